@@ -39,7 +39,7 @@ import stat
 from code_saturne import cs_compile
 from code_saturne import cs_xml_reader
 
-from code_saturne.cs_exec_environment import run_command
+from code_saturne.cs_exec_environment import run_commands
 from code_saturne.cs_exec_environment import enquote_arg, separate_args
 from code_saturne.cs_exec_environment import get_ld_library_path_additions
 from code_saturne.cs_exec_environment import source_syrthes_env
@@ -412,6 +412,7 @@ class domain(base_domain):
 
         self.mesh_dir = None
         self.meshes = None
+        self.preprocess_n_procs = None  # max. concurrent preprocessor runs
 
         # Solver options
 
@@ -985,7 +986,11 @@ class domain(base_domain):
             ld_library_path += ld_library_path_save
             os.environ['LD_LIBRARY_PATH'] = ld_library_path
 
-        # Run once per mesh
+        # Run once per mesh; as meshes are preprocessed independently,
+        # and the solver reads and assembles the resulting files in
+        # parallel, preprocessor instances may run concurrently.
+
+        cmds = []
 
         for m in self.meshes:
 
@@ -1030,8 +1035,6 @@ class domain(base_domain):
                 # code_saturne mesh, no need to run preprocessor
                 self.symlink(mesh_path,
                              os.path.join(self.exec_dir, _outputmesh))
-
-                retcode = 0
             else:
                 # run preprocessor if needed
 
@@ -1050,20 +1053,39 @@ class domain(base_domain):
 
                 cmd.append(mesh_path)
 
-                # Run command
-                retcode = run_command(cmd, pkg=self.package)
+                cmds.append(cmd)
 
-            if retcode != 0:
-                err_str = \
-                    'Error running the preprocessor.\n' \
-                    'Check the preprocessor.log file for details.\n\n'
-                sys.stderr.write(err_str)
+        # Run commands
 
-                self.exec_solver = False
+        retcode = 0
 
-                self.error = 'preprocess'
+        if cmds:
+            n_max = self.preprocess_n_procs
+            if n_max is None:
+                n_max = self.n_procs
+                try:
+                    n_max = min(n_max, os.cpu_count())
+                except Exception:
+                    pass
+            n_max = max(1, min(n_max, len(cmds)))
 
-                break
+            if n_max > 1:
+                print(' Preprocessing ' + str(len(cmds)) + ' meshes using '
+                      + str(n_max) + ' concurrent processes.\n')
+
+            for rc in run_commands(cmds, pkg=self.package, n_max=n_max):
+                if rc != 0:
+                    retcode = rc
+
+        if retcode != 0:
+            err_str = \
+                'Error running the preprocessor.\n' \
+                'Check the preprocessor.log file for details.\n\n'
+            sys.stderr.write(err_str)
+
+            self.exec_solver = False
+
+            self.error = 'preprocess'
 
         # Restore environment
 
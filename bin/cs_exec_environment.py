@@ -665,6 +665,67 @@ def run_command(args, pkg = None, echo = False,
 
 #-------------------------------------------------------------------------------
 
+def run_commands(cmd_list, pkg = None, n_max = 1, env = None):
+    """
+    Run a list of independent commands, with at most n_max commands
+    running concurrently. Return the list of matching return codes.
+    """
+
+    # Modify the PATH for relocatable installation: add Code_Saturne "bindir"
+
+    if pkg != None:
+        if pkg.config.features['relocatable'] == "yes":
+            if sys.platform.startswith("win"):
+                sep = ";"
+            else:
+                sep = ":"
+            saved_path = os.environ['PATH']
+            os.environ['PATH'] = pkg.get_dir('bindir') + sep + saved_path
+
+    n_max = max(1, n_max)
+
+    returncodes = [1]*len(cmd_list)
+    running = []
+
+    for i, args in enumerate(cmd_list):
+
+        # Wait for the oldest running command if the maximum is reached
+
+        if len(running) >= n_max:
+            j, p = running.pop(0)
+            p.communicate()
+            returncodes[j] = p.returncode
+
+        try:
+            p = subprocess.Popen(args,
+                                 universal_newlines=True,
+                                 env=env)
+            running.append((i, p))
+        except Exception as e:
+            import traceback
+            exc_type, exc_value, exc_traceback = sys.exc_info()
+            traceback.print_exception(exc_type, exc_value, exc_traceback,
+                                      limit=2, file=sys.stderr)
+            print("")
+            print("Failed calling subprocess with:")
+            print("  args = " + str(args))
+            print("  env = " + str(env))
+            sys.exit(1)
+
+    for j, p in running:
+        p.communicate()
+        returncodes[j] = p.returncode
+
+    # Reset the PATH to its previous value
+
+    if pkg != None:
+        if pkg.config.features['relocatable'] == "yes":
+            os.environ['PATH'] = saved_path
+
+    return returncodes
+
+#-------------------------------------------------------------------------------
+
 def get_command_output(cmd):
     """
     Run a command and return it's standard output.
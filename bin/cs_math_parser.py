@@ -826,6 +826,12 @@ class cs_math_parser:
         if func_type == "vol":
             req_fields = split_req_components(req)
 
+        # Expressions evaluated in a loop over elements use local
+        # variables private to each element, so that loops may be
+        # vectorized and parallelized.
+        in_loop = func_type in ['vol', 'src', 'ini'] \
+                  or (func_type == 'bnd' and need_for_loop)
+
         # Parse the Mathematical expression and generate the C block code
         exp_lines = expression.split("\n")
         segments = self.separate_segments(exp_lines)
@@ -871,7 +877,10 @@ class cs_math_parser:
             if tk == "=" and t_i > 0:
                 tk0 = tokens[t_i-1][0]
                 if tk0 not in known_symbols:
-                    usr_defs.append('cs_real_t %s = -1.;\n' % tk0)
+                    if in_loop:
+                        usr_code.append('cs_real_t %s = -1.;\n' % tk0)
+                    else:
+                        usr_defs.append('cs_real_t %s = -1.;\n' % tk0)
                     known_symbols.append(tk0)
 
         for t_i, t in enumerate(tokens):
@@ -883,10 +892,16 @@ class cs_math_parser:
                     if fid == None:
                         raise Exception("Uknown field: %s" %(tk))
 
+                    # Output values pointers are hoisted out of the loop
+                    if '_f%d_vals' % (fid) not in known_symbols:
+                        usr_defs.append('cs_real_t *_f%d_vals = f[%d]->val;\n'
+                                        % (fid, fid))
+                        known_symbols.append('_f%d_vals' % (fid))
+
                     if fcomp < 0:
-                        new_v = new_v = 'f[%d]->val[c_id]' % (fid)
+                        new_v = '_f%d_vals[c_id]' % (fid)
                     else:
-                        new_v = 'f[%d]->val[c_id*%d + %d]' % (fid, fdim, fcomp)
+                        new_v = '_f%d_vals[c_id*%d + %d]' % (fid, fdim, fcomp)
 
                 elif func_type == 'bnd':
                     ir = req.index(tk)
@@ -191,6 +191,13 @@ _pkg_glob_struct = {'code_saturne':'cs_glob_fluid_properties',
 
 #---------------------------------------------------------------------------
 
+# Loops over zone elements only use per-element local variables and
+# hoisted global definitions, so they may be run in parallel.
+
+_omp_loop_pragma = '# pragma omp parallel for if (%s > CS_THR_MIN)\n'
+
+#---------------------------------------------------------------------------
+
 _base_tokens = {'dt':'const cs_real_t dt = cs_glob_time_step->dt[0];',
                 't':'const cs_real_t t = cs_glob_time_step->t_cur;',
                 'iter':'const int iter = cs_glob_time_step->nt_cur;',
@@ -486,6 +493,7 @@ class meg_to_c_interpreter:
 
         usr_blck += usr_defs
 
+        usr_blck += _omp_loop_pragma % 'zone->n_elts'
         usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < zone->n_elts; e_id++) {\n'
         usr_blck += 3*tab + 'cs_lnum_t c_id = zone->elt_ids[e_id];\n'
 
@@ -634,6 +642,7 @@ class meg_to_c_interpreter:
         usr_blck += usr_defs
 
         if need_for_loop:
+            usr_blck += _omp_loop_pragma % (val_str)
             usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < %s; e_id++) {\n' % (val_str)
             usr_blck += 3*tab + 'cs_lnum_t %s = %s[e_id];\n' % (elt_id_str, ids_str)
 
@@ -751,6 +760,7 @@ class meg_to_c_interpreter:
 
         usr_blck += usr_defs
 
+        usr_blck += _omp_loop_pragma % 'zone->n_elts'
         usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < zone->n_elts; e_id++) {\n'
         usr_blck += 3*tab + 'cs_lnum_t c_id = zone->elt_ids[e_id];\n'
 
@@ -864,6 +874,7 @@ class meg_to_c_interpreter:
 
         usr_blck += usr_defs
 
+        usr_blck += _omp_loop_pragma % 'zone->n_elts'
         usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < zone->n_elts; e_id++) {\n'
         usr_blck += 3*tab + 'cs_lnum_t c_id = zone->elt_ids[e_id];\n'
 
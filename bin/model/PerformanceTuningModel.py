@@ -256,7 +256,7 @@ class PerformanceTuningModel(Model):
         Set block IO read method if applicable
         """
         self.isInList(m, ('default', 'stdio serial', 'stdio parallel',
-                          'mpi independent', 'mpi noncollective',
+                          'mmap', 'mpi independent', 'mpi noncollective',
                           'mpi collective'))
         if m == 'default':
             node = self.node_io.xmlGetNode('read_method')
@@ -367,7 +367,7 @@ class PerformanceTuningModel(Model):
         """
         Set all to all type.
         """
-        self.isInList(p, ('default', 'crystal router'))
+        self.isInList(p, ('default', 'crystal router', 'automatic'))
         if p == 'default':
             node = self.node_mgt.xmlGetNode('all_to_all')
             if node:
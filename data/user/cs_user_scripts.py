@@ -114,6 +114,15 @@ def define_domain_parameters(domain):
 
     # domain.meshes = None
 
+    # When several meshes are defined, they are preprocessed independently,
+    # so several preprocessor instances may run concurrently; by default,
+    # up to the number of processes of the domain (within the limit of
+    # available cores) are used. As each instance holds the full mesh it
+    # converts, this may be reduced for large meshes, for example:
+    #   domain.preprocess_n_procs = 2
+
+    # domain.preprocess_n_procs = None
+
     # Logging arguments
     #------------------
 
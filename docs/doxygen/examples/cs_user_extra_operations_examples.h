@@ -283,6 +283,17 @@
   components of the pressure drop computation:
   \snippet cs_user_extra_operations-balance_by_zone.c example_6
 
+  \section cs_user_extra_operations_examples_example_7 Balances defined at setup
+
+  When several balances are logged at each time step, it is more efficient
+  to define them once in \ref cs_user_extra_operations_initialize.
+  They are then computed together after each time step, so the gradients
+  of each scalar are computed only once, and all volume zones of a given
+  scalar are handled in a single pass on the mesh. The terms of each balance
+  may be accessed using \ref cs_balance_by_zone_get_terms.
+
+  \snippet cs_user_extra_operations-balance_by_zone.c example_7
+
 */
 // __________________________________________________________________________________
 /*!
@@ -56,6 +56,12 @@
 
   \snippet cs_user_performance_tuning-partition.c performance_tuning_partition_4
 
+  \subsection cs_user_performance_tuning_h_cs_user_performance_tuning_partition_5 Example 5
+
+  \snippet cs_user_performance_tuning-partition.c performance_tuning_partition_weight_func
+
+  \snippet cs_user_performance_tuning-partition.c performance_tuning_partition_5
+
   \section cs_user_performance_tuning_h_cs_user_performance_tuning_parallel_io  Parallel IO
 
   \snippet cs_user_performance_tuning-parallel-io.c perfomance_tuning_parallel_io
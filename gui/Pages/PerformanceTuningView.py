@@ -108,12 +108,13 @@ class PerformanceTuningView(QWidget, Ui_PerformanceTuningForm):
         self.modelPartOut.addItem(self.tr("For graph-based partitioning"), 'default')
         self.modelPartOut.addItem(self.tr("Yes"), 'yes')
 
-        self.modelBlockIORead = ComboModel(self.comboBox_IORead, 6, 1)
+        self.modelBlockIORead = ComboModel(self.comboBox_IORead, 7, 1)
         self.modelBlockIOWrite = ComboModel(self.comboBox_IOWrite, 4, 1)
 
         self.modelBlockIORead.addItem(self.tr("Default"), 'default')
         self.modelBlockIORead.addItem(self.tr("Standard I/O, serial"), 'stdio serial')
         self.modelBlockIORead.addItem(self.tr("Standard I/O, parallel"), 'stdio parallel')
+        self.modelBlockIORead.addItem(self.tr("Memory-mapped, parallel"), 'mmap')
         self.modelBlockIORead.addItem(self.tr("MPI I/O, independent"), 'mpi independent')
         self.modelBlockIORead.addItem(self.tr("MPI I/O, non-collective"), 'mpi noncollective')
         self.modelBlockIORead.addItem(self.tr("MPI I/O, collective"), 'mpi collective')
@@ -123,10 +124,11 @@ class PerformanceTuningView(QWidget, Ui_PerformanceTuningForm):
         self.modelBlockIOWrite.addItem(self.tr("MPI I/O, non-collective"), 'mpi noncollective')
         self.modelBlockIOWrite.addItem(self.tr("MPI I/O, collective"), 'mpi collective')
 
-        self.modelAllToAll = ComboModel(self.comboBox_AllToAll, 2, 1)
+        self.modelAllToAll = ComboModel(self.comboBox_AllToAll, 3, 1)
 
         self.modelAllToAll.addItem(self.tr("Default (MPI_Alltoall/MPI_Alltoallv)"), 'default')
         self.modelAllToAll.addItem(self.tr("Crystal Router"), 'crystal router')
+        self.modelAllToAll.addItem(self.tr("Automatic (per exchange)"), 'automatic')
 
         # Validators
 
@@ -109,6 +109,37 @@ typedef struct {
 
 } _rank_intersects_t;
 
+#if defined(PLE_HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Structure defining a pending (split-phase) point variable exchange
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  void              *distant_var;   /* Variable defined on distant points */
+  void              *local_var;     /* Variable defined on local points */
+  const ple_lnum_t  *local_list;    /* Optional indirection for local_var */
+
+  MPI_Datatype       datatype;      /* Variable type */
+  int                size;          /* Size of variable type */
+  size_t             stride;        /* Variable dimension */
+  _Bool              reverse;       /* Is exchange reversed ? */
+
+  int               *loc_v_flag;    /* Received data flag per distant rank */
+  int               *dist_v_flag;   /* Sent data flag per distant rank */
+  unsigned char     *loc_v_buf;     /* Local points exchange buffer */
+
+  MPI_Request       *request;       /* Flag requests (2 per distant rank),
+                                       followed by data requests
+                                       (2 per distant rank) */
+
+  double             comm_timing[4]; /* Communication timing */
+
+} _ple_locator_exchange_t;
+
+#endif /* defined(PLE_HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Structure defining a locator
  *----------------------------------------------------------------------------*/
@@ -165,6 +196,11 @@ struct _ple_locator_t {
   double  location_cpu_time[2];    /* Location CPU time */
   double  exchange_wtime[2];       /* Variable exchange Wall-clock time */
   double  exchange_cpu_time[2];    /* Variable exchange CPU time */
+
+#if defined(PLE_HAVE_MPI)
+  _ple_locator_exchange_t  *exchange;  /* Pending split-phase exchange,
+                                          or NULL */
+#endif
 };
 
 /*============================================================================
@@ -670,6 +706,8 @@ _point_extents(int                  dim,
 static void
 _clear_location_info(ple_locator_t  *this_locator)
 {
+  ple_locator_exchange_point_var_wait(this_locator);
+
   this_locator->n_intersects = 0;
 
   PLE_FREE(this_locator->intersect_rank);
@@ -2275,16 +2313,98 @@ _exchange_point_var_distant(ple_locator_t     *this_locator,
 }
 
 /*----------------------------------------------------------------------------
- * Distribute variable defined on distant points to processes owning
- * the original points (i.e. distant processes).
+ * Check coherency of exchange flags received from distant ranks.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   loc_v_flag    <-- 1 for distant ranks sending data, 0 otherwise
+ *   local_var     <-- variable defined on local points
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_exchange_flags(const ple_locator_t  *this_locator,
+                      const int             loc_v_flag[],
+                      const void           *local_var)
+{
+  for (int i = 0; i < this_locator->n_intersects; i++) {
+
+    int dist_rank = this_locator->intersect_rank[i];
+
+    ple_lnum_t n_points_loc =   this_locator->local_points_idx[i+1]
+                              - this_locator->local_points_idx[i];
+
+    if (loc_v_flag[i] == 1 && (local_var == NULL || n_points_loc == 0))
+      ple_error(__FILE__, __LINE__, 0,
+                _("Incoherent arguments to different instances in "
+                  "_exchange_point_var().\n"
+                  "Send and receive operations do not match "
+                  "(dist_rank = %d\n)\n"), dist_rank);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Copy variable values between local points and a contiguous exchange
+ * buffer (ordered by distant rank).
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   ex            <-> pending exchange structure
+ *   to_buffer     <-- if true, copy local_var to buffer, otherwise
+ *                     copy buffer to local_var
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_buffer_copy(const ple_locator_t             *this_locator,
+                      const _ple_locator_exchange_t   *ex,
+                      _Bool                            to_buffer)
+{
+  const size_t nbytes = ex->stride*ex->size;
+  const ple_lnum_t idb = this_locator->point_id_base;
+
+  unsigned char *loc_v_ptr = ex->loc_v_buf;
+
+  for (int i = 0; i < this_locator->n_intersects; i++) {
+
+    const ple_lnum_t *_local_point_ids
+      = this_locator->local_point_ids + this_locator->local_points_idx[i];
+
+    ple_lnum_t n_points_loc =    this_locator->local_points_idx[i+1]
+                               - this_locator->local_points_idx[i];
+
+    if (ex->loc_v_flag[i] > 0) {
+      for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+        ple_lnum_t p_id = _local_point_ids[k];
+        if (ex->local_list != NULL)
+          p_id = ex->local_list[p_id] - idb;
+        unsigned char *local_v_p = (unsigned char *)ex->local_var + p_id*nbytes;
+        unsigned char *loc_v_buf_p = loc_v_ptr + k*nbytes;
+        if (to_buffer)
+          memcpy(loc_v_buf_p, local_v_p, nbytes);
+        else
+          memcpy(local_v_p, loc_v_buf_p, nbytes);
+      }
+    }
+
+    loc_v_ptr += n_points_loc*nbytes;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Start distribution of variable defined on distant points to processes
+ * owning the original points (i.e. distant processes).
  *
  * The exchange is symmetric if both variables are defined, receive
  * only if distant_var is NULL, or send only if local_var is NULL.
  *
- * This variant of the function uses asynchronous MPI calls.
+ * This variant of the function uses asynchronous MPI calls, and only
+ * posts the matching requests (except for the exchange of send/receive
+ * flags in reverse mode), so the exchange must be completed using
+ * _exchange_point_var_distant_asyn_wait(). Variables must not be
+ * modified or freed until the exchange is completed.
  *
  * parameters:
- *   this_locator  <-- pointer to locator structure
+ *   this_locator  <-> pointer to locator structure
  *   distant_var   <-> variable defined on distant points (ready to send)
  *   local_var     <-> variable defined on local points (received)
  *   local_list    <-- optional indirection list for local_var
@@ -2296,27 +2416,16 @@ _exchange_point_var_distant(ple_locator_t     *this_locator,
  *----------------------------------------------------------------------------*/
 
 static void
-_exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
-                                 void              *distant_var,
-                                 void              *local_var,
-                                 const ple_lnum_t  *local_list,
-                                 MPI_Datatype       datatype,
-                                 size_t             stride,
-                                 _Bool              reverse)
+_exchange_point_var_distant_asyn_start(ple_locator_t     *this_locator,
+                                       void              *distant_var,
+                                       void              *local_var,
+                                       const ple_lnum_t  *local_list,
+                                       MPI_Datatype       datatype,
+                                       size_t             stride,
+                                       _Bool              reverse)
 {
-  int i, dist_v_count, loc_v_count, size;
-  int dist_rank;
-  ple_lnum_t n_points_loc, n_points_loc_tot, n_points_dist;
-  size_t dist_v_idx;
-  unsigned char *dist_v_ptr, *loc_v_ptr;
-
+  int size;
   MPI_Aint lb, extent;
-  void *loc_v_buf = NULL;
-  int *dist_v_flag = NULL, *loc_v_flag = NULL;
-  MPI_Status *status = NULL;
-  MPI_Request *request = NULL;
-
-  double comm_timing[4] = {0., 0., 0., 0.};
 
   /* Check extent of datatype */
 
@@ -2333,289 +2442,219 @@ _exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
                 "MPI datatypes associated with structures using padding\n"
                 "(for which size != extent)."));
 
-  /* Initialization */
-
-  n_points_loc_tot
-    = this_locator->local_points_idx[this_locator->n_intersects];
+  if (this_locator->exchange != NULL)
+    ple_error(__FILE__, __LINE__, 0,
+              _("A split-phase point variable exchange is already pending\n"
+                "for this locator; it must be completed using\n"
+                "ple_locator_exchange_point_var_wait()."));
 
-  PLE_MALLOC(loc_v_flag, this_locator->n_intersects, int);
-  PLE_MALLOC(dist_v_flag, this_locator->n_intersects, int);
-  PLE_MALLOC(request, this_locator->n_intersects*2, MPI_Request);
-  PLE_MALLOC(status, this_locator->n_intersects*2, MPI_Status);
+  /* Initialization */
 
-  PLE_MALLOC(loc_v_buf, n_points_loc_tot*size*stride, char);
+  const int n_intersects = this_locator->n_intersects;
+  const ple_lnum_t n_points_loc_tot
+    = this_locator->local_points_idx[n_intersects];
 
-  /* First loop on distant ranks for argument checks */
-  /*-------------------------------------------------*/
+  _ple_locator_exchange_t *ex;
+  PLE_MALLOC(ex, 1, _ple_locator_exchange_t);
 
-  _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+  ex->distant_var = distant_var;
+  ex->local_var = local_var;
+  ex->local_list = local_list;
+  ex->datatype = datatype;
+  ex->size = size;
+  ex->stride = stride;
+  ex->reverse = reverse;
 
-  for (i = 0; i < this_locator->n_intersects; i++) {
+  for (int i = 0; i < 4; i++)
+    ex->comm_timing[i] = 0.;
 
-    dist_rank = this_locator->intersect_rank[i];
+  PLE_MALLOC(ex->loc_v_flag, n_intersects, int);
+  PLE_MALLOC(ex->dist_v_flag, n_intersects, int);
+  PLE_MALLOC(ex->request, n_intersects*4, MPI_Request);
+  PLE_MALLOC(ex->loc_v_buf, n_points_loc_tot*size*stride, unsigned char);
 
-    n_points_dist =   this_locator->distant_points_idx[i+1]
-                    - this_locator->distant_points_idx[i];
+  this_locator->exchange = ex;
 
-    if (distant_var != NULL && n_points_dist > 0)
-      dist_v_flag[i] = 1;
-    else
-      dist_v_flag[i] = 0;
+  MPI_Request *f_request = ex->request;
+  MPI_Request *v_request = ex->request + n_intersects*2;
 
-    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
-
-    MPI_Irecv(loc_v_flag + i, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
-              this_locator->comm, &request[i*2]);
-    MPI_Isend(dist_v_flag + i, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
-              this_locator->comm, &request[i*2+1]);
-  }
-
-  MPI_Waitall(this_locator->n_intersects*2, request, status);
+  /* Post exchange of flags */
+  /*------------------------*/
 
-  _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+  _locator_trace_start_comm(_ple_locator_log_start_p_comm, ex->comm_timing);
 
-  PLE_FREE(dist_v_flag);
+  for (int i = 0; i < n_intersects; i++) {
 
-  for (i = 0; i < this_locator->n_intersects; i++) {
+    int dist_rank = this_locator->intersect_rank[i];
 
-    dist_rank = this_locator->intersect_rank[i];
+    ple_lnum_t n_points_dist =   this_locator->distant_points_idx[i+1]
+                               - this_locator->distant_points_idx[i];
 
-    n_points_loc =   this_locator->local_points_idx[i+1]
-                   - this_locator->local_points_idx[i];
+    if (distant_var != NULL && n_points_dist > 0)
+      ex->dist_v_flag[i] = 1;
+    else
+      ex->dist_v_flag[i] = 0;
 
-    if (loc_v_flag[i] == 1 && (local_var == NULL || n_points_loc == 0))
-      ple_error(__FILE__, __LINE__, 0,
-                _("Incoherent arguments to different instances in "
-                  "_exchange_point_var().\n"
-                  "Send and receive operations do not match "
-                  "(dist_rank = %d\n)\n"), dist_rank);
+    MPI_Irecv(ex->loc_v_flag + i, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
+              this_locator->comm, &f_request[i*2]);
+    MPI_Isend(ex->dist_v_flag + i, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
+              this_locator->comm, &f_request[i*2+1]);
   }
 
-  /* Loop on distant ranks for exchange of data in standard mode */
-  /*-------------------------------------------------------------*/
-
-  if (reverse == false) {
-
-    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
-
-    loc_v_ptr = loc_v_buf;
-
-    for (i = 0; i < this_locator->n_intersects; i++) {
-
-      dist_rank = this_locator->intersect_rank[i];
-
-      n_points_loc =    this_locator->local_points_idx[i+1]
-                      - this_locator->local_points_idx[i];
-
-      n_points_dist =   this_locator->distant_points_idx[i+1]
-                      - this_locator->distant_points_idx[i];
-
-      dist_v_idx = this_locator->distant_points_idx[i] * stride*size;
-
-      if (distant_var != NULL)
-        dist_v_count = n_points_dist * stride;
-      else
-        dist_v_count = 0;
+  /* In reverse mode, the amount of data to send depends on flags,
+     so they must be known before posting data exchange */
 
-      if (loc_v_flag[i] > 0)
-        loc_v_count = n_points_loc*stride;
-      else
-        loc_v_count = 0;
+  if (reverse) {
 
-      /* Exchange information */
+    MPI_Waitall(n_intersects*2, f_request, MPI_STATUSES_IGNORE);
 
-      if (distant_var != NULL)
-        dist_v_ptr = ((unsigned char *)distant_var) + dist_v_idx;
-      else
-        dist_v_ptr = NULL;
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, ex->comm_timing);
 
-      MPI_Irecv(loc_v_ptr, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
-                this_locator->comm, &request[i*2]);
-      MPI_Isend(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
-                this_locator->comm, &request[i*2+1]);
+    _check_exchange_flags(this_locator, ex->loc_v_flag, local_var);
 
-      loc_v_ptr += loc_v_count*size;
-    }
+    _exchange_buffer_copy(this_locator, ex, true);
 
-    MPI_Waitall(this_locator->n_intersects*2, request, status);
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, ex->comm_timing);
 
-    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
   }
 
-  /* Loop on distant ranks for preparation or retrieval of buffer data */
-  /*-------------------------------------------------------------------*/
-
-  loc_v_ptr = loc_v_buf;
-
-  for (i = 0; i < this_locator->n_intersects; i++) {
-
-    const ple_lnum_t *_local_point_ids
-      = this_locator->local_point_ids + this_locator->local_points_idx[i];
+  /* Post exchange of data */
+  /*-----------------------*/
 
-    dist_rank = this_locator->intersect_rank[i];
-
-    n_points_loc =    this_locator->local_points_idx[i+1]
-      - this_locator->local_points_idx[i];
-
-    n_points_dist =   this_locator->distant_points_idx[i+1]
-                    - this_locator->distant_points_idx[i];
-
-    dist_v_idx = this_locator->distant_points_idx[i] * stride*size;
-
-    if (distant_var != NULL)
-      dist_v_count = n_points_dist * stride;
-    else
-      dist_v_count = 0;
+  unsigned char *loc_v_ptr = ex->loc_v_buf;
 
-    if (loc_v_flag[i] > 0)
-      loc_v_count = n_points_loc*stride;
-    else
-      loc_v_count = 0;
+  for (int i = 0; i < n_intersects; i++) {
 
-    /* Exchange information */
+    int dist_rank = this_locator->intersect_rank[i];
 
-    if (distant_var != NULL)
-      dist_v_ptr = ((unsigned char *)distant_var) + dist_v_idx;
-    else
-      dist_v_ptr = NULL;
+    ple_lnum_t n_points_loc =    this_locator->local_points_idx[i+1]
+                               - this_locator->local_points_idx[i];
 
-    dist_rank = this_locator->intersect_rank[i];
+    ple_lnum_t n_points_dist =   this_locator->distant_points_idx[i+1]
+                               - this_locator->distant_points_idx[i];
 
-    n_points_loc =    this_locator->local_points_idx[i+1]
-                    - this_locator->local_points_idx[i];
+    size_t dist_v_idx = this_locator->distant_points_idx[i] * stride*size;
 
-    n_points_dist =   this_locator->distant_points_idx[i+1]
-                    - this_locator->distant_points_idx[i];
+    int dist_v_count = (distant_var != NULL) ? n_points_dist*stride : 0;
+    unsigned char *dist_v_ptr = (distant_var != NULL) ?
+      ((unsigned char *)distant_var) + dist_v_idx : NULL;
 
     if (reverse == false) {
 
-      if (loc_v_flag[i] > 0) {
-        if (local_list == NULL) {
-          int k;
-          size_t l;
-          const size_t nbytes = stride*size;
-          for (k = 0; k < n_points_loc; k++) {
-            char *local_v_p = (char *)local_var + _local_point_ids[k]*nbytes;
-            const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
-            for (l = 0; l < nbytes; l++)
-              local_v_p[l] = loc_v_buf_p[l];
-          }
-        }
-        else {
-          int k;
-          size_t l;
-          const size_t nbytes = stride*size;
-          const ple_lnum_t idb = this_locator->point_id_base;
-          for (k = 0; k < n_points_loc; k++) {
-            char *local_v_p =   (char *)local_var
-                              + (local_list[_local_point_ids[k]] - idb)*nbytes;
-            const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
-            for (l = 0; l < nbytes; l++)
-              local_v_p[l] = loc_v_buf_p[l];
-          }
-        }
-      }
-
-    }
-    else { /* if (reverse == true) */
+      /* Flags are not known yet, so post reception for all
+         local points (a smaller message may be received) */
 
-      if (loc_v_flag[i] > 0) {
-        if (local_list == NULL) {
-          int k;
-          size_t l;
-          const size_t nbytes = stride*size;
-          for (k = 0; k < n_points_loc; k++) {
-            const char *local_v_p
-              = (const char *)local_var + _local_point_ids[k]*nbytes;
-            char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
-            for (l = 0; l < nbytes; l++)
-              loc_v_buf_p[l] = local_v_p[l];
-          }
-        }
-        else {
-          int k;
-          size_t l;
-          const size_t nbytes = stride*size;
-          const ple_lnum_t idb = this_locator->point_id_base;
-          for (k = 0; k < n_points_loc; k++) {
-            const char *local_v_p
-              = (const char *)local_var
-                + (local_list[_local_point_ids[k]] - idb)*nbytes;
-            char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
-            for (l = 0; l < nbytes; l++)
-              loc_v_buf_p[l] = local_v_p[l];
-          }
-        }
-      }
+      MPI_Irecv(loc_v_ptr, n_points_loc*stride, datatype, dist_rank,
+                PLE_MPI_TAG, this_locator->comm, &v_request[i*2]);
+      MPI_Isend(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &v_request[i*2+1]);
 
     }
+    else {
 
-    loc_v_ptr += loc_v_count*size;
-
-  }
-
-  /* Loop on distant ranks for exchange of data in reverse mode */
-  /*------------------------------------------------------------*/
-
-  if (reverse == true) {
-
-    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
-
-    loc_v_ptr = loc_v_buf;
-
-    for (i = 0; i < this_locator->n_intersects; i++) {
+      int loc_v_count = (ex->loc_v_flag[i] > 0) ? n_points_loc*stride : 0;
 
-      dist_rank = this_locator->intersect_rank[i];
+      MPI_Irecv(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &v_request[i*2]);
+      MPI_Isend(loc_v_ptr, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &v_request[i*2+1]);
 
-      n_points_loc =    this_locator->local_points_idx[i+1]
-                      - this_locator->local_points_idx[i];
+    }
 
-      n_points_dist =   this_locator->distant_points_idx[i+1]
-                      - this_locator->distant_points_idx[i];
+    loc_v_ptr += n_points_loc*stride*size;
+  }
 
-      dist_v_idx = this_locator->distant_points_idx[i] * stride*size;
+  _locator_trace_end_comm(_ple_locator_log_end_p_comm, ex->comm_timing);
+}
 
-      if (distant_var != NULL)
-        dist_v_count = n_points_dist * stride;
-      else
-        dist_v_count = 0;
+/*----------------------------------------------------------------------------
+ * Complete a pending distribution of variable started with
+ * _exchange_point_var_distant_asyn_start().
+ *
+ * parameters:
+ *   this_locator  <-> pointer to locator structure
+ *----------------------------------------------------------------------------*/
 
-      if (loc_v_flag[i] > 0)
-        loc_v_count = n_points_loc*stride;
-      else
-        loc_v_count = 0;
+static void
+_exchange_point_var_distant_asyn_wait(ple_locator_t  *this_locator)
+{
+  _ple_locator_exchange_t *ex = this_locator->exchange;
 
-      /* Exchange information */
+  if (ex == NULL)
+    return;
 
-      if (distant_var != NULL)
-        dist_v_ptr = ((unsigned char *)distant_var) + dist_v_idx;
-      else
-        dist_v_ptr = NULL;
+  const int n_intersects = this_locator->n_intersects;
 
-      MPI_Irecv(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
-                this_locator->comm, &request[i*2]);
-      MPI_Isend(loc_v_buf, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
-                this_locator->comm, &request[i*2+1]);
+  _locator_trace_start_comm(_ple_locator_log_start_p_comm, ex->comm_timing);
 
-      loc_v_ptr += loc_v_count*size;
-    }
+  if (ex->reverse)
+    MPI_Waitall(n_intersects*2,
+                ex->request + n_intersects*2,
+                MPI_STATUSES_IGNORE);
+  else
+    MPI_Waitall(n_intersects*4, ex->request, MPI_STATUSES_IGNORE);
 
-    MPI_Waitall(this_locator->n_intersects*2, request, status);
+  _locator_trace_end_comm(_ple_locator_log_end_p_comm, ex->comm_timing);
 
-    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+  /* Retrieve data in standard mode */
 
+  if (ex->reverse == false) {
+    _check_exchange_flags(this_locator, ex->loc_v_flag, ex->local_var);
+    _exchange_buffer_copy(this_locator, ex, false);
   }
 
   /* Free temporary arrays */
 
-  PLE_FREE(loc_v_buf);
+  PLE_FREE(ex->loc_v_buf);
+  PLE_FREE(ex->request);
+  PLE_FREE(ex->dist_v_flag);
+  PLE_FREE(ex->loc_v_flag);
 
-  PLE_FREE(loc_v_flag);
-  PLE_FREE(request);
-  PLE_FREE(status);
+  this_locator->exchange_wtime[1] += ex->comm_timing[0];
+  this_locator->exchange_cpu_time[1] += ex->comm_timing[1];
 
-  this_locator->exchange_wtime[1] += comm_timing[0];
-  this_locator->exchange_cpu_time[1] += comm_timing[1];
+  PLE_FREE(this_locator->exchange);
+}
+
+/*----------------------------------------------------------------------------
+ * Distribute variable defined on distant points to processes owning
+ * the original points (i.e. distant processes).
+ *
+ * The exchange is symmetric if both variables are defined, receive
+ * only if distant_var is NULL, or send only if local_var is NULL.
+ *
+ * This variant of the function uses asynchronous MPI calls.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *   local_var     <-> variable defined on local points (received)
+ *   local_list    <-- optional indirection list for local_var
+ *   datatype      <-- variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if true, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
+                                 void              *distant_var,
+                                 void              *local_var,
+                                 const ple_lnum_t  *local_list,
+                                 MPI_Datatype       datatype,
+                                 size_t             stride,
+                                 _Bool              reverse)
+{
+  _exchange_point_var_distant_asyn_start(this_locator,
+                                         distant_var,
+                                         local_var,
+                                         local_list,
+                                         datatype,
+                                         stride,
+                                         reverse);
+
+  _exchange_point_var_distant_asyn_wait(this_locator);
 }
 
 #endif /* defined(PLE_HAVE_MPI) */
@@ -2802,6 +2841,7 @@ ple_locator_create(void)
   this_locator->comm = comm;
   this_locator->n_ranks = n_ranks;
   this_locator->start_rank = start_rank;
+  this_locator->exchange = NULL;
 #else
   this_locator->n_ranks = 1;
   this_locator->start_rank = 0;
@@ -2858,6 +2898,10 @@ ple_locator_destroy(ple_locator_t  *this_locator)
 {
   if (this_locator != NULL) {
 
+#if defined(PLE_HAVE_MPI)
+    ple_locator_exchange_point_var_wait(this_locator);
+#endif
+
     PLE_FREE(this_locator->local_points_idx);
     PLE_FREE(this_locator->distant_points_idx);
 
@@ -3506,6 +3550,10 @@ ple_locator_exchange_point_var(ple_locator_t     *this_locator,
 
     MPI_Datatype datatype = MPI_DATATYPE_NULL;
 
+    /* Complete pending split-phase exchange first, if present */
+
+    _exchange_point_var_distant_asyn_wait(this_locator);
+
     if (type_size == sizeof(double))
       datatype = MPI_DOUBLE;
     else if (type_size == sizeof(float))
@@ -3557,6 +3605,147 @@ ple_locator_exchange_point_var(ple_locator_t     *this_locator,
   this_locator->exchange_cpu_time[0] += (cpu_end - cpu_start);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start distribution of variable defined on distant points to
+ * processes owning the original points (i.e. distant processes).
+ *
+ * This is the split-phase variant of ple_locator_exchange_point_var(),
+ * whose arguments it shares. Communication requests are posted, and the
+ * exchange must be completed by a matching call to
+ * ple_locator_exchange_point_var_wait(), allowing computation to be
+ * overlapped with communication. Only one split-phase exchange may be
+ * pending at a given time for a given locator.
+ *
+ * The distant_var[] and local_var[] arrays must not be modified (nor
+ * freed) until the exchange is completed.
+ *
+ * In non-reverse mode, this function does not block. In reverse mode,
+ * it waits for the exchange of send/receive flags with the distant
+ * processes, as the amount of data sent depends on those flags.
+ * If MPI is not used, the exchange is completed by this function.
+ *
+ * \param[in]      this_locator pointer to locator structure
+ * \param[in, out] distant_var  variable defined on distant points
+ *                              (ready to send); size: n_dist_points*stride
+ * \param[in, out] local_var    variable defined on located local points
+ *                              (received); size: n_interior*stride
+ * \param[in]      local_list   optional indirection list for local_var
+ * \param[in]      type_size    sizeof (float or double) variable type
+ * \param[in]      stride       dimension (1 for scalar,
+ *                              3 for interleaved vector)
+ * \param[in]      reverse      if nonzero, exchange is reversed
+ *                              (receive values associated with distant points
+ *                              from the processes owning the original points)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_start(ple_locator_t     *this_locator,
+                                     void              *distant_var,
+                                     void              *local_var,
+                                     const ple_lnum_t  *local_list,
+                                     size_t             type_size,
+                                     size_t             stride,
+                                     int                reverse)
+{
+  double w_start, w_end, cpu_start, cpu_end;
+
+  int mpi_flag = 0;
+  _Bool _reverse = reverse;
+
+  /* Initialize timing */
+
+  w_start = ple_timer_wtime();
+  cpu_start = ple_timer_cpu_time();
+
+#if defined(PLE_HAVE_MPI)
+
+  MPI_Initialized(&mpi_flag);
+
+  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
+    mpi_flag = 0;
+
+  if (mpi_flag) {
+
+    MPI_Datatype datatype = MPI_DATATYPE_NULL;
+
+    if (type_size == sizeof(double))
+      datatype = MPI_DOUBLE;
+    else if (type_size == sizeof(float))
+      datatype = MPI_FLOAT;
+    else
+      ple_error(__FILE__, __LINE__, 0,
+                _("type_size passed to "
+                  "ple_locator_exchange_point_var_start() does\n"
+                  "not correspond to double or float."));
+
+    assert (datatype != MPI_DATATYPE_NULL);
+
+    _exchange_point_var_distant_asyn_start(this_locator,
+                                           distant_var,
+                                           local_var,
+                                           local_list,
+                                           datatype,
+                                           stride,
+                                           _reverse);
+
+  }
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+  if (!mpi_flag)
+    _exchange_point_var_local(this_locator,
+                              distant_var,
+                              local_var,
+                              local_list,
+                              type_size,
+                              stride,
+                              _reverse);
+
+  /* Finalize timing */
+
+  w_end = ple_timer_wtime();
+  cpu_end = ple_timer_cpu_time();
+
+  this_locator->exchange_wtime[0] += (w_end - w_start);
+  this_locator->exchange_cpu_time[0] += (cpu_end - cpu_start);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete a pending distribution of variable started by
+ * ple_locator_exchange_point_var_start().
+ *
+ * If no exchange is pending, this function does nothing.
+ *
+ * \param[in, out] this_locator pointer to locator structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_wait(ple_locator_t  *this_locator)
+{
+#if defined(PLE_HAVE_MPI)
+
+  if (this_locator->exchange == NULL)
+    return;
+
+  double w_start = ple_timer_wtime();
+  double cpu_start = ple_timer_cpu_time();
+
+  _exchange_point_var_distant_asyn_wait(this_locator);
+
+  this_locator->exchange_wtime[0] += (ple_timer_wtime() - w_start);
+  this_locator->exchange_cpu_time[0] += (ple_timer_cpu_time() - cpu_start);
+
+#else
+
+  PLE_UNUSED(this_locator);
+
+#endif /* defined(PLE_HAVE_MPI) */
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return timing information.
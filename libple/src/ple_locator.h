@@ -463,6 +463,53 @@ ple_locator_exchange_point_var(ple_locator_t     *this_locator,
                                size_t             stride,
                                int                reverse);
 
+/*----------------------------------------------------------------------------
+ * Start distribution of variable defined on distant points to processes
+ * owning the original points (i.e. distant processes).
+ *
+ * This is the split-phase variant of ple_locator_exchange_point_var(),
+ * whose arguments it shares; the exchange must be completed by a matching
+ * call to ple_locator_exchange_point_var_wait(). Only one split-phase
+ * exchange may be pending at a given time for a given locator, and
+ * the distant_var[] and local_var[] arrays must not be modified until
+ * the exchange is completed.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *                     size: n_dist_points*stride
+ *   local_var     <-> variable defined on located local points (received)
+ *                     size: n_interior*stride
+ *   local_list    <-- optional indirection list for local_var
+ *   type_size     <-- sizeof (float or double) variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if nonzero, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_start(ple_locator_t     *this_locator,
+                                     void              *distant_var,
+                                     void              *local_var,
+                                     const ple_lnum_t  *local_list,
+                                     size_t             type_size,
+                                     size_t             stride,
+                                     int                reverse);
+
+/*----------------------------------------------------------------------------
+ * Complete a pending distribution of variable started by
+ * ple_locator_exchange_point_var_start().
+ *
+ * If no exchange is pending, this function does nothing.
+ *
+ * parameters:
+ *   this_locator  <-> pointer to locator structure
+ *----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_wait(ple_locator_t  *this_locator);
+
 /*----------------------------------------------------------------------------
  * Return timing information.
  *
@@ -0,0 +1,172 @@
+dnl--------------------------------------------------------------------------------
+dnl
+dnl This file is part of Code_Saturne, a general-purpose CFD tool.
+dnl
+dnl Copyright (C) 1998-2021 EDF S.A.
+dnl
+dnl This program is free software; you can redistribute it and/or modify it under
+dnl the terms of the GNU General Public License as published by the Free Software
+dnl Foundation; either version 2 of the License, or (at your option) any later
+dnl version.
+dnl
+dnl This program is distributed in the hope that it will be useful, but WITHOUT
+dnl ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+dnl FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+dnl details.
+dnl
+dnl You should have received a copy of the GNU General Public License along with
+dnl this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+dnl Street, Fifth Floor, Boston, MA 02110-1301, USA.
+dnl
+dnl--------------------------------------------------------------------------------
+
+# CS_AC_TEST_ADIOS2
+#------------------
+# modifies or sets cs_have_adios2, ADIOS2_CPPFLAGS, ADIOS2_LDFLAGS,
+# and ADIOS2_LIBS depending on libraries found
+
+AC_DEFUN([CS_AC_TEST_ADIOS2], [
+
+cs_have_adios2=no
+cs_have_plugin_adios2=yes
+
+# Configure options for ADIOS2 paths
+#-----------------------------------
+
+AC_ARG_WITH(adios2,
+            [AS_HELP_STRING([--with-adios2=PATH],
+                            [specify prefix directory for ADIOS2])],
+            [if test "x$withval" = "x"; then
+               with_adios2=yes
+             fi],
+            [with_adios2=no])
+
+AC_ARG_WITH(adios2-include,
+            [AS_HELP_STRING([--with-adios2-include=DIR],
+                            [specify directory for ADIOS2 include files])],
+            [if test "x$with_adios2" = "xcheck" -o "x$with_adios2" = "xno"; then
+               with_adios2=yes
+             fi
+             ADIOS2_CPPFLAGS="-I$with_adios2_include"],
+            [if test "x$with_adios2" != "xno" -a "x$with_adios2" != "xyes" \
+	          -a "x$with_adios2" != "xcheck"; then
+               ADIOS2_CPPFLAGS="-I$with_adios2/include"
+             fi])
+
+AC_ARG_WITH(adios2-lib,
+            [AS_HELP_STRING([--with-adios2-lib=DIR],
+                            [specify directory for ADIOS2 library])],
+            [if test "x$with_adios2" = "xcheck" -o "x$with_adios2" = "xno"; then
+               with_adios2=yes
+             fi
+             ADIOS2_LDFLAGS="-L$with_adios2_lib"
+             # Add the libdir to the runpath as ADIOS2 is not libtoolized
+             ADIOS2RUNPATH="-R$with_adios2_lib"],
+            [if test "x$with_adios2" != "xno" -a "x$with_adios2" != "xyes" \
+	          -a "x$with_adios2" != "xcheck"; then
+               if test -d "$with_adios2/lib64" ; then
+                 ADIOS2_LDFLAGS="-L$with_adios2/lib64"
+                 ADIOS2RUNPATH="-R$with_adios2/lib64"
+               else
+                 ADIOS2_LDFLAGS="-L$with_adios2/lib"
+                 ADIOS2RUNPATH="-R$with_adios2/lib"
+               fi
+             fi])
+
+AC_ARG_ENABLE(adios2-as-plugin,
+  [AS_HELP_STRING([--disable-adios2-as-plugin], [do not use ADIOS2 as plugin])],
+  [
+    case "${enableval}" in
+      yes) cs_have_plugin_adios2=yes ;;
+      no)  cs_have_plugin_adios2=no ;;
+      *)   AC_MSG_ERROR([bad value ${enableval} for --enable-adios2-as-plugin]) ;;
+    esac
+  ],
+  [ cs_have_plugin_adios2=yes ]
+)
+
+if test x$cs_have_dlloader = xno -o x$enable_shared = xno ; then
+  cs_have_plugin_adios2=no
+fi
+
+# Now check for libraries
+#------------------------
+
+if test "x$with_adios2" != "xno" ; then
+
+  saved_CPPFLAGS="$CPPFLAGS"
+  saved_LDFLAGS="$LDFLAGS"
+  saved_LIBS="$LIBS"
+
+  if test "x$cs_have_mpi" != "xno"; then
+    ADIOS2_LIBS="-ladios2_c_mpi -ladios2_c -ladios2_core_mpi -ladios2_core"
+    AC_MSG_CHECKING([for ADIOS2 library (with MPI)])
+  else
+    ADIOS2_LIBS="-ladios2_c -ladios2_core"
+    AC_MSG_CHECKING([for ADIOS2 library])
+  fi
+
+  CPPFLAGS="${CPPFLAGS} ${ADIOS2_CPPFLAGS} ${MPI_CPPFLAGS}"
+  LDFLAGS="${LDFLAGS} ${ADIOS2_LDFLAGS} ${MPI_LDFLAGS}"
+  LIBS="${ADIOS2_LIBS} ${MPI_LIBS} ${LIBS}"
+
+  AC_LINK_IFELSE([AC_LANG_PROGRAM(
+[[#include <adios2_c.h>]],
+[[adios2_adios *adios = adios2_init_serial();
+  (void)adios2_declare_io(adios, "test");
+  (void)adios2_finalize(adios); ]])],
+                 [cs_have_adios2=yes],
+                 [cs_have_adios2=no])
+
+  AC_MSG_RESULT($cs_have_adios2)
+
+  # Report ADIOS2 support
+  #----------------------
+
+  if test "x$cs_have_adios2" = "xyes" ; then
+    AC_DEFINE([HAVE_ADIOS2], 1, [ADIOS2 output support])
+    if test x$cs_have_plugin_adios2 = xyes ; then
+      AC_DEFINE([HAVE_PLUGIN_ADIOS2], 1, [ADIOS2 output support as plugin])
+    fi
+  elif test "x$cs_have_adios2" = "xno" ; then
+    if test "x$with_adios2" != "xcheck" ; then
+      AC_MSG_FAILURE([ADIOS2 output support requested, but test for ADIOS2 failed!])
+    else
+      AC_MSG_WARN([no ADIOS2 output support])
+    fi
+  fi
+
+  if test "x$cs_have_adios2" != "xyes"; then
+    ADIOS2_LIBS=""
+  fi
+
+  CPPFLAGS="$saved_CPPFLAGS"
+  LDFLAGS="$saved_LDFLAGS"
+  LIBS="$saved_LIBS"
+
+  unset saved_CPPFLAGS
+  unset saved_LDFLAGS
+  unset saved_LIBS
+
+fi
+
+if test x$cs_have_adios2 = xno ; then
+  cs_have_plugin_adios2=no
+fi
+
+AM_CONDITIONAL(HAVE_ADIOS2, test x$cs_have_adios2 = xyes)
+AM_CONDITIONAL(HAVE_PLUGIN_ADIOS2, test x$cs_have_plugin_adios2 = xyes)
+
+cs_py_have_plugin_adios2=False
+if test x$cs_have_plugin_adios2 = xyes ; then
+  cs_py_have_plugin_adios2=True
+fi
+
+AC_SUBST(cs_have_adios2)
+AC_SUBST(cs_py_have_plugin_adios2)
+AC_SUBST(ADIOS2_CPPFLAGS)
+AC_SUBST(ADIOS2_LDFLAGS)
+AC_SUBST(ADIOS2_LIBS)
+AC_SUBST(ADIOS2RUNPATH)
+
+])dnl
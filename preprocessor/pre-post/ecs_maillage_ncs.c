@@ -246,7 +246,7 @@ _maillage_ncs__aff_nbr_ent(size_t  nbr_elt_cel,
  *----------------------------------------------------------------------------*/
 
 static void
-_maillage_ncs__cree_fam(const ecs_maillage_t    *maillage,
+_maillage_ncs__cree_fam(ecs_maillage_t          *maillage,
                         size_t                   nbr_cel,
                         size_t                   nbr_fac,
                         const ecs_tab_int_t     *typ_fac_cel,
@@ -332,6 +332,11 @@ _maillage_ncs__cree_fam(const ecs_maillage_t    *maillage,
       tab_fam_cel->val[icel] = 0;
   }
 
+  /* Family numbers are transferred, so free the mesh's copy */
+
+  if (maillage->elt_fam[ECS_ENTMAIL_CEL] != NULL)
+    ECS_FREE(maillage->elt_fam[ECS_ENTMAIL_CEL]);
+
   for (icel = 0; icel < nbr_cel; icel++) {
     if (tab_fam_cel->val[icel] == 0)
       tab_fam_cel->val[icel] = num_fam_defaut;
@@ -353,6 +358,9 @@ _maillage_ncs__cree_fam(const ecs_maillage_t    *maillage,
       tab_fam_fac->val[ifac] = 0;
   }
 
+  if (maillage->elt_fam[ECS_ENTMAIL_FAC] != NULL)
+    ECS_FREE(maillage->elt_fam[ECS_ENTMAIL_FAC]);
+
   for (ifac = 0; ifac < nbr_fac; ifac++) {
     if (tab_fam_fac->val[ifac] == 0)
       tab_fam_fac->val[ifac] = num_fam_defaut;
@@ -541,6 +549,9 @@ _maillage_ncs__cree_fam(const ecs_maillage_t    *maillage,
 
 /*----------------------------------------------------------------------------
  *  Fonction qui écrit les données dans le fichier d'interface pour le noyau
+ *
+ *  Les tables du maillage sont libérées au fur et à mesure de leur écriture,
+ *  de sorte que seule la destruction du maillage peut suivre cette fonction.
  *----------------------------------------------------------------------------*/
 
 void
@@ -815,6 +826,11 @@ ecs_maillage_ncs__ecr(const char      *output,
   connect_fac_cel.nbr = 0;
   ECS_FREE(connect_fac_cel.val);
 
+  /* La définition des cellules n'est plus nécessaire */
+
+  ecs_table__detruit(&(maillage->table_def[ECS_ENTMAIL_CEL]));
+  ecs_table__detruit(&(maillage->table_att[ECS_ENTMAIL_CEL]));
+
   /* Écriture des numéros de famille des cellules */
 
   ecs_comm_write_section("cell_group_class_id",
@@ -824,6 +840,10 @@ ecs_maillage_ncs__ecr(const char      *output,
                          ECS_TYPE_ecs_int_t,
                          comm);
 
+  if (tab_fam_cel.nbr != 0)
+    ECS_FREE(tab_fam_cel.val);
+  tab_fam_cel.nbr = 0;
+
   /* Écriture des numéros de famille des faces */
 
   ecs_comm_write_section("face_group_class_id",
@@ -833,6 +853,10 @@ ecs_maillage_ncs__ecr(const char      *output,
                          ECS_TYPE_ecs_int_t,
                          comm);
 
+  if (tab_fam_fac.nbr != 0)
+    ECS_FREE(tab_fam_fac.val);
+  tab_fam_fac.nbr = 0;
+
   /* Écriture des positions des sommets des faces */
 
   ecs_table_comm__ecr_pos(maillage->table_def[ECS_ENTMAIL_FAC],
@@ -847,6 +871,9 @@ ecs_maillage_ncs__ecr(const char      *output,
                       2, 1, 1,
                       comm);
 
+  ecs_table__detruit(&(maillage->table_def[ECS_ENTMAIL_FAC]));
+  ecs_table__detruit(&(maillage->table_att[ECS_ENTMAIL_FAC]));
+
   /* Écriture des coordonnées des sommets */
 
   ecs_comm_write_section("vertex_coords",
@@ -856,6 +883,8 @@ ecs_maillage_ncs__ecr(const char      *output,
                          ECS_TYPE_ecs_coord_t,
                          comm);
 
+  ECS_FREE(maillage->vertex_coords);
+
   /* Ecriture de la rubrique de fin  du bloc sur les données */
   /*---------------------------------------------------------*/
 
@@ -879,15 +908,6 @@ ecs_maillage_ncs__ecr(const char      *output,
   /*---------------------------------------*/
 
   ecs_comm_finalize(&comm);
-
-  /* Libération de la mémoire */
-  /*--------------------------*/
-
-  if (tab_fam_cel.nbr != 0)
-    ECS_FREE(tab_fam_cel.val);
-
-  if (tab_fam_fac.nbr != 0)
-    ECS_FREE(tab_fam_fac.val);
 }
 
 /*----------------------------------------------------------------------------*/
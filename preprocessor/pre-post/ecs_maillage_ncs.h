@@ -71,6 +71,9 @@
 
 /*----------------------------------------------------------------------------
  *  Fonction qui écrit les données dans le fichier d'interface pour le noyau
+ *
+ *  Les tables du maillage sont libérées au fur et à mesure de leur écriture,
+ *  de sorte que seule la destruction du maillage peut suivre cette fonction.
  *----------------------------------------------------------------------------*/
 
 void
@@ -71,6 +71,103 @@ BEGIN_C_DECLS
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Matrix coefficients shared by all regularisations; they only depend on
+   the mesh quantities and on the bad cells flags, so they are built once
+   and kept until cs_bad_cells_regularisation_reset is called */
+
+static cs_real_t  *_ssd = NULL;  /* surface over distance (interior faces) */
+static cs_real_t  *_xam = NULL;  /* extra-diagonal coefficients */
+static cs_real_t  *_dam = NULL;  /* diagonal coefficients */
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build the matrix coefficients used for the regularisation, if not
+ * already done.
+ *
+ * parameters:
+ *   mesh <-- pointer to mesh structure
+ *   mq   <-- pointer to mesh quantities structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_coeffs(const cs_mesh_t             *mesh,
+              const cs_mesh_quantities_t  *mq)
+{
+  if (_dam != NULL)
+    return;
+
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)mesh->i_face_cells;
+
+  const cs_real_t *surfn = mq->i_face_surf;
+  const cs_real_t *dist = mq->i_dist;
+  const cs_real_t *volume  = mq->cell_vol;
+
+  BFT_MALLOC(_ssd, n_i_faces, cs_real_t);
+  BFT_MALLOC(_xam, n_i_faces, cs_real_t);
+  BFT_MALLOC(_dam, n_cells_ext, cs_real_t);
+
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++)
+    _dam[cell_id] = 0.;
+
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    cs_lnum_t cell_id1 = i_face_cells[face_id][0];
+    cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+
+    //FIXME usefull?
+    double surf = surfn[face_id];
+    double vol = 0.5 * (volume[cell_id1] + volume[cell_id2]);
+    surf = CS_MAX(surf, 0.1*vol/dist[face_id]);
+    double ssd = surf / dist[face_id];
+
+    _ssd[face_id] = ssd;
+
+    _dam[cell_id1] += ssd;
+    _dam[cell_id2] += ssd;
+
+    if (   mq->bad_cell_flag[cell_id1] & CS_BAD_CELL_TO_REGULARIZE
+        && mq->bad_cell_flag[cell_id2] & CS_BAD_CELL_TO_REGULARIZE)
+      _xam[face_id] = -ssd;
+    else
+      _xam[face_id] = 0.;
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free the matrix coefficients kept for the regularisation.
+ *
+ * They are rebuilt at the next regularisation, so this must be called when
+ * the mesh quantities or the bad cells flags are updated, and at the end of
+ * the computation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_bad_cells_regularisation_reset(void)
+{
+  BFT_FREE(_ssd);
+  BFT_FREE(_xam);
+  BFT_FREE(_dam);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Regularisation on bad cells for scalars
@@ -92,11 +189,8 @@ cs_bad_cells_regularisation_scalar(cs_real_t *var)
   cs_lnum_t n_i_faces = mesh->n_i_faces;
   const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)mesh->i_face_cells;
 
-  const cs_real_t *surfn = mq->i_face_surf;
-  double *dist = mq->i_dist;
-  double *volume  = mq->cell_vol;
 
-  cs_real_t *xam, *dam, *rhs;
+  cs_real_t *rhs;
 
   double varmin = 1.e20;
   double varmax =-1.e20;
@@ -110,31 +204,21 @@ cs_bad_cells_regularisation_scalar(cs_real_t *var)
   cs_parall_min(1, CS_DOUBLE, &varmin);
   cs_parall_max(1, CS_DOUBLE, &varmax);
 
-  BFT_MALLOC(xam, n_i_faces, cs_real_t);
-  BFT_MALLOC(dam, n_cells_ext, cs_real_t);
+  _build_coeffs(mesh, mq);
+
   BFT_MALLOC(rhs, n_cells_ext, cs_real_t);
 
-  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
-    dam[cell_id] = 0.;
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++)
     rhs[cell_id] = 0.;
-  }
 
   for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
-    xam[face_id] = 0.;
-
-    double surf = surfn[face_id];
-    double vol = 0.5 * (volume[cell_id1] + volume[cell_id2]);
-    surf = CS_MAX(surf, 0.1*vol/dist[face_id]);
-    double ssd = surf / dist[face_id];
-
-    dam[cell_id1] += ssd;
-    dam[cell_id2] += ssd;
+    double ssd = _ssd[face_id];
 
     if (   mq->bad_cell_flag[cell_id1] & CS_BAD_CELL_TO_REGULARIZE
         && mq->bad_cell_flag[cell_id2] & CS_BAD_CELL_TO_REGULARIZE) {
-      xam[face_id] = -ssd;
+      /* Coupling handled by the extra-diagonal term */
     }
     else if (mq->bad_cell_flag[cell_id1] & CS_BAD_CELL_TO_REGULARIZE) {
       rhs[cell_id1] += ssd * var[cell_id2];
@@ -166,8 +250,8 @@ cs_bad_cells_regularisation_scalar(cs_real_t *var)
                        true, /* symmetric */
                        db_size,
                        NULL, /* eb_size */
-                       (cs_real_t *)dam,
-                       xam,
+                       _dam,
+                       _xam,
                        CS_HALO_ROTATION_COPY,
                        epsilp,
                        rnorm,
@@ -192,8 +276,6 @@ cs_bad_cells_regularisation_scalar(cs_real_t *var)
                       "potential_regularisation_scalar");
 
   /* Free memory */
-  BFT_FREE(xam);
-  BFT_FREE(dam);
   BFT_FREE(rhs);
 
   return;
@@ -223,17 +305,13 @@ cs_bad_cells_regularisation_vector(cs_real_3_t  *var,
   const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)mesh->i_face_cells;
   const cs_lnum_t *b_face_cells = mesh->b_face_cells;
 
-  const cs_real_t *surfn = mq->i_face_surf;
   const cs_real_t *surfbn = mq->b_face_surf;
-  double *dist = mq->i_dist;
   double *distbr = mq->b_dist;
-  double *volume  = mq->cell_vol;
 
   const cs_real_3_t *surfbo = (const cs_real_3_t *) mq->b_face_normal;
 
   cs_real_33_t *dam;
   cs_real_3_t *rhs;
-  cs_real_t *xam;
 #if 1
   double varmin[3] = {1.e20, 1.e20, 1.e20};
   double varmax[3] = {-1.e20, -1.e20,-1.e20};
@@ -252,7 +330,8 @@ cs_bad_cells_regularisation_vector(cs_real_3_t  *var,
   }
 #endif
 
-  BFT_MALLOC(xam, n_i_faces, cs_real_t);
+  _build_coeffs(mesh, mq);
+
   BFT_MALLOC(dam, n_cells_ext, cs_real_33_t);
   BFT_MALLOC(rhs, n_cells_ext, cs_real_3_t);
 
@@ -261,6 +340,7 @@ cs_bad_cells_regularisation_vector(cs_real_3_t  *var,
       for (int j = 0; j < 3; j++) {
         dam[cell_id][i][j] = 0.;
       }
+      dam[cell_id][i][i] = _dam[cell_id];
       rhs[cell_id][i] = 0.;
     }
   }
@@ -268,22 +348,11 @@ cs_bad_cells_regularisation_vector(cs_real_3_t  *var,
   for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
-    xam[face_id] = 0.;
-
-    //FIXME usefull?
-    double surf = surfn[face_id];
-    double vol = 0.5 * (volume[cell_id1] + volume[cell_id2]);
-    surf = CS_MAX(surf, 0.1*vol/dist[face_id]);
-    double ssd = surf / dist[face_id];
-
-    for (int i = 0; i < 3; i++) {
-      dam[cell_id1][i][i] += ssd;
-      dam[cell_id2][i][i] += ssd;
-    }
+    double ssd = _ssd[face_id];
 
     if (   mq->bad_cell_flag[cell_id1] & CS_BAD_CELL_TO_REGULARIZE
         && mq->bad_cell_flag[cell_id2] & CS_BAD_CELL_TO_REGULARIZE) {
-      xam[face_id] = -ssd;
+      /* Coupling handled by the extra-diagonal term */
     }
     else if (mq->bad_cell_flag[cell_id1] & CS_BAD_CELL_TO_REGULARIZE) {
       for (int i = 0; i < 3; i++) {
@@ -345,7 +414,7 @@ cs_bad_cells_regularisation_vector(cs_real_3_t  *var,
                        db_size,
                        NULL, /* eb_size */
                        (cs_real_t *)dam,
-                       xam,
+                       _xam,
                        CS_HALO_ROTATION_COPY,
                        epsilp,
                        rnorm,
@@ -376,7 +445,6 @@ cs_bad_cells_regularisation_vector(cs_real_3_t  *var,
                       "potential_regularisation_vector");
 
   /* Free memory */
-  BFT_FREE(xam);
   BFT_FREE(dam);
   BFT_FREE(rhs);
 }
@@ -403,13 +471,9 @@ cs_bad_cells_regularisation_sym_tensor(cs_real_6_t  *var,
   cs_lnum_t n_i_faces = mesh->n_i_faces;
   const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)mesh->i_face_cells;
 
-  const cs_real_t *surfn = mq->i_face_surf;
-  double *dist = mq->i_dist;
-  double *volume  = mq->cell_vol;
 
   cs_real_66_t *dam;
   cs_real_6_t *rhs;
-  cs_real_t *xam;
 #if 1
   double varmin[6] = { 1.e20,  1.e20, 1.e20,  1.e20,  1.e20, 1.e20};
   double varmax[6] = {-1.e20, -1.e20,-1.e20, -1.e20, -1.e20,-1.e20};
@@ -428,7 +492,8 @@ cs_bad_cells_regularisation_sym_tensor(cs_real_6_t  *var,
   }
 #endif
 
-  BFT_MALLOC(xam, n_i_faces, cs_real_t);
+  _build_coeffs(mesh, mq);
+
   BFT_MALLOC(dam, n_cells_ext, cs_real_66_t);
   BFT_MALLOC(rhs, n_cells_ext, cs_real_6_t);
 
@@ -437,6 +502,7 @@ cs_bad_cells_regularisation_sym_tensor(cs_real_6_t  *var,
       for (int j = 0; j < 6; j++) {
         dam[cell_id][i][j] = 0.;
       }
+      dam[cell_id][i][i] = _dam[cell_id];
       rhs[cell_id][i] = 0.;
     }
   }
@@ -444,22 +510,11 @@ cs_bad_cells_regularisation_sym_tensor(cs_real_6_t  *var,
   for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
-    xam[face_id] = 0.;
-
-    //FIXME usefull?
-    double surf = surfn[face_id];
-    double vol = 0.5 * (volume[cell_id1] + volume[cell_id2]);
-    surf = CS_MAX(surf, 0.1*vol/dist[face_id]);
-    double ssd = surf / dist[face_id];
-
-    for (int i = 0; i < 6; i++) {
-      dam[cell_id1][i][i] += ssd;
-      dam[cell_id2][i][i] += ssd;
-    }
+    double ssd = _ssd[face_id];
 
     if (   mq->bad_cell_flag[cell_id1] & CS_BAD_CELL_TO_REGULARIZE
         && mq->bad_cell_flag[cell_id2] & CS_BAD_CELL_TO_REGULARIZE) {
-      xam[face_id] = -ssd;
+      /* Coupling handled by the extra-diagonal term */
     }
     else if (mq->bad_cell_flag[cell_id1] & CS_BAD_CELL_TO_REGULARIZE) {
       for (int i = 0; i < 6; i++) {
@@ -529,7 +584,7 @@ cs_bad_cells_regularisation_sym_tensor(cs_real_6_t  *var,
                        db_size,
                        NULL, /* eb_size */
                        (cs_real_t *)dam,
-                       xam,
+                       _xam,
                        CS_HALO_ROTATION_COPY,
                        epsilp,
                        rnorm,
@@ -559,7 +614,6 @@ cs_bad_cells_regularisation_sym_tensor(cs_real_6_t  *var,
                       "potential_regularisation_sym_tensor");
 
   /* Free memory */
-  BFT_FREE(xam);
   BFT_FREE(dam);
   BFT_FREE(rhs);
 }
@@ -586,17 +640,13 @@ cs_bad_cells_regularisation_tensor(cs_real_9_t  *var,
   cs_lnum_t n_i_faces = mesh->n_i_faces;
   const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)mesh->i_face_cells;
 
-  const cs_real_t *surfn = mq->i_face_surf;
   const cs_real_t *surfbn = mq->b_face_surf;
-  double *dist = mq->i_dist;
   double *distbr = mq->b_dist;
-  double *volume  = mq->cell_vol;
 
   const cs_real_3_t *surfbo = (const cs_real_3_t *) mq->b_face_normal;
 
   cs_real_99_t *dam;
   cs_real_9_t *rhs;
-  cs_real_t *xam;
 #if 1
   double varmin[9] = { 1.e20,  1.e20, 1.e20,  1.e20,  1.e20, 1.e20,  1.e20,  1.e20, 1.e20};
   double varmax[9] = {-1.e20, -1.e20,-1.e20, -1.e20, -1.e20,-1.e20, -1.e20, -1.e20,-1.e20};
@@ -615,7 +665,8 @@ cs_bad_cells_regularisation_tensor(cs_real_9_t  *var,
   }
 #endif
 
-  BFT_MALLOC(xam, n_i_faces, cs_real_t);
+  _build_coeffs(mesh, mq);
+
   BFT_MALLOC(dam, n_cells_ext, cs_real_99_t);
   BFT_MALLOC(rhs, n_cells_ext, cs_real_9_t);
 
@@ -624,6 +675,7 @@ cs_bad_cells_regularisation_tensor(cs_real_9_t  *var,
       for (int j = 0; j < 9; j++) {
         dam[cell_id][i][j] = 0.;
       }
+      dam[cell_id][i][i] = _dam[cell_id];
       rhs[cell_id][i] = 0.;
     }
   }
@@ -631,22 +683,11 @@ cs_bad_cells_regularisation_tensor(cs_real_9_t  *var,
   for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
-    xam[face_id] = 0.;
-
-    //FIXME usefull?
-    double surf = surfn[face_id];
-    double vol = 0.5 * (volume[cell_id1] + volume[cell_id2]);
-    surf = CS_MAX(surf, 0.1*vol/dist[face_id]);
-    double ssd = surf / dist[face_id];
-
-    for (int i = 0; i < 9; i++) {
-      dam[cell_id1][i][i] += ssd;
-      dam[cell_id2][i][i] += ssd;
-    }
+    double ssd = _ssd[face_id];
 
     if (   mq->bad_cell_flag[cell_id1] & CS_BAD_CELL_TO_REGULARIZE
         && mq->bad_cell_flag[cell_id2] & CS_BAD_CELL_TO_REGULARIZE) {
-      xam[face_id] = -ssd;
+      /* Coupling handled by the extra-diagonal term */
     }
     else if (mq->bad_cell_flag[cell_id1] & CS_BAD_CELL_TO_REGULARIZE) {
       for (int i = 0; i < 9; i++) {
@@ -712,7 +753,7 @@ cs_bad_cells_regularisation_tensor(cs_real_9_t  *var,
                        db_size,
                        NULL, /* eb_size */
                        (cs_real_t *)dam,
-                       xam,
+                       _xam,
                        CS_HALO_ROTATION_COPY,
                        epsilp,
                        rnorm,
@@ -742,7 +783,6 @@ cs_bad_cells_regularisation_tensor(cs_real_9_t  *var,
                       "potential_regularisation_tensor");
 
   /* Free memory */
-  BFT_FREE(xam);
   BFT_FREE(dam);
   BFT_FREE(rhs);
 }
@@ -58,6 +58,19 @@ BEGIN_C_DECLS
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free the matrix coefficients kept for the regularisation.
+ *
+ * They are rebuilt at the next regularisation, so this must be called when
+ * the mesh quantities or the bad cells flags are updated, and at the end of
+ * the computation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_bad_cells_regularisation_reset(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add comments
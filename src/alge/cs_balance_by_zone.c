@@ -91,6 +91,90 @@ BEGIN_C_DECLS
 
 */
 
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Maximum number of volume zones handled in a single mesh pass
+   (one bit per zone in cell tags) */
+
+#define _BALANCE_ZONES_MAX  64
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Scalar-dependent data shared by all balances of a given scalar */
+
+typedef struct {
+
+  const cs_field_t  *f;               /* associated scalar field */
+  cs_var_cal_opt_t   var_cal_opt;     /* field calculation options */
+  int                limiter_choice;  /* NVD/TVD limiter choice, or -1 */
+
+  bool               free_cp;         /* true if cpro_cp is owned here */
+  cs_real_t         *cpro_cp;         /* specific heat if the scalar is the
+                                         temperature, 1 otherwise */
+
+  const cs_real_t   *i_mass_flux;     /* interior faces mass flux */
+  const cs_real_t   *b_mass_flux;     /* boundary faces mass flux */
+
+  cs_real_t         *i_visc;          /* interior faces viscosity */
+  cs_real_t         *b_visc;          /* boundary faces viscosity */
+
+  cs_real_3_t       *grad;            /* cell gradient */
+  cs_real_3_t       *gradup;          /* upwind gradient, or NULL */
+  cs_real_3_t       *gradst;          /* slope test gradient, or NULL */
+
+  cs_real_t         *local_max;       /* local maximum, or NULL */
+  cs_real_t         *local_min;       /* local minimum, or NULL */
+  cs_real_t         *courant;         /* cell Courant number, or NULL */
+
+  const cs_real_t   *cv_limiter;      /* convection limiter, or NULL */
+  const cs_real_t   *df_limiter;      /* diffusion limiter, or NULL */
+
+  cs_lnum_t          n_cpl_faces;     /* number of internally coupled
+                                         local faces */
+  cs_lnum_t         *cpl_faces;       /* internally coupled local faces
+                                         (shared, not owned) */
+  cs_real_t         *cpl_flux;        /* flux through internally coupled
+                                         local faces */
+
+} _balance_scalar_t;
+
+/* Definition of a balance computed at each time step */
+
+typedef struct {
+
+  bool         surface;                     /* true for a surface flux,
+                                               false for a volume zone */
+  char        *criteria;                    /* selection criteria */
+  char        *scalar_name;                 /* scalar name */
+  cs_real_t    normal[3];                   /* outwards normal (surface) */
+
+  cs_lnum_t    n_elts[2];                   /* number of selected cells,
+                                               or boundary and interior
+                                               faces */
+  cs_lnum_t   *elt_ids[2];                  /* ids of selected elements */
+  cs_gnum_t    n_g_elts[2];                 /* global number of selected
+                                               boundary and interior faces
+                                               (surface) */
+
+  cs_real_t    balance[CS_BALANCE_N_TERMS];  /* last computed terms */
+
+} _balance_def_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static int              _n_balance_defs = 0;
+static _balance_def_t  *_balance_defs = NULL;
+
+/* Mesh sizes for which selections were determined */
+
+static cs_lnum_t        _balance_sel_mesh_sizes[3] = {-1, -1, -1};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -729,126 +813,91 @@ _balance_internal_faces(const int         iupwin,
 
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*=============================================================================
- * Local Macro Definitions
- *============================================================================*/
-
-#undef _CS_MODULE2_2
-
-#define _CS_MODULE2_2(vect) \
-  0.5*(vect[0] * vect[0] + vect[1] * vect[1] + vect[2] * vect[2])
 
-#define _CS_DOT_PRODUCT(vect1, vect2) \
-  (vect1[0] * vect2[0] + vect1[1] * vect2[1] + vect1[2] * vect2[2])
+/*----------------------------------------------------------------------------
+ * Return the balance term associated with a given boundary face type.
+ *
+ * parameters:
+ *   bc_type  <-- boundary face type
+ *
+ * returns:
+ *   associated balance term id
+ *----------------------------------------------------------------------------*/
 
-/*============================================================================
- * Public function definitions
- *============================================================================*/
+static inline int
+_b_face_balance_term(int  bc_type)
+{
+  int t_id = CS_BALANCE_BOUNDARY_OTHER;
+
+  if (   bc_type == CS_INLET
+      || bc_type == CS_FREE_INLET
+      || bc_type == CS_ESICF
+      || bc_type == CS_EPHCF)
+    t_id = CS_BALANCE_BOUNDARY_IN;
+  else if (   bc_type == CS_OUTLET
+           || bc_type == CS_SSPCF
+           || bc_type == CS_SOPCF)
+    t_id = CS_BALANCE_BOUNDARY_OUT;
+  else if (bc_type == CS_SYMMETRY)
+    t_id = CS_BALANCE_BOUNDARY_SYM;
+  else if (bc_type == CS_SMOOTHWALL)
+    t_id = CS_BALANCE_BOUNDARY_WALL_S;
+  else if (bc_type == CS_ROUGHWALL)
+    t_id = CS_BALANCE_BOUNDARY_WALL_R;
+  else if (   bc_type == CS_COUPLED
+           || bc_type == CS_COUPLED_FD)
+    t_id = CS_BALANCE_BOUNDARY_COUPLED_E;
+
+  return t_id;
+}
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Compute the different terms of the balance of a given scalar,
- *        on a volume zone defined by selected cell ids/
+/*----------------------------------------------------------------------------
+ * Create structure containing the scalar-dependent data (gradients, face
+ * viscosity, limiters, ...) shared by balance computations.
  *
- * This function computes the balance relative to a given scalar
- * on a selected zone of the mesh.
- * We assume that we want to compute balances (convective and diffusive)
- * at the boundaries of the calculation domain represented below
- * (with different boundary types).
+ * This data depends only on the scalar, so it is computed only once for
+ * all balances of a given scalar.
  *
- * In the case of the temperature, the energy balance in Joules will be
- * computed by multiplying by the specific heat.
+ * parameters:
+ *   f  <-- pointer to scalar field
  *
- * \param[in]     scalar_name         scalar name
- * \param[in]     n_cells_sel         number of selected cells
- * \param[in]     cell_sel_ids        ids of selected cells
- * \param[out]    balance             array of computed balance terms
- *                                    (see \ref cs_balance_term_t)
- */
-/*----------------------------------------------------------------------------*/
+ * returns:
+ *   pointer to new scalar balance data structure
+ *----------------------------------------------------------------------------*/
 
-void
-cs_balance_by_zone_compute(const char      *scalar_name,
-                           cs_lnum_t        n_cells_sel,
-                           const cs_lnum_t  cell_sel_ids[],
-                           cs_real_t        balance[CS_BALANCE_N_TERMS])
+static _balance_scalar_t *
+_balance_scalar_create(const cs_field_t  *f)
 {
-  int idtvar = cs_glob_time_step_options->idtvar;
-
   const cs_mesh_t *m = cs_glob_mesh;
   cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
 
-  const cs_halo_t  *halo = m->halo;
-
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
   const cs_lnum_t n_i_faces = m->n_i_faces;
   const cs_lnum_t n_b_faces = m->n_b_faces;
 
-  const cs_lnum_2_t *restrict i_face_cells
-    = (const cs_lnum_2_t *restrict)m->i_face_cells;
   const cs_lnum_t *restrict b_face_cells
     = (const cs_lnum_t *restrict)m->b_face_cells;
-  const cs_real_t *restrict weight = fvq->weight;
-  const cs_real_t *restrict i_dist = fvq->i_dist;
-  const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
-  const cs_real_t *restrict cell_vol = fvq->cell_vol;
-  const cs_real_3_t *restrict cell_cen
-    = (const cs_real_3_t *restrict)fvq->cell_cen;
-  const cs_real_3_t *restrict i_face_normal
-    = (const cs_real_3_t *restrict)fvq->i_face_normal;
-  const cs_real_3_t *restrict i_face_cog
-    = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
 
-  const int *bc_type = cs_glob_bc_type;
-
-  /* initialize output */
-
-  for (int i = 0; i < CS_BALANCE_N_TERMS; i++)
-    balance[i] = 0;
-
-  /* all boundary convective fluxes are upwind */
-  int icvflb = 0; // TODO handle total energy balance
-  int icvflf = 0;
-
-  /* Get physical fields */
-  const cs_real_t *dt = CS_F_(dt)->val;
-  const cs_real_t *rho = CS_F_(rho)->val;
-  const cs_field_t *f = cs_field_by_name_try(scalar_name);
-  const int field_id = cs_field_id_by_name(scalar_name);
+  _balance_scalar_t *bs = NULL;
 
-  /* If the requested scalar field is not computed, return */
-  if (field_id == -1) {
-    bft_printf("Scalar field does not exist. Balance will not be computed.\n");
-    return;
-  }
+  BFT_MALLOC(bs, 1, _balance_scalar_t);
 
-  /* Internal coupling variables */
-  int key_cal_opt_id = cs_field_key_id("var_cal_opt");
-  cs_var_cal_opt_t var_cal_opt;
+  bs->f = f;
 
   /* Get the calculation option from the field */
-  cs_field_get_key_struct(f, key_cal_opt_id, &var_cal_opt);
 
-  cs_real_t *pvar_local = NULL;
-  cs_real_t *pvar_distant = NULL;
-  cs_real_t  hint, hext, heq;
-  cs_lnum_t *faces_local = NULL;
-  cs_lnum_t  n_local = 0;
-  cs_lnum_t  n_distant = 0;
-  cs_lnum_t *faces_distant = NULL;
-  cs_internal_coupling_t *cpl = NULL;
+  cs_field_get_key_struct(f,
+                          cs_field_key_id("var_cal_opt"),
+                          &(bs->var_cal_opt));
+
+  const cs_var_cal_opt_t *var_cal_opt = &(bs->var_cal_opt);
 
   /* Temperature indicator.
      Will multiply by CP in order to have energy. */
+
   bool itemperature = false;
   if (f == cs_thermal_model_field()) {
     if (cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_TEMPERATURE)
@@ -856,751 +905,717 @@ cs_balance_by_zone_compute(const char      *scalar_name,
   }
 
   /* Specific heat (CP) */
-  cs_real_t *cpro_cp = NULL;
+
   const int icp = cs_field_id_by_name("specific_heat");
+
+  bs->cpro_cp = NULL;
+  bs->free_cp = true;
+
   if (itemperature) {
-    if (icp != -1)
-      cpro_cp = CS_F_(cp)->val;
+    if (icp != -1) {
+      bs->cpro_cp = CS_F_(cp)->val;
+      bs->free_cp = false;
+    }
     else {
       const double cp0 = cs_glob_fluid_properties->cp0;
-      BFT_MALLOC(cpro_cp, n_cells, cs_real_t);
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        cpro_cp[c_id] = cp0;
-      }
+      BFT_MALLOC(bs->cpro_cp, n_cells, cs_real_t);
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+        bs->cpro_cp[c_id] = cp0;
     }
   }
   else {
-    BFT_MALLOC(cpro_cp, n_cells, cs_real_t);
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      cpro_cp[c_id] = 1.;
-    }
+    BFT_MALLOC(bs->cpro_cp, n_cells, cs_real_t);
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      bs->cpro_cp[c_id] = 1.;
   }
 
-  /* Internal coupling initialisation*/
-  if (var_cal_opt.icoupl > 0) {
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
-    const int coupling_id = cs_field_get_key_int(f, coupling_key_id);
-    cpl = cs_internal_coupling_by_id(coupling_id);
-    cs_internal_coupling_coupled_faces(cpl,
-                                       &n_local,
-                                       &faces_local,
-                                       &n_distant,
-                                       &faces_distant);
-  }
+  const cs_real_t *cpro_cp = bs->cpro_cp;
 
-  /* Zone cells selection variables*/
-  cs_lnum_t n_i_faces_sel = 0;
-  cs_lnum_t *i_face_sel_ids = NULL;
-  cs_lnum_t n_bb_faces_sel = 0;
-  cs_lnum_t *bb_face_sel_ids = NULL;
-  cs_lnum_t n_bi_faces_sel = 0;
-  cs_lnum_t *bi_face_sel_ids = NULL;
-  cs_lnum_2_t *bi_face_cells = NULL;
-  cs_lnum_t *cells_tag_ids = NULL;
+  /* Boundary condition coefficients */
 
-  cs_real_t *local_min = NULL;
-  cs_real_t *local_max = NULL;
-  cs_real_t *courant = NULL;
-
-  cs_real_t *cv_limiter = NULL;
-  cs_real_t *df_limiter = NULL;
-
-  const int key_lim_choice = cs_field_key_id("limiter_choice");
-
-  /* Initialize balance contributions
-    ---------------------------------
-
-    vol_balance   : volume contribution of unsteady terms
-    div_balance   : volume contribution due to to term in div(rho u)
-    mass_i_balance: contribution from mass injections
-    mass_o_balance: contribution from mass suctions
-    bi_i_balance  : contribution from inlet boundary faces of the selected zone
-                    which are internal in the total mesh
-    bi_o_balance  : contribution from outlet boundary faces of the selected zone
-                    which are internal in the total mesh
-    in_balance    : contribution from inlets
-    out_balance   : contribution from outlets
-    sym_balance   : contribution from symmetry boundaries
-    s_wall_balance: contribution from smooth walls
-    r_wall_balance: contribution from rough walls
-    cpl_balance   : contribution from coupled faces
-    i_cpl_balance : contribution from internal coupled faces
-    ndef_balance  : contribution from undefined faces
-    tot_balance   : total balance */
-
-  double vol_balance = 0.;
-  double tot_vol_balance2 = 0.;
-  double div_balance = 0.;
-  double mass_i_balance = 0.;
-  double mass_o_balance = 0.;
-  double bi_i_balance = 0.;
-  double bi_o_balance = 0.;
-  double in_balance = 0.;
-  double out_balance = 0.;
-  double sym_balance = 0.;
-  double s_wall_balance = 0.;
-  double r_wall_balance = 0.;
-  double cpl_balance = 0.;
-  double i_cpl_balance = 0.;
-  double ndef_balance = 0.;
-
-  /* Boundary condition coefficient for h */
   const cs_real_t *a_F = f->bc_coeffs->a;
   const cs_real_t *b_F = f->bc_coeffs->b;
-  const cs_real_t *af_F = f->bc_coeffs->af;
-  const cs_real_t *bf_F = f->bc_coeffs->bf;
 
   /* Convective mass fluxes for inner and boundary faces */
+
   int iflmas = cs_field_get_key_int(f, cs_field_key_id("inner_mass_flux_id"));
-  const cs_real_t *i_mass_flux = cs_field_by_id(iflmas)->val;
+  bs->i_mass_flux = cs_field_by_id(iflmas)->val;
 
   int iflmab = cs_field_get_key_int(f, cs_field_key_id("boundary_mass_flux_id"));
-  const cs_real_t *b_mass_flux = cs_field_by_id(iflmab)->val;
+  bs->b_mass_flux = cs_field_by_id(iflmab)->val;
+
+  /* Face viscosity */
+
+  BFT_MALLOC(bs->i_visc, n_i_faces, cs_real_t);
+  BFT_MALLOC(bs->b_visc, n_b_faces, cs_real_t);
+
+  cs_real_t *c_visc = NULL;
+  BFT_MALLOC(c_visc, n_cells_ext, cs_real_t);
+  const int kivisl
+    = cs_field_get_key_int(f, cs_field_key_id("diffusivity_id"));
+  if (kivisl != -1) {
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      c_visc[c_id] = cs_field_by_id(kivisl)->val[c_id];
+  }
+  else {
+    const double visls0
+      = cs_field_get_key_double(f, cs_field_key_id("diffusivity_ref"));
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+      c_visc[c_id] = visls0;
+  }
+
+  /* Turbulent part */
+
+  if (var_cal_opt->idifft == 1) {
+    const cs_real_t *c_visct = cs_field_by_name("turbulent_viscosity")->val;
+    const int ksigmas = cs_field_key_id("turbulent_schmidt");
+    const cs_real_t turb_schmidt = cs_field_get_key_double(f, ksigmas);
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      c_visc[c_id] += cpro_cp[c_id] * c_visct[c_id]/turb_schmidt;
+  }
+
+  cs_face_viscosity(m, fvq, var_cal_opt->imvisf, c_visc,
+                    bs->i_visc, bs->b_visc);
+
+  BFT_FREE(c_visc);
 
   /* Choose gradient type */
 
   cs_halo_type_t halo_type = CS_HALO_STANDARD;
   cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
 
-  const int imrgra = var_cal_opt.imrgra;
-  cs_gradient_type_by_imrgra(imrgra,
+  cs_gradient_type_by_imrgra(var_cal_opt->imrgra,
                              &gradient_type,
                              &halo_type);
 
   /* Limiters */
 
-  int limiter_choice = -1;
-  int ischcp = var_cal_opt.ischcv;
-  if (field_id != -1) {
-    f = cs_field_by_id(field_id);
-
-    /* NVD/TVD limiters */
-    if (ischcp == 4) {
-      limiter_choice = cs_field_get_key_int(f, key_lim_choice);
-      BFT_MALLOC(local_max, n_cells_ext, cs_real_t);
-      BFT_MALLOC(local_min, n_cells_ext, cs_real_t);
-      cs_field_local_extrema_scalar(field_id,
-                                    halo_type,
-                                    local_max,
-                                    local_min);
-      if (limiter_choice >= CS_NVD_VOF_HRIC) {
-        BFT_MALLOC(courant, n_cells_ext, cs_real_t);
-        cs_cell_courant_number(field_id, courant);
-      }
+  bs->limiter_choice = -1;
+  bs->local_max = NULL;
+  bs->local_min = NULL;
+  bs->courant = NULL;
+
+  /* NVD/TVD limiters */
+  if (var_cal_opt->ischcv == 4) {
+    bs->limiter_choice
+      = cs_field_get_key_int(f, cs_field_key_id("limiter_choice"));
+    BFT_MALLOC(bs->local_max, n_cells_ext, cs_real_t);
+    BFT_MALLOC(bs->local_min, n_cells_ext, cs_real_t);
+    cs_field_local_extrema_scalar(f->id,
+                                  halo_type,
+                                  bs->local_max,
+                                  bs->local_min);
+    if (bs->limiter_choice >= CS_NVD_VOF_HRIC) {
+      BFT_MALLOC(bs->courant, n_cells_ext, cs_real_t);
+      cs_cell_courant_number(f->id, bs->courant);
     }
+  }
 
-    int cv_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("convection_limiter_id"));
-    if (cv_limiter_id > -1)
-      cv_limiter = cs_field_by_id(cv_limiter_id)->val;
+  bs->cv_limiter = NULL;
+  bs->df_limiter = NULL;
 
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
-    if (df_limiter_id > -1)
-      df_limiter = cs_field_by_id(df_limiter_id)->val;
-  }
+  int cv_limiter_id =
+    cs_field_get_key_int(f, cs_field_key_id("convection_limiter_id"));
+  if (cv_limiter_id > -1)
+    bs->cv_limiter = cs_field_by_id(cv_limiter_id)->val;
+
+  int df_limiter_id =
+    cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+  if (df_limiter_id > -1)
+    bs->df_limiter = cs_field_by_id(df_limiter_id)->val;
 
-  /* Allocate temporary array */
-  cs_real_t *f_reconstructed;
-  BFT_MALLOC(f_reconstructed, n_b_faces, cs_real_t);
+  /* Gradient calculation */
 
-  /* Reconstructed value */
-  cs_real_3_t *grad;
-  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  BFT_MALLOC(bs->grad, n_cells_ext, cs_real_3_t);
 
-  halo_type = CS_HALO_STANDARD;
   cs_field_gradient_scalar(f,
                            true, /* use_previous_t */
                            1, /* inc */
                            true, /* _recompute_cocg */
-                           grad);
-
-  if (false) {//FIXME
-    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-      /* Associated boundary cell */
-      cs_lnum_t c_id = b_face_cells[f_id];
-      f_reconstructed[f_id] = f->val[c_id]
-                               + grad[c_id][0]*diipb[f_id][0]
-                               + grad[c_id][1]*diipb[f_id][1]
-                               + grad[c_id][2]*diipb[f_id][2];
-    }
+                           bs->grad);
 
-  /* Non-reconstructed value */
-  } else {
-    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-      /* Associated boundary cell */
-      cs_lnum_t c_id = b_face_cells[f_id];
-      f_reconstructed[f_id] = f->val[c_id];
-    }
-  }
+  /* Compute the gradient for convective scheme
+     (the slope test, limiter, SOLU, etc) */
 
-  int inc = 1;
+  bs->gradup = NULL;
+  bs->gradst = NULL;
 
-  /* Compute the gradient for convective scheme (the slope test, limiter, SOLU, etc) */
-  cs_real_3_t *gradup = NULL;
-  cs_real_3_t *gradst = NULL;
-  if (var_cal_opt.blencv > 0 && var_cal_opt.isstpc == 0) {
-    BFT_MALLOC(gradst, n_cells_ext, cs_real_3_t);
+  if (var_cal_opt->blencv > 0 && var_cal_opt->isstpc == 0) {
+    BFT_MALLOC(bs->gradst, n_cells_ext, cs_real_3_t);
     for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-      gradst[c_id][0] = 0.;
-      gradst[c_id][1] = 0.;
-      gradst[c_id][2] = 0.;
+      bs->gradst[c_id][0] = 0.;
+      bs->gradst[c_id][1] = 0.;
+      bs->gradst[c_id][2] = 0.;
     }
     /* Slope test gradient */
-    if (var_cal_opt.iconv > 0)
-      cs_slope_test_gradient(field_id,
-                             inc,
-                             halo_type,
-                             (const cs_real_3_t *)grad,
-                             gradst,
+    if (var_cal_opt->iconv > 0)
+      cs_slope_test_gradient(f->id,
+                             1, /* inc */
+                             CS_HALO_STANDARD,
+                             (const cs_real_3_t *)bs->grad,
+                             bs->gradst,
                              f->val,
                              a_F,
                              b_F,
-                             i_mass_flux);
-
+                             bs->i_mass_flux);
   }
+
   /* Pure SOLU scheme without using gradient_slope_test function
      or Roe and Sweby limiters */
-  if (var_cal_opt.blencv > 0
-      && (var_cal_opt.ischcv==2 || var_cal_opt.ischcv==4)) {
-    BFT_MALLOC(gradup, n_cells_ext, cs_real_3_t);
+  if (var_cal_opt->blencv > 0
+      && (var_cal_opt->ischcv==2 || var_cal_opt->ischcv==4)) {
+    BFT_MALLOC(bs->gradup, n_cells_ext, cs_real_3_t);
     for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-      gradup[c_id][0] = 0.;
-      gradup[c_id][1] = 0.;
-      gradup[c_id][2] = 0.;
+      bs->gradup[c_id][0] = 0.;
+      bs->gradup[c_id][1] = 0.;
+      bs->gradup[c_id][2] = 0.;
     }
 
-    if (var_cal_opt.iconv > 0)
-      cs_upwind_gradient(field_id,
-                         inc,
-                         halo_type,
+    if (var_cal_opt->iconv > 0)
+      cs_upwind_gradient(f->id,
+                         1, /* inc */
+                         CS_HALO_STANDARD,
                          a_F,
                          b_F,
-                         i_mass_flux,
-                         b_mass_flux,
+                         bs->i_mass_flux,
+                         bs->b_mass_flux,
                          f->val,
-                         gradup);
-
-  }
-
-  /* Face viscosity */
-  int imvisf = var_cal_opt.imvisf;
-  cs_real_t *i_visc;
-  cs_real_t *b_visc;
-  BFT_MALLOC(i_visc, n_i_faces, cs_real_t);
-  BFT_MALLOC(b_visc, n_b_faces, cs_real_t);
-
-  cs_real_t *c_visc = NULL;
-  BFT_MALLOC(c_visc, n_cells_ext, cs_real_t);
-  const int kivisl
-    = cs_field_get_key_int(f, cs_field_key_id("diffusivity_id"));
-  if (kivisl != -1) {
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
-      c_visc[c_id] = cs_field_by_id(kivisl)->val[c_id];
-  }
-  else {
-    const double visls0
-      = cs_field_get_key_double(f, cs_field_key_id("diffusivity_ref"));
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      c_visc[c_id] = visls0;
-    }
+                         bs->gradup);
   }
 
-  /* Turbulent part */
-  cs_real_t *c_visct = cs_field_by_name("turbulent_viscosity")->val;
+  /* Flux through internally coupled faces */
 
-  if (var_cal_opt.idifft == 1) {
-    const int ksigmas = cs_field_key_id("turbulent_schmidt");
-    cs_real_t turb_schmidt = cs_field_get_key_double(f, ksigmas);
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
-      c_visc[c_id] += cpro_cp[c_id] * c_visct[c_id]/turb_schmidt;
-  }
+  bs->n_cpl_faces = 0;
+  bs->cpl_faces = NULL;
+  bs->cpl_flux = NULL;
 
-  cs_face_viscosity(m, fvq, imvisf, c_visc, i_visc, b_visc);
+  if (var_cal_opt->icoupl > 0) {
 
-  /* Get user-selected zone
-     ====================== */
+    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    const int coupling_id = cs_field_get_key_int(f, coupling_key_id);
+    const cs_internal_coupling_t *cpl = cs_internal_coupling_by_id(coupling_id);
 
-  /* Initialize arrays */
+    cs_lnum_t n_distant = 0;
+    cs_lnum_t *faces_distant = NULL;
 
-  /* Internal faces of the selected zone */
-  BFT_MALLOC(i_face_sel_ids, n_i_faces, cs_lnum_t);
-  /* Boundary faces of the selected zone,
-     which are internal faces of the global mesh.
-     Faces -> cells connectivity */
-  BFT_MALLOC(bi_face_sel_ids, n_i_faces, cs_lnum_t);
-  BFT_MALLOC(bi_face_cells, n_i_faces, cs_lnum_2_t);
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-    i_face_sel_ids[f_id] = -1;
-    bi_face_sel_ids[f_id] = -1;
-    bi_face_cells[f_id][0] = -999;
-    bi_face_cells[f_id][1] = -999;
-  }
+    cs_internal_coupling_coupled_faces(cpl,
+                                       &(bs->n_cpl_faces),
+                                       &(bs->cpl_faces),
+                                       &n_distant,
+                                       &faces_distant);
 
-  /* Boundary faces of the selected zone,
-     which are also boundary faces of the global mesh */
-  BFT_MALLOC(bb_face_sel_ids, n_b_faces, cs_lnum_t);
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-    bb_face_sel_ids[f_id] = -1;
-  }
+    const int ircflp = var_cal_opt->ircflu;
 
-  /* Synchronization for parallelism */
-  BFT_MALLOC(cells_tag_ids, n_cells_ext, cs_lnum_t);
-  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-    cells_tag_ids[c_id] = 0;
-  }
-  for (cs_lnum_t c_id = 0; c_id < n_cells_sel; c_id++) {
-    cs_lnum_t c_id_sel = cell_sel_ids[c_id];
-    cells_tag_ids[c_id_sel] = 1;
-  }
-  if (halo != NULL) {
-    cs_halo_sync_num(halo, halo_type, cells_tag_ids);
-  }
+    /* Prepare data for sending from distant */
 
-  /* Classify mesh faces with respect to the selected zone */
+    cs_real_t *pvar_distant = NULL;
+    BFT_MALLOC(pvar_distant, n_distant, cs_real_t);
 
-  /* Check boundary faces:
-     if they are in the selected zone, they are boundary as well */
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-
-    cs_lnum_t c_id = b_face_cells[f_id];
-
-    if (cells_tag_ids[c_id] == 1) {
-      n_bb_faces_sel++;
-      bb_face_sel_ids[n_bb_faces_sel-1] = f_id;
+    for (cs_lnum_t ii = 0; ii < n_distant; ii++) {
+      cs_lnum_t f_id = faces_distant[ii];
+      cs_lnum_t c_id = b_face_cells[f_id];
+      cs_real_t pip;
+      cs_b_cd_unsteady(ircflp,
+                       diipb[f_id],
+                       bs->grad[c_id],
+                       f->val[c_id],
+                       &pip);
+      pvar_distant[ii] = pip;
     }
-  }
 
-  /* Check internal faces:
-     if they are in the selected zone, they can be either
-     internal or boundary faces */
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    /* Receive data */
 
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+    BFT_MALLOC(bs->cpl_flux, bs->n_cpl_faces, cs_real_t);
+    cs_internal_coupling_exchange_var(cpl,
+                                      1, /* Dimension */
+                                      pvar_distant,
+                                      bs->cpl_flux);
 
-    bool indic1 = false;
-    bool indic2 = false;
+    BFT_FREE(pvar_distant);
 
-    if (cells_tag_ids[c_id1] == 1)
-      indic1 = true;
-    if (cells_tag_ids[c_id2] == 1)
-      indic2 = true;
+    /* Flux contribution */
 
-    if (indic1 && indic2) {
-      n_i_faces_sel++;
-      i_face_sel_ids[n_i_faces_sel-1] = f_id;
-    }
-    else if (indic1 || indic2) {
-      bi_face_sel_ids[n_bi_faces_sel] = f_id;
-      n_bi_faces_sel++;
-      /* Build the faces -> cells connectivity as done in
-         i_face_cells */
-      if (indic1)
-        bi_face_cells[f_id][0] = c_id1;
-      else
-        bi_face_cells[f_id][1] = c_id2;
-    }
+    for (cs_lnum_t ii = 0; ii < bs->n_cpl_faces; ii++) {
 
-  }
+      cs_lnum_t f_id = bs->cpl_faces[ii];
+      cs_lnum_t c_id = b_face_cells[f_id];
 
-  /* Compute the balance at time step n
-    ===================================
+      cs_real_t pip;
+      cs_real_t pjp = bs->cpl_flux[ii];
+      cs_real_t term_balance = 0.;
 
-    --> Balance on interior volumes and
-        total quantity on interior volumes
-        ---------------------------------- */
+      cs_b_cd_unsteady(ircflp,
+                       diipb[f_id],
+                       bs->grad[c_id],
+                       f->val[c_id],
+                       &pip);
 
-  for (cs_lnum_t c_id = 0; c_id < n_cells_sel; c_id++) {
+      cs_real_t hint = f->bc_coeffs->hint[f_id];
+      cs_real_t hext = f->bc_coeffs->hext[f_id];
+      cs_real_t heq = hint * hext / (hint + hext);
 
-    cs_lnum_t c_id_sel = cell_sel_ids[c_id];
+      cs_b_diff_flux_coupling(var_cal_opt->idiff,
+                              pip,
+                              pjp,
+                              heq,
+                              &term_balance);
 
-    vol_balance += cell_vol[c_id_sel] * rho[c_id_sel]
-                 * cpro_cp[c_id_sel]
-                 * (f->val_pre[c_id_sel] - f->val[c_id_sel]);
+      bs->cpl_flux[ii] = term_balance;
+
+    }
 
-    cs_real_t rho_y_dt =  rho[c_id_sel] * cpro_cp[c_id_sel]
-                        * f->val_pre[c_id_sel] * dt[c_id_sel];
-    tot_vol_balance2 += cell_vol[c_id_sel] * rho_y_dt * rho_y_dt;
   }
 
-  /* Balance on all faces (interior and boundary), for div(rho u)
-     ------------------------------------------------------------ */
+  return bs;
+}
 
-  /* Interior faces */
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces_sel; f_id++) {
+/*----------------------------------------------------------------------------
+ * Destroy structure containing scalar-dependent balance data.
+ *
+ * parameters:
+ *   bs  <-> pointer to scalar balance data structure
+ *----------------------------------------------------------------------------*/
 
-    cs_lnum_t f_id_sel = i_face_sel_ids[f_id];
-    /* Associated internal cells */
-    cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
+static void
+_balance_scalar_destroy(_balance_scalar_t  **bs)
+{
+  _balance_scalar_t *_bs = *bs;
 
-    /* Contribution to flux from the two cells of the current face
-      (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
+  if (_bs == NULL)
+    return;
 
-    if (c_id1 < n_cells)
-      div_balance += i_mass_flux[f_id_sel] * dt[c_id1] * f->val[c_id1]
-                   * cpro_cp[c_id1];
+  if (_bs->free_cp)
+    BFT_FREE(_bs->cpro_cp);
 
-    if (c_id2 < n_cells)
-      div_balance -= i_mass_flux[f_id_sel] * dt[c_id2] * f->val[c_id2]
-                   * cpro_cp[c_id2];
+  BFT_FREE(_bs->i_visc);
+  BFT_FREE(_bs->b_visc);
 
-  }
+  BFT_FREE(_bs->grad);
+  BFT_FREE(_bs->gradup);
+  BFT_FREE(_bs->gradst);
 
-  /* Boundary faces which are internal in the total mesh */
-  for (cs_lnum_t f_id = 0; f_id < n_bi_faces_sel; f_id++) {
+  BFT_FREE(_bs->local_max);
+  BFT_FREE(_bs->local_min);
+  BFT_FREE(_bs->courant);
 
-    cs_lnum_t f_id_sel = bi_face_sel_ids[f_id];
-    /* Associated boundary-internal cells */
-    cs_lnum_t c_id1 = bi_face_cells[f_id_sel][0];
-    cs_lnum_t c_id2 = bi_face_cells[f_id_sel][1];
+  BFT_FREE(_bs->cpl_flux);
 
-    /* Contribution to flux from the only cell of the current face
-       lying inside the selected zone
-      (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
+  BFT_FREE(*bs);
+}
 
-    if (c_id1 >= 0) {
+/*----------------------------------------------------------------------------
+ * Compute convection and diffusion flux of a scalar at a boundary face.
+ *
+ * parameters:
+ *   bs    <-- pointer to scalar balance data structure
+ *   f_id  <-- boundary face id
+ *
+ * returns:
+ *   flux contribution
+ *----------------------------------------------------------------------------*/
 
-      if (c_id1 < n_cells)
-        div_balance += i_mass_flux[f_id_sel] * dt[c_id1] * f->val[c_id1]
-                     * cpro_cp[c_id1];
-    }
+static cs_real_t
+_b_face_flux(const _balance_scalar_t  *bs,
+             cs_lnum_t                 f_id)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
 
-    else {
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
 
-      if (c_id2 < n_cells)
-        div_balance -= i_mass_flux[f_id_sel] * dt[c_id2] * f->val[c_id2]
-                     * cpro_cp[c_id2];
-    }
+  const cs_field_t *f = bs->f;
+  const cs_var_cal_opt_t *var_cal_opt = &(bs->var_cal_opt);
 
-  }
+  /* all boundary convective fluxes are upwind */
+  int icvflb = 0; // TODO handle total energy balance
+  int icvflf = 0;
 
-  /* Boundary faces which are also boundary in the total mesh */
-  for (cs_lnum_t f_id = 0; f_id < n_bb_faces_sel; f_id++) {
+  cs_lnum_t c_id = m->b_face_cells[f_id];
 
-    cs_lnum_t f_id_sel = bb_face_sel_ids[f_id];
-    /* Associated boundary cell */
-    cs_lnum_t c_id = b_face_cells[f_id_sel];
+  cs_real_t term_balance = 0.;
 
-    /* Contribution to flux from the current face */
-      div_balance += b_mass_flux[f_id_sel] * dt[c_id] * f->val[c_id]
-                   * cpro_cp[c_id];
+  cs_real_t ac_F = 0.;
+  cs_real_t bc_F = 0.;
 
+  if (icvflb == 1) {
+    ac_F = f->bc_coeffs->ac[f_id];
+    bc_F = f->bc_coeffs->bc[f_id];
+    icvflf = 0; /* = icvfli */
   }
 
-  // TODO mass source terms and mass accumulation term
-  // In case of a mass source term, add contribution from Gamma*Tn+1
+  _balance_boundary_faces(icvflf,
+                          cs_glob_time_step_options->idtvar,
+                          var_cal_opt->iconv,
+                          var_cal_opt->idiff,
+                          var_cal_opt->ircflu,
+                          var_cal_opt->relaxv,
+                          diipb[f_id],
+                          bs->grad[c_id],
+                          f->val[c_id],
+                          f->val_pre[c_id],
+                          cs_glob_bc_type[f_id],
+                          bs->b_visc[f_id],
+                          f->bc_coeffs->a[f_id],
+                          f->bc_coeffs->b[f_id],
+                          f->bc_coeffs->af[f_id],
+                          f->bc_coeffs->bf[f_id],
+                          ac_F,
+                          bc_F,
+                          bs->b_mass_flux[f_id],
+                          bs->cpro_cp[c_id],
+                          &term_balance);
+
+  return term_balance;
+}
 
-  int iconvp = var_cal_opt.iconv;
-  int idiffp = var_cal_opt.idiff;
-  int ircflp = var_cal_opt.ircflu;
-  double relaxp = var_cal_opt.relaxv;
+/*----------------------------------------------------------------------------
+ * Compute convection and diffusion flux contributions of a scalar at
+ * an interior face, relative to each of its adjacent cells.
+ *
+ * parameters:
+ *   bs         <-- pointer to scalar balance data structure
+ *   f_id       <-- interior face id
+ *   bi_bterms  --> flux contributions
+ *----------------------------------------------------------------------------*/
 
-  /* Balance on boundary faces
-     -------------------------
+static void
+_i_face_flux(const _balance_scalar_t  *bs,
+             cs_lnum_t                 f_id,
+             cs_real_2_t               bi_bterms)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
 
-     We handle different types of boundary faces separately to better
-     analyze the information, but this is not mandatory. */
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)fvq->djjpf;
 
-  for (cs_lnum_t f_id = 0; f_id < n_bb_faces_sel; f_id++) {
+  const cs_field_t *f = bs->f;
+  const cs_var_cal_opt_t *var_cal_opt = &(bs->var_cal_opt);
 
-    cs_lnum_t f_id_sel = bb_face_sel_ids[f_id];
-    /* Associated boundary cell */
-    cs_lnum_t c_id = b_face_cells[f_id_sel];
+  const int ircflp = var_cal_opt->ircflu;
+  const int ischcp = var_cal_opt->ischcv;
+  const int isstpp = var_cal_opt->isstpc;
+  const double blencp = var_cal_opt->blencv;
+  const int iupwin = (blencp > 0.) ? 0 : 1;
 
-    cs_real_t term_balance = 0.;
+  const cs_real_t *i_mass_flux = bs->i_mass_flux;
 
-    cs_real_t ac_F = 0.;
-    cs_real_t bc_F = 0.;
+  cs_lnum_t c_id1 = m->i_face_cells[f_id][0];
+  cs_lnum_t c_id2 = m->i_face_cells[f_id][1];
 
-    if (icvflb == 1) {
-      ac_F = f->bc_coeffs->ac[f_id_sel];
-      bc_F = f->bc_coeffs->bc[f_id_sel];
-      icvflf = 0; /* = icvfli */
-    }
+  cs_real_t beta = blencp;
+  /* Beta blending coefficient ensuring positivity of the scalar */
+  if (isstpp == 2) {
+    beta = CS_MAX(CS_MIN(bs->cv_limiter[c_id1], bs->cv_limiter[c_id2]), 0.);
+  }
 
-    _balance_boundary_faces(icvflf,
-                            idtvar,
-                            iconvp,
-                            idiffp,
-                            ircflp,
-                            relaxp,
-                            diipb[f_id_sel],
-                            grad[c_id],
-                            f->val[c_id],
-                            f->val_pre[c_id],
-                            bc_type[f_id_sel],
-                            b_visc[f_id_sel],
-                            a_F[f_id_sel],
-                            b_F[f_id_sel],
-                            af_F[f_id_sel],
-                            bf_F[f_id_sel],
-                            ac_F,
-                            bc_F,
-                            b_mass_flux[f_id_sel],
-                            cpro_cp[c_id],
-                            &term_balance);
-
-    if (bc_type[f_id_sel] == CS_INLET ||
-        bc_type[f_id_sel] == CS_FREE_INLET ||
-        bc_type[f_id_sel] == CS_ESICF ||
-        bc_type[f_id_sel] == CS_EPHCF)
-      in_balance -= term_balance*dt[c_id];
-    else if (bc_type[f_id_sel] == CS_OUTLET ||
-             bc_type[f_id_sel] == CS_SSPCF ||
-             bc_type[f_id_sel] == CS_SOPCF)
-      out_balance -= term_balance*dt[c_id];
-    else if (bc_type[f_id_sel] == CS_SYMMETRY)
-      sym_balance -= term_balance*dt[c_id];
-    else if (bc_type[f_id_sel] == CS_SMOOTHWALL)
-      s_wall_balance -= term_balance*dt[c_id];
-    else if (bc_type[f_id_sel] == CS_ROUGHWALL)
-      r_wall_balance -= term_balance*dt[c_id];
-    else if (   bc_type[f_id_sel] == CS_COUPLED
-             || bc_type[f_id_sel] == CS_COUPLED_FD)
-      cpl_balance -= term_balance*dt[c_id];
-    else
-      ndef_balance -= term_balance*dt[c_id];
+  cs_real_t bldfrp = (cs_real_t) ircflp;
+  /* Local limitation of the reconstruction */
+  if (bs->df_limiter != NULL && ircflp > 0)
+    bldfrp = CS_MAX(CS_MIN(bs->df_limiter[c_id1], bs->df_limiter[c_id2]), 0.);
+
+  cs_real_t hybrid_coef_ii, hybrid_coef_jj;
+  cs_lnum_t ic = -1, id = -1;
+  cs_real_t courant_c = -1.;
+  cs_real_t local_max_c = 0., local_min_c = 0.;
+  if (ischcp == 3) {
+    hybrid_coef_ii = CS_F_(hybrid_blend)->val[c_id1];
+    hybrid_coef_jj = CS_F_(hybrid_blend)->val[c_id2];
+  }
+  else if (ischcp == 4) {
+    hybrid_coef_ii = 0.;
+    hybrid_coef_jj = 0.;
+    /* Determine central and downwind sides w.r.t. current face */
+    cs_central_downwind_cells(c_id1,
+                              c_id2,
+                              i_mass_flux[f_id],
+                              &ic,  /* central cell id */
+                              &id); /* downwind cell id */
+
+    if (bs->courant != NULL)
+      courant_c = bs->courant[ic];
+
+    local_max_c = bs->local_max[ic];
+    local_min_c = bs->local_min[ic];
 
+  } else {
+    hybrid_coef_ii = 0.;
+    hybrid_coef_jj = 0.;
   }
 
-  /* Balance on coupled faces
-     ------------------------
+  bi_bterms[0] = 0.;
+  bi_bterms[1] = 0.;
+
+  _balance_internal_faces(iupwin,
+                          cs_glob_time_step_options->idtvar,
+                          var_cal_opt->iconv,
+                          var_cal_opt->idiff,
+                          bldfrp,
+                          ischcp,
+                          isstpp,
+                          bs->limiter_choice,
+                          var_cal_opt->relaxv,
+                          beta,
+                          var_cal_opt->blend_st,
+                          fvq->weight[f_id],
+                          fvq->i_dist[f_id],
+                          fvq->i_face_surf[f_id],
+                          cell_cen[c_id1],
+                          cell_cen[c_id2],
+                          cell_cen[ic],
+                          cell_cen[id],
+                          i_face_normal[f_id],
+                          i_face_cog[f_id],
+                          hybrid_coef_ii,
+                          hybrid_coef_jj,
+                          diipf[f_id],
+                          djjpf[f_id],
+                          bs->grad[c_id1],
+                          bs->grad[c_id2],
+                          bs->grad[ic],
+                          bs->gradup[c_id1],
+                          bs->gradup[c_id2],
+                          bs->gradst[c_id1],
+                          bs->gradst[c_id2],
+                          f->val[c_id1],
+                          f->val[c_id2],
+                          f->val[ic],
+                          f->val[id],
+                          f->val_pre[c_id1],
+                          f->val_pre[c_id2],
+                          bs->i_visc[f_id],
+                          i_mass_flux[f_id],
+                          bs->cpro_cp[c_id1],
+                          bs->cpro_cp[c_id2],
+                          local_max_c,
+                          local_min_c,
+                          courant_c,
+                          bi_bterms);
+}
 
-     We handle different types of boundary faces separately to better
-     analyze the information, but this is not mandatory. */
+/*----------------------------------------------------------------------------
+ * Compute the different terms of the balance of a scalar on a set of
+ * volume zones, with a single pass on the mesh.
+ *
+ * Zones are defined by a cell tag, whose bit z is set for cells belonging
+ * to zone z. Balance terms are summed over all ranks, but the total
+ * balance terms are not computed here.
+ *
+ * parameters:
+ *   bs        <-- pointer to scalar balance data structure
+ *   n_zones   <-- number of zones (at most _BALANCE_ZONES_MAX)
+ *   cell_tag  <-- zone tag of each cell (size: n_cells_ext)
+ *   balance   --> balance terms (size: n_zones*CS_BALANCE_N_TERMS)
+ *----------------------------------------------------------------------------*/
 
-  if (var_cal_opt.icoupl > 0) {
+static void
+_balance_by_zones(const _balance_scalar_t  *bs,
+                  int                       n_zones,
+                  const uint64_t            cell_tag[],
+                  cs_real_t                 balance[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
 
-    /* Prepare data for sending from distant */
-    BFT_MALLOC(pvar_distant, n_distant, cs_real_t);
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
 
-    for (cs_lnum_t ii = 0; ii < n_distant; ii++) {
-      cs_lnum_t f_id = faces_distant[ii];
-      cs_lnum_t c_id = b_face_cells[f_id];
-      cs_real_t pip;
-      cs_b_cd_unsteady(ircflp,
-                       diipb[f_id],
-                       grad[c_id],
-                       f->val[c_id],
-                       &pip);
-      pvar_distant[ii] = pip;
-    }
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_real_t *restrict cell_vol = fvq->cell_vol;
 
-    /* Receive data */
-    BFT_MALLOC(pvar_local, n_local, cs_real_t);
-    cs_internal_coupling_exchange_var(cpl,
-                                      1, /* Dimension */
-                                      pvar_distant,
-                                      pvar_local);
+  const int *bc_type = cs_glob_bc_type;
 
-    /* flux contribution */
-    for (cs_lnum_t ii = 0; ii < n_local; ii++) {
-      cs_lnum_t f_id = faces_local[ii];
-      cs_lnum_t c_id = b_face_cells[f_id];
-      if (cells_tag_ids[c_id] == 1) {
-        cs_real_t pip, pjp;
-        cs_real_t term_balance = 0.;
+  const cs_field_t *f = bs->f;
+  const cs_real_t *dt = CS_F_(dt)->val;
+  const cs_real_t *rho = CS_F_(rho)->val;
+  const cs_real_t *cpro_cp = bs->cpro_cp;
+  const cs_real_t *i_mass_flux = bs->i_mass_flux;
+  const cs_real_t *b_mass_flux = bs->b_mass_flux;
+
+  for (cs_lnum_t i = 0; i < n_zones*CS_BALANCE_N_TERMS; i++)
+    balance[i] = 0.;
+
+  /* Balance on interior volumes and
+     total quantity on interior volumes
+     (CS_BALANCE_TOTAL_NORMALIZED temporarily used for the latter) */
 
-        cs_b_cd_unsteady(ircflp,
-                         diipb[f_id],
-                         grad[c_id],
-                         f->val[c_id],
-                         &pip);
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
-        pjp = pvar_local[ii];
+    uint64_t tag = cell_tag[c_id];
+    if (tag == 0)
+      continue;
 
-        hint = f->bc_coeffs->hint[f_id];
-        hext = f->bc_coeffs->hext[f_id];
-        heq = hint * hext / (hint + hext);
+    cs_real_t vol_balance =   cell_vol[c_id] * rho[c_id] * cpro_cp[c_id]
+                            * (f->val_pre[c_id] - f->val[c_id]);
 
-        cs_b_diff_flux_coupling(idiffp,
-                                pip,
-                                pjp,
-                                heq,
-                                &term_balance);
+    cs_real_t rho_y_dt =  rho[c_id] * cpro_cp[c_id]
+                        * f->val_pre[c_id] * dt[c_id];
+    cs_real_t tot_vol_balance2 = cell_vol[c_id] * rho_y_dt * rho_y_dt;
 
-        i_cpl_balance -= term_balance*dt[c_id];
+    for (int z = 0; z < n_zones; z++) {
+      if (tag & ((uint64_t)1 << z)) {
+        cs_real_t *_balance = balance + z*CS_BALANCE_N_TERMS;
+        _balance[CS_BALANCE_VOLUME] += vol_balance;
+        _balance[CS_BALANCE_TOTAL_NORMALIZED] += tot_vol_balance2;
       }
     }
 
-    BFT_FREE(pvar_local);
-    BFT_FREE(pvar_distant);
-
   }
 
-  /* Balance on boundary faces of the selected zone
-     that are interior to the total mesh
-     ---------------------------------------------- */
+  /* Interior faces: contribution to div(rho u) for faces adjacent to
+     a zone, and fluxes through faces on the boundary of a zone
+     (cells are counted only once in parallel by checking that
+     the c_id is not in the halo) */
 
-  int isstpp = var_cal_opt.isstpc;
-  double blencp = var_cal_opt.blencv;
-  double blend_st = var_cal_opt.blend_st;
-  int iupwin = (blencp > 0.) ? 0 : 1;
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
 
-  for (cs_lnum_t f_id = 0; f_id < n_bi_faces_sel; f_id++) {
+    cs_lnum_t c_id1 = i_face_cells[f_id][0];
+    cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
-    cs_lnum_t f_id_sel = bi_face_sel_ids[f_id];
-    /* Associated boundary-internal cells */
-    cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
+    uint64_t tag1 = cell_tag[c_id1];
+    uint64_t tag2 = cell_tag[c_id2];
 
-    cs_real_t beta = blencp;
-    /* Beta blending coefficient ensuring positivity of the scalar */
-    if (isstpp == 2) {
-      beta = CS_MAX(CS_MIN(cv_limiter[c_id1], cv_limiter[c_id2]), 0.);
-    }
+    if ((tag1 | tag2) == 0)
+      continue;
 
-    cs_real_t bldfrp = (cs_real_t) ircflp;
-    /* Local limitation of the reconstruction */
-    if (df_limiter != NULL && ircflp > 0)
-      bldfrp = CS_MAX(CS_MIN(df_limiter[c_id1], df_limiter[c_id2]), 0.);
-
-    cs_real_t hybrid_coef_ii, hybrid_coef_jj;
-    cs_lnum_t ic = -1, id = -1;
-    cs_real_t courant_c = -1.;
-    if (ischcp == 3) {
-      hybrid_coef_ii = CS_F_(hybrid_blend)->val[c_id1];
-      hybrid_coef_jj = CS_F_(hybrid_blend)->val[c_id2];
-    }
-    else if (ischcp == 4) {
-      hybrid_coef_ii = 0.;
-      hybrid_coef_jj = 0.;
-      /* Determine central and downwind sides w.r.t. current face */
-      cs_central_downwind_cells(c_id1,
-                                c_id2,
-                                i_mass_flux[f_id_sel],
-                                &ic,  /* central cell id */
-                                &id); /* downwind cell id */
-
-      if (courant != NULL)
-        courant_c = courant[ic];
+    cs_real_t div1 = 0., div2 = 0.;
 
-    } else {
-      hybrid_coef_ii = 0.;
-      hybrid_coef_jj = 0.;
-    }
+    if (c_id1 < n_cells)
+      div1 = i_mass_flux[f_id] * dt[c_id1] * f->val[c_id1] * cpro_cp[c_id1];
+    if (c_id2 < n_cells)
+      div2 = i_mass_flux[f_id] * dt[c_id2] * f->val[c_id2] * cpro_cp[c_id2];
 
     cs_real_2_t bi_bterms = {0., 0.};
 
-    _balance_internal_faces(iupwin,
-                            idtvar,
-                            iconvp,
-                            idiffp,
-                            bldfrp,
-                            ischcp,
-                            isstpp,
-                            limiter_choice,
-                            relaxp,
-                            beta,
-                            blend_st,
-                            weight[f_id_sel],
-                            i_dist[f_id_sel],
-                            i_face_surf[f_id_sel],
-                            cell_cen[c_id1],
-                            cell_cen[c_id2],
-                            cell_cen[ic],
-                            cell_cen[id],
-                            i_face_normal[f_id_sel],
-                            i_face_cog[f_id_sel],
-                            hybrid_coef_ii,
-                            hybrid_coef_jj,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
-                            grad[c_id1],
-                            grad[c_id2],
-                            grad[ic],
-                            gradup[c_id1],
-                            gradup[c_id2],
-                            gradst[c_id1],
-                            gradst[c_id2],
-                            f->val[c_id1],
-                            f->val[c_id2],
-                            f->val[ic],
-                            f->val[id],
-                            f->val_pre[c_id1],
-                            f->val_pre[c_id2],
-                            i_visc[f_id_sel],
-                            i_mass_flux[f_id_sel],
-                            cpro_cp[c_id1],
-                            cpro_cp[c_id2],
-                            local_max[ic],
-                            local_min[ic],
-                            courant_c,
-                            bi_bterms);
+    if ((tag1 ^ tag2) != 0)
+      _i_face_flux(bs, f_id, bi_bterms);
 
-    /* (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
-    /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
-      if (c_id1 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0)
-          bi_o_balance -= bi_bterms[0]*dt[c_id1];
-        else
-          bi_i_balance -= bi_bterms[0]*dt[c_id1];
+    for (int z = 0; z < n_zones; z++) {
+
+      const uint64_t z_mask = (uint64_t)1 << z;
+      const bool indic1 = (tag1 & z_mask) ? true : false;
+      const bool indic2 = (tag2 & z_mask) ? true : false;
+
+      cs_real_t *_balance = balance + z*CS_BALANCE_N_TERMS;
+
+      if (indic1 && indic2) {
+        _balance[CS_BALANCE_DIV] += div1 - div2;
+      }
+
+      /* Face normal well oriented */
+      else if (indic1) {
+        _balance[CS_BALANCE_DIV] += div1;
+        if (c_id1 < n_cells) {
+          if (i_mass_flux[f_id] > 0)
+            _balance[CS_BALANCE_INTERIOR_OUT] -= bi_bterms[0]*dt[c_id1];
+          else
+            _balance[CS_BALANCE_INTERIOR_IN] -= bi_bterms[0]*dt[c_id1];
+        }
       }
+
+      /* Face normal direction reversed */
+      else if (indic2) {
+        _balance[CS_BALANCE_DIV] -= div2;
+        if (c_id2 < n_cells) {
+          if (i_mass_flux[f_id] > 0)
+            _balance[CS_BALANCE_INTERIOR_IN] += bi_bterms[1]*dt[c_id2];
+          else
+            _balance[CS_BALANCE_INTERIOR_OUT] += bi_bterms[1]*dt[c_id2];
+        }
+      }
+
     }
-    /* Face normal direction reversed */
-    else {
-      if (c_id2 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0)
-          bi_i_balance += bi_bterms[1]*dt[c_id2];
-        else
-          bi_o_balance += bi_bterms[1]*dt[c_id2];
+
+  }
+
+  // TODO mass source terms and mass accumulation term
+  // In case of a mass source term, add contribution from Gamma*Tn+1
+
+  /* Boundary faces: contribution to div(rho u) and fluxes.
+
+     We handle different types of boundary faces separately to better
+     analyze the information, but this is not mandatory. */
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+
+    cs_lnum_t c_id = b_face_cells[f_id];
+
+    uint64_t tag = cell_tag[c_id];
+    if (tag == 0)
+      continue;
+
+    cs_real_t div = b_mass_flux[f_id] * dt[c_id] * f->val[c_id]
+                    * cpro_cp[c_id];
+
+    cs_real_t term_balance = _b_face_flux(bs, f_id) * dt[c_id];
+    int t_id = _b_face_balance_term(bc_type[f_id]);
+
+    for (int z = 0; z < n_zones; z++) {
+      if (tag & ((uint64_t)1 << z)) {
+        cs_real_t *_balance = balance + z*CS_BALANCE_N_TERMS;
+        _balance[CS_BALANCE_DIV] += div;
+        _balance[t_id] -= term_balance;
       }
     }
 
   }
 
-  /* Free memory */
+  /* Balance on internally coupled faces */
 
-  BFT_FREE(grad);
-  BFT_FREE(gradup);
-  BFT_FREE(gradst);
-  BFT_FREE(f_reconstructed);
-  BFT_FREE(local_max);
-  BFT_FREE(local_min);
-  BFT_FREE(courant);
+  for (cs_lnum_t ii = 0; ii < bs->n_cpl_faces; ii++) {
 
-  if (!itemperature || icp == -1)
-    BFT_FREE(cpro_cp);
-  BFT_FREE(c_visc);
-  BFT_FREE(i_visc);
-  BFT_FREE(b_visc);
+    cs_lnum_t f_id = bs->cpl_faces[ii];
+    cs_lnum_t c_id = b_face_cells[f_id];
 
-  BFT_FREE(cells_tag_ids);
-  BFT_FREE(bi_face_cells);
-  BFT_FREE(i_face_sel_ids);
-  BFT_FREE(bb_face_sel_ids);
-  BFT_FREE(bi_face_sel_ids);
+    uint64_t tag = cell_tag[c_id];
+    if (tag == 0)
+      continue;
+
+    for (int z = 0; z < n_zones; z++) {
+      if (tag & ((uint64_t)1 << z))
+        balance[z*CS_BALANCE_N_TERMS + CS_BALANCE_BOUNDARY_COUPLED_I]
+          -= bs->cpl_flux[ii]*dt[c_id];
+    }
+
+  }
 
   /* Sum of values on all ranks (parallel calculations) */
 
-  balance[CS_BALANCE_TOTAL_NORMALIZED] = tot_vol_balance2; /* temporary */
-
-  balance[CS_BALANCE_VOLUME] = vol_balance;
-  balance[CS_BALANCE_DIV] = div_balance;
-  balance[CS_BALANCE_UNSTEADY] = vol_balance + div_balance;
-  balance[CS_BALANCE_MASS] = mass_i_balance + mass_o_balance;
-  balance[CS_BALANCE_MASS_IN] = mass_i_balance;
-  balance[CS_BALANCE_MASS_OUT] = mass_o_balance;
-  balance[CS_BALANCE_INTERIOR_IN] = bi_i_balance;
-  balance[CS_BALANCE_INTERIOR_OUT] = bi_o_balance;
-  balance[CS_BALANCE_BOUNDARY_IN] = in_balance;
-  balance[CS_BALANCE_BOUNDARY_OUT] = out_balance;
-  balance[CS_BALANCE_BOUNDARY_SYM] = sym_balance;
-  balance[CS_BALANCE_BOUNDARY_WALL] = s_wall_balance + r_wall_balance;
-  balance[CS_BALANCE_BOUNDARY_WALL_S] = s_wall_balance;
-  balance[CS_BALANCE_BOUNDARY_WALL_R] = r_wall_balance;
-  balance[CS_BALANCE_BOUNDARY_COUPLED] = cpl_balance + i_cpl_balance;
-  balance[CS_BALANCE_BOUNDARY_COUPLED_E] = cpl_balance;
-  balance[CS_BALANCE_BOUNDARY_COUPLED_I] = i_cpl_balance;
-  balance[CS_BALANCE_BOUNDARY_OTHER] = ndef_balance;
-
-  cs_parall_sum(CS_BALANCE_N_TERMS, CS_REAL_TYPE, balance);
+  cs_parall_sum(n_zones*CS_BALANCE_N_TERMS, CS_REAL_TYPE, balance);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute partial and total balance terms of a volume balance.
+ *
+ * parameters:
+ *   balance   <-> balance terms
+ *----------------------------------------------------------------------------*/
+
+static void
+_balance_by_zone_complete(cs_real_t  balance[CS_BALANCE_N_TERMS])
+{
+  balance[CS_BALANCE_UNSTEADY]
+    = balance[CS_BALANCE_VOLUME] + balance[CS_BALANCE_DIV];
+  balance[CS_BALANCE_MASS]
+    = balance[CS_BALANCE_MASS_IN] + balance[CS_BALANCE_MASS_OUT];
+  balance[CS_BALANCE_BOUNDARY_WALL]
+    = balance[CS_BALANCE_BOUNDARY_WALL_S] + balance[CS_BALANCE_BOUNDARY_WALL_R];
+  balance[CS_BALANCE_BOUNDARY_COUPLED]
+    =   balance[CS_BALANCE_BOUNDARY_COUPLED_E]
+      + balance[CS_BALANCE_BOUNDARY_COUPLED_I];
 
   /* Total balance: add the different contributions calculated above */
 
@@ -1612,63 +1627,182 @@ cs_balance_by_zone_compute(const char      *scalar_name,
       + balance[CS_BALANCE_BOUNDARY_COUPLED]
       + balance[CS_BALANCE_BOUNDARY_OTHER];
 
-  tot_vol_balance2 = balance[CS_BALANCE_TOTAL_NORMALIZED]; /* from temporary above */
+  /* Normalization (total volume term stored temporarily) */
+
+  cs_real_t tot_vol_balance2 = balance[CS_BALANCE_TOTAL_NORMALIZED];
   balance[CS_BALANCE_TOTAL_NORMALIZED] = balance[CS_BALANCE_TOTAL];
 
   if (tot_vol_balance2 > 0.)
     balance[CS_BALANCE_TOTAL_NORMALIZED] /= sqrt(tot_vol_balance2);
 }
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Compute and log the different terms of the balance of a given scalar,
- *        on a volumic zone defined by selection criteria.
- *        The different contributions to the balance are printed in the
- *        run_solver.log.
- *
- * This function computes the balance relative to a given scalar
- * on a selected zone of the mesh.
- * We assume that we want to compute balances (convective and diffusive)
- * at the boundaries of the calculation domain represented below
- * (with different boundary types).
- *
- * The scalar and the zone are selected at the top of the routine
- * by the user.
- * In the case of the temperature, the energy balance in Joules will be
- * computed by multiplying by the specific heat.
+/*----------------------------------------------------------------------------
+ * Compute the surface flux of a scalar through selected faces.
  *
- * \param[in]     selection_crit      zone selection criterion
- * \param[in]     scalar_name         scalar name
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   bs              <-- pointer to scalar balance data structure
+ *   normal          <-- outwards normal direction
+ *   n_b_faces_sel   <-- number of selected boundary faces
+ *   n_i_faces_sel   <-- number of selected internal faces
+ *   b_face_sel_ids  <-- ids of selected boundary faces, or NULL (all)
+ *   i_face_sel_ids  <-- ids of selected internal faces
+ *   balance         --> local balance terms (not summed over ranks)
+ *   flux_b_faces    --> surface flux through selected boundary faces,
+ *                       or NULL
+ *   flux_i_faces    --> surface flux through selected interior faces,
+ *                       or NULL
+ *----------------------------------------------------------------------------*/
 
-void
-cs_balance_by_zone(const char  *selection_crit,
-                   const char  *scalar_name)
+static void
+_flux_through_surface(const _balance_scalar_t  *bs,
+                      const cs_real_t           normal[3],
+                      cs_lnum_t                 n_b_faces_sel,
+                      cs_lnum_t                 n_i_faces_sel,
+                      const cs_lnum_t           b_face_sel_ids[],
+                      const cs_lnum_t           i_face_sel_ids[],
+                      cs_real_t                 balance[CS_BALANCE_N_TERMS],
+                      cs_real_t                *flux_b_faces,
+                      cs_real_t                *flux_i_faces)
 {
-  cs_real_t balance[CS_BALANCE_N_TERMS];
-
   const cs_mesh_t *m = cs_glob_mesh;
-  const int nt_cur = cs_glob_time_step->nt_cur;
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
 
-  /* Select cells */
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
 
-  cs_lnum_t n_cells_sel = 0;
-  cs_lnum_t *cells_sel_ids = NULL;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
 
-  BFT_MALLOC(cells_sel_ids, m->n_cells, cs_lnum_t);
-  cs_selector_get_cell_list(selection_crit, &n_cells_sel, cells_sel_ids);
+  const int *bc_type = cs_glob_bc_type;
+  const cs_real_t *i_mass_flux = bs->i_mass_flux;
 
-  /* Compute balance */
+  for (int i = 0; i < CS_BALANCE_N_TERMS; i++)
+    balance[i] = 0;
 
-  cs_balance_by_zone_compute(scalar_name,
-                             n_cells_sel,
-                             cells_sel_ids,
-                             balance);
+  /* Boundary faces contribution */
 
-  BFT_FREE(cells_sel_ids);
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces_sel; f_id++) {
 
-  /* Log results at time step n */
+    cs_lnum_t f_id_sel = (b_face_sel_ids != NULL) ? b_face_sel_ids[f_id] : f_id;
+
+    cs_real_t term_balance = _b_face_flux(bs, f_id_sel);
+
+    if (flux_b_faces != NULL)
+      flux_b_faces[f_id] = term_balance;
+
+    balance[_b_face_balance_term(bc_type[f_id_sel])] -= term_balance;
+
+  }
+
+  /* Balance on coupled faces */
+
+  if (bs->n_cpl_faces > 0) {
+
+    cs_lnum_t *inv_b_face_sel_ids = NULL;
+
+    BFT_MALLOC(inv_b_face_sel_ids, n_b_faces, cs_lnum_t);
+    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++)
+      inv_b_face_sel_ids[f_id] = -1;
+
+    if (b_face_sel_ids != NULL) {
+      for (cs_lnum_t f_id = 0; f_id < n_b_faces_sel; f_id++) {
+        cs_lnum_t f_id_sel = b_face_sel_ids[f_id];
+        inv_b_face_sel_ids[f_id_sel] = f_id;
+      }
+    }
+    else {
+      for (cs_lnum_t f_id_sel = 0; f_id_sel < n_b_faces_sel; f_id_sel++)
+        inv_b_face_sel_ids[f_id_sel] = f_id_sel;
+    }
+
+    for (cs_lnum_t ii = 0; ii < bs->n_cpl_faces; ii++) {
+
+      cs_lnum_t f_id = bs->cpl_faces[ii];
+      cs_lnum_t sel_f_id = inv_b_face_sel_ids[f_id];
+
+      if (sel_f_id < 0)
+        continue;
+
+      if (flux_b_faces != NULL)
+        flux_b_faces[sel_f_id] = bs->cpl_flux[ii];
+
+      balance[CS_BALANCE_BOUNDARY_COUPLED_I] -= bs->cpl_flux[ii];
+
+    }
+
+    BFT_FREE(inv_b_face_sel_ids);
+  }
+
+  /* Balance on selected interior faces */
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces_sel; f_id++) {
+
+    cs_lnum_t f_id_sel = i_face_sel_ids[f_id];
+    cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
+    cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
+
+    if (flux_i_faces != NULL)
+      flux_i_faces[f_id] = 0.;
+
+    /* Orientation relative to the given normal */
+
+    cs_real_t dot_pro = cs_math_3_dot_product(normal, i_face_normal[f_id_sel]);
+    if (fabs(dot_pro) < 1.0e-14)//FIXME
+      continue;
+
+    /* (The cell is counted only once in parallel by checking that
+       the c_id is not in the halo) */
+
+    if (dot_pro > 0. && c_id1 >= n_cells)
+      continue;
+    else if (dot_pro < 0. && c_id2 >= n_cells)
+      continue;
+
+    cs_real_2_t bi_bterms = {0., 0.};
+
+    _i_face_flux(bs, f_id_sel, bi_bterms);
+
+    /* Face normal well oriented */
+    cs_real_t flux = - bi_bterms[0];
+
+    /* Face normal direction reversed */
+    if (dot_pro < 0.)
+      flux = bi_bterms[1];
+
+    if (flux_i_faces != NULL)
+      flux_i_faces[f_id] = flux;
+
+    if (i_mass_flux[f_id_sel] > 0)
+      balance[CS_BALANCE_INTERIOR_IN] += flux;
+    else
+      balance[CS_BALANCE_INTERIOR_OUT] += flux;
+
+  }
+
+  balance[CS_BALANCE_BOUNDARY_WALL] =   balance[CS_BALANCE_BOUNDARY_WALL_S]
+                                      + balance[CS_BALANCE_BOUNDARY_WALL_R];
+  balance[CS_BALANCE_BOUNDARY_COUPLED]
+    =   balance[CS_BALANCE_BOUNDARY_COUPLED_E]
+      + balance[CS_BALANCE_BOUNDARY_COUPLED_I];
+}
+
+/*----------------------------------------------------------------------------
+ * Log the terms of a scalar balance on a volume zone.
+ *
+ * parameters:
+ *   selection_crit  <-- zone selection criterion
+ *   scalar_name     <-- scalar name
+ *   balance         <-- balance terms
+ *----------------------------------------------------------------------------*/
+
+static void
+_balance_by_zone_log(const char       *selection_crit,
+                     const char       *scalar_name,
+                     const cs_real_t   balance[CS_BALANCE_N_TERMS])
+{
+  const int nt_cur = cs_glob_time_step->nt_cur;
 
   bft_printf
     (_("   ** SCALAR BALANCE BY ZONE at iteration %6i\n"
@@ -1708,572 +1842,427 @@ cs_balance_by_zone(const char  *selection_crit,
      balance[CS_BALANCE_TOTAL], balance[CS_BALANCE_TOTAL_NORMALIZED]);
 }
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Computes one term of the head loss balance (pressure drop) on a
- *        on a volume zone defined by selected cell ids/
+/*----------------------------------------------------------------------------
+ * Count selected faces of a surface balance over all ranks.
  *
- * \param[in]     n_cells_sel         number of selected cells
- * \param[in]     cell_sel_ids        ids of selected cells
- * \param[out]    balance             array of computed balance terms
- *                                    (see \ref cs_balance_p_term_t)
- */
-/*----------------------------------------------------------------------------*/
+ * Interior faces are counted only on the rank owning their first cell.
+ *
+ * parameters:
+ *   n_b_faces_sel   <-- number of selected boundary faces
+ *   n_i_faces_sel   <-- number of selected internal faces
+ *   i_face_sel_ids  <-- ids of selected internal faces
+ *   n_g_sel         --> global number of selected boundary and
+ *                       interior faces
+ *----------------------------------------------------------------------------*/
 
-void
-cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
-                                 const cs_lnum_t  cell_sel_ids[],
-                                 cs_real_t        balance[CS_BALANCE_P_N_TERMS])
+static void
+_surface_balance_count(cs_lnum_t        n_b_faces_sel,
+                       cs_lnum_t        n_i_faces_sel,
+                       const cs_lnum_t  i_face_sel_ids[],
+                       cs_gnum_t        n_g_sel[2])
 {
   const cs_mesh_t *m = cs_glob_mesh;
-  cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
-
-  const cs_halo_t  *halo = m->halo;
-
   const cs_lnum_t n_cells = m->n_cells;
-  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
-  const cs_lnum_t n_i_faces = m->n_i_faces;
-  const cs_lnum_t n_b_faces = m->n_b_faces;
-
   const cs_lnum_2_t *restrict i_face_cells
     = (const cs_lnum_2_t *restrict)m->i_face_cells;
-  const cs_lnum_t *restrict b_face_cells
-    = (const cs_lnum_t *restrict)m->b_face_cells;
-  const cs_real_3_t *restrict i_face_cog
-    = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict b_face_cog
-    = (const cs_real_3_t *restrict)fvq->b_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *restrict)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *restrict)fvq->djjpf;
-  const cs_real_3_t *restrict diipb
-    = (const cs_real_3_t *restrict)fvq->diipb;
-
-  const int *bc_type = cs_glob_bc_type;
-
-  /* initialize output */
-
-  for (int i = 0; i < CS_BALANCE_P_N_TERMS; i++)
-    balance[i] = 0;
-
-  /* Get physical fields */
-  const cs_real_t *rho = CS_F_(rho)->val;
-  const cs_field_t *f_pres = CS_F_(p);
-  const cs_real_t *pressure = f_pres->val;
-  const cs_field_t *f_vel = CS_F_(vel);
-  const cs_real_3_t *velocity =  (const cs_real_3_t *)f_vel->val;
-  cs_real_3_t gravity = {cs_glob_physical_constants->gravity[0],
-                         cs_glob_physical_constants->gravity[1],
-                         cs_glob_physical_constants->gravity[2]};
-
-  /* Zone cells selection variables*/
-  cs_lnum_t n_i_faces_sel = 0;
-  cs_lnum_t *i_face_sel_ids = NULL;
-  cs_lnum_t n_bb_faces_sel = 0;
-  cs_lnum_t *bb_face_sel_ids = NULL;
-  cs_lnum_t n_bi_faces_sel = 0;
-  cs_lnum_t *bi_face_sel_ids = NULL;
-  cs_lnum_2_t *bi_face_cells = NULL;
-  cs_lnum_t *cells_tag_ids = NULL;
-
-  /* Initialization of balance contributions
-     ---------------------------------------
-
-    in_pressure   : contribution from inlets
-    out_pressure  : contribution from outlets
-    in_u2         : contribution from inlets
-    out_u2        : contribution from outlets
-    in_rhogx      : contribution from inlets
-    out_rhogx     : contribution from outlets
-    in_debit      : debit from inlets
-    out_debit     : debit from outlets
-    in_m_debit    : mass flow from inlets
-    out_m_debit   : mass flow from outlets
 
-  */
+  n_g_sel[0] = n_b_faces_sel;
+  n_g_sel[1] = 0;
 
-  double in_pressure= 0.;
-  double out_pressure= 0.;
-  double in_u2 = 0.;
-  double out_u2 = 0.;
-  double in_rhogx = 0.;
-  double out_rhogx = 0.;
-  double in_debit = 0.;
-  double out_debit = 0.;
-  double in_m_debit = 0.;
-  double out_m_debit = 0.;
+  for (cs_lnum_t i = 0; i < n_i_faces_sel; i++) {
+    cs_lnum_t f_id = i_face_sel_ids[i];
+    if (i_face_cells[f_id][0] < n_cells)
+      n_g_sel[1] += 1;
+  }
 
-  /* Boundary condition coefficient for p */
-  const cs_real_t *a_p = f_pres->bc_coeffs->a;
-  const cs_real_t *b_p = f_pres->bc_coeffs->b;
+  cs_parall_sum(2, CS_GNUM_TYPE, n_g_sel);
+}
 
-  /* Boundary condition coefficient for u */
-  const cs_real_3_t *a_u = (const cs_real_3_t *)f_vel->bc_coeffs->a;
-  const cs_real_33_t *b_u = (const cs_real_33_t *)f_vel->bc_coeffs->b;
+/*----------------------------------------------------------------------------
+ * Log the terms of a scalar surface balance.
+ *
+ * parameters:
+ *   selection_crit  <-- zone selection criterion
+ *   scalar_name     <-- scalar name
+ *   normal          <-- outwards normal direction
+ *   n_g_sel         <-- global number of selected boundary and
+ *                       interior faces
+ *   balance         <-- balance terms
+ *----------------------------------------------------------------------------*/
 
-  /* Convective mass fluxes for inner and boundary faces */
-  int iflmas = cs_field_get_key_int(f_pres, cs_field_key_id("inner_mass_flux_id"));
-  const cs_real_t *i_mass_flux = cs_field_by_id(iflmas)->val;
+static void
+_surface_balance_log(const char       *selection_crit,
+                     const char       *scalar_name,
+                     const cs_real_t   normal[3],
+                     const cs_gnum_t   n_g_sel[2],
+                     const cs_real_t   balance[CS_BALANCE_N_TERMS])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const int nt_cur = cs_glob_time_step->nt_cur;
 
-  int iflmab = cs_field_get_key_int(f_pres, cs_field_key_id("boundary_mass_flux_id"));
-  const cs_real_t *b_mass_flux = cs_field_by_id(iflmab)->val;
+  /* Compute some sums */
 
-  int inc = 1;
+  cs_real_t flux_b_faces
+    = balance[CS_BALANCE_BOUNDARY_IN] + balance[CS_BALANCE_BOUNDARY_OUT]
+    + balance[CS_BALANCE_BOUNDARY_SYM] + balance[CS_BALANCE_BOUNDARY_WALL]
+    + balance[CS_BALANCE_BOUNDARY_COUPLED_E]
+    + balance[CS_BALANCE_BOUNDARY_OTHER];
 
-  /* Get user-selected zone
-     ====================== */
+  cs_real_t flux_i_faces
+    = balance[CS_BALANCE_INTERIOR_IN] + balance[CS_BALANCE_INTERIOR_OUT];
 
-  /* Initialize arrays */
+  /* Log balance */
 
-  /* Internal faces of the selected zone */
-  BFT_MALLOC(i_face_sel_ids, n_i_faces, cs_lnum_t);
-  /* Boundary faces of the selected zone,
-     which are internal faces of the global mesh.
-     Faces -> cells connectivity */
-  BFT_MALLOC(bi_face_sel_ids, n_i_faces, cs_lnum_t);
-  BFT_MALLOC(bi_face_cells, n_i_faces, cs_lnum_2_t);
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-    i_face_sel_ids[f_id] = -1;
-    bi_face_sel_ids[f_id] = -1;
-    bi_face_cells[f_id][0] = -999;
-    bi_face_cells[f_id][1] = -999;
-  }
-
-  /* Boundary faces of the selected zone,
-     which are also boundary faces of the global mesh */
-  BFT_MALLOC(bb_face_sel_ids, n_b_faces, cs_lnum_t);
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-    bb_face_sel_ids[f_id] = -1;
-  }
-
-
-  /* Synchronization for parallelism */
-  BFT_MALLOC(cells_tag_ids, n_cells_ext, cs_lnum_t);
-  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-    cells_tag_ids[c_id] = 0;
-  }
-  for (cs_lnum_t c_id = 0; c_id < n_cells_sel; c_id++) {
-    cs_lnum_t c_id_sel = cell_sel_ids[c_id];
-    cells_tag_ids[c_id_sel] = 1;
-  }
-  if (halo != NULL) {
-    cs_halo_sync_num(halo, CS_HALO_STANDARD, cells_tag_ids);
-  }
+  bft_printf
+    (_("\n   ** SURFACE BALANCE at iteration %6i\n"
+       "     ------------------------------------\n"
+       "------------------------------------------------------------\n"
+       "   SCALAR: %s\n"
+       "   ZONE SELECTION CRITERIA: \"%s\"\n"
+       "   OUTGOING NORMAL: [%.2e, %.2e, %.2e] \n"
+       "------------------------------------------------------------\n"
+       "   Interior faces selected: %llu of %llu \n"
+       "   Boundary faces selected: %llu of %llu \n"
+       "------------------------------------------------------------\n"
+       "    Boundary faces:        %12.4e \n"
+       "    Int. Coupling faces:   %12.4e \n"
+       "    Interior faces:        \n"
+       "      In:                  %12.4e \n"
+       "      Out:                 %12.4e \n"
+       "      Balance:             %12.4e \n"
+       "------------------------------------------------------------\n"),
+     nt_cur, scalar_name, selection_crit,
+     normal[0], normal[1], normal[2],
+     (unsigned long long)n_g_sel[1], (unsigned long long)(m->n_g_i_faces),
+     (unsigned long long)n_g_sel[0], (unsigned long long)(m->n_g_b_faces),
+     flux_b_faces, balance[CS_BALANCE_BOUNDARY_COUPLED_E],
+     balance[CS_BALANCE_INTERIOR_IN], balance[CS_BALANCE_INTERIOR_OUT],
+     flux_i_faces);
+}
 
-  /* Classify mesh faces with respect to the selected zone */
+/*----------------------------------------------------------------------------
+ * Update element selections of balance definitions if needed.
+ *
+ * Selections are determined once, and updated only if the mesh changes.
+ *----------------------------------------------------------------------------*/
 
-  /* Check boundary faces:
-     if they are in the selected zone, they are boundary as well */
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+static void
+_balance_defs_select(void)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
 
-    cs_lnum_t c_id = b_face_cells[f_id];
+  if (   m->n_cells == _balance_sel_mesh_sizes[0]
+      && m->n_i_faces == _balance_sel_mesh_sizes[1]
+      && m->n_b_faces == _balance_sel_mesh_sizes[2]
+      && m->time_dep < CS_MESH_TRANSIENT_CONNECT)
+    return;
 
-    if (cells_tag_ids[c_id] == 1) {
-      n_bb_faces_sel++;
-      bb_face_sel_ids[n_bb_faces_sel-1] = f_id;
+  for (int d_id = 0; d_id < _n_balance_defs; d_id++) {
+
+    _balance_def_t *bd = _balance_defs + d_id;
+
+    if (bd->surface) {
+      BFT_REALLOC(bd->elt_ids[0], m->n_b_faces, cs_lnum_t);
+      BFT_REALLOC(bd->elt_ids[1], m->n_i_faces, cs_lnum_t);
+      cs_selector_get_b_face_list(bd->criteria,
+                                  &(bd->n_elts[0]), bd->elt_ids[0]);
+      cs_selector_get_i_face_list(bd->criteria,
+                                  &(bd->n_elts[1]), bd->elt_ids[1]);
+      BFT_REALLOC(bd->elt_ids[0], bd->n_elts[0], cs_lnum_t);
+      BFT_REALLOC(bd->elt_ids[1], bd->n_elts[1], cs_lnum_t);
+      _surface_balance_count(bd->n_elts[0],
+                             bd->n_elts[1],
+                             bd->elt_ids[1],
+                             bd->n_g_elts);
+    }
+    else {
+      BFT_REALLOC(bd->elt_ids[0], m->n_cells, cs_lnum_t);
+      cs_selector_get_cell_list(bd->criteria,
+                                &(bd->n_elts[0]), bd->elt_ids[0]);
+      BFT_REALLOC(bd->elt_ids[0], bd->n_elts[0], cs_lnum_t);
     }
-  }
 
-  /* Check internal faces:
-     if they are in the selected zone, they can be either
-     internal or boundary faces */
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+  }
 
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+  _balance_sel_mesh_sizes[0] = m->n_cells;
+  _balance_sel_mesh_sizes[1] = m->n_i_faces;
+  _balance_sel_mesh_sizes[2] = m->n_b_faces;
+}
 
-    bool indic1 = false;
-    bool indic2 = false;
+/*----------------------------------------------------------------------------
+ * Add a balance definition.
+ *
+ * parameters:
+ *   surface         <-- true for surface balance, false for volume zone
+ *   selection_crit  <-- zone selection criterion
+ *   scalar_name     <-- scalar name
+ *   normal          <-- outwards normal direction, or NULL
+ *
+ * returns:
+ *   id of new definition
+ *----------------------------------------------------------------------------*/
 
-    if (cells_tag_ids[c_id1] == 1)
-      indic1 = true;
-    if (cells_tag_ids[c_id2] == 1)
-      indic2 = true;
+static int
+_balance_def_add(bool              surface,
+                 const char       *selection_crit,
+                 const char       *scalar_name,
+                 const cs_real_t   normal[3])
+{
+  int d_id = _n_balance_defs;
 
-    if (indic1 && indic2) {
-      n_i_faces_sel++;
-      i_face_sel_ids[n_i_faces_sel-1] = f_id;
-    }
-    else if (indic1 || indic2) {
-      n_bi_faces_sel++;
-      bi_face_sel_ids[n_bi_faces_sel-1] = f_id;
-      /* Build the faces -> cells connectivity as done in
-         i_face_cells */
-      if (indic1)
-        bi_face_cells[f_id][0] = c_id1;
-      else
-        bi_face_cells[f_id][1] = c_id2;
-    }
+  _n_balance_defs += 1;
+  BFT_REALLOC(_balance_defs, _n_balance_defs, _balance_def_t);
 
-  }
+  _balance_def_t *bd = _balance_defs + d_id;
 
-  /* Balance computation
-     =================== */
+  bd->surface = surface;
 
-  /* Compute the balance at time step n */
+  BFT_MALLOC(bd->criteria, strlen(selection_crit) + 1, char);
+  strcpy(bd->criteria, selection_crit);
+  BFT_MALLOC(bd->scalar_name, strlen(scalar_name) + 1, char);
+  strcpy(bd->scalar_name, scalar_name);
 
-  int iconvp = 1;
-  int ircflp = 0; /* No reconstruction */
+  for (int i = 0; i < 3; i++)
+    bd->normal[i] = (normal != NULL) ? normal[i] : 0.;
 
-  /* Balance on boundary faces
-     -------------------------
+  for (int i = 0; i < 2; i++) {
+    bd->n_elts[i] = 0;
+    bd->elt_ids[i] = NULL;
+    bd->n_g_elts[i] = 0;
+  }
 
-     We handle different types of boundary faces separately to better
-     analyze the information, but this is not mandatory. */
+  for (int i = 0; i < CS_BALANCE_N_TERMS; i++)
+    bd->balance[i] = 0.;
 
-  for (cs_lnum_t f_id = 0; f_id < n_bb_faces_sel; f_id++) {
+  /* Force update of selections */
 
-    cs_lnum_t f_id_sel = bb_face_sel_ids[f_id];
-    /* Associated boundary cell */
-    cs_lnum_t c_id = b_face_cells[f_id_sel];
+  _balance_sel_mesh_sizes[0] = -1;
 
-    cs_real_t pip;
+  return d_id;
+}
 
-    /* Pressure term FIXME rho0*gravity*(X-X0) should be added */
-    cs_real_t p_rho = pressure[c_id] / rho[c_id];
-    cs_real_t a_p_rho = a_p[f_id_sel] / rho[c_id];
-    cs_real_t b_p_rho = b_p[f_id_sel];
+/*----------------------------------------------------------------------------
+ * Compute balances of a given scalar for a set of volume zone definitions.
+ *
+ * Zones are handled by blocks of _BALANCE_ZONES_MAX, each block requiring
+ * a single pass on the mesh.
+ *
+ * parameters:
+ *   bs         <-- pointer to scalar balance data structure
+ *   n_defs     <-- number of definitions
+ *   def_ids    <-- ids of definitions
+ *----------------------------------------------------------------------------*/
 
-    cs_real_3_t grad = {0, 0, 0};
+static void
+_balance_defs_compute_zones(const _balance_scalar_t  *bs,
+                            int                       n_defs,
+                            const int                 def_ids[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
 
-    cs_b_cd_unsteady(ircflp,
-                     diipb[f_id_sel],
-                     grad,
-                     p_rho,
-                     &pip);
+  uint64_t *cell_tag = NULL;
+  cs_real_t *balance = NULL;
 
-    cs_real_t term_balance = 0.;
+  BFT_MALLOC(cell_tag, n_cells_ext, uint64_t);
+  BFT_MALLOC(balance, _BALANCE_ZONES_MAX*CS_BALANCE_N_TERMS, cs_real_t);
 
-    cs_b_upwind_flux(iconvp,
-                     1., /* thetap */
-                     0, /* Conservative formulation, no mass accumulation */
-                     inc,
-                     bc_type[f_id_sel],
-                     p_rho,
-                     p_rho, /* no relaxation */
-                     pip,
-                     a_p_rho,
-                     b_p_rho,
-                     b_mass_flux[f_id_sel],
-                     1.,
-                     &term_balance);
+  for (int s_id = 0; s_id < n_defs; s_id += _BALANCE_ZONES_MAX) {
 
-    if (b_mass_flux[f_id_sel] > 0) {
-      out_debit += b_mass_flux[f_id_sel]/rho[c_id];
-      out_m_debit += b_mass_flux[f_id_sel];
-      out_pressure += term_balance;
-    } else {
-      in_debit += b_mass_flux[f_id_sel]/rho[c_id];
-      in_m_debit += b_mass_flux[f_id_sel];
-      in_pressure += term_balance;
-    }
+    int n_zones = CS_MIN(n_defs - s_id, _BALANCE_ZONES_MAX);
 
-    /* Kinematic term */
-    cs_real_t u2 = _CS_MODULE2_2(velocity[c_id]);
-    cs_real_t a_u2 = _CS_MODULE2_2(a_u[f_id_sel]);
-    /* Approximation of u^2 BC */
-    cs_real_t b_u2 = 1./6.*( b_u[f_id_sel][0][0] * b_u[f_id_sel][0][0]
-                           + b_u[f_id_sel][1][1] * b_u[f_id_sel][1][1]
-                           + b_u[f_id_sel][2][2] * b_u[f_id_sel][2][2]);
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+      cell_tag[c_id] = 0;
 
-    cs_b_cd_unsteady(ircflp,
-                     diipb[f_id_sel],
-                     grad,
-                     u2,
-                     &pip);
+    for (int z = 0; z < n_zones; z++) {
+      const _balance_def_t *bd = _balance_defs + def_ids[s_id + z];
+      const uint64_t z_mask = (uint64_t)1 << z;
+      for (cs_lnum_t i = 0; i < bd->n_elts[0]; i++)
+        cell_tag[bd->elt_ids[0][i]] |= z_mask;
+    }
 
-    term_balance = 0.;
+    if (m->halo != NULL)
+      cs_halo_sync_untyped(m->halo, CS_HALO_STANDARD, sizeof(uint64_t),
+                           cell_tag);
 
-    cs_b_upwind_flux(iconvp,
-                     1., /* thetap */
-                     0, /* Conservative formulation, no mass accumulation */
-                     inc,
-                     bc_type[f_id_sel],
-                     u2,
-                     u2, /* no relaxation */
-                     pip,
-                     a_u2,
-                     b_u2,
-                     b_mass_flux[f_id_sel],
-                     1.,
-                     &term_balance);
+    _balance_by_zones(bs, n_zones, cell_tag, balance);
 
-    if (b_mass_flux[f_id_sel] > 0) {
-      out_u2 += term_balance;
-    } else {
-      in_u2 += term_balance;
+    for (int z = 0; z < n_zones; z++) {
+      _balance_def_t *bd = _balance_defs + def_ids[s_id + z];
+      for (int i = 0; i < CS_BALANCE_N_TERMS; i++)
+        bd->balance[i] = balance[z*CS_BALANCE_N_TERMS + i];
+      _balance_by_zone_complete(bd->balance);
     }
 
-    /* Gravity term */
-    cs_real_t gx = - _CS_DOT_PRODUCT(gravity, b_face_cog[f_id_sel]);
-    /* Trivial BCs */
-    cs_real_t a_gx = gx;
-    cs_real_t b_gx = 0.;
+  }
 
-    cs_b_cd_unsteady(ircflp,
-                     diipb[f_id_sel],
-                     grad,
-                     gx,
-                     &pip);
+  BFT_FREE(balance);
+  BFT_FREE(cell_tag);
+}
 
-    term_balance = 0.;
+/*----------------------------------------------------------------------------
+ * Compute balances of a given scalar for a set of surface definitions.
+ *
+ * parameters:
+ *   bs         <-- pointer to scalar balance data structure
+ *   n_defs     <-- number of definitions
+ *   def_ids    <-- ids of definitions
+ *----------------------------------------------------------------------------*/
 
-    cs_b_upwind_flux(iconvp,
-                     1., /* thetap */
-                     0, /* Conservative formulation, no mass accumulation */
-                     inc,
-                     bc_type[f_id_sel],
-                     gx,
-                     gx, /* no relaxation */
-                     pip,
-                     a_gx,
-                     b_gx,
-                     b_mass_flux[f_id_sel],
-                     1.,
-                     &term_balance);
+static void
+_balance_defs_compute_surfaces(const _balance_scalar_t  *bs,
+                               int                       n_defs,
+                               const int                 def_ids[])
+{
+  cs_real_t *balance = NULL;
+
+  BFT_MALLOC(balance, n_defs*CS_BALANCE_N_TERMS, cs_real_t);
+
+  for (int i = 0; i < n_defs; i++) {
+    const _balance_def_t *bd = _balance_defs + def_ids[i];
+    _flux_through_surface(bs,
+                          bd->normal,
+                          bd->n_elts[0],
+                          bd->n_elts[1],
+                          bd->elt_ids[0],
+                          bd->elt_ids[1],
+                          balance + i*CS_BALANCE_N_TERMS,
+                          NULL,
+                          NULL);
+  }
 
-    if (b_mass_flux[f_id_sel] > 0) {
-      out_rhogx += term_balance;
-    } else {
-      in_rhogx += term_balance;
-    }
+  /* Single reduction for all surfaces */
 
-  }
+  cs_parall_sum(n_defs*CS_BALANCE_N_TERMS, CS_REAL_TYPE, balance);
 
-  /* Balance on boundary faces of the selected zone
-     that are internal of the total mesh
-     ---------------------------------------------- */
+  for (int i = 0; i < n_defs; i++) {
+    _balance_def_t *bd = _balance_defs + def_ids[i];
+    for (int j = 0; j < CS_BALANCE_N_TERMS; j++)
+      bd->balance[j] = balance[i*CS_BALANCE_N_TERMS + j];
+  }
 
-  for (cs_lnum_t f_id = 0; f_id < n_bi_faces_sel; f_id++) {
+  BFT_FREE(balance);
+}
 
-    cs_lnum_t f_id_sel = bi_face_sel_ids[f_id];
-    /* Associated boundary-internal cells */
-    cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
-    cs_real_2_t bi_bterms = {0.,0.};
-    cs_real_3_t grad = {0, 0, 0};
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
 
-    cs_real_t pip, pjp;
-    cs_real_t pif, pjf;
+#undef _CS_MODULE2_2
 
-    /* Pressure term */
-    cs_real_t p_rho_id1 = pressure[c_id1] / rho[c_id1];
-    cs_real_t p_rho_id2 = pressure[c_id2] / rho[c_id2];
-
-    cs_i_cd_unsteady_upwind(ircflp,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
-                            grad,
-                            grad,
-                            p_rho_id1,
-                            p_rho_id2,
-                            &pif,
-                            &pjf,
-                            &pip,
-                            &pjp);
+#define _CS_MODULE2_2(vect) \
+  0.5*(vect[0] * vect[0] + vect[1] * vect[1] + vect[2] * vect[2])
 
-    cs_i_conv_flux(iconvp,
-                   1.,
-                   0, /* Conservative formulation, no mass accumulation */
-                   p_rho_id1,
-                   p_rho_id2,
-                   pif,
-                   pif, /* no relaxation */
-                   pjf,
-                   pjf, /* no relaxation */
-                   i_mass_flux[f_id_sel],
-                   1.,
-                   1.,
-                   bi_bterms);
+#define _CS_DOT_PRODUCT(vect1, vect2) \
+  (vect1[0] * vect2[0] + vect1[1] * vect2[1] + vect1[2] * vect2[2])
 
-    /* (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
-    /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
-      if (c_id1 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0) {
-          out_pressure += bi_bterms[0];
-          out_debit += i_mass_flux[f_id_sel] / rho[c_id1];
-          out_m_debit += i_mass_flux[f_id_sel];
-        } else {
-          in_pressure += bi_bterms[0];
-          in_debit += i_mass_flux[f_id_sel] / rho[c_id1];
-          in_m_debit += i_mass_flux[f_id_sel];
-        }
-      }
-    }
-    /* Face normal direction reversed */
-    else {
-      if (c_id2 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0) {
-          in_pressure -= bi_bterms[1];
-          in_debit -= i_mass_flux[f_id_sel] / rho[c_id2];
-          in_m_debit -= i_mass_flux[f_id_sel];
-        } else {
-          out_pressure -= bi_bterms[1];
-          out_debit -= i_mass_flux[f_id_sel] / rho[c_id2];
-          out_m_debit -= i_mass_flux[f_id_sel];
-        }
-      }
-    }
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
 
-    /* Kinematic term */
-    bi_bterms[0] = 0.;
-    bi_bterms[1] = 0.;
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the different terms of the balance of a given scalar,
+ *        on a volume zone defined by selected cell ids/
+ *
+ * This function computes the balance relative to a given scalar
+ * on a selected zone of the mesh.
+ * We assume that we want to compute balances (convective and diffusive)
+ * at the boundaries of the calculation domain represented below
+ * (with different boundary types).
+ *
+ * In the case of the temperature, the energy balance in Joules will be
+ * computed by multiplying by the specific heat.
+ *
+ * \param[in]     scalar_name         scalar name
+ * \param[in]     n_cells_sel         number of selected cells
+ * \param[in]     cell_sel_ids        ids of selected cells
+ * \param[out]    balance             array of computed balance terms
+ *                                    (see \ref cs_balance_term_t)
+ */
+/*----------------------------------------------------------------------------*/
 
-    cs_real_t u2_id1 = _CS_MODULE2_2(velocity[c_id1]);
-    cs_real_t u2_id2 = _CS_MODULE2_2(velocity[c_id2]);
+void
+cs_balance_by_zone_compute(const char      *scalar_name,
+                           cs_lnum_t        n_cells_sel,
+                           const cs_lnum_t  cell_sel_ids[],
+                           cs_real_t        balance[CS_BALANCE_N_TERMS])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
 
-    cs_i_cd_unsteady_upwind(ircflp,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
-                            grad,
-                            grad,
-                            u2_id1,
-                            u2_id2,
-                            &pif,
-                            &pjf,
-                            &pip,
-                            &pjp);
+  /* initialize output */
 
-    cs_i_conv_flux(iconvp,
-                   1.,
-                   0, /* Conservative formulation, no mass accumulation */
-                   u2_id1,
-                   u2_id2,
-                   pif,
-                   pif, /* no relaxation */
-                   pjf,
-                   pjf, /* no relaxation */
-                   i_mass_flux[f_id_sel],
-                   1.,
-                   1.,
-                   bi_bterms);
+  for (int i = 0; i < CS_BALANCE_N_TERMS; i++)
+    balance[i] = 0;
 
-    /* (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
-    /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
-      if (c_id1 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0) {
-          out_u2 += bi_bterms[0];
-        } else {
-          in_u2 += bi_bterms[0];
-        }
-      }
-    }
-    /* Face normal direction reversed */
-    else {
-      if (c_id2 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0) {
-          in_u2 -= bi_bterms[1];
-        } else {
-          out_u2 -= bi_bterms[1];
-        }
-      }
-    }
+  /* If the requested scalar field is not computed, return */
 
-    /* Gravity term */
-    bi_bterms[0] = 0.;
-    bi_bterms[1] = 0.;
+  const cs_field_t *f = cs_field_by_name_try(scalar_name);
+  if (f == NULL) {
+    bft_printf("Scalar field does not exist. Balance will not be computed.\n");
+    return;
+  }
 
-    cs_real_t gx_id1 = - _CS_DOT_PRODUCT(gravity, i_face_cog[f_id_sel]);
-    cs_real_t gx_id2 = - _CS_DOT_PRODUCT(gravity, i_face_cog[f_id_sel]);
+  /* Tag cells of the selected zone (synchronized for parallelism) */
 
-    cs_i_cd_unsteady_upwind(ircflp,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
-                            grad,
-                            grad,
-                            gx_id1,
-                            gx_id2,
-                            &pif,
-                            &pjf,
-                            &pip,
-                            &pjp);
+  uint64_t *cell_tag = NULL;
+  BFT_MALLOC(cell_tag, n_cells_ext, uint64_t);
 
-    cs_i_conv_flux(iconvp,
-                   1.,
-                   0, /* Conservative formulation, no mass accumulation */
-                   gx_id1,
-                   gx_id2,
-                   pif,
-                   pif, /* no relaxation */
-                   pjf,
-                   pjf, /* no relaxation */
-                   i_mass_flux[f_id_sel],
-                   1.,
-                   1.,
-                   bi_bterms);
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+    cell_tag[c_id] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells_sel; c_id++)
+    cell_tag[cell_sel_ids[c_id]] = 1;
 
-    /* (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
-    /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
-      if (c_id1 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0) {
-          out_rhogx += bi_bterms[0];
-        } else {
-          in_rhogx += bi_bterms[0];
-        }
-      }
-    }
-    /* Face normal direction reversed */
-    else {
-      if (c_id2 < n_cells) {
-        if (i_mass_flux[f_id_sel] > 0) {
-          in_rhogx -= bi_bterms[1];
-        } else {
-          out_rhogx -= bi_bterms[1];
-        }
-      }
-    }
+  if (m->halo != NULL)
+    cs_halo_sync_untyped(m->halo, CS_HALO_STANDARD, sizeof(uint64_t),
+                         cell_tag);
 
-  }
+  /* Compute the balance at time step n */
 
-  /* Free memory */
+  _balance_scalar_t *bs = _balance_scalar_create(f);
 
-  BFT_FREE(cells_tag_ids);
-  BFT_FREE(bi_face_cells);
-  BFT_FREE(i_face_sel_ids);
-  BFT_FREE(bb_face_sel_ids);
-  BFT_FREE(bi_face_sel_ids);
+  _balance_by_zones(bs, 1, cell_tag, balance);
 
-  /* Sum of values on all ranks (parallel calculations) */
+  _balance_scalar_destroy(&bs);
 
-  balance[CS_BALANCE_P_IN] = in_pressure;
-  balance[CS_BALANCE_P_OUT] = out_pressure;
-  balance[CS_BALANCE_P_U2_IN] = in_u2;
-  balance[CS_BALANCE_P_U2_OUT] = out_u2;
-  balance[CS_BALANCE_P_RHOGX_IN] = in_rhogx;
-  balance[CS_BALANCE_P_RHOGX_OUT] = out_rhogx;
-  balance[CS_BALANCE_P_U_IN] = in_debit;
-  balance[CS_BALANCE_P_U_OUT] = out_debit;
-  balance[CS_BALANCE_P_RHOU_IN] = in_m_debit;
-  balance[CS_BALANCE_P_RHOU_OUT] = out_m_debit;
+  BFT_FREE(cell_tag);
 
-  cs_parall_sum(CS_BALANCE_P_N_TERMS, CS_REAL_TYPE, balance);
+  _balance_by_zone_complete(balance);
 }
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Computes one term of the head loss balance (pressure drop) on a
- * volumic zone defined by the criterion also given as argument.
- * The different contributions are printed in the run_solver.log.
+ * \brief Compute and log the different terms of the balance of a given scalar,
+ *        on a volumic zone defined by selection criteria.
+ *        The different contributions to the balance are printed in the
+ *        run_solver.log.
+ *
+ * This function computes the balance relative to a given scalar
+ * on a selected zone of the mesh.
+ * We assume that we want to compute balances (convective and diffusive)
+ * at the boundaries of the calculation domain represented below
+ * (with different boundary types).
+ *
+ * The scalar and the zone are selected at the top of the routine
+ * by the user.
+ * In the case of the temperature, the energy balance in Joules will be
+ * computed by multiplying by the specific heat.
  *
  * \param[in]     selection_crit      zone selection criterion
+ * \param[in]     scalar_name         scalar name
  */
 /*----------------------------------------------------------------------------*/
 
 void
-cs_pressure_drop_by_zone(const char * selection_crit)
+cs_balance_by_zone(const char  *selection_crit,
+                   const char  *scalar_name)
 {
-  cs_real_t balance[CS_BALANCE_P_N_TERMS];
+  cs_real_t balance[CS_BALANCE_N_TERMS];
 
   const cs_mesh_t *m = cs_glob_mesh;
-  const int nt_cur = cs_glob_time_step->nt_cur;
 
   /* Select cells */
 
@@ -2283,225 +2272,41 @@ cs_pressure_drop_by_zone(const char * selection_crit)
   BFT_MALLOC(cells_sel_ids, m->n_cells, cs_lnum_t);
   cs_selector_get_cell_list(selection_crit, &n_cells_sel, cells_sel_ids);
 
-  /* Compute pressure drop terms */
-
-  cs_pressure_drop_by_zone_compute(n_cells_sel,
-                                   cells_sel_ids,
-                                   balance);
+  /* Compute balance */
 
-  BFT_FREE(cells_sel_ids);
-
-  /* Log results at time step n */
-
-  bft_printf(_("   ** PRESSURE DROP BY ZONE at iteration %6i\n"
-               "   ---------------------------------------------\n"
-               "------------------------------------------------------------\n"
-               "   ZONE SELECTION CRITERIA: \"%s\"\n"
-               "------------------------------------------------------------\n"
-               "  |                 |\n"
-               "  | p u . dS        | p u . dS\n"
-               "  |   -    -        |   -    -\n"
-               "  |                 |\n"
-               "  | inlet           | outlet\n"
-               "  %12.4e      %12.4e\n"
-               "------------------------------------------------------------\n"
-               "  |                 |\n"
-               "  | u^2/2 rho u . dS| u^2/2 rho u . dS\n"
-               "  | -         -    -| -         -    -\n"
-               "  |                 |\n"
-               "  | inlet           | outlet\n"
-               "  %12.4e      %12.4e\n"
-               "------------------------------------------------------------\n"
-               "  |                 |\n"
-               "  |-rho(g . x)u . dS|-rho(g . x)u . dS\n"
-               "  |     -   - -    -|     -   - -    -\n"
-               "  |                 |\n"
-               "  | inlet           | outlet\n"
-               "  %12.4e      %12.4e\n"
-               "------------------------------------------------------------\n"
-               "  |                 |\n"
-               "  | u . dS          | u . dS\n"
-               "  | -    -          | -    -\n"
-               "  |                 |\n"
-               "  | inlet           | outlet\n"
-               "  %12.4e      %12.4e\n"
-               "------------------------------------------------------------\n"
-               "  |                 |\n"
-               "  | rho u . dS      | rho u . dS\n"
-               "  |     -    -      |     -    -\n"
-               "  |                 |\n"
-               "  | inlet           | outlet\n"
-               "  %12.4e      %12.4e\n"
-               "------------------------------------------------------------\n\n"),
-             nt_cur, selection_crit,
-             balance[CS_BALANCE_P_IN], balance[CS_BALANCE_P_OUT],
-             balance[CS_BALANCE_P_U2_IN], balance[CS_BALANCE_P_U2_OUT],
-             balance[CS_BALANCE_P_RHOGX_IN], balance[CS_BALANCE_P_RHOGX_OUT],
-             balance[CS_BALANCE_P_U_IN], balance[CS_BALANCE_P_U_OUT],
-             balance[CS_BALANCE_P_RHOU_IN], balance[CS_BALANCE_P_RHOU_OUT]);
-}
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Compute the surface balance of a given scalar.
- *
- * For interior faces, the flux is counted negatively relative to the given
- * normal (as neighboring interior faces may have differently-aligned normals).
- *
- * For boundary faces, the flux is counted negatively in the outwards-facing
- * direction.
- *
- * \param[in]     selection_crit      zone selection criterion
- * \param[in]     scalar_name         scalar name
- * \param[in]     normal              outwards normal direction
- */
-/*----------------------------------------------------------------------------*/
-
-void
-cs_surface_balance(const char       *selection_crit,
-                   const char       *scalar_name,
-                   const cs_real_t   normal[3])
-{
-  const cs_mesh_t *m = cs_glob_mesh;
-  const cs_lnum_t n_cells = m->n_cells;
-  const cs_lnum_2_t *restrict i_face_cells
-    = (const cs_lnum_2_t *restrict)m->i_face_cells;
-
-  const int nt_cur = cs_glob_time_step->nt_cur;
-
-  /* Faces selection */
-
-  cs_lnum_t n_b_faces_sel = 0;
-  cs_lnum_t *b_face_sel_ids = NULL;
-  cs_lnum_t n_i_faces_sel = 0;
-  cs_lnum_t *i_face_sel_ids = NULL;
-
-  BFT_MALLOC(i_face_sel_ids, m->n_i_faces, cs_lnum_t);
-  BFT_MALLOC(b_face_sel_ids, m->n_b_faces, cs_lnum_t);
-
-  cs_selector_get_i_face_list(selection_crit, &n_i_faces_sel, i_face_sel_ids);
-  cs_selector_get_b_face_list(selection_crit, &n_b_faces_sel, b_face_sel_ids);
-
-  /* Balance on selected faces */
-
-  cs_real_t  balance[CS_BALANCE_N_TERMS];
-
-  cs_flux_through_surface(scalar_name,
-                          normal,
-                          n_b_faces_sel,
-                          n_i_faces_sel,
-                          b_face_sel_ids,
-                          i_face_sel_ids,
-                          balance,
-                          NULL,   /* flux_b_faces */
-                          NULL);  /* flux_i_faces */
-
-  /* Recount selected interior faces (parallel test) */
-
-  cs_gnum_t n_sel[2] = {n_b_faces_sel, 0};
-
-  for (cs_lnum_t i = 0; i < n_i_faces_sel; i++) {
-    cs_lnum_t f_id = i_face_sel_ids[i];
-    if (i_face_cells[f_id][0] < n_cells)
-      n_sel[1] += 1;
-  }
-
-  cs_parall_sum(2, CS_GNUM_TYPE, n_sel);
-
-  /* Free memory */
-
-  BFT_FREE(i_face_sel_ids);
-  BFT_FREE(b_face_sel_ids);
-
-  /* Compute some sums */
-
-  cs_real_t flux_b_faces
-    = balance[CS_BALANCE_BOUNDARY_IN] + balance[CS_BALANCE_BOUNDARY_OUT]
-    + balance[CS_BALANCE_BOUNDARY_SYM] + balance[CS_BALANCE_BOUNDARY_WALL]
-    + balance[CS_BALANCE_BOUNDARY_COUPLED_E]
-    + balance[CS_BALANCE_BOUNDARY_OTHER];
+  cs_balance_by_zone_compute(scalar_name,
+                             n_cells_sel,
+                             cells_sel_ids,
+                             balance);
 
-  cs_real_t flux_i_faces
-    = balance[CS_BALANCE_INTERIOR_IN] + balance[CS_BALANCE_INTERIOR_OUT];
+  BFT_FREE(cells_sel_ids);
 
-  /* Log balance */
+  /* Log results at time step n */
 
-  bft_printf
-    (_("\n   ** SURFACE BALANCE at iteration %6i\n"
-       "     ------------------------------------\n"
-       "------------------------------------------------------------\n"
-       "   SCALAR: %s\n"
-       "   ZONE SELECTION CRITERIA: \"%s\"\n"
-       "   OUTGOING NORMAL: [%.2e, %.2e, %.2e] \n"
-       "------------------------------------------------------------\n"
-       "   Interior faces selected: %llu of %llu \n"
-       "   Boundary faces selected: %llu of %llu \n"
-       "------------------------------------------------------------\n"
-       "    Boundary faces:        %12.4e \n"
-       "    Int. Coupling faces:   %12.4e \n"
-       "    Interior faces:        \n"
-       "      In:                  %12.4e \n"
-       "      Out:                 %12.4e \n"
-       "      Balance:             %12.4e \n"
-       "------------------------------------------------------------\n"),
-     nt_cur, scalar_name, selection_crit,
-     normal[0], normal[1], normal[2],
-     (unsigned long long)n_sel[1], (unsigned long long)(m->n_g_i_faces),
-     (unsigned long long)n_sel[0], (unsigned long long)(m->n_g_b_faces),
-     flux_b_faces, balance[CS_BALANCE_BOUNDARY_COUPLED_E],
-     balance[CS_BALANCE_INTERIOR_IN], balance[CS_BALANCE_INTERIOR_OUT],
-     flux_i_faces);
+  _balance_by_zone_log(selection_crit, scalar_name, balance);
 }
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Get the face by face surface flux of a given scalar, through a
- *        surface area defined by the given face ids.
- *
- * For interior faces, the flux is counted negatively relative to the given
- * normal (as neighboring interior faces may have differently-aligned normals).
- *
- * For boundary faces, the flux is counted negatively in the outwards-facing
- * direction.
+ * \brief Computes one term of the head loss balance (pressure drop) on a
+ *        on a volume zone defined by selected cell ids/
  *
- * \param[in]   scalar_name       scalar name
- * \param[in]   normal            outwards normal direction
- * \param[in]   n_b_faces_sel     number of selected boundary faces
- * \param[in]   n_i_faces_sel     number of selected internal faces
- * \param[in]   b_face_sel_ids    ids of selected boundary faces
- * \param[in]   i_face_sel_ids    ids of selected internal faces
- * \param[out]  balance           optional array of computed balance terms
- *                                (see \ref cs_balance_term_t), of
- *                                size CS_BALANCE_N_TERMS, or NULL
- * \param[out]  flux_b_faces      optional surface flux through selected
- *                                boundary faces, or NULL
- * \param[out]  flux_i_faces      optional surface flux through selected
- *                                interior faces, or NULL
+ * \param[in]     n_cells_sel         number of selected cells
+ * \param[in]     cell_sel_ids        ids of selected cells
+ * \param[out]    balance             array of computed balance terms
+ *                                    (see \ref cs_balance_p_term_t)
  */
 /*----------------------------------------------------------------------------*/
 
 void
-cs_flux_through_surface(const char         *scalar_name,
-                        const cs_real_t     normal[3],
-                        cs_lnum_t           n_b_faces_sel,
-                        cs_lnum_t           n_i_faces_sel,
-                        const cs_lnum_t     b_face_sel_ids[],
-                        const cs_lnum_t     i_face_sel_ids[],
-                        cs_real_t          *balance,
-                        cs_real_t          *flux_b_faces,
-                        cs_real_t          *flux_i_faces)
+cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
+                                 const cs_lnum_t  cell_sel_ids[],
+                                 cs_real_t        balance[CS_BALANCE_P_N_TERMS])
 {
-  int idtvar = cs_glob_time_step_options->idtvar;
-
   const cs_mesh_t *m = cs_glob_mesh;
   cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
 
-  cs_real_t *local_min = NULL;
-  cs_real_t *local_max = NULL;
-  cs_real_t *courant = NULL;
-
-  cs_real_t *cv_limiter = NULL;
-  cs_real_t *df_limiter = NULL;
+  const cs_halo_t  *halo = m->halo;
 
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
@@ -2512,15 +2317,10 @@ cs_flux_through_surface(const char         *scalar_name,
     = (const cs_lnum_2_t *restrict)m->i_face_cells;
   const cs_lnum_t *restrict b_face_cells
     = (const cs_lnum_t *restrict)m->b_face_cells;
-  const cs_real_t *restrict weight = fvq->weight;
-  const cs_real_t *restrict i_dist = fvq->i_dist;
-  const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
-  const cs_real_3_t *restrict cell_cen
-    = (const cs_real_3_t *restrict)fvq->cell_cen;
-  const cs_real_3_t *restrict i_face_normal
-    = (const cs_real_3_t *restrict)fvq->i_face_normal;
   const cs_real_3_t *restrict i_face_cog
     = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict b_face_cog
+    = (const cs_real_3_t *restrict)fvq->b_face_cog;
   const cs_real_3_t *restrict diipf
     = (const cs_real_3_t *restrict)fvq->diipf;
   const cs_real_3_t *restrict djjpf
@@ -2530,590 +2330,922 @@ cs_flux_through_surface(const char         *scalar_name,
 
   const int *bc_type = cs_glob_bc_type;
 
-  const cs_field_t *f = cs_field_by_name_try(scalar_name);
-  const int field_id = cs_field_id_by_name(scalar_name);
-
-  int key_cal_opt_id = cs_field_key_id("var_cal_opt");
-  cs_var_cal_opt_t var_cal_opt;
-  cs_field_get_key_struct(f, key_cal_opt_id, &var_cal_opt);
-
-  const int key_lim_choice = cs_field_key_id("limiter_choice");
-
   /* initialize output */
 
-  cs_real_t  _balance[CS_BALANCE_N_TERMS];
-  for (int i = 0; i < CS_BALANCE_N_TERMS; i++)
-    _balance[i] = 0;
+  for (int i = 0; i < CS_BALANCE_P_N_TERMS; i++)
+    balance[i] = 0;
 
-  /* all boundary convective fluxes are upwind */
-  int icvflb = 0; // TODO handle total energy balance
-  int icvflf = 0;
+  /* Get physical fields */
+  const cs_real_t *rho = CS_F_(rho)->val;
+  const cs_field_t *f_pres = CS_F_(p);
+  const cs_real_t *pressure = f_pres->val;
+  const cs_field_t *f_vel = CS_F_(vel);
+  const cs_real_3_t *velocity =  (const cs_real_3_t *)f_vel->val;
+  cs_real_3_t gravity = {cs_glob_physical_constants->gravity[0],
+                         cs_glob_physical_constants->gravity[1],
+                         cs_glob_physical_constants->gravity[2]};
 
-  /* Internal cuplin varibale initialization*/
-  cs_real_t *pvar_local = NULL;
-  cs_real_t *pvar_distant = NULL;
-  cs_real_t hint, hext, heq;
-  cs_lnum_t *faces_local = NULL;
-  cs_lnum_t n_local = 0;
-  cs_lnum_t n_distant = 0;
-  cs_lnum_t *faces_distant = NULL;
-  cs_internal_coupling_t *cpl = NULL;
+  /* Zone cells selection variables*/
+  cs_lnum_t n_i_faces_sel = 0;
+  cs_lnum_t *i_face_sel_ids = NULL;
+  cs_lnum_t n_bb_faces_sel = 0;
+  cs_lnum_t *bb_face_sel_ids = NULL;
+  cs_lnum_t n_bi_faces_sel = 0;
+  cs_lnum_t *bi_face_sel_ids = NULL;
+  cs_lnum_2_t *bi_face_cells = NULL;
+  cs_lnum_t *cells_tag_ids = NULL;
 
- /* Physical properties
-    ------------------- */
+  /* Initialization of balance contributions
+     ---------------------------------------
 
-  /* Temperature indicator.
-     Will multiply by CP in order to have energy. */
-  bool itemperature = false;
-  if (f == cs_thermal_model_field()) {
-    if (cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_TEMPERATURE)
-      itemperature = true;
-  }
+    in_pressure   : contribution from inlets
+    out_pressure  : contribution from outlets
+    in_u2         : contribution from inlets
+    out_u2        : contribution from outlets
+    in_rhogx      : contribution from inlets
+    out_rhogx     : contribution from outlets
+    in_debit      : debit from inlets
+    out_debit     : debit from outlets
+    in_m_debit    : mass flow from inlets
+    out_m_debit   : mass flow from outlets
 
-  /* Specific heat (CP) */
-  cs_real_t *cpro_cp = NULL;
-  const int icp = cs_field_id_by_name("specific_heat");
-  if (itemperature) {
-    if (icp != -1)
-      cpro_cp = CS_F_(cp)->val;
-    else {
-      const double cp0 = cs_glob_fluid_properties->cp0;
-      BFT_MALLOC(cpro_cp, n_cells, cs_real_t);
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        cpro_cp[c_id] = cp0;
-      }
-    }
-  }
-  else {
-    BFT_MALLOC(cpro_cp, n_cells, cs_real_t);
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      cpro_cp[c_id] = 1.;
-    }
-  }
+  */
 
-  /* Boundary condition coefficient for h */
-  const cs_real_t *a_F = f->bc_coeffs->a;
-  const cs_real_t *b_F = f->bc_coeffs->b;
-  const cs_real_t *af_F = f->bc_coeffs->af;
-  const cs_real_t *bf_F = f->bc_coeffs->bf;
+  double in_pressure= 0.;
+  double out_pressure= 0.;
+  double in_u2 = 0.;
+  double out_u2 = 0.;
+  double in_rhogx = 0.;
+  double out_rhogx = 0.;
+  double in_debit = 0.;
+  double out_debit = 0.;
+  double in_m_debit = 0.;
+  double out_m_debit = 0.;
+
+  /* Boundary condition coefficient for p */
+  const cs_real_t *a_p = f_pres->bc_coeffs->a;
+  const cs_real_t *b_p = f_pres->bc_coeffs->b;
+
+  /* Boundary condition coefficient for u */
+  const cs_real_3_t *a_u = (const cs_real_3_t *)f_vel->bc_coeffs->a;
+  const cs_real_33_t *b_u = (const cs_real_33_t *)f_vel->bc_coeffs->b;
 
   /* Convective mass fluxes for inner and boundary faces */
-  int iflmas = cs_field_get_key_int(f, cs_field_key_id("inner_mass_flux_id"));
+  int iflmas = cs_field_get_key_int(f_pres, cs_field_key_id("inner_mass_flux_id"));
   const cs_real_t *i_mass_flux = cs_field_by_id(iflmas)->val;
 
-  int iflmab = cs_field_get_key_int(f, cs_field_key_id("boundary_mass_flux_id"));
+  int iflmab = cs_field_get_key_int(f_pres, cs_field_key_id("boundary_mass_flux_id"));
   const cs_real_t *b_mass_flux = cs_field_by_id(iflmab)->val;
 
-  /* Face viscosity */
-  int imvisf = var_cal_opt.imvisf;
-  cs_real_t *i_visc;
-  cs_real_t *b_visc;
-  BFT_MALLOC(i_visc, n_i_faces, cs_real_t);
-  BFT_MALLOC(b_visc, n_b_faces, cs_real_t);
+  int inc = 1;
 
-  cs_real_t *c_visc = NULL;
-  BFT_MALLOC(c_visc, n_cells_ext, cs_real_t);
-  const int kivisl
-    = cs_field_get_key_int(f, cs_field_key_id("diffusivity_id"));
-  if (kivisl != -1) {
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
-      c_visc[c_id] = cs_field_by_id(kivisl)->val[c_id];
-  }
-  else {
-    const double visls0
-      = cs_field_get_key_double(f, cs_field_key_id("diffusivity_ref"));
-    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-      c_visc[c_id] = visls0;
-    }
+  /* Get user-selected zone
+     ====================== */
+
+  /* Initialize arrays */
+
+  /* Internal faces of the selected zone */
+  BFT_MALLOC(i_face_sel_ids, n_i_faces, cs_lnum_t);
+  /* Boundary faces of the selected zone,
+     which are internal faces of the global mesh.
+     Faces -> cells connectivity */
+  BFT_MALLOC(bi_face_sel_ids, n_i_faces, cs_lnum_t);
+  BFT_MALLOC(bi_face_cells, n_i_faces, cs_lnum_2_t);
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    i_face_sel_ids[f_id] = -1;
+    bi_face_sel_ids[f_id] = -1;
+    bi_face_cells[f_id][0] = -999;
+    bi_face_cells[f_id][1] = -999;
   }
 
-  /* Turbulent part */
-  cs_real_t *c_visct = cs_field_by_name("turbulent_viscosity")->val;
+  /* Boundary faces of the selected zone,
+     which are also boundary faces of the global mesh */
+  BFT_MALLOC(bb_face_sel_ids, n_b_faces, cs_lnum_t);
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    bb_face_sel_ids[f_id] = -1;
+  }
 
-  if (var_cal_opt.idifft == 1) {
-    const int ksigmas = cs_field_key_id("turbulent_schmidt");
-    const cs_real_t turb_schmidt = cs_field_get_key_double(f, ksigmas);
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
-      c_visc[c_id] += cpro_cp[c_id] * c_visct[c_id]/turb_schmidt;
 
+  /* Synchronization for parallelism */
+  BFT_MALLOC(cells_tag_ids, n_cells_ext, cs_lnum_t);
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    cells_tag_ids[c_id] = 0;
+  }
+  for (cs_lnum_t c_id = 0; c_id < n_cells_sel; c_id++) {
+    cs_lnum_t c_id_sel = cell_sel_ids[c_id];
+    cells_tag_ids[c_id_sel] = 1;
+  }
+  if (halo != NULL) {
+    cs_halo_sync_num(halo, CS_HALO_STANDARD, cells_tag_ids);
   }
 
-  cs_face_viscosity(m, fvq, imvisf, c_visc, i_visc, b_visc);
+  /* Classify mesh faces with respect to the selected zone */
 
-  /* Internal coupling*/
+  /* Check boundary faces:
+     if they are in the selected zone, they are boundary as well */
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
 
-  if (var_cal_opt.icoupl > 0) {
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
-    const int coupling_id = cs_field_get_key_int(f, coupling_key_id);
-    cpl = cs_internal_coupling_by_id(coupling_id);
-    cs_internal_coupling_coupled_faces(cpl,
-                                       &n_local,
-                                       &faces_local,
-                                       &n_distant,
-                                       &faces_distant);
+    cs_lnum_t c_id = b_face_cells[f_id];
+
+    if (cells_tag_ids[c_id] == 1) {
+      n_bb_faces_sel++;
+      bb_face_sel_ids[n_bb_faces_sel-1] = f_id;
+    }
   }
 
-  /* Choose gradient type */
+  /* Check internal faces:
+     if they are in the selected zone, they can be either
+     internal or boundary faces */
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
 
-  cs_halo_type_t halo_type = CS_HALO_STANDARD;
-  cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
+    cs_lnum_t c_id1 = i_face_cells[f_id][0];
+    cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
-  const int imrgra = var_cal_opt.imrgra;
-  cs_gradient_type_by_imrgra(imrgra,
-                             &gradient_type,
-                             &halo_type);
+    bool indic1 = false;
+    bool indic2 = false;
 
-  /* Limiters */
+    if (cells_tag_ids[c_id1] == 1)
+      indic1 = true;
+    if (cells_tag_ids[c_id2] == 1)
+      indic2 = true;
 
-  int limiter_choice = -1;
-  int ischcp = var_cal_opt.ischcv;
-  if (field_id != -1) {
-    f = cs_field_by_id(field_id);
-
-    /* NVD/TVD limiters */
-    if (ischcp == 4) {
-      limiter_choice = cs_field_get_key_int(f, key_lim_choice);
-      BFT_MALLOC(local_max, n_cells_ext, cs_real_t);
-      BFT_MALLOC(local_min, n_cells_ext, cs_real_t);
-      cs_field_local_extrema_scalar(field_id,
-                                    halo_type,
-                                    local_max,
-                                    local_min);
-      if (limiter_choice >= CS_NVD_VOF_HRIC) {
-        BFT_MALLOC(courant, n_cells_ext, cs_real_t);
-        cs_cell_courant_number(field_id, courant);
-      }
+    if (indic1 && indic2) {
+      n_i_faces_sel++;
+      i_face_sel_ids[n_i_faces_sel-1] = f_id;
+    }
+    else if (indic1 || indic2) {
+      n_bi_faces_sel++;
+      bi_face_sel_ids[n_bi_faces_sel-1] = f_id;
+      /* Build the faces -> cells connectivity as done in
+         i_face_cells */
+      if (indic1)
+        bi_face_cells[f_id][0] = c_id1;
+      else
+        bi_face_cells[f_id][1] = c_id2;
     }
 
-    int cv_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("convection_limiter_id"));
-    if (cv_limiter_id > -1)
-      cv_limiter = cs_field_by_id(cv_limiter_id)->val;
-
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
-    if (df_limiter_id > -1)
-      df_limiter = cs_field_by_id(df_limiter_id)->val;
   }
 
-  /* Gradient calculation
-     -------------------- */
+  /* Balance computation
+     =================== */
 
-  cs_real_3_t *grad;
-  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  /* Compute the balance at time step n */
 
-  cs_field_gradient_scalar(f,
-                           true, /* use_previous_t */
-                           1, /* inc */
-                           true, /* _recompute_cocg */
-                           grad);
+  int iconvp = 1;
+  int ircflp = 0; /* No reconstruction */
 
-  /* Compute the gradient for convective scheme
-     (the slope test, limiter, SOLU, etc) */
-  cs_real_3_t *gradup = NULL;
-  cs_real_3_t *gradst = NULL;
-  if (var_cal_opt.blencv > 0 && var_cal_opt.isstpc == 0) {
-    BFT_MALLOC(gradst, n_cells_ext, cs_real_3_t);
-    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-      gradst[c_id][0] = 0.;
-      gradst[c_id][1] = 0.;
-      gradst[c_id][2] = 0.;
+  /* Balance on boundary faces
+     -------------------------
+
+     We handle different types of boundary faces separately to better
+     analyze the information, but this is not mandatory. */
+
+  for (cs_lnum_t f_id = 0; f_id < n_bb_faces_sel; f_id++) {
+
+    cs_lnum_t f_id_sel = bb_face_sel_ids[f_id];
+    /* Associated boundary cell */
+    cs_lnum_t c_id = b_face_cells[f_id_sel];
+
+    cs_real_t pip;
+
+    /* Pressure term FIXME rho0*gravity*(X-X0) should be added */
+    cs_real_t p_rho = pressure[c_id] / rho[c_id];
+    cs_real_t a_p_rho = a_p[f_id_sel] / rho[c_id];
+    cs_real_t b_p_rho = b_p[f_id_sel];
+
+    cs_real_3_t grad = {0, 0, 0};
+
+    cs_b_cd_unsteady(ircflp,
+                     diipb[f_id_sel],
+                     grad,
+                     p_rho,
+                     &pip);
+
+    cs_real_t term_balance = 0.;
+
+    cs_b_upwind_flux(iconvp,
+                     1., /* thetap */
+                     0, /* Conservative formulation, no mass accumulation */
+                     inc,
+                     bc_type[f_id_sel],
+                     p_rho,
+                     p_rho, /* no relaxation */
+                     pip,
+                     a_p_rho,
+                     b_p_rho,
+                     b_mass_flux[f_id_sel],
+                     1.,
+                     &term_balance);
+
+    if (b_mass_flux[f_id_sel] > 0) {
+      out_debit += b_mass_flux[f_id_sel]/rho[c_id];
+      out_m_debit += b_mass_flux[f_id_sel];
+      out_pressure += term_balance;
+    } else {
+      in_debit += b_mass_flux[f_id_sel]/rho[c_id];
+      in_m_debit += b_mass_flux[f_id_sel];
+      in_pressure += term_balance;
     }
-    /* Slope test gradient */
-    if (var_cal_opt.iconv > 0)
-      cs_slope_test_gradient(f->id,
-                             1, /* inc */
-                             CS_HALO_STANDARD,
-                             (const cs_real_3_t *)grad,
-                             gradst,
-                             f->val,
-                             a_F,
-                             b_F,
-                             i_mass_flux);
 
-  }
+    /* Kinematic term */
+    cs_real_t u2 = _CS_MODULE2_2(velocity[c_id]);
+    cs_real_t a_u2 = _CS_MODULE2_2(a_u[f_id_sel]);
+    /* Approximation of u^2 BC */
+    cs_real_t b_u2 = 1./6.*( b_u[f_id_sel][0][0] * b_u[f_id_sel][0][0]
+                           + b_u[f_id_sel][1][1] * b_u[f_id_sel][1][1]
+                           + b_u[f_id_sel][2][2] * b_u[f_id_sel][2][2]);
+
+    cs_b_cd_unsteady(ircflp,
+                     diipb[f_id_sel],
+                     grad,
+                     u2,
+                     &pip);
+
+    term_balance = 0.;
+
+    cs_b_upwind_flux(iconvp,
+                     1., /* thetap */
+                     0, /* Conservative formulation, no mass accumulation */
+                     inc,
+                     bc_type[f_id_sel],
+                     u2,
+                     u2, /* no relaxation */
+                     pip,
+                     a_u2,
+                     b_u2,
+                     b_mass_flux[f_id_sel],
+                     1.,
+                     &term_balance);
+
+    if (b_mass_flux[f_id_sel] > 0) {
+      out_u2 += term_balance;
+    } else {
+      in_u2 += term_balance;
+    }
+
+    /* Gravity term */
+    cs_real_t gx = - _CS_DOT_PRODUCT(gravity, b_face_cog[f_id_sel]);
+    /* Trivial BCs */
+    cs_real_t a_gx = gx;
+    cs_real_t b_gx = 0.;
+
+    cs_b_cd_unsteady(ircflp,
+                     diipb[f_id_sel],
+                     grad,
+                     gx,
+                     &pip);
+
+    term_balance = 0.;
+
+    cs_b_upwind_flux(iconvp,
+                     1., /* thetap */
+                     0, /* Conservative formulation, no mass accumulation */
+                     inc,
+                     bc_type[f_id_sel],
+                     gx,
+                     gx, /* no relaxation */
+                     pip,
+                     a_gx,
+                     b_gx,
+                     b_mass_flux[f_id_sel],
+                     1.,
+                     &term_balance);
+
+    if (b_mass_flux[f_id_sel] > 0) {
+      out_rhogx += term_balance;
+    } else {
+      in_rhogx += term_balance;
+    }
+
+  }
+
+  /* Balance on boundary faces of the selected zone
+     that are internal of the total mesh
+     ---------------------------------------------- */
+
+  for (cs_lnum_t f_id = 0; f_id < n_bi_faces_sel; f_id++) {
+
+    cs_lnum_t f_id_sel = bi_face_sel_ids[f_id];
+    /* Associated boundary-internal cells */
+    cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
+    cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
+
+    cs_real_2_t bi_bterms = {0.,0.};
+    cs_real_3_t grad = {0, 0, 0};
+
+    cs_real_t pip, pjp;
+    cs_real_t pif, pjf;
+
+    /* Pressure term */
+    cs_real_t p_rho_id1 = pressure[c_id1] / rho[c_id1];
+    cs_real_t p_rho_id2 = pressure[c_id2] / rho[c_id2];
+
+    cs_i_cd_unsteady_upwind(ircflp,
+                            diipf[f_id_sel],
+                            djjpf[f_id_sel],
+                            grad,
+                            grad,
+                            p_rho_id1,
+                            p_rho_id2,
+                            &pif,
+                            &pjf,
+                            &pip,
+                            &pjp);
+
+    cs_i_conv_flux(iconvp,
+                   1.,
+                   0, /* Conservative formulation, no mass accumulation */
+                   p_rho_id1,
+                   p_rho_id2,
+                   pif,
+                   pif, /* no relaxation */
+                   pjf,
+                   pjf, /* no relaxation */
+                   i_mass_flux[f_id_sel],
+                   1.,
+                   1.,
+                   bi_bterms);
+
+    /* (The cell is counted only once in parallel by checking that
+       the c_id is not in the halo) */
+    /* Face normal well oriented (check bi_face_cells array) */
+    if (bi_face_cells[f_id_sel][0] >= 0) {
+      if (c_id1 < n_cells) {
+        if (i_mass_flux[f_id_sel] > 0) {
+          out_pressure += bi_bterms[0];
+          out_debit += i_mass_flux[f_id_sel] / rho[c_id1];
+          out_m_debit += i_mass_flux[f_id_sel];
+        } else {
+          in_pressure += bi_bterms[0];
+          in_debit += i_mass_flux[f_id_sel] / rho[c_id1];
+          in_m_debit += i_mass_flux[f_id_sel];
+        }
+      }
+    }
+    /* Face normal direction reversed */
+    else {
+      if (c_id2 < n_cells) {
+        if (i_mass_flux[f_id_sel] > 0) {
+          in_pressure -= bi_bterms[1];
+          in_debit -= i_mass_flux[f_id_sel] / rho[c_id2];
+          in_m_debit -= i_mass_flux[f_id_sel];
+        } else {
+          out_pressure -= bi_bterms[1];
+          out_debit -= i_mass_flux[f_id_sel] / rho[c_id2];
+          out_m_debit -= i_mass_flux[f_id_sel];
+        }
+      }
+    }
+
+    /* Kinematic term */
+    bi_bterms[0] = 0.;
+    bi_bterms[1] = 0.;
+
+    cs_real_t u2_id1 = _CS_MODULE2_2(velocity[c_id1]);
+    cs_real_t u2_id2 = _CS_MODULE2_2(velocity[c_id2]);
+
+    cs_i_cd_unsteady_upwind(ircflp,
+                            diipf[f_id_sel],
+                            djjpf[f_id_sel],
+                            grad,
+                            grad,
+                            u2_id1,
+                            u2_id2,
+                            &pif,
+                            &pjf,
+                            &pip,
+                            &pjp);
+
+    cs_i_conv_flux(iconvp,
+                   1.,
+                   0, /* Conservative formulation, no mass accumulation */
+                   u2_id1,
+                   u2_id2,
+                   pif,
+                   pif, /* no relaxation */
+                   pjf,
+                   pjf, /* no relaxation */
+                   i_mass_flux[f_id_sel],
+                   1.,
+                   1.,
+                   bi_bterms);
+
+    /* (The cell is counted only once in parallel by checking that
+       the c_id is not in the halo) */
+    /* Face normal well oriented (check bi_face_cells array) */
+    if (bi_face_cells[f_id_sel][0] >= 0) {
+      if (c_id1 < n_cells) {
+        if (i_mass_flux[f_id_sel] > 0) {
+          out_u2 += bi_bterms[0];
+        } else {
+          in_u2 += bi_bterms[0];
+        }
+      }
+    }
+    /* Face normal direction reversed */
+    else {
+      if (c_id2 < n_cells) {
+        if (i_mass_flux[f_id_sel] > 0) {
+          in_u2 -= bi_bterms[1];
+        } else {
+          out_u2 -= bi_bterms[1];
+        }
+      }
+    }
+
+    /* Gravity term */
+    bi_bterms[0] = 0.;
+    bi_bterms[1] = 0.;
+
+    cs_real_t gx_id1 = - _CS_DOT_PRODUCT(gravity, i_face_cog[f_id_sel]);
+    cs_real_t gx_id2 = - _CS_DOT_PRODUCT(gravity, i_face_cog[f_id_sel]);
+
+    cs_i_cd_unsteady_upwind(ircflp,
+                            diipf[f_id_sel],
+                            djjpf[f_id_sel],
+                            grad,
+                            grad,
+                            gx_id1,
+                            gx_id2,
+                            &pif,
+                            &pjf,
+                            &pip,
+                            &pjp);
+
+    cs_i_conv_flux(iconvp,
+                   1.,
+                   0, /* Conservative formulation, no mass accumulation */
+                   gx_id1,
+                   gx_id2,
+                   pif,
+                   pif, /* no relaxation */
+                   pjf,
+                   pjf, /* no relaxation */
+                   i_mass_flux[f_id_sel],
+                   1.,
+                   1.,
+                   bi_bterms);
+
+    /* (The cell is counted only once in parallel by checking that
+       the c_id is not in the halo) */
+    /* Face normal well oriented (check bi_face_cells array) */
+    if (bi_face_cells[f_id_sel][0] >= 0) {
+      if (c_id1 < n_cells) {
+        if (i_mass_flux[f_id_sel] > 0) {
+          out_rhogx += bi_bterms[0];
+        } else {
+          in_rhogx += bi_bterms[0];
+        }
+      }
+    }
+    /* Face normal direction reversed */
+    else {
+      if (c_id2 < n_cells) {
+        if (i_mass_flux[f_id_sel] > 0) {
+          in_rhogx -= bi_bterms[1];
+        } else {
+          out_rhogx -= bi_bterms[1];
+        }
+      }
+    }
+
+  }
+
+  /* Free memory */
+
+  BFT_FREE(cells_tag_ids);
+  BFT_FREE(bi_face_cells);
+  BFT_FREE(i_face_sel_ids);
+  BFT_FREE(bb_face_sel_ids);
+  BFT_FREE(bi_face_sel_ids);
+
+  /* Sum of values on all ranks (parallel calculations) */
+
+  balance[CS_BALANCE_P_IN] = in_pressure;
+  balance[CS_BALANCE_P_OUT] = out_pressure;
+  balance[CS_BALANCE_P_U2_IN] = in_u2;
+  balance[CS_BALANCE_P_U2_OUT] = out_u2;
+  balance[CS_BALANCE_P_RHOGX_IN] = in_rhogx;
+  balance[CS_BALANCE_P_RHOGX_OUT] = out_rhogx;
+  balance[CS_BALANCE_P_U_IN] = in_debit;
+  balance[CS_BALANCE_P_U_OUT] = out_debit;
+  balance[CS_BALANCE_P_RHOU_IN] = in_m_debit;
+  balance[CS_BALANCE_P_RHOU_OUT] = out_m_debit;
+
+  cs_parall_sum(CS_BALANCE_P_N_TERMS, CS_REAL_TYPE, balance);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Computes one term of the head loss balance (pressure drop) on a
+ * volumic zone defined by the criterion also given as argument.
+ * The different contributions are printed in the run_solver.log.
+ *
+ * \param[in]     selection_crit      zone selection criterion
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_pressure_drop_by_zone(const char * selection_crit)
+{
+  cs_real_t balance[CS_BALANCE_P_N_TERMS];
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  /* Select cells */
+
+  cs_lnum_t n_cells_sel = 0;
+  cs_lnum_t *cells_sel_ids = NULL;
+
+  BFT_MALLOC(cells_sel_ids, m->n_cells, cs_lnum_t);
+  cs_selector_get_cell_list(selection_crit, &n_cells_sel, cells_sel_ids);
+
+  /* Compute pressure drop terms */
+
+  cs_pressure_drop_by_zone_compute(n_cells_sel,
+                                   cells_sel_ids,
+                                   balance);
+
+  BFT_FREE(cells_sel_ids);
+
+  /* Log results at time step n */
+
+  bft_printf(_("   ** PRESSURE DROP BY ZONE at iteration %6i\n"
+               "   ---------------------------------------------\n"
+               "------------------------------------------------------------\n"
+               "   ZONE SELECTION CRITERIA: \"%s\"\n"
+               "------------------------------------------------------------\n"
+               "  |                 |\n"
+               "  | p u . dS        | p u . dS\n"
+               "  |   -    -        |   -    -\n"
+               "  |                 |\n"
+               "  | inlet           | outlet\n"
+               "  %12.4e      %12.4e\n"
+               "------------------------------------------------------------\n"
+               "  |                 |\n"
+               "  | u^2/2 rho u . dS| u^2/2 rho u . dS\n"
+               "  | -         -    -| -         -    -\n"
+               "  |                 |\n"
+               "  | inlet           | outlet\n"
+               "  %12.4e      %12.4e\n"
+               "------------------------------------------------------------\n"
+               "  |                 |\n"
+               "  |-rho(g . x)u . dS|-rho(g . x)u . dS\n"
+               "  |     -   - -    -|     -   - -    -\n"
+               "  |                 |\n"
+               "  | inlet           | outlet\n"
+               "  %12.4e      %12.4e\n"
+               "------------------------------------------------------------\n"
+               "  |                 |\n"
+               "  | u . dS          | u . dS\n"
+               "  | -    -          | -    -\n"
+               "  |                 |\n"
+               "  | inlet           | outlet\n"
+               "  %12.4e      %12.4e\n"
+               "------------------------------------------------------------\n"
+               "  |                 |\n"
+               "  | rho u . dS      | rho u . dS\n"
+               "  |     -    -      |     -    -\n"
+               "  |                 |\n"
+               "  | inlet           | outlet\n"
+               "  %12.4e      %12.4e\n"
+               "------------------------------------------------------------\n\n"),
+             nt_cur, selection_crit,
+             balance[CS_BALANCE_P_IN], balance[CS_BALANCE_P_OUT],
+             balance[CS_BALANCE_P_U2_IN], balance[CS_BALANCE_P_U2_OUT],
+             balance[CS_BALANCE_P_RHOGX_IN], balance[CS_BALANCE_P_RHOGX_OUT],
+             balance[CS_BALANCE_P_U_IN], balance[CS_BALANCE_P_U_OUT],
+             balance[CS_BALANCE_P_RHOU_IN], balance[CS_BALANCE_P_RHOU_OUT]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the surface balance of a given scalar.
+ *
+ * For interior faces, the flux is counted negatively relative to the given
+ * normal (as neighboring interior faces may have differently-aligned normals).
+ *
+ * For boundary faces, the flux is counted negatively in the outwards-facing
+ * direction.
+ *
+ * \param[in]     selection_crit      zone selection criterion
+ * \param[in]     scalar_name         scalar name
+ * \param[in]     normal              outwards normal direction
+ */
+/*----------------------------------------------------------------------------*/
 
-  /* Pure SOLU scheme without using gradient_slope_test function
-     or Roe and Sweby limiters */
-  if (var_cal_opt.blencv > 0
-      && (var_cal_opt.ischcv==2 || var_cal_opt.ischcv==4)) {
-    BFT_MALLOC(gradup, n_cells_ext, cs_real_3_t);
-    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-      gradup[c_id][0] = 0.;
-      gradup[c_id][1] = 0.;
-      gradup[c_id][2] = 0.;
-    }
+void
+cs_surface_balance(const char       *selection_crit,
+                   const char       *scalar_name,
+                   const cs_real_t   normal[3])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
 
-    if (var_cal_opt.iconv > 0)
-      cs_upwind_gradient(f->id,
-                         1, /* inc */
-                         CS_HALO_STANDARD,
-                         a_F,
-                         b_F,
-                         i_mass_flux,
-                         b_mass_flux,
-                         f->val,
-                         gradup);
-  }
+  /* Faces selection */
 
-  /* Faces selection
-     --------------- */
+  cs_lnum_t n_b_faces_sel = 0;
+  cs_lnum_t *b_face_sel_ids = NULL;
+  cs_lnum_t n_i_faces_sel = 0;
+  cs_lnum_t *i_face_sel_ids = NULL;
 
-  cs_lnum_2_t *bi_face_cells = NULL;
+  BFT_MALLOC(i_face_sel_ids, m->n_i_faces, cs_lnum_t);
+  BFT_MALLOC(b_face_sel_ids, m->n_b_faces, cs_lnum_t);
 
-  if (n_i_faces_sel > 0) {
+  cs_selector_get_i_face_list(selection_crit, &n_i_faces_sel, i_face_sel_ids);
+  cs_selector_get_b_face_list(selection_crit, &n_b_faces_sel, b_face_sel_ids);
 
-    BFT_MALLOC(bi_face_cells, n_i_faces, cs_lnum_2_t);
-    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-      bi_face_cells[f_id][0] = -999;
-      bi_face_cells[f_id][1] = -999;
-    }
+  /* Balance on selected faces */
 
-    for (cs_lnum_t f_id = 0; f_id < n_i_faces_sel; f_id++) {
-      cs_lnum_t f_id_sel = i_face_sel_ids[f_id];
-      cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
-      cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
-
-      cs_real_t dot_pro = cs_math_3_dot_product(normal, i_face_normal[f_id_sel]);
-      if (fabs(dot_pro) < 1.0e-14)//FIXME
-        dot_pro = 0;
-      if(dot_pro > 0.)
-        bi_face_cells[f_id_sel][0] = c_id1;
-      else if (dot_pro < 0.)
-        bi_face_cells[f_id_sel][1] = c_id2;
-    }
+  cs_real_t  balance[CS_BALANCE_N_TERMS];
 
-    if (flux_i_faces != NULL) {
-      for (cs_lnum_t f_id = 0; f_id < n_i_faces_sel; f_id++)
-        flux_i_faces[f_id] = 0.;
-    }
+  cs_flux_through_surface(scalar_name,
+                          normal,
+                          n_b_faces_sel,
+                          n_i_faces_sel,
+                          b_face_sel_ids,
+                          i_face_sel_ids,
+                          balance,
+                          NULL,   /* flux_b_faces */
+                          NULL);  /* flux_i_faces */
 
-    if (flux_b_faces != NULL) {
-      for (cs_lnum_t f_id = 0; f_id < n_b_faces_sel; f_id++)
-        flux_b_faces[f_id] = 0.;
-    }
+  /* Recount selected interior faces (parallel test) */
 
-  }
+  cs_gnum_t n_sel[2];
 
-  /* Boundary faces contribution
-     --------------------------- */
+  _surface_balance_count(n_b_faces_sel, n_i_faces_sel, i_face_sel_ids, n_sel);
 
-  int iconvp = var_cal_opt.iconv;
-  int idiffp = var_cal_opt.idiff;
-  int ircflp = var_cal_opt.ircflu;
-  double relaxp = var_cal_opt.relaxv;
+  /* Free memory */
 
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces_sel; f_id++) {
+  BFT_FREE(i_face_sel_ids);
+  BFT_FREE(b_face_sel_ids);
 
-    cs_lnum_t f_id_sel = (b_face_sel_ids != NULL) ? b_face_sel_ids[f_id] : f_id;
+  /* Log balance */
 
-    /* Associated boundary cell */
-    cs_lnum_t c_id = b_face_cells[f_id_sel];
+  _surface_balance_log(selection_crit, scalar_name, normal, n_sel, balance);
+}
 
-    cs_real_t term_balance = 0.;
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get the face by face surface flux of a given scalar, through a
+ *        surface area defined by the given face ids.
+ *
+ * For interior faces, the flux is counted negatively relative to the given
+ * normal (as neighboring interior faces may have differently-aligned normals).
+ *
+ * For boundary faces, the flux is counted negatively in the outwards-facing
+ * direction.
+ *
+ * \param[in]   scalar_name       scalar name
+ * \param[in]   normal            outwards normal direction
+ * \param[in]   n_b_faces_sel     number of selected boundary faces
+ * \param[in]   n_i_faces_sel     number of selected internal faces
+ * \param[in]   b_face_sel_ids    ids of selected boundary faces
+ * \param[in]   i_face_sel_ids    ids of selected internal faces
+ * \param[out]  balance           optional array of computed balance terms
+ *                                (see \ref cs_balance_term_t), of
+ *                                size CS_BALANCE_N_TERMS, or NULL
+ * \param[out]  flux_b_faces      optional surface flux through selected
+ *                                boundary faces, or NULL
+ * \param[out]  flux_i_faces      optional surface flux through selected
+ *                                interior faces, or NULL
+ */
+/*----------------------------------------------------------------------------*/
 
-    cs_real_t ac_F = 0.;
-    cs_real_t bc_F = 0.;
+void
+cs_flux_through_surface(const char         *scalar_name,
+                        const cs_real_t     normal[3],
+                        cs_lnum_t           n_b_faces_sel,
+                        cs_lnum_t           n_i_faces_sel,
+                        const cs_lnum_t     b_face_sel_ids[],
+                        const cs_lnum_t     i_face_sel_ids[],
+                        cs_real_t          *balance,
+                        cs_real_t          *flux_b_faces,
+                        cs_real_t          *flux_i_faces)
+{
+  const cs_field_t *f = cs_field_by_name_try(scalar_name);
 
-    if (icvflb == 1) {
-      ac_F = f->bc_coeffs->ac[f_id_sel];
-      bc_F = f->bc_coeffs->bc[f_id_sel];
-      icvflf = 0; /* = icvfli */
-    }
+  cs_real_t  _balance[CS_BALANCE_N_TERMS];
 
-    _balance_boundary_faces(icvflf,
-                            idtvar,
-                            iconvp,
-                            idiffp,
-                            ircflp,
-                            relaxp,
-                            diipb[f_id_sel],
-                            grad[c_id],
-                            f->val[c_id],
-                            f->val_pre[c_id],
-                            bc_type[f_id_sel],
-                            b_visc[f_id_sel],
-                            a_F[f_id_sel],
-                            b_F[f_id_sel],
-                            af_F[f_id_sel],
-                            bf_F[f_id_sel],
-                            ac_F,
-                            bc_F,
-                            b_mass_flux[f_id_sel],
-                            cpro_cp[c_id],
-                            &term_balance);
+  _balance_scalar_t *bs = _balance_scalar_create(f);
 
-    if (flux_b_faces != NULL)
-      flux_b_faces[f_id] = term_balance;
+  _flux_through_surface(bs,
+                        normal,
+                        n_b_faces_sel,
+                        n_i_faces_sel,
+                        b_face_sel_ids,
+                        i_face_sel_ids,
+                        _balance,
+                        flux_b_faces,
+                        flux_i_faces);
 
-    if (bc_type[f_id_sel] == CS_INLET ||
-        bc_type[f_id_sel] == CS_FREE_INLET ||
-        bc_type[f_id_sel] == CS_ESICF ||
-        bc_type[f_id_sel] == CS_EPHCF)
-      _balance[CS_BALANCE_BOUNDARY_IN] -= term_balance;
-    else if (bc_type[f_id_sel] == CS_OUTLET ||
-             bc_type[f_id_sel] == CS_SSPCF ||
-             bc_type[f_id_sel] == CS_SOPCF)
-      _balance[CS_BALANCE_BOUNDARY_OUT] -= term_balance;
-    else if (bc_type[f_id_sel] == CS_SYMMETRY)
-      _balance[CS_BALANCE_BOUNDARY_SYM] -= term_balance;
-    else if (bc_type[f_id_sel] == CS_SMOOTHWALL)
-      _balance[CS_BALANCE_BOUNDARY_WALL_S] -= term_balance;
-    else if (bc_type[f_id_sel] == CS_ROUGHWALL)
-      _balance[CS_BALANCE_BOUNDARY_WALL_R] -= term_balance;
-    else if (   bc_type[f_id_sel] == CS_COUPLED
-             || bc_type[f_id_sel] == CS_COUPLED_FD)
-      _balance[CS_BALANCE_BOUNDARY_COUPLED_E] -= term_balance;
-    else
-      _balance[CS_BALANCE_BOUNDARY_OTHER] -= term_balance;
+  _balance_scalar_destroy(&bs);
 
+  if (balance != NULL) {
+    for (int i = 0; i < CS_BALANCE_N_TERMS; i++)
+      balance[i] = _balance[i];
+    cs_parall_sum(CS_BALANCE_N_TERMS, CS_REAL_TYPE, balance);
   }
+}
 
-  /* Balance on coupled faces
-     ------------------------
-
-    We handle different types of boundary faces separately to better
-    analyze the information, but this is not mandatory. */
-
-  if (var_cal_opt.icoupl > 0) {
-
-    cs_lnum_t *inv_b_face_sel_ids = NULL;
-
-    BFT_MALLOC(inv_b_face_sel_ids, n_b_faces, cs_lnum_t);
-    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++)
-      inv_b_face_sel_ids[f_id] = -1;
-
-    if (b_face_sel_ids != NULL) {
-      for (cs_lnum_t f_id = 0; f_id < n_b_faces_sel; f_id++) {
-        cs_lnum_t f_id_sel = b_face_sel_ids[f_id];
-        inv_b_face_sel_ids[f_id_sel] = f_id;
-      }
-    }
-    else {
-      for (cs_lnum_t f_id_sel = 0; f_id_sel < n_b_faces_sel; f_id_sel++)
-        inv_b_face_sel_ids[f_id_sel] = f_id_sel;
-    }
-
-    /* Prepare data for sending from distant */
-    BFT_MALLOC(pvar_distant, n_distant, cs_real_t);
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a scalar balance on a volume zone to the balances computed
+ *        and logged at each time step.
+ *
+ * All balances added in this way are computed together by
+ * \ref cs_balance_by_zone_compute_all, so that the gradients and other
+ * scalar-dependent data are computed only once per scalar, and
+ * a single pass on the mesh is used for all zones of a given scalar.
+ * Zone selections are determined only once (unless the mesh changes).
+ *
+ * This function should be called during the setup phase, for example
+ * in \ref cs_user_extra_operations_initialize.
+ *
+ * \param[in]  selection_crit  zone selection criterion
+ * \param[in]  scalar_name     scalar name
+ *
+ * \return  id of the balance definition
+ */
+/*----------------------------------------------------------------------------*/
 
-    for (cs_lnum_t ii = 0; ii < n_distant; ii++) {
-      cs_lnum_t f_id = faces_distant[ii];
-      cs_lnum_t c_id = b_face_cells[f_id];
-      cs_real_t pip;
-      cs_b_cd_unsteady(ircflp,
-                       diipb[f_id],
-                       grad[c_id],
-                       f->val[c_id],
-                       &pip);
-      pvar_distant[ii] = pip;
-    }
+int
+cs_balance_by_zone_add(const char  *selection_crit,
+                       const char  *scalar_name)
+{
+  return _balance_def_add(false, selection_crit, scalar_name, NULL);
+}
 
-    /* Receive data */
-    BFT_MALLOC(pvar_local, n_local, cs_real_t);
-    cs_internal_coupling_exchange_var(cpl,
-                                      1, /* Dimension */
-                                      pvar_distant,
-                                      pvar_local);
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a scalar surface balance to the balances computed and logged
+ *        at each time step.
+ *
+ * See \ref cs_balance_by_zone_add and \ref cs_surface_balance.
+ *
+ * \param[in]  selection_crit  zone selection criterion
+ * \param[in]  scalar_name     scalar name
+ * \param[in]  normal          outwards normal direction
+ *
+ * \return  id of the balance definition
+ */
+/*----------------------------------------------------------------------------*/
 
-    /* Flux contribution */
+int
+cs_surface_balance_add(const char       *selection_crit,
+                       const char       *scalar_name,
+                       const cs_real_t   normal[3])
+{
+  return _balance_def_add(true, selection_crit, scalar_name, normal);
+}
 
-    for (cs_lnum_t ii = 0; ii < n_local; ii++) {
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute and log all balances added with \ref cs_balance_by_zone_add
+ *        and \ref cs_surface_balance_add.
+ *
+ * Balances are grouped by scalar: the scalar-dependent data (gradients,
+ * face viscosity, limiters) is computed once per scalar, all volume zones
+ * of a scalar are handled in a single pass on the mesh, and parallel
+ * sums are grouped.
+ */
+/*----------------------------------------------------------------------------*/
 
-      cs_lnum_t f_id = faces_local[ii];
-      cs_lnum_t sel_f_id = inv_b_face_sel_ids[f_id];
+void
+cs_balance_by_zone_compute_all(void)
+{
+  if (_n_balance_defs < 1)
+    return;
 
-      if (sel_f_id < 0)
-        continue;
+  _balance_defs_select();
 
-      cs_lnum_t c_id = b_face_cells[f_id];
+  int n_zone_defs = 0, n_surface_defs = 0;
+  int *zone_def_ids = NULL, *surface_def_ids = NULL;
+  bool *handled = NULL;
 
-      cs_real_t pip, pjp;
-      cs_real_t term_balance = 0.;
+  BFT_MALLOC(zone_def_ids, _n_balance_defs, int);
+  BFT_MALLOC(surface_def_ids, _n_balance_defs, int);
+  BFT_MALLOC(handled, _n_balance_defs, bool);
 
-      cs_b_cd_unsteady(ircflp,
-                       diipb[f_id],
-                       grad[c_id],
-                       f->val[c_id],
-                       &pip);
+  for (int d_id = 0; d_id < _n_balance_defs; d_id++)
+    handled[d_id] = false;
 
-      pjp = pvar_local[ii];
+  for (int d_id = 0; d_id < _n_balance_defs; d_id++) {
 
-      hint = f->bc_coeffs->hint[f_id];
-      hext = f->bc_coeffs->hext[f_id];
-      heq = hint * hext / (hint + hext);
+    if (handled[d_id])
+      continue;
 
-      cs_b_diff_flux_coupling(idiffp,
-                              pip,
-                              pjp,
-                              heq,
-                              &term_balance);
+    const char *scalar_name = _balance_defs[d_id].scalar_name;
 
-      if (flux_b_faces != NULL)
-        flux_b_faces[inv_b_face_sel_ids[f_id]] = term_balance;
+    /* Group definitions relative to the same scalar */
 
-      _balance[CS_BALANCE_BOUNDARY_COUPLED_I] -= term_balance;
+    n_zone_defs = 0;
+    n_surface_defs = 0;
 
+    for (int j = d_id; j < _n_balance_defs; j++) {
+      _balance_def_t *bd = _balance_defs + j;
+      if (handled[j] || strcmp(bd->scalar_name, scalar_name) != 0)
+        continue;
+      handled[j] = true;
+      if (bd->surface)
+        surface_def_ids[n_surface_defs++] = j;
+      else
+        zone_def_ids[n_zone_defs++] = j;
+      for (int i = 0; i < CS_BALANCE_N_TERMS; i++)
+        bd->balance[i] = 0.;
     }
 
-    BFT_FREE(pvar_local);
-    BFT_FREE(pvar_distant);
-
-    BFT_FREE(inv_b_face_sel_ids);
-  }
+    /* If the requested scalar field is not computed, skip */
 
-  /* Balance on selected interior faces */
-
-  int isstpp = var_cal_opt.isstpc;
-  double blencp = var_cal_opt.blencv;
-  double blend_st = var_cal_opt.blend_st;
-  int iupwin = (blencp > 0.) ? 0 : 1;
+    const cs_field_t *f = cs_field_by_name_try(scalar_name);
+    if (f == NULL) {
+      bft_printf("Scalar field \"%s\" does not exist. "
+                 "Balance will not be computed.\n", scalar_name);
+      continue;
+    }
 
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces_sel; f_id++) {
+    _balance_scalar_t *bs = _balance_scalar_create(f);
 
-    cs_lnum_t f_id_sel = i_face_sel_ids[f_id];
-    /* Associated boundary-internal cells */
-    cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
+    if (n_zone_defs > 0)
+      _balance_defs_compute_zones(bs, n_zone_defs, zone_def_ids);
 
-    cs_real_t beta = blencp;
-    /* Beta blending coefficient ensuring positivity of the scalar */
-    if (isstpp == 2) {
-      beta = CS_MAX(CS_MIN(cv_limiter[c_id1], cv_limiter[c_id2]), 0.);
-    }
+    if (n_surface_defs > 0)
+      _balance_defs_compute_surfaces(bs, n_surface_defs, surface_def_ids);
 
-    cs_real_t bldfrp = (cs_real_t) ircflp;
-    /* Local limitation of the reconstruction */
-    if (df_limiter != NULL && ircflp > 0)
-      bldfrp = CS_MAX(CS_MIN(df_limiter[c_id1], df_limiter[c_id2]), 0.);
-
-    cs_real_t hybrid_coef_ii, hybrid_coef_jj;
-    cs_lnum_t ic = -1, id = -1;
-    cs_real_t courant_c = -1.;
-    if (ischcp == 3) {
-      hybrid_coef_ii = CS_F_(hybrid_blend)->val[c_id1];
-      hybrid_coef_jj = CS_F_(hybrid_blend)->val[c_id2];
-    }
-    else if (ischcp == 4) {
-      hybrid_coef_ii = 0.;
-      hybrid_coef_jj = 0.;
-      /* Determine central and downwind sides w.r.t. current face */
-      cs_central_downwind_cells(c_id1,
-                                c_id2,
-                                i_mass_flux[f_id_sel],
-                                &ic,  /* central cell id */
-                                &id); /* downwind cell id */
-
-      if (courant != NULL)
-        courant_c = courant[ic];
+    _balance_scalar_destroy(&bs);
 
-    } else {
-      hybrid_coef_ii = 0.;
-      hybrid_coef_jj = 0.;
-    }
+  }
 
-    cs_real_2_t bi_bterms = {0., 0.};
+  BFT_FREE(handled);
+  BFT_FREE(surface_def_ids);
+  BFT_FREE(zone_def_ids);
+
+  /* Log results at time step n, in order of definition */
+
+  for (int d_id = 0; d_id < _n_balance_defs; d_id++) {
+    const _balance_def_t *bd = _balance_defs + d_id;
+    if (cs_field_by_name_try(bd->scalar_name) == NULL)
+      continue;
+    if (bd->surface)
+      _surface_balance_log(bd->criteria,
+                           bd->scalar_name,
+                           bd->normal,
+                           bd->n_g_elts,
+                           bd->balance);
+    else
+      _balance_by_zone_log(bd->criteria,
+                           bd->scalar_name,
+                           bd->balance);
+  }
+}
 
-    _balance_internal_faces(iupwin,
-                            idtvar,
-                            iconvp,
-                            idiffp,
-                            bldfrp,
-                            ischcp,
-                            isstpp,
-                            limiter_choice,
-                            relaxp,
-                            beta,
-                            blend_st,
-                            weight[f_id_sel],
-                            i_dist[f_id_sel],
-                            i_face_surf[f_id_sel],
-                            cell_cen[c_id1],
-                            cell_cen[c_id2],
-                            cell_cen[ic],
-                            cell_cen[id],
-                            i_face_normal[f_id_sel],
-                            i_face_cog[f_id_sel],
-                            hybrid_coef_ii,
-                            hybrid_coef_jj,
-                            diipf[f_id_sel],
-                            djjpf[f_id_sel],
-                            grad[c_id1],
-                            grad[c_id2],
-                            grad[ic],
-                            gradup[c_id1],
-                            gradup[c_id2],
-                            gradst[c_id1],
-                            gradst[c_id2],
-                            f->val[c_id1],
-                            f->val[c_id2],
-                            f->val[ic],
-                            f->val[id],
-                            f->val_pre[c_id1],
-                            f->val_pre[c_id2],
-                            i_visc[f_id_sel],
-                            i_mass_flux[f_id_sel],
-                            cpro_cp[c_id1],
-                            cpro_cp[c_id2],
-                            local_max[ic],
-                            local_min[ic],
-                            courant_c,
-                            bi_bterms);
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the terms of a balance added with
+ *        \ref cs_balance_by_zone_add or \ref cs_surface_balance_add,
+ *        as computed by the last call to \ref cs_balance_by_zone_compute_all.
+ *
+ * \param[in]  id  id of the balance definition
+ *
+ * \return  pointer to balance terms (see \ref cs_balance_term_t),
+ *          of size CS_BALANCE_N_TERMS
+ */
+/*----------------------------------------------------------------------------*/
 
-    /* (The cell is counted only once in parallel by checking that
-       the c_id is not in the halo) */
-    /* Face normal well oriented (check i_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
-      if (c_id1 < n_cells) {
-        if (flux_i_faces != NULL)
-          flux_i_faces[f_id] -= bi_bterms[0];
-        if (i_mass_flux[f_id_sel] > 0)
-          _balance[CS_BALANCE_INTERIOR_IN] -= bi_bterms[0];
-        else
-          _balance[CS_BALANCE_INTERIOR_OUT] -= bi_bterms[0];
-      }
-    }
-    /* Face normal direction reversed */
-    else if (bi_face_cells[f_id_sel][1] >= 0) {
-      if (c_id2 < n_cells) {
-        if (flux_i_faces != NULL)
-          flux_i_faces[f_id] += bi_bterms[1];
-        if (i_mass_flux[f_id_sel] > 0)
-          _balance[CS_BALANCE_INTERIOR_IN] += bi_bterms[1];
-        else
-          _balance[CS_BALANCE_INTERIOR_OUT] += bi_bterms[1];
-      }
-    }
-  }
+const cs_real_t *
+cs_balance_by_zone_get_terms(int  id)
+{
+  if (id < 0 || id >= _n_balance_defs)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: balance definition id %d is not in range [0, %d]."),
+              __func__, id, _n_balance_defs - 1);
 
-  if (balance != NULL) {
+  return _balance_defs[id].balance;
+}
 
-    _balance[CS_BALANCE_BOUNDARY_WALL] =   _balance[CS_BALANCE_BOUNDARY_WALL_S]
-                                         + _balance[CS_BALANCE_BOUNDARY_WALL_R];
-    _balance[CS_BALANCE_BOUNDARY_COUPLED]
-      =   _balance[CS_BALANCE_BOUNDARY_COUPLED_E]
-        + _balance[CS_BALANCE_BOUNDARY_COUPLED_I];
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free all balance definitions.
+ */
+/*----------------------------------------------------------------------------*/
 
-    for (int i = 0; i < CS_BALANCE_N_TERMS; i++)
-      balance[i] = _balance[i];
-    cs_parall_sum(CS_BALANCE_N_TERMS, CS_REAL_TYPE, balance);
+void
+cs_balance_by_zone_finalize(void)
+{
+  for (int d_id = 0; d_id < _n_balance_defs; d_id++) {
+    _balance_def_t *bd = _balance_defs + d_id;
+    BFT_FREE(bd->criteria);
+    BFT_FREE(bd->scalar_name);
+    BFT_FREE(bd->elt_ids[0]);
+    BFT_FREE(bd->elt_ids[1]);
   }
 
-  /* Free memory */
+  BFT_FREE(_balance_defs);
+  _n_balance_defs = 0;
 
-  BFT_FREE(bi_face_cells);
-  BFT_FREE(grad);
-  BFT_FREE(gradup);
-  BFT_FREE(gradst);
-  BFT_FREE(local_max);
-  BFT_FREE(local_min);
-  BFT_FREE(courant);
-
-  if (!itemperature || icp == -1)
-    BFT_FREE(cpro_cp);
-  BFT_FREE(c_visc);
-  BFT_FREE(i_visc);
-  BFT_FREE(b_visc);
+  _balance_sel_mesh_sizes[0] = -1;
+  _balance_sel_mesh_sizes[1] = -1;
+  _balance_sel_mesh_sizes[2] = -1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -247,6 +247,91 @@ cs_flux_through_surface(const char         *scalar_name,
                         cs_real_t          *flux_b_faces,
                         cs_real_t          *flux_i_faces);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a scalar balance on a volume zone to the balances computed
+ *        and logged at each time step.
+ *
+ * All balances added in this way are computed together by
+ * \ref cs_balance_by_zone_compute_all, so that the gradients and other
+ * scalar-dependent data are computed only once per scalar, and
+ * a single pass on the mesh is used for all zones of a given scalar.
+ * Zone selections are determined only once (unless the mesh changes).
+ *
+ * This function should be called during the setup phase, for example
+ * in \ref cs_user_extra_operations_initialize.
+ *
+ * \param[in]  selection_crit  zone selection criterion
+ * \param[in]  scalar_name     scalar name
+ *
+ * \return  id of the balance definition
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_balance_by_zone_add(const char  *selection_crit,
+                       const char  *scalar_name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a scalar surface balance to the balances computed and logged
+ *        at each time step.
+ *
+ * See \ref cs_balance_by_zone_add and \ref cs_surface_balance.
+ *
+ * \param[in]  selection_crit  zone selection criterion
+ * \param[in]  scalar_name     scalar name
+ * \param[in]  normal          outwards normal direction
+ *
+ * \return  id of the balance definition
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_surface_balance_add(const char       *selection_crit,
+                       const char       *scalar_name,
+                       const cs_real_t   normal[3]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute and log all balances added with \ref cs_balance_by_zone_add
+ *        and \ref cs_surface_balance_add.
+ *
+ * Balances are grouped by scalar: the scalar-dependent data (gradients,
+ * face viscosity, limiters) is computed once per scalar, all volume zones
+ * of a scalar are handled in a single pass on the mesh, and parallel
+ * sums are grouped.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_compute_all(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the terms of a balance added with
+ *        \ref cs_balance_by_zone_add or \ref cs_surface_balance_add,
+ *        as computed by the last call to \ref cs_balance_by_zone_compute_all.
+ *
+ * \param[in]  id  id of the balance definition
+ *
+ * \return  pointer to balance terms (see \ref cs_balance_term_t),
+ *          of size CS_BALANCE_N_TERMS
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_real_t *
+cs_balance_by_zone_get_terms(int  id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free all balance definitions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -74,11 +74,16 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "cs_all_to_all.h"
 #include "cs_base.h"
 #include "cs_blas.h"
+#include "cs_block_dist.h"
+#include "cs_file.h"
+#include "cs_gradient.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
 #include "cs_log.h"
+#include "cs_math.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_quantities.h"
@@ -114,10 +119,80 @@ BEGIN_C_DECLS
  * Local Structure Definitions
  *============================================================================*/
 
+/* Function running a benchmarked operation once */
+
+typedef void
+(_benchmark_op_t) (void  *input);
+
+/* Benchmarked operation inputs */
+
+typedef struct {
+
+  const char          *name;        /* gradient name */
+  cs_gradient_type_t   type;        /* gradient type */
+  const cs_real_t     *bc_coeff_a;  /* boundary condition term a */
+  const cs_real_t     *bc_coeff_b;  /* boundary condition term b */
+  cs_real_t           *var;         /* base variable */
+  cs_real_3_t         *grad;        /* gradient */
+
+} _gradient_input_t;
+
+typedef struct {
+
+  int                  centered;    /* 0: upwind; 1: centered with
+                                       reconstruction */
+  const cs_real_t     *pvar;        /* base variable */
+  const cs_real_3_t   *grad;        /* base variable gradient */
+  const cs_real_t     *i_massflux;  /* interior face mass flux */
+  const cs_real_t     *i_visc;      /* interior face viscosity */
+  cs_real_t           *rhs;         /* right-hand side */
+
+} _conv_diff_input_t;
+
+typedef struct {
+
+  cs_halo_type_t       halo_type;   /* halo type */
+  int                  stride;      /* number of values per cell */
+  cs_real_t           *var;         /* synchronized variable */
+
+} _halo_input_t;
+
+typedef struct {
+
+  cs_lnum_t            n;           /* local number of values */
+  const cs_real_t     *x;           /* values */
+  double               test_sum;    /* sum of results */
+
+} _gdot_input_t;
+
+#if defined(HAVE_MPI)
+
+typedef struct {
+
+  cs_block_dist_info_t   bi;        /* cell block distribution */
+  cs_real_t             *val;       /* distributed cell values */
+
+} _all_to_all_input_t;
+
+#endif
+
+typedef struct {
+
+  const char            *name;      /* file name */
+  cs_file_mode_t         mode;      /* read or write mode */
+  cs_block_dist_info_t   bi;        /* block distribution */
+  cs_real_t             *val;       /* block values */
+
+} _file_input_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
 
+/* Machine-readable results file (rank 0 only) */
+
+static FILE  *_results_file = NULL;
+
 static const char *_matrix_operation_name[CS_MATRIX_N_FILL_TYPES][2]
   = {{"y <- A.x",
       "y <- (A-D).x"},
@@ -934,6 +1009,608 @@ _matrix_check_asmb(cs_lnum_t              n_rows,
   BFT_FREE(da);
 }
 
+/*----------------------------------------------------------------------------
+ * Return maximum elapsed time over all ranks.
+ *
+ * This is used so that all ranks run a collective operation the same
+ * number of times.
+ *
+ * parameters:
+ *   wt <-- local elapsed wall-clock time
+ *
+ * returns:
+ *   maximum elapsed wall-clock time
+ *----------------------------------------------------------------------------*/
+
+static double
+_elapsed_max(double  wt)
+{
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    double _wt = wt;
+    MPI_Allreduce(&_wt, &wt, 1, MPI_DOUBLE, MPI_MAX, cs_glob_mpi_comm);
+  }
+#endif
+
+  return wt;
+}
+
+/*----------------------------------------------------------------------------
+ * Time an operation, running it repeatedly until the minimum measure time
+ * is reached on all ranks.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single run)
+ *   op        <-- function running the operation once
+ *   input     <-> pointer to operation input
+ *   n_runs    --> number of runs
+ *
+ * returns:
+ *   wall-clock time for all runs
+ *----------------------------------------------------------------------------*/
+
+static double
+_time_operation(double               t_measure,
+                _benchmark_op_t     *op,
+                void                *input,
+                int                 *n_runs)
+{
+  int run_id = 0;
+  int _n_runs = (t_measure > 0) ? 8 : 1;
+
+  double wt0 = cs_timer_wtime(), wt1 = wt0;
+
+  while (run_id < _n_runs) {
+    while (run_id < _n_runs) {
+      op(input);
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (_elapsed_max(wt1 - wt0) < t_measure)
+      _n_runs *= 2;
+  }
+
+  *n_runs = _n_runs;
+
+  return wt1 - wt0;
+}
+
+/*----------------------------------------------------------------------------
+ * Log and record timing of a benchmarked operation.
+ *
+ * Wall-clock times per call are reduced over ranks, printed to the
+ * performance log, and written to the results file if open.
+ *
+ * parameters:
+ *   category <-- operation category
+ *   name     <-- operation name
+ *   n_g_elts <-- global number of elements (or bytes) handled per call
+ *   n_runs   <-- number of runs
+ *   wt       <-- wall-clock time for all runs
+ *----------------------------------------------------------------------------*/
+
+static void
+_record_timing(const char  *category,
+               const char  *name,
+               cs_gnum_t    n_g_elts,
+               int          n_runs,
+               double       wt)
+{
+  double t_loc = wt / CS_MAX(n_runs, 1);
+  double t_mean = t_loc, t_min = t_loc, t_max = t_loc;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Allreduce(&t_loc, &t_mean, 1, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+    MPI_Allreduce(&t_loc, &t_min, 1, MPI_DOUBLE, MPI_MIN, cs_glob_mpi_comm);
+    MPI_Allreduce(&t_loc, &t_max, 1, MPI_DOUBLE, MPI_MAX, cs_glob_mpi_comm);
+    t_mean /= cs_glob_n_ranks;
+  }
+#endif
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "  %-36s %8d %12.5e %12.5e %12.5e\n",
+                name, n_runs, t_mean, t_min, t_max);
+
+  if (_results_file != NULL) {
+    fprintf(_results_file, "%s,%s,%d,%d,%llu,%.6e,%.6e,%.6e\n",
+            category, name, cs_glob_n_ranks, n_runs,
+            (unsigned long long)n_g_elts, t_mean, t_min, t_max);
+    fflush(_results_file);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Print header for a benchmark category in the performance log.
+ *
+ * parameters:
+ *   title <-- category title
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_category_header(const char  *title)
+{
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "\n"
+                "%s\n\n"
+                "  %-36s %8s %12s %12s %12s\n",
+                title, "Operation", "Calls", "Mean", "Min", "Max");
+}
+
+/*----------------------------------------------------------------------------
+ * Single scalar gradient computation.
+ *
+ * parameters:
+ *   input <-> pointer to gradient benchmark input
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_op(void  *input)
+{
+  _gradient_input_t *gi = input;
+
+  cs_gradient_scalar(gi->name,
+                     gi->type,
+                     CS_HALO_STANDARD,
+                     1,      /* inc */
+                     false,  /* recompute_cocg */
+                     100,    /* n_r_sweeps */
+                     0,      /* tr_dim */
+                     0,      /* hyd_p_flag */
+                     1,      /* w_stride */
+                     0,      /* verbosity */
+                     CS_GRADIENT_LIMIT_NONE,
+                     1e-5,   /* epsilon */
+                     1.5,    /* clip_coeff */
+                     NULL,   /* f_ext */
+                     gi->bc_coeff_a,
+                     gi->bc_coeff_b,
+                     gi->var,
+                     NULL,   /* c_weight */
+                     NULL,   /* cpl */
+                     gi->grad);
+}
+
+/*----------------------------------------------------------------------------
+ * Interior face loop of scalar convection-diffusion terms.
+ *
+ * This reproduces the memory access pattern of the interior face loop of
+ * cs_convection_diffusion_scalar (upwind or centered convection with
+ * optional reconstruction, and diffusion), without dependency on
+ * field or setup options.
+ *
+ * parameters:
+ *   input <-> pointer to convection-diffusion benchmark input
+ *----------------------------------------------------------------------------*/
+
+static void
+_conv_diff_op(void  *input)
+{
+  _conv_diff_input_t *ci = input;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
+
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_3_t *restrict diipf = (const cs_real_3_t *restrict)fvq->diipf;
+  const cs_real_3_t *restrict djjpf = (const cs_real_3_t *restrict)fvq->djjpf;
+
+  const cs_real_t *restrict pvar = ci->pvar;
+  const cs_real_t *restrict i_massflux = ci->i_massflux;
+  const cs_real_t *restrict i_visc = ci->i_visc;
+  const cs_real_3_t *restrict grad = ci->grad;
+  cs_real_t *restrict rhs = ci->rhs;
+
+  const int centered = ci->centered;
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        cs_real_t pip = pvar[ii], pjp = pvar[jj];
+        cs_real_t pif, pjf;
+
+        if (centered) {
+          pip += cs_math_3_dot_product(diipf[face_id], grad[ii]);
+          pjp += cs_math_3_dot_product(djjpf[face_id], grad[jj]);
+          pif = weight[face_id]*pip + (1. - weight[face_id])*pjp;
+          pjf = pif;
+        }
+        else {
+          pif = pvar[ii];
+          pjf = pvar[jj];
+        }
+
+        cs_real_t flui = 0.5*(i_massflux[face_id] + fabs(i_massflux[face_id]));
+        cs_real_t fluj = 0.5*(i_massflux[face_id] - fabs(i_massflux[face_id]));
+
+        cs_real_t fluxi =   flui*(pif - pvar[ii]) + fluj*(pjf - pvar[ii])
+                          + i_visc[face_id]*(pip - pjp);
+        cs_real_t fluxj =   flui*(pif - pvar[jj]) + fluj*(pjf - pvar[jj])
+                          + i_visc[face_id]*(pip - pjp);
+
+        rhs[ii] -= fluxi;
+        rhs[jj] += fluxj;
+
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Single halo synchronization.
+ *
+ * parameters:
+ *   input <-> pointer to halo benchmark input
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_op(void  *input)
+{
+  _halo_input_t *hi = input;
+
+  if (hi->stride == 1)
+    cs_halo_sync_var(cs_glob_mesh->halo, hi->halo_type, hi->var);
+  else
+    cs_halo_sync_var_strided(cs_glob_mesh->halo, hi->halo_type,
+                             hi->var, hi->stride);
+}
+
+/*----------------------------------------------------------------------------
+ * Single global dot product.
+ *
+ * parameters:
+ *   input <-> pointer to dot product benchmark input
+ *----------------------------------------------------------------------------*/
+
+static void
+_gdot_op(void  *input)
+{
+  _gdot_input_t *di = input;
+
+  di->test_sum += cs_gdot(di->n, di->x, di->x);
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Block to partition distribution and return of cell values, as done
+ * for mesh and restart data reads.
+ *
+ * parameters:
+ *   input <-> pointer to all-to-all benchmark input
+ *----------------------------------------------------------------------------*/
+
+static void
+_all_to_all_op(void  *input)
+{
+  _all_to_all_input_t *ai = input;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  cs_all_to_all_t *d
+    = cs_all_to_all_create_from_block(m->n_cells,
+                                      CS_ALL_TO_ALL_USE_DEST_ID,
+                                      m->global_cell_num,
+                                      ai->bi,
+                                      cs_glob_mpi_comm);
+
+  cs_real_t *b_val = cs_all_to_all_copy_array(d,
+                                              CS_REAL_TYPE,
+                                              1,
+                                              false,
+                                              ai->val,
+                                              NULL);
+
+  cs_all_to_all_copy_array(d,
+                           CS_REAL_TYPE,
+                           1,
+                           true,  /* reverse */
+                           b_val,
+                           ai->val);
+
+  BFT_FREE(b_val);
+
+  cs_all_to_all_destroy(&d);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Single block write or read of a file.
+ *
+ * parameters:
+ *   input <-> pointer to file benchmark input
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_op(void  *input)
+{
+  _file_input_t *fi = input;
+
+  cs_file_t *f = cs_file_open_default(fi->name, fi->mode);
+
+  if (fi->mode == CS_FILE_MODE_WRITE)
+    cs_file_write_block(f,
+                        fi->val,
+                        sizeof(cs_real_t),
+                        1,
+                        fi->bi.gnum_range[0],
+                        fi->bi.gnum_range[1]);
+  else
+    cs_file_read_block(f,
+                       fi->val,
+                       sizeof(cs_real_t),
+                       1,
+                       fi->bi.gnum_range[0],
+                       fi->bi.gnum_range[1]);
+
+  f = cs_file_free(f);
+}
+
+/*----------------------------------------------------------------------------
+ * Run kernel benchmarks on the current mesh and partition.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single run)
+ *----------------------------------------------------------------------------*/
+
+static void
+_kernel_benchmarks(double  t_measure)
+{
+  int n_runs = 0;
+  double wt = 0;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  /* Base variable: linear function of coordinates */
+
+  cs_real_t *var = NULL, *bc_coeff_a = NULL, *bc_coeff_b = NULL;
+  cs_real_3_t *grad = NULL;
+
+  BFT_MALLOC(var, n_cells_ext, cs_real_t);
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  BFT_MALLOC(bc_coeff_a, n_b_faces, cs_real_t);
+  BFT_MALLOC(bc_coeff_b, n_b_faces, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+    var[i] = fvq->cell_cen[i*3] + 2.*fvq->cell_cen[i*3 + 1];
+
+  for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+    bc_coeff_a[i] = 0.;
+    bc_coeff_b[i] = 1.;
+  }
+
+  /* Gradients */
+
+  {
+    const cs_gradient_type_t g_type[] = {CS_GRADIENT_GREEN_ITER,
+                                         CS_GRADIENT_LSQ,
+                                         CS_GRADIENT_GREEN_LSQ,
+                                         CS_GRADIENT_GREEN_VTX};
+    const char *g_name[] = {"iterative",
+                            "least-squares",
+                            "Green-Gauss with LSQ gradient",
+                            "vertex-based"};
+
+    _log_category_header("Scalar gradients");
+
+    cs_gradient_initialize();
+
+    for (int i = 0; i < 4; i++) {
+      _gradient_input_t gi = {.name = g_name[i],
+                              .type = g_type[i],
+                              .bc_coeff_a = bc_coeff_a,
+                              .bc_coeff_b = bc_coeff_b,
+                              .var = var,
+                              .grad = grad};
+      _gradient_op(&gi); /* warm-up, builds geometric quantities */
+      wt = _time_operation(t_measure, _gradient_op, &gi, &n_runs);
+      _record_timing("gradient", g_name[i], m->n_g_cells, n_runs, wt);
+    }
+
+    /* Keep least-squares gradient for convection reconstruction */
+
+    _gradient_input_t gi = {.name = g_name[1],
+                            .type = g_type[1],
+                            .bc_coeff_a = bc_coeff_a,
+                            .bc_coeff_b = bc_coeff_b,
+                            .var = var,
+                            .grad = grad};
+    _gradient_op(&gi);
+
+    cs_gradient_finalize();
+  }
+
+  /* Convection-diffusion interior face loops */
+
+  {
+    cs_real_t *i_massflux = NULL, *i_visc = NULL, *rhs = NULL;
+
+    BFT_MALLOC(i_massflux, n_i_faces, cs_real_t);
+    BFT_MALLOC(i_visc, n_i_faces, cs_real_t);
+    BFT_MALLOC(rhs, n_cells_ext, cs_real_t);
+
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+      i_massflux[f_id] = fvq->i_face_normal[f_id*3];
+      i_visc[f_id] = fvq->i_face_surf[f_id] / fvq->i_dist[f_id];
+    }
+
+    for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+      rhs[i] = 0.;
+
+    _log_category_header("Convection-diffusion interior face loops");
+
+    const char *c_name[] = {"upwind", "centered, reconstructed"};
+
+    for (int i = 0; i < 2; i++) {
+      _conv_diff_input_t ci = {.centered = i,
+                               .pvar = var,
+                               .grad = (const cs_real_3_t *)grad,
+                               .i_massflux = i_massflux,
+                               .i_visc = i_visc,
+                               .rhs = rhs};
+      wt = _time_operation(t_measure, _conv_diff_op, &ci, &n_runs);
+      _record_timing("convection_diffusion", c_name[i], m->n_g_i_faces,
+                     n_runs, wt);
+    }
+
+    BFT_FREE(rhs);
+    BFT_FREE(i_visc);
+    BFT_FREE(i_massflux);
+  }
+
+  /* Halo synchronizations */
+
+  if (m->halo != NULL) {
+
+    const int stride[] = {1, 3, 6, 9};
+    int n_halo_types = (m->halo_type == CS_HALO_EXTENDED) ? 2 : 1;
+
+    cs_real_t *h_var = NULL;
+    BFT_MALLOC(h_var, n_cells_ext*9, cs_real_t);
+
+    for (cs_lnum_t i = 0; i < n_cells_ext*9; i++)
+      h_var[i] = i%9;
+
+    _log_category_header("Halo synchronization");
+
+    for (int h_type = 0; h_type < n_halo_types; h_type++) {
+      for (int i = 0; i < 4; i++) {
+        char name[64];
+        snprintf(name, 63, "%s, stride %d",
+                 (h_type == CS_HALO_STANDARD) ? "standard" : "extended",
+                 stride[i]);
+        name[63] = '\0';
+        _halo_input_t hi = {.halo_type = h_type,
+                            .stride = stride[i],
+                            .var = h_var};
+        wt = _time_operation(t_measure, _halo_op, &hi, &n_runs);
+        _record_timing("halo", name, m->n_g_cells, n_runs, wt);
+      }
+    }
+
+    BFT_FREE(h_var);
+  }
+
+  /* Global dot products (latency and bandwidth) */
+
+  {
+    _log_category_header("Global dot products");
+
+    _gdot_input_t di = {.n = CS_MIN(n_cells, 1), .x = var, .test_sum = 0};
+    wt = _time_operation(t_measure, _gdot_op, &di, &n_runs);
+    _record_timing("gdot", "latency (1 value per rank)",
+                   cs_glob_n_ranks, n_runs, wt);
+
+    di.n = n_cells;
+    wt = _time_operation(t_measure, _gdot_op, &di, &n_runs);
+    _record_timing("gdot", "cell values", m->n_g_cells, n_runs, wt);
+  }
+
+  /* All-to-all distribution variants */
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    const cs_all_to_all_type_t a_type[] = {CS_ALL_TO_ALL_MPI_DEFAULT,
+                                           CS_ALL_TO_ALL_HYBRID,
+                                           CS_ALL_TO_ALL_CRYSTAL_ROUTER};
+    const char *a_name[] = {"MPI_Alltoall(v)",
+                            "hybrid",
+                            "crystal router"};
+
+    cs_all_to_all_type_t a_type_prev = cs_all_to_all_get_type();
+
+    _all_to_all_input_t ai;
+    ai.val = var;
+    ai.bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                        cs_glob_n_ranks,
+                                        1,
+                                        0,
+                                        m->n_g_cells);
+
+    _log_category_header("All-to-all block to partition distribution");
+
+    for (int i = 0; i < 3; i++) {
+      cs_all_to_all_set_type(a_type[i]);
+      wt = _time_operation(t_measure, _all_to_all_op, &ai, &n_runs);
+      _record_timing("all_to_all", a_name[i], m->n_g_cells, n_runs, wt);
+    }
+
+    cs_all_to_all_set_type(a_type_prev);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* File block write and read bandwidth */
+
+  {
+    const char name[] = "benchmark_io.tmp";
+
+    int rank_step = 1;
+#if defined(HAVE_MPI)
+    cs_file_get_default_comm(&rank_step, NULL, NULL);
+#endif
+
+    _file_input_t fi;
+    fi.name = name;
+    fi.bi = cs_block_dist_compute_sizes(CS_MAX(cs_glob_rank_id, 0),
+                                        cs_glob_n_ranks,
+                                        rank_step,
+                                        0,
+                                        m->n_g_cells);
+
+    cs_lnum_t n_b_vals = fi.bi.gnum_range[1] - fi.bi.gnum_range[0];
+    BFT_MALLOC(fi.val, n_b_vals, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_b_vals; i++)
+      fi.val[i] = fi.bi.gnum_range[0] + i;
+
+    cs_gnum_t n_g_bytes = m->n_g_cells * sizeof(cs_real_t);
+
+    _log_category_header("File block access");
+
+    fi.mode = CS_FILE_MODE_WRITE;
+    wt = _time_operation(t_measure, _file_op, &fi, &n_runs);
+    _record_timing("file", "block write", n_g_bytes, n_runs, wt);
+
+    fi.mode = CS_FILE_MODE_READ;
+    wt = _time_operation(t_measure, _file_op, &fi, &n_runs);
+    _record_timing("file", "block read", n_g_bytes, n_runs, wt);
+
+    BFT_FREE(fi.val);
+
+    if (cs_glob_rank_id < 1)
+      cs_file_remove(name);
+  }
+
+  cs_log_printf_flush(CS_LOG_PERFORMANCE);
+
+  BFT_FREE(bc_coeff_b);
+  BFT_FREE(bc_coeff_a);
+  BFT_FREE(grad);
+  BFT_FREE(var);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -988,6 +1665,16 @@ cs_benchmark(int  mpi_trace_mode)
                 "Benchmark mode activated\n"
                 "========================\n");
 
+  /* Open machine-readable results file */
+
+  if (cs_glob_rank_id < 1) {
+    _results_file = fopen("benchmark_results.csv", "w");
+    if (_results_file != NULL)
+      fprintf(_results_file,
+              "category,operation,n_ranks,calls,n_g_elts,"
+              "t_mean,t_min,t_max\n");
+  }
+
   /* Run some feature tests */
   /*------------------------*/
 
@@ -1069,6 +1756,20 @@ cs_benchmark(int  mpi_trace_mode)
                           x,
                           y);
 
+  /* Other kernels on the current mesh and partition */
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "\n"
+                "Timing for other kernels (wall-clock time per call)\n"
+                "===================================================\n");
+
+  _kernel_benchmarks(t_measure);
+
+  if (_results_file != NULL) {
+    fclose(_results_file);
+    _results_file = NULL;
+  }
+
   cs_matrix_finalize();
 
   cs_mesh_adjacencies_finalize();
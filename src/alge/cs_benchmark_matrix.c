@@ -483,6 +483,22 @@ _variant_build_list(int                             n_fill_types,
 
   }
 
+  if (type_filter[CS_MATRIX_SELL]) {
+
+    _variant_add("SELL",
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 2, /* ed_flag */
+                 "standard",
+                 "standard",
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_timing_variant_t);
 }
@@ -1423,6 +1439,7 @@ cs_benchmark_matrix(double                 t_measure,
   int  t_id, f_id, v_id, ed_flag;
 
   bool                   type_filter[CS_MATRIX_N_BUILTIN_TYPES] = {true,
+                                                                   true,
                                                                    true,
                                                                    true,
                                                                    true};
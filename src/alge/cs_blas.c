@@ -39,6 +39,7 @@
 
 #include "cs_base.h"
 #include "cs_parall.h"
+#include "cs_repro_sum.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -69,6 +70,14 @@ BEGIN_C_DECLS
   \var CS_BLAS_REDUCE_KAHAN
        Reduction based on Kahan's compensated summation, described in
        \cite Kahan:1965
+
+  \var CS_BLAS_REDUCE_REPRODUCIBLE
+       Exact reduction using fixed-point accumulators (see
+       \ref cs_repro_sum.c), so that results of global reductions
+       (\ref cs_gdot, \ref cs_gres, and \ref cs_parall_sum of double
+       precision values) do not depend on the number of threads or
+       MPI ranks. Local dot products are also independent of the
+       number of threads.
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -1207,6 +1216,198 @@ _cs_gres_kahan(cs_lnum_t         n,
   return dot;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the dot product of 2 vectors: x.y
+ *        using exact (reproducible) summation.
+ *
+ * \param[in]  n  size of arrays x and y
+ * \param[in]  x  array of floating-point values
+ * \param[in]  y  array of floating-point values
+ *
+ * \return  dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_dot_repro(cs_lnum_t         n,
+              const cs_real_t  *x,
+              const cs_real_t  *y)
+{
+  cs_repro_sum_t s;
+  cs_repro_sum_init(&s);
+
+  cs_repro_sum_add_dot(&s, n, x, y);
+
+  return cs_repro_sum_value(&s);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the dot product of 2 vectors: x.x
+ *        using exact (reproducible) summation.
+ *
+ * \param[in]  n  size of arrays x and y
+ * \param[in]  x  array of floating-point values
+ *
+ * \return  dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_dot_xx_repro(cs_lnum_t         n,
+                 const cs_real_t  *x)
+{
+  return _cs_dot_repro(n, x, x);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 2 dot products of 2 vectors: x.x, and x.y
+ *        using exact (reproducible) summation.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[out]  xx  x.x dot product
+ * \param[out]  xy  x.y dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xx_xy_repro(cs_lnum_t                    n,
+                    const cs_real_t  *restrict   x,
+                    const cs_real_t  *restrict   y,
+                    double                      *xx,
+                    double                      *xy)
+{
+  *xx = _cs_dot_repro(n, x, x);
+  *xy = _cs_dot_repro(n, x, y);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 2 dot products of 3 vectors: x.y, and y.z
+ *        using exact (reproducible) summation.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xy  x.y dot product
+ * \param[out]  yz  y.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xy_yz_repro(cs_lnum_t                    n,
+                    const cs_real_t  *restrict   x,
+                    const cs_real_t  *restrict   y,
+                    const cs_real_t  *restrict   z,
+                    double                      *xy,
+                    double                      *yz)
+{
+  *xy = _cs_dot_repro(n, x, y);
+  *yz = _cs_dot_repro(n, y, z);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 3 dot products of 3 vectors: x.x, x.y, and y.z
+ *        using exact (reproducible) summation.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xx  x.x dot product
+ * \param[out]  xy  x.y dot product
+ * \param[out]  yz  y.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xx_xy_yz_repro(cs_lnum_t                    n,
+                       const cs_real_t  *restrict   x,
+                       const cs_real_t  *restrict   y,
+                       const cs_real_t  *restrict   z,
+                       double                      *xx,
+                       double                      *xy,
+                       double                      *yz)
+{
+  *xx = _cs_dot_repro(n, x, x);
+  *xy = _cs_dot_repro(n, x, y);
+  *yz = _cs_dot_repro(n, y, z);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 5 dot products of 3 vectors: x.x, y.y, x.y, x.z, and y.z
+ *        using exact (reproducible) summation.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xx  x.x dot product
+ * \param[out]  yy  y.y dot product
+ * \param[out]  xy  x.y dot product
+ * \param[out]  xz  x.z dot product
+ * \param[out]  yz  y.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xx_yy_xy_xz_yz_repro(cs_lnum_t                    n,
+                             const cs_real_t  *restrict   x,
+                             const cs_real_t  *restrict   y,
+                             const cs_real_t  *restrict   z,
+                             double                      *xx,
+                             double                      *yy,
+                             double                      *xy,
+                             double                      *xz,
+                             double                      *yz)
+{
+  *xx = _cs_dot_repro(n, x, x);
+  *yy = _cs_dot_repro(n, y, y);
+  *xy = _cs_dot_repro(n, x, y);
+  *xz = _cs_dot_repro(n, x, z);
+  *yz = _cs_dot_repro(n, y, z);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the global residual of 2 extensive vectors:
+ *        1/sum(vol) . sum(X.Y.vol)
+ *        using exact (reproducible) summation.
+ *
+ * \param[in]  n    size of arrays x and y
+ * \param[in]  vol  array of floating-point values
+ * \param[in]  x    array of floating-point values
+ * \param[in]  y    array of floating-point values
+ *
+ * \return  global residual
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_gres_repro(cs_lnum_t         n,
+               const cs_real_t  *vol,
+               const cs_real_t  *x,
+               const cs_real_t  *y)
+{
+  cs_repro_sum_t s[2];
+  cs_repro_sum_init(s);
+  cs_repro_sum_init(s + 1);
+
+  cs_repro_sum_add_wdot(s, n, vol, x, y);
+  cs_repro_sum_add_array(s + 1, n, vol);
+
+  cs_repro_sum_parall_merge(2, s);
+
+  return cs_repro_sum_value(s) / cs_repro_sum_value(s + 1);
+}
+
 /*============================================================================
  * Static global function pointers
  *============================================================================*/
@@ -1222,6 +1423,8 @@ static cs_dot_xx_yy_xy_xz_yz_t  *_cs_glob_dot_xx_yy_xy_xz_yz
 
 static cs_gres_t      *_cs_glob_gres      = _cs_gres_superblock;
 
+static cs_blas_reduce_t  _cs_glob_reduce_mode = CS_BLAS_REDUCE_SUPERBLOCK;
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -1240,6 +1443,10 @@ static cs_gres_t      *_cs_glob_gres      = _cs_gres_superblock;
 void
 cs_blas_set_reduce_algorithm(cs_blas_reduce_t  mode)
 {
+  _cs_glob_reduce_mode = mode;
+
+  cs_repro_sum_set_active(mode == CS_BLAS_REDUCE_REPRODUCIBLE);
+
   switch(mode) {
     case CS_BLAS_REDUCE_SUPERBLOCK:
       {
@@ -1263,6 +1470,17 @@ cs_blas_set_reduce_algorithm(cs_blas_reduce_t  mode)
         _cs_glob_gres = _cs_gres_kahan;
       }
       break;
+    case CS_BLAS_REDUCE_REPRODUCIBLE:
+      {
+        _cs_glob_dot    = _cs_dot_repro;
+        _cs_glob_dot_xx = _cs_dot_xx_repro;
+        _cs_glob_dot_xx_xy = _cs_dot_xx_xy_repro;
+        _cs_glob_dot_xy_yz = _cs_dot_xy_yz_repro;
+        _cs_glob_dot_xx_xy_yz = _cs_dot_xx_xy_yz_repro;
+        _cs_glob_dot_xx_yy_xy_xz_yz = _cs_dot_xx_yy_xy_xz_yz_repro;
+        _cs_glob_gres = _cs_gres_repro;
+      }
+      break;
   }
 }
 
@@ -1630,7 +1848,9 @@ cs_dot_xx_yy_xy_xz_yz(cs_lnum_t                    n,
  * In parallel mode, the local results are summed on the default
  * global communicator.
  *
- * For better precision, a superblock algorithm is used.
+ * For better precision, a superblock algorithm is used, unless the
+ * reproducible reduction algorithm is selected, in which case the
+ * result does not depend on the number of threads or ranks.
  *
  * \param[in]  n  size of arrays x and y
  * \param[in]  x  array of floating-point values
@@ -1645,6 +1865,14 @@ cs_gdot(cs_lnum_t         n,
         const cs_real_t  *x,
         const cs_real_t  *y)
 {
+  if (_cs_glob_reduce_mode == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    cs_repro_sum_t s;
+    cs_repro_sum_init(&s);
+    cs_repro_sum_add_dot(&s, n, x, y);
+    cs_repro_sum_parall_merge(1, &s);
+    return cs_repro_sum_value(&s);
+  }
+
   double retval = cs_dot(n, x, y);
 
   cs_parall_sum(1, CS_DOUBLE, &retval);
@@ -56,7 +56,8 @@ BEGIN_C_DECLS
 typedef enum {
 
   CS_BLAS_REDUCE_SUPERBLOCK,
-  CS_BLAS_REDUCE_KAHAN
+  CS_BLAS_REDUCE_KAHAN,
+  CS_BLAS_REDUCE_REPRODUCIBLE
 
 } cs_blas_reduce_t;
 
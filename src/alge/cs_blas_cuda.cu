@@ -0,0 +1,582 @@
+/*============================================================================
+ * BLAS (Basic Linear Algebra Subroutine) functions using CUDA
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_base.h"
+#include "cs_base_cuda.h"
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_blas_cuda.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Block size must be a power of 2 for reductions */
+
+#define CS_BLAS_CUDA_BLOCK_SIZE 256
+
+/* Maximum number of blocks used for reductions */
+
+#define CS_BLAS_CUDA_MAX_GRID_SIZE 1024
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+/* Device buffers for reductions (per block partial sums, and results) */
+
+static double  *_r_grid = NULL;
+static double  *_r_res = NULL;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return grid size for a given number of elements.
+ *
+ * parameters:
+ *   n        <-- number of elements
+ *   max_size <-- maximum grid size, or 0 for no limit
+ *
+ * returns:
+ *   number of blocks
+ *----------------------------------------------------------------------------*/
+
+static inline unsigned int
+_grid_size(cs_lnum_t     n,
+           unsigned int  max_size)
+{
+  unsigned int n_blocks
+    = (n % CS_BLAS_CUDA_BLOCK_SIZE) ?
+        n/CS_BLAS_CUDA_BLOCK_SIZE + 1 : n/CS_BLAS_CUDA_BLOCK_SIZE;
+
+  if (n_blocks < 1)
+    n_blocks = 1;
+  if (max_size > 0 && n_blocks > max_size)
+    n_blocks = max_size;
+
+  return n_blocks;
+}
+
+/*----------------------------------------------------------------------------
+ * Ensure reduction buffers are allocated.
+ *----------------------------------------------------------------------------*/
+
+static void
+_ensure_reduction_buffers(void)
+{
+  if (_r_grid == NULL) {
+    CS_CUDA_CHECK(cudaMalloc((void **)&_r_grid,
+                             CS_BLAS_CUDA_MAX_GRID_SIZE*2*sizeof(double)));
+    CS_CUDA_CHECK(cudaMalloc((void **)&_r_res, 2*sizeof(double)));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Sum values in shared memory for a block, leaving the result at index 0.
+ *
+ * parameters:
+ *   stmp <-> shared values (size: blockDim.x)
+ *----------------------------------------------------------------------------*/
+
+__device__ static void
+_block_reduce_sum(double  *stmp)
+{
+  unsigned int tid = threadIdx.x;
+
+  __syncthreads();
+
+  for (unsigned int j = blockDim.x/2; j > 0; j >>= 1) {
+    if (tid < j)
+      stmp[tid] += stmp[tid + j];
+    __syncthreads();
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Kernel for y <-- ax + y.
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_axpy_kernel(cs_lnum_t                    n,
+             double                       a,
+             const cs_real_t  *restrict   x,
+             cs_real_t        *restrict   y)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n)
+    y[ii] += a*x[ii];
+}
+
+/*----------------------------------------------------------------------------
+ * Kernel for y <-- ax + by.
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_axpby_kernel(cs_lnum_t                    n,
+              double                       a,
+              const cs_real_t  *restrict   x,
+              double                       b,
+              cs_real_t        *restrict   y)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n)
+    y[ii] = a*x[ii] + b*y[ii];
+}
+
+/*----------------------------------------------------------------------------
+ * First stage kernel for x.y: partial sum for each block.
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_dot_xy_stage_1(cs_lnum_t                    n,
+                const cs_real_t  *restrict   x,
+                const cs_real_t  *restrict   y,
+                double           *restrict   b_res)
+{
+  __shared__ double stmp[CS_BLAS_CUDA_BLOCK_SIZE];
+
+  unsigned int tid = threadIdx.x;
+
+  double s = 0.;
+  for (cs_lnum_t ii = blockIdx.x*blockDim.x + tid;
+       ii < n;
+       ii += blockDim.x*gridDim.x)
+    s += x[ii]*y[ii];
+
+  stmp[tid] = s;
+  _block_reduce_sum(stmp);
+
+  if (tid == 0)
+    b_res[blockIdx.x] = stmp[0];
+}
+
+/*----------------------------------------------------------------------------
+ * First stage kernel for x.x and x.y: partial sums for each block.
+ *
+ * Partial sums of x.x are stored first, followed by those of x.y.
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_dot_xx_xy_stage_1(cs_lnum_t                    n,
+                   const cs_real_t  *restrict   x,
+                   const cs_real_t  *restrict   y,
+                   double           *restrict   b_res)
+{
+  __shared__ double stmp_0[CS_BLAS_CUDA_BLOCK_SIZE];
+  __shared__ double stmp_1[CS_BLAS_CUDA_BLOCK_SIZE];
+
+  unsigned int tid = threadIdx.x;
+
+  double s0 = 0., s1 = 0.;
+  for (cs_lnum_t ii = blockIdx.x*blockDim.x + tid;
+       ii < n;
+       ii += blockDim.x*gridDim.x) {
+    s0 += x[ii]*x[ii];
+    s1 += x[ii]*y[ii];
+  }
+
+  stmp_0[tid] = s0;
+  stmp_1[tid] = s1;
+  _block_reduce_sum(stmp_0);
+  _block_reduce_sum(stmp_1);
+
+  if (tid == 0) {
+    b_res[blockIdx.x] = stmp_0[0];
+    b_res[gridDim.x + blockIdx.x] = stmp_1[0];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * First stage kernel for x.y and y.z: partial sums for each block.
+ *
+ * Partial sums of x.y are stored first, followed by those of y.z.
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_dot_xy_yz_stage_1(cs_lnum_t                    n,
+                   const cs_real_t  *restrict   x,
+                   const cs_real_t  *restrict   y,
+                   const cs_real_t  *restrict   z,
+                   double           *restrict   b_res)
+{
+  __shared__ double stmp_0[CS_BLAS_CUDA_BLOCK_SIZE];
+  __shared__ double stmp_1[CS_BLAS_CUDA_BLOCK_SIZE];
+
+  unsigned int tid = threadIdx.x;
+
+  double s0 = 0., s1 = 0.;
+  for (cs_lnum_t ii = blockIdx.x*blockDim.x + tid;
+       ii < n;
+       ii += blockDim.x*gridDim.x) {
+    s0 += x[ii]*y[ii];
+    s1 += y[ii]*z[ii];
+  }
+
+  stmp_0[tid] = s0;
+  stmp_1[tid] = s1;
+  _block_reduce_sum(stmp_0);
+  _block_reduce_sum(stmp_1);
+
+  if (tid == 0) {
+    b_res[blockIdx.x] = stmp_0[0];
+    b_res[gridDim.x + blockIdx.x] = stmp_1[0];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * First stage kernel for x.y.vol and vol: partial sums for each block.
+ *
+ * Partial sums of x.y.vol are stored first, followed by those of vol.
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_gres_stage_1(cs_lnum_t                    n,
+              const cs_real_t  *restrict   vol,
+              const cs_real_t  *restrict   x,
+              const cs_real_t  *restrict   y,
+              double           *restrict   b_res)
+{
+  __shared__ double stmp_0[CS_BLAS_CUDA_BLOCK_SIZE];
+  __shared__ double stmp_1[CS_BLAS_CUDA_BLOCK_SIZE];
+
+  unsigned int tid = threadIdx.x;
+
+  double s0 = 0., s1 = 0.;
+  for (cs_lnum_t ii = blockIdx.x*blockDim.x + tid;
+       ii < n;
+       ii += blockDim.x*gridDim.x) {
+    s0 += x[ii]*y[ii]*vol[ii];
+    s1 += vol[ii];
+  }
+
+  stmp_0[tid] = s0;
+  stmp_1[tid] = s1;
+  _block_reduce_sum(stmp_0);
+  _block_reduce_sum(stmp_1);
+
+  if (tid == 0) {
+    b_res[blockIdx.x] = stmp_0[0];
+    b_res[gridDim.x + blockIdx.x] = stmp_1[0];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Second stage kernel for reductions: sum partial block results.
+ *
+ * This kernel is run on a single block, once for each reduced value.
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_reduce_stage_2(unsigned int                 n_blocks,
+                const double     *restrict   b_res,
+                double           *restrict   res)
+{
+  __shared__ double stmp[CS_BLAS_CUDA_BLOCK_SIZE];
+
+  unsigned int tid = threadIdx.x;
+  const double *_b_res = b_res + blockIdx.x*n_blocks;
+
+  double s = 0.;
+  for (unsigned int i = tid; i < n_blocks; i += blockDim.x)
+    s += _b_res[i];
+
+  stmp[tid] = s;
+  _block_reduce_sum(stmp);
+
+  if (tid == 0)
+    res[blockIdx.x] = stmp[0];
+}
+
+/*----------------------------------------------------------------------------
+ * Complete a reduction started by a first stage kernel, and copy results
+ * to the host.
+ *
+ * parameters:
+ *   n_blocks <-- number of blocks used by first stage
+ *   n_vals   <-- number of reduced values
+ *   res      --> reduced values (on host)
+ *----------------------------------------------------------------------------*/
+
+static void
+_reduce_finalize(unsigned int   n_blocks,
+                 unsigned int   n_vals,
+                 double         res[])
+{
+  _reduce_stage_2<<<n_vals, CS_BLAS_CUDA_BLOCK_SIZE>>>(n_blocks,
+                                                       _r_grid,
+                                                       _r_res);
+
+  CS_CUDA_CHECK(cudaMemcpy(res, _r_res, n_vals*sizeof(double),
+                           cudaMemcpyDeviceToHost));
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Free device reduction buffers used by CUDA BLAS functions.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_cuda_finalize(void)
+{
+  if (_r_grid != NULL) {
+    CS_CUDA_CHECK(cudaFree(_r_grid));
+    CS_CUDA_CHECK(cudaFree(_r_res));
+    _r_grid = NULL;
+    _r_res = NULL;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Constant times a vector plus a vector: y <-- ax + y
+ *
+ * parameters:
+ *   n <-- size of arrays x and y
+ *   a <-- multiplier for x
+ *   x <-- array of floating-point values (on device)
+ *   y <-> array of floating-point values (on device)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_cuda_axpy(cs_lnum_t           n,
+                  double              a,
+                  const cs_real_t    *x,
+                  cs_real_t          *y)
+{
+  if (n < 1)
+    return;
+
+  _axpy_kernel<<<_grid_size(n, 0), CS_BLAS_CUDA_BLOCK_SIZE>>>(n, a, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Linear combination of 2 vectors: y <-- ax + by
+ *
+ * parameters:
+ *   n <-- size of arrays x and y
+ *   a <-- multiplier for x
+ *   x <-- array of floating-point values (on device)
+ *   b <-- multiplier for y
+ *   y <-> array of floating-point values (on device)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_cuda_axpby(cs_lnum_t           n,
+                   double              a,
+                   const cs_real_t    *x,
+                   double              b,
+                   cs_real_t          *y)
+{
+  if (n < 1)
+    return;
+
+  _axpby_kernel<<<_grid_size(n, 0), CS_BLAS_CUDA_BLOCK_SIZE>>>(n, a, x, b, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the dot product of 2 vectors: x.y
+ *
+ * parameters:
+ *   n <-- size of arrays x and y
+ *   x <-- array of floating-point values (on device)
+ *   y <-- array of floating-point values (on device)
+ *
+ * returns:
+ *   dot product
+ *----------------------------------------------------------------------------*/
+
+double
+cs_blas_cuda_dot(cs_lnum_t          n,
+                 const cs_real_t   *x,
+                 const cs_real_t   *y)
+{
+  double s = 0.;
+
+  if (n < 1)
+    return s;
+
+  _ensure_reduction_buffers();
+
+  unsigned int n_blocks = _grid_size(n, CS_BLAS_CUDA_MAX_GRID_SIZE);
+
+  _dot_xy_stage_1<<<n_blocks, CS_BLAS_CUDA_BLOCK_SIZE>>>(n, x, y, _r_grid);
+  _reduce_finalize(n_blocks, 1, &s);
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the double dot product of 2 vectors: x.x, and x.y
+ *
+ * parameters:
+ *   n  <-- size of arrays x and y
+ *   x  <-- array of floating-point values (on device)
+ *   y  <-- array of floating-point values (on device)
+ *   xx --> x.x dot product
+ *   xy --> x.y dot product
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_cuda_dot_xx_xy(cs_lnum_t          n,
+                       const cs_real_t   *x,
+                       const cs_real_t   *y,
+                       double            *xx,
+                       double            *xy)
+{
+  double s[2] = {0., 0.};
+
+  if (n > 0) {
+
+    _ensure_reduction_buffers();
+
+    unsigned int n_blocks = _grid_size(n, CS_BLAS_CUDA_MAX_GRID_SIZE);
+
+    _dot_xx_xy_stage_1<<<n_blocks, CS_BLAS_CUDA_BLOCK_SIZE>>>(n, x, y,
+                                                              _r_grid);
+    _reduce_finalize(n_blocks, 2, s);
+
+  }
+
+  *xx = s[0];
+  *xy = s[1];
+}
+
+/*----------------------------------------------------------------------------
+ * Return the double dot product of 3 vectors: x.y, and y.z
+ *
+ * parameters:
+ *   n  <-- size of arrays x, y, and z
+ *   x  <-- array of floating-point values (on device)
+ *   y  <-- array of floating-point values (on device)
+ *   z  <-- array of floating-point values (on device)
+ *   xy --> x.y dot product
+ *   yz --> y.z dot product
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_cuda_dot_xy_yz(cs_lnum_t          n,
+                       const cs_real_t   *x,
+                       const cs_real_t   *y,
+                       const cs_real_t   *z,
+                       double            *xy,
+                       double            *yz)
+{
+  double s[2] = {0., 0.};
+
+  if (n > 0) {
+
+    _ensure_reduction_buffers();
+
+    unsigned int n_blocks = _grid_size(n, CS_BLAS_CUDA_MAX_GRID_SIZE);
+
+    _dot_xy_yz_stage_1<<<n_blocks, CS_BLAS_CUDA_BLOCK_SIZE>>>(n, x, y, z,
+                                                              _r_grid);
+    _reduce_finalize(n_blocks, 2, s);
+
+  }
+
+  *xy = s[0];
+  *yz = s[1];
+}
+
+/*----------------------------------------------------------------------------
+ * Return the global residual of 2 extensive vectors:
+ *  1/sum(vol) . sum(X.Y.vol)
+ *
+ * In parallel mode, the local results are summed on the default
+ * global communicator.
+ *
+ * parameters:
+ *   n   <-- size of arrays x and y
+ *   vol <-- array of floating-point values (on device)
+ *   x   <-- array of floating-point values (on device)
+ *   y   <-- array of floating-point values (on device)
+ *
+ * returns:
+ *   global residual
+ *----------------------------------------------------------------------------*/
+
+double
+cs_blas_cuda_gres(cs_lnum_t          n,
+                  const cs_real_t   *vol,
+                  const cs_real_t   *x,
+                  const cs_real_t   *y)
+{
+  double s[2] = {0., 0.};
+
+  if (n > 0) {
+
+    _ensure_reduction_buffers();
+
+    unsigned int n_blocks = _grid_size(n, CS_BLAS_CUDA_MAX_GRID_SIZE);
+
+    _gres_stage_1<<<n_blocks, CS_BLAS_CUDA_BLOCK_SIZE>>>(n, vol, x, y,
+                                                         _r_grid);
+    _reduce_finalize(n_blocks, 2, s);
+
+  }
+
+  cs_parall_sum(2, CS_DOUBLE, s);
+
+  return s[0] / s[1];
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,182 @@
+#ifndef __CS_BLAS_CUDA_H__
+#define __CS_BLAS_CUDA_H__
+
+/*============================================================================
+ * BLAS (Basic Linear Algebra Subroutine) functions using CUDA
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*
+ * All array arguments of the following functions are assumed to be
+ * in device memory; results of reductions are returned on the host.
+ */
+
+/*----------------------------------------------------------------------------
+ * Free device reduction buffers used by CUDA BLAS functions.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_cuda_finalize(void);
+
+/*----------------------------------------------------------------------------
+ * Constant times a vector plus a vector: y <-- ax + y
+ *
+ * parameters:
+ *   n <-- size of arrays x and y
+ *   a <-- multiplier for x
+ *   x <-- array of floating-point values (on device)
+ *   y <-> array of floating-point values (on device)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_cuda_axpy(cs_lnum_t           n,
+                  double              a,
+                  const cs_real_t    *x,
+                  cs_real_t          *y);
+
+/*----------------------------------------------------------------------------
+ * Linear combination of 2 vectors: y <-- ax + by
+ *
+ * parameters:
+ *   n <-- size of arrays x and y
+ *   a <-- multiplier for x
+ *   x <-- array of floating-point values (on device)
+ *   b <-- multiplier for y
+ *   y <-> array of floating-point values (on device)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_cuda_axpby(cs_lnum_t           n,
+                   double              a,
+                   const cs_real_t    *x,
+                   double              b,
+                   cs_real_t          *y);
+
+/*----------------------------------------------------------------------------
+ * Return the dot product of 2 vectors: x.y
+ *
+ * parameters:
+ *   n <-- size of arrays x and y
+ *   x <-- array of floating-point values (on device)
+ *   y <-- array of floating-point values (on device)
+ *
+ * returns:
+ *   dot product
+ *----------------------------------------------------------------------------*/
+
+double
+cs_blas_cuda_dot(cs_lnum_t          n,
+                 const cs_real_t   *x,
+                 const cs_real_t   *y);
+
+/*----------------------------------------------------------------------------
+ * Return the double dot product of 2 vectors: x.x, and x.y
+ *
+ * parameters:
+ *   n  <-- size of arrays x and y
+ *   x  <-- array of floating-point values (on device)
+ *   y  <-- array of floating-point values (on device)
+ *   xx --> x.x dot product
+ *   xy --> x.y dot product
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_cuda_dot_xx_xy(cs_lnum_t          n,
+                       const cs_real_t   *x,
+                       const cs_real_t   *y,
+                       double            *xx,
+                       double            *xy);
+
+/*----------------------------------------------------------------------------
+ * Return the double dot product of 3 vectors: x.y, and y.z
+ *
+ * parameters:
+ *   n  <-- size of arrays x, y, and z
+ *   x  <-- array of floating-point values (on device)
+ *   y  <-- array of floating-point values (on device)
+ *   z  <-- array of floating-point values (on device)
+ *   xy --> x.y dot product
+ *   yz --> y.z dot product
+ *----------------------------------------------------------------------------*/
+
+void
+cs_blas_cuda_dot_xy_yz(cs_lnum_t          n,
+                       const cs_real_t   *x,
+                       const cs_real_t   *y,
+                       const cs_real_t   *z,
+                       double            *xy,
+                       double            *yz);
+
+/*----------------------------------------------------------------------------
+ * Return the global residual of 2 extensive vectors:
+ *  1/sum(vol) . sum(X.Y.vol)
+ *
+ * In parallel mode, the local results are summed on the default
+ * global communicator.
+ *
+ * parameters:
+ *   n   <-- size of arrays x and y
+ *   vol <-- array of floating-point values (on device)
+ *   x   <-- array of floating-point values (on device)
+ *   y   <-- array of floating-point values (on device)
+ *
+ * returns:
+ *   global residual
+ *----------------------------------------------------------------------------*/
+
+double
+cs_blas_cuda_gres(cs_lnum_t          n,
+                  const cs_real_t   *vol,
+                  const cs_real_t   *x,
+                  const cs_real_t   *y);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_BLAS_CUDA_H__ */
@@ -106,6 +106,17 @@ typedef  cs_real_t  cs_weight_t;  /* will allow testing single precision
 bool          _set[3] = {false, false, false};
 cs_weight_t  *_weights[3][2] = {{NULL, NULL}, {NULL, NULL}, {NULL, NULL}};
 
+/* Linear regression operator, stored in vertex -> cells and
+   vertex -> boundary faces (CSR) form, so that it may be applied to
+   any field with a gather loop */
+
+static cs_lnum_t    *_lr_v2c_idx = NULL;
+static cs_lnum_t    *_lr_v2c_ids = NULL;
+static cs_weight_t  *_lr_v2c_w = NULL;
+static cs_lnum_t    *_lr_v2b_idx = NULL;
+static cs_lnum_t    *_lr_v2b_ids = NULL;
+static cs_weight_t  *_lr_v2b_w = NULL;
+
 /* Short names for gradient computation types */
 
 const char *cs_cell_to_vertex_type_name[]
@@ -499,6 +510,249 @@ _cell_to_vertex_f_lsq(int  tr_ignore)
     _sym_44_factor_ldlt(w + v_id*10);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Transpose an element -> vertices adjacency and compute the
+ *         associated linear regression weights.
+ *
+ * The computed weight for a given (vertex, element) couple is the
+ * contribution of the element value to the vertex value, that is:
+ *   w = g.(x_e - x_v, 1), with g_k = (A_v^{-1} e_k)_3 obtained from
+ * the vertex's LDL^T factorization.
+ *
+ * \param[in]   n_elts      number of elements
+ * \param[in]   e2v_idx     element -> vertices index
+ * \param[in]   e2v_ids     element -> vertices ids
+ * \param[in]   e_coo       element coordinates
+ * \param[in]   g           per-vertex partial solve coefficients
+ * \param[out]  v2e_idx     vertex -> elements index
+ * \param[out]  v2e_ids     vertex -> elements ids
+ * \param[out]  v2e_w       vertex -> elements weights
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cell_to_vertex_lr_transpose(cs_lnum_t           n_elts,
+                             const cs_lnum_t     e2v_idx[],
+                             const cs_lnum_t     e2v_ids[],
+                             const cs_real_t     e_coo[][3],
+                             const cs_real_t     g[][4],
+                             cs_lnum_t         **v2e_idx,
+                             cs_lnum_t         **v2e_ids,
+                             cs_weight_t       **v2e_w)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_lnum_t n_vertices = m->n_vertices;
+  const cs_real_3_t *vtx_coord = (const cs_real_3_t *)m->vtx_coord;
+
+  cs_lnum_t *_idx, *_ids;
+  cs_weight_t *_w;
+
+  BFT_MALLOC(_idx, n_vertices + 1, cs_lnum_t);
+
+  for (cs_lnum_t v_id = 0; v_id < n_vertices + 1; v_id++)
+    _idx[v_id] = 0;
+
+  for (cs_lnum_t j = 0; j < e2v_idx[n_elts]; j++)
+    _idx[e2v_ids[j] + 1] += 1;
+
+  for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++)
+    _idx[v_id + 1] += _idx[v_id];
+
+  const cs_lnum_t n_ent = _idx[n_vertices];
+
+  BFT_MALLOC(_ids, n_ent, cs_lnum_t);
+  BFT_MALLOC(_w, n_ent, cs_weight_t);
+
+  /* Fill by increasing element id, so that gathers are well ordered */
+
+  cs_lnum_t *v_count;
+  BFT_MALLOC(v_count, n_vertices, cs_lnum_t);
+  for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++)
+    v_count[v_id] = _idx[v_id];
+
+  for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {
+    for (cs_lnum_t j = e2v_idx[e_id]; j < e2v_idx[e_id+1]; j++) {
+      cs_lnum_t v_id = e2v_ids[j];
+      _ids[v_count[v_id]] = e_id;
+      v_count[v_id] += 1;
+    }
+  }
+
+  BFT_FREE(v_count);
+
+# pragma omp parallel for if(n_vertices > CS_THR_MIN)
+  for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
+    const cs_real_t *v_coo = vtx_coord[v_id];
+    const cs_real_t *_g = g[v_id];
+    for (cs_lnum_t j = _idx[v_id]; j < _idx[v_id+1]; j++) {
+      const cs_real_t *_e_coo = e_coo[_ids[j]];
+      _w[j] =   _g[0]*(_e_coo[0] - v_coo[0])
+              + _g[1]*(_e_coo[1] - v_coo[1])
+              + _g[2]*(_e_coo[2] - v_coo[2])
+              + _g[3];
+    }
+  }
+
+  *v2e_idx = _idx;
+  *v2e_ids = _ids;
+  *v2e_w = _w;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build the linear regression operator in vertex-based form.
+ *
+ * Since the vertex value is a linear function of the assembled right-hand
+ * side, the per-vertex factorization is only needed here, and is freed
+ * once the operator is built.
+ *
+ * \param[in]  tr_ignore  if > 0, ignore periodicity with rotation;
+ *                        if > 1, ignore all periodic transforms
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cell_to_vertex_lr_operator(int  tr_ignore)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_adjacency_t  *c2v = cs_mesh_adjacencies_cell_vertices();
+
+  const cs_lnum_t n_vertices = m->n_vertices;
+
+  if (! _set[CS_CELL_TO_VERTEX_LR] || _weights[CS_CELL_TO_VERTEX_LR][0] == NULL)
+    _cell_to_vertex_f_lsq(tr_ignore);
+
+  const cs_weight_t *ldlt = _weights[CS_CELL_TO_VERTEX_LR][0];
+
+  cs_real_4_t *g;
+  BFT_MALLOC(g, n_vertices, cs_real_4_t);
+
+# pragma omp parallel for if(n_vertices > CS_THR_MIN)
+  for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
+    const cs_real_t  *_ldlt = ldlt + v_id*10;
+    for (int k = 0; k < 4; k++) {
+      cs_real_t e_k[4] = {0, 0, 0, 0};
+      e_k[k] = 1;
+      g[v_id][k] = _sym_44_partial_solve_ldlt(_ldlt, e_k);
+    }
+  }
+
+  _cell_to_vertex_lr_transpose(m->n_cells,
+                               c2v->idx,
+                               c2v->ids,
+                               (const cs_real_3_t *)mq->cell_cen,
+                               (const cs_real_4_t *)g,
+                               &_lr_v2c_idx,
+                               &_lr_v2c_ids,
+                               &_lr_v2c_w);
+
+  _cell_to_vertex_lr_transpose(m->n_b_faces,
+                               m->b_face_vtx_idx,
+                               m->b_face_vtx_lst,
+                               (const cs_real_3_t *)mq->b_face_cog,
+                               (const cs_real_4_t *)g,
+                               &_lr_v2b_idx,
+                               &_lr_v2b_ids,
+                               &_lr_v2b_w);
+
+  BFT_FREE(g);
+  BFT_FREE(_weights[CS_CELL_TO_VERTEX_LR][0]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Interpolate cell values to vertex values using the
+ *         linear regression operator.
+ *
+ * Each vertex value is gathered from its adjacent cells and boundary faces,
+ * so no atomic or scatter operations are needed. Contributions from other
+ * ranks or periodic vertices are then summed, which is equivalent to
+ * summing the right-hand sides before the solve, as the operator is linear.
+ *
+ * \param[in]   var_dim     variable dimension
+ * \param[in]   tr_ignore   if > 0, ignore periodicity with rotation;
+ *                          if > 1, ignore all periodic transforms
+ * \param[in]   c_var       base cell-based variable
+ * \param[in]   b_var       base boundary-face values, or NULL
+ * \param[out]  v_var       vertex-based variable
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cell_to_vertex_lr(cs_lnum_t                  var_dim,
+                   int                        tr_ignore,
+                   const cs_real_t            c_var[restrict],
+                   const cs_real_t            b_var[restrict],
+                   cs_real_t                  v_var[restrict])
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_lnum_t n_vertices = m->n_vertices;
+  const cs_lnum_t *b_face_cells = m->b_face_cells;
+
+  if (_lr_v2c_idx == NULL)
+    _cell_to_vertex_lr_operator(tr_ignore);
+
+  const cs_lnum_t *v2c_idx = _lr_v2c_idx;
+  const cs_lnum_t *v2c_ids = _lr_v2c_ids;
+  const cs_weight_t *v2c_w = _lr_v2c_w;
+  const cs_lnum_t *v2b_idx = _lr_v2b_idx;
+  const cs_lnum_t *v2b_ids = _lr_v2b_ids;
+  const cs_weight_t *v2b_w = _lr_v2b_w;
+
+  if (var_dim == 1) {
+
+#   pragma omp parallel for if(n_vertices > CS_THR_MIN)
+    for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
+      cs_real_t s = 0;
+      for (cs_lnum_t j = v2c_idx[v_id]; j < v2c_idx[v_id+1]; j++)
+        s += v2c_w[j] * c_var[v2c_ids[j]];
+      if (b_var != NULL) {
+        for (cs_lnum_t j = v2b_idx[v_id]; j < v2b_idx[v_id+1]; j++)
+          s += v2b_w[j] * b_var[v2b_ids[j]];
+      }
+      else {
+        for (cs_lnum_t j = v2b_idx[v_id]; j < v2b_idx[v_id+1]; j++)
+          s += v2b_w[j] * c_var[b_face_cells[v2b_ids[j]]];
+      }
+      v_var[v_id] = s;
+    }
+
+  }
+  else {
+
+#   pragma omp parallel for if(n_vertices > CS_THR_MIN)
+    for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
+      cs_real_t *_v_var = v_var + v_id*var_dim;
+      for (cs_lnum_t k = 0; k < var_dim; k++)
+        _v_var[k] = 0;
+      for (cs_lnum_t j = v2c_idx[v_id]; j < v2c_idx[v_id+1]; j++) {
+        const cs_real_t *_c_var = c_var + v2c_ids[j]*var_dim;
+        for (cs_lnum_t k = 0; k < var_dim; k++)
+          _v_var[k] += v2c_w[j] * _c_var[k];
+      }
+      for (cs_lnum_t j = v2b_idx[v_id]; j < v2b_idx[v_id+1]; j++) {
+        const cs_real_t *_b_var
+          = (b_var != NULL) ?   b_var + v2b_ids[j]*var_dim
+                              : c_var + b_face_cells[v2b_ids[j]]*var_dim;
+        for (cs_lnum_t k = 0; k < var_dim; k++)
+          _v_var[k] += v2b_w[j] * _b_var[k];
+      }
+    }
+
+  }
+
+  if (m->vtx_interfaces != NULL)
+    cs_interface_set_sum_tr(m->vtx_interfaces,
+                            n_vertices,
+                            var_dim,
+                            true,
+                            CS_REAL_TYPE,
+                            tr_ignore,
+                            v_var);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Interpolate cell values to vertex values for a scalar arrray.
@@ -526,7 +780,6 @@ _cell_to_vertex_scalar(cs_cell_to_vertex_type_t   method,
   CS_UNUSED(verbosity);
 
   const cs_mesh_t  *m = cs_glob_mesh;
-  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
   const cs_adjacency_t  *c2v = cs_mesh_adjacencies_cell_vertices();
 
   const cs_lnum_t n_vertices = m->n_vertices;
@@ -733,94 +986,7 @@ _cell_to_vertex_scalar(cs_cell_to_vertex_type_t   method,
     break;
 
   case CS_CELL_TO_VERTEX_LR:
-    {
-      if (! _set[CS_CELL_TO_VERTEX_LR])
-        _cell_to_vertex_f_lsq(tr_ignore);
-
-      cs_real_t  *rhs;
-      cs_lnum_t  rhs_size = n_vertices*4;
-      BFT_MALLOC(rhs, rhs_size, cs_real_t);
-      for (cs_lnum_t i = 0; i < rhs_size; i++)
-        rhs[i] = 0;
-
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        const cs_real_t *c_coo = mq->cell_cen + c_id*3;
-        cs_real_t _c_var = c_var[c_id];
-        cs_lnum_t s_id = c2v_idx[c_id];
-        cs_lnum_t e_id = c2v_idx[c_id+1];
-        for (cs_lnum_t j = s_id; j < e_id; j++) {
-          cs_lnum_t v_id = c2v_ids[j];
-          const cs_real_t *v_coo = m->vtx_coord + v_id*3;
-          cs_real_t r_coo[3]
-            = {c_coo[0]-v_coo[0], c_coo[1]-v_coo[1], c_coo[2]-v_coo[2]};
-          cs_real_t  *_rhs = rhs + v_id*4;
-          _rhs[0] += r_coo[0] * _c_var;
-          _rhs[1] += r_coo[1] * _c_var;
-          _rhs[2] += r_coo[2] * _c_var;
-          _rhs[3] += c_var[c_id];
-        }
-      }
-
-      if (b_var == NULL) {
-        for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-          const cs_real_t *f_coo = mq->b_face_cog + f_id*3;
-          cs_lnum_t c_id = m->b_face_cells[f_id];
-          cs_real_t _b_var = c_var[c_id];
-          cs_lnum_t s_id = f2v_idx[f_id];
-          cs_lnum_t e_id = f2v_idx[f_id+1];
-          for (cs_lnum_t j = s_id; j < e_id; j++) {
-            cs_lnum_t v_id = f2v_ids[j];
-            const cs_real_t *v_coo = m->vtx_coord + v_id*3;
-            cs_real_t r_coo[3]
-              = {f_coo[0]-v_coo[0], f_coo[1]-v_coo[1], f_coo[2]-v_coo[2]};
-            cs_real_t  *_rhs = rhs + v_id*4;
-            _rhs[0] += r_coo[0] * _b_var;
-            _rhs[1] += r_coo[1] * _b_var;
-            _rhs[2] += r_coo[2] * _b_var;
-            _rhs[3] += _b_var;
-          }
-        }
-      }
-      else {
-        for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-          const cs_real_t *f_coo = mq->b_face_cog + f_id*3;
-          cs_real_t _b_var = b_var[f_id];
-          cs_lnum_t s_id = f2v_idx[f_id];
-          cs_lnum_t e_id = f2v_idx[f_id+1];
-          for (cs_lnum_t j = s_id; j < e_id; j++) {
-            cs_lnum_t v_id = f2v_ids[j];
-            const cs_real_t *v_coo = m->vtx_coord + v_id*3;
-            cs_real_t r_coo[3]
-              = {f_coo[0]-v_coo[0], f_coo[1]-v_coo[1], f_coo[2]-v_coo[2]};
-            cs_real_t  *_rhs = rhs + v_id*4;
-            _rhs[0] += r_coo[0] * _b_var;
-            _rhs[1] += r_coo[1] * _b_var;
-            _rhs[2] += r_coo[2] * _b_var;
-            _rhs[3] += _b_var;
-          }
-        }
-      }
-
-      if (m->vtx_interfaces != NULL)
-        cs_interface_set_sum_tr(m->vtx_interfaces,
-                                m->n_vertices,
-                                4,
-                                true,
-                                CS_REAL_TYPE,
-                                tr_ignore,
-                                rhs);
-
-      const cs_weight_t *ldlt = _weights[CS_CELL_TO_VERTEX_LR][0];
-
-#     pragma omp parallel for if(n_vertices > CS_THR_MIN)
-      for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
-        const cs_real_t  *_ldlt = ldlt + v_id*10;
-        const cs_real_t  *_rhs = rhs + v_id*4;
-        v_var[v_id] = _sym_44_partial_solve_ldlt(_ldlt, _rhs);
-      }
-
-      BFT_FREE(rhs);
-    }
+    _cell_to_vertex_lr(1, tr_ignore, c_var, b_var, v_var);
     break;
   default:
     break;
@@ -856,7 +1022,6 @@ _cell_to_vertex_strided(cs_cell_to_vertex_type_t   method,
   CS_UNUSED(verbosity);
 
   const cs_mesh_t  *m = cs_glob_mesh;
-  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
   const cs_adjacency_t  *c2v = cs_mesh_adjacencies_cell_vertices();
 
   const cs_lnum_t n_vertices = m->n_vertices;
@@ -1080,102 +1245,7 @@ _cell_to_vertex_strided(cs_cell_to_vertex_type_t   method,
     break;
 
   case CS_CELL_TO_VERTEX_LR:
-    {
-      if (! _set[CS_CELL_TO_VERTEX_LR])
-        _cell_to_vertex_f_lsq(tr_ignore);
-
-      cs_real_t  *rhs;
-      cs_lnum_t  rhs_size = n_vertices*4*var_dim;
-      BFT_MALLOC(rhs, rhs_size, cs_real_t);
-      for (cs_lnum_t i = 0; i < rhs_size; i++)
-        rhs[i] = 0;
-
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        const cs_real_t *c_coo = mq->cell_cen + c_id*3;
-        const cs_real_t *_c_var = c_var + c_id*var_dim;
-        cs_lnum_t s_id = c2v_idx[c_id];
-        cs_lnum_t e_id = c2v_idx[c_id+1];
-        for (cs_lnum_t j = s_id; j < e_id; j++) {
-          cs_lnum_t v_id = c2v_ids[j];
-          const cs_real_t *v_coo = m->vtx_coord + v_id*3;
-          cs_real_t r_coo[3]
-            = {c_coo[0]-v_coo[0], c_coo[1]-v_coo[1], c_coo[2]-v_coo[2]};
-          for (cs_lnum_t k = 0; k < var_dim; k++) {
-            cs_real_t  *_rhs = rhs + v_id*4*var_dim + k*4;
-            _rhs[0] += r_coo[0] * _c_var[k];
-            _rhs[1] += r_coo[1] * _c_var[k];
-            _rhs[2] += r_coo[2] * _c_var[k];
-            _rhs[3] += _c_var[k];
-          }
-        }
-      }
-
-      if (b_var == NULL) {
-        for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-          const cs_real_t *f_coo = mq->b_face_cog + f_id*3;
-          cs_lnum_t c_id = m->b_face_cells[f_id];
-          const cs_real_t *_b_var = c_var + c_id*var_dim;
-          cs_lnum_t s_id = f2v_idx[f_id];
-          cs_lnum_t e_id = f2v_idx[f_id+1];
-          for (cs_lnum_t j = s_id; j < e_id; j++) {
-            cs_lnum_t v_id = f2v_ids[j];
-            const cs_real_t *v_coo = m->vtx_coord + v_id*3;
-            cs_real_t r_coo[3]
-              = {f_coo[0]-v_coo[0], f_coo[1]-v_coo[1], f_coo[2]-v_coo[2]};
-            for (cs_lnum_t k = 0; k < var_dim; k++) {
-              cs_real_t  *_rhs = rhs + v_id*4*var_dim + k*4;
-              _rhs[0] += r_coo[0] * _b_var[k];
-              _rhs[1] += r_coo[1] * _b_var[k];
-              _rhs[2] += r_coo[2] * _b_var[k];
-              _rhs[3] += _b_var[k];
-            }
-          }
-        }
-      }
-      else {
-        for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-          const cs_real_t *f_coo = mq->b_face_cog + f_id*3;
-          const cs_real_t *_b_var = b_var + f_id*var_dim;
-          cs_lnum_t s_id = f2v_idx[f_id];
-          cs_lnum_t e_id = f2v_idx[f_id+1];
-          for (cs_lnum_t j = s_id; j < e_id; j++) {
-            cs_lnum_t v_id = f2v_ids[j];
-            const cs_real_t *v_coo = m->vtx_coord + v_id*3;
-            cs_real_t r_coo[3]
-              = {f_coo[0]-v_coo[0], f_coo[1]-v_coo[1], f_coo[2]-v_coo[2]};
-            for (cs_lnum_t k = 0; k < var_dim; k++) {
-              cs_real_t  *_rhs = rhs + v_id*4*var_dim + k*4;
-              _rhs[0] += r_coo[0] * _b_var[k];
-              _rhs[1] += r_coo[1] * _b_var[k];
-              _rhs[2] += r_coo[2] * _b_var[k];
-              _rhs[3] += _b_var[k];
-            }
-          }
-        }
-      }
-
-      if (m->vtx_interfaces != NULL)
-        cs_interface_set_sum_tr(m->vtx_interfaces,
-                                m->n_vertices,
-                                4*var_dim,
-                                true,
-                                CS_REAL_TYPE,
-                                tr_ignore,
-                                rhs);
-
-      const cs_weight_t *ldlt = _weights[CS_CELL_TO_VERTEX_LR][0];
-
-#     pragma omp parallel for if(n_vertices > CS_THR_MIN)
-      for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
-        const cs_real_t  *_ldlt = ldlt + v_id*10;
-        for (cs_lnum_t k = 0; k < var_dim; k++) {
-          const cs_real_t  *_rhs = rhs + v_id*4*var_dim + k*4;
-          v_var[v_id*var_dim + k] = _sym_44_partial_solve_ldlt(_ldlt, _rhs);
-        }
-      }
-
-      BFT_FREE(rhs);
-    }
+    _cell_to_vertex_lr(var_dim, tr_ignore, c_var, b_var, v_var);
     break;
   default:
     break;
@@ -1202,7 +1272,15 @@ cs_cell_to_vertex_free(void)
   for (int i = 0; i < 3; i++) {
     for (int j = 0; j < 2; j++)
     BFT_FREE(_weights[i][j]);
+    _set[i] = false;
   }
+
+  BFT_FREE(_lr_v2c_idx);
+  BFT_FREE(_lr_v2c_ids);
+  BFT_FREE(_lr_v2c_w);
+  BFT_FREE(_lr_v2b_idx);
+  BFT_FREE(_lr_v2b_ids);
+  BFT_FREE(_lr_v2b_w);
 }
 
 /*----------------------------------------------------------------------------*/
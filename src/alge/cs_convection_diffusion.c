@@ -100,6 +100,16 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Force inlining of scheme-specialized face kernels where supported,
+   so that scheme tests are resolved at compile time at any
+   optimization level */
+
+#if defined(__GNUC__)
+#  define CS_CD_FORCE_INLINE inline __attribute__((always_inline))
+#else
+#  define CS_CD_FORCE_INLINE inline
+#endif
+
 /*=============================================================================
  * Local type definitions
  *============================================================================*/
@@ -603,6 +613,522 @@ _beta_limiter_num(const int           f_id,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute the explicit convection/diffusion flux of a scalar at a given
+ * interior face, for an unsteady algorithm and a given scheme.
+ *
+ * This function is always inlined, and intended to be called with constant
+ * values for the iupwin, ischcp and isstpp arguments, so that the tests
+ * relative to the scheme choice are resolved at compile time. As it only
+ * uses the arrays it is given, it is shared by the host and OpenMP target
+ * face loops. Local limitation of the reconstruction (diffusion limiter)
+ * is not handled here.
+ *
+ * parameters:
+ *   iupwin        <-- 1 for pure upwind, 0 otherwise
+ *   ischcp        <-- second order convection scheme (1: centered, 2: SOLU)
+ *   isstpp        <-- 0 with slope test, 1 without
+ *   face_id       <-- interior face id
+ *   ii            <-- first adjacent cell id
+ *   jj            <-- second adjacent cell id
+ *   weight        <-- interior faces weighting factor
+ *   i_dist        <-- interior faces distance between cell centers
+ *   i_face_surf   <-- interior faces surface
+ *   cell_cen      <-- cell centers
+ *   i_face_normal <-- interior faces normal
+ *   i_face_cog    <-- interior faces center of gravity
+ *   diipf         <-- interior faces II' vector
+ *   djjpf         <-- interior faces JJ' vector
+ *   iconvp        <-- convection flag
+ *   idiffp        <-- diffusion flag
+ *   imasac        <-- take mass accumulation into account?
+ *   bldfrp        <-- flux reconstruction coefficient
+ *   thetap        <-- weighting coefficient for the theta-schema
+ *   blencp        <-- proportion of second order scheme
+ *   blend_st      <-- proportion of second order scheme when the slope
+ *                     test is activated
+ *   pvar          <-- solved variable
+ *   grad          <-- cell gradient
+ *   gradup        <-- upwind gradient (for SOLU), or NULL
+ *   gradst        <-- slope test gradient, or NULL
+ *   i_massflux    <-- mass flux at interior faces
+ *   i_visc        <-- diffusion coefficient at interior faces
+ *   fluxij        --> fluxes for cells ii and jj
+ *
+ * returns:
+ *   1 if the face is upwinded (pure upwind or slope test), 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static CS_CD_FORCE_INLINE int
+_i_conv_diff_scalar_face(const int                    iupwin,
+                         const int                    ischcp,
+                         const int                    isstpp,
+                         const cs_lnum_t              face_id,
+                         const cs_lnum_t              ii,
+                         const cs_lnum_t              jj,
+                         const cs_real_t    *restrict weight,
+                         const cs_real_t    *restrict i_dist,
+                         const cs_real_t    *restrict i_face_surf,
+                         const cs_real_3_t  *restrict cell_cen,
+                         const cs_real_3_t  *restrict i_face_normal,
+                         const cs_real_3_t  *restrict i_face_cog,
+                         const cs_real_3_t  *restrict diipf,
+                         const cs_real_3_t  *restrict djjpf,
+                         const int                    iconvp,
+                         const int                    idiffp,
+                         const int                    imasac,
+                         const cs_real_t              bldfrp,
+                         const double                 thetap,
+                         const double                 blencp,
+                         const double                 blend_st,
+                         const cs_real_t    *restrict pvar,
+                         const cs_real_3_t  *restrict grad,
+                         const cs_real_3_t  *restrict gradup,
+                         const cs_real_3_t  *restrict gradst,
+                         const cs_real_t    *restrict i_massflux,
+                         const cs_real_t    *restrict i_visc,
+                         cs_real_t                    fluxij[2])
+{
+  const cs_real_t pi = pvar[ii];
+  const cs_real_t pj = pvar[jj];
+
+  cs_real_t recoi, recoj, pip, pjp;
+
+  cs_i_compute_quantities(bldfrp,
+                          diipf[face_id],
+                          djjpf[face_id],
+                          grad[ii],
+                          grad[jj],
+                          pi,
+                          pj,
+                          &recoi,
+                          &recoj,
+                          &pip,
+                          &pjp);
+
+  cs_real_t pif = pi, pjf = pj;
+
+  int upwind_switch = 0;
+
+  if (iupwin == 1)
+    upwind_switch = 1;
+
+  else {
+
+    if (ischcp == 1) {
+      cs_centered_f_val(weight[face_id], pip, pjp, &pif);
+      cs_centered_f_val(weight[face_id], pip, pjp, &pjf);
+    }
+    else {
+      cs_solu_f_val(cell_cen[ii], i_face_cog[face_id], gradup[ii],
+                    pi, &pif);
+      cs_solu_f_val(cell_cen[jj], i_face_cog[face_id], gradup[jj],
+                    pj, &pjf);
+    }
+
+    if (isstpp == 0) {
+
+      cs_real_t testij, tesqck;
+
+      cs_slope_test(pi,
+                    pj,
+                    i_dist[face_id],
+                    i_face_surf[face_id],
+                    i_face_normal[face_id],
+                    grad[ii],
+                    grad[jj],
+                    gradst[ii],
+                    gradst[jj],
+                    i_massflux[face_id],
+                    &testij,
+                    &tesqck);
+
+      /* Blending with upwind is neutral (factor 1) when the slope
+         test passes, so no branch is needed here */
+
+      upwind_switch = (tesqck <= 0.) | (testij <= 0.);
+      const cs_real_t blend_f = (upwind_switch) ? blend_st : 1.;
+
+      cs_blend_f_val(blend_f, pi, &pif);
+      cs_blend_f_val(blend_f, pj, &pjf);
+
+    }
+
+    cs_blend_f_val(blencp, pi, &pif);
+    cs_blend_f_val(blencp, pj, &pjf);
+
+  }
+
+  fluxij[0] = 0.;
+  fluxij[1] = 0.;
+
+  cs_i_conv_flux(iconvp,
+                 thetap,
+                 imasac,
+                 pi,
+                 pj,
+                 pif,
+                 pif, /* no relaxation */
+                 pjf,
+                 pjf, /* no relaxation */
+                 i_massflux[face_id],
+                 1., /* xcpp */
+                 1., /* xcpp */
+                 fluxij);
+
+  cs_i_diff_flux(idiffp,
+                 thetap,
+                 pip,
+                 pjp,
+                 pip, /* no relaxation */
+                 pjp, /* no relaxation */
+                 i_visc[face_id],
+                 fluxij);
+
+  return upwind_switch;
+}
+
+/*----------------------------------------------------------------------------
+ * Add the explicit contribution of the convection/diffusion terms of a
+ * scalar for a range of interior faces, for an unsteady algorithm and
+ * a given scheme.
+ *
+ * This function is always inlined, and intended to be called with constant
+ * values for the iupwin, ischcp and isstpp arguments, so that the tests
+ * relative to the scheme choice are resolved at compile time and the inner
+ * face loop has no scheme-dependent branching. Local limitation of the
+ * reconstruction (diffusion limiter) is not handled here.
+ *
+ * parameters:
+ *   iupwin       <-- 1 for pure upwind, 0 otherwise
+ *   ischcp       <-- second order convection scheme (1: centered, 2: SOLU)
+ *   isstpp       <-- 0 with slope test, 1 without
+ *   s_id         <-- start id of face range
+ *   e_id         <-- past-the-end id of face range
+ *   m            <-- pointer to mesh
+ *   fvq          <-- pointer to mesh quantities
+ *   iconvp       <-- convection flag
+ *   idiffp       <-- diffusion flag
+ *   imasac       <-- take mass accumulation into account?
+ *   ircflp       <-- flux reconstruction flag
+ *   thetap       <-- weighting coefficient for the theta-schema
+ *   blencp       <-- proportion of second order scheme
+ *   blend_st     <-- proportion of second order scheme when the slope
+ *                    test is activated
+ *   pvar         <-- solved variable
+ *   grad         <-- cell gradient
+ *   gradup       <-- upwind gradient (for SOLU), or NULL
+ *   gradst       <-- slope test gradient, or NULL
+ *   i_massflux   <-- mass flux at interior faces
+ *   i_visc       <-- diffusion coefficient at interior faces
+ *   v_slope_test <-> slope test upwind indicator, or NULL
+ *   rhs          <-> right hand side
+ *
+ * returns:
+ *   number of local interior faces of the range switched to upwind
+ *----------------------------------------------------------------------------*/
+
+static CS_CD_FORCE_INLINE cs_gnum_t
+_i_conv_diff_scalar_faces(const int                    iupwin,
+                          const int                    ischcp,
+                          const int                    isstpp,
+                          const cs_lnum_t              s_id,
+                          const cs_lnum_t              e_id,
+                          const cs_mesh_t             *m,
+                          const cs_mesh_quantities_t  *fvq,
+                          const int                    iconvp,
+                          const int                    idiffp,
+                          const int                    imasac,
+                          const int                    ircflp,
+                          const double                 thetap,
+                          const double                 blencp,
+                          const double                 blend_st,
+                          const cs_real_t    *restrict pvar,
+                          const cs_real_3_t  *restrict grad,
+                          const cs_real_3_t  *restrict gradup,
+                          const cs_real_3_t  *restrict gradst,
+                          const cs_real_t    *restrict i_massflux,
+                          const cs_real_t    *restrict i_visc,
+                          cs_real_t          *restrict v_slope_test,
+                          cs_real_t          *restrict rhs)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict i_dist = fvq->i_dist;
+  const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
+  const cs_real_t *restrict cell_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)fvq->djjpf;
+
+  const cs_real_t bldfrp = (cs_real_t) ircflp;
+
+  cs_gnum_t n_upwind = 0;
+
+  for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+
+    cs_real_t fluxij[2];
+
+    const int upwind_switch
+      = _i_conv_diff_scalar_face(iupwin, ischcp, isstpp, face_id, ii, jj,
+                                 weight, i_dist, i_face_surf, cell_cen,
+                                 i_face_normal, i_face_cog, diipf, djjpf,
+                                 iconvp, idiffp, imasac, bldfrp,
+                                 thetap, blencp, blend_st,
+                                 pvar, grad, gradup, gradst,
+                                 i_massflux, i_visc, fluxij);
+
+    /* in parallel, face will be counted by one and only one rank */
+    n_upwind += upwind_switch & (ii < n_cells);
+
+    if (iupwin == 0 && isstpp == 0 && v_slope_test != NULL && upwind_switch) {
+      v_slope_test[ii] += fabs(i_massflux[face_id]) / cell_vol[ii];
+      v_slope_test[jj] += fabs(i_massflux[face_id]) / cell_vol[jj];
+    }
+
+    rhs[ii] -= fluxij[0];
+    rhs[jj] += fluxij[1];
+
+  }
+
+  return n_upwind;
+}
+
+#if defined(HAVE_OPENMP_TARGET)
+
+/*----------------------------------------------------------------------------
+ * Add the explicit interior face contribution of the convection/diffusion
+ * terms of a scalar for an unsteady algorithm on the OpenMP target device.
+ *
+ * Mesh connectivity and quantities are expected to be present on the
+ * device (see cs_mesh_quantities_device_map), so only the variable,
+ * gradients, face coefficients and right-hand side are transferred.
+ * Face fluxes are computed by the same per-face function as on the host,
+ * and scattered to cells using atomic updates.
+ *
+ * parameters:
+ *   i_kernel     <-- kernel id (as for _i_conv_diff_scalar_unsteady)
+ *   (other parameters as for _i_conv_diff_scalar_faces)
+ *
+ * returns:
+ *   number of local interior faces switched to upwind
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_i_conv_diff_scalar_unsteady_target(const int                    i_kernel,
+                                    const cs_mesh_t             *m,
+                                    const cs_mesh_quantities_t  *fvq,
+                                    const int                    iconvp,
+                                    const int                    idiffp,
+                                    const int                    imasac,
+                                    const int                    ircflp,
+                                    const double                 thetap,
+                                    const double                 blencp,
+                                    const double                 blend_st,
+                                    const cs_real_t    *restrict pvar,
+                                    const cs_real_3_t  *restrict grad,
+                                    const cs_real_3_t  *restrict gradup,
+                                    const cs_real_3_t  *restrict gradst,
+                                    const cs_real_t    *restrict i_massflux,
+                                    const cs_real_t    *restrict i_visc,
+                                    cs_real_t          *restrict v_slope_test,
+                                    cs_real_t          *restrict rhs)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict i_dist = fvq->i_dist;
+  const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
+  const cs_real_t *restrict cell_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)fvq->djjpf;
+
+  const cs_real_t bldfrp = (cs_real_t) ircflp;
+
+  /* Scheme choice is uniform over the loop, so branches on these values
+     do not diverge on the device */
+
+  const int iupwin = (i_kernel == 0) ? 1 : 0;
+  const int ischcp = (i_kernel == 1) ? 1 : 2;
+  const int isstpp = (i_kernel == 0 || i_kernel == 3) ? 1 : 0;
+
+  /* Optional arrays are mapped as zero-sized sections when not used */
+
+  const cs_lnum_t n_up = (gradup != NULL) ? n_cells_ext : 0;
+  const cs_lnum_t n_st = (gradst != NULL) ? n_cells_ext : 0;
+  const bool has_slope_test = (v_slope_test != NULL && isstpp == 0);
+  const cs_lnum_t n_vst = (has_slope_test) ? n_cells_ext : 0;
+
+  cs_gnum_t n_upwind = 0;
+
+# pragma omp target teams distribute parallel for reduction(+:n_upwind) \
+    map(to: i_face_cells[0:n_i_faces], weight[0:n_i_faces], \
+            i_dist[0:n_i_faces], i_face_surf[0:n_i_faces], \
+            cell_vol[0:n_cells_ext], cell_cen[0:n_cells_ext], \
+            i_face_normal[0:n_i_faces], i_face_cog[0:n_i_faces], \
+            diipf[0:n_i_faces], djjpf[0:n_i_faces], \
+            pvar[0:n_cells_ext], grad[0:n_cells_ext], \
+            gradup[0:n_up], gradst[0:n_st], \
+            i_massflux[0:n_i_faces], i_visc[0:n_i_faces]) \
+    map(tofrom: v_slope_test[0:n_vst], rhs[0:n_cells_ext])
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+
+    cs_real_t fluxij[2];
+
+    const int upwind_switch
+      = _i_conv_diff_scalar_face(iupwin, ischcp, isstpp, face_id, ii, jj,
+                                 weight, i_dist, i_face_surf, cell_cen,
+                                 i_face_normal, i_face_cog, diipf, djjpf,
+                                 iconvp, idiffp, imasac, bldfrp,
+                                 thetap, blencp, blend_st,
+                                 pvar, grad, gradup, gradst,
+                                 i_massflux, i_visc, fluxij);
+
+    /* in parallel, face will be counted by one and only one rank */
+    n_upwind += upwind_switch & (ii < n_cells);
+
+    if (has_slope_test && upwind_switch) {
+      cs_real_t vst_i = fabs(i_massflux[face_id]) / cell_vol[ii];
+      cs_real_t vst_j = fabs(i_massflux[face_id]) / cell_vol[jj];
+#     pragma omp atomic
+      v_slope_test[ii] += vst_i;
+#     pragma omp atomic
+      v_slope_test[jj] += vst_j;
+    }
+
+#   pragma omp atomic
+    rhs[ii] -= fluxij[0];
+#   pragma omp atomic
+    rhs[jj] += fluxij[1];
+
+  }
+
+  return n_upwind;
+}
+
+#endif /* defined(HAVE_OPENMP_TARGET) */
+
+/*----------------------------------------------------------------------------
+ * Add the explicit interior face contribution of the convection/diffusion
+ * terms of a scalar for an unsteady algorithm, using a kernel specialized
+ * for the scheme.
+ *
+ * The kernel is selected once per thread and face group, each variant
+ * being an instance of _i_conv_diff_scalar_faces with constant
+ * scheme arguments.
+ *
+ * parameters:
+ *   i_kernel     <-- kernel id: 0: pure upwind,
+ *                               1: centered with slope test,
+ *                               2: SOLU with slope test,
+ *                               3: SOLU without slope test
+ *   (other parameters as for _i_conv_diff_scalar_faces)
+ *
+ * returns:
+ *   number of local interior faces switched to upwind
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_i_conv_diff_scalar_unsteady(const int                    i_kernel,
+                             const cs_mesh_t             *m,
+                             const cs_mesh_quantities_t  *fvq,
+                             const int                    iconvp,
+                             const int                    idiffp,
+                             const int                    imasac,
+                             const int                    ircflp,
+                             const double                 thetap,
+                             const double                 blencp,
+                             const double                 blend_st,
+                             const cs_real_t    *restrict pvar,
+                             const cs_real_3_t  *restrict grad,
+                             const cs_real_3_t  *restrict gradup,
+                             const cs_real_3_t  *restrict gradst,
+                             const cs_real_t    *restrict i_massflux,
+                             const cs_real_t    *restrict i_visc,
+                             cs_real_t          *restrict v_slope_test,
+                             cs_real_t          *restrict rhs)
+{
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+
+  cs_gnum_t n_upwind = 0;
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for reduction(+:n_upwind)
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      const cs_lnum_t s_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+      const cs_lnum_t e_id = i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+
+      switch (i_kernel) {
+      case 0:
+        n_upwind += _i_conv_diff_scalar_faces(1, 0, 1, s_id, e_id, m, fvq,
+                                              iconvp, idiffp, imasac, ircflp,
+                                              thetap, blencp, blend_st,
+                                              pvar, grad, gradup, gradst,
+                                              i_massflux, i_visc,
+                                              v_slope_test, rhs);
+        break;
+      case 1:
+        n_upwind += _i_conv_diff_scalar_faces(0, 1, 0, s_id, e_id, m, fvq,
+                                              iconvp, idiffp, imasac, ircflp,
+                                              thetap, blencp, blend_st,
+                                              pvar, grad, gradup, gradst,
+                                              i_massflux, i_visc,
+                                              v_slope_test, rhs);
+        break;
+      case 2:
+        n_upwind += _i_conv_diff_scalar_faces(0, 2, 0, s_id, e_id, m, fvq,
+                                              iconvp, idiffp, imasac, ircflp,
+                                              thetap, blencp, blend_st,
+                                              pvar, grad, gradup, gradst,
+                                              i_massflux, i_visc,
+                                              v_slope_test, rhs);
+        break;
+      default:
+        n_upwind += _i_conv_diff_scalar_faces(0, 2, 1, s_id, e_id, m, fvq,
+                                              iconvp, idiffp, imasac, ircflp,
+                                              thetap, blencp, blend_st,
+                                              pvar, grad, gradup, gradst,
+                                              i_massflux, i_visc,
+                                              v_slope_test, rhs);
+      }
+
+    }
+  }
+
+  return n_upwind;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1958,10 +2484,58 @@ cs_convection_diffusion_scalar(int                       idtvar,
     }
   }
 
+  /* Select a specialized kernel for the most common unsteady schemes
+     (pure upwind, centered or SOLU, with or without slope test) */
+
+  int i_kernel = -1;
+
+  if (idtvar >= 0 && df_limiter == NULL) {
+    if (iupwin == 1)
+      i_kernel = 0;
+    else if (iconvp > 0 && isstpp == 0 && ischcp == 1)
+      i_kernel = 1;
+    else if (iconvp > 0 && isstpp == 0 && ischcp == 2)
+      i_kernel = 2;
+    else if (iconvp > 0 && isstpp == 1 && ischcp == 2)
+      i_kernel = 3;
+  }
+
+  /* --> Specialized unsteady flux
+    ==============================*/
+
+#if defined(HAVE_OPENMP_TARGET)
+  if (i_kernel > -1 && fvq->device_mapped) {
+
+    n_upwind = _i_conv_diff_scalar_unsteady_target(i_kernel, m, fvq,
+                                                   iconvp, idiffp, imasac,
+                                                   ircflp,
+                                                   thetap, blencp, blend_st,
+                                                   _pvar,
+                                                   (const cs_real_3_t *)grad,
+                                                   (const cs_real_3_t *)gradup,
+                                                   (const cs_real_3_t *)gradst,
+                                                   i_massflux, i_visc,
+                                                   v_slope_test, rhs);
+
+  }
+  else
+#endif
+  if (i_kernel > -1) {
+
+    n_upwind = _i_conv_diff_scalar_unsteady(i_kernel, m, fvq,
+                                            iconvp, idiffp, imasac, ircflp,
+                                            thetap, blencp, blend_st,
+                                            _pvar,
+                                            (const cs_real_3_t *)grad,
+                                            (const cs_real_3_t *)gradup,
+                                            (const cs_real_3_t *)gradst,
+                                            i_massflux, i_visc,
+                                            v_slope_test, rhs);
+
   /* --> Pure upwind flux
     =====================*/
 
-  if (iupwin == 1) {
+  } else if (iupwin == 1) {
 
     /* Steady */
     if (idtvar < 0) {
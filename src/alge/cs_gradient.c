@@ -142,8 +142,27 @@ typedef struct {
   cs_real_33_t  *cocg_lsq_ext;     /* Interleaved cocg matrix for least
                                       squares gradients with ext. neighbors */
 
+  cs_real_t     *i_dc_ddc_lsq;     /* Interior face cell centers displacement
+                                      divided by its squared norm, for least
+                                      squares gradients (non-interleaved:
+                                      x, y, and z component arrays) */
+
 } cs_gradient_quantities_t;
 
+/* Global L2 norm reduction, possibly non-blocking */
+
+typedef struct {
+
+  double        s;                 /* Local, then global squared norm */
+  bool          pending;           /* Is a non-blocking reduction pending ? */
+
+#if defined(HAVE_MPI)
+  double        s_loc;             /* Local squared norm */
+  MPI_Request   request;           /* Request for non-blocking reduction */
+#endif
+
+} cs_gradient_l2_reduce_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -173,6 +192,27 @@ static int _gradient_stat_id = -1;
 static int                        _n_gradient_quantities = 0;
 static cs_gradient_quantities_t  *_gradient_quantities = NULL;
 
+#if defined(HAVE_OPENMP_TARGET)
+
+/* Size of the interior face displacement array mapped to the
+   OpenMP target device, or 0 if not mapped */
+
+static cs_lnum_t  _i_dc_ddc_lsq_device_size = 0;
+
+#endif
+
+/* Maximum number of fields handled in a single face sweep
+   by least squares gradients of multiple fields */
+
+static const int  _lsq_multi_max_fields = 4;
+
+/* Convergence test options for iterative gradient reconstruction:
+   test every _iter_check_interval sweeps (never if 0), optionally
+   overlapping the global reduction with the next sweep */
+
+static int   _iter_check_interval = 1;
+static bool  _iter_overlap_reduce = false;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -258,6 +298,7 @@ _gradient_quantities_get(int id)
       gq->cocg_lsq = NULL;
       gq->cocgb_s_lsq_ext = NULL;
       gq->cocg_lsq_ext = NULL;
+      gq->i_dc_ddc_lsq = NULL;
     }
 
     _n_gradient_quantities = id+1;
@@ -267,6 +308,29 @@ _gradient_quantities_get(int id)
   return _gradient_quantities + id;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free interior face displacement array for least squares
+ *         gradients, removing it from the OpenMP target device if mapped.
+ *
+ * \param[in, out]  gq  pointer to gradient quantities structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_i_dc_ddc_lsq(cs_gradient_quantities_t  *gq)
+{
+#if defined(HAVE_OPENMP_TARGET)
+  if (gq->i_dc_ddc_lsq != NULL && _i_dc_ddc_lsq_device_size > 0) {
+#   pragma omp target exit data \
+      map(delete:gq->i_dc_ddc_lsq[0:_i_dc_ddc_lsq_device_size])
+    _i_dc_ddc_lsq_device_size = 0;
+  }
+#endif
+
+  BFT_FREE(gq->i_dc_ddc_lsq);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Destroy mesh quantities structures.
@@ -285,6 +349,7 @@ _gradient_quantities_destroy(void)
     BFT_FREE(gq->cocg_lsq);
     BFT_FREE(gq->cocgb_s_lsq_ext);
     BFT_FREE(gq->cocg_lsq_ext);
+    _free_i_dc_ddc_lsq(gq);
 
   }
 
@@ -599,6 +664,122 @@ _l2_norm_1(cs_lnum_t            n_elts,
   return (sqrt(s));
 }
 
+/*----------------------------------------------------------------------------
+ * Start computation of L2 norm.
+ *
+ * If a non-blocking reduction is requested and available, the global sum
+ * is only completed by _l2_norm_1_finish.
+ *
+ * parameters:
+ *   n_elts   <-- Local number of elements
+ *   x        <-- array of 3-vectors
+ *   overlap  <-- use a non-blocking reduction if possible
+ *   r        --> reduction status
+ *----------------------------------------------------------------------------*/
+
+static void
+_l2_norm_1_start(cs_lnum_t                  n_elts,
+                 cs_real_t        *restrict x,
+                 bool                       overlap,
+                 cs_gradient_l2_reduce_t   *r)
+{
+  r->s = cs_dot(n_elts, x, x);
+  r->pending = false;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    r->s_loc = r->s;
+#if (MPI_VERSION >= 3)
+    if (overlap) {
+      MPI_Iallreduce(&(r->s_loc), &(r->s), 1, MPI_DOUBLE, MPI_SUM,
+                     cs_glob_mpi_comm, &(r->request));
+      r->pending = true;
+      return;
+    }
+#endif
+    MPI_Allreduce(&(r->s_loc), &(r->s), 1, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  CS_UNUSED(overlap);
+}
+
+/*----------------------------------------------------------------------------
+ * Complete computation of L2 norm started by _l2_norm_1_start.
+ *
+ * parameters:
+ *   r  <-> reduction status
+ *
+ * returns:
+ *   L2 norm
+ *----------------------------------------------------------------------------*/
+
+static double
+_l2_norm_1_finish(cs_gradient_l2_reduce_t  *r)
+{
+#if defined(HAVE_MPI)
+  if (r->pending)
+    MPI_Wait(&(r->request), MPI_STATUS_IGNORE);
+#endif
+
+  r->pending = false;
+
+  return (sqrt(r->s));
+}
+
+/*----------------------------------------------------------------------------
+ * Update the residual of an iterative gradient reconstruction at the end
+ * of a sweep, based on the convergence test options.
+ *
+ * Depending on those options, the residual may not be checked at every
+ * sweep, and a non-blocking reduction started at a given sweep is only
+ * completed at the next one, so the residual returned may be that of the
+ * previous sweep.
+ *
+ * parameters:
+ *   n_sweeps     <-- current sweep number
+ *   n_elts       <-- local number of values in rhs
+ *   rhs          <-- current right hand side
+ *   eps_norm     <-- convergence threshold (relative precision * norm)
+ *   r            <-> reduction status
+ *   l2_residual  <-> residual (updated if available)
+ *
+ * returns:
+ *   true if the updated residual is below eps_norm, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_iterative_residual_update(int                       n_sweeps,
+                           cs_lnum_t                 n_elts,
+                           cs_real_t       *restrict rhs,
+                           cs_real_t                 eps_norm,
+                           cs_gradient_l2_reduce_t  *r,
+                           cs_real_t                *l2_residual)
+{
+  /* Complete reduction started at the previous sweep */
+
+  if (r->pending) {
+    *l2_residual = _l2_norm_1_finish(r);
+    if (*l2_residual < eps_norm)
+      return true;
+  }
+
+  if (_iter_check_interval < 1 || n_sweeps % _iter_check_interval != 0)
+    return false;
+
+  _l2_norm_1_start(n_elts, rhs, _iter_overlap_reduce, r);
+
+  if (r->pending)
+    return false;
+
+  *l2_residual = _l2_norm_1_finish(r);
+
+  return (*l2_residual < eps_norm);
+}
+
 /*----------------------------------------------------------------------------
  * Update R.H.S. for lsq gradient taking into account the weight coefficients.
  *
@@ -1202,6 +1383,57 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
   BFT_FREE(buf);
 }
 
+/*----------------------------------------------------------------------------
+ * Exchange values at the distant side of internally coupled faces, so that
+ * coupled face contributions may be added in the main boundary face loops.
+ *
+ * parameters:
+ *   cpl         <-- structure associated with internal coupling
+ *   c_weight    <-- weighted gradient coefficient variable, or NULL
+ *   pvar        <-- variable
+ *   cpl_pvar    --> distant variable values (size: cpl->n_local)
+ *   cpl_weight  --> physical face weight if c_weight is not NULL,
+ *                   NULL otherwise (size: cpl->n_local)
+ *   cpl_grad    --> if not NULL, allocated array for distant gradient
+ *                   values (size: cpl->n_local)
+ *----------------------------------------------------------------------------*/
+
+static void
+_internal_coupling_face_values(const cs_internal_coupling_t  *cpl,
+                               const cs_real_t                c_weight[],
+                               const cs_real_t                pvar[],
+                               cs_real_t                    **cpl_pvar,
+                               cs_real_t                    **cpl_weight,
+                               cs_real_3_t                  **cpl_grad)
+{
+  const cs_lnum_t n_local = cpl->n_local;
+  const cs_lnum_t *restrict faces_local = cpl->faces_local;
+  const cs_lnum_t *restrict b_face_cells = cs_glob_mesh->b_face_cells;
+  const cs_real_t *restrict g_weight = cpl->g_weight;
+
+  cs_real_t *_pvar = NULL, *_weight = NULL;
+
+  BFT_MALLOC(_pvar, n_local, cs_real_t);
+  cs_internal_coupling_exchange_by_cell_id(cpl, 1, pvar, _pvar);
+
+  if (c_weight != NULL) {
+    BFT_MALLOC(_weight, n_local, cs_real_t);
+    cs_internal_coupling_exchange_by_cell_id(cpl, 1, c_weight, _weight);
+    for (cs_lnum_t ii = 0; ii < n_local; ii++) {
+      cs_real_t ki = c_weight[b_face_cells[faces_local[ii]]];
+      cs_real_t kj = _weight[ii];
+      cs_real_t pond = g_weight[ii];
+      _weight[ii] = kj / (pond * ki + (1. - pond) * kj);
+    }
+  }
+
+  if (cpl_grad != NULL)
+    BFT_MALLOC(*cpl_grad, n_local, cs_real_3_t);
+
+  *cpl_pvar = _pvar;
+  *cpl_weight = _weight;
+}
+
 /*----------------------------------------------------------------------------
  * Initialize gradient and right-hand side for scalar gradient reconstruction.
  *
@@ -1747,18 +1979,36 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
 
   /* Semi-implicit resolution on the whole mesh  */
 
-  /* Compute normalization residual */
+  /* Compute normalization residual (not needed with a fixed
+     number of sweeps) */
 
-  cs_real_t  rnorm = _l2_norm_1(3*n_cells, (cs_real_t *)grad);
+  cs_real_t  rnorm = 1.;
 
-  if (rnorm <= cs_math_epzero) {
-    if (gradient_info != NULL)
-      _gradient_info_update_iter(gradient_info, 0);
-    return;
+  if (_iter_check_interval > 0) {
+    rnorm = _l2_norm_1(3*n_cells, (cs_real_t *)grad);
+
+    if (rnorm <= cs_math_epzero) {
+      if (gradient_info != NULL)
+        _gradient_info_update_iter(gradient_info, 0);
+      return;
+    }
   }
 
+  cs_gradient_l2_reduce_t  l2_r;
+  l2_r.pending = false;
+
   BFT_MALLOC(rhs, n_cells_ext, cs_real_3_t);
 
+  /* Values at distant side of coupled faces; only the gradient
+     needs to be exchanged at each sweep */
+
+  cs_real_t *cpl_pvar = NULL, *cpl_weight = NULL;
+  cs_real_3_t *cpl_grad = NULL;
+
+  if (cpl != NULL && hyd_p_flag != 1)
+    _internal_coupling_face_values(cpl, c_weight, pvar,
+                                   &cpl_pvar, &cpl_weight, &cpl_grad);
+
   /* Vector OijFij is computed in CLDijP */
 
   /* Start iterations */
@@ -1957,16 +2207,13 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
 
       } /* loop on thread groups */
 
-      /* Contribution from coupled faces */
       if (cpl != NULL)
-        cs_internal_coupling_iterative_scalar_gradient
-          (cpl,
-           c_weight,
-           grad,
-           pvar,
-           rhs);
+        cs_internal_coupling_exchange_by_cell_id(cpl,
+                                                 3,
+                                                 (const cs_real_t *)grad,
+                                                 (cs_real_t *)cpl_grad);
 
-      /* Contribution from boundary faces */
+      /* Contribution from boundary and coupled faces */
 
       for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
@@ -2002,6 +2249,30 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
 
             } /* face without internal coupling */
 
+            else {
+
+              cs_lnum_t c_id = b_face_cells[f_id];
+              cs_lnum_t l_id = cpl->b_face_local_id[f_id];
+              const cs_real_t *ofij = cpl->offset_vect[l_id];
+
+              /* Reconstruction part, similar to that of interior faces,
+                 with the local cell as cell i */
+              cs_real_t pfaci
+                = 0.5 * (  ofij[0] * (cpl_grad[l_id][0] + grad[c_id][0])
+                         + ofij[1] * (cpl_grad[l_id][1] + grad[c_id][1])
+                         + ofij[2] * (cpl_grad[l_id][2] + grad[c_id][2]));
+
+              cs_real_t ktpond = (c_weight == NULL) ?
+                cpl->g_weight[l_id] :
+                1.0 - (1.0-cpl->g_weight[l_id]) * cpl_weight[l_id];
+
+              pfaci += (1.0-ktpond) * (cpl_pvar[l_id] - pvar[c_id]);
+
+              for (cs_lnum_t j = 0; j < 3; j++)
+                rhs[c_id][j] += pfaci * b_f_face_normal[f_id][j];
+
+            } /* face with internal coupling */
+
           } /* loop on faces */
 
         } /* loop on threads */
@@ -2043,9 +2314,12 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
 
     /* Convergence test */
 
-    l2_residual = _l2_norm_1(3*n_cells, (cs_real_t *)rhs);
-
-    if (l2_residual < epsrgp*rnorm) {
+    if (_iterative_residual_update(n_sweeps,
+                                   3*n_cells,
+                                   (cs_real_t *)rhs,
+                                   epsrgp*rnorm,
+                                   &l2_r,
+                                   &l2_residual)) {
       if (verbosity >= 2)
         bft_printf(_(" %s; variable: %s; converged in %d sweeps\n"
                      " %*s  normed residual: %11.4e; norm: %11.4e\n"),
@@ -2056,7 +2330,11 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
 
   } /* Loop on sweeps */
 
-  if (l2_residual >= epsrgp*rnorm && verbosity > -1) {
+  if (l2_r.pending)
+    l2_residual = _l2_norm_1_finish(&l2_r);
+
+  if (   l2_residual >= epsrgp*rnorm && _iter_check_interval > 0
+      && verbosity > -1) {
     bft_printf(_(" Warning:\n"
                  " --------\n"
                  "   %s; variable: %s; sweeps: %d\n"
@@ -2068,6 +2346,10 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
   if (gradient_info != NULL)
     _gradient_info_update_iter(gradient_info, n_sweeps);
 
+  BFT_FREE(cpl_grad);
+  BFT_FREE(cpl_weight);
+  BFT_FREE(cpl_pvar);
+
   BFT_FREE(rhs);
 }
 
@@ -2339,179 +2621,702 @@ _get_cell_cocg_lsq(const cs_mesh_t               *m,
 }
 
 /*----------------------------------------------------------------------------
- * Compute cell gradient using least-squares reconstruction for non-orthogonal
- * meshes (nswrgp > 1).
+ * Return interior face cell centers displacement divided by its squared
+ * norm, computing it if not present yet.
  *
- * Optionally, a volume force generating a hydrostatic pressure component
- * may be accounted for.
+ * Values are stored in non-interleaved form, so that component ll of
+ * face f_id is found at index ll*n_i_faces + f_id. This allows face loops
+ * of least squares gradients to access contiguous arrays instead of
+ * the cell centers of adjacent cells.
  *
- * cocg is computed to account for variable B.C.'s (flux).
+ * As this only depends on the interior faces geometry, it is shared by all
+ * gradient quantities (and stored with the default one).
+ * When mesh quantities are mapped to the OpenMP target device, it is
+ * also mapped there.
  *
  * parameters:
- *   m              <-- pointer to associated mesh structure
- *   fvq            <-- pointer to associated finite volume quantities
- *   cpl            <-- structure associated with internal coupling, or NULL
- *   halo_type      <-- halo type (extended or not)
- *   recompute_cocg <-- flag to recompute cocg
- *   idimtr         <-- 0 if ivar does not match a vector or tensor
- *                        or there is no periodicity of rotation
- *                      1 for velocity, 2 for Reynolds stress
- *   hyd_p_flag     <-- flag for hydrostatic pressure
- *   inc            <-- if 0, solve on increment; 1 otherwise
- *   fext           <-- exterior force generating pressure
- *   coefap         <-- B.C. coefficients for boundary face normals
- *   coefbp         <-- B.C. coefficients for boundary face normals
- *   pvar           <-- variable
- *   c_weight       <-- weighted gradient coefficient variable,
- *                      or NULL
- *   grad           <-> gradient of pvar (halo prepared for periodicity
- *                      of rotation)
+ *   m    <--  mesh
+ *   fvq  <--  mesh quantities
+ *
+ * returns:
+ *   pointer to displacement array
+ *----------------------------------------------------------------------------*/
+
+static const cs_real_t *
+_get_i_face_dc_ddc_lsq(const cs_mesh_t             *m,
+                       const cs_mesh_quantities_t  *fvq)
+{
+  cs_gradient_quantities_t  *gq = _gradient_quantities_get(0);
+
+  if (gq->i_dc_ddc_lsq == NULL) {
+
+    const cs_lnum_t n_i_faces = m->n_i_faces;
+    const cs_lnum_2_t *restrict i_face_cells
+      = (const cs_lnum_2_t *restrict)m->i_face_cells;
+    const cs_real_3_t *restrict cell_cen
+      = (const cs_real_3_t *restrict)fvq->cell_cen;
+
+    cs_real_t *restrict i_dc_ddc;
+    BFT_MALLOC(i_dc_ddc, n_i_faces*3, cs_real_t);
+
+#   pragma omp parallel for if(n_i_faces > CS_THR_MIN)
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+
+      cs_real_t dc[3];
+      cs_lnum_t ii = i_face_cells[f_id][0];
+      cs_lnum_t jj = i_face_cells[f_id][1];
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+      cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        i_dc_ddc[ll*n_i_faces + f_id] = dc[ll] * ddc;
+
+    }
+
+    gq->i_dc_ddc_lsq = i_dc_ddc;
+
+#if defined(HAVE_OPENMP_TARGET)
+    if (fvq->device_mapped) {
+      cs_lnum_t n = n_i_faces*3;
+#     pragma omp target enter data map(to:i_dc_ddc[0:n])
+      _i_dc_ddc_lsq_device_size = n;
+    }
+#endif
+
+  }
+
+  return gq->i_dc_ddc_lsq;
+}
+
+/*----------------------------------------------------------------------------
+ * Recompute cocg at boundary cells for the scalar gradient least squares
+ * algorithm, using saved cocgb and the given boundary condition coefficients.
+ *
+ * parameters:
+ *   m       <--  mesh
+ *   fvq     <--  mesh quantities
+ *   cpl     <--  structure associated with internal coupling, or NULL
+ *   coefbp  <--  B.C. coefficients for boundary face normals
+ *   cocgb   <--  saved partial boundary cocg
+ *   cocg    <->  cocg (updated at boundary cells)
  *----------------------------------------------------------------------------*/
 
 static void
-_lsq_scalar_gradient(const cs_mesh_t                *m,
-                     const cs_mesh_quantities_t     *fvq,
-                     const cs_internal_coupling_t   *cpl,
-                     cs_halo_type_t                  halo_type,
-                     bool                            recompute_cocg,
-                     int                             idimtr,
-                     int                             hyd_p_flag,
-                     cs_real_t                       inc,
-                     const cs_real_3_t               f_ext[],
-                     const cs_real_t                 coefap[],
-                     const cs_real_t                 coefbp[],
-                     const cs_real_t                 pvar[],
-                     const cs_real_t       *restrict c_weight,
-                     cs_real_3_t           *restrict grad)
+_recompute_lsq_scalar_cocg(const cs_mesh_t                *m,
+                           const cs_mesh_quantities_t     *fvq,
+                           const cs_internal_coupling_t   *cpl,
+                           const cs_real_t                 coefbp[],
+                           const cs_real_33_t    *restrict cocgb,
+                           cs_real_33_t          *restrict cocg)
 {
-  const cs_lnum_t n_cells = m->n_cells;
-  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
-  const int n_i_groups = m->i_face_numbering->n_groups;
-  const int n_i_threads = m->i_face_numbering->n_threads;
   const int n_b_groups = m->b_face_numbering->n_groups;
   const int n_b_threads = m->b_face_numbering->n_threads;
-  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
   const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
 
-  const cs_lnum_2_t *restrict i_face_cells
-    = (const cs_lnum_2_t *restrict)m->i_face_cells;
   const cs_lnum_t *restrict b_face_cells
     = (const cs_lnum_t *restrict)m->b_face_cells;
-  const cs_lnum_t *restrict cell_cells_idx
-    = (const cs_lnum_t *restrict)m->cell_cells_idx;
-  const cs_lnum_t *restrict cell_cells_lst
-    = (const cs_lnum_t *restrict)m->cell_cells_lst;
 
-  const cs_real_3_t *restrict cell_cen
-    = (const cs_real_3_t *restrict)fvq->cell_cen;
   const cs_real_3_t *restrict b_face_normal
     = (const cs_real_3_t *restrict)fvq->b_face_normal;
   const cs_real_t *restrict b_face_surf
     = (const cs_real_t *restrict)fvq->b_face_surf;
   const cs_real_t *restrict b_dist
     = (const cs_real_t *restrict)fvq->b_dist;
-  const cs_real_3_t *restrict i_face_cog
-    = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict b_face_cog
-    = (const cs_real_3_t *restrict)fvq->b_face_cog;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
-  const cs_real_t *restrict weight = fvq->weight;
 
-  cs_real_33_t   *restrict cocgb = NULL;
-  cs_real_33_t   *restrict cocg = NULL;
+  const bool  *coupled_faces = (cpl == NULL) ?
+    NULL : (const bool *)cpl->coupled_faces;
 
-  _get_cell_cocg_lsq(m,
-                     halo_type,
-                     fvq,
-                     cpl,
-                     &cocg,
-                     &cocgb);
+  /* Recompute cocg at boundaries, using saved cocgb */
 
-  int        g_id, t_id;
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
+    cs_lnum_t c_id = m->b_cells[ii];
+    for (cs_lnum_t ll = 0; ll < 3; ll++) {
+      for (cs_lnum_t mm = 0; mm < 3; mm++)
+        cocg[c_id][ll][mm] = cocgb[ii][ll][mm];
+    }
+  }
 
-  /*Additional terms due to porosity */
-  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-  cs_real_t *i_poro_duq_0;
-  cs_real_t *i_poro_duq_1;
-  cs_real_t *b_poro_duq;
-  cs_real_t _f_ext = 0.;
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-  int is_porous = 0;
-  if (f_i_poro_duq_0 != NULL) {
-    is_porous = 1;
-    i_poro_duq_0 = f_i_poro_duq_0->val;
-    i_poro_duq_1 = cs_field_by_name("i_poro_duq_1")->val;
-    b_poro_duq = cs_field_by_name("b_poro_duq")->val;
-  } else {
-    i_poro_duq_0 = &_f_ext;
-    i_poro_duq_1 = &_f_ext;
-    b_poro_duq = &_f_ext;
-  }
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
 
-  bool  *coupled_faces = (cpl == NULL) ?
-    NULL : (bool *)cpl->coupled_faces;
+        if (cpl == NULL || !coupled_faces[f_id]) {
 
-  /* Reconstruct gradients using least squares for non-orthogonal meshes */
-  /*---------------------------------------------------------------------*/
+          cs_lnum_t ii = b_face_cells[f_id];
 
-  /* Compute cocg and save contribution at boundaries */
+          cs_real_t umcbdd = (1. - coefbp[f_id]) / b_dist[f_id];
+          cs_real_t udbfs = 1. / b_face_surf[f_id];
 
-  if (recompute_cocg) {
+          cs_real_t dddij[3];
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dddij[ll] =   udbfs * b_face_normal[f_id][ll]
+                        + umcbdd * diipb[f_id][ll];
 
-    /* Recompute cocg at boundaries, using saved cocgb */
+          for (cs_lnum_t ll = 0; ll < 3; ll++) {
+            for (cs_lnum_t mm = 0; mm < 3; mm++)
+              cocg[ii][ll][mm] += dddij[ll]*dddij[mm];
+          }
+
+        }  /* face without internal coupling */
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
+    cs_lnum_t c_id = m->b_cells[ii];
+    cs_math_33_inv_cramer_sym_in_place(cocg[c_id]);
+  }
+}
+
+#if defined(HAVE_OPENMP_TARGET)
+
+/*----------------------------------------------------------------------------
+ * Compute cell gradient using least-squares reconstruction on the OpenMP
+ * target device, for the standard case (no hydrostatic pressure and no
+ * internal coupling).
+ *
+ * Mesh connectivity and quantities are expected to be present on the
+ * device (see cs_mesh_quantities_device_map), so only the variable,
+ * weights, boundary condition coefficients, cocg and the resulting gradient
+ * are transferred. Face contributions are scattered to cells using atomic
+ * updates, so the face numbering groups are not used.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   coefap         <-- B.C. coefficients for boundary face normals
+ *   coefbp         <-- B.C. coefficients for boundary face normals
+ *   pvar           <-- variable
+ *   c_weight       <-- weighted gradient coefficient variable, or NULL
+ *   cocg           <-- inverse of least squares cocg matrix
+ *   i_dc_ddc       <-- interior face cell centers displacement divided
+ *                      by its squared norm (non-interleaved)
+ *   grad           --> gradient of pvar (halo not synchronized)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient_target(const cs_mesh_t              *m,
+                            const cs_mesh_quantities_t   *fvq,
+                            cs_halo_type_t                halo_type,
+                            cs_real_t                     inc,
+                            const cs_real_t               coefap[],
+                            const cs_real_t               coefbp[],
+                            const cs_real_t               pvar[],
+                            const cs_real_t     *restrict c_weight,
+                            const cs_real_33_t  *restrict cocg,
+                            const cs_real_t     *restrict i_dc_ddc,
+                            cs_real_3_t         *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf = fvq->b_face_surf;
+  const cs_real_t *restrict b_dist = fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+  const cs_real_t *restrict weight = fvq->weight;
+
+  /* Extended neighborhood (zero-sized sections when not used) */
+
+  const bool extended = (   halo_type == CS_HALO_EXTENDED
+                         && m->cell_cells_idx != NULL) ? true : false;
+  const cs_lnum_t *restrict cell_cells_idx = m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst = m->cell_cells_lst;
+  const cs_lnum_t n_cc_idx = (extended) ? n_cells + 1 : 0;
+  const cs_lnum_t n_cc_lst = (extended) ? cell_cells_idx[n_cells] : 0;
+
+  const bool has_weight = (c_weight != NULL) ? true : false;
+  const cs_lnum_t n_w = (has_weight) ? n_cells_ext : 0;
+
+  cs_real_3_t *restrict rhsv;
+  BFT_MALLOC(rhsv, n_cells_ext, cs_real_3_t);
+
+# pragma omp target data \
+    map(to: i_face_cells[0:n_i_faces], b_face_cells[0:n_b_faces], \
+            cell_cells_idx[0:n_cc_idx], cell_cells_lst[0:n_cc_lst], \
+            cell_cen[0:n_cells_ext], weight[0:n_i_faces], \
+            b_face_normal[0:n_b_faces], b_face_surf[0:n_b_faces], \
+            b_dist[0:n_b_faces], diipb[0:n_b_faces], \
+            i_dc_ddc[0:3*n_i_faces], \
+            pvar[0:n_cells_ext], c_weight[0:n_w], \
+            coefap[0:n_b_faces], coefbp[0:n_b_faces], cocg[0:n_cells]) \
+    map(alloc: rhsv[0:n_cells_ext]) \
+    map(from: grad[0:n_cells])
+  {
+
+#   pragma omp target teams distribute parallel for
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+      rhsv[c_id][0] = 0.0;
+      rhsv[c_id][1] = 0.0;
+      rhsv[c_id][2] = 0.0;
+    }
+
+    /* Contribution from interior faces */
+
+#   pragma omp target teams distribute parallel for
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+
+      cs_lnum_t ii = i_face_cells[f_id][0];
+      cs_lnum_t jj = i_face_cells[f_id][1];
+
+      /* d / ||d||^2 * (P_j - P_i) */
+      cs_real_t pfac = pvar[jj] - pvar[ii];
+
+      cs_real_t w_ii = 1., w_jj = 1.;
+      if (has_weight) {
+        cs_real_t pond = weight[f_id];
+        cs_real_t denom = 1. / (  pond       *c_weight[ii]
+                                + (1. - pond)*c_weight[jj]);
+        w_ii = c_weight[jj] * denom;
+        w_jj = c_weight[ii] * denom;
+      }
 
-#   pragma omp parallel for
-    for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
-      cs_lnum_t c_id = m->b_cells[ii];
       for (cs_lnum_t ll = 0; ll < 3; ll++) {
-        for (cs_lnum_t mm = 0; mm < 3; mm++)
-          cocg[c_id][ll][mm] = cocgb[ii][ll][mm];
+        cs_real_t fctb = i_dc_ddc[ll*n_i_faces + f_id] * pfac;
+#       pragma omp atomic
+        rhsv[ii][ll] += w_ii * fctb;
+#       pragma omp atomic
+        rhsv[jj][ll] += w_jj * fctb;
       }
+
     }
 
-    for (g_id = 0; g_id < n_b_groups; g_id++) {
+    /* Contribution from extended neighborhood */
 
-#     pragma omp parallel for
-      for (t_id = 0; t_id < n_b_threads; t_id++) {
+    if (extended) {
 
-        for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
-             f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
-             f_id++) {
+#     pragma omp target teams distribute parallel for
+      for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+        for (cs_lnum_t cidx = cell_cells_idx[ii];
+             cidx < cell_cells_idx[ii+1];
+             cidx++) {
 
-          if (cpl == NULL || !coupled_faces[f_id]) {
+          cs_lnum_t jj = cell_cells_lst[cidx];
 
-            cs_lnum_t ii = b_face_cells[f_id];
+          cs_real_t dc[3];
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
 
-            cs_real_t umcbdd = (1. - coefbp[f_id]) / b_dist[f_id];
-            cs_real_t udbfs = 1. / b_face_surf[f_id];
+          cs_real_t pfac =   (pvar[jj] - pvar[ii])
+                           / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-            cs_real_t dddij[3];
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              dddij[ll] =   udbfs * b_face_normal[f_id][ll]
-                          + umcbdd * diipb[f_id][ll];
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhsv[ii][ll] += dc[ll] * pfac;
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++) {
-              for (cs_lnum_t mm = 0; mm < 3; mm++)
-                cocg[ii][ll][mm] += dddij[ll]*dddij[mm];
-            }
+        }
+      }
 
-          }  /* face without internal coupling */
+    }
 
-        } /* loop on faces */
+    /* Contribution from boundary faces */
 
-      } /* loop on threads */
+#   pragma omp target teams distribute parallel for
+    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
 
-    } /* loop on thread groups */
+      cs_lnum_t ii = b_face_cells[f_id];
+
+      cs_real_t unddij = 1. / b_dist[f_id];
+      cs_real_t udbfs = 1. / b_face_surf[f_id];
+      cs_real_t umcbdd = (1. - coefbp[f_id]) * unddij;
+
+      cs_real_t pfac =   (coefap[f_id]*inc + (coefbp[f_id] -1.)
+                       * pvar[ii]) * unddij;
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++) {
+        cs_real_t dsij =   udbfs * b_face_normal[f_id][ll]
+                         + umcbdd*diipb[f_id][ll];
+#       pragma omp atomic
+        rhsv[ii][ll] += dsij * pfac;
+      }
+
+    }
+
+    /* Compute gradient */
+
+#   pragma omp target teams distribute parallel for
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      grad[c_id][0] =   cocg[c_id][0][0] *rhsv[c_id][0]
+                      + cocg[c_id][0][1] *rhsv[c_id][1]
+                      + cocg[c_id][0][2] *rhsv[c_id][2];
+      grad[c_id][1] =   cocg[c_id][1][0] *rhsv[c_id][0]
+                      + cocg[c_id][1][1] *rhsv[c_id][1]
+                      + cocg[c_id][1][2] *rhsv[c_id][2];
+      grad[c_id][2] =   cocg[c_id][2][0] *rhsv[c_id][0]
+                      + cocg[c_id][2][1] *rhsv[c_id][1]
+                      + cocg[c_id][2][2] *rhsv[c_id][2];
+    }
+
+  } /* end of target data region */
+
+  BFT_FREE(rhsv);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the right-hand side and first estimate of the cell gradient of
+ * a vector using least-squares reconstruction on the OpenMP target device,
+ * without internal coupling.
+ *
+ * Mesh connectivity and quantities are expected to be present on the
+ * device (see cs_mesh_quantities_device_map). The right-hand side is
+ * copied back, as the boundary cells correction is done on the host.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   coefav         <-- B.C. coefficients for boundary face normals
+ *   coefbv         <-- B.C. coefficients for boundary face normals
+ *   pvar           <-- variable
+ *   c_weight       <-- weighted gradient coefficient variable, or NULL
+ *   cocg           <-- inverse of least squares cocg matrix
+ *   rhs            --> right-hand side
+ *   gradv          --> gradient of pvar (du_i/dx_j : gradv[][i][j])
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_vector_gradient_target(const cs_mesh_t               *m,
+                            const cs_mesh_quantities_t    *fvq,
+                            const cs_halo_type_t           halo_type,
+                            const int                      inc,
+                            const cs_real_3_t    *restrict coefav,
+                            const cs_real_33_t   *restrict coefbv,
+                            const cs_real_3_t    *restrict pvar,
+                            const cs_real_t      *restrict c_weight,
+                            const cs_real_33_t   *restrict cocg,
+                            cs_real_33_t         *restrict rhs,
+                            cs_real_33_t         *restrict gradv)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict b_dist = fvq->b_dist;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+
+  /* Extended neighborhood (zero-sized sections when not used) */
+
+  const bool extended = (   halo_type == CS_HALO_EXTENDED
+                         && m->cell_cells_idx != NULL) ? true : false;
+  const cs_lnum_t *restrict cell_cells_idx = m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst = m->cell_cells_lst;
+  const cs_lnum_t n_cc_idx = (extended) ? n_cells + 1 : 0;
+  const cs_lnum_t n_cc_lst = (extended) ? cell_cells_idx[n_cells] : 0;
+
+  const bool has_weight = (c_weight != NULL) ? true : false;
+  const cs_lnum_t n_w = (has_weight) ? n_cells_ext : 0;
+
+# pragma omp target data \
+    map(to: i_face_cells[0:n_i_faces], b_face_cells[0:n_b_faces], \
+            cell_cells_idx[0:n_cc_idx], cell_cells_lst[0:n_cc_lst], \
+            cell_cen[0:n_cells_ext], weight[0:n_i_faces], \
+            b_face_normal[0:n_b_faces], b_dist[0:n_b_faces], \
+            pvar[0:n_cells_ext], c_weight[0:n_w], \
+            coefav[0:n_b_faces], coefbv[0:n_b_faces], cocg[0:n_cells]) \
+    map(from: rhs[0:n_cells_ext], gradv[0:n_cells])
+  {
+
+#   pragma omp target teams distribute parallel for
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+      for (cs_lnum_t i = 0; i < 3; i++)
+        for (cs_lnum_t j = 0; j < 3; j++)
+          rhs[c_id][i][j] = 0.0;
+    }
+
+    /* Contribution from interior faces */
+
+#   pragma omp target teams distribute parallel for
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+
+      cs_lnum_t c_id1 = i_face_cells[f_id][0];
+      cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+      cs_real_t dc[3];
+      for (cs_lnum_t i = 0; i < 3; i++)
+        dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
+
+      cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+      cs_real_t w_1 = 1., w_2 = 1.;
+      if (has_weight) {
+        cs_real_t pond = weight[f_id];
+        cs_real_t denom = 1. / (  pond       *c_weight[c_id1]
+                                + (1. - pond)*c_weight[c_id2]);
+        w_1 = c_weight[c_id2] * denom;
+        w_2 = c_weight[c_id1] * denom;
+      }
+
+      for (cs_lnum_t i = 0; i < 3; i++) {
+        cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+
+        for (cs_lnum_t j = 0; j < 3; j++) {
+          cs_real_t fctb = dc[j] * pfac;
+#         pragma omp atomic
+          rhs[c_id1][i][j] += w_1 * fctb;
+#         pragma omp atomic
+          rhs[c_id2][i][j] += w_2 * fctb;
+        }
+      }
 
-#   pragma omp parallel for
-    for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
-      cs_lnum_t c_id = m->b_cells[ii];
-      cs_math_33_inv_cramer_sym_in_place(cocg[c_id]);
     }
 
-  } /* End of recompute_cocg */
+    /* Contribution from extended neighborhood */
+
+    if (extended) {
+
+#     pragma omp target teams distribute parallel for
+      for (cs_lnum_t c_id1 = 0; c_id1 < n_cells; c_id1++) {
+        for (cs_lnum_t cidx = cell_cells_idx[c_id1];
+             cidx < cell_cells_idx[c_id1+1];
+             cidx++) {
+
+          cs_lnum_t c_id2 = cell_cells_lst[cidx];
+
+          cs_real_t dc[3];
+          for (cs_lnum_t i = 0; i < 3; i++)
+            dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
+
+          cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+          for (cs_lnum_t i = 0; i < 3; i++) {
+            cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+            for (cs_lnum_t j = 0; j < 3; j++)
+              rhs[c_id1][i][j] += dc[j] * pfac;
+          }
+        }
+      }
+
+    }
+
+    /* Contribution from boundary faces */
+
+#   pragma omp target teams distribute parallel for
+    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+
+      cs_lnum_t c_id1 = b_face_cells[f_id];
+
+      cs_real_t n_d_dist[3];
+      /* Normal is vector 0 if the b_face_normal norm is too small */
+      cs_math_3_normalise(b_face_normal[f_id], n_d_dist);
+
+      cs_real_t d_b_dist = 1. / b_dist[f_id];
+
+      /* Normal divided by b_dist */
+      for (cs_lnum_t i = 0; i < 3; i++)
+        n_d_dist[i] *= d_b_dist;
+
+      for (cs_lnum_t i = 0; i < 3; i++) {
+        cs_real_t pfac = (coefav[f_id][i]*inc
+             + ( coefbv[f_id][0][i] * pvar[c_id1][0]
+               + coefbv[f_id][1][i] * pvar[c_id1][1]
+               + coefbv[f_id][2][i] * pvar[c_id1][2]
+               -                      pvar[c_id1][i]));
+
+        for (cs_lnum_t j = 0; j < 3; j++) {
+#         pragma omp atomic
+          rhs[c_id1][i][j] += n_d_dist[j] * pfac;
+        }
+      }
+
+    }
+
+    /* Compute gradient */
+
+#   pragma omp target teams distribute parallel for
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (cs_lnum_t j = 0; j < 3; j++) {
+        for (cs_lnum_t i = 0; i < 3; i++) {
+
+          gradv[c_id][i][j] = 0.0;
+
+          for (cs_lnum_t k = 0; k < 3; k++)
+            gradv[c_id][i][j] += rhs[c_id][i][k] * cocg[c_id][k][j];
+
+        }
+      }
+    }
+
+  } /* end of target data region */
+}
+
+#endif /* defined(HAVE_OPENMP_TARGET) */
+
+/*----------------------------------------------------------------------------
+ * Compute cell gradient using least-squares reconstruction for non-orthogonal
+ * meshes (nswrgp > 1).
+ *
+ * Optionally, a volume force generating a hydrostatic pressure component
+ * may be accounted for.
+ *
+ * cocg is computed to account for variable B.C.'s (flux).
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   cpl            <-- structure associated with internal coupling, or NULL
+ *   halo_type      <-- halo type (extended or not)
+ *   recompute_cocg <-- flag to recompute cocg
+ *   idimtr         <-- 0 if ivar does not match a vector or tensor
+ *                        or there is no periodicity of rotation
+ *                      1 for velocity, 2 for Reynolds stress
+ *   hyd_p_flag     <-- flag for hydrostatic pressure
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   fext           <-- exterior force generating pressure
+ *   coefap         <-- B.C. coefficients for boundary face normals
+ *   coefbp         <-- B.C. coefficients for boundary face normals
+ *   pvar           <-- variable
+ *   c_weight       <-- weighted gradient coefficient variable,
+ *                      or NULL
+ *   grad           <-> gradient of pvar (halo prepared for periodicity
+ *                      of rotation)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient(const cs_mesh_t                *m,
+                     const cs_mesh_quantities_t     *fvq,
+                     const cs_internal_coupling_t   *cpl,
+                     cs_halo_type_t                  halo_type,
+                     bool                            recompute_cocg,
+                     int                             idimtr,
+                     int                             hyd_p_flag,
+                     cs_real_t                       inc,
+                     const cs_real_3_t               f_ext[],
+                     const cs_real_t                 coefap[],
+                     const cs_real_t                 coefbp[],
+                     const cs_real_t                 pvar[],
+                     const cs_real_t       *restrict c_weight,
+                     cs_real_3_t           *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict b_face_cog
+    = (const cs_real_3_t *restrict)fvq->b_face_cog;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+  const cs_real_t *restrict weight = fvq->weight;
+
+  cs_real_33_t   *restrict cocgb = NULL;
+  cs_real_33_t   *restrict cocg = NULL;
+
+  _get_cell_cocg_lsq(m,
+                     halo_type,
+                     fvq,
+                     cpl,
+                     &cocg,
+                     &cocgb);
+
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_real_t *restrict i_dc_ddc = _get_i_face_dc_ddc_lsq(m, fvq);
+
+  int        g_id, t_id;
+
+  /*Additional terms due to porosity */
+  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
+
+  cs_real_t *i_poro_duq_0;
+  cs_real_t *i_poro_duq_1;
+  cs_real_t *b_poro_duq;
+  cs_real_t _f_ext = 0.;
+
+  int is_porous = 0;
+  if (f_i_poro_duq_0 != NULL) {
+    is_porous = 1;
+    i_poro_duq_0 = f_i_poro_duq_0->val;
+    i_poro_duq_1 = cs_field_by_name("i_poro_duq_1")->val;
+    b_poro_duq = cs_field_by_name("b_poro_duq")->val;
+  } else {
+    i_poro_duq_0 = &_f_ext;
+    i_poro_duq_1 = &_f_ext;
+    b_poro_duq = &_f_ext;
+  }
+
+  bool  *coupled_faces = (cpl == NULL) ?
+    NULL : (bool *)cpl->coupled_faces;
+
+  /* Reconstruct gradients using least squares for non-orthogonal meshes */
+  /*---------------------------------------------------------------------*/
+
+  /* Compute cocg and save contribution at boundaries */
+
+  if (recompute_cocg)
+    _recompute_lsq_scalar_cocg(m, fvq, cpl, coefbp, cocgb, cocg);
+
+#if defined(HAVE_OPENMP_TARGET)
+
+  /* Offload standard case when mesh quantities are on the device */
+
+  if (fvq->device_mapped && hyd_p_flag == 0 && cpl == NULL) {
+    _lsq_scalar_gradient_target(m, fvq, halo_type, inc,
+                                coefap, coefbp, pvar, c_weight,
+                                (const cs_real_33_t *)cocg, i_dc_ddc, grad);
+    _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
+    return;
+  }
+
+#endif
 
   /* Compute Right-Hand Side */
   /*-------------------------*/
@@ -2532,6 +3337,14 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   if (hyd_p_flag == 0) {
 
+    /* Values at distant side of coupled faces */
+
+    cs_real_t *cpl_pvar = NULL, *cpl_weight = NULL;
+
+    if (cpl != NULL)
+      _internal_coupling_face_values(cpl, c_weight, pvar,
+                                     &cpl_pvar, &cpl_weight, NULL);
+
     /* Contribution from interior faces */
 
     for (g_id = 0; g_id < n_i_groups; g_id++) {
@@ -2546,21 +3359,16 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
           cs_lnum_t ii = i_face_cells[f_id][0];
           cs_lnum_t jj = i_face_cells[f_id][1];
 
-          cs_real_t pond = weight[f_id];
-
-          cs_real_t pfac, dc[3], fctb[4];
-
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
-
-          if (c_weight != NULL) {
-            /* (P_j - P_i) / ||d||^2 */
-            pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          cs_real_t pfac, fctb[4];
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              fctb[ll] = dc[ll] * pfac;
+          /* d / ||d||^2 * (P_j - P_i) */
+          pfac = rhsv[jj][3] - rhsv[ii][3];
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            fctb[ll] = i_dc_ddc[ll*n_i_faces + f_id] * pfac;
 
+          if (c_weight != NULL) {
+            cs_real_t pond = weight[f_id];
             cs_real_t denom = 1. / (  pond       *c_weight[ii]
                                     + (1. - pond)*c_weight[jj]);
 
@@ -2571,13 +3379,6 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
               rhsv[jj][ll] +=  c_weight[ii] * denom * fctb[ll];
           }
           else {
-            /* (P_j - P_i) / ||d||^2 */
-            pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
-
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              fctb[ll] = dc[ll] * pfac;
-
             for (cs_lnum_t ll = 0; ll < 3; ll++)
               rhsv[ii][ll] += fctb[ll];
 
@@ -2622,13 +3423,7 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
     } /* End for extended neighborhood */
 
-    /* Contribution from coupled faces */
-
-    if (cpl != NULL)
-      cs_internal_coupling_lsq_scalar_gradient
-        (cpl, c_weight, 1, rhsv);
-
-    /* Contribution from boundary faces */
+    /* Contribution from boundary and coupled faces */
 
     for (g_id = 0; g_id < n_b_groups; g_id++) {
 
@@ -2660,12 +3455,37 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
           } /* face without internal coupling */
 
+          else {
+
+            cs_lnum_t ii = b_face_cells[f_id];
+            cs_lnum_t l_id = cpl->b_face_local_id[f_id];
+            const cs_real_t *dc = cpl->ci_cj_vect[l_id];
+
+            /* (P_j - P_i) / ||d||^2 */
+            cs_real_t pfac =   (cpl_pvar[l_id] - rhsv[ii][3])
+                             / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+            /* Physical face weight already contains denom */
+            if (c_weight != NULL) {
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[ii][ll] += cpl_weight[l_id] * (dc[ll] * pfac);
+            }
+            else {
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[ii][ll] += dc[ll] * pfac;
+            }
+
+          } /* face with internal coupling */
+
         } /* loop on faces */
 
       } /* loop on threads */
 
     } /* loop on thread groups */
 
+    BFT_FREE(cpl_weight);
+    BFT_FREE(cpl_pvar);
+
   }
 
   /* Case with hydrostatic pressure */
@@ -2694,184 +3514,436 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
           cs_real_t pond = weight[f_id];
 
+          cs_real_t pfac, fctb[4];
+
+          pfac =   rhsv[jj][3] - rhsv[ii][3]
+                 + (cell_cen[ii][0] - i_face_cog[f_id][0]) * f_ext[ii][0]
+                 + (cell_cen[ii][1] - i_face_cog[f_id][1]) * f_ext[ii][1]
+                 + (cell_cen[ii][2] - i_face_cog[f_id][2]) * f_ext[ii][2]
+                 + poro[0]
+                 - (cell_cen[jj][0] - i_face_cog[f_id][0]) * f_ext[jj][0]
+                 - (cell_cen[jj][1] - i_face_cog[f_id][1]) * f_ext[jj][1]
+                 - (cell_cen[jj][2] - i_face_cog[f_id][2]) * f_ext[jj][2]
+                 - poro[1];
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            fctb[ll] = i_dc_ddc[ll*n_i_faces + f_id] * pfac;
+
+          if (c_weight != NULL) {
+              cs_real_t denom = 1. / (  pond       *c_weight[ii]
+                                      + (1. - pond)*c_weight[jj]);
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[ii][ll] += c_weight[jj] * denom * fctb[ll];
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[jj][ll] += c_weight[ii] * denom * fctb[ll];
+          }
+          else { // no cell weighting
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              rhsv[ii][ll] += fctb[ll];
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              rhsv[jj][ll] += fctb[ll];
+          }
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+    /* Contribution from extended neighborhood;
+       We assume that the middle of the segment joining cell centers
+       may replace the center of gravity of a fictitious face. */
+
+    if (halo_type == CS_HALO_EXTENDED && cell_cells_idx != NULL) {
+
+#     pragma omp parallel for
+      for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+        for (cs_lnum_t cidx = cell_cells_idx[ii];
+             cidx < cell_cells_idx[ii+1];
+             cidx++) {
+
+          cs_lnum_t jj = cell_cells_lst[cidx];
+
+          /* Note: replaced the expressions:
+           *  a) ptmid = 0.5 * (cell_cen[jj] - cell_cen[ii])
+           *  b)   (cell_cen[ii] - ptmid) * f_ext[ii]
+           *  c) - (cell_cen[jj] - ptmid) * f_ext[jj]
+           * with:
+           *  a) dc = cell_cen[jj] - cell_cen[ii]
+           *  b) - 0.5 * dc * f_ext[ii]
+           *  c) - 0.5 * dc * f_ext[jj]
+           */
+
           cs_real_t pfac, dc[3], fctb[4];
 
           for (cs_lnum_t ll = 0; ll < 3; ll++)
             dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
 
           pfac =   (  rhsv[jj][3] - rhsv[ii][3]
-                    + (cell_cen[ii][0] - i_face_cog[f_id][0]) * f_ext[ii][0]
-                    + (cell_cen[ii][1] - i_face_cog[f_id][1]) * f_ext[ii][1]
-                    + (cell_cen[ii][2] - i_face_cog[f_id][2]) * f_ext[ii][2]
-                    + poro[0]
-                    - (cell_cen[jj][0] - i_face_cog[f_id][0]) * f_ext[jj][0]
-                    - (cell_cen[jj][1] - i_face_cog[f_id][1]) * f_ext[jj][1]
-                    - (cell_cen[jj][2] - i_face_cog[f_id][2]) * f_ext[jj][2]
-                    - poro[1])
+                    - 0.5 * dc[0] * f_ext[ii][0]
+                    - 0.5 * dc[1] * f_ext[ii][1]
+                    - 0.5 * dc[2] * f_ext[ii][2]
+                    - 0.5 * dc[0] * f_ext[jj][0]
+                    - 0.5 * dc[1] * f_ext[jj][1]
+                    - 0.5 * dc[2] * f_ext[jj][2])
                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            fctb[ll] = dc[ll] * pfac;
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            fctb[ll] = dc[ll] * pfac;
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhsv[ii][ll] += fctb[ll];
+
+        }
+      }
+
+    } /* End for extended neighborhood */
+
+    /* Contribution from boundary faces */
+
+    for (g_id = 0; g_id < n_b_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (t_id = 0; t_id < n_b_threads; t_id++) {
+
+        for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             f_id++) {
+
+          cs_lnum_t ii = b_face_cells[f_id];
+
+          cs_real_t poro = b_poro_duq[is_porous*f_id];
+
+          cs_real_t unddij = 1. / b_dist[f_id];
+          cs_real_t udbfs = 1. / b_face_surf[f_id];
+          cs_real_t umcbdd = (1. - coefbp[f_id]) * unddij;
+
+          cs_real_t dsij[3];
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dsij[ll] =   udbfs * b_face_normal[f_id][ll]
+                       + umcbdd*diipb[f_id][ll];
+
+          cs_real_t pfac
+            =   (coefap[f_id]*inc
+              + (  (coefbp[f_id] -1.)
+                 * (  rhsv[ii][3]
+                    + (b_face_cog[f_id][0] - cell_cen[ii][0]) * f_ext[ii][0]
+                    + (b_face_cog[f_id][1] - cell_cen[ii][1]) * f_ext[ii][1]
+                    + (b_face_cog[f_id][2] - cell_cen[ii][2]) * f_ext[ii][2]
+                    + poro)))
+              * unddij;
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhsv[ii][ll] += dsij[ll] * pfac;
+
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+  } /* End of test on hydrostatic pressure */
+
+  /* Compute gradient */
+  /*------------------*/
+
+  if (hyd_p_flag == 1) {
+
+#   pragma omp parallel for
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      grad[c_id][0] =   cocg[c_id][0][0] *rhsv[c_id][0]
+                      + cocg[c_id][0][1] *rhsv[c_id][1]
+                      + cocg[c_id][0][2] *rhsv[c_id][2]
+                      + f_ext[c_id][0];
+      grad[c_id][1] =   cocg[c_id][1][0] *rhsv[c_id][0]
+                      + cocg[c_id][1][1] *rhsv[c_id][1]
+                      + cocg[c_id][1][2] *rhsv[c_id][2]
+                      + f_ext[c_id][1];
+      grad[c_id][2] =   cocg[c_id][2][0] *rhsv[c_id][0]
+                      + cocg[c_id][2][1] *rhsv[c_id][1]
+                      + cocg[c_id][2][2] *rhsv[c_id][2]
+                      + f_ext[c_id][2];
+    }
+
+  }
+  else {
+
+#   pragma omp parallel for
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      grad[c_id][0] =   cocg[c_id][0][0] *rhsv[c_id][0]
+                      + cocg[c_id][0][1] *rhsv[c_id][1]
+                      + cocg[c_id][0][2] *rhsv[c_id][2];
+      grad[c_id][1] =   cocg[c_id][1][0] *rhsv[c_id][0]
+                      + cocg[c_id][1][1] *rhsv[c_id][1]
+                      + cocg[c_id][1][2] *rhsv[c_id][2];
+      grad[c_id][2] =   cocg[c_id][2][0] *rhsv[c_id][0]
+                      + cocg[c_id][2][1] *rhsv[c_id][1]
+                      + cocg[c_id][2][2] *rhsv[c_id][2];
+    }
+
+  }
+
+  /* Synchronize halos */
+
+  _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
+
+  BFT_FREE(rhsv);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of multiple scalar fields using least-squares
+ * reconstruction for non-orthogonal meshes (nswrgp > 1).
+ *
+ * Gradients of all fields are computed in a single sweep over faces, so
+ * mesh connectivity and geometric quantities are read only once.
+ * Values are interleaved, so that the value of field k at cell c_id
+ * is var[c_id*stride + k].
+ *
+ * Hydrostatic pressure, weighting and internal coupling are not handled
+ * here (see _lsq_scalar_gradient).
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   recompute_cocg <-- flag to recompute cocg
+ *   n_fields       <-- number of fields
+ *   stride         <-- stride of interleaved variables (>= n_fields)
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   coefap         <-- B.C. coefficients for boundary face normals,
+ *                      for each field
+ *   coefbp         <-- B.C. coefficients for boundary face normals,
+ *                      for each field
+ *   var            <-- interleaved variables (synchronized)
+ *   grad           --> gradient for each field (halo not synchronized)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient_multi(const cs_mesh_t             *m,
+                           const cs_mesh_quantities_t  *fvq,
+                           cs_halo_type_t               halo_type,
+                           bool                         recompute_cocg,
+                           int                          n_fields,
+                           int                          stride,
+                           cs_real_t                    inc,
+                           const cs_real_t             *coefap[],
+                           const cs_real_t             *coefbp[],
+                           const cs_real_t    *restrict var,
+                           cs_real_3_t                 *grad[])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+
+  cs_real_33_t   *restrict cocgb = NULL;
+  cs_real_33_t   *restrict cocg = NULL;
+
+  _get_cell_cocg_lsq(m,
+                     halo_type,
+                     fvq,
+                     NULL,
+                     &cocg,
+                     &cocgb);
+
+  const cs_real_t *restrict i_dc_ddc = _get_i_face_dc_ddc_lsq(m, fvq);
+
+  /* Compute Right-Hand Side */
+  /*-------------------------*/
+
+  cs_real_3_t  *restrict rhsv;
+  BFT_MALLOC(rhsv, n_cells_ext*n_fields, cs_real_3_t);
+
+# pragma omp parallel for
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext*n_fields; c_id++) {
+    rhsv[c_id][0] = 0.0;
+    rhsv[c_id][1] = 0.0;
+    rhsv[c_id][2] = 0.0;
+  }
+
+  /* Contribution from interior faces */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
 
-          if (c_weight != NULL) {
-              cs_real_t denom = 1. / (  pond       *c_weight[ii]
-                                      + (1. - pond)*c_weight[jj]);
+        cs_lnum_t ii = i_face_cells[f_id][0];
+        cs_lnum_t jj = i_face_cells[f_id][1];
 
-              for (cs_lnum_t ll = 0; ll < 3; ll++)
-                rhsv[ii][ll] += c_weight[jj] * denom * fctb[ll];
+        const cs_real_t dc_ddc_x = i_dc_ddc[f_id];
+        const cs_real_t dc_ddc_y = i_dc_ddc[n_i_faces + f_id];
+        const cs_real_t dc_ddc_z = i_dc_ddc[2*n_i_faces + f_id];
 
-              for (cs_lnum_t ll = 0; ll < 3; ll++)
-                rhsv[jj][ll] += c_weight[ii] * denom * fctb[ll];
-          }
-          else { // no cell weighting
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[ii][ll] += fctb[ll];
+        const cs_real_t *restrict var_i = var + ii*stride;
+        const cs_real_t *restrict var_j = var + jj*stride;
+        cs_real_t *restrict rhsv_i = (cs_real_t *)(rhsv + ii*n_fields);
+        cs_real_t *restrict rhsv_j = (cs_real_t *)(rhsv + jj*n_fields);
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[jj][ll] += fctb[ll];
-          }
-        } /* loop on faces */
+        for (int k = 0; k < n_fields; k++) {
 
-      } /* loop on threads */
+          /* d / ||d||^2 * (P_j - P_i) */
+          cs_real_t pfac = var_j[k] - var_i[k];
 
-    } /* loop on thread groups */
+          cs_real_t fctb_x = dc_ddc_x * pfac;
+          cs_real_t fctb_y = dc_ddc_y * pfac;
+          cs_real_t fctb_z = dc_ddc_z * pfac;
 
-    /* Contribution from extended neighborhood;
-       We assume that the middle of the segment joining cell centers
-       may replace the center of gravity of a fictitious face. */
+          rhsv_i[3*k]     += fctb_x;
+          rhsv_i[3*k + 1] += fctb_y;
+          rhsv_i[3*k + 2] += fctb_z;
+          rhsv_j[3*k]     += fctb_x;
+          rhsv_j[3*k + 1] += fctb_y;
+          rhsv_j[3*k + 2] += fctb_z;
 
-    if (halo_type == CS_HALO_EXTENDED && cell_cells_idx != NULL) {
+        }
 
-#     pragma omp parallel for
-      for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
-        for (cs_lnum_t cidx = cell_cells_idx[ii];
-             cidx < cell_cells_idx[ii+1];
-             cidx++) {
+      } /* loop on faces */
 
-          cs_lnum_t jj = cell_cells_lst[cidx];
+    } /* loop on threads */
 
-          /* Note: replaced the expressions:
-           *  a) ptmid = 0.5 * (cell_cen[jj] - cell_cen[ii])
-           *  b)   (cell_cen[ii] - ptmid) * f_ext[ii]
-           *  c) - (cell_cen[jj] - ptmid) * f_ext[jj]
-           * with:
-           *  a) dc = cell_cen[jj] - cell_cen[ii]
-           *  b) - 0.5 * dc * f_ext[ii]
-           *  c) - 0.5 * dc * f_ext[jj]
-           */
+  } /* loop on thread groups */
 
-          cs_real_t pfac, dc[3], fctb[4];
+  /* Contribution from extended neighborhood */
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+  if (halo_type == CS_HALO_EXTENDED && cell_cells_idx != NULL) {
 
-          pfac =   (  rhsv[jj][3] - rhsv[ii][3]
-                    - 0.5 * dc[0] * f_ext[ii][0]
-                    - 0.5 * dc[1] * f_ext[ii][1]
-                    - 0.5 * dc[2] * f_ext[ii][2]
-                    - 0.5 * dc[0] * f_ext[jj][0]
-                    - 0.5 * dc[1] * f_ext[jj][1]
-                    - 0.5 * dc[2] * f_ext[jj][2])
-                  / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++) {
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            fctb[ll] = dc[ll] * pfac;
+        cs_lnum_t jj = cell_cells_lst[cidx];
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            rhsv[ii][ll] += fctb[ll];
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
+        for (int k = 0; k < n_fields; k++) {
+          cs_real_t pfac = (var[jj*stride + k] - var[ii*stride + k]) * ddc;
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhsv[ii*n_fields + k][ll] += dc[ll] * pfac;
         }
+
       }
+    }
 
-    } /* End for extended neighborhood */
+  } /* End for extended neighborhood */
 
-    /* Contribution from boundary faces */
+  /* Contribution from boundary faces */
 
-    for (g_id = 0; g_id < n_b_groups; g_id++) {
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-#     pragma omp parallel for
-      for (t_id = 0; t_id < n_b_threads; t_id++) {
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-        for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
-             f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
-             f_id++) {
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
 
-          cs_lnum_t ii = b_face_cells[f_id];
+        cs_lnum_t ii = b_face_cells[f_id];
 
-          cs_real_t poro = b_poro_duq[is_porous*f_id];
+        cs_real_t unddij = 1. / b_dist[f_id];
+        cs_real_t udbfs = 1. / b_face_surf[f_id];
 
-          cs_real_t unddij = 1. / b_dist[f_id];
-          cs_real_t udbfs = 1. / b_face_surf[f_id];
-          cs_real_t umcbdd = (1. - coefbp[f_id]) * unddij;
+        for (int k = 0; k < n_fields; k++) {
+
+          cs_real_t umcbdd = (1. - coefbp[k][f_id]) * unddij;
 
           cs_real_t dsij[3];
           for (cs_lnum_t ll = 0; ll < 3; ll++)
             dsij[ll] =   udbfs * b_face_normal[f_id][ll]
                        + umcbdd*diipb[f_id][ll];
 
-          cs_real_t pfac
-            =   (coefap[f_id]*inc
-              + (  (coefbp[f_id] -1.)
-                 * (  rhsv[ii][3]
-                    + (b_face_cog[f_id][0] - cell_cen[ii][0]) * f_ext[ii][0]
-                    + (b_face_cog[f_id][1] - cell_cen[ii][1]) * f_ext[ii][1]
-                    + (b_face_cog[f_id][2] - cell_cen[ii][2]) * f_ext[ii][2]
-                    + poro)))
-              * unddij;
+          cs_real_t pfac =   (coefap[k][f_id]*inc + (coefbp[k][f_id] -1.)
+                           * var[ii*stride + k]) * unddij;
 
           for (cs_lnum_t ll = 0; ll < 3; ll++)
-            rhsv[ii][ll] += dsij[ll] * pfac;
+            rhsv[ii*n_fields + k][ll] += dsij[ll] * pfac;
 
-        } /* loop on faces */
+        }
 
-      } /* loop on threads */
+      } /* loop on faces */
 
-    } /* loop on thread groups */
+    } /* loop on threads */
 
-  } /* End of test on hydrostatic pressure */
+  } /* loop on thread groups */
 
   /* Compute gradient */
   /*------------------*/
 
-  if (hyd_p_flag == 1) {
+  for (int k = 0; k < n_fields; k++) {
+
+    cs_real_3_t *restrict _grad = grad[k];
 
 #   pragma omp parallel for
     for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      grad[c_id][0] =   cocg[c_id][0][0] *rhsv[c_id][0]
-                      + cocg[c_id][0][1] *rhsv[c_id][1]
-                      + cocg[c_id][0][2] *rhsv[c_id][2]
-                      + f_ext[c_id][0];
-      grad[c_id][1] =   cocg[c_id][1][0] *rhsv[c_id][0]
-                      + cocg[c_id][1][1] *rhsv[c_id][1]
-                      + cocg[c_id][1][2] *rhsv[c_id][2]
-                      + f_ext[c_id][1];
-      grad[c_id][2] =   cocg[c_id][2][0] *rhsv[c_id][0]
-                      + cocg[c_id][2][1] *rhsv[c_id][1]
-                      + cocg[c_id][2][2] *rhsv[c_id][2]
-                      + f_ext[c_id][2];
+      const cs_real_t *restrict _rhsv = rhsv[c_id*n_fields + k];
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        _grad[c_id][ll] =   cocg[c_id][ll][0] *_rhsv[0]
+                          + cocg[c_id][ll][1] *_rhsv[1]
+                          + cocg[c_id][ll][2] *_rhsv[2];
     }
 
   }
-  else {
 
-#   pragma omp parallel for
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      grad[c_id][0] =   cocg[c_id][0][0] *rhsv[c_id][0]
-                      + cocg[c_id][0][1] *rhsv[c_id][1]
-                      + cocg[c_id][0][2] *rhsv[c_id][2];
-      grad[c_id][1] =   cocg[c_id][1][0] *rhsv[c_id][0]
-                      + cocg[c_id][1][1] *rhsv[c_id][1]
-                      + cocg[c_id][1][2] *rhsv[c_id][2];
-      grad[c_id][2] =   cocg[c_id][2][0] *rhsv[c_id][0]
-                      + cocg[c_id][2][1] *rhsv[c_id][1]
-                      + cocg[c_id][2][2] *rhsv[c_id][2];
-    }
+  /* As cocg at boundary cells depends on the boundary conditions,
+     update gradient at those cells for each field if required. */
 
-  }
+  if (recompute_cocg) {
 
-  /* Synchronize halos */
+    for (int k = 0; k < n_fields; k++) {
 
-  _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
+      _recompute_lsq_scalar_cocg(m, fvq, NULL, coefbp[k], cocgb, cocg);
+
+      cs_real_3_t *restrict _grad = grad[k];
+
+#     pragma omp parallel for
+      for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
+        cs_lnum_t c_id = m->b_cells[ii];
+        const cs_real_t *restrict _rhsv = rhsv[c_id*n_fields + k];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          _grad[c_id][ll] =   cocg[c_id][ll][0] *_rhsv[0]
+                            + cocg[c_id][ll][1] *_rhsv[1]
+                            + cocg[c_id][ll][2] *_rhsv[2];
+      }
+
+    }
+
+  }
 
   BFT_FREE(rhsv);
 }
@@ -4040,20 +5112,6 @@ _fv_vtx_based_scalar_gradient(const cs_mesh_t                *m,
 
   /* Vertex values are not needed after this stage */
 
-  cs_real_t mean[4] = {0, 0, 0, 0};
-  for (cs_lnum_t i = 0; i < n_cells; i++)
-    mean[0] += c_var[i];
-  mean[0] /= n_cells;
-  for (cs_lnum_t i = 0; i < m->n_vertices; i++)
-    mean[1] += v_var[i];
-  mean[1] /= m->n_vertices;
-  for (cs_lnum_t i = 0; i < m->n_i_faces; i++)
-    mean[2] += i_f_var[i];
-  mean[2] /= m->n_i_faces;
-  for (cs_lnum_t i = 0; i < m->n_b_faces; i++)
-    mean[3] += b_f_var[i];
-  mean[3] /= m->n_b_faces;
-
   BFT_FREE(v_var);
 
   /* Case with hydrostatic pressure
@@ -5249,10 +6307,18 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
   /* Gradient reconstruction to handle non-orthogonal meshes */
   /*---------------------------------------------------------*/
 
-  /* L2 norm */
+  /* L2 norm (not needed with a fixed number of sweeps) */
+
+  cs_real_t l2_norm = 1.;
+  cs_real_t l2_residual = cs_math_big_r;
+
+  if (_iter_check_interval > 0) {
+    l2_norm = _l2_norm_1(9*n_cells, (cs_real_t *)grad);
+    l2_residual = l2_norm;
+  }
 
-  cs_real_t l2_norm = _l2_norm_1(9*n_cells, (cs_real_t *)grad);
-  cs_real_t l2_residual = l2_norm;
+  cs_gradient_l2_reduce_t  l2_r;
+  l2_r.pending = false;
 
   if (l2_norm > cs_math_epzero) {
 
@@ -5417,10 +6483,18 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
 
       /* Convergence test (L2 norm) */
 
-      l2_residual = _l2_norm_1(9*n_cells, (cs_real_t *)rhs);
+      _iterative_residual_update(isweep,
+                                 9*n_cells,
+                                 (cs_real_t *)rhs,
+                                 epsrgp*l2_norm,
+                                 &l2_r,
+                                 &l2_residual);
 
     } /* End of the iterative process */
 
+    if (l2_r.pending)
+      l2_residual = _l2_norm_1_finish(&l2_r);
+
     /* Printing */
 
     if (l2_residual < epsrgp*l2_norm) {
@@ -5430,7 +6504,7 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
            __func__, isweep, l2_residual/l2_norm, l2_norm, var_name);
       }
     }
-    else if (isweep >= n_r_sweeps) {
+    else if (isweep >= n_r_sweeps && _iter_check_interval > 0) {
       if (verbosity >= 0) {
         bft_printf(_(" Warning:\n"
                      " --------\n"
@@ -5531,10 +6605,18 @@ _iterative_tensor_gradient(const cs_mesh_t              *m,
   /* Gradient reconstruction to handle non-orthogonal meshes */
   /*---------------------------------------------------------*/
 
-  /* L2 norm */
+  /* L2 norm (not needed with a fixed number of sweeps) */
+
+  cs_real_t l2_norm = 1.;
+  cs_real_t l2_residual = cs_math_big_r;
+
+  if (_iter_check_interval > 0) {
+    l2_norm = _l2_norm_1(18*n_cells, (cs_real_t *)grad);
+    l2_residual = l2_norm;
+  }
 
-  cs_real_t l2_norm = _l2_norm_1(18*n_cells, (cs_real_t *)grad);
-  cs_real_t l2_residual = l2_norm ;
+  cs_gradient_l2_reduce_t  l2_r;
+  l2_r.pending = false;
 
   if (l2_norm > cs_math_epzero) {
 
@@ -5687,10 +6769,18 @@ _iterative_tensor_gradient(const cs_mesh_t              *m,
       /* Convergence test (L2 norm) */
 
       ///FIXME
-      l2_residual = _l2_norm_1(18*n_cells, (cs_real_t *)rhs);
+      _iterative_residual_update(isweep,
+                                 18*n_cells,
+                                 (cs_real_t *)rhs,
+                                 epsrgp*l2_norm,
+                                 &l2_r,
+                                 &l2_residual);
 
     } /* End of the iterative process */
 
+    if (l2_r.pending)
+      l2_residual = _l2_norm_1_finish(&l2_r);
+
     /* Printing */
 
     if (l2_residual < epsrgp*l2_norm) {
@@ -5700,7 +6790,7 @@ _iterative_tensor_gradient(const cs_mesh_t              *m,
            __func__, isweep, l2_residual/l2_norm, l2_norm, var_name);
       }
     }
-    else if (isweep >= n_r_sweeps) {
+    else if (isweep >= n_r_sweeps && _iter_check_interval > 0) {
       if (verbosity >= 0) {
         bft_printf(_(" Warning:\n"
                      " --------\n"
@@ -6208,170 +7298,192 @@ _lsq_vector_gradient(const cs_mesh_t               *m,
   bool  *coupled_faces = (cpl == NULL) ?
     NULL : (bool *)cpl->coupled_faces;
 
-  /* Compute Right-Hand Side */
-  /*-------------------------*/
+#if defined(HAVE_OPENMP_TARGET)
+  const bool on_device = (fvq->device_mapped && cpl == NULL) ? true : false;
+#else
+  const bool on_device = false;
+#endif
 
-# pragma omp parallel for
-  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-    for (cs_lnum_t i = 0; i < 3; i++)
-      for (cs_lnum_t j = 0; j < 3; j++)
-        rhs[c_id][i][j] = 0.0;
-  }
+  /* Offload computation of RHS and gradient estimate when mesh quantities
+     are on the device; boundary cells are handled on the host */
 
-  /* Contribution from interior faces */
+  if (on_device) {
 
-  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#if defined(HAVE_OPENMP_TARGET)
+    _lsq_vector_gradient_target(m, fvq, halo_type, inc,
+                                coefav, coefbv, pvar, c_weight,
+                                (const cs_real_33_t *)cocg, rhs, gradv);
+#endif
+
+  }
+  else {
+
+    /* Compute Right-Hand Side */
+    /*-------------------------*/
 
 #   pragma omp parallel for
-    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+      for (cs_lnum_t i = 0; i < 3; i++)
+        for (cs_lnum_t j = 0; j < 3; j++)
+          rhs[c_id][i][j] = 0.0;
+    }
 
-      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-           f_id++) {
+    /* Contribution from interior faces */
 
-        cs_lnum_t c_id1 = i_face_cells[f_id][0];
-        cs_lnum_t c_id2 = i_face_cells[f_id][1];
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-        cs_real_t  dc[3], fctb[3];
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-        for (cs_lnum_t i = 0; i < 3; i++)
-          dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
+        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             f_id++) {
 
-        cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          cs_lnum_t c_id1 = i_face_cells[f_id][0];
+          cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
-        if (c_weight != NULL) {
-          cs_real_t pond = weight[f_id];
-          cs_real_t denom = 1. / (  pond       *c_weight[c_id1]
-                                  + (1. - pond)*c_weight[c_id2]);
+          cs_real_t  dc[3], fctb[3];
 
-          for (cs_lnum_t i = 0; i < 3; i++) {
-            cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+          for (cs_lnum_t i = 0; i < 3; i++)
+            dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
 
-            for (cs_lnum_t j = 0; j < 3; j++) {
-              fctb[j] = dc[j] * pfac;
-              rhs[c_id1][i][j] += c_weight[c_id2] * denom * fctb[j];
-              rhs[c_id2][i][j] += c_weight[c_id1] * denom * fctb[j];
+          cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+          if (c_weight != NULL) {
+            cs_real_t pond = weight[f_id];
+            cs_real_t denom = 1. / (  pond       *c_weight[c_id1]
+                                    + (1. - pond)*c_weight[c_id2]);
+
+            for (cs_lnum_t i = 0; i < 3; i++) {
+              cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+
+              for (cs_lnum_t j = 0; j < 3; j++) {
+                fctb[j] = dc[j] * pfac;
+                rhs[c_id1][i][j] += c_weight[c_id2] * denom * fctb[j];
+                rhs[c_id2][i][j] += c_weight[c_id1] * denom * fctb[j];
+              }
             }
           }
-        }
-        else {
-          for (cs_lnum_t i = 0; i < 3; i++) {
-            cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+          else {
+            for (cs_lnum_t i = 0; i < 3; i++) {
+              cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
 
-            for (cs_lnum_t j = 0; j < 3; j++) {
-              fctb[j] = dc[j] * pfac;
-              rhs[c_id1][i][j] += fctb[j];
-              rhs[c_id2][i][j] += fctb[j];
+              for (cs_lnum_t j = 0; j < 3; j++) {
+                fctb[j] = dc[j] * pfac;
+                rhs[c_id1][i][j] += fctb[j];
+                rhs[c_id2][i][j] += fctb[j];
+              }
             }
           }
-        }
 
-      } /* loop on faces */
+        } /* loop on faces */
 
-    } /* loop on threads */
+      } /* loop on threads */
 
-  } /* loop on thread groups */
+    } /* loop on thread groups */
 
-  /* Contribution from extended neighborhood */
+    /* Contribution from extended neighborhood */
 
-  if (halo_type == CS_HALO_EXTENDED) {
+    if (halo_type == CS_HALO_EXTENDED) {
 
-#   pragma omp parallel for
-    for (cs_lnum_t c_id1 = 0; c_id1 < n_cells; c_id1++) {
-      for (cs_lnum_t cidx = cell_cells_idx[c_id1];
-           cidx < cell_cells_idx[c_id1+1];
-           cidx++) {
+#     pragma omp parallel for
+      for (cs_lnum_t c_id1 = 0; c_id1 < n_cells; c_id1++) {
+        for (cs_lnum_t cidx = cell_cells_idx[c_id1];
+             cidx < cell_cells_idx[c_id1+1];
+             cidx++) {
 
-        cs_lnum_t c_id2 = cell_cells_lst[cidx];
+          cs_lnum_t c_id2 = cell_cells_lst[cidx];
 
-        cs_real_t dc[3];
+          cs_real_t dc[3];
 
-        for (cs_lnum_t i = 0; i < 3; i++)
-          dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
+          for (cs_lnum_t i = 0; i < 3; i++)
+            dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
 
-        cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-        for (cs_lnum_t i = 0; i < 3; i++) {
+          for (cs_lnum_t i = 0; i < 3; i++) {
 
-          cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+            cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
 
-          for (cs_lnum_t j = 0; j < 3; j++) {
-            rhs[c_id1][i][j] += dc[j] * pfac;
+            for (cs_lnum_t j = 0; j < 3; j++) {
+              rhs[c_id1][i][j] += dc[j] * pfac;
+            }
           }
         }
       }
-    }
 
-  } /* End for extended neighborhood */
+    } /* End for extended neighborhood */
 
-  /* Contribution from coupled faces */
+    /* Contribution from coupled faces */
 
-  if (cpl != NULL)
-    cs_internal_coupling_lsq_vector_gradient
-      (cpl,
-       c_weight,
-       1, /* w_stride */
-       pvar,
-       rhs);
+    if (cpl != NULL)
+      cs_internal_coupling_lsq_vector_gradient
+        (cpl,
+         c_weight,
+         1, /* w_stride */
+         pvar,
+         rhs);
 
-  /* Contribution from boundary faces */
+    /* Contribution from boundary faces */
 
-  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+    for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-#   pragma omp parallel for
-    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
-           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
-           f_id++) {
+        for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             f_id++) {
 
-        if (cpl == NULL || !coupled_faces[f_id]) {
+          if (cpl == NULL || !coupled_faces[f_id]) {
 
-          cs_lnum_t c_id1 = b_face_cells[f_id];
+            cs_lnum_t c_id1 = b_face_cells[f_id];
 
-          cs_real_t n_d_dist[3];
-          /* Normal is vector 0 if the b_face_normal norm is too small */
-          cs_math_3_normalise(b_face_normal[f_id], n_d_dist);
+            cs_real_t n_d_dist[3];
+            /* Normal is vector 0 if the b_face_normal norm is too small */
+            cs_math_3_normalise(b_face_normal[f_id], n_d_dist);
 
-          cs_real_t d_b_dist = 1. / b_dist[f_id];
+            cs_real_t d_b_dist = 1. / b_dist[f_id];
 
-          /* Normal divided by b_dist */
-          for (cs_lnum_t i = 0; i < 3; i++)
-            n_d_dist[i] *= d_b_dist;
+            /* Normal divided by b_dist */
+            for (cs_lnum_t i = 0; i < 3; i++)
+              n_d_dist[i] *= d_b_dist;
 
-          for (cs_lnum_t i = 0; i < 3; i++) {
-            cs_real_t pfac = (coefav[f_id][i]*inc
-                 + ( coefbv[f_id][0][i] * pvar[c_id1][0]
-                   + coefbv[f_id][1][i] * pvar[c_id1][1]
-                   + coefbv[f_id][2][i] * pvar[c_id1][2]
-                   -                      pvar[c_id1][i]));
+            for (cs_lnum_t i = 0; i < 3; i++) {
+              cs_real_t pfac = (coefav[f_id][i]*inc
+                   + ( coefbv[f_id][0][i] * pvar[c_id1][0]
+                     + coefbv[f_id][1][i] * pvar[c_id1][1]
+                     + coefbv[f_id][2][i] * pvar[c_id1][2]
+                     -                      pvar[c_id1][i]));
 
-            for (cs_lnum_t j = 0; j < 3; j++)
-              rhs[c_id1][i][j] += n_d_dist[j] * pfac;
+              for (cs_lnum_t j = 0; j < 3; j++)
+                rhs[c_id1][i][j] += n_d_dist[j] * pfac;
+            }
           }
-        }
 
-      } /* loop on faces */
+        } /* loop on faces */
 
-    } /* loop on threads */
+      } /* loop on threads */
 
-  } /* loop on thread groups */
+    } /* loop on thread groups */
 
-  /* Compute gradient */
-  /*------------------*/
+    /* Compute gradient */
+    /*------------------*/
 
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-    for (cs_lnum_t j = 0; j < 3; j++) {
-      for (cs_lnum_t i = 0; i < 3; i++) {
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (cs_lnum_t j = 0; j < 3; j++) {
+        for (cs_lnum_t i = 0; i < 3; i++) {
 
-        gradv[c_id][i][j] = 0.0;
+          gradv[c_id][i][j] = 0.0;
 
-        for (cs_lnum_t k = 0; k < 3; k++)
-          gradv[c_id][i][j] += rhs[c_id][i][k] * cocg[c_id][k][j];
+          for (cs_lnum_t k = 0; k < 3; k++)
+            gradv[c_id][i][j] += rhs[c_id][i][k] * cocg[c_id][k][j];
 
+        }
       }
     }
-  }
+
+  } /* end of host computation */
 
   /* Compute gradient on boundary cells */
   /*------------------------------------*/
@@ -7241,6 +8353,42 @@ _initialize_tensor_gradient(const cs_mesh_t              *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Update timers and logging for gradients of multiple fields computed
+ * together, sharing elapsed time evenly between fields.
+ *
+ * parameters:
+ *   n_fields       <-- number of fields
+ *   var_name       <-- variable name for each field
+ *   gradient_type  <-- gradient type
+ *   t0             <-- start time
+ *   t1             <-- end time
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_multi_update_stats(int                  n_fields,
+                             const char          *var_name[],
+                             cs_gradient_type_t   gradient_type,
+                             const cs_timer_t    *t0,
+                             const cs_timer_t    *t1)
+{
+  cs_timer_counter_add_diff(&_gradient_t_tot, t0, t1);
+
+  cs_timer_counter_t t_field = cs_timer_diff(t0, t1);
+  t_field.wall_nsec /= n_fields;
+  t_field.cpu_nsec /= n_fields;
+
+  for (int k = 0; k < n_fields; k++) {
+    cs_gradient_info_t *gradient_info
+      = _find_or_add_system(var_name[k], gradient_type);
+    gradient_info->n_calls += 1;
+    CS_TIMER_COUNTER_ADD(gradient_info->t_tot, gradient_info->t_tot, t_field);
+  }
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, t0, t1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -8886,10 +10034,44 @@ cs_gradient_free_quantities(void)
     BFT_FREE(gq->cocg_lsq);
     BFT_FREE(gq->cocgb_s_lsq_ext);
     BFT_FREE(gq->cocg_lsq_ext);
+    _free_i_dc_ddc_lsq(gq);
 
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set convergence test options for the iterative reconstruction
+ *         of gradients (CS_GRADIENT_GREEN_ITER).
+ *
+ * The convergence test of each sweep requires a global reduction. Testing
+ * only every given number of sweeps, or not at all (so that the given
+ * number of sweeps is always done), reduces the number of reductions.
+ * With a non-blocking reduction, the test of a given sweep is completed
+ * during the next sweep, possibly leading to one additional sweep.
+ *
+ * \param[in]  check_interval  test convergence every check_interval sweeps,
+ *                             or never if 0 (fixed number of sweeps);
+ *                             default: 1
+ * \param[in]  overlap_reduce  if true, overlap the convergence reduction with
+ *                             the next sweep (requires MPI 3);
+ *                             default: false
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_iterative_options(int   check_interval,
+                                  bool  overlap_reduce)
+{
+  if (check_interval < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: check_interval must be >= 0 (%d given)."),
+              __func__, check_interval);
+
+  _iter_check_interval = check_interval;
+  _iter_overlap_reduce = overlap_reduce;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -9115,6 +10297,354 @@ cs_gradient_vector(const char                    *var_name,
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields.
+ *
+ * This is equivalent to calling \ref cs_gradient_scalar for each field
+ * (without hydrostatic pressure, weighting, or internal coupling),
+ * but ghost cell values of all fields are synchronized in a single
+ * exchange. With the least-squares gradient type, gradients of all fields
+ * are also computed in a single sweep over mesh faces.
+ *
+ * \param[in]       n_fields        number of fields
+ * \param[in]       var_name        variable name for each field
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ *                                  (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       clip_mode       clipping mode
+ * \param[in]       epsilon         precision for iterative gradient calculation
+ * \param[in]       clip_coeff      clipping coefficient
+ * \param[in]       bc_coeff_a      boundary condition term a for each field
+ * \param[in]       bc_coeff_b      boundary condition term b for each field
+ * \param[in, out]  var             gradient's base variable for each field
+ * \param[out]      grad            gradient for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(int                            n_fields,
+                         const char                    *var_name[],
+                         cs_gradient_type_t             gradient_type,
+                         cs_halo_type_t                 halo_type,
+                         int                            inc,
+                         bool                           recompute_cocg,
+                         int                            n_r_sweeps,
+                         int                            verbosity,
+                         cs_gradient_limit_t            clip_mode,
+                         double                         epsilon,
+                         double                         clip_coeff,
+                         const cs_real_t               *bc_coeff_a[],
+                         const cs_real_t               *bc_coeff_b[],
+                         cs_real_t                     *var[],
+                         cs_real_3_t                   *grad[])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+
+  if (n_fields < 1)
+    return;
+
+  cs_timer_t t0, t1;
+
+  t0 = cs_timer_time();
+
+  /* Interleave variables and synchronize all fields at once */
+
+  cs_real_t *var_i;
+  BFT_MALLOC(var_i, n_cells_ext*n_fields, cs_real_t);
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (int k = 0; k < n_fields; k++)
+      var_i[c_id*n_fields + k] = var[k][c_id];
+  }
+
+  if (mesh->halo != NULL) {
+
+    cs_halo_sync_var_strided(mesh->halo, halo_type, var_i, n_fields);
+
+    for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++) {
+      for (int k = 0; k < n_fields; k++)
+        var[k][c_id] = var_i[c_id*n_fields + k];
+    }
+
+  }
+
+  /* Use Neumann BC's as default if not provided */
+
+  const cs_real_t **_bc_coeff_a, **_bc_coeff_b;
+  cs_real_t *_bc_coeff_a_0 = NULL, *_bc_coeff_b_1 = NULL;
+
+  BFT_MALLOC(_bc_coeff_a, n_fields*2, const cs_real_t *);
+  _bc_coeff_b = _bc_coeff_a + n_fields;
+
+  for (int k = 0; k < n_fields; k++) {
+    _bc_coeff_a[k] = bc_coeff_a[k];
+    _bc_coeff_b[k] = bc_coeff_b[k];
+    if (_bc_coeff_a[k] == NULL) {
+      if (_bc_coeff_a_0 == NULL) {
+        BFT_MALLOC(_bc_coeff_a_0, n_b_faces, cs_real_t);
+        for (cs_lnum_t i = 0; i < n_b_faces; i++)
+          _bc_coeff_a_0[i] = 0;
+      }
+      _bc_coeff_a[k] = _bc_coeff_a_0;
+    }
+    if (_bc_coeff_b[k] == NULL) {
+      if (_bc_coeff_b_1 == NULL) {
+        BFT_MALLOC(_bc_coeff_b_1, n_b_faces, cs_real_t);
+        for (cs_lnum_t i = 0; i < n_b_faces; i++)
+          _bc_coeff_b_1[i] = 1;
+      }
+      _bc_coeff_b[k] = _bc_coeff_b_1;
+    }
+  }
+
+  /* Compute gradients */
+
+  if (gradient_type == CS_GRADIENT_LSQ) {
+
+    static int last_fvm_count = 0;
+
+    if (n_r_sweeps > 0) {
+      int prev_fvq_count = last_fvm_count;
+      last_fvm_count = cs_mesh_quantities_compute_count();
+      if (last_fvm_count != prev_fvq_count)
+        recompute_cocg = true;
+    }
+
+    /* Fields are handled by small groups, so as to limit the
+       working set size of the face loops */
+
+    for (int k0 = 0; k0 < n_fields; k0 += _lsq_multi_max_fields) {
+
+      int n_k = CS_MIN(n_fields - k0, _lsq_multi_max_fields);
+
+      _lsq_scalar_gradient_multi(mesh,
+                                 fvq,
+                                 halo_type,
+                                 recompute_cocg,
+                                 n_k,
+                                 n_fields,
+                                 inc,
+                                 _bc_coeff_a + k0,
+                                 _bc_coeff_b + k0,
+                                 var_i + k0,
+                                 grad + k0);
+
+    }
+
+    /* Synchronize halos for all fields at once */
+
+    if (mesh->halo != NULL) {
+
+      cs_real_3_t *grad_i;
+      BFT_MALLOC(grad_i, n_cells_ext*n_fields, cs_real_3_t);
+
+#     pragma omp parallel for if(n_cells > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        for (int k = 0; k < n_fields; k++) {
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            grad_i[c_id*n_fields + k][ll] = grad[k][c_id][ll];
+        }
+      }
+
+      cs_halo_sync_var_strided(mesh->halo, CS_HALO_STANDARD,
+                               (cs_real_t *)grad_i, 3*n_fields);
+
+      for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++) {
+        for (int k = 0; k < n_fields; k++) {
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            grad[k][c_id][ll] = grad_i[c_id*n_fields + k][ll];
+        }
+      }
+
+      BFT_FREE(grad_i);
+
+    }
+
+    for (int k = 0; k < n_fields; k++) {
+
+      if (mesh->halo != NULL && mesh->n_init_perio > 0)
+        cs_halo_perio_sync_var_vect(mesh->halo, CS_HALO_STANDARD,
+                                    (cs_real_t *)grad[k], 3);
+
+      _scalar_gradient_clipping(halo_type,
+                                clip_mode,
+                                verbosity,
+                                0,
+                                clip_coeff,
+                                var_name[k],
+                                var[k], grad[k]);
+
+      if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
+        cs_bad_cells_regularisation_vector(grad[k], 0);
+
+    }
+
+  }
+
+  /* Other gradient types are computed field by field */
+
+  else {
+
+    for (int k = 0; k < n_fields; k++)
+      _gradient_scalar(var_name[k],
+                       _find_or_add_system(var_name[k], gradient_type),
+                       gradient_type,
+                       halo_type,
+                       inc,
+                       recompute_cocg,
+                       n_r_sweeps,
+                       0,             /* tr_dim */
+                       0,             /* hyd_p_flag */
+                       1,             /* w_stride */
+                       verbosity,
+                       clip_mode,
+                       epsilon,
+                       clip_coeff,
+                       NULL,          /* f_ext */
+                       _bc_coeff_a[k],
+                       _bc_coeff_b[k],
+                       var[k],
+                       NULL,          /* c_weight */
+                       NULL,          /* cpl */
+                       grad[k]);
+
+  }
+
+  BFT_FREE(_bc_coeff_a_0);
+  BFT_FREE(_bc_coeff_b_1);
+  BFT_FREE(_bc_coeff_a);
+  BFT_FREE(var_i);
+
+  t1 = cs_timer_time();
+
+  _gradient_multi_update_stats(n_fields, var_name, gradient_type, &t0, &t1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple vector fields.
+ *
+ * This is equivalent to calling \ref cs_gradient_vector for each field
+ * (without weighting or internal coupling), but ghost cell values of all
+ * fields are synchronized in a single exchange.
+ *
+ * \param[in]       n_fields        number of fields
+ * \param[in]       var_name        variable name for each field
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ *                                  (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       clip_mode       clipping mode
+ * \param[in]       epsilon         precision for iterative gradient calculation
+ * \param[in]       clip_coeff      clipping coefficient
+ * \param[in]       bc_coeff_a      boundary condition term a for each field
+ * \param[in]       bc_coeff_b      boundary condition term b for each field
+ * \param[in, out]  var             gradient's base variable for each field
+ * \param[out]      gradv           gradient for each field
+                                    (\f$ \der{u_i}{x_j} \f$ is gradv[][i][j])
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_vector_multi(int                            n_fields,
+                         const char                    *var_name[],
+                         cs_gradient_type_t             gradient_type,
+                         cs_halo_type_t                 halo_type,
+                         int                            inc,
+                         int                            n_r_sweeps,
+                         int                            verbosity,
+                         cs_gradient_limit_t            clip_mode,
+                         double                         epsilon,
+                         double                         clip_coeff,
+                         const cs_real_3_t             *bc_coeff_a[],
+                         const cs_real_33_t            *bc_coeff_b[],
+                         cs_real_3_t                   *var[],
+                         cs_real_33_t                  *gradv[])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+
+  if (n_fields < 1)
+    return;
+
+  cs_timer_t t0, t1;
+
+  t0 = cs_timer_time();
+
+  /* Synchronize all fields at once */
+
+  if (mesh->halo != NULL) {
+
+    cs_real_t *var_i;
+    BFT_MALLOC(var_i, n_cells_ext*n_fields*3, cs_real_t);
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (int k = 0; k < n_fields; k++) {
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          var_i[(c_id*n_fields + k)*3 + ll] = var[k][c_id][ll];
+      }
+    }
+
+    cs_halo_sync_var_strided(mesh->halo, halo_type, var_i, 3*n_fields);
+
+    for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++) {
+      for (int k = 0; k < n_fields; k++) {
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          var[k][c_id][ll] = var_i[(c_id*n_fields + k)*3 + ll];
+      }
+    }
+
+    BFT_FREE(var_i);
+
+    if (mesh->n_init_perio > 0) {
+      for (int k = 0; k < n_fields; k++)
+        cs_halo_perio_sync_var_vect(mesh->halo, halo_type,
+                                    (cs_real_t *)var[k], 3);
+    }
+
+  }
+
+  /* Compute gradients */
+
+  for (int k = 0; k < n_fields; k++)
+    _gradient_vector(var_name[k],
+                     _find_or_add_system(var_name[k], gradient_type),
+                     gradient_type,
+                     halo_type,
+                     inc,
+                     n_r_sweeps,
+                     verbosity,
+                     clip_mode,
+                     epsilon,
+                     clip_coeff,
+                     bc_coeff_a[k],
+                     bc_coeff_b[k],
+                     (const cs_real_3_t *)var[k],
+                     NULL,          /* c_weight */
+                     NULL,          /* cpl */
+                     gradv[k]);
+
+  t1 = cs_timer_time();
+
+  _gradient_multi_update_stats(n_fields, var_name, gradient_type, &t0, &t1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of tensor.
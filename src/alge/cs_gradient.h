@@ -154,6 +154,30 @@ cs_gradient_finalize(void);
 void
 cs_gradient_free_quantities(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set convergence test options for the iterative reconstruction
+ *         of gradients (CS_GRADIENT_GREEN_ITER).
+ *
+ * The convergence test of each sweep requires a global reduction. Testing
+ * only every given number of sweeps, or not at all (so that the given
+ * number of sweeps is always done), reduces the number of reductions.
+ * With a non-blocking reduction, the test of a given sweep is completed
+ * during the next sweep, possibly leading to one additional sweep.
+ *
+ * \param[in]  check_interval  test convergence every check_interval sweeps,
+ *                             or never if 0 (fixed number of sweeps);
+ *                             default: 1
+ * \param[in]  overlap_reduce  if true, overlap the convergence reduction with
+ *                             the next sweep (requires MPI 3);
+ *                             default: false
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_iterative_options(int   check_interval,
+                                  bool  overlap_reduce);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -248,6 +272,95 @@ cs_gradient_vector(const char                    *var_name,
                    const cs_internal_coupling_t  *cpl,
                    cs_real_t                      gradv[restrict][3][3]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields.
+ *
+ * This is equivalent to calling \ref cs_gradient_scalar for each field
+ * (without hydrostatic pressure, weighting, or internal coupling),
+ * but ghost cell values of all fields are synchronized in a single
+ * exchange. With the least-squares gradient type, gradients of all fields
+ * are also computed in a single sweep over mesh faces.
+ *
+ * \param[in]       n_fields        number of fields
+ * \param[in]       var_name        variable name for each field
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ *                                  (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       clip_mode       clipping mode
+ * \param[in]       epsilon         precision for iterative gradient calculation
+ * \param[in]       clip_coeff      clipping coefficient
+ * \param[in]       bc_coeff_a      boundary condition term a for each field
+ * \param[in]       bc_coeff_b      boundary condition term b for each field
+ * \param[in, out]  var             gradient's base variable for each field
+ * \param[out]      grad            gradient for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(int                            n_fields,
+                         const char                    *var_name[],
+                         cs_gradient_type_t             gradient_type,
+                         cs_halo_type_t                 halo_type,
+                         int                            inc,
+                         bool                           recompute_cocg,
+                         int                            n_r_sweeps,
+                         int                            verbosity,
+                         cs_gradient_limit_t            clip_mode,
+                         double                         epsilon,
+                         double                         clip_coeff,
+                         const cs_real_t               *bc_coeff_a[],
+                         const cs_real_t               *bc_coeff_b[],
+                         cs_real_t                     *var[],
+                         cs_real_3_t                   *grad[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple vector fields.
+ *
+ * This is equivalent to calling \ref cs_gradient_vector for each field
+ * (without weighting or internal coupling), but ghost cell values of all
+ * fields are synchronized in a single exchange.
+ *
+ * \param[in]       n_fields        number of fields
+ * \param[in]       var_name        variable name for each field
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ *                                  (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       clip_mode       clipping mode
+ * \param[in]       epsilon         precision for iterative gradient calculation
+ * \param[in]       clip_coeff      clipping coefficient
+ * \param[in]       bc_coeff_a      boundary condition term a for each field
+ * \param[in]       bc_coeff_b      boundary condition term b for each field
+ * \param[in, out]  var             gradient's base variable for each field
+ * \param[out]      gradv           gradient for each field
+                                    (\f$ \der{u_i}{x_j} \f$ is gradv[][i][j])
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_vector_multi(int                            n_fields,
+                         const char                    *var_name[],
+                         cs_gradient_type_t             gradient_type,
+                         cs_halo_type_t                 halo_type,
+                         int                            inc,
+                         int                            n_r_sweeps,
+                         int                            verbosity,
+                         cs_gradient_limit_t            clip_mode,
+                         double                         epsilon,
+                         double                         clip_coeff,
+                         const cs_real_3_t             *bc_coeff_a[],
+                         const cs_real_33_t            *bc_coeff_b[],
+                         cs_real_3_t                   *var[],
+                         cs_real_33_t                  *gradv[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of tensor.
@@ -97,6 +97,10 @@ BEGIN_C_DECLS
 #define HUGE_VAL  1.E+12
 #endif
 
+/* Cache line multiple, in cs_real_t units */
+
+#define CS_CL  (CS_CL_SIZE/8)
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -311,6 +315,105 @@ _l_id_binary_search(cs_lnum_t        l_id_array_size,
   return mid_id;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute array index bounds for a local thread.
+ *
+ * When called inside an OpenMP parallel section, this will return the
+ * start an past-the-end indexes for the array range assigned to that thread.
+ * In other cases, the start index is 0, and the past-the-end index is n;
+ *
+ * parameters:
+ *   n    <-- size of array
+ *   s_id --> start index for the current thread
+ *   e_id --> past-the-end index for the current thread
+ *----------------------------------------------------------------------------*/
+
+static void
+_thread_range(cs_lnum_t   n,
+              cs_lnum_t  *s_id,
+              cs_lnum_t  *e_id)
+{
+#if defined(HAVE_OPENMP)
+  int t_id = omp_get_thread_num();
+  int n_t = omp_get_num_threads();
+  cs_lnum_t t_n = (n + n_t - 1) / n_t;
+  *s_id =  t_id    * t_n;
+  *e_id = (t_id+1) * t_n;
+  *s_id = cs_align(*s_id, CS_CL);
+  *e_id = cs_align(*e_id, CS_CL);
+  if (*s_id > n) *s_id = n;
+  if (*e_id > n) *e_id = n;
+#else
+  *s_id = 0;
+  *e_id = n;
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Renumber coarse rows built independently by threads.
+ *
+ * Each thread is assumed to have built coarse rows numbered from 0 for
+ * the fine rows of its range only (see _thread_range). Coarse rows are
+ * then shifted so that numbering is contiguous over all threads.
+ *
+ * This function must be called by all threads of a parallel section.
+ *
+ * parameters:
+ *   s_id       <-- start index for the current thread
+ *   e_id       <-- past-the-end index for the current thread
+ *   c_n_rows   <-- number of coarse rows built by the current thread
+ *   t_c_n_rows <-> shared work array (size: n_threads + 1)
+ *   f_c_row    <-> fine row -> coarse row connectivity
+ *
+ * returns:
+ *   total number of coarse rows
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_thread_renumber_coarse_rows(cs_lnum_t   s_id,
+                             cs_lnum_t   e_id,
+                             cs_lnum_t   c_n_rows,
+                             cs_lnum_t   t_c_n_rows[],
+                             cs_lnum_t   f_c_row[])
+{
+#if defined(HAVE_OPENMP)
+
+  int t_id = omp_get_thread_num();
+  int n_t = omp_get_num_threads();
+
+  t_c_n_rows[t_id + 1] = c_n_rows;
+
+# pragma omp barrier
+# pragma omp single
+  {
+    t_c_n_rows[0] = 0;
+    for (int i = 0; i < n_t; i++)
+      t_c_n_rows[i+1] += t_c_n_rows[i];
+  }
+
+  cs_lnum_t c_shift = t_c_n_rows[t_id];
+
+  if (c_shift > 0) {
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+      if (f_c_row[ii] > -1)
+        f_c_row[ii] += c_shift;
+    }
+  }
+
+  return t_c_n_rows[n_t];
+
+#else
+
+  CS_UNUSED(s_id);
+  CS_UNUSED(e_id);
+  CS_UNUSED(t_c_n_rows);
+  CS_UNUSED(f_c_row);
+
+  return c_n_rows;
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Reduce block values to a single equivalent value for computation
  * of aggregation criteria.
@@ -2554,7 +2657,13 @@ _graph_m_ptr_insert_m(cs_graph_m_ptr_t  *s,
  * form. To use block matrices with this function, their blocks must be
  * condensed to equivalent scalars.
  *
- * \param[in]   f_n_rows      number of rows in fine grid
+ * The rows handled may be a subset of a larger matrix, in which case
+ * matrix arrays (except col_id) and f_c_row should point to the first
+ * row of the subset, and id_shift be the id of that row; columns
+ * outside the subset are then ignored, as are ghost columns.
+ *
+ * \param[in]   f_n_rows      number of rows in fine grid (or subset)
+ * \param[in]   id_shift      id of first row of subset in matrix
  * \param[in]   beta          aggregation criterion
  * \param[in]   dd_threshold  diagonal dominance threshold; if > 0, ignore rows
  *                            whose diagonal dominance is above this threshold
@@ -2570,6 +2679,7 @@ _graph_m_ptr_insert_m(cs_graph_m_ptr_t  *s,
 
 static cs_lnum_t
 _pairwise_msr(cs_lnum_t         f_n_rows,
+              cs_lnum_t         id_shift,
               const cs_real_t   beta,
               const cs_real_t   dd_threshold,
               const cs_lnum_t   row_index[restrict],
@@ -2627,7 +2737,8 @@ _pairwise_msr(cs_lnum_t         f_n_rows,
       else {
         a_m[ii] = 0;
         for (cs_lnum_t jj = e_id-1; jj >= s_id; jj--) {
-          if (col_id[jj] < f_n_rows && x_val[jj] < beta*sum)
+          cs_lnum_t j = col_id[jj] - id_shift;
+          if (j >= 0 && j < f_n_rows && x_val[jj] < beta*sum)
             a_m[ii] += 1;
         }
       }
@@ -2654,7 +2765,8 @@ _pairwise_msr(cs_lnum_t         f_n_rows,
 
       a_m[ii] = 0;
       for (cs_lnum_t jj = e_id-1; jj >= s_id; jj--) {
-        if (col_id[jj] < f_n_rows)
+        cs_lnum_t j = col_id[jj] - id_shift;
+        if (j >= 0 && j < f_n_rows)
           a_m[ii] += 1;
       }
 
@@ -2665,8 +2777,11 @@ _pairwise_msr(cs_lnum_t         f_n_rows,
 
   }
 
-  if (m_max < 0)
+  if (m_max < 0) {
+    BFT_FREE(a_max);
+    BFT_FREE(a_m);
     return 0;
+  }
 
   /* Build pointers to lists of rows by a_m
      (to allow access to row with lowest m) */
@@ -2728,8 +2843,10 @@ _pairwise_msr(cs_lnum_t         f_n_rows,
       cs_lnum_t jj = -1;
       cs_real_t _a_min = HUGE_VAL;
       for (cs_lnum_t kk_idx = s_id; kk_idx < e_id; kk_idx++) {
-        cs_lnum_t kk = col_id[kk_idx];
-        if (kk < f_n_rows && f_c_row[kk] == -2) { /* not aggregated yet */
+        cs_lnum_t kk = col_id[kk_idx] - id_shift;
+        if (kk < 0 || kk >= f_n_rows)
+          continue;
+        if (f_c_row[kk] == -2) { /* not aggregated yet */
           cs_real_t xv = x_val[kk_idx];
           if (xv < _a_min) {
             _a_min = xv;
@@ -2763,8 +2880,8 @@ _pairwise_msr(cs_lnum_t         f_n_rows,
         cs_lnum_t _s_id = row_index[i];
         cs_lnum_t _e_id = row_index[i+1];
         for (cs_lnum_t k = _e_id-1; k >= _s_id; k--) {
-          cs_lnum_t j = col_id[k];
-          if (j >= f_n_rows)
+          cs_lnum_t j = col_id[k] - id_shift;
+          if (j < 0 || j >= f_n_rows)
             continue;
           _m = a_m[j];
           if (_m >= 0) {
@@ -2855,14 +2972,36 @@ _automatic_aggregation_pw_msr(const cs_grid_t  *f,
     bft_printf("\n     %s: beta %5.3e; diag_dominance_threshold: %5.3e\n",
                __func__, beta, dd_threshold);
 
-  _pairwise_msr(f_n_rows,
-                beta,
-                dd_threshold,
-                row_index,
-                col_id,
-                d_val,
-                x_val,
-                f_c_row);
+  /* Each thread aggregates rows of its own range, as is done for
+     each rank (so the result depends on the number of threads) */
+
+  int n_t_max = 1;
+#if defined(HAVE_OPENMP)
+  n_t_max = omp_get_max_threads();
+#endif
+
+  cs_lnum_t *t_c_n_rows;
+  BFT_MALLOC(t_c_n_rows, n_t_max + 1, cs_lnum_t);
+
+# pragma omp parallel if(f_n_rows > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    _thread_range(f_n_rows, &s_id, &e_id);
+
+    cs_lnum_t c_n_rows = _pairwise_msr(e_id - s_id,
+                                       s_id,
+                                       beta,
+                                       dd_threshold,
+                                       row_index + s_id,
+                                       col_id,
+                                       d_val + s_id,
+                                       x_val,
+                                       f_c_row + s_id);
+
+    _thread_renumber_coarse_rows(s_id, e_id, c_n_rows, t_c_n_rows, f_c_row);
+  }
+
+  BFT_FREE(t_c_n_rows);
 
   /* Free working arrays */
 
@@ -3100,10 +3239,7 @@ _automatic_aggregation_mx_msr(const cs_grid_t  *f,
 {
   const cs_lnum_t f_n_rows = f->n_rows;
 
-  int npass_max = 10;
-  int _max_aggregation = 1, npass = 0;
-  cs_lnum_t aggr_count = f_n_rows;
-  cs_lnum_t c_n_rows = 0;
+  const int npass_max = 10;
 
   cs_lnum_t *c_aggr_count = NULL;
   bool *penalize = NULL;
@@ -3193,90 +3329,129 @@ _automatic_aggregation_mx_msr(const cs_grid_t  *f,
 
   }   /* OpenMP block */
 
-  /* Passes */
+  /* Passes; each thread aggregates rows of its own range, as is done
+     for each rank (so the result depends on the number of threads).
+     Coarse rows are first numbered from the start of the range, so
+     that c_aggr_count may be shared. */
 
-  do {
+  int n_t_max = 1;
+#if defined(HAVE_OPENMP)
+  n_t_max = omp_get_max_threads();
+#endif
 
-    npass++;
-    _max_aggregation++;
-    _max_aggregation = CS_MIN(_max_aggregation, max_aggregation);
+  cs_lnum_t *t_c_n_rows;
+  BFT_MALLOC(t_c_n_rows, n_t_max + 1, cs_lnum_t);
 
-    /* Pairwise aggregation */
+# pragma omp parallel if (f_n_rows > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    _thread_range(f_n_rows, &s_id, &e_id);
 
-    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+    int _npass_max = npass_max;
+    int _max_aggregation = 1, npass = 0;
+    cs_lnum_t aggr_count = e_id - s_id;
+    cs_lnum_t c_n_rows = s_id;
 
-      /* ii is candidate to aggregation only if it is not penalized */
+    do {
 
-      if (penalize[ii])
-        continue;
+      npass++;
+      _max_aggregation++;
+      _max_aggregation = CS_MIN(_max_aggregation, max_aggregation);
 
-      const cs_real_t  row_criterion = -beta*maxi[ii];
+      /* Pairwise aggregation */
 
-      for (cs_lnum_t jidx = row_index[ii]; jidx < row_index[ii+1]; jidx++) {
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+
+        /* ii is candidate to aggregation only if it is not penalized */
+
+        if (penalize[ii])
+          continue;
 
-        cs_lnum_t jj = col_id[jidx];
+        const cs_real_t  row_criterion = -beta*maxi[ii];
 
-        /* Exclude rows on parallel or periodic boundary, so as not to */
-        /* coarsen the grid across those boundaries (which would change */
-        /* the communication pattern and require a more complex algorithm). */
+        for (cs_lnum_t jidx = row_index[ii]; jidx < row_index[ii+1]; jidx++) {
 
-        if (jj < f_n_rows) {
-          if (!penalize[jj]) {
+          cs_lnum_t jj = col_id[jidx];
 
-            /* Test if ii and jj are strongly negatively coupled and at */
-            /* least one of them is not already in an aggregate. */
+          /* Exclude rows on parallel or periodic boundary, so as not to */
+          /* coarsen the grid across those boundaries (which would change */
+          /* the communication pattern and require a more complex algorithm). */
+          /* Rows of other threads are excluded in the same manner. */
 
-            if (    x_val[jidx] < row_criterion
-                && (f_c_row[ii] < 0 || f_c_row[jj] < 0)) {
+          if (jj >= s_id && jj < e_id) {
+            if (!penalize[jj]) {
 
-              if (f_c_row[ii] > -1 && f_c_row[jj] < 0 ) {
-                if (c_aggr_count[f_c_row[ii]] < _max_aggregation +1) {
-                  f_c_row[jj] = f_c_row[ii];
-                  c_aggr_count[f_c_row[ii]] += 1;
+              /* Test if ii and jj are strongly negatively coupled and at */
+              /* least one of them is not already in an aggregate. */
+
+              if (    x_val[jidx] < row_criterion
+                  && (f_c_row[ii] < 0 || f_c_row[jj] < 0)) {
+
+                if (f_c_row[ii] > -1 && f_c_row[jj] < 0 ) {
+                  if (c_aggr_count[f_c_row[ii]] < _max_aggregation +1) {
+                    f_c_row[jj] = f_c_row[ii];
+                    c_aggr_count[f_c_row[ii]] += 1;
+                  }
                 }
-              }
-              else if (f_c_row[ii] < 0 && f_c_row[jj] > -1) {
-                if (c_aggr_count[f_c_row[jj]] < _max_aggregation +1) {
-                  f_c_row[ii] = f_c_row[jj];
-                  c_aggr_count[f_c_row[jj]] += 1;
+                else if (f_c_row[ii] < 0 && f_c_row[jj] > -1) {
+                  if (c_aggr_count[f_c_row[jj]] < _max_aggregation +1) {
+                    f_c_row[ii] = f_c_row[jj];
+                    c_aggr_count[f_c_row[jj]] += 1;
+                  }
+                }
+                else if (f_c_row[ii] < 0 && f_c_row[jj] < 0) {
+                  f_c_row[ii] = c_n_rows;
+                  f_c_row[jj] = c_n_rows;
+                  c_aggr_count[c_n_rows] += 1;
+                  c_n_rows++;
                 }
               }
-              else if (f_c_row[ii] < 0 && f_c_row[jj] < 0) {
-                f_c_row[ii] = c_n_rows;
-                f_c_row[jj] = c_n_rows;
-                c_aggr_count[c_n_rows] += 1;
-                c_n_rows++;
-              }
-            }
 
-          } /* Column is not penalized */
-        } /* The current rank is owner of the column */
+            } /* Column is not penalized */
+          } /* The current thread is owner of the column */
 
-      } /* Loop on columns */
+        } /* Loop on columns */
 
-    } /* Loop on rows */
+      } /* Loop on rows */
 
-    /* Check the number of coarse rows created */
-    aggr_count = 0;
-    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
-      if (f_c_row[ii] < 0)
-        aggr_count++;
-    }
+      /* Check the number of coarse rows created */
+      aggr_count = 0;
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+        if (f_c_row[ii] < 0)
+          aggr_count++;
+      }
 
-    /* Additional passes if aggregation is insufficient */
-    if (aggr_count == 0 || (c_n_rows + aggr_count)*ncoarse < f_n_rows)
-      npass_max = npass;
+      /* Additional passes if aggregation is insufficient */
+      if (   aggr_count == 0
+          || (c_n_rows - s_id + aggr_count)*ncoarse < e_id - s_id)
+        _npass_max = npass;
 
-  } while (npass < npass_max); /* Loop on passes */
+    } while (npass < _npass_max); /* Loop on passes */
 
-  /* Finish assembly: rows that are not diagonally dominant and not in an
-   * aggregate form their own aggregate */
-  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
-    if (!penalize[ii] && f_c_row[ii] < 0) {
-      f_c_row[ii] = c_n_rows;
-      c_n_rows++;
+    /* Finish assembly: rows that are not diagonally dominant and not in an
+     * aggregate form their own aggregate */
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+      if (!penalize[ii] && f_c_row[ii] < 0) {
+        f_c_row[ii] = c_n_rows;
+        c_n_rows++;
+      }
     }
-  }
+
+    /* Number coarse rows from 0 for this thread, then renumber globally */
+
+    if (s_id > 0) {
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+        if (f_c_row[ii] > -1)
+          f_c_row[ii] -= s_id;
+      }
+    }
+
+    _thread_renumber_coarse_rows(s_id, e_id, c_n_rows - s_id,
+                                 t_c_n_rows, f_c_row);
+
+  } /* OpenMP block */
+
+  BFT_FREE(t_c_n_rows);
 
   /* Free working arrays */
 
@@ -4494,28 +4669,102 @@ _compute_coarse_quantities_conv_diff(const cs_grid_t  *fine_grid,
 }
 
 /*----------------------------------------------------------------------------
- * Build a coarse level from a finer level with an MSR matrix.
+ * Build index of fine rows associated with each coarse row.
+ *
+ * Fine rows are listed in increasing order for each coarse row.
+ * Rows with no associated coarse row, or associated with a rank
+ * other than the local one, are excluded.
  *
  * parameters:
- *   fine_grid   <-- Fine grid structure
- *   coarse_grid <-> Coarse grid structure
+ *   f_n_rows     <-- Number of fine rows
+ *   c_n_rows     <-- Number of coarse rows
+ *   c_coarse_row <-- Fine -> coarse row connectivity
+ *   cf_row_idx   --> Coarse -> fine rows index (size: c_n_rows + 1)
+ *   f_row_id     --> Coarse -> fine rows ids (size: cf_row_idx[c_n_rows])
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
-                               cs_grid_t        *coarse_grid)
+_coarse_to_fine_rows(cs_lnum_t          f_n_rows,
+                     cs_lnum_t          c_n_rows,
+                     const cs_lnum_t    c_coarse_row[],
+                     cs_lnum_t        **cf_row_idx,
+                     cs_lnum_t        **f_row_id)
+{
+  cs_lnum_t *_cf_row_idx, *_f_row_id;
+
+  BFT_MALLOC(_cf_row_idx, c_n_rows+1, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i <= c_n_rows; i++)
+    _cf_row_idx[i] = 0;
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+    cs_lnum_t i = c_coarse_row[ii];
+    if (i > -1 && i < c_n_rows)
+      _cf_row_idx[i+1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < c_n_rows; i++)
+    _cf_row_idx[i+1] += _cf_row_idx[i];
 
+  BFT_MALLOC(_f_row_id, _cf_row_idx[c_n_rows], cs_lnum_t);
+
+  /* Use start index as insertion position, then shift back */
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+    cs_lnum_t i = c_coarse_row[ii];
+    if (i > -1 && i < c_n_rows) {
+      _f_row_id[_cf_row_idx[i]] = ii;
+      _cf_row_idx[i] += 1;
+    }
+  }
+
+  for (cs_lnum_t i = c_n_rows; i > 0; i--)
+    _cf_row_idx[i] = _cf_row_idx[i-1];
+  _cf_row_idx[0] = 0;
+
+  *cf_row_idx = _cf_row_idx;
+  *f_row_id = _f_row_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute coarse MSR matrix values from a finer level with an MSR matrix,
+ * given the coarse matrix structure.
+ *
+ * Column ids of each coarse row must be sorted. Coarse rows are handled
+ * independently, so this is done in parallel by threads.
+ *
+ * parameters:
+ *   fine_grid   <-- Fine grid structure
+ *   coarse_grid <-- Coarse grid structure
+ *   cf_row_idx  <-- Coarse -> fine rows index
+ *   f_row_id    <-- Coarse -> fine rows ids
+ *   c_row_index <-- Coarse MSR row index
+ *   c_col_id    <-- Coarse MSR column ids
+ *   c_d_val     --> Coarse MSR diagonal values
+ *   c_x_val     --> Coarse MSR extra-diagonal values
+ *
+ * returns:
+ *   true if all fine entries could be mapped to the coarse structure,
+ *   false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_compute_coarse_values_msr(const cs_grid_t  *fine_grid,
+                           const cs_grid_t  *coarse_grid,
+                           const cs_lnum_t   cf_row_idx[],
+                           const cs_lnum_t   f_row_id[],
+                           const cs_lnum_t   c_row_index[],
+                           const cs_lnum_t   c_col_id[],
+                           cs_real_t         c_d_val[],
+                           cs_real_t         c_x_val[])
 {
-  const cs_lnum_t *db_size = fine_grid->db_size;
+  int n_errors = 0;
 
-  const cs_lnum_t f_n_rows = fine_grid->n_rows;
+  const cs_lnum_t *db_size = fine_grid->db_size;
 
   const cs_lnum_t c_n_rows = coarse_grid->n_rows;
-  const cs_lnum_t c_n_cols = coarse_grid->n_cols_ext;
   const cs_lnum_t *c_coarse_row = coarse_grid->coarse_row;
 
-  /* Fine matrix in the MSR format */
-
   const cs_lnum_t  *f_row_index, *f_col_id;
   const cs_real_t  *f_d_val, *f_x_val;
 
@@ -4525,116 +4774,171 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
                            &f_d_val,
                            &f_x_val);
 
-  /* Coarse matrix elements in the MSR format */
-
-  cs_lnum_t *restrict c_row_index,  *restrict c_col_id;
-  cs_real_t *restrict c_d_val, *restrict c_x_val;
+  /* Careful here, we exclude penalized rows
+     from the aggregation process */
 
-  /* Diagonal elements
-     ----------------- */
+# pragma omp parallel for reduction(+:n_errors) if(c_n_rows > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < c_n_rows; i++) {
 
-  BFT_MALLOC(c_d_val, c_n_rows*db_size[3], cs_real_t);
+    /* Diagonal elements
+       ----------------- */
 
-  for (cs_lnum_t i = 0; i < c_n_rows*db_size[3]; i++)
-    c_d_val[i] = 0.0;
+    cs_real_t *_d_val = c_d_val + i*db_size[3];
 
-  /* Careful here, we exclude penalized rows
-     from the aggregation process */
+    for (cs_lnum_t k = 0; k < db_size[3]; k++)
+      _d_val[k] = 0.0;
 
-  if (db_size[0] == 1) {
-    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
-      cs_lnum_t ic = c_coarse_row[ii];
-      if (ic > -1 && ic < c_n_rows)
-        c_d_val[ic] += f_d_val[ii];
-    }
-  }
-  else {
-    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
-      cs_lnum_t ic = c_coarse_row[ii];
-      if (ic > -1 && ic < c_n_rows) {
+    for (cs_lnum_t ii_id = cf_row_idx[i]; ii_id < cf_row_idx[i+1]; ii_id++) {
+      cs_lnum_t ii = f_row_id[ii_id];
+      if (db_size[0] == 1)
+        _d_val[0] += f_d_val[ii];
+      else {
         for (cs_lnum_t jj = 0; jj < db_size[0]; jj++) {
           for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
-            c_d_val[ic*db_size[3] + db_size[2]*jj + kk]
+            _d_val[db_size[2]*jj + kk]
               += f_d_val[ii*db_size[3] + db_size[2]*jj + kk];
         }
       }
     }
-  }
 
-  /* Extradiagonal elements
-     ---------------------- */
+    /* Extradiagonal elements
+       ---------------------- */
 
-  BFT_MALLOC(c_row_index, c_n_rows+1, cs_lnum_t);
+    cs_lnum_t s_id = c_row_index[i];
+    cs_lnum_t n_cols = c_row_index[i+1] - s_id;
 
-  /* Prepare to traverse fine rows by increasing associated coarse row */
+    for (cs_lnum_t k = 0; k < n_cols; k++)
+      c_x_val[s_id + k] = 0;
 
-  cs_lnum_t  f_n_active_rows = 0;
-  cs_lnum_t *f_row_id = NULL;
-  {
-    cs_lnum_t *cf_row_idx;
-    BFT_MALLOC(cf_row_idx, c_n_rows+1, cs_lnum_t);
+    for (cs_lnum_t ii_id = cf_row_idx[i]; ii_id < cf_row_idx[i+1]; ii_id++) {
 
-    for (cs_lnum_t i = 0; i <= c_n_rows; i++)
-      cf_row_idx[i] = 0;
+      cs_lnum_t ii = f_row_id[ii_id];
 
-    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
-      cs_lnum_t i = c_coarse_row[ii];
-      if (i > -1 && i < c_n_rows)
-        cf_row_idx[i+1] += 1;
-    }
+      for (cs_lnum_t jj_ind = f_row_index[ii];
+           jj_ind < f_row_index[ii+1];
+           jj_ind++) {
 
-    for (cs_lnum_t i = 0; i < c_n_rows; i++)
-      cf_row_idx[i+1] += cf_row_idx[i];
+        cs_lnum_t jj = f_col_id[jj_ind];
 
-    f_n_active_rows = cf_row_idx[c_n_rows];
+        cs_lnum_t j = c_coarse_row[jj];
 
-    BFT_MALLOC(f_row_id, f_n_active_rows, cs_lnum_t);
-    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
-      cs_lnum_t i = c_coarse_row[ii];
-      if (i > -1 && i < c_n_rows) {
-        f_row_id[cf_row_idx[i]] = ii;
-        cf_row_idx[i] += 1;
+        if (j > -1) {
+
+          if (i != j) {
+            /* ids are sorted, so binary search possible */
+            cs_lnum_t k = _l_id_binary_search(n_cols, j, c_col_id + s_id);
+            if (k > -1)
+              c_x_val[k + s_id] += f_x_val[jj_ind];
+            else
+              n_errors += 1;
+          }
+          else { /* i == j */
+            for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+              /* diagonal terms only */
+              _d_val[db_size[2]*kk + kk] += f_x_val[jj_ind];
+            }
+          }
+
+        }
       }
+
     }
 
-    BFT_FREE(cf_row_idx);
   }
 
-  /* Counting pass */
+  return (n_errors == 0) ? true : false;
+}
 
+/*----------------------------------------------------------------------------
+ * Build a coarse level from a finer level with an MSR matrix.
+ *
+ * Structure and values of the coarse matrix are built in parallel
+ * by threads, each handling a subset of coarse rows.
+ *
+ * parameters:
+ *   fine_grid   <-- Fine grid structure
+ *   coarse_grid <-> Coarse grid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
+                               cs_grid_t        *coarse_grid)
+
+{
+  const cs_lnum_t *db_size = fine_grid->db_size;
+
+  const cs_lnum_t f_n_rows = fine_grid->n_rows;
+
+  const cs_lnum_t c_n_rows = coarse_grid->n_rows;
+  const cs_lnum_t c_n_cols = coarse_grid->n_cols_ext;
+  const cs_lnum_t *c_coarse_row = coarse_grid->coarse_row;
+
+  /* Fine matrix structure in the MSR format */
+
+  const cs_lnum_t  *f_row_index, *f_col_id;
+
+  cs_matrix_get_msr_arrays(fine_grid->matrix,
+                           &f_row_index,
+                           &f_col_id,
+                           NULL,
+                           NULL);
+
+  /* Coarse matrix elements in the MSR format */
+
+  cs_lnum_t *restrict c_row_index,  *restrict c_col_id;
+  cs_real_t *restrict c_d_val, *restrict c_x_val;
+
+  /* Extradiagonal elements
+     ---------------------- */
+
+  BFT_MALLOC(c_row_index, c_n_rows+1, cs_lnum_t);
+
+  /* Prepare to traverse fine rows by increasing associated coarse row */
+
+  cs_lnum_t *cf_row_idx = NULL, *f_row_id = NULL;
+
+  _coarse_to_fine_rows(f_n_rows, c_n_rows, c_coarse_row,
+                       &cf_row_idx, &f_row_id);
+
+  /* Counting pass; each thread handles an increasing range of coarse rows,
+     so marking the last row referencing a given column is sufficient */
+
+  c_row_index[0] = 0;
+
+# pragma omp parallel if(c_n_rows > CS_THR_MIN)
   {
     cs_lnum_t *last_row;
     BFT_MALLOC(last_row, c_n_cols, cs_lnum_t);
 
-    for (cs_lnum_t i = 0; i <= c_n_rows; i++)
-      c_row_index[i] = 0;
-
     for (cs_lnum_t i = 0; i < c_n_cols; i++)
       last_row[i] = -1;
 
-    for (cs_lnum_t ii_id = 0; ii_id < f_n_active_rows; ii_id++) {
+#   pragma omp for schedule(static)
+    for (cs_lnum_t i = 0; i < c_n_rows; i++) {
 
-      cs_lnum_t ii = f_row_id[ii_id];
+      cs_lnum_t n_cols = 0;
 
-      cs_lnum_t s_id = f_row_index[ii];
-      cs_lnum_t e_id = f_row_index[ii+1];
+      for (cs_lnum_t ii_id = cf_row_idx[i]; ii_id < cf_row_idx[i+1]; ii_id++) {
 
-      for (cs_lnum_t jj_ind = s_id; jj_ind < e_id; jj_ind++) {
+        cs_lnum_t ii = f_row_id[ii_id];
 
-        cs_lnum_t jj = f_col_id[jj_ind];
+        for (cs_lnum_t jj_ind = f_row_index[ii];
+             jj_ind < f_row_index[ii+1];
+             jj_ind++) {
 
-        cs_lnum_t i = c_coarse_row[ii];
-        cs_lnum_t j = c_coarse_row[jj];
+          cs_lnum_t j = c_coarse_row[f_col_id[jj_ind]];
 
-        assert(i > -1 && i < c_n_rows);
+          if (j > -1 && i != j && last_row[j] < i) {
+            last_row[j] = i;
+            n_cols++;
+          }
 
-        if (j > -1 && i != j && last_row[j] < i) {
-          last_row[j] = i;
-          c_row_index[i+1]++;
         }
 
       }
 
+      c_row_index[i+1] = n_cols;
+
     }
 
     BFT_FREE(last_row);
@@ -4652,103 +4956,61 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
 
   /* Assignment pass */
 
+# pragma omp parallel if(c_n_rows > CS_THR_MIN)
   {
-    for (cs_lnum_t i = 0; i < c_size; i++)
-      c_col_id[i] = -1;
-
-    cs_lnum_t *r_col_idx; /* col_idx for a given id in current row */
-    BFT_MALLOC(r_col_idx, c_n_cols, cs_lnum_t);
+    cs_lnum_t *last_row;
+    BFT_MALLOC(last_row, c_n_cols, cs_lnum_t);
 
     for (cs_lnum_t i = 0; i < c_n_cols; i++)
-      r_col_idx[i] = -1;
-
-    cs_lnum_t i_prev = -1;
-    cs_lnum_t r_count = 0;
-
-    for (cs_lnum_t ii_id = 0; ii_id < f_n_active_rows; ii_id++) {
+      last_row[i] = -1;
 
-      cs_lnum_t ii = f_row_id[ii_id];
+#   pragma omp for schedule(static)
+    for (cs_lnum_t i = 0; i < c_n_rows; i++) {
 
-      cs_lnum_t i = c_coarse_row[ii];
+      cs_lnum_t r_count = c_row_index[i];
 
-      if (i_prev != i) {
-        r_count = 0;
-        i_prev = i;
-      }
+      for (cs_lnum_t ii_id = cf_row_idx[i]; ii_id < cf_row_idx[i+1]; ii_id++) {
 
-      assert(i > -1 && i < c_n_rows);
+        cs_lnum_t ii = f_row_id[ii_id];
 
-      for (cs_lnum_t jj_ind = f_row_index[ii];
-           jj_ind < f_row_index[ii+1];
-           jj_ind++) {
+        for (cs_lnum_t jj_ind = f_row_index[ii];
+             jj_ind < f_row_index[ii+1];
+             jj_ind++) {
 
-        cs_lnum_t jj = f_col_id[jj_ind];
+          cs_lnum_t j = c_coarse_row[f_col_id[jj_ind]];
 
-        cs_lnum_t j = c_coarse_row[jj];
-        if (j > -1 && i != j) {
-          if (r_col_idx[j] < c_row_index[i]) {
-              r_col_idx[j] = c_row_index[i] + r_count;
-              c_col_id[r_col_idx[j]] = j;
-              r_count++;
+          if (j > -1 && i != j && last_row[j] < i) {
+            last_row[j] = i;
+            c_col_id[r_count] = j;
+            r_count++;
           }
+
         }
+
       }
+
+      assert(r_count == c_row_index[i+1]);
+
     }
 
-    BFT_FREE(r_col_idx);
+    BFT_FREE(last_row);
   }
 
-  BFT_FREE(f_row_id);
-
   /* Order column ids in case some algorithms expect it */
 
   cs_sort_indexed(c_n_rows, c_row_index, c_col_id);
 
   /* Values assignment pass */
 
-  {
-    for (cs_lnum_t i = 0; i < c_size; i++)
-      c_x_val[i] = 0;
-
-    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
-
-      cs_lnum_t i = c_coarse_row[ii];
-
-      if (i > -1 && i < c_n_rows) {
-
-        for (cs_lnum_t jj_ind = f_row_index[ii];
-             jj_ind < f_row_index[ii+1];
-             jj_ind++) {
-
-          cs_lnum_t jj = f_col_id[jj_ind];
-
-          cs_lnum_t j = c_coarse_row[jj];
-
-          if (j > -1) {
-
-            if (i != j) {
-              cs_lnum_t s_id = c_row_index[i];
-              cs_lnum_t n_cols = c_row_index[i+1] - s_id;
-              /* ids are sorted, so binary search possible */
-              cs_lnum_t k = _l_id_binary_search(n_cols, j, c_col_id + s_id);
-              c_x_val[k + s_id] += f_x_val[jj_ind];
-            }
-            else { /* i == j */
-              for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
-                /* diagonal terms only */
-                c_d_val[i*db_size[3] + db_size[2]*kk + kk]
-                  += f_x_val[jj_ind];
-              }
-            }
-
-          }
-        }
-
-      }
+  BFT_MALLOC(c_d_val, c_n_rows*db_size[3], cs_real_t);
 
-    }
+  _compute_coarse_values_msr(fine_grid, coarse_grid,
+                             cf_row_idx, f_row_id,
+                             c_row_index, c_col_id,
+                             c_d_val, c_x_val);
 
-  }
+  BFT_FREE(f_row_id);
+  BFT_FREE(cf_row_idx);
 
   _build_coarse_matrix_msr(coarse_grid, fine_grid->symmetric,
                            c_row_index, c_col_id,
@@ -5473,6 +5735,26 @@ cs_grid_get_matrix(const cs_grid_t  *g)
   return m;
 }
 
+/*----------------------------------------------------------------------------
+ * Use single precision extra-diagonal coefficients for matrix.vector
+ * products with a grid's associated matrix.
+ *
+ * This has no effect on grids whose matrix is shared with the caller
+ * (i.e. the finest grid), or on matrix types not supporting this.
+ *
+ * parameters:
+ *   g <-> Grid structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_matrix_single_precision(cs_grid_t  *g)
+{
+  assert(g != NULL);
+
+  if (g->_matrix != NULL)
+    cs_matrix_set_spmv_single_precision(g->_matrix);
+}
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -6013,6 +6295,187 @@ cs_grid_coarsen_to_single(const cs_grid_t  *f,
   return c;
 }
 
+/*----------------------------------------------------------------------------
+ * Check whether coarse grid matrix coefficients may be updated from a
+ * fine grid, keeping the existing aggregation and coarse matrix structure.
+ *
+ * Coarse grids resulting from grid merging or built with
+ * convection/diffusion matrices cannot be updated, and the quantities
+ * required for the coarse grid computation must not have been freed
+ * (see cs_grid_free_quantities).
+ *
+ * This function does not require any communication, so it may be
+ * used to determine (with a reduction) whether all ranks will be able
+ * to call cs_grid_update_coarse_quantities.
+ *
+ * parameters:
+ *   f <-- Fine grid structure
+ *   c <-- Coarse grid structure
+ *
+ * returns:
+ *   true if coarse coefficients may be updated, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_is_coarse_updatable(const cs_grid_t  *f,
+                            const cs_grid_t  *c)
+{
+  if (f == NULL || c == NULL)
+    return false;
+
+  if (   c->coarse_row == NULL || c->_matrix == NULL
+      || c->conv_diff || f->conv_diff)
+    return false;
+
+  /* Merged grids use a different local numbering than the
+     one used for restriction */
+
+  if (   c->n_elts_r[0] != c->n_rows
+      || c->n_elts_r[1] != c->n_cols_ext)
+    return false;
+
+#if defined(HAVE_MPI)
+  if (c->merge_sub_size > 1 || c->merge_cell_idx != NULL)
+    return false;
+#endif
+
+  for (int i = 0; i < 4; i++) {
+    if (f->db_size[i] != c->db_size[i] || f->eb_size[i] != c->eb_size[i])
+      return false;
+  }
+
+  if (f->symmetric != c->symmetric)
+    return false;
+
+  /* Same paths as in cs_grid_coarsen */
+
+  cs_matrix_type_t fine_matrix_type = cs_matrix_get_type(f->matrix);
+
+  if (fine_matrix_type == CS_MATRIX_MSR && c->relaxation <= 0) {
+    if (cs_matrix_get_type(c->matrix) != CS_MATRIX_MSR)
+      return false;
+  }
+
+  else if (f->face_cell != NULL) {
+    if (   c->coarse_face == NULL || c->face_cell == NULL
+        || c->_da == NULL || c->_xa == NULL
+        || f->da == NULL || f->xa == NULL)
+      return false;
+    if (c->relaxation > 0) {
+      if (   c->_xa0 == NULL || c->xa0ij == NULL
+          || c->_face_normal == NULL || c->_cell_cen == NULL
+          || f->xa0 == NULL || f->xa0ij == NULL || f->face_normal == NULL)
+        return false;
+    }
+  }
+
+  else
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Update coarse grid matrix coefficients from a fine grid, keeping the
+ * existing fine -> coarse row aggregation and coarse matrix structure.
+ *
+ * This allows reusing a grid hierarchy when only the fine matrix
+ * coefficients have changed. The fine grid must have the same
+ * dimensions and graph as the one used to build the coarse grid
+ * (see also cs_grid_is_coarse_updatable).
+ *
+ * parameters:
+ *   f         <-- Fine grid structure
+ *   c         <-> Coarse grid structure
+ *   verbosity <-- Verbosity level
+ *
+ * returns:
+ *   true if coarse coefficients were updated, false if the coarse grid
+ *   needs to be rebuilt
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_update_coarse_quantities(const cs_grid_t  *f,
+                                 cs_grid_t        *c,
+                                 int               verbosity)
+{
+  if (cs_grid_is_coarse_updatable(f, c) == false)
+    return false;
+
+  c->parent = f;
+
+  cs_matrix_type_t fine_matrix_type = cs_matrix_get_type(f->matrix);
+
+  if (fine_matrix_type == CS_MATRIX_MSR && c->relaxation <= 0) {
+
+    const cs_lnum_t  *c_row_index, *c_col_id;
+
+    cs_matrix_get_msr_arrays(c->matrix,
+                             &c_row_index, &c_col_id,
+                             NULL, NULL);
+
+    cs_lnum_t *cf_row_idx = NULL, *f_row_id = NULL;
+
+    _coarse_to_fine_rows(f->n_rows, c->n_rows, c->coarse_row,
+                         &cf_row_idx, &f_row_id);
+
+    cs_real_t  *c_d_val, *c_x_val;
+    BFT_MALLOC(c_d_val, c->n_rows*c->db_size[3], cs_real_t);
+    BFT_MALLOC(c_x_val, c_row_index[c->n_rows], cs_real_t);
+
+    /* A fine entry not found in the coarse structure means the
+       fine matrix graph has changed */
+
+    bool is_valid = _compute_coarse_values_msr(f, c,
+                                               cf_row_idx, f_row_id,
+                                               c_row_index, c_col_id,
+                                               c_d_val, c_x_val);
+
+    BFT_FREE(f_row_id);
+    BFT_FREE(cf_row_idx);
+
+    if (is_valid == false) {
+      BFT_FREE(c_x_val);
+      BFT_FREE(c_d_val);
+      return false;
+    }
+
+    cs_matrix_transfer_coefficients_msr(c->_matrix,
+                                        f->symmetric,
+                                        NULL,
+                                        NULL,
+                                        c_row_index,
+                                        c_col_id,
+                                        &c_d_val,
+                                        &c_x_val);
+
+  }
+
+  else {
+
+    _compute_coarse_quantities_native(f, c, verbosity);
+
+    if (c->halo != NULL)
+      cs_halo_sync_var_strided(c->halo, CS_HALO_STANDARD,
+                               c->_da, c->db_size[3]);
+
+    cs_matrix_set_coefficients(c->_matrix,
+                               c->symmetric,
+                               c->db_size,
+                               c->eb_size,
+                               c->n_faces,
+                               c->face_cell,
+                               c->da,
+                               c->xa);
+
+  }
+
+  if (verbosity > 3)
+    _verify_matrix(c);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Compute coarse row variable values from fine row values
  *
@@ -254,6 +254,20 @@ cs_grid_get_n_g_rows(const cs_grid_t  *g);
 const cs_matrix_t *
 cs_grid_get_matrix(const cs_grid_t  *g);
 
+/*----------------------------------------------------------------------------
+ * Use single precision extra-diagonal coefficients for matrix.vector
+ * products with a grid's associated matrix.
+ *
+ * This has no effect on grids whose matrix is shared with the caller
+ * (i.e. the finest grid), or on matrix types not supporting this.
+ *
+ * parameters:
+ *   g <-> Grid structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_matrix_single_precision(cs_grid_t  *g);
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -332,6 +346,55 @@ cs_grid_coarsen_to_single(const cs_grid_t  *f,
                           int               merge_stride,
                           int               verbosity);
 
+/*----------------------------------------------------------------------------
+ * Check whether coarse grid matrix coefficients may be updated from a
+ * fine grid, keeping the existing aggregation and coarse matrix structure.
+ *
+ * Coarse grids resulting from grid merging or built with
+ * convection/diffusion matrices cannot be updated, and the quantities
+ * required for the coarse grid computation must not have been freed
+ * (see cs_grid_free_quantities).
+ *
+ * This function does not require any communication, so it may be
+ * used to determine (with a reduction) whether all ranks will be able
+ * to call cs_grid_update_coarse_quantities.
+ *
+ * parameters:
+ *   f <-- Fine grid structure
+ *   c <-- Coarse grid structure
+ *
+ * returns:
+ *   true if coarse coefficients may be updated, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_is_coarse_updatable(const cs_grid_t  *f,
+                            const cs_grid_t  *c);
+
+/*----------------------------------------------------------------------------
+ * Update coarse grid matrix coefficients from a fine grid, keeping the
+ * existing fine -> coarse row aggregation and coarse matrix structure.
+ *
+ * This allows reusing a grid hierarchy when only the fine matrix
+ * coefficients have changed. The fine grid must have the same
+ * dimensions and graph as the one used to build the coarse grid
+ * (see also cs_grid_is_coarse_updatable).
+ *
+ * parameters:
+ *   f         <-- Fine grid structure
+ *   c         <-> Coarse grid structure
+ *   verbosity <-- Verbosity level
+ *
+ * returns:
+ *   true if coarse coefficients were updated, false if the coarse grid
+ *   needs to be rebuilt
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_update_coarse_quantities(const cs_grid_t  *f,
+                                 cs_grid_t        *c,
+                                 int               verbosity);
+
 /*----------------------------------------------------------------------------
  * Compute coarse row variable values from fine row values
  *
@@ -119,6 +119,15 @@ BEGIN_C_DECLS
 
 #define CS_CL  (CS_CL_SIZE/8)
 
+/* SELL-C-sigma slice size and sorting window, in rows */
+
+#define CS_SELL_C      8
+#define CS_SELL_SIGMA  (32*CS_SELL_C)
+
+/* Number of interleaved vectors handled together in multi-vector products */
+
+#define CS_MULTI_VEC_CHUNK  4
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -135,7 +144,9 @@ BEGIN_C_DECLS
 const char  *cs_matrix_type_name[] = {N_("native"),
                                       N_("CSR"),
                                       N_("symmetric CSR"),
-                                      N_("MSR")};
+                                      N_("MSR"),
+                                      N_("SELL"),
+                                      N_("shell")};
 
 /* Full names for matrix types */
 
@@ -143,7 +154,9 @@ const char
 *cs_matrix_type_fullname[] = {N_("diagonal + faces"),
                               N_("Compressed Sparse Row"),
                               N_("symmetric Compressed Sparse Row"),
-                              N_("Modified Compressed Sparse Row")};
+                              N_("Modified Compressed Sparse Row"),
+                              N_("Sliced ELLPACK"),
+                              N_("matrix-free")};
 
 /* Fill type names for matrices */
 
@@ -405,6 +418,56 @@ _dense_eb_ax_add(cs_lnum_t        b_i,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute matrix-vector product increment for one dense block:
+ * y += a.x
+ *
+ * This variant uses a fixed 3x3 block, for better compiler optimization.
+ * Block and vector offsets must be applied by the caller.
+ *
+ * parameters:
+ *   a      <-- pointer to block matrix values
+ *   x      <-- multipliying vector values
+ *   y      <-> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_dense_3_3_ax_add(const cs_real_t  a[restrict],
+                  const cs_real_t  x[restrict],
+                  cs_real_t        y[restrict])
+{
+  y[0] += a[0]*x[0] + a[1]*x[1] + a[2]*x[2];
+  y[1] += a[3]*x[0] + a[4]*x[1] + a[5]*x[2];
+  y[2] += a[6]*x[0] + a[7]*x[1] + a[8]*x[2];
+}
+
+/*----------------------------------------------------------------------------
+ * Compute matrix-vector product increment for one dense block:
+ * y += a.x
+ *
+ * This variant uses a fixed 6x6 block, for better compiler optimization.
+ * Block and vector offsets must be applied by the caller.
+ *
+ * parameters:
+ *   a      <-- pointer to block matrix values
+ *   x      <-- multipliying vector values
+ *   y      <-> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_dense_6_6_ax_add(const cs_real_t  a[restrict],
+                  const cs_real_t  x[restrict],
+                  cs_real_t        y[restrict])
+{
+  for (int ii = 0; ii < 6; ii++)
+    y[ii] +=   a[ii*6]     * x[0]
+             + a[ii*6 + 1] * x[1]
+             + a[ii*6 + 2] * x[2]
+             + a[ii*6 + 3] * x[3]
+             + a[ii*6 + 4] * x[4]
+             + a[ii*6 + 5] * x[5];
+}
+
 /*----------------------------------------------------------------------------
  * y[i] = da[i].x[i], with da possibly NULL
  *
@@ -827,7 +890,7 @@ _release_coeffs_native(cs_matrix_t  *matrix)
 }
 
 /*----------------------------------------------------------------------------
- * Copy diagonal of native or MSR matrix.
+ * Copy diagonal of native, MSR or SELL matrix.
  *
  * parameters:
  *   matrix <-- pointer to matrix structure
@@ -843,7 +906,8 @@ _copy_diagonal_separate(const cs_matrix_t  *matrix,
     const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
     _da = mc->da;
   }
-  else if (matrix->type == CS_MATRIX_MSR) {
+  else if (   matrix->type == CS_MATRIX_MSR
+           || matrix->type == CS_MATRIX_SELL) {
     const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
     _da = mc->d_val;
   }
@@ -1258,6 +1322,172 @@ _b_mat_vec_p_l_native_fixed(bool                exclude_diag,
     _b_mat_vec_p_l_native(exclude_diag, matrix, x, y);
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with native matrix, with full
+ * extradiagonal blocks.
+ *
+ * This variant uses fixed 3x3 blocks, for better compiler optimization.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_3_3_mat_vec_p_l_native(bool                exclude_diag,
+                           const cs_matrix_t  *matrix,
+                           const cs_real_t     x[restrict],
+                           cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  const cs_real_t  *restrict xa = mc->xa;
+
+  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
+  assert(matrix->eb_size[0] == 3 && matrix->eb_size[3] == 9);
+
+  /* Diagonal part of matrix.vector product */
+
+  if (! exclude_diag) {
+    _3_3_diag_vec_p_l(mc->da, x, y, ms->n_rows);
+    _3_3_zero_range(y, ms->n_rows, ms->n_cols_ext);
+  }
+  else
+    _3_3_zero_range(y, 0, ms->n_cols_ext);
+
+  /* non-diagonal terms */
+
+  if (mc->xa != NULL) {
+
+    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+    if (mc->symmetric) {
+
+      for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
+        cs_lnum_t ii = face_cel_p[face_id][0];
+        cs_lnum_t jj = face_cel_p[face_id][1];
+        _dense_3_3_ax_add(xa + face_id*9, x + jj*3, y + ii*3);
+        _dense_3_3_ax_add(xa + face_id*9, x + ii*3, y + jj*3);
+      }
+    }
+    else {
+
+      for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
+        cs_lnum_t ii = face_cel_p[face_id][0];
+        cs_lnum_t jj = face_cel_p[face_id][1];
+        _dense_3_3_ax_add(xa + face_id*18, x + jj*3, y + ii*3);
+        _dense_3_3_ax_add(xa + face_id*18 + 9, x + ii*3, y + jj*3);
+      }
+
+    }
+
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with native matrix, with full
+ * extradiagonal blocks.
+ *
+ * This variant uses fixed 6x6 blocks, for better compiler optimization.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_6_6_mat_vec_p_l_native(bool                exclude_diag,
+                           const cs_matrix_t  *matrix,
+                           const cs_real_t     x[restrict],
+                           cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  const cs_real_t  *restrict xa = mc->xa;
+
+  assert(matrix->db_size[0] == 6 && matrix->db_size[3] == 36);
+  assert(matrix->eb_size[0] == 6 && matrix->eb_size[3] == 36);
+
+  /* Diagonal part of matrix.vector product */
+
+  if (! exclude_diag) {
+    _6_6_diag_vec_p_l(mc->da, x, y, ms->n_rows);
+    _6_6_zero_range(y, ms->n_rows, ms->n_cols_ext);
+  }
+  else
+    _6_6_zero_range(y, 0, ms->n_cols_ext);
+
+  /* non-diagonal terms */
+
+  if (mc->xa != NULL) {
+
+    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+    if (mc->symmetric) {
+
+      for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
+        cs_lnum_t ii = face_cel_p[face_id][0];
+        cs_lnum_t jj = face_cel_p[face_id][1];
+        _dense_6_6_ax_add(xa + face_id*36, x + jj*6, y + ii*6);
+        _dense_6_6_ax_add(xa + face_id*36, x + ii*6, y + jj*6);
+      }
+    }
+    else {
+
+      for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
+        cs_lnum_t ii = face_cel_p[face_id][0];
+        cs_lnum_t jj = face_cel_p[face_id][1];
+        _dense_6_6_ax_add(xa + face_id*72, x + jj*6, y + ii*6);
+        _dense_6_6_ax_add(xa + face_id*72 + 36, x + ii*6, y + jj*6);
+      }
+
+    }
+
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with native matrix, with full
+ * extradiagonal blocks.
+ *
+ * This variant uses fixed block size variants for common cases.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_native_fixed(bool                exclude_diag,
+                             const cs_matrix_t  *matrix,
+                             const cs_real_t     x[restrict],
+                             cs_real_t           y[restrict])
+{
+  const cs_lnum_t *db_size = matrix->db_size;
+  const cs_lnum_t *eb_size = matrix->eb_size;
+
+  if (   db_size[0] == 3 && db_size[1] == 3 && db_size[3] == 9
+      && eb_size[0] == 3 && eb_size[3] == 9)
+    _bb_3_3_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+
+  else if (   db_size[0] == 6 && db_size[1] == 6 && db_size[3] == 36
+           && eb_size[0] == 6 && eb_size[3] == 36)
+    _bb_6_6_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+
+  else
+    _bb_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+}
+
 #if defined(HAVE_OPENMP) /* OpenMP variants */
 
 /*----------------------------------------------------------------------------
@@ -1614,16 +1844,33 @@ _mat_vec_p_l_native_vector(bool                exclude_diag,
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
+    /* Faces are numbered in conflict-free blocks of vector_size,
+       possibly followed by a remainder handled in scalar mode */
+
+    const cs_lnum_t vector_size = matrix->numbering->vector_size;
+    const cs_lnum_t n_block_edges
+      =   matrix->numbering->group_index[1]
+        - matrix->numbering->group_index[1] % vector_size;
+
     if (mc->symmetric) {
 
-#     if defined(HAVE_OPENMP_SIMD)
-#       pragma omp simd safelen(CS_NUMBERING_SIMD_SIZE)
-#     else
-#       pragma dir nodep
-#       pragma GCC ivdep
-#       pragma _NEC ivdep
-#     endif
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
+      for (cs_lnum_t b_id = 0; b_id < n_block_edges; b_id += vector_size) {
+#       if defined(HAVE_OPENMP_SIMD)
+#         pragma omp simd
+#       else
+#         pragma dir nodep
+#         pragma GCC ivdep
+#         pragma _NEC ivdep
+#       endif
+        for (face_id = b_id; face_id < b_id + vector_size; face_id++) {
+          ii = face_cel_p[face_id][0];
+          jj = face_cel_p[face_id][1];
+          y[ii] += xa[face_id] * x[jj];
+          y[jj] += xa[face_id] * x[ii];
+        }
+      }
+
+      for (face_id = n_block_edges; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
         y[ii] += xa[face_id] * x[jj];
@@ -1633,14 +1880,23 @@ _mat_vec_p_l_native_vector(bool                exclude_diag,
     }
     else {
 
-#     if defined(HAVE_OPENMP_SIMD)
-#       pragma omp simd safelen(CS_NUMBERING_SIMD_SIZE)
-#     else
-#       pragma dir nodep
-#       pragma GCC ivdep
-#       pragma _NEC ivdep
-#     endif
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
+      for (cs_lnum_t b_id = 0; b_id < n_block_edges; b_id += vector_size) {
+#       if defined(HAVE_OPENMP_SIMD)
+#         pragma omp simd
+#       else
+#         pragma dir nodep
+#         pragma GCC ivdep
+#         pragma _NEC ivdep
+#       endif
+        for (face_id = b_id; face_id < b_id + vector_size; face_id++) {
+          ii = face_cel_p[face_id][0];
+          jj = face_cel_p[face_id][1];
+          y[ii] += xa[2*face_id] * x[jj];
+          y[jj] += xa[2*face_id + 1] * x[ii];
+        }
+      }
+
+      for (face_id = n_block_edges; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
         y[ii] += xa[2*face_id] * x[jj];
@@ -1670,6 +1926,10 @@ _destroy_struct_csr(cs_matrix_struct_csr_t  **matrix)
 
     BFT_FREE(ms->_col_id);
 
+    BFT_FREE(ms->_row_part);
+
+    BFT_FREE(ms->_xa_src_id);
+
     BFT_FREE(ms);
 
     *matrix = NULL;
@@ -1677,6 +1937,139 @@ _destroy_struct_csr(cs_matrix_struct_csr_t  **matrix)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Partition rows of a CSR matrix structure into interior rows (referencing
+ * no ghost column) and boundary rows.
+ *
+ * This allows overlapping the halo exchange preceding a matrix.vector
+ * product with computations on interior rows.
+ *
+ * parameters:
+ *   ms  <-> pointer to CSR matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_row_partition_csr(cs_matrix_struct_csr_t  *ms)
+{
+  const cs_lnum_t n_rows = ms->n_rows;
+
+  ms->n_i_rows = n_rows;
+  ms->_row_part = NULL;
+
+  if (ms->n_cols_ext <= n_rows)
+    return;
+
+  cs_lnum_t n_i_rows = 0, n_b_rows = 0;
+
+  BFT_MALLOC(ms->_row_part, n_rows, cs_lnum_t);
+
+  /* Interior rows are added from the start, boundary rows from the end */
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    bool is_boundary = false;
+    for (cs_lnum_t jj = ms->row_index[ii]; jj < ms->row_index[ii+1]; jj++) {
+      if (ms->col_id[jj] >= n_rows) {
+        is_boundary = true;
+        break;
+      }
+    }
+    if (is_boundary) {
+      n_b_rows++;
+      ms->_row_part[n_rows - n_b_rows] = ii;
+    }
+    else
+      ms->_row_part[n_i_rows++] = ii;
+  }
+
+  if (n_b_rows == 0) {
+    BFT_FREE(ms->_row_part);
+    return;
+  }
+
+  /* Restore increasing id order for boundary rows */
+
+  for (cs_lnum_t ii = 0; ii < n_b_rows/2; ii++) {
+    cs_lnum_t tmp_id = ms->_row_part[n_i_rows + ii];
+    ms->_row_part[n_i_rows + ii] = ms->_row_part[n_rows - 1 - ii];
+    ms->_row_part[n_rows - 1 - ii] = tmp_id;
+  }
+
+  ms->n_i_rows = n_i_rows;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the mapping from native (edge-based) extradiagonal values to
+ * extradiagonal entries of a CSR matrix structure with no diagonal
+ * (as used by MSR matrices).
+ *
+ * The map is only built when each extradiagonal entry matches exactly
+ * one edge side (i.e. direct assembly is possible); otherwise, the
+ * structure is left unchanged.
+ *
+ * parameters:
+ *   ms       <-> pointer to CSR matrix structure
+ *   n_edges  <-- local number of graph edges
+ *   edges    <-- edges (symmetric row <-> column) connectivity
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_edge_map_csr(cs_matrix_struct_csr_t  *ms,
+                  cs_lnum_t                n_edges,
+                  const cs_lnum_2_t       *edges)
+{
+  BFT_FREE(ms->_xa_src_id);
+  ms->n_edges = 0;
+  ms->edges = NULL;
+
+  if (ms->have_diag || ms->direct_assembly == false)
+    return;
+
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_lnum_t n_vals = ms->row_index[n_rows];
+
+  cs_lnum_t *xa_src_id;
+  BFT_MALLOC(xa_src_id, n_vals, cs_lnum_t);
+
+# pragma omp parallel for  if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t kk = 0; kk < n_vals; kk++)
+    xa_src_id[kk] = -1;
+
+  bool complete = true;
+
+  for (cs_lnum_t face_id = 0; face_id < n_edges && complete; face_id++) {
+    cs_lnum_t ii = edges[face_id][0];
+    cs_lnum_t jj = edges[face_id][1];
+    for (int side = 0; side < 2; side++) {
+      if (ii < n_rows) {
+        cs_lnum_t s_id = ms->row_index[ii], e_id = ms->row_index[ii+1];
+        cs_lnum_t kk;
+        for (kk = s_id; kk < e_id && ms->col_id[kk] != jj; kk++);
+        if (kk < e_id && xa_src_id[kk] < 0)
+          xa_src_id[kk] = 2*face_id + side;
+        else
+          complete = false;
+      }
+      cs_lnum_t tmp_id = ii;
+      ii = jj;
+      jj = tmp_id;
+    }
+  }
+
+  for (cs_lnum_t kk = 0; kk < n_vals && complete; kk++) {
+    if (xa_src_id[kk] < 0)
+      complete = false;
+  }
+
+  if (complete == false) {
+    BFT_FREE(xa_src_id);
+    return;
+  }
+
+  ms->n_edges = n_edges;
+  ms->edges = edges;
+  ms->_xa_src_id = xa_src_id;
+}
+
 /*----------------------------------------------------------------------------
  * Create a CSR matrix structure from a native matrix stucture.
  *
@@ -1828,6 +2221,12 @@ _create_struct_csr(bool                have_diag,
   ms->row_index = ms->_row_index;
   ms->col_id = ms->_col_id;
 
+  _set_row_partition_csr(ms);
+
+  ms->n_edges = 0;
+  ms->edges = NULL;
+  ms->_xa_src_id = NULL;
+
   return ms;
 }
 
@@ -1896,6 +2295,12 @@ _create_struct_csr_from_csr(bool         have_diag,
 
   }
 
+  _set_row_partition_csr(ms);
+
+  ms->n_edges = 0;
+  ms->edges = NULL;
+  ms->_xa_src_id = NULL;
+
   return ms;
 }
 
@@ -1941,6 +2346,12 @@ _create_struct_csr_from_shared(bool              have_diag,
   ms->_row_index = NULL;
   ms->_col_id = NULL;
 
+  _set_row_partition_csr(ms);
+
+  ms->n_edges = 0;
+  ms->edges = NULL;
+  ms->_xa_src_id = NULL;
+
   return ms;
 }
 
@@ -2000,6 +2411,12 @@ _create_struct_csr_from_restrict_local(const cs_matrix_struct_csr_t  *src)
   ms->row_index = ms->_row_index;
   ms->col_id = ms->_col_id;
 
+  _set_row_partition_csr(ms);
+
+  ms->n_edges = 0;
+  ms->edges = NULL;
+  ms->_xa_src_id = NULL;
+
   return ms;
 }
 
@@ -2629,12 +3046,122 @@ _mat_vec_p_l_csr(bool                exclude_diag,
 
 }
 
-#if defined (HAVE_MKL)
-
-static void
-_mat_vec_p_l_csr_mkl(bool                exclude_diag,
-                     const cs_matrix_t  *matrix,
-                     const cs_real_t    *restrict x,
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product Y = A.X with CSR matrix, for n_vecs
+ * interleaved vectors (x[i*n_vecs + k] is the value of vector k at row i).
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   n_vecs <-- number of vectors
+ *   x      <-- multipliying vector values
+ *   y      --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_csr_multi(const cs_matrix_t  *matrix,
+                       cs_lnum_t           n_vecs,
+                       const cs_real_t    *restrict x,
+                       cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_csr_t  *mc = matrix->coeffs;
+  cs_lnum_t  n_rows = ms->n_rows;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    cs_real_t *restrict y_ii = y + ii*n_vecs;
+
+    cs_lnum_t k0 = 0;
+
+    /* Blocks of CS_MULTI_VEC_CHUNK vectors, accumulated in registers */
+
+    for ( ; k0 + CS_MULTI_VEC_CHUNK <= n_vecs; k0 += CS_MULTI_VEC_CHUNK) {
+      cs_real_t s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t *restrict _x = x + col_id[jj]*n_vecs + k0;
+        const cs_real_t m_ij = m_row[jj];
+        s0 += m_ij*_x[0];
+        s1 += m_ij*_x[1];
+        s2 += m_ij*_x[2];
+        s3 += m_ij*_x[3];
+      }
+      y_ii[k0] = s0;
+      y_ii[k0+1] = s1;
+      y_ii[k0+2] = s2;
+      y_ii[k0+3] = s3;
+    }
+
+    /* Remaining vectors */
+
+    for ( ; k0 < n_vecs; k0++) {
+      cs_real_t sii = 0.0;
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += m_row[jj]*x[col_id[jj]*n_vecs + k0];
+      y_ii[k0] = sii;
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with CSR matrix, restricted to
+ * a given list of rows.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   n_row_ids    <-- number of rows in list
+ *   row_ids      <-- ids of rows in list
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_csr_rows(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      cs_lnum_t           n_row_ids,
+                      const cs_lnum_t    *restrict row_ids,
+                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_csr_t  *mc = matrix->coeffs;
+
+# pragma omp parallel for  if(n_row_ids > CS_THR_MIN)
+  for (cs_lnum_t kk = 0; kk < n_row_ids; kk++) {
+
+    const cs_lnum_t ii = row_ids[kk];
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    cs_real_t sii = 0.0;
+
+    if (!exclude_diag) {
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += (m_row[jj]*x[col_id[jj]]);
+    }
+    else {
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        if (col_id[jj] != ii)
+          sii += (m_row[jj]*x[col_id[jj]]);
+      }
+    }
+
+    y[ii] = sii;
+
+  }
+}
+
+#if defined (HAVE_MKL)
+
+static void
+_mat_vec_p_l_csr_mkl(bool                exclude_diag,
+                     const cs_matrix_t  *matrix,
+                     const cs_real_t    *restrict x,
                      cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
@@ -3246,6 +3773,8 @@ _create_coeff_msr(void)
   mc->_d_val = NULL;
   mc->_x_val = NULL;
 
+  mc->x_val_sp = NULL;
+
   return mc;
 }
 
@@ -3263,6 +3792,8 @@ _destroy_coeff_msr(cs_matrix_coeff_msr_t  **coeff)
 
     cs_matrix_coeff_msr_t  *mc = *coeff;
 
+    BFT_FREE(mc->x_val_sp);
+
     BFT_FREE(mc->_x_val);
 
     BFT_FREE(mc->_d_val);
@@ -3464,6 +3995,102 @@ _set_xa_coeffs_msr_increment(cs_matrix_t        *matrix,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Set MSR extradiagonal matrix coefficients using full blocks.
+ *
+ * The matrix coefficients should have been initialized (i.e. set to 0)
+ * some before using this function, so both direct and incremental
+ * assembly are handled.
+ *
+ * parameters:
+ *   matrix      <-- pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   xa          <-- extradiagonal values
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_xa_coeffs_msr_block(cs_matrix_t        *matrix,
+                         bool                symmetric,
+                         cs_lnum_t           n_edges,
+                         const cs_lnum_2_t  *edges,
+                         const cs_real_t    *restrict xa)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t  b_size = matrix->eb_size[3];
+
+  /* Copy extra-diagonal values */
+
+  assert(edges != NULL);
+
+  const cs_lnum_t  xa_stride = (symmetric) ? 1 : 2;
+  const cs_lnum_t  xa_shift = (symmetric) ? 0 : 1;
+
+  for (cs_lnum_t face_id = 0; face_id < n_edges; face_id++) {
+    cs_lnum_t  ii = edges[face_id][0];
+    cs_lnum_t  jj = edges[face_id][1];
+    const cs_real_t  *xa_ij = xa + xa_stride*face_id*b_size;
+    const cs_real_t  *xa_ji = xa + (xa_stride*face_id + xa_shift)*b_size;
+    if (ii < ms->n_rows) {
+      cs_lnum_t kk;
+      for (kk = ms->row_index[ii]; ms->col_id[kk] != jj; kk++);
+      for (cs_lnum_t ll = 0; ll < b_size; ll++)
+        mc->_x_val[kk*b_size + ll] += xa_ij[ll];
+    }
+    if (jj < ms->n_rows) {
+      cs_lnum_t kk;
+      for (kk = ms->row_index[jj]; ms->col_id[kk] != ii; kk++);
+      for (cs_lnum_t ll = 0; ll < b_size; ll++)
+        mc->_x_val[kk*b_size + ll] += xa_ji[ll];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set MSR extradiagonal matrix coefficients using the structure's
+ * precomputed edge map.
+ *
+ * Each extradiagonal value is gathered from its matching native value,
+ * so no search or indirect write is required.
+ *
+ * parameters:
+ *   matrix      <-- pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   xa          <-- extradiagonal values
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_xa_coeffs_msr_mapped(cs_matrix_t        *matrix,
+                          bool                symmetric,
+                          const cs_real_t    *restrict xa)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  *restrict xa_src_id = ms->_xa_src_id;
+  cs_real_t  *restrict x_val = mc->_x_val;
+
+  /* Symmetric values are shared by both sides of an edge */
+
+  const int shift = (symmetric) ? 1 : 0;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t  s_id = ms->row_index[ii];
+    const cs_lnum_t  e_id = ms->row_index[ii+1];
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd
+#   endif
+    for (cs_lnum_t kk = s_id; kk < e_id; kk++)
+      x_val[kk] = xa[xa_src_id[kk] >> shift];
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Map or copy MSR matrix diagonal coefficients.
  *
@@ -3615,15 +4242,29 @@ _set_coeffs_msr(cs_matrix_t         *matrix,
 
   _map_or_copy_da_coeffs_msr(matrix, copy, da);
 
+  /* Extradiagonal full blocks (always initialized to zero) */
+
+  if (matrix->eb_size[0] > 1) {
+    _map_or_copy_xa_coeffs_msr(matrix, true, NULL);
+    if (xa != NULL)
+      _set_xa_coeffs_msr_block(matrix, symmetric, n_edges, edges, xa);
+    return;
+  }
+
   /* Extradiagonal values */
 
   if (mc->_x_val == NULL)
     BFT_MALLOC(mc->_x_val, ms->row_index[ms->n_rows], cs_real_t);
   mc->x_val = mc->_x_val;
 
-  /* Copy extra-diagonal values if assembly is direct */
+  /* Copy extra-diagonal values if assembly is direct, using the
+     structure's edge map if it matches the given edges */
 
-  if (ms->direct_assembly)
+  if (   ms->_xa_src_id != NULL && xa != NULL
+      && ms->edges == edges && ms->n_edges == n_edges)
+    _set_xa_coeffs_msr_mapped(matrix, symmetric, xa);
+
+  else if (ms->direct_assembly)
     _set_xa_coeffs_msr_direct(matrix, symmetric, n_edges, edges, xa);
 
   /* Initialize coefficients to zero if assembly is incremental */
@@ -3794,6 +4435,120 @@ _mat_vec_p_l_msr(bool                exclude_diag,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product Y = A.X with MSR matrix, for n_vecs
+ * interleaved vectors (x[i*n_vecs + k] is the value of vector k at row i).
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   n_vecs <-- number of vectors
+ *   x      <-- multipliying vector values
+ *   y      --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_multi(const cs_matrix_t  *matrix,
+                       cs_lnum_t           n_vecs,
+                       const cs_real_t    *restrict x,
+                       cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_real_t *restrict d_val = mc->d_val;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    const cs_real_t d_ii = (d_val != NULL) ? d_val[ii] : 0.0;
+    const cs_real_t *restrict x_ii = x + ii*n_vecs;
+    cs_real_t *restrict y_ii = y + ii*n_vecs;
+
+    cs_lnum_t k0 = 0;
+
+    /* Blocks of CS_MULTI_VEC_CHUNK vectors, accumulated in registers */
+
+    for ( ; k0 + CS_MULTI_VEC_CHUNK <= n_vecs; k0 += CS_MULTI_VEC_CHUNK) {
+      cs_real_t s0 = d_ii*x_ii[k0];
+      cs_real_t s1 = d_ii*x_ii[k0+1];
+      cs_real_t s2 = d_ii*x_ii[k0+2];
+      cs_real_t s3 = d_ii*x_ii[k0+3];
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t *restrict _x = x + col_id[jj]*n_vecs + k0;
+        const cs_real_t m_ij = m_row[jj];
+        s0 += m_ij*_x[0];
+        s1 += m_ij*_x[1];
+        s2 += m_ij*_x[2];
+        s3 += m_ij*_x[3];
+      }
+      y_ii[k0] = s0;
+      y_ii[k0+1] = s1;
+      y_ii[k0+2] = s2;
+      y_ii[k0+3] = s3;
+    }
+
+    /* Remaining vectors */
+
+    for ( ; k0 < n_vecs; k0++) {
+      cs_real_t sii = d_ii*x_ii[k0];
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += m_row[jj]*x[col_id[jj]*n_vecs + k0];
+      y_ii[k0] = sii;
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, restricted to
+ * a given list of rows.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   n_row_ids    <-- number of rows in list
+ *   row_ids      <-- ids of rows in list
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_rows(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      cs_lnum_t           n_row_ids,
+                      const cs_lnum_t    *restrict row_ids,
+                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+# pragma omp parallel for  if(n_row_ids > CS_THR_MIN)
+  for (cs_lnum_t kk = 0; kk < n_row_ids; kk++) {
+
+    const cs_lnum_t ii = row_ids[kk];
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    cs_real_t sii = 0.0;
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      sii += (m_row[jj]*x[col_id[jj]]);
+
+    if (d_val != NULL)
+      sii += d_val[ii]*x[ii];
+
+    y[ii] = sii;
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with MSR matrix.
  *
@@ -3999,50 +4754,35 @@ _3_3_mat_vec_p_l_msr(bool                exclude_diag,
 
   assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
 
-  /* Standard case */
+  const bool use_diag = (!exclude_diag && mc->d_val != NULL) ? true : false;
 
-  if (!exclude_diag && mc->d_val != NULL) {
+  /* Accumulate in local values, so that the inner loop may be unrolled
+     and vectorized without aliasing concerns */
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
 
-      _dense_3_3_ax(ii, mc->d_val, x, y);
+    cs_real_t sii[3] = {0., 0., 0.};
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
-      }
+    if (use_diag)
+      _dense_3_3_ax_add(mc->d_val + ii*9, x + ii*3, sii);
 
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_real_t *restrict x_j = x + col_id[jj]*3;
+      sii[0] += m_row[jj]*x_j[0];
+      sii[1] += m_row[jj]*x_j[1];
+      sii[2] += m_row[jj]*x_j[2];
     }
 
-  }
-
-  /* Exclude diagonal */
-
-  else {
-
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-
-      for (cs_lnum_t kk = 0; kk < 3; kk++)
-        y[ii*3 + kk] = 0.;
-
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
-      }
+    y[ii*3]     = sii[0];
+    y[ii*3 + 1] = sii[1];
+    y[ii*3 + 2] = sii[2];
 
-    }
   }
-
 }
 
 /*----------------------------------------------------------------------------
@@ -4067,50 +4807,33 @@ _6_6_mat_vec_p_l_msr(bool                exclude_diag,
 
   assert(matrix->db_size[0] == 6 && matrix->db_size[3] == 36);
 
-  /* Standard case */
-
-  if (!exclude_diag && mc->d_val != NULL) {
-
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-
-      _dense_6_6_ax(ii, mc->d_val, x, y);
-
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
-      }
-
-    }
+  const bool use_diag = (!exclude_diag && mc->d_val != NULL) ? true : false;
 
-  }
+  /* Accumulate in local values, so that the inner loop may be unrolled
+     and vectorized without aliasing concerns */
 
-  /* Exclude diagonal */
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
-  else {
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_real_t sii[6] = {0., 0., 0., 0., 0., 0.};
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    if (use_diag)
+      _dense_6_6_ax_add(mc->d_val + ii*36, x + ii*6, sii);
 
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_real_t *restrict x_j = x + col_id[jj]*6;
       for (cs_lnum_t kk = 0; kk < 6; kk++)
-        y[ii*6 + kk] = 0.;
+        sii[kk] += m_row[jj]*x_j[kk];
+    }
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
-      }
+    for (cs_lnum_t kk = 0; kk < 6; kk++)
+      y[ii*6 + kk] = sii[kk];
 
-    }
   }
-
 }
 
 /*----------------------------------------------------------------------------
@@ -4141,6 +4864,283 @@ _b_mat_vec_p_l_msr(bool                exclude_diag,
     _b_mat_vec_p_l_msr_generic(exclude_diag, matrix, x, y);
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, with full
+ * extradiagonal blocks.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_msr_generic(bool                exclude_diag,
+                            const cs_matrix_t  *matrix,
+                            const cs_real_t     x[restrict],
+                            cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t *db_size = matrix->db_size;
+  const cs_lnum_t *eb_size = matrix->eb_size;
+
+  const bool use_diag = (!exclude_diag && mc->d_val != NULL) ? true : false;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row
+      = mc->x_val + ms->row_index[ii]*eb_size[3];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    if (use_diag)
+      _dense_b_ax(ii, db_size, mc->d_val, x, y);
+    else {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+        y[ii*db_size[1] + kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      _dense_eb_ax_add(ii, col_id[jj], 0, eb_size, m_row + jj*eb_size[3],
+                       x, y);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, with full
+ * extradiagonal blocks.
+ *
+ * This variant uses fixed 3x3 blocks, for better compiler optimization.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_3_3_mat_vec_p_l_msr(bool                exclude_diag,
+                        const cs_matrix_t  *matrix,
+                        const cs_real_t     x[restrict],
+                        cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
+  assert(matrix->eb_size[0] == 3 && matrix->eb_size[3] == 9);
+
+  const bool use_diag = (!exclude_diag && mc->d_val != NULL) ? true : false;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii]*9;
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    cs_real_t sii[3] = {0., 0., 0.};
+
+    if (use_diag)
+      _dense_3_3_ax_add(mc->d_val + ii*9, x + ii*3, sii);
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      _dense_3_3_ax_add(m_row + jj*9, x + col_id[jj]*3, sii);
+
+    for (cs_lnum_t kk = 0; kk < 3; kk++)
+      y[ii*3 + kk] = sii[kk];
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, with full
+ * extradiagonal blocks.
+ *
+ * This variant uses fixed 6x6 blocks, for better compiler optimization.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_6_6_mat_vec_p_l_msr(bool                exclude_diag,
+                        const cs_matrix_t  *matrix,
+                        const cs_real_t     x[restrict],
+                        cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  assert(matrix->db_size[0] == 6 && matrix->db_size[3] == 36);
+  assert(matrix->eb_size[0] == 6 && matrix->eb_size[3] == 36);
+
+  const bool use_diag = (!exclude_diag && mc->d_val != NULL) ? true : false;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii]*36;
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    cs_real_t sii[6] = {0., 0., 0., 0., 0., 0.};
+
+    if (use_diag)
+      _dense_6_6_ax_add(mc->d_val + ii*36, x + ii*6, sii);
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      _dense_6_6_ax_add(m_row + jj*36, x + col_id[jj]*6, sii);
+
+    for (cs_lnum_t kk = 0; kk < 6; kk++)
+      y[ii*6 + kk] = sii[kk];
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, with full
+ * extradiagonal blocks.
+ *
+ * This variant uses fixed block size variants for common cases.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_msr(bool                exclude_diag,
+                    const cs_matrix_t  *matrix,
+                    const cs_real_t     x[restrict],
+                    cs_real_t           y[restrict])
+{
+  const cs_lnum_t *db_size = matrix->db_size;
+  const cs_lnum_t *eb_size = matrix->eb_size;
+
+  if (   db_size[0] == 3 && db_size[1] == 3 && db_size[3] == 9
+      && eb_size[0] == 3 && eb_size[3] == 9)
+    _bb_3_3_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+
+  else if (   db_size[0] == 6 && db_size[1] == 6 && db_size[3] == 36
+           && eb_size[0] == 6 && eb_size[3] == 36)
+    _bb_6_6_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+
+  else
+    _bb_mat_vec_p_l_msr_generic(exclude_diag, matrix, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, using single
+ * precision extradiagonal coefficients.
+ *
+ * Vectors and the diagonal remain in double precision; only the
+ * extradiagonal coefficients (the main contributor to memory traffic)
+ * are read in single precision.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_sp(bool                exclude_diag,
+                    const cs_matrix_t  *matrix,
+                    const cs_real_t    *restrict x,
+                    cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+  assert(mc->x_val_sp != NULL);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const float *restrict m_row = mc->x_val_sp + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    cs_real_t sii = 0.0;
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      sii += (m_row[jj]*x[col_id[jj]]);
+
+    if (d_val != NULL)
+      y[ii] = sii + d_val[ii]*x[ii];
+    else
+      y[ii] = sii;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, blocked version,
+ * using single precision extradiagonal coefficients.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_msr_sp(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      const cs_real_t     x[restrict],
+                      cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t *db_size = matrix->db_size;
+
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+  assert(mc->x_val_sp != NULL);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const float *restrict m_row = mc->x_val_sp + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    if (d_val != NULL)
+      _dense_b_ax(ii, db_size, d_val, x, y);
+    else {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+        y[ii*db_size[1] + kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+        y[ii*db_size[1] + kk]
+          += (m_row[jj]*x[col_id[jj]*db_size[1] + kk]);
+      }
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with MSR matrix, using MKL
  *
@@ -4151,40 +5151,747 @@ _b_mat_vec_p_l_msr(bool                exclude_diag,
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
-#if defined (HAVE_MKL)
+#if defined (HAVE_MKL)
+
+static void
+_mat_vec_p_l_msr_mkl(bool                exclude_diag,
+                     const cs_matrix_t  *matrix,
+                     const cs_real_t     x[restrict],
+                     cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  int n_rows = ms->n_rows;
+  char transa[] = "n";
+
+  mkl_cspblas_dcsrgemv(transa,
+                       &n_rows,
+                       mc->x_val,
+                       ms->row_index,
+                       ms->col_id,
+                       (double *)x,
+                       y);
+
+  /* Add diagonal contribution */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+    cs_lnum_t ii;
+    const double *restrict da = mc->d_val;
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (ii = 0; ii < n_rows; ii++)
+      y[ii] += da[ii] * x[ii];
+  }
+}
+
+#endif /* defined (HAVE_MKL) */
+
+/*----------------------------------------------------------------------------
+ * Destroy a SELL matrix structure.
+ *
+ * parameters:
+ *   matrix  <->  pointer to SELL matrix structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_struct_sell(cs_matrix_struct_sell_t  **matrix)
+{
+  if (matrix != NULL && *matrix !=NULL) {
+
+    cs_matrix_struct_sell_t  *ms = *matrix;
+
+    BFT_FREE(ms->slice_index);
+    BFT_FREE(ms->slice_row_id);
+    BFT_FREE(ms->row_start);
+    BFT_FREE(ms->row_length);
+    BFT_FREE(ms->col_id);
+
+    BFT_FREE(ms);
+
+    *matrix = NULL;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Create a SELL matrix structure from an MSR (CSR without diagonal)
+ * matrix structure.
+ *
+ * Rows are sorted by decreasing number of extra-diagonal entries inside
+ * each window of CS_SELL_SIGMA rows, then grouped in slices of CS_SELL_C
+ * rows. Column ids keep the (sorted) order of the source rows, so
+ * column indexes relative to a row are the same as for the source.
+ *
+ * parameters:
+ *   src <-- pointer to source MSR structure
+ *
+ * returns:
+ *   pointer to allocated SELL matrix structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_struct_sell_t *
+_create_struct_sell_from_csr(const cs_matrix_struct_csr_t  *src)
+{
+  cs_matrix_struct_sell_t  *ms;
+
+  const cs_lnum_t  n_rows = src->n_rows;
+  const cs_lnum_t  c_size = CS_SELL_C;
+
+  assert(src->have_diag == false);
+
+  /* Allocate and map */
+
+  BFT_MALLOC(ms, 1, cs_matrix_struct_sell_t);
+
+  ms->n_rows = n_rows;
+  ms->n_cols_ext = src->n_cols_ext;
+
+  ms->chunk_size = c_size;
+  ms->sigma = CS_SELL_SIGMA;
+  ms->n_slices = (n_rows + c_size - 1) / c_size;
+  ms->n_entries = src->row_index[n_rows];
+
+  ms->direct_assembly = src->direct_assembly;
+
+  BFT_MALLOC(ms->slice_index, ms->n_slices + 1, cs_lnum_t);
+  BFT_MALLOC(ms->slice_row_id, ms->n_slices*c_size, cs_lnum_t);
+  BFT_MALLOC(ms->row_start, n_rows, cs_lnum_t);
+  BFT_MALLOC(ms->row_length, n_rows, cs_lnum_t);
+
+  cs_lnum_t max_row_length = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    ms->row_length[ii] = src->row_index[ii+1] - src->row_index[ii];
+    if (ms->row_length[ii] > max_row_length)
+      max_row_length = ms->row_length[ii];
+  }
+
+  /* Sort rows by decreasing length inside each sigma window;
+     as row lengths are small, we use a (stable) counting sort */
+
+  cs_lnum_t *l_count;
+  BFT_MALLOC(l_count, max_row_length + 2, cs_lnum_t);
+
+  for (cs_lnum_t w_s = 0; w_s < n_rows; w_s += ms->sigma) {
+
+    const cs_lnum_t w_e = CS_MIN(w_s + ms->sigma, n_rows);
+
+    for (cs_lnum_t kk = 0; kk < max_row_length + 2; kk++)
+      l_count[kk] = 0;
+
+    for (cs_lnum_t ii = w_s; ii < w_e; ii++)
+      l_count[max_row_length - ms->row_length[ii] + 1] += 1;
+
+    l_count[0] = w_s;
+    for (cs_lnum_t kk = 0; kk < max_row_length + 1; kk++)
+      l_count[kk+1] += l_count[kk];
+
+    for (cs_lnum_t ii = w_s; ii < w_e; ii++) {
+      cs_lnum_t kk = max_row_length - ms->row_length[ii];
+      ms->slice_row_id[l_count[kk]] = ii;
+      l_count[kk] += 1;
+    }
+
+  }
+
+  BFT_FREE(l_count);
+
+  for (cs_lnum_t ii = n_rows; ii < ms->n_slices*c_size; ii++)
+    ms->slice_row_id[ii] = -1;
+
+  /* Slice widths define the index */
+
+  ms->slice_index[0] = 0;
+
+  for (cs_lnum_t s_id = 0; s_id < ms->n_slices; s_id++) {
+    cs_lnum_t s_width = 0;
+    for (cs_lnum_t l_id = 0; l_id < c_size; l_id++) {
+      cs_lnum_t ii = ms->slice_row_id[s_id*c_size + l_id];
+      if (ii > -1) {
+        ms->row_start[ii] = ms->slice_index[s_id] + l_id;
+        if (ms->row_length[ii] > s_width)
+          s_width = ms->row_length[ii];
+      }
+    }
+    ms->slice_index[s_id + 1] = ms->slice_index[s_id] + s_width*c_size;
+  }
+
+  /* Now define column ids; padding entries reference the row itself
+     (or the first column for empty lanes), so as to remain valid */
+
+  BFT_MALLOC(ms->col_id, ms->slice_index[ms->n_slices], cs_lnum_t);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < ms->n_slices; s_id++) {
+    const cs_lnum_t s_width
+      = (ms->slice_index[s_id+1] - ms->slice_index[s_id]) / c_size;
+    cs_lnum_t *restrict s_col_id = ms->col_id + ms->slice_index[s_id];
+    for (cs_lnum_t l_id = 0; l_id < c_size; l_id++) {
+      cs_lnum_t ii = ms->slice_row_id[s_id*c_size + l_id];
+      cs_lnum_t jj = 0;
+      if (ii > -1) {
+        const cs_lnum_t *restrict r_col_id
+          = src->col_id + src->row_index[ii];
+        for (jj = 0; jj < ms->row_length[ii]; jj++)
+          s_col_id[jj*c_size + l_id] = r_col_id[jj];
+      }
+      for (; jj < s_width; jj++)
+        s_col_id[jj*c_size + l_id] = (ii > -1) ? ii : 0;
+    }
+  }
+
+  return ms;
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL matrix extradiagonal coefficients to zero.
+ *
+ * Padding coefficients are also zeroed, and the coefficients
+ * array is allocated if needed.
+ *
+ * parameters:
+ *   matrix           <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_zero_x_coeffs_sell(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+
+  const cs_lnum_t  n_slices = ms->n_slices;
+  const cs_lnum_t  e_stride = matrix->eb_size[3];
+
+  if (mc->_x_val == NULL || mc->max_eb_size < e_stride) {
+    BFT_REALLOC(mc->_x_val,
+                e_stride*ms->slice_index[n_slices],
+                cs_real_t);
+    mc->max_eb_size = e_stride;
+  }
+  mc->x_val = mc->_x_val;
+
+# pragma omp parallel for  if(ms->n_rows > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+    cs_lnum_t s_e = ms->slice_index[s_id+1]*e_stride;
+    for (cs_lnum_t kk = ms->slice_index[s_id]*e_stride; kk < s_e; kk++)
+      mc->_x_val[kk] = 0.0;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add SELL extradiagonal matrix coefficients.
+ *
+ * The matrix coefficients should have been initialized (i.e. set to 0)
+ * before using this function; as padding values must be zero, this is
+ * used both for direct and incremental assembly.
+ *
+ * parameters:
+ *   matrix      <-- pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   xa          <-- extradiagonal values
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_xa_coeffs_sell_increment(cs_matrix_t        *matrix,
+                              bool                symmetric,
+                              cs_lnum_t           n_edges,
+                              const cs_lnum_2_t  *edges,
+                              const cs_real_t    *restrict xa)
+{
+  cs_lnum_t  ii, jj, face_id;
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_lnum_t  c_size = ms->chunk_size;
+
+  assert(edges != NULL || n_edges == 0);
+
+  const cs_lnum_t *restrict edges_p
+    = (const cs_lnum_t *restrict)(edges);
+
+  const cs_lnum_t  xa_stride = (symmetric) ? 1 : 2;
+  const cs_lnum_t  xa_shift = (symmetric) ? 0 : 1;
+
+  for (face_id = 0; face_id < n_edges; face_id++) {
+    cs_lnum_t kk, ll;
+    ii = *edges_p++;
+    jj = *edges_p++;
+    if (ii < ms->n_rows) {
+      const cs_lnum_t *restrict s_col_id = ms->col_id + ms->row_start[ii];
+      for (kk = 0; s_col_id[kk*c_size] != jj; kk++);
+      mc->_x_val[ms->row_start[ii] + kk*c_size] += xa[xa_stride*face_id];
+    }
+    if (jj < ms->n_rows) {
+      const cs_lnum_t *restrict s_col_id = ms->col_id + ms->row_start[jj];
+      for (ll = 0; s_col_id[ll*c_size] != ii; ll++);
+      mc->_x_val[ms->row_start[jj] + ll*c_size]
+        += xa[xa_stride*face_id + xa_shift];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL matrix coefficients.
+ *
+ * Extra-diagonal coefficients are always copied, as they are reordered.
+ *
+ * parameters:
+ *   matrix      <-> pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   copy        <-- indicates if diagonal coefficients should be copied
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   da          <-- diagonal values (NULL if all zero)
+ *   xa          <-- extradiagonal values (NULL if all zero)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs_sell(cs_matrix_t         *matrix,
+                 bool                 symmetric,
+                 bool                 copy,
+                 cs_lnum_t            n_edges,
+                 const cs_lnum_2_t  *restrict edges,
+                 const cs_real_t    *restrict da,
+                 const cs_real_t    *restrict xa)
+{
+  /* Map or copy diagonal values */
+
+  _map_or_copy_da_coeffs_msr(matrix, copy, da);
+
+  /* Extradiagonal values */
+
+  if (matrix->eb_size[3] != 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: only scalar extra-diagonal coefficients are handled\n"
+                "for matrices in %s format."),
+              __func__, _(cs_matrix_type_name[matrix->type]));
+
+  _zero_x_coeffs_sell(matrix);
+
+  if (xa != NULL)
+    _set_xa_coeffs_sell_increment(matrix, symmetric, n_edges, edges, xa);
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL matrix coefficients provided in MSR form.
+ *
+ * If da and xa are equal to NULL, then initialize val with zeros.
+ *
+ * parameters:
+ *   matrix           <-> pointer to matrix structure
+ *   copy             <-- indicates if diagonal coefficients should be
+ *                        copied when not transferred
+ *   row_index        <-- MSR row index (0 to n-1)
+ *   col_id           <-- MSR column id (0 to n-1)
+ *   d_vals           <-- diagonal values (NULL if all zero)
+ *   d_vals_transfer  <-- diagonal values whose ownership is transferred
+ *                        (NULL or d_vals in, NULL out)
+ *   x_vals           <-- extradiagonal values (NULL if all zero)
+ *   x_vals_transfer  <-- extradiagonal values whose ownership is transferred
+ *                        (NULL or x_vals in, NULL out)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs_sell_from_msr(cs_matrix_t       *matrix,
+                          bool               copy,
+                          const cs_lnum_t    row_index[],
+                          const cs_lnum_t    col_id[],
+                          const cs_real_t   *d_vals,
+                          cs_real_t        **d_vals_transfer,
+                          const cs_real_t   *x_vals,
+                          cs_real_t        **x_vals_transfer)
+{
+  CS_UNUSED(col_id);
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_lnum_t  c_size = ms->chunk_size;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  e_stride = matrix->eb_size[3];
+
+  /* Diagonal values are kept as is */
+
+  bool d_transferred = false;
+
+  if (d_vals_transfer != NULL) {
+    if (*d_vals_transfer != NULL) {
+      mc->max_db_size = matrix->db_size[0];
+      if (mc->_d_val != *d_vals_transfer) {
+        BFT_FREE(mc->_d_val);
+        mc->_d_val = *d_vals_transfer;
+      }
+      mc->d_val = mc->_d_val;
+      *d_vals_transfer = NULL;
+      d_transferred = true;
+    }
+  }
+
+  if (d_transferred == false)
+    _map_or_copy_da_coeffs_msr(matrix, copy, d_vals);
+
+  /* Extra-diagonal values are reordered; as with the MSR case, we assume
+     the column ids are consistent with those used to build the structure */
+
+  _zero_x_coeffs_sell(matrix);
+
+  if (x_vals != NULL) {
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      const cs_lnum_t  n_cols = row_index[ii+1] - row_index[ii];
+      const cs_real_t  *s_row = x_vals + row_index[ii]*e_stride;
+      cs_real_t  *m_row = mc->_x_val + ms->row_start[ii]*e_stride;
+      assert(n_cols == ms->row_length[ii]);
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        for (cs_lnum_t kk = 0; kk < e_stride; kk++)
+          m_row[jj*c_size*e_stride + kk] = s_row[jj*e_stride + kk];
+      }
+    }
+  }
+
+  /* Now free transferred arrays */
+
+  if (d_vals_transfer != NULL)
+    BFT_FREE(*d_vals_transfer);
+  if (x_vals_transfer != NULL)
+    BFT_FREE(*x_vals_transfer);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_sell(bool                exclude_diag,
+                  const cs_matrix_t  *matrix,
+                  const cs_real_t    *restrict x,
+                  cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_slices = ms->n_slices;
+
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+  assert(ms->chunk_size == CS_SELL_C);
+
+# pragma omp parallel for  if(ms->n_rows > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+
+    const cs_lnum_t s_width
+      = (ms->slice_index[s_id+1] - ms->slice_index[s_id]) / CS_SELL_C;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->slice_index[s_id];
+    const cs_real_t *restrict m_val = mc->x_val + ms->slice_index[s_id];
+    const cs_lnum_t *restrict row_id = ms->slice_row_id + s_id*CS_SELL_C;
+
+    cs_real_t sii[CS_SELL_C];
+
+    for (cs_lnum_t l_id = 0; l_id < CS_SELL_C; l_id++)
+      sii[l_id] = 0.0;
+
+    /* Lanes are contiguous, so the inner loop may be vectorized */
+
+    for (cs_lnum_t jj = 0; jj < s_width; jj++) {
+      for (cs_lnum_t l_id = 0; l_id < CS_SELL_C; l_id++)
+        sii[l_id] +=   m_val[jj*CS_SELL_C + l_id]
+                     * x[col_id[jj*CS_SELL_C + l_id]];
+    }
+
+    if (d_val != NULL) {
+      for (cs_lnum_t l_id = 0; l_id < CS_SELL_C; l_id++) {
+        cs_lnum_t ii = row_id[l_id];
+        if (ii > -1)
+          y[ii] = sii[l_id] + d_val[ii]*x[ii];
+      }
+    }
+    else {
+      for (cs_lnum_t l_id = 0; l_id < CS_SELL_C; l_id++) {
+        cs_lnum_t ii = row_id[l_id];
+        if (ii > -1)
+          y[ii] = sii[l_id];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix, blocked version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
 
 static void
-_mat_vec_p_l_msr_mkl(bool                exclude_diag,
-                     const cs_matrix_t  *matrix,
-                     const cs_real_t     x[restrict],
-                     cs_real_t           y[restrict])
+_b_mat_vec_p_l_sell(bool                exclude_diag,
+                    const cs_matrix_t  *matrix,
+                    const cs_real_t     x[restrict],
+                    cs_real_t           y[restrict])
 {
-  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_slices = ms->n_slices;
+  const cs_lnum_t *db_size = matrix->db_size;
 
-  int n_rows = ms->n_rows;
-  char transa[] = "n";
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
 
-  mkl_cspblas_dcsrgemv(transa,
-                       &n_rows,
-                       mc->x_val,
-                       ms->row_index,
-                       ms->col_id,
-                       (double *)x,
-                       y);
+  assert(ms->chunk_size == CS_SELL_C);
 
-  /* Add diagonal contribution */
+# pragma omp parallel for  if(ms->n_rows*db_size[0] > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
 
-  if (!exclude_diag && mc->d_val != NULL) {
-    cs_lnum_t ii;
-    const double *restrict da = mc->d_val;
+    const cs_lnum_t s_width
+      = (ms->slice_index[s_id+1] - ms->slice_index[s_id]) / CS_SELL_C;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->slice_index[s_id];
+    const cs_real_t *restrict m_val = mc->x_val + ms->slice_index[s_id];
+    const cs_lnum_t *restrict row_id = ms->slice_row_id + s_id*CS_SELL_C;
+
+    /* Diagonal contribution */
+
+    for (cs_lnum_t l_id = 0; l_id < CS_SELL_C; l_id++) {
+      cs_lnum_t ii = row_id[l_id];
+      if (ii < 0)
+        continue;
+      if (d_val != NULL)
+        _dense_b_ax(ii, db_size, d_val, x, y);
+      else {
+        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+          y[ii*db_size[1] + kk] = 0.;
+      }
+    }
+
+    /* Extra-diagonal contribution, component by component */
+
+    for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+
+      cs_real_t sii[CS_SELL_C];
+
+      for (cs_lnum_t l_id = 0; l_id < CS_SELL_C; l_id++)
+        sii[l_id] = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < s_width; jj++) {
+        for (cs_lnum_t l_id = 0; l_id < CS_SELL_C; l_id++)
+          sii[l_id] +=   m_val[jj*CS_SELL_C + l_id]
+                       * x[col_id[jj*CS_SELL_C + l_id]*db_size[1] + kk];
+      }
+
+      for (cs_lnum_t l_id = 0; l_id < CS_SELL_C; l_id++) {
+        cs_lnum_t ii = row_id[l_id];
+        if (ii > -1)
+          y[ii*db_size[1] + kk] += sii[l_id];
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function for initialization of SELL matrix coefficients using
+ * local row ids and column indexes.
+ *
+ * Column indexes are those of the matching MSR structure, as the
+ * SELL structure keeps the same column order in each row.
+ *
+ * parameters:
+ *   matrix_p <-> untyped pointer to matrix description structure
+ *   db_size  <-- optional diagonal block sizes
+ *   eb_size  <-- optional extra-diagonal block sizes
+ *----------------------------------------------------------------------------*/
+
+static void
+_sell_assembler_values_init(void              *matrix_p,
+                            const cs_lnum_t    db_size[4],
+                            const cs_lnum_t    eb_size[4])
+{
+  cs_matrix_t  *matrix = (cs_matrix_t *)matrix_p;
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t n_rows = matrix->n_rows;
+
+  cs_lnum_t d_stride = 1;
+  if (db_size != NULL)
+    d_stride = db_size[3];
+
+  /* Initialize diagonal values */
+
+  BFT_REALLOC(mc->_d_val, d_stride*n_rows, cs_real_t);
+  mc->d_val = mc->_d_val;
+  mc->max_db_size = d_stride;
+
+# pragma omp parallel for  if(n_rows*d_stride > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows*d_stride; ii++)
+    mc->_d_val[ii] = 0;
+
+  /* Initialize extra-diagonal values (including padding);
+     their block size is that of the matrix */
+
+  CS_UNUSED(eb_size);
+  assert(eb_size == NULL || eb_size[3] == matrix->eb_size[3]);
+
+  _zero_x_coeffs_sell(matrix);
+}
+
+/*----------------------------------------------------------------------------
+ * Function for addition to SELL matrix coefficients using
+ * local row ids and column indexes.
+ *
+ * Values whose associated row index is negative are ignored;
+ * Values whose column index is -1 are assumed to be assigned to a
+ * separately stored diagonal.
+ *
+ * parameters:
+ *   matrix_p <-> untyped pointer to matrix description structure
+ *   n        <-- number of values to add
+ *   stride   <-- associated data block size
+ *   row_id   <-- associated local row ids
+ *   col_idx  <-- associated local column indexes
+ *   vals     <-- pointer to values (size: n*stride)
+ *----------------------------------------------------------------------------*/
+
+static void
+_sell_assembler_values_add(void             *matrix_p,
+                           cs_lnum_t         n,
+                           cs_lnum_t         stride,
+                           const cs_lnum_t   row_id[],
+                           const cs_lnum_t   col_idx[],
+                           const cs_real_t   vals[])
+{
+  cs_matrix_t  *matrix = (cs_matrix_t *)matrix_p;
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_lnum_t  c_size = ms->chunk_size;
+
+  if (stride == 1) {
+
+#   pragma omp parallel for  if(n > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n; ii++) {
+      cs_lnum_t r_id = row_id[ii];
+      if (r_id < 0)
+        continue;
+      if (col_idx[ii] < 0) {
+#       pragma omp atomic
+        mc->_d_val[r_id] += vals[ii];
+      }
+      else {
+#       pragma omp atomic
+        mc->_x_val[ms->row_start[r_id] + col_idx[ii]*c_size] += vals[ii];
+      }
+    }
+
+  }
+
+  else { /* if (stride > 1) */
+
+#   pragma omp parallel for  if(n*stride > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n; ii++) {
+      cs_lnum_t r_id = row_id[ii];
+      if (r_id < 0)
+        continue;
+      if (col_idx[ii] < 0) {
+        for (cs_lnum_t jj = 0; jj < stride; jj++)
+          mc->_d_val[r_id*stride + jj] += vals[ii*stride + jj];
+      }
+      else {
+        cs_lnum_t displ = (ms->row_start[r_id] + col_idx[ii]*c_size)*stride;
+        for (cs_lnum_t jj = 0; jj < stride; jj++)
+          mc->_x_val[displ + jj] += vals[ii*stride + jj];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Release shell matrix coefficients (no-op, as only the
+ * product function and shared diagonal are referenced).
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_release_coeffs_shell(cs_matrix_t  *matrix)
+{
+  CS_UNUSED(matrix);
+}
+
+/*----------------------------------------------------------------------------
+ * Copy diagonal of shell matrix.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   da     --> diagonal (pre-allocated, size: n_rows)
+ *----------------------------------------------------------------------------*/
+
+static void
+_copy_diagonal_shell(const cs_matrix_t  *matrix,
+                     cs_real_t           da[restrict])
+{
+  const cs_matrix_coeff_shell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = matrix->n_rows;
+
+  if (mc->d_val != NULL) {
 #   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (ii = 0; ii < n_rows; ii++)
-      y[ii] += da[ii] * x[ii];
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      da[ii] = mc->d_val[ii];
+  }
+  else {
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      da[ii] = 0.0;
   }
 }
 
-#endif /* defined (HAVE_MKL) */
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with shell matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_shell(bool                exclude_diag,
+                   const cs_matrix_t  *matrix,
+                   const cs_real_t     x[restrict],
+                   cs_real_t           y[restrict])
+{
+  const cs_matrix_coeff_shell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = matrix->n_rows;
+
+  mc->product(mc->input, x, y);
+
+  if (exclude_diag) {
+
+    if (mc->d_val == NULL)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Shell matrix has no diagonal, so a product excluding\\n"
+                  "the diagonal is not available."));
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      y[ii] -= mc->d_val[ii]*x[ii];
+
+  }
+}
 
 /*----------------------------------------------------------------------------
  * Synchronize ghost values prior to matrix.vector product
@@ -4294,6 +6001,74 @@ _pre_vector_multiply_sync(cs_halo_rotation_t   rotation_mode,
   _pre_vector_multiply_sync_x(rotation_mode, matrix, x);
 }
 
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with halo update of x overlapped with
+ * computation on interior rows, if possible.
+ *
+ * This is available for scalar CSR and MSR matrices using the default
+ * local product, in parallel. In other cases, nothing is done.
+ *
+ * parameters:
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   exclude_diag  <-- exclude diagonal if true
+ *   matrix        <-- pointer to matrix structure
+ *   x             <-> multipliying vector values (ghost values updated)
+ *   y             --> resulting vector
+ *
+ * returns:
+ *   true if the product was computed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_vector_multiply_overlap(cs_halo_rotation_t   rotation_mode,
+                         bool                 exclude_diag,
+                         const cs_matrix_t   *matrix,
+                         cs_real_t           *restrict x,
+                         cs_real_t           *restrict y)
+{
+  const cs_halo_t *halo = matrix->halo;
+
+  if (cs_glob_n_ranks < 2 || matrix->db_size[3] != 1)
+    return false;
+
+  if (halo->n_rotations > 0 && rotation_mode != CS_HALO_ROTATION_COPY)
+    return false;
+
+  const int ed_flag = (exclude_diag) ? 1 : 0;
+  cs_matrix_vector_product_t *vector_multiply
+    = matrix->vector_multiply[matrix->fill_type][ed_flag];
+
+  void (*mat_vec_p_rows)(bool, const cs_matrix_t *, cs_lnum_t,
+                         const cs_lnum_t *, const cs_real_t *, cs_real_t *)
+    = NULL;
+
+  if (matrix->type == CS_MATRIX_CSR && vector_multiply == _mat_vec_p_l_csr)
+    mat_vec_p_rows = _mat_vec_p_l_csr_rows;
+  else if (   matrix->type == CS_MATRIX_MSR
+           && vector_multiply == _mat_vec_p_l_msr)
+    mat_vec_p_rows = _mat_vec_p_l_msr_rows;
+  else
+    return false;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+
+  if (ms->_row_part == NULL)
+    return false;
+
+  _zero_range(y, matrix->n_rows, matrix->n_cols_ext);
+
+  cs_halo_sync_start(halo, CS_HALO_STANDARD, x, 1);
+
+  mat_vec_p_rows(exclude_diag, matrix, ms->n_i_rows, ms->_row_part, x, y);
+
+  cs_halo_sync_wait(halo, CS_HALO_STANDARD, x, 1);
+
+  mat_vec_p_rows(exclude_diag, matrix, ms->n_rows - ms->n_i_rows,
+                 ms->_row_part + ms->n_i_rows, x, y);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Add variant
  *
@@ -4379,6 +6154,10 @@ _variant_add(const char                        *name,
  *     omp_sched       (Improved scheduling for OpenMP)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     default
+ *     standard
+ *
  * parameters:
  *   m_type          <-- Matrix type
  *   numbering       <-- mesh numbering type, or NULL
@@ -4431,9 +6210,8 @@ _set_spmv_func(cs_matrix_type_t             m_type,
         spmv[1] = _b_mat_vec_p_l_native_fixed;
         break;
       case CS_MATRIX_BLOCK:
-        spmv[0] = _bb_mat_vec_p_l_native;
-        spmv[1] = _bb_mat_vec_p_l_native;
-        break;
+        spmv[0] = _bb_mat_vec_p_l_native_fixed;
+        spmv[1] = _bb_mat_vec_p_l_native_fixed;
         break;
       default:
         break;
@@ -4598,6 +6376,10 @@ _set_spmv_func(cs_matrix_type_t             m_type,
         spmv[0] = _b_mat_vec_p_l_msr;
         spmv[1] = _b_mat_vec_p_l_msr;
         break;
+      case CS_MATRIX_BLOCK:
+        spmv[0] = _bb_mat_vec_p_l_msr;
+        spmv[1] = _bb_mat_vec_p_l_msr;
+        break;
       default:
         break;
       }
@@ -4633,6 +6415,28 @@ _set_spmv_func(cs_matrix_type_t             m_type,
 
     break;
 
+  case CS_MATRIX_SELL:
+
+    if (standard > 0) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_sell;
+        spmv[1] = _mat_vec_p_l_sell;
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_sell;
+        spmv[1] = _b_mat_vec_p_l_sell;
+        break;
+      default:
+        break;
+      }
+    }
+
+    break;
+
   default:
     break;
   }
@@ -4649,6 +6453,42 @@ _set_spmv_func(cs_matrix_type_t             m_type,
   return retcode;
 }
 
+/*----------------------------------------------------------------------------
+ * Discard single precision MSR extradiagonal coefficients, and restore
+ * default matrix.vector product functions if needed.
+ *
+ * This must be called whenever matrix coefficients are (re)assigned or
+ * released, so that products never use outdated coefficients.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_discard_x_val_sp(cs_matrix_t  *matrix)
+{
+  if (matrix->type != CS_MATRIX_MSR)
+    return;
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  if (mc != NULL)
+    BFT_FREE(mc->x_val_sp);
+
+  for (cs_matrix_fill_type_t mft = 0; mft < CS_MATRIX_N_FILL_TYPES; mft++) {
+    for (int ed_flag = 0; ed_flag < 2; ed_flag++) {
+      cs_matrix_vector_product_t *f = matrix->vector_multiply[mft][ed_flag];
+      if (f == _mat_vec_p_l_msr_sp || f == _b_mat_vec_p_l_msr_sp)
+        _set_spmv_func(matrix->type,
+                       matrix->numbering,
+                       mft,
+                       ed_flag,
+                       NULL, /* func_name */
+                       matrix->vector_multiply[mft]);
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create matrix structure internals using a matrix assembler.
@@ -4750,6 +6590,16 @@ _structure_from_assembler(cs_matrix_type_t        type,
                                               &_col_id);
     }
     break;
+
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_csr_t *_structure
+        = _structure_from_assembler(CS_MATRIX_MSR, n_rows, n_cols_ext, ma);
+      structure = _create_struct_sell_from_csr(_structure);
+      _destroy_struct_csr(&_structure);
+    }
+    break;
+
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("%s: handling of matrices in %s format\n"
@@ -4804,6 +6654,13 @@ _structure_destroy(cs_matrix_type_t   type,
       *structure = _structure;
     }
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_sell_t *_structure = *structure;
+      _destroy_struct_sell(&_structure);
+      *structure = _structure;
+    }
+    break;
   default:
     assert(0);
     break;
@@ -4872,8 +6729,19 @@ _matrix_create(cs_matrix_type_t  type)
     m->coeffs = _create_coeff_csr_sym();
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_SHELL:
+    {
+      cs_matrix_coeff_shell_t  *mc;
+      BFT_MALLOC(mc, 1, cs_matrix_coeff_shell_t);
+      mc->product = NULL;
+      mc->input = NULL;
+      mc->d_val = NULL;
+      m->coeffs = mc;
+    }
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -4924,6 +6792,21 @@ _matrix_create(cs_matrix_type_t  type)
     m->copy_diagonal = _copy_diagonal_separate;
     break;
 
+  case CS_MATRIX_SELL:
+    m->set_coefficients = _set_coeffs_sell;
+    m->release_coefficients = _release_coeffs_msr;
+    m->copy_diagonal = _copy_diagonal_separate;
+    break;
+
+  case CS_MATRIX_SHELL:
+    m->release_coefficients = _release_coeffs_shell;
+    m->copy_diagonal = _copy_diagonal_shell;
+    for (i = 0; i < 2; i++) {
+      m->vector_multiply[CS_MATRIX_SCALAR][i] = _mat_vec_p_l_shell;
+      m->vector_multiply[CS_MATRIX_SCALAR_SYM][i] = _mat_vec_p_l_shell;
+    }
+    break;
+
   default:
     assert(0);
     break;
@@ -4986,6 +6869,8 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
 {
   cs_matrix_structure_t *ms;
 
+  bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_MATRICES);
+
   BFT_MALLOC(ms, 1, cs_matrix_structure_t);
 
   ms->type = type;
@@ -5023,6 +6908,17 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
                                        n_edges,
                                        edges);
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_csr_t *_structure = _create_struct_csr(false,
+                                                              n_rows,
+                                                              n_cols_ext,
+                                                              n_edges,
+                                                              edges);
+      ms->structure = _create_struct_sell_from_csr(_structure);
+      _destroy_struct_csr(&_structure);
+    }
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -5037,6 +6933,8 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
   ms->numbering = numbering;
   ms->assembler = NULL;
 
+  bft_mem_tag_end(mem_tag);
+
   return ms;
 }
 
@@ -5112,6 +7010,20 @@ cs_matrix_structure_create_msr(cs_matrix_type_t        type,
                                                 row_index,
                                                 col_id);
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_csr_t *_structure
+        = _create_struct_csr_from_csr(false,
+                                      transfer,
+                                      false,
+                                      n_rows,
+                                      n_cols_ext,
+                                      row_index,
+                                      col_id);
+      ms->structure = _create_struct_sell_from_csr(_structure);
+      _destroy_struct_csr(&_structure);
+    }
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("%s: handling of matrices in %s format\n"
@@ -5212,6 +7124,8 @@ cs_matrix_structure_create_from_assembler(cs_matrix_type_t        type,
 {
   cs_matrix_structure_t *ms = NULL;
 
+  bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_MATRICES);
+
   BFT_MALLOC(ms, 1, cs_matrix_structure_t);
 
   ms->type = type;
@@ -5234,9 +7148,43 @@ cs_matrix_structure_create_from_assembler(cs_matrix_type_t        type,
 
   ms->assembler = ma;
 
+  bft_mem_tag_end(mem_tag);
+
   return ms;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build and cache the mapping from native (edge-based)
+ *        extradiagonal coefficients to matrix entries for a matrix structure.
+ *
+ * Subsequent calls to \ref cs_matrix_set_coefficients using the same
+ * edges array then reduce to a simple gather, avoiding the search for
+ * each edge's matching entries.
+ *
+ * Only MSR structures are handled, when each extradiagonal entry matches
+ * exactly one edge; for other structures, this function has no effect.
+ *
+ * Note that the structure keeps a reference to the given edges array,
+ * which must not be freed or modified while the map is in use.
+ *
+ * \param[in, out]  ms       pointer to matrix structure
+ * \param[in]       n_edges  local number of graph edges
+ * \param[in]       edges    edges (symmetric row <-> column) connectivity
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_structure_set_edge_map(cs_matrix_structure_t  *ms,
+                                 cs_lnum_t               n_edges,
+                                 const cs_lnum_2_t      *edges)
+{
+  if (ms == NULL || ms->type != CS_MATRIX_MSR)
+    return;
+
+  _set_edge_map_csr(ms->structure, n_edges, edges);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Destroy a matrix structure.
@@ -5376,6 +7324,7 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
     m->coeffs = _create_coeff_csr_sym();
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     m->coeffs = _create_coeff_msr();
     break;
   default:
@@ -5455,6 +7404,7 @@ cs_matrix_create_by_local_restrict(const cs_matrix_t  *src)
   case CS_MATRIX_NATIVE:
   case CS_MATRIX_CSR:
   case CS_MATRIX_CSR_SYM:
+  case CS_MATRIX_SELL:
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in %s format\n"
@@ -5504,12 +7454,16 @@ cs_matrix_destroy(cs_matrix_t **matrix)
       }
       break;
     case CS_MATRIX_MSR:
+    case CS_MATRIX_SELL:
       {
         cs_matrix_coeff_msr_t *coeffs = m->coeffs;
         _destroy_coeff_msr(&coeffs);
         m->coeffs = NULL;
       }
       break;
+    case CS_MATRIX_SHELL:
+      BFT_FREE(m->coeffs);
+      break;
     default:
       assert(0);
       break;
@@ -5526,6 +7480,53 @@ cs_matrix_destroy(cs_matrix_t **matrix)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a matrix-free (shell) scalar matrix.
+ *
+ * Such a matrix has no coefficients: its product with a vector is
+ * computed by the given function, and its diagonal (needed for diagonal
+ * or polynomial preconditioning) is given by the caller. It may thus only
+ * be used with iterative solvers relying on these operations.
+ *
+ * The diagonal and input arrays are shared, so they must remain valid
+ * as long as the matrix is used.
+ *
+ * \param[in]  n_rows     local number of rows
+ * \param[in]  symmetric  indicates if the matrix is symmetric
+ * \param[in]  d_val      diagonal values (size: n_rows), or NULL
+ * \param[in]  product    matrix.vector product function
+ * \param[in]  input      pointer to context passed to the product function
+ *
+ * \return  pointer to created matrix structure;
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_t *
+cs_matrix_create_shell(cs_lnum_t                   n_rows,
+                       bool                        symmetric,
+                       const cs_real_t            *d_val,
+                       cs_matrix_shell_product_t  *product,
+                       const void                 *input)
+{
+  assert(product != NULL);
+
+  cs_matrix_t *m = _matrix_create(CS_MATRIX_SHELL);
+
+  m->n_rows = n_rows;
+  m->n_cols_ext = n_rows;
+
+  _set_fill_info(m, symmetric, NULL, NULL);
+
+  cs_matrix_coeff_shell_t  *mc = m->coeffs;
+
+  mc->product = product;
+  mc->input = input;
+  mc->d_val = d_val;
+
+  return m;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return matrix type.
@@ -5622,6 +7623,12 @@ cs_matrix_get_n_entries(const cs_matrix_t  *matrix)
       retval = ms->row_index[ms->n_rows] + ms->n_rows;
     }
     break;
+  case CS_MATRIX_SELL:
+    {
+      const cs_matrix_struct_sell_t  *ms = matrix->structure;
+      retval = ms->n_entries + ms->n_rows;
+    }
+    break;
   default:
     break;
   }
@@ -5800,6 +7807,8 @@ cs_matrix_set_coefficients(cs_matrix_t        *matrix,
 
   cs_base_check_bool(&symmetric);
 
+  _discard_x_val_sp(matrix);
+
   /* Set fill type */
   _set_fill_info(matrix,
                  symmetric,
@@ -5809,8 +7818,10 @@ cs_matrix_set_coefficients(cs_matrix_t        *matrix,
   /* Set coefficients */
 
   if (matrix->set_coefficients != NULL) {
+    bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_MATRICES);
     matrix->xa = xa;
     matrix->set_coefficients(matrix, symmetric, false, n_edges, edges, da, xa);
+    bft_mem_tag_end(mem_tag);
   }
   else
     bft_error
@@ -5864,13 +7875,18 @@ cs_matrix_copy_coefficients(cs_matrix_t        *matrix,
 
   cs_base_check_bool(&symmetric);
 
+  _discard_x_val_sp(matrix);
+
   _set_fill_info(matrix,
                  symmetric,
                  diag_block_size,
                  extra_diag_block_size);
 
-  if (matrix->set_coefficients != NULL)
+  if (matrix->set_coefficients != NULL) {
+    bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_MATRICES);
     matrix->set_coefficients(matrix, symmetric, true, n_edges, edges, da, xa);
+    bft_mem_tag_end(mem_tag);
+  }
   else
     bft_error
       (__FILE__, __LINE__, 0,
@@ -5927,6 +7943,8 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
 
   cs_base_check_bool(&symmetric);
 
+  _discard_x_val_sp(matrix);
+
   _set_fill_info(matrix,
                  symmetric,
                  diag_block_size,
@@ -5955,6 +7973,17 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
                              x_val);
     break;
 
+  case CS_MATRIX_SELL:
+    _set_coeffs_sell_from_msr(matrix,
+                              false, /* ignored in case of transfer */
+                              row_index,
+                              col_id,
+                              d_val_p,
+                              d_val,
+                              x_val_p,
+                              x_val);
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
@@ -5965,6 +7994,84 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Use single precision extra-diagonal coefficients for
+ *        matrix.vector products.
+ *
+ * A single precision copy of the current extra-diagonal coefficients
+ * is built, and the matrix.vector product functions switched to variants
+ * using it, while the diagonal and vectors remain in double precision.
+ * This reduces memory bandwidth requirements for products, at the
+ * expense of accuracy, so it is intended for matrices where rounding
+ * errors are not critical, such as multigrid coarse levels.
+ *
+ * Double precision coefficients are kept (and still used for other
+ * operations); the copy is discarded when coefficients are assigned
+ * again or released.
+ *
+ * This is currently only available for MSR matrices with scalar
+ * extra-diagonal coefficients; for other cases, this function has
+ * no effect.
+ *
+ * \param[in, out]  matrix  pointer to matrix structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_spmv_single_precision(cs_matrix_t  *matrix)
+{
+  if (matrix == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The matrix is not defined."));
+
+  if (   matrix->type != CS_MATRIX_MSR
+      || matrix->eb_size[3] != 1
+      || matrix->fill_type == CS_MATRIX_N_FILL_TYPES)
+    return;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  if (mc->x_val == NULL)
+    return;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  BFT_REALLOC(mc->x_val_sp, ms->row_index[n_rows], float);
+
+  /* Loop on rows for consistent first touch with products */
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    for (cs_lnum_t jj = ms->row_index[ii]; jj < ms->row_index[ii+1]; jj++)
+      mc->x_val_sp[jj] = mc->x_val[jj];
+  }
+
+  cs_matrix_vector_product_t *spmv = NULL;
+
+  switch(matrix->fill_type) {
+  case CS_MATRIX_SCALAR:
+  case CS_MATRIX_SCALAR_SYM:
+    spmv = _mat_vec_p_l_msr_sp;
+    break;
+  case CS_MATRIX_BLOCK_D:
+  case CS_MATRIX_BLOCK_D_66:
+  case CS_MATRIX_BLOCK_D_SYM:
+    spmv = _b_mat_vec_p_l_msr_sp;
+    break;
+  default:
+    break;
+  }
+
+  if (spmv != NULL) {
+    matrix->vector_multiply[matrix->fill_type][0] = spmv;
+    matrix->vector_multiply[matrix->fill_type][1] = spmv;
+  }
+  else
+    BFT_FREE(mc->x_val_sp);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Release shared matrix coefficients.
@@ -5988,6 +8095,8 @@ cs_matrix_release_coefficients(cs_matrix_t  *matrix)
     bft_error(__FILE__, __LINE__, 0,
               _("The matrix is not defined."));
 
+  _discard_x_val_sp(matrix);
+
   if (matrix->release_coefficients != NULL) {
     matrix->xa = NULL;
     matrix->release_coefficients(matrix);
@@ -6030,6 +8139,8 @@ cs_matrix_assembler_values_init(cs_matrix_t      *matrix,
 {
   cs_matrix_assembler_values_t *mav = NULL;
 
+  _discard_x_val_sp(matrix);
+
   /* Set fill type */
 
   _set_fill_info(matrix,
@@ -6064,6 +8175,18 @@ cs_matrix_assembler_values_init(cs_matrix_t      *matrix,
                                             NULL,
                                             NULL);
     break;
+  case CS_MATRIX_SELL:
+    mav = cs_matrix_assembler_values_create(matrix->assembler,
+                                            true,
+                                            diag_block_size,
+                                            extra_diag_block_size,
+                                            (void *)matrix,
+                                            _sell_assembler_values_init,
+                                            _sell_assembler_values_add,
+                                            NULL,
+                                            NULL,
+                                            NULL);
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("%s: handling of matrices in %s format\n"
@@ -6213,6 +8336,7 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     {
       cs_matrix_coeff_msr_t *mc = matrix->coeffs;
       if (mc->d_val == NULL) {
@@ -6230,6 +8354,16 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
     }
     break;
 
+  case CS_MATRIX_SHELL:
+    {
+      const cs_matrix_coeff_shell_t *mc = matrix->coeffs;
+      if (mc->d_val == NULL)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Shell matrix has no diagonal defined."));
+      diag = mc->d_val;
+    }
+    break;
+
   default:
     assert(0);
     break;
@@ -6357,13 +8491,13 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
     {
       const cs_lnum_t _row_id = row_id / b_size;
       const cs_matrix_struct_csr_t  *ms = matrix->structure;
-      const cs_matrix_coeff_csr_t  *mc = matrix->coeffs;
+      const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
       const cs_lnum_t n_ed_cols =   ms->row_index[_row_id+1]
                                   - ms->row_index[_row_id];
       if (b_size == 1)
         r->row_size = n_ed_cols + 1;
       else if (matrix->eb_size[0] == 1)
-        r->row_size = n_ed_cols*b_size;
+        r->row_size = n_ed_cols + b_size;
       else
         r->row_size = (n_ed_cols+1)*b_size;
       if (r->buffer_size < r->row_size) {
@@ -6376,7 +8510,7 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
       cs_lnum_t ii = 0, jj = 0;
       const cs_lnum_t *restrict c_id = ms->col_id + ms->row_index[_row_id];
       if (b_size == 1) {
-        const cs_real_t *m_row = mc->val + ms->row_index[_row_id];
+        const cs_real_t *m_row = mc->x_val + ms->row_index[_row_id];
         for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
           r->_col_id[ii] = c_id[jj];
           r->_vals[ii++] = m_row[jj];
@@ -6391,7 +8525,7 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
       else if (matrix->eb_size[0] == 1) {
         const cs_lnum_t _sub_id = row_id % b_size;
         const cs_lnum_t *db_size = matrix->db_size;
-        const cs_real_t *m_row = mc->val + ms->row_index[_row_id];
+        const cs_real_t *m_row = mc->x_val + ms->row_index[_row_id];
         for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
           r->_col_id[ii] = c_id[jj]*b_size + _sub_id;
           r->_vals[ii++] = m_row[jj];
@@ -6409,12 +8543,12 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
       else {
         const cs_lnum_t _sub_id = row_id % b_size;
         const cs_lnum_t *db_size = matrix->db_size;
-        const cs_lnum_t *eb_size = matrix->db_size;
-        const cs_real_t *m_row = mc->val + ms->row_index[_row_id]*eb_size[3];
+        const cs_lnum_t *eb_size = matrix->eb_size;
+        const cs_real_t *m_row = mc->x_val + ms->row_index[_row_id]*eb_size[3];
         for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
           for (cs_lnum_t kk = 0; kk < b_size; kk++) {
             r->_col_id[ii] = c_id[jj]*b_size + kk;
-            r->_vals[ii++] = m_row[_sub_id*eb_size[2] + kk];
+            r->_vals[ii++] = m_row[jj*eb_size[3] + _sub_id*eb_size[2] + kk];
           }
         }
         for (cs_lnum_t kk = 0; kk < b_size; kk++) {
@@ -6425,13 +8559,49 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
         for (; jj < n_ed_cols; jj++) {
           for (cs_lnum_t kk = 0; kk < b_size; kk++) {
             r->_col_id[ii] = c_id[jj]*b_size + kk;
-            r->_vals[ii++] = m_row[_sub_id*eb_size[2] + kk];
+            r->_vals[ii++] = m_row[jj*eb_size[3] + _sub_id*eb_size[2] + kk];
           }
         }
       }
     }
     break;
 
+  case CS_MATRIX_SELL:
+    {
+      const cs_lnum_t _row_id = row_id / b_size;
+      const cs_lnum_t _sub_id = row_id % b_size;
+      const cs_lnum_t *db_size = matrix->db_size;
+      const cs_matrix_struct_sell_t  *ms = matrix->structure;
+      const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+      const cs_lnum_t c_size = ms->chunk_size;
+      const cs_lnum_t n_ed_cols = ms->row_length[_row_id];
+      r->row_size = n_ed_cols + b_size;
+      if (r->buffer_size < r->row_size) {
+        r->buffer_size = r->row_size*2;
+        BFT_REALLOC(r->_col_id, r->buffer_size, cs_lnum_t);
+        r->col_id = r->_col_id;
+        BFT_REALLOC(r->_vals, r->buffer_size, cs_real_t);
+        r->vals = r->_vals;
+      }
+      cs_lnum_t ii = 0, jj = 0;
+      const cs_lnum_t *restrict c_id = ms->col_id + ms->row_start[_row_id];
+      const cs_real_t *m_row = mc->x_val + ms->row_start[_row_id];
+      for (jj = 0; jj < n_ed_cols && c_id[jj*c_size] < _row_id; jj++) {
+        r->_col_id[ii] = c_id[jj*c_size]*b_size + _sub_id;
+        r->_vals[ii++] = m_row[jj*c_size];
+      }
+      for (cs_lnum_t kk = 0; kk < b_size; kk++) {
+        r->_col_id[ii] = _row_id*b_size + kk;
+        r->_vals[ii++] = mc->d_val[  _row_id*db_size[3]
+                                   + _sub_id*db_size[2] + kk];
+      }
+      for (; jj < n_ed_cols; jj++) {
+        r->_col_id[ii] = c_id[jj*c_size]*b_size + _sub_id;
+        r->_vals[ii++] = m_row[jj*c_size];
+      }
+    }
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
@@ -6601,6 +8771,8 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
  * \brief Matrix.vector product y = A.x
  *
  * This function includes a halo update of x prior to multiplication by A.
+ * For scalar CSR and MSR matrices, this update is overlapped with the
+ * product on rows which do not reference ghost values.
  *
  * \param[in]       rotation_mode  halo update option for
  *                                 rotational periodicity
@@ -6619,11 +8791,14 @@ cs_matrix_vector_multiply(cs_halo_rotation_t   rotation_mode,
 {
   assert(matrix != NULL);
 
-  if (matrix->halo != NULL)
+  if (matrix->halo != NULL) {
+    if (_vector_multiply_overlap(rotation_mode, false, matrix, x, y))
+      return;
     _pre_vector_multiply_sync(rotation_mode,
                               matrix,
                               x,
                               y);
+  }
 
   if (matrix->vector_multiply[matrix->fill_type][0] != NULL)
     matrix->vector_multiply[matrix->fill_type][0](false, matrix, x, y);
@@ -6672,6 +8847,8 @@ cs_matrix_vector_multiply_nosync(const cs_matrix_t  *matrix,
  * \brief Matrix.vector product y = (A-D).x
  *
  * This function includes a halo update of x prior to multiplication by A.
+ * For scalar CSR and MSR matrices, this update is overlapped with the
+ * product on rows which do not reference ghost values.
  *
  * \param[in]       rotation_mode  halo update option for
  *                                 rotational periodicity
@@ -6690,11 +8867,14 @@ cs_matrix_exdiag_vector_multiply(cs_halo_rotation_t   rotation_mode,
 {
   assert(matrix != NULL);
 
-  if (matrix->halo != NULL)
+  if (matrix->halo != NULL) {
+    if (_vector_multiply_overlap(rotation_mode, true, matrix, x, y))
+      return;
     _pre_vector_multiply_sync(rotation_mode,
                               matrix,
                               x,
                               y);
+  }
 
   if (matrix->vector_multiply[matrix->fill_type][1] != NULL)
     matrix->vector_multiply[matrix->fill_type][1](true, matrix, x, y);
@@ -6706,6 +8886,91 @@ cs_matrix_exdiag_vector_multiply(cs_halo_rotation_t   rotation_mode,
        cs_matrix_fill_type_name[matrix->fill_type]);
 }
 
+/*----------------------------------------------------------------------------
+ * Matrix.vector product Y = A.X for multiple vectors.
+ *
+ * Vectors are interleaved, so that x[i*n_vecs + k] is the value of vector
+ * k at row i; the matrix coefficients are thus read only once for all
+ * vectors. Scalar CSR and MSR matrices use dedicated kernels; other
+ * matrices fall back to one matrix.vector product per vector.
+ *
+ * This function includes a halo update of x prior to multiplication by A.
+ *
+ * parameters:
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   matrix        <-- pointer to matrix structure
+ *   n_vecs        <-- number of vectors
+ *   x             <-> multipliying vector values (ghost values updated),
+ *                     size: n_cols_ext*n_vecs
+ *   y             --> resulting vector, size: n_rows*n_vecs
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_multiply_multi(cs_halo_rotation_t   rotation_mode,
+                                const cs_matrix_t   *matrix,
+                                cs_lnum_t            n_vecs,
+                                cs_real_t           *restrict x,
+                                cs_real_t           *restrict y)
+{
+  assert(matrix != NULL);
+
+  if (n_vecs == 1) {
+    cs_matrix_vector_multiply(rotation_mode, matrix, x, y);
+    return;
+  }
+
+  const bool scalar = (matrix->db_size[3] == 1 && matrix->eb_size[3] == 1);
+
+  if (scalar && (   matrix->type == CS_MATRIX_CSR
+                 || matrix->type == CS_MATRIX_MSR)) {
+
+    if (matrix->halo != NULL)
+      cs_halo_sync_components_strided(matrix->halo,
+                                      CS_HALO_STANDARD,
+                                      rotation_mode,
+                                      x,
+                                      n_vecs);
+
+    if (matrix->type == CS_MATRIX_CSR)
+      _mat_vec_p_l_csr_multi(matrix, n_vecs, x, y);
+    else
+      _mat_vec_p_l_msr_multi(matrix, n_vecs, x, y);
+
+    return;
+
+  }
+
+  /* Fallback: one matrix.vector product per vector */
+
+  const cs_lnum_t n_rows = matrix->n_rows * matrix->db_size[1];
+  const cs_lnum_t n_cols_ext = matrix->n_cols_ext * matrix->db_size[1];
+
+  cs_real_t *_x, *_y;
+  BFT_MALLOC(_x, n_cols_ext, cs_real_t);
+  BFT_MALLOC(_y, n_cols_ext, cs_real_t);
+
+  for (cs_lnum_t kk = 0; kk < n_vecs; kk++) {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      _x[ii] = x[ii*n_vecs + kk];
+
+    cs_matrix_vector_multiply(rotation_mode, matrix, _x, _y);
+
+#   pragma omp parallel for  if(n_cols_ext > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_cols_ext; ii++)
+      x[ii*n_vecs + kk] = _x[ii];
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      y[ii*n_vecs + kk] = _y[ii];
+
+  }
+
+  BFT_FREE(_y);
+  BFT_FREE(_x);
+}
+
 /*----------------------------------------------------------------------------
  * Synchronize ghost values prior to matrix.vector product
  *
@@ -7128,7 +9393,7 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
       vector_multiply = _b_mat_vec_p_l_native_fixed;
       break;
     case CS_MATRIX_BLOCK:
-      vector_multiply = _bb_mat_vec_p_l_native;
+      vector_multiply = _bb_mat_vec_p_l_native_fixed;
       break;
     default:
       vector_multiply = NULL;
@@ -7322,6 +9587,9 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
       case CS_MATRIX_BLOCK_D_SYM:
         vector_multiply = _b_mat_vec_p_l_msr;
         break;
+      case CS_MATRIX_BLOCK:
+        vector_multiply = _bb_mat_vec_p_l_msr;
+        break;
       default:
         vector_multiply = NULL;
       }
@@ -7385,6 +9653,33 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
 
   }
 
+  if (m->type == CS_MATRIX_SELL) {
+
+    switch(m->fill_type) {
+    case CS_MATRIX_SCALAR:
+    case CS_MATRIX_SCALAR_SYM:
+      vector_multiply = _mat_vec_p_l_sell;
+      break;
+    case CS_MATRIX_BLOCK_D:
+    case CS_MATRIX_BLOCK_D_66:
+    case CS_MATRIX_BLOCK_D_SYM:
+      vector_multiply = _b_mat_vec_p_l_sell;
+      break;
+    default:
+      vector_multiply = NULL;
+    }
+
+    _variant_add(_("SELL"),
+                 m->type,
+                 m->fill_type,
+                 2, /* ed_flag */
+                 vector_multiply,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_variant_t);
 }
@@ -7458,6 +9753,10 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     default
+ *     standard
+ *
  * parameters:
  *   mv        <-> Pointer to matrix variant
  *   numbering <-- mesh numbering info, or NULL
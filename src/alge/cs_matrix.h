@@ -59,9 +59,15 @@ typedef enum {
   CS_MATRIX_CSR_SYM,          /*!< Compressed Symmetric Sparse Row storage */
   CS_MATRIX_MSR,              /*!< Modified Compressed Sparse Row storage
                                 (separate diagonal) */
+  CS_MATRIX_SELL,             /*!< Sliced ELLPACK (SELL-C-sigma) storage
+                                (separate diagonal) */
 
   CS_MATRIX_N_BUILTIN_TYPES,  /*!< Number of known and built-in matrix types */
 
+  CS_MATRIX_SHELL = CS_MATRIX_N_BUILTIN_TYPES,
+                              /*!< Matrix-free matrix, only defined through
+                                a matrix.vector product function */
+
   CS_MATRIX_N_TYPES           /*!< Number of known matrix types */
 
 } cs_matrix_type_t;
@@ -97,6 +103,25 @@ typedef struct _cs_matrix_t cs_matrix_t;
 
 typedef struct _cs_matrix_variant_t cs_matrix_variant_t;
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Function computing a matrix.vector product y = A.x for a
+ *        matrix-free (\ref CS_MATRIX_SHELL) matrix.
+ *
+ * Parallel synchronizations required by the product are handled by the
+ * function itself, as shell matrices have no halo.
+ *
+ * \param[in]   input  pointer to associated (user) context
+ * \param[in]   x      multiplying vector values (size: n_rows)
+ * \param[out]  y      resulting vector (size: n_rows)
+ */
+/*----------------------------------------------------------------------------*/
+
+typedef void
+(cs_matrix_shell_product_t) (const void        *input,
+                             const cs_real_t   *x,
+                             cs_real_t         *y);
+
 /* Information structure for extraction of matrix row */
 
 typedef struct {
@@ -259,6 +284,32 @@ cs_matrix_structure_t *
 cs_matrix_structure_create_from_assembler(cs_matrix_type_t        type,
                                           cs_matrix_assembler_t  *ma);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build and cache the mapping from native (edge-based)
+ *        extradiagonal coefficients to matrix entries for a matrix structure.
+ *
+ * Subsequent calls to \ref cs_matrix_set_coefficients using the same
+ * edges array then reduce to a simple gather, avoiding the search for
+ * each edge's matching entries.
+ *
+ * Only MSR structures are handled, when each extradiagonal entry matches
+ * exactly one edge; for other structures, this function has no effect.
+ *
+ * Note that the structure keeps a reference to the given edges array,
+ * which must not be freed or modified while the map is in use.
+ *
+ * \param[in, out]  ms       pointer to matrix structure
+ * \param[in]       n_edges  local number of graph edges
+ * \param[in]       edges    edges (symmetric row <-> column) connectivity
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_structure_set_edge_map(cs_matrix_structure_t  *ms,
+                                 cs_lnum_t               n_edges,
+                                 const cs_lnum_2_t      *edges);
+
 /*----------------------------------------------------------------------------
  * Destroy a matrix structure.
  *
@@ -320,6 +371,35 @@ cs_matrix_create_from_assembler(cs_matrix_type_t        type,
 cs_matrix_t *
 cs_matrix_create_by_copy(cs_matrix_t   *src);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a matrix-free (shell) scalar matrix.
+ *
+ * Such a matrix has no coefficients: its product with a vector is
+ * computed by the given function, and its diagonal (needed for diagonal
+ * or polynomial preconditioning) is given by the caller. It may thus only
+ * be used with iterative solvers relying on these operations.
+ *
+ * The diagonal and input arrays are shared, so they must remain valid
+ * as long as the matrix is used.
+ *
+ * \param[in]  n_rows     local number of rows
+ * \param[in]  symmetric  indicates if the matrix is symmetric
+ * \param[in]  d_val      diagonal values (size: n_rows), or NULL
+ * \param[in]  product    matrix.vector product function
+ * \param[in]  input      pointer to context passed to the product function
+ *
+ * \return  pointer to created matrix structure;
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_t *
+cs_matrix_create_shell(cs_lnum_t                   n_rows,
+                       bool                        symmetric,
+                       const cs_real_t            *d_val,
+                       cs_matrix_shell_product_t  *product,
+                       const void                 *input);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create a matrix based on the local restriction of a base matrix.
@@ -593,6 +673,33 @@ cs_matrix_assembler_values_init(cs_matrix_t      *matrix,
                                 const cs_lnum_t  *diag_block_size,
                                 const cs_lnum_t  *extra_diag_block_size);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Use single precision extra-diagonal coefficients for
+ *        matrix.vector products.
+ *
+ * A single precision copy of the current extra-diagonal coefficients
+ * is built, and the matrix.vector product functions switched to variants
+ * using it, while the diagonal and vectors remain in double precision.
+ * This reduces memory bandwidth requirements for products, at the
+ * expense of accuracy, so it is intended for matrices where rounding
+ * errors are not critical, such as multigrid coarse levels.
+ *
+ * Double precision coefficients are kept (and still used for other
+ * operations); the copy is discarded when coefficients are assigned
+ * again or released.
+ *
+ * This is currently only available for MSR matrices with scalar
+ * extra-diagonal coefficients; for other cases, this function has
+ * no effect.
+ *
+ * \param[in, out]  matrix  pointer to matrix structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_spmv_single_precision(cs_matrix_t  *matrix);
+
 /*----------------------------------------------------------------------------
  * Release shared matrix coefficients.
  *
@@ -826,6 +933,8 @@ cs_matrix_apply_variant(cs_matrix_t                *m,
  * Matrix.vector product y = A.x
  *
  * This function includes a halo update of x prior to multiplication by A.
+ * For scalar CSR and MSR matrices, this update is overlapped with the
+ * product on rows which do not reference ghost values.
  *
  * parameters:
  *   rotation_mode --> halo update option for rotational periodicity
@@ -863,6 +972,8 @@ cs_matrix_vector_multiply_nosync(const cs_matrix_t  *matrix,
  * Matrix.vector product y = (A-D).x
  *
  * This function includes a halo update of x prior to multiplication by A.
+ * For scalar CSR and MSR matrices, this update is overlapped with the
+ * product on rows which do not reference ghost values.
  *
  * parameters:
  *   rotation_mode <-- halo update option for rotational periodicity
@@ -877,6 +988,32 @@ cs_matrix_exdiag_vector_multiply(cs_halo_rotation_t   rotation_mode,
                                  cs_real_t           *restrict x,
                                  cs_real_t           *restrict y);
 
+/*----------------------------------------------------------------------------
+ * Matrix.vector product Y = A.X for multiple vectors.
+ *
+ * Vectors are interleaved, so that x[i*n_vecs + k] is the value of vector
+ * k at row i; the matrix coefficients are thus read only once for all
+ * vectors. Scalar CSR and MSR matrices use dedicated kernels; other
+ * matrices fall back to one matrix.vector product per vector.
+ *
+ * This function includes a halo update of x prior to multiplication by A.
+ *
+ * parameters:
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   matrix        <-- pointer to matrix structure
+ *   n_vecs        <-- number of vectors
+ *   x             <-> multipliying vector values (ghost values updated),
+ *                     size: n_cols_ext*n_vecs
+ *   y             --> resulting vector, size: n_rows*n_vecs
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_multiply_multi(cs_halo_rotation_t   rotation_mode,
+                                const cs_matrix_t   *matrix,
+                                cs_lnum_t            n_vecs,
+                                cs_real_t           *restrict x,
+                                cs_real_t           *restrict y);
+
 /*----------------------------------------------------------------------------
  * Synchronize ghost values prior to matrix.vector product
  *
@@ -1086,6 +1223,10 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     default
+ *     standard
+ *
  * parameters:
  *   mv        <-> pointer to matrix variant
  *   numbering <-- mesh numbering info, or NULL
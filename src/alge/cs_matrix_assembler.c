@@ -2374,6 +2374,113 @@ _matrix_assembler_values_add_lg_g(cs_matrix_assembler_values_t  *mav,
 
 #endif /* HAVE_MPI */
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the buffer to which the calling thread should add
+ *        contributions to rows handled by other ranks.
+ *
+ * Inside a (non-nested) parallel region, each thread uses its own private
+ * buffer when those have been allocated, so no atomic update is needed.
+ * Otherwise, the shared buffer is returned, and atomic updates are needed
+ * if we are inside a parallel region.
+ *
+ * \param[in]   mav         pointer to matrix assembler values structure
+ * \param[out]  use_atomic  true if updates must be atomic
+ *
+ * \return  pointer to contributions buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_real_t *
+_coeff_send_buffer(const cs_matrix_assembler_values_t  *mav,
+                   bool                                *use_atomic)
+{
+  cs_real_t *coeff_send = mav->coeff_send;
+
+  *use_atomic = false;
+
+#if defined(HAVE_OPENMP)
+
+  if (omp_in_parallel()) {
+    int t_id = omp_get_thread_num();
+    if (omp_get_level() == 1 && t_id + 1 < mav->coeff_send_n_buf) {
+      cs_lnum_t buf_size = mav->ma->coeff_send_size * mav->eb_size[3];
+      coeff_send += (t_id + 1)*buf_size;
+    }
+    else
+      *use_atomic = true;
+  }
+
+#endif
+
+  return coeff_send;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add contributions to a row handled by another rank.
+ *
+ * \param[in, out]  coeff_send  contributions buffer
+ * \param[in]       use_atomic  true if updates must be atomic
+ * \param[in]       e_id        id of entry in contributions buffer
+ * \param[in]       stride      matrix block stride
+ * \param[in]       val         values to add
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_coeff_send_add(cs_real_t        *coeff_send,
+                bool              use_atomic,
+                cs_lnum_t         e_id,
+                cs_lnum_t         stride,
+                const cs_real_t   val[])
+{
+  if (use_atomic) {
+    for (cs_lnum_t l = 0; l < stride; l++)
+#     pragma omp atomic
+      coeff_send[e_id*stride + l] += val[l];
+  }
+  else {
+    for (cs_lnum_t l = 0; l < stride; l++)
+      coeff_send[e_id*stride + l] += val[l];
+  }
+}
+
+#endif /* HAVE_MPI */
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the global column id matching a local row id and
+ *        column index of a matrix assembler.
+ *
+ * \param[in]  ma       pointer to matrix assembler structure
+ * \param[in]  l_r_id   local row id
+ * \param[in]  c_idx    column index in row (-1 for separate diagonal)
+ *
+ * \return  global column id
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_gnum_t
+_col_idx_to_g_id(const cs_matrix_assembler_t  *ma,
+                 cs_lnum_t                     l_r_id,
+                 cs_lnum_t                     c_idx)
+{
+  if (c_idx < 0)
+    return l_r_id + ma->l_range[0];
+
+  cs_lnum_t n_l_cols = ma->r_idx[l_r_id+1] - ma->r_idx[l_r_id];
+  if (ma->d_r_idx != NULL)
+    n_l_cols -= ma->d_r_idx[l_r_id+1] - ma->d_r_idx[l_r_id];
+
+  if (c_idx < n_l_cols)
+    return ma->c_id[ma->r_idx[l_r_id] + c_idx] + ma->l_range[0];
+  else
+    return ma->d_g_c_id[ma->d_r_idx[l_r_id] + c_idx - n_l_cols];
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -3025,6 +3132,112 @@ cs_matrix_assembler_log_rank_counts(const cs_matrix_assembler_t  *ma,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the location of matrix entries given by global
+ *        row and column ids.
+ *
+ * Entries whose row belongs to the local rank are located by their
+ * local row id and column index in that row (-1 for the diagonal when it
+ * is stored separately); entries whose row belongs to another rank are
+ * located by (-2 - id of the matching row) and the id of the entry in
+ * the contributions to send to other ranks.
+ *
+ * Those locations are independent of the values and of the associated
+ * matrix, so when the same entries are assembled repeatedly (for example
+ * at each time step), computing them once and using
+ * \ref cs_matrix_assembler_values_add_loc avoids searching for each
+ * entry in the assembler's structure.
+ *
+ * This function may be called by different threads.
+ *
+ * \param[in]   ma        pointer to matrix assembler structure
+ * \param[in]   n         number of entries
+ * \param[in]   g_row_id  global row ids associated with entries
+ * \param[in]   g_col_id  global column ids associated with entries
+ * \param[out]  loc       entry locations (size: n)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_locate_g(const cs_matrix_assembler_t  *ma,
+                             cs_lnum_t                     n,
+                             const cs_gnum_t               g_row_id[],
+                             const cs_gnum_t               g_col_id[],
+                             cs_lnum_2_t                   loc[])
+{
+  for (cs_lnum_t k = 0; k < n; k++) {
+
+    cs_gnum_t g_r_id = g_row_id[k];
+    cs_gnum_t g_c_id = g_col_id[k];
+
+#if defined(HAVE_MPI)
+
+    /* Case where coefficient is handled by other rank */
+
+    if (g_r_id < ma->l_range[0] || g_r_id >= ma->l_range[1]) {
+
+      cs_lnum_t e_r_id = _g_id_binary_find(ma->coeff_send_n_rows,
+                                           g_r_id,
+                                           ma->coeff_send_row_g_id);
+
+      cs_lnum_t r_start = ma->coeff_send_index[e_r_id];
+      cs_lnum_t n_e_rows = ma->coeff_send_index[e_r_id+1] - r_start;
+
+      loc[k][0] = -2 - e_r_id;
+      loc[k][1] =   r_start
+                  + _g_id_binary_find(n_e_rows,
+                                      g_c_id,
+                                      ma->coeff_send_col_g_id + r_start);
+
+      continue;
+
+    }
+
+#endif /* HAVE_MPI */
+
+    cs_lnum_t l_r_id = g_r_id - ma->l_range[0];
+
+    cs_lnum_t n_l_cols = ma->r_idx[l_r_id+1] - ma->r_idx[l_r_id];
+    if (ma->d_r_idx != NULL)
+      n_l_cols -= ma->d_r_idx[l_r_id+1] - ma->d_r_idx[l_r_id];
+
+    loc[k][0] = l_r_id;
+
+    /* Local part */
+
+    if (g_c_id >= ma->l_range[0] && g_c_id < ma->l_range[1]) {
+
+      cs_lnum_t l_c_id = g_c_id - ma->l_range[0];
+
+      loc[k][1] = _l_id_binary_search(n_l_cols,
+                                      l_c_id,
+                                      ma->c_id + ma->r_idx[l_r_id]);
+
+      assert(loc[k][1] > -1 || (ma->separate_diag && l_c_id == l_r_id));
+
+    }
+
+    /* Distant part */
+
+    else {
+
+      assert(ma->d_r_idx != NULL);
+
+      cs_lnum_t n_cols = ma->d_r_idx[l_r_id+1] - ma->d_r_idx[l_r_id];
+
+      cs_lnum_t d_c_idx = _g_id_binary_find(n_cols,
+                                            g_c_id,
+                                            ma->d_g_c_id + ma->d_r_idx[l_r_id]);
+
+      /* column ids start and end of local row, so add n_l_cols */
+      loc[k][1] = d_c_idx + n_l_cols;
+
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create and initialize a matrix assembler values structure.
@@ -3109,7 +3322,15 @@ cs_matrix_assembler_values_create(const cs_matrix_assembler_t          *ma,
 
 #if defined(HAVE_MPI)
 
-  cs_lnum_t  alloc_size = ma->coeff_send_size * mav->eb_size[3];
+  /* When threads are used, each thread may add contributions to rows
+     handled by other ranks to its own buffer, avoiding atomic updates */
+
+  mav->coeff_send_n_buf = 1;
+  if (cs_glob_n_threads > 1 && ma->coeff_send_size > 0)
+    mav->coeff_send_n_buf += cs_glob_n_threads;
+
+  cs_lnum_t  alloc_size =   ma->coeff_send_size * mav->eb_size[3]
+                          * mav->coeff_send_n_buf;
 
   BFT_MALLOC(mav->coeff_send, alloc_size, cs_real_t);
 
@@ -3317,6 +3538,11 @@ cs_matrix_assembler_values_add_g(cs_matrix_assembler_values_t  *mav,
   else
     stride = mav->eb_size[3];
 
+#if defined(HAVE_MPI)
+  bool use_atomic;
+  cs_real_t *coeff_send = _coeff_send_buffer(mav, &use_atomic);
+#endif
+
   cs_gnum_t s_g_row_id[COEFF_GROUP_SIZE];
   cs_gnum_t s_g_col_id[COEFF_GROUP_SIZE];
 
@@ -3355,9 +3581,8 @@ cs_matrix_assembler_values_add_g(cs_matrix_assembler_values_t  *mav,
 
         /* Now add values to send coefficients */
 
-        for (cs_lnum_t l = 0; l < stride; l++)
-#         pragma omp atomic
-          mav->coeff_send[e_id*stride + l] += val[k*stride + l];
+        _coeff_send_add(coeff_send, use_atomic, e_id, stride,
+                        val + k*stride);
 
       }
 
@@ -3510,6 +3735,133 @@ cs_matrix_assembler_values_add_g(cs_matrix_assembler_values_t  *mav,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a matrix assembler values structure using
+ *        precomputed entry locations.
+ *
+ * This function is equivalent to \ref cs_matrix_assembler_values_add_g,
+ * with entry locations previously computed from global row and column
+ * ids using \ref cs_matrix_assembler_locate_g, so no search is required.
+ *
+ * The same rules regarding block sizes apply, and this function may be
+ * called by different threads under the same conditions.
+ *
+ * \param[in, out]  mav  pointer to matrix assembler values structure
+ * \param[in]       n    number of entries
+ * \param[in]       loc  entry locations
+ * \param[in]       val  values associated with entries
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_values_add_loc(cs_matrix_assembler_values_t  *mav,
+                                   cs_lnum_t                      n,
+                                   const cs_lnum_2_t              loc[],
+                                   const cs_real_t                val[])
+{
+  const cs_matrix_assembler_t  *ma = mav->ma;
+
+  cs_lnum_t stride = 0;
+
+  if (n < 1)
+    return;
+
+  /* Base stride on first type of value encountered */
+
+  bool is_diag = false;
+  if (loc[0][0] > -1)
+    is_diag = (   _col_idx_to_g_id(ma, loc[0][0], loc[0][1])
+               == (cs_gnum_t)(loc[0][0]) + ma->l_range[0]);
+#if defined(HAVE_MPI)
+  else
+    is_diag = (   ma->coeff_send_col_g_id[loc[0][1]]
+               == ma->coeff_send_row_g_id[-2 - loc[0][0]]);
+
+  bool use_atomic;
+  cs_real_t *coeff_send = _coeff_send_buffer(mav, &use_atomic);
+#endif
+
+  if (is_diag)
+    stride = mav->db_size[3];
+  else
+    stride = mav->eb_size[3];
+
+  cs_lnum_t s_row_id[COEFF_GROUP_SIZE];
+  cs_lnum_t s_col_idx[COEFF_GROUP_SIZE];
+
+  for (cs_lnum_t i = 0; i < n; i+= COEFF_GROUP_SIZE) {
+
+    cs_lnum_t b_size = COEFF_GROUP_SIZE;
+    if (i + COEFF_GROUP_SIZE > n)
+      b_size = n - i;
+
+    for (cs_lnum_t j = 0; j < b_size; j++) {
+
+      cs_lnum_t k = i+j;
+
+      s_row_id[j] = loc[k][0];
+      s_col_idx[j] = loc[k][1];
+
+#if defined(HAVE_MPI)
+
+      /* Case where coefficient is handled by other rank */
+
+      if (s_row_id[j] < 0) {
+        _coeff_send_add(coeff_send, use_atomic, s_col_idx[j], stride,
+                        val + k*stride);
+        s_row_id[j] = -1;
+        s_col_idx[j] = -1;
+      }
+
+#endif /* HAVE_MPI */
+
+    }
+
+    if (mav->add_values_g != NULL) { /* global id-based assembler function */
+
+      cs_gnum_t s_g_row_id[COEFF_GROUP_SIZE];
+      cs_gnum_t s_g_col_id[COEFF_GROUP_SIZE];
+
+      for (cs_lnum_t j = 0; j < b_size; j++) {
+        if (s_row_id[j] < 0) { /* filter other-rank values */
+          s_g_row_id[j] = ma->l_range[1];
+          s_g_col_id[j] = 0;
+        }
+        else {
+          s_g_row_id[j] = s_row_id[j] + ma->l_range[0];
+          s_g_col_id[j] = _col_idx_to_g_id(ma, s_row_id[j], s_col_idx[j]);
+        }
+      }
+
+      mav->add_values_g(mav->matrix,
+                        b_size,
+                        stride,
+                        s_g_row_id,
+                        s_g_col_id,
+                        val + (i*stride));
+
+    }
+
+    else if (ma->separate_diag == mav->separate_diag)
+      mav->add_values(mav->matrix,
+                      b_size,
+                      stride,
+                      s_row_id,
+                      s_col_idx,
+                      val + (i*stride));
+
+    else
+      _matrix_assembler_values_add_cnv_idx(mav,
+                                           b_size,
+                                           stride,
+                                           s_row_id,
+                                           s_col_idx,
+                                           val + (i*stride));
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Start assembly of matrix values structure.
@@ -3550,6 +3902,21 @@ cs_matrix_assembler_values_done(cs_matrix_assembler_values_t  *mav)
 
     BFT_MALLOC(recv_coeffs, ma->coeff_recv_size*stride, cs_real_t);
 
+    /* Merge contributions from thread-private buffers */
+
+    if (mav->coeff_send_n_buf > 1) {
+
+      const int n_buf = mav->coeff_send_n_buf;
+      const cs_lnum_t buf_size = ma->coeff_send_size*stride;
+
+#     pragma omp parallel for if (buf_size > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < buf_size; i++) {
+        for (int j = 1; j < n_buf; j++)
+          mav->coeff_send[i] += mav->coeff_send[j*buf_size + i];
+      }
+
+    }
+
     BFT_MALLOC(request, ma->n_coeff_ranks*2, MPI_Request);
     BFT_MALLOC(status, ma->n_coeff_ranks*2, MPI_Status);
 
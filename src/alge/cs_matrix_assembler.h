@@ -544,6 +544,40 @@ cs_matrix_assembler_log_rank_counts(const cs_matrix_assembler_t  *ma,
                                     cs_log_t                      log_id,
                                     const char                   *name);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the location of matrix entries given by global
+ *        row and column ids.
+ *
+ * Entries whose row belongs to the local rank are located by their
+ * local row id and column index in that row (-1 for the diagonal when it
+ * is stored separately); entries whose row belongs to another rank are
+ * located by (-2 - id of the matching row) and the id of the entry in
+ * the contributions to send to other ranks.
+ *
+ * Those locations are independent of the values and of the associated
+ * matrix, so when the same entries are assembled repeatedly (for example
+ * at each time step), computing them once and using
+ * \ref cs_matrix_assembler_values_add_loc avoids searching for each
+ * entry in the assembler's structure.
+ *
+ * This function may be called by different threads.
+ *
+ * \param[in]   ma        pointer to matrix assembler structure
+ * \param[in]   n         number of entries
+ * \param[in]   g_row_id  global row ids associated with entries
+ * \param[in]   g_col_id  global column ids associated with entries
+ * \param[out]  loc       entry locations (size: n)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_locate_g(const cs_matrix_assembler_t  *ma,
+                             cs_lnum_t                     n,
+                             const cs_gnum_t               g_row_id[],
+                             const cs_gnum_t               g_col_id[],
+                             cs_lnum_2_t                   loc[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create and initialize a matrix assembler values structure.
@@ -680,6 +714,31 @@ cs_matrix_assembler_values_add_g(cs_matrix_assembler_values_t  *mav,
                                  const cs_gnum_t                g_col_id[],
                                  const cs_real_t                val[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a matrix assembler values structure using
+ *        precomputed entry locations.
+ *
+ * This function is equivalent to \ref cs_matrix_assembler_values_add_g,
+ * with entry locations previously computed from global row and column
+ * ids using \ref cs_matrix_assembler_locate_g, so no search is required.
+ *
+ * The same rules regarding block sizes apply, and this function may be
+ * called by different threads under the same conditions.
+ *
+ * \param[in, out]  mav  pointer to matrix assembler values structure
+ * \param[in]       n    number of entries
+ * \param[in]       loc  entry locations
+ * \param[in]       val  values associated with entries
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_values_add_loc(cs_matrix_assembler_values_t  *mav,
+                                   cs_lnum_t                      n,
+                                   const cs_lnum_2_t              loc[],
+                                   const cs_real_t                val[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Start assembly of matrix values structure.
@@ -179,6 +179,12 @@ struct _cs_matrix_assembler_values_t {
 
   cs_real_t  *coeff_send;
 
+  int         coeff_send_n_buf;       /* number of contribution buffers:
+                                         1, or 1 + number of threads when
+                                         each thread has a private buffer
+                                         (merged into the first one when
+                                         assembly is done) */
+
 #endif
 
   /* Matching structure and function pointers; some function type may not be
@@ -0,0 +1,439 @@
+/*============================================================================
+ * Device-resident sparse matrices and operations using CUDA
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_base.h"
+#include "cs_base_cuda.h"
+#include "cs_halo.h"
+#include "cs_halo_cuda.h"
+#include "cs_matrix.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_matrix_cuda.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+#define CS_MATRIX_CUDA_BLOCK_SIZE 256
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/* Device-resident matrix */
+
+struct _cs_matrix_cuda_t {
+
+  cs_matrix_type_t   type;          /* CS_MATRIX_CSR or CS_MATRIX_MSR */
+
+  cs_lnum_t          n_rows;        /* Number of rows */
+  cs_lnum_t          n_cols;        /* Number of columns, including ghosts */
+
+  const cs_halo_t   *halo;          /* Pointer to host halo, or NULL */
+
+  cs_lnum_t         *row_index;     /* Row index (on device) */
+  cs_lnum_t         *col_id;        /* Column ids (on device) */
+  cs_real_t         *d_val;         /* Diagonal values (MSR only,
+                                       on device) */
+  cs_real_t         *x_val;         /* Extra-diagonal values for MSR,
+                                       all values for CSR (on device) */
+  cs_real_t         *ad_inv;        /* Inverse of diagonal (on device) */
+
+  cs_halo_cuda_t    *dh;            /* Device halo exchange helper,
+                                       or NULL */
+
+};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return grid size for a given number of elements.
+ *
+ * parameters:
+ *   n <-- number of elements
+ *
+ * returns:
+ *   number of blocks
+ *----------------------------------------------------------------------------*/
+
+static inline unsigned int
+_grid_size(cs_lnum_t  n)
+{
+  return (n % CS_MATRIX_CUDA_BLOCK_SIZE) ?
+    n/CS_MATRIX_CUDA_BLOCK_SIZE + 1 : n/CS_MATRIX_CUDA_BLOCK_SIZE;
+}
+
+/*----------------------------------------------------------------------------
+ * Allocate device array and copy host values to it.
+ *
+ * parameters:
+ *   n_vals <-- number of values
+ *   size   <-- size of each value
+ *   h_vals <-- host values
+ *
+ * returns:
+ *   pointer to device array
+ *----------------------------------------------------------------------------*/
+
+static void *
+_copy_to_device(size_t       n_vals,
+                size_t       size,
+                const void  *h_vals)
+{
+  void *d_vals = NULL;
+
+  if (n_vals > 0) {
+    CS_CUDA_CHECK(cudaMalloc(&d_vals, n_vals*size));
+    CS_CUDA_CHECK(cudaMemcpy(d_vals, h_vals, n_vals*size,
+                             cudaMemcpyHostToDevice));
+  }
+
+  return d_vals;
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with CSR matrix.
+ *
+ * One thread is used per row.
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_mat_vec_p_l_csr(cs_lnum_t                    n_rows,
+                 const cs_lnum_t  *restrict   row_index,
+                 const cs_lnum_t  *restrict   col_id,
+                 const cs_real_t  *restrict   val,
+                 const cs_real_t  *restrict   x,
+                 cs_real_t        *restrict   y)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n_rows) {
+    const cs_lnum_t s_id = row_index[ii];
+    const cs_lnum_t e_id = row_index[ii+1];
+    cs_real_t sii = 0.0;
+    for (cs_lnum_t jj = s_id; jj < e_id; jj++)
+      sii += val[jj]*x[col_id[jj]];
+    y[ii] = sii;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix.
+ *
+ * One thread is used per row.
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_mat_vec_p_l_msr(cs_lnum_t                    n_rows,
+                 const cs_lnum_t  *restrict   row_index,
+                 const cs_lnum_t  *restrict   col_id,
+                 const cs_real_t  *restrict   d_val,
+                 const cs_real_t  *restrict   x_val,
+                 const cs_real_t  *restrict   x,
+                 cs_real_t        *restrict   y)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n_rows) {
+    const cs_lnum_t s_id = row_index[ii];
+    const cs_lnum_t e_id = row_index[ii+1];
+    cs_real_t sii = d_val[ii]*x[ii];
+    for (cs_lnum_t jj = s_id; jj < e_id; jj++)
+      sii += x_val[jj]*x[col_id[jj]];
+    y[ii] = sii;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Diagonal scaling for Jacobi preconditioning.
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_jacobi_kernel(cs_lnum_t                    n_rows,
+               const cs_real_t  *restrict   ad_inv,
+               const cs_real_t  *restrict   x_in,
+               cs_real_t        *restrict   x_out)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n_rows)
+    x_out[ii] = x_in[ii] * ad_inv[ii];
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check if a matrix may be mirrored on the current CUDA device.
+ *
+ * This is the case for scalar CSR and MSR matrices whose halo (if present)
+ * does not involve rotational periodicity.
+ *
+ * parameters:
+ *   matrix <-- pointer to host matrix structure
+ *
+ * returns:
+ *   true if cs_matrix_cuda_create() may be used for this matrix
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_cuda_is_supported(const cs_matrix_t  *matrix)
+{
+  cs_matrix_type_t type = cs_matrix_get_type(matrix);
+
+  if (type != CS_MATRIX_CSR && type != CS_MATRIX_MSR)
+    return false;
+
+  if (   cs_matrix_get_diag_block_size(matrix)[0] != 1
+      || cs_matrix_get_extra_diag_block_size(matrix)[0] != 1)
+    return false;
+
+  const cs_halo_t  *halo = cs_matrix_get_halo(matrix);
+  if (halo != NULL) {
+    if (halo->n_rotations > 0)
+      return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a device-resident copy of a matrix's structure and coefficients.
+ *
+ * The inverse of the matrix diagonal is also computed, for use by
+ * Jacobi preconditioning.
+ *
+ * parameters:
+ *   matrix <-- pointer to host matrix structure
+ *
+ * returns:
+ *   pointer to device matrix structure
+ *----------------------------------------------------------------------------*/
+
+cs_matrix_cuda_t *
+cs_matrix_cuda_create(const cs_matrix_t  *matrix)
+{
+  assert(cs_matrix_cuda_is_supported(matrix));
+
+  cs_matrix_cuda_t  *dm = NULL;
+
+  BFT_MALLOC(dm, 1, cs_matrix_cuda_t);
+
+  dm->type = cs_matrix_get_type(matrix);
+  dm->n_rows = cs_matrix_get_n_rows(matrix);
+  dm->n_cols = cs_matrix_get_n_columns(matrix);
+  dm->halo = cs_matrix_get_halo(matrix);
+
+  const cs_lnum_t n_rows = dm->n_rows;
+
+  /* Structure and coefficients */
+
+  const cs_lnum_t *row_index = NULL, *col_id = NULL;
+  const cs_real_t *d_val = NULL, *x_val = NULL;
+
+  if (dm->type == CS_MATRIX_CSR)
+    cs_matrix_get_csr_arrays(matrix, &row_index, &col_id, &x_val);
+  else
+    cs_matrix_get_msr_arrays(matrix, &row_index, &col_id, &d_val, &x_val);
+
+  const cs_lnum_t nnz = row_index[n_rows];
+
+  dm->row_index = (cs_lnum_t *)_copy_to_device(n_rows + 1,
+                                               sizeof(cs_lnum_t),
+                                               row_index);
+  dm->col_id = (cs_lnum_t *)_copy_to_device(nnz, sizeof(cs_lnum_t), col_id);
+  dm->x_val = (cs_real_t *)_copy_to_device(nnz, sizeof(cs_real_t), x_val);
+
+  if (d_val != NULL)
+    dm->d_val = (cs_real_t *)_copy_to_device(n_rows,
+                                             sizeof(cs_real_t),
+                                             d_val);
+  else if (dm->type == CS_MATRIX_MSR) {
+    CS_CUDA_CHECK(cudaMalloc((void **)&(dm->d_val),
+                             n_rows*sizeof(cs_real_t)));
+    CS_CUDA_CHECK(cudaMemset(dm->d_val, 0, n_rows*sizeof(cs_real_t)));
+  }
+  else
+    dm->d_val = NULL;
+
+  /* Diagonal inverse */
+
+  {
+    cs_real_t *_ad_inv;
+    BFT_MALLOC(_ad_inv, n_rows, cs_real_t);
+
+    cs_matrix_copy_diagonal(matrix, _ad_inv);
+
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      _ad_inv[i] = 1.0 / _ad_inv[i];
+
+    dm->ad_inv = (cs_real_t *)_copy_to_device(n_rows,
+                                              sizeof(cs_real_t),
+                                              _ad_inv);
+
+    BFT_FREE(_ad_inv);
+  }
+
+  /* Halo exchange helper */
+
+  dm->dh = NULL;
+
+  if (dm->halo != NULL)
+    dm->dh = cs_halo_cuda_create(dm->halo);
+
+  return dm;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a device-resident matrix.
+ *
+ * parameters:
+ *   dm <-> pointer to device matrix structure pointer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_cuda_destroy(cs_matrix_cuda_t  **dm)
+{
+  if (dm == NULL || *dm == NULL)
+    return;
+
+  cs_matrix_cuda_t  *_dm = *dm;
+
+  CS_CUDA_CHECK(cudaFree(_dm->row_index));
+  CS_CUDA_CHECK(cudaFree(_dm->col_id));
+  CS_CUDA_CHECK(cudaFree(_dm->d_val));
+  CS_CUDA_CHECK(cudaFree(_dm->x_val));
+  CS_CUDA_CHECK(cudaFree(_dm->ad_inv));
+
+  cs_halo_cuda_destroy(&(_dm->dh));
+
+  BFT_FREE(*dm);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the number of columns (including ghost values) of a device matrix.
+ *
+ * parameters:
+ *   dm <-- pointer to device matrix structure
+ *
+ * returns:
+ *   number of columns
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_matrix_cuda_get_n_columns(const cs_matrix_cuda_t  *dm)
+{
+  return dm->n_cols;
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x on device.
+ *
+ * This function includes a halo update of x prior to multiplication by A,
+ * using device-side packing (see cs_halo_cuda_sync_var).
+ *
+ * parameters:
+ *   dm <-- pointer to device matrix structure
+ *   x  <-> multipliying vector values (on device, size: n_columns)
+ *   y  --> resulting vector (on device, size: n_rows)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_cuda_vector_multiply(cs_matrix_cuda_t  *dm,
+                               cs_real_t         *x,
+                               cs_real_t         *y)
+{
+  const cs_lnum_t n_rows = dm->n_rows;
+
+  if (dm->dh != NULL)
+    cs_halo_cuda_sync_var(dm->dh, CS_HALO_STANDARD, x);
+
+  if (n_rows < 1)
+    return;
+
+  if (dm->type == CS_MATRIX_CSR)
+    _mat_vec_p_l_csr<<<_grid_size(n_rows), CS_MATRIX_CUDA_BLOCK_SIZE>>>
+      (n_rows, dm->row_index, dm->col_id, dm->x_val, x, y);
+  else
+    _mat_vec_p_l_msr<<<_grid_size(n_rows), CS_MATRIX_CUDA_BLOCK_SIZE>>>
+      (n_rows, dm->row_index, dm->col_id, dm->d_val, dm->x_val, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Apply Jacobi preconditioning on device: x_out = D^-1.x_in
+ *
+ * parameters:
+ *   dm    <-- pointer to device matrix structure
+ *   x_in  <-- input vector (on device, size: n_rows)
+ *   x_out --> output vector (on device, size: n_rows)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_cuda_jacobi_apply(const cs_matrix_cuda_t  *dm,
+                            const cs_real_t         *x_in,
+                            cs_real_t               *x_out)
+{
+  const cs_lnum_t n_rows = dm->n_rows;
+
+  if (n_rows < 1)
+    return;
+
+  _jacobi_kernel<<<_grid_size(n_rows), CS_MATRIX_CUDA_BLOCK_SIZE>>>
+    (n_rows, dm->ad_inv, x_in, x_out);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,150 @@
+#ifndef __CS_MATRIX_CUDA_H__
+#define __CS_MATRIX_CUDA_H__
+
+/*============================================================================
+ * Device-resident sparse matrices and operations using CUDA
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+#include "cs_matrix.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Structure associated with a device-resident matrix (opaque) */
+
+typedef struct _cs_matrix_cuda_t  cs_matrix_cuda_t;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check if a matrix may be mirrored on the current CUDA device.
+ *
+ * This is the case for scalar CSR and MSR matrices whose halo (if present)
+ * does not involve rotational periodicity.
+ *
+ * parameters:
+ *   matrix <-- pointer to host matrix structure
+ *
+ * returns:
+ *   true if cs_matrix_cuda_create() may be used for this matrix
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_cuda_is_supported(const cs_matrix_t  *matrix);
+
+/*----------------------------------------------------------------------------
+ * Create a device-resident copy of a matrix's structure and coefficients.
+ *
+ * The inverse of the matrix diagonal is also computed, for use by
+ * Jacobi preconditioning.
+ *
+ * parameters:
+ *   matrix <-- pointer to host matrix structure
+ *
+ * returns:
+ *   pointer to device matrix structure
+ *----------------------------------------------------------------------------*/
+
+cs_matrix_cuda_t *
+cs_matrix_cuda_create(const cs_matrix_t  *matrix);
+
+/*----------------------------------------------------------------------------
+ * Destroy a device-resident matrix.
+ *
+ * parameters:
+ *   dm <-> pointer to device matrix structure pointer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_cuda_destroy(cs_matrix_cuda_t  **dm);
+
+/*----------------------------------------------------------------------------
+ * Return the number of columns (including ghost values) of a device matrix.
+ *
+ * parameters:
+ *   dm <-- pointer to device matrix structure
+ *
+ * returns:
+ *   number of columns
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_matrix_cuda_get_n_columns(const cs_matrix_cuda_t  *dm);
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x on device.
+ *
+ * This function includes a halo update of x prior to multiplication by A.
+ * Only the values to send, and received ghost values, are copied between
+ * device and host for this update.
+ *
+ * parameters:
+ *   dm <-- pointer to device matrix structure
+ *   x  <-> multipliying vector values (on device, size: n_columns)
+ *   y  --> resulting vector (on device, size: n_rows)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_cuda_vector_multiply(cs_matrix_cuda_t  *dm,
+                               cs_real_t         *x,
+                               cs_real_t         *y);
+
+/*----------------------------------------------------------------------------
+ * Apply Jacobi preconditioning on device: x_out = D^-1.x_in
+ *
+ * parameters:
+ *   dm    <-- pointer to device matrix structure
+ *   x_in  <-- input vector (on device, size: n_rows)
+ *   x_out --> output vector (on device, size: n_rows)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_cuda_jacobi_apply(const cs_matrix_cuda_t  *dm,
+                            const cs_real_t         *x_in,
+                            cs_real_t               *x_out);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MATRIX_CUDA_H__ */
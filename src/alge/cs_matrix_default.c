@@ -134,6 +134,12 @@ static cs_matrix_assembler_t  *_matrix_assembler = NULL;
 
 static cs_matrix_assembler_t  **_matrix_assembler_coupled = NULL;
 
+/* Precomputed entry locations for the above assembler structures, in the
+   order in which coefficients are assembled (diagonal, then faces) */
+
+static cs_lnum_2_t   *_matrix_assembler_loc = NULL;
+static cs_lnum_2_t  **_matrix_assembler_coupled_loc = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -227,6 +233,16 @@ _update_matrix_struct(cs_matrix_type_t  t)
                                        (const cs_lnum_2_t *)(mesh->i_face_cells),
                                        mesh->halo,
                                        mesh->i_face_numbering);
+
+      /* Coefficients are usually assigned from face-based values at
+         each time step, so cache the face -> entry mapping */
+
+      const cs_lnum_2_t *i_face_cells
+        = (const cs_lnum_2_t *)(mesh->i_face_cells);
+
+      cs_matrix_structure_set_edge_map(_matrix_struct[t],
+                                       mesh->n_i_faces,
+                                       i_face_cells);
     }
     break;
 
@@ -357,6 +373,80 @@ _create_assembler(int  coupling_id)
   return ma;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute locations of cell-based matrix entries in a matrix assembler
+ *
+ * Locations are computed in the order in which coefficients are added
+ * by cs_matrix_set_coefficients_by_assembler: diagonal terms first,
+ * then extra-diagonal terms based on interior faces.
+ *
+ * parameters:
+ *   ma <-- pointer to matrix assembler
+ *
+ * returns:
+ *   pointer to allocated entry locations
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_2_t *
+_locate_assembler_entries(const cs_matrix_assembler_t  *ma)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  const cs_lnum_t     n_rows = m->n_cells;
+  const cs_lnum_t     n_edges = m->n_i_faces;
+  const cs_lnum_2_t  *edges = (const cs_lnum_2_t *)(m->i_face_cells);
+
+  const cs_gnum_t *r_g_id = _global_row_id;
+
+  cs_lnum_t n_entries = n_rows;
+  for (cs_lnum_t ii = 0; ii < n_edges; ii++) {
+    if (edges[ii][0] < n_rows)
+      n_entries++;
+    if (edges[ii][1] < n_rows)
+      n_entries++;
+  }
+
+  cs_lnum_2_t *loc;
+  BFT_MALLOC(loc, n_entries, cs_lnum_2_t);
+
+  /* Diagonal entries */
+
+  cs_matrix_assembler_locate_g(ma, n_rows, r_g_id, r_g_id, loc);
+
+  /* Extradiagonal entries based on internal faces */
+
+  const cs_lnum_t block_size = 800;
+  cs_gnum_t g_row_id[800];
+  cs_gnum_t g_col_id[800];
+
+  cs_lnum_t jj = 0, shift = n_rows;
+
+  for (cs_lnum_t ii = 0; ii < n_edges; ii++) {
+    cs_lnum_t i0 = edges[ii][0];
+    cs_lnum_t i1 = edges[ii][1];
+    if (i0 < n_rows) {
+      g_row_id[jj] = r_g_id[i0];
+      g_col_id[jj] = r_g_id[i1];
+      jj++;
+    }
+    if (i1 < n_rows) {
+      g_row_id[jj] = r_g_id[i1];
+      g_col_id[jj] = r_g_id[i0];
+      jj++;
+    }
+    if (jj >= block_size - 1) {
+      cs_matrix_assembler_locate_g(ma, jj, g_row_id, g_col_id, loc + shift);
+      shift += jj;
+      jj = 0;
+    }
+  }
+  cs_matrix_assembler_locate_g(ma, jj, g_row_id, g_col_id, loc + shift);
+
+  assert(shift + jj == n_entries);
+
+  return loc;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -440,8 +530,11 @@ cs_matrix_initialize(void)
 
   if (n_ic > 0) {
     BFT_MALLOC(_matrix_assembler_coupled, n_ic, cs_matrix_assembler_t *);
-    for (int i = 0; i < n_ic; i++)
+    BFT_MALLOC(_matrix_assembler_coupled_loc, n_ic, cs_lnum_2_t *);
+    for (int i = 0; i < n_ic; i++) {
       _matrix_assembler_coupled[i] = NULL;
+      _matrix_assembler_coupled_loc[i] = NULL;
+    }
   }
 }
 
@@ -466,14 +559,21 @@ cs_matrix_finalize(void)
   }
 
   cs_matrix_assembler_destroy(&_matrix_assembler);
+  BFT_FREE(_matrix_assembler_loc);
 
   /* Matrices for internal couplings */
 
   int n_ic = cs_internal_coupling_n_couplings();
   for (int i = 0; i < n_ic; i++) {
     cs_matrix_assembler_destroy(&(_matrix_assembler_coupled[i]));
+    BFT_FREE(_matrix_assembler_coupled_loc[i]);
   }
   BFT_FREE(_matrix_assembler_coupled);
+  BFT_FREE(_matrix_assembler_coupled_loc);
+
+  /* Tuning cache settings */
+
+  cs_matrix_tuning_set_cache_file(NULL);
 
   /* Exit status */
 
@@ -508,12 +608,14 @@ cs_matrix_update_mesh(void)
   }
 
   cs_matrix_assembler_destroy(&_matrix_assembler);
+  BFT_FREE(_matrix_assembler_loc);
 
   /* Matrices for internal couplings */
 
   int n_ic = cs_internal_coupling_n_couplings();
   for (int i = 0; i < n_ic; i++) {
     cs_matrix_assembler_destroy(&(_matrix_assembler_coupled[i]));
+    BFT_FREE(_matrix_assembler_coupled_loc[i]);
   }
 }
 
@@ -793,6 +895,17 @@ cs_matrix_set_coefficients_by_assembler(const cs_field_t  *f,
       _matrix_assembler_coupled[coupling_id] = ma;
   }
 
+  /* Entry locations are computed once per assembler, so that repeated
+     assembly does not need to search for each entry */
+
+  cs_lnum_2_t  **loc_p = (coupling_id < 0) ?
+    &_matrix_assembler_loc : &(_matrix_assembler_coupled_loc[coupling_id]);
+
+  if (*loc_p == NULL)
+    *loc_p = _locate_assembler_entries(ma);
+
+  const cs_lnum_2_t *loc = *loc_p;
+
   /* Now build matrix */
 
   cs_matrix_t *m = cs_matrix_create_from_assembler(type, ma);
@@ -811,13 +924,11 @@ cs_matrix_set_coefficients_by_assembler(const cs_field_t  *f,
   /* Set coefficients */
 
   const cs_lnum_t block_size = 800;
-  cs_gnum_t g_row_id[800];
-  cs_gnum_t g_col_id[800];
   cs_real_t val[1600];
 
   /* Diagonal values */
 
-  cs_matrix_assembler_values_add_g(mav, n_rows, r_g_id, r_g_id, da);
+  cs_matrix_assembler_values_add_loc(mav, n_rows, loc, da);
 
   /* Extradiagonal values based on internal faces */
 
@@ -829,32 +940,27 @@ cs_matrix_set_coefficients_by_assembler(const cs_field_t  *f,
   if (extra_diag_block_size != NULL)
     eb_size = extra_diag_block_size[0];
 
-  cs_lnum_t jj = 0;
+  cs_lnum_t jj = 0, shift = n_rows;
 
   if (eb_size == 1) {
     for (cs_lnum_t ii = 0; ii < n_edges; ii++) {
       cs_lnum_t i0 = edges[ii][0];
       cs_lnum_t i1 = edges[ii][1];
       if (i0 < n_rows) {
-        g_row_id[jj] = r_g_id[i0];
-        g_col_id[jj] = r_g_id[i1];
         val[jj] = xa[ii*s0];
         jj++;
       }
       if (i1 < n_rows) {
-        g_row_id[jj] = r_g_id[i1];
-        g_col_id[jj] = r_g_id[i0];
         val[jj] = xa[ii*s0+s1];
         jj++;
       }
       if (jj >= block_size - 1) {
-        cs_matrix_assembler_values_add_g(mav, jj,
-                                         g_row_id, g_col_id, val);
+        cs_matrix_assembler_values_add_loc(mav, jj, loc + shift, val);
+        shift += jj;
         jj = 0;
       }
     }
-    cs_matrix_assembler_values_add_g(mav, jj,
-                                     g_row_id, g_col_id, val);
+    cs_matrix_assembler_values_add_loc(mav, jj, loc + shift, val);
     jj = 0;
   }
   else {
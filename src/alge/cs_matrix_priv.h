@@ -55,6 +55,7 @@ BEGIN_C_DECLS
  *  - Compressed Sparse Row (CSR)
  *  - Modified Compressed Sparse Row (MSR), with separate diagonal
  *  - Symmetric Compressed Sparse Row (CSR_SYM)
+ *  - Sliced ELLPACK (SELL-C-sigma), with separate diagonal
  */
 
 /*----------------------------------------------------------------------------
@@ -152,6 +153,22 @@ typedef struct _cs_matrix_struct_csr_t {
   cs_lnum_t        *_row_index;       /* Row index (0 to n-1), if owner */
   cs_lnum_t        *_col_id;          /* Column id (0 to n-1), if owner */
 
+  cs_lnum_t         n_i_rows;         /* Number of rows referencing no
+                                         ghost column (interior rows) */
+  cs_lnum_t        *_row_part;        /* Row ids, interior rows first,
+                                         then boundary rows (rows referencing
+                                         ghost columns), or NULL if the
+                                         structure has no ghost columns */
+
+  cs_lnum_t           n_edges;        /* Number of edges for edge map */
+  const cs_lnum_2_t  *edges;          /* Edges (symmetric row <-> column)
+                                         connectivity for which the edge map
+                                         was built, or NULL */
+  cs_lnum_t          *_xa_src_id;     /* For each extradiagonal value, id of
+                                         the matching native value, for
+                                         non-symmetric (2 per edge) values,
+                                         or NULL if no edge map is built */
+
 } cs_matrix_struct_csr_t;
 
 /* CSR matrix coefficients representation */
@@ -233,8 +250,66 @@ typedef struct _cs_matrix_coeff_msr_t {
   cs_real_t        *_d_val;           /* Diagonal matrix coefficients */
   cs_real_t        *_x_val;           /* Extra-diagonal matrix coefficients */
 
+  /* Optional private single precision copy (NULL if unused) */
+
+  float            *x_val_sp;         /* Extra-diagonal matrix coefficients
+                                         used for matrix.vector products */
+
 } cs_matrix_coeff_msr_t;
 
+/* Matrix-free (shell) matrix coefficients representation */
+/*----------------------------------------------------------*/
+
+typedef struct _cs_matrix_coeff_shell_t {
+
+  cs_matrix_shell_product_t  *product;  /* Matrix.vector product function */
+  const void                 *input;    /* Context for product function */
+
+  const cs_real_t            *d_val;    /* Shared diagonal values, or NULL */
+
+} cs_matrix_coeff_shell_t;
+
+/* SELL-C-sigma (sliced ELLPACK) matrix structure representation */
+/*---------------------------------------------------------------*/
+
+/* Rows are grouped in slices of chunk_size rows, whose extra-diagonal
+   entries are stored column-major (entry j of lane l of slice s is
+   at slice_index[s] + j*chunk_size + l), padded to the longest row
+   of the slice. Rows are sorted by decreasing length inside windows
+   of sigma rows, so as to limit padding. Coefficients use the MSR
+   coefficients structure (separate diagonal), with extra-diagonal
+   values stored in the sliced order. */
+
+typedef struct _cs_matrix_struct_sell_t {
+
+  cs_lnum_t         n_rows;           /* Local number of rows */
+  cs_lnum_t         n_cols_ext;       /* Local number of columns + ghosts */
+
+  cs_lnum_t         chunk_size;       /* Number of rows per slice */
+  cs_lnum_t         sigma;            /* Row sorting window size */
+  cs_lnum_t         n_slices;         /* Number of slices */
+  cs_lnum_t         n_entries;        /* Number of extra-diagonal entries
+                                         (excluding padding) */
+
+  bool              direct_assembly;  /* True if each value corresponds to
+                                         a unique face ; false if multiple
+                                         faces contribute to the same
+                                         value (i.e. we have split faces) */
+
+  cs_lnum_t        *slice_index;      /* Slice start index in column id and
+                                         value arrays (size: n_slices + 1) */
+  cs_lnum_t        *slice_row_id;     /* Row id for each slice lane, or -1
+                                         for padding lanes
+                                         (size: n_slices*chunk_size) */
+  cs_lnum_t        *row_start;        /* Position of first entry of each row
+                                         in sliced arrays (size: n_rows) */
+  cs_lnum_t        *row_length;       /* Number of extra-diagonal entries
+                                         of each row (size: n_rows) */
+  cs_lnum_t        *col_id;           /* Column ids, padded with the
+                                         row's own id (0 to n-1) */
+
+} cs_matrix_struct_sell_t;
+
 /* Matrix structure (representation-independent part) */
 /*----------------------------------------------------*/
 
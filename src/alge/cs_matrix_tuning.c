@@ -83,7 +83,9 @@
 #include "cs_halo_perio.h"
 #include "cs_log.h"
 #include "cs_numbering.h"
+#include "cs_parall.h"
 #include "cs_prototypes.h"
+#include "cs_system_info.h"
 #include "cs_timer.h"
 
 /*----------------------------------------------------------------------------
@@ -105,6 +107,10 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Maximum size of tuning cache keys */
+
+#define CS_MATRIX_TUNING_KEY_SIZE 256
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -116,6 +122,11 @@ BEGIN_C_DECLS
  *  Global variables
  *============================================================================*/
 
+/* Tuning cache file path, and option to ignore cached values */
+
+static char  *_cache_path = NULL;
+static bool   _cache_force = false;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -308,6 +319,224 @@ _matrix_tune_spmv_select(const cs_matrix_t    *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return path to tuning cache file, or NULL if caching is not active.
+ *
+ * If no path was set explicitely, the CS_MATRIX_TUNING_CACHE environment
+ * variable is used.
+ *
+ * returns:
+ *   path to tuning cache file, or NULL
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_tuning_cache_path(void)
+{
+  if (_cache_path != NULL)
+    return _cache_path;
+
+  const char *s = getenv("CS_MATRIX_TUNING_CACHE");
+  if (s != NULL && strlen(s) > 0)
+    return s;
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Build key identifying a tuning run for a given matrix.
+ *
+ * The key is based on the matrix type and fill type, diagonal block size,
+ * global number of rows, number of ranks and threads, and CPU model.
+ *
+ * This function must be called by all ranks, but only the key built
+ * on rank 0 is relevant.
+ *
+ * parameters:
+ *   m         <-- associated matrix
+ *   fill_type <-- fill type tuned for
+ *   key       --> associated key
+ *----------------------------------------------------------------------------*/
+
+static void
+_tuning_cache_key(const cs_matrix_t      *m,
+                  cs_matrix_fill_type_t   fill_type,
+                  char                    key[CS_MATRIX_TUNING_KEY_SIZE])
+{
+  cs_gnum_t n_g_rows = m->n_rows;
+  cs_parall_counter(&n_g_rows, 1);
+
+  char cpu_str[81];
+  cs_system_info_cpu(cpu_str, 81);
+
+  /* Tabs are used as field separators */
+
+  for (char *s = cpu_str; *s != '\0'; s++) {
+    if (*s == '\t')
+      *s = ' ';
+  }
+
+  snprintf(key, CS_MATRIX_TUNING_KEY_SIZE, "%s\t%s\t%d\t%llu\t%d\t%d\t%s",
+           cs_matrix_type_name[m->type],
+           cs_matrix_fill_type_name[fill_type],
+           (int)(m->db_size[0]),
+           (unsigned long long)n_g_rows,
+           cs_glob_n_ranks,
+           cs_glob_n_threads,
+           cpu_str);
+
+  key[CS_MATRIX_TUNING_KEY_SIZE - 1] = '\0';
+}
+
+/*----------------------------------------------------------------------------
+ * Look for a matching entry in the tuning cache file.
+ *
+ * The file is read on rank 0 only, and the result broadcast to other ranks.
+ * If multiple entries match, the last one is used.
+ *
+ * parameters:
+ *   path  <-- path to tuning cache file
+ *   key   <-- key identifying tuning run
+ *   names --> names of selected variants for each exclude diagonal flag
+ *
+ * returns:
+ *   true if a matching entry was found, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_tuning_cache_lookup(const char  *path,
+                     const char   key[CS_MATRIX_TUNING_KEY_SIZE],
+                     char         names[2][32])
+{
+  int found = 0;
+
+  names[0][0] = '\0';
+  names[1][0] = '\0';
+
+  if (cs_glob_rank_id < 1) {
+
+    FILE *f = fopen(path, "r");
+
+    if (f != NULL) {
+
+      char line[CS_MATRIX_TUNING_KEY_SIZE + 80];
+      const size_t key_len = strlen(key);
+
+      while (fgets(line, CS_MATRIX_TUNING_KEY_SIZE + 80, f) != NULL) {
+
+        if (strncmp(line, key, key_len) != 0 || line[key_len] != '\t')
+          continue;
+
+        char *s = line + key_len + 1;
+        char *n0 = s;
+        for ( ; *s != '\0' && *s != '\t'; s++);
+        if (*s != '\t')
+          continue;
+        *s++ = '\0';
+        char *n1 = s;
+        for ( ; *s != '\0' && *s != '\n' && *s != '\r'; s++);
+        *s = '\0';
+
+        strncpy(names[0], n0, 31);
+        names[0][31] = '\0';
+        strncpy(names[1], n1, 31);
+        names[1][31] = '\0';
+        found = 1;
+
+      }
+
+      fclose(f);
+
+    }
+
+  }
+
+  cs_parall_bcast(0, 1, CS_INT_TYPE, &found);
+
+  if (found)
+    cs_parall_bcast(0, 64, CS_CHAR, names);
+
+  return (found) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Apply cached variant selection to the first variant of a list.
+ *
+ * The selection is applied only if all named variants are available
+ * on all ranks.
+ *
+ * parameters:
+ *   names      <-- names of selected variants for each exclude diagonal flag
+ *   n_variants <-- number of variants
+ *   m_variant  <-> array of matrix variants
+ *
+ * returns:
+ *   true if the cached selection was applied, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_tuning_cache_apply(char                  names[2][32],
+                    int                   n_variants,
+                    cs_matrix_variant_t  *m_variant)
+{
+  int v_id[2] = {-1, -1};
+
+  for (int j = 0; j < 2; j++) {
+    for (int i = 0; i < n_variants && v_id[j] < 0; i++) {
+      if (   strcmp(m_variant[i].name[j], names[j]) == 0
+          && m_variant[i].vector_multiply[j] != NULL)
+        v_id[j] = i;
+    }
+  }
+
+  int valid = (v_id[0] > -1 && v_id[1] > -1) ? 1 : 0;
+  cs_parall_min(1, CS_INT_TYPE, &valid);
+
+  if (valid == 0)
+    return false;
+
+  for (int j = 0; j < 2; j++) {
+    const cs_matrix_variant_t *mv_s = m_variant + v_id[j];
+    strcpy(m_variant->name[j], mv_s->name[j]);
+    m_variant->vector_multiply[j] = mv_s->vector_multiply[j];
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Append tuning results to the tuning cache file.
+ *
+ * The file is written on rank 0 only. Failure to write is not fatal,
+ * as the cache is only an optimization.
+ *
+ * parameters:
+ *   path  <-- path to tuning cache file
+ *   key   <-- key identifying tuning run
+ *   mv    <-- selected variant
+ *----------------------------------------------------------------------------*/
+
+static void
+_tuning_cache_save(const char                 *path,
+                   const char                  key[CS_MATRIX_TUNING_KEY_SIZE],
+                   const cs_matrix_variant_t  *mv)
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  FILE *f = fopen(path, "a");
+
+  if (f == NULL) {
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\nUnable to open matrix tuning cache file \"%s\".\n"),
+                  path);
+    return;
+  }
+
+  fprintf(f, "%s\t%s\t%s\n", key, mv->name[0], mv->name[1]);
+
+  fclose(f);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -340,6 +569,37 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
 
   cs_matrix_variant_build_list(m, &n_variants, &m_variant);
 
+  const char *cache_path = _tuning_cache_path();
+  char cache_key[CS_MATRIX_TUNING_KEY_SIZE];
+
+  if (n_variants > 1 && cache_path != NULL) {
+
+    _tuning_cache_key(m, m->fill_type, cache_key);
+
+    char names[2][32];
+
+    if (   _cache_force == false
+        && _tuning_cache_lookup(cache_path, cache_key, names)
+        && _tuning_cache_apply(names, n_variants, m_variant)) {
+
+      if (verbosity > 0)
+        cs_log_printf(CS_LOG_PERFORMANCE,
+                      _("\n"
+                        "Cached SpMV variant for matrix of type %s "
+                        "and fill %s:\n"
+                        "  %32s for y <= A.x\n"
+                        "  %32s for y <= (A-D).x\n"),
+                      _(cs_matrix_type_name[m->type]),
+                      _(cs_matrix_fill_type_name[m->fill_type]),
+                      m_variant[0].name[0], m_variant[0].name[1]);
+
+      n_variants = 1;
+      BFT_REALLOC(m_variant, 1, cs_matrix_variant_t);
+
+    }
+
+  }
+
   if (n_variants > 1) {
 
     if (verbosity > 0)
@@ -368,6 +628,9 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
 
     BFT_FREE(spmv_cost);
 
+    if (cache_path != NULL)
+      _tuning_cache_save(cache_path, cache_key, m_variant);
+
     cs_log_printf(CS_LOG_PERFORMANCE, "\n");
     cs_log_separator(CS_LOG_PERFORMANCE);
 
@@ -379,6 +642,80 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
   return m_variant;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a file in which matrix tuning results are cached.
+ *
+ * When a matching entry (based on matrix type and fill type, diagonal
+ * block size, global number of rows, number of ranks and threads, and
+ * CPU model) is found in this file, the cached variant is used instead
+ * of running the tuning measures. Otherwise, tuning results are appended
+ * to this file.
+ *
+ * If no file is defined using this function, the file defined by the
+ * CS_MATRIX_TUNING_CACHE environment variable, if present, is used.
+ *
+ * \param[in]  path  path to tuning cache file, or NULL to unset
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuning_set_cache_file(const char  *path)
+{
+  BFT_FREE(_cache_path);
+
+  if (path != NULL) {
+    BFT_MALLOC(_cache_path, strlen(path) + 1, char);
+    strcpy(_cache_path, path);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the file in which matrix tuning results are cached.
+ *
+ * \return  path to tuning cache file, or NULL if caching is not active
+ */
+/*----------------------------------------------------------------------------*/
+
+const char *
+cs_matrix_tuning_get_cache_file(void)
+{
+  return _tuning_cache_path();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether tuning should be forced even when cached
+ *        results are available.
+ *
+ * Tuning results are still saved to the cache file, if defined.
+ *
+ * \param[in]  force  true to ignore cached results, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuning_set_force(bool  force)
+{
+  _cache_force = force;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether tuning is forced even when cached results are
+ *        available.
+ *
+ * \return  true if cached results are ignored, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_tuning_get_force(void)
+{
+  return _cache_force;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
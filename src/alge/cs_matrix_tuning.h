@@ -78,6 +78,63 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
                         int                 n_measure,
                         double              t_measure);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a file in which matrix tuning results are cached.
+ *
+ * When a matching entry (based on matrix type and fill type, diagonal
+ * block size, global number of rows, number of ranks and threads, and
+ * CPU model) is found in this file, the cached variant is used instead
+ * of running the tuning measures. Otherwise, tuning results are appended
+ * to this file.
+ *
+ * If no file is defined using this function, the file defined by the
+ * CS_MATRIX_TUNING_CACHE environment variable, if present, is used.
+ *
+ * \param[in]  path  path to tuning cache file, or NULL to unset
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuning_set_cache_file(const char  *path);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the file in which matrix tuning results are cached.
+ *
+ * \return  path to tuning cache file, or NULL if caching is not active
+ */
+/*----------------------------------------------------------------------------*/
+
+const char *
+cs_matrix_tuning_get_cache_file(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether tuning should be forced even when cached
+ *        results are available.
+ *
+ * Tuning results are still saved to the cache file, if defined.
+ *
+ * \param[in]  force  true to ignore cached results, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuning_set_force(bool  force);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether tuning is forced even when cached results are
+ *        available.
+ *
+ * \return  true if cached results are ignored, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_tuning_get_force(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
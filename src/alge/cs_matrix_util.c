@@ -1881,6 +1881,20 @@ _frobenius_norm(const cs_matrix_t  *m)
     }
     break;
 
+  case CS_MATRIX_SELL:
+    if (m->db_size[0]*m->db_size[0] == m->db_size[3]) {
+      /* Padding values are zero, so they may be included */
+      cs_lnum_t  d_stride = m->db_size[3];
+      const cs_matrix_struct_sell_t  *ms = m->structure;
+      const cs_matrix_coeff_msr_t  *mc = m->coeffs;
+      cs_lnum_t n_vals = ms->slice_index[ms->n_slices];
+      double d_mult = m->db_size[0];
+      retval = cs_dot_xx(d_stride*m->n_rows, mc->d_val);
+      retval += d_mult * cs_dot_xx(n_vals, mc->x_val);
+      cs_parall_sum(1, CS_DOUBLE, &retval);
+    }
+    break;
+
     default:
       retval = -1;
   }
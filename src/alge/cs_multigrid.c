@@ -136,6 +136,34 @@ typedef struct _cs_mg_sles_t {
 
 } cs_mg_sles_t;
 
+/* Direct solver context for the coarsest level: the coarsest grid matrix
+   is gathered on the first rank of the grid's communicator, which
+   handles the factorization and solution */
+/*---------------------------------------------------------------------*/
+
+typedef struct _cs_mg_coarse_direct_t {
+
+  cs_lnum_t      n_rows;             /* Number of local scalar rows */
+  cs_lnum_t      n_g_rows;           /* Number of gathered scalar rows
+                                        (0 on ranks other than root) */
+
+  cs_real_t     *lu;                 /* LU factors of gathered matrix,
+                                        row-major (root only) */
+  cs_lnum_t     *pivot;              /* Row permutation (root only) */
+  bool           null_last_pivot;    /* Singular matrix with last pivot
+                                        null (last unknown set to 0) */
+
+#if defined(HAVE_MPI)
+  MPI_Comm       comm;               /* Gather communicator, or
+                                        MPI_COMM_NULL if local */
+  int           *counts;             /* Per rank rows count (root only) */
+  int           *displs;             /* Per rank rows shift (root only) */
+  cs_real_t     *buf;                /* Gathered rhs/solution buffer
+                                        (root only) */
+#endif
+
+} cs_mg_coarse_direct_t;
+
 /* Basic per linear system options and logging */
 /*---------------------------------------------*/
 
@@ -244,6 +272,12 @@ typedef struct _cs_multigrid_setup_data_t {
   cs_real_t    **rhs_vx;                /* Coarse grid "right hand sides"
                                            and corrections */
 
+  int           *kc_skip;               /* Adaptive K-cycle: remaining
+                                           number of cycles for which
+                                           the Krylov acceleration of each
+                                           level's coarse correction is
+                                           skipped */
+
   /* Options used only when used as a preconditioner */
 
   char          *pc_name;               /* name of preconditioning system */
@@ -252,6 +286,12 @@ typedef struct _cs_multigrid_setup_data_t {
 
   cs_real_t     *pc_aux;                /* preconditioner auxiliary array */
 
+  /* Fine grid dimensions, used to check compatibility when the
+     hierarchy is kept for reuse (the fine grid being destroyed) */
+
+  cs_lnum_t      fine_n_rows;           /* Fine grid number of rows */
+  cs_lnum_t      fine_n_cols_ext;       /* Fine grid number of columns */
+  cs_lnum_t      fine_n_entries;        /* Fine grid number of entries */
 
 } cs_multigrid_setup_data_t;
 
@@ -278,6 +318,29 @@ struct _cs_multigrid_t {
 
   double     p0p1_relax;         /* p0/p1 relaxation_parameter */
   double     k_cycle_threshold;  /* threshold for k cycle */
+  int        k_cycle_probe_interval;  /* If > 0, adaptive K-cycle: number
+                                         of cycles between re-evaluations
+                                         of levels on which Krylov
+                                         acceleration is skipped */
+
+  int        sp_level_min;       /* Minimum grid level at which single
+                                    precision extra-diagonal coefficients
+                                    are used for matrix.vector products
+                                    (none if < 1) */
+
+  int        setup_reuse_max;    /* Maximum number of successive setups
+                                    reusing the grid hierarchy, with only
+                                    coarse coefficients updated (none if < 1) */
+  double     setup_reuse_ratio;  /* Force full rebuild of the hierarchy when
+                                    the number of cycles exceeds this ratio
+                                    of the number of cycles at the first
+                                    solve after the last full build
+                                    (ignored if <= 0) */
+
+  cs_gnum_t  coarse_direct_max;  /* Maximum global number of rows of the
+                                    coarsest grid for which it is gathered
+                                    and solved by a direct factorization
+                                    on a single rank (none if 0) */
 
   /* Setting for use as a preconditioner */
 
@@ -329,6 +392,14 @@ struct _cs_multigrid_t {
 
   cs_multigrid_setup_data_t  *setup_data;   /* setup data */
 
+  cs_multigrid_setup_data_t  *reuse_data;   /* grid hierarchy kept between
+                                               solve and next setup for
+                                               reuse, or NULL */
+  int        setup_reuse_count;  /* Number of setups since last full build */
+  unsigned   setup_ref_cycles;   /* Number of cycles at first solve after
+                                    last full build (0 if not known yet) */
+  bool       setup_rebuild;      /* Force full build at next setup */
+
   cs_time_plot_t             *cycle_plot;       /* plotting of cycles */
   int                         plot_time_stamp;  /* plotting time stamp;
                                                    if < 0, use wall clock */
@@ -353,6 +424,11 @@ static int _k_cycle_hpc_recurse_threshold = 256; /* under this size, coarsest
                                                     level solver does not
                                                     use k-cycle preconditioning */
 
+static double _k_cycle_adaptive_skip_ratio = 0.1; /* adaptive K-cycle: coarse
+                                                     residual reduction ratio
+                                                     under which Krylov
+                                                     acceleration is skipped */
+
 /*============================================================================
  * Private function prototypes for recursive
  *============================================================================*/
@@ -475,6 +551,32 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                 mg->n_levels_max, (unsigned long long)(mg->n_g_rows_min),
                 mg->p0p1_relax, mg->info.n_max_cycles);
 
+  if (mg->sp_level_min > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Single precision products from level: %d\n"),
+                  mg->sp_level_min);
+
+  if (mg->setup_reuse_max > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Grid hierarchy reuse:\n"
+                    "    Max successive reuses:           %d\n"
+                    "    Rebuild cycles ratio:            %g\n"),
+                  mg->setup_reuse_max, mg->setup_reuse_ratio);
+
+  if (   mg->k_cycle_probe_interval > 0
+      && mg->type >= CS_MULTIGRID_K_CYCLE
+      && mg->type <= CS_MULTIGRID_K_CYCLE_HPC)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Adaptive K-cycle:\n"
+                    "    Probe interval (cycles):         %d\n"),
+                  mg->k_cycle_probe_interval);
+
+  if (mg->coarse_direct_max > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarsest level direct solver:\n"
+                    "    Maximum number of rows:          %llu\n"),
+                  (unsigned long long)(mg->coarse_direct_max));
+
 #if defined(HAVE_MPI)
   if (cs_glob_n_ranks > 1)
     cs_log_printf(CS_LOG_SETUP,
@@ -802,14 +904,45 @@ _multigrid_setup_data_create(void)
 
   mgd->rhs_vx_buf = NULL;
   mgd->rhs_vx = NULL;
+  mgd->kc_skip = NULL;
 
   mgd->pc_name = NULL;
   mgd->pc_aux = NULL;
   mgd->pc_verbosity = 0;
 
+  mgd->fine_n_rows = 0;
+  mgd->fine_n_cols_ext = 0;
+  mgd->fine_n_entries = 0;
+
   return mgd;
 }
 
+/*----------------------------------------------------------------------------
+ * Destroy grid hierarchy kept for reuse, if present.
+ *
+ * parameters:
+ *   mg <-> multigrid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_reuse_data_free(cs_multigrid_t  *mg)
+{
+  cs_multigrid_setup_data_t *mgd = mg->reuse_data;
+
+  if (mgd == NULL)
+    return;
+
+  /* Solvers were already destroyed and finest grid is not kept */
+
+  for (int i = mgd->n_levels - 1; i > 0; i--)
+    cs_grid_destroy(mgd->grid_hierarchy + i);
+
+  BFT_FREE(mgd->grid_hierarchy);
+  BFT_FREE(mgd->sles_hierarchy);
+
+  BFT_FREE(mg->reuse_data);
+}
+
 /*----------------------------------------------------------------------------
  * Add grid to multigrid structure hierarchy.
  *
@@ -1661,6 +1794,10 @@ _multigrid_setup_sles_work_arrays(cs_multigrid_t  *mg,
       && mg->type <= CS_MULTIGRID_K_CYCLE_HPC) {
     n0 = 4;
     n1 = n0 + 6;
+
+    BFT_MALLOC(mgd->kc_skip, mgd->n_levels, int);
+    for (unsigned i = 0; i < mgd->n_levels; i++)
+      mgd->kc_skip[i] = 0;
   }
 
   BFT_MALLOC(mgd->rhs_vx, mgd->n_levels*n1, cs_real_t *);
@@ -1844,6 +1981,511 @@ _multigrid_setup_sles_k_cycle_bottom(cs_multigrid_t  *mg,
   cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------
+ * LU factorization with partial pivoting of a dense matrix.
+ *
+ * A null last pivot is accepted, the matrix then being assumed to be
+ * singular with a one-dimensional kernel (such as for pure Neumann
+ * problems), in which case the last unknown is set to 0 when solving.
+ * Other null pivots lead to failure.
+ *
+ * parameters:
+ *   n               <-- matrix dimension
+ *   a               <-> matrix (row-major) in, LU factors out
+ *   pivot           --> row permutation
+ *   null_last_pivot --> true if last pivot is null
+ *
+ * returns:
+ *   true if factorization succeeded, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_dense_lu_factor(cs_lnum_t   n,
+                 cs_real_t   a[],
+                 cs_lnum_t   pivot[],
+                 bool       *null_last_pivot)
+{
+  cs_real_t a_max = 0.;
+
+  for (size_t ij = 0; ij < (size_t)n*(size_t)n; ij++)
+    a_max = CS_MAX(a_max, CS_ABS(a[ij]));
+
+  const cs_real_t null_pivot = EPZERO * a_max;
+
+  *null_last_pivot = false;
+
+  for (cs_lnum_t k = 0; k < n; k++) {
+
+    cs_real_t *restrict a_k = a + (size_t)k*n;
+
+    /* Partial pivoting */
+
+    cs_lnum_t p_id = k;
+    cs_real_t p_max = CS_ABS(a_k[k]);
+
+    for (cs_lnum_t i = k+1; i < n; i++) {
+      cs_real_t a_ik = CS_ABS(a[(size_t)i*n + k]);
+      if (a_ik > p_max) {
+        p_id = i;
+        p_max = a_ik;
+      }
+    }
+
+    pivot[k] = p_id;
+
+    if (p_max <= null_pivot) {
+      if (k < n-1)
+        return false;
+      *null_last_pivot = true;
+      break;
+    }
+
+    if (p_id != k) {
+      cs_real_t *restrict a_p = a + (size_t)p_id*n;
+      for (cs_lnum_t j = 0; j < n; j++) {
+        cs_real_t t = a_k[j];
+        a_k[j] = a_p[j];
+        a_p[j] = t;
+      }
+    }
+
+    /* Elimination */
+
+    const cs_real_t d_inv = 1. / a_k[k];
+
+#   pragma omp parallel for if(n - k > CS_THR_MIN)
+    for (cs_lnum_t i = k+1; i < n; i++) {
+      cs_real_t *restrict a_i = a + (size_t)i*n;
+      const cs_real_t l_ik = a_i[k] * d_inv;
+      a_i[k] = l_ik;
+      if (l_ik < 0 || l_ik > 0) {
+        for (cs_lnum_t j = k+1; j < n; j++)
+          a_i[j] -= l_ik*a_k[j];
+      }
+    }
+
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Solve a linear system using an LU factorization from _dense_lu_factor.
+ *
+ * parameters:
+ *   n               <-- matrix dimension
+ *   lu              <-- LU factors (row-major)
+ *   pivot           <-- row permutation
+ *   null_last_pivot <-- true if last pivot is null
+ *   x               <-> right hand side in, solution out
+ *----------------------------------------------------------------------------*/
+
+static void
+_dense_lu_solve(cs_lnum_t         n,
+                const cs_real_t   lu[],
+                const cs_lnum_t   pivot[],
+                bool              null_last_pivot,
+                cs_real_t         x[])
+{
+  /* Permutation */
+
+  for (cs_lnum_t k = 0; k < n; k++) {
+    cs_lnum_t p_id = pivot[k];
+    if (p_id != k) {
+      cs_real_t t = x[k];
+      x[k] = x[p_id];
+      x[p_id] = t;
+    }
+  }
+
+  /* Forward substitution (unit lower triangular factor) */
+
+  for (cs_lnum_t i = 1; i < n; i++) {
+    const cs_real_t *restrict lu_i = lu + (size_t)i*n;
+    cs_real_t s = x[i];
+    for (cs_lnum_t j = 0; j < i; j++)
+      s -= lu_i[j]*x[j];
+    x[i] = s;
+  }
+
+  /* Backward substitution */
+
+  for (cs_lnum_t i = n-1; i > -1; i--) {
+    const cs_real_t *restrict lu_i = lu + (size_t)i*n;
+    if (i == n-1 && null_last_pivot) {
+      x[i] = 0.;
+      continue;
+    }
+    cs_real_t s = x[i];
+    for (cs_lnum_t j = i+1; j < n; j++)
+      s -= lu_i[j]*x[j];
+    x[i] = s / lu_i[i];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy coarsest level direct solver context.
+ *
+ * parameters:
+ *   context <-> pointer to direct solver context
+ *               (actual type: cs_mg_coarse_direct_t  **)
+ *----------------------------------------------------------------------------*/
+
+static void
+_coarse_direct_destroy(void  **context)
+{
+  cs_mg_coarse_direct_t *cd = *context;
+
+  if (cd != NULL) {
+    BFT_FREE(cd->lu);
+    BFT_FREE(cd->pivot);
+#if defined(HAVE_MPI)
+    BFT_FREE(cd->counts);
+    BFT_FREE(cd->displs);
+    BFT_FREE(cd->buf);
+#endif
+    BFT_FREE(cd);
+    *context = NULL;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Create and setup direct solver for the coarsest grid, if possible.
+ *
+ * The coarsest grid matrix is gathered on the first rank of the grid's
+ * communicator, which computes its factorization; other ranks of that
+ * communicator only take part in gathering the right-hand side and
+ * scattering the solution, and ranks on which the grid is empty (due to
+ * grid merging) are not involved in the solution at all.
+ *
+ * This function must be called by all ranks of the caller communicator.
+ *
+ * parameters:
+ *   mg        <-- pointer to multigrid solver info and context
+ *   g         <-- coarsest grid
+ *   name      <-- coarse system name
+ *   verbosity <-- associated verbosity
+ *
+ * returns:
+ *   pointer to direct solver context, or NULL if not usable
+ *----------------------------------------------------------------------------*/
+
+static cs_mg_coarse_direct_t *
+_coarse_direct_create(const cs_multigrid_t  *mg,
+                      const cs_grid_t       *g,
+                      const char            *name,
+                      int                    verbosity)
+{
+  const cs_matrix_t *m = cs_grid_get_matrix(g);
+  const cs_halo_t *halo = cs_matrix_get_halo(m);
+  const cs_lnum_t *db_size = cs_matrix_get_diag_block_size(m);
+  const cs_lnum_t b_size = db_size[0];
+  const cs_lnum_t n_rows = cs_grid_get_n_rows(g);
+
+  int n_ranks = 1, rank_id = 0;
+
+#if defined(HAVE_MPI)
+  MPI_Comm comm = cs_grid_get_comm(g);
+  if (comm != MPI_COMM_NULL) {
+    MPI_Comm_size(comm, &n_ranks);
+    MPI_Comm_rank(comm, &rank_id);
+  }
+  if (n_ranks < 2)
+    comm = MPI_COMM_NULL;
+#endif
+
+  /* Check if usable (ranks with an empty grid do not know their
+     global size, and so do not check it) */
+
+  int usable = 1;
+
+  cs_matrix_type_t m_type = cs_matrix_get_type(m);
+
+  if (m_type != CS_MATRIX_MSR && (m_type != CS_MATRIX_CSR || b_size > 1))
+    usable = 0;
+  if (halo != NULL && b_size > 1) {
+    if (halo->n_transforms > 0)
+      usable = 0;
+  }
+  if (n_rows > 0 || n_ranks > 1) {
+    if (cs_grid_get_n_g_rows(g) > mg->coarse_direct_max)
+      usable = 0;
+  }
+
+#if defined(HAVE_MPI)
+  if (mg->caller_n_ranks > 1) {
+    int _usable = usable;
+    MPI_Allreduce(&_usable, &usable, 1, MPI_INT, MPI_MIN, mg->caller_comm);
+  }
+#endif
+
+  if (usable == 0)
+    return NULL;
+
+  cs_mg_coarse_direct_t *cd;
+  BFT_MALLOC(cd, 1, cs_mg_coarse_direct_t);
+
+  cd->n_rows = n_rows*b_size;
+  cd->n_g_rows = 0;
+  cd->lu = NULL;
+  cd->pivot = NULL;
+  cd->null_last_pivot = false;
+
+#if defined(HAVE_MPI)
+  cd->comm = comm;
+  cd->counts = NULL;
+  cd->displs = NULL;
+  cd->buf = NULL;
+#endif
+
+  /* Global scalar column ids */
+
+  const cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(m);
+
+  cs_gnum_t g_shift = 0;
+
+#if defined(HAVE_MPI)
+  if (comm != MPI_COMM_NULL) {
+    cs_gnum_t l_shift = cd->n_rows;
+    MPI_Scan(&l_shift, &g_shift, 1, CS_MPI_GNUM, MPI_SUM, comm);
+    g_shift -= l_shift;
+  }
+#endif
+
+  cs_gnum_t *g_col_id;
+  BFT_MALLOC(g_col_id, n_cols_ext, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    g_col_id[i] = g_shift + (cs_gnum_t)(i*b_size);
+
+  if (halo != NULL)
+    cs_halo_sync_untyped(halo, CS_HALO_STANDARD, sizeof(cs_gnum_t), g_col_id);
+
+  /* Extract local rows */
+
+  int *row_size;
+  BFT_MALLOC(row_size, cd->n_rows, int);
+
+  cs_matrix_row_info_t r;
+  cs_matrix_row_init(&r);
+
+  cs_lnum_t n_entries = 0;
+  for (cs_lnum_t i = 0; i < cd->n_rows; i++) {
+    cs_matrix_get_row(m, i, &r);
+    row_size[i] = r.row_size;
+    n_entries += r.row_size;
+  }
+
+  cs_gnum_t *e_col_id;
+  cs_real_t *e_val;
+  BFT_MALLOC(e_col_id, n_entries, cs_gnum_t);
+  BFT_MALLOC(e_val, n_entries, cs_real_t);
+
+  n_entries = 0;
+  for (cs_lnum_t i = 0; i < cd->n_rows; i++) {
+    cs_matrix_get_row(m, i, &r);
+    for (cs_lnum_t j = 0; j < r.row_size; j++) {
+      cs_lnum_t c_id = r.col_id[j];
+      e_col_id[n_entries] = g_col_id[c_id/b_size] + (cs_gnum_t)(c_id%b_size);
+      e_val[n_entries] = r.vals[j];
+      n_entries++;
+    }
+  }
+
+  cs_matrix_row_finalize(&r);
+  BFT_FREE(g_col_id);
+
+  /* Gather rows on root rank */
+
+  int *g_row_size = row_size;
+  cs_gnum_t *g_e_col_id = e_col_id;
+  cs_real_t *g_e_val = e_val;
+
+  if (n_ranks < 2)
+    cd->n_g_rows = cd->n_rows;
+
+#if defined(HAVE_MPI)
+
+  if (comm != MPI_COMM_NULL) {
+
+    int l_counts[2] = {cd->n_rows, n_entries};
+    int *g_counts = NULL, *e_counts = NULL, *e_displs = NULL;
+    cs_lnum_t n_g_entries = 0;
+
+    if (rank_id == 0) {
+      BFT_MALLOC(g_counts, n_ranks*2, int);
+      BFT_MALLOC(cd->counts, n_ranks, int);
+      BFT_MALLOC(cd->displs, n_ranks, int);
+      BFT_MALLOC(e_counts, n_ranks, int);
+      BFT_MALLOC(e_displs, n_ranks, int);
+    }
+
+    MPI_Gather(l_counts, 2, MPI_INT, g_counts, 2, MPI_INT, 0, comm);
+
+    if (rank_id == 0) {
+      for (int i = 0; i < n_ranks; i++) {
+        cd->counts[i] = g_counts[i*2];
+        cd->displs[i] = cd->n_g_rows;
+        e_counts[i] = g_counts[i*2 + 1];
+        e_displs[i] = n_g_entries;
+        cd->n_g_rows += g_counts[i*2];
+        n_g_entries += g_counts[i*2 + 1];
+      }
+      BFT_FREE(g_counts);
+      BFT_MALLOC(g_row_size, cd->n_g_rows, int);
+      BFT_MALLOC(g_e_col_id, n_g_entries, cs_gnum_t);
+      BFT_MALLOC(g_e_val, n_g_entries, cs_real_t);
+      BFT_MALLOC(cd->buf, cd->n_g_rows, cs_real_t);
+    }
+
+    MPI_Gatherv(row_size, cd->n_rows, MPI_INT,
+                g_row_size, cd->counts, cd->displs, MPI_INT, 0, comm);
+    MPI_Gatherv(e_col_id, n_entries, CS_MPI_GNUM,
+                g_e_col_id, e_counts, e_displs, CS_MPI_GNUM, 0, comm);
+    MPI_Gatherv(e_val, n_entries, CS_MPI_REAL,
+                g_e_val, e_counts, e_displs, CS_MPI_REAL, 0, comm);
+
+    BFT_FREE(e_counts);
+    BFT_FREE(e_displs);
+
+    BFT_FREE(row_size);
+    BFT_FREE(e_col_id);
+    BFT_FREE(e_val);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Assemble and factorize on root rank */
+
+  int retval = 1;
+
+  if (rank_id == 0) {
+
+    const cs_lnum_t n = cd->n_g_rows;
+
+    BFT_MALLOC(cd->lu, (size_t)n*(size_t)n, cs_real_t);
+    BFT_MALLOC(cd->pivot, n, cs_lnum_t);
+
+    for (size_t ij = 0; ij < (size_t)n*(size_t)n; ij++)
+      cd->lu[ij] = 0.;
+
+    cs_lnum_t e_id = 0;
+    for (cs_lnum_t i = 0; i < n; i++) {
+      cs_real_t *restrict lu_i = cd->lu + (size_t)i*n;
+      for (int j = 0; j < g_row_size[i]; j++) {
+        lu_i[g_e_col_id[e_id]] += g_e_val[e_id];
+        e_id++;
+      }
+    }
+
+    if (_dense_lu_factor(n, cd->lu, cd->pivot, &(cd->null_last_pivot))
+        == false)
+      retval = 0;
+
+  }
+
+  BFT_FREE(g_row_size);
+  BFT_FREE(g_e_col_id);
+  BFT_FREE(g_e_val);
+
+#if defined(HAVE_MPI)
+  if (mg->caller_n_ranks > 1) {
+    int _retval = retval;
+    MPI_Allreduce(&_retval, &retval, 1, MPI_INT, MPI_MIN, mg->caller_comm);
+  }
+#endif
+
+  if (retval == 0) {
+    if (verbosity > 0)
+      bft_printf(_("\n  %s: null pivot in direct factorization;\n"
+                   "  using iterative coarse solver.\n"), name);
+    _coarse_direct_destroy((void **)&cd);
+  }
+  else if (verbosity > 1)
+    bft_printf(_("\n  %s: direct factorization of %ld rows"
+                 " gathered from %d ranks\n"),
+               name, (long)(cd->n_g_rows), n_ranks);
+
+  return cd;
+}
+
+/*----------------------------------------------------------------------------
+ * Solve coarsest level system using direct solver.
+ *
+ * Only ranks of the coarsest grid's communicator are synchronized
+ * (to gather the right-hand side and scatter the solution), so other ranks
+ * return immediately.
+ *
+ * parameters:
+ *   context       <-> pointer to direct solver context
+ *                     (actual type: cs_mg_coarse_direct_t  *)
+ *   name          <-- pointer to system name
+ *   a             <-- matrix
+ *   verbosity     <-- associated verbosity
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   precision     <-- solver precision
+ *   r_norm        <-- residue normalization
+ *   n_iter        --> number of "equivalent" iterations
+ *   residue       --> residue
+ *   rhs           <-- right hand side
+ *   vx            --> system solution
+ *   aux_size      <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors   --- optional working area
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_coarse_direct_solve(void                *context,
+                     const char          *name,
+                     const cs_matrix_t   *a,
+                     int                  verbosity,
+                     cs_halo_rotation_t   rotation_mode,
+                     double               precision,
+                     double               r_norm,
+                     int                 *n_iter,
+                     double              *residue,
+                     const cs_real_t     *rhs,
+                     cs_real_t           *vx,
+                     size_t               aux_size,
+                     void                *aux_vectors)
+{
+  CS_UNUSED(name);
+  CS_UNUSED(a);
+  CS_UNUSED(verbosity);
+  CS_UNUSED(rotation_mode);
+  CS_UNUSED(precision);
+  CS_UNUSED(r_norm);
+  CS_UNUSED(aux_size);
+  CS_UNUSED(aux_vectors);
+
+  cs_mg_coarse_direct_t *cd = context;
+
+#if defined(HAVE_MPI)
+  if (cd->comm != MPI_COMM_NULL) {
+    MPI_Gatherv(rhs, cd->n_rows, CS_MPI_REAL,
+                cd->buf, cd->counts, cd->displs, CS_MPI_REAL, 0, cd->comm);
+    if (cd->lu != NULL)
+      _dense_lu_solve(cd->n_g_rows, cd->lu, cd->pivot, cd->null_last_pivot,
+                      cd->buf);
+    MPI_Scatterv(cd->buf, cd->counts, cd->displs, CS_MPI_REAL,
+                 vx, cd->n_rows, CS_MPI_REAL, 0, cd->comm);
+  }
+  else
+#endif
+  if (cd->n_g_rows > 0) {
+    memcpy(vx, rhs, cd->n_rows*sizeof(cs_real_t));
+    _dense_lu_solve(cd->n_g_rows, cd->lu, cd->pivot, cd->null_last_pivot, vx);
+  }
+
+  *n_iter = 1;
+  *residue = 0.;
+
+  return CS_SLES_CONVERGED;
+}
+
 /*----------------------------------------------------------------------------
  * Setup multigrid sparse linear equation solvers on existing hierarchy.
  *
@@ -1979,34 +2621,52 @@ _multigrid_setup_sles(cs_multigrid_t  *mg,
 
     mg_lv_info = mg->lv_info + i;
 
+    snprintf(_name, l-1, "%s:coarse:%d", name, i);
+    _name[l-1] = '\0';
+
     cs_mg_sles_t  *mg_sles = &(mgd->sles_hierarchy[i*2]);
-    mg_sles->context
-      = cs_sles_it_create(mg->info.type[2],
-                          mg->info.poly_degree[2],
-                          mg->info.n_max_iter[2],
-                          false); /* stats not updated here */
-    mg_sles->setup_func = cs_sles_it_setup;
-    mg_sles->solve_func = cs_sles_it_solve;
-    mg_sles->destroy_func = cs_sles_it_destroy;
 
-    if (mg->lv_mg[2] != NULL) {
-      cs_sles_pc_t *pc = _pc_create_from_mg_sub(mg->lv_mg[2]);
-      cs_sles_it_transfer_pc(mg_sles->context, &pc);
+    /* Use direct solver if possible (setup done here) */
+
+    if (mg->coarse_direct_max > 0 && mg->subtype == CS_MULTIGRID_MAIN) {
+      mg_sles->context = _coarse_direct_create(mg, g, _name, verbosity - 2);
+      if (mg_sles->context != NULL) {
+        mg_sles->setup_func = NULL;
+        mg_sles->solve_func = _coarse_direct_solve;
+        mg_sles->destroy_func = _coarse_direct_destroy;
+      }
     }
 
+    /* Otherwise, use iterative solver */
+
+    if (mg_sles->context == NULL) {
+
+      mg_sles->context
+        = cs_sles_it_create(mg->info.type[2],
+                            mg->info.poly_degree[2],
+                            mg->info.n_max_iter[2],
+                            false); /* stats not updated here */
+      mg_sles->setup_func = cs_sles_it_setup;
+      mg_sles->solve_func = cs_sles_it_solve;
+      mg_sles->destroy_func = cs_sles_it_destroy;
+
+      if (mg->lv_mg[2] != NULL) {
+        cs_sles_pc_t *pc = _pc_create_from_mg_sub(mg->lv_mg[2]);
+        cs_sles_it_transfer_pc(mg_sles->context, &pc);
+      }
+
 #if defined(HAVE_MPI)
-    {
-      cs_sles_it_t  *context = mg_sles->context;
-      cs_sles_it_set_mpi_reduce_comm(context,
-                                     cs_grid_get_comm(mgd->grid_hierarchy[i]),
-                                     mg->comm);
-    }
+      {
+        cs_sles_it_t  *context = mg_sles->context;
+        cs_sles_it_set_mpi_reduce_comm(context,
+                                       cs_grid_get_comm(mgd->grid_hierarchy[i]),
+                                       mg->comm);
+      }
 #endif
 
-    snprintf(_name, l-1, "%s:coarse:%d", name, i);
-    _name[l-1] = '\0';
+      mg_sles->setup_func(mg_sles->context, _name, m, verbosity - 2);
 
-    mg_sles->setup_func(mg_sles->context, _name, m, verbosity - 2);
+    }
 
     /* Diagonal block size is the same for all levels */
 
@@ -2064,6 +2724,10 @@ _setup_hierarchy(void             *context,
 
   mg->setup_data = _multigrid_setup_data_create();
 
+  mg->setup_reuse_count = 0;
+  mg->setup_ref_cycles = 0;
+  mg->setup_rebuild = false;
+
   _multigrid_add_level(mg, f); /* Assign to hierarchy */
 
   /* Add info */
@@ -2150,6 +2814,12 @@ _setup_hierarchy(void             *context,
 
     if (add_grid) {
 
+      /* Coarse levels are bandwidth-bound, so optionally reduce
+         coefficient precision for matrix.vector products */
+
+      if (mg->sp_level_min > 0 && grid_lv >= mg->sp_level_min)
+        cs_grid_set_matrix_single_precision(g);
+
       _multigrid_add_level(mg, g); /* Assign to hierarchy */
 
       /* Print coarse mesh stats */
@@ -2243,84 +2913,226 @@ _setup_hierarchy(void             *context,
     }
   }
 
-  /* Update info */
+  /* Update info */
+
+#if defined(HAVE_MPI)
+
+  /* In parallel, get global (average) values from local values */
+
+  if (mg->caller_n_ranks > 1) {
+
+    int i, j;
+    cs_gnum_t *_n_elts_l = NULL, *_n_elts_s = NULL, *_n_elts_m = NULL;
+    int grid_lv = mg->setup_data->n_levels;
+
+    BFT_MALLOC(_n_elts_l, 3*grid_lv, cs_gnum_t);
+    BFT_MALLOC(_n_elts_s, 3*grid_lv, cs_gnum_t);
+    BFT_MALLOC(_n_elts_m, 3*grid_lv, cs_gnum_t);
+
+    for (i = 0; i < grid_lv; i++) {
+      cs_multigrid_level_info_t *mg_inf = mg->lv_info + i;
+      for (j = 0; j < 3; j++)
+        _n_elts_l[i*3 + j] = mg_inf->n_elts[j][0];
+    }
+
+    MPI_Allreduce(_n_elts_l, _n_elts_s, 3*grid_lv, CS_MPI_GNUM, MPI_SUM,
+                  mg->caller_comm);
+    MPI_Allreduce(_n_elts_l, _n_elts_m, 3*grid_lv, CS_MPI_GNUM, MPI_MAX,
+                  mg->caller_comm);
+
+    for (i = 0; i < grid_lv; i++) {
+      cs_multigrid_level_info_t *mg_inf = mg->lv_info + i;
+      cs_gnum_t n_g_ranks = mg_inf->n_ranks[0];
+      for (j = 0; j < 3; j++) {
+        cs_gnum_t tmp_max = n_g_ranks * _n_elts_m[i*3+j];
+        mg_inf->n_elts[j][0] = (_n_elts_s[i*3+j] + n_g_ranks/2) / n_g_ranks;
+        mg_inf->imbalance[j][0] = (float)(tmp_max*1.0/_n_elts_s[i*3+j]);
+      }
+    }
+
+    BFT_FREE(_n_elts_m);
+    BFT_FREE(_n_elts_s);
+    BFT_FREE(_n_elts_l);
+
+  }
+
+#endif
+
+  mg->info.n_levels_tot += mg->setup_data->n_levels;
+
+  mg->info.n_levels[0] = mg->setup_data->n_levels;
+
+  if (mg->info.n_calls[0] > 0) {
+    if (mg->info.n_levels[0] < mg->info.n_levels[1])
+      mg->info.n_levels[1] = mg->info.n_levels[0];
+    if (mg->info.n_levels[0] > mg->info.n_levels[2])
+      mg->info.n_levels[2] = mg->info.n_levels[0];
+  }
+  else {
+    mg->info.n_levels[1] = mg->info.n_levels[0];
+    mg->info.n_levels[2] = mg->info.n_levels[0];
+  }
+
+  mg->info.n_calls[0] += 1;
+
+  /* Cleanup temporary interpolation arrays; those of coarse grids
+     are kept when needed to update the hierarchy at a later setup */
+
+  for (unsigned i = 0; i < mg->setup_data->n_levels; i++) {
+    if (i == 0 || mg->setup_reuse_max < 1)
+      cs_grid_free_quantities(mg->setup_data->grid_hierarchy[i]);
+  }
+
+  /* Setup solvers */
+
+  if (mg->subtype == CS_MULTIGRID_BOTTOM)
+    _multigrid_setup_sles_k_cycle_bottom(mg, name, verbosity);
+  else
+    _multigrid_setup_sles(mg, name, verbosity);
+
+  /* Update timers */
+
+  t2 = cs_timer_time();
+  cs_timer_counter_add_diff(&(mg->info.t_tot[0]), &t0, &t2);
+}
+
+/*----------------------------------------------------------------------------
+ * Setup multigrid sparse linear equation solver by reusing the grid
+ * hierarchy kept from a previous setup.
+ *
+ * Coarse grid aggregation, halos, and matrix structures are kept, and only
+ * coarse matrix coefficients are updated from the new fine grid.
+ * If this is not possible on all ranks, the kept hierarchy is destroyed,
+ * so the caller should do a full setup.
+ *
+ * parameters:
+ *   mg        <-> pointer to multigrid solver info and context
+ *   name      <-- linear system name
+ *   f         <-- associated fine grid
+ *   verbosity <-- associated verbosity
+ *
+ * returns:
+ *   true if the hierarchy was reused, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_setup_hierarchy_reuse(cs_multigrid_t  *mg,
+                       const char      *name,
+                       cs_grid_t       *f,
+                       int              verbosity)
+{
+  cs_multigrid_setup_data_t *mgd = mg->reuse_data;
+
+  if (mgd == NULL)
+    return false;
+
+  cs_timer_t t0 = cs_timer_time();
+
+  cs_lnum_t n_rows = 0, n_cols_ext = 0, n_entries = 0;
+
+  cs_grid_get_info(f,
+                   NULL,
+                   NULL,
+                   NULL,
+                   NULL,
+                   NULL,
+                   &n_rows,
+                   &n_cols_ext,
+                   &n_entries,
+                   NULL);
+
+  int reuse = 1;
 
-#if defined(HAVE_MPI)
+  if (   mg->setup_rebuild
+      || mg->setup_reuse_count >= mg->setup_reuse_max
+      || n_rows != mgd->fine_n_rows
+      || n_cols_ext != mgd->fine_n_cols_ext
+      || n_entries != mgd->fine_n_entries)
+    reuse = 0;
 
-  /* In parallel, get global (average) values from local values */
+  mgd->grid_hierarchy[0] = f;
+
+  /* Check all levels before updating, as updates may require
+     halo exchanges */
+
+  for (unsigned i = 1; i < mgd->n_levels && reuse; i++) {
+    if (cs_grid_is_coarse_updatable(mgd->grid_hierarchy[i-1],
+                                    mgd->grid_hierarchy[i]) == false)
+      reuse = 0;
+  }
 
+#if defined(HAVE_MPI)
   if (mg->caller_n_ranks > 1) {
+    int _reuse = reuse;
+    MPI_Allreduce(&_reuse, &reuse, 1, MPI_INT, MPI_MIN, mg->caller_comm);
+  }
+#endif
 
-    int i, j;
-    cs_gnum_t *_n_elts_l = NULL, *_n_elts_s = NULL, *_n_elts_m = NULL;
-    int grid_lv = mg->setup_data->n_levels;
+  /* Update coarse grids from finest to coarsest */
 
-    BFT_MALLOC(_n_elts_l, 3*grid_lv, cs_gnum_t);
-    BFT_MALLOC(_n_elts_s, 3*grid_lv, cs_gnum_t);
-    BFT_MALLOC(_n_elts_m, 3*grid_lv, cs_gnum_t);
+  if (reuse) {
 
-    for (i = 0; i < grid_lv; i++) {
-      cs_multigrid_level_info_t *mg_inf = mg->lv_info + i;
-      for (j = 0; j < 3; j++)
-        _n_elts_l[i*3 + j] = mg_inf->n_elts[j][0];
+    for (unsigned i = 1; i < mgd->n_levels; i++) {
+      if (cs_grid_update_coarse_quantities(mgd->grid_hierarchy[i-1],
+                                           mgd->grid_hierarchy[i],
+                                           verbosity) == false)
+        reuse = 0;
     }
 
-    MPI_Allreduce(_n_elts_l, _n_elts_s, 3*grid_lv, CS_MPI_GNUM, MPI_SUM,
-                  mg->caller_comm);
-    MPI_Allreduce(_n_elts_l, _n_elts_m, 3*grid_lv, CS_MPI_GNUM, MPI_MAX,
-                  mg->caller_comm);
-
-    for (i = 0; i < grid_lv; i++) {
-      cs_multigrid_level_info_t *mg_inf = mg->lv_info + i;
-      cs_gnum_t n_g_ranks = mg_inf->n_ranks[0];
-      for (j = 0; j < 3; j++) {
-        cs_gnum_t tmp_max = n_g_ranks * _n_elts_m[i*3+j];
-        mg_inf->n_elts[j][0] = (_n_elts_s[i*3+j] + n_g_ranks/2) / n_g_ranks;
-        mg_inf->imbalance[j][0] = (float)(tmp_max*1.0/_n_elts_s[i*3+j]);
-      }
+#if defined(HAVE_MPI)
+    if (mg->caller_n_ranks > 1) {
+      int _reuse = reuse;
+      MPI_Allreduce(&_reuse, &reuse, 1, MPI_INT, MPI_MIN, mg->caller_comm);
     }
+#endif
 
-    BFT_FREE(_n_elts_m);
-    BFT_FREE(_n_elts_s);
-    BFT_FREE(_n_elts_l);
+  }
 
+  if (reuse == 0) {
+    mgd->grid_hierarchy[0] = NULL; /* fine grid is kept by caller */
+    _multigrid_reuse_data_free(mg);
+    if (verbosity > 1)
+      bft_printf(_("   grid hierarchy not reusable, rebuilding\n"));
+    return false;
   }
 
-#endif
+  mg->setup_data = mgd;
+  mg->reuse_data = NULL;
 
-  mg->info.n_levels_tot += mg->setup_data->n_levels;
+  mg->setup_reuse_count += 1;
 
-  mg->info.n_levels[0] = mg->setup_data->n_levels;
+  /* Coefficient updates discard single precision copies */
 
-  if (mg->info.n_calls[0] > 0) {
-    if (mg->info.n_levels[0] < mg->info.n_levels[1])
-      mg->info.n_levels[1] = mg->info.n_levels[0];
-    if (mg->info.n_levels[0] > mg->info.n_levels[2])
-      mg->info.n_levels[2] = mg->info.n_levels[0];
-  }
-  else {
-    mg->info.n_levels[1] = mg->info.n_levels[0];
-    mg->info.n_levels[2] = mg->info.n_levels[0];
+  if (mg->sp_level_min > 0) {
+    for (unsigned i = mg->sp_level_min; i < mgd->n_levels; i++)
+      cs_grid_set_matrix_single_precision(mgd->grid_hierarchy[i]);
   }
 
-  mg->info.n_calls[0] += 1;
+  if (verbosity > 1)
+    bft_printf
+      (_("   reusing grid hierarchy (%d/%d since last build)\n"
+         "   number of grid levels:           %u\n\n"),
+       mg->setup_reuse_count, mg->setup_reuse_max, mgd->n_levels);
+
+  /* Update info */
 
-  /* Cleanup temporary interpolation arrays */
+  mg->info.n_levels_tot += mgd->n_levels;
+  mg->info.n_levels[0] = mgd->n_levels;
+  mg->info.n_calls[0] += 1;
 
-  for (unsigned i = 0; i < mg->setup_data->n_levels; i++)
-    cs_grid_free_quantities(mg->setup_data->grid_hierarchy[i]);
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(mg->lv_info->t_tot[0]), &t0, &t1);
 
   /* Setup solvers */
 
-  if (mg->subtype == CS_MULTIGRID_BOTTOM)
-    _multigrid_setup_sles_k_cycle_bottom(mg, name, verbosity);
-  else
-    _multigrid_setup_sles(mg, name, verbosity);
+  _multigrid_setup_sles(mg, name, verbosity);
 
   /* Update timers */
 
-  t2 = cs_timer_time();
-  cs_timer_counter_add_diff(&(mg->info.t_tot[0]), &t0, &t2);
+  t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(mg->info.t_tot[0]), &t0, &t1);
+
+  return true;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2487,6 +3299,45 @@ _dot_xy_yz(const cs_multigrid_t  *mg,
   *s2 = s[1];
 }
 
+/*----------------------------------------------------------------------------
+ * Compute 5 dot products x.x, y.y, x.y, x.z, and y.z, summing result
+ * over all ranks in a single reduction.
+ *
+ * parameters:
+ *   mg <-- pointer to solver context info
+ *   n  <-- number of associated values
+ *   x  <-- first vector
+ *   y  <-- second vector
+ *   z  <-- third vector
+ *   s  --> results: x.x, y.y, x.y, x.z, y.z
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_dot_xx_yy_xy_xz_yz(const cs_multigrid_t  *mg,
+                    cs_lnum_t              n,
+                    const cs_real_t       *x,
+                    const cs_real_t       *y,
+                    const cs_real_t       *z,
+                    double                 s[5])
+{
+  cs_dot_xx_yy_xy_xz_yz(n, x, y, z, s, s+1, s+2, s+3, s+4);
+
+#if defined(HAVE_MPI)
+
+  if (mg->comm != MPI_COMM_NULL) {
+    double _sum[5];
+    MPI_Allreduce(s, _sum, 5, MPI_DOUBLE, MPI_SUM, mg->comm);
+    for (int i = 0; i < 5; i++)
+      s[i] = _sum[i];
+  }
+
+#else
+
+  CS_UNUSED(mg);
+
+#endif /* defined(HAVE_MPI) */
+}
+
 /*----------------------------------------------------------------------------
  * Compute 3 dot products x.u, xv, and x.w, summing result over all ranks.
  *
@@ -3506,103 +4357,147 @@ _multigrid_k_cycle(cs_multigrid_t       *mg,
 
     t1 = cs_timer_time();
 
-    /* Arrays needed for the first Krylov iteration inside the cycle */
-    cs_real_t *restrict v_lv1 = mgd->rhs_vx[(level+1)*na + 6];
-    cs_real_t *restrict rt_lv1 = mgd->rhs_vx[(level+1)*na + 7];
+    /* Adaptive mode: on levels where the coarse correction was found to
+       need no Krylov acceleration, use it as is (as in a V-cycle), saving
+       a matrix-vector product and global reductions, until the next probe. */
 
-    cs_matrix_vector_multiply(rotation_mode,
-                              c_matrix,
-                              vx_lv1,
-                              v_lv1);
+    const int kc_interval = mg->k_cycle_probe_interval;
+
+    if (kc_interval > 0 && mgd->kc_skip[level] > 0) {
+      mgd->kc_skip[level] -= 1;
+      rhs_lv1 = NULL;
+      t0 = cs_timer_time();
+      cs_timer_counter_add_diff(&(lv_info->t_tot[6]), &t1, &t0);
+    }
+    else {
+
+      /* Arrays needed for the first Krylov iteration inside the cycle */
+      cs_real_t *restrict v_lv1 = mgd->rhs_vx[(level+1)*na + 6];
+      cs_real_t *restrict rt_lv1 = mgd->rhs_vx[(level+1)*na + 7];
+
+      cs_matrix_vector_multiply(rotation_mode,
+                                c_matrix,
+                                vx_lv1,
+                                v_lv1);
 
-    /* Coefficients for the Krylov iteration */
+      /* Coefficients for the Krylov iteration */
 
-    cs_real_t rho1 = 0, alpha1 = 0;
-    _dot_xy_yz(mg, _c_n_rows, v_lv1, vx_lv1, rhs_lv1, &rho1, &alpha1);
+      cs_real_t rho1 = 0, alpha1 = 0;
+      cs_real_t  rt_lv1_norm = 1.0, r_lv1_norm = 0.0;
 
-    cs_real_t ar1 = alpha1 / rho1;
+      if (kc_interval > 0) {
 
-    /* New residual */
-    for (cs_lnum_t i = 0; i < _c_n_rows; i++)
-      rt_lv1[i] = rhs_lv1[i] - ar1 * v_lv1[i];
+        /* Single reduction; the new residual norm is deduced from
+           |r - a.v|^2 = r.r - 2a r.v + a^2 v.v */
 
-    cs_real_t  rt_lv1_norm = 1.0, r_lv1_norm = 0.0;
+        double s[5];
+        _dot_xx_yy_xy_xz_yz(mg, _c_n_rows, v_lv1, rhs_lv1, vx_lv1, s);
 
-    if (trsh > 0)
-      _dot_xx_yy(mg, _c_n_rows, rt_lv1, rhs_lv1, &rt_lv1_norm, &r_lv1_norm);
+        rho1 = s[3];
+        alpha1 = s[4];
 
-    /* Free (unmap) arrays that were needed only for the descent phase */
-    rhs_lv1 = NULL;
+        cs_real_t _ar1 = alpha1 / rho1;
+        r_lv1_norm = s[1];
+        rt_lv1_norm = CS_MAX(s[1] - 2.*_ar1*s[2] + _ar1*_ar1*s[0], 0.);
 
-    /* Test for the second coarse resolution */
-    if (rt_lv1_norm < trsh * trsh * r_lv1_norm) {
-#     pragma omp parallel for if(_c_n_rows > CS_THR_MIN)
+        /* Measured coarse correction quality; reductions weigh more on
+           levels merged on a subset of ranks, so accept more there. */
+
+        double q_max = _k_cycle_adaptive_skip_ratio;
+        if (mg->lv_info[level+1].n_ranks[0] < mg->lv_info[0].n_ranks[0])
+          q_max *= 2;
+
+        if (   rt_lv1_norm < q_max * q_max * r_lv1_norm
+            && CS_ABS(_ar1 - 1.) < q_max)
+          mgd->kc_skip[level] = kc_interval;
+
+      }
+      else
+        _dot_xy_yz(mg, _c_n_rows, v_lv1, vx_lv1, rhs_lv1, &rho1, &alpha1);
+
+      cs_real_t ar1 = alpha1 / rho1;
+
+      /* New residual */
       for (cs_lnum_t i = 0; i < _c_n_rows; i++)
-        vx_lv1[i] = ar1 * vx_lv1[i];
-    }
-    else {
+        rt_lv1[i] = rhs_lv1[i] - ar1 * v_lv1[i];
+
+      if (trsh > 0 && kc_interval < 1)
+        _dot_xx_yy(mg, _c_n_rows, rt_lv1, rhs_lv1, &rt_lv1_norm, &r_lv1_norm);
 
-      /* Arrays for the (optional) second Krylov iteration */
-      cs_real_t *restrict vx2_lv1 = mgd->rhs_vx[(level+1)*na + 8];
-      cs_real_t *restrict w_lv1 = mgd->rhs_vx[(level+1)*na + 9];
+      /* Free (unmap) arrays that were needed only for the descent phase */
+      rhs_lv1 = NULL;
 
-#     pragma omp parallel for if(_c_n_rows > CS_THR_MIN)
-      for (cs_lnum_t i = 0; i < _c_n_rows; i++) {
-        vx2_lv1[i] = 0.0;
-        w_lv1[i] = 0.0;
+      /* Test for the second coarse resolution */
+      if (trsh > 0 && rt_lv1_norm < trsh * trsh * r_lv1_norm) {
+#       pragma omp parallel for if(_c_n_rows > CS_THR_MIN)
+        for (cs_lnum_t i = 0; i < _c_n_rows; i++)
+          vx_lv1[i] = ar1 * vx_lv1[i];
       }
+      else {
 
-      t0 = cs_timer_time();
-      cs_timer_counter_add_diff(&(lv_info->t_tot[6]), &t1, &t0);
+        /* Arrays for the (optional) second Krylov iteration */
+        cs_real_t *restrict vx2_lv1 = mgd->rhs_vx[(level+1)*na + 8];
+        cs_real_t *restrict w_lv1 = mgd->rhs_vx[(level+1)*na + 9];
 
-      c_cvg = _multigrid_k_cycle(mg,
-                                 level + 1,
-                                 lv_names,
-                                 verbosity,
-                                 rotation_mode,
-                                 cycle_id,
-                                 &n_iter,
-                                 precision,
-                                 r_norm,
-                                 initial_residue,
-                                 residue,
-                                 rt_lv1,
-                                 vx2_lv1,
-                                 aux_size,
-                                 aux_vectors);
+#       pragma omp parallel for if(_c_n_rows > CS_THR_MIN)
+        for (cs_lnum_t i = 0; i < _c_n_rows; i++) {
+          vx2_lv1[i] = 0.0;
+          w_lv1[i] = 0.0;
+        }
 
-      t1 = cs_timer_time();
+        t0 = cs_timer_time();
+        cs_timer_counter_add_diff(&(lv_info->t_tot[6]), &t1, &t0);
+
+        c_cvg = _multigrid_k_cycle(mg,
+                                   level + 1,
+                                   lv_names,
+                                   verbosity,
+                                   rotation_mode,
+                                   cycle_id,
+                                   &n_iter,
+                                   precision,
+                                   r_norm,
+                                   initial_residue,
+                                   residue,
+                                   rt_lv1,
+                                   vx2_lv1,
+                                   aux_size,
+                                   aux_vectors);
 
-      cs_matrix_vector_multiply(rotation_mode,
-                                c_matrix,
-                                vx2_lv1,
-                                w_lv1);
+        t1 = cs_timer_time();
 
-      /* Krylov iteration */
+        cs_matrix_vector_multiply(rotation_mode,
+                                  c_matrix,
+                                  vx2_lv1,
+                                  w_lv1);
 
-      cs_real_t gamma = 0, beta = 0, alpha2 = 0;
+        /* Krylov iteration */
 
-      _dot_xu_xv_xw(mg, _c_n_rows,
-                    vx2_lv1, v_lv1, w_lv1, rt_lv1,
-                    &gamma, &beta, &alpha2);
+        cs_real_t gamma = 0, beta = 0, alpha2 = 0;
 
-      cs_real_t rho2 = beta - (gamma * gamma) / rho1;
-      cs_real_t ar2 = alpha2 / rho2;
-      cs_real_t ar1_ar2 = ar1 - (gamma / rho1) * ar2;
+        _dot_xu_xv_xw(mg, _c_n_rows,
+                      vx2_lv1, v_lv1, w_lv1, rt_lv1,
+                      &gamma, &beta, &alpha2);
 
-#     pragma omp parallel for if(_c_n_rows > CS_THR_MIN)
-      for (cs_lnum_t i = 0; i < _c_n_rows; i++)
-        vx_lv1[i] = ar1_ar2 * vx_lv1[i] + ar2 * vx2_lv1[i];
+        cs_real_t rho2 = beta - (gamma * gamma) / rho1;
+        cs_real_t ar2 = alpha2 / rho2;
+        cs_real_t ar1_ar2 = ar1 - (gamma / rho1) * ar2;
 
-      vx2_lv1 = NULL;
-      w_lv1 = NULL;
-    }
+#       pragma omp parallel for if(_c_n_rows > CS_THR_MIN)
+        for (cs_lnum_t i = 0; i < _c_n_rows; i++)
+          vx_lv1[i] = ar1_ar2 * vx_lv1[i] + ar2 * vx2_lv1[i];
 
-    t0 = cs_timer_time();
-    cs_timer_counter_add_diff(&(lv_info->t_tot[6]), &t1, &t0);
+        vx2_lv1 = NULL;
+        w_lv1 = NULL;
+      }
+
+      t0 = cs_timer_time();
+      cs_timer_counter_add_diff(&(lv_info->t_tot[6]), &t1, &t0);
 
-    v_lv1 = NULL;
-    rt_lv1 = NULL;
+      v_lv1 = NULL;
+      rt_lv1 = NULL;
+
+    }
   }
 
   /* Ascent
@@ -3812,6 +4707,14 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
 
   mg->p0p1_relax = 0.;
   mg->k_cycle_threshold = 0;
+  mg->k_cycle_probe_interval = 0;
+
+  mg->sp_level_min = 0;
+
+  mg->setup_reuse_max = 0;
+  mg->setup_reuse_ratio = 1.5;
+
+  mg->coarse_direct_max = 0;
 
   _multigrid_info_init(&(mg->info));
   for (int i = 0; i < 3; i++)
@@ -3843,6 +4746,11 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
 
   mg->setup_data = NULL;
 
+  mg->reuse_data = NULL;
+  mg->setup_reuse_count = 0;
+  mg->setup_ref_cycles = 0;
+  mg->setup_rebuild = false;
+
   BFT_MALLOC(mg->lv_info, mg->n_levels_max, cs_multigrid_level_info_t);
 
   for (ii = 0; ii < mg->n_levels_max; ii++)
@@ -3900,6 +4808,8 @@ cs_multigrid_destroy(void  **context)
   if (mg == NULL)
     return;
 
+  _multigrid_reuse_data_free(mg);
+
   BFT_FREE(mg->lv_info);
 
   if (mg->post_row_num != NULL) {
@@ -4027,6 +4937,35 @@ cs_multigrid_set_coarsening_options(cs_multigrid_t  *mg,
   mg->p0p1_relax = p0p1_relax;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid coarse level coefficients precision options.
+ *
+ * On grid levels greater or equal to the given level, matrix.vector
+ * products use a single precision copy of the extra-diagonal matrix
+ * coefficients, while vectors and the diagonal remain in double precision.
+ * As coarse levels are usually limited by memory bandwidth, this may
+ * reduce solve times, but may also increase the number of cycles.
+ *
+ * Only operations using matrix.vector products benefit from this
+ * setting (so Gauss-Seidel type smoothers are not affected).
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       sp_level_min  minimum grid level using single precision
+ *                                coefficients (< 1 to disable)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_precision(cs_multigrid_t  *mg,
+                                  int              sp_level_min)
+{
+  if (mg == NULL)
+    return;
+
+  mg->sp_level_min = sp_level_min;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set multigrid parameters for associated iterative solvers.
@@ -4185,6 +5124,8 @@ cs_multigrid_setup_conv_diff(void               *context,
   const cs_mesh_t  *mesh = cs_glob_mesh;
   const cs_mesh_quantities_t  *mq = cs_glob_mesh_quantities;
 
+  bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_MULTIGRID);
+
   /* Destroy previous hierarchy if necessary */
 
   if (mg->setup_data != NULL)
@@ -4228,13 +5169,18 @@ cs_multigrid_setup_conv_diff(void               *context,
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t0, &t1);
 
-  _setup_hierarchy(mg, name, mesh, f, verbosity); /* Assign to and build
-                                                     hierarchy */
+  /* Reuse previous hierarchy if possible, build it otherwise */
+
+  if (_setup_hierarchy_reuse(mg, name, f, verbosity) == false)
+    _setup_hierarchy(mg, name, mesh, f, verbosity); /* Assign to and build
+                                                       hierarchy */
 
   /* Update timers */
 
   t1 = cs_timer_time();
   cs_timer_counter_add_diff(&(mg->info.t_tot[0]), &t0, &t1);
+
+  bft_mem_tag_end(mem_tag);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4396,6 +5342,16 @@ cs_multigrid_solve(void                *context,
 
   mg_info->n_cycles[2] += n_cycles;
 
+  /* Check for convergence degradation when reusing the hierarchy */
+
+  if (mg->setup_reuse_max > 0) {
+    if (mg->setup_ref_cycles == 0)
+      mg->setup_ref_cycles = n_cycles;
+    else if (   mg->setup_reuse_ratio > 0
+             && n_cycles > mg->setup_reuse_ratio * mg->setup_ref_cycles)
+      mg->setup_rebuild = true;
+  }
+
   if (mg_info->n_calls[1] > 0) {
     if (mg_info->n_cycles[0] > n_cycles)
       mg_info->n_cycles[0] = n_cycles;
@@ -4454,6 +5410,7 @@ cs_multigrid_free(void  *context)
 
     BFT_FREE(mgd->rhs_vx);
     BFT_FREE(mgd->rhs_vx_buf);
+    BFT_FREE(mgd->kc_skip);
 
     /* Destroy solver hierarchy */
 
@@ -4464,20 +5421,71 @@ cs_multigrid_free(void  *context)
           mg_sles->destroy_func(&(mg_sles->context));
       }
     }
-    BFT_FREE(mgd->sles_hierarchy);
-
-    /* Destroy grid hierarchy */
-
-    for (int i = mgd->n_levels - 1; i > -1; i--)
-      cs_grid_destroy(mgd->grid_hierarchy + i);
-    BFT_FREE(mgd->grid_hierarchy);
 
     /* Destroy peconditioning-only arrays */
 
     BFT_FREE(mgd->pc_name);
     BFT_FREE(mgd->pc_aux);
 
-    BFT_FREE(mg->setup_data);
+    /* Keep coarse grids if the hierarchy may be reused at next setup;
+       the finest grid shares the caller's matrix, so is always destroyed.
+       Only settings and statistics identical on all ranks are used here,
+       so the decision is the same on all ranks. */
+
+    bool keep_hierarchy = false;
+
+    if (   mg->setup_reuse_max > 0
+        && mg->setup_reuse_count < mg->setup_reuse_max
+        && mg->setup_rebuild == false
+        && mg->subtype == CS_MULTIGRID_MAIN
+        && mgd->n_levels > 1) {
+      keep_hierarchy = true;
+      for (int i = 0; i < 3; i++) {
+        if (mg->lv_mg[i] != NULL)
+          keep_hierarchy = false;
+      }
+    }
+
+    _multigrid_reuse_data_free(mg);
+
+    if (keep_hierarchy) {
+
+      for (unsigned i = 0; i < mgd->n_levels_alloc*2; i++) {
+        mgd->sles_hierarchy[i].context = NULL;
+        mgd->sles_hierarchy[i].setup_func = NULL;
+        mgd->sles_hierarchy[i].solve_func = NULL;
+        mgd->sles_hierarchy[i].destroy_func = NULL;
+      }
+
+      cs_grid_get_info(mgd->grid_hierarchy[0],
+                       NULL,
+                       NULL,
+                       NULL,
+                       NULL,
+                       NULL,
+                       &(mgd->fine_n_rows),
+                       &(mgd->fine_n_cols_ext),
+                       &(mgd->fine_n_entries),
+                       NULL);
+      cs_grid_destroy(mgd->grid_hierarchy);
+
+      mg->reuse_data = mgd;
+      mg->setup_data = NULL;
+
+    }
+    else {
+
+      BFT_FREE(mgd->sles_hierarchy);
+
+      /* Destroy grid hierarchy */
+
+      for (int i = mgd->n_levels - 1; i > -1; i--)
+        cs_grid_destroy(mgd->grid_hierarchy + i);
+      BFT_FREE(mgd->grid_hierarchy);
+
+      BFT_FREE(mg->setup_data);
+
+    }
   }
 
   /* Update timers */
@@ -4840,6 +5848,170 @@ cs_multigrid_set_merge_options(cs_multigrid_t  *mg,
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query multigrid setup reuse options.
+ *
+ * \param[in]   mg            pointer to multigrid info and context
+ * \param[out]  n_max_reuse   maximum number of successive setups reusing
+ *                            the grid hierarchy, or NULL
+ * \param[out]  cycles_ratio  cycles ratio above which a full rebuild is
+ *                            forced, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_get_setup_reuse(const cs_multigrid_t  *mg,
+                             int                   *n_max_reuse,
+                             double                *cycles_ratio)
+{
+  if (n_max_reuse != NULL)
+    *n_max_reuse = mg->setup_reuse_max;
+  if (cycles_ratio != NULL)
+    *cycles_ratio = mg->setup_reuse_ratio;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid setup reuse options.
+ *
+ * When activated, the grid hierarchy (coarse grid aggregation, halos
+ * and matrix structures) is kept between successive setups, and only
+ * coarse matrix coefficients are recomputed from the new fine matrix.
+ * The hierarchy is fully rebuilt after a given number of reuses, or when
+ * the number of cycles needed for convergence exceeds a given ratio of
+ * the number of cycles needed just after the last full build.
+ *
+ * This is intended for fixed meshes with slowly varying coefficients.
+ * When the fine matrix dimensions change, or for hierarchies using grid
+ * merging, convection/diffusion coarsening, or recursive multigrid
+ * coarse solvers, a full setup is always done.
+ *
+ * Coarse grid quantities used for coarsening are kept when this option
+ * is active, which increases memory usage.
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       n_max_reuse   maximum number of successive setups
+ *                                reusing the grid hierarchy
+ *                                (< 1 to deactivate)
+ * \param[in]       cycles_ratio  cycles ratio above which a full rebuild
+ *                                is forced (ignored if <= 0)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_setup_reuse(cs_multigrid_t  *mg,
+                             int              n_max_reuse,
+                             double           cycles_ratio)
+{
+  mg->setup_reuse_max = n_max_reuse;
+  mg->setup_reuse_ratio = cycles_ratio;
+
+  if (mg->setup_reuse_max < 1)
+    _multigrid_reuse_data_free(mg);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query the maximum coarsest grid size for direct solution.
+ *
+ * \param[in]  mg  pointer to multigrid info and context
+ *
+ * \return  maximum global number of coarsest grid rows under which
+ *          a direct solver is used (0 if not used)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_gnum_t
+cs_multigrid_get_coarse_direct(const cs_multigrid_t  *mg)
+{
+  return mg->coarse_direct_max;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum coarsest grid size for direct solution.
+ *
+ * When the coarsest grid has at most the given global number of rows,
+ * its matrix is gathered on the first rank of the coarsest grid's
+ * communicator, which computes a dense LU factorization at setup.
+ * Each coarse solve then only requires gathering the right-hand side
+ * and scattering the solution over that communicator, replacing the
+ * global reductions of the iterative coarse solver. Ranks on which
+ * the coarsest grid is empty (see \ref cs_multigrid_set_merge_options)
+ * do not wait for the coarse solution.
+ *
+ * Memory and factorization cost on the root rank grow respectively with
+ * the square and cube of the coarsest grid size, so the maximum size
+ * should remain small (a few thousand rows at most).
+ *
+ * If the factorization fails (for example for a singular matrix with
+ * a kernel of dimension larger than 1), or for coarse matrices with
+ * block rotational periodicity, the iterative coarse solver is used.
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       n_g_rows_max  maximum global number of coarsest grid
+ *                                rows for a direct solution (0 to
+ *                                deactivate)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_direct(cs_multigrid_t  *mg,
+                               cs_gnum_t        n_g_rows_max)
+{
+  mg->coarse_direct_max = n_g_rows_max;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query the adaptive K-cycle probe interval.
+ *
+ * \param[in]  mg  pointer to multigrid info and context
+ *
+ * \return  number of cycles between re-evaluations of levels on which
+ *          Krylov acceleration is skipped (0 if adaptive mode is not used)
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_multigrid_get_k_cycle_adaptive(const cs_multigrid_t  *mg)
+{
+  return mg->k_cycle_probe_interval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set adaptive K-cycle options.
+ *
+ * When activated for a K-cycle type multigrid, the quality of each
+ * level's coarse correction is measured when it is Krylov-accelerated.
+ * If the coarse correction alone already reduces the coarse residual
+ * well, with an optimal scaling close to 1, the Krylov acceleration
+ * (matrix-vector product and global reductions) is skipped on that level
+ * for the given number of cycles, after which it is evaluated again.
+ * Levels merged on a subset of ranks, for which reductions are relatively
+ * more costly, use a more permissive criterion.
+ *
+ * In this mode, the dot products used for the Krylov step and for the
+ * threshold test of the second coarse correction are also combined
+ * in a single global reduction.
+ *
+ * This setting has no effect for V-cycle multigrid.
+ *
+ * \param[in, out]  mg              pointer to multigrid info and context
+ * \param[in]       probe_interval  number of cycles between
+ *                                  re-evaluations (< 1 to deactivate)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_k_cycle_adaptive(cs_multigrid_t  *mg,
+                                  int              probe_interval)
+{
+  mg->k_cycle_probe_interval = CS_MAX(probe_interval, 0);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
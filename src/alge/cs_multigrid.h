@@ -190,6 +190,28 @@ cs_multigrid_set_coarsening_options(cs_multigrid_t  *mg,
                                     double           p0p1_relax,
                                     int              postprocess_block_size);
 
+/*----------------------------------------------------------------------------
+ * Set multigrid coarse level coefficients precision options.
+ *
+ * On grid levels greater or equal to the given level, matrix.vector
+ * products use a single precision copy of the extra-diagonal matrix
+ * coefficients, while vectors and the diagonal remain in double precision.
+ * As coarse levels are usually limited by memory bandwidth, this may
+ * reduce solve times, but may also increase the number of cycles.
+ *
+ * Only operations using matrix.vector products benefit from this
+ * setting (so Gauss-Seidel type smoothers are not affected).
+ *
+ * parameters:
+ *   mg            <-> pointer to multigrid info and context
+ *   sp_level_min  <-- minimum grid level using single precision
+ *                     coefficients (< 1 to disable)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_precision(cs_multigrid_t  *mg,
+                                  int              sp_level_min);
+
 /*----------------------------------------------------------------------------
  * Set multigrid parameters for associated iterative solvers.
  *
@@ -443,6 +465,145 @@ cs_multigrid_set_merge_options(cs_multigrid_t  *mg,
                                int              rows_mean_threshold,
                                cs_gnum_t        rows_glob_threshold);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query multigrid setup reuse options.
+ *
+ * \param[in]   mg            pointer to multigrid info and context
+ * \param[out]  n_max_reuse   maximum number of successive setups reusing
+ *                            the grid hierarchy, or NULL
+ * \param[out]  cycles_ratio  cycles ratio above which a full rebuild is
+ *                            forced, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_get_setup_reuse(const cs_multigrid_t  *mg,
+                             int                   *n_max_reuse,
+                             double                *cycles_ratio);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid setup reuse options.
+ *
+ * When activated, the grid hierarchy (coarse grid aggregation, halos
+ * and matrix structures) is kept between successive setups, and only
+ * coarse matrix coefficients are recomputed from the new fine matrix.
+ * The hierarchy is fully rebuilt after a given number of reuses, or when
+ * the number of cycles needed for convergence exceeds a given ratio of
+ * the number of cycles needed just after the last full build.
+ *
+ * This is intended for fixed meshes with slowly varying coefficients.
+ * When the fine matrix dimensions change, or for hierarchies using grid
+ * merging, convection/diffusion coarsening, or recursive multigrid
+ * coarse solvers, a full setup is always done.
+ *
+ * Coarse grid quantities used for coarsening are kept when this option
+ * is active, which increases memory usage.
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       n_max_reuse   maximum number of successive setups
+ *                                reusing the grid hierarchy
+ *                                (< 1 to deactivate)
+ * \param[in]       cycles_ratio  cycles ratio above which a full rebuild
+ *                                is forced (ignored if <= 0)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_setup_reuse(cs_multigrid_t  *mg,
+                             int              n_max_reuse,
+                             double           cycles_ratio);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query the maximum coarsest grid size for direct solution.
+ *
+ * \param[in]  mg  pointer to multigrid info and context
+ *
+ * \return  maximum global number of coarsest grid rows under which
+ *          a direct solver is used (0 if not used)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_gnum_t
+cs_multigrid_get_coarse_direct(const cs_multigrid_t  *mg);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum coarsest grid size for direct solution.
+ *
+ * When the coarsest grid has at most the given global number of rows,
+ * its matrix is gathered on the first rank of the coarsest grid's
+ * communicator, which computes a dense LU factorization at setup.
+ * Each coarse solve then only requires gathering the right-hand side
+ * and scattering the solution over that communicator, replacing the
+ * global reductions of the iterative coarse solver. Ranks on which
+ * the coarsest grid is empty (see \ref cs_multigrid_set_merge_options)
+ * do not wait for the coarse solution.
+ *
+ * Memory and factorization cost on the root rank grow respectively with
+ * the square and cube of the coarsest grid size, so the maximum size
+ * should remain small (a few thousand rows at most).
+ *
+ * If the factorization fails (for example for a singular matrix with
+ * a kernel of dimension larger than 1), or for coarse matrices with
+ * block rotational periodicity, the iterative coarse solver is used.
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       n_g_rows_max  maximum global number of coarsest grid
+ *                                rows for a direct solution (0 to
+ *                                deactivate)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_direct(cs_multigrid_t  *mg,
+                               cs_gnum_t        n_g_rows_max);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query the adaptive K-cycle probe interval.
+ *
+ * \param[in]  mg  pointer to multigrid info and context
+ *
+ * \return  number of cycles between re-evaluations of levels on which
+ *          Krylov acceleration is skipped (0 if adaptive mode is not used)
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_multigrid_get_k_cycle_adaptive(const cs_multigrid_t  *mg);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set adaptive K-cycle options.
+ *
+ * When activated for a K-cycle type multigrid, the quality of each
+ * level's coarse correction is measured when it is Krylov-accelerated.
+ * If the coarse correction alone already reduces the coarse residual
+ * well, with an optimal scaling close to 1, the Krylov acceleration
+ * (matrix-vector product and global reductions) is skipped on that level
+ * for the given number of cycles, after which it is evaluated again.
+ * Levels merged on a subset of ranks, for which reductions are relatively
+ * more costly, use a more permissive criterion.
+ *
+ * In this mode, the dot products used for the Krylov step and for the
+ * threshold test of the second coarse correction are also combined
+ * in a single global reduction.
+ *
+ * This setting has no effect for V-cycle multigrid.
+ *
+ * \param[in, out]  mg              pointer to multigrid info and context
+ * \param[in]       probe_interval  number of cycles between
+ *                                  re-evaluations (< 1 to deactivate)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_k_cycle_adaptive(cs_multigrid_t  *mg,
+                                  int              probe_interval);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
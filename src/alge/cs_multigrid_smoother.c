@@ -101,6 +101,14 @@ static int _thread_debug = 0;
 
 static cs_lnum_t _pcg_sr_threshold = 512;
 
+/* Chebyshev smoother: number of power iterations used to estimate the
+   largest eigenvalue of diag^-1.A, safety factor applied to that estimate,
+   and ratio of the lower to upper bound of the damped part of the spectrum */
+
+static int     _cheb_n_power_iter = 10;
+static double  _cheb_lambda_safety = 1.1;
+static double  _cheb_lambda_ratio = 0.3;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -1042,6 +1050,257 @@ _block_jacobi(cs_sles_it_t              *c,
   return CS_SLES_MAX_ITERATION;
 }
 
+/*----------------------------------------------------------------------------
+ * Apply the inverse of the (block) diagonal: x <- diag^-1.(c - b).
+ *
+ * parameters:
+ *   n_rows  <-- number of rows
+ *   db_size <-- block size of diagonal elements
+ *   ad_inv  <-- inverse of the diagonal (or LU factors of diagonal blocks)
+ *   b       <-- 1st part of RHS (c - b), or NULL for zero
+ *   c       <-- 2nd part of RHS (c - b)
+ *   x       --> result
+ *----------------------------------------------------------------------------*/
+
+static void
+_diag_inverse_apply(cs_lnum_t                  n_rows,
+                    const cs_lnum_t           *db_size,
+                    const cs_real_t  *restrict ad_inv,
+                    const cs_real_t  *restrict b,
+                    const cs_real_t  *restrict c,
+                    cs_real_t        *restrict x)
+{
+  if (db_size[0] == 1) {
+    if (b != NULL) {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        x[ii] = (c[ii] - b[ii]) * ad_inv[ii];
+    }
+    else {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        x[ii] = c[ii] * ad_inv[ii];
+    }
+  }
+
+  else {
+    const cs_lnum_t n_blocks = n_rows / db_size[0];
+    const cs_real_t zero[DB_SIZE_MAX] = {0};
+
+#   pragma omp parallel for if(n_blocks > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_blocks; ii++) {
+      const cs_real_t *_b = (b != NULL) ? b + db_size[1]*ii : zero;
+      _fw_and_bw_lu(ad_inv + db_size[3]*ii,
+                    db_size[0],
+                    x + db_size[1]*ii,
+                    _b,
+                    c + db_size[1]*ii);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Estimate the largest eigenvalue of diag^-1.A using a few power iterations.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   v               --- work array (size: n_cols)
+ *   w               --- work array (size: n_rows)
+ *
+ * returns:
+ *   estimated largest eigenvalue
+ *----------------------------------------------------------------------------*/
+
+static double
+_chebyshev_lambda_max(cs_sles_it_t        *c,
+                      const cs_matrix_t   *a,
+                      cs_halo_rotation_t   rotation_mode,
+                      cs_real_t  *restrict v,
+                      cs_real_t  *restrict w)
+{
+  const cs_lnum_t *db_size = cs_matrix_get_diag_block_size(a);
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  double lambda = 0.;
+
+  /* Deterministic, non-smooth starting vector */
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    v[ii] = (double)(((unsigned)ii * 2654435761u) >> 22) / 1024. + 0.5;
+
+  double v_norm = sqrt(_dot_product_xx(c, v));
+
+  for (int k = 0; k < _cheb_n_power_iter && v_norm > 0; k++) {
+
+    const double v_scale = 1. / v_norm;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      v[ii] *= v_scale;
+
+    cs_matrix_vector_multiply(rotation_mode, a, v, w);
+
+    _diag_inverse_apply(n_rows, db_size, ad_inv, NULL, w, v);
+
+    v_norm = sqrt(_dot_product_xx(c, v));
+    lambda = v_norm;
+
+  }
+
+  return lambda;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Jacobi-preconditioned Chebyshev
+ * polynomial smoothing.
+ *
+ * The polynomial degree is the number of iterations; the damped part of the
+ * spectrum of diag^-1.A is based on an estimate of its largest
+ * eigenvalue, computed using power iterations on the first call
+ * following a setup.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- block size of diagonal elements
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_chebyshev(cs_sles_it_t              *c,
+           const cs_matrix_t         *a,
+           cs_lnum_t                  diag_block_size,
+           cs_halo_rotation_t         rotation_mode,
+           cs_sles_it_convergence_t  *convergence,
+           const cs_real_t           *rhs,
+           cs_real_t                 *restrict vx,
+           size_t                     aux_size,
+           void                      *aux_vectors)
+{
+  cs_real_t *_aux_vectors;
+  cs_real_t  *restrict xk, *restrict wk, *restrict zk, *restrict dk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  cs_sles_it_setup_t *sd = c->setup_data;
+
+  const cs_lnum_t *db_size = cs_matrix_get_diag_block_size(a);
+
+  const cs_real_t  *restrict ad_inv = sd->ad_inv;
+
+  const cs_lnum_t n_rows = sd->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 4;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    xk = _aux_vectors;
+    wk = _aux_vectors + wa_size;
+    zk = _aux_vectors + wa_size*2;
+    dk = _aux_vectors + wa_size*3;
+  }
+
+  /* Estimate spectrum bounds if not already done since last setup
+     (reusing that of the shared smoother when available) */
+
+  if (sd->lambda_max < 0) {
+    const cs_sles_it_t *s = c->shared;
+    if (s != NULL && s->setup_data != NULL && s->setup_data->lambda_max > 0)
+      sd->lambda_max = s->setup_data->lambda_max;
+    else
+      sd->lambda_max = _cheb_lambda_safety
+                       * _chebyshev_lambda_max(c, a, rotation_mode, xk, wk);
+  }
+
+  const double lambda_max = sd->lambda_max;
+  const double lambda_min = _cheb_lambda_ratio * lambda_max;
+
+  const double theta = 0.5 * (lambda_max + lambda_min);
+  const double delta = 0.5 * (lambda_max - lambda_min);
+
+  if (!(delta > 0)) {
+    if (_aux_vectors != aux_vectors)
+      BFT_FREE(_aux_vectors);
+    convergence->n_iterations = 0;
+    return CS_SLES_MAX_ITERATION;
+  }
+
+  const double sigma = theta / delta;
+
+  double rho_old = 1. / sigma;
+
+  memcpy(xk, vx, n_rows * sizeof(cs_real_t));  /* xk <- vx */
+
+  /* Current iteration */
+  /*-------------------*/
+
+  for (n_iter = 0; n_iter < convergence->n_iterations_max; n_iter++) {
+
+    /* Compute zk <- diag^-1 . (rhs - A.xk) */
+
+    cs_matrix_vector_multiply(rotation_mode, a, xk, wk);
+
+    _diag_inverse_apply(n_rows, db_size, ad_inv, wk, rhs, zk);
+
+    /* Update direction and solution */
+
+    if (n_iter == 0) {
+      const double c_z = 1. / theta;
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        dk[ii] = c_z * zk[ii];
+        xk[ii] += dk[ii];
+      }
+    }
+    else {
+      const double rho = 1. / (2.*sigma - rho_old);
+      const double c_d = rho * rho_old;
+      const double c_z = 2. * rho / delta;
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        dk[ii] = c_d * dk[ii] + c_z * zk[ii];
+        xk[ii] += dk[ii];
+      }
+      rho_old = rho;
+    }
+
+  }
+
+  memcpy(vx, xk, n_rows * sizeof(cs_real_t));  /* vx <- xk */
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  convergence->n_iterations = n_iter;
+
+  return CS_SLES_MAX_ITERATION;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local Gauss-Seidel.
  *
@@ -1818,6 +2077,7 @@ cs_multigrid_smoother_create(cs_sles_it_type_t    smoother_type,
   case CS_SLES_P_SYM_GAUSS_SEIDEL:
   case CS_SLES_TS_F_GAUSS_SEIDEL:
   case CS_SLES_TS_B_GAUSS_SEIDEL:
+  case CS_SLES_CHEBYSHEV:
     break;
 
   case CS_SLES_PCG:
@@ -1869,6 +2129,7 @@ cs_multigrid_smoother_create(cs_sles_it_type_t    smoother_type,
   c->setup_data = NULL;
   c->add_data = NULL;
   c->shared = NULL;
+  c->deflation = NULL;
 
   return c;
 }
@@ -1902,7 +2163,7 @@ cs_multigrid_smoother_setup(void               *context,
     cs_matrix_log_info(a, verbosity);
   }
 
-  if (c->type == CS_SLES_JACOBI)
+  if (c->type == CS_SLES_JACOBI || c->type == CS_SLES_CHEBYSHEV)
     cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size, true);
 
   else if (   c->type == CS_SLES_P_GAUSS_SEIDEL
@@ -1985,6 +2246,10 @@ cs_multigrid_smoother_setup(void               *context,
     c->solve = _ts_b_gauss_seidel_msr;
     break;
 
+  case CS_SLES_CHEBYSHEV:
+    c->solve = _chebyshev;
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
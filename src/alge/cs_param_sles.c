@@ -72,6 +72,13 @@ BEGIN_C_DECLS
  * Local private variables
  *============================================================================*/
 
+/* Auxiliary data for the auxiliary-space Maxwell preconditioner (shared) */
+
+static const cs_adjacency_t  *_ams_e2v = NULL;
+static const cs_range_set_t  *_ams_edge_rs = NULL;
+static const cs_range_set_t  *_ams_vtx_rs = NULL;
+static const cs_real_t       *_ams_vtx_coord = NULL;
+
 /*============================================================================
  * Private function prototypes
  *============================================================================*/
@@ -147,6 +154,89 @@ _petsc_pchypre_hook(void)
 #endif
 }
 
+#if defined(PETSC_HAVE_HYPRE)
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Provide the discrete gradient and the vertex coordinates to the
+ *        HYPRE AMS preconditioner.
+ *
+ * Rows of the discrete gradient are numbered as the (edge-based) system
+ * matrix, i.e. using the global ids of the edge range set, and columns
+ * using the global ids of the vertex range set.
+ *
+ * \param[in]      slesp    set of parameters for the linear algebra
+ * \param[in, out] pc       PETSc preconditioner structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_petsc_set_ams_auxiliary(const cs_param_sles_t   *slesp,
+                         PC                       pc)
+{
+  const cs_adjacency_t  *e2v = _ams_e2v;
+  const cs_range_set_t  *e_rs = _ams_edge_rs;
+  const cs_range_set_t  *v_rs = _ams_vtx_rs;
+
+  if (e2v == NULL || e_rs == NULL || v_rs == NULL || _ams_vtx_coord == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: System %s: auxiliary data for the AMS preconditioner"
+              " is not defined.\n"
+              " This preconditioner is only available for CDO edge-based"
+              " schemes.", __func__, slesp->name);
+
+  const PetscInt  n_l_edges = e_rs->l_range[1] - e_rs->l_range[0];
+  const PetscInt  n_l_vtx = v_rs->l_range[1] - v_rs->l_range[0];
+
+  /* Discrete gradient (2 non-zeros per row) */
+
+  Mat  g;
+  MatCreateAIJ(PETSC_COMM_WORLD,
+               n_l_edges, n_l_vtx, PETSC_DETERMINE, PETSC_DETERMINE,
+               2, NULL, 2, NULL, &g);
+
+  for (cs_lnum_t e_id = 0; e_id < e2v->n_elts; e_id++) {
+
+    const cs_gnum_t  e_gid = e_rs->g_id[e_id];
+    if (e_gid < e_rs->l_range[0] || e_gid >= e_rs->l_range[1])
+      continue;
+
+    const cs_lnum_t  *v_ids = e2v->ids + 2*e_id;
+    const short int  *sgn = e2v->sgn + 2*e_id;
+
+    PetscInt  row = e_gid;
+    PetscInt  cols[2] = {v_rs->g_id[v_ids[0]], v_rs->g_id[v_ids[1]]};
+    PetscScalar  vals[2] = {sgn[0], sgn[1]};
+
+    MatSetValues(g, 1, &row, 2, cols, vals, INSERT_VALUES);
+
+  }
+
+  MatAssemblyBegin(g, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(g, MAT_FINAL_ASSEMBLY);
+
+  PCHYPRESetDiscreteGradient(pc, g);
+  MatDestroy(&g); /* Reference kept by the preconditioner */
+
+  /* Coordinates of vertices in the local range, ordered by global id */
+
+  PetscReal  *coords = NULL;
+  BFT_MALLOC(coords, 3*n_l_vtx, PetscReal);
+
+  for (cs_lnum_t v_id = 0; v_id < v_rs->n_elts[1]; v_id++) {
+    const cs_gnum_t  v_gid = v_rs->g_id[v_id];
+    if (v_gid < v_rs->l_range[0] || v_gid >= v_rs->l_range[1])
+      continue;
+    const cs_lnum_t  j = v_gid - v_rs->l_range[0];
+    for (int k = 0; k < 3; k++)
+      coords[3*j + k] = _ams_vtx_coord[3*v_id + k];
+  }
+
+  PCSetCoordinates(pc, 3, n_l_vtx, coords);
+
+  BFT_FREE(coords);
+}
+#endif /* PETSC_HAVE_HYPRE */
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set command line options for PC according to the kind of
@@ -219,6 +309,18 @@ _petsc_set_pc_type(cs_param_sles_t   *slesp,
     PCSetType(pc, PCASM);
     break;
 
+  case CS_PARAM_PRECOND_AMS:
+#if defined(PETSC_HAVE_HYPRE)
+    PCSetType(pc, PCHYPRE);
+    PCHYPRESetType(pc, "ams");
+    _petsc_set_ams_auxiliary(slesp, pc);
+#else
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Eq. %s: The AMS preconditioner requires PETSc"
+              " with HYPRE.", __func__, slesp->name);
+#endif
+    break;
+
   case CS_PARAM_PRECOND_AMG:
     {
       switch (slesp->amg_type) {
@@ -935,6 +1037,12 @@ _set_saturne_sles(bool                 use_field_id,
     poly_degree = -1;
     break;
 
+  case CS_PARAM_PRECOND_AMS:
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: System: %s; The AMS preconditioner is only available"
+              " with PETSc and HYPRE.", __func__, slesp->name);
+    break;
+
   case CS_PARAM_PRECOND_NONE:
   default:
     poly_degree = -1;       /* None or other */
@@ -1532,6 +1640,33 @@ cs_param_sles_set(bool                 use_field_id,
   return 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the auxiliary data used by the auxiliary-space Maxwell (AMS)
+ *         preconditioner: edge -> vertices connectivity (the discrete
+ *         gradient), associated global numberings and vertex coordinates.
+ *         Data is shared (not copied) and must remain valid while systems
+ *         using this preconditioner are solved.
+ *
+ * \param[in]  e2v        edge -> vertices connectivity (signed)
+ * \param[in]  edge_rs    range set associated to edges
+ * \param[in]  vtx_rs     range set associated to vertices
+ * \param[in]  vtx_coord  vertex coordinates (interlaced)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_param_sles_set_ams_auxiliary(const cs_adjacency_t   *e2v,
+                                const cs_range_set_t   *edge_rs,
+                                const cs_range_set_t   *vtx_rs,
+                                const cs_real_t        *vtx_coord)
+{
+  _ams_e2v = e2v;
+  _ams_edge_rs = edge_rs;
+  _ams_vtx_rs = vtx_rs;
+  _ams_vtx_coord = vtx_coord;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
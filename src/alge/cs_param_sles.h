@@ -31,7 +31,9 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "cs_mesh_adjacencies.h"
 #include "cs_param_types.h"
+#include "cs_range_set.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -168,6 +170,27 @@ int
 cs_param_sles_set(bool                 use_field_id,
                   cs_param_sles_t     *slesp);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the auxiliary data used by the auxiliary-space Maxwell (AMS)
+ *         preconditioner: edge -> vertices connectivity (the discrete
+ *         gradient), associated global numberings and vertex coordinates.
+ *         Data is shared (not copied) and must remain valid while systems
+ *         using this preconditioner are solved.
+ *
+ * \param[in]  e2v        edge -> vertices connectivity (signed)
+ * \param[in]  edge_rs    range set associated to edges
+ * \param[in]  vtx_rs     range set associated to vertices
+ * \param[in]  vtx_coord  vertex coordinates (interlaced)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_param_sles_set_ams_auxiliary(const cs_adjacency_t   *e2v,
+                                const cs_range_set_t   *edge_rs,
+                                const cs_range_set_t   *vtx_rs,
+                                const cs_real_t        *vtx_coord);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
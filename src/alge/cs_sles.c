@@ -66,6 +66,10 @@
 #include "cs_timer_stats.h"
 #include "cs_time_step.h"
 
+#if defined(HAVE_CUDA)
+#include "cs_blas_cuda.h"
+#endif
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -337,6 +341,9 @@ struct _cs_sles_t {
 
   cs_sles_error_handler_t  *error_func;    /* error handler */
 
+  cs_sles_solve_multi_t    *solve_multi_func; /* batched solve function,
+                                                 or NULL */
+
   cs_sles_post_t           *post_info;     /* postprocessing info */
 
 };
@@ -368,6 +375,9 @@ static cs_sles_t **_cs_sles_systems[3] = {NULL, NULL, NULL};
 static cs_timer_counter_t   _sles_t_tot;     /* Total time in linear solvers */
 static int _sles_stat_id = -1;
 
+static unsigned long long  _sles_n_iter_tot = 0;  /* Total number of
+                                                     solver iterations */
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -419,6 +429,7 @@ _sles_create(int          f_id,
   sles->copy_func = NULL;
   sles->destroy_func = NULL;
   sles->error_func = NULL;
+  sles->solve_multi_func = NULL;
 
   sles->n_calls = 0;
   sles->n_no_op = 0;
@@ -937,6 +948,10 @@ cs_sles_finalize(void)
   }
 
   cs_map_name_to_id_destroy(&_type_name_map);
+
+#if defined(HAVE_CUDA)
+  cs_blas_cuda_finalize();
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1323,6 +1338,7 @@ cs_sles_define(int                 f_id,
   sles->log_func = log_func;
   sles->copy_func = copy_func;
   sles->destroy_func = destroy_func;
+  sles->solve_multi_func = NULL;
 
   return sles;
 }
@@ -1465,6 +1481,34 @@ cs_sles_get_context(cs_sles_t  *sles)
   return sles->context;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Exchange the solver context of a sparse linear equation solver
+ *        with another context of the same type.
+ *
+ * Associated functions are not modified, so both contexts must be handled
+ * by the same functions. The solver must not be currently set up.
+ *
+ * This is intended for switching between alternative settings of a given
+ * solver type while keeping statistics for each setting.
+ *
+ * \param[in, out]  sles     pointer to solver object
+ * \param[in]       context  pointer to new solver context
+ *
+ * \return  pointer to previous solver context
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_sles_exchange_context(cs_sles_t  *sles,
+                         void       *context)
+{
+  void *prev = sles->context;
+  sles->context = context;
+
+  return prev;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return field id associated with a given sparse linear equation solver.
@@ -1500,6 +1544,23 @@ cs_sles_get_name(const cs_sles_t  *sles)
   return cs_sles_base_name(sles->f_id, sles->name);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the total number of iterations of all sparse linear
+ *        equation solvers since the start of the computation.
+ *
+ * Since solves are collective, this count is the same on all ranks.
+ *
+ * \return  cumulative number of linear solver iterations
+ */
+/*----------------------------------------------------------------------------*/
+
+unsigned long long
+cs_sles_get_n_iterations_tot(void)
+{
+  return _sles_n_iter_tot;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Setup sparse linear equation solver.
@@ -1661,6 +1722,8 @@ cs_sles_solve(cs_sles_t           *sles,
 
   }
 
+  _sles_n_iter_tot += *n_iter;
+
   /* Prepare postprocessing if needed */
 
   if (sles->post_info != NULL) {
@@ -1679,6 +1742,163 @@ cs_sles_solve(cs_sles_t           *sles,
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(&_sles_t_tot, &t0, &t1);
+  cs_timer_stats_trace_event(sles_name, &t0, &t1);
+
+  return state;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sparse linear system resolution for multiple right-hand sides
+ *        sharing the same matrix.
+ *
+ * Right-hand sides and solutions are interleaved, so that rhs[i*n_vecs + k]
+ * is the value of right-hand side k at row i.
+ *
+ * If the associated solver provides a batched solve function (see
+ * \ref cs_sles_set_solve_multi_func), all systems are solved together,
+ * so the matrix is read only once per iteration for all vectors.
+ * Otherwise, or for systems which fail to converge with the batched solver,
+ * systems are solved one by one using \ref cs_sles_solve.
+ *
+ * \param[in, out]  sles           pointer to solver object
+ * \param[in]       a              matrix
+ * \param[in]       rotation_mode  halo update option for rotational periodicity
+ * \param[in]       n_vecs         number of right-hand sides
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residue normalization for each system
+ * \param[out]      n_iter         number of "equivalent" iterations
+ *                                 for each system
+ * \param[out]      residue        residue for each system
+ * \param[in]       rhs            interleaved right hand sides
+ * \param[in, out]  vx             interleaved system solutions
+ *
+ * \return  convergence state (worst of all systems)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_multi(cs_sles_t           *sles,
+                    const cs_matrix_t   *a,
+                    cs_halo_rotation_t   rotation_mode,
+                    int                  n_vecs,
+                    double               precision,
+                    const double         r_norm[],
+                    int                  n_iter[],
+                    double               residue[],
+                    const cs_real_t     *rhs,
+                    cs_real_t           *vx)
+{
+  cs_sles_convergence_state_t state = CS_SLES_CONVERGED;
+
+  if (n_vecs < 1)
+    return state;
+
+  if (sles->context == NULL)
+    _cs_sles_define_default(sles->f_id, sles->name, a);
+
+  cs_sles_convergence_state_t *v_state;
+  BFT_MALLOC(v_state, n_vecs, cs_sles_convergence_state_t);
+
+  for (int k = 0; k < n_vecs; k++)
+    v_state[k] = CS_SLES_ITERATING;
+
+  /* Batched solve if available (residual postprocessing
+     requires the single-vector path) */
+
+  if (sles->solve_multi_func != NULL && sles->post_info == NULL) {
+
+    cs_timer_t t0 = cs_timer_time();
+
+    int t_top_id = cs_timer_stats_switch(_sles_stat_id);
+
+    const char  *sles_name = cs_sles_base_name(sles->f_id, sles->name);
+
+    bool solved = sles->solve_multi_func(sles->context,
+                                         sles_name,
+                                         a,
+                                         sles->verbosity,
+                                         rotation_mode,
+                                         n_vecs,
+                                         precision,
+                                         r_norm,
+                                         n_iter,
+                                         residue,
+                                         v_state,
+                                         rhs,
+                                         vx);
+
+    if (solved) {
+      sles->n_calls += 1;
+      for (int k = 0; k < n_vecs; k++) {
+        if (   v_state[k] == CS_SLES_CONVERGED
+            || v_state[k] == CS_SLES_MAX_ITERATION)
+          _sles_n_iter_tot += n_iter[k];
+      }
+    }
+    else {
+      for (int k = 0; k < n_vecs; k++)
+        v_state[k] = CS_SLES_ITERATING;
+    }
+
+    cs_timer_stats_switch(t_top_id);
+
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_counter_add_diff(&_sles_t_tot, &t0, &t1);
+
+  }
+
+  /* Solve remaining systems (not handled or not converged) one by one */
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
+
+  cs_real_t *_rhs = NULL, *_vx = NULL;
+
+  for (int k = 0; k < n_vecs; k++) {
+
+    if (   v_state[k] == CS_SLES_CONVERGED
+        || v_state[k] == CS_SLES_MAX_ITERATION)
+      continue;
+
+    if (_rhs == NULL) {
+      BFT_MALLOC(_rhs, n_rows, cs_real_t);
+      BFT_MALLOC(_vx, n_cols_ext, cs_real_t);
+    }
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      _rhs[i] = rhs[i*n_vecs + k];
+      _vx[i] = vx[i*n_vecs + k];
+    }
+
+    v_state[k] = cs_sles_solve(sles,
+                               a,
+                               rotation_mode,
+                               precision,
+                               r_norm[k],
+                               n_iter + k,
+                               residue + k,
+                               _rhs,
+                               _vx,
+                               0,
+                               NULL);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      vx[i*n_vecs + k] = _vx[i];
+
+  }
+
+  BFT_FREE(_vx);
+  BFT_FREE(_rhs);
+
+  for (int k = 0; k < n_vecs; k++) {
+    if (v_state[k] < state)
+      state = v_state[k];
+  }
+
+  BFT_FREE(v_state);
 
   return state;
 }
@@ -1760,6 +1980,7 @@ cs_sles_copy(cs_sles_t        *dest,
   dest->log_func = src->log_func;
   dest->copy_func = src->copy_func;
   dest->destroy_func = src->destroy_func;
+  dest->solve_multi_func = src->solve_multi_func;
 
   if (dest->context != NULL)
     retval = 0;
@@ -1792,6 +2013,28 @@ cs_sles_set_error_handler(cs_sles_t                *sles,
     sles->error_func = error_handler_func;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Associate a batched (multiple right-hand side) solve function
+ *        to a given sparse linear equation solver.
+ *
+ * The association will only be successful if the matching solver
+ * has already been defined.
+ *
+ * \param[in, out]  sles              pointer to solver object
+ * \param[in]       solve_multi_func  pointer to batched solve function,
+ *                                    or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_solve_multi_func(cs_sles_t              *sles,
+                             cs_sles_solve_multi_t  *solve_multi_func)
+{
+  if (sles != NULL)
+    sles->solve_multi_func = solve_multi_func;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return pointer to default sparse linear solver definition function.
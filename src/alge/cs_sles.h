@@ -142,6 +142,53 @@ typedef cs_sles_convergence_state_t
                    size_t               aux_size,
                    void                *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Function pointer for resolution of multiple linear systems sharing
+ * the same matrix.
+ *
+ * Right-hand sides and solutions are interleaved, so that rhs[i*n_vecs + k]
+ * is the value of right-hand side k at row i. Each system is considered
+ * to have converged when residue[k]/r_norm[k] <= precision.
+ *
+ * Such a function is optional; if it is not available for a given solver,
+ * or returns false, systems are solved one by one using the matching
+ * cs_sles_solve_t function.
+ *
+ * parameters:
+ *   context       <-> pointer to solver context
+ *   name          <-- pointer to name of linear system
+ *   a             <-- matrix
+ *   verbosity     <-- associated verbosity
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   n_vecs        <-- number of right-hand sides
+ *   precision     <-- solver precision
+ *   r_norm        <-- residue normalization for each system
+ *   n_iter        --> number of "equivalent" iterations for each system
+ *   residue       --> residue for each system
+ *   state         --> convergence status for each system
+ *   rhs           <-- interleaved right hand sides
+ *   vx            <-> interleaved system solutions
+ *
+ * returns:
+ *   true if the systems were solved, false if the solver settings or
+ *   matrix are not handled (in which case vx is unchanged)
+ *----------------------------------------------------------------------------*/
+
+typedef bool
+(cs_sles_solve_multi_t) (void                         *context,
+                         const char                   *name,
+                         const cs_matrix_t            *a,
+                         int                           verbosity,
+                         cs_halo_rotation_t            rotation_mode,
+                         int                           n_vecs,
+                         double                        precision,
+                         const double                  r_norm[],
+                         int                           n_iter[],
+                         double                        residue[],
+                         cs_sles_convergence_state_t   state[],
+                         const cs_real_t              *rhs,
+                         cs_real_t                    *vx);
+
 /*----------------------------------------------------------------------------
  * Function pointer for freeing of a linear system's context data.
  *
@@ -555,6 +602,28 @@ cs_sles_get_type(cs_sles_t  *sles);
 void *
 cs_sles_get_context(cs_sles_t  *sles);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Exchange the solver context of a sparse linear equation solver
+ *        with another context of the same type.
+ *
+ * Associated functions are not modified, so both contexts must be handled
+ * by the same functions. The solver must not be currently set up.
+ *
+ * This is intended for switching between alternative settings of a given
+ * solver type while keeping statistics for each setting.
+ *
+ * \param[in, out]  sles     pointer to solver object
+ * \param[in]       context  pointer to new solver context
+ *
+ * \return  pointer to previous solver context
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_sles_exchange_context(cs_sles_t  *sles,
+                         void       *context);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return field id associated with a given sparse linear equation solver.
@@ -584,6 +653,20 @@ cs_sles_get_f_id(const cs_sles_t  *sles);
 const char *
 cs_sles_get_name(const cs_sles_t  *sles);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the total number of iterations of all sparse linear
+ *        equation solvers since the start of the computation.
+ *
+ * Since solves are collective, this count is the same on all ranks.
+ *
+ * \return  cumulative number of linear solver iterations
+ */
+/*----------------------------------------------------------------------------*/
+
+unsigned long long
+cs_sles_get_n_iterations_tot(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Setup sparse linear equation solver.
@@ -650,6 +733,48 @@ cs_sles_solve(cs_sles_t           *sles,
               size_t               aux_size,
               void                *aux_vectors);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sparse linear system resolution for multiple right-hand sides
+ *        sharing the same matrix.
+ *
+ * Right-hand sides and solutions are interleaved, so that rhs[i*n_vecs + k]
+ * is the value of right-hand side k at row i.
+ *
+ * If the associated solver provides a batched solve function (see
+ * \ref cs_sles_set_solve_multi_func), all systems are solved together,
+ * so the matrix is read only once per iteration for all vectors.
+ * Otherwise, or for systems which fail to converge with the batched solver,
+ * systems are solved one by one using \ref cs_sles_solve.
+ *
+ * \param[in, out]  sles           pointer to solver object
+ * \param[in]       a              matrix
+ * \param[in]       rotation_mode  halo update option for rotational periodicity
+ * \param[in]       n_vecs         number of right-hand sides
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residue normalization for each system
+ * \param[out]      n_iter         number of "equivalent" iterations
+ *                                 for each system
+ * \param[out]      residue        residue for each system
+ * \param[in]       rhs            interleaved right hand sides
+ * \param[in, out]  vx             interleaved system solutions
+ *
+ * \return  convergence state (worst of all systems)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_multi(cs_sles_t           *sles,
+                    const cs_matrix_t   *a,
+                    cs_halo_rotation_t   rotation_mode,
+                    int                  n_vecs,
+                    double               precision,
+                    const double         r_norm[],
+                    int                  n_iter[],
+                    double               residue[],
+                    const cs_real_t     *rhs,
+                    cs_real_t           *vx);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free sparse linear equation solver setup.
@@ -713,6 +838,24 @@ void
 cs_sles_set_error_handler(cs_sles_t                *sles,
                           cs_sles_error_handler_t  *error_handler_func);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Associate a batched (multiple right-hand side) solve function
+ *        to a given sparse linear equation solver.
+ *
+ * The association will only be successful if the matching solver
+ * has already been defined.
+ *
+ * \param[in, out]  sles              pointer to solver object
+ * \param[in]       solve_multi_func  pointer to batched solve function,
+ *                                    or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_solve_multi_func(cs_sles_t              *sles,
+                             cs_sles_solve_multi_t  *solve_multi_func);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return pointer to default sparse linear solver definition function.
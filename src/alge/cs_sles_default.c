@@ -61,6 +61,7 @@
 #include "cs_matrix_default.h"
 #include "cs_matrix_util.h"
 #include "cs_multigrid.h"
+#include "cs_parall.h"
 #include "cs_parameters.h"
 #include "cs_sles.h"
 #include "cs_sles_it.h"
@@ -85,10 +86,39 @@ BEGIN_C_DECLS
 
 #define CS_SLES_DEFAULT_N_SETUPS 2  /* Number of concurrent setups allowed */
 
+#define CS_SLES_DEFAULT_ADAPTIVE_N_MAX 5      /* Maximum number of candidate
+                                                 definitions per system */
+#define CS_SLES_DEFAULT_ADAPTIVE_N_SAMPLES 2  /* Number of setups for which
+                                                 each candidate is tried */
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
 
+/* Adaptive solver selection state for a given system; candidate 0 is
+   the reference (default) definition; the active candidate's context
+   is owned by the associated solver, others by this structure */
+
+typedef struct {
+
+  int             n_candidates;   /* number of candidate definitions */
+  int             active_id;      /* id of active candidate */
+  int             n_samples;      /* number of setups of active candidate
+                                     during current evaluation */
+  int             n_settled;      /* remaining setups before next
+                                     evaluation, or -1 during evaluation */
+  bool            pending;        /* solve done since last setup */
+  bool            disabled;       /* adaptation disabled */
+
+  cs_sles_it_t   *c[CS_SLES_DEFAULT_ADAPTIVE_N_MAX];  /* candidates */
+
+  bool            failed[CS_SLES_DEFAULT_ADAPTIVE_N_MAX];  /* failure flag */
+  double          t_sum[CS_SLES_DEFAULT_ADAPTIVE_N_MAX];   /* solve time */
+  unsigned long long  n_iter[CS_SLES_DEFAULT_ADAPTIVE_N_MAX];
+                                                      /* solver iterations */
+
+} _sles_adaptive_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -100,10 +130,401 @@ static cs_matrix_t  *_matrix_setup[CS_SLES_DEFAULT_N_SETUPS][3];
 static const int _poly_degree_default = 0;
 static const int _n_max_iter_default = 10000;
 
+/* Adaptive selection of default solver definitions */
+
+static int                 _adaptive_interval = 0;
+static int                 _n_adaptive = 0;
+static _sles_adaptive_t  **_adaptive = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Log and destroy candidate solver contexts of an adaptive system,
+ * except for the active one (owned by the associated solver).
+ *
+ * parameters:
+ *   s <-> pointer to adaptive selection state
+ *----------------------------------------------------------------------------*/
+
+static void
+_adaptive_disable(_sles_adaptive_t  *s)
+{
+  for (int k = 0; k < s->n_candidates; k++) {
+    if (k == s->active_id || s->c[k] == NULL)
+      continue;
+    cs_sles_it_destroy((void **)&(s->c[k]));
+  }
+
+  s->disabled = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Switch the active candidate of an adaptive system.
+ *
+ * The system must not be currently set up.
+ *
+ * parameters:
+ *   s    <-> pointer to adaptive selection state
+ *   sles <-> associated solver
+ *   k    <-- id of candidate to activate
+ *----------------------------------------------------------------------------*/
+
+static void
+_adaptive_activate(_sles_adaptive_t  *s,
+                   cs_sles_t         *sles,
+                   int                k)
+{
+  if (k == s->active_id)
+    return;
+
+  void *prev = cs_sles_exchange_context(sles, s->c[k]);
+
+  assert(prev == s->c[s->active_id]);
+  CS_UNUSED(prev);
+
+  s->active_id = k;
+}
+
+/*----------------------------------------------------------------------------
+ * Error handler for adaptive systems.
+ *
+ * In case of divergence or breakdown of an alternative candidate, the
+ * candidate is discarded and the solve retried with the reference
+ * definition. Errors with the reference definition are handled
+ * as for non-adaptive systems.
+ *
+ * parameters:
+ *   sles          <-> pointer to solver object
+ *   state         <-- convergence status
+ *   a             <-- matrix
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   rhs           <-- right hand side
+ *   vx            <-> system solution
+ *
+ * returns:
+ *   true if fallback solution is possible, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_adaptive_error(cs_sles_t                    *sles,
+                cs_sles_convergence_state_t   state,
+                const cs_matrix_t            *a,
+                cs_halo_rotation_t            rotation_mode,
+                const cs_real_t               rhs[],
+                cs_real_t                     vx[])
+{
+  const int f_id = cs_sles_get_f_id(sles);
+
+  _sles_adaptive_t *s = (f_id < _n_adaptive) ? _adaptive[f_id] : NULL;
+
+  if (s != NULL && s->disabled == false && s->active_id != 0) {
+
+    s->failed[s->active_id] = true;
+
+    if (state == CS_SLES_MAX_ITERATION)
+      return false;
+
+    cs_sles_free(sles);
+    _adaptive_activate(s, sles, 0);
+
+    const cs_lnum_t *db_size = cs_matrix_get_diag_block_size(a);
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * db_size[1];
+    for (cs_lnum_t i = 0; i < n_cols; i++)
+      vx[i] = 0;
+
+    return true;
+  }
+
+  /* Reference definition: same handling as for default definitions */
+
+  bool use_default_error = false;
+
+  if (s != NULL && s->c[0] != NULL) {
+    cs_sles_pc_t  *pc = cs_sles_it_get_pc(s->c[0]);
+    if (pc != NULL) {
+      if (strcmp(cs_sles_pc_get_type(pc), "multigrid") == 0)
+        use_default_error = true;
+    }
+  }
+
+  if (use_default_error) {
+    bool alternative = cs_sles_default_error(sles, state, a,
+                                             rotation_mode, rhs, vx);
+    /* The solver may have been redefined, so stop adaptation */
+    if (alternative) {
+      _adaptive_disable(s);
+      s->c[0] = NULL;
+    }
+    return alternative;
+  }
+
+  return cs_sles_it_error_post_and_abort(sles, state, a,
+                                         rotation_mode, rhs, vx);
+}
+
+/*----------------------------------------------------------------------------
+ * Add adaptive selection state for a default field system definition.
+ *
+ * parameters:
+ *   f_id      <-- associated field id
+ *   c         <-- reference solver context
+ *   symmetric <-- indicate if matrix is symmetric
+ *----------------------------------------------------------------------------*/
+
+static void
+_adaptive_add(int            f_id,
+              cs_sles_it_t  *c,
+              bool           symmetric)
+{
+  if (f_id >= _n_adaptive) {
+    int n_fields = cs_field_n_fields();
+    BFT_REALLOC(_adaptive, n_fields, _sles_adaptive_t *);
+    for (int i = _n_adaptive; i < n_fields; i++)
+      _adaptive[i] = NULL;
+    _n_adaptive = n_fields;
+  }
+
+  if (_adaptive[f_id] != NULL) {
+    _adaptive_disable(_adaptive[f_id]);
+    BFT_FREE(_adaptive[f_id]);
+  }
+
+  /* Alternative candidates (type, polynomial degree) */
+
+  const cs_sles_it_type_t ref_type = cs_sles_it_get_type(c);
+
+  const cs_sles_it_type_t sym_types[] = {CS_SLES_FCG, CS_SLES_FCG,
+                                         CS_SLES_GCR};
+  const int sym_degree[] = {0, 1, 0};
+
+  const cs_sles_it_type_t nsym_types[] = {CS_SLES_P_GAUSS_SEIDEL,
+                                          CS_SLES_BICGSTAB,
+                                          CS_SLES_GMRES,
+                                          CS_SLES_GCR};
+  const int nsym_degree[] = {-1, 0, 0, 0};
+
+  const cs_sles_it_type_t *types = (symmetric) ? sym_types : nsym_types;
+  const int *degree = (symmetric) ? sym_degree : nsym_degree;
+  int n_alt = (symmetric) ? 3 : 4;
+
+  /* Skip alternatives identical to the reference definition */
+
+  cs_sles_pc_t  *ref_pc = cs_sles_it_get_pc(c);
+  bool ref_mg = false;
+  if (ref_pc != NULL)
+    ref_mg = (strcmp(cs_sles_pc_get_type(ref_pc), "multigrid") == 0);
+
+  _sles_adaptive_t *s;
+  BFT_MALLOC(s, 1, _sles_adaptive_t);
+
+  s->n_candidates = 1;
+  s->c[0] = c;
+
+  for (int i = 0; i < n_alt; i++) {
+    if (   types[i] == ref_type && degree[i] == _poly_degree_default
+        && ref_mg == false)
+      continue;
+    cs_sles_it_t *c_alt = cs_sles_it_create(types[i],
+                                            degree[i],
+                                            _n_max_iter_default,
+                                            true);
+    cs_sles_it_transfer_parameters(c, c_alt);
+    s->c[s->n_candidates] = c_alt;
+    s->n_candidates += 1;
+  }
+
+  for (int k = 0; k < s->n_candidates; k++) {
+    s->failed[k] = false;
+    s->t_sum[k] = 0;
+    s->n_iter[k] = 0;
+  }
+
+  s->active_id = 0;
+  s->n_samples = 0;
+  s->n_settled = -1;
+  s->pending = false;
+  s->disabled = false;
+
+  _adaptive[f_id] = s;
+
+  cs_sles_t *sc = cs_sles_find(f_id, NULL);
+  cs_sles_set_error_handler(sc, _adaptive_error);
+}
+
+/*----------------------------------------------------------------------------
+ * Select the candidate definition of an adaptive system before its setup.
+ *
+ * Each candidate is tried for a given number of setups, after which the
+ * fastest one (based on the maximum time over ranks) is kept for the
+ * adaptive interval, before another evaluation.
+ *
+ * This function is collective, as solves are.
+ *
+ * parameters:
+ *   f_id <-- associated field id
+ *   sles <-> associated solver
+ *----------------------------------------------------------------------------*/
+
+static void
+_adaptive_select(int         f_id,
+                 cs_sles_t  *sles)
+{
+  if (f_id < 0 || f_id >= _n_adaptive)
+    return;
+
+  _sles_adaptive_t *s = _adaptive[f_id];
+
+  if (s == NULL)
+    return;
+  if (s->disabled)
+    return;
+
+  /* Settled: count down to next evaluation */
+
+  if (s->n_settled > 0) {
+    s->n_settled -= 1;
+    if (s->n_settled > 0)
+      return;
+    for (int k = 0; k < s->n_candidates; k++) {
+      s->failed[k] = false;
+      s->t_sum[k] = 0;
+      s->n_iter[k] = 0;
+    }
+    s->n_samples = 0;
+    s->n_settled = -1;
+    s->pending = false;
+    _adaptive_activate(s, sles, 0);
+    return;
+  }
+
+  /* Exploring */
+
+  if (s->pending) {
+    s->n_samples += 1;
+    s->pending = false;
+  }
+
+  if (   s->n_samples < CS_SLES_DEFAULT_ADAPTIVE_N_SAMPLES
+      && s->failed[s->active_id] == false)
+    return;
+
+  if (s->active_id + 1 < s->n_candidates) {
+    _adaptive_activate(s, sles, s->active_id + 1);
+    s->n_samples = 0;
+    return;
+  }
+
+  /* All candidates tried: select fastest */
+
+  double t_max[CS_SLES_DEFAULT_ADAPTIVE_N_MAX];
+  for (int k = 0; k < s->n_candidates; k++)
+    t_max[k] = s->t_sum[k];
+
+  cs_parall_max(s->n_candidates, CS_DOUBLE, t_max);
+
+  int best_id = 0;
+  for (int k = 1; k < s->n_candidates; k++) {
+    if (s->failed[k] == false && t_max[k] < t_max[best_id])
+      best_id = k;
+  }
+
+  _adaptive_activate(s, sles, best_id);
+  s->n_settled = _adaptive_interval;
+
+  cs_sles_pc_t  *pc = cs_sles_it_get_pc(s->c[best_id]);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n  Adaptive linear solver selection for \"%s\":\n"
+                  "    %s (%s), %.3g s for %d setups (reference: %.3g s)\n"),
+                cs_sles_get_name(sles),
+                _(cs_sles_it_type_name[cs_sles_it_get_type(s->c[best_id])]),
+                (pc != NULL) ? _(cs_sles_pc_get_type_name(pc)) : _("none"),
+                t_max[best_id], CS_SLES_DEFAULT_ADAPTIVE_N_SAMPLES,
+                t_max[0]);
+}
+
+/*----------------------------------------------------------------------------
+ * Update adaptive system statistics after a solve.
+ *
+ * parameters:
+ *   f_id     <-- associated field id
+ *   wt       <-- solve wall-clock time (including setup)
+ *   n_iter   <-- number of iterations
+ *   cvg      <-- convergence state
+ *----------------------------------------------------------------------------*/
+
+static void
+_adaptive_update(int                          f_id,
+                 double                       wt,
+                 int                          n_iter,
+                 cs_sles_convergence_state_t  cvg)
+{
+  if (f_id < 0 || f_id >= _n_adaptive)
+    return;
+
+  _sles_adaptive_t *s = _adaptive[f_id];
+
+  if (s == NULL)
+    return;
+  if (s->disabled || s->n_settled > -1)
+    return;
+
+  int k = s->active_id;
+
+  s->t_sum[k] += wt;
+  s->n_iter[k] += n_iter;
+  s->pending = true;
+
+  if (cvg < CS_SLES_ITERATING && k > 0)
+    s->failed[k] = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Log and free adaptive selection states.
+ *----------------------------------------------------------------------------*/
+
+static void
+_adaptive_finalize(void)
+{
+  bool logged = false;
+
+  for (int f_id = 0; f_id < _n_adaptive; f_id++) {
+
+    _sles_adaptive_t *s = _adaptive[f_id];
+    if (s == NULL)
+      continue;
+
+    for (int k = 0; k < s->n_candidates; k++) {
+      if (k == s->active_id || s->c[k] == NULL)
+        continue;
+      if (logged == false) {
+        cs_log_printf(CS_LOG_PERFORMANCE,
+                      _("\n"
+                        "Alternative linear solvers tried by adaptive "
+                        "selection\n"
+                        "----------------------------------------------"
+                        "--------\n"));
+        logged = true;
+      }
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("\nAlternative solver for \"%s\"\n"),
+                    cs_field_by_id(f_id)->name);
+      cs_sles_it_log(s->c[k], CS_LOG_PERFORMANCE);
+    }
+
+    _adaptive_disable(s);
+    BFT_FREE(_adaptive[f_id]);
+  }
+
+  BFT_FREE(_adaptive);
+  _n_adaptive = 0;
+
+  if (logged)
+    cs_log_separator(CS_LOG_PERFORMANCE);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Default definition of a sparse linear equation solver
@@ -123,8 +544,10 @@ _sles_default_native(int                f_id,
                      bool               symmetric)
 {
   int multigrid = 0;
+  int coupling_id = -1;
   cs_sles_it_type_t sles_it_type = CS_SLES_N_IT_TYPES;
   int n_max_iter = _n_max_iter_default;
+  cs_sles_it_t *c = NULL;
 
   if (name != NULL) {
 
@@ -179,8 +602,6 @@ _sles_default_native(int                f_id,
 
   if (sles_it_type == CS_SLES_N_IT_TYPES) {
 
-    int coupling_id = -1;
-
     if (f_id > -1) {
       const cs_field_t *f = cs_field_by_id(f_id);
       coupling_id
@@ -208,11 +629,11 @@ _sles_default_native(int                f_id,
         || (matrix_type >= CS_MATRIX_N_TYPES)) {
       if (sles_it_type == CS_SLES_PCG && cs_glob_n_threads > 1)
         sles_it_type = CS_SLES_FCG;
-      cs_sles_it_t *c = cs_sles_it_define(f_id,
-                                          name,
-                                          sles_it_type,
-                                          -1, /* poly_degree */
-                                          n_max_iter);
+      c = cs_sles_it_define(f_id,
+                            name,
+                            sles_it_type,
+                            -1, /* poly_degree */
+                            n_max_iter);
       cs_sles_pc_t *pc = cs_multigrid_pc_create(CS_MULTIGRID_V_CYCLE);
       cs_sles_it_transfer_pc(c, &pc);
       cs_sles_t *sc = cs_sles_find(f_id, name);
@@ -226,12 +647,17 @@ _sles_default_native(int                f_id,
     cs_multigrid_define(f_id, name, CS_MULTIGRID_V_CYCLE);
 
   else
-    (void)cs_sles_it_define(f_id,
-                            name,
-                            sles_it_type,
-                            _poly_degree_default,
-                            n_max_iter);
+    c = cs_sles_it_define(f_id,
+                          name,
+                          sles_it_type,
+                          _poly_degree_default,
+                          n_max_iter);
+
+  /* Adaptive selection for field systems using iterative solvers */
 
+  if (   _adaptive_interval > 0 && c != NULL
+      && f_id > -1 && name == NULL && coupling_id < 0)
+    _adaptive_add(f_id, c, symmetric);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -514,10 +940,49 @@ cs_sles_default_finalize(void)
 {
   cs_sles_log(CS_LOG_PERFORMANCE);
 
+  _adaptive_finalize();
+
   cs_multigrid_finalize();
   cs_sles_finalize();
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the interval for adaptive selection of default solvers.
+ *
+ * When active (interval > 0), default iterative solver definitions of
+ * field systems are complemented by a few alternative solver and
+ * preconditioner combinations. Each is tried for a few setups, after
+ * which the fastest is used for the given interval (in number of
+ * setups), before a new evaluation.
+ *
+ * This must be called before \ref cs_sles_default_setup to be effective.
+ *
+ * \param[in]  interval  number of setups between evaluations, or 0
+ *                       to disable adaptive selection (default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_set_adaptive(int  interval)
+{
+  _adaptive_interval = CS_MAX(interval, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the interval for adaptive selection of default solvers.
+ *
+ * \return  number of setups between evaluations, or 0 if not active
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_sles_default_get_adaptive(void)
+{
+  return _adaptive_interval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return default verbosity associated to a field id, name couple.
@@ -759,6 +1224,11 @@ cs_sles_solve_native(int                  f_id,
 
   if (setup_id >= _n_setups) {
 
+    /* Select definition if adaptive (before setup) */
+
+    if (_n_adaptive > 0)
+      _adaptive_select(f_id, sc);
+
     _n_setups += 1;
 
     if (_n_setups > CS_SLES_DEFAULT_N_SETUPS)
@@ -844,6 +1314,8 @@ cs_sles_solve_native(int                  f_id,
 
   /* Solve system */
 
+  double wt0 = (_n_adaptive > 0) ? cs_timer_wtime() : 0.;
+
   cvg = cs_sles_solve(sc,
                       a,
                       rotation_mode,
@@ -856,6 +1328,9 @@ cs_sles_solve_native(int                  f_id,
                       0,
                       NULL);
 
+  if (_n_adaptive > 0)
+    _adaptive_update(f_id, cs_timer_wtime() - wt0, *n_iter, cvg);
+
   BFT_FREE(_rhs);
   if (_vx != vx) {
     size_t stride = 1;
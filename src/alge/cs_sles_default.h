@@ -86,6 +86,35 @@ cs_sles_default(int                 f_id,
 void
 cs_sles_default_setup(void);
 
+/*----------------------------------------------------------------------------
+ * Set the interval for adaptive selection of default solvers.
+ *
+ * When active (interval > 0), default iterative solver definitions of
+ * field systems are complemented by a few alternative solver and
+ * preconditioner combinations. Each is tried for a few setups, after
+ * which the fastest is used for the given interval (in number of
+ * setups), before a new evaluation.
+ *
+ * This must be called before cs_sles_default_setup to be effective.
+ *
+ * parameters:
+ *   interval <-- number of setups between evaluations, or 0 to
+ *                disable adaptive selection (default)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_set_adaptive(int  interval);
+
+/*----------------------------------------------------------------------------
+ * Return the interval for adaptive selection of default solvers.
+ *
+ * returns:
+ *   number of setups between evaluations, or 0 if not active
+ *----------------------------------------------------------------------------*/
+
+int
+cs_sles_default_get_adaptive(void);
+
 /*----------------------------------------------------------------------------
  * Return default verbosity associated to a field id, name couple.
  *
@@ -46,6 +46,12 @@
  * Local headers
  *----------------------------------------------------------------------------*/
 
+#if defined(HAVE_CUDA)
+#include "cs_base_cuda.h"
+#include "cs_blas_cuda.h"
+#include "cs_matrix_cuda.h"
+#endif
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -118,17 +124,34 @@ static int _thread_debug = 0;
 
 static cs_lnum_t _pcg_sr_threshold = 512;
 
+/* Default maximum number of vectors in deflation subspace, and relative
+   tolerance under which a vector is considered linearly dependent */
+
+static int _deflation_n_max = 4;
+static double _deflation_eps = 1e-10;
+
+/* Use device-resident PCG when possible ? */
+
+static bool _pcg_use_device = false;
+
+/* Number of basis vectors generated per block in s-step GMRES */
+
+static int _gmres_s_step = 5;
+
 /* Sparse linear equation solver type names */
 
 const char *cs_sles_it_type_name[]
   = {N_("Conjugate Gradient"),
      N_("Flexible Conjugate Gradient"),
      N_("Inexact Preconditioned Conjugate Gradient"),
+     N_("Pipelined Conjugate Gradient"),
+     N_("Deflated Conjugate Gradient"),
      N_("Jacobi"),
      N_("BiCGstab"),
      N_("BiCGstab2"),
      N_("GCR"),
      N_("GMRES"),
+     N_("s-step GMRES"),
      N_("Gauss-Seidel"),
      N_("Symmetric Gauss-Seidel"),
      N_("3-layer conjugate residual"),
@@ -136,6 +159,7 @@ const char *cs_sles_it_type_name[]
      N_("None"), /* Smoothers beyond this */
      N_("Truncated forward Gauss-Seidel"),
      N_("Truncated backwards Gauss-Seidel"),
+     N_("Chebyshev"),
 };
 
 /*=============================================================================
@@ -445,6 +469,273 @@ _conjugate_gradient(cs_sles_it_t              *c,
   return cvg;
 }
 
+#if defined(HAVE_CUDA)
+
+/*----------------------------------------------------------------------------
+ * Sum device dot product results over all ranks.
+ *
+ * parameters:
+ *   c <-- pointer to solver context info
+ *   n <-- number of values
+ *   s <-> local values in, global sums out
+ *----------------------------------------------------------------------------*/
+
+static void
+_dot_products_sum_cuda(const cs_sles_it_t  *c,
+                       int                  n,
+                       double               s[])
+{
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL) {
+    double _sum[2];
+    assert(n <= 2);
+    MPI_Allreduce(s, _sum, n, MPI_DOUBLE, MPI_SUM, c->comm);
+    for (int i = 0; i < n; i++)
+      s[i] = _sum[i];
+  }
+
+#else
+
+  CS_UNUSED(c);
+  CS_UNUSED(n);
+  CS_UNUSED(s);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Setup device-resident data for preconditioned conjugate gradient
+ * if possible.
+ *
+ * This requires an available CUDA device, a scalar CSR or MSR matrix
+ * and Jacobi preconditioning.
+ *
+ * parameters:
+ *   c <-> pointer to solver context info
+ *   a <-- matrix
+ *
+ * returns:
+ *   true if the device-resident variant may be used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_conjugate_gradient_cuda_setup(cs_sles_it_t       *c,
+                               const cs_matrix_t  *a)
+{
+  cs_sles_it_setup_t  *sd = c->setup_data;
+
+  cs_matrix_cuda_destroy(&(sd->d_matrix));
+  cs_base_cuda_free(sd->d_wa);
+  sd->d_wa = NULL;
+
+  if (_pcg_use_device == false)
+    return false;
+
+  if (c->pc == NULL)
+    return false;
+  if (strcmp(cs_sles_pc_get_type(c->pc), "jacobi") != 0)
+    return false;
+
+  if (cs_matrix_cuda_is_supported(a) == false)
+    return false;
+
+  if (cs_base_cuda_select_default_device() < 0)
+    return false;
+
+  sd->d_matrix = cs_matrix_cuda_create(a);
+
+  const size_t n_wa = 6;
+  const size_t wa_size = CS_SIMD_SIZE(cs_matrix_get_n_columns(a));
+
+  sd->d_wa = cs_base_cuda_malloc(wa_size * n_wa * sizeof(cs_real_t));
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Jacobi-preconditioned conjugate gradient,
+ * with matrix and vectors resident on a CUDA device.
+ *
+ * This is the same algorithm as _conjugate_gradient, with the same
+ * sequence of global reductions, so ranks without a device may use
+ * the host variant. Only the solution and right-hand side are copied
+ * to and from the device for each solve, and halo values for each
+ * matrix.vector product.
+ *
+ * Rotational periodicity is not handled here.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size (unused here)
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *                       (unused here)
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (unused here)
+ *   aux_vectors     --- optional working area (unused here)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_conjugate_gradient_cuda(cs_sles_it_t              *c,
+                         const cs_matrix_t         *a,
+                         cs_lnum_t                  diag_block_size,
+                         cs_halo_rotation_t         rotation_mode,
+                         cs_sles_it_convergence_t  *convergence,
+                         const cs_real_t           *rhs,
+                         cs_real_t                 *restrict vx,
+                         size_t                     aux_size,
+                         void                      *aux_vectors)
+{
+  CS_UNUSED(diag_block_size);
+  CS_UNUSED(rotation_mode);
+  CS_UNUSED(aux_size);
+  CS_UNUSED(aux_vectors);
+
+  cs_sles_convergence_state_t cvg;
+  double  ro_0, ro_1, alpha, rk_gkm1, rk_gk, beta, residue;
+  double  s[2];
+
+  unsigned n_iter = 0;
+
+  /* Map device work arrays */
+  /*------------------------*/
+
+  assert(c->setup_data != NULL && c->setup_data->d_matrix != NULL);
+
+  cs_matrix_cuda_t  *dm = c->setup_data->d_matrix;
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const size_t wa_size = CS_SIMD_SIZE(cs_matrix_get_n_columns(a));
+
+  cs_real_t  *d_vx = c->setup_data->d_wa;
+  cs_real_t  *d_rhs = d_vx + wa_size;
+  cs_real_t  *rk = d_vx + wa_size*2;
+  cs_real_t  *dk = d_vx + wa_size*3;
+  cs_real_t  *gk = d_vx + wa_size*4;
+  cs_real_t  *zk = d_vx + wa_size*5;
+
+  cs_base_cuda_copy_h2d(d_vx, vx, n_rows*sizeof(cs_real_t));
+  cs_base_cuda_copy_h2d(d_rhs, rhs, n_rows*sizeof(cs_real_t));
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residue and descent direction */
+
+  cs_matrix_cuda_vector_multiply(dm, d_vx, rk);  /* rk = A.x0 */
+
+  cs_blas_cuda_axpy(n_rows, -1., d_rhs, rk);
+
+  /* Preconditioning */
+
+  cs_matrix_cuda_jacobi_apply(dm, rk, gk);
+
+  /* Descent direction */
+  /*-------------------*/
+
+  cs_base_cuda_copy_d2d(dk, gk, n_rows*sizeof(cs_real_t));
+
+  cs_blas_cuda_dot_xx_xy(n_rows, rk, gk, s, s+1);
+  _dot_products_sum_cuda(c, 2, s);
+  residue = sqrt(s[0]);
+  rk_gkm1 = s[1];
+
+  /* If no solving required, finish here */
+
+  c->setup_data->initial_residue = residue;
+  cvg = _convergence_test(c, n_iter, residue, convergence);
+
+  if (cvg == CS_SLES_ITERATING) {
+
+    n_iter = 1;
+
+    cs_matrix_cuda_vector_multiply(dm, dk, zk);
+
+    /* Descent parameter */
+
+    cs_blas_cuda_dot_xy_yz(n_rows, rk, dk, zk, s, s+1);
+    _dot_products_sum_cuda(c, 2, s);
+    ro_0 = s[0];
+    ro_1 = s[1];
+
+    cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
+    alpha =  - ro_0 * d_ro_1;
+
+    cs_blas_cuda_axpy(n_rows, alpha, dk, d_vx);
+    cs_blas_cuda_axpy(n_rows, alpha, zk, rk);
+
+    /* Convergence test */
+
+    s[0] = cs_blas_cuda_dot(n_rows, rk, rk);
+    _dot_products_sum_cuda(c, 1, s);
+    residue = sqrt(s[0]);
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    /* Current Iteration */
+    /*-------------------*/
+
+  }
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Preconditioning */
+
+    cs_matrix_cuda_jacobi_apply(dm, rk, gk);
+
+    /* compute residue and prepare descent parameter */
+
+    cs_blas_cuda_dot_xx_xy(n_rows, rk, gk, s, s+1);
+    _dot_products_sum_cuda(c, 2, s);
+    residue = sqrt(s[0]);
+    rk_gk = s[1];
+
+    /* Convergence test for end of previous iteration */
+
+    if (n_iter > 1)
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    n_iter += 1;
+
+    /* Complete descent parameter computation and matrix.vector product */
+
+    beta = rk_gk / rk_gkm1;
+    rk_gkm1 = rk_gk;
+
+    cs_blas_cuda_axpby(n_rows, 1., gk, beta, dk);  /* dk = gk + beta.dk */
+
+    cs_matrix_cuda_vector_multiply(dm, dk, zk);
+
+    cs_blas_cuda_dot_xy_yz(n_rows, rk, dk, zk, s, s+1);
+    _dot_products_sum_cuda(c, 2, s);
+    ro_0 = s[0];
+    ro_1 = s[1];
+
+    cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
+    alpha =  - ro_0 * d_ro_1;
+
+    cs_blas_cuda_axpy(n_rows, alpha, dk, d_vx);
+    cs_blas_cuda_axpy(n_rows, alpha, zk, rk);
+
+  }
+
+  cs_base_cuda_copy_d2h(vx, d_vx, n_rows*sizeof(cs_real_t));
+
+  return cvg;
+}
+
+#endif /* defined(HAVE_CUDA) */
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using flexible preconditioned conjugate gradient.
  *
@@ -1404,14 +1695,21 @@ _conjugate_gradient_npc_sr(cs_sles_it_t              *c,
 }
 
 /*----------------------------------------------------------------------------
- * Solution of A.vx = Rhs using preconditioned 3-layer conjugate residual.
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient.
+ *
+ * This variant (Ghysels and Vanroose, "Hiding global synchronization
+ * latency in the preconditioned Conjugate Gradient algorithm", Parallel
+ * Computing, 2014) groups the dot products of each iteration in a single
+ * global reduction, which is overlapped with the preconditioning and
+ * matrix.vector product of that iteration when non-blocking collectives
+ * are available (MPI 3 or above).
  *
  * On entry, vx is considered initialized.
  *
  * parameters:
  *   c               <-- pointer to solver context info
  *   a               <-- matrix
- *   diag_block_size <-- block size of element ii, ii
+ *   diag_block_size <-- diagonal block size
  *   rotation_mode   <-- halo update option for rotational periodicity
  *   convergence     <-- convergence information structure
  *   rhs             <-- right hand side
@@ -1424,25 +1722,27 @@ _conjugate_gradient_npc_sr(cs_sles_it_t              *c,
  *----------------------------------------------------------------------------*/
 
 static cs_sles_convergence_state_t
-_conjugate_residual_3(cs_sles_it_t              *c,
-                      const cs_matrix_t         *a,
-                      cs_lnum_t                  diag_block_size,
-                      cs_halo_rotation_t         rotation_mode,
-                      cs_sles_it_convergence_t  *convergence,
-                      const cs_real_t           *rhs,
-                      cs_real_t                 *restrict vx,
-                      size_t                     aux_size,
-                      void                      *aux_vectors)
+_conjugate_gradient_pipelined(cs_sles_it_t              *c,
+                              const cs_matrix_t         *a,
+                              cs_lnum_t                  diag_block_size,
+                              cs_halo_rotation_t         rotation_mode,
+                              cs_sles_it_convergence_t  *convergence,
+                              const cs_real_t           *rhs,
+                              cs_real_t                 *restrict vx,
+                              size_t                     aux_size,
+                              void                      *aux_vectors)
 {
   cs_sles_convergence_state_t cvg;
-  cs_lnum_t  ii;
-  double  residue;
-  double  ak, bk, ck, dk, ek, denom, alpha, tau;
-  cs_real_t *_aux_vectors;
-  cs_real_t  *restrict vxm1;
-  cs_real_t  *restrict rk, *restrict rkm1;
-  cs_real_t  *restrict wk, *restrict zk;
-  cs_real_t  *restrict tmp;
+  double  alpha = 0., beta = 0., gamma_km1 = 0., residue;
+  double  s_loc[3], s_glob[3];
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict uk, *restrict wk, *restrict mk;
+  cs_real_t  *restrict nk, *restrict zk, *restrict qk, *restrict sk;
+  cs_real_t  *restrict pk;
+
+#if defined(HAVE_MPI)
+  MPI_Request request = MPI_REQUEST_NULL;
+#endif
 
   unsigned n_iter = 0;
 
@@ -1455,7 +1755,7 @@ _conjugate_residual_3(cs_sles_it_t              *c,
 
   {
     const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
-    const size_t n_wa = 6;
+    const size_t n_wa = 9;
     const size_t wa_size = CS_SIMD_SIZE(n_cols);
 
     if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
@@ -1463,110 +1763,121 @@ _conjugate_residual_3(cs_sles_it_t              *c,
     else
       _aux_vectors = aux_vectors;
 
-    vxm1 = _aux_vectors;
-    rk = _aux_vectors + wa_size;
-    rkm1 = _aux_vectors + wa_size*2;
-    tmp = _aux_vectors + wa_size*3;
-    wk = _aux_vectors + wa_size*4;
+    rk = _aux_vectors;
+    uk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    mk = _aux_vectors + wa_size*3;
+    nk = _aux_vectors + wa_size*4;
     zk = _aux_vectors + wa_size*5;
-
-#   pragma omp parallel for if(n_rows > CS_THR_MIN)
-    for (ii = 0; ii < n_rows; ii++) {
-      vxm1[ii] = vx[ii];
-      rkm1[ii] = 0.0;
-    }
+    qk = _aux_vectors + wa_size*6;
+    sk = _aux_vectors + wa_size*7;
+    pk = _aux_vectors + wa_size*8;
   }
 
   /* Initialize iterative calculation */
   /*----------------------------------*/
 
-  /* Residue */
+  /* Residue, preconditioned residue, and its matrix.vector product */
 
   cs_matrix_vector_multiply(rotation_mode, a, vx, rk);  /* rk = A.x0 */
 
 # pragma omp parallel for if(n_rows > CS_THR_MIN)
-  for (ii = 0; ii < n_rows; ii++)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
     rk[ii] -= rhs[ii];
 
-  residue = _dot_product(c, rk, rk);
-  residue = sqrt(residue);
-
-  /* If no solving required, finish here */
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          rk,
+                          uk);
 
-  c->setup_data->initial_residue = residue;
-  cvg = _convergence_test(c, n_iter, residue, convergence);
+  cs_matrix_vector_multiply(rotation_mode, a, uk, wk);  /* wk = A.uk */
 
   /* Current Iteration */
   /*-------------------*/
 
-  while (cvg == CS_SLES_ITERATING) {
+  while (true) {
 
-    /* Preconditionning */
+    /* Start reduction of rk.rk, rk.uk and uk.wk */
 
-    c->setup_data->pc_apply(c->setup_data->pc_context,
-                            rotation_mode,
-                            rk,
-                            wk);
+    cs_dot_xx_xy_yz(n_rows, rk, uk, wk, s_loc, s_loc+1, s_loc+2);
 
-    cs_matrix_vector_multiply(rotation_mode, a, wk, zk);
+#if defined(HAVE_MPI)
 
-    _dot_products_xy_yz(c, rk, zk, rkm1, &ak, &bk);
+    if (c->comm != MPI_COMM_NULL) {
+#if (MPI_VERSION >= 3)
+      MPI_Iallreduce(s_loc, s_glob, 3, MPI_DOUBLE, MPI_SUM, c->comm,
+                     &request);
+#else
+      MPI_Allreduce(s_loc, s_glob, 3, MPI_DOUBLE, MPI_SUM, c->comm);
+#endif
+    }
+    else
+      memcpy(s_glob, s_loc, 3*sizeof(double));
 
-#   pragma omp parallel for if(n_rows > CS_THR_MIN)
-    for (ii = 0; ii < n_rows; ii++)
-      tmp[ii] = rk[ii] - rkm1[ii];
+#else
 
-    _dot_products_xy_yz(c, rk, tmp, rkm1, &ck, &dk);
+    memcpy(s_glob, s_loc, 3*sizeof(double));
 
-    ek = _dot_product_xx(c, zk);
+#endif /* defined(HAVE_MPI) */
 
-    denom = (ck-dk)*ek - ((ak-bk)*(ak-bk));
+    /* Overlap reduction with preconditioning and matrix.vector product */
 
-    if (fabs(denom) < 1.e-30)
-      alpha = 1.0;
-    else
-      alpha = ((ak-bk)*bk - dk*ek)/denom;
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            wk,
+                            mk);
 
-    if (fabs(alpha) < 1.e-30 || fabs(alpha - 1.) < 1.e-30) {
-      alpha = 1.0;
-      tau = ak/ek;
-    }
-    else
-      tau = ak/ek + ((1 - alpha)/alpha) * bk/ek;
+    cs_matrix_vector_multiply(rotation_mode, a, mk, nk);  /* nk = A.mk */
 
-    cs_real_t c0 = (1 - alpha);
-    cs_real_t c1 = -alpha*tau;
+#if defined(HAVE_MPI)
+    if (request != MPI_REQUEST_NULL)
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+#endif
 
-#   pragma omp parallel firstprivate(alpha, tau, c0, c1) if(n_rows > CS_THR_MIN)
-    {
-#     pragma omp for nowait
-      for (ii = 0; ii < n_rows; ii++) {
-        cs_real_t trk = rk[ii];
-        rk[ii] = alpha*rk[ii] + c0*rkm1[ii] + c1*zk[ii];
-        rkm1[ii] = trk;
-      }
-#     pragma omp for nowait
-      for (ii = 0; ii < n_rows; ii++) {
-        cs_real_t tvx = vx[ii];
-        vx[ii] = alpha*vx[ii] + c0*vxm1[ii] + c1*wk[ii];
-        vxm1[ii] = tvx;
-      }
-    }
+    const double gamma_k = s_glob[1], delta_k = s_glob[2];
 
-    /* compute residue */
+    residue = sqrt(s_glob[0]);
 
-    residue = sqrt(_dot_product(c, rk, rk));
+    /* If no solving required, finish here */
 
-    /* Convergence test for end of previous iteration */
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
 
-    if (n_iter > 1)
-      cvg = _convergence_test(c, n_iter, residue, convergence);
+    cvg = _convergence_test(c, n_iter, residue, convergence);
 
     if (cvg != CS_SLES_ITERATING)
       break;
 
+    /* Descent parameters */
+
+    if (n_iter == 0) {
+      beta = 0.;
+      alpha = (CS_ABS(delta_k) > DBL_MIN) ? gamma_k / delta_k : 0.;
+    }
+    else {
+      beta = (CS_ABS(gamma_km1) > DBL_MIN) ? gamma_k / gamma_km1 : 0.;
+      double d_alpha = (CS_ABS(alpha) > DBL_MIN) ? 1. / alpha : 0.;
+      double denom = delta_k - beta * gamma_k * d_alpha;
+      alpha = (CS_ABS(denom) > DBL_MIN) ? gamma_k / denom : 0.;
+    }
+    gamma_km1 = gamma_k;
+
     n_iter += 1;
 
+    /* Update recurrences (fused, single pass over the working arrays) */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      zk[ii] = nk[ii] + beta * zk[ii];
+      qk[ii] = mk[ii] + beta * qk[ii];
+      sk[ii] = wk[ii] + beta * sk[ii];
+      pk[ii] = uk[ii] + beta * pk[ii];
+      vx[ii] -= alpha * pk[ii];
+      rk[ii] -= alpha * sk[ii];
+      uk[ii] -= alpha * qk[ii];
+      wk[ii] -= alpha * zk[ii];
+    }
+
   }
 
   if (_aux_vectors != aux_vectors)
@@ -1576,142 +1887,207 @@ _conjugate_residual_3(cs_sles_it_t              *c,
 }
 
 /*----------------------------------------------------------------------------
- * Solution of A.vx = Rhs using Jacobi.
+ * Sum an array of values over all ranks of the solver's communicator.
  *
- * On entry, vx is considered initialized.
+ * parameters:
+ *   c <-- pointer to solver context info
+ *   n <-- number of values
+ *   s <-> local values in, global sums out
+ *----------------------------------------------------------------------------*/
+
+static void
+_sum_over_ranks(const cs_sles_it_t  *c,
+                int                  n,
+                double               s[])
+{
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL && n > 0) {
+    double *_sum;
+    BFT_MALLOC(_sum, n, double);
+    MPI_Allreduce(s, _sum, n, MPI_DOUBLE, MPI_SUM, c->comm);
+    for (int i = 0; i < n; i++)
+      s[i] = _sum[i];
+    BFT_FREE(_sum);
+  }
+
+#else
+
+  CS_UNUSED(c);
+  CS_UNUSED(n);
+  CS_UNUSED(s);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Cholesky factorization of the (small) deflation subspace matrix.
  *
  * parameters:
- *   c               <-- pointer to solver context info
- *   a               <-- linear equation matrix
- *   diag_block_size <-- diagonal block size
- *   rotation_mode   <-- halo update option for rotational periodicity
- *   convergence     <-- convergence information structure
- *   rhs             <-- right hand side
- *   vx              <-> system solution
- *   aux_size        <-- number of elements in aux_vectors (in bytes)
- *   aux_vectors     --- optional working area (allocation otherwise)
+ *   n <-- matrix size
+ *   e <-- symmetric matrix (n*n)
+ *   l --> lower triangular factor (n*n)
  *
  * returns:
- *   convergence state
+ *   id of first column with a null or negative pivot, or -1 if
+ *   factorization is successful
  *----------------------------------------------------------------------------*/
 
-static cs_sles_convergence_state_t
-_jacobi(cs_sles_it_t              *c,
-        const cs_matrix_t         *a,
-        cs_lnum_t                  diag_block_size,
-        cs_halo_rotation_t         rotation_mode,
-        cs_sles_it_convergence_t  *convergence,
-        const cs_real_t           *rhs,
-        cs_real_t                 *restrict vx,
-        size_t                     aux_size,
-        void                      *aux_vectors)
+static int
+_deflation_factor(int           n,
+                  const double  e[],
+                  double        l[])
 {
-  cs_sles_convergence_state_t cvg;
-  cs_lnum_t  ii;
-  double  res2, residue;
-  cs_real_t *_aux_vectors;
-  cs_real_t *restrict rk;
+  for (int j = 0; j < n; j++) {
 
-  unsigned n_iter = 0;
+    double d = e[j*n + j];
+    for (int k = 0; k < j; k++)
+      d -= l[j*n + k]*l[j*n + k];
 
-  /* Allocate or map work arrays */
-  /*-----------------------------*/
+    if (!(d > _deflation_eps * e[j*n + j]))
+      return j;
 
-  assert(c->setup_data != NULL);
+    l[j*n + j] = sqrt(d);
 
-  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+    for (int i = j+1; i < n; i++) {
+      double s = e[i*n + j];
+      for (int k = 0; k < j; k++)
+        s -= l[i*n + k]*l[j*n + k];
+      l[i*n + j] = s / l[j*n + j];
+    }
 
-  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  }
 
-  {
-    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
-    const size_t n_wa = 1;
-    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+  return -1;
+}
 
-    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
-      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
-    else
-      _aux_vectors = aux_vectors;
+/*----------------------------------------------------------------------------
+ * Solve L.L^t.x = b with the factor of the deflation subspace matrix.
+ *
+ * parameters:
+ *   n <-- matrix size
+ *   l <-- lower triangular factor (n*n)
+ *   x <-> right hand side in, solution out
+ *----------------------------------------------------------------------------*/
 
-    rk = _aux_vectors;
+static void
+_deflation_solve(int           n,
+                 const double  l[],
+                 double        x[])
+{
+  for (int i = 0; i < n; i++) {
+    for (int k = 0; k < i; k++)
+      x[i] -= l[i*n + k]*x[k];
+    x[i] /= l[i*n + i];
   }
 
-  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+  for (int i = n-1; i >= 0; i--) {
+    for (int k = i+1; k < n; k++)
+      x[i] -= l[k*n + i]*x[k];
+    x[i] /= l[i*n + i];
+  }
+}
 
-  cvg = CS_SLES_ITERATING;
+/*----------------------------------------------------------------------------
+ * Add a solution vector to the deflation subspace.
+ *
+ * The vector is orthonormalized against the current subspace (using
+ * two passes of classical Gram-Schmidt), and added only if it is not
+ * almost linearly dependent on it. If the subspace is full, its oldest
+ * vector is discarded.
+ *
+ * parameters:
+ *   c  <-- pointer to solver context info
+ *   df <-> deflation subspace
+ *   x  <-- vector to add
+ *   v  --- work array (size: n_rows)
+ *----------------------------------------------------------------------------*/
 
-  /* Current iteration */
-  /*-------------------*/
+static void
+_deflation_update(const cs_sles_it_t      *c,
+                  cs_sles_it_deflation_t  *df,
+                  const cs_real_t         *restrict x,
+                  cs_real_t               *restrict v)
+{
+  const cs_lnum_t n_rows = df->n_rows;
 
-  while (cvg == CS_SLES_ITERATING) {
+  if (df->n_max < 1)
+    return;
 
-    n_iter += 1;
+  if (df->n_vectors == df->n_max) {
+    memmove(df->w, df->w + n_rows,
+            (df->n_max-1)*n_rows*sizeof(cs_real_t));
+    df->n_vectors -= 1;
+  }
 
-#if defined(HAVE_OPENMP)
+  const int n_w = df->n_vectors;
+  const cs_real_t *restrict w = df->w;
 
-#   pragma omp parallel for if(n_rows > CS_THR_MIN)
-    for (ii = 0; ii < n_rows; ii++)
-      rk[ii] = vx[ii];
+  double *h;
+  BFT_MALLOC(h, n_w + 1, double);
 
-#else
+  memcpy(v, x, n_rows * sizeof(cs_real_t));
 
-    memcpy(rk, vx, n_rows * sizeof(cs_real_t));   /* rk <- vx */
+  double x_norm2 = 0;
 
-#endif
+  for (int pass = 0; pass < 2; pass++) {
 
-    /* Compute Vx <- Vx - (A-diag).Rk and residue. */
+    for (int j = 0; j < n_w; j++)
+      h[j] = cs_dot(n_rows, w + j*n_rows, v);
+    h[n_w] = (pass == 0) ? cs_dot(n_rows, x, x) : 0;
 
-    cs_matrix_exdiag_vector_multiply(rotation_mode, a, rk, vx);
+    _sum_over_ranks(c, n_w + 1, h);
 
-    res2 = 0.0;
+    if (pass == 0)
+      x_norm2 = h[n_w];
 
-#   pragma omp parallel for reduction(+:res2) if(n_rows > CS_THR_MIN)
-    for (ii = 0; ii < n_rows; ii++) {
-      vx[ii] = (rhs[ii]-vx[ii])*ad_inv[ii];
-      double r = ad[ii] * (vx[ii]-rk[ii]);
-      res2 += (r*r);
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      for (int j = 0; j < n_w; j++)
+        v[ii] -= h[j] * w[j*n_rows + ii];
     }
 
-#if defined(HAVE_MPI)
+  }
 
-    if (c->comm != MPI_COMM_NULL) {
-      double _sum;
-      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
-      res2 = _sum;
-    }
+  BFT_FREE(h);
 
-#endif /* defined(HAVE_MPI) */
+  double v_norm2 = _dot_product_xx(c, v);
 
-    residue = sqrt(res2); /* Actually, residue of previous iteration */
+  if (v_norm2 > _deflation_eps * x_norm2 && v_norm2 > 0) {
 
-    /* Convergence test */
+    const double scale = 1. / sqrt(v_norm2);
+    cs_real_t *restrict w_n = df->w + n_w*n_rows;
 
-    if (n_iter == 1)
-      c->setup_data->initial_residue = residue;
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      w_n[ii] = v[ii] * scale;
 
-    cvg = _convergence_test(c, n_iter, residue, convergence);
+    df->n_vectors += 1;
 
   }
-
-  if (_aux_vectors != aux_vectors)
-    BFT_FREE(_aux_vectors);
-
-  return cvg;
 }
 
 /*----------------------------------------------------------------------------
- * Solution of A.vx = Rhs using block Jacobi.
+ * Solution of A.vx = Rhs using deflated preconditioned conjugate gradient.
+ *
+ * The deflation subspace W is spanned by the solutions of previous solves
+ * with the same context. The initial guess is first corrected by Galerkin
+ * projection on W, then the search directions are kept A-orthogonal to W,
+ * which removes the associated (generally slowly converging) components
+ * from the Krylov iterations. The subspace is updated with the solution
+ * at the end of each solve, and requires one additional matrix-vector
+ * product per subspace vector at the start of each solve.
  *
  * On entry, vx is considered initialized.
  *
  * parameters:
  *   c               <-- pointer to solver context info
- *   a               <-- linear equation matrix
- *   diag_block_size <-- diagonal block size (unused here)
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
  *   rotation_mode   <-- halo update option for rotational periodicity
  *   convergence     <-- convergence information structure
  *   rhs             <-- right hand side
- *   vx              --> system solution
+ *   vx              <-> system solution
  *   aux_size        <-- number of elements in aux_vectors (in bytes)
  *   aux_vectors     --- optional working area (allocation otherwise)
  *
@@ -1720,24 +2096,22 @@ _jacobi(cs_sles_it_t              *c,
  *----------------------------------------------------------------------------*/
 
 static cs_sles_convergence_state_t
-_block_3_jacobi(cs_sles_it_t              *c,
-                const cs_matrix_t         *a,
-                cs_lnum_t                  diag_block_size,
-                cs_halo_rotation_t         rotation_mode,
-                cs_sles_it_convergence_t  *convergence,
-                const cs_real_t           *rhs,
-                cs_real_t                 *restrict vx,
-                size_t                     aux_size,
-                void                      *aux_vectors)
+_conjugate_gradient_deflated(cs_sles_it_t              *c,
+                             const cs_matrix_t         *a,
+                             cs_lnum_t                  diag_block_size,
+                             cs_halo_rotation_t         rotation_mode,
+                             cs_sles_it_convergence_t  *convergence,
+                             const cs_real_t           *rhs,
+                             cs_real_t                 *restrict vx,
+                             size_t                     aux_size,
+                             void                      *aux_vectors)
 {
-  CS_UNUSED(diag_block_size);
-
-  assert(diag_block_size == 3);
-
   cs_sles_convergence_state_t cvg;
-  double  res2, residue;
-  cs_real_t *_aux_vectors;
-  cs_real_t  *restrict rk, *restrict vxx;
+  double  rk_gk, rk_gkm1, residue;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict dk, *restrict gk, *restrict zk;
+  cs_real_t  *restrict aw = NULL;
+  double  *e = NULL, *l = NULL, *mu = NULL;
 
   unsigned n_iter = 0;
 
@@ -1746,14 +2120,11 @@ _block_3_jacobi(cs_sles_it_t              *c,
 
   assert(c->setup_data != NULL);
 
-  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
-
   const cs_lnum_t n_rows = c->setup_data->n_rows;
-  const cs_lnum_t n_blocks = c->setup_data->n_rows / 3;
 
   {
     const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
-    const size_t n_wa = 2;
+    const size_t n_wa = 4;
     const size_t wa_size = CS_SIMD_SIZE(n_cols);
 
     if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
@@ -1761,66 +2132,969 @@ _block_3_jacobi(cs_sles_it_t              *c,
     else
       _aux_vectors = aux_vectors;
 
-    rk  = _aux_vectors;
-    vxx = _aux_vectors + wa_size;
+    rk = _aux_vectors;
+    dk = _aux_vectors + wa_size;
+    gk = _aux_vectors + wa_size*2;
+    zk = _aux_vectors + wa_size*3;
   }
 
-  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+  /* Deflation subspace; reset it on all ranks if the number of rows
+     changed on any rank */
 
-  cvg = CS_SLES_ITERATING;
+  if (c->deflation == NULL)
+    cs_sles_it_set_n_deflation_vectors(c, _deflation_n_max);
 
-  /* Current iteration */
-  /*-------------------*/
+  cs_sles_it_deflation_t *df = c->deflation;
 
-  while (cvg == CS_SLES_ITERATING) {
+  {
+    int reset = (df->n_rows != n_rows) ? 1 : 0;
 
-    n_iter += 1;
-    memcpy(rk, vx, n_rows * sizeof(cs_real_t));  /* rk <- vx */
+#if defined(HAVE_MPI)
+    if (c->comm != MPI_COMM_NULL) {
+      int _reset = reset;
+      MPI_Allreduce(&_reset, &reset, 1, MPI_INT, MPI_MAX, c->comm);
+    }
+#endif
 
-    /* Compute vxx <- vx - (a-diag).rk and residue. */
+    if (reset) {
+      df->n_vectors = 0;
+      df->n_rows = n_rows;
+      BFT_REALLOC(df->w, (size_t)(df->n_max)*n_rows, cs_real_t);
+    }
+  }
 
-    cs_matrix_exdiag_vector_multiply(rotation_mode, a, rk, vxx);
+  int n_w = df->n_vectors;
+  const int n_w_max = CS_MAX(n_w, 1);
 
-    res2 = 0.0;
+  BFT_MALLOC(e, n_w_max*n_w_max, double);
+  BFT_MALLOC(l, n_w_max*n_w_max, double);
+  BFT_MALLOC(mu, n_w_max + 2, double);
 
-    /* Compute vx <- diag^-1 . (vxx - rhs) and residue. */
-#   pragma omp parallel for reduction(+:res2) if(n_blocks > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_blocks; ii++) {
-      _fw_and_bw_lu33(ad_inv + 9*ii,
-                      vx + 3*ii,
-                      vxx + 3*ii,
-                      rhs + 3*ii);
-      for (cs_lnum_t jj = 0; jj < 3; jj++) {
-        register double r = 0.0;
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          r +=    ad[ii*9 + jj*3 + kk]
-               * (vx[ii*3 + kk] - rk[ii*3 + kk]);
-        res2 += (r*r);
+  /* Image of subspace by A, and associated Galerkin matrix W^t.A.W;
+     almost linearly dependent vectors are removed from the subspace */
+
+  if (n_w > 0) {
+
+    BFT_MALLOC(aw, (size_t)n_w*n_rows, cs_real_t);
+
+    for (int j = 0; j < n_w; j++) {
+      memcpy(dk, df->w + j*n_rows, n_rows*sizeof(cs_real_t));
+      cs_matrix_vector_multiply(rotation_mode, a, dk, aw + j*n_rows);
+    }
+
+    int k = 0;
+    for (int i = 0; i < n_w; i++) {
+      for (int j = 0; j <= i; j++)
+        l[k++] = cs_dot(n_rows, df->w + i*n_rows, aw + j*n_rows);
+    }
+    _sum_over_ranks(c, k, l);
+
+    k = 0;
+    for (int i = 0; i < n_w; i++) {
+      for (int j = 0; j <= i; j++) {
+        e[i*n_w + j] = l[k];
+        e[j*n_w + i] = l[k];
+        k++;
       }
     }
 
-#if defined(HAVE_MPI)
+    int j_null = _deflation_factor(n_w, e, l);
 
-    if (c->comm != MPI_COMM_NULL) {
-      double _sum;
-      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
-      res2 = _sum;
-    }
+    while (j_null > -1) {
 
-#endif /* defined(HAVE_MPI) */
+      for (int j = j_null; j < n_w - 1; j++) {
+        memcpy(df->w + j*n_rows, df->w + (j+1)*n_rows,
+               n_rows*sizeof(cs_real_t));
+        memcpy(aw + j*n_rows, aw + (j+1)*n_rows, n_rows*sizeof(cs_real_t));
+      }
 
-    residue = sqrt(res2); /* Actually, residue of previous iteration */
+      k = 0;
+      for (int i = 0; i < n_w; i++) {
+        for (int j = 0; j < n_w; j++) {
+          if (i != j_null && j != j_null)
+            e[k++] = e[i*n_w + j];
+        }
+      }
 
-    if (n_iter == 1)
-      c->setup_data->initial_residue = residue;
+      n_w -= 1;
+      df->n_vectors = n_w;
 
-    /* Convergence test */
+      j_null = _deflation_factor(n_w, e, l);
 
-    cvg = _convergence_test(c, n_iter, residue, convergence);
+    }
 
   }
 
-  if (_aux_vectors != aux_vectors)
+  const cs_real_t *restrict w = df->w;
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residue, with Galerkin projection of initial guess on subspace */
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, rk);  /* rk = A.x0 */
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    rk[ii] = rhs[ii] - rk[ii];
+
+  if (n_w > 0) {
+
+    for (int j = 0; j < n_w; j++)
+      mu[j] = cs_dot(n_rows, w + j*n_rows, rk);
+    _sum_over_ranks(c, n_w, mu);
+
+    _deflation_solve(n_w, l, mu);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      for (int j = 0; j < n_w; j++) {
+        vx[ii] += mu[j] * w[j*n_rows + ii];
+        rk[ii] -= mu[j] * aw[j*n_rows + ii];
+      }
+    }
+
+  }
+
+  /* Preconditioning and deflated descent direction */
+
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          rk,
+                          gk);
+
+  for (int j = 0; j < n_w; j++)
+    mu[j] = cs_dot(n_rows, aw + j*n_rows, gk);
+  cs_dot_xx_xy(n_rows, rk, gk, mu + n_w, mu + n_w + 1);
+  _sum_over_ranks(c, n_w + 2, mu);
+
+  residue = sqrt(mu[n_w]);
+  rk_gkm1 = mu[n_w + 1];
+
+  _deflation_solve(n_w, l, mu);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    dk[ii] = gk[ii];
+    for (int j = 0; j < n_w; j++)
+      dk[ii] -= mu[j] * w[j*n_rows + ii];
+  }
+
+  /* If no solving required, finish here */
+
+  c->setup_data->initial_residue = residue;
+  cvg = _convergence_test(c, n_iter, residue, convergence);
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    n_iter += 1;
+
+    cs_matrix_vector_multiply(rotation_mode, a, dk, zk);
+
+    /* Descent parameter */
+
+    double ro_1 = _dot_product(c, dk, zk);
+
+    cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
+    double alpha = rk_gkm1 * d_ro_1;
+
+#   pragma omp parallel if(n_rows > CS_THR_MIN)
+    {
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        vx[ii] += (alpha * dk[ii]);
+
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        rk[ii] -= (alpha * zk[ii]);
+    }
+
+    /* Preconditioning, residue and deflation coefficients */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            rk,
+                            gk);
+
+    for (int j = 0; j < n_w; j++)
+      mu[j] = cs_dot(n_rows, aw + j*n_rows, gk);
+    cs_dot_xx_xy(n_rows, rk, gk, mu + n_w, mu + n_w + 1);
+    _sum_over_ranks(c, n_w + 2, mu);
+
+    residue = sqrt(mu[n_w]);
+    rk_gk = mu[n_w + 1];
+
+    /* Convergence test */
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    /* New deflated descent direction */
+
+    double beta = rk_gk / rk_gkm1;
+    rk_gkm1 = rk_gk;
+
+    _deflation_solve(n_w, l, mu);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      dk[ii] = gk[ii] + (beta * dk[ii]);
+      for (int j = 0; j < n_w; j++)
+        dk[ii] -= mu[j] * w[j*n_rows + ii];
+    }
+
+  }
+
+  /* Recycle solution in deflation subspace */
+
+  if (cvg == CS_SLES_CONVERGED || cvg == CS_SLES_MAX_ITERATION)
+    _deflation_update(c, df, vx, rk);
+
+  BFT_FREE(mu);
+  BFT_FREE(l);
+  BFT_FREE(e);
+  BFT_FREE(aw);
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute dot products for multiple interleaved vectors, summing results
+ * over all ranks.
+ *
+ * For each vector k, s[k] = x_k.y_k, and if z is non-NULL,
+ * s[n_vecs + k] = x_k.z_k. Partial sums are computed on fixed row blocks
+ * so the result does not depend on the number of threads.
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   n_rows <-- number of rows
+ *   n_vecs <-- number of interleaved vectors
+ *   x      <-- first vectors
+ *   y      <-- second vectors
+ *   z      <-- optional third vectors, or NULL
+ *   s      --> resulting dot products
+ *----------------------------------------------------------------------------*/
+
+static void
+_dot_products_multi(const cs_sles_it_t  *c,
+                    cs_lnum_t            n_rows,
+                    int                  n_vecs,
+                    const cs_real_t     *restrict x,
+                    const cs_real_t     *restrict y,
+                    const cs_real_t     *restrict z,
+                    double               s[])
+{
+  const int n_s = (z != NULL) ? 2*n_vecs : n_vecs;
+  const cs_lnum_t block_size = 256;
+  const cs_lnum_t n_blocks = (n_rows + block_size - 1) / block_size;
+
+  double *b_s;
+  BFT_MALLOC(b_s, (size_t)n_blocks*n_s + 1, double);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+
+    double *_s = b_s + b_id*n_s;
+
+    const cs_lnum_t s_id = b_id*block_size;
+    const cs_lnum_t e_id = CS_MIN(s_id + block_size, n_rows);
+
+    for (int j = 0; j < n_s; j += n_vecs) {
+
+      const cs_real_t *restrict _y = (j == 0) ? y : z;
+      int k = 0;
+
+      for ( ; k + 4 <= n_vecs; k += 4) {
+        double s0 = 0., s1 = 0., s2 = 0., s3 = 0.;
+        for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+          const cs_real_t *restrict _xi = x + ii*n_vecs + k;
+          const cs_real_t *restrict _yi = _y + ii*n_vecs + k;
+          s0 += _xi[0]*_yi[0];
+          s1 += _xi[1]*_yi[1];
+          s2 += _xi[2]*_yi[2];
+          s3 += _xi[3]*_yi[3];
+        }
+        _s[j+k] = s0;
+        _s[j+k+1] = s1;
+        _s[j+k+2] = s2;
+        _s[j+k+3] = s3;
+      }
+
+      for ( ; k < n_vecs; k++) {
+        double s0 = 0.;
+        for (cs_lnum_t ii = s_id; ii < e_id; ii++)
+          s0 += x[ii*n_vecs + k] * _y[ii*n_vecs + k];
+        _s[j+k] = s0;
+      }
+
+    }
+
+  }
+
+  for (int k = 0; k < n_s; k++)
+    s[k] = 0.;
+
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+    for (int k = 0; k < n_s; k++)
+      s[k] += b_s[b_id*n_s + k];
+  }
+
+  BFT_FREE(b_s);
+
+  _sum_over_ranks(c, n_s, s);
+}
+
+/*----------------------------------------------------------------------------
+ * Convergence test for one of multiple systems solved together.
+ *
+ * parameters:
+ *   n_iter          <-- number of iterations done
+ *   n_iter_max      <-- maximum number of iterations
+ *   precision       <-- solver precision
+ *   r_norm          <-- residue normalization
+ *   residue         <-- current (non normalized) residue
+ *   initial_residue <-- initial (non normalized) residue
+ *
+ * returns:
+ *   convergence status.
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_convergence_test_multi(unsigned  n_iter,
+                        unsigned  n_iter_max,
+                        double    precision,
+                        double    r_norm,
+                        double    residue,
+                        double    initial_residue)
+{
+  if (residue < precision * r_norm)
+    return CS_SLES_CONVERGED;
+  else if (n_iter >= n_iter_max)
+    return CS_SLES_MAX_ITERATION;
+  else if (   (residue > initial_residue * 10000.0 && residue > 100.)
+           || isnan(residue) || isinf(residue))
+    return CS_SLES_DIVERGED;
+
+  return CS_SLES_ITERATING;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.X = B for multiple interleaved right-hand sides using
+ * (Jacobi-preconditioned or non-preconditioned) conjugate gradient.
+ *
+ * All systems share matrix.vector products (so the matrix is read only
+ * once per iteration for all vectors) and parallel reductions. Converged
+ * systems are frozen while the others keep iterating.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c             <-- pointer to solver context info
+ *   a             <-- matrix
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   n_vecs        <-- number of right-hand sides
+ *   precision     <-- solver precision
+ *   r_norm        <-- residue normalization for each system
+ *   ad_inv        <-- inverse of diagonal, or NULL for no preconditioning
+ *   rhs           <-- interleaved right hand sides
+ *   vx            <-> interleaved system solutions
+ *   n_iter        --> number of iterations for each system
+ *   residue       --> residue for each system
+ *   state         --> convergence state for each system
+ *----------------------------------------------------------------------------*/
+
+static void
+_conjugate_gradient_multi(cs_sles_it_t                 *c,
+                          const cs_matrix_t            *a,
+                          cs_halo_rotation_t            rotation_mode,
+                          int                           n_vecs,
+                          double                        precision,
+                          const double                  r_norm[],
+                          const cs_real_t              *restrict ad_inv,
+                          const cs_real_t              *restrict rhs,
+                          cs_real_t                    *restrict vx,
+                          int                           n_iter[],
+                          double                        residue[],
+                          cs_sles_convergence_state_t   state[])
+{
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict xk, *restrict rk, *restrict dk, *restrict zk;
+  cs_real_t  *gk;  /* may be an alias to rk */
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a);
+    const size_t n_wa = 5;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols) * n_vecs;
+
+    BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+
+    xk = _aux_vectors;
+    rk = _aux_vectors + wa_size;
+    dk = _aux_vectors + wa_size*2;
+    gk = _aux_vectors + wa_size*3;
+    zk = _aux_vectors + wa_size*4;
+  }
+
+  const cs_lnum_t n_vals = n_rows*n_vecs;
+
+  double *s, *rk_gkm1, *alpha, *initial_residue;
+  BFT_MALLOC(s, n_vecs*5, double);
+  rk_gkm1 = s + 2*n_vecs;
+  alpha = s + 3*n_vecs;
+  initial_residue = s + 4*n_vecs;
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  memcpy(xk, vx, n_vals*sizeof(cs_real_t));
+
+  cs_matrix_vector_multiply_multi(rotation_mode, a, n_vecs, xk, rk);
+
+# pragma omp parallel for if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+    rk[ii] = rhs[ii] - rk[ii];
+
+  /* Without preconditioning, the preconditioned residue is the residue */
+
+  if (ad_inv != NULL) {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      for (int k = 0; k < n_vecs; k++)
+        gk[ii*n_vecs + k] = rk[ii*n_vecs + k] * ad_inv[ii];
+    }
+  }
+  else
+    gk = rk;
+
+  memcpy(dk, gk, n_vals*sizeof(cs_real_t));
+
+  _dot_products_multi(c, n_rows, n_vecs, rk, rk, gk, s);
+
+  bool iterating = false;
+
+  for (int k = 0; k < n_vecs; k++) {
+    residue[k] = sqrt(s[k]);
+    initial_residue[k] = residue[k];
+    rk_gkm1[k] = s[n_vecs + k];
+    n_iter[k] = 0;
+    state[k] = _convergence_test_multi(0, c->n_max_iter, precision, r_norm[k],
+                                       residue[k], initial_residue[k]);
+    if (state[k] == CS_SLES_ITERATING)
+      iterating = true;
+  }
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (iterating) {
+
+    cs_matrix_vector_multiply_multi(rotation_mode, a, n_vecs, dk, zk);
+
+    /* Descent parameters */
+
+    _dot_products_multi(c, n_rows, n_vecs, dk, zk, NULL, s);
+
+    for (int k = 0; k < n_vecs; k++) {
+      alpha[k] = 0.;
+      if (state[k] == CS_SLES_ITERATING && CS_ABS(s[k]) > DBL_MIN)
+        alpha[k] = rk_gkm1[k] / s[k];
+    }
+
+    /* Update solution and residue, with preconditioning */
+
+    if (ad_inv != NULL) {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        const cs_lnum_t s_id = ii*n_vecs;
+        const cs_real_t ad_inv_ii = ad_inv[ii];
+        for (int k = 0; k < n_vecs; k++) {
+          xk[s_id + k] += alpha[k] * dk[s_id + k];
+          cs_real_t r = rk[s_id + k] - alpha[k] * zk[s_id + k];
+          rk[s_id + k] = r;
+          gk[s_id + k] = r * ad_inv_ii;
+        }
+      }
+    }
+    else {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        const cs_lnum_t s_id = ii*n_vecs;
+        for (int k = 0; k < n_vecs; k++) {
+          xk[s_id + k] += alpha[k] * dk[s_id + k];
+          rk[s_id + k] -= alpha[k] * zk[s_id + k];
+        }
+      }
+    }
+
+    /* Convergence test */
+
+    _dot_products_multi(c, n_rows, n_vecs, rk, rk, gk, s);
+
+    iterating = false;
+
+    for (int k = 0; k < n_vecs; k++) {
+      alpha[k] = 0.;  /* used as beta below */
+      if (state[k] != CS_SLES_ITERATING)
+        continue;
+      n_iter[k] += 1;
+      residue[k] = sqrt(s[k]);
+      state[k] = _convergence_test_multi(n_iter[k], c->n_max_iter, precision,
+                                         r_norm[k], residue[k],
+                                         initial_residue[k]);
+      if (state[k] == CS_SLES_ITERATING) {
+        iterating = true;
+        alpha[k] = s[n_vecs + k] / rk_gkm1[k];
+        rk_gkm1[k] = s[n_vecs + k];
+      }
+    }
+
+    if (!iterating)
+      break;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      const cs_lnum_t s_id = ii*n_vecs;
+      for (int k = 0; k < n_vecs; k++)
+        dk[s_id + k] = gk[s_id + k] + alpha[k]*dk[s_id + k];
+    }
+
+  }
+
+  memcpy(vx, xk, n_vals*sizeof(cs_real_t));
+
+  BFT_FREE(s);
+  BFT_FREE(_aux_vectors);
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using preconditioned 3-layer conjugate residual.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- block size of element ii, ii
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_conjugate_residual_3(cs_sles_it_t              *c,
+                      const cs_matrix_t         *a,
+                      cs_lnum_t                  diag_block_size,
+                      cs_halo_rotation_t         rotation_mode,
+                      cs_sles_it_convergence_t  *convergence,
+                      const cs_real_t           *rhs,
+                      cs_real_t                 *restrict vx,
+                      size_t                     aux_size,
+                      void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg;
+  cs_lnum_t  ii;
+  double  residue;
+  double  ak, bk, ck, dk, ek, denom, alpha, tau;
+  cs_real_t *_aux_vectors;
+  cs_real_t  *restrict vxm1;
+  cs_real_t  *restrict rk, *restrict rkm1;
+  cs_real_t  *restrict wk, *restrict zk;
+  cs_real_t  *restrict tmp;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 6;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    vxm1 = _aux_vectors;
+    rk = _aux_vectors + wa_size;
+    rkm1 = _aux_vectors + wa_size*2;
+    tmp = _aux_vectors + wa_size*3;
+    wk = _aux_vectors + wa_size*4;
+    zk = _aux_vectors + wa_size*5;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (ii = 0; ii < n_rows; ii++) {
+      vxm1[ii] = vx[ii];
+      rkm1[ii] = 0.0;
+    }
+  }
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residue */
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, rk);  /* rk = A.x0 */
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (ii = 0; ii < n_rows; ii++)
+    rk[ii] -= rhs[ii];
+
+  residue = _dot_product(c, rk, rk);
+  residue = sqrt(residue);
+
+  /* If no solving required, finish here */
+
+  c->setup_data->initial_residue = residue;
+  cvg = _convergence_test(c, n_iter, residue, convergence);
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Preconditionning */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            rk,
+                            wk);
+
+    cs_matrix_vector_multiply(rotation_mode, a, wk, zk);
+
+    _dot_products_xy_yz(c, rk, zk, rkm1, &ak, &bk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (ii = 0; ii < n_rows; ii++)
+      tmp[ii] = rk[ii] - rkm1[ii];
+
+    _dot_products_xy_yz(c, rk, tmp, rkm1, &ck, &dk);
+
+    ek = _dot_product_xx(c, zk);
+
+    denom = (ck-dk)*ek - ((ak-bk)*(ak-bk));
+
+    if (fabs(denom) < 1.e-30)
+      alpha = 1.0;
+    else
+      alpha = ((ak-bk)*bk - dk*ek)/denom;
+
+    if (fabs(alpha) < 1.e-30 || fabs(alpha - 1.) < 1.e-30) {
+      alpha = 1.0;
+      tau = ak/ek;
+    }
+    else
+      tau = ak/ek + ((1 - alpha)/alpha) * bk/ek;
+
+    cs_real_t c0 = (1 - alpha);
+    cs_real_t c1 = -alpha*tau;
+
+#   pragma omp parallel firstprivate(alpha, tau, c0, c1) if(n_rows > CS_THR_MIN)
+    {
+#     pragma omp for nowait
+      for (ii = 0; ii < n_rows; ii++) {
+        cs_real_t trk = rk[ii];
+        rk[ii] = alpha*rk[ii] + c0*rkm1[ii] + c1*zk[ii];
+        rkm1[ii] = trk;
+      }
+#     pragma omp for nowait
+      for (ii = 0; ii < n_rows; ii++) {
+        cs_real_t tvx = vx[ii];
+        vx[ii] = alpha*vx[ii] + c0*vxm1[ii] + c1*wk[ii];
+        vxm1[ii] = tvx;
+      }
+    }
+
+    /* compute residue */
+
+    residue = sqrt(_dot_product(c, rk, rk));
+
+    /* Convergence test for end of previous iteration */
+
+    if (n_iter > 1)
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    n_iter += 1;
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Jacobi.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_jacobi(cs_sles_it_t              *c,
+        const cs_matrix_t         *a,
+        cs_lnum_t                  diag_block_size,
+        cs_halo_rotation_t         rotation_mode,
+        cs_sles_it_convergence_t  *convergence,
+        const cs_real_t           *rhs,
+        cs_real_t                 *restrict vx,
+        size_t                     aux_size,
+        void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg;
+  cs_lnum_t  ii;
+  double  res2, residue;
+  cs_real_t *_aux_vectors;
+  cs_real_t *restrict rk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 1;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+  }
+
+  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+
+  cvg = CS_SLES_ITERATING;
+
+  /* Current iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    n_iter += 1;
+
+#if defined(HAVE_OPENMP)
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (ii = 0; ii < n_rows; ii++)
+      rk[ii] = vx[ii];
+
+#else
+
+    memcpy(rk, vx, n_rows * sizeof(cs_real_t));   /* rk <- vx */
+
+#endif
+
+    /* Compute Vx <- Vx - (A-diag).Rk and residue. */
+
+    cs_matrix_exdiag_vector_multiply(rotation_mode, a, rk, vx);
+
+    res2 = 0.0;
+
+#   pragma omp parallel for reduction(+:res2) if(n_rows > CS_THR_MIN)
+    for (ii = 0; ii < n_rows; ii++) {
+      vx[ii] = (rhs[ii]-vx[ii])*ad_inv[ii];
+      double r = ad[ii] * (vx[ii]-rk[ii]);
+      res2 += (r*r);
+    }
+
+#if defined(HAVE_MPI)
+
+    if (c->comm != MPI_COMM_NULL) {
+      double _sum;
+      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+      res2 = _sum;
+    }
+
+#endif /* defined(HAVE_MPI) */
+
+    residue = sqrt(res2); /* Actually, residue of previous iteration */
+
+    /* Convergence test */
+
+    if (n_iter == 1)
+      c->setup_data->initial_residue = residue;
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using block Jacobi.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size (unused here)
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              --> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_block_3_jacobi(cs_sles_it_t              *c,
+                const cs_matrix_t         *a,
+                cs_lnum_t                  diag_block_size,
+                cs_halo_rotation_t         rotation_mode,
+                cs_sles_it_convergence_t  *convergence,
+                const cs_real_t           *rhs,
+                cs_real_t                 *restrict vx,
+                size_t                     aux_size,
+                void                      *aux_vectors)
+{
+  CS_UNUSED(diag_block_size);
+
+  assert(diag_block_size == 3);
+
+  cs_sles_convergence_state_t cvg;
+  double  res2, residue;
+  cs_real_t *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict vxx;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t n_blocks = c->setup_data->n_rows / 3;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 2;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk  = _aux_vectors;
+    vxx = _aux_vectors + wa_size;
+  }
+
+  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+
+  cvg = CS_SLES_ITERATING;
+
+  /* Current iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    n_iter += 1;
+    memcpy(rk, vx, n_rows * sizeof(cs_real_t));  /* rk <- vx */
+
+    /* Compute vxx <- vx - (a-diag).rk and residue. */
+
+    cs_matrix_exdiag_vector_multiply(rotation_mode, a, rk, vxx);
+
+    res2 = 0.0;
+
+    /* Compute vx <- diag^-1 . (vxx - rhs) and residue. */
+#   pragma omp parallel for reduction(+:res2) if(n_blocks > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_blocks; ii++) {
+      _fw_and_bw_lu33(ad_inv + 9*ii,
+                      vx + 3*ii,
+                      vxx + 3*ii,
+                      rhs + 3*ii);
+      for (cs_lnum_t jj = 0; jj < 3; jj++) {
+        register double r = 0.0;
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          r +=    ad[ii*9 + jj*3 + kk]
+               * (vx[ii*3 + kk] - rk[ii*3 + kk]);
+        res2 += (r*r);
+      }
+    }
+
+#if defined(HAVE_MPI)
+
+    if (c->comm != MPI_COMM_NULL) {
+      double _sum;
+      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+      res2 = _sum;
+    }
+
+#endif /* defined(HAVE_MPI) */
+
+    residue = sqrt(res2); /* Actually, residue of previous iteration */
+
+    if (n_iter == 1)
+      c->setup_data->initial_residue = residue;
+
+    /* Convergence test */
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+
+  }
+
+  if (_aux_vectors != aux_vectors)
     BFT_FREE(_aux_vectors);
   return cvg;
 }
@@ -1999,12 +3273,41 @@ _breakdown(cs_sles_it_t                 *c,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Create a deferred sum structure using the solver's communicator.
+ *
+ * parameters:
+ *   c <-- pointer to solver context info
+ *
+ * returns:
+ *   pointer to deferred sum structure
+ *----------------------------------------------------------------------------*/
+
+static cs_parall_deferred_sum_t *
+_deferred_sum_create(const cs_sles_it_t  *c)
+{
+  cs_parall_deferred_sum_t *ds = cs_parall_deferred_sum_create();
+
+#if defined(HAVE_MPI)
+  cs_parall_deferred_sum_set_comm(ds, c->comm);
+#else
+  CS_UNUSED(c);
+#endif
+
+  return ds;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using preconditioned Bi-CGSTAB.
  *
  * Parallel-optimized version, groups dot products, at the cost of
  * computation of the preconditionning for n+1 iterations instead of n.
  *
+ * The residual norm and the next iteration's beta are obtained by
+ * recurrence from the dot products required for alpha, so that only
+ * 2 reductions are required per iteration; they are computed explicitly
+ * when the recurrence would lead to excessive cancellation.
+ *
  * On entry, vx is considered initialized.
  *
  * parameters:
@@ -2038,11 +3341,15 @@ _bi_cgstab(cs_sles_it_t              *c,
   double  _epzero = 1.e-30; /* smaller than epzero */
   double  ro_0, ro_1, alpha, beta, betam1, gamma, omega, ukres0;
   double  residue;
+  double  s[5];
   cs_real_t  *_aux_vectors;
   cs_real_t  *restrict res0, *restrict rk, *restrict pk, *restrict zk;
   cs_real_t  *restrict uk, *restrict vk;
 
   unsigned n_iter = 0;
+  bool update_residue = true;
+
+  cs_parall_deferred_sum_t *ds = _deferred_sum_create(c);
 
   /* Allocate or map work arrays */
   /*-----------------------------*/
@@ -2106,7 +3413,7 @@ _bi_cgstab(cs_sles_it_t              *c,
       residue = sqrt(beta);
       c->setup_data->initial_residue = residue;
     }
-    else {
+    else if (update_residue) {
       _dot_products_xx_xy(c, rk, res0, &residue, &beta);
       residue = sqrt(residue);
     }
@@ -2176,7 +3483,16 @@ _bi_cgstab(cs_sles_it_t              *c,
 
     cs_matrix_vector_multiply(rotation_mode, a, zk, vk);
 
-    _dot_products_xx_xy(c, vk, rk, &ro_1, &ro_0);
+    /* Group vk.vk and vk.rk (for alpha) with rk.rk, vk.res0 and rk.res0
+       (for the next iteration's residue and beta) in a single reduction */
+
+    cs_dot_xx_yy_xy_xz_yz(n_rows, vk, rk, res0, s, s+1, s+2, s+3, s+4);
+
+    cs_parall_deferred_sum_add(ds, 5, s, s);
+    cs_parall_deferred_sum_flush(ds);
+
+    ro_1 = s[0];
+    ro_0 = s[2];
 
     if (_breakdown(c, convergence, "rho1", ro_1, _epzero,
                    residue, n_iter, &cvg))
@@ -2185,6 +3501,22 @@ _bi_cgstab(cs_sles_it_t              *c,
     cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
     alpha = ro_0 * d_ro_1;
 
+    /* Residue and beta after the final update of rk; if cancellation is
+       too strong, recompute them explicitly at the next iteration */
+
+    {
+      double rr = s[1] - alpha*ro_0;
+      double r_res0 = s[4] - alpha*s[3];
+
+      update_residue = (   rr < 1.e-6*s[1]
+                        || CS_ABS(r_res0) < 1.e-6*CS_ABS(s[4]));
+
+      if (update_residue == false) {
+        residue = sqrt(rr);
+        beta = r_res0;
+      }
+    }
+
     /* Final update of vx and rk */
 
 #   pragma omp parallel if(n_rows > CS_THR_MIN)
@@ -2202,6 +3534,8 @@ _bi_cgstab(cs_sles_it_t              *c,
        as to group dot products for better parallel performance */
   }
 
+  cs_parall_deferred_sum_destroy(&ds);
+
   if (_aux_vectors != aux_vectors)
     BFT_FREE(_aux_vectors);
 
@@ -2582,14 +3916,20 @@ _solve_diag_sup_halo(cs_real_t  *restrict a,
 }
 
 /*----------------------------------------------------------------------------
- * Solution of A.vx = Rhs using preconditioned GMRES.
+ * Solution of A.vx = Rhs using preconditioned GCR (restarted).
+ *
+ * Search directions are orthogonalized with classical Gram-Schmidt, and
+ * dot products are grouped so that only 2 reductions are required per
+ * iteration, at the cost of computation of the preconditioning for n+1
+ * iterations instead of n (the convergence test is grouped with the
+ * orthogonalization of the next direction).
  *
  * On entry, vx is considered initialized.
  *
  * parameters:
  *   c               <-- pointer to solver context info
  *   a               <-- matrix
- *   diag_block_size <-- diagonal block size (unused here)
+ *   diag_block_size <-- diagonal block size
  *   rotation_mode   <-- halo update option for rotational periodicity
  *   convergence     <-- convergence information structure
  *   rhs             <-- right hand side
@@ -2612,34 +3952,176 @@ _gcr(cs_sles_it_t              *c,
      size_t                     aux_size,
      void                      *aux_vectors)
 {
-  CS_UNUSED(diag_block_size);
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  _epzero = 1.e-30; /* smaller than epzero */
+  double  residue = 0.;
+  double  *gamma, *ww, s[2];
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict zk, *restrict wk;
+
+  int n_restart_max = 20;
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  int n_restart = sqrt(n_rows*diag_block_size)*1.5 + 1;
+  if (n_restart > n_restart_max)
+    n_restart = n_restart_max;
+
+#if defined(HAVE_MPI)
+  if (c->comm != MPI_COMM_NULL) {
+    int _n_restart = n_restart;
+    MPI_Allreduce(&_n_restart, &n_restart, 1, MPI_INT, MPI_MIN, c->comm);
+  }
+#endif
+
+  const size_t wa_size
+    = CS_SIMD_SIZE(cs_matrix_get_n_columns(a) * diag_block_size);
+
+  {
+    const size_t n_wa = 1 + 2*n_restart;
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    zk = _aux_vectors + wa_size;                /* n_restart directions */
+    wk = _aux_vectors + wa_size*(1+n_restart);  /* and their images by A */
+  }
+
+  BFT_MALLOC(gamma, n_restart + 1, double);
+  BFT_MALLOC(ww, n_restart, double);
+
+  cs_parall_deferred_sum_t *ds = _deferred_sum_create(c);
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, rk);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    rk[ii] = rhs[ii] - rk[ii];
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  int k = 0; /* index of current direction in restart cycle */
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    cs_real_t *restrict _zk = zk + k*wa_size;
+    cs_real_t *restrict _wk = wk + k*wa_size;
+
+    /* Compute zk = C.rk and wk = A.zk */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            rk,
+                            _zk);
+
+    cs_matrix_vector_multiply(rotation_mode, a, _zk, _wk);
+
+    /* Group wk.wj (j < k) with rk.rk for the convergence test */
+
+    for (int j = 0; j < k; j++)
+      gamma[j] = cs_dot(n_rows, _wk, wk + j*wa_size);
+    gamma[k] = cs_dot_xx(n_rows, rk);
+
+    cs_parall_deferred_sum_add(ds, k+1, gamma, gamma);
+    cs_parall_deferred_sum_flush(ds);
+
+    residue = sqrt(gamma[k]);
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    n_iter += 1;
+
+    /* Orthogonalize wk against previous wj (and update zk accordingly) */
+
+    for (int j = 0; j < k; j++)
+      gamma[j] /= ww[j];
+
+    if (k > 0) {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        double s_z = 0., s_w = 0.;
+        for (int j = 0; j < k; j++) {
+          s_z += gamma[j] * zk[j*wa_size + ii];
+          s_w += gamma[j] * wk[j*wa_size + ii];
+        }
+        _zk[ii] -= s_z;
+        _wk[ii] -= s_w;
+      }
+    }
+
+    /* Compute wk.wk and rk.wk */
+
+    cs_dot_xx_xy(n_rows, _wk, rk, s, s+1);
+
+    cs_parall_deferred_sum_add(ds, 2, s, s);
+    cs_parall_deferred_sum_flush(ds);
+
+    if (_breakdown(c, convergence, "wk.wk", s[0], _epzero,
+                   residue, n_iter, &cvg))
+      break;
+
+    ww[k] = s[0];
+
+    const double alpha = s[1] / s[0];
+
+    /* Update vx and rk */
+
+#   pragma omp parallel if(n_rows > CS_THR_MIN)
+    {
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        vx[ii] += alpha * _zk[ii];
 
-  /* Manage the workspace memory */
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        rk[ii] -= alpha * _wk[ii];
+    }
 
-  size_t _aux_r_size = 0; /* TO BE SET (cf. _gmres for instance) */
-  cs_real_t  *_aux_vectors = NULL;
+    /* Restart when all directions are used */
 
-  if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < _aux_r_size)
-    BFT_MALLOC(_aux_vectors, _aux_r_size, cs_real_t);
-  else
-    _aux_vectors = aux_vectors;
+    k += 1;
+    if (k >= n_restart)
+      k = 0;
 
-  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  }
 
-  /* TODO */
-  bft_error(__FILE__, __LINE__, 0, " %s: Not implemented.", __func__);
+  cs_parall_deferred_sum_destroy(&ds);
+
+  BFT_FREE(ww);
+  BFT_FREE(gamma);
 
   if (_aux_vectors != aux_vectors)
     BFT_FREE(_aux_vectors);
 
-  cvg = CS_SLES_CONVERGED;      /* check convergence ? */
-
   return cvg;
 }
 
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using preconditioned GMRES.
  *
+ * Krylov vectors are orthogonalized using classical Gram-Schmidt, so that
+ * the dot products with all previous vectors and the norm of the new vector
+ * are summed in a single reduction; a second orthogonalization pass is
+ * applied only when cancellation is too strong.
+ *
  * On entry, vx is considered initialized.
  *
  * parameters:
@@ -2678,6 +4160,7 @@ _gmres(cs_sles_it_t              *c,
   cs_real_t *restrict _givens_coeff, *restrict _beta;
   cs_real_t *restrict dk, *restrict gk;
   cs_real_t *restrict bk, *restrict fk, *restrict krk;
+  double  *h_loc, *h_glob;
 
   cs_lnum_t krylov_size_max = 40;
   unsigned n_iter = 0;
@@ -2739,144 +4222,578 @@ _gmres(cs_sles_it_t              *c,
             + (krylov_size - 1)*(n_rows + krylov_size) + 2*krylov_size;
   }
 
-  for (cs_lnum_t ii = 0; ii < krylov_size*(krylov_size - 1); ii++)
-    _h_matrix[ii] = 0.;
+  for (cs_lnum_t ii = 0; ii < krylov_size*(krylov_size - 1); ii++)
+    _h_matrix[ii] = 0.;
+
+  BFT_MALLOC(h_loc, krylov_size + 1, double);
+  BFT_MALLOC(h_glob, krylov_size + 1, double);
+
+  cs_parall_deferred_sum_t *ds = _deferred_sum_create(c);
+
+  cvg = CS_SLES_ITERATING;
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* compute  rk <- a*vx (vx = x0) */
+
+    cs_matrix_vector_multiply(rotation_mode, a, vx, dk);
+
+    /* compute  rk <- rhs - rk (r0 = b-A*x0) */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      dk[ii] = rhs[ii] - dk[ii];
+
+    /* beta = ||r0|| */
+    beta = sqrt(_dot_product_xx(c, dk));
+    dot_prod = beta;
+
+    if (n_iter == 0) {
+      residue = beta;
+      c->setup_data->initial_residue = residue;
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+      if (cvg != CS_SLES_ITERATING)
+        break;
+    }
+
+    _beta[0] = beta;
+    for (cs_lnum_t ii = 1; ii < krylov_size; ii++)
+      _beta[ii] = 0.;
+
+    /* Lap */
+
+    l_iter = 0;
+    l_old_iter = 0;
+
+    for (cs_lnum_t ii = 0; ii < krylov_size - 1; ii++) {
+
+      /* krk = k-ieth col of _krylov_vector = vi */
+      krk = _krylov_vectors + ii*n_rows;
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+        krk[jj] = dk[jj]/dot_prod;
+
+      c->setup_data->pc_apply(c->setup_data->pc_context,
+                              rotation_mode,
+                              krk,
+                              gk);
+
+      /* compute w = dk <- A*vj */
+
+      cs_matrix_vector_multiply(rotation_mode, a, gk, dk);
+
+      cs_real_t *restrict h_i = _h_matrix + ii*krylov_size;
+
+      for (cs_lnum_t jj = 0; jj < ii + 1; jj++)
+        h_i[jj] = 0.;
+
+      /* Classical Gram-Schmidt; a second pass is needed only if
+         the norm of w is reduced by more than a factor sqrt(2)
+         (so that orthogonality is maintained to working precision) */
+
+      for (int pass = 0; pass < 2; pass++) {
+
+        /* compute h(k,i) = <w,vi> and <w,w> with a single reduction */
+
+        for (cs_lnum_t jj = 0; jj < ii + 1; jj++)
+          h_loc[jj] = cs_dot(n_rows, dk, (_krylov_vectors + jj*n_rows));
+        h_loc[ii+1] = cs_dot_xx(n_rows, dk);
+
+        cs_parall_deferred_sum_add(ds, ii + 2, h_loc, h_glob);
+        cs_parall_deferred_sum_flush(ds);
+
+        /* compute w = dk <- w - sum_k(h(k,i)*vk) */
+
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t kk = 0; kk < n_rows; kk++) {
+          double _s = 0.;
+          for (cs_lnum_t jj = 0; jj < ii + 1; jj++)
+            _s += h_glob[jj] * _krylov_vectors[jj*n_rows + kk];
+          dk[kk] -= _s;
+        }
+
+        /* <w,w> after orthogonalization (Pythagoras) */
+
+        double ww = h_glob[ii+1];
+        for (cs_lnum_t jj = 0; jj < ii + 1; jj++) {
+          h_i[jj] += h_glob[jj];
+          ww -= h_glob[jj]*h_glob[jj];
+        }
+
+        dot_prod = (ww > 0.) ? sqrt(ww) : 0.;
+
+        if (ww > 0.5*h_glob[ii+1])
+          break;
+      }
+
+      /* h(i+1,i) = sqrt<w,w> */
+      _h_matrix[ii*krylov_size + ii + 1] = dot_prod;
+
+      if (dot_prod < epsi) scaltest = 1;
+
+      if (   (l_iter + 1)%check_freq == 0
+          || l_iter == krylov_size - 2
+          || scaltest == 1) {
+
+          /* H matrix to diagonal sup matrix */
+
+        _givens_rot_update(_h_matrix,
+                           krylov_size,
+                           _beta,
+                           _givens_coeff,
+                           l_old_iter,
+                           l_iter + 1);
+
+        l_old_iter = l_iter + 1;
+
+        /* solve diag sup system */
+        _solve_diag_sup_halo(_h_matrix, l_iter + 1, krylov_size, _beta, gk);
+
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t jj = 0; jj < n_rows; jj++) {
+          fk[jj] = 0.0;
+          for (cs_lnum_t kk = 0; kk <= l_iter; kk++)
+            fk[jj] += _krylov_vectors[kk*n_rows + jj] * gk[kk];
+        }
+
+        c->setup_data->pc_apply(c->setup_data->pc_context,
+                                rotation_mode,
+                                fk,
+                                gk);
+
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+          fk[jj] = vx[jj] + gk[jj];
+
+        cs_matrix_vector_multiply(rotation_mode, a, fk, bk);
+
+        /* compute residue = | Ax - b |_1 */
+
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+          bk[jj] -= rhs[jj];
+
+        residue = sqrt(_dot_product_xx(c, bk));
+
+        cvg = _convergence_test(c, n_iter, residue, convergence);
+
+      }
+
+      n_iter++;
+      l_iter++;
+
+      if (cvg == CS_SLES_CONVERGED || cvg == CS_SLES_MAX_ITERATION ||
+          l_iter == krylov_size - 1   || scaltest == 1) {
+#       pragma omp parallel for if (n_rows > CS_THR_MIN)
+        for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+          vx[jj] = fk[jj];
+        break;
+      }
+    }
+  }
+
+  cs_parall_deferred_sum_destroy(&ds);
+
+  BFT_FREE(h_glob);
+  BFT_FREE(h_loc);
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using preconditioned s-step GMRES.
+ *
+ * Krylov basis vectors are generated by blocks of s, using a shifted
+ * monomial basis (the shift being the mean of the current Ritz values),
+ * and each block is orthogonalized against the previous basis and
+ * orthonormalized (block classical Gram-Schmidt and Cholesky QR) with
+ * a single reduction. A second pass is applied only when the block
+ * is ill-conditioned, and the block is truncated if its vectors are
+ * almost linearly dependent. The Hessenberg matrix of the Arnoldi
+ * relation is then deduced from the change of basis.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_s_step_gmres(cs_sles_it_t              *c,
+              const cs_matrix_t         *a,
+              cs_lnum_t                  diag_block_size,
+              cs_halo_rotation_t         rotation_mode,
+              cs_sles_it_convergence_t  *convergence,
+              const cs_real_t           *rhs,
+              cs_real_t                 *restrict vx,
+              size_t                     aux_size,
+              void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  residue;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict q, *restrict dk, *restrict gk, *restrict fk;
+
+  const int krylov_size_max = 40;
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  int krylov_size = sqrt(n_rows*diag_block_size)*1.5 + 2;
+  if (krylov_size > krylov_size_max)
+    krylov_size = krylov_size_max;
+
+#if defined(HAVE_MPI)
+  if (c->comm != MPI_COMM_NULL) {
+    int _krylov_size = krylov_size;
+    MPI_Allreduce(&_krylov_size, &krylov_size, 1, MPI_INT, MPI_MIN, c->comm);
+  }
+#endif
+
+  const int ks = krylov_size;
+  const int s_max = CS_MAX(CS_MIN(_gmres_s_step, ks - 1), 1);
+
+  const size_t wa_size
+    = CS_SIMD_SIZE(cs_matrix_get_n_columns(a) * diag_block_size);
+
+  {
+    const size_t n_wa = 3 + ks;
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    dk = _aux_vectors;
+    gk = _aux_vectors + wa_size;
+    fk = _aux_vectors + 2*wa_size;
+    q = _aux_vectors + 3*wa_size;   /* Krylov basis (ks vectors) */
+  }
+
+  /* Small dense arrays: Hessenberg matrix (h(i,j) = h[i + j*ks]) and
+     its rotated copy, rotated right-hand side, Givens coefficients, and
+     for the current block, the projection coefficients, Gram matrices
+     and Cholesky factor */
+
+  double *h, *hr, *g, *givens, *ct, *ct2, *gram, *gram2, *gram0, *l, *x;
+
+  BFT_MALLOC(h, ks*ks, double);
+  BFT_MALLOC(hr, ks*ks, double);
+  BFT_MALLOC(g, ks, double);
+  BFT_MALLOC(givens, 2*ks, double);
+  BFT_MALLOC(ct, ks*s_max, double);
+  BFT_MALLOC(ct2, ks*s_max + s_max*s_max, double);
+  BFT_MALLOC(gram, s_max*s_max, double);
+  BFT_MALLOC(gram2, s_max*s_max, double);
+  BFT_MALLOC(gram0, s_max, double);
+  BFT_MALLOC(l, s_max*s_max, double);
+  BFT_MALLOC(x, ks*s_max, double);
+
+  cs_parall_deferred_sum_t *ds = _deferred_sum_create(c);
+
+  double theta = 0., h_diag_sum = 0.;
+  int n_h_diag = 0;
+
+  /* Restart cycles */
+  /*----------------*/
+
+  while (true) {
+
+    /* Compute r0 = rhs - A.vx and beta = ||r0|| */
+
+    cs_matrix_vector_multiply(rotation_mode, a, vx, dk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      dk[ii] = rhs[ii] - dk[ii];
+
+    residue = sqrt(_dot_product_xx(c, dk));
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    for (int ii = 0; ii < ks*ks; ii++) {
+      h[ii] = 0.;
+      hr[ii] = 0.;
+    }
+    for (int ii = 0; ii < ks; ii++)
+      g[ii] = 0.;
+    g[0] = residue;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      q[ii] = dk[ii] / residue;
+
+    int m = 1;  /* current number of basis vectors */
+
+    while (m < ks) {
+
+      /* Block size: use a single Arnoldi step until a shift is known */
+
+      int sb = (n_h_diag > 0) ? CS_MIN(s_max, ks - m) : 1;
+
+      /* Generate v_1 ... v_sb, with v_k+1 = (A.M - theta.I).v_k,
+         stored in slots m to m+sb-1 of the basis */
+
+      for (int k = 0; k < sb; k++) {
+        const cs_real_t *restrict v_p = q + (m-1+k)*wa_size;
+        cs_real_t *restrict v = q + (m+k)*wa_size;
+
+        c->setup_data->pc_apply(c->setup_data->pc_context,
+                                rotation_mode,
+                                v_p,
+                                gk);
+
+        cs_matrix_vector_multiply(rotation_mode, a, gk, v);
 
-  cvg = CS_SLES_ITERATING;
+        if (n_h_diag > 0) {
+#         pragma omp parallel for if(n_rows > CS_THR_MIN)
+          for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+            v[ii] -= theta*v_p[ii];
+        }
+      }
 
-  while (cvg == CS_SLES_ITERATING) {
+      cs_real_t *restrict v = q + m*wa_size;
 
-    /* compute  rk <- a*vx (vx = x0) */
+      /* Block classical Gram-Schmidt + Cholesky QR; a second pass is
+         used only if cancellation is too strong. */
 
-    cs_matrix_vector_multiply(rotation_mode, a, vx, dk);
+      for (int ii = 0; ii < m*sb; ii++)
+        ct[ii] = 0.;
 
-    /* compute  rk <- rhs - rk (r0 = b-A*x0) */
+      int n_ok = 0;
 
-#   pragma omp parallel for if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-      dk[ii] = rhs[ii] - dk[ii];
+      for (int pass = 0; pass < 2; pass++) {
 
-    if (n_iter == 0) {
-      residue = sqrt(_dot_product_xx(c, dk));
-      c->setup_data->initial_residue = residue;
-      cvg = _convergence_test(c, n_iter, residue, convergence);
-      if (cvg != CS_SLES_ITERATING)
-        break;
-    }
+        /* ct2(i,k) = q_i.v_k and gram2(k,j) = v_k.v_j, in one reduction */
 
-    /* beta = ||r0|| */
-    beta = sqrt(_dot_product(c, dk, dk));
-    dot_prod = beta;
+        int n_vals = 0;
+        for (int k = 0; k < sb; k++) {
+          for (int i = 0; i < m; i++)
+            ct2[n_vals++] = cs_dot(n_rows, q + i*wa_size, v + k*wa_size);
+        }
+        for (int k = 0; k < sb; k++) {
+          for (int j = 0; j <= k; j++)
+            ct2[n_vals++] = cs_dot(n_rows, v + k*wa_size, v + j*wa_size);
+        }
 
-    _beta[0] = beta;
-    for (cs_lnum_t ii = 1; ii < krylov_size; ii++)
-      _beta[ii] = 0.;
+        cs_parall_deferred_sum_add(ds, n_vals, ct2, ct2);
+        cs_parall_deferred_sum_flush(ds);
 
-    /* Lap */
+        n_vals = m*sb;
+        for (int k = 0; k < sb; k++) {
+          for (int j = 0; j <= k; j++) {
+            gram2[k*sb + j] = ct2[n_vals];
+            gram2[j*sb + k] = ct2[n_vals];
+            n_vals++;
+          }
+        }
 
-    l_iter = 0;
-    l_old_iter = 0;
+        /* v_k <- v_k - sum_i(ct2(i,k).q_i) */
 
-    for (cs_lnum_t ii = 0; ii < krylov_size - 1; ii++) {
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+          for (int k = 0; k < sb; k++) {
+            double _s = 0.;
+            for (int i = 0; i < m; i++)
+              _s += ct2[k*m + i] * q[i*wa_size + ii];
+            v[k*wa_size + ii] -= _s;
+          }
+        }
 
-      /* krk = k-ieth col of _krylov_vector = vi */
-      krk = _krylov_vectors + ii*n_rows;
+        /* Gram matrix after projection */
+
+        for (int k = 0; k < sb; k++) {
+          for (int j = 0; j < sb; j++) {
+            double _s = gram2[k*sb + j];
+            for (int i = 0; i < m; i++)
+              _s -= ct2[k*m + i] * ct2[j*m + i];
+            gram[k*sb + j] = _s;
+          }
+          if (pass == 0)
+            gram0[k] = gram2[k*sb + k];
+        }
 
-#     pragma omp parallel for if(n_rows > CS_THR_MIN)
-      for (cs_lnum_t jj = 0; jj < n_rows; jj++)
-        krk[jj] = dk[jj]/dot_prod;
+        for (int ii = 0; ii < m*sb; ii++)
+          ct[ii] += ct2[ii];
 
-      c->setup_data->pc_apply(c->setup_data->pc_context,
-                              rotation_mode,
-                              krk,
-                              gk);
+        /* Cholesky factorization (vectors almost linearly dependent
+           on the previous ones of the block lead to a null pivot) */
 
-      /* compute w = dk <- A*vj */
+        int j_null = _deflation_factor(sb, gram, l);
+        n_ok = (j_null < 0) ? sb : j_null;
 
-      cs_matrix_vector_multiply(rotation_mode, a, gk, dk);
+        /* Cancellation check: projection on the previous basis
+           should not reduce the norm of a vector too much */
 
-      for (cs_lnum_t jj = 0; jj < ii + 1; jj++) {
+        double r_min = 1.;
+        for (int k = 0; k < n_ok; k++)
+          r_min = CS_MIN(r_min, gram[k*sb + k] / gram0[k]);
 
-        /* compute h(k,i) = <w,vi> = <dk,vi> */
-        _h_matrix[ii*krylov_size + jj]
-          = _dot_product(c, dk, (_krylov_vectors + jj*n_rows));
+        if (r_min > 1.e-4)
+          break;
 
-        /* compute w = dk <- w - h(i,k)*vi */
+        for (int k = 0; k < sb; k++)
+          gram0[k] = gram[k*sb + k];
+      }
 
-        cs_axpy(n_rows,
-                -_h_matrix[ii*krylov_size+jj],
-                (_krylov_vectors + jj*n_rows),
-                dk);
+      /* Truncate the block to linearly independent vectors */
 
+      if (n_ok < sb) {
+        for (int k = 1; k < n_ok; k++) {
+          for (int j = 0; j <= k; j++)
+            l[k*n_ok + j] = l[k*sb + j];
+        }
+        sb = n_ok;
       }
 
-      /* compute h(i+1,i) = sqrt<w,w> */
-      dot_prod = sqrt(_dot_product(c, dk, dk));
-      _h_matrix[ii*krylov_size + ii + 1] = dot_prod;
+      if (sb == 0)
+        break;
 
-      if (dot_prod < epsi) scaltest = 1;
+      /* q_k = (v_k - sum_{j<k} r(j,k).q_j) / r(k,k), with r = l^t */
 
-      if (   (l_iter + 1)%check_freq == 0
-          || l_iter == krylov_size - 2
-          || scaltest == 1) {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        for (int k = 0; k < sb; k++) {
+          double _v = v[k*wa_size + ii];
+          for (int j = 0; j < k; j++)
+            _v -= l[k*sb + j] * v[j*wa_size + ii];
+          v[k*wa_size + ii] = _v / l[k*sb + k];
+        }
+      }
 
-          /* H matrix to diagonal sup matrix */
+      /* Hessenberg matrix columns m-1 to m+sb-2 from the change of basis:
+         A.M.W = V + theta.W, with W = [q_m-1, v_1 ... v_sb-1] = Q.w,
+         V = Q.b, b = [ct; r] and w = [e_m-1, b(:, 0:sb-2)], so that
+         h(:, m-1:m+sb-2) = (b + theta.w - h_old.w_top).t^-1,
+         where t is the (upper triangular) block of w on rows m-1 to
+         m+sb-2. */
+
+      const int n_b = m + sb;
+
+#     define _B(i, k) \
+        (((i) < m) ? ct[(k)*m + (i)] : \
+         (((i) - m <= (k)) ? l[(k)*sb + ((i) - m)] : 0.))
+#     define _W(i, k) \
+        (((k) == 0) ? (((i) == m-1) ? 1. : 0.) : _B(i, (k)-1))
+
+      for (int k = 0; k < sb; k++) {
+        for (int i = 0; i < n_b; i++) {
+          double _x = _B(i, k) + theta*_W(i, k);
+          if (i < m) {
+            for (int j = 0; j < m-1; j++)
+              _x -= h[i + j*ks] * _W(j, k);
+          }
+          x[k*n_b + i] = _x;
+        }
+      }
 
-        _givens_rot_update(_h_matrix,
-                           krylov_size,
-                           _beta,
-                           _givens_coeff,
-                           l_old_iter,
-                           l_iter + 1);
+      for (int k = 0; k < sb; k++) {
+        double *restrict h_k = h + (m-1+k)*ks;
+        for (int i = 0; i < n_b; i++) {
+          double _h = x[k*n_b + i];
+          for (int j = 0; j < k; j++)
+            _h -= h[i + (m-1+j)*ks] * _W(m-1+j, k);
+          h_k[i] = _h / _W(m-1+k, k);
+        }
+        for (int i = m+k+1; i < ks; i++)
+          h_k[i] = 0.;
+        h_diag_sum += h_k[m-1+k];
+        n_h_diag++;
+      }
 
-        l_old_iter = l_iter + 1;
+#     undef _W
+#     undef _B
 
-        /* solve diag sup system */
-        _solve_diag_sup_halo(_h_matrix, l_iter + 1, krylov_size, _beta, gk);
+      theta = h_diag_sum / n_h_diag;
 
-#       pragma omp parallel for if(n_rows > CS_THR_MIN)
-        for (cs_lnum_t jj = 0; jj < n_rows; jj++) {
-          fk[jj] = 0.0;
-          for (cs_lnum_t kk = 0; kk <= l_iter; kk++)
-            fk[jj] += _krylov_vectors[kk*n_rows + jj] * gk[kk];
-        }
+      /* Rotate new columns and update residual estimate */
 
-        c->setup_data->pc_apply(c->setup_data->pc_context,
-                                rotation_mode,
-                                fk,
-                                gk);
+      for (int ii = (m-1)*ks; ii < (m-1+sb)*ks; ii++)
+        hr[ii] = h[ii];
 
-#       pragma omp parallel for if(n_rows > CS_THR_MIN)
-        for (cs_lnum_t jj = 0; jj < n_rows; jj++)
-          fk[jj] = vx[jj] + gk[jj];
+      _givens_rot_update(hr, ks, g, givens, m-1, m-1+sb);
 
-        cs_matrix_vector_multiply(rotation_mode, a, fk, bk);
+      m += sb;
+      n_iter += sb;
 
-        /* compute residue = | Ax - b |_1 */
+      residue = CS_ABS(g[m-1]);
 
-#       pragma omp parallel for if(n_rows > CS_THR_MIN)
-        for (cs_lnum_t jj = 0; jj < n_rows; jj++)
-          bk[jj] -= rhs[jj];
+      if (   residue < convergence->precision * convergence->r_norm
+          || n_iter >= convergence->n_iterations_max)
+        break;
+    }
 
-        residue = sqrt(_dot_product_xx(c, bk));
+    /* Update solution: vx <- vx + M.Q.y */
 
-        cvg = _convergence_test(c, n_iter, residue, convergence);
+    if (m > 1) {
+
+      _solve_diag_sup_halo(hr, m-1, ks, g, x);
 
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        double _s = 0.;
+        for (int k = 0; k < m-1; k++)
+          _s += q[k*wa_size + ii] * x[k];
+        fk[ii] = _s;
       }
 
-      n_iter++;
-      l_iter++;
+      c->setup_data->pc_apply(c->setup_data->pc_context,
+                              rotation_mode,
+                              fk,
+                              gk);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        vx[ii] += gk[ii];
 
-      if (cvg == CS_SLES_CONVERGED || cvg == CS_SLES_MAX_ITERATION ||
-          l_iter == krylov_size - 1   || scaltest == 1) {
-#       pragma omp parallel for if (n_rows > CS_THR_MIN)
-        for (cs_lnum_t jj = 0; jj < n_rows; jj++)
-          vx[jj] = fk[jj];
-        break;
-      }
     }
+    else
+      cvg = CS_SLES_BREAKDOWN;
+
+    if (cvg == CS_SLES_BREAKDOWN)
+      break;
+
   }
 
+  cs_parall_deferred_sum_destroy(&ds);
+
+  BFT_FREE(x);
+  BFT_FREE(l);
+  BFT_FREE(gram0);
+  BFT_FREE(gram2);
+  BFT_FREE(gram);
+  BFT_FREE(ct2);
+  BFT_FREE(ct);
+  BFT_FREE(givens);
+  BFT_FREE(g);
+  BFT_FREE(hr);
+  BFT_FREE(h);
+
   if (_aux_vectors != aux_vectors)
     BFT_FREE(_aux_vectors);
 
@@ -3727,6 +5644,8 @@ cs_sles_it_define(int                 f_id,
   cs_sles_set_error_handler(sc,
                             cs_sles_it_error_post_and_abort);
 
+  cs_sles_set_solve_multi_func(sc, cs_sles_it_solve_multi);
+
   return c;
 }
 
@@ -3814,6 +5733,7 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
   c->setup_data = NULL;
   c->add_data = NULL;
   c->shared = NULL;
+  c->deflation = NULL;
 
   /* Fallback mechanism; note that for fallbacks,
      the preconditioner is shared, so Krylov methods
@@ -3863,6 +5783,10 @@ cs_sles_it_destroy(void **context)
       BFT_FREE(c->add_data->order);
       BFT_FREE(c->add_data);
     }
+    if (c->deflation != NULL) {
+      BFT_FREE(c->deflation->w);
+      BFT_FREE(c->deflation);
+    }
     BFT_FREE(c);
     *context = c;
   }
@@ -3904,6 +5828,9 @@ cs_sles_it_copy(const void  *context)
 #if defined(HAVE_MPI)
     d->comm = c->comm;
 #endif
+
+    if (c->deflation != NULL)
+      cs_sles_it_set_n_deflation_vectors(d, c->deflation->n_max);
   }
 
   return d;
@@ -3937,6 +5864,11 @@ cs_sles_it_log(const void  *context,
     cs_log_printf(log_type,
                   _("  Maximum number of iterations:      %d\n"),
                   c->n_max_iter);
+    if (c->type == CS_SLES_DEFLATED_PCG)
+      cs_log_printf(log_type,
+                    _("  Maximum deflation subspace size:   %d\n"),
+                    (c->deflation != NULL) ?
+                    c->deflation->n_max : _deflation_n_max);
 
   }
 
@@ -4084,6 +6016,10 @@ cs_sles_it_setup(void               *context,
           c->solve = _conjugate_gradient;
         else
           c->solve = _conjugate_gradient_npc;
+#if defined(HAVE_CUDA)
+        if (_conjugate_gradient_cuda_setup(c, a))
+          c->solve = _conjugate_gradient_cuda;
+#endif
         break;
       }
       else {
@@ -4103,6 +6039,14 @@ cs_sles_it_setup(void               *context,
     c->solve = _conjugate_gradient_ip;
     break;
 
+  case CS_SLES_PIPELINED_PCG:
+    c->solve = _conjugate_gradient_pipelined;
+    break;
+
+  case CS_SLES_DEFLATED_PCG:
+    c->solve = _conjugate_gradient_deflated;
+    break;
+
   case CS_SLES_JACOBI:
     if (diag_block_size == 1)
       c->solve = _jacobi;
@@ -4128,6 +6072,10 @@ cs_sles_it_setup(void               *context,
     c->solve = _gmres;
     break;
 
+  case CS_SLES_S_STEP_GMRES:
+    c->solve = _s_step_gmres;
+    break;
+
   case CS_SLES_P_GAUSS_SEIDEL:
     c->solve = _p_gauss_seidel;
     break;
@@ -4336,6 +6284,149 @@ cs_sles_it_solve(void                *context,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call iterative sparse linear equation solver for multiple
+ *        right-hand sides sharing the same matrix.
+ *
+ * Right-hand sides and solutions are interleaved, so that rhs[i*n_vecs + k]
+ * is the value of right-hand side k at row i.
+ *
+ * Only the conjugate gradient with Jacobi or no preconditioning is
+ * currently handled for scalar matrices; false is returned otherwise,
+ * so that the caller may solve systems one by one.
+ *
+ * \param[in, out]  context        pointer to iterative solver info and context
+ *                                 (actual type: cs_sles_it_t  *)
+ * \param[in]       name           pointer to system name
+ * \param[in]       a              matrix
+ * \param[in]       verbosity      associated verbosity
+ * \param[in]       rotation_mode  halo update option for rotational periodicity
+ * \param[in]       n_vecs         number of right-hand sides
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residue normalization for each system
+ * \param[out]      n_iter         number of iterations for each system
+ * \param[out]      residue        residue for each system
+ * \param[out]      state          convergence state for each system
+ * \param[in]       rhs            interleaved right hand sides
+ * \param[in, out]  vx             interleaved system solutions
+ *
+ * \return  true if systems were solved, false if not handled
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_it_solve_multi(void                         *context,
+                       const char                   *name,
+                       const cs_matrix_t            *a,
+                       int                           verbosity,
+                       cs_halo_rotation_t            rotation_mode,
+                       int                           n_vecs,
+                       double                        precision,
+                       const double                  r_norm[],
+                       int                           n_iter[],
+                       double                        residue[],
+                       cs_sles_convergence_state_t   state[],
+                       const cs_real_t              *rhs,
+                       cs_real_t                    *vx)
+{
+  cs_sles_it_t  *c = context;
+
+  /* Check if settings are handled */
+
+  if (c->type != CS_SLES_PCG)
+    return false;
+
+  if (cs_matrix_get_diag_block_size(a)[0] != 1)
+    return false;
+
+  bool jacobi = false;
+  if (c->pc != NULL) {
+    const char *pc_type = cs_sles_pc_get_type(c->pc);
+    if (strcmp(pc_type, "jacobi") == 0)
+      jacobi = true;
+    else if (strcmp(pc_type, "none") != 0)
+      return false;
+  }
+
+#if defined(HAVE_MPI)
+  if (c->comm != c->caller_comm && c->caller_n_ranks > 1)
+    return false;
+#endif
+
+  /* Setup if not already done */
+
+  if (c->setup_data == NULL)
+    cs_sles_it_setup(c, name, a, verbosity);
+
+  cs_timer_t t0 = {0, 0, 0, 0}, t1;
+  if (c->update_stats == true)
+    t0 = cs_timer_time();
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  cs_real_t *ad_inv = NULL;
+  if (jacobi) {
+    BFT_MALLOC(ad_inv, n_rows, cs_real_t);
+    cs_matrix_copy_diagonal(a, ad_inv);
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      ad_inv[ii] = 1.0 / ad_inv[ii];
+  }
+
+  if (verbosity > 1)
+    bft_printf(_("\n %s [%s]: %d right-hand sides\n"),
+               _(cs_sles_it_type_name[c->type]), name, n_vecs);
+
+  _conjugate_gradient_multi(c,
+                            a,
+                            rotation_mode,
+                            n_vecs,
+                            precision,
+                            r_norm,
+                            ad_inv,
+                            rhs,
+                            vx,
+                            n_iter,
+                            residue,
+                            state);
+
+  BFT_FREE(ad_inv);
+
+  for (int k = 0; k < n_vecs; k++) {
+    if (verbosity > 1 || (state[k] == CS_SLES_MAX_ITERATION && verbosity > -1))
+      bft_printf(_("  rhs %d: n_iter: %5d, res_abs: %11.4e, norm: %11.4e\n"),
+                 k, n_iter[k], residue[k], r_norm[k]);
+    if (state[k] == CS_SLES_MAX_ITERATION && verbosity > -1)
+      bft_printf(_(" @@ Warning: non convergence\n"));
+  }
+
+  /* Update statistics (each system counts as one solve) */
+
+  if (c->update_stats == true) {
+
+    t1 = cs_timer_time();
+
+    for (int k = 0; k < n_vecs; k++) {
+      unsigned _n_iter = n_iter[k];
+      c->n_solves += 1;
+      if (c->n_iterations_tot == 0)
+        c->n_iterations_min = _n_iter;
+      else if (c->n_iterations_min > _n_iter)
+        c->n_iterations_min = _n_iter;
+      if (c->n_iterations_max < _n_iter)
+        c->n_iterations_max = _n_iter;
+      c->n_iterations_last = _n_iter;
+      c->n_iterations_tot += _n_iter;
+    }
+
+    cs_timer_counter_add_diff(&(c->t_solve), &t0, &t1);
+
+  }
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free iterative sparse linear equation solver setup context.
@@ -4365,6 +6456,10 @@ cs_sles_it_free(void  *context)
     cs_sles_pc_free(c->_pc);
 
   if (c->setup_data != NULL) {
+#if defined(HAVE_CUDA)
+    cs_matrix_cuda_destroy(&(c->setup_data->d_matrix));
+    cs_base_cuda_free(c->setup_data->d_wa);
+#endif
     BFT_FREE(c->setup_data->_ad_inv);
     BFT_FREE(c->setup_data);
   }
@@ -4661,6 +6756,48 @@ cs_sles_it_set_fallback_threshold(cs_sles_it_t                 *context,
   context->fallback_cvg = threshold;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the maximum number of vectors kept in the deflation subspace
+ *        of a deflated conjugate gradient solver.
+ *
+ * The subspace is built from the solutions of previous solves with the same
+ * solver context, and is used both to project the initial guess and to
+ * deflate the following iterations. A size of 0 disables deflation.
+ *
+ * \param[in, out]  context  pointer to iterative solver info and context
+ * \param[in]       n_max    maximum number of subspace vectors
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_n_deflation_vectors(cs_sles_it_t  *context,
+                                   int            n_max)
+{
+  if (n_max < 0)
+    n_max = 0;
+
+  if (context->deflation == NULL) {
+    BFT_MALLOC(context->deflation, 1, cs_sles_it_deflation_t);
+    context->deflation->n_vectors = 0;
+    context->deflation->n_rows = 0;
+    context->deflation->w = NULL;
+  }
+
+  cs_sles_it_deflation_t *df = context->deflation;
+
+  /* Keep the most recent vectors if the subspace is reduced */
+
+  if (df->n_vectors > n_max) {
+    cs_lnum_t shift = (df->n_vectors - n_max) * df->n_rows;
+    memmove(df->w, df->w + shift, n_max*df->n_rows*sizeof(cs_real_t));
+    df->n_vectors = n_max;
+  }
+
+  df->n_max = n_max;
+  BFT_REALLOC(df->w, (size_t)n_max*df->n_rows, cs_real_t);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Query mean number of rows under which Conjugate Gradient algorithm
@@ -4715,6 +6852,83 @@ cs_sles_it_set_pcg_single_reduction(cs_lnum_t  threshold)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether Conjugate Gradient should use a device-resident
+ *        variant when possible.
+ *
+ * \returns  true if the device-resident variant is used when possible
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_it_get_pcg_use_device(void)
+{
+  return _pcg_use_device;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether Conjugate Gradient should use a device-resident
+ *        variant when possible.
+ *
+ * This variant keeps the matrix and work vectors on the device across
+ * iterations, and only transfers halo values between host and device.
+ * It is used for Jacobi-preconditioned conjugate gradient with scalar
+ * CSR or MSR matrices, when a CUDA device is available, and when the
+ * single-reduction variant is not selected. This option is ignored
+ * for builds without CUDA support.
+ *
+ * \param[in]  use_device  true if the device-resident variant should be
+ *                         used when possible
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_pcg_use_device(bool  use_device)
+{
+#if defined(HAVE_CUDA)
+  _pcg_use_device = use_device;
+#else
+  CS_UNUSED(use_device);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query the number of basis vectors generated per block
+ *        by s-step GMRES.
+ *
+ * \returns  number of basis vectors per block
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_sles_it_get_gmres_s_step(void)
+{
+  return _gmres_s_step;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the number of basis vectors generated per block
+ *        by s-step GMRES.
+ *
+ * Each block of s vectors requires a single reduction for its
+ * orthogonalization (or 2 when the block is ill-conditioned), instead
+ * of one reduction per vector for GMRES. Larger blocks lead to less
+ * well-conditioned bases, so values above 8 are not recommended.
+ *
+ * \param[in]  s  number of basis vectors per block (1 to 20)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_gmres_s_step(int  s)
+{
+  _gmres_s_step = CS_MAX(CS_MIN(s, 20), 1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log the current global settings relative to parallelism.
@@ -4729,8 +6943,9 @@ cs_sles_it_log_parallel_options(void)
     cs_log_printf(CS_LOG_SETUP,
                   _("\n"
                     "Iterative linear solvers parallel parameters:\n"
-                    "  PCG single-reduction threshold:     %ld\n"),
-                  (long)_pcg_sr_threshold);
+                    "  PCG single-reduction threshold:     %ld\n"
+                    "  s-step GMRES block size:            %d\n"),
+                  (long)_pcg_sr_threshold, _gmres_s_step);
 #endif
 }
 
@@ -60,6 +60,12 @@ typedef enum {
   CS_SLES_FCG,                 /*!< Preconditions flexible conjugate gradient,
                                     described in \cite Notay:2015 */
   CS_SLES_IPCG,                /*!< Preconditions inexact conjugate gradient */
+  CS_SLES_PIPELINED_PCG,       /*!< Pipelined preconditioned conjugate gradient,
+                                    with a single overlapped reduction
+                                    per iteration */
+  CS_SLES_DEFLATED_PCG,        /*!< Preconditioned conjugate gradient,
+                                    deflated using a subspace recycled
+                                    from previous solves */
   CS_SLES_JACOBI,              /*!< Jacobi */
   CS_SLES_BICGSTAB,            /*!< Preconditioned BiCGstab
                                     (biconjugate gradient stabilized) */
@@ -67,6 +73,9 @@ typedef enum {
   CS_SLES_GCR,                 /*! Generalized conjugate residual  */
   CS_SLES_GMRES,               /*!< Preconditioned GMRES
                                     (generalized minimal residual) */
+  CS_SLES_S_STEP_GMRES,        /*!< Preconditioned s-step GMRES, with
+                                    block orthogonalization (one reduction
+                                    per block of basis vectors) */
   CS_SLES_P_GAUSS_SEIDEL,      /*!< Process-local Gauss-Seidel */
   CS_SLES_P_SYM_GAUSS_SEIDEL,  /*!< Process-local symmetric Gauss-Seidel */
   CS_SLES_PCR3,                /*!< 3-layer conjugate residual */
@@ -77,6 +86,8 @@ typedef enum {
 
   CS_SLES_TS_F_GAUSS_SEIDEL,   /*!< Truncated forward Gauss-Seidel smoother */
   CS_SLES_TS_B_GAUSS_SEIDEL,   /*!< Truncated backward Gauss-Seidel smoother */
+  CS_SLES_CHEBYSHEV,           /*!< Jacobi-preconditioned Chebyshev
+                                    polynomial smoother */
 
   CS_SLES_N_SMOOTHER_TYPES     /*!< Number of resolution algorithms
                                     including smoother only */
@@ -275,6 +286,52 @@ cs_sles_it_solve(void                *context,
                  size_t               aux_size,
                  void                *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Call iterative sparse linear equation solver for multiple right-hand
+ * sides sharing the same matrix.
+ *
+ * Right-hand sides and solutions are interleaved, so that rhs[i*n_vecs + k]
+ * is the value of right-hand side k at row i.
+ *
+ * Only the conjugate gradient with Jacobi or no preconditioning is
+ * currently handled for scalar matrices; false is returned otherwise,
+ * so that the caller may solve systems one by one.
+ *
+ * parameters:
+ *   context       <-> pointer to iterative sparse linear solver info
+ *                     (actual type: cs_sles_it_t  *)
+ *   name          <-- pointer to system name
+ *   a             <-- matrix
+ *   verbosity     <-- verbosity level
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   n_vecs        <-- number of right-hand sides
+ *   precision     <-- solver precision
+ *   r_norm        <-- residue normalization for each system
+ *   n_iter        --> number of iterations for each system
+ *   residue       --> residue for each system
+ *   state         --> convergence state for each system
+ *   rhs           <-- interleaved right hand sides
+ *   vx            <-> interleaved system solutions
+ *
+ * returns:
+ *   true if systems were solved, false if not handled
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_sles_it_solve_multi(void                         *context,
+                       const char                   *name,
+                       const cs_matrix_t            *a,
+                       int                           verbosity,
+                       cs_halo_rotation_t            rotation_mode,
+                       int                           n_vecs,
+                       double                        precision,
+                       const double                  r_norm[],
+                       int                           n_iter[],
+                       double                        residue[],
+                       cs_sles_convergence_state_t   state[],
+                       const cs_real_t              *rhs,
+                       cs_real_t                    *vx);
+
 /*----------------------------------------------------------------------------
  * Free iterative sparse linear equation solver setup context.
  *
@@ -477,6 +534,24 @@ void
 cs_sles_it_set_fallback_threshold(cs_sles_it_t                 *context,
                                   cs_sles_convergence_state_t   threshold);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the maximum number of vectors kept in the deflation subspace
+ *        of a deflated conjugate gradient solver.
+ *
+ * The subspace is built from the solutions of previous solves with the same
+ * solver context, and is used both to project the initial guess and to
+ * deflate the following iterations. A size of 0 disables deflation.
+ *
+ * \param[in, out]  context  pointer to iterative solver info and context
+ * \param[in]       n_max    maximum number of subspace vectors
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_n_deflation_vectors(cs_sles_it_t  *context,
+                                   int            n_max);
+
 /*----------------------------------------------------------------------------
  * Query mean number of rows under which Conjugate Gradient algorithm
  * uses the single-reduction variant.
@@ -517,6 +592,65 @@ cs_sles_it_get_pcg_single_reduction(void);
 void
 cs_sles_it_set_pcg_single_reduction(cs_lnum_t  threshold);
 
+/*----------------------------------------------------------------------------
+ * Query whether Conjugate Gradient should use a device-resident
+ * variant when possible.
+ *
+ * return:
+ *   true if the device-resident variant is used when possible
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_sles_it_get_pcg_use_device(void);
+
+/*----------------------------------------------------------------------------
+ * Indicate whether Conjugate Gradient should use a device-resident
+ * variant when possible.
+ *
+ * This variant keeps the matrix and work vectors on the device across
+ * iterations, and only transfers halo values between host and device.
+ * It is used for Jacobi-preconditioned conjugate gradient with scalar
+ * CSR or MSR matrices, when a CUDA device is available, and when the
+ * single-reduction variant is not selected. This option is ignored
+ * for builds without CUDA support.
+ *
+ * parameters:
+ *   use_device <-- true if the device-resident variant should be
+ *                  used when possible
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_pcg_use_device(bool  use_device);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query the number of basis vectors generated per block
+ *        by s-step GMRES.
+ *
+ * \returns  number of basis vectors per block
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_sles_it_get_gmres_s_step(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the number of basis vectors generated per block
+ *        by s-step GMRES.
+ *
+ * Each block of s vectors requires a single reduction for its
+ * orthogonalization (or 2 when the block is ill-conditioned), instead
+ * of one reduction per vector for GMRES. Larger blocks lead to less
+ * well-conditioned bases, so values above 8 are not recommended.
+ *
+ * \param[in]  s  number of basis vectors per block (1 to 20)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_gmres_s_step(int  s);
+
 /*----------------------------------------------------------------------------
  * Log the current global settings relative to parallelism.
  *----------------------------------------------------------------------------*/
@@ -236,11 +236,16 @@ cs_sles_it_setup_priv(cs_sles_it_t       *c,
     sd->_ad_inv = NULL;
     sd->pc_context = NULL;
     sd->pc_apply = NULL;
+#if defined(HAVE_CUDA)
+    sd->d_matrix = NULL;
+    sd->d_wa = NULL;
+#endif
   }
 
   sd->n_rows = cs_matrix_get_n_rows(a) * diag_block_size;
 
   sd->initial_residue = -1;
+  sd->lambda_max = -1;
 
   const cs_sles_it_t  *s = c->shared;
 
@@ -61,10 +61,15 @@
 #include "cs_matrix.h"
 #include "cs_matrix_default.h"
 #include "cs_matrix_util.h"
+#include "cs_parall.h"
 #include "cs_post.h"
 #include "cs_timer.h"
 #include "cs_time_plot.h"
 
+#if defined(HAVE_CUDA)
+#include "cs_matrix_cuda.h"
+#endif
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -134,9 +139,18 @@ typedef struct _cs_sles_it_setup_t {
   cs_real_t           *_ad_inv;          /* private pointer to
                                             diagonal inverse */
 
+  double               lambda_max;       /* estimated largest eigenvalue
+                                            of diag^-1.A for Chebyshev
+                                            smoothing (< 0 if unknown) */
+
   void                *pc_context;       /* preconditioner context */
   cs_sles_pc_apply_t  *pc_apply;         /* preconditioner apply */
 
+#if defined(HAVE_CUDA)
+  cs_matrix_cuda_t    *d_matrix;         /* device-resident matrix, or NULL */
+  cs_real_t           *d_wa;             /* device work arrays, or NULL */
+#endif
+
 } cs_sles_it_setup_t;
 
 /* Solver additional data */
@@ -148,6 +162,22 @@ typedef struct _cs_sles_it_add_t {
 
 } cs_sles_it_add_t;
 
+/* Deflation subspace, kept across solves */
+/*----------------------------------------*/
+
+typedef struct _cs_sles_it_deflation_t {
+
+  int                  n_max;            /* maximum number of vectors */
+  int                  n_vectors;        /* current number of vectors */
+
+  cs_lnum_t            n_rows;           /* number of rows of vectors */
+
+  cs_real_t           *w;                /* orthonormal subspace vectors,
+                                            oldest first (interleaved
+                                            by vector, size n_max*n_rows) */
+
+} cs_sles_it_deflation_t;
+
 /* Basic per linear system options and logging */
 /*---------------------------------------------*/
 
@@ -213,6 +243,9 @@ struct _cs_sles_it_t {
 
   cs_sles_it_setup_t          *setup_data; /* setup data */
 
+  cs_sles_it_deflation_t      *deflation;  /* deflation subspace kept across
+                                              solves, or NULL */
+
   /* Alternative solvers (fallback or heuristics) */
 
   cs_sles_convergence_state_t  fallback_cvg;  /* threshold for fallback
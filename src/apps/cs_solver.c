@@ -45,6 +45,8 @@
 
 #include "cs_ale.h"
 #include "cs_all_to_all.h"
+#include "cs_bad_cells_regularisation.h"
+#include "cs_balance_by_zone.h"
 #include "cs_base.h"
 #include "cs_base_fortran.h"
 #include "cs_benchmark.h"
@@ -55,7 +57,9 @@
 #include "cs_control.h"
 #include "cs_coupling.h"
 #include "cs_ctwr.h"
+#include "cs_elec_model.h"
 #include "cs_domain_setup.h"
+#include "cs_equation_iterative_solve.h"
 #include "cs_fan.h"
 #include "cs_field.h"
 #include "cs_field_pointer.h"
@@ -76,6 +80,7 @@
 #include "cs_join.h"
 #include "cs_lagr.h"
 #include "cs_lagr_tracking.h"
+#include "cs_les_filter.h"
 #include "cs_les_inflow.h"
 #include "cs_log.h"
 #include "cs_log_setup.h"
@@ -89,6 +94,7 @@
 #include "cs_mesh_quantities.h"
 #include "cs_mesh_bad_cells.h"
 #include "cs_mesh_smoother.h"
+#include "cs_node_shared.h"
 #include "cs_notebook.h"
 #include "cs_opts.h"
 #include "cs_param_cdo.h"
@@ -271,6 +277,8 @@ _run(void)
     cs_gui_linear_solvers();
     cs_user_linear_solvers();
 
+    cs_elec_define_linear_solvers();
+
     cs_base_fortran_bft_printf_to_c();
 
     cs_ctwr_build_zones();
@@ -316,9 +324,13 @@ _run(void)
 
   /* Preprocess mesh */
 
+  bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_MESH);
+
   cs_preprocess_mesh(halo_type);
   cs_mesh_adjacencies_initialize();
 
+  bft_mem_tag_end(mem_tag);
+
   /* Initialization for turbomachinery computations */
 
   cs_turbomachinery_initialize();
@@ -375,6 +387,11 @@ _run(void)
                                  cs_glob_mesh,
                                  cs_glob_mesh_quantities);
 
+    /* Map mesh quantities used by offloaded loops to the OpenMP
+       target device, if available */
+
+    cs_mesh_quantities_device_map(cs_glob_mesh, cs_glob_mesh_quantities);
+
     /* Initialize gradient computation */
 
     cs_gradient_initialize();
@@ -469,6 +486,10 @@ _run(void)
 
     cs_les_inflow_finalize();
 
+    /* Finalize filters for dynamic models */
+
+    cs_les_filter_finalize();
+
   }
 
   /* Finalize user extra operations */
@@ -477,6 +498,8 @@ _run(void)
 
   /* Finalize linear system resolution */
 
+  cs_equation_iterative_solve_finalize();
+  cs_bad_cells_regularisation_reset();
   cs_sles_default_finalize();
 
   /* Switch logging back to C (may be moved depending on Fortran dependencies) */
@@ -505,7 +528,9 @@ _run(void)
 
   cs_control_finalize();
 
-  /* Free the checkpoint multiwriter structure */
+  /* Complete pending checkpoint writes and free the
+     checkpoint multiwriter structure */
+  cs_restart_checkpoint_wait();
   cs_restart_multiwriters_destroy_all();
 
   /* Print some mesh statistics */
@@ -536,6 +561,7 @@ _run(void)
 
   cs_probe_finalize();
   cs_post_finalize();
+  cs_balance_by_zone_finalize();
   cs_log_iteration_destroy_all();
 
   /* Free moments info */
@@ -549,6 +575,8 @@ _run(void)
 
   cs_notebook_destroy_all();
 
+  cs_field_log_lookup_stats();
+
   cs_field_pointer_destroy_all();
   cs_field_destroy_all();
   cs_field_destroy_all_keys();
@@ -568,6 +596,8 @@ _run(void)
   cs_mesh_quantities_destroy(cs_glob_mesh_quantities);
   cs_mesh_destroy(cs_glob_mesh);
 
+  cs_node_shared_finalize();
+
   /* Free parameters tree info */
 
   cs_tree_node_free(&cs_glob_tree);
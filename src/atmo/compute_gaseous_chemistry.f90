@@ -82,6 +82,7 @@ double precision rk(nrg)
 double precision dtc
 integer ncycle
 double precision dtrest
+logical l_thr
 
 double precision, dimension(:), pointer :: crom
 type(pmapper_double_r1), dimension(:), allocatable :: cvar_espg, cvara_espg
@@ -99,6 +100,17 @@ do ii = 1, nespg
   call field_get_val_prev_s(ivarfl(isca(isca_chem(ii))), cvara_espg(ii)%p)
 enddo
 
+! Cells are independent, and the predefined schemes (1 to 3) only use
+! local work arrays, so they may be handled by separate threads.
+! The cost of each cell depends on the number of chemistry sub-cycles
+! (so on the local time step), hence the dynamic schedule.
+! The user-defined scheme (ssh library) is handled by a single thread.
+
+l_thr = (ichemistry.ge.1 .and. ichemistry.le.3 .and. ncel.gt.thr_n_min)
+
+!$omp parallel do if(l_thr) schedule(dynamic, 64)                    &
+!$omp private(ii, dtc, rom, rk, dlconc, source, dchema, conv_factor,  &
+!$omp         ncycle, dtrest)
 do iel = 1, ncel
 
   ! time step
@@ -178,6 +190,7 @@ do iel = 1, ncel
   enddo
 
 enddo
+!$omp end parallel do
 
 deallocate(cvar_espg, cvara_espg)
 
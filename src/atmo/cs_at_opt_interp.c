@@ -51,6 +51,7 @@
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_quantities.h"
+#include "cs_node_shared.h"
 #include "cs_parall.h"
 #include "cs_math.h"
 #include "cs_time_step.h"
@@ -116,6 +117,26 @@ static int _p1_projection_needed = 0;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Free observation error covariances.
+ *
+ * Full covariance matrices are stored once per compute node.
+ *
+ * parameters:
+ *   oi        <->   pointer to an optimal interpolation
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_obs_cov(cs_at_opt_interp_t  *oi)
+{
+  if (oi->obs_cov_is_diag)
+    BFT_FREE(oi->obs_cov);
+  else {
+    cs_node_shared_free(oi->obs_cov);
+    oi->obs_cov = NULL;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute observation operator (H) as a P0 interpolation operator.
  *
@@ -426,8 +447,10 @@ _p1_projection(cs_measures_set_t  *ms,
  *   xj     <-- x coordinate of point J
  *   yj     <-- y coordinate of point J
  *   zj     <-- z coordinate of point J
- *   ir_xy2 <-- square of influence radius with respect to x and y
- *   ir_z2  <-- square of influence radius with respect to z
+ *   ir_xy2  <-- square of influence radius with respect to x and y
+ *   ir_z2   <-- square of influence radius with respect to z
+ *   cutoff2 <-- square of relative distance above which the coefficient
+ *               is neglected (no cutoff if <= 0)
  *----------------------------------------------------------------------------*/
 
 inline static cs_real_t
@@ -438,15 +461,99 @@ _b_matrix(cs_real_t  xi,
           cs_real_t  yj,
           cs_real_t  zj,
           cs_real_t  ir_xy2,
-          cs_real_t  ir_z2)
+          cs_real_t  ir_z2,
+          cs_real_t  cutoff2)
 {
-  cs_real_t dist = sqrt( ( cs_math_sq(xi - xj)
-                         + cs_math_sq(yi - yj) )/ir_xy2
-                       + cs_math_sq(zi - zj)/ir_z2);
+  cs_real_t dist2 = ( cs_math_sq(xi - xj)
+                    + cs_math_sq(yi - yj) )/ir_xy2
+                  + cs_math_sq(zi - zj)/ir_z2;
+
+  if (cutoff2 > 0. && dist2 > cutoff2)
+    return 0.;
+
+  cs_real_t dist = sqrt(dist2);
 
   return (1. + dist) * exp(-dist);
 }
 
+/*----------------------------------------------------------------------------
+ * Select active observations whose projection points are close enough
+ * to the local cells to contribute to their analysis increments.
+ *
+ * The relative distance of each projection point to the bounding box
+ * of local cells is compared to the covariance cutoff.
+ *
+ * parameters:
+ *   oi           <-- pointer to optimal interpolation
+ *   dim          <-- dimension of measures
+ *   n_active_obs <-- number of active observations
+ *   ao_idx       <-- index of active observations
+ *   l_obs        --> ids (in active observations) of selected observations
+ *
+ * returns:
+ *   number of selected observations
+ *----------------------------------------------------------------------------*/
+
+static int
+_local_active_obs(const cs_at_opt_interp_t  *oi,
+                  int                        dim,
+                  int                        n_active_obs,
+                  const int                  ao_idx[],
+                  int                        l_obs[])
+{
+  if (oi->ir_cutoff <= 0.) {
+    for (int ll = 0; ll < n_active_obs; ll++)
+      l_obs[ll] = ll;
+    return n_active_obs;
+  }
+
+  const cs_mesh_t *mesh = cs_glob_mesh;
+  const cs_real_3_t  *restrict cell_cen
+    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->cell_cen;
+
+  const cs_real_t *proj = oi->model_to_obs_proj;
+  const cs_lnum_t *proj_idx = oi->model_to_obs_proj_idx;
+  const int stride = dim + 3;
+
+  const cs_real_t ir2[3] = {cs_math_sq(oi->ir[0]),
+                            cs_math_sq(oi->ir[0]),
+                            cs_math_sq(oi->ir[1])};
+  const cs_real_t cutoff2 = cs_math_sq(oi->ir_cutoff);
+
+  /* Bounding box of local cells */
+
+  cs_real_t c_min[3] = {cs_math_big_r, cs_math_big_r, cs_math_big_r};
+  cs_real_t c_max[3] = {-cs_math_big_r, -cs_math_big_r, -cs_math_big_r};
+
+  for (cs_lnum_t c_id = 0; c_id < mesh->n_cells; c_id++) {
+    for (int kk = 0; kk < 3; kk++) {
+      c_min[kk] = CS_MIN(c_min[kk], cell_cen[c_id][kk]);
+      c_max[kk] = CS_MAX(c_max[kk], cell_cen[c_id][kk]);
+    }
+  }
+
+  int n_l_obs = 0;
+
+  for (int ll = 0; ll < n_active_obs; ll++) {
+    for (cs_lnum_t mm = proj_idx[ao_idx[ll]];
+         mm < proj_idx[ao_idx[ll]+1];
+         mm++) {
+      const cs_real_t *x = proj + mm*stride + dim;
+      cs_real_t dist2 = 0.;
+      for (int kk = 0; kk < 3; kk++) {
+        cs_real_t d = CS_MAX(CS_MAX(c_min[kk] - x[kk], x[kk] - c_max[kk]), 0.);
+        dist2 += d*d/ir2[kk];
+      }
+      if (dist2 <= cutoff2) {
+        l_obs[n_l_obs++] = ll;
+        break;
+      }
+    }
+  }
+
+  return n_l_obs;
+}
+
 /*----------------------------------------------------------------------------
  * Assemble full matrix HB(H)t+R.
  *----------------------------------------------------------------------------*/
@@ -587,6 +694,7 @@ cs_at_opt_interp_create(const char   *name)
     oi->times = NULL;
     oi->times_read = NULL;
     oi->obs_cov = NULL;
+    oi->obs_cov_is_diag = true;
     oi->measures_idx = NULL;
     oi->model_to_obs_proj = NULL;
     oi->model_to_obs_proj_idx = NULL;
@@ -600,7 +708,7 @@ cs_at_opt_interp_create(const char   *name)
     BFT_FREE(oi->relax);
     BFT_FREE(oi->times);
     BFT_FREE(oi->times_read);
-    BFT_FREE(oi->obs_cov);
+    _free_obs_cov(oi);
     BFT_FREE(oi->measures_idx);
     BFT_FREE(oi->model_to_obs_proj);
     BFT_FREE(oi->model_to_obs_proj_idx);
@@ -678,7 +786,7 @@ cs_at_opt_interps_destroy(void)
     cs_at_opt_interp_t  *oi = _opt_interps + i;
     BFT_FREE(oi->b_proj);
     BFT_FREE(oi->relax);
-    BFT_FREE(oi->obs_cov);
+    _free_obs_cov(oi);
     BFT_FREE(oi->times);
     BFT_FREE(oi->times_read);
     BFT_FREE(oi->measures_idx);
@@ -730,6 +838,7 @@ cs_at_opt_interp_read_file(char const           filename[50],
   oi->nb_times = 0;
   oi->ir[0] = 100.;
   oi->ir[1] = 100.;
+  oi->ir_cutoff = 0.;
   oi->n_log_data = 10;
   oi->interp_type = CS_AT_OPT_INTERP_P0;
   oi->steady = -1;
@@ -897,6 +1006,16 @@ cs_at_opt_interp_read_file(char const           filename[50],
       }
     }
 
+    /* Reading model covariance cutoff (relative to influence radii) */
+    if (strncmp(line, "_cutoff_", 8) == 0) {
+      fscanf(fichier, "%lf", &(oi->ir_cutoff));
+
+#if _OI_DEBUG_
+      bft_printf("   * Reading _cutoff_ : %.2f\n", oi->ir_cutoff);
+#endif
+
+    }
+
     /* Reading relaxation time */
     if (strncmp(line, "_t_", 3) == 0) {
       cs_real_t *tau = NULL;
@@ -1175,13 +1294,24 @@ cs_at_opt_interp_read_file(char const           filename[50],
 #endif
 
       } else if (strncmp(line,"full", 4) == 0) {
-        BFT_MALLOC(oi->obs_cov, ms->dim*n_obs*ms->dim*n_obs, cs_real_t);
+        /* Full matrix stored once per compute node; other ranks
+           skip the values */
+
+        bool is_writer = true;
+        size_t n_bytes = (size_t)ms->dim*n_obs*ms->dim*n_obs*sizeof(cs_real_t);
+        oi->obs_cov = cs_node_shared_malloc(n_bytes, &is_writer);
         oi->obs_cov_is_diag = false;
 
         for (int ii = 0; ii < n_obs; ii++)
           for (int jj = 0; jj < n_obs; jj++)
-            for (int kk = 0; kk < ms->dim; kk++)
-              fscanf(fichier, "%lf", oi->obs_cov + ms->dim*(ii*n_obs + jj) + kk);
+            for (int kk = 0; kk < ms->dim; kk++) {
+              double v;
+              fscanf(fichier, "%lf", &v);
+              if (is_writer)
+                oi->obs_cov[ms->dim*(ii*n_obs + jj) + kk] = v;
+            }
+
+        cs_node_shared_sync(oi->obs_cov);
 
 #if _OI_DEBUG_
         bft_printf("   * Reading _errors_ : full\n");
@@ -1389,9 +1519,14 @@ cs_at_opt_interp_project_model_covariance(cs_measures_set_t  *ms,
 
   const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
   const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
+  const cs_real_t cutoff2
+    = (oi->ir_cutoff > 0.) ? cs_math_sq(oi->ir_cutoff) : -1.;
 
+  /* The matrix is symmetric, so only its upper part is computed */
+
+# pragma omp parallel for schedule(dynamic)
   for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
-    for (cs_lnum_t jj = 0; jj < n_obs; jj++) {
+    for (cs_lnum_t jj = ii; jj < n_obs; jj++) {
       for (int pp = 0; pp < dim; pp++)
         b_proj[dim*(ii*n_obs + jj) + pp] = 0;
 
@@ -1405,13 +1540,20 @@ cs_at_opt_interp_project_model_covariance(cs_measures_set_t  *ms,
           cs_real_t y2 = (proj + ll*stride)[dim+1];
           cs_real_t z2 = (proj + ll*stride)[dim+2];
 
-          cs_real_t influ = _b_matrix(x1, y1, z1, x2, y2, z2, ir_xy2, ir_z2);
+          cs_real_t influ = _b_matrix(x1, y1, z1, x2, y2, z2,
+                                      ir_xy2, ir_z2, cutoff2);
+
+          if (influ <= 0.)
+            continue;
 
           for (int pp = 0; pp < dim; pp++)
             b_proj[dim*(ii*n_obs + jj) + pp] += (proj + kk*stride)[pp] * (proj + ll*stride)[pp]
                                               * influ;
         }
       }
+
+      for (int pp = 0; pp < dim; pp++)
+        b_proj[dim*(jj*n_obs + ii) + pp] = b_proj[dim*(ii*n_obs + jj) + pp];
     }
   }
 }
@@ -1723,12 +1865,25 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
 
   const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
   const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
+  const cs_real_t cutoff2
+    = (oi->ir_cutoff > 0.) ? cs_math_sq(oi->ir_cutoff) : -1.;
+
+  /* With a covariance cutoff, only observations close to the local
+     cells contribute to their increments */
+
+  int *l_obs = NULL;
+  BFT_MALLOC(l_obs, n_active_obs, int);
+
+  const int n_l_obs = _local_active_obs(oi, m_dim, n_active_obs, ao_idx,
+                                        l_obs);
 
+# pragma omp parallel for if (mesh->n_cells > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < mesh->n_cells; ii++) {
     f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] =
       f->val_pre[ii*f_dim+ms->comp_ids[mc_id]];
 
-    for (int ll = 0; ll < n_active_obs; ll++) {
+    for (int l_id = 0; l_id < n_l_obs; l_id++) {
+      int ll = l_obs[l_id];
       for (int mm = proj_idx[ao_idx[ll]];
            mm < proj_idx[ao_idx[ll]+1];
            mm++) {
@@ -1739,11 +1894,13 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
                                                    * _b_matrix(cell_cen[ii][0],
                                                                cell_cen[ii][1],
                                                                cell_cen[ii][2],
-                                                               x, y, z, ir_xy2, ir_z2);
+                                                               x, y, z, ir_xy2,
+                                                               ir_z2, cutoff2);
       }
     }
   }
 
+  BFT_FREE(l_obs);
   BFT_FREE(vect);
 }
 
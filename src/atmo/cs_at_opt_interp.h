@@ -72,6 +72,9 @@ typedef struct _cs_at_opt_interp_t {
   cs_lnum_t               *model_to_obs_proj_c_ids;
   cs_real_t               *b_proj;
   cs_real_t                ir[2];
+  cs_real_t                ir_cutoff;           /* Cutoff of model covariance,
+                                                   relative to influence radii
+                                                   (none if <= 0) */
   cs_real_t               *relax;
   int                      nb_times;
   int                     *measures_idx;
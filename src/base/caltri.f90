@@ -994,6 +994,10 @@ if (itrale.gt.0) then
 
   call uiexop()
 
+  ! Balances by zone defined at setup
+
+  call cs_balance_by_zone_compute_all()
+
   call cs_f_user_extra_operations(nvar, nscal, dt)
 
   call user_extra_operations()
@@ -1151,6 +1155,14 @@ if (itrale.le.0) then
   write(nfecra,3012)titer2-titer1
 endif
 
+!===============================================================================
+! Check load balance (writes a weighted partitioning for restart if required)
+!===============================================================================
+
+if (itrale.gt.0) then
+  call cs_partition_check_load_balance
+endif
+
 !===============================================================================
 ! End of time loop
 !===============================================================================
@@ -76,10 +76,12 @@ double precision hbord(nfabor),tbord(nfabor)
 
 integer          iappel
 integer          ifac, iel , ii
+integer          nlst1d
 
 double precision energ, cvt
 
 double precision, dimension(:), allocatable :: wa
+integer, dimension(:), allocatable :: lst1d
 double precision, dimension(:,:), pointer :: vel
 double precision, dimension(:), pointer :: cpro_cp, cpro_cv, cpro_rho
 
@@ -171,6 +173,11 @@ call cs_user_1d_wall_thermal(iappel, isuit1)
 iappel = 3
 call cs_1d_wall_thermal_check(iappel, isuit1)
 
+! Select faces to solve (0 to n-1 numbering)
+allocate(lst1d(nfpt1d))
+
+nlst1d = 0
+
 ! coupling with radiative module
 if (iirayo.ge.1) then
 
@@ -183,7 +190,8 @@ if (iirayo.ge.1) then
     ! plusieurs faces, paroi + autre
     if (itypfb(ifac).eq.iparoi.or.itypfb(ifac).eq.iparug) then
 
-      call cs_1d_wall_thermal_solve(ii-1, tbord(ifac), hbord(ifac))
+      nlst1d = nlst1d + 1
+      lst1d(nlst1d) = ii-1
 
     endif
 
@@ -194,14 +202,17 @@ else
 
   do ii = 1, nfpt1d
 
-    ifac = ifpt1d(ii)
-
-    call cs_1d_wall_thermal_solve(ii-1, tbord(ifac), hbord(ifac))
+    nlst1d = nlst1d + 1
+    lst1d(nlst1d) = ii-1
 
   enddo
 
 endif
 
+call cs_1d_wall_thermal_solve_faces(nlst1d, lst1d, tbord, hbord)
+
+deallocate(lst1d)
+
 if (itherm .gt. 1) deallocate(wa)
 
 return
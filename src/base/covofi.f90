@@ -393,8 +393,11 @@ endif
 
 allocate(xcpp(ncelet))
 
+! Constant values are set on ghost cells too, so that no halo
+! synchronization (and associated latency) is needed for each scalar
+
 if (imucpp.eq.0) then
-  do iel = 1, ncel
+  do iel = 1, ncelet
     xcpp(iel) = 1.d0
   enddo
 elseif (imucpp.eq.1) then
@@ -403,18 +406,17 @@ elseif (imucpp.eq.1) then
     do iel = 1, ncel
       xcpp(iel) = cpro_cp(iel)
     enddo
+    ! Handle parallelism and periodicity
+    if (irangp.ge.0.or.iperio.eq.1) then
+      call synsca(xcpp)
+    endif
   else
-    do iel = 1, ncel
+    do iel = 1, ncelet
       xcpp(iel) = cp0
     enddo
   endif
 endif
 
-! Handle parallelism and periodicity
-if (irangp.ge.0.or.iperio.eq.1) then
-  call synsca(xcpp)
-endif
-
 ! Retrieve turbulent Schmidt value for current scalar
 call field_get_key_double(iflid, ksigmas, turb_schmidt)
 ! If turbulent Schmidt is variable, id of the corresponding field
@@ -155,6 +155,14 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Number of faces handled together by the block solver */
+
+#define CS_1D_WALL_THERMAL_BLOCK_SIZE 8
+
 /*============================================================================
  * Local structure definitions
  *============================================================================*/
@@ -197,6 +205,248 @@ cs_f_1d_wall_thermal_get_temp(cs_real_t **tppt1d);
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Solve the 1D equation for a block of faces with the same number
+ * of discretization points.
+ *
+ * Tridiagonal systems are stored with the values of all faces of the block
+ * for a given point stored contiguously (i.e. interleaved), so that
+ * operations of the Thomas algorithm are vectorized across faces.
+ *
+ * parameters:
+ *   n_l   <-- number of faces in block
+ *   ids   <-- ids of faces in 1D wall faces (size: n_l)
+ *   tf    <-- fluid temperature at the boundary for each face
+ *   hf    <-- exchange coefficient for the fluid for each face
+ *----------------------------------------------------------------------------*/
+
+static void
+_solve_block(cs_lnum_t        n_l,
+             const cs_lnum_t  ids[],
+             const cs_real_t  tf[],
+             const cs_real_t  hf[])
+{
+  const cs_lnum_t bs = CS_1D_WALL_THERMAL_BLOCK_SIZE;
+
+  cs_1d_wall_thermal_local_model_t *local_models
+    = _1d_wall_thermal.local_models;
+
+  const cs_lnum_t n = local_models[ids[0]].nppt1d;
+
+  const bool rad = (cs_glob_lagr_extra_module->radiative_model >= 1);
+
+  const cs_real_t *qinci = (rad) ? CS_F_(qinci)->val : NULL;
+  const cs_real_t *emissivity = (rad) ? CS_F_(emissivity)->val : NULL;
+
+  /* Per face coefficients */
+
+  cs_real_t xlmbt1[CS_1D_WALL_THERMAL_BLOCK_SIZE]; /* thermal diffusivity */
+  cs_real_t rcp_dt[CS_1D_WALL_THERMAL_BLOCK_SIZE]; /* rho.C_p / dt */
+  cs_real_t eppt1d[CS_1D_WALL_THERMAL_BLOCK_SIZE]; /* wall thickness */
+  cs_real_t f3[CS_1D_WALL_THERMAL_BLOCK_SIZE];     /* thermal flux on
+                                                      Tfluide */
+  cs_real_t h2[CS_1D_WALL_THERMAL_BLOCK_SIZE];     /* thermal exchange
+                                                      coefficient on T(1) */
+  cs_real_t h5[CS_1D_WALL_THERMAL_BLOCK_SIZE];     /* thermal exchange
+                                                      coefficient on T(n) */
+  cs_real_t f6[CS_1D_WALL_THERMAL_BLOCK_SIZE];     /* thermal flux on Text */
+  cs_real_t eps[CS_1D_WALL_THERMAL_BLOCK_SIZE];    /* emissivity */
+  cs_real_t m[CS_1D_WALL_THERMAL_BLOCK_SIZE];
+
+  /* Interleaved tri-diagonal matrices, coordinates and temperatures */
+
+  cs_real_t _w[6*32*CS_1D_WALL_THERMAL_BLOCK_SIZE];
+  cs_real_t *w = _w;
+
+  if (n > 32)
+    BFT_MALLOC(w, 6*n*bs, cs_real_t);
+
+  cs_real_t *restrict al = w;
+  cs_real_t *restrict bl = al + n*bs;
+  cs_real_t *restrict cl = bl + n*bs;
+  cs_real_t *restrict dl = cl + n*bs;
+  cs_real_t *restrict zz = dl + n*bs;
+  cs_real_t *restrict tt = zz + n*bs;
+
+  for (cs_lnum_t l = 0; l < n_l; l++) {
+
+    const cs_1d_wall_thermal_local_model_t *lm = local_models + ids[l];
+
+    for (cs_lnum_t kk = 0; kk < n; kk++) {
+      zz[kk*bs + l] = lm->z[kk];
+      tt[kk*bs + l] = lm->t[kk];
+    }
+
+    cs_real_t qinc = 0.;
+    eps[l] = 0.;
+
+    if (rad) {
+      /* coupling with radiative module, qinc and qeps != 0 */
+      cs_lnum_t ifac = _1d_wall_thermal.ifpt1d[ids[l]] - 1;
+      qinc = qinci[ifac];
+      eps[l] = emissivity[ifac];
+    }
+
+    xlmbt1[l] = lm->xlmbt1;
+    rcp_dt[l] = lm->rcpt1d/lm->dtpt1d;
+    eppt1d[l] = lm->eppt1d;
+
+    /* Boundary conditions on the fluid side: flux conservation */
+    /*   flux in the fluid = flux in the solid = f3 + h2*T1 */
+    cs_real_t a1 = 1./hf[l] + zz[l]/xlmbt1[l];
+    h2[l] = -1./a1; // TAKE CARE TO THE MINUS !
+    f3[l] = -h2[l]*tf[l] + qinc;
+
+    /* Boundary conditions on the exterior */
+    /*   flux in the fluid = flux in the solid = f6 + h5*T(n-1) */
+
+    h5[l] = 0.;
+    f6[l] = 0.;
+
+    /* Dirichlet condition */
+    if (lm->iclt1d == 1) {
+      cs_real_t a4 = 1./lm->hept1d + (eppt1d[l] - zz[(n-1)*bs + l])/xlmbt1[l];
+      h5[l] = -1./a4;
+      f6[l] = -h5[l]*lm->tept1d;
+    }
+    /* Forced flux condition */
+    else if (lm->iclt1d == 3) {
+      h5[l] = 0.;
+      f6[l] = lm->fept1d;
+    }
+
+  }
+
+  /* Build the tri-diagonal matrix */
+
+  /* Mesh interior points */
+  for (cs_lnum_t kk = 1; kk <= n-1; kk++) {
+    cs_real_t *_al = al + kk*bs;
+    const cs_real_t *_z1 = zz + kk*bs, *_z0 = _z1 - bs;
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd
+#   endif
+    for (cs_lnum_t l = 0; l < n_l; l++)
+      _al[l] = -xlmbt1[l]/(_z1[l]-_z0[l]);
+  }
+
+  for (cs_lnum_t l = 0; l < n_l; l++)
+    m[l] = 2*zz[l];
+  for (cs_lnum_t kk = 1; kk <= n-2; kk++) {
+    cs_real_t *_bl = bl + kk*bs;
+    const cs_real_t *_z1 = zz + kk*bs, *_z0 = _z1 - bs, *_z2 = _z1 + bs;
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd
+#   endif
+    for (cs_lnum_t l = 0; l < n_l; l++) {
+      m[l] = 2*(_z1[l]-_z0[l])-m[l];
+      _bl[l] =   rcp_dt[l]*m[l] + xlmbt1[l]/(_z2[l]-_z1[l])
+               + xlmbt1[l]/(_z1[l]-_z0[l]);
+    }
+  }
+
+  for (cs_lnum_t kk = 0; kk <= n-2; kk++) {
+    cs_real_t *_cl = cl + kk*bs;
+    const cs_real_t *_z0 = zz + kk*bs, *_z1 = _z0 + bs;
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd
+#   endif
+    for (cs_lnum_t l = 0; l < n_l; l++)
+      _cl[l] = -xlmbt1[l]/(_z1[l]-_z0[l]);
+  }
+
+  for (cs_lnum_t l = 0; l < n_l; l++) {
+    m[l] = 2*zz[l];
+    dl[l] = rcp_dt[l]*m[l]*tt[l];
+  }
+
+  for (cs_lnum_t kk = 1; kk <= n-1; kk++) {
+    cs_real_t *_dl = dl + kk*bs;
+    const cs_real_t *_t = tt + kk*bs;
+    const cs_real_t *_z1 = zz + kk*bs, *_z0 = _z1 - bs;
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd
+#   endif
+    for (cs_lnum_t l = 0; l < n_l; l++) {
+      m[l] = 2*(_z1[l]-_z0[l])-m[l];
+      _dl[l] = rcp_dt[l]*m[l]*_t[l];
+    }
+  }
+
+  /* Boundary points */
+  /* bl[0] and bl[n-1] are initialized here and set later,
+     in the case where 0 = n-1 */
+  {
+    cs_real_t *_bl = bl + (n-1)*bs;
+    cs_real_t *_cl = cl + (n-1)*bs;
+    cs_real_t *_dl = dl + (n-1)*bs;
+    const cs_real_t *_zn = zz + (n-1)*bs;
+
+    for (cs_lnum_t l = 0; l < n_l; l++) {
+      bl[l] = 0.;
+      _bl[l] = 0.;
+      al[l] = 0.;
+      bl[l] +=   rcp_dt[l]*2*zz[l] + xlmbt1[l]/(zz[bs + l]-zz[l]) - h2[l]
+               + eps[l]*cs_physical_constants_stephan*pow(tt[l], 3.);
+      dl[l] += f3[l];
+      _bl[l] +=   rcp_dt[l]*2*(eppt1d[l]-_zn[l])
+                + xlmbt1[l]/(_zn[l]-_zn[l - bs]) - h5[l];
+      _cl[l] = 0.;
+      _dl[l] += f6[l];
+    }
+  }
+
+  /* System resolution by a Cholesky method ("dual-scan") */
+  for (cs_lnum_t kk = 1; kk <= n-1; kk++) {
+    cs_real_t *_bl = bl + kk*bs, *_dl = dl + kk*bs;
+    const cs_real_t *_al = al + kk*bs, *_cl = cl + (kk-1)*bs;
+    const cs_real_t *_bl0 = _bl - bs, *_dl0 = _dl - bs;
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd
+#   endif
+    for (cs_lnum_t l = 0; l < n_l; l++) {
+      _bl[l] -= _al[l]*_cl[l]/_bl0[l];
+      _dl[l] -= _al[l]*_dl0[l]/_bl0[l];
+    }
+  }
+
+  {
+    cs_real_t *_t = tt + (n-1)*bs;
+    const cs_real_t *_bl = bl + (n-1)*bs, *_dl = dl + (n-1)*bs;
+    for (cs_lnum_t l = 0; l < n_l; l++)
+      _t[l] = _dl[l]/_bl[l];
+  }
+
+  for (cs_lnum_t kk = n-2; kk >= 0; kk--) {
+    cs_real_t *_t = tt + kk*bs;
+    const cs_real_t *_t1 = _t + bs;
+    const cs_real_t *_bl = bl + kk*bs, *_cl = cl + kk*bs, *_dl = dl + kk*bs;
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd
+#   endif
+    for (cs_lnum_t l = 0; l < n_l; l++)
+      _t[l] = (_dl[l] - _cl[l]*_t1[l])/_bl[l];
+  }
+
+  /* Update temperatures and compute the new value of tp */
+
+  for (cs_lnum_t l = 0; l < n_l; l++) {
+
+    cs_1d_wall_thermal_local_model_t *lm = local_models + ids[l];
+
+    for (cs_lnum_t kk = 0; kk < n; kk++)
+      lm->t[kk] = tt[kk*bs + l];
+
+    cs_real_t tp = hf[l] + xlmbt1[l]/zz[l];
+    _1d_wall_thermal.tppt1d[ids[l]]
+      = 1./tp*(xlmbt1[l]*tt[l]/zz[l] + hf[l]*tf[l]);
+
+  }
+
+  if (w != _w)
+    BFT_FREE(w);
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -428,158 +678,90 @@ cs_1d_wall_thermal_solve(cs_lnum_t ii,
                          cs_real_t tf,
                          cs_real_t hf)
 {
-  cs_lnum_t kk;
-  cs_real_t qinc, eps;
-  cs_lnum_t ifac = _1d_wall_thermal.ifpt1d[ii] - 1;
-
-  if (cs_glob_lagr_extra_module->radiative_model >= 1) {
-    /* coupling with radiative module, qinc and qeps != 0 */
-    /* incident radiative flux at the boundary at the boundary */
-    qinc = CS_F_(qinci)->val[ifac];
-
-    /* emissivity */
-    eps = CS_F_(emissivity)->val[ifac];
-  } else {
-    /* without coupling with radiative module */
-    qinc = 0.;
-    eps = 0.;
-  }
-
-  /* thermal diffusivity */
-  cs_real_t xlmbt1 = _1d_wall_thermal.local_models[ii].xlmbt1;
-
-  /* volumetric heat capacity of the wall */
-  cs_real_t rcp = _1d_wall_thermal.local_models[ii].rcpt1d;
-
-  /* exchange coefficient on the exterior wall */
-  cs_real_t hept1d = _1d_wall_thermal.local_models[ii].hept1d;
-
-  /* flux on the exterior wall */
-  cs_real_t fept1d = _1d_wall_thermal.local_models[ii].fept1d;
-
-  /* thickness of the 1D wall */
-  cs_real_t eppt1d = _1d_wall_thermal.local_models[ii].eppt1d;
-
-  /* temperature on the exterior boundary */
-  cs_real_t tept1d = _1d_wall_thermal.local_models[ii].tept1d;
-
-  /* time-step for the solid resolution */
-  cs_real_t dtpt1d = _1d_wall_thermal.local_models[ii].dtpt1d;
-
-  /* type of exterior boundary condition */
-  int iclt1d = _1d_wall_thermal.local_models[ii].iclt1d;
-
-  cs_real_t a1; /* extrapolation coefficient for temperature1 */
-  cs_real_t h2; /* thermal exchange coefficient on T(1) */
-  cs_real_t f3; /* thermal flux on Tfluide */
-  cs_real_t a4; /* extrapolation coefficient for temperature4 */
-
-  cs_real_t h5 = 0.; /* thermal exchange coefficient on T(n) */
-  cs_real_t f6 = 0.; /* thermal flux on Text */
-
-  cs_real_t m;
-
-  cs_real_t _al[128];
-  cs_real_t *al, *bl, *cl, *dl;
-  cs_real_t *zz;
-  cs_lnum_t n;
-
-  n = _1d_wall_thermal.local_models[ii].nppt1d;
-
-  if (n > 32)
-    BFT_MALLOC(al, 4*n, cs_real_t);
-  else
-    al = _al;
-
-  bl = al+n;
-  cl = bl+n;
-  dl = cl+n;
-
-  zz = _1d_wall_thermal.local_models[ii].z;
+  _solve_block(1, &ii, &tf, &hf);
+}
 
-  /* Build the tri-diagonal matrix */
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve the 1D equation for a set of faces.
+ *
+ * Successive faces with the same number of discretization points are
+ * solved together by blocks, with operations vectorized across faces.
+ *
+ * \param[in]   n_faces   number of faces to solve
+ * \param[in]   face_ids  ids of faces in 1D wall faces (0 to nfpt1d-1),
+ *                        or NULL for all 1D wall faces
+ * \param[in]   tf        fluid temperature at the boundary
+ *                        (size: n_b_faces)
+ * \param[in]   hf        exchange coefficient for the fluid
+ *                        (size: n_b_faces)
+ */
+/*----------------------------------------------------------------------------*/
 
-  /* Boundary conditions on the fluid side: flux conservation */
-  /*   flux in the fluid = flux in the solid = f3 + h2*T1 */
-  a1 = 1./hf + zz[0]/xlmbt1;
-  h2 = -1./a1; // TAKE CARE TO THE MINUS !
-  f3 = -h2*tf + qinc;
+void
+cs_1d_wall_thermal_solve_faces(cs_lnum_t        n_faces,
+                               const cs_lnum_t  face_ids[],
+                               const cs_real_t  tf[],
+                               const cs_real_t  hf[])
+{
+  const cs_1d_wall_thermal_local_model_t *local_models
+    = _1d_wall_thermal.local_models;
+  const cs_lnum_t *ifpt1d = _1d_wall_thermal.ifpt1d;
 
-  /* Boundary conditions on the exterior */
-  /*   flux in the fluid = flux in the solid = f6 + h5*T(n-1) */
+  cs_lnum_t *_face_ids = NULL;
 
-  /* Dirichlet condition */
-  if (iclt1d == 1) {
-    a4 = 1./hept1d + (eppt1d - zz[n-1])/xlmbt1;
-    h5 = -1./a4;
-    f6 = -h5*tept1d;
-  }
-  /* Forced flux condition */
-  else if (iclt1d == 3) {
-    h5 = 0.;
-    f6 = fept1d;
+  if (face_ids == NULL) {
+    BFT_MALLOC(_face_ids, n_faces, cs_lnum_t);
+    for (cs_lnum_t i = 0; i < n_faces; i++)
+      _face_ids[i] = i;
+    face_ids = _face_ids;
   }
 
-  /* Mesh interior points */
-  for (kk = 1 ; kk <= n-1; kk++) {
-    al[kk] = -xlmbt1/(zz[kk]-zz[kk-1]);
+  /* Build index of blocks of faces with the same number of points */
+
+  cs_lnum_t n_blocks = 0;
+  cs_lnum_t *block_idx = NULL;
+  BFT_MALLOC(block_idx, n_faces + 1, cs_lnum_t);
+
+  block_idx[0] = 0;
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    cs_lnum_t s_id = block_idx[n_blocks];
+    if (   i > s_id
+        && (   i - s_id >= CS_1D_WALL_THERMAL_BLOCK_SIZE
+            || (   local_models[face_ids[i]].nppt1d
+                != local_models[face_ids[s_id]].nppt1d))) {
+      n_blocks++;
+      block_idx[n_blocks] = i;
+    }
   }
-
-  m = 2*zz[0];
-  for (kk = 1 ; kk <= n-2 ; kk++) {
-    m = 2*(zz[kk]-zz[kk-1])-m;
-    bl[kk] = rcp/dtpt1d*m + xlmbt1/(zz[kk+1]-zz[kk]) + xlmbt1/(zz[kk]-zz[kk-1]);
+  if (n_faces > 0) {
+    n_blocks++;
+    block_idx[n_blocks] = n_faces;
   }
 
-  for (kk = 0; kk <= n-2; kk++) {
-    cl[kk] =  -xlmbt1/(zz[kk+1]-zz[kk]);
-  }
+  /* Loop on blocks of faces */
 
-  m = 2*zz[0];
-  dl[0] = rcp/dtpt1d*m*(_1d_wall_thermal.local_models[ii].t)[0];
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
 
-  for (kk = 1; kk <= n-1; kk++) {
-    m = 2*(zz[kk]-zz[kk-1])-m;
-    dl[kk] = rcp/dtpt1d*m*(_1d_wall_thermal.local_models[ii].t)[kk];
-  }
+    const cs_lnum_t s_id = block_idx[b_id];
+    const cs_lnum_t n_l = block_idx[b_id + 1] - s_id;
 
-  /* Boundary points */
-  /* bl[0] and bl[n-1] are initialized here and set later,
-     in the case where 0 = n-1 */
-  bl[0] = 0.;
-  bl[n-1] = 0.;
-  al[0] = 0.;
-  bl[0] += rcp/dtpt1d*2*zz[0] + xlmbt1/(zz[1]-zz[0]) - h2
-         + eps*cs_physical_constants_stephan
-         * pow(_1d_wall_thermal.local_models[ii].t[0],3.);
-  dl[0] += f3;
-  bl[n-1] += rcp/dtpt1d*2*(_1d_wall_thermal.local_models[ii].eppt1d-zz[n-1])
-           + xlmbt1/(zz[n-1]-zz[n-2]) - h5;
-  cl[n-1] = 0.;
-  dl[n-1] += f6;
+    cs_real_t tf_l[CS_1D_WALL_THERMAL_BLOCK_SIZE];
+    cs_real_t hf_l[CS_1D_WALL_THERMAL_BLOCK_SIZE];
 
-  /* System resolution by a Cholesky method ("dual-scan") */
-  for (kk = 1 ; kk <= n-1 ; kk++) {
-    bl[kk] -= al[kk]*cl[kk-1]/bl[kk-1];
-    dl[kk] -= al[kk]*dl[kk-1]/bl[kk-1];
-  }
+    for (cs_lnum_t l = 0; l < n_l; l++) {
+      cs_lnum_t ifac = ifpt1d[face_ids[s_id + l]] - 1;
+      tf_l[l] = tf[ifac];
+      hf_l[l] = hf[ifac];
+    }
 
-  _1d_wall_thermal.local_models[ii].t[n-1] = dl[n-1]/bl[n-1];
+    _solve_block(n_l, face_ids + s_id, tf_l, hf_l);
 
-  for (kk=n-2; kk>=0; kk--) {
-    _1d_wall_thermal.local_models[ii].t[kk] =
-       (dl[kk] - cl[kk]*_1d_wall_thermal.local_models[ii].t[kk+1])/bl[kk];
   }
 
-  /* Compute the new value of tp */
-  _1d_wall_thermal.tppt1d[ii] = hf + xlmbt1/zz[0];
-  _1d_wall_thermal.tppt1d[ii]
-    = 1./_1d_wall_thermal.tppt1d[ii]
-         *(xlmbt1*_1d_wall_thermal.local_models[ii].t[0]/zz[0]
-           + hf*tf);
-
-  if (al != _al)
-    BFT_FREE(al);
+  BFT_FREE(block_idx);
+  BFT_FREE(_face_ids);
 }
 
 /*----------------------------------------------------------------------------*/
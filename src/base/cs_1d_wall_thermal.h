@@ -190,6 +190,29 @@ cs_1d_wall_thermal_solve(cs_lnum_t ii,
                          cs_real_t tf,
                          cs_real_t hf);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve the 1D equation for a set of faces.
+ *
+ * Successive faces with the same number of discretization points are
+ * solved together by blocks, with operations vectorized across faces.
+ *
+ * \param[in]   n_faces   number of faces to solve
+ * \param[in]   face_ids  ids of faces in 1D wall faces (0 to nfpt1d-1),
+ *                        or NULL for all 1D wall faces
+ * \param[in]   tf        fluid temperature at the boundary
+ *                        (size: n_b_faces)
+ * \param[in]   hf        exchange coefficient for the fluid
+ *                        (size: n_b_faces)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_1d_wall_thermal_solve_faces(cs_lnum_t        n_faces,
+                               const cs_lnum_t  face_ids[],
+                               const cs_real_t  tf[],
+                               const cs_real_t  hf[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read the restart file of the 1D-wall thermal module.
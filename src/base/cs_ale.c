@@ -1411,15 +1411,36 @@ cs_ale_update_mesh(const int           itrale)
   cs_real_3_t *disala = (cs_real_3_t *)(f_displ->val_pre);
   cs_real_3_t *xyzno0 = (cs_real_3_t *)(cs_field_by_name("vtx_coord0")->val);
 
-  /* Update geometry */
+  /* Update geometry, counting displaced vertices */
+  cs_gnum_t n_moved = 0;
+
+# pragma omp parallel for reduction(+:n_moved) if (n_vertices > CS_THR_MIN)
   for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
+    bool moved = false;
     for (cs_lnum_t idim = 0; idim < ndim; idim++) {
-      vtx_coord[v_id][idim] = xyzno0[v_id][idim] + disale[v_id][idim];
+      cs_real_t x = xyzno0[v_id][idim] + disale[v_id][idim];
+      if (fabs(x - vtx_coord[v_id][idim]) > 0.) {
+        vtx_coord[v_id][idim] = x;
+        moved = true;
+      }
       disala[v_id][idim] = vtx_coord[v_id][idim] - xyzno0[v_id][idim];
     }
+    if (moved)
+      n_moved++;
   }
 
-  cs_ale_update_mesh_quantities(&(mq->min_vol), &(mq->max_vol), &(mq->tot_vol));
+  cs_parall_counter(&n_moved, 1);
+
+  /* Geometric quantities (and dependent gradient and cell to vertex
+     caches) only need to be updated if some vertex actually moved */
+  if (n_moved > 0)
+    cs_ale_update_mesh_quantities(&(mq->min_vol),
+                                  &(mq->max_vol),
+                                  &(mq->tot_vol));
+
+  if (var_cal_opt.verbosity >= 1)
+    bft_printf("  Number of displaced vertices: %llu\n\n",
+               (unsigned long long)n_moved);
 
   /* Abort at the end of the current time-step if there is a negative volume */
   if (mq->min_vol <= 0.)
@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -85,6 +86,20 @@ BEGIN_C_DECLS
   \var CS_ALL_TO_ALL_CRYSTAL_ROUTER
        Use crystal router algorithm
 
+  \var CS_ALL_TO_ALL_NEIGHBOR_COLLECTIVE
+       Use hybrid metadata exchange, with data exchanged using
+       MPI_Neighbor_alltoallv on a distributed graph communicator
+       (requires MPI 3; otherwise behaves as CS_ALL_TO_ALL_HYBRID)
+
+  \var CS_ALL_TO_ALL_AUTO
+       Select one of CS_ALL_TO_ALL_MPI_DEFAULT, CS_ALL_TO_ALL_HYBRID, or
+       CS_ALL_TO_ALL_CRYSTAL_ROUTER for each distributor, based on the
+       number of destination ranks and elements per destination rank.
+       The threshold under which exchanges are considered sparse is
+       calibrated once, on the first distributor created on the main
+       communicator, by timing MPI_Alltoall relative to point-to-point
+       latency.
+
   \paragraph all_to_all_flags Using flags
   \parblock
 
@@ -110,6 +125,17 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Automatic algorithm selection parameters: minimum communicator size
+   for sparse algorithms, default ratio of destination ranks to
+   communicator size under which exchanges are considered sparse (before
+   calibration), and mean number of elements per destination rank
+   under which the (latency-bound) Crystal Router is preferred to
+   the hybrid algorithm. */
+
+#define _AUTO_MIN_RANKS            16
+#define _AUTO_SPARSE_RATIO_DEFAULT 0.25
+#define _AUTO_CR_MAX_ELTS          64
+
 /*=============================================================================
  * Local type definitions
  *============================================================================*/
@@ -195,6 +221,15 @@ typedef struct {
   MPI_Comm        comm;              /* Associated MPI communicator */
   MPI_Datatype    comp_type;         /* Associated MPI datatype */
 
+  bool            use_ngb_coll;      /* Use neighborhood collectives for
+                                        data exchange */
+  MPI_Comm        ngb_comm;          /* Distributed graph communicator
+                                        matching rn_send and rn_recv,
+                                        or MPI_COMM_NULL */
+  MPI_Comm        ngb_comm_r;        /* Distributed graph communicator
+                                        for reverse direction, or
+                                        MPI_COMM_NULL */
+
 } _hybrid_pex_t;
 
 #endif /* defined(HAVE_MPI) */
@@ -271,6 +306,14 @@ static cs_rank_neighbors_exchange_t _hybrid_meta_type
 static size_t              _all_to_all_calls[3] = {0, 0, 0};
 static cs_timer_counter_t  _all_to_all_timers[3];
 
+/* Automatic selection: calibrated sparse ratio (< 0 if not calibrated),
+   calibration times (MPI_Alltoall, point-to-point), and number of
+   distributors using each algorithm */
+
+static double  _auto_sparse_ratio = -1.;
+static double  _auto_calib_t[2] = {0, 0};
+static size_t  _auto_calls[3] = {0, 0, 0};
+
 /* Instrumentation */
 
 static int        _n_trace = 0;
@@ -365,9 +408,150 @@ _all_to_all_create_base(size_t    n_elts,
 
   d->type = _all_to_all_type;
 
+  /* Neighborhood collectives are handled as a variant of the hybrid
+     algorithm, using the same metadata */
+
+  if (d->type == CS_ALL_TO_ALL_NEIGHBOR_COLLECTIVE)
+    d->type = CS_ALL_TO_ALL_HYBRID;
+
   return d;
 }
 
+/*----------------------------------------------------------------------------
+ * Calibrate the automatic all-to-all algorithm selection.
+ *
+ * The sparse metadata exchange costs about 2.log2(p) point-to-point
+ * latencies, plus one per destination rank, compared to one MPI_Alltoall,
+ * so the threshold number of destination ranks is deduced from the
+ * ratio of those timings.
+ *
+ * This is a collective operation on communicator comm.
+ *
+ * arguments:
+ *   comm <-- associated MPI communicator
+ *----------------------------------------------------------------------------*/
+
+static void
+_auto_calibrate(MPI_Comm  comm)
+{
+  const int n_reps = 5;
+
+  int n_ranks, rank_id;
+  MPI_Comm_size(comm, &n_ranks);
+  MPI_Comm_rank(comm, &rank_id);
+
+  int *send_buf, *recv_buf;
+  BFT_MALLOC(send_buf, n_ranks*2, int);
+  recv_buf = send_buf + n_ranks;
+
+  for (int i = 0; i < n_ranks; i++)
+    send_buf[i] = i;
+
+  int dest = (rank_id + 1) % n_ranks;
+  int src = (rank_id + n_ranks - 1) % n_ranks;
+
+  MPI_Barrier(comm);
+
+  double t0 = MPI_Wtime();
+
+  for (int i = 0; i < n_reps; i++)
+    MPI_Alltoall(send_buf, 1, MPI_INT, recv_buf, 1, MPI_INT, comm);
+
+  double t1 = MPI_Wtime();
+
+  for (int i = 0; i < n_reps; i++)
+    MPI_Sendrecv(send_buf, 1, MPI_INT, dest, 0,
+                 recv_buf, 1, MPI_INT, src, 0,
+                 comm, MPI_STATUS_IGNORE);
+
+  double t2 = MPI_Wtime();
+
+  BFT_FREE(send_buf);
+
+  double t_l[2] = {(t1-t0)/n_reps, (t2-t1)/n_reps};
+  MPI_Allreduce(t_l, _auto_calib_t, 2, MPI_DOUBLE, MPI_MAX, comm);
+
+  double ratio = 0.;
+  if (_auto_calib_t[1] > 0) {
+    double log2_p = log((double)n_ranks) / log(2.);
+    double n_dest_max =   (_auto_calib_t[0] - 2.*log2_p*_auto_calib_t[1])
+                        / _auto_calib_t[1];
+    ratio = n_dest_max / n_ranks;
+  }
+
+  if (ratio < 0.)
+    ratio = 0.;
+  else if (ratio > 1.)
+    ratio = 1.;
+
+  _auto_sparse_ratio = ratio;
+}
+
+/*----------------------------------------------------------------------------
+ * Select the algorithm used by a distributor in automatic mode.
+ *
+ * The choice is based on the maximum number of destination ranks and
+ * of source elements over all ranks, so it is the same on all ranks.
+ *
+ * This is a collective operation on the distributor's communicator.
+ *
+ * arguments:
+ *   d <-> pointer to all-to-all distributor
+ *----------------------------------------------------------------------------*/
+
+static void
+_auto_select_type(cs_all_to_all_t  *d)
+{
+  d->type = CS_ALL_TO_ALL_MPI_DEFAULT;
+
+  if (d->n_ranks >= _AUTO_MIN_RANKS) {
+
+    if (_auto_sparse_ratio < 0 && d->comm == cs_glob_mpi_comm)
+      _auto_calibrate(d->comm);
+
+    /* Count local destination ranks */
+
+    const cs_lnum_t n_elts = d->n_elts_src;
+    const int *dest_rank = d->dest_rank;
+
+    unsigned char *rank_flag;
+    BFT_MALLOC(rank_flag, d->n_ranks, unsigned char);
+    memset(rank_flag, 0, d->n_ranks);
+
+    int n_dest = 0;
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      if (rank_flag[dest_rank[i]] == 0) {
+        rank_flag[dest_rank[i]] = 1;
+        n_dest++;
+      }
+    }
+
+    BFT_FREE(rank_flag);
+
+    /* Ranks which have not calibrated use the default ratio;
+       the reduction ensures all ranks make the same choice */
+
+    double l_vals[3] = {n_dest, n_elts, _auto_sparse_ratio};
+    if (l_vals[2] < 0)
+      l_vals[2] = _AUTO_SPARSE_RATIO_DEFAULT;
+
+    double g_vals[3];
+    MPI_Allreduce(l_vals, g_vals, 3, MPI_DOUBLE, MPI_MAX, d->comm);
+
+    double n_dest_max = (g_vals[0] > 1) ? g_vals[0] : 1;
+
+    if (g_vals[0] <= g_vals[2]*d->n_ranks) {
+      if (g_vals[1] < _AUTO_CR_MAX_ELTS*n_dest_max)
+        d->type = CS_ALL_TO_ALL_CRYSTAL_ROUTER;
+      else
+        d->type = CS_ALL_TO_ALL_HYBRID;
+    }
+
+  }
+
+  _auto_calls[d->type] += 1;
+}
+
 /*----------------------------------------------------------------------------
  * Compute rank displacement based on count.
  *
@@ -922,6 +1106,7 @@ _alltoall_caller_exchange_meta(_mpi_all_to_all_caller_t  *dc,
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_METADATA,
                             &t0, &t1);
+  cs_timer_trace_event("all_to_all metadata", &t0, &t1);
 
   if (_n_trace < _n_trace_max) {
     /* Time to 1-5 s */
@@ -1010,6 +1195,7 @@ _alltoall_caller_exchange_s(cs_all_to_all_t           *d,
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_EXCHANGE,
                             &t0, &t1);
+  cs_timer_trace_event("all_to_all exchange", &t0, &t1);
   _all_to_all_calls[CS_ALL_TO_ALL_TIME_EXCHANGE] += 1;
 
   if (_n_trace < _n_trace_max) {
@@ -1169,6 +1355,7 @@ _alltoall_caller_exchange_i(cs_all_to_all_t           *d,
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_EXCHANGE,
                             &t0, &t1);
+  cs_timer_trace_event("all_to_all exchange", &t0, &t1);
   _all_to_all_calls[CS_ALL_TO_ALL_TIME_EXCHANGE] += 1;
 
   if (_n_trace < _n_trace_max) {
@@ -1279,6 +1466,15 @@ _hybrid_pex_create_meta(int        flags,
   hc->recv_displ = NULL;
   hc->recv_count_save = NULL;
 
+#if (MPI_VERSION >= 3)
+  hc->use_ngb_coll
+    = (_all_to_all_type == CS_ALL_TO_ALL_NEIGHBOR_COLLECTIVE) ? true : false;
+#else
+  hc->use_ngb_coll = false;
+#endif
+  hc->ngb_comm = MPI_COMM_NULL;
+  hc->ngb_comm_r = MPI_COMM_NULL;
+
   /* Compute data size and alignment */
 
   if (hc->dest_id_datatype == CS_LNUM_TYPE)
@@ -1314,6 +1510,10 @@ _hybrid_pex_destroy(_hybrid_pex_t **hc)
     _hybrid_pex_t *_hc = *hc;
     if (_hc->comp_type != MPI_BYTE)
       MPI_Type_free(&(_hc->comp_type));
+    if (_hc->ngb_comm != MPI_COMM_NULL)
+      MPI_Comm_free(&(_hc->ngb_comm));
+    if (_hc->ngb_comm_r != MPI_COMM_NULL)
+      MPI_Comm_free(&(_hc->ngb_comm_r));
     BFT_FREE(_hc->elt_rank_index);
     BFT_FREE(_hc->_send_buffer);
     BFT_FREE(_hc->recv_count_save);
@@ -1462,6 +1662,10 @@ _hybrid_pex_swap_src_dest(_hybrid_pex_t  *hc)
 
   hc->send_count = tmp_count;
   hc->send_displ = tmp_displ;
+
+  MPI_Comm tmp_comm = hc->ngb_comm;
+  hc->ngb_comm = hc->ngb_comm_r;
+  hc->ngb_comm_r = tmp_comm;
 }
 
 /*----------------------------------------------------------------------------
@@ -1793,6 +1997,11 @@ _hybrid_pex_exchange_meta(_hybrid_pex_t  *hc,
     BFT_FREE(hc->recv_displ);
   }
 
+  if (hc->ngb_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(hc->ngb_comm));
+  if (hc->ngb_comm_r != MPI_COMM_NULL)
+    MPI_Comm_free(&(hc->ngb_comm_r));
+
   cs_rank_neighbors_sync_count_m(hc->rn_send,
                                  &(hc->rn_recv),
                                  hc->send_count,
@@ -1803,6 +2012,7 @@ _hybrid_pex_exchange_meta(_hybrid_pex_t  *hc,
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_METADATA,
                             &t0, &t1);
+  cs_timer_trace_event("all_to_all metadata", &t0, &t1);
 
   if (_n_trace < _n_trace_max) {
     /* Time to 1-5 s */
@@ -1843,7 +2053,48 @@ _hybrid_alltoallv(_hybrid_pex_t   *hc,
                   const void      *sendbuf,
                   void            *recvbuf)
 {
-  /* Currently available: MPI_Alltoallv */
+  /* Currently available: MPI_Neighbor_alltoallv and MPI_Alltoallv */
+
+#if (MPI_VERSION >= 3)
+
+  if (hc->use_ngb_coll) {
+
+    const int n_s_ranks = hc->rn_send->size;
+    const int n_r_ranks = hc->rn_recv->size;
+
+    int  *send_count, *recv_count;
+
+    BFT_MALLOC(send_count, n_s_ranks, int);
+    BFT_MALLOC(recv_count, n_r_ranks, int);
+
+    for (int i = 0; i < n_s_ranks; i++)
+      send_count[i] = hc->send_displ[i+1] - hc->send_displ[i];
+    for (int i = 0; i < n_r_ranks; i++)
+      recv_count[i] = hc->recv_displ[i+1] - hc->recv_displ[i];
+
+    /* Build graph communicator on first use, with exchange sizes
+       as edge weights */
+
+    if (hc->ngb_comm == MPI_COMM_NULL)
+      hc->ngb_comm = cs_rank_neighbors_create_graph_comm(hc->rn_send,
+                                                         hc->rn_recv,
+                                                         send_count,
+                                                         recv_count,
+                                                         hc->comm);
+
+    MPI_Neighbor_alltoallv(sendbuf, send_count, hc->send_displ,
+                           hc->comp_type,
+                           recvbuf, recv_count, hc->recv_displ,
+                           hc->comp_type,
+                           hc->ngb_comm);
+
+    BFT_FREE(recv_count);
+    BFT_FREE(send_count);
+
+    return;
+  }
+
+#endif /* (MPI_VERSION >= 3) */
 
   if (true) {
     int n_ranks;
@@ -1939,6 +2190,7 @@ _hybrid_pex_exchange_s(cs_all_to_all_t  *d,
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_EXCHANGE,
                             &t0, &t1);
+  cs_timer_trace_event("all_to_all exchange", &t0, &t1);
   _all_to_all_calls[CS_ALL_TO_ALL_TIME_EXCHANGE] += 1;
 
   if (_n_trace < _n_trace_max) {
@@ -2082,6 +2334,7 @@ _hybrid_pex_exchange_i(cs_all_to_all_t    *d,
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_EXCHANGE,
                             &t0, &t1);
+  cs_timer_trace_event("all_to_all exchange", &t0, &t1);
   _all_to_all_calls[CS_ALL_TO_ALL_TIME_EXCHANGE] += 1;
 
   if (_n_trace < _n_trace_max) {
@@ -2397,6 +2650,9 @@ cs_all_to_all_create(size_t            n_elts,
   d->dest_id = dest_id;
   d->dest_rank = dest_rank;
 
+  if (d->type == CS_ALL_TO_ALL_AUTO)
+    _auto_select_type(d);
+
   /* Create substructures based on info available at this stage
      (for Crystal Router, delay creation as data is not passed yet) */
 
@@ -2488,6 +2744,9 @@ cs_all_to_all_create_from_block(size_t                 n_elts,
     }
   }
 
+  if (d->type == CS_ALL_TO_ALL_AUTO)
+    _auto_select_type(d);
+
   /* Create substructures based on info available at this stage
      (for Crystal Router, delay creation as data is not passed yet) */
 
@@ -2658,6 +2917,11 @@ cs_all_to_all_n_elts_dest(cs_all_to_all_t  *d)
       }
       break;
 
+    case CS_ALL_TO_ALL_AUTO: /* resolved at creation */
+      assert(0);
+      break;
+
+    case CS_ALL_TO_ALL_NEIGHBOR_COLLECTIVE: /* hybrid variant */
     case CS_ALL_TO_ALL_HYBRID:
       {
         _hybrid_pex_exchange_meta(d->hc,
@@ -2862,6 +3126,11 @@ cs_all_to_all_copy_array(cs_all_to_all_t   *d,
     }
     break;
 
+  case CS_ALL_TO_ALL_AUTO: /* resolved at creation */
+    assert(0);
+    break;
+
+  case CS_ALL_TO_ALL_NEIGHBOR_COLLECTIVE: /* hybrid variant */
   case CS_ALL_TO_ALL_HYBRID:
     {
       if (d->n_elts_dest < 0) { /* Exchange metadata if not done yet */
@@ -3238,6 +3507,11 @@ cs_all_to_all_copy_indexed(cs_all_to_all_t  *d,
     }
     break;
 
+  case CS_ALL_TO_ALL_AUTO: /* resolved at creation */
+    assert(0);
+    break;
+
+  case CS_ALL_TO_ALL_NEIGHBOR_COLLECTIVE: /* hybrid variant */
   case CS_ALL_TO_ALL_HYBRID:
     {
       if (d->n_elts_dest < 0) { /* Exchange metadata if not done yet */
@@ -3469,6 +3743,11 @@ cs_all_to_all_get_src_rank(cs_all_to_all_t  *d)
     }
     break;
 
+  case CS_ALL_TO_ALL_AUTO: /* resolved at creation */
+    assert(0);
+    break;
+
+  case CS_ALL_TO_ALL_NEIGHBOR_COLLECTIVE: /* hybrid variant */
   case CS_ALL_TO_ALL_HYBRID:
     {
       const _hybrid_pex_t *hc = d->hc;
@@ -3585,6 +3864,14 @@ cs_all_to_all_log_finalize(void)
   case CS_ALL_TO_ALL_CRYSTAL_ROUTER:
     snprintf(method_name, 96, N_("Crystal Router algorithm"));
     break;
+  case CS_ALL_TO_ALL_NEIGHBOR_COLLECTIVE:
+    snprintf(method_name, 96, N_("Hybrid, %s (metadata), %s (data)"),
+             _(cs_rank_neighbors_exchange_name[_hybrid_meta_type]),
+             "MPI_Neighbor_alltoallv");
+    break;
+  case CS_ALL_TO_ALL_AUTO:
+    snprintf(method_name, 96, N_("Automatic selection"));
+    break;
   }
   method_name[95] = '\0';
 
@@ -3625,6 +3912,25 @@ cs_all_to_all_log_finalize(void)
      wtimes_mean[2], wtimes_min[2], wtimes_max[2],
      (unsigned long)(_all_to_all_calls[2]));
 
+  if (_all_to_all_type == CS_ALL_TO_ALL_AUTO) {
+    if (_auto_sparse_ratio >= 0)
+      cs_log_printf
+        (CS_LOG_PERFORMANCE,
+         _("  Calibration: MPI_Alltoall %10.3e s, point-to-point %10.3e s\n"
+           "               sparse if destination ranks < %5.3f x ranks\n\n"),
+         _auto_calib_t[0], _auto_calib_t[1], _auto_sparse_ratio);
+    cs_log_printf
+      (CS_LOG_PERFORMANCE,
+       _("  Selected algorithms (distributors, rank 0):\n"
+         "    MPI_Alltoall and MPI_Alltoallv:  %lu\n"
+         "    Hybrid, %s (metadata):  %lu\n"
+         "    Crystal Router algorithm:        %lu\n\n"),
+       (unsigned long)(_auto_calls[CS_ALL_TO_ALL_MPI_DEFAULT]),
+       _(cs_rank_neighbors_exchange_name[_hybrid_meta_type]),
+       (unsigned long)(_auto_calls[CS_ALL_TO_ALL_HYBRID]),
+       (unsigned long)(_auto_calls[CS_ALL_TO_ALL_CRYSTAL_ROUTER]));
+  }
+
   cs_log_separator(CS_LOG_PERFORMANCE);
 
   if (cs_glob_n_ranks > 1 && _n_trace > 0) {
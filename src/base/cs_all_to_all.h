@@ -67,7 +67,9 @@ typedef enum {
 
   CS_ALL_TO_ALL_MPI_DEFAULT,
   CS_ALL_TO_ALL_HYBRID,
-  CS_ALL_TO_ALL_CRYSTAL_ROUTER
+  CS_ALL_TO_ALL_CRYSTAL_ROUTER,
+  CS_ALL_TO_ALL_NEIGHBOR_COLLECTIVE,
+  CS_ALL_TO_ALL_AUTO
 
 } cs_all_to_all_type_t;
 
@@ -44,6 +44,8 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "cs_repro_sum.h"
+
 /*----------------------------------------------------------------------------
  * Header for the current file
  *----------------------------------------------------------------------------*/
@@ -139,7 +141,8 @@ _sbloc_sizes(cs_lnum_t   n,
 /*----------------------------------------------------------------------------
  * Compute sum of a 1-dimensional array.
  *
- * The algorithm here is similar to that used for blas.
+ * The algorithm here is similar to that used for blas; when reproducible
+ * sums are active, the sum is computed exactly.
  *
  * parameters:
  *   n        <-- local number of elements
@@ -153,6 +156,13 @@ static double
 _cs_real_sum_1d(cs_lnum_t        n,
                 const cs_real_t  v[])
 {
+  if (cs_repro_sum_is_active()) {
+    cs_repro_sum_t rs;
+    cs_repro_sum_init(&rs);
+    cs_repro_sum_add_array(&rs, n, v);
+    return cs_repro_sum_value(&rs);
+  }
+
   double v_sum = 0.;
 
 # pragma omp parallel reduction(+:v_sum) if (n > CS_THR_MIN)
@@ -246,7 +256,8 @@ _cs_real_minmax_1d(cs_lnum_t          n,
  * Compute simple local stats (minima, maxima, sum) of a 1-dimensional array.
  *
  * The algorithm here is similar to that used for blas, but computes several
- * quantities simultaneously for better cache behavior
+ * quantities simultaneously for better cache behavior; when reproducible
+ * sums are active, the sum is computed exactly.
  *
  * parameters:
  *   n        <-- local number of elements
@@ -319,6 +330,13 @@ _cs_real_sstats_1d(cs_lnum_t         n,
     }
 
   }
+
+  if (cs_repro_sum_is_active()) {
+    cs_repro_sum_t rs;
+    cs_repro_sum_init(&rs);
+    cs_repro_sum_add_array(&rs, n, v);
+    *vsum = cs_repro_sum_value(&rs);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -409,7 +427,8 @@ _cs_real_sstats_1d_iv(cs_lnum_t         n,
  * 1-dimensional array.
  *
  * The algorithm here is similar to that used for blas, but computes several
- * quantities simultaneously for better cache behavior
+ * quantities simultaneously for better cache behavior; when reproducible
+ * sums are active, sums are computed exactly.
  *
  * parameters:
  *   n        <-- local number of elements
@@ -492,6 +511,16 @@ _cs_real_sstats_1d_w(cs_lnum_t         n,
     }
 
   }
+
+  if (cs_repro_sum_is_active()) {
+    cs_repro_sum_t rs[2];
+    cs_repro_sum_init(rs);
+    cs_repro_sum_init(rs + 1);
+    cs_repro_sum_add_array(rs, n, v);
+    cs_repro_sum_add_dot(rs + 1, n, v, w);
+    *vsum = cs_repro_sum_value(rs);
+    *wsum = cs_repro_sum_value(rs + 1);
+  }
 }
 
 /*----------------------------------------------------------------------------
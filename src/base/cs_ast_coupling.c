@@ -113,6 +113,10 @@ struct _cs_ast_coupling_t {
 
   int  nbssit;     /* number of sub-iterations */
 
+  bool async;         /* if true, receive displacements of explicit
+                         schemes only when needed (at next time step) */
+  bool recv_pending;  /* displacements not received yet */
+
   double  dt;
   double  dtref;   /* reference time step */
   double  epsilo;  /* scheme convergence threshold */
@@ -201,6 +205,9 @@ _allocate_arrays(cs_ast_coupling_t  *ast_cpl)
 
 /*----------------------------------------------------------------------------
  * Receives displacements and velocities from code_aster at current time step
+ *
+ * In parallel, both arrays are received on rank 0 and distributed
+ * together through a single all-to-all exchange.
  *----------------------------------------------------------------------------*/
 
 static void
@@ -208,64 +215,83 @@ _recv_dyn(cs_ast_coupling_t  *ast_cpl)
 {
   int n_val_read = 0;
 
-  double *buffer = NULL;
+  const cs_gnum_t n_g_vertices = ast_cpl->n_g_vertices;
 
-  if (cs_glob_n_ranks <= 1)
-    buffer = ast_cpl->xast;
+  if (cs_glob_n_ranks <= 1) {
 
-  else if (cs_glob_rank_id <= 0)
-    BFT_MALLOC(buffer, 3*ast_cpl->n_g_vertices, double);
+    cs_calcium_read_double(ast_cpl->root_rank, &(ast_cpl->iteration),
+                           "DEPAST", 3*n_g_vertices,
+                           &n_val_read, ast_cpl->xast);
 
-  /* Read displacements */
+    assert((cs_gnum_t)n_val_read == 3*n_g_vertices);
 
-  if (cs_glob_rank_id <= 0) {
     cs_calcium_read_double(ast_cpl->root_rank, &(ast_cpl->iteration),
-                           "DEPAST", 3*ast_cpl->n_g_vertices,
-                           &n_val_read, buffer);
+                           "VITAST", 3*n_g_vertices,
+                           &n_val_read, ast_cpl->xvast);
 
-    assert((cs_gnum_t)n_val_read == 3*ast_cpl->n_g_vertices);
-  }
+    assert((cs_gnum_t)n_val_read == 3*n_g_vertices);
 
+    return;
+  }
 
 #if defined(HAVE_MPI)
 
-  if (cs_glob_n_ranks > 1)
-    cs_all_to_all_copy_array(ast_cpl->vtx_b2p,
-                             CS_DOUBLE,
-                             3,
-                             true, /* reverse */
-                             buffer,
-                             ast_cpl->xast);
+  const cs_lnum_t n_vertices = ast_cpl->n_vertices;
 
-#endif
+  double *g_dyn = NULL, *dyn = NULL;
 
-  /* Read velocities */
-
-  if (cs_glob_n_ranks <= 1)
-    buffer = ast_cpl->xvast;
+  /* Read displacements and velocities, interlaced as 6 values per vertex */
 
   if (cs_glob_rank_id <= 0) {
+
+    double *buffer = NULL;
+    BFT_MALLOC(buffer, 6*n_g_vertices, double);
+    BFT_MALLOC(g_dyn, 6*n_g_vertices, double);
+
     cs_calcium_read_double(ast_cpl->root_rank, &(ast_cpl->iteration),
-                           "VITAST", 3*ast_cpl->n_g_vertices,
+                           "DEPAST", 3*n_g_vertices,
                            &n_val_read, buffer);
 
-    assert((cs_gnum_t)n_val_read == 3*ast_cpl->n_g_vertices);
-  }
+    assert((cs_gnum_t)n_val_read == 3*n_g_vertices);
 
-#if defined(HAVE_MPI)
+    cs_calcium_read_double(ast_cpl->root_rank, &(ast_cpl->iteration),
+                           "VITAST", 3*n_g_vertices,
+                           &n_val_read, buffer + 3*n_g_vertices);
 
-  if (cs_glob_n_ranks > 1)
-    cs_all_to_all_copy_array(ast_cpl->vtx_b2p,
-                             CS_DOUBLE,
-                             3,
-                             true, /* reverse */
-                             buffer,
-                             ast_cpl->xvast);
+    assert((cs_gnum_t)n_val_read == 3*n_g_vertices);
 
-#endif
+    const double *v_buffer = buffer + 3*n_g_vertices;
+    for (cs_gnum_t i = 0; i < n_g_vertices; i++) {
+      for (cs_lnum_t j = 0; j < 3; j++) {
+        g_dyn[6*i + j]     = buffer[3*i + j];
+        g_dyn[6*i + 3 + j] = v_buffer[3*i + j];
+      }
+    }
 
-  if (cs_glob_n_ranks > 1)
     BFT_FREE(buffer);
+  }
+
+  BFT_MALLOC(dyn, 6*n_vertices, double);
+
+  cs_all_to_all_copy_array(ast_cpl->vtx_b2p,
+                           CS_DOUBLE,
+                           6,
+                           true, /* reverse */
+                           g_dyn,
+                           dyn);
+
+  BFT_FREE(g_dyn);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    for (cs_lnum_t j = 0; j < 3; j++) {
+      ast_cpl->xast[3*i + j]  = dyn[6*i + j];
+      ast_cpl->xvast[3*i + j] = dyn[6*i + 3 + j];
+    }
+  }
+
+  BFT_FREE(dyn);
+
+#endif
 }
 
 /*----------------------------------------------------------------------------
@@ -436,6 +462,29 @@ _val_ant(cs_ast_coupling_t  *ast_cpl)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Complete reception of displacements deferred by an explicit scheme
+ * in asynchronous mode.
+ *
+ * This must be done before any other read from code_aster, as Calcium
+ * messages are received in the order in which they were sent.
+ *----------------------------------------------------------------------------*/
+
+static void
+_complete_recv_dyn(cs_ast_coupling_t  *ast_cpl)
+{
+  if (ast_cpl->recv_pending == false)
+    return;
+
+  ast_cpl->recv_pending = false;
+
+  /* receive displacements from code_aster */
+  _recv_dyn(ast_cpl);
+
+  /* save previous values */
+  _val_ant(ast_cpl);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -767,8 +816,9 @@ void CS_PROCF(astfor, ASTFOR)
 
   if (cs_glob_n_ranks > 1) {
 
-    double  *fopas;
-    BFT_MALLOC(fopas, 3*ast_cpl->n_g_faces, double);
+    double  *fopas = NULL;
+    if (cs_glob_rank_id == 0)
+      BFT_MALLOC(fopas, 3*ast_cpl->n_g_faces, double);
 
     cs_part_to_block_copy_array(ast_cpl->face_p2b,
                                 CS_DOUBLE,
@@ -805,11 +855,13 @@ void CS_PROCF(astfor, ASTFOR)
     ast_cpl->icv1 = icv;
     _send_icv2(ast_cpl, icv);
 
-    /* receive displacements from code_aster */
-    _recv_dyn(ast_cpl);
-
-    /* save previous values */
-    _val_ant(ast_cpl);
+    /* receive displacements from code_aster and save previous values;
+       in asynchronous mode, this is deferred until the displacements
+       are needed, so that the structure computation overlaps the
+       end of the fluid time step */
+    ast_cpl->recv_pending = true;
+    if (ast_cpl->async == false)
+      _complete_recv_dyn(ast_cpl);
 
   }
 
@@ -856,6 +908,8 @@ void CS_PROCF(astcin, ASTCIN)
   if (ast_cpl->iteration < 0)
     return;
 
+  _complete_recv_dyn(ast_cpl);
+
   const cs_lnum_t  nb_dyn = ast_cpl->n_vertices;
 
   /* Predict displacements */
@@ -957,6 +1011,8 @@ CS_PROCF(astpdt, ASTPDT)
 
   int err_code = 0;
 
+  _complete_recv_dyn(ast_cpl);
+
   ast_cpl->iteration += 1;
 
   if (cs_glob_rank_id <= 0) {
@@ -1066,6 +1122,9 @@ cs_ast_coupling_initialize(int        nalimx,
 
   ast_cpl->nbssit = nalimx; /* number of sub-iterations */
 
+  ast_cpl->async = false;
+  ast_cpl->recv_pending = false;
+
   ast_cpl->dt = 0.;
   ast_cpl->dtref = ts->dt_ref;  /* reference time step */
 
@@ -1094,6 +1153,15 @@ cs_ast_coupling_initialize(int        nalimx,
   if (calcium_verbosity != NULL)
     cs_calcium_set_verbosity(atoi(calcium_verbosity));
 
+  /* Asynchronous reception of displacements for explicit schemes,
+     based on environment variable */
+
+  const char *ast_async = getenv("CS_AST_COUPLING_ASYNC");
+  if (ast_async != NULL) {
+    if (atoi(ast_async) > 0)
+      ast_cpl->async = true;
+  }
+
   /* Find root rank of coupling */
 
 #if defined(PLE_HAVE_MPI)
@@ -1178,6 +1246,12 @@ cs_ast_coupling_finalize(void)
 {
   cs_ast_coupling_t  *ast_cpl = cs_glob_ast_coupling;
 
+  /* Displacements sent by code_aster for the last time step
+     must still be received */
+
+  if (ast_cpl->iteration >= 0)
+    _complete_recv_dyn(ast_cpl);
+
   BFT_FREE(ast_cpl->xast);
   BFT_FREE(ast_cpl->xvast);
   BFT_FREE(ast_cpl->xvasa);
@@ -199,6 +199,7 @@ static bool   _cs_trace = false;
 /* Additional cleanup steps */
 
 static cs_base_atexit_t  * _cs_base_atexit = NULL;
+static cs_base_atexit_t  * _cs_base_error_flush = NULL;
 
 /* Additional MPI communicators */
 
@@ -516,6 +517,15 @@ _cs_base_error_handler(const char  *nom_fic,
     _cs_base_atexit = NULL;
   }
 
+  /* Write buffered output (such as time plot values), which may help
+     diagnose the error */
+
+  if (_cs_base_error_flush != NULL) {
+    cs_base_atexit_t  *_error_flush = _cs_base_error_flush;
+    _cs_base_error_flush = NULL;
+    _error_flush();
+  }
+
   bft_printf_flush();
 
   _cs_base_err_printf("\n");
@@ -1311,6 +1321,17 @@ cs_base_mpi_init(int    *argc,
   int arg_id = 0, flag = 0;
   int use_mpi = false;
 
+#if (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
+
+  /* Allow MPI calls from multiple threads only if requested
+     (as needed by asynchronous postprocessing output) */
+
+  int mpi_thread_level = MPI_THREAD_FUNNELED;
+  if (getenv("CS_MPI_THREAD_MULTIPLE") != NULL)
+    mpi_thread_level = MPI_THREAD_MULTIPLE;
+
+#endif
+
 #if   defined(__bg__) || defined(__CRAYXT_COMPUTE_LINUX_TARGET)
 
   /* Blue Gene/Q or Cray: assume MPI is always used. */
@@ -1349,7 +1370,7 @@ cs_base_mpi_init(int    *argc,
     if (!flag) {
 #if (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
       int mpi_threads;
-      MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &mpi_threads);
+      MPI_Init_thread(argc, argv, mpi_thread_level, &mpi_threads);
 #else
       MPI_Init(argc, argv);
 #endif
@@ -1377,7 +1398,7 @@ cs_base_mpi_init(int    *argc,
     if (!flag) {
 #if (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
       int mpi_threads;
-      MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &mpi_threads);
+      MPI_Init_thread(argc, argv, mpi_thread_level, &mpi_threads);
 #else
       MPI_Init(argc, argv);
 #endif
@@ -1633,6 +1654,21 @@ cs_base_mem_init(void)
     cs_glob_base_bft_mem_init = true;
 
   }
+
+  /* Optional pool for large blocks (CS_MEM_POOL gives cache size in MiB) */
+
+  if ((base_name = getenv("CS_MEM_POOL")) != NULL) {
+    long pool_size = atol(base_name);
+    if (pool_size > 0)
+      bft_mem_pool_set_params(256*1024, (size_t)pool_size * 1024*1024);
+  }
+
+  /* Optional per-subsystem accounting (CS_MEM_TAGS=1) */
+
+  if ((base_name = getenv("CS_MEM_TAGS")) != NULL) {
+    if (atoi(base_name) > 0)
+      bft_mem_tag_set_active(1);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -1755,6 +1791,26 @@ cs_base_mem_finalize(void)
 
   }
 
+  /* Memory pool statistics */
+
+  {
+    size_t n_pool_allocs = 0, n_pool_reuses = 0, pool_cached_max = 0;
+    bft_mem_pool_get_stats(&n_pool_allocs, &n_pool_reuses, &pool_cached_max);
+
+    if (n_pool_allocs > 0)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("\n  Pooled large blocks:          %llu allocations, "
+                      "%llu reused\n"
+                      "  Maximum pool cache size:      %12.3f MiB\n"),
+                    (unsigned long long)n_pool_allocs,
+                    (unsigned long long)n_pool_reuses,
+                    (double)pool_cached_max / 1024.);
+
+    bft_mem_pool_set_params(0, 0);
+  }
+
+  cs_base_mem_tag_log(CS_LOG_PERFORMANCE);
+
   cs_log_printf(CS_LOG_PERFORMANCE, "\n");
   cs_log_separator(CS_LOG_PERFORMANCE);
 
@@ -1783,6 +1839,78 @@ cs_base_mem_finalize(void)
   bft_mem_usage_end();
 }
 
+/*----------------------------------------------------------------------------
+ * Log current and peak memory use per subsystem tag.
+ *
+ * This is only active when tagged allocation accounting is active
+ * (CS_MEM_TAGS environment variable set to 1). In parallel, this function
+ * must be called by all ranks, and minimum and maximum values over ranks
+ * are also logged.
+ *
+ * parameters:
+ *   log_type <-- log type (CS_LOG_SETUP or CS_LOG_PERFORMANCE)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_base_mem_tag_log(cs_log_t  log_type)
+{
+  if (bft_mem_tag_is_active() == 0)
+    return;
+
+  /* Values per tag: current, peak (in MiB) */
+
+  double v_loc[2*BFT_MEM_N_TAGS];
+  double v_min[2*BFT_MEM_N_TAGS], v_max[2*BFT_MEM_N_TAGS];
+
+  for (int t = 0; t < BFT_MEM_N_TAGS; t++) {
+    size_t s_cur = 0, s_max = 0;
+    bft_mem_tag_get_stats(t, &s_cur, &s_max);
+    v_loc[t*2]     = (double)s_cur / 1024.;
+    v_loc[t*2 + 1] = (double)s_max / 1024.;
+  }
+
+  for (int i = 0; i < 2*BFT_MEM_N_TAGS; i++) {
+    v_min[i] = v_loc[i];
+    v_max[i] = v_loc[i];
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Allreduce(v_loc, v_min, 2*BFT_MEM_N_TAGS, MPI_DOUBLE, MPI_MIN,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(v_loc, v_max, 2*BFT_MEM_N_TAGS, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  cs_log_printf(log_type,
+                _("\n  Memory use per subsystem (MiB):\n\n"));
+
+  if (cs_glob_n_ranks > 1)
+    cs_log_printf(log_type,
+                  _("    %-16s %12s %12s %12s %12s\n"),
+                  "", _("current min"), _("current max"),
+                  _("peak min"), _("peak max"));
+  else
+    cs_log_printf(log_type,
+                  _("    %-16s %12s %12s\n"),
+                  "", _("current"), _("peak"));
+
+  for (int t = 0; t < BFT_MEM_N_TAGS; t++) {
+    if (v_max[t*2 + 1] <= 0.)
+      continue;
+    if (cs_glob_n_ranks > 1)
+      cs_log_printf(log_type,
+                    "    %-16s %12.3f %12.3f %12.3f %12.3f\n",
+                    bft_mem_tag_name(t),
+                    v_min[t*2], v_max[t*2], v_min[t*2+1], v_max[t*2+1]);
+    else
+      cs_log_printf(log_type,
+                    "    %-16s %12.3f %12.3f\n",
+                    bft_mem_tag_name(t), v_max[t*2], v_max[t*2+1]);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Print summary of running time, including CPU and elapsed times.
  *----------------------------------------------------------------------------*/
@@ -2159,6 +2287,24 @@ cs_base_atexit_set(cs_base_atexit_t  *const fct)
   _cs_base_atexit = fct;
 }
 
+/*----------------------------------------------------------------------------
+ * Define a function to be called by the error handler to flush buffered
+ * output before aborting.
+ *
+ * This allows higher level modules (such as time plots) to write their
+ * buffered data in case of error without cs_base depending on them.
+ * Only one function may be called (latest setting wins).
+ *
+ * parameters:
+ *   fct <-- pointer to function to be called
+ *----------------------------------------------------------------------------*/
+
+void
+cs_base_error_flush_set(cs_base_atexit_t  *const fct)
+{
+  _cs_base_error_flush = fct;
+}
+
 /*----------------------------------------------------------------------------
  * Convert a character string from the Fortran API to the C API.
  *
@@ -39,6 +39,8 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "cs_log.h"
+
 /*=============================================================================
  * Macro definitions
  *============================================================================*/
@@ -215,6 +217,21 @@ cs_base_mem_init(void);
 void
 cs_base_mem_finalize(void);
 
+/*----------------------------------------------------------------------------
+ * Log current and peak memory use per subsystem tag.
+ *
+ * This is only active when tagged allocation accounting is active
+ * (CS_MEM_TAGS environment variable set to 1). In parallel, this function
+ * must be called by all ranks, and minimum and maximum values over ranks
+ * are also logged.
+ *
+ * parameters:
+ *   log_type <-- log type (CS_LOG_SETUP or CS_LOG_PERFORMANCE)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_base_mem_tag_log(cs_log_t  log_type);
+
 /*----------------------------------------------------------------------------
  * Print summary of running time, including CPU and elapsed times.
  *----------------------------------------------------------------------------*/
@@ -330,6 +347,19 @@ cs_base_warn(const char  *file_name,
 void
 cs_base_atexit_set(cs_base_atexit_t  *const fct);
 
+/*----------------------------------------------------------------------------
+ * Define a function to be called by the error handler to flush buffered
+ * output before aborting.
+ *
+ * Only one function may be called (latest setting wins).
+ *
+ * parameters:
+ *   fct <-- pointer to function to be called
+ *----------------------------------------------------------------------------*/
+
+void
+cs_base_error_flush_set(cs_base_atexit_t  *const fct);
+
 /*----------------------------------------------------------------------------
  * Convert a character string from the Fortran API to the C API.
  *
@@ -57,10 +57,6 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
-#define CS_CUDA_CHECK(x)                                                       \
-if (cudaError_t err = (x)) {                                                   \
-  bft_error(__FILE__, __LINE__, 0, _("CUDA error: %s"), cudaGetErrorString(err)); \
-}
 
 /*============================================================================
  * Local Type Definitions
@@ -76,6 +72,105 @@ int  cs_glob_cuda_device_id = -1;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Allocate page-locked host or unified memory (for bft_mem).
+ *
+ * parameters:
+ *   mode <-- allocation mode
+ *   size <-- size in bytes
+ *
+ * returns:
+ *   pointer to allocated memory, or NULL in case of failure
+ *----------------------------------------------------------------------------*/
+
+static void *
+_hd_malloc(bft_mem_mode_t  mode,
+           size_t          size)
+{
+  void *ptr = NULL;
+  cudaError_t retval;
+
+  if (mode == BFT_MEM_HOST_PINNED)
+    retval = cudaMallocHost(&ptr, size);
+  else
+    retval = cudaMallocManaged(&ptr, size, cudaMemAttachGlobal);
+
+  if (retval != cudaSuccess)
+    ptr = NULL;
+
+  return ptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Free page-locked host or unified memory (for bft_mem).
+ *
+ * parameters:
+ *   mode <-- allocation mode
+ *   ptr  <-- pointer to memory allocated by _hd_malloc
+ *----------------------------------------------------------------------------*/
+
+static void
+_hd_free(bft_mem_mode_t   mode,
+         void            *ptr)
+{
+  if (mode == BFT_MEM_HOST_PINNED)
+    CS_CUDA_CHECK(cudaFreeHost(ptr));
+  else
+    CS_CUDA_CHECK(cudaFree(ptr));
+}
+
+/*----------------------------------------------------------------------------
+ * Prefetch unified memory to host or device (for bft_mem).
+ *
+ * The prefetch is asynchronous relative to the host, on the default stream.
+ *
+ * parameters:
+ *   ptr      <-- pointer to memory
+ *   size     <-- size in bytes
+ *   location <-- target location
+ *----------------------------------------------------------------------------*/
+
+static void
+_hd_prefetch(const void          *ptr,
+             size_t               size,
+             bft_mem_location_t   location)
+{
+  int device_id = (location == BFT_MEM_LOC_DEVICE) ?
+    cs_glob_cuda_device_id : cudaCpuDeviceId;
+
+  CS_CUDA_CHECK(cudaMemPrefetchAsync(ptr, size, device_id, 0));
+}
+
+/*----------------------------------------------------------------------------
+ * Give usage advice for unified memory (for bft_mem).
+ *
+ * parameters:
+ *   ptr    <-- pointer to memory
+ *   size   <-- size in bytes
+ *   advice <-- usage advice
+ *----------------------------------------------------------------------------*/
+
+static void
+_hd_advise(const void        *ptr,
+           size_t             size,
+           bft_mem_advice_t   advice)
+{
+  switch (advice) {
+  case BFT_MEM_ADVISE_READ_MOSTLY:
+    CS_CUDA_CHECK(cudaMemAdvise(ptr, size, cudaMemAdviseSetReadMostly,
+                                cs_glob_cuda_device_id));
+    break;
+  case BFT_MEM_ADVISE_PREFER_HOST:
+    CS_CUDA_CHECK(cudaMemAdvise(ptr, size, cudaMemAdviseSetPreferredLocation,
+                                cudaCpuDeviceId));
+    break;
+  case BFT_MEM_ADVISE_PREFER_DEVICE:
+    CS_CUDA_CHECK(cudaMemAdvise(ptr, size, cudaMemAdviseSetPreferredLocation,
+                                cs_glob_cuda_device_id));
+    break;
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -142,6 +237,143 @@ cs_base_cuda_device_info(cs_log_t  log_id)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Select a CUDA device for the current rank, if not done already.
+ *
+ * Ranks are distributed in round-robin fashion over available devices,
+ * so that consecutive ranks placed on a same node use different devices.
+ * This does not require any communication.
+ *
+ * Once a device is selected, page-locked and unified memory allocation
+ * functions are also defined for \ref BFT_MALLOC_HD.
+ *
+ * \return  selected device id, or -1 if no device is available
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_base_cuda_select_default_device(void)
+{
+  static bool selected = false;
+
+  if (selected)
+    return cs_glob_cuda_device_id;
+
+  selected = true;
+
+  int n_devices = 0;
+
+  if (cudaGetDeviceCount(&n_devices) != cudaSuccess || n_devices < 1)
+    return cs_glob_cuda_device_id;
+
+  int rank_id = (cs_glob_rank_id > -1) ? cs_glob_rank_id : 0;
+  int device_id = rank_id % n_devices;
+
+  CS_CUDA_CHECK(cudaSetDevice(device_id));
+
+  cs_glob_cuda_device_id = device_id;
+
+  /* Allow host/device allocations (BFT_MALLOC_HD) from now on */
+
+  bft_mem_hd_set_functions(_hd_malloc, _hd_free, _hd_prefetch, _hd_advise);
+
+  return cs_glob_cuda_device_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate memory on the current CUDA device.
+ *
+ * \param[in]  size  size of memory to allocate, in bytes
+ *
+ * \return  pointer to allocated device memory, or NULL if size is 0
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_base_cuda_malloc(size_t  size)
+{
+  void *ptr = NULL;
+
+  if (size > 0)
+    CS_CUDA_CHECK(cudaMalloc(&ptr, size));
+
+  return ptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free memory allocated on a CUDA device.
+ *
+ * \param[in]  ptr  pointer to device memory, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_base_cuda_free(void  *ptr)
+{
+  if (ptr != NULL)
+    CS_CUDA_CHECK(cudaFree(ptr));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Copy data from host to device.
+ *
+ * \param[out]  dst   pointer to destination (device memory)
+ * \param[in]   src   pointer to source (host memory)
+ * \param[in]   size  size of data to copy, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_base_cuda_copy_h2d(void        *dst,
+                      const void  *src,
+                      size_t       size)
+{
+  if (size > 0)
+    CS_CUDA_CHECK(cudaMemcpy(dst, src, size, cudaMemcpyHostToDevice));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Copy data from device to host.
+ *
+ * \param[out]  dst   pointer to destination (host memory)
+ * \param[in]   src   pointer to source (device memory)
+ * \param[in]   size  size of data to copy, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_base_cuda_copy_d2h(void        *dst,
+                      const void  *src,
+                      size_t       size)
+{
+  if (size > 0)
+    CS_CUDA_CHECK(cudaMemcpy(dst, src, size, cudaMemcpyDeviceToHost));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Copy data from device to device.
+ *
+ * \param[out]  dst   pointer to destination (device memory)
+ * \param[in]   src   pointer to source (device memory)
+ * \param[in]   size  size of data to copy, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_base_cuda_copy_d2d(void        *dst,
+                      const void  *src,
+                      size_t       size)
+{
+  if (size > 0)
+    CS_CUDA_CHECK(cudaMemcpy(dst, src, size, cudaMemcpyDeviceToDevice));
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
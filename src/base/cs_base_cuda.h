@@ -45,6 +45,15 @@
  * Macro definitions
  *============================================================================*/
 
+#if defined(__CUDACC__)
+
+#define CS_CUDA_CHECK(x)                                                       \
+if (cudaError_t err = (x)) {                                                   \
+  bft_error(__FILE__, __LINE__, 0, _("CUDA error: %s"), cudaGetErrorString(err)); \
+}
+
+#endif /* defined(__CUDACC__) */
+
 /*----------------------------------------------------------------------------*/
 
 BEGIN_C_DECLS
@@ -80,6 +89,93 @@ extern int  cs_glob_cuda_device_id;
 void
 cs_base_cuda_device_info(cs_log_t  log_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Select a CUDA device for the current rank, if not done already.
+ *
+ * Ranks are distributed in round-robin fashion over available devices,
+ * so that consecutive ranks placed on a same node use different devices.
+ * This does not require any communication.
+ *
+ * Once a device is selected, page-locked and unified memory allocation
+ * functions are also defined for \ref BFT_MALLOC_HD.
+ *
+ * \return  selected device id, or -1 if no device is available
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_base_cuda_select_default_device(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate memory on the current CUDA device.
+ *
+ * \param[in]  size  size of memory to allocate, in bytes
+ *
+ * \return  pointer to allocated device memory, or NULL if size is 0
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_base_cuda_malloc(size_t  size);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free memory allocated on a CUDA device.
+ *
+ * \param[in]  ptr  pointer to device memory, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_base_cuda_free(void  *ptr);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Copy data from host to device.
+ *
+ * \param[out]  dst   pointer to destination (device memory)
+ * \param[in]   src   pointer to source (host memory)
+ * \param[in]   size  size of data to copy, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_base_cuda_copy_h2d(void        *dst,
+                      const void  *src,
+                      size_t       size);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Copy data from device to host.
+ *
+ * \param[out]  dst   pointer to destination (host memory)
+ * \param[in]   src   pointer to source (device memory)
+ * \param[in]   size  size of data to copy, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_base_cuda_copy_d2h(void        *dst,
+                      const void  *src,
+                      size_t       size);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Copy data from device to device.
+ *
+ * \param[out]  dst   pointer to destination (device memory)
+ * \param[in]   src   pointer to source (device memory)
+ * \param[in]   size  size of data to copy, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_base_cuda_copy_d2d(void        *dst,
+                      const void  *src,
+                      size_t       size);
+
 #endif
 
 /*----------------------------------------------------------------------------*/
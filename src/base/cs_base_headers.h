@@ -66,6 +66,7 @@
 #include "cs_mass_source_terms.h"
 #include "cs_math.h"
 #include "cs_measures_util.h"
+#include "cs_node_shared.h"
 #include "cs_notebook.h"
 #include "cs_numbering.h"
 #include "cs_order.h"
@@ -85,6 +86,7 @@
 #include "cs_prototypes.h"
 #include "cs_random.h"
 #include "cs_renumber.h"
+#include "cs_repro_sum.h"
 #include "cs_restart.h"
 #include "cs_restart_map.h"
 #include "cs_rotation.h"
@@ -104,6 +106,7 @@
 #include "cs_volume_mass_injection.h"
 #include "cs_volume_zone.h"
 #include "cs_vof.h"
+#include "cs_wall_distance_geom.h"
 #include "cs_wall_functions.h"
 #include "cs_zone.h"
 
@@ -865,6 +865,25 @@ module cs_c_bindings
 
     !---------------------------------------------------------------------------
 
+    !> \brief Compute the distance from each cell center to the nearest
+    !>        wall face center.
+
+    !> \param[in]   n_wall_faces   number of local wall faces
+    !> \param[in]   wall_face_ids  ids of local wall faces (0 to n-1)
+    !> \param[out]  wall_dist      wall distance at cells
+
+    subroutine wall_distance_geom_compute(n_wall_faces, wall_face_ids,         &
+                                          wall_dist)                           &
+      bind(C, name='cs_wall_distance_geom_compute')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value :: n_wall_faces
+      integer(c_int), dimension(*), intent(in) :: wall_face_ids
+      real(c_double), dimension(*), intent(out) :: wall_dist
+    end subroutine wall_distance_geom_compute
+
+    !---------------------------------------------------------------------------
+
     !> \brief Set inlet boundary condition values for turbulence variables based
     !>        on a diameter \f$ D_H \f$ and the reference velocity
     !>        \f$ U_{ref} \f$
@@ -1093,6 +1112,27 @@ module cs_c_bindings
 
     !---------------------------------------------------------------------------
 
+    ! Interface to C function computing and logging balances by zone
+    ! defined at setup.
+
+    subroutine cs_balance_by_zone_compute_all()  &
+      bind(C, name='cs_balance_by_zone_compute_all')
+      use, intrinsic :: iso_c_binding
+      implicit none
+    end subroutine cs_balance_by_zone_compute_all
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function checking the runtime load balance.
+
+    subroutine cs_partition_check_load_balance()  &
+      bind(C, name='cs_partition_check_load_balance')
+      use, intrinsic :: iso_c_binding
+      implicit none
+    end subroutine cs_partition_check_load_balance
+
+    !---------------------------------------------------------------------------
+
     ! Interface to C function mapping field pointers
 
     subroutine cs_field_pointer_map_base()  &
@@ -1857,6 +1897,50 @@ module cs_c_bindings
 
     !---------------------------------------------------------------------------
 
+    ! Interface to C function computing Rij SSG and EBRSM cell source terms
+
+    subroutine cs_turbulence_rij_ssg_source_terms(gradv, produc, smbr, rovsdt) &
+      bind(C, name='cs_turbulence_rij_ssg_source_terms')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      real(kind=c_double), dimension(*), intent(in) :: gradv, produc
+      real(kind=c_double), dimension(*), intent(inout) :: smbr, rovsdt
+    end subroutine cs_turbulence_rij_ssg_source_terms
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function correcting the velocity with the pressure
+    ! increment gradient
+
+    subroutine cs_velocity_pressure_correct_velocity                         &
+      (idften, iphydr, thetap, dt, dttens, crom, dfrcxt, gradp, frcxt, vel)  &
+      bind(C, name='cs_velocity_pressure_correct_velocity')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value :: idften, iphydr
+      real(kind=c_double), value :: thetap
+      real(kind=c_double), dimension(*), intent(in) :: dt, dttens, crom
+      real(kind=c_double), dimension(*), intent(in) :: dfrcxt, gradp
+      real(kind=c_double), dimension(*), intent(inout) :: frcxt, vel
+    end subroutine cs_velocity_pressure_correct_velocity
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function reconstructing the velocity from mass fluxes
+
+    subroutine cs_velocity_pressure_velocity_from_mass_flux                  &
+      (ivofmt, crom, i_massflux, b_massflux, vel)                            &
+      bind(C, name='cs_velocity_pressure_velocity_from_mass_flux')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value :: ivofmt
+      real(kind=c_double), dimension(*), intent(in) :: crom
+      real(kind=c_double), dimension(*), intent(in) :: i_massflux, b_massflux
+      real(kind=c_double), dimension(*), intent(inout) :: vel
+    end subroutine cs_velocity_pressure_velocity_from_mass_flux
+
+    !---------------------------------------------------------------------------
+
     ! Interface to C function creating a variable field
 
     function cs_variable_field_create(name, label,                   &
@@ -2355,6 +2439,24 @@ module cs_c_bindings
 
     !---------------------------------------------------------------------------
 
+    !> \brief Solve the 1D equation for a set of faces.
+
+    !> \param[in]   n_faces   number of faces to solve
+    !> \param[in]   face_ids  ids of faces in 1D wall faces (0 to nfpt1d-1)
+    !> \param[in]   tf        fluid temperature at the boundary
+    !> \param[in]   hf        exchange coefficient for the fluid
+
+    subroutine cs_1d_wall_thermal_solve_faces(n_faces, face_ids, tf, hf)  &
+      bind(C, name='cs_1d_wall_thermal_solve_faces')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value :: n_faces
+      integer(c_int), dimension(*), intent(in) :: face_ids
+      real(kind=c_double), dimension(*), intent(in) :: tf, hf
+    end subroutine cs_1d_wall_thermal_solve_faces
+
+    !---------------------------------------------------------------------------
+
     !> \brief Read the restart file of the 1D-wall thermal module.
 
     subroutine cs_1d_wall_thermal_read()  &
@@ -355,7 +355,7 @@ cs_calcium_read_int(int                    rank_id,
     bft_printf_flush();
   }
 
-  MPI_Recv(meta, n_val_max, MPI_INT, rank_id,
+  MPI_Recv(val, n_val_max, MPI_INT, rank_id,
            CS_CALCIUM_MPI_TAG, _comm, &status);
 
   MPI_Get_count(&status, MPI_INT, n_val_read);
@@ -428,7 +428,7 @@ cs_calcium_read_double(int                    rank_id,
     bft_printf_flush();
   }
 
-  MPI_Recv(meta, n_val_max, MPI_DOUBLE, rank_id,
+  MPI_Recv(val, n_val_max, MPI_DOUBLE, rank_id,
            CS_CALCIUM_MPI_TAG, _comm, &status);
 
   MPI_Get_count(&status, MPI_DOUBLE, n_val_read);
@@ -52,6 +52,14 @@
 #include <arpa/inet.h>
 #endif
 
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
+#if defined(HAVE_SOCKET) && defined(HAVE_PTHREAD)
+#include <poll.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -66,8 +74,10 @@
 #include "cs_post.h"
 #include "cs_resource.h"
 #include "cs_restart.h"
+#include "cs_sles.h"
 #include "cs_time_plot.h"
 #include "cs_timer.h"
+#include "cs_timer_stats.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -93,6 +103,17 @@ BEGIN_C_DECLS
 #define CS_CONTROL_COMM_L_TYPE_NAME         2
 #define CS_CONTROL_COMM_L_SEC_NUM           4
 
+/* Monitor thread command buffer size, metrics line size,
+   and socket polling timeout (in milliseconds) */
+
+#define CS_CONTROL_MONITOR_BUF_L         8192
+#define CS_CONTROL_MONITOR_LINE_L         256
+#define CS_CONTROL_MONITOR_POLL_MS        100
+
+/* Default control file check interval when a monitor is connected */
+
+#define CS_CONTROL_MONITOR_FILE_WT_INTERVAL  30.
+
 /* If SSIZE_MAX is not defined by the sytem headers, we take the minimum value
    required by POSIX (for low level reads/writes with sockets). */
 
@@ -135,6 +156,27 @@ typedef struct {
 
 } cs_control_queue_t;
 
+/* Asynchronous monitor (socket I/O handled by a background thread
+   on rank 0; all fields except comm are protected by a mutex) */
+
+typedef struct {
+
+  cs_control_comm_t      *comm;           /* associated communicator */
+
+  size_t                  cmd_size;       /* size of received commands */
+  char                    cmd_buf[CS_CONTROL_MONITOR_BUF_L];
+                                          /* received, unhandled commands */
+
+  char                    metrics[CS_CONTROL_MONITOR_LINE_L];
+                                          /* latest metrics line */
+  bool                    metrics_pending; /* metrics not sent yet */
+
+  bool                    connected;      /* false after socket error
+                                             or disconnection */
+  bool                    stop;           /* request thread exit */
+
+} cs_control_monitor_t;
+
 /* TODO: use control queue after advance for remaining commands
    * commands may return response in case of controller sockets
    * socket errors should give xwarnings, not errors to allow dirty disconnect */
@@ -163,6 +205,22 @@ static double  _control_file_wt_last = -1.;
 static int     _control_advance_steps = -1;
 static int     _flush_nt = -1;
 
+/* Monitor state; active flag and previous metrics values are known
+   on all ranks, the monitor itself only on rank 0 */
+
+static bool                  _monitor_active = false;
+static double                _monitor_wt_last = -1.;
+static double                _monitor_ct_last = -1.;
+static unsigned long long    _monitor_n_iter_last = 0;
+
+#if defined(HAVE_SOCKET) && defined(HAVE_PTHREAD)
+
+static cs_control_monitor_t  *_monitor = NULL;
+static pthread_mutex_t        _monitor_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t              _monitor_thread;
+
+#endif
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -744,6 +802,330 @@ _comm_finalize(cs_control_comm_t  **comm)
   }
 }
 
+#if defined(HAVE_SOCKET) && defined(HAVE_PTHREAD)
+
+/*----------------------------------------------------------------------------
+ * Send a buffer through the monitor socket (from the monitor thread).
+ *
+ * No logging or memory allocation is done here, as those are not
+ * thread-safe.
+ *
+ * parameters:
+ *   sock <-- socket number
+ *   buf  <-- buffer to send
+ *   n    <-- number of bytes to send
+ *
+ * returns:
+ *   true in case of success, false on error
+ *----------------------------------------------------------------------------*/
+
+static bool
+_monitor_send(int          sock,
+              const char  *buf,
+              size_t       n)
+{
+  size_t start_id = 0;
+
+  while (start_id < n) {
+#if defined(MSG_NOSIGNAL)
+    ssize_t ret = send(sock, buf + start_id, n - start_id, MSG_NOSIGNAL);
+#else
+    ssize_t ret = write(sock, buf + start_id, n - start_id);
+#endif
+    if (ret < 1) {
+      if (ret < 0 && errno == EINTR)
+        continue;
+      return false;
+    }
+    start_id += ret;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Main function of the monitor thread.
+ *
+ * The socket is polled with a timeout, so that pending metrics are sent
+ * and stop requests handled shortly after they are posted. Received data
+ * is appended to the command buffer, which is consumed by the main thread.
+ *
+ * parameters:
+ *   arg <-- pointer to monitor structure
+ *
+ * returns:
+ *   NULL
+ *----------------------------------------------------------------------------*/
+
+static void *
+_monitor_thread_main(void  *arg)
+{
+  cs_control_monitor_t *m = arg;
+
+  const int sock = m->comm->socket;
+
+  char in_buf[CS_CONTROL_MONITOR_BUF_L];
+  char out_buf[CS_CONTROL_MONITOR_LINE_L];
+
+  pthread_mutex_lock(&_monitor_mutex);
+
+  while (m->stop == false && m->connected) {
+
+    size_t n_free = CS_CONTROL_MONITOR_BUF_L - m->cmd_size;
+    size_t n_out = 0;
+
+    if (m->metrics_pending) {
+      n_out = strlen(m->metrics);
+      memcpy(out_buf, m->metrics, n_out);
+      m->metrics_pending = false;
+    }
+
+    pthread_mutex_unlock(&_monitor_mutex);
+
+    bool ok = true;
+    ssize_t n_in = 0;
+
+    if (n_out > 0)
+      ok = _monitor_send(sock, out_buf, n_out);
+
+    /* Stop polling for input while the command buffer is full,
+       until the main thread has consumed it */
+
+    struct pollfd pfd;
+    pfd.fd = sock;
+    pfd.events = (n_free > 0) ? POLLIN : 0;
+    pfd.revents = 0;
+
+    int ret = (ok) ? poll(&pfd, 1, CS_CONTROL_MONITOR_POLL_MS) : 0;
+
+    if (ret > 0) {
+      if (pfd.revents & POLLIN) {
+        n_in = read(sock, in_buf, n_free);
+        if (n_in < 1)
+          ok = false;
+      }
+      else if (pfd.revents & (POLLERR | POLLHUP | POLLNVAL))
+        ok = false;
+    }
+    else if (ret < 0 && errno != EINTR)
+      ok = false;
+
+    pthread_mutex_lock(&_monitor_mutex);
+
+    if (n_in > 0) {
+      memcpy(m->cmd_buf + m->cmd_size, in_buf, n_in);
+      m->cmd_size += n_in;
+    }
+
+    if (ok == false)
+      m->connected = false;
+
+  }
+
+  pthread_mutex_unlock(&_monitor_mutex);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Extract complete command lines received by the monitor.
+ *
+ * If the buffer is full with no complete line, its contents are
+ * returned anyway so as not to stall reception.
+ *
+ * parameters:
+ *   buf --> pointer to allocated command buffer, or NULL
+ *
+ * returns:
+ *   size of extracted commands
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_monitor_pop_commands(char  **buf)
+{
+  size_t n = 0;
+  cs_control_monitor_t *m = _monitor;
+
+  *buf = NULL;
+
+  pthread_mutex_lock(&_monitor_mutex);
+
+  for (size_t i = m->cmd_size; i > 0; i--) {
+    if (m->cmd_buf[i-1] == '\n') {
+      n = i;
+      break;
+    }
+  }
+
+  if (n == 0 && m->cmd_size == CS_CONTROL_MONITOR_BUF_L)
+    n = m->cmd_size;
+
+  if (n > 0) {
+    BFT_MALLOC(*buf, n + 1, char);
+    memcpy(*buf, m->cmd_buf, n);
+    (*buf)[n] = '\0';
+    memmove(m->cmd_buf, m->cmd_buf + n, m->cmd_size - n);
+    m->cmd_size -= n;
+  }
+
+  pthread_mutex_unlock(&_monitor_mutex);
+
+  return n;
+}
+
+#endif /* defined(HAVE_SOCKET) && defined(HAVE_PTHREAD) */
+
+/*----------------------------------------------------------------------------
+ * Finalize the asynchronous monitor if present (local operation).
+ *----------------------------------------------------------------------------*/
+
+static void
+_monitor_finalize(void)
+{
+#if defined(HAVE_SOCKET) && defined(HAVE_PTHREAD)
+
+  if (_monitor == NULL)
+    return;
+
+  pthread_mutex_lock(&_monitor_mutex);
+  _monitor->stop = true;
+  pthread_mutex_unlock(&_monitor_mutex);
+
+  pthread_join(_monitor_thread, NULL);
+
+  _comm_finalize(&(_monitor->comm));
+  BFT_FREE(_monitor);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Connect the asynchronous monitor to a client.
+ *
+ * The connection itself is established on rank 0 by the calling thread;
+ * socket I/O is then handled by a background thread, so that commands
+ * received are queued and metrics sent without blocking the computation.
+ *
+ * parameters:
+ *   port_name <-- name of server port (host:port for IP sockets)
+ *   key       <-- key for authentification
+ *----------------------------------------------------------------------------*/
+
+static void
+_monitor_initialize(const char  *port_name,
+                    const char  *key)
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+#if defined(HAVE_SOCKET) && defined(HAVE_PTHREAD)
+
+  _monitor_finalize();
+
+  cs_control_comm_t *comm
+    = _comm_initialize(port_name, key, CS_CONTROL_COMM_TYPE_SOCKET);
+
+  if (comm == NULL)
+    return;
+
+  comm->errors_are_fatal = false;
+
+  BFT_MALLOC(_monitor, 1, cs_control_monitor_t);
+
+  _monitor->comm = comm;
+  _monitor->cmd_size = 0;
+  _monitor->metrics[0] = '\0';
+  _monitor->metrics_pending = false;
+  _monitor->connected = true;
+  _monitor->stop = false;
+
+  int retval = pthread_create(&_monitor_thread,
+                              NULL,
+                              _monitor_thread_main,
+                              _monitor);
+
+  if (retval != 0) {
+    bft_printf(_("  Error creating control monitor thread (ignored):\n"
+                 "    %s\n"), strerror(retval));
+    _comm_finalize(&(_monitor->comm));
+    BFT_FREE(_monitor);
+  }
+
+#else
+
+  CS_UNUSED(port_name);
+  CS_UNUSED(key);
+
+  bft_printf(_("  control monitor requires socket and thread support "
+               "(ignored).\n"));
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Publish live metrics through the asynchronous monitor.
+ *
+ * The step computation time is the compute time (excluding MPI waits)
+ * of the top-level timer statistics since the previous call, and the
+ * imbalance the ratio of its maximum to mean value over ranks.
+ *
+ * This function is collective, and must be called on all ranks
+ * when the monitor is active.
+ *----------------------------------------------------------------------------*/
+
+static void
+_monitor_publish_metrics(void)
+{
+  const cs_time_step_t  *ts = cs_glob_time_step;
+
+  int stats_id = cs_timer_stats_id_by_name("stages");
+
+  double wt = cs_timer_wtime();
+  double ct = (stats_id > -1) ? cs_timer_stats_get_compute_time(stats_id) : 0.;
+  unsigned long long n_iter = cs_sles_get_n_iterations_tot();
+
+  if (_monitor_wt_last >= 0.) {
+
+    double c_loc = ct - _monitor_ct_last;
+    double c_max = c_loc, c_sum = c_loc;
+
+#if defined(HAVE_MPI)
+    if (cs_glob_n_ranks > 1) {
+      MPI_Reduce(&c_loc, &c_max, 1, MPI_DOUBLE, MPI_MAX, 0,
+                 cs_glob_mpi_comm);
+      MPI_Reduce(&c_loc, &c_sum, 1, MPI_DOUBLE, MPI_SUM, 0,
+                 cs_glob_mpi_comm);
+    }
+#endif
+
+    double imbalance = 1.;
+    if (c_sum > 0.)
+      imbalance = c_max / (c_sum / cs_glob_n_ranks);
+
+#if defined(HAVE_SOCKET) && defined(HAVE_PTHREAD)
+    if (_monitor != NULL) {
+      pthread_mutex_lock(&_monitor_mutex);
+      snprintf(_monitor->metrics, CS_CONTROL_MONITOR_LINE_L,
+               "metrics time_step %d time_value %.9g step_wtime %.6g "
+               "solver_iterations %llu imbalance %.4f\n",
+               ts->nt_cur, ts->t_cur, wt - _monitor_wt_last,
+               n_iter - _monitor_n_iter_last, imbalance);
+      _monitor->metrics[CS_CONTROL_MONITOR_LINE_L - 1] = '\0';
+      _monitor->metrics_pending = true;
+      pthread_mutex_unlock(&_monitor_mutex);
+    }
+#else
+    CS_UNUSED(ts);
+    CS_UNUSED(imbalance);
+#endif
+
+  }
+
+  _monitor_wt_last = wt;
+  _monitor_ct_last = ct;
+  _monitor_n_iter_last = n_iter;
+}
+
 /*----------------------------------------------------------------------------
  * Read next value, expecting integer
  *
@@ -1248,6 +1630,20 @@ _parse_control_buffer(const char         *name,
       break;
     }
 
+    /* Asynchronous monitor connect/disconnect request */
+
+    else if (strncmp(s, "monitor_connect ", 16) == 0) {
+      char *port_name, *key;
+      _read_next_string(true, &s, &port_name);
+      _read_next_string(false, &s, &key);
+      _monitor_initialize(port_name, key);
+    }
+
+    else if (strncmp(s, "monitor_disconnect", 18) == 0) {
+      if (cs_glob_rank_id <= 0)
+        _monitor_finalize();
+    }
+
     /* Advance */
 
     else if (strncmp(s, "advance ", 8) == 0) {
@@ -1331,6 +1727,7 @@ _parse_control_buffer(const char         *name,
 void
 cs_control_finalize(void)
 {
+  _monitor_finalize();
   _comm_finalize(&_cs_glob_control_comm);
   _queue_finalize(&_cs_glob_control_queue);
 }
@@ -1346,18 +1743,73 @@ void
 cs_control_check_file(void)
 {
   long f_size = -1;
+  long m_size = 0;
+  long m_active = 0;
   char *buffer = NULL;
+  char *m_buffer = NULL;
   const cs_time_step_t  *ts = cs_glob_time_step;
 
   const char path[] = "control_file";
 
-  /* Test existence and size of file */
+  /* Handle asynchronous monitor on rank 0: connect on first call if
+     requested through the environment, and extract received commands */
 
   if (cs_glob_rank_id <= 0) {
 
-    if (   _control_file_wt_interval <= 0.
+    static bool env_checked = false;
+
+    if (env_checked == false) {
+      env_checked = true;
+      const char *s = getenv("CS_CONTROL_MONITOR");
+      if (s != NULL) {
+        char *env_s = NULL, *p, *port_name, *key;
+        BFT_MALLOC(env_s, strlen(s) + 1, char);
+        strcpy(env_s, s);
+        p = env_s;
+        _read_next_string(false, &p, &port_name);
+        _read_next_string(false, &p, &key);
+        _monitor_initialize(port_name, key);
+        BFT_FREE(env_s);
+      }
+    }
+
+#if defined(HAVE_SOCKET) && defined(HAVE_PTHREAD)
+
+    if (_monitor != NULL) {
+
+      pthread_mutex_lock(&_monitor_mutex);
+      bool connected = _monitor->connected;
+      pthread_mutex_unlock(&_monitor_mutex);
+
+      m_size = _monitor_pop_commands(&m_buffer);
+
+      if (connected == false && m_size == 0) {
+        bft_printf(_("\n Control monitor disconnected.\n"));
+        _monitor_finalize();
+      }
+      else
+        m_active = 1;
+
+    }
+
+#endif
+
+  }
+
+  /* Test existence and size of file; if an asynchronous monitor
+     is connected, the file system is polled less often by default */
+
+  if (cs_glob_rank_id <= 0) {
+
+    double wt_interval = _control_file_wt_interval;
+    if (wt_interval <= 0. && m_active)
+      wt_interval = CS_CONTROL_MONITOR_FILE_WT_INTERVAL;
+
+    if (   wt_interval <= 0.
         ||(    cs_timer_wtime() - _control_file_wt_last
-           >= _control_file_wt_interval)) {
+           >= wt_interval)) {
+
+      _control_file_wt_last = cs_timer_wtime();
 
 #if defined(HAVE_UNISTD_H) && defined(HAVE_ACCESS)
 
@@ -1379,10 +1831,19 @@ cs_control_check_file(void)
   }
 
 #if defined(HAVE_MPI)
-  if (cs_glob_rank_id >= 0)
-    MPI_Bcast(&f_size,  1, MPI_LONG,  0, cs_glob_mpi_comm);
+  if (cs_glob_rank_id >= 0) {
+    long sizes[3] = {f_size, m_size, m_active};
+    MPI_Bcast(sizes, 3, MPI_LONG, 0, cs_glob_mpi_comm);
+    f_size = sizes[0];
+    m_size = sizes[1];
+    m_active = sizes[2];
+  }
 #endif
 
+  if (m_active && _monitor_active == false)
+    _monitor_wt_last = -1.;
+  _monitor_active = (m_active) ? true : false;
+
   /* If file exists, handle it */
 
   if (f_size >= 0) {
@@ -1407,8 +1868,6 @@ cs_control_check_file(void)
              " --------\n"
              "   \"%s\"\n\n"), path, strerror(errno));
 
-      _control_file_wt_last = cs_timer_wtime();
-
     }
 
 #if defined(HAVE_MPI)
@@ -1423,6 +1882,23 @@ cs_control_check_file(void)
     BFT_FREE(buffer);
   }
 
+  /* Handle commands received by the asynchronous monitor */
+
+  if (m_size > 0) {
+
+    if (cs_glob_rank_id > 0)
+      BFT_MALLOC(m_buffer, m_size + 1, char);
+
+#if defined(HAVE_MPI)
+    if (cs_glob_rank_id >= 0)
+      MPI_Bcast(m_buffer, m_size + 1, MPI_CHAR, 0, cs_glob_mpi_comm);
+#endif
+
+    _parse_control_buffer("control monitor", m_buffer, m_size, NULL);
+
+    BFT_FREE(m_buffer);
+  }
+
   /* Test control queue and connection second */
 
   if (_control_advance_steps > 0) {
@@ -1476,6 +1952,11 @@ cs_control_check_file(void)
     bft_printf_flush();
     cs_time_plot_flush_all();
   }
+
+  /* Publish metrics (using the active state shared by all ranks) */
+
+  if (_monitor_active)
+    _monitor_publish_metrics();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -83,10 +83,228 @@
 
 BEGIN_C_DECLS
 
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Work arrays ids */
+
+typedef enum {
+
+  CS_EIS_WORK_DAM,
+  CS_EIS_WORK_XAM,
+  CS_EIS_WORK_DAM_CONV,
+  CS_EIS_WORK_XAM_CONV,
+  CS_EIS_WORK_DAM_DIFF,
+  CS_EIS_WORK_XAM_DIFF,
+  CS_EIS_WORK_DPVAR,
+  CS_EIS_WORK_SMBINI,
+  CS_EIS_WORK_ADXK,
+  CS_EIS_WORK_ADXKM1,
+  CS_EIS_WORK_DPVARM1,
+  CS_EIS_WORK_RHS0,
+  CS_EIS_WORK_RHS_B,
+  CS_EIS_WORK_RHS_BAL,
+  CS_EIS_WORK_W1,
+
+  CS_EIS_N_WORK_ARRAYS
+
+} cs_eis_work_id_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Work arrays, kept from one call to the next so as to avoid
+   reallocation at each solve (calls are not nested) */
+
+static size_t      _work_size[CS_EIS_N_WORK_ARRAYS];
+static cs_real_t  *_work[CS_EIS_N_WORK_ARRAYS];
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Return a work array with at least a given number of values.
+ *
+ * The array is grown if needed, and its contents are undefined.
+ *
+ * parameters:
+ *   id     <-- work array id
+ *   n_vals <-- required number of values
+ *
+ * returns:
+ *   pointer to work array
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_work_array(cs_eis_work_id_t  id,
+            size_t            n_vals)
+{
+  if (_work_size[id] < n_vals) {
+    BFT_FREE(_work[id]);
+    BFT_MALLOC(_work[id], n_vals, cs_real_t);
+    _work_size[id] = n_vals;
+  }
+
+  return _work[id];
+}
+
+/*----------------------------------------------------------------------------
+ * Check if the right hand side may be updated incrementally between
+ * reconstruction sweeps.
+ *
+ * This requires the balance operator E to be affine in the variable,
+ * so that E.(x + alpha.dx) = E.x + alpha.(E.dx - E.0), and E.dx
+ * to be available from the dynamic relaxation. The field-dependent
+ * options must also be absent, as the dynamic relaxation applies the
+ * operator to increments without an associated field.
+ *
+ * parameters:
+ *   idtvar      <-- indicator of the temporal scheme
+ *   f_id        <-- field id (or -1)
+ *   var_cal_opt <-- variable calculation options
+ *
+ * returns:
+ *   true if the incremental update may be used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_incremental_rhs(int                      idtvar,
+                 int                      f_id,
+                 const cs_var_cal_opt_t  *var_cal_opt)
+{
+  /* Increments are only multiplied by the operator with dynamic
+     relaxation, and the first sweep must be complete */
+
+  if (   var_cal_opt->iswdyn < 1 || var_cal_opt->iswdyn > 2
+      || var_cal_opt->nswrsm < 2)
+    return false;
+
+  /* Relaxation of steady computations involves the previous value */
+
+  if (idtvar < 0)
+    return false;
+
+  /* Slope test and limiters are not linear */
+
+  if (   var_cal_opt->iconv > 0
+      && (var_cal_opt->isstpc != 1 || var_cal_opt->ischcv == 4))
+    return false;
+
+  cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
+  cs_halo_type_t halo_type = CS_HALO_STANDARD;
+
+  cs_gradient_type_by_imrgra(var_cal_opt->imrgra,
+                             &gradient_type,
+                             &halo_type);
+
+  if (   var_cal_opt->imligr > -1
+      || (gradient_type == CS_GRADIENT_GREEN_ITER && var_cal_opt->nswrgr > 1))
+    return false;
+
+  /* Field-dependent options */
+
+  if (   var_cal_opt->icoupl > 0 || var_cal_opt->iwgrec > 0
+      || cs_glob_mesh->have_rotation_perio)
+    return false;
+
+  if (f_id > -1) {
+    const cs_field_t *f = cs_field_by_id(f_id);
+    const int k_cv = cs_field_key_id("convection_limiter_id");
+    const int k_df = cs_field_key_id("diffusion_limiter_id");
+    if (   cs_field_get_key_int(f, k_cv) > -1
+        || cs_field_get_key_int(f, k_df) > -1)
+      return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Update the right hand side incrementally at the end of a sweep.
+ *
+ * rhs_bal contains the balance E.x^(k-1) of the previous sweep and is
+ * updated to E.x^k. adxk and adxkm1 contain E.dx^k - rhs0 and
+ * E.dx^(k-1) - rhs0 from the dynamic relaxation, and rhs_b the
+ * balance E.0 of a zero variable, so that:
+ *   E.x^k = E.x^(k-1) + alpha.(E.dx^k - E.0) + beta.(E.dx^(k-1) - E.0)
+ *
+ * parameters:
+ *   n_vals  <-- number of values (cells x dimension)
+ *   iswdyp  <-- dynamic relaxation type
+ *   alph    <-- relaxation coefficient of the current increment
+ *   beta    <-- relaxation coefficient of the previous increment
+ *   rhs0    <-- balance of the initial variable
+ *   rhs_b   <-- balance of a zero variable
+ *   adxk    <-- operator applied to current increment, minus rhs0
+ *   adxkm1  <-- operator applied to previous increment, minus rhs0
+ *   smbini  <-- right hand side without balance
+ *   rhs_bal <-> balance of the variable
+ *   smbrp   --> right hand side
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_rhs_incremental(cs_lnum_t        n_vals,
+                        int              iswdyp,
+                        cs_real_t        alph,
+                        cs_real_t        beta,
+                        const cs_real_t  rhs0[],
+                        const cs_real_t  rhs_b[],
+                        const cs_real_t  adxk[],
+                        const cs_real_t  adxkm1[],
+                        const cs_real_t  smbini[],
+                        cs_real_t        rhs_bal[],
+                        cs_real_t        smbrp[])
+{
+  if (iswdyp < 2)
+    beta = 0.;
+
+# pragma omp parallel for if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vals; i++) {
+    rhs_bal[i] +=   alph*(adxk[i] + rhs0[i] - rhs_b[i])
+                  + beta*(adxkm1[i] + rhs0[i] - rhs_b[i]);
+    smbrp[i] = smbini[i] + rhs_bal[i];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Save the balance computed at the first sweep for incremental updates,
+ * and deduce the balance of a zero variable.
+ *
+ * As x^1 = x^0 + dx^1, E.0 = (E.dx^1 - rhs0) + 2.rhs0 - E.x^1.
+ *
+ * parameters:
+ *   n_vals  <-- number of values (cells x dimension)
+ *   rhs0    <-- balance of the initial variable
+ *   adxk    <-- operator applied to first increment, minus rhs0
+ *   smbini  <-- right hand side without balance
+ *   smbrp   <-- right hand side
+ *   rhs_b   --> balance of a zero variable
+ *   rhs_bal --> balance of the variable
+ *----------------------------------------------------------------------------*/
+
+static void
+_init_rhs_incremental(cs_lnum_t        n_vals,
+                      const cs_real_t  rhs0[],
+                      const cs_real_t  adxk[],
+                      const cs_real_t  smbini[],
+                      const cs_real_t  smbrp[],
+                      cs_real_t        rhs_b[],
+                      cs_real_t        rhs_bal[])
+{
+# pragma omp parallel for if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vals; i++) {
+    rhs_bal[i] = smbrp[i] - smbini[i];
+    rhs_b[i] = adxk[i] + 2.*rhs0[i] - rhs_bal[i];
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -254,7 +472,8 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   int isym, inc, isweep, niterf, iccocg, nswmod, itenso, iinvpe;
   int lvar, ibsize, iesize, imasac, key_sinfo_id;
   double residu, rnorm, ressol, rnorm2;
-  double thetex, nadxkm1, nadxk, paxm1ax, paxm1rk, paxkrk, alph, beta;
+  double thetex, nadxkm1, nadxk, paxm1ax, paxm1rk, paxkrk;
+  double alph = 1., beta = 0.;
 
   cs_halo_rotation_t rotation_mode = CS_HALO_ROTATION_COPY;
 
@@ -265,8 +484,10 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   cs_field_t *f = NULL;
   int coupling_id = -1;
 
-  cs_real_t *dam, *xam, *smbini, *w1, *adxk, *adxkm1, *dpvarm1, *rhs0;
+  cs_real_t *dam, *xam, *smbini, *w1;
+  cs_real_t *adxk = NULL, *adxkm1 = NULL, *dpvarm1 = NULL, *rhs0 = NULL;
   cs_real_t *dam_conv, *xam_conv, *dam_diff, *xam_diff;
+  cs_real_t *rhs_b = NULL, *rhs_bal = NULL;
 
   bool conv_diff_mg = false;
 
@@ -294,20 +515,27 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
       conv_diff_mg = true;
   }
 
-  /* Allocate temporary arrays */
+  /* Get work arrays */
 
-  BFT_MALLOC(dam, n_cells_ext, cs_real_t);
+  dam = _work_array(CS_EIS_WORK_DAM, n_cells_ext);
   if (conv_diff_mg) {
-    BFT_MALLOC(dam_conv, n_cells_ext, cs_real_t);
-    BFT_MALLOC(dam_diff, n_cells_ext, cs_real_t);
+    dam_conv = _work_array(CS_EIS_WORK_DAM_CONV, n_cells_ext);
+    dam_diff = _work_array(CS_EIS_WORK_DAM_DIFF, n_cells_ext);
   }
-  BFT_MALLOC(smbini, n_cells_ext, cs_real_t);
+  smbini = _work_array(CS_EIS_WORK_SMBINI, n_cells_ext);
 
   if (iswdyp >= 1) {
-    BFT_MALLOC(adxk, n_cells_ext, cs_real_t);
-    BFT_MALLOC(adxkm1, n_cells_ext, cs_real_t);
-    BFT_MALLOC(dpvarm1, n_cells_ext, cs_real_t);
-    BFT_MALLOC(rhs0, n_cells_ext, cs_real_t);
+    adxk = _work_array(CS_EIS_WORK_ADXK, n_cells_ext);
+    adxkm1 = _work_array(CS_EIS_WORK_ADXKM1, n_cells_ext);
+    dpvarm1 = _work_array(CS_EIS_WORK_DPVARM1, n_cells_ext);
+    rhs0 = _work_array(CS_EIS_WORK_RHS0, n_cells_ext);
+  }
+
+  const bool incremental_rhs = _incremental_rhs(idtvar, f_id, var_cal_opt);
+
+  if (incremental_rhs) {
+    rhs_b = _work_array(CS_EIS_WORK_RHS_B, n_cells);
+    rhs_bal = _work_array(CS_EIS_WORK_RHS_BAL, n_cells);
   }
 
   /* Symmetric matrix, except if advection */
@@ -316,10 +544,10 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
   bool symmetric = (isym == 1) ? true : false;
 
-  BFT_MALLOC(xam,isym*n_i_faces,cs_real_t);
+  xam = _work_array(CS_EIS_WORK_XAM, isym*n_i_faces);
   if (conv_diff_mg) {
-    BFT_MALLOC(xam_conv, 2*n_i_faces, cs_real_t);
-    BFT_MALLOC(xam_diff,   n_i_faces, cs_real_t);
+    xam_conv = _work_array(CS_EIS_WORK_XAM_CONV, 2*n_i_faces);
+    xam_diff = _work_array(CS_EIS_WORK_XAM_DIFF,   n_i_faces);
   }
 
   /* Matrix block size */
@@ -573,8 +801,7 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
      ghost values should not be cancelled, but rather left unchanged.
      For other variables, iinvpe=1 will also be a standard exchange. */
 
-  /* Allocate a temporary array */
-  BFT_MALLOC(w1, n_cells_ext, cs_real_t);
+  w1 = _work_array(CS_EIS_WORK_W1, n_cells_ext);
 
   if (iinvpe == 2)
     rotation_mode = CS_HALO_ROTATION_IGNORE;
@@ -605,9 +832,6 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
   sinfo.rhs_norm = rnorm;
 
-  /* Free memory */
-  BFT_FREE(w1);
-
   /* Warning: for Weight Matrix, one and only one sweep is done. */
   nswmod = CS_MAX(var_cal_opt->nswrsm, 1);
 
@@ -810,40 +1034,54 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
       }
     }
 
-    /* Compute the beta (min/max) limiter */
-    if (f_id > -1)
-      cs_beta_limiter_building(f_id, inc, rovsdt);
+    /* The operator is affine: reuse its product with the increments */
+    if (incremental_rhs && isweep > 1)
+      _update_rhs_incremental(n_cells, iswdyp, alph, beta,
+                              rhs0, rhs_b, adxk, adxkm1, smbini,
+                              rhs_bal, smbrp);
 
-    /* The added convective scalar mass flux is:
-       (thetex*Y_\face-imasac*Y_\celli)*mf.
-       When building the implicit part of the rhs, one
-       has to impose 1 on mass accumulation. */
-    imasac = 1;
+    else {
 
-    cs_balance_scalar(idtvar,
-                      f_id,
-                      imucpp,
-                      imasac,
-                      inc,
-                      iccocg,
-                      var_cal_opt,
-                      pvar,
-                      pvara,
-                      coefap,
-                      coefbp,
-                      cofafp,
-                      cofbfp,
-                      i_massflux,
-                      b_massflux,
-                      i_visc,
-                      b_visc,
-                      viscel,
-                      xcpp,
-                      weighf,
-                      weighb,
-                      icvflb,
-                      icvfli,
-                      smbrp);
+      /* Compute the beta (min/max) limiter */
+      if (f_id > -1)
+        cs_beta_limiter_building(f_id, inc, rovsdt);
+
+      /* The added convective scalar mass flux is:
+         (thetex*Y_\face-imasac*Y_\celli)*mf.
+         When building the implicit part of the rhs, one
+         has to impose 1 on mass accumulation. */
+      imasac = 1;
+
+      cs_balance_scalar(idtvar,
+                        f_id,
+                        imucpp,
+                        imasac,
+                        inc,
+                        iccocg,
+                        var_cal_opt,
+                        pvar,
+                        pvara,
+                        coefap,
+                        coefbp,
+                        cofafp,
+                        cofbfp,
+                        i_massflux,
+                        b_massflux,
+                        i_visc,
+                        b_visc,
+                        viscel,
+                        xcpp,
+                        weighf,
+                        weighb,
+                        icvflb,
+                        icvfli,
+                        smbrp);
+
+      if (incremental_rhs)
+        _init_rhs_incremental(n_cells, rhs0, adxk, smbini, smbrp,
+                              rhs_b, rhs_bal);
+
+    }
 
     /* --- Convergence test */
     residu = sqrt(cs_gdot(n_cells, smbrp, smbrp));
@@ -1040,24 +1278,6 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
  *============================================================================*/
 
   cs_sles_free_native(f_id, var_name);
-
-  /*  Free memory */
-  BFT_FREE(dam);
-  BFT_FREE(xam);
-  if (conv_diff_mg) {
-    BFT_FREE(dam_conv);
-    BFT_FREE(xam_conv);
-    BFT_FREE(dam_diff);
-    BFT_FREE(xam_diff);
-  }
-
-  BFT_FREE(smbini);
-  if (iswdyp >= 1) {
-    BFT_FREE(adxk);
-    BFT_FREE(adxkm1);
-    BFT_FREE(dpvarm1);
-    BFT_FREE(rhs0);
-  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1218,7 +1438,8 @@ cs_equation_iterative_solve_vector(int                   idtvar,
   int isym, inc, isweep, niterf, nswmod, ibsize;
   int key_sinfo_id;
   int iesize, lvar, imasac;
-  double residu, rnorm, ressol, rnorm2, thetex, alph, beta;
+  double residu, rnorm, ressol, rnorm2, thetex;
+  double alph = 1., beta = 0.;
   double paxkrk, nadxk, paxm1rk, nadxkm1, paxm1ax;
 
   cs_halo_rotation_t rotation_mode = CS_HALO_ROTATION_COPY;
@@ -1229,9 +1450,11 @@ cs_equation_iterative_solve_vector(int                   idtvar,
 
   cs_field_t *f;
 
-  cs_real_t    *xam;
+  cs_real_t    *xam = NULL;
   cs_real_33_t *dam;
-  cs_real_3_t  *dpvar, *smbini, *w1, *adxk, *adxkm1, *dpvarm1, *rhs0;
+  cs_real_3_t  *dpvar, *smbini, *w1;
+  cs_real_3_t  *adxk = NULL, *adxkm1 = NULL, *dpvarm1 = NULL, *rhs0 = NULL;
+  cs_real_t    *rhs_b = NULL, *rhs_bal = NULL;
 
   /*============================================================================
    * 0.  Initialization
@@ -1258,16 +1481,23 @@ cs_equation_iterative_solve_vector(int                   idtvar,
   eb_size[2] = iesize;
   eb_size[3] = iesize*iesize;
 
-  /* Allocate temporary arrays */
-  BFT_MALLOC(dam, n_cells_ext, cs_real_33_t);
-  BFT_MALLOC(dpvar, n_cells_ext, cs_real_3_t);
-  BFT_MALLOC(smbini, n_cells_ext, cs_real_3_t);
+  /* Get work arrays */
+  dam = (cs_real_33_t *)_work_array(CS_EIS_WORK_DAM, 9*n_cells_ext);
+  dpvar = (cs_real_3_t *)_work_array(CS_EIS_WORK_DPVAR, 3*n_cells_ext);
+  smbini = (cs_real_3_t *)_work_array(CS_EIS_WORK_SMBINI, 3*n_cells_ext);
 
   if (iswdyp >= 1) {
-    BFT_MALLOC(adxk, n_cells_ext, cs_real_3_t);
-    BFT_MALLOC(adxkm1, n_cells_ext, cs_real_3_t);
-    BFT_MALLOC(dpvarm1, n_cells_ext, cs_real_3_t);
-    BFT_MALLOC(rhs0, n_cells_ext, cs_real_3_t);
+    adxk = (cs_real_3_t *)_work_array(CS_EIS_WORK_ADXK, 3*n_cells_ext);
+    adxkm1 = (cs_real_3_t *)_work_array(CS_EIS_WORK_ADXKM1, 3*n_cells_ext);
+    dpvarm1 = (cs_real_3_t *)_work_array(CS_EIS_WORK_DPVARM1, 3*n_cells_ext);
+    rhs0 = (cs_real_3_t *)_work_array(CS_EIS_WORK_RHS0, 3*n_cells_ext);
+  }
+
+  const bool incremental_rhs = _incremental_rhs(idtvar, f_id, var_cal_opt);
+
+  if (incremental_rhs) {
+    rhs_b = _work_array(CS_EIS_WORK_RHS_B, 3*n_cells);
+    rhs_bal = _work_array(CS_EIS_WORK_RHS_BAL, 3*n_cells);
   }
 
   /* solving info */
@@ -1288,9 +1518,9 @@ cs_equation_iterative_solve_vector(int                   idtvar,
 
   /*  be careful here, xam is interleaved*/
   if (iesize == 1)
-    BFT_MALLOC(xam, isym*n_faces, cs_real_t);
+    xam = _work_array(CS_EIS_WORK_XAM, isym*n_faces);
   if (iesize == 3)
-    BFT_MALLOC(xam, 3*3*isym*n_faces, cs_real_t);
+    xam = _work_array(CS_EIS_WORK_XAM, 3*3*isym*n_faces);
 
   /*============================================================================
    * 1.  Building of the "simplified" matrix
@@ -1499,8 +1729,7 @@ cs_equation_iterative_solve_vector(int                   idtvar,
   /* ---> RESIDU DE NORMALISATION
    *    (NORME C.L +TERMES SOURCES+ TERMES DE NON ORTHOGONALITE) */
 
-  /* Allocate a temporary array */
-  BFT_MALLOC(w1, n_cells_ext, cs_real_3_t);
+  w1 = (cs_real_3_t *)_work_array(CS_EIS_WORK_W1, 3*n_cells_ext);
 
   cs_matrix_vector_native_multiply(symmetric,
                                    db_size,
@@ -1526,9 +1755,6 @@ cs_equation_iterative_solve_vector(int                   idtvar,
   rnorm = sqrt(rnorm2);
   sinfo.rhs_norm = rnorm;
 
-  /* Free memory */
-  BFT_FREE(w1);
-
   /* Warning: for Weight Matrix, one and only one sweep is done. */
   nswmod = CS_MAX(var_cal_opt->nswrsm, 1);
 
@@ -1759,30 +1985,47 @@ cs_equation_iterative_solve_vector(int                   idtvar,
      * has to impose 1 on mass accumulation. */
     imasac = 1;
 
-    cs_balance_vector(idtvar,
-                      f_id,
-                      imasac,
-                      inc,
-                      ivisep,
-                      var_cal_opt,
-                      pvar,
-                      pvara,
-                      coefav,
-                      coefbv,
-                      cofafv,
-                      cofbfv,
-                      i_massflux,
-                      b_massflux,
-                      i_visc,
-                      b_visc,
-                      i_secvis,
-                      b_secvis,
-                      viscel,
-                      weighf,
-                      weighb,
-                      icvflb,
-                      icvfli,
-                      smbrp);
+    /* The operator is affine: reuse its product with the increments */
+    if (incremental_rhs && isweep > 1)
+      _update_rhs_incremental(3*n_cells, iswdyp, alph, beta,
+                              (cs_real_t *)rhs0, rhs_b,
+                              (cs_real_t *)adxk, (cs_real_t *)adxkm1,
+                              (cs_real_t *)smbini, rhs_bal,
+                              (cs_real_t *)smbrp);
+
+    else {
+
+      cs_balance_vector(idtvar,
+                        f_id,
+                        imasac,
+                        inc,
+                        ivisep,
+                        var_cal_opt,
+                        pvar,
+                        pvara,
+                        coefav,
+                        coefbv,
+                        cofafv,
+                        cofbfv,
+                        i_massflux,
+                        b_massflux,
+                        i_visc,
+                        b_visc,
+                        i_secvis,
+                        b_secvis,
+                        viscel,
+                        weighf,
+                        weighb,
+                        icvflb,
+                        icvfli,
+                        smbrp);
+
+      if (incremental_rhs)
+        _init_rhs_incremental(3*n_cells, (cs_real_t *)rhs0,
+                              (cs_real_t *)adxk, (cs_real_t *)smbini,
+                              (cs_real_t *)smbrp, rhs_b, rhs_bal);
+
+    }
 
     /* --- Convergence test */
     residu = sqrt(cs_gdot(3*n_cells, (cs_real_t *)smbrp, (cs_real_t *)smbrp));
@@ -1895,18 +2138,6 @@ cs_equation_iterative_solve_vector(int                   idtvar,
       for (cs_lnum_t j = 0; j < 3; j++)
         fimp[cell_id][i][j] = dam[cell_id][i][j];
   }
-
-  /* Free memory */
-  BFT_FREE(dam);
-  BFT_FREE(xam);
-  BFT_FREE(smbini);
-  BFT_FREE(dpvar);
-  if (iswdyp >= 1) {
-    BFT_FREE(adxk);
-    BFT_FREE(adxkm1);
-    BFT_FREE(dpvarm1);
-    BFT_FREE(rhs0);
-  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2049,7 +2280,8 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
   int isym, inc, isweep, niterf, nswmod, ibsize;
   int key_sinfo_id;
   int iesize, lvar, imasac;
-  double residu, rnorm, ressol, rnorm2, thetex, alph, beta;
+  double residu, rnorm, ressol, rnorm2, thetex;
+  double alph = 1., beta = 0.;
   double paxkrk, nadxk, paxm1rk, nadxkm1, paxm1ax;
 
   cs_halo_rotation_t rotation_mode = CS_HALO_ROTATION_COPY;
@@ -2060,9 +2292,11 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
 
   cs_field_t *f;
 
-  cs_real_t    *xam;
+  cs_real_t    *xam = NULL;
   cs_real_66_t *dam;
-  cs_real_6_t  *dpvar, *smbini, *w1, *adxk, *adxkm1, *dpvarm1, *rhs0;
+  cs_real_6_t  *dpvar, *smbini, *w1;
+  cs_real_6_t  *adxk = NULL, *adxkm1 = NULL, *dpvarm1 = NULL, *rhs0 = NULL;
+  cs_real_t    *rhs_b = NULL, *rhs_bal = NULL;
 
   /*============================================================================
    * 0.  Initialization
@@ -2083,16 +2317,23 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
   eb_size[2] = iesize;
   eb_size[3] = iesize*iesize;
 
-  /* Allocate temporary arrays */
-  BFT_MALLOC(dam, n_cells_ext, cs_real_66_t);
-  BFT_MALLOC(dpvar, n_cells_ext, cs_real_6_t);
-  BFT_MALLOC(smbini, n_cells_ext, cs_real_6_t);
+  /* Get work arrays */
+  dam = (cs_real_66_t *)_work_array(CS_EIS_WORK_DAM, 36*n_cells_ext);
+  dpvar = (cs_real_6_t *)_work_array(CS_EIS_WORK_DPVAR, 6*n_cells_ext);
+  smbini = (cs_real_6_t *)_work_array(CS_EIS_WORK_SMBINI, 6*n_cells_ext);
 
   if (iswdyp >= 1) {
-    BFT_MALLOC(adxk, n_cells_ext, cs_real_6_t);
-    BFT_MALLOC(adxkm1, n_cells_ext, cs_real_6_t);
-    BFT_MALLOC(dpvarm1, n_cells_ext, cs_real_6_t);
-    BFT_MALLOC(rhs0, n_cells_ext, cs_real_6_t);
+    adxk = (cs_real_6_t *)_work_array(CS_EIS_WORK_ADXK, 6*n_cells_ext);
+    adxkm1 = (cs_real_6_t *)_work_array(CS_EIS_WORK_ADXKM1, 6*n_cells_ext);
+    dpvarm1 = (cs_real_6_t *)_work_array(CS_EIS_WORK_DPVARM1, 6*n_cells_ext);
+    rhs0 = (cs_real_6_t *)_work_array(CS_EIS_WORK_RHS0, 6*n_cells_ext);
+  }
+
+  const bool incremental_rhs = _incremental_rhs(idtvar, f_id, var_cal_opt);
+
+  if (incremental_rhs) {
+    rhs_b = _work_array(CS_EIS_WORK_RHS_B, 6*n_cells);
+    rhs_bal = _work_array(CS_EIS_WORK_RHS_BAL, 6*n_cells);
   }
 
   /* solving info */
@@ -2113,9 +2354,9 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
 
   /*  be carefull here, xam is interleaved*/
   if (iesize == 1)
-    BFT_MALLOC(xam, isym*n_faces, cs_real_t);
+    xam = _work_array(CS_EIS_WORK_XAM, isym*n_faces);
   if (iesize == 6)
-    BFT_MALLOC(xam, 6*6*isym*n_faces, cs_real_t);
+    xam = _work_array(CS_EIS_WORK_XAM, 6*6*isym*n_faces);
 
   /*============================================================================
    * 1.  Building of the "simplified" matrix
@@ -2308,8 +2549,7 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
   /* ---> RESIDU DE NORMALISATION
    *    (NORME C.L +TERMES SOURCES+ TERMES DE NON ORTHOGONALITE) */
 
-  /* Allocate a temporary array */
-  BFT_MALLOC(w1, n_cells_ext, cs_real_6_t);
+  w1 = (cs_real_6_t *)_work_array(CS_EIS_WORK_W1, 6*n_cells_ext);
 
   cs_matrix_vector_native_multiply(symmetric,
                                    db_size,
@@ -2336,9 +2576,6 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
   rnorm = sqrt(rnorm2);
   sinfo.rhs_norm = rnorm;
 
-  /* Free memory */
-  BFT_FREE(w1);
-
   /* Warning: for Weight Matrix, one and only one sweep is done. */
   nswmod = CS_MAX(var_cal_opt->nswrsm, 1);
 
@@ -2574,27 +2811,44 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
      * has to impose 1 on mass accumulation. */
     imasac = 1;
 
-    cs_balance_tensor(idtvar,
-                      f_id,
-                      imasac,
-                      inc,
-                      var_cal_opt,
-                      pvar,
-                      pvara,
-                      coefats,
-                      coefbts,
-                      cofafts,
-                      cofbfts,
-                      i_massflux,
-                      b_massflux,
-                      i_visc,
-                      b_visc,
-                      viscel,
-                      weighf,
-                      weighb,
-                      icvflb,
-                      icvfli,
-                      smbrp);
+    /* The operator is affine: reuse its product with the increments */
+    if (incremental_rhs && isweep > 1)
+      _update_rhs_incremental(6*n_cells, iswdyp, alph, beta,
+                              (cs_real_t *)rhs0, rhs_b,
+                              (cs_real_t *)adxk, (cs_real_t *)adxkm1,
+                              (cs_real_t *)smbini, rhs_bal,
+                              (cs_real_t *)smbrp);
+
+    else {
+
+      cs_balance_tensor(idtvar,
+                        f_id,
+                        imasac,
+                        inc,
+                        var_cal_opt,
+                        pvar,
+                        pvara,
+                        coefats,
+                        coefbts,
+                        cofafts,
+                        cofbfts,
+                        i_massflux,
+                        b_massflux,
+                        i_visc,
+                        b_visc,
+                        viscel,
+                        weighf,
+                        weighb,
+                        icvflb,
+                        icvfli,
+                        smbrp);
+
+      if (incremental_rhs)
+        _init_rhs_incremental(6*n_cells, (cs_real_t *)rhs0,
+                              (cs_real_t *)adxk, (cs_real_t *)smbini,
+                              (cs_real_t *)smbrp, rhs_b, rhs_bal);
+
+    }
 
     /* --- Convergence test */
     residu = sqrt(cs_gdot(6*n_cells, (cs_real_t *)smbrp, (cs_real_t *)smbrp));
@@ -2643,17 +2897,20 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
  *============================================================================*/
 
   cs_sles_free_native(f_id, var_name);
+}
 
-  /* Free memory */
-  BFT_FREE(dam);
-  BFT_FREE(xam);
-  BFT_FREE(smbini);
-  BFT_FREE(dpvar);
-  if (iswdyp >= 1) {
-    BFT_FREE(adxk);
-    BFT_FREE(adxkm1);
-    BFT_FREE(dpvarm1);
-    BFT_FREE(rhs0);
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free work arrays kept between calls to the equation solvers.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_iterative_solve_finalize(void)
+{
+  for (int i = 0; i < CS_EIS_N_WORK_ARRAYS; i++) {
+    BFT_FREE(_work[i]);
+    _work_size[i] = 0;
   }
 }
 
@@ -430,6 +430,15 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
                                    cs_real_6_t           smbrp[],
                                    cs_real_6_t           pvar[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free work arrays kept between calls to the equation solvers.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_iterative_solve_finalize(void);
+
 END_C_DECLS
 
 #endif /* __CS_EQUATION_ITERATIVE_SOLVE_H__ */
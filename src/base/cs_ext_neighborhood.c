@@ -159,6 +159,8 @@ static cs_ext_neighborhood_type_t _ext_nbh_type
   = CS_EXT_NEIGHBORHOOD_CELL_CENTER_OPPOSITE;
 static cs_real_t                  _non_ortho_max = 45;
 static bool                       _full_nb_boundary = false;
+static cs_lnum_t                  _n_max_ext_neighbors = 0;
+static cs_real_t                  _max_distance_ratio = -1;
 
 /*============================================================================
  * Private function definitions
@@ -922,216 +924,277 @@ _create_vtx_cells_connect2(cs_mesh_t   *mesh,
 }
 
 /*---------------------------------------------------------------------------
- * Create a "cell -> cells" connectivity.
+ * Build the extended neighborhood of a given cell.
+ *
+ * Cells sharing a vertex of one of the cell's interior faces are gathered
+ * in a work buffer, then sorted and made unique; the cell itself and cells
+ * sharing a face with it are removed.
  *
  * parameters:
+ *   c_id              <-- id of the cell
  *   mesh              <-- pointer to cs_mesh_t structure
  *   cell_i_faces_idx  <-- "cell -> faces" connectivity index
  *   cell_i_faces_lst  <-- "cell -> faces" connectivity list
- *   vtx_gcells_idx    --> "vertex -> ghost cells" connectivity index
- *   vtx_gcells_lst    --> "vertex -> ghost cells" connectivity list
- *   vtx_cells_idx     --> "vertex -> cells" connectivity index
- *   vtx_cells_lst     --> "vertex -> cells" connectivity list
- *   p_cell_cells_idx  --> pointer to "cell -> cells" connectivity index
- *   p_cell_cells_lst  --> pointer to "cell -> cells" connectivity list
+ *   vtx_gcells_idx    <-- "vertex -> ghost cells" connectivity index
+ *   vtx_gcells_lst    <-- "vertex -> ghost cells" connectivity list
+ *   vtx_cells_idx     <-- "vertex -> cells" connectivity index
+ *   vtx_cells_lst     <-- "vertex -> cells" connectivity list
+ *   buf_size          <-> size of the work buffer
+ *   buf               <-> work buffer (extended neighbors on output)
+ *
+ * returns:
+ *   number of cells in the extended neighborhood of the cell
  *---------------------------------------------------------------------------*/
 
-static void
-_create_cell_cells_connect(cs_mesh_t  *mesh,
-                           cs_lnum_t  *cell_i_faces_idx,
-                           cs_lnum_t  *cell_i_faces_lst,
-                           cs_lnum_t  *vtx_gcells_idx,
-                           cs_lnum_t  *vtx_gcells_lst,
-                           cs_lnum_t  *vtx_cells_idx,
-                           cs_lnum_t  *vtx_cells_lst,
-                           cs_lnum_t  *p_cell_cells_idx[],
-                           cs_lnum_t  *p_cell_cells_lst[])
+static cs_lnum_t
+_cell_ext_neighbors(cs_lnum_t          c_id,
+                    const cs_mesh_t   *mesh,
+                    const cs_lnum_t   *cell_i_faces_idx,
+                    const cs_lnum_t   *cell_i_faces_lst,
+                    const cs_lnum_t   *vtx_gcells_idx,
+                    const cs_lnum_t   *vtx_gcells_lst,
+                    const cs_lnum_t   *vtx_cells_idx,
+                    const cs_lnum_t   *vtx_cells_lst,
+                    cs_lnum_t         *buf_size,
+                    cs_lnum_t         *buf[])
 {
-  cs_lnum_t  i, j, i_cel, fac_id, i_vtx;
-  cs_lnum_t  cell_id, vtx_id, shift;
-
-  cs_lnum_t  *cell_buffer = NULL, *cell_tag = NULL, *cell_count = NULL;
-  cs_lnum_t  *cell_cells_idx = NULL, *cell_cells_lst = NULL;
-
   const cs_lnum_t  n_cells = mesh->n_cells;
-  const cs_lnum_t  n_cells_wghosts = mesh->n_cells_with_ghosts;
   const cs_lnum_2_t  *face_cells = (const cs_lnum_2_t *)(mesh->i_face_cells);
   const cs_lnum_t  *fac_vtx_idx = mesh->i_face_vtx_idx;
   const cs_lnum_t  *fac_vtx_lst = mesh->i_face_vtx_lst;
 
-  /* Allocate and initialize buffers */
-
-  BFT_MALLOC(cell_cells_idx, n_cells + 1, cs_lnum_t);
-  BFT_MALLOC(cell_buffer, n_cells_wghosts + n_cells, cs_lnum_t);
-
-  cell_tag = &(cell_buffer[0]);
-  cell_count = &(cell_buffer[n_cells_wghosts]);
-
-  cell_cells_idx[0] = 0;
-  for (i = 0; i < n_cells; i++) {
-    cell_cells_idx[i+1] = 0;
-    cell_count[i] = 0;
-  }
-
-  for (i = 0; i < n_cells_wghosts; i++)
-    cell_tag[i] = -1;
-
-  /* Define index */
-
-  for (i_cel = 0; i_cel < n_cells; i_cel++) {
-
-    /* First loop on faces to tag cells sharing a face */
-
-    for (i = cell_i_faces_idx[i_cel]; i < cell_i_faces_idx[i_cel+1]; i++) {
-
-      fac_id = cell_i_faces_lst[i];
-
-      cell_tag[face_cells[fac_id][0]] = i_cel;
-      cell_tag[face_cells[fac_id][1]] = i_cel;
-
-    } /* End of loop on cell's faces */
-
-    /* Second loop on faces to update index */
-
-    for (i = cell_i_faces_idx[i_cel]; i < cell_i_faces_idx[i_cel+1]; i++) {
-
-      fac_id = cell_i_faces_lst[i];
-
-      for (i_vtx = fac_vtx_idx[fac_id];
-           i_vtx < fac_vtx_idx[fac_id+1];
-           i_vtx++) {
-
-        vtx_id = fac_vtx_lst[i_vtx];
+  const cs_lnum_t  s_id = cell_i_faces_idx[c_id];
+  const cs_lnum_t  e_id = cell_i_faces_idx[c_id+1];
 
-        /* For cells belonging to this rank, get vertex -> cells connect. */
+  cs_lnum_t  *_buf = *buf;
+  cs_lnum_t  n = 0;
 
-        for (j = vtx_cells_idx[vtx_id]; j < vtx_cells_idx[vtx_id+1]; j++) {
+  /* Gather cells sharing a vertex of the cell's faces */
 
-          cell_id = vtx_cells_lst[j];
+  for (cs_lnum_t i = s_id; i < e_id; i++) {
 
-          if (cell_tag[cell_id] != i_cel) {
-            cell_cells_idx[i_cel+1] += 1;
-            cell_tag[cell_id] = i_cel;
-          }
-
-        }
-
-        if (n_cells_wghosts - n_cells > 0) { /* If there are ghost cells */
+    cs_lnum_t fac_id = cell_i_faces_lst[i];
 
-          /* For ghost cells, get vertex -> ghost cells connect. */
+    for (cs_lnum_t i_vtx = fac_vtx_idx[fac_id];
+         i_vtx < fac_vtx_idx[fac_id+1];
+         i_vtx++) {
 
-          for (j = vtx_gcells_idx[vtx_id]; j < vtx_gcells_idx[vtx_id+1]; j++) {
+      cs_lnum_t vtx_id = fac_vtx_lst[i_vtx];
 
-            cell_id = vtx_gcells_lst[j] + n_cells;
+      cs_lnum_t n_add = vtx_cells_idx[vtx_id+1] - vtx_cells_idx[vtx_id];
+      if (vtx_gcells_idx != NULL)
+        n_add += vtx_gcells_idx[vtx_id+1] - vtx_gcells_idx[vtx_id];
 
-            if (cell_tag[cell_id] != i_cel) {
-              cell_cells_idx[i_cel+1] += 1;
-              cell_tag[cell_id] = i_cel;
-            }
+      if (n + n_add > *buf_size) {
+        *buf_size = CS_MAX(2*(*buf_size), n + n_add);
+        BFT_REALLOC(_buf, *buf_size, cs_lnum_t);
+      }
 
-          }
+      for (cs_lnum_t j = vtx_cells_idx[vtx_id]; j < vtx_cells_idx[vtx_id+1]; j++)
+        _buf[n++] = vtx_cells_lst[j];
 
-        } /* If there are ghost cells */
+      if (vtx_gcells_idx != NULL) {
+        for (cs_lnum_t j = vtx_gcells_idx[vtx_id];
+             j < vtx_gcells_idx[vtx_id+1];
+             j++)
+          _buf[n++] = vtx_gcells_lst[j] + n_cells;
+      }
 
-      } /* End of loop on vertices */
+    } /* End of loop on vertices */
 
-    } /* End of loop on cell's faces */
+  } /* End of loop on cell's faces */
 
-  } /* End of loop on cells */
+  /* Sort, remove duplicates, the cell itself and face-adjacent cells */
 
-  /* Create index */
+  cs_sort_lnum(_buf, n);
 
-  for (i = 0; i < n_cells; i++)
-    cell_cells_idx[i+1] += cell_cells_idx[i];
+  cs_lnum_t n_ext = 0, prev_id = -1;
 
-  for (i = 0; i < n_cells_wghosts; i++)
-    cell_tag[i] = -1;
+  for (cs_lnum_t k = 0; k < n; k++) {
 
-  BFT_MALLOC(cell_cells_lst, cell_cells_idx[n_cells], cs_lnum_t);
+    cs_lnum_t cell_id = _buf[k];
 
-  /* Fill list */
+    if (cell_id == c_id || cell_id == prev_id)
+      continue;
+    prev_id = cell_id;
 
-  for (i_cel = 0; i_cel < n_cells; i_cel++) {
+    bool face_adjacent = false;
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      cs_lnum_t fac_id = cell_i_faces_lst[i];
+      if (face_cells[fac_id][0] == cell_id || face_cells[fac_id][1] == cell_id) {
+        face_adjacent = true;
+        break;
+      }
+    }
 
-    /* First loop on faces to tag cells sharing a face */
+    if (!face_adjacent)
+      _buf[n_ext++] = cell_id;
 
-    for (i = cell_i_faces_idx[i_cel]; i < cell_i_faces_idx[i_cel+1]; i++) {
+  }
 
-      fac_id = cell_i_faces_lst[i];
+  *buf = _buf;
 
-      cell_tag[face_cells[fac_id][0]] = i_cel;
-      cell_tag[face_cells[fac_id][1]] = i_cel;
+  return n_ext;
+}
 
-    } /* End of loop on cell's faces */
+/*---------------------------------------------------------------------------
+ * Create a "cell -> cells" connectivity.
+ *
+ * The connectivity is built in two thread-parallel passes (count, then
+ * fill), each thread using a work buffer sized by the largest vertex
+ * neighborhood of its cells, so no array of the size of the mesh is
+ * needed per thread.
+ *
+ * parameters:
+ *   mesh              <-- pointer to cs_mesh_t structure
+ *   cell_i_faces_idx  <-- "cell -> faces" connectivity index
+ *   cell_i_faces_lst  <-- "cell -> faces" connectivity list
+ *   vtx_gcells_idx    --> "vertex -> ghost cells" connectivity index
+ *   vtx_gcells_lst    --> "vertex -> ghost cells" connectivity list
+ *   vtx_cells_idx     --> "vertex -> cells" connectivity index
+ *   vtx_cells_lst     --> "vertex -> cells" connectivity list
+ *   p_cell_cells_idx  --> pointer to "cell -> cells" connectivity index
+ *   p_cell_cells_lst  --> pointer to "cell -> cells" connectivity list
+ *---------------------------------------------------------------------------*/
 
-    /* Second loop on faces to update list */
+static void
+_create_cell_cells_connect(cs_mesh_t  *mesh,
+                           cs_lnum_t  *cell_i_faces_idx,
+                           cs_lnum_t  *cell_i_faces_lst,
+                           cs_lnum_t  *vtx_gcells_idx,
+                           cs_lnum_t  *vtx_gcells_lst,
+                           cs_lnum_t  *vtx_cells_idx,
+                           cs_lnum_t  *vtx_cells_lst,
+                           cs_lnum_t  *p_cell_cells_idx[],
+                           cs_lnum_t  *p_cell_cells_lst[])
+{
+  cs_lnum_t  *cell_cells_idx = NULL, *cell_cells_lst = NULL;
 
-    for (i = cell_i_faces_idx[i_cel]; i < cell_i_faces_idx[i_cel+1]; i++) {
+  const cs_lnum_t  n_cells = mesh->n_cells;
 
-      fac_id = cell_i_faces_lst[i];
+  const cs_lnum_t  *_vtx_gcells_idx
+    = (mesh->n_cells_with_ghosts > n_cells) ? vtx_gcells_idx : NULL;
 
-      for (i_vtx = fac_vtx_idx[fac_id];
-           i_vtx < fac_vtx_idx[fac_id+1];
-           i_vtx++) {
+  BFT_MALLOC(cell_cells_idx, n_cells + 1, cs_lnum_t);
 
-        vtx_id = fac_vtx_lst[i_vtx];
+  cell_cells_idx[0] = 0;
 
-        /* For cells belonging to this rank, get vertex -> cells connect. */
+  /* First pass: define index; second pass: fill list */
 
-        for (j = vtx_cells_idx[vtx_id]; j < vtx_cells_idx[vtx_id+1]; j++) {
+  for (int pass = 0; pass < 2; pass++) {
 
-          cell_id = vtx_cells_lst[j];
+#   pragma omp parallel if (n_cells > CS_THR_MIN)
+    {
+      cs_lnum_t t_s_id, t_e_id;
+      _thread_range(n_cells, &t_s_id, &t_e_id);
 
-          if (cell_tag[cell_id] != i_cel) {
+      cs_lnum_t  buf_size = 0;
+      cs_lnum_t  *buf = NULL;
 
-            shift = cell_cells_idx[i_cel] + cell_count[i_cel];
-            cell_cells_lst[shift] = cell_id;
-            cell_tag[cell_id] = i_cel;
-            cell_count[i_cel] += 1;
+      for (cs_lnum_t c_id = t_s_id; c_id < t_e_id; c_id++) {
 
-          } /* Add this cell_id */
+        cs_lnum_t n_ext = _cell_ext_neighbors(c_id,
+                                              mesh,
+                                              cell_i_faces_idx,
+                                              cell_i_faces_lst,
+                                              _vtx_gcells_idx,
+                                              vtx_gcells_lst,
+                                              vtx_cells_idx,
+                                              vtx_cells_lst,
+                                              &buf_size,
+                                              &buf);
 
-        }
+        if (pass == 0)
+          cell_cells_idx[c_id+1] = n_ext;
+        else
+          memcpy(cell_cells_lst + cell_cells_idx[c_id],
+                 buf,
+                 n_ext*sizeof(cs_lnum_t));
 
-        if (n_cells_wghosts - n_cells > 0) { /* If there are ghost cells */
+      } /* End of loop on cells */
 
-          /* For ghost cells, get vertex -> ghost cells connect. */
+      BFT_FREE(buf);
 
-          for (j = vtx_gcells_idx[vtx_id]; j < vtx_gcells_idx[vtx_id+1]; j++){
+    } /* End of OpenMP block */
 
-            cell_id = vtx_gcells_lst[j] + n_cells;
+    if (pass == 0) {
 
-            if (cell_tag[cell_id] != i_cel) {
+      for (cs_lnum_t i = 0; i < n_cells; i++)
+        cell_cells_idx[i+1] += cell_cells_idx[i];
 
-              shift = cell_cells_idx[i_cel] + cell_count[i_cel];
-              cell_cells_lst[shift] = cell_id;
-              cell_tag[cell_id] = i_cel;
-              cell_count[i_cel] += 1;
+      BFT_MALLOC(cell_cells_lst, cell_cells_idx[n_cells], cs_lnum_t);
 
-            }
+    }
 
-          }
+  }
 
-        } /* If there are ghost cells */
+  /* Line elements are already sorted by column id */
 
-      } /* End of loop on vertices */
+  *p_cell_cells_idx = cell_cells_idx;
+  *p_cell_cells_lst = cell_cells_lst;
+}
 
-    } /* End of loop on cell's faces */
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get the maximum number of retained extended neighbors per cell.
+ *
+ * \return  maximum number of extended neighbors (0 if unlimited)
+ */
+/*----------------------------------------------------------------------------*/
 
-  } /* End of loop on cells */
+cs_lnum_t
+cs_ext_neighborhood_get_max_neighbors(void)
+{
+  return _n_max_ext_neighbors;
+}
 
-  /* Sort line elements by column id (for better access patterns) */
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum number of retained extended neighbors per cell.
+ *
+ * When set, only the nearest extended neighbors (based on cell center
+ * distance) are kept among those selected by the extended neighborhood
+ * type, which bounds the memory used by the "cell -> cells" connectivity.
+ *
+ * \param[in]  n_max  maximum number of extended neighbors (0 if unlimited)
+ */
+/*----------------------------------------------------------------------------*/
 
-  bool unique = cs_sort_indexed(n_cells, cell_cells_idx, cell_cells_lst);
+void
+cs_ext_neighborhood_set_max_neighbors(cs_lnum_t  n_max)
+{
+  _n_max_ext_neighbors = CS_MAX(n_max, 0);
+}
 
-  assert(unique == true);
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get the maximum distance ratio for extended neighbors.
+ *
+ * \return  maximum distance ratio (< 0 if unlimited)
+ */
+/*----------------------------------------------------------------------------*/
 
-  *p_cell_cells_idx = cell_cells_idx;
-  *p_cell_cells_lst = cell_cells_lst;
+cs_real_t
+cs_ext_neighborhood_get_max_distance_ratio(void)
+{
+  return _max_distance_ratio;
+}
 
-  /* Free memory */
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum distance ratio for extended neighbors.
+ *
+ * Extended neighbors whose center is farther than this ratio times the
+ * largest center distance to a face neighbor are discarded.
+ *
+ * \param[in]  ratio  maximum distance ratio (< 0 if unlimited)
+ */
+/*----------------------------------------------------------------------------*/
 
-  BFT_FREE(cell_buffer);
+void
+cs_ext_neighborhood_set_max_distance_ratio(cs_real_t  ratio)
+{
+  _max_distance_ratio = ratio;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1553,6 +1616,138 @@ _neighborhood_reduce_full_boundary(cs_mesh_t             *mesh,
   } /* End of Open MP block */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Prune retained extended neighbors based on distance criteria.
+ *
+ * Among adjacencies currently tagged for retention, those whose center
+ * distance exceeds the maximum distance ratio times the largest distance
+ * to a face neighbor are untagged, then only the nearest
+ * maximum number of neighbors are kept for each cell.
+ *
+ * \param[in]       mesh            pointer to a mesh structure
+ * \param[in]       mq              associated mesh quantities
+ * \param[in, out]  cell_cells_tag  tag adjacencies to retain
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_neighborhood_prune(const cs_mesh_t             *mesh,
+                    const cs_mesh_quantities_t  *mq,
+                    char                         cell_cells_tag[])
+{
+  const cs_lnum_t  *cell_cells_lst = mesh->cell_cells_lst;
+  const cs_lnum_t  *cell_cells_idx = mesh->cell_cells_idx;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+
+  const cs_lnum_2_t  *i_face_cells = (const cs_lnum_2_t *)mesh->i_face_cells;
+  const cs_real_3_t  *cell_cen = (const cs_real_3_t *)mq->cell_cen;
+
+  const cs_lnum_t n_max = _n_max_ext_neighbors;
+  const cs_real_t r2_max = (_max_distance_ratio > 0) ?
+    _max_distance_ratio*_max_distance_ratio : -1;
+
+  /* Reference (squared) distance: largest distance to a face neighbor */
+
+  cs_real_t *d2_ref = NULL;
+
+  if (r2_max > 0) {
+
+    BFT_MALLOC(d2_ref, mesh->n_cells_with_ghosts, cs_real_t);
+    for (cs_lnum_t i = 0; i < mesh->n_cells_with_ghosts; i++)
+      d2_ref[i] = 0;
+
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+      cs_lnum_t c_id_0 = i_face_cells[f_id][0];
+      cs_lnum_t c_id_1 = i_face_cells[f_id][1];
+      cs_real_t d2 = cs_math_3_square_distance(cell_cen[c_id_0],
+                                               cell_cen[c_id_1]);
+      if (d2 > d2_ref[c_id_0])
+        d2_ref[c_id_0] = d2;
+      if (d2 > d2_ref[c_id_1])
+        d2_ref[c_id_1] = d2;
+    }
+
+  }
+
+# pragma omp parallel if (n_cells > CS_THR_MIN)
+  {
+    cs_lnum_t t_s_id, t_e_id;
+    _thread_range(n_cells, &t_s_id, &t_e_id);
+
+    cs_lnum_t  n_max_c = 0;
+    cs_lnum_t  *c_ids = NULL;
+    cs_real_t  *c_d2 = NULL;
+
+    /* Loop on cells */
+
+    for (cs_lnum_t c_id = t_s_id; c_id < t_e_id; c_id++) {
+
+      cs_lnum_t c_s_id = cell_cells_idx[c_id];
+      cs_lnum_t c_e_id = cell_cells_idx[c_id+1];
+      cs_lnum_t n_c = c_e_id - c_s_id;
+
+      if (n_c > n_max_c) {
+        n_max_c = n_c*2;
+        BFT_REALLOC(c_ids, n_max_c, cs_lnum_t);
+        BFT_REALLOC(c_d2, n_max_c, cs_real_t);
+      }
+
+      /* Distance filter; build list of remaining candidates */
+
+      cs_lnum_t n_r = 0;
+
+      for (cs_lnum_t i = c_s_id; i < c_e_id; i++) {
+
+        if (cell_cells_tag[i] == 0)
+          continue;
+
+        cs_real_t d2 = cs_math_3_square_distance(cell_cen[c_id],
+                                                 cell_cen[cell_cells_lst[i]]);
+
+        if (r2_max > 0 && d2 > r2_max*d2_ref[c_id]) {
+          cell_cells_tag[i] = 0;
+          continue;
+        }
+
+        c_ids[n_r] = i;
+        c_d2[n_r] = d2;
+        n_r++;
+
+      }
+
+      /* Keep only the n_max nearest (partial selection sort) */
+
+      if (n_max < 1 || n_r <= n_max)
+        continue;
+
+      for (cs_lnum_t j = 0; j < n_max; j++) {
+        cs_lnum_t k_min = j;
+        for (cs_lnum_t k = j+1; k < n_r; k++) {
+          if (c_d2[k] < c_d2[k_min])
+            k_min = k;
+        }
+        if (k_min != j) {
+          cs_real_t t_d2 = c_d2[j]; c_d2[j] = c_d2[k_min]; c_d2[k_min] = t_d2;
+          cs_lnum_t t_id = c_ids[j]; c_ids[j] = c_ids[k_min]; c_ids[k_min] = t_id;
+        }
+      }
+
+      for (cs_lnum_t j = n_max; j < n_r; j++)
+        cell_cells_tag[c_ids[j]] = 0;
+
+    } /* End of loop on cells */
+
+    BFT_FREE(c_ids);
+    BFT_FREE(c_d2);
+
+  } /* End of Open MP block */
+
+  BFT_FREE(d2_ref);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1642,7 +1837,8 @@ cs_ext_neighborhood_reduce(cs_mesh_t             *mesh,
 
   if (   mesh->cell_cells_idx == NULL
       || (mesh->halo_type == CS_HALO_STANDARD && _full_nb_boundary == false)
-      || _ext_nbh_type == CS_EXT_NEIGHBORHOOD_COMPLETE)
+      || (   _ext_nbh_type == CS_EXT_NEIGHBORHOOD_COMPLETE
+          && _n_max_ext_neighbors < 1 && _max_distance_ratio <= 0))
     return;
 
   cs_lnum_t  i, cell_id;
@@ -1674,10 +1870,17 @@ cs_ext_neighborhood_reduce(cs_mesh_t             *mesh,
                                               mesh_quantities,
                                               cell_cells_tag);
     break;
+  case CS_EXT_NEIGHBORHOOD_COMPLETE:
+    for (i = 0; i < mesh->cell_cells_idx[n_cells]; i++)
+      cell_cells_tag[i] = 1;
+    break;
   default:
     break;
   }
 
+  if (_n_max_ext_neighbors > 0 || _max_distance_ratio > 0)
+    _neighborhood_prune(mesh, mesh_quantities, cell_cells_tag);
+
   if (_full_nb_boundary)
     _neighborhood_reduce_full_boundary(mesh, cell_cells_tag);
 
@@ -1749,6 +1952,13 @@ cs_ext_neighborhood_reduce(cs_mesh_t             *mesh,
        (unsigned long long)(init_cell_cells_connect_size - n_deleted_cells),
        ratio);
 
+    if (_n_max_ext_neighbors > 0)
+      bft_printf(_(" Maximum extended neighbors per cell:     %12d\n"),
+                 (int)_n_max_ext_neighbors);
+    if (_max_distance_ratio > 0)
+      bft_printf(_(" Maximum extended neighbor distance ratio: %11.3g\n"),
+                 _max_distance_ratio);
+
   }
 
 #if 0 /* For debugging purposes */
@@ -123,6 +123,53 @@ cs_ext_neighborhood_get_non_ortho_max(void);
 void
 cs_ext_neighborhood_set_non_ortho_max(cs_real_t  non_ortho_max);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get the maximum number of retained extended neighbors per cell.
+ *
+ * \return  maximum number of extended neighbors (0 if unlimited)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_ext_neighborhood_get_max_neighbors(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum number of retained extended neighbors per cell.
+ *
+ * \param[in]  n_max  maximum number of extended neighbors (0 if unlimited)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_ext_neighborhood_set_max_neighbors(cs_lnum_t  n_max);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get the maximum distance ratio for extended neighbors.
+ *
+ * \return  maximum distance ratio (< 0 if unlimited)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_real_t
+cs_ext_neighborhood_get_max_distance_ratio(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum distance ratio for extended neighbors.
+ *
+ * Extended neighbors whose center is farther than this ratio times the
+ * largest center distance to a face neighbor are discarded.
+ *
+ * \param[in]  ratio  maximum distance ratio (< 0 if unlimited)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_ext_neighborhood_set_max_distance_ratio(cs_real_t  ratio);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Reduce the "cell -> cells" connectivity for the
@@ -49,7 +49,10 @@
 #include "cs_log.h"
 #include "cs_map.h"
 #include "cs_parall.h"
+#include "cs_mesh.h"
 #include "cs_mesh_location.h"
+#include "cs_numbering.h"
+#include "cs_field_operator.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -218,6 +221,20 @@ static int _k_label = -1;
 
 static cs_field_key_val_t  *_key_vals = NULL;
 
+/* Generation of field and key ids (incremented when ids are invalidated) */
+
+static int  _id_generation = 0;
+
+/* Counters for lookups by name (per field or key id, and unmatched) */
+
+static unsigned long long  *_field_name_lookups = NULL;
+static unsigned long long  *_key_name_lookups = NULL;
+static unsigned long long   _n_unmatched_lookups = 0;
+
+/* Host/device allocation mode for field values */
+
+static bft_mem_mode_t  _alloc_mode = BFT_MEM_HOST;
+
 /* Names for logging */
 
 static const int _n_type_flags = 8;
@@ -399,7 +416,10 @@ _field_create(const char   *name,
   size_t l = strlen(name);
   const char *addr_0 = NULL, *addr_1 = NULL;
 
-  cs_field_t *f = cs_field_by_name_try(name);
+  cs_field_t *f = NULL;
+  field_id = cs_map_name_to_id_try(_field_map, name);
+  if (field_id > -1)
+    f = _fields[field_id];
 
   /* Check this name was not already used */
 
@@ -462,8 +482,11 @@ _field_create(const char   *name,
       _n_fields_max *= 2;
     BFT_REALLOC(_fields, _n_fields_max, cs_field_t *);
     BFT_REALLOC(_key_vals, _n_keys_max*_n_fields_max, cs_field_key_val_t);
+    BFT_REALLOC(_field_name_lookups, _n_fields_max, unsigned long long);
   }
 
+  _field_name_lookups[field_id] = 0;
+
   /* Allocate fields descriptor block if necessary
      (to reduce fragmentation and improve locality of field
      descriptors, they are allocated in blocks) */
@@ -522,36 +545,93 @@ _field_create(const char   *name,
   return f;
 }
 
+/*----------------------------------------------------------------------------
+ * Return the numbering associated with a mesh location, if available.
+ *
+ * Numberings are only associated with locations covering all elements
+ * of a given type, so as to share the thread ranges of the main
+ * computational loops.
+ *
+ * parameters:
+ *   location_id <-- associated mesh location id
+ *
+ * returns  pointer to associated numbering, or NULL.
+ *----------------------------------------------------------------------------*/
+
+static const cs_numbering_t *
+_location_numbering(int  location_id)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  if (m == NULL)
+    return NULL;
+
+  const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(location_id)[0];
+
+  const cs_numbering_t *numbering = NULL;
+
+  switch(cs_mesh_location_get_type(location_id)) {
+  case CS_MESH_LOCATION_CELLS:
+    if (n_elts == m->n_cells)
+      numbering = m->cell_numbering;
+    break;
+  case CS_MESH_LOCATION_INTERIOR_FACES:
+    if (n_elts == m->n_i_faces)
+      numbering = m->i_face_numbering;
+    break;
+  case CS_MESH_LOCATION_BOUNDARY_FACES:
+    if (n_elts == m->n_b_faces)
+      numbering = m->b_face_numbering;
+    break;
+  case CS_MESH_LOCATION_VERTICES:
+    if (n_elts == m->n_vertices)
+      numbering = m->vtx_numbering;
+    break;
+  default:
+    break;
+  }
+
+  return numbering;
+}
+
 /*----------------------------------------------------------------------------*
  * allocate and initialize a field values array.
  *
  * parameters:
- *   n_elts  <-- number of associated elements
- *   dim     <-- associated dimension
- *   val_old <-- pointer to previous array in case of reallocation
- *               (usually NULL)
+ *   location_id <-- associated mesh location id
+ *   dim         <-- associated dimension
+ *   val_old     <-- pointer to previous array in case of reallocation
+ *                   (usually NULL)
  *
  * returns  pointer to new field values.
  *----------------------------------------------------------------------------*/
 
 static cs_real_t *
-_add_val(cs_lnum_t   n_elts,
-         int         dim,
-         cs_real_t  *val_old)
+_add_val(int          location_id,
+         int          dim,
+         cs_real_t   *val_old)
 {
   cs_real_t  *val = val_old;
 
-  BFT_REALLOC(val, n_elts*dim, cs_real_t);
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(location_id);
+
+  if (val == NULL)
+    BFT_MALLOC_HD(val, n_elts[2]*dim, cs_real_t, _alloc_mode);
+  else
+    BFT_REALLOC(val, n_elts[2]*dim, cs_real_t);
 
   /* Initialize field. This should not be necessary, but when using
      threads with Open MP, this should help ensure that the memory will
      first be touched by the same core that will later operate on
-     this memory, usually leading to better core/memory affinity. */
+     this memory, usually leading to better core/memory affinity.
+     When available, the thread ranges of the location's numbering
+     are used, so as to match those of the computational loops. */
 
-  const cs_lnum_t _n_elts = dim * n_elts;
-# pragma omp parallel for if (_n_elts > CS_THR_MIN)
-  for (cs_lnum_t ii = 0; ii < _n_elts; ii++)
-    val[ii] = 0.0;
+  cs_numbering_first_touch(_location_numbering(location_id),
+                           n_elts[2],
+                           dim*sizeof(cs_real_t),
+                           NULL,
+                           val);
 
   return val;
 }
@@ -594,6 +674,9 @@ _find_or_add_key(const char  *name)
       _n_keys_max *= 2;
     BFT_REALLOC(_key_defs, _n_keys_max, cs_field_key_def_t);
     BFT_REALLOC(_key_vals, _n_keys_max*_n_fields_max, cs_field_key_val_t);
+    BFT_REALLOC(_key_name_lookups, _n_keys_max, unsigned long long);
+    for (_key_id = _n_keys_max_prev; _key_id < _n_keys_max; _key_id++)
+      _key_name_lookups[_key_id] = 0;
     for (field_id = _n_fields - 1; field_id >= 0; field_id--) {
       for (_key_id = _n_keys - 2; _key_id >= 0; _key_id--)
         _key_vals[field_id*_n_keys_max + _key_id]
@@ -611,6 +694,80 @@ _find_or_add_key(const char  *name)
   return key_id;
 }
 
+/*----------------------------------------------------------------------------
+ * Count a lookup by name.
+ *
+ * parameters:
+ *   counts <-> lookup counts per id
+ *   id     <-- id matching name, or -1
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_count_name_lookup(unsigned long long  counts[],
+                   int                 id)
+{
+  if (id > -1) {
+#   pragma omp atomic
+    counts[id] += 1;
+  }
+  else {
+#   pragma omp atomic
+    _n_unmatched_lookups += 1;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Log the most looked-up names for a given map.
+ *
+ * parameters:
+ *   m       <-- associated name to id map
+ *   n_ids   <-- number of ids in map
+ *   counts  <-- lookup counts per id
+ *   title   <-- title for log
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_name_lookups(const cs_map_name_to_id_t  *m,
+                  int                         n_ids,
+                  const unsigned long long    counts[],
+                  const char                 *title)
+{
+  const int n_max_log = 10;
+
+  unsigned long long n_tot = 0;
+  for (int i = 0; i < n_ids; i++)
+    n_tot += counts[i];
+
+  if (n_tot == 0)
+    return;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n  %s lookups by name: %llu\n"), title, n_tot);
+
+  /* Log highest counts first (small selection loop, as only a few
+     entries are logged) */
+
+  unsigned long long c_prev = ~0ULL;
+  int i_prev = -1;
+
+  for (int l = 0; l < n_max_log; l++) {
+    int i_max = -1;
+    for (int i = 0; i < n_ids; i++) {
+      if (   counts[i] > 0
+          && (counts[i] < c_prev || (counts[i] == c_prev && i > i_prev))
+          && (i_max < 0 || counts[i] > counts[i_max]))
+        i_max = i;
+    }
+    if (i_max < 0)
+      break;
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "    %-32s %12llu\n",
+                  cs_map_name_to_id_reverse(m, i_max), counts[i_max]);
+    c_prev = counts[i_max];
+    i_prev = i_max;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Add type flag info to the current position in the setup log.
  *
@@ -1694,13 +1851,31 @@ cs_field_set_n_time_vals(cs_field_t  *f,
     }
     else { /* if (n_time_vals_ini < _n_time_vals) */
       if (f->is_owner) {
-        const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
-        f->val_pre = _add_val(n_elts[2], f->dim, f->val_pre);
+        f->val_pre = _add_val(f->location_id, f->dim, f->val_pre);
       }
     }
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the host/device allocation mode for field values.
+ *
+ * This applies to values allocated afterwards. With unified memory
+ * (BFT_MEM_HOST_DEVICE), values may migrate to the device on demand
+ * (see \ref bft_mem_prefetch). If no device is available, standard host
+ * memory is used.
+ *
+ * \param[in]  mode  allocation mode
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_set_alloc_mode(bft_mem_mode_t  mode)
+{
+  _alloc_mode = mode;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Allocate arrays for field values.
@@ -1716,17 +1891,20 @@ cs_field_allocate_values(cs_field_t  *f)
 
   if (f->is_owner) {
 
-    const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
     int ii;
 
+    bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_FIELDS);
+
     /* Initialization */
 
     for (ii = 0; ii < f->n_time_vals; ii++)
-      f->vals[ii] = _add_val(n_elts[2], f->dim, f->vals[ii]);
+      f->vals[ii] = _add_val(f->location_id, f->dim, f->vals[ii]);
 
     f->val = f->vals[0];
     if (f->n_time_vals > 1)
       f->val_pre = f->vals[1];
+
+    bft_mem_tag_end(mem_tag);
   }
 }
 
@@ -1809,6 +1987,8 @@ cs_field_allocate_bc_coeffs(cs_field_t  *f,
   cs_base_check_bool(&have_mom_bc);
   cs_base_check_bool(&have_conv_bc);
 
+  bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_FIELDS);
+
   if (f->type & CS_FIELD_VARIABLE) {
     int coupled = 0;
     int coupled_key_id = cs_field_key_id_try("coupled");
@@ -1920,6 +2100,8 @@ cs_field_allocate_bc_coeffs(cs_field_t  *f,
               _("Field \"%s\"\n"
                 " has location %d, which does not support BC coefficients."),
               f->name, f->location_id);
+
+  bft_mem_tag_end(mem_tag);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2160,6 +2342,8 @@ cs_field_set_values(cs_field_t  *f,
  * For fields with only one time value, or values not allocated yet,
  * this is a no-op.
  *
+ * Cached gradients of the field are invalidated.
+ *
  * \param[in, out]  f  pointer to field structure
  */
 /*----------------------------------------------------------------------------*/
@@ -2169,6 +2353,8 @@ cs_field_current_to_previous(cs_field_t  *f)
 {
   assert(f != NULL);
 
+  cs_field_gradient_cache_invalidate(f);
+
   if (f->n_time_vals > 1) {
 
     const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
@@ -2227,6 +2413,8 @@ cs_field_destroy_all(void)
 {
   int i;
 
+  cs_field_gradient_cache_finalize();
+
   for (i = 0; i < _n_fields; i++) {
     cs_field_t  *f = _fields[i];
     if (f->is_owner && f->vals != NULL) {
@@ -2263,9 +2451,12 @@ cs_field_destroy_all(void)
   _cs_field_free_struct();
 
   BFT_FREE(_key_vals);
+  BFT_FREE(_field_name_lookups);
 
   _n_fields = 0;
   _n_fields_max = 0;
+
+  _id_generation += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2338,6 +2529,7 @@ cs_field_t  *
 cs_field_by_name(const char  *name)
 {
   int id = cs_map_name_to_id_try(_field_map, name);
+  _count_name_lookup(_field_name_lookups, id);
 
   if (id > -1)
     return _fields[id];
@@ -2364,6 +2556,7 @@ cs_field_t  *
 cs_field_by_name_try(const char  *name)
 {
   int id = cs_map_name_to_id_try(_field_map, name);
+  _count_name_lookup(_field_name_lookups, id);
 
   if (id > -1)
     return _fields[id];
@@ -2387,10 +2580,41 @@ int
 cs_field_id_by_name(const char *name)
 {
   int id = cs_map_name_to_id_try(_field_map, name);
+  _count_name_lookup(_field_name_lookups, id);
 
   return id;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return a pointer to a field based on a name handle.
+ *
+ * The field id associated with the handle's name is looked up on first use
+ * and cached in the handle, so that later calls do not require a name
+ * lookup, until fields are destroyed. Handles are intended to be defined
+ * as static variables at frequently called sites, using
+ * \ref CS_FIELD_HANDLE_INIT. The first call for a given handle should not
+ * be done concurrently by several threads.
+ *
+ * This function requires that a field of the given name is defined.
+ *
+ * \param[in, out]  h  pointer to field name handle
+ *
+ * \return  pointer to the field structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_field_t  *
+cs_field_by_handle(cs_field_handle_t  *h)
+{
+  if (h->generation != _id_generation || h->id < 0) {
+    h->id = cs_field_by_name(h->name)->id;
+    h->generation = _id_generation;
+  }
+
+  return _fields[h->id];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return the id of a defined field and an associated component
@@ -2501,6 +2725,8 @@ cs_field_key_id(const char  *name)
   if (_key_map != NULL)
     id = cs_map_name_to_id_try(_key_map, name);
 
+  _count_name_lookup(_key_name_lookups, id);
+
   if (id < 0)
     bft_error(__FILE__, __LINE__, 0,
               _("Field \"%s\" is not defined."), name);
@@ -2528,9 +2754,38 @@ cs_field_key_id_try(const char  *name)
   if (_key_map != NULL)
     id = cs_map_name_to_id_try(_key_map, name);
 
+  _count_name_lookup(_key_name_lookups, id);
+
   return id;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return an id associated with a key name handle.
+ *
+ * The key id associated with the handle's name is looked up on first use
+ * and cached in the handle, so that later calls do not require a name
+ * lookup, until keys are destroyed (see \ref cs_field_by_handle).
+ *
+ * The key must have been defined previously.
+ *
+ * \param[in, out]  h  pointer to key name handle
+ *
+ * \return  id associated with key
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_field_key_id_by_handle(cs_field_handle_t  *h)
+{
+  if (h->generation != _id_generation || h->id < 0) {
+    h->id = cs_field_key_id(h->name);
+    h->generation = _id_generation;
+  }
+
+  return h->id;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define a key for an integer value by its name and return an
@@ -2771,6 +3026,9 @@ cs_field_destroy_all_keys(void)
   cs_map_name_to_id_destroy(&_key_map);
 
   BFT_FREE(_key_vals);
+  BFT_FREE(_key_name_lookups);
+
+  _id_generation += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4244,6 +4502,44 @@ cs_field_log_all_key_vals(bool  log_defaults)
     cs_field_log_key_vals(i, log_defaults);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Print statistics on field and key lookups by name to the
+ *        performance log.
+ *
+ * Lookups through \ref cs_field_by_name, \ref cs_field_by_name_try,
+ * \ref cs_field_id_by_name, \ref cs_field_key_id and
+ * \ref cs_field_key_id_try (including those from Fortran) are counted,
+ * so that names looked up most often (which may be replaced by handles)
+ * may be identified. Counts are those of the local rank.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_log_lookup_stats(void)
+{
+  if (_field_name_lookups == NULL && _key_name_lookups == NULL)
+    return;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Field and key lookups by name:\n"
+                  "-----------------------------\n"));
+
+  if (_field_name_lookups != NULL)
+    _log_name_lookups(_field_map, _n_fields, _field_name_lookups,
+                      _("Field"));
+  if (_key_name_lookups != NULL)
+    _log_name_lookups(_key_map, _n_keys, _key_name_lookups,
+                      _("Key"));
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n  Lookups of undefined names: %llu\n"),
+                _n_unmatched_lookups);
+
+  cs_log_printf_flush(CS_LOG_PERFORMANCE);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define base keys.
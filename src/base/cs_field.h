@@ -33,6 +33,8 @@
 
 #include "cs_defs.h"
 
+#include "bft_mem.h"
+
 /*----------------------------------------------------------------------------*/
 
 BEGIN_C_DECLS
@@ -79,6 +81,9 @@ BEGIN_C_DECLS
 
 /*! @} */
 
+/*! Static initializer for a field or key name handle */
+#define CS_FIELD_HANDLE_INIT(name) {name, -1, -1}
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -157,6 +162,19 @@ typedef struct {
 
 } cs_field_t;
 
+/* Field or key name handle */
+/*---------------------------*/
+
+typedef struct {
+
+  const char             *name;         /* Field or key name */
+
+  int                     id;           /* Cached id, or -1 */
+  int                     generation;   /* Id generation at which the id
+                                           was cached */
+
+} cs_field_handle_t;
+
 /*----------------------------------------------------------------------------
  * Function pointer for structure associated to field key
  *
@@ -264,6 +282,21 @@ void
 cs_field_set_n_time_vals(cs_field_t  *f,
                          int          n_time_vals);
 
+/*----------------------------------------------------------------------------
+ * Set the host/device allocation mode for field values.
+ *
+ * This applies to values allocated afterwards. With unified memory
+ * (BFT_MEM_HOST_DEVICE), values may migrate to the device on demand
+ * (see bft_mem_prefetch). If no device is available, standard host
+ * memory is used.
+ *
+ * parameters:
+ *   mode <-- allocation mode
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_set_alloc_mode(bft_mem_mode_t  mode);
+
 /*----------------------------------------------------------------------------
  * Allocate arrays for field values.
  *
@@ -357,6 +390,8 @@ cs_field_set_values(cs_field_t  *f,
  * For fields with only one time value, or values not allocated yet,
  * this is a no-op.
  *
+ * Cached gradients of the field are invalidated.
+ *
  * parameters:
  *   f <-> pointer to field structure
  *----------------------------------------------------------------------------*/
@@ -443,6 +478,24 @@ cs_field_by_name_try(const char *name);
 int
 cs_field_id_by_name(const char *name);
 
+/*----------------------------------------------------------------------------
+ * Return a pointer to a field based on a name handle.
+ *
+ * The field id associated with the handle's name is looked up on first use
+ * and cached in the handle, until fields are destroyed.
+ *
+ * This function requires that a field of the given name is defined.
+ *
+ * parameters:
+ *   h <-> pointer to field name handle
+ *
+ * returns:
+ *   pointer to the field structure
+ *----------------------------------------------------------------------------*/
+
+cs_field_t  *
+cs_field_by_handle(cs_field_handle_t  *h);
+
 /*----------------------------------------------------------------------------
  * Return the id of a defined field and an associated component
  * based on a component name.
@@ -490,6 +543,24 @@ cs_field_key_id(const char  *name);
 int
 cs_field_key_id_try(const char  *name);
 
+/*----------------------------------------------------------------------------
+ * Return an id associated with a key name handle.
+ *
+ * The key id associated with the handle's name is looked up on first use
+ * and cached in the handle, until keys are destroyed.
+ *
+ * The key must have been defined previously.
+ *
+ * parameters:
+ *   h <-> pointer to key name handle
+ *
+ * returns:
+ *   id associated with key
+ *----------------------------------------------------------------------------*/
+
+int
+cs_field_key_id_by_handle(cs_field_handle_t  *h);
+
 /*----------------------------------------------------------------------------
  * Define a key for an integer value by its name and return an associated id.
  *
@@ -1012,6 +1083,13 @@ cs_field_log_key_vals(int   key_id,
 void
 cs_field_log_all_key_vals(bool  log_defaults);
 
+/*----------------------------------------------------------------------------
+ * Print statistics on field and key lookups by name to the performance log.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_log_lookup_stats(void);
+
 /*----------------------------------------------------------------------------
  * Define base keys.
  *
@@ -57,6 +57,7 @@
 #include "cs_map.h"
 #include "cs_parameters.h"
 #include "cs_parall.h"
+#include "cs_time_step.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_location.h"
@@ -97,14 +98,67 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Number of cached gradients per field */
+
+#define _GRADIENT_CACHE_N_ENTRIES  2
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
 
+/* Gradient cache key: a cached gradient may be reused only if all
+   options and inputs match (compared bitwise, so the structure is
+   always zeroed before being set) */
+
+typedef struct {
+
+  const cs_real_t  *var;            /* values (current or previous) */
+  const cs_real_t  *bc_coeff_a;     /* explicit boundary coefficients */
+  const cs_real_t  *bc_coeff_b;     /* implicit boundary coefficients */
+  const cs_real_t  *c_weight;       /* gradient weighting, or NULL */
+  const void       *cpl;            /* internal coupling, or NULL */
+
+  int               grad_dim;       /* number of gradient values per cell */
+  int               inc;            /* 0 for increment, 1 otherwise */
+  int               gradient_type;  /* gradient type */
+  int               halo_type;      /* halo type */
+  int               nswrgr;         /* number of sweeps */
+  int               imligr;         /* limiter type */
+  int               w_stride;       /* weighting stride */
+  int               nt_cur;         /* time step number */
+  cs_real_t         epsrgr;         /* reconstruction precision */
+  cs_real_t         climgr;         /* limiter factor */
+
+  uint64_t          checksum;       /* checksum of values, boundary
+                                       coefficients and weights */
+
+} _gradient_cache_key_t;
+
+/* Gradient cache entry */
+
+typedef struct {
+
+  _gradient_cache_key_t   key;      /* associated key */
+  bool                    valid;    /* true if gradient may be reused */
+  unsigned long long      stamp;    /* stamp of last use */
+  cs_lnum_t               n_vals;   /* allocated size of grad */
+  cs_real_t              *grad;     /* cached gradient values */
+
+} _gradient_cache_entry_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
 
+/* Gradient cache entries, by field id */
+
+static int                       _n_gradient_cache_fields = 0;
+static _gradient_cache_entry_t  *_gradient_cache = NULL;
+
+static unsigned long long        _gradient_cache_stamp = 0;
+static unsigned long long        _gradient_cache_n_queries = 0;
+static unsigned long long        _gradient_cache_n_hits = 0;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -357,6 +411,230 @@ _local_extrema_scalar(const cs_real_t *restrict pvar,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute a checksum of an array of real values.
+ *
+ * The checksum is a sum of hashed (index, value) pairs, so it may be
+ * computed in any order.
+ *
+ * parameters:
+ *   n     <-- number of values
+ *   v     <-- array of values, or NULL
+ *   seed  <-- seed specific to the array's role
+ *
+ * returns:
+ *   checksum
+ *----------------------------------------------------------------------------*/
+
+static uint64_t
+_gradient_cache_checksum(cs_lnum_t         n,
+                         const cs_real_t  *v,
+                         uint64_t          seed)
+{
+  uint64_t h = seed;
+
+  if (v == NULL)
+    return h;
+
+# pragma omp parallel for reduction(+:h) if (n > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n; i++) {
+    uint64_t w = 0;
+    memcpy(&w, v + i, CS_MIN(sizeof(cs_real_t), sizeof(uint64_t)));
+    w ^= seed + (uint64_t)i * 0x9e3779b97f4a7c15ULL;
+    w = (w ^ (w >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    w = (w ^ (w >> 27)) * 0x94d049bb133111ebULL;
+    h += w ^ (w >> 31);
+  }
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Query the gradient cache of a field.
+ *
+ * If the field's "gradient_cache" key is not set, or caching is not
+ * possible for the given options (indicated by a zero grad_dim), the
+ * returned key has a zero grad_dim, and nothing will be stored.
+ *
+ * Hits are determined collectively, so that either all ranks or none
+ * skip the gradient computation (which requires communication).
+ *
+ * parameters:
+ *   f              <-- pointer to field
+ *   grad_dim       <-- number of gradient values per cell
+ *   var            <-- values used for the gradient
+ *   bc_coeff_a     <-- explicit boundary coefficients, or NULL
+ *   bc_coeff_b     <-- implicit boundary coefficients, or NULL
+ *   bc_b_dim       <-- number of implicit coefficients per face
+ *   c_weight       <-- gradient weighting, or NULL
+ *   w_stride       <-- weighting stride
+ *   cpl            <-- internal coupling, or NULL
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   gradient_type  <-- gradient type
+ *   halo_type      <-- halo type
+ *   eqp            <-- equation parameters
+ *   key            --> associated cache key
+ *   grad           --> gradient, if found
+ *
+ * returns:
+ *   true if the cached gradient was copied to grad, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_gradient_cache_query(const cs_field_t            *f,
+                      int                          grad_dim,
+                      const cs_real_t             *var,
+                      const cs_real_t             *bc_coeff_a,
+                      const cs_real_t             *bc_coeff_b,
+                      int                          bc_b_dim,
+                      const cs_real_t             *c_weight,
+                      int                          w_stride,
+                      const void                  *cpl,
+                      int                          inc,
+                      cs_gradient_type_t           gradient_type,
+                      cs_halo_type_t               halo_type,
+                      const cs_equation_param_t   *eqp,
+                      _gradient_cache_key_t       *key,
+                      cs_real_t                   *grad)
+{
+  memset(key, 0, sizeof(_gradient_cache_key_t));
+
+  if (grad_dim < 1)
+    return false;
+
+  const int k_id = cs_field_key_id_try("gradient_cache");
+  if (k_id < 0 || f->location_id != CS_MESH_LOCATION_CELLS)
+    return false;
+  if (cs_field_get_key_int(f, k_id) < 1)
+    return false;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  key->var = var;
+  key->bc_coeff_a = bc_coeff_a;
+  key->bc_coeff_b = bc_coeff_b;
+  key->c_weight = c_weight;
+  key->cpl = cpl;
+
+  key->grad_dim = grad_dim;
+  key->inc = inc;
+  key->gradient_type = gradient_type;
+  key->halo_type = halo_type;
+  key->nswrgr = eqp->nswrgr;
+  key->imligr = eqp->imligr;
+  key->w_stride = (c_weight != NULL) ? w_stride : 0;
+  key->nt_cur = cs_glob_time_step->nt_cur;
+  key->epsrgr = eqp->epsrgr;
+  key->climgr = eqp->climgr;
+
+  key->checksum
+    =   _gradient_cache_checksum(n_cells*f->dim, var, 1)
+      + _gradient_cache_checksum(n_b_faces*f->dim, bc_coeff_a, 2)
+      + _gradient_cache_checksum(n_b_faces*bc_b_dim, bc_coeff_b, 3)
+      + _gradient_cache_checksum(n_cells*key->w_stride, c_weight, 4);
+
+  _gradient_cache_n_queries += 1;
+
+  /* Local search */
+
+  _gradient_cache_entry_t *ce = NULL;
+
+  if (f->id < _n_gradient_cache_fields) {
+    for (int i = 0; i < _GRADIENT_CACHE_N_ENTRIES; i++) {
+      _gradient_cache_entry_t *_ce
+        = _gradient_cache + f->id*_GRADIENT_CACHE_N_ENTRIES + i;
+      if (   _ce->valid
+          && memcmp(&(_ce->key), key, sizeof(_gradient_cache_key_t)) == 0)
+        ce = _ce;
+    }
+  }
+
+  /* Global agreement */
+
+  int hit = (ce != NULL) ? 1 : 0;
+  cs_parall_min(1, CS_INT_TYPE, &hit);
+
+  if (hit < 1)
+    return false;
+
+  memcpy(grad, ce->grad, ce->n_vals*sizeof(cs_real_t));
+
+  _gradient_cache_stamp += 1;
+  ce->stamp = _gradient_cache_stamp;
+  _gradient_cache_n_hits += 1;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Store a gradient in the gradient cache of a field.
+ *
+ * The least recently used entry of the field is replaced (invalid
+ * entries having a zero stamp).
+ *
+ * parameters:
+ *   f     <-- pointer to field
+ *   key   <-- associated cache key
+ *   grad  <-- computed gradient
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_cache_store(const cs_field_t             *f,
+                      const _gradient_cache_key_t  *key,
+                      const cs_real_t              *grad)
+{
+  if (key->grad_dim < 1)
+    return;
+
+  /* Resize cache if needed */
+
+  if (f->id >= _n_gradient_cache_fields) {
+    int n_fields = cs_field_n_fields();
+    BFT_REALLOC(_gradient_cache,
+                n_fields*_GRADIENT_CACHE_N_ENTRIES,
+                _gradient_cache_entry_t);
+    for (int i = _n_gradient_cache_fields*_GRADIENT_CACHE_N_ENTRIES;
+         i < n_fields*_GRADIENT_CACHE_N_ENTRIES;
+         i++) {
+      _gradient_cache_entry_t *ce = _gradient_cache + i;
+      memset(&(ce->key), 0, sizeof(_gradient_cache_key_t));
+      ce->valid = false;
+      ce->stamp = 0;
+      ce->n_vals = 0;
+      ce->grad = NULL;
+    }
+    _n_gradient_cache_fields = n_fields;
+  }
+
+  /* Replace least recently used entry */
+
+  _gradient_cache_entry_t *ce
+    = _gradient_cache + f->id*_GRADIENT_CACHE_N_ENTRIES;
+
+  for (int i = 1; i < _GRADIENT_CACHE_N_ENTRIES; i++) {
+    _gradient_cache_entry_t *_ce
+      = _gradient_cache + f->id*_GRADIENT_CACHE_N_ENTRIES + i;
+    if (_ce->stamp < ce->stamp)
+      ce = _ce;
+  }
+
+  const cs_lnum_t n_vals = cs_glob_mesh->n_cells_with_ghosts * key->grad_dim;
+
+  if (ce->n_vals != n_vals) {
+    BFT_REALLOC(ce->grad, n_vals, cs_real_t);
+    ce->n_vals = n_vals;
+  }
+
+  memcpy(&(ce->key), key, sizeof(_gradient_cache_key_t));
+  memcpy(ce->grad, grad, n_vals*sizeof(cs_real_t));
+
+  _gradient_cache_stamp += 1;
+  ce->stamp = _gradient_cache_stamp;
+  ce->valid = true;
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -622,6 +900,27 @@ cs_field_gradient_scalar(const cs_field_t          *f,
     bc_coeff_b = f->bc_coeffs->b;
   }
 
+  /* Reuse cached gradient if possible */
+
+  _gradient_cache_key_t ck;
+
+  if (_gradient_cache_query(f,
+                            (tr_dim == 0) ? 3 : 0,
+                            var,
+                            bc_coeff_a,
+                            bc_coeff_b,
+                            1,
+                            c_weight,
+                            w_stride,
+                            cpl,
+                            inc,
+                            gradient_type,
+                            halo_type,
+                            eqp,
+                            &ck,
+                            (cs_real_t *)grad))
+    return;
+
   cs_gradient_scalar(f->name,
                      gradient_type,
                      halo_type,
@@ -642,6 +941,8 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                      c_weight,
                      cpl, /* internal coupling */
                      grad);
+
+  _gradient_cache_store(f, &ck, (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -739,6 +1040,28 @@ cs_field_gradient_potential(const cs_field_t          *f,
     bc_coeff_b = f->bc_coeffs->b;
   }
 
+  /* Reuse cached gradient if possible
+     (not with hydrostatic pressure, as f_ext is not checked) */
+
+  _gradient_cache_key_t ck;
+
+  if (_gradient_cache_query(f,
+                            (hyd_p_flag == 0 && f_ext == NULL) ? 3 : 0,
+                            var,
+                            bc_coeff_a,
+                            bc_coeff_b,
+                            1,
+                            c_weight,
+                            w_stride,
+                            cpl,
+                            inc,
+                            gradient_type,
+                            halo_type,
+                            eqp,
+                            &ck,
+                            (cs_real_t *)grad))
+    return;
+
   cs_gradient_scalar(f->name,
                      gradient_type,
                      halo_type,
@@ -759,6 +1082,8 @@ cs_field_gradient_potential(const cs_field_t          *f,
                      c_weight,
                      cpl, /* internal coupling */
                      grad);
+
+  _gradient_cache_store(f, &ck, (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -797,6 +1122,7 @@ cs_field_gradient_vector(const cs_field_t          *f,
                              &gradient_type,
                              &halo_type);
 
+  int w_stride = 1;
   cs_real_t *c_weight = NULL;
   cs_internal_coupling_t  *cpl = NULL;
 
@@ -809,6 +1135,7 @@ cs_field_gradient_vector(const cs_field_t          *f,
       if (diff_id > -1) {
         cs_field_t *f_weight = cs_field_by_id(diff_id);
         c_weight = f_weight->val;
+        w_stride = f_weight->dim;
       }
     }
 
@@ -843,6 +1170,27 @@ cs_field_gradient_vector(const cs_field_t          *f,
     }
   }
 
+  /* Reuse cached gradient if possible */
+
+  _gradient_cache_key_t ck;
+
+  if (_gradient_cache_query(f,
+                            9,
+                            (const cs_real_t *)var,
+                            (const cs_real_t *)bc_coeff_a,
+                            (const cs_real_t *)bc_coeff_b,
+                            9,
+                            c_weight,
+                            w_stride,
+                            cpl,
+                            inc,
+                            gradient_type,
+                            halo_type,
+                            eqp,
+                            &ck,
+                            (cs_real_t *)grad))
+    return;
+
   cs_gradient_vector(f->name,
                      gradient_type,
                      halo_type,
@@ -858,6 +1206,8 @@ cs_field_gradient_vector(const cs_field_t          *f,
                      c_weight,
                      cpl,
                      grad);
+
+  _gradient_cache_store(f, &ck, (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -917,6 +1267,27 @@ cs_field_gradient_tensor(const cs_field_t          *f,
     }
   }
 
+  /* Reuse cached gradient if possible */
+
+  _gradient_cache_key_t ck;
+
+  if (_gradient_cache_query(f,
+                            18,
+                            (const cs_real_t *)var,
+                            (const cs_real_t *)bc_coeff_a,
+                            (const cs_real_t *)bc_coeff_b,
+                            36,
+                            NULL, /* c_weight */
+                            1,
+                            NULL, /* cpl */
+                            inc,
+                            gradient_type,
+                            halo_type,
+                            eqp,
+                            &ck,
+                            (cs_real_t *)grad))
+    return;
+
   cs_gradient_tensor(f->name,
                      gradient_type,
                      halo_type,
@@ -930,6 +1301,8 @@ cs_field_gradient_tensor(const cs_field_t          *f,
                      bc_coeff_b,
                      var,
                      grad);
+
+  _gradient_cache_store(f, &ck, (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1115,6 +1488,63 @@ cs_field_synchronize(cs_field_t      *f,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Invalidate cached gradients of a given field.
+ *
+ * Gradients are cached only for fields whose "gradient_cache" key is set
+ * to 1. A cached gradient is reused only if the field values, boundary
+ * condition coefficients, weighting and gradient options match, and only
+ * during the time step in which it was computed, so explicit invalidation
+ * is needed only when other quantities (such as the mesh geometry) change.
+ *
+ * This function is called by \ref cs_field_current_to_previous.
+ *
+ * \param[in]  f  pointer to field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_invalidate(const cs_field_t  *f)
+{
+  if (f->id >= _n_gradient_cache_fields)
+    return;
+
+  for (int i = 0; i < _GRADIENT_CACHE_N_ENTRIES; i++) {
+    _gradient_cache_entry_t *ce
+      = _gradient_cache + f->id*_GRADIENT_CACHE_N_ENTRIES + i;
+    ce->valid = false;
+    ce->stamp = 0;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free all cached field gradients, and log cache usage.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_finalize(void)
+{
+  if (_gradient_cache_n_queries > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\nField gradient cache:\n"
+                    "  number of queries: %llu\n"
+                    "  number of hits:    %llu\n"),
+                  _gradient_cache_n_queries, _gradient_cache_n_hits);
+
+  for (int i = 0; i < _n_gradient_cache_fields*_GRADIENT_CACHE_N_ENTRIES; i++)
+    BFT_FREE(_gradient_cache[i].grad);
+
+  BFT_FREE(_gradient_cache);
+  _n_gradient_cache_fields = 0;
+
+  _gradient_cache_stamp = 0;
+  _gradient_cache_n_queries = 0;
+  _gradient_cache_n_hits = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -207,6 +207,34 @@ void
 cs_field_synchronize(cs_field_t      *f,
                      cs_halo_type_t   halo_type);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Invalidate cached gradients of a given field.
+ *
+ * Gradients are cached only for fields whose "gradient_cache" key is set
+ * to 1. A cached gradient is reused only if the field values, boundary
+ * condition coefficients, weighting and gradient options match, and only
+ * during the time step in which it was computed, so explicit invalidation
+ * is needed only when other quantities (such as the mesh geometry) change.
+ *
+ * This function is called by \ref cs_field_current_to_previous.
+ *
+ * \param[in]  f  pointer to field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_invalidate(const cs_field_t  *f);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free all cached field gradients, and log cache usage.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -69,6 +69,13 @@
 #include <dirent.h>
 #endif
 
+#if defined(HAVE_MMAP)
+#include <sys/mman.h>
+# if defined(HAVE_FCNTL_H)
+#  include <fcntl.h>
+# endif
+#endif
+
 #if defined(WIN32) || defined(_WIN32)
 #include <io.h>
 #endif
@@ -142,6 +149,8 @@ BEGIN_C_DECLS
        Serial standard C IO (funnelled through rank 0 in parallel)
   \var CS_FILE_STDIO_PARALLEL
        Per-process standard C IO (for reading only)
+  \var CS_FILE_MMAP
+       Per-process memory-mapped file access (for reading only)
   \var CS_FILE_MPI_INDEPENDENT
        Non-collective MPI-IO with independent file open and close
        (for reading only)
@@ -192,6 +201,9 @@ struct _cs_file_t {
 
   FILE              *sh;           /* Serial file handle */
 
+  void              *map;          /* Memory-mapped file contents */
+  size_t             map_size;     /* Size of memory-mapped region */
+
 #if defined(HAVE_MPI)
   int                rank_step;    /* Rank step between ranks and io ranks */
   cs_gnum_t         *block_size;   /* Block sizes on IO ranks in case
@@ -203,6 +215,10 @@ struct _cs_file_t {
   MPI_File           fh;           /* MPI file handle */
   MPI_Info           info;         /* MPI file info */
   MPI_Offset         offset;       /* MPI file offset */
+  MPI_Offset         stripe_size;  /* Stripe size for aligned collective
+                                      block writes, or 0 */
+  int                n_aggr;       /* Number of aggregator ranks for aligned
+                                      collective block writes */
 #else
   cs_file_off_t      offset;       /* File offset */
 #endif
@@ -270,6 +286,11 @@ static MPI_Info _mpi_io_hints_w = MPI_INFO_NULL;
 
 #endif
 
+/* Stripe alignment for collective block writes */
+
+static cs_file_off_t  _mpi_io_stripe_size = 0;  /* 0: none, < 0: detect */
+static int            _mpi_io_n_aggr = 0;       /* 0: default */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -282,6 +303,7 @@ const char  *cs_file_access_name[]
   = {N_("default"),
      N_("standard input and output, serial access"),
      N_("standard input and output, parallel access"),
+     N_("memory-mapped input, parallel access"),
      N_("non-collective MPI-IO, independent file open/close"),
      N_("non-collective MPI-IO, collective file open/close"),
      N_("collective MPI-IO")};
@@ -334,6 +356,13 @@ _access_method(cs_file_access_t  m,
 
   /* Restrict to possible values */
 
+#if defined(HAVE_MMAP)
+  if (_m == CS_FILE_MMAP && !w)
+    return _m;
+#endif
+  if (_m == CS_FILE_MMAP)
+    _m = CS_FILE_STDIO_PARALLEL;
+
 #if defined(HAVE_MPI)
 #  if !defined(HAVE_MPI_IO)
   _m = CS_MAX(_m, CS_FILE_STDIO_PARALLEL);
@@ -825,6 +854,148 @@ _file_tell(cs_file_t  *f)
   return offset;
 }
 
+#if defined(HAVE_MMAP)
+
+/*----------------------------------------------------------------------------
+ * Map a file to memory for reading.
+ *
+ * The file descriptor is closed once the mapping is established, as
+ * the mapping remains valid until unmapped.
+ *
+ * parameters:
+ *   f    <-- pointer to file handler
+ *
+ * returns:
+ *   0 in case of success, error number in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_file_mmap(cs_file_t  *f)
+{
+  int retval = 0;
+  struct stat s;
+
+  assert(f != NULL);
+
+  if (f->map != NULL)
+    return 0;
+
+  int fd = open(f->name, O_RDONLY);
+
+  if (fd < 0) {
+    retval = errno;
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error opening file \"%s\":\n\n"
+                "  %s"), f->name, strerror(retval));
+    return retval;
+  }
+
+  if (fstat(fd, &s) != 0) {
+    retval = errno;
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error obtaining size of file \"%s\":\n\n"
+                "  %s"), f->name, strerror(retval));
+  }
+
+  else if (s.st_size > 0) {
+
+    void *map = mmap(NULL, (size_t)s.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+    if (map == MAP_FAILED) {
+      retval = errno;
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error mapping file \"%s\" to memory:\n\n"
+                  "  %s"), f->name, strerror(retval));
+    }
+    else {
+      f->map = map;
+      f->map_size = s.st_size;
+#if defined(POSIX_MADV_SEQUENTIAL)
+      posix_madvise(f->map, f->map_size, POSIX_MADV_SEQUENTIAL);
+#endif
+    }
+
+  }
+
+  close(fd);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Unmap a memory-mapped file.
+ *
+ * parameters:
+ *   f <-> pointer to file handler
+ *
+ * returns:
+ *   0 in case of success, error number in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_file_munmap(cs_file_t  *f)
+{
+  int retval = 0;
+
+  if (f->map != NULL) {
+    if (munmap(f->map, f->map_size) != 0) {
+      retval = errno;
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error unmapping file \"%s\":\n\n"
+                  "  %s"), f->name, strerror(retval));
+    }
+  }
+
+  f->map = NULL;
+  f->map_size = 0;
+
+  return retval;
+}
+
+#endif /* defined(HAVE_MMAP) */
+
+/*----------------------------------------------------------------------------
+ * Read data to a buffer from a memory-mapped file.
+ *
+ * Data is copied directly from the mapped pages, so no intermediate
+ * buffering is required.
+ *
+ * parameters:
+ *   f      <-- cs_file_t descriptor
+ *   buf    --> pointer to location receiving data
+ *   offset <-- offset of data in file, in bytes
+ *   size   <-- size of each item of data in bytes
+ *   ni     <-- number of items to read
+ *
+ * returns:
+ *   the (local) number of items (not bytes) sucessfully read;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_file_read_m(cs_file_t      *f,
+             void           *buf,
+             cs_file_off_t   offset,
+             size_t          size,
+             size_t          ni)
+{
+  size_t retval = 0;
+
+  if (ni == 0)
+    return 0;
+
+  if (offset >= 0 && (size_t)offset < f->map_size) {
+    size_t n_max = (f->map_size - (size_t)offset) / size;
+    retval = CS_MIN(ni, n_max);
+    memcpy(buf, (const unsigned char *)f->map + offset, retval*size);
+  }
+
+  if (retval != ni)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Premature end of file \"%s\""), f->name);
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Read data to a buffer, distributing a contiguous part of it to each
  * process associated with a file.
@@ -1016,6 +1187,52 @@ _file_read_block_p(cs_file_t  *f,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Read data to a buffer, distributing a contiguous part of it to each
+ * process associated with a file.
+ *
+ * Each process should receive a (possibly empty) block of the data,
+ * and we should have:
+ *   global_num_start at rank 0 = 1
+ *   global_num_start at rank i+1 = global_num_end at rank i.
+ * Otherwise, behavior (especially positioning for future reads) is undefined.
+ *
+ * This version copies data directly from the memory-mapped file, so
+ * each rank only touches the pages of its own block.
+ *
+ * parameters:
+ *   f                <-- cs_file_t descriptor
+ *   buf              --> pointer to location receiving data
+ *   size             <-- size of each item of data in bytes
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *
+ * returns:
+ *   the (local) number of items (not bytes) sucessfully read;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_file_read_block_m(cs_file_t  *f,
+                   void       *buf,
+                   size_t      size,
+                   cs_gnum_t   global_num_start,
+                   cs_gnum_t   global_num_end)
+{
+  size_t retval = 0;
+  cs_gnum_t loc_count = global_num_end - global_num_start;
+
+  if (loc_count > 0) {
+
+    cs_file_off_t offset = f->offset + ((global_num_start - 1) * size);
+
+    retval = _file_read_m(f, buf, offset, size, (size_t)loc_count);
+
+  }
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Write data to a file, each associated process providing a contiguous part
  * of this data.
@@ -1519,6 +1736,74 @@ _mpi_io_error_message
               "Error type: %s"), file_name, buffer);
 }
 
+/*----------------------------------------------------------------------------
+ * Determine stripe alignment settings for a file opened using MPI IO.
+ *
+ * If the default stripe size or number of aggregators are to be detected,
+ * "striping_unit" and "striping_factor" values are queried from the hints
+ * actually used by the MPI IO library for this file (on Lustre or GPFS,
+ * these usually reflect the file's layout).
+ *
+ * parameters:
+ *   f <-> pointer to file handler
+ *----------------------------------------------------------------------------*/
+
+static void
+_mpi_file_stripe_info(cs_file_t  *f)
+{
+  MPI_Offset stripe_size = _mpi_io_stripe_size;
+  int n_aggr = _mpi_io_n_aggr;
+
+  f->stripe_size = 0;
+  f->n_aggr = 0;
+
+  if (   stripe_size == 0
+      || f->method != CS_FILE_MPI_COLLECTIVE
+      || f->mode == CS_FILE_MODE_READ
+      || f->fh == MPI_FILE_NULL)
+    return;
+
+  int io_rank, n_io_ranks;
+  MPI_Comm_rank(f->io_comm, &io_rank);
+  MPI_Comm_size(f->io_comm, &n_io_ranks);
+
+#if MPI_VERSION > 1
+
+  if ((stripe_size < 0 || n_aggr < 1) && io_rank == 0) {
+
+    MPI_Info info_used;
+    char val[MPI_MAX_INFO_VAL + 1];
+    int flag = 0;
+
+    MPI_File_get_info(f->fh, &info_used);
+
+    if (stripe_size < 0) {
+      MPI_Info_get(info_used, "striping_unit", MPI_MAX_INFO_VAL, val, &flag);
+      stripe_size = (flag) ? atoll(val) : 0;
+    }
+    if (n_aggr < 1) {
+      MPI_Info_get(info_used, "striping_factor", MPI_MAX_INFO_VAL, val,
+                   &flag);
+      n_aggr = (flag) ? atoi(val) : 0;
+    }
+
+    MPI_Info_free(&info_used);
+  }
+
+  MPI_Bcast(&stripe_size, 1, MPI_OFFSET, 0, f->io_comm);
+  MPI_Bcast(&n_aggr, 1, MPI_INT, 0, f->io_comm);
+
+#endif /* MPI_VERSION > 1 */
+
+  if (stripe_size <= 0)
+    return;
+  if (n_aggr < 1 || n_aggr > n_io_ranks)
+    n_aggr = n_io_ranks;
+
+  f->stripe_size = stripe_size;
+  f->n_aggr = n_aggr;
+}
+
 /*----------------------------------------------------------------------------
  * Open a file using MPI IO.
  *
@@ -1569,6 +1854,8 @@ _mpi_file_open(cs_file_t       *f,
     retval = MPI_File_open(f->io_comm, f->name, amode, f->info, &(f->fh));
     if (retval == MPI_SUCCESS)
       retval = MPI_File_get_position(f->fh, &(f->offset));
+    if (retval == MPI_SUCCESS)
+      _mpi_file_stripe_info(f);
   }
 
   if (retval != MPI_SUCCESS)
@@ -2045,6 +2332,171 @@ _mpi_file_write_block_ip(cs_file_t  *f,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Write data to a file as a block, using collective MPI IO with an
+ * alignment of written ranges to file system stripes.
+ *
+ * Data is first redistributed among aggregator ranks, each of which is
+ * assigned a contiguous range of whole stripes (except at the section
+ * boundaries), so that no stripe is shared by several write requests;
+ * each aggregator then writes its data using MPI_File_write_at_all.
+ *
+ * If the range assigned to an aggregator would be too large for a
+ * single write, the default (non-aligned) method is used.
+ *
+ * parameters:
+ *   f                <-- pointer to file handler
+ *   buf              <-- pointer to location containing data
+ *   size             <-- size of each item of data in bytes
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *
+ * returns:
+ *   the (local) number of items (not bytes) sucessfully written;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_mpi_file_write_block_aligned(cs_file_t  *f,
+                              void       *buf,
+                              size_t      size,
+                              cs_gnum_t   global_num_start,
+                              cs_gnum_t   global_num_end)
+{
+  MPI_Status status;
+  int errcode = MPI_SUCCESS;
+
+  size_t retval = 0;
+
+  if (f->fh == MPI_FILE_NULL)
+    return retval;
+
+  const MPI_Offset stripe_size = f->stripe_size;
+  const int n_aggr = f->n_aggr;
+
+  int io_rank, n_io_ranks;
+  MPI_Comm_rank(f->io_comm, &io_rank);
+  MPI_Comm_size(f->io_comm, &n_io_ranks);
+
+  /* Byte ranges of all ranks (which follow each other) */
+
+  MPI_Offset range[2] = {f->offset + (global_num_start - 1)*size,
+                         f->offset + (global_num_end - 1)*size};
+  MPI_Offset *g_range = NULL;
+
+  BFT_MALLOC(g_range, n_io_ranks*2, MPI_Offset);
+
+  MPI_Allgather(range, 2, MPI_OFFSET, g_range, 2, MPI_OFFSET, f->io_comm);
+
+  const MPI_Offset g_start = g_range[0];
+  const MPI_Offset g_end = g_range[n_io_ranks*2 - 1];
+
+  /* Contiguous stripe ranges assigned to each aggregator */
+
+  const MPI_Offset s_start = g_start / stripe_size;
+  const MPI_Offset n_stripes = (g_end + stripe_size - 1)/stripe_size - s_start;
+  const MPI_Offset d_stripes = (n_stripes + n_aggr - 1) / n_aggr;
+
+  if (d_stripes * stripe_size > INT_MAX) {
+    BFT_FREE(g_range);
+    return _mpi_file_write_block_eo(f,
+                                    buf,
+                                    size,
+                                    global_num_start,
+                                    global_num_end);
+  }
+
+  /* Local aggregator id (aggregators are evenly spread among ranks) */
+
+  int aggr_id = -1;
+  {
+    int a = ((cs_gnum_t)io_rank * n_aggr + n_io_ranks - 1) / n_io_ranks;
+    if (   a < n_aggr
+        && ((cs_gnum_t)a * n_io_ranks) / n_aggr == (cs_gnum_t)io_rank)
+      aggr_id = a;
+  }
+
+  MPI_Offset d_range[2] = {g_start, g_start};
+  if (aggr_id > -1) {
+    d_range[0] = CS_MAX(g_start, (s_start + aggr_id*d_stripes)*stripe_size);
+    d_range[1] = CS_MIN(g_end, (s_start + (aggr_id+1)*d_stripes)*stripe_size);
+    if (d_range[1] < d_range[0])
+      d_range[1] = d_range[0];
+  }
+
+  /* Exchange counts and displacements */
+
+  int *send_count, *send_displ, *recv_count, *recv_displ;
+  BFT_MALLOC(send_count, n_io_ranks*4, int);
+  send_displ = send_count + n_io_ranks;
+  recv_count = send_displ + n_io_ranks;
+  recv_displ = recv_count + n_io_ranks;
+
+  for (int i = 0; i < n_io_ranks*4; i++)
+    send_count[i] = 0;
+
+  for (int a = 0; a < n_aggr; a++) {
+    MPI_Offset a_s = CS_MAX(range[0], (s_start + a*d_stripes)*stripe_size);
+    MPI_Offset a_e = CS_MIN(range[1], (s_start + (a+1)*d_stripes)*stripe_size);
+    if (a_e > a_s) {
+      int r_id = ((cs_gnum_t)a * n_io_ranks) / n_aggr;
+      send_count[r_id] = a_e - a_s;
+      send_displ[r_id] = a_s - range[0];
+    }
+  }
+
+  if (aggr_id > -1) {
+    for (int r_id = 0; r_id < n_io_ranks; r_id++) {
+      MPI_Offset r_s = CS_MAX(d_range[0], g_range[r_id*2]);
+      MPI_Offset r_e = CS_MIN(d_range[1], g_range[r_id*2 + 1]);
+      if (r_e > r_s) {
+        recv_count[r_id] = r_e - r_s;
+        recv_displ[r_id] = r_s - d_range[0];
+      }
+    }
+  }
+
+  BFT_FREE(g_range);
+
+  int d_size = d_range[1] - d_range[0];
+  unsigned char *d_buf = NULL;
+
+  BFT_MALLOC(d_buf, d_size, unsigned char);
+
+  MPI_Alltoallv(buf, send_count, send_displ, MPI_BYTE,
+                d_buf, recv_count, recv_displ, MPI_BYTE,
+                f->io_comm);
+
+  BFT_FREE(send_count);
+
+  /* Write aligned ranges */
+
+  errcode = MPI_File_write_at_all(f->fh, d_range[0], d_buf, d_size, MPI_BYTE,
+                                  &status);
+
+  if (errcode != MPI_SUCCESS)
+    _mpi_io_error_message(f->name, errcode);
+
+  BFT_FREE(d_buf);
+
+  /* As data was redistributed, local counts are only known if
+     all aggregators wrote all their data */
+
+  int count = 0, l_ok = 1, g_ok = 1;
+
+  if (d_size > 0) {
+    MPI_Get_count(&status, MPI_BYTE, &count);
+    if (count != d_size)
+      l_ok = 0;
+  }
+
+  MPI_Allreduce(&l_ok, &g_ok, 1, MPI_INT, MPI_MIN, f->io_comm);
+
+  if (g_ok)
+    retval = global_num_end - global_num_start;
+
+  return retval;
+}
+
 #endif /* defined(HAVE_MPI_IO) */
 
 /*----------------------------------------------------------------------------
@@ -2146,12 +2598,17 @@ cs_file_open(const char        *name,
 
   f->sh = NULL;
 
+  f->map = NULL;
+  f->map_size = 0;
+
 #if defined(HAVE_MPI)
   f->comm = MPI_COMM_NULL;
   f->io_comm = MPI_COMM_NULL;
 #if defined(HAVE_MPI_IO)
   f->fh = MPI_FILE_NULL;
   f->info = hints;
+  f->stripe_size = 0;
+  f->n_aggr = 0;
 #endif
 #endif
 
@@ -2208,17 +2665,18 @@ cs_file_open(const char        *name,
         BFT_MALLOC(f->block_size, 1, cs_gnum_t);
     }
 
-    if (f->comm == MPI_COMM_NULL)
+    if (f->comm == MPI_COMM_NULL && f->method != CS_FILE_MMAP)
       f->method = CS_FILE_STDIO_SERIAL;
   }
 #else
-  f->method = CS_FILE_STDIO_SERIAL;
+  if (f->method != CS_FILE_MMAP)
+    f->method = CS_FILE_STDIO_SERIAL;
 #endif
 
   /* Use MPI IO ? */
 
 #if !defined(HAVE_MPI_IO)
-  if (f->method > CS_FILE_STDIO_PARALLEL)
+  if (f->method >= CS_FILE_MPI_INDEPENDENT)
     bft_error(__FILE__, __LINE__, 0,
               _("Error opening file:\n%s\n"
                 "MPI-IO is requested, but not available."),
@@ -2232,6 +2690,11 @@ cs_file_open(const char        *name,
   if (f->method <= CS_FILE_STDIO_PARALLEL && f->rank == 0)
     errcode = _file_open(f);
 
+#if defined(HAVE_MMAP)
+  if (f->method == CS_FILE_MMAP)
+    errcode = _file_mmap(f);
+#endif
+
 #if defined(HAVE_MPI_IO)
   if (f->method == CS_FILE_MPI_INDEPENDENT) {
     f->io_comm = MPI_COMM_SELF;
@@ -2362,6 +2825,11 @@ cs_file_free(cs_file_t  *f)
   BFT_FREE(f->block_size);
 #endif
 
+#if defined(HAVE_MMAP)
+  if (_f->map != NULL)
+    _file_munmap(_f);
+#endif
+
   BFT_FREE(_f->name);
   BFT_FREE(_f);
 
@@ -2485,9 +2953,14 @@ cs_file_read_global(cs_file_t  *f,
     }
   }
 
+  /* With memory mapping, all ranks read directly (no broadcast needed) */
+
+  else if (f->method == CS_FILE_MMAP)
+    retval = _file_read_m(f, buf, f->offset, size, ni);
+
 #if defined(HAVE_MPI_IO)
 
-  else if ((f->method > CS_FILE_STDIO_PARALLEL)) {
+  else if ((f->method >= CS_FILE_MPI_INDEPENDENT)) {
 
     MPI_Status status;
     int errcode = MPI_SUCCESS, count = 0;
@@ -2532,7 +3005,7 @@ cs_file_read_global(cs_file_t  *f,
 #endif /* defined(HAVE_MPI_IO) */
 
 #if defined(HAVE_MPI)
-  if (f->comm != MPI_COMM_NULL) {
+  if (f->comm != MPI_COMM_NULL && f->method != CS_FILE_MMAP) {
     long _retval = retval;
     MPI_Bcast(buf, size*ni, MPI_BYTE, 0, f->comm);
     MPI_Bcast(&_retval, 1, MPI_LONG, 0, f->comm);
@@ -2584,7 +3057,7 @@ cs_file_write_global(cs_file_t   *f,
 
   if (   f->rank == 0
       && (   (f->swap_endian == true && size > 1)
-          || (f->method > CS_FILE_STDIO_PARALLEL))) {
+          || (f->method >= CS_FILE_MPI_INDEPENDENT))) {
 
     if (size*ni > sizeof(_copybuf))
       BFT_MALLOC(copybuf, size*ni, unsigned char);
@@ -2607,7 +3080,7 @@ cs_file_write_global(cs_file_t   *f,
 
 #if defined(HAVE_MPI_IO)
 
-  else if ((f->method > CS_FILE_STDIO_PARALLEL)) {
+  else if ((f->method >= CS_FILE_MPI_INDEPENDENT)) {
 
     MPI_Status status;
     int errcode = MPI_SUCCESS, count = 0;
@@ -2746,6 +3219,14 @@ cs_file_read_block(cs_file_t  *f,
                                 _global_num_end);
     break;
 
+  case CS_FILE_MMAP:
+    retval = _file_read_block_m(f,
+                                _buf,
+                                size,
+                                _global_num_start,
+                                _global_num_end);
+    break;
+
 #if defined(HAVE_MPI_IO)
 
   case CS_FILE_MPI_INDEPENDENT:
@@ -3012,7 +3493,13 @@ cs_file_write_block_buffer(cs_file_t  *f,
       break;
 
   case CS_FILE_MPI_COLLECTIVE:
-    if (_mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS)
+    if (f->stripe_size > 0)
+      retval = _mpi_file_write_block_aligned(f,
+                                             _buf,
+                                             size,
+                                             _global_num_start,
+                                             _global_num_end);
+    else if (_mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS)
       retval = _mpi_file_write_block_eo(f,
                                         _buf,
                                         size,
@@ -3104,6 +3591,9 @@ cs_file_seek(cs_file_t       *f,
     if (f->sh != NULL)
       f->offset = cs_file_tell(f) + offset;
 
+    else if (f->method == CS_FILE_MMAP)
+      f->offset = f->map_size + offset;
+
 #if defined(HAVE_MPI_IO)
     if (f->fh != MPI_FILE_NULL) {
       MPI_Offset f_size = 0;
@@ -3216,6 +3706,7 @@ cs_file_dump(const cs_file_t  *f)
                              "CS_FILE_MODE_APPEND"};
   const char *access_name[] = {"CS_FILE_STDIO_SERIAL",
                                "CS_FILE_STDIO_PARALLEL",
+                               "CS_FILE_MMAP",
                                "CS_FILE_MPI_INDEPENDENT",
                                "CS_FILE_MPI_NON_COLLECTIVE",
                                "CS_FILE_MPI_COLLECTIVE"};
@@ -3259,9 +3750,13 @@ cs_file_dump(const cs_file_t  *f)
              (unsigned long long)(f->comm));
 #if defined(HAVE_MPI_IO)
   bft_printf("MPI file handle:             %llu\n"
-             "MPI file offset:             %llu\n",
+             "MPI file offset:             %llu\n"
+             "Stripe size:                 %llu\n"
+             "N aggregators:               %d\n",
              (unsigned long long)(f->fh),
-             (unsigned long long)(f->offset));
+             (unsigned long long)(f->offset),
+             (unsigned long long)(f->stripe_size),
+             f->n_aggr);
 #endif
 #endif
 
@@ -3279,6 +3774,9 @@ cs_file_free_defaults(void)
 {
   _mpi_io_positioning = CS_FILE_MPI_EXPLICIT_OFFSETS;
 
+  _mpi_io_stripe_size = 0;
+  _mpi_io_n_aggr = 0;
+
   _default_access_r = CS_FILE_DEFAULT;
   _default_access_w = CS_FILE_DEFAULT;
 
@@ -3414,7 +3912,7 @@ cs_file_set_default_access(cs_file_mode_t    mode,
 
   /* Set info objects */
 
-  if (_method > CS_FILE_STDIO_PARALLEL && hints != MPI_INFO_NULL) {
+  if (_method >= CS_FILE_MPI_INDEPENDENT && hints != MPI_INFO_NULL) {
     if (mode == CS_FILE_MODE_READ)
       MPI_Info_dup(hints, &_mpi_io_hints_r);
     else if (mode == CS_FILE_MODE_WRITE || mode == CS_FILE_MODE_APPEND)
@@ -3676,6 +4174,64 @@ cs_file_set_mpi_io_positioning(cs_file_mpi_positioning_t  positioning)
   _mpi_io_positioning = positioning;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get the default stripe alignment settings for collective MPI-IO
+ *        block writes.
+ *
+ * For details, see \ref cs_file_set_default_stripe_alignment.
+ *
+ * \param[out]  stripe_size    stripe size in bytes (0 if not used,
+ *                             < 0 if detected), or NULL
+ * \param[out]  n_aggregators  number of aggregator ranks (0 for default),
+ *                             or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_get_default_stripe_alignment(cs_file_off_t  *stripe_size,
+                                     int            *n_aggregators)
+{
+  if (stripe_size != NULL)
+    *stripe_size = _mpi_io_stripe_size;
+  if (n_aggregators != NULL)
+    *n_aggregators = _mpi_io_n_aggr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the default stripe alignment settings for collective MPI-IO
+ *        block writes.
+ *
+ * When active, block writes using the \ref CS_FILE_MPI_COLLECTIVE method
+ * first redistribute data to a set of aggregator ranks, each handling
+ * a contiguous range of whole file system stripes, so that no stripe
+ * is written by more than one rank. This may significantly reduce lock
+ * contention on parallel file systems such as Lustre or GPFS.
+ *
+ * If the stripe size is negative, the "striping_unit" value used by
+ * the MPI-IO library for each file is used (if available; otherwise, no
+ * alignment is done). Similarly, if the number of aggregators is not
+ * strictly positive, the "striping_factor" value is used, or the number
+ * of I/O ranks if not available. The number of aggregators is always
+ * limited to the number of I/O ranks.
+ *
+ * This applies to files opened after this call.
+ *
+ * \param[in]  stripe_size    stripe size in bytes (0 to disable alignment,
+ *                            < 0 for automatic detection)
+ * \param[in]  n_aggregators  number of aggregator ranks (0 for default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_default_stripe_alignment(cs_file_off_t  stripe_size,
+                                     int            n_aggregators)
+{
+  _mpi_io_stripe_size = stripe_size;
+  _mpi_io_n_aggr = n_aggregators;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Print information on default options for file access.
@@ -3708,7 +4264,7 @@ cs_file_defaults_info(void)
     cs_file_get_default_access(mode, &method, &hints);
 
 #if defined(HAVE_MPI_IO)
-    if (method > CS_FILE_STDIO_PARALLEL) {
+    if (method >= CS_FILE_MPI_INDEPENDENT) {
       for (log_id = 0; log_id < 2; log_id++)
         cs_log_printf(logs[log_id],
                       _(fmt[mode + 2]),
@@ -3716,7 +4272,7 @@ cs_file_defaults_info(void)
                       _(cs_file_mpi_positioning_name[_mpi_io_positioning]));
     }
 #endif
-    if (method <= CS_FILE_STDIO_PARALLEL) {
+    if (method < CS_FILE_MPI_INDEPENDENT) {
       for (log_id = 0; log_id < 2; log_id++)
         cs_log_printf(logs[log_id],
                       _(fmt[mode]), _(cs_file_access_name[method]));
@@ -3757,6 +4313,23 @@ cs_file_defaults_info(void)
                     _("  I/O rank step:        %d\n"), block_rank_step);
   }
 
+#if defined(HAVE_MPI_IO)
+  if (_mpi_io_stripe_size != 0) {
+    for (log_id = 0; log_id < 2; log_id++) {
+      if (_mpi_io_stripe_size > 0)
+        cs_log_printf(logs[log_id],
+                      _("  I/O stripe alignment: %llu bytes\n"),
+                      (unsigned long long)_mpi_io_stripe_size);
+      else
+        cs_log_printf(logs[log_id],
+                      _("  I/O stripe alignment: automatic\n"));
+      if (_mpi_io_n_aggr > 0)
+        cs_log_printf(logs[log_id],
+                      _("  I/O aggregators:      %d\n"), _mpi_io_n_aggr);
+    }
+  }
+#endif
+
   cs_log_printf(CS_LOG_PERFORMANCE, "\n");
   cs_log_separator(CS_LOG_PERFORMANCE);
 
@@ -86,6 +86,7 @@ typedef enum {
   CS_FILE_DEFAULT,
   CS_FILE_STDIO_SERIAL,
   CS_FILE_STDIO_PARALLEL,
+  CS_FILE_MMAP,
   CS_FILE_MPI_INDEPENDENT,
   CS_FILE_MPI_NON_COLLECTIVE,
   CS_FILE_MPI_COLLECTIVE
@@ -627,6 +628,49 @@ cs_file_get_mpi_io_positioning(void);
 void
 cs_file_set_mpi_io_positioning(cs_file_mpi_positioning_t  positioning);
 
+/*----------------------------------------------------------------------------
+ * Get the default stripe alignment settings for collective MPI-IO
+ * block writes.
+ *
+ * For details, see cs_file_set_default_stripe_alignment().
+ *
+ * parameters:
+ *   stripe_size   --> stripe size in bytes (0 if not used, < 0 if detected),
+ *                     or NULL
+ *   n_aggregators --> number of aggregator ranks (0 for default), or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_get_default_stripe_alignment(cs_file_off_t  *stripe_size,
+                                     int            *n_aggregators);
+
+/*----------------------------------------------------------------------------
+ * Set the default stripe alignment settings for collective MPI-IO
+ * block writes.
+ *
+ * When active, block writes using the CS_FILE_MPI_COLLECTIVE method
+ * first redistribute data to a set of aggregator ranks, each handling
+ * a contiguous range of whole file system stripes, so that no stripe
+ * is written by more than one rank.
+ *
+ * If the stripe size is negative, the "striping_unit" value used by
+ * the MPI-IO library for each file is used (if available). Similarly,
+ * if the number of aggregators is not strictly positive, the
+ * "striping_factor" value is used, or the number of I/O ranks
+ * if not available.
+ *
+ * This applies to files opened after this call.
+ *
+ * parameters:
+ *   stripe_size   <-- stripe size in bytes (0 to disable alignment,
+ *                     < 0 for automatic detection)
+ *   n_aggregators <-- number of aggregator ranks (0 for default)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_default_stripe_alignment(cs_file_off_t  stripe_size,
+                                     int            n_aggregators);
+
 /*----------------------------------------------------------------------------
  * Print information on default options for file access.
  *----------------------------------------------------------------------------*/
@@ -47,6 +47,8 @@
 
 #include "cs_interface.h"
 #include "cs_rank_neighbors.h"
+#include "cs_timer.h"
+#include "cs_timer_stats.h"
 
 #include "fvm_periodicity.h"
 
@@ -62,6 +64,66 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/* Persistent communication requests for a given halo type and stride */
+
+typedef struct {
+
+  cs_halo_type_t   sync_mode;     /* Associated synchronization mode */
+  int              stride;        /* Associated stride */
+
+  int              n_requests;    /* Number of requests */
+  MPI_Request     *request;       /* Persistent requests (receives first) */
+
+  cs_real_t       *send_buffer;   /* Send buffer bound to requests */
+  cs_real_t       *recv_buffer;   /* Receive buffer bound to requests */
+
+} _cs_halo_p_comm_t;
+
+/* Set of cached persistent communications for a given halo */
+
+typedef struct {
+
+  int                 n_p_comm;   /* Number of cached request sets */
+  _cs_halo_p_comm_t  *p_comm;     /* Cached request sets */
+
+  MPI_Comm            ngb_comm;   /* Distributed graph communicator for
+                                     neighborhood collectives, or
+                                     MPI_COMM_NULL */
+  int                 n_ngb;      /* Number of distant neighbor ranks */
+  int                *ngb_rank_id;  /* Matching halo rank ids (size: n_ngb) */
+  int                *ngb_count;  /* Send counts, send displacements,
+                                     receive counts and receive
+                                     displacements (size: 4*n_ngb) */
+
+  MPI_Comm            sh_comm;    /* Shared-memory (node) communicator,
+                                     or MPI_COMM_NULL */
+  int                *sh_rank;    /* Rank in sh_comm of each communicating
+                                     rank, or -1 if not on same node
+                                     (size: n_c_domains) */
+  MPI_Win             sh_win;     /* Shared-memory window, or MPI_WIN_NULL */
+  int                 sh_stride;  /* Maximum stride usable with window */
+  int                 sh_parity;  /* Send buffer used by next exchange */
+  MPI_Aint            sh_buffer_size;  /* Size of each local send buffer
+                                          (in values) */
+  cs_real_t          *sh_buffer;  /* Local window segment (2 buffers) */
+  cs_real_t         **sh_base;    /* Window segment of each communicating
+                                     rank on same node, or NULL */
+  cs_lnum_t          *sh_seg_size;  /* Size of each send buffer of each
+                                       communicating rank (in values) */
+  cs_lnum_t          *sh_shift;   /* Start of values destined to local rank
+                                     in send buffer of each communicating
+                                     rank on same node (in elements) */
+
+} _cs_halo_p_comm_set_t;
+
+#endif /* defined(HAVE_MPI) */
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -84,6 +146,23 @@ static int           _cs_glob_halo_request_size = 0;
 static MPI_Request  *_cs_glob_halo_request = NULL;
 static MPI_Status   *_cs_glob_halo_status = NULL;
 
+/* Number of pending requests (for split synchronization) */
+
+static int           _cs_glob_halo_request_count = 0;
+
+/* Pending persistent requests (for split synchronization) */
+
+static _cs_halo_p_comm_t  *_cs_glob_halo_p_comm_pending = NULL;
+
+/* Pending neighborhood collective (for split synchronization) */
+
+static bool          _cs_glob_halo_ngb_pending = false;
+static MPI_Request   _cs_glob_halo_ngb_request = MPI_REQUEST_NULL;
+
+/* Pending shared-memory exchange (for split synchronization) */
+
+static _cs_halo_p_comm_set_t  *_cs_glob_halo_sh_pending = NULL;
+
 #endif
 
 /* Buffer to save rotation halo values */
@@ -95,6 +174,18 @@ static cs_real_t  *_cs_glob_halo_rot_backup = NULL;
 
 static int _cs_glob_halo_use_barrier = false;
 
+/* Should we use persistent communication requests ? */
+
+static bool _cs_glob_halo_use_persistent = false;
+
+/* Should we use MPI neighborhood collectives ? */
+
+static bool _cs_glob_halo_use_ngb_coll = false;
+
+/* Should we use MPI shared-memory windows for ranks on the same node ? */
+
+static bool _cs_glob_halo_use_shared_memory = false;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -349,235 +440,764 @@ _zero_rotation_values(const cs_halo_t  *halo,
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
-/*============================================================================
- * Public function definitions
- *============================================================================*/
+#if defined(HAVE_MPI)
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Create a halo structure given an interface set.
+/*----------------------------------------------------------------------------
+ * Create an empty set of persistent communications for a halo.
  *
- * \param[in]  ifs  pointer to a cs_interface_set structure
+ * returns:
+ *   pointer to created structure
+ *----------------------------------------------------------------------------*/
+
+static _cs_halo_p_comm_set_t *
+_p_comm_set_create(void)
+{
+  _cs_halo_p_comm_set_t  *pcs = NULL;
+
+  BFT_MALLOC(pcs, 1, _cs_halo_p_comm_set_t);
+
+  pcs->n_p_comm = 0;
+  pcs->p_comm = NULL;
+
+  pcs->ngb_comm = MPI_COMM_NULL;
+  pcs->n_ngb = 0;
+  pcs->ngb_rank_id = NULL;
+  pcs->ngb_count = NULL;
+
+  pcs->sh_comm = MPI_COMM_NULL;
+  pcs->sh_rank = NULL;
+  pcs->sh_win = MPI_WIN_NULL;
+  pcs->sh_stride = 0;
+  pcs->sh_parity = 0;
+  pcs->sh_buffer_size = 0;
+  pcs->sh_buffer = NULL;
+  pcs->sh_base = NULL;
+  pcs->sh_seg_size = NULL;
+  pcs->sh_shift = NULL;
+
+  return pcs;
+}
+
+/*----------------------------------------------------------------------------
+ * Build a distributed graph communicator for a halo's distant ranks.
  *
- * \return  pointer to created cs_halo_t structure
- */
-/*----------------------------------------------------------------------------*/
+ * This is a collective operation over cs_glob_mpi_comm, and requires
+ * MPI 3 or above; it does nothing otherwise.
+ *
+ * parameters:
+ *   halo <-> pointer to halo structure
+ *----------------------------------------------------------------------------*/
 
-cs_halo_t *
-cs_halo_create(const cs_interface_set_t  *ifs)
+static void
+_p_comm_set_build_ngb_comm(cs_halo_t  *halo)
 {
-  cs_lnum_t  i, tmp_id, perio_lst_size;
+#if (MPI_VERSION >= 3)
 
-  cs_lnum_t  loc_id = -1;
+  _cs_halo_p_comm_set_t  *pcs = halo->p_comm;
 
-  cs_halo_t  *halo = NULL;
+  assert(pcs != NULL && pcs->ngb_comm == MPI_COMM_NULL);
 
-  const cs_interface_t  *interface = NULL;
+  int  *ngb_rank;
 
-  BFT_MALLOC(halo, 1, cs_halo_t);
+  BFT_MALLOC(ngb_rank, halo->n_c_domains + 1, int);
+  BFT_MALLOC(pcs->ngb_rank_id, halo->n_c_domains + 1, int);
 
-  halo->n_c_domains = cs_interface_set_size(ifs);
-  halo->n_transforms = 0;
+  pcs->n_ngb = 0;
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    if (halo->c_domain_rank[rank_id] != cs_glob_rank_id) {
+      ngb_rank[pcs->n_ngb] = halo->c_domain_rank[rank_id];
+      pcs->ngb_rank_id[pcs->n_ngb] = rank_id;
+      pcs->n_ngb += 1;
+    }
+  }
 
-  halo->periodicity = cs_interface_set_periodicity(ifs);
-  halo->n_rotations = 0;
+  BFT_MALLOC(pcs->ngb_count, pcs->n_ngb*4 + 1, int);
 
-  halo->n_local_elts = 0;
+  /* Halo neighborhoods are symmetric */
 
-  for (i = 0; i < CS_HALO_N_TYPES; i++) {
-    halo->n_send_elts[i] = 0;
-    halo->n_elts [i] = 0;
-  }
+  cs_rank_neighbors_t  rn = {.size = pcs->n_ngb, .rank = ngb_rank};
 
-  BFT_MALLOC(halo->c_domain_rank, halo->n_c_domains, int);
+  pcs->ngb_comm = cs_rank_neighbors_create_graph_comm(&rn, &rn,
+                                                      NULL, NULL,
+                                                      cs_glob_mpi_comm);
 
-  /* Check if cs_glob_rank_id belongs to interface set in order to
-     order ranks with local rank at first place */
+  BFT_FREE(ngb_rank);
 
-  for (i = 0; i < halo->n_c_domains; i++) {
+#else
 
-    interface = cs_interface_set_get(ifs, i);
-    halo->c_domain_rank[i] = cs_interface_rank(interface);
+  CS_UNUSED(halo);
 
-    if (cs_glob_rank_id == cs_interface_rank(interface))
-      loc_id = i;
+#endif /* (MPI_VERSION >= 3) */
+}
 
-  } /* End of loop on ranks */
+/*----------------------------------------------------------------------------
+ * Free the distributed graph communicator and counts of a halo.
+ *
+ * parameters:
+ *   pcs <-> pointer to set of persistent communications
+ *----------------------------------------------------------------------------*/
 
-  if (loc_id > 0) {
+static void
+_p_comm_set_free_ngb_comm(_cs_halo_p_comm_set_t  *pcs)
+{
+  if (pcs == NULL)
+    return;
 
-    tmp_id = halo->c_domain_rank[loc_id];
-    halo->c_domain_rank[loc_id] = halo->c_domain_rank[0];
-    halo->c_domain_rank[0] = tmp_id;
+  if (pcs->ngb_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(pcs->ngb_comm));
 
-  }
+  BFT_FREE(pcs->ngb_rank_id);
+  BFT_FREE(pcs->ngb_count);
+  pcs->n_ngb = 0;
+}
 
-  /* Order ranks */
+/*----------------------------------------------------------------------------
+ * Build a shared-memory communicator for a halo's ranks on the same node.
+ *
+ * This is a collective operation over cs_glob_mpi_comm, and requires
+ * MPI 3 or above; it does nothing otherwise. The shared-memory window
+ * itself is only allocated on first use, as its size depends on the
+ * halo's send lists.
+ *
+ * parameters:
+ *   halo <-> pointer to halo structure
+ *----------------------------------------------------------------------------*/
 
-  if (   halo->n_c_domains > 2
-      && _order_int_test(&(halo->c_domain_rank[1]),
-                         halo->n_c_domains-1) == 0) {
+static void
+_p_comm_set_build_sh_comm(cs_halo_t  *halo)
+{
+#if (MPI_VERSION >= 3)
 
-    cs_lnum_t  *order = NULL;
-    cs_gnum_t  *buffer = NULL;
+  _cs_halo_p_comm_set_t  *pcs = halo->p_comm;
 
-    BFT_MALLOC(order, halo->n_c_domains - 1, cs_lnum_t);
-    BFT_MALLOC(buffer, halo->n_c_domains - 1, cs_gnum_t);
+  assert(pcs != NULL && pcs->sh_comm == MPI_COMM_NULL);
 
-    for (i = 1; i < halo->n_c_domains; i++)
-      buffer[i-1] = (cs_gnum_t)halo->c_domain_rank[i];
+  MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED, 0,
+                      MPI_INFO_NULL, &(pcs->sh_comm));
 
-    cs_order_gnum_allocated(NULL,
-                            buffer,
-                            order,
-                            halo->n_c_domains - 1);
+  int sh_size;
+  MPI_Comm_size(pcs->sh_comm, &sh_size);
 
-    for (i = 0; i < halo->n_c_domains - 1; i++)
-      halo->c_domain_rank[i+1] = (cs_lnum_t)buffer[order[i]];
+  if (sh_size < 2) {
+    MPI_Comm_free(&(pcs->sh_comm));
+    return;
+  }
 
-    BFT_FREE(buffer);
-    BFT_FREE(order);
+  /* Rank in node communicator of each communicating rank, or -1 */
 
-  } /* End of ordering ranks */
+  const int n_c_domains = halo->n_c_domains;
 
-  BFT_MALLOC(halo->send_index, 2*halo->n_c_domains + 1, cs_lnum_t);
-  BFT_MALLOC(halo->index, 2*halo->n_c_domains + 1, cs_lnum_t);
+  BFT_MALLOC(pcs->sh_rank, n_c_domains, int);
+  BFT_MALLOC(pcs->sh_shift, n_c_domains, cs_lnum_t);
+  BFT_MALLOC(pcs->sh_seg_size, n_c_domains, cs_lnum_t);
+  BFT_MALLOC(pcs->sh_base, n_c_domains, cs_real_t *);
 
-  for (i = 0; i < 2*halo->n_c_domains + 1; i++) {
-    halo->send_index[i] = 0;
-    halo->index[i] = 0;
-  }
+  MPI_Group g_glob, g_sh;
+  MPI_Comm_group(cs_glob_mpi_comm, &g_glob);
+  MPI_Comm_group(pcs->sh_comm, &g_sh);
 
-  halo->send_perio_lst = NULL;
-  halo->perio_lst = NULL;
+  MPI_Group_translate_ranks(g_glob, n_c_domains, halo->c_domain_rank,
+                            g_sh, pcs->sh_rank);
 
-  if (halo->periodicity != NULL) {
+  MPI_Group_free(&g_sh);
+  MPI_Group_free(&g_glob);
 
-    halo->n_transforms = fvm_periodicity_get_n_transforms(halo->periodicity);
+  for (int rank_id = 0; rank_id < n_c_domains; rank_id++) {
+    if (   pcs->sh_rank[rank_id] == MPI_UNDEFINED
+        || halo->c_domain_rank[rank_id] == cs_glob_rank_id)
+      pcs->sh_rank[rank_id] = -1;
+    pcs->sh_shift[rank_id] = 0;
+    pcs->sh_seg_size[rank_id] = 0;
+    pcs->sh_base[rank_id] = NULL;
+  }
 
-    for (i = 0; i < halo->n_transforms; i++) {
-      if (   fvm_periodicity_get_type(halo->periodicity, i)
-          >= FVM_PERIODICITY_ROTATION)
-        halo->n_rotations += 1;
-    }
+#else
 
-    /* We need 2 values per transformation and there are n_transforms
-       transformations. For each rank, we need a value for standard and
-       extended halo. */
+  CS_UNUSED(halo);
 
-    perio_lst_size = 2*halo->n_transforms * 2*halo->n_c_domains;
+#endif /* (MPI_VERSION >= 3) */
+}
 
-    BFT_MALLOC(halo->send_perio_lst, perio_lst_size, cs_lnum_t);
-    BFT_MALLOC(halo->perio_lst, perio_lst_size, cs_lnum_t);
+/*----------------------------------------------------------------------------
+ * Free the shared-memory window and communicator of a halo.
+ *
+ * This is a collective operation over the halo's node communicator.
+ *
+ * parameters:
+ *   pcs <-> pointer to set of persistent communications
+ *----------------------------------------------------------------------------*/
 
-    for (i = 0; i < perio_lst_size; i++) {
-      halo->send_perio_lst[i] = 0;
-      halo->perio_lst[i] = 0;
-    }
+static void
+_p_comm_set_free_sh_comm(_cs_halo_p_comm_set_t  *pcs)
+{
+  if (pcs == NULL)
+    return;
 
+#if (MPI_VERSION >= 3)
+
+  if (pcs->sh_win != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(pcs->sh_win);
+    MPI_Win_free(&(pcs->sh_win));
   }
 
-  halo->send_list = NULL;
+#endif
 
-  _cs_glob_n_halos += 1;
+  if (pcs->sh_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(pcs->sh_comm));
 
-  return halo;
+  BFT_FREE(pcs->sh_rank);
+  BFT_FREE(pcs->sh_shift);
+  BFT_FREE(pcs->sh_seg_size);
+  BFT_FREE(pcs->sh_base);
 }
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Create a halo structure, given a reference halo.
+/*----------------------------------------------------------------------------
+ * Ensure the shared-memory window of a halo may be used with a given
+ * stride, (re)allocating it if necessary.
  *
- * \param[in]  ref  pointer to reference halo
+ * Each rank's segment contains 2 send buffers, used alternately by
+ * successive synchronizations, so that a single node barrier is required
+ * per synchronization.
  *
- * \return  pointer to created cs_halo_t structure
- */
-/*----------------------------------------------------------------------------*/
+ * This is a collective operation over the halo's node communicator.
+ *
+ * parameters:
+ *   halo   <-- pointer to halo structure
+ *   stride <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
 
-cs_halo_t *
-cs_halo_create_from_ref(const cs_halo_t  *ref)
+static void
+_sh_window_update(const cs_halo_t  *halo,
+                  int               stride)
 {
-  cs_lnum_t  i;
+#if (MPI_VERSION >= 3)
 
-  cs_halo_t  *halo = NULL;
+  _cs_halo_p_comm_set_t  *pcs = halo->p_comm;
 
-  BFT_MALLOC(halo, 1, cs_halo_t);
+  if (pcs->sh_win != MPI_WIN_NULL && stride <= pcs->sh_stride)
+    return;
 
-  halo->n_c_domains = ref->n_c_domains;
-  halo->n_transforms = ref->n_transforms;
+  if (pcs->sh_win != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(pcs->sh_win);
+    MPI_Win_free(&(pcs->sh_win));
+  }
 
-  halo->periodicity = ref->periodicity;
-  halo->n_rotations = ref->n_rotations;
+  pcs->sh_stride = CS_MAX(stride, _cs_glob_halo_max_stride);
+  pcs->sh_parity = 0;
 
-  halo->n_local_elts = 0;
+  MPI_Aint n_vals = halo->n_send_elts[CS_HALO_EXTENDED] * pcs->sh_stride;
 
-  BFT_MALLOC(halo->c_domain_rank, halo->n_c_domains, int);
+  MPI_Info info;
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "alloc_shared_noncontig", "true");
 
-  for (i = 0; i < halo->n_c_domains; i++)
-    halo->c_domain_rank[i] = ref->c_domain_rank[i];
+  MPI_Win_allocate_shared(n_vals*2*sizeof(cs_real_t),
+                          sizeof(cs_real_t),
+                          info,
+                          pcs->sh_comm,
+                          &(pcs->sh_buffer),
+                          &(pcs->sh_win));
 
-  BFT_MALLOC(halo->send_index, 2*halo->n_c_domains + 1, cs_lnum_t);
-  BFT_MALLOC(halo->index, 2*halo->n_c_domains + 1, cs_lnum_t);
+  MPI_Info_free(&info);
+
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, pcs->sh_win);
+
+  pcs->sh_buffer_size = n_vals;
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    if (pcs->sh_rank[rank_id] < 0)
+      continue;
+
+    MPI_Aint seg_size;
+    int disp_unit;
+    cs_real_t *base;
+
+    MPI_Win_shared_query(pcs->sh_win, pcs->sh_rank[rank_id],
+                         &seg_size, &disp_unit, &base);
+
+    pcs->sh_base[rank_id] = base;
 
-  for (i = 0; i < 2*halo->n_c_domains + 1; i++) {
-    halo->send_index[i] = 0;
-    halo->index[i] = 0;
   }
 
-  halo->send_perio_lst = NULL;
-  halo->perio_lst = NULL;
+  /* Exchange send buffer size and start of values destined to each
+     node neighbor in its send buffer (segment sizes returned by
+     MPI_Win_shared_query may be rounded up, so are not usable here) */
 
-  if (halo->n_transforms > 0) {
+  int request_count = 0;
+  MPI_Request *request = NULL;
+  cs_lnum_t *send_info = NULL, *recv_info = NULL;
 
-    cs_lnum_t  perio_lst_size = 2*halo->n_transforms * 2*halo->n_c_domains;
+  BFT_MALLOC(request, halo->n_c_domains*2, MPI_Request);
+  BFT_MALLOC(send_info, halo->n_c_domains*4, cs_lnum_t);
+  recv_info = send_info + halo->n_c_domains*2;
 
-    BFT_MALLOC(halo->send_perio_lst, perio_lst_size, cs_lnum_t);
-    BFT_MALLOC(halo->perio_lst, perio_lst_size, cs_lnum_t);
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    if (pcs->sh_rank[rank_id] > -1)
+      MPI_Irecv(recv_info + 2*rank_id, 2, CS_MPI_LNUM,
+                pcs->sh_rank[rank_id], 0, pcs->sh_comm,
+                &(request[request_count++]));
+  }
 
-    for (i = 0; i < perio_lst_size; i++) {
-      halo->send_perio_lst[i] = 0;
-      halo->perio_lst[i] = 0;
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    if (pcs->sh_rank[rank_id] > -1) {
+      send_info[2*rank_id] = n_vals;
+      send_info[2*rank_id + 1] = halo->send_index[2*rank_id];
+      MPI_Isend(send_info + 2*rank_id, 2, CS_MPI_LNUM,
+                pcs->sh_rank[rank_id], 0, pcs->sh_comm,
+                &(request[request_count++]));
     }
+  }
+
+  MPI_Waitall(request_count, request, MPI_STATUSES_IGNORE);
 
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    if (pcs->sh_rank[rank_id] > -1) {
+      pcs->sh_seg_size[rank_id] = recv_info[2*rank_id];
+      pcs->sh_shift[rank_id] = recv_info[2*rank_id + 1];
+    }
   }
 
-  halo->send_list = NULL;
+  BFT_FREE(send_info);
+  BFT_FREE(request);
 
-  _cs_glob_n_halos += 1;
+#else
 
-  return halo;
-}
+  CS_UNUSED(halo);
+  CS_UNUSED(stride);
 
-#if defined(HAVE_MPI)
+#endif /* (MPI_VERSION >= 3) */
+}
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Create a halo structure from distant element distant ranks and ids.
- *
- * \remark  This function does not handle periodicity. For most matrix-vector,
- *          products and similar operations, periodicity of translation an
- *          even rotation could be handled with no specific halo information,
- *          simply by assigning an equivalence between two periodic elements.
- *          For rotation, this would require also applying a rotation through
- *          the matrix coefficients (this would have the advantage of being
- *          compatible with external libraries). An alternative would be
- *          to add rotation information to a given halo as a second stage,
- *          through a specialized operator which can be added in the future.
+/*----------------------------------------------------------------------------
+ * Free persistent communications cached for a halo.
  *
- * \param[in]  rn              associated rank neighbors info
- * \param[in]  n_local_elts    number of elements for local rank
- * \param[in]  n_distant_elts  number of distant elements for local rank
- * \param[in]  elt_rank_id     distant element rank index in rank neighbors,
- *                             ordered by rank (size: n_distant_elts)
- * \param[in]  elt_id          distant element id (at distant rank),
- *                             ordered by rank (size: n_distant_elts)
+ * The structure itself is kept, so that it may be reused.
  *
- * \return  pointer to created cs_halo_t structure
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   pcs <-> pointer to set of persistent communications
+ *----------------------------------------------------------------------------*/
 
-cs_halo_t *
-cs_halo_create_from_rank_neighbors(const cs_rank_neighbors_t  *rn,
+static void
+_p_comm_set_clear(_cs_halo_p_comm_set_t  *pcs)
+{
+  if (pcs == NULL)
+    return;
+
+  for (int i = 0; i < pcs->n_p_comm; i++) {
+    _cs_halo_p_comm_t  *pc = pcs->p_comm + i;
+    for (int j = 0; j < pc->n_requests; j++)
+      MPI_Request_free(pc->request + j);
+    BFT_FREE(pc->request);
+    BFT_FREE(pc->send_buffer);
+    BFT_FREE(pc->recv_buffer);
+  }
+
+  BFT_FREE(pcs->p_comm);
+  pcs->n_p_comm = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Return persistent communications matching a halo, synchronization mode,
+ * and stride, creating them if necessary.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   stride    <-- number of (interlaced) values by entity
+ *
+ * returns:
+ *   pointer to matching persistent communications
+ *----------------------------------------------------------------------------*/
+
+static _cs_halo_p_comm_t *
+_get_p_comm(const cs_halo_t  *halo,
+            cs_halo_type_t    sync_mode,
+            int               stride)
+{
+  _cs_halo_p_comm_set_t  *pcs = halo->p_comm;
+
+  assert(pcs != NULL);
+
+  for (int i = 0; i < pcs->n_p_comm; i++) {
+    if (   pcs->p_comm[i].sync_mode == sync_mode
+        && pcs->p_comm[i].stride == stride)
+      return pcs->p_comm + i;
+  }
+
+  BFT_REALLOC(pcs->p_comm, pcs->n_p_comm + 1, _cs_halo_p_comm_t);
+
+  _cs_halo_p_comm_t  *pc = pcs->p_comm + pcs->n_p_comm;
+  pcs->n_p_comm += 1;
+
+  const int local_rank = cs_glob_rank_id;
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+
+  pc->sync_mode = sync_mode;
+  pc->stride = stride;
+  pc->n_requests = 0;
+
+  BFT_MALLOC(pc->request, halo->n_c_domains*2, MPI_Request);
+  BFT_MALLOC(pc->send_buffer,
+             halo->n_send_elts[CS_HALO_EXTENDED]*stride,
+             cs_real_t);
+  BFT_MALLOC(pc->recv_buffer,
+             halo->n_elts[CS_HALO_EXTENDED]*stride,
+             cs_real_t);
+
+  /* Receives */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t start = halo->index[2*rank_id];
+    cs_lnum_t length = halo->index[2*rank_id + end_shift] - start;
+
+    if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
+      MPI_Recv_init(pc->recv_buffer + start*stride,
+                    length*stride,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    halo->c_domain_rank[rank_id],
+                    cs_glob_mpi_comm,
+                    &(pc->request[pc->n_requests++]));
+
+  }
+
+  /* Sends */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t start = halo->send_index[2*rank_id];
+    cs_lnum_t length = halo->send_index[2*rank_id + end_shift] - start;
+
+    if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
+      MPI_Send_init(pc->send_buffer + start*stride,
+                    length*stride,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    local_rank,
+                    cs_glob_mpi_comm,
+                    &(pc->request[pc->n_requests++]));
+
+  }
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------
+ * Assemble send buffer for halo exchange of strided values.
+ *
+ * Avoid threading for now, as dynamic scheduling led to slightly higher
+ * cost here, and even static scheduling might lead to false sharing
+ * for small halos.
+ *
+ * parameters:
+ *   halo         <-- pointer to halo structure
+ *   sync_mode    <-- synchronization mode (standard or extended)
+ *   var          <-- pointer to variable value array
+ *   stride       <-- number of (interlaced) values by entity
+ *   build_buffer --> send buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_pack_send_buffer(const cs_halo_t  *halo,
+                  cs_halo_type_t    sync_mode,
+                  const cs_real_t   var[],
+                  int               stride,
+                  cs_real_t         build_buffer[])
+{
+  cs_lnum_t i, j, start, length;
+
+  const int local_rank = cs_glob_rank_id;
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    if (halo->c_domain_rank[rank_id] != local_rank) {
+
+      start = halo->send_index[2*rank_id];
+      length = (  halo->send_index[2*rank_id + end_shift]
+                - halo->send_index[2*rank_id]);
+
+      if (stride == 1) {
+        for (i = 0; i < length; i++)
+          build_buffer[start + i] = var[halo->send_list[start + i]];
+      }
+      else if (stride == 3) { /* Unroll loop for this case */
+        for (i = 0; i < length; i++) {
+          build_buffer[(start + i)*3]
+            = var[(halo->send_list[start + i])*3];
+          build_buffer[(start + i)*3 + 1]
+            = var[(halo->send_list[start + i])*3 + 1];
+          build_buffer[(start + i)*3 + 2]
+            = var[(halo->send_list[start + i])*3 + 2];
+        }
+      }
+      else {
+        for (i = 0; i < length; i++) {
+          for (j = 0; j < stride; j++)
+            build_buffer[(start + i)*stride + j]
+              = var[(halo->send_list[start + i])*stride + j];
+        }
+      }
+
+    }
+
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a halo structure given an interface set.
+ *
+ * \param[in]  ifs  pointer to a cs_interface_set structure
+ *
+ * \return  pointer to created cs_halo_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_t *
+cs_halo_create(const cs_interface_set_t  *ifs)
+{
+  cs_lnum_t  i, tmp_id, perio_lst_size;
+
+  cs_lnum_t  loc_id = -1;
+
+  cs_halo_t  *halo = NULL;
+
+  const cs_interface_t  *interface = NULL;
+
+  BFT_MALLOC(halo, 1, cs_halo_t);
+
+  halo->n_c_domains = cs_interface_set_size(ifs);
+  halo->n_transforms = 0;
+
+  halo->periodicity = cs_interface_set_periodicity(ifs);
+  halo->n_rotations = 0;
+
+  halo->n_local_elts = 0;
+
+  for (i = 0; i < CS_HALO_N_TYPES; i++) {
+    halo->n_send_elts[i] = 0;
+    halo->n_elts [i] = 0;
+  }
+
+  BFT_MALLOC(halo->c_domain_rank, halo->n_c_domains, int);
+
+  /* Check if cs_glob_rank_id belongs to interface set in order to
+     order ranks with local rank at first place */
+
+  for (i = 0; i < halo->n_c_domains; i++) {
+
+    interface = cs_interface_set_get(ifs, i);
+    halo->c_domain_rank[i] = cs_interface_rank(interface);
+
+    if (cs_glob_rank_id == cs_interface_rank(interface))
+      loc_id = i;
+
+  } /* End of loop on ranks */
+
+  if (loc_id > 0) {
+
+    tmp_id = halo->c_domain_rank[loc_id];
+    halo->c_domain_rank[loc_id] = halo->c_domain_rank[0];
+    halo->c_domain_rank[0] = tmp_id;
+
+  }
+
+  /* Order ranks */
+
+  if (   halo->n_c_domains > 2
+      && _order_int_test(&(halo->c_domain_rank[1]),
+                         halo->n_c_domains-1) == 0) {
+
+    cs_lnum_t  *order = NULL;
+    cs_gnum_t  *buffer = NULL;
+
+    BFT_MALLOC(order, halo->n_c_domains - 1, cs_lnum_t);
+    BFT_MALLOC(buffer, halo->n_c_domains - 1, cs_gnum_t);
+
+    for (i = 1; i < halo->n_c_domains; i++)
+      buffer[i-1] = (cs_gnum_t)halo->c_domain_rank[i];
+
+    cs_order_gnum_allocated(NULL,
+                            buffer,
+                            order,
+                            halo->n_c_domains - 1);
+
+    for (i = 0; i < halo->n_c_domains - 1; i++)
+      halo->c_domain_rank[i+1] = (cs_lnum_t)buffer[order[i]];
+
+    BFT_FREE(buffer);
+    BFT_FREE(order);
+
+  } /* End of ordering ranks */
+
+  BFT_MALLOC(halo->send_index, 2*halo->n_c_domains + 1, cs_lnum_t);
+  BFT_MALLOC(halo->index, 2*halo->n_c_domains + 1, cs_lnum_t);
+
+  for (i = 0; i < 2*halo->n_c_domains + 1; i++) {
+    halo->send_index[i] = 0;
+    halo->index[i] = 0;
+  }
+
+  halo->send_perio_lst = NULL;
+  halo->perio_lst = NULL;
+
+  if (halo->periodicity != NULL) {
+
+    halo->n_transforms = fvm_periodicity_get_n_transforms(halo->periodicity);
+
+    for (i = 0; i < halo->n_transforms; i++) {
+      if (   fvm_periodicity_get_type(halo->periodicity, i)
+          >= FVM_PERIODICITY_ROTATION)
+        halo->n_rotations += 1;
+    }
+
+    /* We need 2 values per transformation and there are n_transforms
+       transformations. For each rank, we need a value for standard and
+       extended halo. */
+
+    perio_lst_size = 2*halo->n_transforms * 2*halo->n_c_domains;
+
+    BFT_MALLOC(halo->send_perio_lst, perio_lst_size, cs_lnum_t);
+    BFT_MALLOC(halo->perio_lst, perio_lst_size, cs_lnum_t);
+
+    for (i = 0; i < perio_lst_size; i++) {
+      halo->send_perio_lst[i] = 0;
+      halo->perio_lst[i] = 0;
+    }
+
+  }
+
+  halo->send_list = NULL;
+
+#if defined(HAVE_MPI)
+  halo->p_comm = _p_comm_set_create();
+
+  /* Halo creation from an interface set is collective, so the
+     graph communicator may safely be built here */
+
+  if (cs_glob_n_ranks > 1 && _cs_glob_halo_use_ngb_coll)
+    _p_comm_set_build_ngb_comm(halo);
+
+  if (cs_glob_n_ranks > 1 && _cs_glob_halo_use_shared_memory)
+    _p_comm_set_build_sh_comm(halo);
+#else
+  halo->p_comm = NULL;
+#endif
+
+  _cs_glob_n_halos += 1;
+
+  return halo;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a halo structure, given a reference halo.
+ *
+ * \param[in]  ref  pointer to reference halo
+ *
+ * \return  pointer to created cs_halo_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_t *
+cs_halo_create_from_ref(const cs_halo_t  *ref)
+{
+  cs_lnum_t  i;
+
+  cs_halo_t  *halo = NULL;
+
+  BFT_MALLOC(halo, 1, cs_halo_t);
+
+  halo->n_c_domains = ref->n_c_domains;
+  halo->n_transforms = ref->n_transforms;
+
+  halo->periodicity = ref->periodicity;
+  halo->n_rotations = ref->n_rotations;
+
+  halo->n_local_elts = 0;
+
+  BFT_MALLOC(halo->c_domain_rank, halo->n_c_domains, int);
+
+  for (i = 0; i < halo->n_c_domains; i++)
+    halo->c_domain_rank[i] = ref->c_domain_rank[i];
+
+  BFT_MALLOC(halo->send_index, 2*halo->n_c_domains + 1, cs_lnum_t);
+  BFT_MALLOC(halo->index, 2*halo->n_c_domains + 1, cs_lnum_t);
+
+  for (i = 0; i < 2*halo->n_c_domains + 1; i++) {
+    halo->send_index[i] = 0;
+    halo->index[i] = 0;
+  }
+
+  halo->send_perio_lst = NULL;
+  halo->perio_lst = NULL;
+
+  if (halo->n_transforms > 0) {
+
+    cs_lnum_t  perio_lst_size = 2*halo->n_transforms * 2*halo->n_c_domains;
+
+    BFT_MALLOC(halo->send_perio_lst, perio_lst_size, cs_lnum_t);
+    BFT_MALLOC(halo->perio_lst, perio_lst_size, cs_lnum_t);
+
+    for (i = 0; i < perio_lst_size; i++) {
+      halo->send_perio_lst[i] = 0;
+      halo->perio_lst[i] = 0;
+    }
+
+  }
+
+  halo->send_list = NULL;
+
+#if defined(HAVE_MPI)
+  halo->p_comm = _p_comm_set_create();
+#else
+  halo->p_comm = NULL;
+#endif
+
+  _cs_glob_n_halos += 1;
+
+  return halo;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a halo structure from distant element distant ranks and ids.
+ *
+ * \remark  This function does not handle periodicity. For most matrix-vector,
+ *          products and similar operations, periodicity of translation an
+ *          even rotation could be handled with no specific halo information,
+ *          simply by assigning an equivalence between two periodic elements.
+ *          For rotation, this would require also applying a rotation through
+ *          the matrix coefficients (this would have the advantage of being
+ *          compatible with external libraries). An alternative would be
+ *          to add rotation information to a given halo as a second stage,
+ *          through a specialized operator which can be added in the future.
+ *
+ * \param[in]  rn              associated rank neighbors info
+ * \param[in]  n_local_elts    number of elements for local rank
+ * \param[in]  n_distant_elts  number of distant elements for local rank
+ * \param[in]  elt_rank_id     distant element rank index in rank neighbors,
+ *                             ordered by rank (size: n_distant_elts)
+ * \param[in]  elt_id          distant element id (at distant rank),
+ *                             ordered by rank (size: n_distant_elts)
+ *
+ * \return  pointer to created cs_halo_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_t *
+cs_halo_create_from_rank_neighbors(const cs_rank_neighbors_t  *rn,
                                    cs_lnum_t                   n_local_elts,
                                    cs_lnum_t                   n_distant_elts,
                                    const int                   elt_rank_id[],
@@ -776,6 +1396,12 @@ cs_halo_create_from_rank_neighbors(const cs_rank_neighbors_t  *rn,
   BFT_FREE(request);
   BFT_FREE(status);
 
+#if defined(HAVE_MPI)
+  halo->p_comm = _p_comm_set_create();
+#else
+  halo->p_comm = NULL;
+#endif
+
   _cs_glob_n_halos += 1;
 
   return halo;
@@ -811,6 +1437,13 @@ cs_halo_destroy(cs_halo_t  **halo)
 
   BFT_FREE(_halo->send_list);
 
+#if defined(HAVE_MPI)
+  _p_comm_set_clear(_halo->p_comm);
+  _p_comm_set_free_ngb_comm(_halo->p_comm);
+  _p_comm_set_free_sh_comm(_halo->p_comm);
+#endif
+  BFT_FREE(_halo->p_comm);
+
   BFT_FREE(*halo);
 
   _cs_glob_n_halos -= 1;
@@ -977,6 +1610,12 @@ cs_halo_renumber_ghost_cells(cs_halo_t        *halo,
   if (halo == NULL)
     return;
 
+  /* Cached persistent requests are rebuilt on next use */
+
+#if defined(HAVE_MPI)
+  _p_comm_set_clear(halo->p_comm);
+#endif
+
   /* Reverse update from distant cells */
 
   cs_lnum_t *send_buf, *recv_buf;
@@ -1059,8 +1698,13 @@ cs_halo_renumber_ghost_cells(cs_halo_t        *halo,
 
     /* Wait for all exchanges */
 
+    cs_timer_t t0 = cs_timer_time();
+
     MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
 
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_stats_add_mpi_wait("halo exchange wait", &t0, &t1);
+
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1251,7 +1895,12 @@ cs_halo_sync_untyped(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
+    cs_timer_t t0 = cs_timer_time();
+
     MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_stats_add_mpi_wait("halo exchange wait", &t0, &t1);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1390,7 +2039,12 @@ cs_halo_sync_num(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
+    cs_timer_t t0 = cs_timer_time();
+
     MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_stats_add_mpi_wait("halo exchange wait", &t0, &t1);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1417,78 +2071,151 @@ cs_halo_sync_num(const cs_halo_t  *halo,
 }
 
 /*----------------------------------------------------------------------------
- * Update array of variable (floating-point) halo values in case of
- * parallelism or periodicity.
+ * Start update of array of strided variable (floating-point) halo values
+ * in case of parallelism or periodicity.
  *
- * This function aims at copying main values from local elements
- * (id between 1 and n_local_elements) to ghost elements on distant ranks
- * (id between n_local_elements + 1 to n_local_elements_with_halo).
+ * This function posts the receives and sends of a halo synchronization,
+ * and returns without waiting for their completion, so that computations
+ * which do not depend on ghost values may be overlapped with the exchange.
+ * It must be followed by a call to cs_halo_sync_wait() with the same
+ * arguments before ghost values are used, or the send buffer reused.
+ *
+ * As the send buffer and requests are shared by all halos, only one
+ * such split synchronization may be pending at a given time.
  *
  * parameters:
  *   halo      <-- pointer to halo structure
  *   sync_mode <-- synchronization mode (standard or extended)
  *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
  *----------------------------------------------------------------------------*/
 
 void
-cs_halo_sync_var(const cs_halo_t  *halo,
-                 cs_halo_type_t    sync_mode,
-                 cs_real_t         var[])
+cs_halo_sync_start(const cs_halo_t  *halo,
+                   cs_halo_type_t    sync_mode,
+                   cs_real_t         var[],
+                   int               stride)
 {
-  cs_lnum_t i, start, length;
-
-  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
-  const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+  if (stride > _cs_glob_halo_max_stride) {
+    _cs_glob_halo_max_stride = stride;
+    cs_halo_update_buffers(halo);
+  }
 
 #if defined(HAVE_MPI)
 
-  if (cs_glob_n_ranks > 1) {
+  assert(_cs_glob_halo_request_count == 0);
+  assert(_cs_glob_halo_p_comm_pending == NULL);
+  assert(_cs_glob_halo_ngb_pending == false);
+  assert(_cs_glob_halo_sh_pending == NULL);
+
+  _cs_halo_p_comm_set_t  *pcs = halo->p_comm;
+
+#if (MPI_VERSION >= 3)
+
+  if (   cs_glob_n_ranks > 1 && _cs_glob_halo_use_ngb_coll
+      && pcs != NULL && pcs->ngb_comm != MPI_COMM_NULL) {
+
+    cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
+    const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+
+    const int n_ngb = pcs->n_ngb;
+    int *s_count = pcs->ngb_count;
+    int *s_displ = pcs->ngb_count + n_ngb;
+    int *r_count = pcs->ngb_count + n_ngb*2;
+    int *r_displ = pcs->ngb_count + n_ngb*3;
+
+    for (int i = 0; i < n_ngb; i++) {
+      int rank_id = pcs->ngb_rank_id[i];
+      s_displ[i] = halo->send_index[2*rank_id] * stride;
+      s_count[i] = halo->send_index[2*rank_id + end_shift]*stride - s_displ[i];
+      r_displ[i] = halo->index[2*rank_id] * stride;
+      r_count[i] = halo->index[2*rank_id + end_shift]*stride - r_displ[i];
+    }
+
+    _pack_send_buffer(halo, sync_mode, var, stride, build_buffer);
+
+    /* Receive directly into ghost values */
+
+    MPI_Ineighbor_alltoallv(build_buffer, s_count, s_displ, CS_MPI_REAL,
+                            var + halo->n_local_elts*stride,
+                            r_count, r_displ, CS_MPI_REAL,
+                            pcs->ngb_comm,
+                            &_cs_glob_halo_ngb_request);
+
+    _cs_glob_halo_ngb_pending = true;
+
+  }
+
+  else
+
+#endif /* (MPI_VERSION >= 3) */
+
+  if (cs_glob_n_ranks > 1 && _cs_glob_halo_use_persistent) {
+
+    _cs_halo_p_comm_t  *pc = _get_p_comm(halo, sync_mode, stride);
+
+    _pack_send_buffer(halo, sync_mode, var, stride, pc->send_buffer);
+
+    MPI_Startall(pc->n_requests, pc->request);
+
+    _cs_glob_halo_p_comm_pending = pc;
 
+  }
+
+  else if (cs_glob_n_ranks > 1) {
+
+    cs_lnum_t start, length;
     int rank_id;
     int request_count = 0;
     cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
+    cs_real_t *buffer = NULL;
     const int local_rank = cs_glob_rank_id;
+    const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+
+    /* Values for ranks on the same node are exchanged through
+       the shared-memory window, in which the send buffer is built */
+
+    const int *sh_rank = NULL;
+
+    if (pcs != NULL && pcs->sh_comm != MPI_COMM_NULL) {
+      _sh_window_update(halo, stride);
+      sh_rank = pcs->sh_rank;
+      build_buffer = pcs->sh_buffer + pcs->sh_parity*pcs->sh_buffer_size;
+      _cs_glob_halo_sh_pending = pcs;
+    }
 
     /* Receive data from distant ranks */
 
     for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
-      start = halo->index[2*rank_id];
-      length = halo->index[2*rank_id + end_shift] - halo->index[2*rank_id];
+      length = (  halo->index[2*rank_id + end_shift]
+                - halo->index[2*rank_id]) * stride;
+
+      if (sh_rank != NULL && sh_rank[rank_id] > -1)
+        continue;
 
       if (halo->c_domain_rank[rank_id] != local_rank) {
-        if (length > 0)
-          MPI_Irecv(var + halo->n_local_elts + start,
+
+        if (length > 0) {
+
+          buffer = var + (halo->n_local_elts + halo->index[2*rank_id])*stride;
+
+          MPI_Irecv(buffer,
                     length,
                     CS_MPI_REAL,
                     halo->c_domain_rank[rank_id],
                     halo->c_domain_rank[rank_id],
                     cs_glob_mpi_comm,
                     &(_cs_glob_halo_request[request_count++]));
+
+        }
       }
-      else
-        local_rank_id = rank_id;
 
     }
 
-    /* Assemble buffers for halo exchange; avoid threading for now, as dynamic
-       scheduling led to slightly higher cost here, and even static scheduling
-       might lead to false sharing for small halos. */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        start = halo->send_index[2*rank_id];
-        length =   halo->send_index[2*rank_id + end_shift]
-                 - halo->send_index[2*rank_id];
-
-        for (i = 0; i < length; i++)
-          build_buffer[start + i] = var[halo->send_list[start + i]];
-
-      }
+    /* Assemble buffers for halo exchange */
 
-    }
+    _pack_send_buffer(halo, sync_mode, var, stride, build_buffer);
 
     /* We wait for posting all receives (often recommended) */
 
@@ -1499,15 +2226,20 @@ cs_halo_sync_var(const cs_halo_t  *halo,
 
     for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
+      if (sh_rank != NULL && sh_rank[rank_id] > -1)
+        continue;
+
+      /* If this is not the local rank */
+
       if (halo->c_domain_rank[rank_id] != local_rank) {
 
         start = halo->send_index[2*rank_id];
-        length =   halo->send_index[2*rank_id + end_shift]
-                 - halo->send_index[2*rank_id];
+        length = (  halo->send_index[2*rank_id + end_shift]
+                  - halo->send_index[2*rank_id]);
 
         if (length > 0)
-          MPI_Isend(build_buffer + start,
-                    length,
+          MPI_Isend(build_buffer + start*stride,
+                    length*stride,
                     CS_MPI_REAL,
                     halo->c_domain_rank[rank_id],
                     local_rank,
@@ -1518,41 +2250,23 @@ cs_halo_sync_var(const cs_halo_t  *halo,
 
     }
 
-    /* Wait for all exchanges */
-
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    _cs_glob_halo_request_count = request_count;
   }
 
-#endif /* defined(HAVE_MPI) */
-
-  /* Copy local values in case of periodicity */
-
-  if (halo->n_transforms > 0) {
-
-    if (local_rank_id > -1) {
-
-      cs_real_t *recv_var
-        = var + halo->n_local_elts + halo->index[2*local_rank_id];
-
-      start = halo->send_index[2*local_rank_id];
-      length =   halo->send_index[2*local_rank_id + end_shift]
-               - halo->send_index[2*local_rank_id];
-
-      for (i = 0; i < length; i++)
-        recv_var[i] = var[halo->send_list[start + i]];
+#else
 
-    }
+  CS_UNUSED(sync_mode);
+  CS_UNUSED(var);
 
-  }
+#endif /* defined(HAVE_MPI) */
 }
 
 /*----------------------------------------------------------------------------
- * Update array of strided variable (floating-point) values in case
- * of parallelism or periodicity.
+ * Complete update of array of strided variable (floating-point) halo values
+ * in case of parallelism or periodicity.
  *
- * This function aims at copying main values from local elements
- * (id between 1 and n_local_elements) to ghost elements on distant ranks
- * (id between n_local_elements + 1 to n_local_elements_with_halo).
+ * This function waits for the exchanges posted by cs_halo_sync_start(),
+ * and copies local values to ghost elements in case of periodicity.
  *
  * parameters:
  *   halo      <-- pointer to halo structure
@@ -1562,131 +2276,127 @@ cs_halo_sync_var(const cs_halo_t  *halo,
  *----------------------------------------------------------------------------*/
 
 void
-cs_halo_sync_var_strided(const cs_halo_t  *halo,
-                         cs_halo_type_t    sync_mode,
-                         cs_real_t         var[],
-                         int               stride)
+cs_halo_sync_wait(const cs_halo_t  *halo,
+                  cs_halo_type_t    sync_mode,
+                  cs_real_t         var[],
+                  int               stride)
 {
   cs_lnum_t i, j, start, length;
 
-  cs_lnum_t end_shift = 0;
   int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
 
-  if (stride > _cs_glob_halo_max_stride)
-    _cs_glob_halo_max_stride = stride;
-  cs_halo_update_buffers(halo);
+#if defined(HAVE_MPI)
 
-  if (sync_mode == CS_HALO_STANDARD)
-    end_shift = 1;
+  if (cs_glob_n_ranks > 1 && _cs_glob_halo_ngb_pending) {
 
-  else if (sync_mode == CS_HALO_EXTENDED)
-    end_shift = 2;
+    MPI_Wait(&_cs_glob_halo_ngb_request, MPI_STATUS_IGNORE);
 
-#if defined(HAVE_MPI)
+    _cs_glob_halo_ngb_pending = false;
 
-  if (cs_glob_n_ranks > 1) {
+  }
 
-    int rank_id;
-    int request_count = 0;
-    cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
-    cs_real_t *buffer = NULL;
-    const int local_rank = cs_glob_rank_id;
+  else if (cs_glob_n_ranks > 1 && _cs_glob_halo_p_comm_pending != NULL) {
 
-    /* Receive data from distant ranks */
+    _cs_halo_p_comm_t  *pc = _cs_glob_halo_p_comm_pending;
 
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    assert(pc->sync_mode == sync_mode && pc->stride == stride);
 
-      length = (  halo->index[2*rank_id + end_shift]
-                - halo->index[2*rank_id]) * stride;
+    cs_timer_t t0 = cs_timer_time();
 
-      if (halo->c_domain_rank[rank_id] != local_rank) {
+    MPI_Waitall(pc->n_requests, pc->request, MPI_STATUSES_IGNORE);
 
-        if (length > 0) {
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_stats_add_mpi_wait("halo exchange wait", &t0, &t1);
 
-          buffer = var + (halo->n_local_elts + halo->index[2*rank_id])*stride;
+    _cs_glob_halo_p_comm_pending = NULL;
 
-          MPI_Irecv(buffer,
-                    length,
-                    CS_MPI_REAL,
-                    halo->c_domain_rank[rank_id],
-                    halo->c_domain_rank[rank_id],
-                    cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
+    /* Copy received values to ghost elements */
 
-        }
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != cs_glob_rank_id) {
+        start = halo->index[2*rank_id];
+        length = halo->index[2*rank_id + end_shift] - start;
+        memcpy(var + (halo->n_local_elts + start)*stride,
+               pc->recv_buffer + start*stride,
+               length*stride*sizeof(cs_real_t));
       }
-      else
-        local_rank_id = rank_id;
 
     }
 
-    /* Assemble buffers for halo exchange; avoid threading for now, as dynamic
-       scheduling led to slightly higher cost here, and even static scheduling
-       might lead to false sharing for small halos. */
+  }
 
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+  else if (cs_glob_n_ranks > 1) {
 
-      if (halo->c_domain_rank[rank_id] != local_rank) {
+    /* Wait for all exchanges */
 
-        start = halo->send_index[2*rank_id];
-        length = (  halo->send_index[2*rank_id + end_shift]
-                  - halo->send_index[2*rank_id]);
+    cs_timer_t t0 = cs_timer_time();
 
-        if (stride == 3) { /* Unroll loop for this case */
-          for (i = 0; i < length; i++) {
-            build_buffer[(start + i)*3]
-              = var[(halo->send_list[start + i])*3];
-            build_buffer[(start + i)*3 + 1]
-              = var[(halo->send_list[start + i])*3 + 1];
-            build_buffer[(start + i)*3 + 2]
-              = var[(halo->send_list[start + i])*3 + 2];
-          }
-        }
-        else {
-          for (i = 0; i < length; i++) {
-            for (j = 0; j < stride; j++)
-              build_buffer[(start + i)*stride + j]
-                = var[(halo->send_list[start + i])*stride + j];
-          }
-        }
+    MPI_Waitall(_cs_glob_halo_request_count,
+                _cs_glob_halo_request,
+                _cs_glob_halo_status);
 
-      }
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_stats_add_mpi_wait("halo exchange wait", &t0, &t1);
 
-    }
+    _cs_glob_halo_request_count = 0;
 
-    /* We wait for posting all receives (often recommended) */
+    /* Copy values from send buffers of ranks on the same node,
+       once all of those are assembled */
 
-    if (_cs_glob_halo_use_barrier)
-      MPI_Barrier(cs_glob_mpi_comm);
+    if (_cs_glob_halo_sh_pending != NULL) {
 
-    /* Send data to distant ranks */
+      _cs_halo_p_comm_set_t  *pcs = _cs_glob_halo_sh_pending;
 
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+      assert(pcs == halo->p_comm);
 
-      /* If this is not the local rank */
+#if (MPI_VERSION >= 3)
 
-      if (halo->c_domain_rank[rank_id] != local_rank) {
+      t0 = cs_timer_time();
 
-        start = halo->send_index[2*rank_id];
-        length = (  halo->send_index[2*rank_id + end_shift]
-                  - halo->send_index[2*rank_id]);
+      MPI_Win_sync(pcs->sh_win);
+      MPI_Barrier(pcs->sh_comm);
+      MPI_Win_sync(pcs->sh_win);
 
-        if (length > 0)
-          MPI_Isend(build_buffer + start*stride,
-                    length*stride,
-                    CS_MPI_REAL,
-                    halo->c_domain_rank[rank_id],
-                    local_rank,
-                    cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
+      t1 = cs_timer_time();
+      cs_timer_stats_add_mpi_wait("halo exchange wait", &t0, &t1);
+
+#endif
+
+      for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+        if (pcs->sh_rank[rank_id] < 0)
+          continue;
+
+        start = halo->index[2*rank_id];
+        length = halo->index[2*rank_id + end_shift] - start;
+
+        const cs_real_t *src
+          =   pcs->sh_base[rank_id]
+            + pcs->sh_parity*pcs->sh_seg_size[rank_id]
+            + pcs->sh_shift[rank_id]*stride;
+
+        memcpy(var + (halo->n_local_elts + start)*stride,
+               src,
+               length*stride*sizeof(cs_real_t));
 
       }
 
+      pcs->sh_parity = 1 - pcs->sh_parity;
+
+      _cs_glob_halo_sh_pending = NULL;
+
     }
+  }
 
-    /* Wait for all exchanges */
+  /* Local rank may also appear in halo in case of periodicity */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+  if (cs_glob_n_ranks > 1) {
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+      if (halo->c_domain_rank[rank_id] == cs_glob_rank_id)
+        local_rank_id = rank_id;
+    }
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1704,7 +2414,11 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
       length =   halo->send_index[2*local_rank_id + end_shift]
                - halo->send_index[2*local_rank_id];
 
-      if (stride == 3) { /* Unroll loop for this case */
+      if (stride == 1) {
+        for (i = 0; i < length; i++)
+          recv_var[i] = var[halo->send_list[start + i]];
+      }
+      else if (stride == 3) { /* Unroll loop for this case */
         for (i = 0; i < length; i++) {
           recv_var[i*3]     = var[(halo->send_list[start + i])*3];
           recv_var[i*3 + 1] = var[(halo->send_list[start + i])*3 + 1];
@@ -1724,6 +2438,58 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Update array of variable (floating-point) halo values in case of
+ * parallelism or periodicity.
+ *
+ * This function aims at copying main values from local elements
+ * (id between 1 and n_local_elements) to ghost elements on distant ranks
+ * (id between n_local_elements + 1 to n_local_elements_with_halo).
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_var(const cs_halo_t  *halo,
+                 cs_halo_type_t    sync_mode,
+                 cs_real_t         var[])
+{
+  cs_halo_sync_start(halo, sync_mode, var, 1);
+  cs_halo_sync_wait(halo, sync_mode, var, 1);
+}
+
+/*----------------------------------------------------------------------------
+ * Update array of strided variable (floating-point) values in case
+ * of parallelism or periodicity.
+ *
+ * This function aims at copying main values from local elements
+ * (id between 1 and n_local_elements) to ghost elements on distant ranks
+ * (id between n_local_elements + 1 to n_local_elements_with_halo).
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_var_strided(const cs_halo_t  *halo,
+                         cs_halo_type_t    sync_mode,
+                         cs_real_t         var[],
+                         int               stride)
+{
+  if (stride > _cs_glob_halo_max_stride)
+    _cs_glob_halo_max_stride = stride;
+  cs_halo_update_buffers(halo);
+
+  cs_halo_sync_start(halo, sync_mode, var, stride);
+  cs_halo_sync_wait(halo, sync_mode, var, stride);
+}
+
 /*----------------------------------------------------------------------------
  * Update array of vector variable component (floating-point) halo values
  * in case of parallelism or periodicity.
@@ -1847,6 +2613,125 @@ cs_halo_set_use_barrier(bool use_barrier)
   _cs_glob_halo_use_barrier = use_barrier;
 }
 
+/*----------------------------------------------------------------------------
+ * Return persistent communications usage flag.
+ *
+ * returns:
+ *   true if persistent MPI requests are used for halo synchronization,
+ *   false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_persistent(void)
+{
+  return _cs_glob_halo_use_persistent;
+}
+
+/*----------------------------------------------------------------------------
+ * Set persistent communications usage flag.
+ *
+ * When enabled, persistent MPI requests and associated buffers are built
+ * on first use for each halo, synchronization mode, and stride, and reused
+ * (using MPI_Startall) for subsequent synchronizations of that type.
+ *
+ * parameters:
+ *   use_persistent <-- true if persistent MPI requests should be used
+ *                      for halo synchronization, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_persistent(bool use_persistent)
+{
+  _cs_glob_halo_use_persistent = use_persistent;
+}
+
+/*----------------------------------------------------------------------------
+ * Return MPI neighborhood collectives usage flag.
+ *
+ * returns:
+ *   true if MPI neighborhood collectives are used for halo synchronization,
+ *   false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_neighbor_collectives(void)
+{
+  return _cs_glob_halo_use_ngb_coll;
+}
+
+/*----------------------------------------------------------------------------
+ * Set MPI neighborhood collectives usage flag.
+ *
+ * When enabled (and MPI 3 or above is available), a distributed graph
+ * communicator is built for each halo created from an interface set
+ * (such as the main mesh halo), and MPI_Ineighbor_alltoallv is used
+ * for its synchronizations. As building that communicator is collective,
+ * this must be set before the halo is created; other halos (such as
+ * coarse multigrid level halos) keep using point-to-point exchanges.
+ *
+ * This takes precedence over persistent communications.
+ *
+ * parameters:
+ *   use_ngb_coll <-- true if MPI neighborhood collectives should be used
+ *                    for halo synchronization, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_neighbor_collectives(bool use_ngb_coll)
+{
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+  _cs_glob_halo_use_ngb_coll = use_ngb_coll;
+#else
+  _cs_glob_halo_use_ngb_coll = false;
+  CS_UNUSED(use_ngb_coll);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Return MPI shared-memory windows usage flag.
+ *
+ * returns:
+ *   true if MPI shared-memory windows are used for halo synchronization
+ *   with ranks on the same node, false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_shared_memory(void)
+{
+  return _cs_glob_halo_use_shared_memory;
+}
+
+/*----------------------------------------------------------------------------
+ * Set MPI shared-memory windows usage flag.
+ *
+ * When enabled (and MPI 3 or above is available), the ranks of each halo
+ * created from an interface set (such as the main mesh halo) which are
+ * on the same node as the local rank are determined at creation, and
+ * point-to-point exchanges with those ranks are replaced by copies from
+ * an MPI shared-memory window in which send buffers are assembled,
+ * synchronized by a node barrier. As this is collective, it must be set
+ * before the halo is created; other halos keep using point-to-point
+ * exchanges.
+ *
+ * This is used by the point-to-point exchange path only, so neighborhood
+ * collectives and persistent communications take precedence.
+ *
+ * parameters:
+ *   use_shared_memory <-- true if MPI shared-memory windows should be used
+ *                         for halo synchronization, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_shared_memory(bool use_shared_memory)
+{
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+  _cs_glob_halo_use_shared_memory = use_shared_memory;
+#else
+  _cs_glob_halo_use_shared_memory = false;
+  CS_UNUSED(use_shared_memory);
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
@@ -83,6 +83,9 @@ typedef struct {
 
   cs_lnum_t  n_local_elts;   /* Number of local elements */
 
+  void      *p_comm;         /* Cached persistent communication requests
+                                and buffers (private) */
+
   /* send_halo features : send to distant ranks */
 
   cs_lnum_t  n_send_elts[2];   /* Numer of ghost elements in send_list
@@ -332,6 +335,52 @@ cs_halo_sync_num(const cs_halo_t  *halo,
                  cs_halo_type_t    sync_mode,
                  cs_lnum_t         num[]);
 
+/*----------------------------------------------------------------------------
+ * Start update of array of strided variable (floating-point) halo values
+ * in case of parallelism or periodicity.
+ *
+ * This function posts the receives and sends of a halo synchronization,
+ * and returns without waiting for their completion, so that computations
+ * which do not depend on ghost values may be overlapped with the exchange.
+ * It must be followed by a call to cs_halo_sync_wait() with the same
+ * arguments before ghost values are used, or the send buffer reused.
+ *
+ * As the send buffer and requests are shared by all halos, only one
+ * such split synchronization may be pending at a given time.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_start(const cs_halo_t  *halo,
+                   cs_halo_type_t    sync_mode,
+                   cs_real_t         var[],
+                   int               stride);
+
+/*----------------------------------------------------------------------------
+ * Complete update of array of strided variable (floating-point) halo values
+ * in case of parallelism or periodicity.
+ *
+ * This function waits for the exchanges posted by cs_halo_sync_start(),
+ * and copies local values to ghost elements in case of periodicity.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_wait(const cs_halo_t  *halo,
+                  cs_halo_type_t    sync_mode,
+                  cs_real_t         var[],
+                  int               stride);
+
 /*----------------------------------------------------------------------------
  * Update array of variable (floating-point) halo values in case of
  * parallelism or periodicity.
@@ -460,6 +509,93 @@ cs_halo_get_use_barrier(void);
 void
 cs_halo_set_use_barrier(bool use_barrier);
 
+/*----------------------------------------------------------------------------
+ * Return persistent communications usage flag.
+ *
+ * returns:
+ *   true if persistent MPI requests are used for halo synchronization,
+ *   false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_persistent(void);
+
+/*----------------------------------------------------------------------------
+ * Set persistent communications usage flag.
+ *
+ * When enabled, persistent MPI requests and associated buffers are built
+ * on first use for each halo, synchronization mode, and stride, and reused
+ * (using MPI_Startall) for subsequent synchronizations of that type.
+ *
+ * parameters:
+ *   use_persistent <-- true if persistent MPI requests should be used
+ *                      for halo synchronization, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_persistent(bool use_persistent);
+
+/*----------------------------------------------------------------------------
+ * Return MPI neighborhood collectives usage flag.
+ *
+ * returns:
+ *   true if MPI neighborhood collectives are used for halo synchronization,
+ *   false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_neighbor_collectives(void);
+
+/*----------------------------------------------------------------------------
+ * Set MPI neighborhood collectives usage flag.
+ *
+ * When enabled (and MPI 3 or above is available), a distributed graph
+ * communicator is built for each halo created from an interface set
+ * (such as the main mesh halo), and MPI_Ineighbor_alltoallv is used
+ * for its synchronizations. As building that communicator is collective,
+ * this must be set before the halo is created; other halos (such as
+ * coarse multigrid level halos) keep using point-to-point exchanges.
+ *
+ * This takes precedence over persistent communications.
+ *
+ * parameters:
+ *   use_ngb_coll <-- true if MPI neighborhood collectives should be used
+ *                    for halo synchronization, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_neighbor_collectives(bool use_ngb_coll);
+
+/*----------------------------------------------------------------------------
+ * Return MPI shared-memory windows usage flag.
+ *
+ * returns:
+ *   true if MPI shared-memory windows are used for halo synchronization
+ *   with ranks on the same node, false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_shared_memory(void);
+
+/*----------------------------------------------------------------------------
+ * Set MPI shared-memory windows usage flag.
+ *
+ * When enabled (and MPI 3 or above is available), point-to-point
+ * exchanges with ranks on the same node are replaced by copies from an
+ * MPI shared-memory window for halos created from an interface set
+ * (such as the main mesh halo). As this is collective, it must be set
+ * before the halo is created.
+ *
+ * Neighborhood collectives and persistent communications take precedence.
+ *
+ * parameters:
+ *   use_shared_memory <-- true if MPI shared-memory windows should be used
+ *                         for halo synchronization, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_shared_memory(bool use_shared_memory);
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
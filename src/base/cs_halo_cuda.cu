@@ -0,0 +1,506 @@
+/*============================================================================
+ * Halo exchange for device-resident arrays (CUDA)
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#if defined(OMPI_MAJOR_VERSION)
+#include <mpi-ext.h>
+#endif
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_base.h"
+#include "cs_base_cuda.h"
+#include "cs_halo.h"
+#include "cs_timer.h"
+#include "cs_timer_stats.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_halo_cuda.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_halo_cuda.cu
+        Halo exchange for device-resident arrays.
+
+  Values to send are gathered on the device based on a device copy of the
+  halo's send list. With a CUDA-aware MPI library, they are sent directly
+  from device memory, and received directly in the ghost section of the
+  device array. Otherwise, only the packed send buffer and the received
+  ghost values are staged through pinned host buffers, never the whole
+  array.
+
+  Received values are copied to the device asynchronously on the helper's
+  stream, so kernels queued later on that stream may run without the host
+  waiting for the end of the copy.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+#define CS_HALO_CUDA_BLOCK_SIZE 256
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/* Device halo exchange helper */
+
+struct _cs_halo_cuda_t {
+
+  const cs_halo_t   *halo;          /* Pointer to host halo */
+
+  cudaStream_t       stream;        /* Associated stream */
+
+  cs_lnum_t          n_send;        /* Number of values to send
+                                       (standard + extended) */
+  cs_lnum_t         *send_list;     /* Elements to send (on device) */
+  cs_real_t         *send_buf;      /* Send buffer (on device) */
+
+  cs_real_t         *h_send_buf;    /* Send buffer (host, pinned),
+                                       for host-staged exchanges */
+  cs_real_t         *h_recv_buf;    /* Receive buffer (host, pinned),
+                                       for host-staged exchanges */
+
+#if defined(HAVE_MPI)
+  MPI_Request       *request;       /* MPI requests */
+#endif
+
+};
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+/* Use CUDA-aware MPI: -1 if not determined yet, 0 if no, 1 if yes */
+
+static int  _use_device_mpi = -1;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return grid size for a given number of elements.
+ *
+ * parameters:
+ *   n <-- number of elements
+ *
+ * returns:
+ *   number of blocks
+ *----------------------------------------------------------------------------*/
+
+static inline unsigned int
+_grid_size(cs_lnum_t  n)
+{
+  return (n % CS_HALO_CUDA_BLOCK_SIZE) ?
+    n/CS_HALO_CUDA_BLOCK_SIZE + 1 : n/CS_HALO_CUDA_BLOCK_SIZE;
+}
+
+/*----------------------------------------------------------------------------
+ * Gather values to send for a halo exchange.
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_gather_send(cs_lnum_t                    n_send,
+             const cs_lnum_t  *restrict   send_list,
+             const cs_real_t  *restrict   var,
+             cs_real_t        *restrict   send_buf)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n_send)
+    send_buf[ii] = var[send_list[ii]];
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether the MPI library is able to use device buffers.
+ *
+ * returns:
+ *   true if MPI library reports CUDA support at run time
+ *----------------------------------------------------------------------------*/
+
+static bool
+_mpi_is_cuda_aware(void)
+{
+  bool retval = false;
+
+#if defined(MPIX_CUDA_AWARE_SUPPORT) && MPIX_CUDA_AWARE_SUPPORT
+  retval = (MPIX_Query_cuda_support() == 1);
+#endif
+
+  return retval;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate whether MPI exchanges use device buffers directly.
+ *
+ * \return  true if CUDA-aware MPI is used, false if exchanges are staged
+ *          through host memory
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_halo_cuda_get_use_device_mpi(void)
+{
+  if (_use_device_mpi < 0)
+    _use_device_mpi = (_mpi_is_cuda_aware()) ? 1 : 0;
+
+  return (_use_device_mpi > 0) ? true : false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set whether MPI exchanges should use device buffers directly.
+ *
+ * By default, this is enabled only when the MPI library reports CUDA
+ * support. Forcing this with an MPI library which is not CUDA-aware
+ * leads to a crash.
+ *
+ * \param[in]  use_device_mpi  true to use CUDA-aware MPI
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_cuda_set_use_device_mpi(bool  use_device_mpi)
+{
+  _use_device_mpi = (use_device_mpi) ? 1 : 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a device halo exchange helper for a given halo.
+ *
+ * The send list is mirrored on the device, and the required exchange
+ * buffers are allocated. Halos with rotational periodicity are not handled.
+ *
+ * \param[in]  halo  pointer to host halo structure
+ *
+ * \return  pointer to device halo exchange helper
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_cuda_t *
+cs_halo_cuda_create(const cs_halo_t  *halo)
+{
+  if (halo->n_rotations > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: halos with rotational periodicity are not handled."),
+              __func__);
+
+  cs_halo_cuda_t  *dh = NULL;
+
+  BFT_MALLOC(dh, 1, cs_halo_cuda_t);
+
+  dh->halo = halo;
+  dh->stream = 0;
+
+  dh->n_send = halo->n_send_elts[CS_HALO_EXTENDED];
+  dh->send_list = NULL;
+  dh->send_buf = NULL;
+  dh->h_send_buf = NULL;
+  dh->h_recv_buf = NULL;
+
+  if (dh->n_send > 0) {
+    size_t l_size = dh->n_send*sizeof(cs_lnum_t);
+    CS_CUDA_CHECK(cudaMalloc((void **)&(dh->send_list), l_size));
+    CS_CUDA_CHECK(cudaMemcpy(dh->send_list, halo->send_list, l_size,
+                             cudaMemcpyHostToDevice));
+    CS_CUDA_CHECK(cudaMalloc((void **)&(dh->send_buf),
+                             dh->n_send*sizeof(cs_real_t)));
+  }
+
+#if defined(HAVE_MPI)
+
+  dh->request = NULL;
+
+  if (cs_glob_n_ranks > 1) {
+
+    BFT_MALLOC(dh->request, 2*halo->n_c_domains, MPI_Request);
+
+    /* Staging buffers are allocated even when CUDA-aware MPI is used,
+       as that setting may be changed later */
+
+    if (dh->n_send > 0)
+      CS_CUDA_CHECK(cudaMallocHost((void **)&(dh->h_send_buf),
+                                   dh->n_send*sizeof(cs_real_t)));
+    if (halo->n_elts[CS_HALO_EXTENDED] > 0)
+      CS_CUDA_CHECK(cudaMallocHost((void **)&(dh->h_recv_buf),
+                                     halo->n_elts[CS_HALO_EXTENDED]
+                                   * sizeof(cs_real_t)));
+
+  }
+
+#endif
+
+  return dh;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Destroy a device halo exchange helper.
+ *
+ * \param[in, out]  dh  pointer to device halo helper pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_cuda_destroy(cs_halo_cuda_t  **dh)
+{
+  if (dh == NULL || *dh == NULL)
+    return;
+
+  cs_halo_cuda_t  *_dh = *dh;
+
+  CS_CUDA_CHECK(cudaStreamSynchronize(_dh->stream));
+
+  CS_CUDA_CHECK(cudaFree(_dh->send_list));
+  CS_CUDA_CHECK(cudaFree(_dh->send_buf));
+  CS_CUDA_CHECK(cudaFreeHost(_dh->h_send_buf));
+  CS_CUDA_CHECK(cudaFreeHost(_dh->h_recv_buf));
+
+#if defined(HAVE_MPI)
+  BFT_FREE(_dh->request);
+#endif
+
+  BFT_FREE(*dh);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the stream on which a device halo helper's operations
+ *         are queued (default: legacy default stream).
+ *
+ * \param[in, out]  dh      pointer to device halo helper
+ * \param[in]       stream  CUDA stream
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_cuda_set_stream(cs_halo_cuda_t  *dh,
+                        cudaStream_t     stream)
+{
+  CS_CUDA_CHECK(cudaStreamSynchronize(dh->stream));
+
+  dh->stream = stream;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update ghost values of a device-resident array of reals.
+ *
+ * Values are packed and unpacked on the device. Unpacking is ordered on
+ * the helper's stream, so kernels later queued on that stream see the
+ * updated values without the host waiting for completion.
+ *
+ * \param[in, out]  dh         pointer to device halo helper
+ * \param[in]       sync_mode  synchronization mode (standard or extended)
+ * \param[in, out]  d_var      device array (size: n_local_elts + n_ghosts)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_cuda_sync_var(cs_halo_cuda_t  *dh,
+                      cs_halo_type_t   sync_mode,
+                      cs_real_t       *d_var)
+{
+  const cs_halo_t  *halo = dh->halo;
+  cudaStream_t stream = dh->stream;
+
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+
+  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+
+  cs_real_t *d_ghosts = d_var + halo->n_local_elts;
+
+  /* Pack values to send */
+
+  if (dh->n_send > 0)
+    _gather_send<<<_grid_size(dh->n_send),
+                   CS_HALO_CUDA_BLOCK_SIZE,
+                   0,
+                   stream>>>
+      (dh->n_send, dh->send_list, d_var, dh->send_buf);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    const bool device_mpi = cs_halo_cuda_get_use_device_mpi();
+    const int local_rank = cs_glob_rank_id;
+
+    if (!device_mpi && dh->n_send > 0)
+      CS_CUDA_CHECK(cudaMemcpyAsync(dh->h_send_buf, dh->send_buf,
+                                    dh->n_send*sizeof(cs_real_t),
+                                    cudaMemcpyDeviceToHost, stream));
+
+    /* Packing must be complete before sending; this also ensures
+       previously queued kernels are done with ghost values (or
+       the staging receive buffer), which are overwritten below */
+
+    CS_CUDA_CHECK(cudaStreamSynchronize(stream));
+
+    cs_real_t *recv_base = (device_mpi) ? d_ghosts : dh->h_recv_buf;
+    cs_real_t *send_base = (device_mpi) ? dh->send_buf : dh->h_send_buf;
+
+    int request_count = 0;
+
+    /* Receive data from distant ranks */
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      cs_lnum_t start = halo->index[2*rank_id];
+      cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
+                          - halo->index[2*rank_id]);
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+        if (length > 0)
+          MPI_Irecv(recv_base + start,
+                    length,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    halo->c_domain_rank[rank_id],
+                    cs_glob_mpi_comm,
+                    &(dh->request[request_count++]));
+      }
+      else
+        local_rank_id = rank_id;
+
+    }
+
+    if (cs_halo_get_use_barrier())
+      MPI_Barrier(cs_glob_mpi_comm);
+
+    /* Send data to distant ranks */
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        cs_lnum_t start = halo->send_index[2*rank_id];
+        cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
+                            - halo->send_index[2*rank_id]);
+
+        if (length > 0)
+          MPI_Isend(send_base + start,
+                    length,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    local_rank,
+                    cs_glob_mpi_comm,
+                    &(dh->request[request_count++]));
+
+      }
+
+    }
+
+    /* Wait for all exchanges */
+
+    cs_timer_t t0 = cs_timer_time();
+
+    MPI_Waitall(request_count, dh->request, MPI_STATUSES_IGNORE);
+
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_stats_add_mpi_wait("halo exchange wait", &t0, &t1);
+
+    /* Copy staged values to device ghost sections (stream-ordered) */
+
+    if (!device_mpi) {
+
+      for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+        cs_lnum_t start = halo->index[2*rank_id];
+        cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
+                            - halo->index[2*rank_id]);
+
+        if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
+          CS_CUDA_CHECK(cudaMemcpyAsync(d_ghosts + start,
+                                        dh->h_recv_buf + start,
+                                        length*sizeof(cs_real_t),
+                                        cudaMemcpyHostToDevice, stream));
+
+      }
+
+    }
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Copy local values in case of periodicity (stream-ordered) */
+
+  if (halo->n_transforms > 0 && local_rank_id > -1) {
+
+    cs_lnum_t start = halo->send_index[2*local_rank_id];
+    cs_lnum_t length = (  halo->send_index[2*local_rank_id + end_shift]
+                        - halo->send_index[2*local_rank_id]);
+
+    if (length > 0)
+      CS_CUDA_CHECK(cudaMemcpyAsync(d_ghosts + halo->index[2*local_rank_id],
+                                    dh->send_buf + start,
+                                    length*sizeof(cs_real_t),
+                                    cudaMemcpyDeviceToDevice, stream));
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
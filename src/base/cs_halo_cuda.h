@@ -0,0 +1,151 @@
+#ifndef __CS_HALO_CUDA_H__
+#define __CS_HALO_CUDA_H__
+
+/*============================================================================
+ * Halo exchange for device-resident arrays (CUDA)
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_halo.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Device halo exchange helper (opaque) */
+
+typedef struct _cs_halo_cuda_t  cs_halo_cuda_t;
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate whether MPI exchanges use device buffers directly.
+ *
+ * \return  true if CUDA-aware MPI is used, false if exchanges are staged
+ *          through host memory
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_halo_cuda_get_use_device_mpi(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set whether MPI exchanges should use device buffers directly.
+ *
+ * By default, this is enabled only when the MPI library reports CUDA
+ * support. Forcing this with an MPI library which is not CUDA-aware
+ * leads to a crash.
+ *
+ * \param[in]  use_device_mpi  true to use CUDA-aware MPI
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_cuda_set_use_device_mpi(bool  use_device_mpi);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a device halo exchange helper for a given halo.
+ *
+ * The send list is mirrored on the device, and the required exchange
+ * buffers are allocated. Halos with rotational periodicity are not handled.
+ *
+ * \param[in]  halo  pointer to host halo structure
+ *
+ * \return  pointer to device halo exchange helper
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_cuda_t *
+cs_halo_cuda_create(const cs_halo_t  *halo);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Destroy a device halo exchange helper.
+ *
+ * \param[in, out]  dh  pointer to device halo helper pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_cuda_destroy(cs_halo_cuda_t  **dh);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update ghost values of a device-resident array of reals.
+ *
+ * Values are packed and unpacked on the device. Unpacking is ordered on
+ * the helper's stream, so kernels later queued on that stream see the
+ * updated values without the host waiting for completion.
+ *
+ * \param[in, out]  dh         pointer to device halo helper
+ * \param[in]       sync_mode  synchronization mode (standard or extended)
+ * \param[in, out]  d_var      device array (size: n_local_elts + n_ghosts)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_cuda_sync_var(cs_halo_cuda_t  *dh,
+                      cs_halo_type_t   sync_mode,
+                      cs_real_t       *d_var);
+
+/*----------------------------------------------------------------------------*/
+
+#if defined(__CUDACC__)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the stream on which a device halo helper's operations
+ *         are queued (default: legacy default stream).
+ *
+ * \param[in, out]  dh      pointer to device halo helper
+ * \param[in]       stream  CUDA stream
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_cuda_set_stream(cs_halo_cuda_t  *dh,
+                        cudaStream_t     stream);
+
+#endif /* defined(__CUDACC__) */
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_HALO_CUDA_H__ */
@@ -487,6 +487,84 @@ _apply_tensor3sym_rotation(cs_real_t   matrix[3][4],
 
 }
 
+/*----------------------------------------------------------------------------
+ * Apply rotations to interleaved vectors, tensors, or symmetric tensors
+ * of periodic ghost cells.
+ *
+ * Ghost cells of a given rotation are contiguous for each communicating
+ * rank and halo type, so each such range is handled as a batch using the
+ * transformation's matrix, with no per-element branching.
+ *
+ * parameters:
+ *   halo      <-- halo associated with variable to synchronize
+ *   sync_mode <-- kind of halo treatment (standard or extended)
+ *   stride    <-- 3 for vectors, 6 for symmetric tensors, 9 for tensors
+ *   var       <-> values to update
+ *----------------------------------------------------------------------------*/
+
+static void
+_apply_rotation_batches(const cs_halo_t  *halo,
+                        cs_halo_type_t    sync_mode,
+                        cs_lnum_t         stride,
+                        cs_real_t         var[])
+{
+  cs_real_t  matrix[3][4];
+
+  const int  n_transforms = halo->n_transforms;
+  const cs_lnum_t  n_elts = halo->n_local_elts;
+  const fvm_periodicity_t  *periodicity = cs_glob_mesh->periodicity;
+
+  const int n_ranges = (sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+
+  for (int t_id = 0; t_id < n_transforms; t_id++) {
+
+    if (  fvm_periodicity_get_type(periodicity, t_id)
+        < FVM_PERIODICITY_ROTATION)
+      continue;
+
+    fvm_periodicity_get_matrix(periodicity, t_id, matrix);
+
+    const cs_lnum_t  shift = 4 * halo->n_c_domains * t_id;
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      for (int r_id = 0; r_id < n_ranges; r_id++) {
+
+        const cs_lnum_t *p = halo->perio_lst + shift + 4*rank_id + 2*r_id;
+        const cs_lnum_t  n = p[1];
+
+        if (n < 1)
+          continue;
+
+        cs_real_t *v = var + (n_elts + p[0])*stride;
+
+        switch(stride) {
+        case 3:
+#         pragma omp parallel for if (n > CS_THR_MIN)
+          for (cs_lnum_t i = 0; i < n; i++)
+            _apply_vector_rotation(matrix, v + i*3);
+          break;
+        case 6:
+#         pragma omp parallel for if (n > CS_THR_MIN)
+          for (cs_lnum_t i = 0; i < n; i++)
+            _apply_sym_tensor_rotation(matrix, v + i*6);
+          break;
+        case 9:
+#         pragma omp parallel for if (n > CS_THR_MIN)
+          for (cs_lnum_t i = 0; i < n; i++)
+            _apply_tensor_rotation(matrix, v + i*9);
+          break;
+        default:
+          assert(0);
+        }
+
+      } /* End of loop on standard and extended ranges */
+
+    } /* End of loop on ranks */
+
+  } /* End of loop on transformations */
+}
+
 /*----------------------------------------------------------------------------
  * Test if a halo seems compatible with the main mesh's periodic
  * transformations.
@@ -642,16 +720,6 @@ cs_halo_perio_sync_var_vect(const cs_halo_t  *halo,
                             cs_real_t         var[],
                             int               incvar)
 {
-  int  rank_id, t_id;
-  cs_lnum_t  i, shift, start_std, end_std, start_ext, end_ext;
-
-  cs_real_t matrix[3][4];
-
-  fvm_periodicity_type_t  perio_type = FVM_PERIODICITY_NULL;
-
-  const int  n_transforms = halo->n_transforms;
-  const cs_lnum_t  n_elts   = halo->n_local_elts;
-  const fvm_periodicity_t  *periodicity = cs_glob_mesh->periodicity;
   const int  have_rotation = cs_glob_mesh->have_rotation_perio;
 
   if (sync_mode == CS_HALO_N_TYPES || have_rotation == 0)
@@ -662,39 +730,7 @@ cs_halo_perio_sync_var_vect(const cs_halo_t  *halo,
 
   _test_halo_compatibility(halo);
 
-  for (t_id = 0; t_id < n_transforms; t_id++) {
-
-    shift = 4 * halo->n_c_domains * t_id;
-
-    perio_type = fvm_periodicity_get_type(periodicity, t_id);
-
-    if (perio_type >= FVM_PERIODICITY_ROTATION) {
-
-      fvm_periodicity_get_matrix(periodicity, t_id, matrix);
-
-      for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-        start_std = n_elts + halo->perio_lst[shift + 4*rank_id];
-        end_std = start_std + halo->perio_lst[shift + 4*rank_id + 1];
-
-        for (i = start_std; i < end_std; i++)
-          _apply_vector_rotation(matrix, var + i*incvar);
-
-        if (sync_mode == CS_HALO_EXTENDED) {
-
-          start_ext = n_elts + halo->perio_lst[shift + 4*rank_id + 2];
-          end_ext = start_ext + halo->perio_lst[shift + 4*rank_id + 3];
-
-          for (i = start_ext; i < end_ext; i++)
-            _apply_vector_rotation(matrix, var + i*incvar);
-
-        }
-
-      } /* End of loop on ranks */
-
-    } /* End of the treatment of rotation */
-
-  } /* End of loop on transformations */
+  _apply_rotation_batches(halo, sync_mode, incvar, var);
 }
 
 /*----------------------------------------------------------------------------
@@ -934,16 +970,6 @@ cs_halo_perio_sync_var_tens(const cs_halo_t  *halo,
                             cs_halo_type_t    sync_mode,
                             cs_real_t         var[])
 {
-  int  rank_id, t_id;
-  cs_lnum_t  i, shift, start_std, end_std, start_ext, end_ext;
-
-  cs_real_t  matrix[3][4];
-
-  fvm_periodicity_type_t  perio_type = FVM_PERIODICITY_NULL;
-
-  const int  n_transforms = halo->n_transforms;
-  const cs_lnum_t  n_elts   = halo->n_local_elts;
-  const fvm_periodicity_t *periodicity = cs_glob_mesh->periodicity;
   const int  have_rotation = cs_glob_mesh->have_rotation_perio;
 
   if (sync_mode == CS_HALO_N_TYPES || have_rotation == 0)
@@ -953,39 +979,7 @@ cs_halo_perio_sync_var_tens(const cs_halo_t  *halo,
 
   _test_halo_compatibility(halo);
 
-  for (t_id = 0; t_id < n_transforms; t_id++) {
-
-    shift = 4 * halo->n_c_domains * t_id;
-
-    perio_type = fvm_periodicity_get_type(periodicity, t_id);
-
-    if (perio_type >= FVM_PERIODICITY_ROTATION) {
-
-      fvm_periodicity_get_matrix(periodicity, t_id, matrix);
-
-      for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-        start_std = halo->perio_lst[shift + 4*rank_id];
-        end_std = start_std + halo->perio_lst[shift + 4*rank_id + 1];
-
-        for (i = start_std; i < end_std; i++)
-          _apply_tensor_rotation(matrix, var + 9*(n_elts+i));
-
-        if (sync_mode == CS_HALO_EXTENDED) {
-
-          start_ext = halo->perio_lst[shift + 4*rank_id + 2];
-          end_ext = start_ext + halo->perio_lst[shift + 4*rank_id + 3];
-
-          for (i = start_ext; i < end_ext; i++)
-            _apply_tensor_rotation(matrix, var + 9*(n_elts+i));
-
-        } /* End of the treatment of rotation */
-
-      } /* End if halo is extended */
-
-    } /* End of loop on ranks */
-
-  } /* End of loop on transformations for the local rank */
+  _apply_rotation_batches(halo, sync_mode, 9, var);
 }
 
 /*----------------------------------------------------------------------------
@@ -1003,16 +997,6 @@ cs_halo_perio_sync_var_sym_tens(const cs_halo_t  *halo,
                                 cs_halo_type_t    sync_mode,
                                 cs_real_t         var[])
 {
-  int  rank_id, t_id;
-  cs_lnum_t  i, shift, start_std, end_std, start_ext, end_ext;
-
-  cs_real_t  matrix[3][4];
-
-  fvm_periodicity_type_t  perio_type = FVM_PERIODICITY_NULL;
-
-  const int  n_transforms = halo->n_transforms;
-  const cs_lnum_t  n_elts   = halo->n_local_elts;
-  const fvm_periodicity_t *periodicity = cs_glob_mesh->periodicity;
   const int  have_rotation = cs_glob_mesh->have_rotation_perio;
 
   if (sync_mode == CS_HALO_N_TYPES || have_rotation == 0)
@@ -1022,39 +1006,7 @@ cs_halo_perio_sync_var_sym_tens(const cs_halo_t  *halo,
 
   _test_halo_compatibility(halo);
 
-  for (t_id = 0; t_id < n_transforms; t_id++) {
-
-    shift = 4 * halo->n_c_domains * t_id;
-
-    perio_type = fvm_periodicity_get_type(periodicity, t_id);
-
-    if (perio_type >= FVM_PERIODICITY_ROTATION) {
-
-      fvm_periodicity_get_matrix(periodicity, t_id, matrix);
-
-      for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-        start_std = halo->perio_lst[shift + 4*rank_id];
-        end_std = start_std + halo->perio_lst[shift + 4*rank_id + 1];
-
-        for (i = start_std; i < end_std; i++)
-          _apply_sym_tensor_rotation(matrix, var + 6*(n_elts+i));
-
-        if (sync_mode == CS_HALO_EXTENDED) {
-
-          start_ext = halo->perio_lst[shift + 4*rank_id + 2];
-          end_ext = start_ext + halo->perio_lst[shift + 4*rank_id + 3];
-
-          for (i = start_ext; i < end_ext; i++)
-            _apply_sym_tensor_rotation(matrix, var + 6*(n_elts+i));
-
-        } /* End of the treatment of rotation */
-
-      } /* End if halo is extended */
-
-    } /* End of loop on ranks */
-
-  } /* End of loop on transformations for the local rank */
+  _apply_rotation_batches(halo, sync_mode, 6, var);
 }
 
 /*----------------------------------------------------------------------------
@@ -46,6 +46,7 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "cs_array.h"
 #include "cs_field_pointer.h"
 #include "cs_gui.h"
 #include "cs_log.h"
@@ -124,18 +125,18 @@ cs_head_losses_compute(cs_real_6_t cku[])
   /* We first use an interleaved definition, then switch to the
      non-interleaved variant still used in Fortran */
 
-  cs_lnum_t n_loc_cells = 0;
   cs_lnum_t n_hl_cells = 0;
 
   for (int i = 0; i < n_zones; i++) {
     const cs_zone_t  *z = cs_volume_zone_by_id(i);
-    if (z->type & CS_VOLUME_ZONE_HEAD_LOSS) {
+    if (z->type & CS_VOLUME_ZONE_HEAD_LOSS)
       n_hl_cells += z->n_elts;
-      if (z->n_elts > n_loc_cells)
-        n_loc_cells = z->n_elts;
-    }
   }
 
+  /* Initialize (zone-local values are contiguous) */
+
+  cs_array_set_value_real(n_hl_cells, 6, 0., (cs_real_t *)cku);
+
   const cs_real_3_t *cvara_vel = (const cs_real_3_t *)(CS_F_(vel)->val_pre);
 
   /* Loop on head loss zones */
@@ -150,13 +151,6 @@ cs_head_losses_compute(cs_real_6_t cku[])
       const cs_lnum_t n_z_cells = z->n_elts;
       cs_real_6_t *_cku = cku + n_p_cells;
 
-      /* Initialize */
-
-      for (cs_lnum_t j = 0; j < n_z_cells; j++) {
-        for (cs_lnum_t k = 0; k < 6; k++)
-          _cku[j][k] = 0.;
-      }
-
       /* GUI definitions go first, then user function definitions */
 
       cs_gui_head_losses(z, cvara_vel, _cku);
@@ -99,6 +99,40 @@ struct _cs_interface_t {
 
 };
 
+/*----------------------------------------------------------------------------
+ * Structure defining a persistent communication plan for the exchange of
+ * values of a given type and stride over an interface set
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_datatype_t   datatype;        /* Type of exchanged values */
+  cs_lnum_t       stride;          /* Number of values per element */
+
+  const void     *pending_var;     /* Variable (or NULL) for which a split
+                                      exchange is pending */
+
+  unsigned char  *send_buf;        /* Preallocated send buffer */
+  unsigned char  *recv_buf;        /* Preallocated receive buffer */
+
+#if defined(HAVE_MPI)
+  int             n_requests;      /* Number of persistent requests */
+  MPI_Request    *request;         /* Persistent requests (receives first) */
+#endif
+
+} _cs_interface_comm_plan_t;
+
+/*----------------------------------------------------------------------------
+ * Set of persistent communication plans associated with an interface set
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  int                         n_plans;  /* Number of plans */
+  _cs_interface_comm_plan_t  *plans;    /* Plans array */
+
+} _cs_interface_comm_plan_set_t;
+
 /*----------------------------------------------------------------------------
  * Structure defining a set of interfaces
  *----------------------------------------------------------------------------*/
@@ -113,6 +147,9 @@ struct _cs_interface_set_t {
 
   int                       match_id_rc;   /* Match_id reference count */
 
+  _cs_interface_comm_plan_set_t  *cps;     /* Persistent communication plans,
+                                              built on demand */
+
 #if defined(HAVE_MPI)
   MPI_Comm                  comm;          /* Associated communicator */
 #endif
@@ -3321,236 +3358,687 @@ _copy_sub_blocked(cs_interface_t  *o,
   return n;
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*=============================================================================
- * Public function definitions
- *============================================================================*/
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Return process rank associated with an interface's distant elements.
- *
- * \param[in]  itf  pointer to interface structure
+/*----------------------------------------------------------------------------
+ * Create an empty set of persistent communication plans.
  *
- * \return  process rank associated with the interface's distant elements
- */
-/*----------------------------------------------------------------------------*/
+ * returns:
+ *   pointer to allocated structure
+ *----------------------------------------------------------------------------*/
 
-int
-cs_interface_rank(const cs_interface_t  *itf)
+static _cs_interface_comm_plan_set_t *
+_comm_plan_set_create(void)
 {
-  int retval = -1;
+  _cs_interface_comm_plan_set_t  *cps;
 
-  if (itf != NULL)
-    retval = itf->rank;
+  BFT_MALLOC(cps, 1, _cs_interface_comm_plan_set_t);
 
-  return retval;
+  cps->n_plans = 0;
+  cps->plans = NULL;
+
+  return cps;
 }
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Return number of local and distant elements defining an interface.
- *
- * \param[in]  itf  pointer to interface structure
+/*----------------------------------------------------------------------------
+ * Free the plans of a set of persistent communication plans.
  *
- * \return  number of local and distant elements defining the interface
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   cps <-> pointer to set of persistent communication plans
+ *----------------------------------------------------------------------------*/
 
-cs_lnum_t
-cs_interface_size(const cs_interface_t  *itf)
+static void
+_comm_plan_set_clear(_cs_interface_comm_plan_set_t  *cps)
 {
-  cs_lnum_t retval = 0;
+  for (int i = 0; i < cps->n_plans; i++) {
 
-  if (itf != NULL)
-    retval = itf->size;
+    _cs_interface_comm_plan_t  *cp = cps->plans + i;
 
-  return retval;
-}
+    assert(cp->pending_var == NULL);
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Return pointer to array of local element ids defining an interface.
- *
- * The size of the array may be obtained by cs_interface_size().
- * The array is owned by the interface structure, and is not copied
- * (hence the constant qualifier for the return value).
- *
- * \param[in]  itf  pointer to interface structure
- *
- * \return  pointer to array of local element ids (0 to n-1) defining
- * the interface
- */
-/*----------------------------------------------------------------------------*/
+#if defined(HAVE_MPI)
+    for (int j = 0; j < cp->n_requests; j++)
+      MPI_Request_free(cp->request + j);
+    BFT_FREE(cp->request);
+#endif
 
-const cs_lnum_t *
-cs_interface_get_elt_ids(const cs_interface_t  *itf)
-{
-  const cs_lnum_t *retval = NULL;
+    BFT_FREE(cp->send_buf);
+    BFT_FREE(cp->recv_buf);
 
-  if (itf != NULL)
-    retval = itf->elt_id;
+  }
 
-  return retval;
+  BFT_FREE(cps->plans);
+  cps->n_plans = 0;
 }
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Return pointer to array of matching element ids defining an interface.
- *
- * This array is only available if cs_interface_set_add_match_ids() has
- * been called for the containing interface set.
+/*----------------------------------------------------------------------------
+ * Return a persistent communication plan of an interface set, for a given
+ * datatype and stride, creating it if needed.
  *
- * The size of the array may be obtained by cs_interface_size().
- * The array is owned by the interface structure, and is not copied
- * (hence the constant qualifier for the return value).
+ * Only plans with no pending exchange are returned, so that several
+ * split exchanges of the same type may be pending at the same time.
  *
- * \param[in]  itf  pointer to interface structure
+ * parameters:
+ *   ifs      <-- pointer to interface set
+ *   datatype <-- type of exchanged values
+ *   stride   <-- number of values per element
+ *   create   <-- create plan if not present
  *
- * \return  pointer to array of local element ids (0 to n-1) defining
- * the interface
- */
-/*----------------------------------------------------------------------------*/
+ * returns:
+ *   pointer to matching plan, or NULL
+ *----------------------------------------------------------------------------*/
 
-const cs_lnum_t *
-cs_interface_get_match_ids(const cs_interface_t  *itf)
+static _cs_interface_comm_plan_t *
+_get_comm_plan(const cs_interface_set_t  *ifs,
+               cs_datatype_t              datatype,
+               cs_lnum_t                  stride,
+               bool                       create)
 {
-  const cs_lnum_t *retval = NULL;
+  _cs_interface_comm_plan_set_t  *cps = ifs->cps;
 
-  if (itf != NULL)
-    retval = itf->match_id;
+  for (int i = 0; i < cps->n_plans; i++) {
+    _cs_interface_comm_plan_t  *cp = cps->plans + i;
+    if (   cp->datatype == datatype && cp->stride == stride
+        && cp->pending_var == NULL)
+      return cp;
+  }
 
-  return retval;
-}
+  if (create == false)
+    return NULL;
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Return size of index of sub-sections for different transformations.
- *
- * The index is applicable to both local_num and distant_num arrays,
- * with purely parallel equivalences appearing at position 0, and
- * equivalences through periodic transform i at position i+1;
- * Its size should thus be equal to 1 + number of periodic transforms + 1,
- * In absence of periodicity, it may be 0, as the index is not needed.
- *
- * \param[in]  itf  pointer to interface structure
- *
- * \return  transform index size for the interface
- */
-/*----------------------------------------------------------------------------*/
+  BFT_REALLOC(cps->plans, cps->n_plans + 1, _cs_interface_comm_plan_t);
 
-cs_lnum_t
-cs_interface_get_tr_index_size(const cs_interface_t  *itf)
-{
-  cs_lnum_t retval = 0;
+  _cs_interface_comm_plan_t  *cp = cps->plans + cps->n_plans;
+  cps->n_plans += 1;
 
-  if (itf != NULL)
-    retval = itf->tr_index_size;
+  const cs_lnum_t stride_size = cs_datatype_size[datatype]*stride;
+  const cs_lnum_t n_elts = cs_interface_set_n_elts(ifs);
 
-  return retval;
-}
+  cp->datatype = datatype;
+  cp->stride = stride;
+  cp->pending_var = NULL;
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Return pointer to index of sub-sections for different transformations.
- *
- * The index is applicable to both local_num and distant_num arrays,
- * with purely parallel equivalences appearing at position 0, and
- * equivalences through periodic transform i at position i+1;
- * In absence of periodicity, it may be NULL, as it is not needed.
- *
- * \param[in]  itf  pointer to interface structure
- *
- * \return  pointer to transform index for the interface
- */
-/*----------------------------------------------------------------------------*/
+  BFT_MALLOC(cp->send_buf, n_elts*stride_size, unsigned char);
+  BFT_MALLOC(cp->recv_buf, n_elts*stride_size, unsigned char);
 
-const cs_lnum_t *
-cs_interface_get_tr_index(const cs_interface_t  *itf)
-{
-  const cs_lnum_t *tr_index = 0;
+#if defined(HAVE_MPI)
 
-  if (itf != NULL)
-    tr_index = itf->tr_index;
+  int local_rank = 0;
+  MPI_Datatype mpi_type = cs_datatype_to_mpi[datatype];
 
-  return tr_index;
+  if (ifs->comm != MPI_COMM_NULL)
+    MPI_Comm_rank(ifs->comm, &local_rank);
+
+  cp->n_requests = 0;
+  BFT_MALLOC(cp->request, ifs->size*2, MPI_Request);
+
+  for (int i = 0, j = 0; i < ifs->size; i++) {
+    cs_interface_t *itf = ifs->interfaces[i];
+    if (itf->rank != local_rank)
+      MPI_Recv_init(cp->recv_buf + j*stride_size,
+                    itf->size*stride,
+                    mpi_type,
+                    itf->rank,
+                    itf->rank,
+                    ifs->comm,
+                    &(cp->request[cp->n_requests++]));
+    j += itf->size;
+  }
+
+  for (int i = 0, j = 0; i < ifs->size; i++) {
+    cs_interface_t *itf = ifs->interfaces[i];
+    if (itf->rank != local_rank)
+      MPI_Send_init(cp->send_buf + j*stride_size,
+                    itf->size*stride,
+                    mpi_type,
+                    itf->rank,
+                    local_rank,
+                    ifs->comm,
+                    &(cp->request[cp->n_requests++]));
+    j += itf->size;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  return cp;
 }
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Creation of a list of interfaces between elements of a same type.
- *
- * These interfaces may be used to identify equivalent vertices or faces using
- * domain splitting, as well as periodic elements (on the same or on
- * distant ranks).
- *
- * Note that periodicity information will be completed and made consistent
- * based on the input, so that if a periodic couple is defined on a given rank,
- * the reverse couple wil be defined, whether it is also defined on the same
- * or a different rank.
- *
- * In addition, multiple periodicity interfaces will be built automatically
- * if the periodicity structure provides for composed periodicities, so they
- * need not be defined prior to this function being called.
+/*----------------------------------------------------------------------------
+ * Start the exchange of values of an interface set using a
+ * persistent communication plan.
  *
- * \param[in]  n_elts                 number of local elements considered
- *                                    (size of parent_element_id[])
- * \param[in]  parent_element_id      pointer to list of selected elements
- *                                    local ids (0 to n-1), or NULL if all
- *                                    first n_elts elements are used
- * \param[in]  global_number          pointer to list of global (i.e. domain
- *                                    splitting independent) element numbers
- * \param[in]  periodicity            periodicity information (NULL if none)
- * \param[in]  n_periodic_lists       number of periodic lists (may be local)
- * \param[in]  periodicity_num        periodicity number (1 to n) associated
- *                                    with each periodic list (primary
- *                                    periodicities only)
- * \param[in]  n_periodic_couples     number of periodic couples associated
- *                                    with each periodic list
- * \param[in]  periodic_couples       array indicating periodic couples
- *                                    (interlaced, using global numberings)
- *                                    for each list
+ * Values are packed in the plan's send buffer, in send order; when
+ * the plan's datatype is CS_FLOAT and the variable's is CS_DOUBLE,
+ * values are converted to single precision.
  *
- * \return  pointer to list of interfaces (possibly NULL in serial mode)
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   ifs       <-- pointer to interface set
+ *   cp        <-> pointer to communication plan
+ *   n_elts    <-- number of elements in var buffer
+ *   interlace <-- true if variable is interlaced (for stride > 1)
+ *   datatype  <-- type of variable values
+ *   var       <-- variable buffer
+ *----------------------------------------------------------------------------*/
 
-cs_interface_set_t *
-cs_interface_set_create(cs_lnum_t                 n_elts,
-                        const cs_lnum_t           parent_element_id[],
-                        const cs_gnum_t           global_number[],
-                        const fvm_periodicity_t  *periodicity,
-                        int                       n_periodic_lists,
-                        const int                 periodicity_num[],
-                        const cs_lnum_t           n_periodic_couples[],
-                        const cs_gnum_t    *const periodic_couples[])
+static void
+_comm_plan_start(const cs_interface_set_t   *ifs,
+                 _cs_interface_comm_plan_t  *cp,
+                 cs_lnum_t                   n_elts,
+                 bool                        interlace,
+                 cs_datatype_t               datatype,
+                 const void                 *var)
 {
-  cs_interface_set_t  *ifs;
-
-  /* Initial checks */
-
-  if (   (cs_glob_n_ranks < 2)
-      && (periodicity == NULL || n_periodic_lists == 0))
-    return NULL;
+  int local_rank = 0;
+  const cs_lnum_t stride = cp->stride;
+  const cs_lnum_t x_size = cs_datatype_size[cp->datatype];
+  const cs_lnum_t d_size = cs_datatype_size[datatype];
+  const cs_lnum_t l_stride = (stride < 2 || interlace) ? stride : 1;
+  const cs_lnum_t c_stride = (stride < 2 || interlace) ? 1 : n_elts;
+  const bool to_float = (cp->datatype != datatype);
 
-  /* Create structure */
+  assert(to_float == false
+         || (cp->datatype == CS_FLOAT && datatype == CS_DOUBLE));
 
-  BFT_MALLOC(ifs, 1, cs_interface_set_t);
-  ifs->size = 0;
-  ifs->interfaces = NULL;
-  ifs->periodicity = periodicity;
-  ifs->match_id_rc = 0;
+  const unsigned char *_var = var;
 
-  const cs_gnum_t  *global_num = global_number;
+#if defined(HAVE_MPI)
+  if (ifs->comm != MPI_COMM_NULL)
+    MPI_Comm_rank(ifs->comm, &local_rank);
+#endif
 
-  cs_gnum_t  *_global_num = NULL;
+  /* Pack send buffer */
 
-  if (global_number != NULL && parent_element_id != NULL) {
+  for (int i = 0, j = 0; i < ifs->size; i++) {
 
-    BFT_MALLOC(_global_num, n_elts, cs_gnum_t);
+    cs_interface_t *itf = ifs->interfaces[i];
 
-    for (size_t i = 0 ; i < (size_t)n_elts ; i++)
+    if (to_float) {
+      const double *v = var;
+      float *p = (float *)(cp->send_buf) + j*stride;
+      for (cs_lnum_t k = 0; k < itf->size; k++) {
+        cs_lnum_t elt_id = itf->elt_id[itf->send_order[k]];
+        for (cs_lnum_t l = 0; l < stride; l++)
+          p[k*stride + l] = v[elt_id*l_stride + l*c_stride];
+      }
+    }
+    else {
+      unsigned char *p = cp->send_buf + j*stride*x_size;
+      for (cs_lnum_t k = 0; k < itf->size; k++) {
+        cs_lnum_t elt_id = itf->elt_id[itf->send_order[k]];
+        for (cs_lnum_t l = 0; l < stride; l++)
+          memcpy(p + (k*stride + l)*x_size,
+                 _var + (elt_id*l_stride + l*c_stride)*d_size,
+                 x_size);
+      }
+    }
+
+    /* Same-rank (periodic) interfaces do not need communication */
+
+    if (itf->rank == local_rank)
+      memcpy(cp->recv_buf + j*stride*x_size,
+             cp->send_buf + j*stride*x_size,
+             itf->size*stride*x_size);
+
+    j += itf->size;
+
+  }
+
+#if defined(HAVE_MPI)
+  if (cp->n_requests > 0)
+    MPI_Startall(cp->n_requests, cp->request);
+#endif
+
+  cp->pending_var = var;
+}
+
+/*----------------------------------------------------------------------------
+ * Increment values of elements associated with an interface set with
+ * values received from matching elements.
+ *
+ * parameters:
+ *   ifs       <-- pointer to interface set
+ *   n_elts    <-- number of elements in var buffer
+ *   stride    <-- number of values by entity
+ *   interlace <-- true if variable is interlaced (for stride > 1)
+ *   datatype  <-- type of data considered
+ *   buf       <-- received values, in interface order
+ *   var       <-> variable buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_interface_set_sum_buf(const cs_interface_set_t  *ifs,
+                       cs_lnum_t                  n_elts,
+                       cs_lnum_t                  stride,
+                       bool                       interlace,
+                       cs_datatype_t              datatype,
+                       const unsigned char       *buf,
+                       void                      *var)
+{
+  int i;
+  cs_lnum_t j, k, l;
+
+  switch (datatype) {
+
+  case CS_CHAR:
+    for (i = 0, j = 0; i < ifs->size; i++) {
+      cs_interface_t *itf = ifs->interfaces[i];
+      char *v = var;
+      const char *p = (const char *)buf + j*stride;
+      if (stride < 2 || interlace) {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id*stride + l] += p[k*stride + l];
+        }
+      }
+      else {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id + l*n_elts] += p[k*stride + l];
+        }
+      }
+      j += itf->size;
+    }
+    break;
+
+  case CS_FLOAT:
+    for (i = 0, j = 0; i < ifs->size; i++) {
+      cs_interface_t *itf = ifs->interfaces[i];
+      float *v = var;
+      const float *p = (const float *)buf + j*stride;
+      if (stride < 2 || interlace) {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id*stride + l] += p[k*stride + l];
+        }
+      }
+      else {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id + l*n_elts] += p[k*stride + l];
+        }
+      }
+      j += itf->size;
+    }
+    break;
+
+  case CS_DOUBLE:
+    for (i = 0, j = 0; i < ifs->size; i++) {
+      cs_interface_t *itf = ifs->interfaces[i];
+      double *v = var;
+      const double *p = (const double *)buf + j*stride;
+      if (stride < 2 || interlace) {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id*stride + l] += p[k*stride + l];
+        }
+      }
+      else {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id + l*n_elts] += p[k*stride + l];
+        }
+      }
+      j += itf->size;
+    }
+    break;
+
+  case CS_INT32:
+    for (i = 0, j = 0; i < ifs->size; i++) {
+      cs_interface_t *itf = ifs->interfaces[i];
+      int32_t *v = var;
+      const int32_t *p = (const int32_t *)buf + j*stride;
+      if (stride < 2 || interlace) {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id*stride + l] += p[k*stride + l];
+        }
+      }
+      else {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id + l*n_elts] += p[k*stride + l];
+        }
+      }
+      j += itf->size;
+    }
+    break;
+
+  case CS_INT64:
+    for (i = 0, j = 0; i < ifs->size; i++) {
+      cs_interface_t *itf = ifs->interfaces[i];
+      int64_t *v = var;
+      const int64_t *p = (const int64_t *)buf + j*stride;
+      if (stride < 2 || interlace) {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id*stride + l] += p[k*stride + l];
+        }
+      }
+      else {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id + l*n_elts] += p[k*stride + l];
+        }
+      }
+      j += itf->size;
+    }
+    break;
+
+  case CS_UINT16:
+    for (i = 0, j = 0; i < ifs->size; i++) {
+      cs_interface_t *itf = ifs->interfaces[i];
+      uint16_t *v = var;
+      const uint16_t *p = (const uint16_t *)buf + j*stride;
+      if (stride < 2 || interlace) {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id*stride + l] += p[k*stride + l];
+        }
+      }
+      else {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id + l*n_elts] += p[k*stride + l];
+        }
+      }
+      j += itf->size;
+    }
+    break;
+
+  case CS_UINT32:
+    for (i = 0, j = 0; i < ifs->size; i++) {
+      cs_interface_t *itf = ifs->interfaces[i];
+      uint32_t *v = var;
+      const uint32_t *p = (const uint32_t *)buf + j*stride;
+      if (stride < 2 || interlace) {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id*stride + l] += p[k*stride + l];
+        }
+      }
+      else {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id + l*n_elts] += p[k*stride + l];
+        }
+      }
+      j += itf->size;
+    }
+    break;
+
+  case CS_UINT64:
+    for (i = 0, j = 0; i < ifs->size; i++) {
+      cs_interface_t *itf = ifs->interfaces[i];
+      uint64_t *v = var;
+      const uint64_t *p = (const uint64_t *)buf + j*stride;
+      if (stride < 2 || interlace) {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id*stride + l] += p[k*stride + l];
+        }
+      }
+      else {
+        for (k = 0; k < itf->size; k++) {
+          cs_lnum_t elt_id = itf->elt_id[k];
+          for (l = 0; l < stride; l++)
+            v[elt_id + l*n_elts] += p[k*stride + l];
+        }
+      }
+      j += itf->size;
+    }
+    break;
+
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              _("Called %s with unhandled datatype (%d)."), __func__,
+              (int)datatype);
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return process rank associated with an interface's distant elements.
+ *
+ * \param[in]  itf  pointer to interface structure
+ *
+ * \return  process rank associated with the interface's distant elements
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_interface_rank(const cs_interface_t  *itf)
+{
+  int retval = -1;
+
+  if (itf != NULL)
+    retval = itf->rank;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return number of local and distant elements defining an interface.
+ *
+ * \param[in]  itf  pointer to interface structure
+ *
+ * \return  number of local and distant elements defining the interface
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_interface_size(const cs_interface_t  *itf)
+{
+  cs_lnum_t retval = 0;
+
+  if (itf != NULL)
+    retval = itf->size;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return pointer to array of local element ids defining an interface.
+ *
+ * The size of the array may be obtained by cs_interface_size().
+ * The array is owned by the interface structure, and is not copied
+ * (hence the constant qualifier for the return value).
+ *
+ * \param[in]  itf  pointer to interface structure
+ *
+ * \return  pointer to array of local element ids (0 to n-1) defining
+ * the interface
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_interface_get_elt_ids(const cs_interface_t  *itf)
+{
+  const cs_lnum_t *retval = NULL;
+
+  if (itf != NULL)
+    retval = itf->elt_id;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return pointer to array of matching element ids defining an interface.
+ *
+ * This array is only available if cs_interface_set_add_match_ids() has
+ * been called for the containing interface set.
+ *
+ * The size of the array may be obtained by cs_interface_size().
+ * The array is owned by the interface structure, and is not copied
+ * (hence the constant qualifier for the return value).
+ *
+ * \param[in]  itf  pointer to interface structure
+ *
+ * \return  pointer to array of local element ids (0 to n-1) defining
+ * the interface
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_interface_get_match_ids(const cs_interface_t  *itf)
+{
+  const cs_lnum_t *retval = NULL;
+
+  if (itf != NULL)
+    retval = itf->match_id;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return size of index of sub-sections for different transformations.
+ *
+ * The index is applicable to both local_num and distant_num arrays,
+ * with purely parallel equivalences appearing at position 0, and
+ * equivalences through periodic transform i at position i+1;
+ * Its size should thus be equal to 1 + number of periodic transforms + 1,
+ * In absence of periodicity, it may be 0, as the index is not needed.
+ *
+ * \param[in]  itf  pointer to interface structure
+ *
+ * \return  transform index size for the interface
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_interface_get_tr_index_size(const cs_interface_t  *itf)
+{
+  cs_lnum_t retval = 0;
+
+  if (itf != NULL)
+    retval = itf->tr_index_size;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return pointer to index of sub-sections for different transformations.
+ *
+ * The index is applicable to both local_num and distant_num arrays,
+ * with purely parallel equivalences appearing at position 0, and
+ * equivalences through periodic transform i at position i+1;
+ * In absence of periodicity, it may be NULL, as it is not needed.
+ *
+ * \param[in]  itf  pointer to interface structure
+ *
+ * \return  pointer to transform index for the interface
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_interface_get_tr_index(const cs_interface_t  *itf)
+{
+  const cs_lnum_t *tr_index = 0;
+
+  if (itf != NULL)
+    tr_index = itf->tr_index;
+
+  return tr_index;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Creation of a list of interfaces between elements of a same type.
+ *
+ * These interfaces may be used to identify equivalent vertices or faces using
+ * domain splitting, as well as periodic elements (on the same or on
+ * distant ranks).
+ *
+ * Note that periodicity information will be completed and made consistent
+ * based on the input, so that if a periodic couple is defined on a given rank,
+ * the reverse couple wil be defined, whether it is also defined on the same
+ * or a different rank.
+ *
+ * In addition, multiple periodicity interfaces will be built automatically
+ * if the periodicity structure provides for composed periodicities, so they
+ * need not be defined prior to this function being called.
+ *
+ * \param[in]  n_elts                 number of local elements considered
+ *                                    (size of parent_element_id[])
+ * \param[in]  parent_element_id      pointer to list of selected elements
+ *                                    local ids (0 to n-1), or NULL if all
+ *                                    first n_elts elements are used
+ * \param[in]  global_number          pointer to list of global (i.e. domain
+ *                                    splitting independent) element numbers
+ * \param[in]  periodicity            periodicity information (NULL if none)
+ * \param[in]  n_periodic_lists       number of periodic lists (may be local)
+ * \param[in]  periodicity_num        periodicity number (1 to n) associated
+ *                                    with each periodic list (primary
+ *                                    periodicities only)
+ * \param[in]  n_periodic_couples     number of periodic couples associated
+ *                                    with each periodic list
+ * \param[in]  periodic_couples       array indicating periodic couples
+ *                                    (interlaced, using global numberings)
+ *                                    for each list
+ *
+ * \return  pointer to list of interfaces (possibly NULL in serial mode)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_interface_set_t *
+cs_interface_set_create(cs_lnum_t                 n_elts,
+                        const cs_lnum_t           parent_element_id[],
+                        const cs_gnum_t           global_number[],
+                        const fvm_periodicity_t  *periodicity,
+                        int                       n_periodic_lists,
+                        const int                 periodicity_num[],
+                        const cs_lnum_t           n_periodic_couples[],
+                        const cs_gnum_t    *const periodic_couples[])
+{
+  cs_interface_set_t  *ifs;
+
+  /* Initial checks */
+
+  if (   (cs_glob_n_ranks < 2)
+      && (periodicity == NULL || n_periodic_lists == 0))
+    return NULL;
+
+  /* Create structure */
+
+  BFT_MALLOC(ifs, 1, cs_interface_set_t);
+  ifs->size = 0;
+  ifs->interfaces = NULL;
+  ifs->periodicity = periodicity;
+  ifs->match_id_rc = 0;
+  ifs->cps = _comm_plan_set_create();
+
+  const cs_gnum_t  *global_num = global_number;
+
+  cs_gnum_t  *_global_num = NULL;
+
+  if (global_number != NULL && parent_element_id != NULL) {
+
+    BFT_MALLOC(_global_num, n_elts, cs_gnum_t);
+
+    for (size_t i = 0 ; i < (size_t)n_elts ; i++)
       _global_num[i] = global_number[parent_element_id[i]];
 
     global_num = _global_num;
@@ -3631,6 +4119,8 @@ cs_interface_set_destroy(cs_interface_set_t  **ifs)
       _cs_interface_destroy(&(itfs->interfaces[i]));
     }
     BFT_FREE(itfs->interfaces);
+    _comm_plan_set_clear(itfs->cps);
+    BFT_FREE(itfs->cps);
     BFT_FREE(itfs);
     *ifs = itfs;
   }
@@ -3664,6 +4154,7 @@ cs_interface_set_dup(const cs_interface_set_t  *ifs,
   ifs_new->size = ifs->size;
   ifs_new->periodicity = ifs->periodicity;
   ifs_new->match_id_rc = 0;
+  ifs_new->cps = _comm_plan_set_create();
 
 #if defined(HAVE_MPI)
   ifs_new->comm = ifs->comm;
@@ -3731,6 +4222,7 @@ cs_interface_set_dup_blocks(cs_interface_set_t  *ifs,
 
   ifs_new->size = ifs->size;
   ifs_new->periodicity = ifs->periodicity;
+  ifs_new->cps = _comm_plan_set_create();
 
   cs_lnum_t *d_block_size;
   BFT_MALLOC(d_block_size, ifs->size, cs_lnum_t);
@@ -3951,6 +4443,11 @@ cs_interface_set_renumber(cs_interface_set_t  *ifs,
   assert(ifs != NULL);
   assert(old_to_new != NULL);
 
+  /* Interface sizes may change, so communication plans are rebuilt
+     on demand */
+
+  _comm_plan_set_clear(ifs->cps);
+
   /* Compute new element and match ids */
 
   _set_renumber_update_ids(ifs, old_to_new);
@@ -4620,8 +5117,16 @@ cs_interface_set_sum(const cs_interface_set_t  *ifs,
                      cs_datatype_t              datatype,
                      void                      *var)
 {
-  int i;
-  cs_lnum_t j, k, l;
+  /* Use a persistent communication plan if one is available */
+
+  if (_get_comm_plan(ifs, datatype, stride, false) != NULL) {
+    cs_interface_set_sum_start(ifs, n_elts, stride, interlace, datatype,
+                               false, var);
+    cs_interface_set_sum_wait(ifs, n_elts, stride, interlace, datatype,
+                              false, var);
+    return;
+  }
+
   cs_lnum_t stride_size = cs_datatype_size[datatype]*stride;
   unsigned char *buf = NULL;
 
@@ -4645,199 +5150,145 @@ cs_interface_set_sum(const cs_interface_set_t  *ifs,
 
   /* Now increment values */
 
-  switch (datatype) {
+  _interface_set_sum_buf(ifs, n_elts, stride, interlace, datatype, buf, var);
 
-  case CS_CHAR:
-    for (i = 0, j = 0; i < ifs->size; i++) {
-      cs_interface_t *itf = ifs->interfaces[i];
-      char *v = var;
-      const char *p = (const char *)buf + j*stride;
-      if (stride < 2 || interlace) {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id*stride + l] += p[k*stride + l];
-        }
-      }
-      else {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id + l*n_elts] += p[k*stride + l];
-        }
-      }
-      j += itf->size;
-    }
-    break;
+  BFT_FREE(buf);
+}
 
-  case CS_FLOAT:
-    for (i = 0, j = 0; i < ifs->size; i++) {
-      cs_interface_t *itf = ifs->interfaces[i];
-      float *v = var;
-      const float *p = (const float *)buf + j*stride;
-      if (stride < 2 || interlace) {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id*stride + l] += p[k*stride + l];
-        }
-      }
-      else {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id + l*n_elts] += p[k*stride + l];
-        }
-      }
-      j += itf->size;
-    }
-    break;
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start updating the sum of values for elements associated with an
+ * interface set, using a persistent communication plan.
+ *
+ * This function packs local contributions and posts the matching
+ * exchanges, and returns without waiting for their completion, so that
+ * computations which do not involve the variable may be overlapped with
+ * communication. It must be followed by a call to
+ * \ref cs_interface_set_sum_wait with the same arguments.
+ *
+ * Communication plans (with preallocated buffers and persistent requests)
+ * are built on the first call for a given type and stride, and reused
+ * afterwards, including by \ref cs_interface_set_sum. Several such
+ * exchanges may be pending at the same time, as long as they apply to
+ * different variables.
+ *
+ * If float_exchange is true and datatype is CS_DOUBLE, values are
+ * exchanged in single precision, which reduces the communication volume,
+ * but should be restricted to cases where the loss of precision is
+ * acceptable (such as preconditioning).
+ *
+ * \param[in]       ifs             pointer to a fvm_interface_set_t structure
+ * \param[in]       n_elts          number of elements in var buffer
+ * \param[in]       stride          number of values (non interlaced)
+ *                                  by entity
+ * \param[in]       interlace       true if variable is interlaced
+ *                                  (for stride > 1)
+ * \param[in]       datatype        type of data considered
+ * \param[in]       float_exchange  exchange double values as floats
+ * \param[in, out]  var             variable buffer
+ */
+/*----------------------------------------------------------------------------*/
 
-  case CS_DOUBLE:
-    for (i = 0, j = 0; i < ifs->size; i++) {
-      cs_interface_t *itf = ifs->interfaces[i];
-      double *v = var;
-      const double *p = (const double *)buf + j*stride;
-      if (stride < 2 || interlace) {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id*stride + l] += p[k*stride + l];
-        }
-      }
-      else {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id + l*n_elts] += p[k*stride + l];
-        }
-      }
-      j += itf->size;
-    }
-    break;
+void
+cs_interface_set_sum_start(const cs_interface_set_t  *ifs,
+                           cs_lnum_t                  n_elts,
+                           cs_lnum_t                  stride,
+                           bool                       interlace,
+                           cs_datatype_t              datatype,
+                           bool                       float_exchange,
+                           void                      *var)
+{
+  cs_datatype_t x_type = datatype;
+  if (float_exchange && datatype == CS_DOUBLE)
+    x_type = CS_FLOAT;
 
-  case CS_INT32:
-    for (i = 0, j = 0; i < ifs->size; i++) {
-      cs_interface_t *itf = ifs->interfaces[i];
-      int32_t *v = var;
-      const int32_t *p = (const int32_t *)buf + j*stride;
-      if (stride < 2 || interlace) {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id*stride + l] += p[k*stride + l];
-        }
-      }
-      else {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id + l*n_elts] += p[k*stride + l];
-        }
-      }
-      j += itf->size;
-    }
-    break;
+  _cs_interface_comm_plan_t  *cp = _get_comm_plan(ifs, x_type, stride, true);
 
-  case CS_INT64:
-    for (i = 0, j = 0; i < ifs->size; i++) {
-      cs_interface_t *itf = ifs->interfaces[i];
-      int64_t *v = var;
-      const int64_t *p = (const int64_t *)buf + j*stride;
-      if (stride < 2 || interlace) {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id*stride + l] += p[k*stride + l];
-        }
-      }
-      else {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id + l*n_elts] += p[k*stride + l];
-        }
-      }
-      j += itf->size;
-    }
-    break;
+  _comm_plan_start(ifs, cp, n_elts, interlace, datatype, var);
+}
 
-  case CS_UINT16:
-    for (i = 0, j = 0; i < ifs->size; i++) {
-      cs_interface_t *itf = ifs->interfaces[i];
-      uint16_t *v = var;
-      const uint16_t *p = (const uint16_t *)buf + j*stride;
-      if (stride < 2 || interlace) {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id*stride + l] += p[k*stride + l];
-        }
-      }
-      else {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id + l*n_elts] += p[k*stride + l];
-        }
-      }
-      j += itf->size;
-    }
-    break;
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete updating the sum of values for elements associated with
+ * an interface set.
+ *
+ * This function waits for the exchanges posted by
+ * \ref cs_interface_set_sum_start for the same variable, and adds
+ * received contributions.
+ *
+ * \param[in]       ifs             pointer to a fvm_interface_set_t structure
+ * \param[in]       n_elts          number of elements in var buffer
+ * \param[in]       stride          number of values (non interlaced)
+ *                                  by entity
+ * \param[in]       interlace       true if variable is interlaced
+ *                                  (for stride > 1)
+ * \param[in]       datatype        type of data considered
+ * \param[in]       float_exchange  exchange double values as floats
+ * \param[in, out]  var             variable buffer
+ */
+/*----------------------------------------------------------------------------*/
 
-  case CS_UINT32:
-    for (i = 0, j = 0; i < ifs->size; i++) {
-      cs_interface_t *itf = ifs->interfaces[i];
-      uint32_t *v = var;
-      const uint32_t *p = (const uint32_t *)buf + j*stride;
-      if (stride < 2 || interlace) {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id*stride + l] += p[k*stride + l];
-        }
-      }
-      else {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id + l*n_elts] += p[k*stride + l];
-        }
-      }
-      j += itf->size;
+void
+cs_interface_set_sum_wait(const cs_interface_set_t  *ifs,
+                          cs_lnum_t                  n_elts,
+                          cs_lnum_t                  stride,
+                          bool                       interlace,
+                          cs_datatype_t              datatype,
+                          bool                       float_exchange,
+                          void                      *var)
+{
+  cs_datatype_t x_type = datatype;
+  if (float_exchange && datatype == CS_DOUBLE)
+    x_type = CS_FLOAT;
+
+  _cs_interface_comm_plan_set_t  *cps = ifs->cps;
+  _cs_interface_comm_plan_t  *cp = NULL;
+
+  for (int i = 0; i < cps->n_plans; i++) {
+    if (   cps->plans[i].pending_var == var
+        && cps->plans[i].datatype == x_type
+        && cps->plans[i].stride == stride) {
+      cp = cps->plans + i;
+      break;
     }
-    break;
+  }
 
-  case CS_UINT64:
-    for (i = 0, j = 0; i < ifs->size; i++) {
+  if (cp == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: no matching exchange was started."), __func__);
+
+#if defined(HAVE_MPI)
+  if (cp->n_requests > 0)
+    MPI_Waitall(cp->n_requests, cp->request, MPI_STATUSES_IGNORE);
+#endif
+
+  cp->pending_var = NULL;
+
+  /* Now increment values */
+
+  if (x_type == datatype)
+    _interface_set_sum_buf(ifs, n_elts, stride, interlace, datatype,
+                           cp->recv_buf, var);
+
+  else {
+
+    const cs_lnum_t l_stride = (stride < 2 || interlace) ? stride : 1;
+    const cs_lnum_t c_stride = (stride < 2 || interlace) ? 1 : n_elts;
+
+    double *v = var;
+
+    for (int i = 0, j = 0; i < ifs->size; i++) {
       cs_interface_t *itf = ifs->interfaces[i];
-      uint64_t *v = var;
-      const uint64_t *p = (const uint64_t *)buf + j*stride;
-      if (stride < 2 || interlace) {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id*stride + l] += p[k*stride + l];
-        }
-      }
-      else {
-        for (k = 0; k < itf->size; k++) {
-          cs_lnum_t elt_id = itf->elt_id[k];
-          for (l = 0; l < stride; l++)
-            v[elt_id + l*n_elts] += p[k*stride + l];
-        }
+      const float *p = (const float *)(cp->recv_buf) + j*stride;
+      for (cs_lnum_t k = 0; k < itf->size; k++) {
+        cs_lnum_t elt_id = itf->elt_id[k];
+        for (cs_lnum_t l = 0; l < stride; l++)
+          v[elt_id*l_stride + l*c_stride] += p[k*stride + l];
       }
       j += itf->size;
     }
-    break;
 
-  default:
-    bft_error(__FILE__, __LINE__, 0,
-              _("Called cs_interface_set_sum with unhandled datatype (%d)."),
-              (int)datatype);
   }
-
-  BFT_FREE(buf);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -505,6 +505,73 @@ cs_interface_set_sum(const cs_interface_set_t  *ifs,
                      cs_datatype_t              datatype,
                      void                      *var);
 
+/*----------------------------------------------------------------------------
+ * Start updating the sum of values for elements associated with an
+ * interface set, using a persistent communication plan.
+ *
+ * This function packs local contributions and posts the matching
+ * exchanges, and returns without waiting for their completion, so that
+ * computations which do not involve the variable may be overlapped with
+ * communication. It must be followed by a call to
+ * cs_interface_set_sum_wait() with the same arguments.
+ *
+ * Communication plans (with preallocated buffers and persistent requests)
+ * are built on the first call for a given type and stride, and reused
+ * afterwards, including by cs_interface_set_sum(). Several such
+ * exchanges may be pending at the same time, as long as they apply to
+ * different variables.
+ *
+ * If float_exchange is true and datatype is CS_DOUBLE, values are
+ * exchanged in single precision, which reduces the communication volume,
+ * but should be restricted to cases where the loss of precision is
+ * acceptable (such as preconditioning).
+ *
+ * parameters:
+ *   ifs            <-- pointer to a fvm_interface_set_t structure
+ *   n_elts         <-- number of elements in var buffer
+ *   stride         <-- number of values (non interlaced) by entity
+ *   interlace      <-- true if variable is interlaced (for stride > 1)
+ *   datatype       <-- type of data considered
+ *   float_exchange <-- exchange double values as floats
+ *   var            <-> variable buffer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_interface_set_sum_start(const cs_interface_set_t  *ifs,
+                           cs_lnum_t                  n_elts,
+                           cs_lnum_t                  stride,
+                           bool                       interlace,
+                           cs_datatype_t              datatype,
+                           bool                       float_exchange,
+                           void                      *var);
+
+/*----------------------------------------------------------------------------
+ * Complete updating the sum of values for elements associated with
+ * an interface set.
+ *
+ * This function waits for the exchanges posted by
+ * cs_interface_set_sum_start() for the same variable, and adds
+ * received contributions.
+ *
+ * parameters:
+ *   ifs            <-- pointer to a fvm_interface_set_t structure
+ *   n_elts         <-- number of elements in var buffer
+ *   stride         <-- number of values (non interlaced) by entity
+ *   interlace      <-- true if variable is interlaced (for stride > 1)
+ *   datatype       <-- type of data considered
+ *   float_exchange <-- exchange double values as floats
+ *   var            <-> variable buffer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_interface_set_sum_wait(const cs_interface_set_t  *ifs,
+                          cs_lnum_t                  n_elts,
+                          cs_lnum_t                  stride,
+                          bool                       interlace,
+                          cs_datatype_t              datatype,
+                          bool                       float_exchange,
+                          void                      *var);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update the sum of values for elements associated with an
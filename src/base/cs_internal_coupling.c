@@ -62,6 +62,8 @@
 #include "cs_mesh.h"
 #include "cs_mesh_boundary.h"
 #include "cs_mesh_quantities.h"
+#include "cs_order.h"
+#include "cs_rank_neighbors.h"
 #include "cs_convection_diffusion.h"
 #include "cs_field.h"
 #include "cs_field_operator.h"
@@ -347,6 +349,232 @@ _create_locator(cs_internal_coupling_t  *cpl)
   return locator;
 }
 
+/*----------------------------------------------------------------------------
+ * Build the exchange plan of a given coupling entity.
+ *
+ * The locator is only used once here, so as to determine the rank and
+ * id of the distant face associated with each local face; later exchanges
+ * use a halo built from this pairing, which only involves ranks actually
+ * sharing coupled faces. Values whose source is on the local rank are
+ * not handled by the halo, but copied directly.
+ *
+ * parameters:
+ *   cpl <-> pointer to coupling structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_plan_initialize(cs_internal_coupling_t  *cpl)
+{
+  const cs_lnum_t n_local = cpl->n_local;
+  const cs_lnum_t n_distant = cpl->n_distant;
+  const cs_lnum_t l_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  /* Exchange source rank and id of distant values */
+
+  cs_lnum_t *d_src = NULL, *l_src = NULL;
+  BFT_MALLOC(d_src, n_distant*2, cs_lnum_t);
+  BFT_MALLOC(l_src, n_local*2, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_distant; i++) {
+    d_src[i*2] = l_rank;
+    d_src[i*2 + 1] = i;
+  }
+  for (cs_lnum_t i = 0; i < n_local*2; i++)
+    l_src[i] = -1;
+
+  ple_locator_exchange_point_var(cpl->locator,
+                                 d_src,
+                                 l_src,
+                                 NULL,
+                                 sizeof(cs_lnum_t),
+                                 2,
+                                 0);
+
+  BFT_FREE(d_src);
+
+  /* Order received values lexicographically by source rank and id,
+     ignoring local faces for which no value is received */
+
+  cs_lnum_t *order = NULL;
+  BFT_MALLOC(order, n_local, cs_lnum_t);
+  cs_order_lnum_allocated_s(NULL, l_src, 2, order, n_local);
+
+  cs_lnum_t s_id = 0;
+  while (s_id < n_local && l_src[order[s_id]*2] < 0)
+    s_id++;
+
+  const cs_lnum_t n_x_elts = n_local - s_id;
+
+  cpl->n_x_elts = n_x_elts;
+  BFT_MALLOC(cpl->x_local_id, n_x_elts, cs_lnum_t);
+  BFT_MALLOC(cpl->x_distant_id, n_x_elts, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_x_elts; i++) {
+    cs_lnum_t j = order[s_id + i];
+    cpl->x_local_id[i] = j;
+    cpl->x_distant_id[i] = l_src[j*2 + 1];
+  }
+
+  BFT_FREE(order);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    int *x_rank = NULL, *x_rank_id = NULL;
+    cs_lnum_t *x_id = NULL;
+    BFT_MALLOC(x_rank, n_x_elts, int);
+    BFT_MALLOC(x_rank_id, n_x_elts, int);
+    BFT_MALLOC(x_id, n_x_elts, cs_lnum_t);
+
+    /* Values from other ranks are placed after distant values
+       in exchange buffers */
+
+    cs_lnum_t n_h_elts = 0;
+
+    for (cs_lnum_t i = 0; i < n_x_elts; i++) {
+      cs_lnum_t j = cpl->x_local_id[i];
+      if (l_src[j*2] != l_rank) {
+        x_rank[n_h_elts] = l_src[j*2];
+        x_id[n_h_elts] = l_src[j*2 + 1];
+        cpl->x_distant_id[i] = n_distant + n_h_elts;
+        n_h_elts++;
+      }
+    }
+
+    cs_rank_neighbors_t *rn = cs_rank_neighbors_create(n_h_elts, x_rank);
+
+    cs_rank_neighbors_symmetrize(rn, cs_glob_mpi_comm);
+
+    cs_rank_neighbors_to_index(rn, n_h_elts, x_rank, x_rank_id);
+
+    cpl->x_halo = cs_halo_create_from_rank_neighbors(rn,
+                                                     n_distant,
+                                                     n_h_elts,
+                                                     x_rank_id,
+                                                     x_id);
+
+    cs_halo_update_buffers(cpl->x_halo);
+
+    cs_rank_neighbors_destroy(&rn);
+
+    BFT_FREE(x_id);
+    BFT_FREE(x_rank_id);
+    BFT_FREE(x_rank);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  BFT_FREE(l_src);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the number of elements of a buffer used for exchanges.
+ *
+ * Such a buffer contains distant values, followed by received values
+ * when the exchange requires communication.
+ *
+ * parameters:
+ *   cpl <-- pointer to coupling structure
+ *
+ * returns:
+ *   number of elements of exchange buffer
+ *----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_exchange_buffer_size(const cs_internal_coupling_t  *cpl)
+{
+  cs_lnum_t n_elts = cpl->n_distant;
+
+  if (cpl->x_halo != NULL)
+    n_elts += cpl->x_halo->n_elts[CS_HALO_STANDARD];
+
+  return n_elts;
+}
+
+/*----------------------------------------------------------------------------
+ * Exchange values from distant to local faces using the exchange plan.
+ *
+ * parameters:
+ *   cpl       <-- pointer to coupling structure
+ *   datatype  <-- data type (CS_REAL_TYPE or CS_GNUM_TYPE)
+ *   stride    <-- number of values per face
+ *   buf       <-> exchange buffer, with distant values at the beginning
+ *                 (size: _exchange_buffer_size(cpl)*stride)
+ *   local     --> local values (size: cpl->n_local*stride)
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_buffer(const cs_internal_coupling_t  *cpl,
+                 cs_datatype_t                  datatype,
+                 int                            stride,
+                 void                          *buf,
+                 void                          *local)
+{
+  const cs_lnum_t n_x_elts = cpl->n_x_elts;
+  const cs_lnum_t *x_local_id = cpl->x_local_id;
+  const cs_lnum_t *x_distant_id = cpl->x_distant_id;
+  const size_t elt_size = cs_datatype_size[datatype]*stride;
+
+  if (cpl->x_halo != NULL) {
+    if (datatype == CS_REAL_TYPE)
+      cs_halo_sync_var_strided(cpl->x_halo, CS_HALO_STANDARD, buf, stride);
+    else
+      cs_halo_sync_untyped(cpl->x_halo, CS_HALO_STANDARD, elt_size, buf);
+  }
+
+  if (datatype == CS_REAL_TYPE) {
+    const cs_real_t *_buf = buf;
+    cs_real_t *_local = local;
+    for (cs_lnum_t i = 0; i < n_x_elts; i++) {
+      cs_lnum_t s_id = x_distant_id[i];
+      cs_lnum_t l_id = x_local_id[i];
+      for (cs_lnum_t j = 0; j < stride; j++)
+        _local[l_id*stride + j] = _buf[s_id*stride + j];
+    }
+  }
+  else {
+    const unsigned char *_buf = buf;
+    unsigned char *_local = local;
+    for (cs_lnum_t i = 0; i < n_x_elts; i++)
+      memcpy(_local + x_local_id[i]*elt_size,
+             _buf + x_distant_id[i]*elt_size,
+             elt_size);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Exchange global ids of cells adjacent to coupled faces.
+ *
+ * parameters:
+ *   cpl     <-- pointer to coupling structure
+ *   r_g_id  <-- global row ids (per cell)
+ *   g_id_d  --> global ids of distant cells (size: cpl->n_local)
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_g_ids(const cs_internal_coupling_t  *cpl,
+                const cs_gnum_t                r_g_id[],
+                cs_gnum_t                      g_id_d[])
+{
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)cs_glob_mesh->b_face_cells;
+
+  cs_gnum_t *buf = NULL;
+  BFT_MALLOC(buf, _exchange_buffer_size(cpl), cs_gnum_t);
+
+  for (cs_lnum_t ii = 0; ii < cpl->n_distant; ii++) {
+    cs_lnum_t face_id = cpl->faces_distant[ii];
+    cs_lnum_t cell_id = b_face_cells[face_id]; /* boundary to cell */
+    buf[ii] = r_g_id[cell_id];
+  }
+
+  _exchange_buffer(cpl, CS_GNUM_TYPE, 1, buf, g_id_d);
+
+  BFT_FREE(buf);
+}
+
 /*----------------------------------------------------------------------------
  * Destruction of given internal coupling structure.
  *
@@ -367,6 +595,10 @@ _destroy_entity(cs_internal_coupling_t  *cpl)
   BFT_FREE(cpl->cells_criteria);
   BFT_FREE(cpl->faces_criteria);
   BFT_FREE(cpl->namesca);
+  BFT_FREE(cpl->b_face_local_id);
+  BFT_FREE(cpl->x_local_id);
+  BFT_FREE(cpl->x_distant_id);
+  cs_halo_destroy(&(cpl->x_halo));
   ple_locator_destroy(cpl->locator);
 }
 
@@ -599,14 +831,17 @@ _initialize_coupled_faces(cs_internal_coupling_t *cpl)
   const cs_lnum_t *faces_local = cpl->faces_local;
   const cs_mesh_t *m = cs_glob_mesh;
   bool *coupled_faces = cpl->coupled_faces;
+  cs_lnum_t *b_face_local_id = cpl->b_face_local_id;
 
   for (cs_lnum_t face_id = 0; face_id < m->n_b_faces; face_id++) {
     coupled_faces[face_id] = false;
+    b_face_local_id[face_id] = -1;
   }
 
   for (cs_lnum_t ii = 0; ii < n_local; ii++) {
     cs_lnum_t face_id = faces_local[ii];
     coupled_faces[face_id] = true;
+    b_face_local_id[face_id] = ii;
   }
 }
 
@@ -632,6 +867,12 @@ _cpl_initialize(cs_internal_coupling_t *cpl)
   cpl->faces_distant = NULL;
 
   cpl->coupled_faces = NULL;
+  cpl->b_face_local_id = NULL;
+
+  cpl->n_x_elts = 0;
+  cpl->x_local_id = NULL;
+  cpl->x_distant_id = NULL;
+  cpl->x_halo = NULL;
 
   cpl->g_weight = NULL;
   cpl->ci_cj_vect = NULL;
@@ -874,6 +1115,8 @@ _locator_initialize(cs_mesh_t               *m,
   for (cs_lnum_t i = 0; i < cpl->n_distant; i++)
     cpl->faces_distant[i] = faces_distant_num[i] - 1;
 
+  _exchange_plan_initialize(cpl);
+
   /* Geometric quantities */
 
   BFT_MALLOC(cpl->g_weight, cpl->n_local, cs_real_t);
@@ -883,6 +1126,7 @@ _locator_initialize(cs_mesh_t               *m,
   _compute_ci_cj_vect(cpl);
 
   BFT_MALLOC(cpl->coupled_faces, m->n_b_faces, bool);
+  BFT_MALLOC(cpl->b_face_local_id, m->n_b_faces, cs_lnum_t);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -2223,13 +2467,19 @@ cs_internal_coupling_exchange_var(const cs_internal_coupling_t  *cpl,
                                   cs_real_t                      distant[],
                                   cs_real_t                      local[])
 {
-  ple_locator_exchange_point_var(cpl->locator,
-                                 distant,
-                                 local,
-                                 NULL,
-                                 sizeof(cs_real_t),
-                                 stride,
-                                 0);
+  if (cpl->x_halo == NULL) {
+    _exchange_buffer(cpl, CS_REAL_TYPE, stride, distant, local);
+    return;
+  }
+
+  cs_real_t *buf = NULL;
+  BFT_MALLOC(buf, _exchange_buffer_size(cpl)*stride, cs_real_t);
+
+  memcpy(buf, distant, cpl->n_distant*stride*sizeof(cs_real_t));
+
+  _exchange_buffer(cpl, CS_REAL_TYPE, stride, buf, local);
+
+  BFT_FREE(buf);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2260,10 +2510,10 @@ cs_internal_coupling_exchange_by_cell_id(const cs_internal_coupling_t  *cpl,
   const cs_lnum_t *restrict b_face_cells
     = (const cs_lnum_t *restrict)m->b_face_cells;
 
-  /* Initialize distant array */
+  /* Initialize distant values in exchange buffer */
 
   cs_real_t *distant = NULL;
-  BFT_MALLOC(distant, n_distant*stride, cs_real_t);
+  BFT_MALLOC(distant, _exchange_buffer_size(cpl)*stride, cs_real_t);
   for (cs_lnum_t ii = 0; ii < n_distant; ii++) {
     face_id = faces_distant[ii];
     cell_id = b_face_cells[face_id];
@@ -2273,10 +2523,8 @@ cs_internal_coupling_exchange_by_cell_id(const cs_internal_coupling_t  *cpl,
 
   /* Exchange variable */
 
-  cs_internal_coupling_exchange_var(cpl,
-                                    stride,
-                                    distant,
-                                    local);
+  _exchange_buffer(cpl, CS_REAL_TYPE, stride, distant, local);
+
   /* Free memory */
   BFT_FREE(distant);
 }
@@ -2301,10 +2549,10 @@ cs_internal_coupling_exchange_by_face_id(const cs_internal_coupling_t  *cpl,
   const cs_lnum_t n_distant = cpl->n_distant;
   const cs_lnum_t *faces_distant = cpl->faces_distant;
 
-  /* Initialize distant array */
+  /* Initialize distant values in exchange buffer */
 
   cs_real_t *distant = NULL;
-  BFT_MALLOC(distant, n_distant*stride, cs_real_t);
+  BFT_MALLOC(distant, _exchange_buffer_size(cpl)*stride, cs_real_t);
   for (cs_lnum_t ii = 0; ii < n_distant; ii++) {
     cs_lnum_t face_id = faces_distant[ii];
     for (cs_lnum_t jj = 0; jj < stride; jj++)
@@ -2313,10 +2561,8 @@ cs_internal_coupling_exchange_by_face_id(const cs_internal_coupling_t  *cpl,
 
   /* Exchange variable */
 
-  cs_internal_coupling_exchange_var(cpl,
-                                    stride,
-                                    distant,
-                                    local);
+  _exchange_buffer(cpl, CS_REAL_TYPE, stride, distant, local);
+
   /* Free memory */
   BFT_FREE(distant);
 }
@@ -2482,19 +2728,7 @@ cs_internal_coupling_matrix_add_ids(int                     coupling_id,
 
   /* local to global preparation and exchange */
 
-  for (cs_lnum_t ii = 0; ii < n_local; ii++) {
-    cs_lnum_t face_id = cpl->faces_distant[ii];
-    cs_lnum_t cell_id = b_face_cells[face_id]; /* boundary to cell */
-    g_id_l[ii] = r_g_id[cell_id];
-  }
-
-  ple_locator_exchange_point_var(cpl->locator,
-                                 g_id_l,
-                                 g_id_d,
-                                 NULL,
-                                 sizeof(cs_gnum_t),
-                                 1,
-                                 0);
+  _exchange_g_ids(cpl, r_g_id, g_id_d);
 
   /* local side */
 
@@ -2570,19 +2804,7 @@ cs_internal_coupling_matrix_add_values(const cs_field_t              *f,
   BFT_MALLOC(g_id_l, n_local, cs_gnum_t);
   BFT_MALLOC(g_id_d, n_local, cs_gnum_t);
 
-  for (cs_lnum_t ii = 0; ii < n_local; ii++) {
-    cs_lnum_t face_id = cpl->faces_distant[ii];
-    cs_lnum_t cell_id = b_face_cells[face_id]; /* boundary to cell */
-    g_id_l[ii] = r_g_id[cell_id];
-  }
-
-  ple_locator_exchange_point_var(cpl->locator,
-                                 g_id_l,
-                                 g_id_d,
-                                 NULL,
-                                 sizeof(cs_gnum_t),
-                                 1,
-                                 0);
+  _exchange_g_ids(cpl, r_g_id, g_id_d);
 
   /* local side */
 
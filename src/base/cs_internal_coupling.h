@@ -40,6 +40,7 @@
 #include "cs_defs.h"
 
 #include "cs_base.h"
+#include "cs_halo.h"
 #include "cs_matrix_assembler.h"
 #include "cs_mesh.h"
 #include "cs_mesh_quantities.h"
@@ -82,6 +83,19 @@ typedef struct {
   /* face i is coupled in this entity if coupled_faces[i] = true */
   bool *coupled_faces;
 
+  /* Id of each boundary face in faces_local, or -1 if not coupled */
+  cs_lnum_t *b_face_local_id;
+
+  /* Exchange plan built from the locator pairing: exchange buffers
+     contain values at faces_distant, followed by values received through
+     x_halo; value i is copied from buffer element x_distant_id[i]
+     to local face x_local_id[i] */
+  cs_lnum_t   n_x_elts;      /* Number of exchanged values */
+  cs_lnum_t  *x_local_id;    /* Local face id of exchanged values */
+  cs_lnum_t  *x_distant_id;  /* Buffer element id of exchanged values */
+  cs_halo_t  *x_halo;        /* Halo for values from other ranks,
+                                or NULL */
+
   /* Geometrical weights around coupling interface */
   cs_real_t *g_weight;
 
@@ -49,6 +49,7 @@
 #include "cs_gradient.h"
 #include "cs_halo.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
@@ -82,6 +83,22 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Precomputed P1 interpolation stencil */
+
+struct _cs_interpolate_p1_stencil_t {
+
+  cs_lnum_t     n_points;          /* Number of interpolation points */
+  cs_lnum_t    *point_location;    /* Cell id of each point, or -1 */
+  cs_real_3_t  *point_coords;      /* Point coordinates */
+
+  cs_lnum_t    *idx[2];            /* Stencil index per point, for standard
+                                      and extended neighborhoods (NULL if
+                                      not built yet) */
+  cs_lnum_t    *c_ids[2];          /* Neighbor cell ids */
+  cs_real_t    *w[2];              /* Matching weights */
+
+};
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -92,6 +109,199 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Determine the boundary conditions and gradient neighborhood used for the
+ * P1 interpolation of a given field.
+ *
+ * parameters:
+ *   input      <-- field name, or NULL
+ *   halo_type  --> associated halo type
+ *   bc_coeff_a --> associated boundary values or coefficients, or NULL
+ *   bc_coeff_b --> associated boundary coefficients, or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_p1_field_info(const void        *input,
+               cs_halo_type_t    *halo_type,
+               const cs_real_t  **bc_coeff_a,
+               const cs_real_t  **bc_coeff_b)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  *halo_type = (m->cell_cells_idx != NULL) ?
+    CS_HALO_EXTENDED : CS_HALO_STANDARD;
+
+  *bc_coeff_a = NULL;
+  *bc_coeff_b = NULL;
+
+  if (input == NULL)
+    return;
+
+  const char *name = input;
+  cs_field_t *f = cs_field_by_name_try(name);
+  if (f == NULL)
+    return;
+
+  int kbf = cs_field_key_id_try("boundary_value_id");
+  int bf_id = cs_field_get_key_int(f, kbf);
+  if (bf_id > -1) {
+    const cs_field_t *bf = cs_field_by_id(bf_id);
+    *bc_coeff_a = bf->val;
+  }
+  else if (f->bc_coeffs != NULL) {
+    *bc_coeff_a = f->bc_coeffs->a;
+    *bc_coeff_b = f->bc_coeffs->b;
+    if (f->dim > 1 && f->type & CS_FIELD_VARIABLE) {
+      int coupled = 0;
+      int coupled_key_id = cs_field_key_id_try("coupled");
+      if (coupled_key_id > -1)
+        coupled = cs_field_get_key_int(f, coupled_key_id);
+      if (coupled == 0) {   /* not handled in this case */
+        *bc_coeff_a = NULL;
+        *bc_coeff_b = NULL;
+      }
+    }
+  }
+  if (f->type & CS_FIELD_VARIABLE) {
+    const cs_equation_param_t *eqp
+      = cs_field_get_equation_param_const(f);
+    cs_gradient_type_t gradient_type = CS_GRADIENT_LSQ;
+    cs_gradient_type_by_imrgra(eqp->imrgra,
+                               &gradient_type,
+                               halo_type);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build P1 interpolation stencil for a given neighborhood type.
+ *
+ * The interpolated value at a point p in cell c is
+ *   v_c + d.G, with d = x_p - x_c
+ * where the least-squares gradient G = C^-1 sum_j(dc_j (v_j - v_c) / |dc_j|^2)
+ * only depends linearly on neighbor cell values for cells with no boundary
+ * face. It can thus be written as
+ *   v_c + sum_j(w_j (v_j - v_c)), with w_j = (C^-1 d).dc_j / |dc_j|^2
+ *
+ * Points in cells with boundary faces, whose gradient also depends on
+ * boundary conditions, have an empty stencil and are handled separately.
+ *
+ * parameters:
+ *   s       <-> stencil structure
+ *   h_id    <-- 0 for standard, 1 for extended neighborhood
+ *----------------------------------------------------------------------------*/
+
+static void
+_p1_stencil_build(cs_interpolate_p1_stencil_t  *s,
+                  int                           h_id)
+{
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+
+  const cs_lnum_t *cell_cells_idx[2] = {ma->cell_cells_idx,
+                                        ma->cell_cells_e_idx};
+  const cs_lnum_t *cell_cells[2] = {ma->cell_cells,
+                                    ma->cell_cells_e};
+
+  const int n_adj = (h_id == 1 && ma->cell_cells_e_idx != NULL) ? 2 : 1;
+
+  const cs_lnum_t n_points = s->n_points;
+
+  /* Count stencil sizes */
+
+  cs_lnum_t *idx;
+  BFT_MALLOC(idx, n_points + 1, cs_lnum_t);
+
+  idx[0] = 0;
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    cs_lnum_t n = 0;
+    cs_lnum_t c_id = s->point_location[i];
+    if (c_id > -1) {
+      if (ma->cell_b_faces_idx[c_id+1] == ma->cell_b_faces_idx[c_id]) {
+        for (int adj_id = 0; adj_id < n_adj; adj_id++)
+          n += cell_cells_idx[adj_id][c_id+1] - cell_cells_idx[adj_id][c_id];
+      }
+    }
+    idx[i+1] = idx[i] + n;
+  }
+
+  cs_lnum_t *c_ids;
+  cs_real_t *w;
+  BFT_MALLOC(c_ids, idx[n_points], cs_lnum_t);
+  BFT_MALLOC(w, idx[n_points], cs_real_t);
+
+  /* Compute weights */
+
+# pragma omp parallel for if (n_points > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+
+    if (idx[i+1] == idx[i])
+      continue;
+
+    cs_lnum_t c_id = s->point_location[i];
+
+    cs_real_t cocg[6] = {0., 0., 0., 0., 0., 0.};
+
+    cs_lnum_t k = idx[i];
+
+    for (int adj_id = 0; adj_id < n_adj; adj_id++) {
+      for (cs_lnum_t j = cell_cells_idx[adj_id][c_id];
+           j < cell_cells_idx[adj_id][c_id+1];
+           j++) {
+        cs_lnum_t c_id1 = cell_cells[adj_id][j];
+        cs_real_t dc[3];
+        for (cs_lnum_t ii = 0; ii < 3; ii++)
+          dc[ii] = cell_cen[c_id1][ii] - cell_cen[c_id][ii];
+
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        cocg[0] += dc[0]*dc[0]*ddc;
+        cocg[1] += dc[1]*dc[1]*ddc;
+        cocg[2] += dc[2]*dc[2]*ddc;
+        cocg[3] += dc[0]*dc[1]*ddc;
+        cocg[4] += dc[1]*dc[2]*ddc;
+        cocg[5] += dc[0]*dc[2]*ddc;
+
+        c_ids[k++] = c_id1;
+      }
+    }
+
+    /* Invert (as in the matching gradient computation) and apply
+       to the point's offset relative to the cell center */
+
+    cs_real_t a00 = cocg[1]*cocg[2] - cocg[4]*cocg[4];
+    cs_real_t a01 = cocg[4]*cocg[5] - cocg[3]*cocg[2];
+    cs_real_t a02 = cocg[3]*cocg[4] - cocg[1]*cocg[5];
+    cs_real_t a11 = cocg[0]*cocg[2] - cocg[5]*cocg[5];
+    cs_real_t a12 = cocg[3]*cocg[5] - cocg[0]*cocg[4];
+    cs_real_t a22 = cocg[0]*cocg[1] - cocg[3]*cocg[3];
+
+    cs_real_t det_inv = 1. / (cocg[0]*a00 + cocg[3]*a01 + cocg[5]*a02);
+
+    cs_real_t d[3] = {s->point_coords[i][0] - cell_cen[c_id][0],
+                      s->point_coords[i][1] - cell_cen[c_id][1],
+                      s->point_coords[i][2] - cell_cen[c_id][2]};
+
+    cs_real_t q[3] = {(a00*d[0] + a01*d[1] + a02*d[2]) * det_inv,
+                      (a01*d[0] + a11*d[1] + a12*d[2]) * det_inv,
+                      (a02*d[0] + a12*d[1] + a22*d[2]) * det_inv};
+
+    for (k = idx[i]; k < idx[i+1]; k++) {
+      cs_lnum_t c_id1 = c_ids[k];
+      cs_real_t dc[3];
+      for (cs_lnum_t ii = 0; ii < 3; ii++)
+        dc[ii] = cell_cen[c_id1][ii] - cell_cen[c_id][ii];
+      cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+      w[k] = (q[0]*dc[0] + q[1]*dc[1] + q[2]*dc[2]) * ddc;
+    }
+
+  }
+
+  s->idx[h_id] = idx;
+  s->c_ids[h_id] = c_ids;
+  s->w[h_id] = w;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -257,47 +467,11 @@ cs_interpolate_from_location_p1(void                *input,
   const cs_real_3_t *cell_cen
     = (const cs_real_3_t *)fvq->cell_cen;
 
-  cs_halo_type_t halo_type
-    = (m->cell_cells_idx != NULL) ? CS_HALO_EXTENDED : CS_HALO_STANDARD;
-
-  cs_field_t *f = NULL;
+  cs_halo_type_t halo_type;
   const cs_real_t *bc_coeff_a = NULL;
   const cs_real_t *bc_coeff_b = NULL;
 
-  if (input != NULL) {
-    const char *name = input;
-    f = cs_field_by_name_try(name);
-    if (f != NULL) {
-      int kbf = cs_field_key_id_try("boundary_value_id");
-      int bf_id = cs_field_get_key_int(f, kbf);
-      if (bf_id > -1) {
-        const cs_field_t *bf = cs_field_by_id(bf_id);
-        bc_coeff_a = bf->val;
-      }
-      else if (f->bc_coeffs != NULL) {
-        bc_coeff_a = f->bc_coeffs->a;
-        bc_coeff_b = f->bc_coeffs->b;
-        if (f->dim > 1 && f->type & CS_FIELD_VARIABLE) {
-          int coupled = 0;
-          int coupled_key_id = cs_field_key_id_try("coupled");
-          if (coupled_key_id > -1)
-            coupled = cs_field_get_key_int(f, coupled_key_id);
-          if (coupled == 0) {   /* not handled in this case */
-            bc_coeff_a = NULL;
-            bc_coeff_b = NULL;
-          }
-        }
-      }
-      if (f->type & CS_FIELD_VARIABLE) {
-        const cs_equation_param_t *eqp
-          = cs_field_get_equation_param_const(f);
-        cs_gradient_type_t gradient_type = CS_GRADIENT_LSQ;
-        cs_gradient_type_by_imrgra(eqp->imrgra,
-                                   &gradient_type,
-                                   &halo_type);
-      }
-    }
-  }
+  _p1_field_info(input, &halo_type, &bc_coeff_a, &bc_coeff_b);
 
   switch(val_dim) {
   case 1:
@@ -364,7 +538,7 @@ cs_interpolate_from_location_p1(void                *input,
           }
         }
         else {
-          for (cs_lnum_t j = 0; j < 6; j++)
+          for (cs_lnum_t j = 0; j < 3; j++)
             p_vals[i][j] = 0;
         }
       }
@@ -413,6 +587,210 @@ cs_interpolate_from_location_p1(void                *input,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a P1 interpolation stencil for a given set of points.
+ *
+ * The stencil weights are computed on first use, for the gradient
+ * neighborhood required by the interpolated field, and reused for all
+ * subsequent interpolations, so the stencil must be destroyed and
+ * recreated if point locations or the mesh change.
+ *
+ * \param[in]  n_points        number of interpolation points
+ * \param[in]  point_location  location of points in cells (-1 if unlocated)
+ * \param[in]  point_coords    point coordinates
+ *
+ * \return  pointer to new stencil structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_interpolate_p1_stencil_t *
+cs_interpolate_p1_stencil_create(cs_lnum_t          n_points,
+                                 const cs_lnum_t    point_location[],
+                                 const cs_real_3_t  point_coords[])
+{
+  cs_interpolate_p1_stencil_t *s;
+
+  BFT_MALLOC(s, 1, cs_interpolate_p1_stencil_t);
+
+  s->n_points = n_points;
+
+  BFT_MALLOC(s->point_location, n_points, cs_lnum_t);
+  BFT_MALLOC(s->point_coords, n_points, cs_real_3_t);
+
+  memcpy(s->point_location, point_location, n_points*sizeof(cs_lnum_t));
+  memcpy(s->point_coords, point_coords, n_points*sizeof(cs_real_3_t));
+
+  for (int h_id = 0; h_id < 2; h_id++) {
+    s->idx[h_id] = NULL;
+    s->c_ids[h_id] = NULL;
+    s->w[h_id] = NULL;
+  }
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a P1 interpolation stencil.
+ *
+ * \param[in, out]  s  pointer to stencil structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_interpolate_p1_stencil_destroy(cs_interpolate_p1_stencil_t  **s)
+{
+  cs_interpolate_p1_stencil_t *_s = *s;
+
+  if (_s == NULL)
+    return;
+
+  for (int h_id = 0; h_id < 2; h_id++) {
+    BFT_FREE(_s->idx[h_id]);
+    BFT_FREE(_s->c_ids[h_id]);
+    BFT_FREE(_s->w[h_id]);
+  }
+
+  BFT_FREE(_s->point_location);
+  BFT_FREE(_s->point_coords);
+
+  BFT_FREE(*s);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Interpolate cell values at the points of a P1 stencil.
+ *
+ * This is equivalent to \ref cs_interpolate_from_location_p1 with the
+ * stencil's points, but points in cells without boundary faces use the
+ * precomputed weights, so that the least-squares gradient does not need
+ * to be rebuilt for each point and each field. Points in cells with
+ * boundary faces use \ref cs_interpolate_from_location_p1 directly.
+ *
+ * \param[in, out]  s              pointer to stencil structure
+ * \param[in, out]  input          pointer to optional (untyped) value
+ *                                 or structure (field name).
+ * \param[in]       datatype       associated datatype
+ * \param[in]       val_dim        dimension of data values
+ * \param[in]       location_vals  values at cells
+ * \param[out]      point_vals     interpolated values at points
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_interpolate_p1_stencil_apply(cs_interpolate_p1_stencil_t  *s,
+                                void                         *input,
+                                cs_datatype_t                 datatype,
+                                int                           val_dim,
+                                const void                   *location_vals,
+                                void                         *point_vals)
+{
+  const cs_lnum_t n_points = s->n_points;
+
+  if (   datatype != CS_REAL_TYPE
+      || (val_dim != 1 && val_dim != 3 && val_dim != 6)) {
+    cs_interpolate_from_location_p1(input,
+                                    datatype,
+                                    val_dim,
+                                    n_points,
+                                    s->point_location,
+                                    (const cs_real_3_t *)s->point_coords,
+                                    location_vals,
+                                    point_vals);
+    return;
+  }
+
+  cs_halo_type_t halo_type;
+  const cs_real_t *bc_coeff_a = NULL;
+  const cs_real_t *bc_coeff_b = NULL;
+
+  _p1_field_info(input, &halo_type, &bc_coeff_a, &bc_coeff_b);
+
+  const int h_id = (halo_type == CS_HALO_EXTENDED) ? 1 : 0;
+
+  if (s->idx[h_id] == NULL)
+    _p1_stencil_build(s, h_id);
+
+  const cs_lnum_t *restrict idx = s->idx[h_id];
+  const cs_lnum_t *restrict c_ids = s->c_ids[h_id];
+  const cs_real_t *restrict w = s->w[h_id];
+
+  const cs_real_t *restrict c_vals = (const cs_real_t *)location_vals;
+  cs_real_t *restrict p_vals = (cs_real_t *)point_vals;
+
+  /* Points with precomputed stencil (or unlocated) */
+
+  cs_lnum_t n_b_points = 0;
+
+# pragma omp parallel for reduction(+:n_b_points) if (n_points > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    cs_lnum_t c_id = s->point_location[i];
+    if (c_id < 0) {
+      for (cs_lnum_t l = 0; l < val_dim; l++)
+        p_vals[i*val_dim + l] = 0;
+    }
+    else if (idx[i+1] > idx[i]) {
+      for (cs_lnum_t l = 0; l < val_dim; l++) {
+        const cs_real_t v_c = c_vals[c_id*val_dim + l];
+        cs_real_t v = v_c;
+        for (cs_lnum_t k = idx[i]; k < idx[i+1]; k++)
+          v += w[k] * (c_vals[c_ids[k]*val_dim + l] - v_c);
+        p_vals[i*val_dim + l] = v;
+      }
+    }
+    else
+      n_b_points += 1;
+  }
+
+  /* Points in cells with boundary faces */
+
+  if (n_b_points > 0) {
+
+    cs_lnum_t *b_point_ids, *b_point_location;
+    cs_real_3_t *b_point_coords;
+    cs_real_t *b_point_vals;
+
+    BFT_MALLOC(b_point_ids, n_b_points, cs_lnum_t);
+    BFT_MALLOC(b_point_location, n_b_points, cs_lnum_t);
+    BFT_MALLOC(b_point_coords, n_b_points, cs_real_3_t);
+    BFT_MALLOC(b_point_vals, n_b_points*val_dim, cs_real_t);
+
+    n_b_points = 0;
+    for (cs_lnum_t i = 0; i < n_points; i++) {
+      cs_lnum_t c_id = s->point_location[i];
+      if (c_id > -1 && idx[i+1] == idx[i]) {
+        b_point_ids[n_b_points] = i;
+        b_point_location[n_b_points] = c_id;
+        for (cs_lnum_t l = 0; l < 3; l++)
+          b_point_coords[n_b_points][l] = s->point_coords[i][l];
+        n_b_points += 1;
+      }
+    }
+
+    cs_interpolate_from_location_p1(input,
+                                    datatype,
+                                    val_dim,
+                                    n_b_points,
+                                    b_point_location,
+                                    (const cs_real_3_t *)b_point_coords,
+                                    location_vals,
+                                    b_point_vals);
+
+    for (cs_lnum_t j = 0; j < n_b_points; j++) {
+      cs_lnum_t i = b_point_ids[j];
+      for (cs_lnum_t l = 0; l < val_dim; l++)
+        p_vals[i*val_dim + l] = b_point_vals[j*val_dim + l];
+    }
+
+    BFT_FREE(b_point_vals);
+    BFT_FREE(b_point_coords);
+    BFT_FREE(b_point_location);
+    BFT_FREE(b_point_ids);
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
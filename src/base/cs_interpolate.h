@@ -50,6 +50,10 @@ BEGIN_C_DECLS
  * Field values interpolation type
  *----------------------------------------------------------------------------*/
 
+/* Opaque precomputed P1 interpolation stencil */
+
+typedef struct _cs_interpolate_p1_stencil_t  cs_interpolate_p1_stencil_t;
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Function pointer for interpolatation of values defined on
@@ -151,6 +155,67 @@ cs_interpolate_from_location_p1(void                *input,
                                  const void          *location_vals,
                                  void                *point_vals);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a P1 interpolation stencil for a given set of points.
+ *
+ * The stencil weights are computed on first use, for the gradient
+ * neighborhood required by the interpolated field, and reused for all
+ * subsequent interpolations, so the stencil must be destroyed and
+ * recreated if point locations or the mesh change.
+ *
+ * \param[in]  n_points        number of interpolation points
+ * \param[in]  point_location  location of points in cells (-1 if unlocated)
+ * \param[in]  point_coords    point coordinates
+ *
+ * \return  pointer to new stencil structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_interpolate_p1_stencil_t *
+cs_interpolate_p1_stencil_create(cs_lnum_t          n_points,
+                                 const cs_lnum_t    point_location[],
+                                 const cs_real_3_t  point_coords[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a P1 interpolation stencil.
+ *
+ * \param[in, out]  s  pointer to stencil structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_interpolate_p1_stencil_destroy(cs_interpolate_p1_stencil_t  **s);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Interpolate cell values at the points of a P1 stencil.
+ *
+ * This is equivalent to \ref cs_interpolate_from_location_p1 with the
+ * stencil's points, but points in cells without boundary faces use the
+ * precomputed weights, so that the least-squares gradient does not need
+ * to be rebuilt for each point and each field. Points in cells with
+ * boundary faces use \ref cs_interpolate_from_location_p1 directly.
+ *
+ * \param[in, out]  s              pointer to stencil structure
+ * \param[in, out]  input          pointer to optional (untyped) value
+ *                                 or structure (field name).
+ * \param[in]       datatype       associated datatype
+ * \param[in]       val_dim        dimension of data values
+ * \param[in]       location_vals  values at cells
+ * \param[out]      point_vals     interpolated values at points
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_interpolate_p1_stencil_apply(cs_interpolate_p1_stencil_t  *s,
+                                void                         *input,
+                                cs_datatype_t                 datatype,
+                                int                           val_dim,
+                                const void                   *location_vals,
+                                void                         *point_vals);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
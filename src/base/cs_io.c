@@ -110,7 +110,7 @@ typedef struct {
    *   5: index of embedded data in data array + 1 if data is
    *      embedded, 0 otherwise
    *   6: datatype id in file
-   *   7: associated file id (in case of multiple files)
+   *   7: compression codec id, or 0
    */
 
   cs_file_off_t  *h_vals;            /* Base values associated
@@ -160,6 +160,8 @@ struct _cs_io_t {
   size_t              type_size;      /* Size of current type */
   char               *sec_name;       /* Pointer to name in section header */
   char               *type_name;      /* Pointer to type in section header */
+  int                 codec;          /* Compression codec id for written
+                                         sections, or 0 */
   void               *data;           /* Pointer to data in section header
                                          (if embedded; NULL otherwise) */
 
@@ -408,6 +410,7 @@ _cs_io_create(cs_io_mode_t   mode,
   cs_io->type_size = 0;
   cs_io->sec_name = NULL;
   cs_io->type_name = NULL;
+  cs_io->codec = 0;
   cs_io->data = NULL;
 
   /* Verbosity and logging */
@@ -442,7 +445,7 @@ _create_index(cs_io_t *inp)
   idx->size = 0;
   idx->max_size = 32;
 
-  BFT_MALLOC(idx->h_vals, idx->max_size*7, cs_file_off_t);
+  BFT_MALLOC(idx->h_vals, idx->max_size*8, cs_file_off_t);
   BFT_MALLOC(idx->offset, idx->max_size, cs_file_off_t);
 
   idx->max_names_size = 256;
@@ -513,7 +516,7 @@ _update_index_and_shift(cs_io_t             *inp,
       idx->max_size = 32;
     else
       idx->max_size *= 2;
-    BFT_REALLOC(idx->h_vals, idx->max_size*7, cs_file_off_t);
+    BFT_REALLOC(idx->h_vals, idx->max_size*8, cs_file_off_t);
     BFT_REALLOC(idx->offset, idx->max_size, cs_file_off_t);
   };
 
@@ -544,13 +547,14 @@ _update_index_and_shift(cs_io_t             *inp,
 
   id = idx->size;
 
-  idx->h_vals[id*7]     = inp->n_vals;
-  idx->h_vals[id*7 + 1] = inp->location_id;
-  idx->h_vals[id*7 + 2] = inp->index_id;
-  idx->h_vals[id*7 + 3] = inp->n_loc_vals;
-  idx->h_vals[id*7 + 4] = idx->names_size;
-  idx->h_vals[id*7 + 5] = 0;
-  idx->h_vals[id*7 + 6] = header->type_read;
+  idx->h_vals[id*8]     = inp->n_vals;
+  idx->h_vals[id*8 + 1] = inp->location_id;
+  idx->h_vals[id*8 + 2] = inp->index_id;
+  idx->h_vals[id*8 + 3] = inp->n_loc_vals;
+  idx->h_vals[id*8 + 4] = idx->names_size;
+  idx->h_vals[id*8 + 5] = 0;
+  idx->h_vals[id*8 + 6] = header->type_read;
+  idx->h_vals[id*8 + 7] = header->codec;
 
   strcpy(idx->names + idx->names_size, inp->sec_name);
   idx->names[new_names_size - 1] = '\0';
@@ -568,7 +572,7 @@ _update_index_and_shift(cs_io_t             *inp,
     cs_file_seek(inp->f, idx->offset[id] + data_shift, CS_FILE_SEEK_SET);
   }
   else {
-    idx->h_vals[id*7 + 5] = idx->data_size + 1;
+    idx->h_vals[id*8 + 5] = idx->data_size + 1;
     memcpy(idx->data + idx->data_size,
            inp->data,
            new_data_size - idx->data_size);
@@ -1318,7 +1322,7 @@ _cs_io_read_body(const cs_io_sec_header_t  *header,
 
   /* Choose global or block mode */
 
-  if (header->n_location_vals > 1)
+  if (header->n_location_vals > 1 && header->codec == 0)
     stride = header->n_location_vals;
 
   if (global_num_start > 0 && global_num_end > 0) {
@@ -1696,6 +1700,8 @@ _write_header(const char     *sec_name,
   case CS_CHAR:
     outp->type_name[0] = 'c';
     outp->type_name[1] = ' ';
+    if (outp->codec > 0)
+      outp->type_name[2] = outp->codec;
     break;
   default:
     break;
@@ -1762,23 +1768,23 @@ _dump_index(const cs_io_sec_index_t  *idx)
 
   bft_printf(_(" %llu indexed records:\n"
                "   (name, n_vals, location_id, index_id, n_loc_vals, type, "
-               "embed, file_id, offset)\n\n"),
+               "embed, codec, offset)\n\n"),
              (unsigned long long)(idx->size));
 
   for (ii = 0; ii < idx->size; ii++) {
 
     char embed = 'n';
-    cs_file_off_t *h_vals = idx->h_vals + ii*7;
+    cs_file_off_t *h_vals = idx->h_vals + ii*8;
     const char *name = idx->names + h_vals[4];
 
     if (h_vals[5] > 0)
       embed = 'y';
 
-    bft_printf(_(" %40s %10llu %2u %2u %2u %6s %c %2u %ld\n"),
+    bft_printf(_(" %40s %10llu %2u %2u %2u %6s %c %c %ld\n"),
                name, (unsigned long long)(h_vals[0]),
                (unsigned)(h_vals[1]), (unsigned)(h_vals[2]),
                (unsigned)(h_vals[3]), cs_datatype_name[h_vals[6]],
-               embed, (unsigned)(h_vals[7]),
+               embed, (h_vals[7] > 0) ? (char)(h_vals[7]) : '-',
                (long)(idx->offset[ii]));
 
   }
@@ -2035,7 +2041,7 @@ cs_io_get_indexed_sec_name(const cs_io_t  *inp,
 
   if (inp != NULL && inp->index != NULL) {
     if (id < inp->index->size) {
-      size_t name_id = inp->index->h_vals[7*id + 4];
+      size_t name_id = inp->index->h_vals[8*id + 4];
       retval = inp->index->names + name_id;
     }
   }
@@ -2065,16 +2071,17 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
   if (inp != NULL && inp->index != NULL) {
     if (id < inp->index->size) {
 
-      size_t name_id = inp->index->h_vals[7*id + 4];
+      size_t name_id = inp->index->h_vals[8*id + 4];
 
       h.sec_name = inp->index->names + name_id;
 
-      h.n_vals          = inp->index->h_vals[7*id];
-      h.location_id     = inp->index->h_vals[7*id + 1];
-      h.index_id        = inp->index->h_vals[7*id + 2];
-      h.n_location_vals = inp->index->h_vals[7*id + 3];
-      h.type_read       = (cs_datatype_t)(inp->index->h_vals[7*id + 6]);
+      h.n_vals          = inp->index->h_vals[8*id];
+      h.location_id     = inp->index->h_vals[8*id + 1];
+      h.index_id        = inp->index->h_vals[8*id + 2];
+      h.n_location_vals = inp->index->h_vals[8*id + 3];
+      h.type_read       = (cs_datatype_t)(inp->index->h_vals[8*id + 6]);
       h.elt_type        = _type_read_to_elt_type(h.type_read);
+      h.codec           = inp->index->h_vals[8*id + 7];
     }
   }
 
@@ -2085,6 +2092,7 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
     h.n_location_vals = 0;
     h.type_read       = CS_DATATYPE_NULL;
     h.elt_type        = h.type_read;
+    h.codec           = 0;
   }
 
   return h;
@@ -2105,6 +2113,30 @@ cs_io_get_echo(const cs_io_t  *cs_io)
   return (size_t)(cs_io->echo);
 }
 
+/*----------------------------------------------------------------------------
+ * Set the compression codec id recorded in headers of sections written next.
+ *
+ * The codec id is an arbitrary (printable) character, whose meaning is
+ * defined by the calling code; only character sections are tagged.
+ * For tagged sections, the number of values and global numbers passed to
+ * write functions refer to bytes of the encoded data, while
+ * n_location_vals is only recorded in the header. Such sections are
+ * read in the same manner, based on the codec id in the section header.
+ *
+ * parameters:
+ *   outp  <-> output kernel IO structure
+ *   codec <-- codec id, or 0 for uncompressed sections
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_codec(cs_io_t  *outp,
+                int       codec)
+{
+  assert(outp != NULL);
+
+  outp->codec = codec;
+}
+
 /*----------------------------------------------------------------------------
  * Read a section header.
  *
@@ -2254,6 +2286,7 @@ cs_io_read_header(cs_io_t             *inp,
   header->location_id = inp->location_id;
   header->index_id = inp->index_id;
   header->n_location_vals = inp->n_loc_vals;
+  header->codec = 0;
 
   /* Initialize data type */
   /*----------------------*/
@@ -2283,8 +2316,10 @@ cs_io_read_header(cs_io_t             *inp,
     else if (strcmp(elt_type_name, _type_name_r8) == 0)
       header->type_read = CS_DOUBLE;
 
-    else if (strcmp(elt_type_name, _type_name_char) == 0)
+    else if (strncmp(elt_type_name, _type_name_char, 2) == 0) {
       header->type_read = CS_CHAR;
+      header->codec = elt_type_name[2];
+    }
 
     else
       bft_error(__FILE__, __LINE__, 0,
@@ -2344,14 +2379,15 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   if (id >= inp->index->size)
     return 1;
 
-  header->sec_name = inp->index->names + inp->index->h_vals[7*id + 4];
+  header->sec_name = inp->index->names + inp->index->h_vals[8*id + 4];
 
-  header->n_vals          = inp->index->h_vals[7*id];
-  header->location_id     = inp->index->h_vals[7*id + 1];
-  header->index_id        = inp->index->h_vals[7*id + 2];
-  header->n_location_vals = inp->index->h_vals[7*id + 3];
-  header->type_read       = (cs_datatype_t)(inp->index->h_vals[7*id + 6]);
+  header->n_vals          = inp->index->h_vals[8*id];
+  header->location_id     = inp->index->h_vals[8*id + 1];
+  header->index_id        = inp->index->h_vals[8*id + 2];
+  header->n_location_vals = inp->index->h_vals[8*id + 3];
+  header->type_read       = (cs_datatype_t)(inp->index->h_vals[8*id + 6]);
   header->elt_type        = _type_read_to_elt_type(header->type_read);
+  header->codec           = inp->index->h_vals[8*id + 7];
 
   inp->n_vals      = header->n_vals;
   inp->location_id = header->location_id;
@@ -2368,7 +2404,7 @@ cs_io_set_indexed_position(cs_io_t             *inp,
 
   /* Non-embedded values */
 
-  if (inp->index->h_vals[7*id + 5] == 0) {
+  if (inp->index->h_vals[8*id + 5] == 0) {
     cs_file_off_t offset = inp->index->offset[id];
     retval = cs_file_seek(inp->f, offset, CS_FILE_SEEK_SET);
   }
@@ -2376,7 +2412,7 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   /* Embedded values */
 
   else {
-    size_t data_id = inp->index->h_vals[7*id + 5] - 1;
+    size_t data_id = inp->index->h_vals[8*id + 5] - 1;
     unsigned char *_data = inp->index->data + data_id;
     inp->data = _data;
   }
@@ -2890,7 +2926,7 @@ cs_io_write_block(const char     *sec_name,
   size_t stride = 1;
   cs_io_log_t  *log = NULL;
 
-  if (n_location_vals > 1) {
+  if (n_location_vals > 1 && outp->codec == 0) {
     stride = n_location_vals;
     n_g_vals *= n_location_vals;
     n_vals *= n_location_vals;
@@ -2991,7 +3027,7 @@ cs_io_write_block_buffer(const char     *sec_name,
   size_t stride = 1;
   cs_io_log_t  *log = NULL;
 
-  if (n_location_vals > 1) {
+  if (n_location_vals > 1 && outp->codec == 0) {
     stride = n_location_vals;
     n_g_vals *= n_location_vals;
     n_vals *= n_location_vals;
@@ -3038,6 +3074,88 @@ cs_io_write_block_buffer(const char     *sec_name,
                elt_type, elts);
 }
 
+/*----------------------------------------------------------------------------
+ * Write a section header to file, reserving space for the section's body,
+ * which is to be written later by each associated process.
+ *
+ * Each process should provide a (possibly empty) block of the body,
+ * and we should have:
+ *   global_num_start at rank 0 = 1
+ *   global_num_start at rank i+1 = global_num_end at rank i.
+ * Otherwise, behavior (especially positioning for future reads) is undefined.
+ *
+ * The values in the input buffer are converted to the file's endianness
+ * if necessary, so that they may later be copied as-is to the file at the
+ * returned offset (using a lower-level mechanism than this API, for example
+ * from a background thread). The file position is moved past the
+ * section's body, so other sections may be written in the mean time.
+ *
+ * parameters:
+ *   section_name     <-- section name
+ *   n_g_elts         <-- number of global elements (locations)
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *   location_id      <-- id of associated location, or 0
+ *   index_id         <-- id of associated index, or 0
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *   elts             <-> pointer to element data
+ *   outp             <-> output kernel IO structure
+ *
+ * returns:
+ *   offset in file at which the local block's data must be written
+ *----------------------------------------------------------------------------*/
+
+cs_file_off_t
+cs_io_write_block_deferred(const char     *sec_name,
+                           cs_gnum_t       n_g_elts,
+                           cs_gnum_t       global_num_start,
+                           cs_gnum_t       global_num_end,
+                           size_t          location_id,
+                           size_t          index_id,
+                           size_t          n_location_vals,
+                           cs_datatype_t   elt_type,
+                           void           *elts,
+                           cs_io_t        *outp)
+{
+  size_t n_g_vals = n_g_elts;
+  size_t n_vals = global_num_end - global_num_start;
+  size_t stride = 1;
+  size_t elt_size = cs_datatype_size[elt_type];
+
+  if (n_location_vals > 1 && outp->codec == 0) {
+    stride = n_location_vals;
+    n_g_vals *= n_location_vals;
+    n_vals *= n_location_vals;
+  }
+
+  _write_header(sec_name,
+                n_g_vals,
+                location_id,
+                index_id,
+                n_location_vals,
+                elt_type,
+                NULL,
+                outp);
+
+  _write_padding(outp->body_align, outp);
+
+  cs_file_off_t body_offset = cs_file_tell(outp->f);
+  cs_file_off_t offset
+    = body_offset + (global_num_start-1)*stride*elt_size;
+
+  cs_file_seek(outp->f,
+               body_offset + (cs_file_off_t)(n_g_vals*elt_size),
+               CS_FILE_SEEK_SET);
+
+  if (   n_vals > 0
+      && cs_file_get_swap_endian(outp->f) == 1
+      && elt_size > 1)
+    _swap_endian(elts, elt_size, n_vals);
+
+  return offset;
+}
+
 /*----------------------------------------------------------------------------
  * Skip a message.
  *
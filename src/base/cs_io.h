@@ -79,6 +79,7 @@ typedef struct {
   size_t          n_location_vals;    /* Number of values per location */
   cs_datatype_t   elt_type;           /* Type if n_elts > 0 */
   cs_datatype_t   type_read;          /* Type in file */
+  int             codec;              /* Compression codec id, or 0 */
 
 } cs_io_sec_header_t;
 
@@ -259,6 +260,25 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
 size_t
 cs_io_get_echo(const cs_io_t  *pp_io);
 
+/*----------------------------------------------------------------------------
+ * Set the compression codec id recorded in headers of sections written next.
+ *
+ * The codec id is an arbitrary (printable) character, whose meaning is
+ * defined by the calling code; only character sections are tagged.
+ * For tagged sections, the number of values and global numbers passed to
+ * write functions refer to bytes of the encoded data, while
+ * n_location_vals is only recorded in the header. Such sections are
+ * read in the same manner, based on the codec id in the section header.
+ *
+ * parameters:
+ *   outp  <-> output kernel IO structure
+ *   codec <-- codec id, or 0 for uncompressed sections
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_codec(cs_io_t  *outp,
+                int       codec);
+
 /*----------------------------------------------------------------------------
  * Read a message header.
  *
@@ -563,6 +583,50 @@ cs_io_write_block_buffer(const char     *sec_name,
                          void           *elts,
                          cs_io_t        *outp);
 
+/*----------------------------------------------------------------------------
+ * Write a section header to file, reserving space for the section's body,
+ * which is to be written later by each associated process.
+ *
+ * Each process should provide a (possibly empty) block of the body,
+ * and we should have:
+ *   global_num_start at rank 0 = 1
+ *   global_num_start at rank i+1 = global_num_end at rank i.
+ * Otherwise, behavior (especially positioning for future reads) is undefined.
+ *
+ * The values in the input buffer are converted to the file's endianness
+ * if necessary, so that they may later be copied as-is to the file at the
+ * returned offset (using a lower-level mechanism than this API, for example
+ * from a background thread). The file position is moved past the
+ * section's body, so other sections may be written in the mean time.
+ *
+ * parameters:
+ *   section_name     <-- section name
+ *   n_g_elts         <-- number of global elements (locations)
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *   location_id      <-- id of associated location, or 0
+ *   index_id         <-- id of associated index, or 0
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *   elts             <-> pointer to element data
+ *   outp             <-> output kernel IO structure
+ *
+ * returns:
+ *   offset in file at which the local block's data must be written
+ *----------------------------------------------------------------------------*/
+
+cs_file_off_t
+cs_io_write_block_deferred(const char     *sec_name,
+                           cs_gnum_t       n_g_elts,
+                           cs_gnum_t       global_num_start,
+                           cs_gnum_t       global_num_end,
+                           size_t          location_id,
+                           size_t          index_id,
+                           size_t          n_location_vals,
+                           cs_datatype_t   elt_type,
+                           void           *elts,
+                           cs_io_t        *outp);
+
 /*----------------------------------------------------------------------------
  * Skip a message.
  *
@@ -157,6 +157,77 @@ static cs_time_plot_t  *_l2_residual_plot = NULL;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Compute global minima, maxima, and sums of value arrays.
+ *
+ * Minima are negated so that minima and maxima require a single
+ * MPI_MAX reduction, and all sums a single MPI_SUM reduction.
+ *
+ * parameters:
+ *   n     <-- number of values
+ *   n_sum <-- number of sum arrays (0, 1, or 2)
+ *   vmin  <-> minimum values
+ *   vmax  <-> maximum values
+ *   vsum  <-> sum values (ignored if n_sum < 1)
+ *   wsum  <-> weighted sum values (ignored if n_sum < 2)
+ *----------------------------------------------------------------------------*/
+
+static void
+_parall_min_max_sum(int     n,
+                    int     n_sum,
+                    double  vmin[],
+                    double  vmax[],
+                    double  vsum[],
+                    double  wsum[])
+{
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks < 2 || n < 1)
+    return;
+
+  double *buf;
+  BFT_MALLOC(buf, (2 + n_sum)*n, double);
+
+  double *b_sum = buf + 2*n;
+
+  for (int i = 0; i < n; i++) {
+    buf[i] = vmax[i];
+    buf[n + i] = -vmin[i];
+  }
+  if (n_sum > 0)
+    memcpy(b_sum, vsum, n*sizeof(double));
+  if (n_sum > 1)
+    memcpy(b_sum + n, wsum, n*sizeof(double));
+
+  MPI_Allreduce(MPI_IN_PLACE, buf, 2*n, MPI_DOUBLE, MPI_MAX,
+                cs_glob_mpi_comm);
+  if (n_sum > 0)
+    MPI_Allreduce(MPI_IN_PLACE, b_sum, n_sum*n, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+
+  for (int i = 0; i < n; i++) {
+    vmax[i] = buf[i];
+    vmin[i] = -buf[n + i];
+  }
+  if (n_sum > 0)
+    memcpy(vsum, b_sum, n*sizeof(double));
+  if (n_sum > 1)
+    memcpy(wsum, b_sum + n, n*sizeof(double));
+
+  BFT_FREE(buf);
+
+#else
+
+  CS_UNUSED(n);
+  CS_UNUSED(n_sum);
+  CS_UNUSED(vmin);
+  CS_UNUSED(vmax);
+  CS_UNUSED(vsum);
+  CS_UNUSED(wsum);
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Compare simple stats elements (qsort function).
  *
@@ -726,17 +797,12 @@ _log_fields(void)
     if (log_count < 1)
       continue;
 
-    /* Group MPI operations if required */
-
-    cs_parall_min(log_count, CS_DOUBLE, vmin);
-    cs_parall_max(log_count, CS_DOUBLE, vmax);
-    cs_parall_sum(log_count, CS_DOUBLE, vsum);
+    /* Group MPI operations if required
+       (have_weight only depends on the location, so is the same
+       on all ranks) */
 
-#   if defined(HAVE_MPI)
-    cs_parall_counter_max(&have_weight, 1);
-    if (have_weight)
-      cs_parall_sum(log_count, CS_DOUBLE, wsum);
-#   endif
+    _parall_min_max_sum(log_count, (have_weight) ? 2 : 1,
+                        vmin, vmax, vsum, wsum);
 
     /* Print headers */
 
@@ -886,10 +952,7 @@ _log_sstats(void)
 
   /* Group MPI operations if required */
 
-  cs_parall_min(_sstats_val_size, CS_DOUBLE, vmin);
-  cs_parall_max(_sstats_val_size, CS_DOUBLE, vmax);
-  cs_parall_sum(_sstats_val_size, CS_DOUBLE, vsum);
-  cs_parall_sum(_sstats_val_size, CS_DOUBLE, wsum);
+  _parall_min_max_sum(_sstats_val_size, 2, vmin, vmax, vsum, wsum);
 
   /* Loop on statistics */
 
@@ -1227,8 +1290,7 @@ _log_clips(void)
 
   /* Group MPI operations if required */
 
-  cs_parall_min(_clips_val_size, CS_DOUBLE, vmin);
-  cs_parall_max(_clips_val_size, CS_DOUBLE, vmax);
+  _parall_min_max_sum(_clips_val_size, 0, vmin, vmax, NULL, NULL);
   cs_parall_sum(_clips_val_size*2, CS_GNUM_TYPE, vcount);
 
   /* Fist loop on clippings for counting */
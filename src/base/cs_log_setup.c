@@ -224,6 +224,8 @@ cs_log_setup(void)
 
   cs_ctwr_log_setup();
 
+  cs_base_mem_tag_log(CS_LOG_SETUP);
+
   cs_log_printf_flush(CS_LOG_SETUP);
 }
 
@@ -324,52 +324,41 @@ cs_mass_source_terms(int                   iterns,
      * The distinction between st_exp and W1 (which both go finally to the
      * right-hand side) is used for the 2nd-order time scheme. */
 
-  if (iterns == 1) {
+  if (iterns == 1)
     cs_array_set_value_real(n_cells, dim, 0, gapinj);
 
-    if (dim == 1) {
-      for (cs_lnum_t i = 0; i < ncesmp; i++) {
-        cs_lnum_t c_id = icetsm[i] - 1;
-        if (gamma[i] > 0. && itpsmp[i] == 1) {
-          st_exp[c_id] -= volume[c_id]*gamma[i] * pvara[c_id];
-          gapinj[c_id] = volume[c_id]*gamma[i] * smcelp[i];
-        }
-      }
-    }
-    else {
-      cs_lnum_t _dim = dim;
-      for (cs_lnum_t i = 0; i < ncesmp; i++) {
-        cs_lnum_t c_id = icetsm[i] - 1;
-        if (gamma[i] > 0. && itpsmp[i] == 1) {
-          for (cs_lnum_t j = 0; j < _dim; j++) {
-            cs_lnum_t k = c_id*_dim + j;
-            st_exp[k] -= volume[c_id]*gamma[i] * pvara[k];
-            gapinj[k] = volume[c_id]*gamma[i] * smcelp[j*ncesmp + i];
-          }
-        }
-      }
-    }
-  }
-
-  /* On the diagonal */
+  /* Explicit and implicit (diagonal) parts are updated in a single pass
+     over the source term cells, using the volume-weighted mass flow
+     of each cell */
 
   if (dim == 1) {
     for (cs_lnum_t i = 0; i < ncesmp; i++) {
-      cs_lnum_t c_id = icetsm[i] - 1;
       if (gamma[i] > 0. && itpsmp[i] == 1) {
-        st_imp[c_id] += volume[c_id]*gamma[i];
+        cs_lnum_t c_id = icetsm[i] - 1;
+        const cs_real_t vg = volume[c_id]*gamma[i];
+        if (iterns == 1) {
+          st_exp[c_id] -= vg * pvara[c_id];
+          gapinj[c_id] = vg * smcelp[i];
+        }
+        st_imp[c_id] += vg;
       }
     }
   }
   else {
     cs_lnum_t _dim = dim, _dim2 = dim*dim;
     for (cs_lnum_t i = 0; i < ncesmp; i++) {
-      cs_lnum_t c_id = icetsm[i] - 1;
       if (gamma[i] > 0. && itpsmp[i] == 1) {
-        for (cs_lnum_t j = 0; j < _dim; j++) {
-          cs_lnum_t k = c_id*_dim2 + j*_dim + j;
-          st_imp[k] += volume[c_id]*gamma[i];
+        cs_lnum_t c_id = icetsm[i] - 1;
+        const cs_real_t vg = volume[c_id]*gamma[i];
+        if (iterns == 1) {
+          for (cs_lnum_t j = 0; j < _dim; j++) {
+            cs_lnum_t k = c_id*_dim + j;
+            st_exp[k] -= vg * pvara[k];
+            gapinj[k] = vg * smcelp[j*ncesmp + i];
+          }
         }
+        for (cs_lnum_t j = 0; j < _dim; j++)
+          st_imp[c_id*_dim2 + j*_dim + j] += vg;
       }
     }
   }
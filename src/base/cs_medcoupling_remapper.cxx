@@ -82,6 +82,9 @@
 
 #include <MEDCouplingRemapper.hxx>
 
+#include <map>
+#include <vector>
+
 #include <MEDLoader.hxx>
 
 using namespace MEDCoupling;
@@ -124,6 +127,16 @@ struct _cs_medcoupling_remapper_t {
   void                     *remapper;
 #endif
 
+  /* Cached interpolation operator, kept as long as the source mesh is
+     not moved: CSR matrix whose rows are target mesh elements and columns
+     are source field elements, with row-normalized coefficients */
+
+  bool                      matrix_is_set;  /* remapper prepared */
+  cs_lnum_t                 n_matrix_rows;
+  cs_lnum_t                *matrix_index;
+  cs_lnum_t                *matrix_col_id;
+  cs_real_t                *matrix_coeff;
+
 };
 
 /*============================================================================
@@ -293,9 +306,168 @@ _create_remapper(const char                        *name,
   r->bbox_source_mesh
     = dynamic_cast<MEDCouplingUMesh *>(r->source_fields[0]->getMesh());
 
+  r->matrix_is_set = false;
+  r->n_matrix_rows = 0;
+  r->matrix_index = NULL;
+  r->matrix_col_id = NULL;
+  r->matrix_coeff = NULL;
+
   return r;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Free the cached interpolation operator of a remapper
+ *
+ * \param[in, out] r  pointer to the cs_medcoupling_remapper_t struct
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_matrix_cache(cs_medcoupling_remapper_t  *r)
+{
+  r->n_matrix_rows = 0;
+  BFT_FREE(r->matrix_index);
+  BFT_FREE(r->matrix_col_id);
+  BFT_FREE(r->matrix_coeff);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Extract the interpolation matrix computed by the MEDCoupling
+ *          remapper to a local CSR operator.
+ *
+ * Coefficients are normalized by the row sums, which is what MEDCoupling
+ * does for IntensiveMaximum fields, so that applying the operator to the
+ * source values gives the same result as transferField.
+ *
+ * When the remapper was prepared on a sub-part of the source mesh,
+ * column ids are renumbered to the full source mesh using the subcells
+ * list, so that the sub-field does not need to be rebuilt at each call.
+ * This is only possible for cell-based source fields.
+ *
+ * \param[in, out] r         pointer to the cs_medcoupling_remapper_t struct
+ * \param[in]      subcells  list of source sub-part cells, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_build_matrix_cache(cs_medcoupling_remapper_t  *r,
+                    const DataArrayIdType      *subcells)
+{
+  _free_matrix_cache(r);
+
+  if (   subcells != NULL
+      && r->source_fields[0]->getTypeOfField() != MEDCoupling::ON_CELLS)
+    return;
+
+  const std::vector<std::map<mcIdType, double> > &m
+    = r->remapper->getCrudeMatrix();
+
+  const cs_lnum_t n_rows = m.size();
+  const mcIdType *sub_ids
+    = (subcells != NULL) ? subcells->getConstPointer() : NULL;
+
+  BFT_MALLOC(r->matrix_index, n_rows + 1, cs_lnum_t);
+
+  r->matrix_index[0] = 0;
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    r->matrix_index[i+1] = r->matrix_index[i] + m[i].size();
+
+  BFT_MALLOC(r->matrix_col_id, r->matrix_index[n_rows], cs_lnum_t);
+  BFT_MALLOC(r->matrix_coeff, r->matrix_index[n_rows], cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+
+    double row_sum = 0.;
+    for (std::map<mcIdType, double>::const_iterator it = m[i].begin();
+         it != m[i].end();
+         ++it)
+      row_sum += it->second;
+
+    double inv_sum = (row_sum > 0. || row_sum < 0.) ? 1./row_sum : 1.;
+
+    cs_lnum_t k = r->matrix_index[i];
+    for (std::map<mcIdType, double>::const_iterator it = m[i].begin();
+         it != m[i].end();
+         ++it, k++) {
+      r->matrix_col_id[k] = (sub_ids != NULL) ? sub_ids[it->first] : it->first;
+      r->matrix_coeff[k] = it->second * inv_sum;
+    }
+
+  }
+
+  r->n_matrix_rows = n_rows;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Interpolate values for a given field using the cached operator
+ *
+ * \param[in] r            pointer to the cs_medcoupling_remapper_t struct
+ * \param[in] field_id     id of the field to interpolate (in list given before)
+ * \param[in] default_val  value to apply for elements not intersected by
+ *                         source mesh
+ * \param[in] n_vals_elts  number of elements of the returned array
+ * \param[in] row_elt_id   element id for each operator row, or NULL
+ *
+ * \return  pointer to cs_real_t array containing new values
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_copy_values_cached(cs_medcoupling_remapper_t  *r,
+                    int                         field_id,
+                    double                      default_val,
+                    cs_lnum_t                   n_vals_elts,
+                    const cs_lnum_t            *row_elt_id)
+{
+  cs_real_t *new_vals = NULL;
+
+  const DataArrayDouble *src_arr = r->source_fields[field_id]->getArray();
+
+  const cs_lnum_t dim = src_arr->getNumberOfComponents();
+  const double *src_vals = src_arr->getConstPointer();
+
+  const cs_lnum_t n_rows = r->n_matrix_rows;
+  const cs_lnum_t *m_idx = r->matrix_index;
+  const cs_lnum_t *m_col = r->matrix_col_id;
+  const cs_real_t *m_coeff = r->matrix_coeff;
+
+  BFT_MALLOC(new_vals, n_vals_elts*dim, cs_real_t);
+
+  if (row_elt_id != NULL || n_rows < n_vals_elts) {
+#   pragma omp parallel for if (n_vals_elts*dim > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_vals_elts*dim; i++)
+      new_vals[i] = default_val;
+  }
+
+# pragma omp parallel for if (n_rows > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+
+    cs_lnum_t e_id = (row_elt_id != NULL) ? row_elt_id[i] : i;
+    cs_real_t *v = new_vals + e_id*dim;
+
+    if (m_idx[i+1] == m_idx[i]) {
+      for (cs_lnum_t j = 0; j < dim; j++)
+        v[j] = default_val;
+      continue;
+    }
+
+    for (cs_lnum_t j = 0; j < dim; j++)
+      v[j] = 0.;
+
+    for (cs_lnum_t k = m_idx[i]; k < m_idx[i+1]; k++) {
+      const double *s = src_vals + m_col[k]*dim;
+      for (cs_lnum_t j = 0; j < dim; j++)
+        v[j] += m_coeff[k] * s[j];
+    }
+
+  }
+
+  return new_vals;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Add a new remapper to the list
@@ -499,6 +671,8 @@ _setup_no_bbox(cs_medcoupling_remapper_t *r)
     r->remapper->prepare(source_field->getMesh(),
                          r->target_mesh->med_mesh,
                          r->interp_method);
+
+    _build_matrix_cache(r, NULL);
   }
 }
 
@@ -534,6 +708,8 @@ _setup_with_bbox(cs_medcoupling_remapper_t  *r)
                          r->target_mesh->med_mesh,
                          r->interp_method);
 
+    _build_matrix_cache(r, subcells);
+
   }
 }
 
@@ -554,6 +730,8 @@ _cs_medcoupling_remapper_destroy(cs_medcoupling_remapper_t *r)
   BFT_FREE(r->bbox_source_mesh);
   BFT_FREE(r->remapper);
 
+  _free_matrix_cache(r);
+
   for (int i = 0; i < r->n_fields; i++) {
     BFT_FREE(r->field_names[i]);
     BFT_FREE(r->source_fields[i]);
@@ -745,6 +923,9 @@ cs_medcoupling_remapper_set_options(cs_medcoupling_remapper_t  *r,
   if (key == NULL || value == NULL)
     return;
 
+  r->matrix_is_set = false;
+  _free_matrix_cache(r);
+
   if (strcmp(key, "Precision") == 0) {
     double epsilon = atof(value);
     if (epsilon > 0)
@@ -790,6 +971,11 @@ cs_medcoupling_remapper_set_options(cs_medcoupling_remapper_t  *r,
 /*!
  * \brief update the interpolation matrix of the remapper
  *
+ * The interpolation matrix is computed only once, and kept as a local
+ * sparse operator as long as the source mesh is not translated or rotated
+ * (or remapper options changed), so calling this function at each time
+ * step for a fixed coupling is cheap.
+ *
  * \param[in] r            pointer to the cs_medcoupling_remapper_t struct
  */
 /*----------------------------------------------------------------------------*/
@@ -803,6 +989,9 @@ cs_medcoupling_remapper_setup(cs_medcoupling_remapper_t  *r)
             _("Error: This function cannot be called without "
               "MEDCoupling support.\n"));
 #else
+  if (r->matrix_is_set)
+    return;
+
   cs_lnum_t n_elts = r->target_mesh->n_elts;
 
   r->remapper->setPrecision(1.e-12);
@@ -820,6 +1009,8 @@ cs_medcoupling_remapper_setup(cs_medcoupling_remapper_t  *r)
     }
 
   }
+
+  r->matrix_is_set = true;
 #endif
 }
 
@@ -851,9 +1042,21 @@ cs_medcoupling_remapper_copy_values(cs_medcoupling_remapper_t  *r,
               "MEDCoupling support.\n"));
 #else
   if (r->target_mesh->elt_dim == 2) {
-    new_vals = _copy_values_no_bbox(r, field_id, default_val);
+    if (r->matrix_index != NULL && r->target_mesh->n_elts > 0)
+      new_vals = _copy_values_cached(r, field_id, default_val,
+                                     r->target_mesh->n_elts, NULL);
+    else
+      new_vals = _copy_values_no_bbox(r, field_id, default_val);
   } else if (r->target_mesh->elt_dim == 3) {
-    new_vals = _copy_values_with_bbox(r, field_id, default_val);
+    if (r->matrix_index != NULL && r->target_mesh->n_elts > 0) {
+      const cs_lnum_t *row_elt_id = NULL;
+      if (r->target_mesh->elt_list != NULL)
+        row_elt_id = r->target_mesh->new_to_old;
+      new_vals = _copy_values_cached(r, field_id, default_val,
+                                     cs_glob_mesh->n_cells, row_elt_id);
+    }
+    else
+      new_vals = _copy_values_with_bbox(r, field_id, default_val);
   }
 #endif
 
@@ -881,6 +1084,9 @@ cs_medcoupling_remapper_translate(cs_medcoupling_remapper_t  *r,
   for (int i = 0; i < r->n_fields; i++) {
     r->source_fields[i]->getMesh()->translate(translation);
   }
+
+  r->matrix_is_set = false;
+  _free_matrix_cache(r);
 #endif
 }
 
@@ -909,6 +1115,9 @@ cs_medcoupling_remapper_rotate(cs_medcoupling_remapper_t  *r,
   for (int i = 0; i < r->n_fields; i++) {
     r->source_fields[i]->getMesh()->rotate(invariant, axis, angle);
   }
+
+  r->matrix_is_set = false;
+  _free_matrix_cache(r);
 #endif
 }
 
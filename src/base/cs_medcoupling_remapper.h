@@ -140,6 +140,11 @@ cs_medcoupling_remapper_set_options(cs_medcoupling_remapper_t  *r,
 /*!
  * \brief update the interpolation matrix of the remapper
  *
+ * The interpolation matrix is computed only once, and kept as a local
+ * sparse operator as long as the source mesh is not translated or rotated
+ * (or remapper options changed), so calling this function at each time
+ * step for a fixed coupling is cheap.
+ *
  * \param[in] r            pointer to the cs_medcoupling_remapper_t struct
  */
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,357 @@
+/*============================================================================
+ * Read-only buffers shared by the ranks of a same compute node.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stddef.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_node_shared.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_node_shared.c
+        Read-only buffers shared by the ranks of a same compute node.
+
+  Large read-only data (property tables, observation data, ...) is
+  otherwise duplicated on each rank. Using MPI-3 shared memory windows,
+  a single copy is stored per compute node, filled by the first rank of
+  that node only.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+#define _CS_NODE_SHARED_MPI 1
+#endif
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Allocated buffer descriptor */
+
+typedef struct {
+
+  void     *ptr;     /* pointer to buffer */
+
+#if defined(_CS_NODE_SHARED_MPI)
+  MPI_Win   win;     /* associated window, or MPI_WIN_NULL if local */
+#endif
+
+} _shared_block_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static int               _n_blocks = 0;
+static int               _n_blocks_max = 0;
+static _shared_block_t  *_blocks = NULL;
+
+#if defined(_CS_NODE_SHARED_MPI)
+
+static MPI_Comm  _node_comm = MPI_COMM_NULL;
+static int       _node_rank = 0;
+static int       _node_size = 1;
+
+#endif
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+#if defined(_CS_NODE_SHARED_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build node communicator if not done yet.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_ensure_node_comm(void)
+{
+  if (_node_comm != MPI_COMM_NULL || cs_glob_n_ranks < 2)
+    return;
+
+  MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED, 0,
+                      MPI_INFO_NULL, &_node_comm);
+  MPI_Comm_rank(_node_comm, &_node_rank);
+  MPI_Comm_size(_node_comm, &_node_size);
+}
+
+#endif /* defined(_CS_NODE_SHARED_MPI) */
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Find a block descriptor based on its buffer.
+ *
+ * \param[in]  ptr  pointer to buffer
+ *
+ * \return  id of matching block, or -1 if not found
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_find_block(const void  *ptr)
+{
+  for (int i = 0; i < _n_blocks; i++) {
+    if (_blocks[i].ptr == ptr)
+      return i;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a block given its id.
+ *
+ * \param[in]  b_id  block id
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_block(int  b_id)
+{
+  _shared_block_t *b = _blocks + b_id;
+
+#if defined(_CS_NODE_SHARED_MPI)
+  if (b->win != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(b->win);
+    MPI_Win_free(&(b->win));
+  }
+  else
+    BFT_FREE(b->ptr);
+#else
+  BFT_FREE(b->ptr);
+#endif
+
+  _blocks[b_id] = _blocks[_n_blocks - 1];
+  _n_blocks -= 1;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate a buffer shared by all ranks of a compute node.
+ *
+ * This function is collective on the main communicator. Only the ranks
+ * for which is_writer is set to true may write to the buffer, after which
+ * \ref cs_node_shared_sync must be called before the buffer is read.
+ *
+ * When MPI-3 shared memory is not available, or a node holds a single rank,
+ * a rank-local buffer is returned, and is_writer is always true.
+ *
+ * \param[in]   n_bytes    buffer size, in bytes
+ * \param[out]  is_writer  true if this rank should fill the buffer
+ *
+ * \return  pointer to allocated buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_node_shared_malloc(size_t   n_bytes,
+                      bool    *is_writer)
+{
+  if (_n_blocks >= _n_blocks_max) {
+    _n_blocks_max = CS_MAX(4, _n_blocks_max*2);
+    BFT_REALLOC(_blocks, _n_blocks_max, _shared_block_t);
+  }
+
+  _shared_block_t *b = _blocks + _n_blocks;
+  b->ptr = NULL;
+
+  *is_writer = true;
+
+#if defined(_CS_NODE_SHARED_MPI)
+
+  b->win = MPI_WIN_NULL;
+
+  _ensure_node_comm();
+
+  if (_node_size > 1) {
+
+    MPI_Aint l_size = (_node_rank == 0) ? (MPI_Aint)CS_MAX(n_bytes, 1) : 0;
+    void *l_ptr = NULL;
+
+    MPI_Win_allocate_shared(l_size, 1, MPI_INFO_NULL, _node_comm,
+                            &l_ptr, &(b->win));
+
+    MPI_Aint s_size;
+    int disp_unit;
+    MPI_Win_shared_query(b->win, 0, &s_size, &disp_unit, &(b->ptr));
+
+    /* Passive target epoch kept open for the buffer's lifetime,
+       so that MPI_Win_sync may be used in cs_node_shared_sync */
+
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, b->win);
+
+    *is_writer = (_node_rank == 0);
+
+  }
+
+#endif /* defined(_CS_NODE_SHARED_MPI) */
+
+  if (*is_writer && b->ptr == NULL) { /* local fallback */
+    unsigned char *_ptr = NULL;
+    BFT_MALLOC(_ptr, CS_MAX(n_bytes, 1), unsigned char);
+    b->ptr = _ptr;
+  }
+
+  _n_blocks += 1;
+
+  return b->ptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Make the values written to a node-shared buffer visible to all
+ *        ranks of the node.
+ *
+ * This function is collective on the main communicator.
+ *
+ * \param[in]  ptr  pointer to buffer allocated by \ref cs_node_shared_malloc
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_node_shared_sync(const void  *ptr)
+{
+#if defined(_CS_NODE_SHARED_MPI)
+
+  int b_id = _find_block(ptr);
+
+  if (b_id < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s: buffer %p is not a node-shared buffer.",
+              __func__, ptr);
+
+  MPI_Win win = _blocks[b_id].win;
+
+  if (win != MPI_WIN_NULL) {
+    MPI_Win_sync(win);
+    MPI_Barrier(_node_comm);
+    MPI_Win_sync(win);
+  }
+
+#else
+
+  CS_UNUSED(ptr);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a buffer allocated by \ref cs_node_shared_malloc.
+ *
+ * This function is collective on the main communicator.
+ *
+ * \param[in]  ptr  pointer to buffer, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_node_shared_free(void  *ptr)
+{
+  if (ptr == NULL)
+    return;
+
+  int b_id = _find_block(ptr);
+
+  if (b_id < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s: buffer %p is not a node-shared buffer.",
+              __func__, ptr);
+
+  _free_block(b_id);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free all remaining node-shared buffers and the associated
+ *        node communicator.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_node_shared_finalize(void)
+{
+  while (_n_blocks > 0)
+    _free_block(_n_blocks - 1);
+
+  BFT_FREE(_blocks);
+  _n_blocks_max = 0;
+
+#if defined(_CS_NODE_SHARED_MPI)
+  if (_node_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&_node_comm);
+    _node_rank = 0;
+    _node_size = 1;
+  }
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
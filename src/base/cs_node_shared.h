@@ -0,0 +1,115 @@
+#ifndef __CS_NODE_SHARED_H__
+#define __CS_NODE_SHARED_H__
+
+/*============================================================================
+ * Read-only buffers shared by the ranks of a same compute node.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate a buffer shared by all ranks of a compute node.
+ *
+ * This function is collective on the main communicator. Only the ranks
+ * for which is_writer is set to true may write to the buffer, after which
+ * \ref cs_node_shared_sync must be called before the buffer is read.
+ *
+ * When MPI-3 shared memory is not available, or a node holds a single rank,
+ * a rank-local buffer is returned, and is_writer is always true.
+ *
+ * \param[in]   n_bytes    buffer size, in bytes
+ * \param[out]  is_writer  true if this rank should fill the buffer
+ *
+ * \return  pointer to allocated buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_node_shared_malloc(size_t   n_bytes,
+                      bool    *is_writer);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Make the values written to a node-shared buffer visible to all
+ *        ranks of the node.
+ *
+ * This function is collective on the main communicator.
+ *
+ * \param[in]  ptr  pointer to buffer allocated by \ref cs_node_shared_malloc
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_node_shared_sync(const void  *ptr);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a buffer allocated by \ref cs_node_shared_malloc.
+ *
+ * This function is collective on the main communicator.
+ *
+ * \param[in]  ptr  pointer to buffer, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_node_shared_free(void  *ptr);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free all remaining node-shared buffers and the associated
+ *        node communicator.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_node_shared_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_NODE_SHARED_H__ */
@@ -222,6 +222,15 @@ _log_vector_info_l(cs_log_t               log,
   cs_log_printf(log,
                 _("  vector size:                             %3d\n"),
                 numbering->vector_size);
+
+  if (numbering->n_groups > 1) {
+    cs_lnum_t n_block_elts = numbering->group_index[1];
+    cs_lnum_t n_elts = numbering->group_index[3];
+    cs_log_printf(log,
+                  _("  number of elements in vector blocks: %9ld\n"
+                    "  number of scalar remainder elements: %9ld\n"),
+                  (long)n_block_elts, (long)(n_elts - n_block_elts));
+  }
 }
 
 #if defined(HAVE_MPI)
@@ -278,6 +287,19 @@ _log_vector_info(cs_log_t               log,
     cs_log_printf(log,
                   _("  vector size:                             %3d\n"),
                   vs);
+
+  cs_gnum_t n_elts_l[2] = {numbering->group_index[1], 0}, n_elts[2];
+  if (numbering->n_groups > 1)
+    n_elts_l[1] = numbering->group_index[3] - numbering->group_index[1];
+
+  MPI_Allreduce(n_elts_l, n_elts, 2, CS_MPI_GNUM, MPI_SUM, comm);
+
+  if (n_elts[1] > 0)
+    cs_log_printf(log,
+                  _("  number of elements in vector blocks: %9llu\n"
+                    "  number of scalar remainder elements: %9llu\n"),
+                  (unsigned long long)n_elts[0],
+                  (unsigned long long)n_elts[1]);
 }
 
 #endif /* have_MPI */
@@ -577,6 +599,46 @@ cs_numbering_create_vectorized(cs_lnum_t  n_elts,
   return numbering;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a numbering information structure in case of vectorization
+ *        by blocks, with a possible scalar remainder.
+ *
+ * Elements in [0, n_block_elts[ are organized in blocks of vector_size
+ * elements, which may be processed without conflicts; remaining elements
+ * should be processed in scalar mode.
+ *
+ * \param[in]  n_elts        number of associated elements
+ * \param[in]  n_block_elts  number of elements in vector blocks
+ *                           (multiple of vector_size)
+ * \param[in]  vector_size   vector size used for this vectorization
+ *
+ * \return  pointer to created cs_numbering_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_numbering_t *
+cs_numbering_create_vectorized_blocks(cs_lnum_t  n_elts,
+                                      cs_lnum_t  n_block_elts,
+                                      int        vector_size)
+{
+  assert(n_block_elts % vector_size == 0 && n_block_elts <= n_elts);
+
+  cs_numbering_t  *numbering
+    = cs_numbering_create_vectorized(n_elts, vector_size);
+
+  if (n_block_elts < n_elts) {
+    numbering->n_groups = 2;
+    BFT_REALLOC(numbering->group_index, 4, cs_lnum_t);
+    numbering->group_index[0] = 0;
+    numbering->group_index[1] = n_block_elts;
+    numbering->group_index[2] = n_block_elts;
+    numbering->group_index[3] = n_elts;
+  }
+
+  return numbering;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create a default numbering information structure
@@ -644,6 +706,92 @@ cs_numbering_destroy(cs_numbering_t  **numbering)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize an array so that its memory is first touched by the
+ *        threads which will operate on it.
+ *
+ * For threaded numberings, elements are touched by the same loop structure
+ * as that used on the associated thread groups; other elements (such as
+ * ghost elements, or all elements for other numberings) are touched with
+ * the default static schedule of elementwise OpenMP loops.
+ *
+ * On NUMA systems, this places pages on the memory associated with the
+ * socket of the thread which will later operate on them.
+ *
+ * \param[in]   numbering  pointer to numbering structure, or NULL
+ * \param[in]   n_elts     number of elements in array
+ * \param[in]   elt_size   size of each element (in bytes)
+ * \param[in]   src        values to copy, or NULL to initialize to 0
+ * \param[out]  dest       array to initialize
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_numbering_first_touch(const cs_numbering_t  *numbering,
+                         cs_lnum_t              n_elts,
+                         size_t                 elt_size,
+                         const void            *src,
+                         void                  *dest)
+{
+  const unsigned char *_src = src;
+  unsigned char *_dest = dest;
+
+  cs_lnum_t n_num_elts = 0;
+
+  if (numbering != NULL) {
+
+    if (numbering->type == CS_NUMBERING_THREADS) {
+
+      const int n_threads = numbering->n_threads;
+      const int n_groups = numbering->n_groups;
+      const cs_lnum_t *group_index = numbering->group_index;
+
+      for (int g_id = 0; g_id < n_groups; g_id++) {
+
+#       pragma omp parallel for
+        for (int t_id = 0; t_id < n_threads; t_id++) {
+          cs_lnum_t s_id = group_index[(t_id*n_groups + g_id)*2];
+          cs_lnum_t e_id = group_index[(t_id*n_groups + g_id)*2 + 1];
+          if (e_id > n_elts)
+            e_id = n_elts;
+          if (e_id > s_id) {
+            size_t n_bytes = (size_t)(e_id - s_id) * elt_size;
+            if (_src != NULL)
+              memcpy(_dest + s_id*elt_size, _src + s_id*elt_size, n_bytes);
+            else
+              memset(_dest + s_id*elt_size, 0, n_bytes);
+          }
+        }
+
+        for (int t_id = 0; t_id < n_threads; t_id++) {
+          cs_lnum_t e_id = group_index[(t_id*n_groups + g_id)*2 + 1];
+          if (e_id > n_num_elts)
+            n_num_elts = CS_MIN(e_id, n_elts);
+        }
+
+      }
+
+    }
+
+  }
+
+  /* Remaining elements */
+
+  const cs_lnum_t n_rem_elts = n_elts - n_num_elts;
+
+  if (_src != NULL) {
+#   pragma omp parallel for if (n_rem_elts > CS_THR_MIN)
+    for (cs_lnum_t i = n_num_elts; i < n_elts; i++)
+      memcpy(_dest + i*elt_size, _src + i*elt_size, elt_size);
+  }
+  else {
+#   pragma omp parallel for if (n_rem_elts > CS_THR_MIN)
+    for (cs_lnum_t i = n_num_elts; i < n_elts; i++)
+      memset(_dest + i*elt_size, 0, elt_size);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log information relative to a cs_numbering_t structure.
@@ -58,6 +58,10 @@ BEGIN_C_DECLS
 
 #  define CS_NUMBERING_SIMD_SIZE 64
 
+#elif defined(__ARM_FEATURE_SVE)         /* For Arm with SVE (such as A64FX) */
+
+#  define CS_NUMBERING_SIMD_SIZE 64
+
 #else
 
 #  define CS_NUMBERING_SIMD_SIZE 4       /* Most current platforms */
@@ -100,7 +104,11 @@ typedef struct {
                                      group and thread are respectively:
                                      group_index[t*n_groups*2 + g] and
                                      group_index[t*n_groups*2 + g + 1].
-                                     (size: n_groups * n_threads * 2) */
+                                     (size: n_groups * n_threads * 2)
+                                     For vectorized numberings, group 0
+                                     contains complete, conflict-free blocks
+                                     of vector_size elements, and group 1
+                                     (if present) the scalar remainder. */
 
 } cs_numbering_t;
 
@@ -149,6 +157,29 @@ cs_numbering_t *
 cs_numbering_create_vectorized(cs_lnum_t  n_elts,
                                int        vector_size);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a numbering information structure in case of vectorization
+ *        by blocks, with a possible scalar remainder.
+ *
+ * Elements in [0, n_block_elts[ are organized in blocks of vector_size
+ * elements, which may be processed without conflicts; remaining elements
+ * should be processed in scalar mode.
+ *
+ * \param[in]  n_elts        number of associated elements
+ * \param[in]  n_block_elts  number of elements in vector blocks
+ *                           (multiple of vector_size)
+ * \param[in]  vector_size   vector size used for this vectorization
+ *
+ * \return  pointer to created cs_numbering_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_numbering_t *
+cs_numbering_create_vectorized_blocks(cs_lnum_t  n_elts,
+                                      cs_lnum_t  n_block_elts,
+                                      int        vector_size);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create a default numbering information structure
@@ -183,6 +214,34 @@ cs_numbering_create_threaded(int        n_threads,
 void
 cs_numbering_destroy(cs_numbering_t  **numbering);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize an array so that its memory is first touched by the
+ *        threads which will operate on it.
+ *
+ * For threaded numberings, elements are touched by the same loop structure
+ * as that used on the associated thread groups; other elements (such as
+ * ghost elements, or all elements for other numberings) are touched with
+ * the default static schedule of elementwise OpenMP loops.
+ *
+ * On NUMA systems, this places pages on the memory associated with the
+ * socket of the thread which will later operate on them.
+ *
+ * \param[in]   numbering  pointer to numbering structure, or NULL
+ * \param[in]   n_elts     number of elements in array
+ * \param[in]   elt_size   size of each element (in bytes)
+ * \param[in]   src        values to copy, or NULL to initialize to 0
+ * \param[out]  dest       array to initialize
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_numbering_first_touch(const cs_numbering_t  *numbering,
+                         cs_lnum_t              n_elts,
+                         size_t                 elt_size,
+                         const void            *src,
+                         void                  *dest);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log information relative to a cs_numbering_t structure.
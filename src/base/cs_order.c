@@ -41,6 +41,8 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_all_to_all.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -53,6 +55,21 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Radix sort digit size; arrays smaller than _RADIX_MIN_SIZE are
+   ordered using heap sort */
+
+#define _RADIX_BITS 8
+#define _RADIX_SIZE (1 << _RADIX_BITS)
+#define _RADIX_MIN_SIZE 512
+
+/* Maximum number of samples per rank for parallel sample sort */
+
+#define _SAMPLE_MAX 128
+
 /*============================================================================
  * Local structure definitions
  *============================================================================*/
@@ -61,6 +78,200 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Sort an array of non-negative keys using an LSD radix sort, applying
+ * the same permutation to an optional associated array.
+ *
+ * Each pass is parallelized using OpenMP: threads count digits in
+ * their own contiguous chunk, and scatter values in chunk order, so the
+ * sort is stable. Passes in which all keys share the same digit are
+ * skipped, and only digits up to the highest bit of the largest key
+ * are processed.
+ *
+ * parameters:
+ *   n_elts  <-- number of elements
+ *   key     <-> keys to sort
+ *   b       <-> associated array, or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_radix_sort(size_t      n_elts,
+            cs_gnum_t   key[],
+            cs_lnum_t   b[])
+{
+  if (n_elts < 2)
+    return;
+
+  cs_gnum_t k_max = 0;
+  for (size_t i = 0; i < n_elts; i++) {
+    if (key[i] > k_max)
+      k_max = key[i];
+  }
+
+  int n_passes = 0;
+  while (   n_passes*_RADIX_BITS < (int)(sizeof(cs_gnum_t)*8)
+         && (k_max >> (n_passes*_RADIX_BITS)) > 0)
+    n_passes++;
+
+  int n_t_max = 1;
+#if defined(HAVE_OPENMP)
+  n_t_max = omp_get_max_threads();
+#endif
+
+  size_t *count;
+  BFT_MALLOC(count, (size_t)n_t_max*_RADIX_SIZE, size_t);
+
+  cs_gnum_t *k_tmp, *k_src = key, *k_dest;
+  cs_lnum_t *b_tmp = NULL, *b_src = b, *b_dest = NULL;
+  BFT_MALLOC(k_tmp, n_elts, cs_gnum_t);
+  k_dest = k_tmp;
+  if (b != NULL) {
+    BFT_MALLOC(b_tmp, n_elts, cs_lnum_t);
+    b_dest = b_tmp;
+  }
+
+  for (int pass = 0; pass < n_passes; pass++) {
+
+    const int shift = pass*_RADIX_BITS;
+    bool skip = false;
+
+#   pragma omp parallel if (n_elts > CS_THR_MIN)
+    {
+      int t_id = 0, n_t = 1;
+#if defined(HAVE_OPENMP)
+      t_id = omp_get_thread_num();
+      n_t = omp_get_num_threads();
+#endif
+      size_t s_id = n_elts * t_id / n_t;
+      size_t e_id = n_elts * (t_id + 1) / n_t;
+
+      size_t *t_count = count + (size_t)t_id*_RADIX_SIZE;
+      for (int d = 0; d < _RADIX_SIZE; d++)
+        t_count[d] = 0;
+
+      for (size_t i = s_id; i < e_id; i++)
+        t_count[(k_src[i] >> shift) & (_RADIX_SIZE - 1)] += 1;
+
+#     pragma omp barrier
+
+      /* Convert counts to start positions, by digit then thread */
+
+#     pragma omp single
+      {
+        size_t pos = 0;
+        for (int d = 0; d < _RADIX_SIZE; d++) {
+          size_t n_d = 0;
+          for (int t = 0; t < n_t; t++) {
+            size_t c = count[(size_t)t*_RADIX_SIZE + d];
+            count[(size_t)t*_RADIX_SIZE + d] = pos;
+            pos += c;
+            n_d += c;
+          }
+          if (n_d == n_elts)
+            skip = true;
+        }
+      }
+
+      if (skip == false) {
+        for (size_t i = s_id; i < e_id; i++) {
+          size_t j = t_count[(k_src[i] >> shift) & (_RADIX_SIZE - 1)]++;
+          k_dest[j] = k_src[i];
+          if (b_src != NULL)
+            b_dest[j] = b_src[i];
+        }
+      }
+    }
+
+    if (skip == false) {
+      cs_gnum_t *k_swap = k_src;
+      k_src = k_dest;
+      k_dest = k_swap;
+      cs_lnum_t *b_swap = b_src;
+      b_src = b_dest;
+      b_dest = b_swap;
+    }
+
+  }
+
+  if (k_src != key) {
+    memcpy(key, k_src, n_elts*sizeof(cs_gnum_t));
+    if (b != NULL)
+      memcpy(b, b_src, n_elts*sizeof(cs_lnum_t));
+  }
+
+  BFT_FREE(b_tmp);
+  BFT_FREE(k_tmp);
+  BFT_FREE(count);
+}
+
+/*----------------------------------------------------------------------------
+ * Order an array of global numbers using a radix sort.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers
+ *   order    <-- pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_gnum_radix(const cs_gnum_t   number[],
+                  cs_lnum_t         order[],
+                  const size_t      nb_ent)
+{
+  cs_gnum_t *key;
+  BFT_MALLOC(key, nb_ent, cs_gnum_t);
+
+  cs_gnum_t k_min = number[0];
+  for (size_t i = 1; i < nb_ent; i++) {
+    if (number[i] < k_min)
+      k_min = number[i];
+  }
+
+# pragma omp parallel for if (nb_ent > CS_THR_MIN)
+  for (size_t i = 0; i < nb_ent; i++) {
+    key[i] = number[i] - k_min;
+    order[i] = i;
+  }
+
+  _radix_sort(nb_ent, key, order);
+
+  BFT_FREE(key);
+}
+
+/*----------------------------------------------------------------------------
+ * Order an array of local numbers using a radix sort.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers
+ *   order    <-- pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_lnum_radix(const cs_lnum_t   number[],
+                  cs_lnum_t         order[],
+                  const size_t      nb_ent)
+{
+  cs_gnum_t *key;
+  BFT_MALLOC(key, nb_ent, cs_gnum_t);
+
+  cs_lnum_t k_min = number[0];
+  for (size_t i = 1; i < nb_ent; i++) {
+    if (number[i] < k_min)
+      k_min = number[i];
+  }
+
+# pragma omp parallel for if (nb_ent > CS_THR_MIN)
+  for (size_t i = 0; i < nb_ent; i++) {
+    key[i] = (cs_gnum_t)(number[i] - k_min);
+    order[i] = i;
+  }
+
+  _radix_sort(nb_ent, key, order);
+
+  BFT_FREE(key);
+}
+
 /*----------------------------------------------------------------------------
  * Descend binary tree for the ordering of a cs_gnum_t (integer) array.
  *
@@ -127,6 +338,13 @@ _order_gnum(const cs_gnum_t   number[],
   size_t i;
   cs_lnum_t o_save;
 
+  /* Use radix sort for large arrays */
+
+  if (nb_ent >= _RADIX_MIN_SIZE) {
+    _order_gnum_radix(number, order, nb_ent);
+    return;
+  }
+
   /* Initialize ordering array */
 
   for (i = 0 ; i < nb_ent ; i++)
@@ -538,6 +756,13 @@ _order_lnum(const cs_lnum_t   number[],
   size_t i;
   cs_lnum_t o_save;
 
+  /* Use radix sort for large arrays */
+
+  if (nb_ent >= _RADIX_MIN_SIZE) {
+    _order_lnum_radix(number, order, nb_ent);
+    return;
+  }
+
   /* Initialize ordering array */
 
   for (i = 0 ; i < nb_ent ; i++)
@@ -1482,6 +1707,308 @@ cs_order_single_gnum(size_t            n_ent,
   *single = _single;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sort an array of global numbers using a parallel radix sort,
+ *        applying the same permutation to an optional associated array.
+ *
+ * The sort is stable, and threaded using OpenMP.
+ *
+ * \param[in]       n_elts  number of elements
+ * \param[in, out]  a       array to sort
+ * \param[in, out]  b       associated array, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_order_radix_sort_gnum(size_t      n_elts,
+                         cs_gnum_t   a[],
+                         cs_lnum_t   b[])
+{
+  if (n_elts < 2)
+    return;
+
+  cs_gnum_t a_min = a[0];
+  for (size_t i = 1; i < n_elts; i++) {
+    if (a[i] < a_min)
+      a_min = a[i];
+  }
+
+  if (a_min > 0) {
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (size_t i = 0; i < n_elts; i++)
+      a[i] -= a_min;
+  }
+
+  _radix_sort(n_elts, a, b);
+
+  if (a_min > 0) {
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (size_t i = 0; i < n_elts; i++)
+      a[i] += a_min;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sort an array of local numbers using a parallel radix sort,
+ *        applying the same permutation to an optional associated array.
+ *
+ * The sort is stable, and threaded using OpenMP.
+ *
+ * \param[in]       n_elts  number of elements
+ * \param[in, out]  a       array to sort
+ * \param[in, out]  b       associated array, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_order_radix_sort_lnum(size_t      n_elts,
+                         cs_lnum_t   a[],
+                         cs_lnum_t   b[])
+{
+  if (n_elts < 2)
+    return;
+
+  cs_lnum_t a_min = a[0];
+  for (size_t i = 1; i < n_elts; i++) {
+    if (a[i] < a_min)
+      a_min = a[i];
+  }
+
+  cs_gnum_t *key;
+  BFT_MALLOC(key, n_elts, cs_gnum_t);
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (size_t i = 0; i < n_elts; i++)
+    key[i] = (cs_gnum_t)(a[i] - a_min);
+
+  _radix_sort(n_elts, key, b);
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (size_t i = 0; i < n_elts; i++)
+    a[i] = (cs_lnum_t)key[i] + a_min;
+
+  BFT_FREE(key);
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a global ordering of distributed global numbers using a
+ *        parallel sample sort.
+ *
+ * Each rank sorts its values locally, and provides regularly spaced
+ * samples, weighted by its local number of values; splitters are chosen
+ * from the sorted samples so that each rank receives a similar number of
+ * values, independently of their distribution, and identical values are
+ * always sent to the same rank. Values are then exchanged using an
+ * all-to-all distributor, and ordered on the destination rank.
+ *
+ * On output, the rank of each value is 1 + the number of distinct values
+ * lower than this value over all ranks.
+ *
+ * \param[in]   n_elts  local number of elements
+ * \param[in]   number  local global numbers
+ * \param[out]  g_rank  global rank of each value (size: n_elts)
+ * \param[in]   comm    associated MPI communicator
+ *
+ * \return  global number of distinct values
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_gnum_t
+cs_order_gnum_sample_sort(cs_lnum_t         n_elts,
+                          const cs_gnum_t   number[],
+                          cs_gnum_t         g_rank[],
+                          MPI_Comm          comm)
+{
+  int n_ranks = 1;
+  MPI_Comm_size(comm, &n_ranks);
+
+  /* Local sort */
+
+  cs_gnum_t *l_sorted;
+  BFT_MALLOC(l_sorted, n_elts, cs_gnum_t);
+  memcpy(l_sorted, number, n_elts*sizeof(cs_gnum_t));
+
+  cs_order_radix_sort_gnum(n_elts, l_sorted, NULL);
+
+  /* Select weighted samples */
+
+  int n_samples = CS_MIN(n_ranks - 1, _SAMPLE_MAX);
+  if (n_samples > n_elts)
+    n_samples = n_elts;
+
+  double *l_samples;
+  BFT_MALLOC(l_samples, n_samples*2, double);
+
+  for (int i = 0; i < n_samples; i++) {
+    cs_lnum_t j = ((cs_gnum_t)n_elts * (i+1)) / (n_samples+1);
+    l_samples[i*2] = l_sorted[j];    /* exact up to 2^53 */
+    l_samples[i*2+1] = (double)n_elts / n_samples;
+  }
+
+  /* Gather samples; with fewer than 2^53 values, the double
+     representation of global numbers is exact */
+
+  int *recv_count, *recv_displ;
+  BFT_MALLOC(recv_count, n_ranks, int);
+  BFT_MALLOC(recv_displ, n_ranks, int);
+
+  int send_count = n_samples*2;
+  MPI_Allgather(&send_count, 1, MPI_INT, recv_count, 1, MPI_INT, comm);
+
+  int n_g_samples = 0;
+  for (int i = 0; i < n_ranks; i++) {
+    recv_displ[i] = n_g_samples;
+    n_g_samples += recv_count[i];
+  }
+
+  double *g_samples;
+  BFT_MALLOC(g_samples, n_g_samples, double);
+
+  MPI_Allgatherv(l_samples, send_count, MPI_DOUBLE,
+                 g_samples, recv_count, recv_displ, MPI_DOUBLE, comm);
+
+  BFT_FREE(recv_displ);
+  BFT_FREE(recv_count);
+  BFT_FREE(l_samples);
+
+  n_g_samples /= 2;
+
+  /* Order samples (identical on all ranks) */
+
+  cs_gnum_t *s_val;
+  cs_lnum_t *s_order;
+  BFT_MALLOC(s_val, n_g_samples, cs_gnum_t);
+  BFT_MALLOC(s_order, n_g_samples, cs_lnum_t);
+
+  double w_tot = 0;
+  for (int i = 0; i < n_g_samples; i++) {
+    s_val[i] = g_samples[i*2];
+    w_tot += g_samples[i*2+1];
+  }
+
+  cs_order_gnum_allocated(NULL, s_val, s_order, n_g_samples);
+
+  /* Choose splitters: rank r receives values in
+     ]splitter[r-1], splitter[r]] */
+
+  cs_gnum_t *splitter;
+  BFT_MALLOC(splitter, n_ranks, cs_gnum_t);
+
+  {
+    double w_sum = 0;
+    int s_id = 0;
+    for (int r = 0; r < n_ranks - 1; r++) {
+      double w_target = w_tot * (r+1) / n_ranks;
+      while (s_id < n_g_samples - 1 && w_sum < w_target) {
+        w_sum += g_samples[s_order[s_id]*2 + 1];
+        s_id++;
+      }
+      splitter[r] = (n_g_samples > 0) ? s_val[s_order[s_id]] : 0;
+      if (r > 0 && splitter[r] < splitter[r-1])
+        splitter[r] = splitter[r-1];
+    }
+    splitter[n_ranks - 1] = ~((cs_gnum_t)0);
+  }
+
+  BFT_FREE(s_order);
+  BFT_FREE(s_val);
+  BFT_FREE(g_samples);
+  BFT_FREE(l_sorted);
+
+  /* Determine destination ranks (first splitter >= value) */
+
+  int *dest_rank;
+  BFT_MALLOC(dest_rank, n_elts, int);
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    int l = 0, h = n_ranks - 1;
+    while (l < h) {
+      int m = (l + h) / 2;
+      if (splitter[m] < number[i])
+        l = m + 1;
+      else
+        h = m;
+    }
+    dest_rank[i] = l;
+  }
+
+  BFT_FREE(splitter);
+
+  cs_all_to_all_t *d = cs_all_to_all_create(n_elts,
+                                            0, /* flags */
+                                            NULL,
+                                            dest_rank,
+                                            comm);
+
+  cs_gnum_t *b_num = cs_all_to_all_copy_array(d,
+                                              CS_GNUM_TYPE,
+                                              1,
+                                              false, /* reverse */
+                                              number,
+                                              NULL);
+
+  cs_lnum_t b_size = cs_all_to_all_n_elts_dest(d);
+
+  /* Order received values and number distinct values */
+
+  cs_lnum_t *b_order;
+  BFT_MALLOC(b_order, b_size, cs_lnum_t);
+
+  cs_order_gnum_allocated(NULL, b_num, b_order, b_size);
+
+  cs_gnum_t n_distinct = 0;
+  {
+    cs_gnum_t num_prev = 0;
+    for (cs_lnum_t i = 0; i < b_size; i++) {
+      cs_lnum_t j = b_order[i];
+      if (i == 0 || b_num[j] > num_prev) {
+        n_distinct += 1;
+        num_prev = b_num[j];
+      }
+      b_num[j] = n_distinct;
+    }
+  }
+
+  BFT_FREE(b_order);
+
+  cs_gnum_t shift = 0, n_g_distinct = 0;
+  MPI_Exscan(&n_distinct, &shift, 1, CS_MPI_GNUM, MPI_SUM, comm);
+  MPI_Allreduce(&n_distinct, &n_g_distinct, 1, CS_MPI_GNUM, MPI_SUM, comm);
+
+  int rank_id = 0;
+  MPI_Comm_rank(comm, &rank_id);
+  if (rank_id == 0)
+    shift = 0;
+
+  for (cs_lnum_t i = 0; i < b_size; i++)
+    b_num[i] += shift;
+
+  /* Return ranks to source */
+
+  cs_all_to_all_copy_array(d,
+                           CS_GNUM_TYPE,
+                           1,
+                           true, /* reverse */
+                           b_num,
+                           g_rank);
+
+  BFT_FREE(b_num);
+
+  cs_all_to_all_destroy(&d);
+
+  BFT_FREE(dest_rank);
+
+  return n_g_distinct;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
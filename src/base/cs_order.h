@@ -338,6 +338,76 @@ cs_order_single_gnum(size_t            n_ent,
                      size_t           *n_single,
                      cs_gnum_t        *single[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sort an array of global numbers using a parallel radix sort,
+ *        applying the same permutation to an optional associated array.
+ *
+ * The sort is stable, and threaded using OpenMP.
+ *
+ * \param[in]       n_elts  number of elements
+ * \param[in, out]  a       array to sort
+ * \param[in, out]  b       associated array, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_order_radix_sort_gnum(size_t      n_elts,
+                         cs_gnum_t   a[],
+                         cs_lnum_t   b[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sort an array of local numbers using a parallel radix sort,
+ *        applying the same permutation to an optional associated array.
+ *
+ * The sort is stable, and threaded using OpenMP.
+ *
+ * \param[in]       n_elts  number of elements
+ * \param[in, out]  a       array to sort
+ * \param[in, out]  b       associated array, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_order_radix_sort_lnum(size_t      n_elts,
+                         cs_lnum_t   a[],
+                         cs_lnum_t   b[]);
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a global ordering of distributed global numbers using a
+ *        parallel sample sort.
+ *
+ * Each rank sorts its values locally, and provides regularly spaced
+ * samples, weighted by its local number of values; splitters are chosen
+ * from the sorted samples so that each rank receives a similar number of
+ * values, independently of their distribution, and identical values are
+ * always sent to the same rank. Values are then exchanged using an
+ * all-to-all distributor, and ordered on the destination rank.
+ *
+ * On output, the rank of each value is 1 + the number of distinct values
+ * lower than this value over all ranks.
+ *
+ * \param[in]   n_elts  local number of elements
+ * \param[in]   number  local global numbers
+ * \param[out]  g_rank  global rank of each value (size: n_elts)
+ * \param[in]   comm    associated MPI communicator
+ *
+ * \return  global number of distinct values
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_gnum_t
+cs_order_gnum_sample_sort(cs_lnum_t         n_elts,
+                          const cs_gnum_t   number[],
+                          cs_gnum_t         g_rank[],
+                          MPI_Comm          comm);
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -141,6 +141,26 @@ typedef struct
   int     rank;
 } _mpi_double_int_t;
 
+/* Deferred sum structure */
+
+struct _cs_parall_deferred_sum_t {
+
+  int           n_vals;        /* number of registered values */
+  int           n_vals_max;    /* allocated number of values */
+
+  bool          pending;       /* is a reduction in progress ? */
+
+  double       *s_loc;         /* local partial sums */
+  double       *s_glob;        /* global sums */
+  double      **dest;          /* destination of each global sum */
+
+#if defined(HAVE_MPI)
+  MPI_Comm      comm;          /* associated communicator */
+  MPI_Request   request;       /* request for non-blocking reduction */
+#endif
+
+};
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -308,9 +328,14 @@ _cs_parall_allreduce(int             n,
 
   memcpy(locval, val, data_size);
 
+  cs_timer_t t0 = cs_timer_time();
+
   MPI_Allreduce(locval, val, n, cs_datatype_to_mpi[datatype], operation,
                 cs_glob_mpi_comm);
 
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_mpi_wait_event("allreduce", &t0, &t1);
+
   if (locval != _locval)
     BFT_FREE(locval);
 }
@@ -689,8 +714,12 @@ cs_parall_sum(int             n,
               cs_datatype_t   datatype,
               void           *val)
 {
-  if (cs_glob_n_ranks > 1)
-    _cs_parall_allreduce(n, datatype, MPI_SUM, val);
+  if (cs_glob_n_ranks > 1) {
+    if (datatype == CS_DOUBLE && cs_repro_sum_is_active())
+      cs_repro_sum_parall(n, (double *)val);
+    else
+      _cs_parall_allreduce(n, datatype, MPI_SUM, val);
+  }
 }
 
 #endif
@@ -1237,6 +1266,232 @@ cs_parall_set_min_coll_buf_size(size_t buffer_size)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a deferred sum structure.
+ *
+ * Local partial sums are registered with \ref cs_parall_deferred_sum_add,
+ * and summed over all ranks with a single reduction by
+ * \ref cs_parall_deferred_sum_flush (or \ref cs_parall_deferred_sum_start
+ * and \ref cs_parall_deferred_sum_finish, so as to overlap the reduction
+ * with other computations).
+ *
+ * The default communicator is used, unless another communicator is
+ * defined with \ref cs_parall_deferred_sum_set_comm.
+ *
+ * \return  pointer to created deferred sum structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_parall_deferred_sum_t *
+cs_parall_deferred_sum_create(void)
+{
+  cs_parall_deferred_sum_t *ds;
+
+  BFT_MALLOC(ds, 1, cs_parall_deferred_sum_t);
+
+  ds->n_vals = 0;
+  ds->n_vals_max = 0;
+  ds->pending = false;
+
+  ds->s_loc = NULL;
+  ds->s_glob = NULL;
+  ds->dest = NULL;
+
+#if defined(HAVE_MPI)
+  ds->comm = (cs_glob_n_ranks > 1) ? cs_glob_mpi_comm : MPI_COMM_NULL;
+  ds->request = MPI_REQUEST_NULL;
+#endif
+
+  return ds;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a deferred sum structure.
+ *
+ * \param[in, out]  ds  pointer to deferred sum structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum_destroy(cs_parall_deferred_sum_t  **ds)
+{
+  if (ds == NULL || *ds == NULL)
+    return;
+
+  cs_parall_deferred_sum_t *_ds = *ds;
+
+  if (_ds->pending)
+    cs_parall_deferred_sum_finish(_ds);
+
+  BFT_FREE(_ds->s_loc);
+  BFT_FREE(_ds->s_glob);
+  BFT_FREE(_ds->dest);
+
+  BFT_FREE(*ds);
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the communicator used by a deferred sum structure.
+ *
+ * \param[in, out]  ds    pointer to deferred sum structure
+ * \param[in]       comm  associated communicator, or MPI_COMM_NULL
+ *                        for local sums
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum_set_comm(cs_parall_deferred_sum_t  *ds,
+                                MPI_Comm                   comm)
+{
+  assert(ds->pending == false);
+
+  ds->comm = comm;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Register local partial sums in a deferred sum structure.
+ *
+ * The global sums are written to dest when the matching reduction is
+ * finished, so dest must remain valid until then. The local values are
+ * copied, so dest may be the same array as s_loc.
+ *
+ * \param[in, out]  ds     pointer to deferred sum structure
+ * \param[in]       n      number of values
+ * \param[in]       s_loc  local partial sums
+ * \param[out]      dest   global sums (set when the reduction is finished)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum_add(cs_parall_deferred_sum_t  *ds,
+                           int                        n,
+                           const double               s_loc[],
+                           double                     dest[])
+{
+  if (ds->pending)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: values may not be added while a reduction is pending."),
+              __func__);
+
+  if (ds->n_vals + n > ds->n_vals_max) {
+    ds->n_vals_max = CS_MAX(ds->n_vals + n, 2*ds->n_vals_max);
+    BFT_REALLOC(ds->s_loc, ds->n_vals_max, double);
+    BFT_REALLOC(ds->s_glob, ds->n_vals_max, double);
+    BFT_REALLOC(ds->dest, ds->n_vals_max, double *);
+  }
+
+  for (int i = 0; i < n; i++) {
+    ds->s_loc[ds->n_vals + i] = s_loc[i];
+    ds->dest[ds->n_vals + i] = dest + i;
+  }
+
+  ds->n_vals += n;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start the reduction of all values registered in a deferred
+ *        sum structure.
+ *
+ * A non-blocking reduction is used when available. No values may be
+ * registered until \ref cs_parall_deferred_sum_finish is called.
+ *
+ * \param[in, out]  ds  pointer to deferred sum structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum_start(cs_parall_deferred_sum_t  *ds)
+{
+  assert(ds->pending == false);
+
+  ds->pending = true;
+
+#if defined(HAVE_MPI)
+
+  if (ds->comm != MPI_COMM_NULL && ds->n_vals > 0) {
+#if (MPI_VERSION >= 3)
+    MPI_Iallreduce(ds->s_loc, ds->s_glob, ds->n_vals, MPI_DOUBLE, MPI_SUM,
+                   ds->comm, &(ds->request));
+#else
+    MPI_Allreduce(ds->s_loc, ds->s_glob, ds->n_vals, MPI_DOUBLE, MPI_SUM,
+                  ds->comm);
+#endif
+    return;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  for (int i = 0; i < ds->n_vals; i++)
+    ds->s_glob[i] = ds->s_loc[i];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Finish the reduction started by \ref cs_parall_deferred_sum_start.
+ *
+ * Global sums are written to their destinations, and the structure
+ * is emptied so as to be reused.
+ *
+ * \param[in, out]  ds  pointer to deferred sum structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum_finish(cs_parall_deferred_sum_t  *ds)
+{
+  assert(ds->pending == true);
+
+#if defined(HAVE_MPI)
+  if (ds->request != MPI_REQUEST_NULL)
+    MPI_Wait(&(ds->request), MPI_STATUS_IGNORE);
+#endif
+
+  for (int i = 0; i < ds->n_vals; i++)
+    *(ds->dest[i]) = ds->s_glob[i];
+
+  ds->n_vals = 0;
+  ds->pending = false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sum all values registered in a deferred sum structure over all
+ *        ranks with a single reduction, and write global sums to their
+ *        destinations.
+ *
+ * \param[in, out]  ds  pointer to deferred sum structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum_flush(cs_parall_deferred_sum_t  *ds)
+{
+#if defined(HAVE_MPI)
+
+  if (ds->comm != MPI_COMM_NULL && ds->n_vals > 0) {
+    assert(ds->pending == false);
+    MPI_Allreduce(ds->s_loc, ds->s_glob, ds->n_vals, MPI_DOUBLE, MPI_SUM,
+                  ds->comm);
+    ds->pending = true;
+    cs_parall_deferred_sum_finish(ds);
+    return;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  cs_parall_deferred_sum_start(ds);
+  cs_parall_deferred_sum_finish(ds);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
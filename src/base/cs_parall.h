@@ -32,11 +32,21 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_defs.h"
+#include "cs_repro_sum.h"
+#include "cs_timer.h"
 
 /*----------------------------------------------------------------------------*/
 
 BEGIN_C_DECLS
 
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Opaque structure for deferred (grouped) sums */
+
+typedef struct _cs_parall_deferred_sum_t  cs_parall_deferred_sum_t;
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -56,8 +66,11 @@ cs_parall_counter(cs_gnum_t   cpt[],
                   const int   n)
 {
   if (cs_glob_n_ranks > 1) {
+    cs_timer_t t0 = cs_timer_time();
     MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_GNUM, MPI_SUM,
                   cs_glob_mpi_comm);
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_mpi_wait_event("allreduce", &t0, &t1);
   }
 }
 
@@ -88,8 +101,11 @@ cs_parall_counter_max(cs_lnum_t   cpt[],
                       const int   n)
 {
   if (cs_glob_n_ranks > 1) {
+    cs_timer_t t0 = cs_timer_time();
     MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_LNUM, MPI_MAX,
                   cs_glob_mpi_comm);
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_mpi_wait_event("allreduce", &t0, &t1);
   }
 }
 
@@ -108,6 +124,10 @@ cs_parall_counter_max(cs_lnum_t   cpt[],
 /*----------------------------------------------------------------------------
  * Sum values of a given datatype on all default communicator processes.
  *
+ * When reproducible sums are active (see \ref cs_repro_sum_set_active),
+ * double precision values are summed exactly, so the result does not
+ * depend on the reduction order.
+ *
  * parameters:
  *   n        <-- number of values
  *   datatype <-- matching Code_Saturne datatype
@@ -122,8 +142,15 @@ cs_parall_sum(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
+    if (datatype == CS_DOUBLE && cs_repro_sum_is_active()) {
+      cs_repro_sum_parall(n, (double *)val);
+      return;
+    }
+    cs_timer_t t0 = cs_timer_time();
     MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_SUM,
                   cs_glob_mpi_comm);
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_mpi_wait_event("allreduce", &t0, &t1);
   }
 }
 
@@ -157,8 +184,11 @@ cs_parall_max(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
+    cs_timer_t t0 = cs_timer_time();
     MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_MAX,
                   cs_glob_mpi_comm);
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_mpi_wait_event("allreduce", &t0, &t1);
   }
 }
 
@@ -192,8 +222,11 @@ cs_parall_min(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
+    cs_timer_t t0 = cs_timer_time();
     MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_MIN,
                   cs_glob_mpi_comm);
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_mpi_wait_event("allreduce", &t0, &t1);
   }
 }
 
@@ -449,6 +482,108 @@ cs_parall_get_min_coll_buf_size(void);
 void
 cs_parall_set_min_coll_buf_size(size_t buffer_size);
 
+/*----------------------------------------------------------------------------
+ * Create a deferred sum structure.
+ *
+ * Local partial sums are registered with cs_parall_deferred_sum_add(),
+ * and summed over all ranks with a single reduction by
+ * cs_parall_deferred_sum_flush() (or cs_parall_deferred_sum_start() and
+ * cs_parall_deferred_sum_finish(), so as to overlap the reduction with
+ * other computations).
+ *
+ * The default communicator is used, unless another communicator is
+ * defined with cs_parall_deferred_sum_set_comm().
+ *
+ * returns:
+ *   pointer to created deferred sum structure
+ *----------------------------------------------------------------------------*/
+
+cs_parall_deferred_sum_t *
+cs_parall_deferred_sum_create(void);
+
+/*----------------------------------------------------------------------------
+ * Destroy a deferred sum structure.
+ *
+ * parameters:
+ *   ds <-> pointer to deferred sum structure pointer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum_destroy(cs_parall_deferred_sum_t  **ds);
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Define the communicator used by a deferred sum structure.
+ *
+ * parameters:
+ *   ds   <-> pointer to deferred sum structure
+ *   comm <-- associated communicator, or MPI_COMM_NULL for local sums
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum_set_comm(cs_parall_deferred_sum_t  *ds,
+                                MPI_Comm                   comm);
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Register local partial sums in a deferred sum structure.
+ *
+ * The global sums are written to dest when the matching reduction is
+ * finished, so dest must remain valid until then. The local values are
+ * copied, so dest may be the same array as s_loc.
+ *
+ * parameters:
+ *   ds    <-> pointer to deferred sum structure
+ *   n     <-- number of values
+ *   s_loc <-- local partial sums
+ *   dest  --> global sums (set when the reduction is finished)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum_add(cs_parall_deferred_sum_t  *ds,
+                           int                        n,
+                           const double               s_loc[],
+                           double                     dest[]);
+
+/*----------------------------------------------------------------------------
+ * Start the reduction of all values registered in a deferred sum structure.
+ *
+ * A non-blocking reduction is used when available. No values may be
+ * registered until cs_parall_deferred_sum_finish() is called.
+ *
+ * parameters:
+ *   ds <-> pointer to deferred sum structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum_start(cs_parall_deferred_sum_t  *ds);
+
+/*----------------------------------------------------------------------------
+ * Finish the reduction started by cs_parall_deferred_sum_start().
+ *
+ * Global sums are written to their destinations, and the structure
+ * is emptied so as to be reused.
+ *
+ * parameters:
+ *   ds <-> pointer to deferred sum structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum_finish(cs_parall_deferred_sum_t  *ds);
+
+/*----------------------------------------------------------------------------
+ * Sum all values registered in a deferred sum structure over all ranks
+ * with a single reduction, and write global sums to their destinations.
+ *
+ * parameters:
+ *   ds <-> pointer to deferred sum structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum_flush(cs_parall_deferred_sum_t  *ds);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
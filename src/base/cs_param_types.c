@@ -559,6 +559,9 @@ cs_param_get_precond_name(cs_param_precond_type_t  precond)
   case CS_PARAM_PRECOND_SSOR:
     return  "SSOR";
     break;
+  case CS_PARAM_PRECOND_AMS:
+    return  "Auxiliary.Space.Maxwell";
+    break;
 
   default:
     bft_error(__FILE__, __LINE__, 0,
@@ -695,6 +695,11 @@ typedef enum {
  * \var CS_PARAM_PRECOND_SSOR
  * Symmetric Successive OverRelaxations (can be seen as a symmetric
  * Gauss-Seidel preconditioner)
+ *
+ * \var CS_PARAM_PRECOND_AMS
+ * Auxiliary-space Maxwell solver (HYPRE AMS through PETSc), for curl-curl
+ * systems arising from CDO edge-based schemes. It relies on the discrete
+ * gradient (edge -> vertices) and on the vertex coordinates.
  */
 
 typedef enum {
@@ -713,6 +718,7 @@ typedef enum {
   CS_PARAM_PRECOND_POLY1,
   CS_PARAM_PRECOND_POLY2,
   CS_PARAM_PRECOND_SSOR,
+  CS_PARAM_PRECOND_AMS,         /*!< Only with PETSc and HYPRE */
 
   CS_PARAM_N_PRECOND_TYPES
 
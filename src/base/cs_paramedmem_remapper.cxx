@@ -126,6 +126,9 @@ struct _cs_paramedmem_remapper_t {
   cs_real_t               _sphere_cen[3] = {0., 0., 0.};
   cs_real_t               _sphere_rad    = 1.e20;
 
+  /* Sphere center before transformations */
+  cs_real_t               _sphere_cen_ref[3] = {0., 0., 0.};
+
 #if defined(HAVE_PARAMEDMEM) && defined(HAVE_MEDCOUPLING_LOADER)
   OverlapDEC             *odec;           /* Overlap data exchange channel */
 #else
@@ -133,6 +136,12 @@ struct _cs_paramedmem_remapper_t {
 #endif
 
   int                     synced;
+
+  /* Transformations used for the last synchronization (8 values each:
+     type, vector, center, angle); the DEC, with its interpolation matrix
+     and communication scheme, is kept while they do not change */
+  int                     n_sync_transformations;
+  cs_real_t              *sync_transformations;
 };
 
 struct _mesh_transformation_t {
@@ -224,6 +233,12 @@ _cs_paramedmem_apply_transformations(MEDCouplingFieldDouble   *field,
                                      cs_paramedmem_remapper_t *r)
 {
   if (_transformations_applied == false) {
+
+    /* Transformations apply to the mesh as read from the file, so the
+       bounding sphere is also transformed from its initial position */
+    for (int id = 0; id < 3; id++)
+      r->_sphere_cen[id] = r->_sphere_cen_ref[id];
+
     for (int i = 0; i < _n_transformations; i++) {
       _mesh_transformation_t *mt = _transformations[i];
       if (mt->type == 0) {
@@ -272,6 +287,65 @@ _cs_paramedmem_apply_transformations(MEDCouplingFieldDouble   *field,
   _transformations_applied = true;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check if the requested mesh transformations differ from those
+ *          used for the last synchronization of a remapper.
+ *
+ * \param[in]  r  pointer to cs_paramedmem_remapper_t struct
+ *
+ * \return  true if transformations changed, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_cs_paramedmem_transformations_changed(const cs_paramedmem_remapper_t  *r)
+{
+  if (_n_transformations != r->n_sync_transformations)
+    return true;
+
+  for (int i = 0; i < _n_transformations; i++) {
+    const _mesh_transformation_t *mt = _transformations[i];
+    const cs_real_t *st = r->sync_transformations + 8*i;
+    if (   st[0] != mt->type
+        || st[1] != mt->vector[0] || st[2] != mt->vector[1]
+        || st[3] != mt->vector[2]
+        || st[4] != mt->center[0] || st[5] != mt->center[1]
+        || st[6] != mt->center[2]
+        || st[7] != mt->angle)
+      return true;
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Save the current mesh transformations as those used for the
+ *          synchronization of a remapper.
+ *
+ * \param[in, out]  r  pointer to cs_paramedmem_remapper_t struct
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_paramedmem_save_transformations(cs_paramedmem_remapper_t  *r)
+{
+  r->n_sync_transformations = _n_transformations;
+  BFT_REALLOC(r->sync_transformations, 8*_n_transformations, cs_real_t);
+
+  for (int i = 0; i < _n_transformations; i++) {
+    const _mesh_transformation_t *mt = _transformations[i];
+    cs_real_t *st = r->sync_transformations + 8*i;
+    st[0] = mt->type;
+    for (int id = 0; id < 3; id++) {
+      st[1+id] = mt->vector[id];
+      st[4+id] = mt->center[id];
+    }
+    st[7] = mt->angle;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Returns an array containing the ranks of Code_Saturne processes in
@@ -328,6 +402,8 @@ _cs_paramedmem_overlap_create(const char  *name)
   r->ntsteps    = -1;
 
   r->synced = 0;
+  r->n_sync_transformations = 0;
+  r->sync_transformations = NULL;
 
   /* Local id's */
   int *cs_ranks = _cs_paramedmem_get_mpi_comm_world_ranks();
@@ -474,6 +550,7 @@ _cs_paramedmem_remapper_destroy(cs_paramedmem_remapper_t *r)
   BFT_FREE(r->order);
   BFT_FREE(r->time_steps);
   BFT_FREE(r->odec);
+  BFT_FREE(r->sync_transformations);
 
   cs_medcoupling_mesh_destroy(r->local_mesh);
 
@@ -540,8 +617,10 @@ cs_paramedmem_remapper_create(char       *name,
   _cs_paramedmem_load_paramesh(r, file_name, mesh_name);
 
   r->_sphere_rad = radius;
-  for (int i = 0; i < 3; i++)
+  for (int i = 0; i < 3; i++) {
     r->_sphere_cen[i] = center[i];
+    r->_sphere_cen_ref[i] = center[i];
+  }
 
   _remapper[_n_remappers] = r;
   _n_remappers++;
@@ -661,10 +740,13 @@ cs_paramedmem_remap_field_one_time(cs_paramedmem_remapper_t *r,
   r->odec->attachTargetLocalField(trg_field);
 
   r->odec->setDefaultValue(default_val);
-  // Sync the DEC if needed
-  if (r->synced != 1) {
+  // Sync the DEC if needed: intersections are only recomputed when the
+  // source mesh transformations change, so for a fixed coupling each call
+  // reduces to a local matrix-vector product and one exchange.
+  if (r->synced != 1 || _cs_paramedmem_transformations_changed(r)) {
     r->odec->synchronize();
     r->synced = 1;
+    _cs_paramedmem_save_transformations(r);
   }
 
   r->odec->sendData();
@@ -794,7 +876,6 @@ cs_paramedmem_remap_field(cs_paramedmem_remapper_t *r,
 
   }
 
-  r->synced = 0;
   _cs_paramedmem_reset_transformations();
 
 #endif
@@ -405,7 +405,9 @@ static cs_equation_param_t _equation_param_default
 
    .sles_param = NULL,
 
-   .omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_CRITICAL
+   .omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_CRITICAL,
+   .cellwise_cache_size = 0.,
+   .matrix_free = false
   };
 
 /* Space discretisation options structure and associated pointer */
@@ -1003,6 +1005,10 @@ cs_parameters_define_field_keys(void)
 
   cs_field_define_key_int("gradient_weighting_id", -1, CS_FIELD_VARIABLE);
 
+  /* Cache computed cell gradients for reuse in the same time step
+     (0: no, 1: yes) */
+  cs_field_define_key_int("gradient_cache", 0, 0);
+
   cs_field_define_key_int("diffusivity_tensor", 0, CS_FIELD_VARIABLE);
   cs_field_define_key_int("drift_scalar_model", 0, 0);
 
@@ -91,6 +91,10 @@ BEGIN_C_DECLS
 
 #define DIR_SEPARATOR '/'
 
+/* Number of property types */
+
+#define CS_PHYS_PROP_N_TYPES (CS_PHYS_PROP_SPEED_OF_SOUND + 1)
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -116,6 +120,26 @@ typedef struct {
 
 } cs_thermal_table_t;
 
+/* Tabulated property structure: values of a property at the nodes of
+   a uniform grid over the thermodynamic plane (var1, var2), built from the
+   external library over the range of values actually visited. */
+
+typedef struct {
+
+  int          n_nodes[2];           /* number of nodes on each axis */
+
+  cs_real_t    x_min[2];             /* lower bounds of tabulated range */
+  cs_real_t    x_max[2];             /* upper bounds of tabulated range */
+  cs_real_t    dx[2];                /* grid step on each axis */
+
+  cs_real_t   *val;                  /* values at grid nodes
+                                        (size: n_nodes[0]*n_nodes[1]) */
+  bool        *valid;                /* is interpolation within tolerance
+                                        on each grid cell ?
+                                        (size: (n_nodes[0]-1)*(n_nodes[1]-1)) */
+
+} cs_phys_prop_table_t;
+
 /*----------------------------------------------------------------------------
  * Function pointer types
  *----------------------------------------------------------------------------*/
@@ -150,6 +174,14 @@ typedef void
 
 cs_thermal_table_t *cs_glob_thermal_table = NULL;
 
+/* Tabulation of properties computed by external libraries
+   (disabled if the number of nodes is 0) */
+
+static int        _tab_n_nodes[2] = {0, 0};
+static cs_real_t  _tab_rtol = 1.e-6;
+
+static cs_phys_prop_table_t  *_tables[CS_PHYS_PROP_N_TYPES] = {NULL};
+
 #if defined(HAVE_DLOPEN) && defined(HAVE_EOS)
 
 static void                     *_cs_eos_dl_lib = NULL;
@@ -193,6 +225,357 @@ _thermal_table_create(void)
   return tt;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute a physical property with the external library associated with
+ * the thermal table.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_phys_prop_compute_ext(cs_phys_prop_type_t   property,
+                       cs_lnum_t             n_vals,
+                       const cs_real_t       var1[],
+                       const cs_real_t       var2[],
+                       cs_real_t             val[])
+{
+  if (n_vals < 1)
+    return;
+
+#if defined(HAVE_EOS)
+  if (cs_glob_thermal_table->type == 2) {
+    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
+                      property,
+                      n_vals,
+                      var1,
+                      var2,
+                      val);
+  }
+#endif
+#if defined(HAVE_COOLPROP)
+  if (cs_glob_thermal_table->type == 3) {
+    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
+                           cs_glob_thermal_table->thermo_plane,
+                           property,
+                           n_vals,
+                           var1,
+                           var2,
+                           val);
+  }
+#endif
+
+  CS_UNUSED(property);
+  CS_UNUSED(var1);
+  CS_UNUSED(var2);
+  CS_UNUSED(val);
+}
+
+/*----------------------------------------------------------------------------
+ * Free all property tables.
+ *----------------------------------------------------------------------------*/
+
+static void
+_phys_prop_tables_free(void)
+{
+  for (int i = 0; i < CS_PHYS_PROP_N_TYPES; i++) {
+    if (_tables[i] != NULL) {
+      BFT_FREE(_tables[i]->val);
+      BFT_FREE(_tables[i]->valid);
+      BFT_FREE(_tables[i]);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute cubic (Catmull-Rom) interpolation weights and associated node
+ * ids along one axis of a property table.
+ *
+ * parameters:
+ *   x      <-- coordinate along axis
+ *   x_min  <-- lower bound of axis
+ *   dx     <-- grid step along axis
+ *   n      <-- number of nodes along axis
+ *   c_id   --> id of grid cell containing x
+ *   n_id   --> ids of the 4 nodes of the interpolation stencil
+ *   w      --> associated weights
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_cubic_weights(cs_real_t   x,
+               cs_real_t   x_min,
+               cs_real_t   dx,
+               int         n,
+               int        *c_id,
+               int         n_id[4],
+               cs_real_t   w[4])
+{
+  cs_real_t r = (x - x_min) / dx;
+  int i = (int)r;
+  if (i < 0)
+    i = 0;
+  else if (i > n - 2)
+    i = n - 2;
+
+  const cs_real_t t = r - i, t2 = t*t, t3 = t2*t;
+
+  w[0] = 0.5*(-t3 + 2.*t2 - t);
+  w[1] = 0.5*(3.*t3 - 5.*t2 + 2.);
+  w[2] = 0.5*(-3.*t3 + 4.*t2 + t);
+  w[3] = 0.5*(t3 - t2);
+
+  /* Stencil is clamped at range boundaries */
+
+  for (int k = 0; k < 4; k++) {
+    int j = i - 1 + k;
+    n_id[k] = (j < 0) ? 0 : ((j > n - 1) ? n - 1 : j);
+  }
+
+  *c_id = i;
+}
+
+/*----------------------------------------------------------------------------
+ * Interpolate a property from its table.
+ *
+ * parameters:
+ *   t      <-- pointer to property table
+ *   x1     <-- value on first plane axis
+ *   x2     <-- value on second plane axis
+ *   valid  --> is the interpolated value within tolerance ?
+ *
+ * returns:
+ *   interpolated value
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_table_interpolate(const cs_phys_prop_table_t  *t,
+                   cs_real_t                    x1,
+                   cs_real_t                    x2,
+                   bool                        *valid)
+{
+  int c_id[2], n_id[2][4];
+  cs_real_t w[2][4];
+
+  for (int k = 0; k < 2; k++) {
+    const cs_real_t x = (k == 0) ? x1 : x2;
+    _cubic_weights(x, t->x_min[k], t->dx[k], t->n_nodes[k],
+                   c_id + k, n_id[k], w[k]);
+  }
+
+  *valid = t->valid[c_id[0]*(t->n_nodes[1]-1) + c_id[1]];
+
+  cs_real_t v = 0;
+  for (int k0 = 0; k0 < 4; k0++) {
+    const cs_real_t *_val = t->val + n_id[0][k0]*t->n_nodes[1];
+    cs_real_t v1 = 0;
+    for (int k1 = 0; k1 < 4; k1++)
+      v1 += w[1][k1] * _val[n_id[1][k1]];
+    v += w[0][k0] * v1;
+  }
+
+  return v;
+}
+
+/*----------------------------------------------------------------------------
+ * Build or extend the table of a property so that it covers given values.
+ *
+ * The table is rebuilt using the external library only when some values
+ * are outside its current range. The interpolation error is then checked
+ * at the center of each grid cell, and cells where it is not within
+ * the tolerance are flagged so that values in those cells are computed
+ * by the library.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *
+ * returns:
+ *   pointer to property table
+ *----------------------------------------------------------------------------*/
+
+static cs_phys_prop_table_t *
+_table_update(cs_phys_prop_type_t   property,
+              cs_lnum_t             n_vals,
+              const cs_real_t       var1[],
+              const cs_real_t       var2[])
+{
+  cs_real_t x_min[2] = {var1[0], var2[0]};
+  cs_real_t x_max[2] = {var1[0], var2[0]};
+
+  for (cs_lnum_t i = 1; i < n_vals; i++) {
+    x_min[0] = CS_MIN(x_min[0], var1[i]);
+    x_max[0] = CS_MAX(x_max[0], var1[i]);
+    x_min[1] = CS_MIN(x_min[1], var2[i]);
+    x_max[1] = CS_MAX(x_max[1], var2[i]);
+  }
+
+  cs_phys_prop_table_t *t = _tables[property];
+
+  if (t != NULL) {
+    if (   x_min[0] >= t->x_min[0] && x_max[0] <= t->x_max[0]
+        && x_min[1] >= t->x_min[1] && x_max[1] <= t->x_max[1])
+      return t;
+
+    /* Extend range to union of visited ranges */
+
+    for (int k = 0; k < 2; k++) {
+      x_min[k] = CS_MIN(x_min[k], t->x_min[k]);
+      x_max[k] = CS_MAX(x_max[k], t->x_max[k]);
+    }
+  }
+  else {
+    BFT_MALLOC(t, 1, cs_phys_prop_table_t);
+    t->n_nodes[0] = CS_MAX(_tab_n_nodes[0], 4);
+    t->n_nodes[1] = CS_MAX(_tab_n_nodes[1], 4);
+    BFT_MALLOC(t->val, t->n_nodes[0]*t->n_nodes[1], cs_real_t);
+    BFT_MALLOC(t->valid, (t->n_nodes[0]-1)*(t->n_nodes[1]-1), bool);
+    _tables[property] = t;
+  }
+
+  /* Add a margin so that slowly drifting ranges do not require
+     rebuilding the table at each call */
+
+  for (int k = 0; k < 2; k++) {
+    cs_real_t w = x_max[k] - x_min[k];
+    if (w <= 0)
+      w = CS_MAX(1.e-3*CS_ABS(x_max[k]), 1.e-12);
+    t->x_min[k] = x_min[k] - 0.05*w;
+    t->x_max[k] = x_max[k] + 0.05*w;
+    t->dx[k] = (t->x_max[k] - t->x_min[k]) / (t->n_nodes[k] - 1);
+  }
+
+  const int n0 = t->n_nodes[0], n1 = t->n_nodes[1];
+
+  /* Values at grid nodes and grid cell centers;
+     the library is called only once for each set */
+
+  const cs_lnum_t n_nodes = n0*n1, n_cells = (n0-1)*(n1-1);
+
+  cs_real_t *x1, *x2, *v_ref;
+  BFT_MALLOC(x1, n_nodes, cs_real_t);
+  BFT_MALLOC(x2, n_nodes, cs_real_t);
+  BFT_MALLOC(v_ref, n_cells, cs_real_t);
+
+  for (int i = 0; i < n0; i++) {
+    for (int j = 0; j < n1; j++) {
+      x1[i*n1 + j] = t->x_min[0] + i*t->dx[0];
+      x2[i*n1 + j] = t->x_min[1] + j*t->dx[1];
+    }
+  }
+
+  _phys_prop_compute_ext(property, n_nodes, x1, x2, t->val);
+
+  for (int i = 0; i < n0-1; i++) {
+    for (int j = 0; j < n1-1; j++) {
+      x1[i*(n1-1) + j] = t->x_min[0] + (i+0.5)*t->dx[0];
+      x2[i*(n1-1) + j] = t->x_min[1] + (j+0.5)*t->dx[1];
+    }
+  }
+
+  _phys_prop_compute_ext(property, n_cells, x1, x2, v_ref);
+
+  cs_real_t v_max = 0;
+  for (cs_lnum_t i = 0; i < n_nodes; i++)
+    v_max = CS_MAX(v_max, CS_ABS(t->val[i]));
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    t->valid[i] = true;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    bool valid;
+    cs_real_t v = _table_interpolate(t, x1[i], x2[i], &valid);
+    cs_real_t tol = _tab_rtol * (CS_ABS(v_ref[i]) + 1.e-12*v_max);
+    t->valid[i] = (CS_ABS(v - v_ref[i]) <= tol);
+  }
+
+  BFT_FREE(v_ref);
+  BFT_FREE(x2);
+  BFT_FREE(x1);
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a physical property using its table, falling back to the
+ * external library for values where the interpolation is not accurate
+ * enough.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_phys_prop_compute_tabulated(cs_phys_prop_type_t   property,
+                             cs_lnum_t             n_vals,
+                             const cs_real_t       var1[],
+                             const cs_real_t       var2[],
+                             cs_real_t             val[])
+{
+  const cs_phys_prop_table_t *t = _table_update(property, n_vals, var1, var2);
+
+  bool *fallback;
+  BFT_MALLOC(fallback, n_vals, bool);
+
+# pragma omp parallel for if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vals; i++) {
+    bool valid;
+    val[i] = _table_interpolate(t, var1[i], var2[i], &valid);
+    fallback[i] = !valid;
+  }
+
+  /* Values in cells of the table where the interpolation is not
+     within tolerance are computed by the library, in a single call */
+
+  cs_lnum_t n_fb = 0;
+  for (cs_lnum_t i = 0; i < n_vals; i++) {
+    if (fallback[i])
+      n_fb++;
+  }
+
+  if (n_fb > 0) {
+
+    cs_lnum_t *fb_ids;
+    cs_real_t *fb_var1, *fb_var2, *fb_val;
+    BFT_MALLOC(fb_ids, n_fb, cs_lnum_t);
+    BFT_MALLOC(fb_var1, n_fb, cs_real_t);
+    BFT_MALLOC(fb_var2, n_fb, cs_real_t);
+    BFT_MALLOC(fb_val, n_fb, cs_real_t);
+
+    n_fb = 0;
+    for (cs_lnum_t i = 0; i < n_vals; i++) {
+      if (fallback[i]) {
+        fb_ids[n_fb] = i;
+        fb_var1[n_fb] = var1[i];
+        fb_var2[n_fb] = var2[i];
+        n_fb++;
+      }
+    }
+
+    _phys_prop_compute_ext(property, n_fb, fb_var1, fb_var2, fb_val);
+
+    for (cs_lnum_t i = 0; i < n_fb; i++)
+      val[fb_ids[i]] = fb_val[i];
+
+    BFT_FREE(fb_val);
+    BFT_FREE(fb_var2);
+    BFT_FREE(fb_var1);
+    BFT_FREE(fb_ids);
+
+  }
+
+  BFT_FREE(fallback);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get xdef of a property on a given zone.
@@ -376,6 +759,45 @@ cs_thermal_table_set(const char                        *material,
   }
   cs_glob_thermal_table->thermo_plane = thermo_plane;
   cs_glob_thermal_table->temp_scale = temp_scale;
+
+  _phys_prop_tables_free();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define tabulation of properties computed by external libraries.
+ *
+ * When activated, properties computed with EOS or CoolProp are interpolated
+ * (bicubic interpolation) from tables built over the range of values
+ * actually visited in the thermodynamic plane, and rebuilt only when this
+ * range is extended. Values for which the interpolation error (checked at
+ * the center of each table cell) is not within the given relative
+ * tolerance are computed by the library.
+ *
+ * \param[in]  n_nodes_1  number of table nodes on first plane axis
+ *                         (0 to deactivate tabulation)
+ * \param[in]  n_nodes_2  number of table nodes on second plane axis
+ * \param[in]  rtol       relative tolerance of interpolated values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_thermal_table_set_tabulation(int        n_nodes_1,
+                                int        n_nodes_2,
+                                cs_real_t  rtol)
+{
+  _phys_prop_tables_free();
+
+  if (n_nodes_1 > 0 && n_nodes_2 > 0) {
+    _tab_n_nodes[0] = CS_MAX(n_nodes_1, 4);
+    _tab_n_nodes[1] = CS_MAX(n_nodes_2, 4);
+  }
+  else {
+    _tab_n_nodes[0] = 0;
+    _tab_n_nodes[1] = 0;
+  }
+
+  _tab_rtol = rtol;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -407,6 +829,8 @@ cs_thermal_table_finalize(void)
     BFT_FREE(cs_glob_thermal_table->method);
     BFT_FREE(cs_glob_thermal_table);
   }
+
+  _phys_prop_tables_free();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -488,27 +912,21 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
                            var2_c,
                            val);
   }
-#if defined(HAVE_EOS)
-  else if (cs_glob_thermal_table->type == 2) {
-    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
-                      property,
-                      _n_vals,
-                      var1_c,
-                      var2_c,
-                      val);
-  }
-#endif
-#if defined(HAVE_COOLPROP)
-  else if (cs_glob_thermal_table->type == 3) {
-    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
-                           cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
-                           val);
+  else if (   cs_glob_thermal_table->type == 2
+           || cs_glob_thermal_table->type == 3) {
+    if (_tab_n_nodes[0] > 0 && _n_vals > 1)
+      _phys_prop_compute_tabulated(property,
+                                   _n_vals,
+                                   var1_c,
+                                   var2_c,
+                                   val);
+    else
+      _phys_prop_compute_ext(property,
+                             _n_vals,
+                             var1_c,
+                             var2_c,
+                             val);
   }
-#endif
   BFT_FREE(_var1_c);
   BFT_FREE(_var2_c);
 
@@ -82,6 +82,28 @@ cs_thermal_table_set(const char                        *material,
                      cs_phys_prop_thermo_plane_type_t   thermo_plane,
                      int                                temp_scale);
 
+/*----------------------------------------------------------------------------
+ * Define tabulation of properties computed by external libraries.
+ *
+ * When activated, properties computed with EOS or CoolProp are interpolated
+ * (bicubic interpolation) from tables built over the range of values
+ * actually visited in the thermodynamic plane, and rebuilt only when this
+ * range is extended. Values for which the interpolation error (checked at
+ * the center of each table cell) is not within the given relative
+ * tolerance are computed by the library.
+ *
+ * parameters:
+ *   n_nodes_1 <-- number of table nodes on first plane axis
+ *                 (0 to deactivate tabulation)
+ *   n_nodes_2 <-- number of table nodes on second plane axis
+ *   rtol      <-- relative tolerance of interpolated values
+ *----------------------------------------------------------------------------*/
+
+void
+cs_thermal_table_set_tabulation(int        n_nodes_1,
+                                int        n_nodes_2,
+                                cs_real_t  rtol);
+
 /*----------------------------------------------------------------------------
  * Finalize thermal table
  *----------------------------------------------------------------------------*/
@@ -58,12 +58,14 @@
 
 
 #include "cs_base.h"
+#include "cs_block_dist.h"
 #include "cs_boundary_conditions.h"
 #include "cs_boundary_zone.h"
 #include "cs_coupling.h"
 #include "cs_domain.h"
 #include "cs_field.h"
 #include "cs_field_pointer.h"
+#include "cs_file.h"
 #include "cs_geom.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
@@ -74,6 +76,7 @@
 #include "cs_mesh_connect.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
+#include "cs_order.h"
 #include "cs_parall.h"
 #include "cs_equation_iterative_solve.h"
 #include "cs_physical_constants.h"
@@ -106,6 +109,39 @@ BEGIN_C_DECLS
  * Local Type Definitions
  *============================================================================*/
 
+/* Scanned points held by the local rank */
+
+typedef struct {
+
+  cs_gnum_t     n_g_points;   /* Global number of points read */
+  cs_lnum_t     n_points;     /* Number of local points */
+  cs_real_3_t  *coords;       /* Point coordinates */
+  float        *colors;       /* Point colors in [0, 1], or NULL */
+  cs_real_t    *weights;      /* Number of points read represented by
+                                 each point, or NULL (1 for all points) */
+
+} _scan_points_t;
+
+/* Description of fixed-size point records in a binary file */
+
+typedef struct {
+
+  cs_gnum_t      n_g_points;       /* Number of points */
+  cs_gnum_t      data_offset;      /* Offset of first record in file */
+  size_t         record_size;      /* Size of each record, in bytes */
+  bool           swap_endian;      /* Swap bytes of values if true */
+
+  cs_datatype_t  coord_type[3];    /* Coordinates datatype */
+  size_t         coord_offset[3];  /* Coordinates offset in record */
+  double         coord_scale[3];   /* Coordinates scaling factor */
+  double         coord_shift[3];   /* Coordinates offset after scaling */
+
+  cs_datatype_t  color_type[3];    /* Colors datatype (CS_CHAR for unsigned
+                                      bytes), or CS_DATATYPE_NULL */
+  size_t         color_offset[3];  /* Colors offset in record */
+
+} _scan_record_format_t;
+
 static cs_porosity_from_scan_opt_t _porosity_from_scan_opt = {
   .compute_porosity_from_scan = false,
   .file_name = NULL,
@@ -115,6 +151,7 @@ static cs_porosity_from_scan_opt_t _porosity_from_scan_opt = {
   {{1., 0., 0., 0.},
     {0., 1., 0., 0.},
     {0., 0., 1., 0.}},
+  .voxel_size = -1.,
   .nb_sources = 0,
   .sources = NULL,
   .source_c_ids = NULL
@@ -142,22 +179,907 @@ cs_f_porosity_from_scan_get_pointer(bool  **compute_porosity_from_scan);
  *============================================================================*/
 
 /*----------------------------------------------------------------------------
- * Function
+ * Decode a value from a binary point record.
+ *
+ * parameters:
+ *   p    <-- pointer to value in record
+ *   type <-- value datatype (CS_CHAR for unsigned byte values)
+ *   swap <-- true if bytes must be swapped
+ *
+ * returns:
+ *   decoded value
+ *----------------------------------------------------------------------------*/
+
+static double
+_decode_value(const unsigned char  *p,
+              cs_datatype_t         type,
+              bool                  swap)
+{
+  unsigned char b[8];
+  const size_t s = cs_datatype_size[type];
+
+  for (size_t i = 0; i < s; i++)
+    b[i] = (swap) ? p[s-1-i] : p[i];
+
+  double v = 0;
+
+  switch(type) {
+  case CS_CHAR:
+    v = b[0];
+    break;
+  case CS_UINT16:
+    {
+      uint16_t _v;
+      memcpy(&_v, b, 2);
+      v = _v;
+    }
+    break;
+  case CS_INT32:
+    {
+      int32_t _v;
+      memcpy(&_v, b, 4);
+      v = _v;
+    }
+    break;
+  case CS_UINT32:
+    {
+      uint32_t _v;
+      memcpy(&_v, b, 4);
+      v = _v;
+    }
+    break;
+  case CS_UINT64:
+    {
+      uint64_t _v;
+      memcpy(&_v, b, 8);
+      v = _v;
+    }
+    break;
+  case CS_FLOAT:
+    {
+      float _v;
+      memcpy(&_v, b, 4);
+      v = _v;
+    }
+    break;
+  case CS_DOUBLE:
+    memcpy(&v, b, 8);
+    break;
+  default:
+    assert(0);
+  }
+
+  return v;
+}
+
+/*----------------------------------------------------------------------------
+ * Return datatype and size matching a PLY property type name.
+ *
+ * Types not handled for coordinates or colors have a matching size
+ * but a CS_DATATYPE_NULL datatype.
+ *
+ * parameters:
+ *   type_name <-- PLY type name
+ *   type      --> matching datatype
+ *
+ * returns:
+ *   size of type in bytes, or 0 if unknown
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_ply_type(const char     *type_name,
+          cs_datatype_t  *type)
+{
+  const char *names[] = {"char", "int8", "uchar", "uint8",
+                         "short", "int16", "ushort", "uint16",
+                         "int", "int32", "uint", "uint32",
+                         "float", "float32", "double", "float64"};
+  const cs_datatype_t types[] = {CS_DATATYPE_NULL, CS_CHAR,
+                                 CS_DATATYPE_NULL, CS_UINT16,
+                                 CS_INT32, CS_UINT32,
+                                 CS_FLOAT, CS_DOUBLE};
+  const size_t sizes[] = {1, 1, 2, 2, 4, 4, 4, 8};
+
+  for (int i = 0; i < 16; i++) {
+    if (strcmp(type_name, names[i]) == 0) {
+      *type = types[i/2];
+      return sizes[i/2];
+    }
+  }
+
+  *type = CS_DATATYPE_NULL;
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Parse the header of a binary PLY file.
+ *
+ * Only the vertex element is read, so it must be the first element
+ * of the file.
+ *
+ * parameters:
+ *   file_name   <-- file name (for error messages)
+ *   header      <-- start of file (null-terminated)
+ *   header_size <-- size of header buffer
+ *   rf          --> point record description
+ *----------------------------------------------------------------------------*/
+
+static void
+_parse_ply_header(const char               *file_name,
+                  const char               *header,
+                  size_t                    header_size,
+                  _scan_record_format_t    *rf)
+{
+  const char *coord_names[] = {"x", "y", "z"};
+  const char *color_names[] = {"red", "green", "blue"};
+
+  const unsigned int _one = 1;
+  const bool host_is_big_endian = (*((const char *)&_one) == 0);
+
+  int n_elements = 0;
+  bool in_vertex = false;
+  size_t s = 0;
+
+  rf->data_offset = 0;
+
+  for (int line_id = 0; s < header_size; line_id++) {
+
+    char line[256], w[3][64];
+
+    size_t l = 0;
+    while (s < header_size && header[s] != '\n') {
+      if (l < sizeof(line) - 1 && header[s] != '\r')
+        line[l++] = header[s];
+      s++;
+    }
+    line[l] = '\0';
+    s++;
+
+    int n_w = sscanf(line, "%63s %63s %63s", w[0], w[1], w[2]);
+
+    if (line_id == 0) {
+      if (n_w != 1 || strcmp(w[0], "ply") != 0)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Porosity from scan: file \"%s\" is not a PLY file."),
+                  file_name);
+    }
+    else if (n_w < 1)
+      continue;
+    else if (strcmp(w[0], "format") == 0 && n_w > 1) {
+      if (strcmp(w[1], "binary_little_endian") == 0)
+        rf->swap_endian = host_is_big_endian;
+      else if (strcmp(w[1], "binary_big_endian") == 0)
+        rf->swap_endian = !host_is_big_endian;
+      else
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Porosity from scan: PLY file \"%s\" has format \"%s\";\n"
+                    "only binary PLY files are handled."),
+                  file_name, w[1]);
+    }
+    else if (strcmp(w[0], "element") == 0 && n_w > 2) {
+      in_vertex = (strcmp(w[1], "vertex") == 0);
+      if (in_vertex) {
+        if (n_elements > 0)
+          bft_error(__FILE__, __LINE__, 0,
+                    _("Porosity from scan: in PLY file \"%s\",\n"
+                      "the vertex element must be the first element."),
+                    file_name);
+        rf->n_g_points = strtoull(w[2], NULL, 10);
+      }
+      n_elements++;
+    }
+    else if (strcmp(w[0], "property") == 0 && in_vertex && n_w > 2) {
+      cs_datatype_t type;
+      size_t type_size = _ply_type(w[1], &type);
+      if (type_size == 0)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Porosity from scan: in PLY file \"%s\",\n"
+                    "vertex property type \"%s\" is not handled."),
+                  file_name, w[1]);
+      for (int j = 0; j < 3; j++) {
+        if (strcmp(w[2], coord_names[j]) == 0) {
+          rf->coord_type[j] = type;
+          rf->coord_offset[j] = rf->record_size;
+        }
+        else if (   strcmp(w[2], color_names[j]) == 0
+                 && (type == CS_CHAR || type == CS_UINT16)) {
+          rf->color_type[j] = type;
+          rf->color_offset[j] = rf->record_size;
+        }
+      }
+      rf->record_size += type_size;
+    }
+    else if (strcmp(w[0], "end_header") == 0) {
+      rf->data_offset = s;
+      break;
+    }
+
+  }
+
+  if (rf->data_offset == 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Porosity from scan: end of header not found\n"
+                "in PLY file \"%s\"."), file_name);
+
+  for (int j = 0; j < 3; j++) {
+    if (rf->coord_type[j] == CS_DATATYPE_NULL)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Porosity from scan: in PLY file \"%s\",\n"
+                  "vertex property \"%s\" is missing or of unhandled type."),
+                file_name, coord_names[j]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Parse the header of a LAS file.
+ *
+ * parameters:
+ *   file_name   <-- file name (for error messages)
+ *   header      <-- start of file
+ *   header_size <-- size of header buffer
+ *   rf          --> point record description
+ *----------------------------------------------------------------------------*/
+
+static void
+_parse_las_header(const char               *file_name,
+                  const unsigned char      *header,
+                  size_t                    header_size,
+                  _scan_record_format_t    *rf)
+{
+  const unsigned int _one = 1;
+  const bool swap = (*((const char *)&_one) == 0); /* LAS is little-endian */
+
+  if (header_size < 227 || strncmp((const char *)header, "LASF", 4) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Porosity from scan: file \"%s\" is not a LAS file."),
+              file_name);
+
+  int version_minor = header[25];
+  int point_format = header[104];
+
+  if (point_format & 0xC0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Porosity from scan: LAS file \"%s\" is compressed;\n"
+                "only uncompressed LAS files are handled."),
+              file_name);
+
+  rf->swap_endian = swap;
+  rf->data_offset = _decode_value(header + 96, CS_UINT32, swap);
+  rf->record_size = _decode_value(header + 105, CS_UINT16, swap);
+  rf->n_g_points = _decode_value(header + 107, CS_UINT32, swap);
+
+  /* LAS 1.4 files may only define the 64-bit number of points */
+  if (version_minor >= 4 && header_size >= 255) {
+    cs_gnum_t n_g_points = _decode_value(header + 247, CS_UINT64, swap);
+    if (n_g_points > 0)
+      rf->n_g_points = n_g_points;
+  }
+
+  for (int j = 0; j < 3; j++) {
+    rf->coord_type[j] = CS_INT32;
+    rf->coord_offset[j] = 4*j;
+    rf->coord_scale[j] = _decode_value(header + 131 + 8*j, CS_DOUBLE, swap);
+    rf->coord_shift[j] = _decode_value(header + 155 + 8*j, CS_DOUBLE, swap);
+  }
+
+  /* Point data formats with RGB colors */
+  size_t color_offset = 0;
+  switch(point_format) {
+  case 2:
+    color_offset = 20;
+    break;
+  case 3:
+  case 5:
+    color_offset = 28;
+    break;
+  case 7:
+  case 8:
+  case 10:
+    color_offset = 30;
+    break;
+  default:
+    break;
+  }
+
+  if (color_offset > 0 && color_offset + 6 <= rf->record_size) {
+    for (int j = 0; j < 3; j++) {
+      rf->color_type[j] = CS_UINT16;
+      rf->color_offset[j] = color_offset + 2*j;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read a binary (PLY or LAS) scan file.
+ *
+ * Each rank reads a contiguous block of fixed-size point records.
+ *
+ * parameters:
+ *   file_name <-- file name
+ *   las       <-- true for LAS file, false for PLY file
+ *   sp        --> local points
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_binary_scan(const char        *file_name,
+                  bool               las,
+                  _scan_points_t    *sp)
+{
+  _scan_record_format_t rf = {.n_g_points = 0,
+                              .data_offset = 0,
+                              .record_size = 0,
+                              .swap_endian = false};
+
+  for (int j = 0; j < 3; j++) {
+    rf.coord_type[j] = CS_DATATYPE_NULL;
+    rf.coord_offset[j] = 0;
+    rf.coord_scale[j] = 1.;
+    rf.coord_shift[j] = 0.;
+    rf.color_type[j] = CS_DATATYPE_NULL;
+    rf.color_offset[j] = 0;
+  }
+
+  cs_file_t *f = cs_file_open_default(file_name, CS_FILE_MODE_READ);
+
+  /* Headers are small, but their size is not known in advance */
+
+  cs_file_off_t file_size = cs_file_size(file_name);
+  size_t header_size = CS_MIN(file_size, 65536);
+
+  unsigned char *header;
+  BFT_MALLOC(header, header_size + 1, unsigned char);
+
+  cs_file_read_global(f, header, 1, header_size);
+  header[header_size] = '\0';
+
+  if (las)
+    _parse_las_header(file_name, header, header_size, &rf);
+  else
+    _parse_ply_header(file_name, (const char *)header, header_size, &rf);
+
+  BFT_FREE(header);
+
+  if (  (cs_gnum_t)file_size
+      < rf.data_offset + rf.n_g_points*rf.record_size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Porosity from scan: file \"%s\" is truncated."),
+              file_name);
+
+  /* Read local block of records */
+
+  cs_block_dist_info_t bi
+    = cs_block_dist_compute_sizes(CS_MAX(cs_glob_rank_id, 0),
+                                  cs_glob_n_ranks,
+                                  1,
+                                  0,
+                                  rf.n_g_points);
+
+  const cs_lnum_t n_points = bi.gnum_range[1] - bi.gnum_range[0];
+  const bool have_colors = (rf.color_type[0] != CS_DATATYPE_NULL);
+
+  sp->n_g_points = rf.n_g_points;
+  sp->n_points = n_points;
+  BFT_MALLOC(sp->coords, n_points, cs_real_3_t);
+  if (have_colors)
+    BFT_MALLOC(sp->colors, 3*n_points, float);
+
+  unsigned char *buf;
+  BFT_MALLOC(buf, n_points*rf.record_size, unsigned char);
+
+  cs_file_seek(f, rf.data_offset, CS_FILE_SEEK_SET);
+  cs_file_read_block(f, buf, 1, rf.record_size,
+                     bi.gnum_range[0], bi.gnum_range[1]);
+
+  f = cs_file_free(f);
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    const unsigned char *r = buf + i*rf.record_size;
+    for (int j = 0; j < 3; j++)
+      sp->coords[i][j] =   _decode_value(r + rf.coord_offset[j],
+                                         rf.coord_type[j],
+                                         rf.swap_endian)
+                         * rf.coord_scale[j] + rf.coord_shift[j];
+    if (have_colors) {
+      for (int j = 0; j < 3; j++) {
+        double c_max = (rf.color_type[j] == CS_CHAR) ? 255. : 65535.;
+        sp->colors[3*i + j] = _decode_value(r + rf.color_offset[j],
+                                            rf.color_type[j],
+                                            rf.swap_endian) / c_max;
+      }
+    }
+  }
+
+  BFT_FREE(buf);
+}
+
+/*----------------------------------------------------------------------------
+ * Read the number of points of the next scan in an ASCII scan file.
+ *
+ * parameters:
+ *   file <-- file pointer (on rank 0 only)
+ *
+ * returns:
+ *   number of points of next scan, or 0 at end of file
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_read_ascii_n_points(FILE  *file)
+{
+  cs_gnum_t n_points = 0;
+
+  if (file != NULL) {
+    char line[512];
+    if (fgets(line, sizeof(line), file) != NULL)
+      n_points = strtoull(line, NULL, 10);
+  }
+
+  cs_parall_bcast(0, 1, CS_GNUM_TYPE, &n_points);
+
+  return n_points;
+}
+
+/*----------------------------------------------------------------------------
+ * Read points from an ASCII scan file.
+ *
+ * Each line contains the coordinates, intensity, and red, green and
+ * blue color components of a point.
+ *
+ * parameters:
+ *   file         <-- file pointer
+ *   point_num    <-- global number of first point (for error messages)
+ *   n_points     <-- number of points to read
+ *   point_coords --> point coordinates
+ *   colors       --> point colors
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_ascii_points(FILE         *file,
+                   cs_gnum_t     point_num,
+                   cs_lnum_t     n_points,
+                   cs_real_3_t   point_coords[],
+                   float         colors[])
+{
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    int num, red, green, blue;
+    double xyz[3];
+
+    if (fscanf(file, "%lf %lf %lf %d %d %d %d\n",
+               &(xyz[0]), &(xyz[1]), &(xyz[2]),
+               &num, &red, &green, &blue) != 7)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Porosity from scan: Error while reading dataset."
+                  " Point %llu\n"),
+                (unsigned long long)(point_num + i));
+
+    for (int j = 0; j < 3; j++)
+      point_coords[i][j] = xyz[j];
+
+    /* When colors are written as int, Paraview intreprates them in [0, 255]
+     * when they are written as float, Paraview interprates them in [0., 1.]
+     * */
+    colors[3*i + 0] = red/255.;
+    colors[3*i + 1] = green/255.;
+    colors[3*i + 2] = blue/255.;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read one scan from an ASCII scan file.
+ *
+ * Text lines can not be read in parallel, so rank 0 reads the file,
+ * and sends each other rank its block of points.
+ *
+ * parameters:
+ *   file       <-- file pointer (on rank 0 only)
+ *   n_g_points <-- number of points in scan
+ *   sp         --> local points
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_ascii_scan(FILE            *file,
+                 cs_gnum_t        n_g_points,
+                 _scan_points_t  *sp)
+{
+  const int n_ranks = cs_glob_n_ranks;
+  const int rank_id = CS_MAX(cs_glob_rank_id, 0);
+
+  cs_block_dist_info_t bi
+    = cs_block_dist_compute_sizes(rank_id, n_ranks, 1, 0, n_g_points);
+
+  const cs_lnum_t n_points = bi.gnum_range[1] - bi.gnum_range[0];
+
+  sp->n_g_points = n_g_points;
+  sp->n_points = n_points;
+  BFT_MALLOC(sp->coords, n_points, cs_real_3_t);
+  BFT_MALLOC(sp->colors, 3*n_points, float);
+
+  if (rank_id == 0)
+    _read_ascii_points(file, bi.gnum_range[0], n_points,
+                       sp->coords, sp->colors);
+
+#if defined(HAVE_MPI)
+
+  if (n_ranks > 1) {
+
+    if (rank_id == 0) {
+
+      cs_real_3_t *r_coords;
+      float *r_colors;
+      BFT_MALLOC(r_coords, bi.block_size, cs_real_3_t);
+      BFT_MALLOC(r_colors, 3*bi.block_size, float);
+
+      for (int r = 1; r < n_ranks; r++) {
+        cs_block_dist_info_t rbi
+          = cs_block_dist_compute_sizes(r, n_ranks, 1, 0, n_g_points);
+        const cs_lnum_t n_r = rbi.gnum_range[1] - rbi.gnum_range[0];
+
+        _read_ascii_points(file, rbi.gnum_range[0], n_r, r_coords, r_colors);
+
+        MPI_Send(r_coords, 3*n_r, CS_MPI_REAL, r, 1, cs_glob_mpi_comm);
+        MPI_Send(r_colors, 3*n_r, MPI_FLOAT, r, 2, cs_glob_mpi_comm);
+      }
+
+      BFT_FREE(r_colors);
+      BFT_FREE(r_coords);
+
+    }
+    else {
+
+      MPI_Status status;
+      MPI_Recv(sp->coords, 3*n_points, CS_MPI_REAL, 0, 1,
+               cs_glob_mpi_comm, &status);
+      MPI_Recv(sp->colors, 3*n_points, MPI_FLOAT, 0, 2,
+               cs_glob_mpi_comm, &status);
+
+    }
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Apply the transformation matrix to local points, and update the
+ * associated bounding box.
+ *
+ * parameters:
+ *   sp      <-> local points
+ *   min_vec <-> bounding box minimum
+ *   max_vec <-> bounding box maximum
+ *----------------------------------------------------------------------------*/
+
+static void
+_transform_points(_scan_points_t  *sp,
+                  cs_real_t        min_vec[3],
+                  cs_real_t        max_vec[3])
+{
+  cs_real_t (*t)[4] = _porosity_from_scan_opt.transformation_matrix;
+
+  for (cs_lnum_t i = 0; i < sp->n_points; i++) {
+
+    cs_real_t xyz[4] = {sp->coords[i][0], sp->coords[i][1], sp->coords[i][2],
+                        1.};
+
+    /* Translation and rotation */
+    for (int j = 0; j < 3; j++) {
+      sp->coords[i][j] = 0.;
+      for (int k = 0; k < 4; k++)
+        sp->coords[i][j] += t[j][k] * xyz[k];
+
+      /* Compute bounding box*/
+      min_vec[j] = CS_MIN(min_vec[j], sp->coords[i][j]);
+      max_vec[j] = CS_MAX(max_vec[j], sp->coords[i][j]);
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Merge local points by voxel.
+ *
+ * Points in a same voxel are replaced by their centroid, whose weight
+ * is the number of merged points, so that point counts used to determine
+ * solid cells are preserved. Points are merged on each rank only.
+ *
+ * parameters:
+ *   voxel_size <-- voxel size
+ *   origin     <-- voxel grid origin
+ *   sp         <-> local points
+ *----------------------------------------------------------------------------*/
+
+static void
+_voxel_downsample(cs_real_t         voxel_size,
+                  const cs_real_t   origin[3],
+                  _scan_points_t   *sp)
+{
+  const cs_lnum_t n_points = sp->n_points;
+  const cs_real_t v_inv = 1. / voxel_size;
+
+  cs_gnum_t *voxel_ijk;
+  BFT_MALLOC(voxel_ijk, 3*n_points, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    for (int j = 0; j < 3; j++)
+      voxel_ijk[3*i + j]
+        = (cs_gnum_t)CS_MAX(floor((sp->coords[i][j] - origin[j])*v_inv), 0);
+  }
+
+  cs_lnum_t *order = cs_order_gnum_s(NULL, voxel_ijk, 3, n_points);
+
+  cs_real_3_t *coords;
+  cs_real_t *weights;
+  float *colors = NULL;
+  BFT_MALLOC(coords, n_points, cs_real_3_t);
+  BFT_MALLOC(weights, n_points, cs_real_t);
+  if (sp->colors != NULL)
+    BFT_MALLOC(colors, 3*n_points, float);
+
+  cs_lnum_t n_voxels = 0;
+
+  for (cs_lnum_t s_id = 0; s_id < n_points;) {
+
+    const cs_gnum_t *v = voxel_ijk + 3*order[s_id];
+
+    cs_lnum_t e_id = s_id + 1;
+    while (e_id < n_points) {
+      const cs_gnum_t *v_e = voxel_ijk + 3*order[e_id];
+      if (v_e[0] != v[0] || v_e[1] != v[1] || v_e[2] != v[2])
+        break;
+      e_id++;
+    }
+
+    cs_real_t w = 0;
+    double c_sum[3] = {0, 0, 0};
+    for (int j = 0; j < 3; j++)
+      coords[n_voxels][j] = 0;
+
+    for (cs_lnum_t k = s_id; k < e_id; k++) {
+      const cs_lnum_t p_id = order[k];
+      const cs_real_t w_p = (sp->weights != NULL) ? sp->weights[p_id] : 1.;
+      w += w_p;
+      for (int j = 0; j < 3; j++)
+        coords[n_voxels][j] += w_p*sp->coords[p_id][j];
+      if (colors != NULL) {
+        for (int j = 0; j < 3; j++)
+          c_sum[j] += w_p*sp->colors[3*p_id + j];
+      }
+    }
+
+    for (int j = 0; j < 3; j++)
+      coords[n_voxels][j] /= w;
+    if (colors != NULL) {
+      for (int j = 0; j < 3; j++)
+        colors[3*n_voxels + j] = c_sum[j] / w;
+    }
+    weights[n_voxels] = w;
+
+    n_voxels++;
+    s_id = e_id;
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(voxel_ijk);
+
+  BFT_FREE(sp->coords);
+  BFT_FREE(sp->colors);
+  BFT_FREE(sp->weights);
+
+  BFT_REALLOC(coords, n_voxels, cs_real_3_t);
+  BFT_REALLOC(weights, n_voxels, cs_real_t);
+  if (colors != NULL)
+    BFT_REALLOC(colors, 3*n_voxels, float);
+
+  sp->n_points = n_voxels;
+  sp->coords = coords;
+  sp->colors = colors;
+  sp->weights = weights;
+}
+
+/*----------------------------------------------------------------------------
+ * Output scanned points.
+ *
+ * parameters:
+ *   n_scan <-- scan number
+ *   sp     <-- local points
+ *----------------------------------------------------------------------------*/
+
+static void
+_postprocess_points(int                    n_scan,
+                    const _scan_points_t  *sp)
+{
+  char *fvm_name;
+  if (_porosity_from_scan_opt.output_name == NULL) {
+    BFT_MALLOC(fvm_name,
+               strlen(_porosity_from_scan_opt.file_name) + 3 + 1,
+               char);
+    strcpy(fvm_name, _porosity_from_scan_opt.file_name);
+  } else {
+    BFT_MALLOC(fvm_name,
+               strlen(_porosity_from_scan_opt.output_name) + 3 + 1,
+               char);
+    strcpy(fvm_name, _porosity_from_scan_opt.output_name);
+  }
+  char suffix[13];
+  sprintf(suffix, "_%02d", n_scan);
+  strcat(fvm_name, suffix);
+
+  /* Build FVM mesh from scanned points */
+  fvm_nodal_t *pts_mesh = fvm_nodal_create(fvm_name, 3);
+
+  /* Update the points set structure */
+  fvm_nodal_define_vertex_list(pts_mesh, sp->n_points, NULL);
+  fvm_nodal_set_shared_vertices(pts_mesh, (const cs_coord_t *)sp->coords);
+
+  /* Points are numbered in rank order */
+  cs_gnum_t gnum_shift = 0;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t n_points = sp->n_points;
+    MPI_Scan(&n_points, &gnum_shift, 1, CS_MPI_GNUM, MPI_SUM,
+             cs_glob_mpi_comm);
+    gnum_shift -= n_points;
+  }
+#endif
+
+  cs_gnum_t *vtx_gnum = NULL;
+  BFT_MALLOC(vtx_gnum, sp->n_points, cs_gnum_t);
+  for (cs_lnum_t i = 0; i < sp->n_points; i++)
+    vtx_gnum[i] = gnum_shift + i + 1;
+
+  fvm_nodal_init_io_num(pts_mesh, vtx_gnum, 0);
+
+  BFT_FREE(vtx_gnum);
+
+  /* Create default writer */
+  fvm_writer_t *writer = fvm_writer_init(fvm_name,
+                                         "postprocessing",
+                                         cs_post_get_default_format(),
+                                         cs_post_get_default_format_options(),
+                                         FVM_WRITER_FIXED_MESH);
+
+  fvm_writer_export_nodal(writer, pts_mesh);
+
+  /* Colors may be missing from binary files */
+  int have_colors = (sp->colors != NULL) ? 1 : 0;
+  cs_parall_max(1, CS_INT_TYPE, &have_colors);
+
+  if (have_colors) {
+    const void *var_ptr[1] = {sp->colors};
+
+    fvm_writer_export_field(writer,
+                            pts_mesh,
+                            "color",
+                            FVM_WRITER_PER_NODE,
+                            3,
+                            CS_INTERLACE,
+                            0,
+                            0,
+                            CS_FLOAT,
+                            -1,
+                            0.0,
+                            (const void * *)var_ptr);
+  }
+
+  /* Free and destroy */
+  fvm_writer_finalize(writer);
+  pts_mesh = fvm_nodal_destroy(pts_mesh);
+
+  BFT_FREE(fvm_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Locate local points in cells, and add them to the cell point counts.
+ *
+ * parameters:
+ *   location_mesh <-- nodal mesh of cells
+ *   sp            <-- local points
+ *   nb_scan       <-> number of points per cell
+ *----------------------------------------------------------------------------*/
+
+static void
+_count_points(fvm_nodal_t           *location_mesh,
+              const _scan_points_t  *sp,
+              cs_real_t              nb_scan[])
+{
+  int options[PLE_LOCATOR_N_OPTIONS];
+  for (int i = 0; i < PLE_LOCATOR_N_OPTIONS; i++)
+    options[i] = 0;
+  options[PLE_LOCATOR_NUMBERING] = 0; /* base 0 numbering */
+
+#if defined(PLE_HAVE_MPI)
+  _locator = ple_locator_create(cs_glob_mpi_comm,
+                                cs_glob_n_ranks,
+                                0);
+#else
+  _locator = ple_locator_create();
+#endif
+
+  /* Each point is located only once; points are only sent to
+     ranks whose mesh extents contain them */
+
+  ple_locator_set_mesh(_locator,
+                       location_mesh,
+                       options,
+                       0., /* tolerance_base */
+                       0.1, /* tolerance */
+                       3, /* dim */
+                       sp->n_points,
+                       NULL,
+                       NULL, /* point_tag */
+                       (const cs_real_t *)sp->coords,
+                       NULL, /* distance */
+                       cs_coupling_mesh_extents,
+                       cs_coupling_point_in_mesh_p);
+
+  /* Shift from 1-base to 0-based locations */
+  ple_locator_shift_locations(_locator, -1);
+
+  /* dump locator */
+#if 0
+  ple_locator_dump(_locator);
+#endif
+
+  /* Get the element ids (list of points on the local rank) */
+  cs_lnum_t n_points_loc = ple_locator_get_n_dist_points(_locator);
+
+  const cs_lnum_t *elt_ids = ple_locator_get_dist_locations(_locator);
+
+  /* Merged points carry the number of points they represent */
+  int have_weights = (sp->weights != NULL) ? 1 : 0;
+  cs_parall_max(1, CS_INT_TYPE, &have_weights);
+
+  if (have_weights) {
+    cs_real_t *dist_weights;
+    BFT_MALLOC(dist_weights, n_points_loc, cs_real_t);
+
+    ple_locator_exchange_point_var(_locator,
+                                   dist_weights,
+                                   sp->weights,
+                                   ple_locator_get_interior_list(_locator),
+                                   sizeof(cs_real_t),
+                                   1,
+                                   1);
+
+    for (cs_lnum_t i = 0; i < n_points_loc; i++) {
+      if (elt_ids[i] >= 0) /* Found */
+        nb_scan[elt_ids[i]] += dist_weights[i];
+    }
+
+    BFT_FREE(dist_weights);
+  }
+  else {
+    for (cs_lnum_t i = 0; i < n_points_loc; i++) {
+      if (elt_ids[i] >= 0) /* Found */
+        nb_scan[elt_ids[i]] += 1.;
+    }
+  }
+
+  _locator = ple_locator_destroy(_locator);
+}
+
+/*----------------------------------------------------------------------------
+ * Count scanned points in cells, and deduce solid cells.
+ *
+ * Points are distributed in blocks over ranks; binary (PLY or LAS) files
+ * are read in parallel, while ASCII files are read by rank 0 only.
  *
  * parameters:
+ *   m  <-- pointer to mesh
+ *   mq <-> pointer to mesh quantities
  *----------------------------------------------------------------------------*/
 
 static void
 _count_from_file(const cs_mesh_t *m,
                  const cs_mesh_quantities_t *mq) {
 
-  char line[512];
-
   cs_real_t *restrict cell_f_vol = mq->cell_f_vol;
 
+  const char *file_name = _porosity_from_scan_opt.file_name;
+
   /* Open file */
   bft_printf(_("\n\n  Compute the porosity from a scan points file:\n    %s\n\n"),
-             _porosity_from_scan_opt.file_name);
+             file_name);
 
   bft_printf(_("  Transformation       %12.5g %12.5g %12.5g %12.5g\n"
                "  matrix:              %12.5g %12.5g %12.5g %12.5g\n"
@@ -176,24 +1098,35 @@ _count_from_file(const cs_mesh_t *m,
              _porosity_from_scan_opt.transformation_matrix[2][2],
              _porosity_from_scan_opt.transformation_matrix[2][3]);
 
-  FILE* file = fopen(_porosity_from_scan_opt.file_name, "rt");
-  if (file == NULL)
-    bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Could not open file."));
+  const bool is_ply = cs_file_endswith(file_name, ".ply");
+  const bool is_las = cs_file_endswith(file_name, ".las");
 
-  int n_points = 0;
-  int n_read_points = 0;
-  cs_real_3_t min_vec_tot = { HUGE_VAL,  HUGE_VAL,  HUGE_VAL};
-  cs_real_3_t max_vec_tot = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+  /* ASCII files are read by rank 0 only */
+  FILE *file = NULL;
+  cs_gnum_t n_read_points = 0;
 
-  if (fscanf(file, "%d\n", &n_read_points) != 1)
-    bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Could not read the number of lines."));
+  if (!is_ply && !is_las) {
+    if (cs_glob_rank_id < 1) {
+      file = fopen(file_name, "rt");
+      if (file == NULL)
+        bft_error(__FILE__,__LINE__, 0,
+                  _("Porosity from scan: Could not open file."));
+    }
+    n_read_points = _read_ascii_n_points(file);
+    if (n_read_points == 0)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Could not read the number of lines."));
 
-  bft_printf(_("  Porosity from scan: %d points to be read.\n\n"), n_read_points);
+    bft_printf(_("  Porosity from scan: %llu points to be read.\n\n"),
+               (unsigned long long)n_read_points);
+  }
+
+  cs_real_3_t min_vec_tot = { HUGE_VAL,  HUGE_VAL,  HUGE_VAL};
+  cs_real_3_t max_vec_tot = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
 
   /* Pointer to field */
   cs_field_t *f_nb_scan = cs_field_by_name_try("nb_scan_points");
 
-
   /* Location mesh where points will be localized */
   fvm_nodal_t *location_mesh =
     cs_mesh_connect_cells_to_nodal(m,
@@ -204,70 +1137,35 @@ _count_from_file(const cs_mesh_t *m,
 
   fvm_nodal_make_vertices_private(location_mesh);
 
-  /* Read multiple scan file
-   * ----------------------- */
-  for (int n_scan = 0; n_read_points != 0; n_scan++) {
-    n_points = n_read_points;
-    cs_real_3_t *point_coords;
-    float *colors;
-    BFT_MALLOC(point_coords, n_points, cs_real_3_t);
-    BFT_MALLOC(colors, 3*n_points, float);
+  /* Read multiple scan file (binary files contain a single scan)
+   * ------------------------------------------------------------ */
+  for (int n_scan = 0; n_scan == 0 || n_read_points != 0; n_scan++) {
 
-    cs_real_3_t min_vec = { HUGE_VAL,  HUGE_VAL,  HUGE_VAL};
-    cs_real_3_t max_vec = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+    _scan_points_t sp = {.n_g_points = 0,
+                         .n_points = 0,
+                         .coords = NULL,
+                         .colors = NULL,
+                         .weights = NULL};
 
-    /* Read points */
-    for (int i = 0; i < n_points; i++ ) {
-      int num, green, red, blue;
-      cs_real_4_t xyz;
-      for (int j = 0; j < 3; j++)
-        point_coords[i][j] = 0.;
+    if (is_ply || is_las) {
+      _read_binary_scan(file_name, is_las, &sp);
+      bft_printf(_("  Porosity from scan: %llu points read.\n\n"),
+                 (unsigned long long)sp.n_g_points);
+    }
+    else {
+      _read_ascii_scan(file, n_read_points, &sp);
 
-      if (fscanf(file, "%lf", &(xyz[0])) != 1)
-        bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Error while reading dataset. Line %d\n"), i);
-      if (fscanf(file, "%lf", &(xyz[1])) != 1)
-        bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Error while reading dataset."));
-      if (fscanf(file, "%lf", &(xyz[2])) != 1)
-        bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Error while reading dataset."));
+      /* Check EOF was correctly reached */
+      n_read_points = _read_ascii_n_points(file);
+    }
 
-      /* Translation and rotation */
-      xyz[3] = 1.;
-      for (int j = 0; j < 3; j++) {
-        for (int k = 0; k < 4; k++)
-          point_coords[i][j] += _porosity_from_scan_opt.transformation_matrix[j][k] * xyz[k];
+    cs_real_3_t min_vec = { HUGE_VAL,  HUGE_VAL,  HUGE_VAL};
+    cs_real_3_t max_vec = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
 
-        /* Compute bounding box*/
-        min_vec[j] = CS_MIN(min_vec[j], point_coords[i][j]);
-        max_vec[j] = CS_MAX(max_vec[j], point_coords[i][j]);
-      }
+    _transform_points(&sp, min_vec, max_vec);
 
-      /* Intensities */
-      if (fscanf(file, "%d", &num) != 1)
-        bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Error while reading dataset."));
-
-      /* Red */
-      if (fscanf(file, "%d", &red) != 1)
-        bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Error while reading dataset."));
-      /* Green */
-      if (fscanf(file, "%d", &green) != 1)
-        bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Error while reading dataset."));
-      /* Blue */
-      if (fscanf(file, "%d\n", &blue) != 1)
-        bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Error while reading dataset."));
-
-      /* When colors are written as int, Paraview intreprates them in [0, 255]
-       * when they are written as float, Paraview interprates them in [0., 1.]
-       * */
-      colors[3*i + 0] = red/255.;
-      colors[3*i + 1] = green/255.;
-      colors[3*i + 2] = blue/255.;
-    }
-
-    /* Check EOF was correctly reached */
-    if (fgets(line, sizeof(line), file) != NULL)
-      n_read_points = strtol(line, NULL, 10);
-    else
-      n_read_points = 0;
+    cs_parall_min(3, CS_REAL_TYPE, min_vec);
+    cs_parall_max(3, CS_REAL_TYPE, max_vec);
 
     /* Bounding box*/
     bft_printf(_("  Bounding box [%f, %f, %f], [%f, %f, %f].\n\n"),
@@ -280,144 +1178,33 @@ _count_from_file(const cs_mesh_t *m,
       max_vec_tot[j] = CS_MAX(max_vec[j], max_vec_tot[j]);
     }
 
-
     if (n_read_points > 0)
-      bft_printf(_("  Porosity from scan: %d additional points to be read.\n\n"),
-                 n_read_points);
-
-    /* FVM meshes for writers */
-    if (_porosity_from_scan_opt.postprocess_points) {
-      char *fvm_name;
-      if (_porosity_from_scan_opt.output_name == NULL) {
-        BFT_MALLOC(fvm_name,
-                   strlen(_porosity_from_scan_opt.file_name) + 3 + 1,
-                   char);
-        strcpy(fvm_name, _porosity_from_scan_opt.file_name);
-      } else {
-        BFT_MALLOC(fvm_name,
-                   strlen(_porosity_from_scan_opt.output_name) + 3 + 1,
-                   char);
-        strcpy(fvm_name, _porosity_from_scan_opt.output_name);
-      }
-      char suffix[13];
-      sprintf(suffix, "_%02d", n_scan);
-      strcat(fvm_name, suffix);
-
-      /* Build FVM mesh from scanned points */
-      fvm_nodal_t *pts_mesh = fvm_nodal_create(fvm_name, 3);
-
-      /* Only the first rank writes points for now */
-      cs_gnum_t *vtx_gnum = NULL;
-
-      if (cs_glob_rank_id < 1) {
-        /* Update the points set structure */
-        fvm_nodal_define_vertex_list(pts_mesh, n_points, NULL);
-        fvm_nodal_set_shared_vertices(pts_mesh, (cs_coord_t *)point_coords);
-
-        BFT_MALLOC(vtx_gnum, n_points, cs_gnum_t);
-        for (cs_lnum_t i = 0; i < n_points; i++)
-          vtx_gnum[i] = i + 1;
-
-
-      }
-      fvm_nodal_init_io_num(pts_mesh, vtx_gnum, 0);
-
-      /* Free if allocated */
-      BFT_FREE(vtx_gnum);
-
-      /* Create default writer */
-      fvm_writer_t *writer = fvm_writer_init(fvm_name,
-                                             "postprocessing",
-                                             cs_post_get_default_format(),
-                                             cs_post_get_default_format_options(),
-                                             FVM_WRITER_FIXED_MESH);
-
-
-      fvm_writer_export_nodal(writer, pts_mesh);
-
-      const void *var_ptr[1] = {NULL};
-
-      var_ptr[0] = colors;
-
-      fvm_writer_export_field(writer,
-                              pts_mesh,
-                              "color",
-                              FVM_WRITER_PER_NODE,
-                              3,
-                              CS_INTERLACE,
-                              0,
-                              0,
-                              CS_FLOAT,
-                              -1,
-                              0.0,
-                              (const void * *)var_ptr);
-
-
-      /* Free and destroy */
-      fvm_writer_finalize(writer);
-      pts_mesh = fvm_nodal_destroy(pts_mesh);
+      bft_printf(_("  Porosity from scan: %llu additional points to be read."
+                   "\n\n"),
+                 (unsigned long long)n_read_points);
+
+    /* Reduce the number of points to locate */
+    if (_porosity_from_scan_opt.voxel_size > 0.) {
+      _voxel_downsample(_porosity_from_scan_opt.voxel_size, min_vec, &sp);
+
+      cs_gnum_t n_g_voxels = sp.n_points;
+      cs_parall_counter(&n_g_voxels, 1);
+      bft_printf(_("  Points merged in %llu voxels of size %g.\n\n"),
+                 (unsigned long long)n_g_voxels,
+                 _porosity_from_scan_opt.voxel_size);
     }
 
-    /* Now build locator
-     * Locate points on this location mesh */
-    /*-------------------------------------*/
-
-    int options[PLE_LOCATOR_N_OPTIONS];
-    for (int i = 0; i < PLE_LOCATOR_N_OPTIONS; i++)
-      options[i] = 0;
-    options[PLE_LOCATOR_NUMBERING] = 0; /* base 0 numbering */
-
-#if defined(PLE_HAVE_MPI)
-    _locator = ple_locator_create(cs_glob_mpi_comm,
-                                  cs_glob_n_ranks,
-                                  0);
-#else
-    _locator = ple_locator_create();
-#endif
-
-    ple_locator_set_mesh(_locator,
-                         location_mesh,
-                         options,
-                         0., /* tolerance_base */
-                         0.1, /* tolerance */
-                         3, /* dim */
-                         n_points,
-                         NULL,
-                         NULL, /* point_tag */
-                         (cs_real_t *)point_coords,
-                         NULL, /* distance */
-                         cs_coupling_mesh_extents,
-                         cs_coupling_point_in_mesh_p);
-
-    /* Shift from 1-base to 0-based locations */
-    ple_locator_shift_locations(_locator, -1);
-
-    /* dump locator */
-#if 0
-    ple_locator_dump(_locator);
-#endif
-
-    /* Get the element ids (list of points on the local rank) */
-    cs_lnum_t n_points_loc = ple_locator_get_n_dist_points(_locator);
-
-#if 0
-    bft_printf("ple_locator_get_n_dist_points = %d, n_points = %d\n",
-               n_points_loc, n_points);
-#endif
+    /* FVM meshes for writers */
+    if (_porosity_from_scan_opt.postprocess_points)
+      _postprocess_points(n_scan, &sp);
 
-    const cs_lnum_t *elt_ids = ple_locator_get_dist_locations(_locator);
-
-    for (int i = 0; i < n_points_loc; i++) {
-      if (elt_ids[i] >= 0) { /* Found */
-        /* Could be improved with a prallel reading */
-        f_nb_scan->val[elt_ids[i]] += 1./cs_glob_n_ranks;
-      }
-    }
+    /* Now locate points on the location mesh */
+    _count_points(location_mesh, &sp, f_nb_scan->val);
 
     /* Free memory */
-    _locator = ple_locator_destroy(_locator);
-    BFT_FREE(point_coords);
-    BFT_FREE(colors);
+    BFT_FREE(sp.coords);
+    BFT_FREE(sp.colors);
+    BFT_FREE(sp.weights);
 
   } /* End loop on multiple scans */
 
@@ -426,8 +1213,11 @@ _count_from_file(const cs_mesh_t *m,
       min_vec_tot[0], min_vec_tot[1], min_vec_tot[2],
       max_vec_tot[0], max_vec_tot[1], max_vec_tot[2]);
 
-  if (fclose(file) != 0)
-    bft_error(__FILE__,__LINE__, 0, _("Porosity from scan: Could not close the file."));
+  if (file != NULL) {
+    if (fclose(file) != 0)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Could not close the file."));
+  }
 
   /* Nodal mesh is not needed anymore */
   location_mesh = fvm_nodal_destroy(location_mesh);
@@ -78,6 +78,9 @@ typedef struct {
      coordinates transformation matrix,
      with last row = [0 0 0 1]) */
   cs_real_34_t transformation_matrix;
+  /*! Size of voxels in which scanned points are merged before
+     location (no merging if <= 0) */
+  cs_real_t voxel_size;
   int   nb_sources;
   cs_real_3_t *sources;
   cs_lnum_t *source_c_ids;
@@ -36,6 +36,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -256,8 +260,45 @@ typedef struct {
 
   fvm_writer_t  *writer;        /* Associated FVM writer */
 
+  bool           float32;       /* Convert double precision values to
+                                   single precision before output */
+
+  bool           async;         /* Field output handled asynchronously */
+
 } cs_post_writer_t;
 
+/* Asynchronous output operation */
+/*-------------------------------*/
+
+/* Field values are copied to an owned snapshot buffer, so that the
+   operation may be handled by a background thread while the source
+   arrays are modified; an operation with no mesh denotes a flush. */
+
+typedef struct _cs_post_async_op_t {
+
+  fvm_writer_t          *writer;              /* Associated FVM writer */
+  const fvm_nodal_t     *mesh;                /* Associated exported mesh,
+                                                 or NULL for flush */
+  char                  *name;                /* Variable name */
+
+  fvm_writer_var_loc_t   location;            /* Variable location */
+  int                    dim;                 /* Variable dimension */
+  cs_interlace_t         interlace;           /* Interlaced or not */
+  int                    n_parent_lists;      /* Number of parent lists */
+  cs_lnum_t              parent_num_shift[2]; /* Parent number shifts */
+  cs_datatype_t          datatype;            /* Snapshot data type */
+  int                    nt_cur;              /* Time step number */
+  double                 t_cur;               /* Time value */
+
+  const void            *var_ptr[2*9];        /* Pointers to snapshot */
+  unsigned char         *buffer;              /* Snapshot values */
+
+  int                    generation;          /* Output generation */
+
+  struct _cs_post_async_op_t  *next;          /* Next operation in queue */
+
+} _cs_post_async_op_t;
+
 /* Post-processing mesh structure */
 /*--------------------------------*/
 
@@ -321,6 +362,13 @@ typedef struct {
   fvm_writer_time_dep_t   mod_flag_min;  /* Minimum mesh time dependency */
   fvm_writer_time_dep_t   mod_flag_max;  /* Maximum mesh time dependency */
 
+  cs_lnum_t               n_sel_elts[3]; /* Number of cells, interior and
+                                            boundary faces selected at
+                                            last (re)definition of a
+                                            time-varying mesh, or -1 */
+  cs_lnum_t              *sel_elts[3];   /* Matching element lists (1 to n),
+                                            or NULL if all or none */
+
   int                     n_a_fields;    /* Number of additional fields
                                             (in addition to those output
                                             through "cat_id */
@@ -386,6 +434,27 @@ static const char  _cs_post_dirname[] = "postprocessing";
 
 static int  _post_out_stat_id = -1;
 
+/* Asynchronous output */
+
+static int  _cs_post_async = 0;               /* asynchronous output mode */
+static bool _cs_post_async_checked = false;   /* prerequisites checked */
+static int  _cs_post_async_generation = 0;    /* current output id */
+
+#if defined(HAVE_MPI)
+static MPI_Comm  _cs_post_async_comm = MPI_COMM_NULL;
+#endif
+
+#if defined(HAVE_PTHREAD)
+
+static pthread_mutex_t       _async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t        _async_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t             _async_thread;
+static bool                  _async_thread_created = false;
+static bool                  _async_thread_active = false;
+static _cs_post_async_op_t  *_async_queue = NULL;  /* pending operations */
+
+#endif
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -537,6 +606,440 @@ _writer_info(void)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Check if asynchronous output may be used.
+ *
+ * Prerequisites are checked once, upon the first call with asynchronous
+ * mode requested; if they are not met, a warning is printed and
+ * output remains synchronous.
+ *
+ * Asynchronous output requires POSIX threads and thread-safe memory
+ * management (based on OpenMP locks), and in parallel, MPI support for
+ * MPI_THREAD_MULTIPLE, as background output uses a duplicate of the
+ * main communicator.
+ *
+ * returns:
+ *   true if asynchronous output is enabled
+ *----------------------------------------------------------------------------*/
+
+static bool
+_cs_post_async_available(void)
+{
+  if (_cs_post_async == 0)
+    return false;
+
+  if (_cs_post_async_checked)
+    return true;
+
+  const char *reason = NULL;
+
+#if !defined(HAVE_PTHREAD) || !defined(HAVE_OPENMP)
+  reason = _("thread support (POSIX threads and OpenMP) is not available.");
+#endif
+
+#if defined(HAVE_MPI)
+  if (reason == NULL && cs_glob_n_ranks > 1) {
+    int mpi_threads = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&mpi_threads);
+    if (mpi_threads < MPI_THREAD_MULTIPLE)
+      reason = _("MPI was not initialized with MPI_THREAD_MULTIPLE\n"
+                 "    (define the CS_MPI_THREAD_MULTIPLE environment variable"
+                 " to request it).");
+  }
+#endif
+
+  if (reason != NULL) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Asynchronous postprocessing output is disabled, as\n"
+                 "  %s\n\n"), reason);
+    _cs_post_async = 0;
+    return false;
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    _cs_post_async_comm = cs_file_block_comm(1, cs_glob_mpi_comm);
+#endif
+
+  bft_mem_set_thread_safe(1);
+
+  _cs_post_async_checked = true;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Copy variable values to a snapshot buffer.
+ *
+ * Value pointers are organized as for fvm_writer_export_field(): for each
+ * list of values, one pointer if values are interlaced, or one per
+ * component otherwise. Null pointers are ignored.
+ *
+ * parameters:
+ *   var_dim   <-- variable dimension
+ *   interlace <-- indicates if variable in memory is interlaced
+ *   n_lists   <-- number of value lists (1 or 2)
+ *   n_vals    <-- number of elements associated with each list
+ *   datatype  <-- variable data type
+ *   var_ptr   <-- pointers to values
+ *   var_ptr_c --> pointers to copied values
+ *
+ * returns:
+ *   snapshot buffer, to be freed by the caller
+ *----------------------------------------------------------------------------*/
+
+static unsigned char *
+_cs_post_copy_values(int               var_dim,
+                     cs_interlace_t    interlace,
+                     int               n_lists,
+                     const cs_lnum_t   n_vals[],
+                     cs_datatype_t     datatype,
+                     const void *const var_ptr[],
+                     const void       *var_ptr_c[])
+{
+  unsigned char  *buffer = NULL;
+
+  const int n_ptr = (interlace == CS_INTERLACE) ? 1 : var_dim;
+  const int stride = (interlace == CS_INTERLACE) ? var_dim : 1;
+  const size_t elt_size = cs_datatype_size[datatype];
+
+  size_t n_tot = 0;
+  for (int l_id = 0; l_id < n_lists; l_id++)
+    n_tot += n_vals[l_id] * var_dim;
+
+  BFT_MALLOC(buffer, CS_MAX(n_tot*elt_size, 1), unsigned char);
+
+  size_t shift = 0;
+
+  for (int l_id = 0; l_id < n_lists; l_id++) {
+    for (int p_id = 0; p_id < n_ptr; p_id++) {
+      int k = (interlace == CS_INTERLACE) ? l_id : l_id*var_dim + p_id;
+      var_ptr_c[k] = NULL;
+      if (var_ptr[k] == NULL)
+        continue;
+      const size_t n = n_vals[l_id] * stride * elt_size;
+      memcpy(buffer + shift, var_ptr[k], n);
+      var_ptr_c[k] = buffer + shift;
+      shift += n;
+    }
+  }
+
+  return buffer;
+}
+
+/*----------------------------------------------------------------------------
+ * Handle an asynchronous output operation.
+ *
+ * parameters:
+ *   op <-- pointer to asynchronous operation
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_post_async_op_run(const _cs_post_async_op_t  *op)
+{
+  if (op->mesh != NULL)
+    fvm_writer_export_field(op->writer,
+                            op->mesh,
+                            op->name,
+                            op->location,
+                            op->dim,
+                            op->interlace,
+                            op->n_parent_lists,
+                            op->parent_num_shift,
+                            op->datatype,
+                            op->nt_cur,
+                            op->t_cur,
+                            op->var_ptr);
+  else
+    fvm_writer_flush(op->writer);
+}
+
+/*----------------------------------------------------------------------------
+ * Free an asynchronous output operation.
+ *
+ * parameters:
+ *   op <-> pointer to asynchronous operation pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_post_async_op_free(_cs_post_async_op_t  **op)
+{
+  _cs_post_async_op_t *_op = *op;
+
+  BFT_FREE(_op->name);
+  BFT_FREE(_op->buffer);
+  BFT_FREE(*op);
+}
+
+#if defined(HAVE_PTHREAD)
+
+/*----------------------------------------------------------------------------
+ * Main function of the background output thread.
+ *
+ * Operations are handled in queue order; an operation remains in the
+ * queue until it has been handled, so that waits may be based on the
+ * queue contents.
+ *
+ * parameters:
+ *   arg <-- unused
+ *
+ * returns:
+ *   NULL
+ *----------------------------------------------------------------------------*/
+
+static void *
+_cs_post_async_thread_main(void  *arg)
+{
+  CS_UNUSED(arg);
+
+  pthread_mutex_lock(&_async_mutex);
+
+  while (_async_queue != NULL) {
+
+    _cs_post_async_op_t *op = _async_queue;
+
+    pthread_mutex_unlock(&_async_mutex);
+
+    _cs_post_async_op_run(op);
+
+    pthread_mutex_lock(&_async_mutex);
+
+    _async_queue = op->next;
+    _cs_post_async_op_free(&op);
+
+    pthread_cond_broadcast(&_async_cond);
+
+  }
+
+  _async_thread_active = false;
+  pthread_cond_broadcast(&_async_cond);
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  return NULL;
+}
+
+#endif /* defined(HAVE_PTHREAD) */
+
+/*----------------------------------------------------------------------------
+ * Submit an output operation for asynchronous handling.
+ *
+ * With thread support, the operation is handled by a background thread;
+ * otherwise, it is handled immediately.
+ *
+ * parameters:
+ *   op <-> pointer to asynchronous operation
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_post_async_submit(_cs_post_async_op_t  *op)
+{
+  op->generation = _cs_post_async_generation;
+  op->next = NULL;
+
+#if defined(HAVE_PTHREAD)
+
+  pthread_mutex_lock(&_async_mutex);
+
+  if (_async_queue == NULL)
+    _async_queue = op;
+  else {
+    _cs_post_async_op_t *op_last = _async_queue;
+    while (op_last->next != NULL)
+      op_last = op_last->next;
+    op_last->next = op;
+  }
+
+  /* (Re)start background thread if needed; a previous thread which
+     found an empty queue has exited or is about to, so join it first */
+
+  if (_async_thread_active == false) {
+    if (_async_thread_created)
+      pthread_join(_async_thread, NULL);
+    _async_thread_active = true;
+    _async_thread_created = true;
+    int retval = pthread_create(&_async_thread,
+                                NULL,
+                                _cs_post_async_thread_main,
+                                NULL);
+    if (retval != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error creating postprocessing output thread:\n\n  %s"),
+                strerror(retval));
+  }
+
+  pthread_mutex_unlock(&_async_mutex);
+
+#else
+
+  _cs_post_async_op_run(op);
+  _cs_post_async_op_free(&op);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of asynchronous output operations.
+ *
+ * This must be called before any synchronous operation on a writer
+ * using asynchronous output, or on a mesh or values referenced by
+ * pending operations.
+ *
+ * parameters:
+ *   generation <-- if >= 0, only wait for operations of this output
+ *                  generation or older ones
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_post_async_wait(int  generation)
+{
+#if defined(HAVE_PTHREAD)
+
+  pthread_mutex_lock(&_async_mutex);
+
+  bool pending = true;
+
+  while (pending) {
+    pending = false;
+    for (_cs_post_async_op_t *op = _async_queue; op != NULL; op = op->next) {
+      if (generation < 0 || op->generation <= generation) {
+        pending = true;
+        break;
+      }
+    }
+    if (pending)
+      pthread_cond_wait(&_async_cond, &_async_mutex);
+  }
+
+  pthread_mutex_unlock(&_async_mutex);
+
+#else
+
+  CS_UNUSED(generation);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Output field values using a given writer.
+ *
+ * Arguments are those of fvm_writer_export_field(), along with the
+ * number of value lists and their sizes. For writers using asynchronous
+ * output, values are copied to a snapshot buffer and output is handled
+ * by a background thread.
+ *
+ * parameters:
+ *   writer           <-- pointer to writer structure
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- number of parent lists (0 if no indirection)
+ *   parent_num_shift <-- parent number to value array index shifts
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   n_lists          <-- number of value lists (1 or 2)
+ *   n_vals           <-- number of elements associated with each list
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_post_export_field(cs_post_writer_t        *writer,
+                      const fvm_nodal_t       *mesh,
+                      const char              *name,
+                      fvm_writer_var_loc_t     location,
+                      int                      dimension,
+                      cs_interlace_t           interlace,
+                      int                      n_parent_lists,
+                      const cs_lnum_t          parent_num_shift[],
+                      cs_datatype_t            datatype,
+                      int                      time_step,
+                      double                   time_value,
+                      int                      n_lists,
+                      const cs_lnum_t          n_vals[],
+                      const void        *const field_values[])
+{
+  if (writer->async == false) {
+    fvm_writer_export_field(writer->writer,
+                            mesh,
+                            name,
+                            location,
+                            dimension,
+                            interlace,
+                            n_parent_lists,
+                            parent_num_shift,
+                            datatype,
+                            time_step,
+                            time_value,
+                            field_values);
+    return;
+  }
+
+  _cs_post_async_op_t *op;
+  BFT_MALLOC(op, 1, _cs_post_async_op_t);
+
+  op->writer = writer->writer;
+  op->mesh = mesh;
+  BFT_MALLOC(op->name, strlen(name) + 1, char);
+  strcpy(op->name, name);
+
+  op->location = location;
+  op->dim = dimension;
+  op->interlace = interlace;
+  op->n_parent_lists = n_parent_lists;
+  op->parent_num_shift[0] = 0;
+  op->parent_num_shift[1] = 0;
+  for (int i = 0; i < n_parent_lists; i++)
+    op->parent_num_shift[i] = parent_num_shift[i];
+  op->datatype = datatype;
+  op->nt_cur = time_step;
+  op->t_cur = time_value;
+
+  for (int i = 0; i < 2*9; i++)
+    op->var_ptr[i] = NULL;
+
+  op->buffer = _cs_post_copy_values(dimension,
+                                    interlace,
+                                    n_lists,
+                                    n_vals,
+                                    datatype,
+                                    field_values,
+                                    op->var_ptr);
+
+  _cs_post_async_submit(op);
+}
+
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * For writers using asynchronous output, the flush is handled
+ * by the background thread, after pending output operations.
+ *
+ * parameters:
+ *   writer <-- pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_post_flush_writer(cs_post_writer_t  *writer)
+{
+  if (writer->async == false) {
+    fvm_writer_flush(writer->writer);
+    return;
+  }
+
+  _cs_post_async_op_t *op;
+  BFT_MALLOC(op, 1, _cs_post_async_op_t);
+
+  op->writer = writer->writer;
+  op->mesh = NULL;
+  op->name = NULL;
+  op->buffer = NULL;
+
+  _cs_post_async_submit(op);
+}
+
 /*----------------------------------------------------------------------------
  * Initialize a writer; this creates the FVM writer structure, and
  * clears the temporary writer definition information.
@@ -561,11 +1064,32 @@ _init_writer(cs_post_writer_t  *writer)
                 _(" Invalid format name for writer (case: %s, dirname: %s)."),
                 wd->case_name, wd->dir_name);
 
-    writer->writer = fvm_writer_init(wd->case_name,
-                                     wd->dir_name,
-                                     fvm_writer_format_name(wd->fmt_id),
-                                     wd->fmt_opts,
-                                     wd->time_dep);
+    const char *fmt_name = fvm_writer_format_name(wd->fmt_id);
+
+    writer->async = false;
+    if (_cs_post_async_available()) {
+      if (   strcmp(fmt_name, "EnSight Gold") == 0
+          || strcmp(fmt_name, "MED") == 0
+          || strcmp(fmt_name, "CGNS") == 0
+          || strcmp(fmt_name, "Melissa") == 0)
+        writer->async = true;
+    }
+
+#if defined(HAVE_MPI)
+    if (writer->async && _cs_post_async_comm != MPI_COMM_NULL)
+      writer->writer = fvm_writer_init_comm(wd->case_name,
+                                            wd->dir_name,
+                                            fmt_name,
+                                            wd->fmt_opts,
+                                            wd->time_dep,
+                                            _cs_post_async_comm);
+    else
+#endif
+      writer->writer = fvm_writer_init(wd->case_name,
+                                       wd->dir_name,
+                                       fmt_name,
+                                       wd->fmt_opts,
+                                       wd->time_dep);
     _destroy_writer_def(writer);
 
   }
@@ -848,6 +1372,66 @@ _cs_post_cnv_datatype(cs_post_type_t  type_cs)
   return type_fvm;
 }
 
+/*----------------------------------------------------------------------------
+ * Convert double precision variable values to single precision for output.
+ *
+ * Value pointers are organized as for fvm_writer_export_field(): for each
+ * list of values, one pointer if values are interlaced, or one per
+ * component otherwise. Null pointers are ignored.
+ *
+ * parameters:
+ *   var_dim   <-- variable dimension
+ *   interlace <-- indicates if variable in memory is interlaced
+ *   n_lists   <-- number of value lists (1 or 2)
+ *   n_vals    <-- number of elements associated with each list
+ *   var_ptr   <-- pointers to double precision values
+ *   var_ptr_f --> pointers to single precision values
+ *
+ * returns:
+ *   single precision values array, to be freed by the caller
+ *----------------------------------------------------------------------------*/
+
+static float *
+_cs_post_convert_float32(int               var_dim,
+                         cs_interlace_t    interlace,
+                         int               n_lists,
+                         const cs_lnum_t   n_vals[],
+                         const void       *var_ptr[],
+                         const void       *var_ptr_f[])
+{
+  float  *var_f = NULL;
+
+  const int n_ptr = (interlace == CS_INTERLACE) ? 1 : var_dim;
+  const int stride = (interlace == CS_INTERLACE) ? var_dim : 1;
+
+  cs_lnum_t n_tot = 0;
+  for (int l_id = 0; l_id < n_lists; l_id++)
+    n_tot += n_vals[l_id] * var_dim;
+
+  BFT_MALLOC(var_f, n_tot, float);
+
+  cs_lnum_t shift = 0;
+
+  for (int l_id = 0; l_id < n_lists; l_id++) {
+    for (int p_id = 0; p_id < n_ptr; p_id++) {
+      int k = (interlace == CS_INTERLACE) ? l_id : l_id*var_dim + p_id;
+      var_ptr_f[k] = NULL;
+      if (var_ptr[k] == NULL)
+        continue;
+      const double *src = (const double *)var_ptr[k];
+      float *dest = var_f + shift;
+      const cs_lnum_t n = n_vals[l_id] * stride;
+#     pragma omp parallel for if (n > CS_THR_MIN)
+      for (cs_lnum_t j = 0; j < n; j++)
+        dest[j] = src[j];
+      var_ptr_f[k] = dest;
+      shift += n;
+    }
+  }
+
+  return var_f;
+}
+
 /*----------------------------------------------------------------------------
  * Search for position in the array of writers of a writer with a given id.
  *
@@ -1010,6 +1594,22 @@ _lagrangian_needed(const cs_time_step_t  *ts)
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Free element selection lists kept for a time-varying post-processing mesh.
+ *
+ * parameters:
+ *   post_mesh <-> pointer to post-processing mesh
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_selection_cache(cs_post_mesh_t  *post_mesh)
+{
+  for (int i = 0; i < 3; i++) {
+    post_mesh->n_sel_elts[i] = -1;
+    BFT_FREE(post_mesh->sel_elts[i]);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Update mesh attributes related to writer association.
  *
@@ -1137,6 +1737,7 @@ _predefine_mesh(int        mesh_id,
       post_mesh->exp_mesh = NULL;
       if (post_mesh->_exp_mesh != NULL)
         post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+      _free_selection_cache(post_mesh);
 
       break;
 
@@ -1198,6 +1799,11 @@ _predefine_mesh(int        mesh_id,
   post_mesh->exp_mesh = NULL;
   post_mesh->_exp_mesh = NULL;
 
+  for (j = 0; j < 3; j++) {
+    post_mesh->n_sel_elts[j] = -1;
+    post_mesh->sel_elts[j] = NULL;
+  }
+
   /* Minimum and maximum time dependency flags initially inverted,
      will be recalculated after mesh - writer associations */
 
@@ -1245,8 +1851,11 @@ _free_mesh(int _mesh_id)
   int i;
   cs_post_mesh_t  *post_mesh = _cs_post_meshes + _mesh_id;
 
+  _cs_post_async_wait(-1);
+
   if (post_mesh->_exp_mesh != NULL)
     post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+  _free_selection_cache(post_mesh);
 
   BFT_FREE(post_mesh->writer_id);
   post_mesh->n_writers = 0;
@@ -1566,22 +2175,54 @@ _define_particle_export_mesh(cs_post_mesh_t        *post_mesh,
 }
 
 /*----------------------------------------------------------------------------
- * Initialize a volume or surface post-processing mesh based on its
- * selection criteria or selection functions.
+ * Check if the element selection of a time-varying post-processing mesh
+ * may be kept so as to rebuild the exportable mesh only when it changes.
+ *
+ * This is not the case when the mesh connectivity itself may change
+ * (see cs_post_set_changing_connectivity), as identical element lists
+ * would not imply an identical exportable mesh.
  *
  * parameters:
- *   post_mesh <-> pointer to partially initialized post-processing mesh
- *   ts        <-- time step structure
+ *   post_mesh <-- pointer to post-processing mesh
+ *
+ * returns:
+ *   true if the element selection may be kept, false otherwise
  *----------------------------------------------------------------------------*/
 
-static void
-_define_regular_mesh(cs_post_mesh_t  *post_mesh)
+static bool
+_selection_is_cacheable(const cs_post_mesh_t  *post_mesh)
 {
-  const cs_mesh_t *mesh = cs_glob_mesh;
+  bool retval = false;
 
-  assert(post_mesh != NULL);
+  if (   _cs_post_mod_flag_min != FVM_WRITER_TRANSIENT_CONNECT
+      && post_mesh->mod_flag_min == FVM_WRITER_TRANSIENT_CONNECT
+      && post_mesh->edges_ref < 0
+      && post_mesh->ent_flag[3] == 0
+      && post_mesh->ent_flag[4] == 0)
+    retval = true;
 
-  assert(post_mesh->exp_mesh == NULL);
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Select cells, interior and boundary faces of a regular post-processing
+ * mesh based on its selection criteria or selection functions.
+ *
+ * Lists are allocated here, and should be freed by the caller; they
+ * remain NULL when all or no elements of a given type are selected.
+ *
+ * parameters:
+ *   post_mesh <-- pointer to partially initialized post-processing mesh
+ *   n_elts    --> number of selected cells, interior and boundary faces
+ *   elt_list  --> matching element lists (1 to n), or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_select_regular_elts(const cs_post_mesh_t  *post_mesh,
+                     cs_lnum_t              n_elts[3],
+                     cs_lnum_t             *elt_list[3])
+{
+  const cs_mesh_t *mesh = cs_glob_mesh;
 
   cs_lnum_t i;
   cs_lnum_t n_cells = 0, n_i_faces = 0, n_b_faces = 0;
@@ -1637,19 +2278,132 @@ _define_regular_mesh(cs_post_mesh_t  *post_mesh)
       b_face_list[i] += 1;
   }
 
+  n_elts[0] = n_cells;
+  n_elts[1] = n_i_faces;
+  n_elts[2] = n_b_faces;
+
+  elt_list[0] = cell_list;
+  elt_list[1] = i_face_list;
+  elt_list[2] = b_face_list;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare an element selection with the one kept from the previous
+ * definition of a post-processing mesh.
+ *
+ * The result is the same on all ranks.
+ *
+ * parameters:
+ *   post_mesh <-- pointer to post-processing mesh
+ *   n_elts    <-- number of selected cells, interior and boundary faces
+ *   elt_list  <-- matching element lists (1 to n), or NULL
+ *
+ * returns:
+ *   true if the selection is unchanged, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_selection_is_unchanged(const cs_post_mesh_t  *post_mesh,
+                        const cs_lnum_t        n_elts[3],
+                        cs_lnum_t       *const elt_list[3])
+{
+  int changed = 0;
+
+  for (int i = 0; i < 3 && changed == 0; i++) {
+
+    const cs_lnum_t *prev_list = post_mesh->sel_elts[i];
+
+    if (post_mesh->n_sel_elts[i] != n_elts[i])
+      changed = 1;
+
+    else if (n_elts[i] > 0) {
+      if (prev_list == NULL || elt_list[i] == NULL) {
+        if (prev_list != elt_list[i])
+          changed = 1;
+      }
+      else if (memcmp(prev_list,
+                      elt_list[i],
+                      n_elts[i]*sizeof(cs_lnum_t)) != 0)
+        changed = 1;
+    }
+
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    int _changed = changed;
+    MPI_Allreduce(&_changed, &changed, 1, MPI_INT, MPI_MAX,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  return (changed == 0) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a regular post-processing mesh from a given element selection.
+ *
+ * Element lists are either kept by the post-processing mesh (for
+ * time-varying meshes whose selection may be compared over time steps)
+ * or freed here.
+ *
+ * parameters:
+ *   post_mesh <-> pointer to partially initialized post-processing mesh
+ *   n_elts    <-- number of selected cells, interior and boundary faces
+ *   elt_list  <-> matching element lists (1 to n), or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_selected_mesh(cs_post_mesh_t  *post_mesh,
+                      cs_lnum_t        n_elts[3],
+                      cs_lnum_t       *elt_list[3])
+{
   /* Define mesh based on current arguments */
 
   _define_export_mesh(post_mesh,
-                      n_cells,
-                      n_i_faces,
-                      n_b_faces,
-                      cell_list,
-                      i_face_list,
-                      b_face_list);
+                      n_elts[0],
+                      n_elts[1],
+                      n_elts[2],
+                      elt_list[0],
+                      elt_list[1],
+                      elt_list[2]);
+
+  _free_selection_cache(post_mesh);
+
+  if (_selection_is_cacheable(post_mesh)) {
+    for (int i = 0; i < 3; i++) {
+      post_mesh->n_sel_elts[i] = n_elts[i];
+      post_mesh->sel_elts[i] = elt_list[i];
+    }
+  }
+  else {
+    for (int i = 0; i < 3; i++)
+      BFT_FREE(elt_list[i]);
+  }
+}
 
-  BFT_FREE(cell_list);
-  BFT_FREE(i_face_list);
-  BFT_FREE(b_face_list);
+/*----------------------------------------------------------------------------
+ * Initialize a volume or surface post-processing mesh based on its
+ * selection criteria or selection functions.
+ *
+ * parameters:
+ *   post_mesh <-> pointer to partially initialized post-processing mesh
+ *   ts        <-- time step structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_regular_mesh(cs_post_mesh_t  *post_mesh)
+{
+  assert(post_mesh != NULL);
+
+  assert(post_mesh->exp_mesh == NULL);
+
+  cs_lnum_t n_elts[3];
+  cs_lnum_t *elt_list[3];
+
+  _select_regular_elts(post_mesh, n_elts, elt_list);
+
+  _define_selected_mesh(post_mesh, n_elts, elt_list);
 }
 
 /*----------------------------------------------------------------------------
@@ -1836,8 +2590,36 @@ _redefine_mesh(cs_post_mesh_t        *post_mesh,
   if (post_mesh->exp_mesh != NULL) {
     if (post_mesh->_exp_mesh == NULL)
       return;
-    else
+
+    /* When only the selection may vary, keep the current mesh (with its
+       global numbering and tesselation) if the selection is unchanged */
+
+    else if (_selection_is_cacheable(post_mesh)) {
+
+      cs_lnum_t n_elts[3];
+      cs_lnum_t *elt_list[3];
+
+      _select_regular_elts(post_mesh, n_elts, elt_list);
+
+      if (_selection_is_unchanged(post_mesh, n_elts, elt_list)) {
+        for (int i = 0; i < 3; i++)
+          BFT_FREE(elt_list[i]);
+        return;
+      }
+
+      _cs_post_async_wait(-1);
+      post_mesh->exp_mesh = NULL;
       post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+
+      _define_selected_mesh(post_mesh, n_elts, elt_list);
+      return;
+
+    }
+
+    else {
+      _cs_post_async_wait(-1);
+      post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+    }
   }
   post_mesh->exp_mesh = NULL;
 
@@ -2180,6 +2962,8 @@ _cs_post_write_mesh(cs_post_mesh_t        *post_mesh,
 
     if (write_mesh == true) {
 
+      _cs_post_async_wait(-1);
+
       if (writer->writer == NULL)
         _init_writer(writer);
 
@@ -3065,6 +3849,11 @@ _cs_post_output_fields(cs_post_mesh_t        *post_mesh,
       if (_cs_post_match_post_write_var(post_mesh, field_loc_type) == false)
         continue;
 
+      /* Values on a subset of a main location do not map to parent ids */
+
+      if (f->location_id != (int)field_loc_type)
+        continue;
+
       if (! (cs_field_get_key_int(f, vis_key_id) & CS_POST_ON_LOCATION))
         continue;
 
@@ -3151,6 +3940,9 @@ _cs_post_output_fields(cs_post_mesh_t        *post_mesh,
       const cs_mesh_location_type_t field_loc_type
         = cs_mesh_location_get_type(f->location_id);
 
+      if (f->location_id != (int)field_loc_type)
+        continue;
+
       if (pset_on_boundary) {
         if (   field_loc_type != CS_MESH_LOCATION_CELLS
             && field_loc_type != CS_MESH_LOCATION_BOUNDARY_FACES
@@ -3728,6 +4520,7 @@ _check_non_transient(const cs_post_writer_t  *writer,
  * - \c \b CGNS
  * - \c \b CCM (only for the full volume and boundary meshes)
  * - \c \b Catalyst (in-situ visualization)
+ * - \c \b ADIOS2 (BP files, or staging for in-transit processing)
  * - \c \b MEDCoupling (in-memory structure, to be used from other code)
  * - \c \b plot (comma or whitespace separated 2d plot files)
  * - \c \b time_plot (comma or whitespace separated time plot files)
@@ -3759,6 +4552,9 @@ _check_non_transient(const cs_post_writer_t  *writer,
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b bp4, \c \b bp5 (default) or \c \b sst to select the
+ *         \em ADIOS2 engine (\c \b sst allowing a concurrently running
+ *         reader to consume data in-transit).
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
@@ -3884,6 +4680,9 @@ cs_post_define_writer(int                     writer_id,
   }
   w->ot = NULL;
 
+  w->float32 = false;
+  w->async = false;
+
   wd->time_dep = time_dep;
 
   BFT_MALLOC(wd->case_name, strlen(case_name) + 1, char);
@@ -3924,6 +4723,105 @@ cs_post_define_writer(int                     writer_id,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define on-rank data reduction options for a given writer.
+ *
+ * These options act as a reduction stage between variable output
+ * functions such as \ref cs_post_write_var and the associated FVM writer:
+ *
+ * - if \c float32 is true, double precision values are converted to
+ *   single precision on each rank before being passed to the writer,
+ *   halving the amount of data redistributed and written for formats
+ *   which do not already do this;
+ * - if \c rank_step > 1, output data is aggregated on one rank out of
+ *   \c rank_step for writing, using the \c rank_step format option
+ *   (currently handled by the \c EnSight format).
+ *
+ * Spatial reduction (decimation or thresholding of output elements) is
+ * obtained by defining post-processing meshes based on a selection
+ * function, such as \ref cs_cell_subset_select.
+ *
+ * The aggregation rank step must be defined before the writer's first
+ * use, so this function should be called just after the matching
+ * \ref cs_post_define_writer call.
+ *
+ * \param[in]  writer_id  id of associated writer
+ * \param[in]  float32    convert double precision values to single
+ *                        precision if true
+ * \param[in]  rank_step  MPI rank step between output ranks, or 1
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_writer_set_reduction(int   writer_id,
+                             bool  float32,
+                             int   rank_step)
+{
+  cs_post_writer_t  *w = _cs_post_writers + _cs_post_writer_id(writer_id);
+
+  w->float32 = float32;
+
+  if (rank_step > 1) {
+
+    cs_post_writer_def_t  *wd = w->wd;
+
+    if (wd == NULL)
+      bft_error(__FILE__, __LINE__, 0,
+                _("The output rank step of post-processing writer %d\n"
+                  "may not be modified after its first use."), writer_id);
+
+    char rs_opt[32];
+    snprintf(rs_opt, 31, "rank_step=%d", rank_step);
+    rs_opt[31] = '\0';
+
+    size_t l = strlen(wd->fmt_opts);
+    BFT_REALLOC(wd->fmt_opts, l + strlen(rs_opt) + 2, char);
+    if (l > 0)
+      wd->fmt_opts[l++] = ' ';
+    strcpy(wd->fmt_opts + l, rs_opt);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define whether postprocessing output is asynchronous.
+ *
+ * In asynchronous mode, values output through writers using the
+ * \c EnSight, \c MED, \c CGNS or \c Melissa formats are copied to
+ * snapshot buffers,
+ * and actual output is handled by a background thread, using a duplicate
+ * of the main MPI communicator (obtained through \ref cs_file_block_comm),
+ * so that output overlaps with the computation. Snapshots of at most
+ * two consecutive outputs are kept in memory: output of a given time step
+ * is guaranteed to be complete when the time step following the next
+ * one is output. Mesh output remains synchronous, and waits for completion
+ * of pending output.
+ *
+ * This requires thread support and, in parallel, that MPI is initialized
+ * with \c MPI_THREAD_MULTIPLE (which is requested when the
+ * \c CS_MPI_THREAD_MULTIPLE environment variable is defined); otherwise,
+ * a warning is printed and output remains synchronous. Output rank
+ * aggregation (see \ref cs_post_writer_set_reduction) is not used by
+ * asynchronous writers.
+ *
+ * This setting only applies to writers initialized after it is defined,
+ * so it should be called before the first output.
+ *
+ * \param[in]  mode  if 0, output is synchronous (default)
+ *                   if 1, output is asynchronous when possible
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_set_async_mode(int  mode)
+{
+  _cs_post_async = mode;
+  if (mode == 0)
+    _cs_post_async_wait(-1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define a volume post-processing mesh.
@@ -3979,7 +4877,10 @@ cs_post_define_volume_mesh(int          mesh_id,
  *
  * The selection may be updated over time steps if both the time_varying
  * flag is set to true and the mesh is only associated with writers defined
- * with the FVM_WRITER_TRANSIENT_CONNECT option.
+ * with the FVM_WRITER_TRANSIENT_CONNECT option. Unless
+ * cs_post_set_changing_connectivity has been called, the exportable mesh
+ * (with its global numbering and tesselation) is then rebuilt only when
+ * the selection actually changes.
  *
  * Note: if the cell_select_input pointer is non-NULL, it must point
  * to valid data when the selection function is called, so either:
@@ -4103,7 +5004,10 @@ cs_post_define_surface_mesh(int          mesh_id,
  *
  * The selection may be updated over time steps if both the time_varying
  * flag is set to true and the mesh is only associated with writers defined
- * with the FVM_WRITER_TRANSIENT_CONNECT option.
+ * with the FVM_WRITER_TRANSIENT_CONNECT option. Unless
+ * cs_post_set_changing_connectivity has been called, the exportable mesh
+ * (with its global numbering and tesselation) is then rebuilt only when
+ * the selection actually changes.
  *
  * Note: if i_face_select_input or b_face_select_input pointer is non-NULL,
  * it must point to valid data when the selection function is called,
@@ -5328,6 +6232,12 @@ cs_post_get_writer(int  writer_id)
   if (writer->writer == NULL)
     _init_writer(writer);
 
+  /* The caller may use the writer directly, so pending
+     asynchronous output must be complete */
+
+  if (writer->async)
+    _cs_post_async_wait(-1);
+
   return writer->writer;
 }
 
@@ -5434,6 +6344,7 @@ cs_post_write_meshes(const cs_time_step_t  *ts)
   cs_post_mesh_t  *post_mesh;
 
   int t_top_id = cs_timer_stats_switch(_post_out_stat_id);
+  bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_POST);
 
   /* First loop on meshes, for probes and profiles (which must not be
      "reduced" afer first output, as coordinates may be required for
@@ -5458,6 +6369,7 @@ cs_post_write_meshes(const cs_time_step_t  *ts)
       fvm_nodal_reduce(post_mesh->_exp_mesh, 0);
   }
 
+  bft_mem_tag_end(mem_tag);
   cs_timer_stats_switch(t_top_id);
 }
 
@@ -5506,7 +6418,9 @@ cs_post_write_var(int                    mesh_id,
   size_t       dec_ptr = 0;
   int          n_parent_lists = 0;
   cs_lnum_t    parent_num_shift[2]  = {0, 0};
+  cs_lnum_t    n_list_vals[2] = {0, 0};
   cs_real_t   *var_tmp = NULL;
+  float       *var_f = NULL;
   cs_post_mesh_t  *post_mesh = NULL;
   cs_post_writer_t    *writer = NULL;
 
@@ -5516,6 +6430,12 @@ cs_post_write_var(int                    mesh_id,
                                NULL, NULL, NULL,
                                NULL, NULL, NULL,
                                NULL, NULL, NULL};
+  const void  *var_ptr_f[2*9] = {NULL, NULL, NULL,
+                                 NULL, NULL, NULL,
+                                 NULL, NULL, NULL,
+                                 NULL, NULL, NULL,
+                                 NULL, NULL, NULL,
+                                 NULL, NULL, NULL};
 
   int nt_cur = (ts != NULL) ? ts->nt_cur : -1;
   double t_cur = (ts != NULL) ? ts->t_cur : 0.;
@@ -5550,6 +6470,11 @@ cs_post_write_var(int                    mesh_id,
     else
       n_parent_lists = 0;
 
+    if (use_parent)
+      n_list_vals[0] = cs_glob_mesh->n_cells;
+    else
+      n_list_vals[0] = fvm_nodal_get_n_entities(post_mesh->exp_mesh, 3);
+
     var_ptr[0] = cel_vals;
     if (interlace == false) {
       if (use_parent)
@@ -5576,6 +6501,9 @@ cs_post_write_var(int                    mesh_id,
       parent_num_shift[0] = 0;
       parent_num_shift[1] = cs_glob_mesh->n_b_faces;
 
+      n_list_vals[0] = cs_glob_mesh->n_b_faces;
+      n_list_vals[1] = cs_glob_mesh->n_i_faces;
+
       if (post_mesh->ent_flag[CS_POST_LOCATION_B_FACE] == 1) {
         if (interlace == false) {
           dec_ptr = cs_glob_mesh->n_b_faces * cs_datatype_size[datatype];
@@ -5629,6 +6557,8 @@ cs_post_write_var(int                    mesh_id,
 
           _interlace = CS_NO_INTERLACE;
 
+          n_list_vals[0] = post_mesh->n_i_faces + post_mesh->n_b_faces;
+
           dec_ptr = cs_datatype_size[datatype] * (  post_mesh->n_i_faces
                                                   + post_mesh->n_b_faces);
 
@@ -5641,6 +6571,8 @@ cs_post_write_var(int                    mesh_id,
 
         else {
 
+          n_list_vals[0] = post_mesh->n_b_faces;
+
           if (interlace == false) {
             dec_ptr = cs_datatype_size[datatype] * post_mesh->n_b_faces;
             for (i = 0; i < var_dim; i++)
@@ -5656,6 +6588,8 @@ cs_post_write_var(int                    mesh_id,
 
       else if (post_mesh->ent_flag[CS_POST_LOCATION_I_FACE] == 1) {
 
+        n_list_vals[0] = post_mesh->n_i_faces;
+
         if (interlace == false) {
           dec_ptr = cs_datatype_size[datatype] * post_mesh->n_i_faces;
           for (i = 0; i < var_dim; i++)
@@ -5683,18 +6617,32 @@ cs_post_write_var(int                    mesh_id,
 
       _check_non_transient(writer, &nt_cur, &t_cur);
 
-      fvm_writer_export_field(writer->writer,
-                              post_mesh->exp_mesh,
-                              var_name,
-                              FVM_WRITER_PER_ELEMENT,
-                              var_dim,
-                              _interlace,
-                              n_parent_lists,
-                              parent_num_shift,
-                              datatype,
-                              nt_cur,
-                              t_cur,
-                              (const void * *)var_ptr);
+      /* Optional reduction to single precision (converted once) */
+
+      if (writer->float32 && datatype == CS_DOUBLE && var_f == NULL)
+        var_f = _cs_post_convert_float32(var_dim,
+                                         _interlace,
+                                         CS_MAX(n_parent_lists, 1),
+                                         n_list_vals,
+                                         var_ptr,
+                                         var_ptr_f);
+
+      bool use_f = (writer->float32 && var_f != NULL);
+
+      _cs_post_export_field(writer,
+                            post_mesh->exp_mesh,
+                            var_name,
+                            FVM_WRITER_PER_ELEMENT,
+                            var_dim,
+                            _interlace,
+                            n_parent_lists,
+                            parent_num_shift,
+                            (use_f) ? CS_FLOAT : datatype,
+                            nt_cur,
+                            t_cur,
+                            CS_MAX(n_parent_lists, 1),
+                            n_list_vals,
+                            (use_f) ? var_ptr_f : var_ptr);
 
       if (nt_cur >= 0) {
         writer->tc.last_nt = nt_cur;
@@ -5709,6 +6657,8 @@ cs_post_write_var(int                    mesh_id,
 
   if (var_tmp != NULL)
     BFT_FREE(var_tmp);
+
+  BFT_FREE(var_f);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -5754,10 +6704,15 @@ cs_post_write_vertex_var(int                    mesh_id,
   size_t       dec_ptr = 0;
   int          n_parent_lists = 0;
   cs_lnum_t    parent_num_shift[1]  = {0};
+  cs_lnum_t    n_list_vals[1] = {0};
+  float       *var_f = NULL;
 
   const void  *var_ptr[9] = {NULL, NULL, NULL,
                              NULL, NULL, NULL,
                              NULL, NULL, NULL};
+  const void  *var_ptr_f[9] = {NULL, NULL, NULL,
+                               NULL, NULL, NULL,
+                               NULL, NULL, NULL};
 
   int nt_cur = (ts != NULL) ? ts->nt_cur : -1;
   double t_cur = (ts != NULL) ? ts->t_cur : 0.;
@@ -5783,10 +6738,14 @@ cs_post_write_vertex_var(int                    mesh_id,
 
   /* Assign appropriate array to FVM for output */
 
-  if (use_parent)
+  if (use_parent) {
     n_parent_lists = 1;
-  else
+    n_list_vals[0] = cs_glob_mesh->n_vertices;
+  }
+  else {
     n_parent_lists = 0;
+    n_list_vals[0] = fvm_nodal_get_n_entities(post_mesh->exp_mesh, 0);
+  }
 
   var_ptr[0] = vtx_vals;
   if (interlace == false) {
@@ -5813,18 +6772,32 @@ cs_post_write_vertex_var(int                    mesh_id,
 
       _check_non_transient(writer, &nt_cur, &t_cur);
 
-      fvm_writer_export_field(writer->writer,
-                              post_mesh->exp_mesh,
-                              var_name,
-                              FVM_WRITER_PER_NODE,
-                              var_dim,
-                              _interlace,
-                              n_parent_lists,
-                              parent_num_shift,
-                              datatype,
-                              nt_cur,
-                              t_cur,
-                              (const void * *)var_ptr);
+      /* Optional reduction to single precision (converted once) */
+
+      if (writer->float32 && datatype == CS_DOUBLE && var_f == NULL)
+        var_f = _cs_post_convert_float32(var_dim,
+                                         _interlace,
+                                         1,
+                                         n_list_vals,
+                                         var_ptr,
+                                         var_ptr_f);
+
+      bool use_f = (writer->float32 && var_f != NULL);
+
+      _cs_post_export_field(writer,
+                            post_mesh->exp_mesh,
+                            var_name,
+                            FVM_WRITER_PER_NODE,
+                            var_dim,
+                            _interlace,
+                            n_parent_lists,
+                            parent_num_shift,
+                            (use_f) ? CS_FLOAT : datatype,
+                            nt_cur,
+                            t_cur,
+                            1,
+                            n_list_vals,
+                            (use_f) ? var_ptr_f : var_ptr);
 
       if (nt_cur >= 0) {
         writer->tc.last_t = nt_cur;
@@ -5835,6 +6808,7 @@ cs_post_write_vertex_var(int                    mesh_id,
 
   }
 
+  BFT_FREE(var_f);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -5974,18 +6948,20 @@ cs_post_write_particle_values(int                    mesh_id,
 
     if (writer->active == 1) {
 
-      fvm_writer_export_field(writer->writer,
-                              post_mesh->exp_mesh,
-                              var_name,
-                              FVM_WRITER_PER_NODE,
-                              _stride_export_field,
-                              CS_INTERLACE,
-                              0, /* n_parent_lists, */
-                              parent_num_shift,
-                              datatype,
-                              nt_cur,
-                              t_cur,
-                              (const void * *)var_ptr);
+      _cs_post_export_field(writer,
+                            post_mesh->exp_mesh,
+                            var_name,
+                            FVM_WRITER_PER_NODE,
+                            _stride_export_field,
+                            CS_INTERLACE,
+                            0, /* n_parent_lists, */
+                            parent_num_shift,
+                            datatype,
+                            nt_cur,
+                            t_cur,
+                            1,
+                            &n_pts,
+                            (const void * *)var_ptr);
 
       if (nt_cur >= 0) {
         writer->tc.last_nt = nt_cur;
@@ -6083,21 +7059,37 @@ cs_post_write_probe_values(int                              mesh_id,
                n_points*cs_datatype_size[datatype]*var_dim,
                unsigned char);
 
-    if (_interpolate_func != cs_interpolate_from_location_p0) {
+    /* Use precomputed stencil when available */
+
+    cs_interpolate_p1_stencil_t *p1_stencil = NULL;
+    if (   _interpolate_func == cs_interpolate_from_location_p1
+        && parent_location_id == CS_MESH_LOCATION_CELLS)
+      p1_stencil = cs_probe_set_get_p1_stencil(pset);
+
+    if (p1_stencil != NULL)
+      cs_interpolate_p1_stencil_apply(p1_stencil,
+                                      interpolate_input,
+                                      datatype,
+                                      var_dim,
+                                      vals,
+                                      _vals);
+
+    else if (_interpolate_func != cs_interpolate_from_location_p0) {
       BFT_MALLOC(point_coords, n_points*3, cs_coord_t);
       fvm_nodal_get_vertex_coords(post_mesh->exp_mesh,
                                   CS_INTERLACE,
                                   point_coords);
     }
 
-    _interpolate_func(interpolate_input,
-                      datatype,
-                      var_dim,
-                      n_points,
-                      elt_ids,
-                      (const cs_real_3_t *)point_coords,
-                      vals,
-                      _vals);
+    if (p1_stencil == NULL)
+      _interpolate_func(interpolate_input,
+                        datatype,
+                        var_dim,
+                        n_points,
+                        elt_ids,
+                        (const cs_real_3_t *)point_coords,
+                        vals,
+                        _vals);
     var_ptr[0] = _vals;
 
     BFT_FREE(point_coords);
@@ -6116,19 +7108,22 @@ cs_post_write_probe_values(int                              mesh_id,
     if (writer->active == 1) {
 
       cs_lnum_t  parent_num_shift[1] = {0};
+      cs_lnum_t  n_points = fvm_nodal_get_n_entities(post_mesh->exp_mesh, 0);
 
-      fvm_writer_export_field(writer->writer,
-                              post_mesh->exp_mesh,
-                              var_name,
-                              FVM_WRITER_PER_NODE,
-                              var_dim,
-                              CS_INTERLACE,
-                              0, /* n_parent_lists */
-                              parent_num_shift,
-                              datatype,
-                              nt_cur,
-                              t_cur,
-                              (const void **)var_ptr);
+      _cs_post_export_field(writer,
+                            post_mesh->exp_mesh,
+                            var_name,
+                            FVM_WRITER_PER_NODE,
+                            var_dim,
+                            CS_INTERLACE,
+                            0, /* n_parent_lists */
+                            parent_num_shift,
+                            datatype,
+                            nt_cur,
+                            t_cur,
+                            1,
+                            &n_points,
+                            (const void **)var_ptr);
 
       if (nt_cur >= 0) {
         writer->tc.last_nt = nt_cur;
@@ -6173,6 +7168,8 @@ cs_post_renum_cells(const cs_lnum_t  init_cell_num[])
   if (init_cell_num == NULL)
     return;
 
+  _cs_post_async_wait(-1);
+
   /* Loop on meshes */
 
   for (i = 0; i < _cs_post_n_meshes; i++) {
@@ -6207,6 +7204,10 @@ cs_post_renum_cells(const cs_lnum_t  init_cell_num[])
                                     renum_ent_parent,
                                     3);
 
+        /* Kept element selection refers to the previous numbering */
+
+        _free_selection_cache(post_mesh);
+
       }
 
     }
@@ -6247,6 +7248,8 @@ cs_post_renum_faces(const cs_lnum_t  init_i_face_num[],
   cs_post_mesh_t   *post_mesh;
   const cs_mesh_t  *mesh = cs_glob_mesh;
 
+  _cs_post_async_wait(-1);
+
   /* Loop on meshes */
 
   for (i = 0; i < _cs_post_n_meshes; i++) {
@@ -6306,6 +7309,10 @@ cs_post_renum_faces(const cs_lnum_t  init_i_face_num[],
                                     renum_ent_parent,
                                     2);
 
+        /* Kept element selection refers to the previous numbering */
+
+        _free_selection_cache(post_mesh);
+
       }
 
     }
@@ -6456,6 +7463,8 @@ cs_post_init_writers(void)
 void
 cs_post_init_meshes(int check_mask)
 {
+  bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_POST);
+
   { /* Definition of default post-processing meshes if this has not been
        done yet */
 
@@ -6604,6 +7613,8 @@ cs_post_init_meshes(int check_mask)
   /* Initial output */
 
   cs_post_write_meshes(NULL);
+
+  bft_mem_tag_end(mem_tag);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -6667,6 +7678,14 @@ cs_post_time_step_output(const cs_time_step_t  *ts)
 
   int t_top_id = cs_timer_stats_switch(_post_out_stat_id);
 
+  /* With asynchronous output, snapshots of the previous output may still
+     be in progress, but older ones are guaranteed to be complete, so
+     that at most two sets of snapshots are present */
+
+  _cs_post_async_generation += 1;
+
+  _cs_post_async_wait(_cs_post_async_generation - 2);
+
   /* Output of variables by registered function instances */
   /*------------------------------------------------------*/
 
@@ -6931,18 +7950,22 @@ cs_post_time_step_end(void)
     cs_post_writer_t  *writer = _cs_post_writers + i;
     if (writer->active == 1) {
       if (writer->writer != NULL)
-        fvm_writer_flush(writer->writer);
+        _cs_post_flush_writer(writer);
     }
   }
 
   /* Free time-varying and Lagrangian meshes unless they
-     are mapped to an existing mesh */
+     are mapped to an existing mesh (meshes for which only the
+     element selection may vary are kept, and rebuilt only if
+     that selection changes) */
 
   for (int i = 0; i < _cs_post_n_meshes; i++) {
     cs_post_mesh_t  *post_mesh = _cs_post_meshes + i;
     if (post_mesh->_exp_mesh != NULL) {
       if (   post_mesh->ent_flag[3]
-          || post_mesh->mod_flag_min == FVM_WRITER_TRANSIENT_CONNECT) {
+          || (   post_mesh->mod_flag_min == FVM_WRITER_TRANSIENT_CONNECT
+              && _selection_is_cacheable(post_mesh) == false)) {
+        _cs_post_async_wait(-1);
         post_mesh->exp_mesh = NULL;
         post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
       }
@@ -6967,6 +7990,8 @@ cs_post_time_step_end(void)
 void
 cs_post_write_vars(const cs_time_step_t  *ts)
 {
+  bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_POST);
+
   /* Output meshes if needed */
 
   _update_meshes(ts);
@@ -6978,6 +8003,8 @@ cs_post_write_vars(const cs_time_step_t  *ts)
   /* Flush writers and free time-varying and Lagragian mesh if needed */
 
   cs_post_time_step_end();
+
+  bft_mem_tag_end(mem_tag);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -6992,6 +8019,17 @@ cs_post_finalize(void)
   int i, j;
   cs_post_mesh_t  *post_mesh = NULL;
 
+  /* Complete pending asynchronous output */
+
+  _cs_post_async_wait(-1);
+
+#if defined(HAVE_PTHREAD)
+  if (_async_thread_created) {
+    pthread_join(_async_thread, NULL);
+    _async_thread_created = false;
+  }
+#endif
+
   /* Timings */
 
   for (i = 0; i < _cs_post_n_writers; i++) {
@@ -7034,6 +8072,7 @@ cs_post_finalize(void)
     post_mesh = _cs_post_meshes + i;
     if (post_mesh->_exp_mesh != NULL)
       fvm_nodal_destroy(post_mesh->_exp_mesh);
+    _free_selection_cache(post_mesh);
     BFT_FREE(post_mesh->name);
     for (j = 0; j < 4; j++)
       BFT_FREE(post_mesh->criteria[j]);
@@ -7076,6 +8115,17 @@ cs_post_finalize(void)
     BFT_FREE(_cs_post_i_output_mtp);
   }
 
+  /* Asynchronous output */
+
+  if (_cs_post_async_checked) {
+#if defined(HAVE_MPI)
+    if (_cs_post_async_comm != MPI_COMM_NULL)
+      MPI_Comm_free(&_cs_post_async_comm);
+#endif
+    bft_mem_set_thread_safe(0);
+    _cs_post_async_checked = false;
+  }
+
   /* Options */
 
   BFT_FREE(_cs_post_default_format_options);
@@ -299,6 +299,73 @@ cs_post_define_writer(int                     writer_id,
                       int                     interval_n,
                       double                  interval_t);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define on-rank data reduction options for a given writer.
+ *
+ * These options act as a reduction stage between variable output
+ * functions such as \ref cs_post_write_var and the associated FVM writer:
+ *
+ * - if \c float32 is true, double precision values are converted to
+ *   single precision on each rank before being passed to the writer,
+ *   halving the amount of data redistributed and written for formats
+ *   which do not already do this;
+ * - if \c rank_step > 1, output data is aggregated on one rank out of
+ *   \c rank_step for writing, using the \c rank_step format option
+ *   (currently handled by the \c EnSight format).
+ *
+ * Spatial reduction (decimation or thresholding of output elements) is
+ * obtained by defining post-processing meshes based on a selection
+ * function, such as \ref cs_cell_subset_select.
+ *
+ * The aggregation rank step must be defined before the writer's first
+ * use, so this function should be called just after the matching
+ * \ref cs_post_define_writer call.
+ *
+ * \param[in]  writer_id  id of associated writer
+ * \param[in]  float32    convert double precision values to single
+ *                        precision if true
+ * \param[in]  rank_step  MPI rank step between output ranks, or 1
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_writer_set_reduction(int   writer_id,
+                             bool  float32,
+                             int   rank_step);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define whether postprocessing output is asynchronous.
+ *
+ * In asynchronous mode, values output through writers using the
+ * \c EnSight, \c MED or \c CGNS formats are copied to snapshot buffers,
+ * and actual output is handled by a background thread, using a duplicate
+ * of the main MPI communicator (obtained through \ref cs_file_block_comm),
+ * so that output overlaps with the computation. Snapshots of at most
+ * two consecutive outputs are kept in memory: output of a given time step
+ * is guaranteed to be complete when the time step following the next
+ * one is output. Mesh output remains synchronous, and waits for completion
+ * of pending output.
+ *
+ * This requires thread support and, in parallel, that MPI is initialized
+ * with \c MPI_THREAD_MULTIPLE (which is requested when the
+ * \c CS_MPI_THREAD_MULTIPLE environment variable is defined); otherwise,
+ * a warning is printed and output remains synchronous. Output rank
+ * aggregation (see \ref cs_post_writer_set_reduction) is not used by
+ * asynchronous writers.
+ *
+ * This setting only applies to writers initialized after it is defined,
+ * so it should be called before the first output.
+ *
+ * \param[in]  mode  if 0, output is synchronous (default)
+ *                   if 1, output is asynchronous when possible
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_set_async_mode(int  mode);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define a volume post-processing mesh.
@@ -329,7 +396,10 @@ cs_post_define_volume_mesh(int          mesh_id,
  *
  * The selection may be updated over time steps if both the time_varying
  * flag is set to true and the mesh is only associated with writers defined
- * with the FVM_WRITER_TRANSIENT_CONNECT option.
+ * with the FVM_WRITER_TRANSIENT_CONNECT option. Unless
+ * cs_post_set_changing_connectivity has been called, the exportable mesh
+ * (with its global numbering and tesselation) is then rebuilt only when
+ * the selection actually changes.
  *
  * Note: if the cell_select_input pointer is non-NULL, it must point
  * to valid data when the selection function is called, so either:
@@ -395,7 +465,10 @@ cs_post_define_surface_mesh(int          mesh_id,
  *
  * The selection may be updated over time steps if both the time_varying
  * flag is set to true and the mesh is only associated with writers defined
- * with the FVM_WRITER_TRANSIENT_CONNECT option.
+ * with the FVM_WRITER_TRANSIENT_CONNECT option. Unless
+ * cs_post_set_changing_connectivity has been called, the exportable mesh
+ * (with its global numbering and tesselation) is then rebuilt only when
+ * the selection actually changes.
  *
  * Note: if i_face_select_input or b_face_select_input pointer is non-NULL,
  * it must point to valid data when the selection function is called,
@@ -37,6 +37,7 @@
  * Local headers
  *----------------------------------------------------------------------------*/
 
+#include "bft_error.h"
 #include "bft_mem.h"
 #include "bft_printf.h"
 
@@ -602,6 +603,110 @@ cs_cell_polyline_intersect_select(void        *input,
   *seg_c_len = _seg_c_len;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select a reduced subset of cells for output, by decimation
+ *        and/or thresholding of a cell-based field.
+ *
+ * This selection function may be used as an elements selection function
+ * for postprocessing, so as to reduce the amount of data output by
+ * writers associated with the matching mesh. When thresholding, the mesh
+ * should be associated with writers allowing transient connectivity
+ * (\ref FVM_WRITER_TRANSIENT_CONNECT) so the selection follows the field.
+ *
+ * In this case, the input points to a \ref cs_post_cell_subset_t
+ * structure.
+ *
+ * Note: the input pointer must point to valid data when this selection
+ * function is called, so either:
+ * - that value or structure should not be temporary (i.e. local);
+ * - post-processing output must be ensured using cs_post_write_meshes()
+ *   with a fixed-mesh writer before the data pointed to goes out of scope;
+ *
+ * The caller is responsible for freeing the returned cell_ids array.
+ * When passed to postprocessing mesh or probe set definition functions,
+ * this is handled automatically.
+ *
+ * \param[in]   input     pointer to cell subset definition
+ * \param[out]  n_cells   number of selected cells
+ * \param[out]  cell_ids  array of selected cell ids (0 to n-1 numbering)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_subset_select(void        *input,
+                      cs_lnum_t   *n_cells,
+                      cs_lnum_t  **cell_ids)
+{
+  const cs_post_cell_subset_t *cs = (const cs_post_cell_subset_t *)input;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_m_cells = m->n_cells;
+
+  const cs_gnum_t stride = (cs->stride > 1) ? cs->stride : 1;
+
+  const cs_real_t *val = NULL;
+  int dim = 1;
+
+  if (cs->f_id > -1) {
+    const cs_field_t *f = cs_field_by_id(cs->f_id);
+    if (f->location_id != CS_MESH_LOCATION_CELLS)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: field \"%s\" is not defined on cells."),
+                __func__, f->name);
+    if (cs->c_id >= f->dim)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: field \"%s\" has no component %d."),
+                __func__, f->name, cs->c_id);
+    val = f->val;
+    dim = f->dim;
+  }
+
+  cs_lnum_t _n_cells = 0;
+  cs_lnum_t *_cell_ids = NULL;
+
+  BFT_MALLOC(_cell_ids, n_m_cells, cs_lnum_t); /* Allocate selection list */
+
+  for (cs_lnum_t c_id = 0; c_id < n_m_cells; c_id++) {
+
+    /* Decimation based on global numbers, independent of partitioning */
+
+    if (stride > 1) {
+      cs_gnum_t g_num = (m->global_cell_num != NULL) ?
+        m->global_cell_num[c_id] : (cs_gnum_t)c_id + 1;
+      if ((g_num - 1) % stride != 0)
+        continue;
+    }
+
+    /* Threshold on selected component (or norm) */
+
+    if (val != NULL) {
+      cs_real_t v;
+      if (cs->c_id > -1 || dim == 1)
+        v = val[c_id*dim + CS_MAX(cs->c_id, 0)];
+      else {
+        v = 0;
+        for (int j = 0; j < dim; j++)
+          v += val[c_id*dim + j]*val[c_id*dim + j];
+        v = sqrt(v);
+      }
+      if (v < cs->v_min || v > cs->v_max)
+        continue;
+    }
+
+    _cell_ids[_n_cells++] = c_id;
+
+  }
+
+  BFT_REALLOC(_cell_ids, _n_cells, cs_lnum_t); /* Adjust size (good practice,
+                                                  but not required) */
+
+  /* Set return values */
+
+  *n_cells = _n_cells;
+  *cell_ids = _cell_ids;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define probes based on the centers of cells intersected by
@@ -53,6 +53,22 @@ typedef enum {
 
 } cs_post_util_type_t;
 
+/*! Cell subset definition for reduced output
+    (see \ref cs_cell_subset_select) */
+
+typedef struct {
+
+  cs_gnum_t  stride;   /*!< keep one cell out of stride (by global number),
+                            or 1 for all cells */
+  int        f_id;     /*!< id of cell-based field used for thresholding,
+                            or -1 for no threshold */
+  int        c_id;     /*!< component of field used for thresholding,
+                            or -1 for its norm */
+  cs_real_t  v_min;    /*!< minimum threshold value */
+  cs_real_t  v_max;    /*!< maximum threshold value */
+
+} cs_post_cell_subset_t;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -133,6 +149,41 @@ cs_cell_polyline_intersect_select(void        *input,
                                   cs_lnum_t  **cell_ids,
                                   cs_real_t  **seg_c_len);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select a reduced subset of cells for output, by decimation
+ *        and/or thresholding of a cell-based field.
+ *
+ * This selection function may be used as an elements selection function
+ * for postprocessing, so as to reduce the amount of data output by
+ * writers associated with the matching mesh. When thresholding, the mesh
+ * should be associated with writers allowing transient connectivity
+ * (\ref FVM_WRITER_TRANSIENT_CONNECT) so the selection follows the field.
+ *
+ * In this case, the input points to a \ref cs_post_cell_subset_t
+ * structure.
+ *
+ * Note: the input pointer must point to valid data when this selection
+ * function is called, so either:
+ * - that value or structure should not be temporary (i.e. local);
+ * - post-processing output must be ensured using cs_post_write_meshes()
+ *   with a fixed-mesh writer before the data pointed to goes out of scope;
+ *
+ * The caller is responsible for freeing the returned cell_ids array.
+ * When passed to postprocessing mesh or probe set definition functions,
+ * this is handled automatically.
+ *
+ * \param[in]   input     pointer to cell subset definition
+ * \param[out]  n_cells   number of selected cells
+ * \param[out]  cell_ids  array of selected cell ids (0 to n-1 numbering)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_subset_select(void        *input,
+                      cs_lnum_t   *n_cells,
+                      cs_lnum_t  **cell_ids);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define probes based on the centers of cells intersected by
@@ -68,6 +68,7 @@
 #include "cs_post.h"
 #include "cs_prototypes.h"
 #include "cs_preprocessor_data.h"
+#include "cs_timer.h"
 #include "cs_timer_stats.h"
 #include "cs_velocity_pressure.h"
 #include "cs_volume_zone.h"
@@ -101,10 +102,42 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Mesh preprocessing phases, for startup timing breakdown */
+
+typedef enum {
+
+  CS_PREPROCESS_PHASE_READ,          /* read mesh input */
+  CS_PREPROCESS_PHASE_JOIN,          /* joining, boundary insertion */
+  CS_PREPROCESS_PHASE_HALO,          /* halo and auxiliary connectivity */
+  CS_PREPROCESS_PHASE_MODIFY,        /* user modification, smoothing */
+  CS_PREPROCESS_PHASE_WARPING,       /* warped faces cutting */
+  CS_PREPROCESS_PHASE_PARTITION,     /* save and repartitioning */
+  CS_PREPROCESS_PHASE_RENUMBER,      /* renumbering */
+  CS_PREPROCESS_PHASE_QUANTITIES,    /* geometric quantities, bad cells */
+  CS_PREPROCESS_PHASE_ZONES,         /* selectors, locations and zones */
+  CS_PREPROCESS_PHASE_OTHER,         /* other operations */
+
+  CS_PREPROCESS_N_PHASES
+
+} cs_preprocess_phase_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
 
+static const char *_phase_name[] = {N_("mesh reading"),
+                                    N_("joining and boundaries"),
+                                    N_("halo construction"),
+                                    N_("modification"),
+                                    N_("warped faces cutting"),
+                                    N_("partitioning"),
+                                    N_("renumbering"),
+                                    N_("geometric quantities"),
+                                    N_("selectors and zones"),
+                                    N_("other")};
+
+static cs_timer_counter_t  _phase_timer[CS_PREPROCESS_N_PHASES];
+
 /*============================================================================
  * Prototypes for Fortran functions used only through this program unit.
  *============================================================================*/
@@ -160,6 +193,99 @@ extern void cs_f_majgeo(const cs_lnum_t    *ncel,
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Add elapsed time since a given start to a preprocessing phase timer.
+ *
+ * parameters:
+ *   phase <-- phase to which time is attributed
+ *   t0    <-> start time; reset to current time on output
+ *----------------------------------------------------------------------------*/
+
+static void
+_phase_time(cs_preprocess_phase_t   phase,
+            cs_timer_t             *t0)
+{
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(_phase_timer[phase]), t0, &t1);
+  *t0 = t1;
+}
+
+/*----------------------------------------------------------------------------
+ * Log per-phase mesh preprocessing timings.
+ *
+ * In parallel, the minimum, mean, and maximum times over ranks are logged,
+ * with the rank id at which the maximum is reached, to help identify
+ * imbalanced or serial phases.
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_phase_times(void)
+{
+  double t_loc[CS_PREPROCESS_N_PHASES + 1];
+  double t_min[CS_PREPROCESS_N_PHASES + 1], t_sum[CS_PREPROCESS_N_PHASES + 1];
+  struct {
+    double val;
+    int    rank;
+  } t_in[CS_PREPROCESS_N_PHASES + 1], t_max[CS_PREPROCESS_N_PHASES + 1];
+
+  const int n_vals = CS_PREPROCESS_N_PHASES + 1;
+
+  t_loc[CS_PREPROCESS_N_PHASES] = 0;
+  for (int i = 0; i < CS_PREPROCESS_N_PHASES; i++) {
+    t_loc[i] = _phase_timer[i].wall_nsec*1e-9;
+    t_loc[CS_PREPROCESS_N_PHASES] += t_loc[i];
+  }
+
+  for (int i = 0; i < n_vals; i++) {
+    t_min[i] = t_loc[i];
+    t_sum[i] = t_loc[i];
+    t_in[i].val = t_loc[i];
+    t_in[i].rank = CS_MAX(cs_glob_rank_id, 0);
+    t_max[i] = t_in[i];
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Allreduce(t_loc, t_min, n_vals, MPI_DOUBLE, MPI_MIN,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(t_loc, t_sum, n_vals, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(t_in, t_max, n_vals, MPI_DOUBLE_INT, MPI_MAXLOC,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nMesh preprocessing phases:\n\n"));
+
+  if (cs_glob_n_ranks > 1)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  %-28s  %12s  %12s  %12s  %8s\n"),
+                  " ", _("min (s)"), _("mean (s)"), _("max (s)"),
+                  _("max rank"));
+
+  for (int i = 0; i < n_vals; i++) {
+
+    const char *name = (i < CS_PREPROCESS_N_PHASES) ?
+      _(_phase_name[i]) : _("total");
+
+    if (i == CS_PREPROCESS_N_PHASES)
+      cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+
+    if (cs_glob_n_ranks > 1)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "  %-28s  %12.3f  %12.3f  %12.3f  %8d\n",
+                    name, t_min[i], t_sum[i]/cs_glob_n_ranks,
+                    t_max[i].val, t_max[i].rank);
+    else
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "  %-28s  %12.3f s\n", name, t_loc[i]);
+
+  }
+
+  cs_log_separator(CS_LOG_PERFORMANCE);
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -258,6 +384,11 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
 
   int t_top_id = cs_timer_stats_switch(t_stat_id);
 
+  for (int i = 0; i < CS_PREPROCESS_N_PHASES; i++)
+    CS_TIMER_COUNTER_INIT(_phase_timer[i]);
+
+  cs_timer_t t_p = cs_timer_time();
+
   bool allow_modify = cs_preprocess_mesh_is_needed();
 
   /* Disable all writers until explicitely enabled for this stage */
@@ -283,11 +414,15 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
     cs_user_partition();
   }
 
+  _phase_time(CS_PREPROCESS_PHASE_OTHER, &t_p);
+
   /* Read Preprocessor output */
 
   cs_preprocessor_data_read_mesh(cs_glob_mesh,
                                  cs_glob_mesh_builder);
 
+  _phase_time(CS_PREPROCESS_PHASE_READ, &t_p);
+
   if (allow_modify) {
 
     /* Join meshes / build periodicity links if necessary */
@@ -301,6 +436,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
 
     cs_internal_coupling_preprocess(cs_glob_mesh);
 
+    _phase_time(CS_PREPROCESS_PHASE_JOIN, &t_p);
+
   }
 
   /* Initialize extended connectivity, ghost cells and other remaining
@@ -309,6 +446,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
   cs_mesh_init_halo(cs_glob_mesh, cs_glob_mesh_builder, halo_type);
   cs_mesh_update_auxiliary(cs_glob_mesh);
 
+  _phase_time(CS_PREPROCESS_PHASE_HALO, &t_p);
+
   if (allow_modify) {
 
     /* Possible geometry modification */
@@ -326,6 +465,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
     cs_gui_mesh_smoothe(cs_glob_mesh);
     cs_user_mesh_smoothe(cs_glob_mesh);
 
+    _phase_time(CS_PREPROCESS_PHASE_MODIFY, &t_p);
+
     /* Triangulate warped faces if necessary */
 
     {
@@ -343,6 +484,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
         bft_printf(_("\n Cutting warped faces (%.3g s)\n"), t2-t1);
 
       }
+
+      _phase_time(CS_PREPROCESS_PHASE_WARPING, &t_p);
     }
 
     /* Now that mesh modification is finished, save mesh if modified */
@@ -388,12 +531,16 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
   /* Destroy cartesian mesh builder if necessary */
   cs_mesh_cartesian_params_destroy();
 
+  _phase_time(CS_PREPROCESS_PHASE_PARTITION, &t_p);
+
   /* Renumber mesh based on code options */
 
   cs_user_numbering();
 
   cs_renumber_mesh(cs_glob_mesh);
 
+  _phase_time(CS_PREPROCESS_PHASE_RENUMBER, &t_p);
+
   /* Initialize group classes */
 
   cs_mesh_init_group_classes(cs_glob_mesh);
@@ -409,6 +556,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
 
   bft_printf_flush();
 
+  _phase_time(CS_PREPROCESS_PHASE_OTHER, &t_p);
+
   t1 = cs_timer_wtime();
 
   /* If fluid_solid mode is activated: disable solid cells for the dynamics */
@@ -427,6 +576,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
   cs_user_mesh_bad_cells_tag(cs_glob_mesh, cs_glob_mesh_quantities);
   t2 = cs_timer_wtime();
 
+  _phase_time(CS_PREPROCESS_PHASE_QUANTITIES, &t_p);
+
   bft_printf(_("\n Computing geometric quantities (%.3g s)\n"), t2-t1);
 
   /* Initialize selectors and locations for the mesh */
@@ -441,6 +592,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
   cs_ext_neighborhood_reduce(cs_glob_mesh,
                              cs_glob_mesh_quantities);
 
+  _phase_time(CS_PREPROCESS_PHASE_ZONES, &t_p);
+
   /* For debugging purposes */
 
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
@@ -452,6 +605,10 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
 
   cs_post_enable_writer(0);
 
+  _phase_time(CS_PREPROCESS_PHASE_OTHER, &t_p);
+
+  _log_phase_times();
+
   cs_timer_stats_switch(t_top_id);
 }
 
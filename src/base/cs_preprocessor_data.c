@@ -59,6 +59,15 @@
 #include "cs_mesh_cartesian.h"
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_group.h"
+
+#if defined(HAVE_CGNS)
+#include "cs_mesh_read_cgns.h"
+#endif
+
+#if defined(HAVE_MED)
+#include "cs_mesh_read_med.h"
+#endif
+
 #include "cs_parall.h"
 #include "cs_partition.h"
 #include "cs_io.h"
@@ -1935,6 +1944,137 @@ _read_data(int                 file_id,
   cs_io_finalize(&pp_in);
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a mesh file should be read directly, bypassing the Preprocessor.
+ *
+ * MED and CGNS files are identified by their extension.
+ *
+ * parameters:
+ *   filename <-- file name
+ *
+ * returns:
+ *   0 for Preprocessor output, 1 for MED, 2 for CGNS
+ *----------------------------------------------------------------------------*/
+
+static int
+_direct_read_format(const char  *filename)
+{
+  int retval = 0;
+
+  const char *ext = strrchr(filename, '.');
+
+  if (ext == NULL)
+    return retval;
+
+  if (strcmp(ext, ".med") == 0)
+    retval = 1;
+  else if (strcmp(ext, ".cgns") == 0)
+    retval = 2;
+
+#if !defined(HAVE_MED)
+  if (retval == 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\" can not be read directly,\n"
+                "as MED support is not available in this build."),
+              filename);
+#endif
+
+#if !defined(HAVE_CGNS)
+  if (retval == 2)
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\" can not be read directly,\n"
+                "as CGNS support is not available in this build."),
+              filename);
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Read mesh dimensions from a MED or CGNS file.
+ *
+ * Only a single mesh file may be read directly.
+ *
+ * parameters:
+ *   mesh     <-> pointer to mesh structure
+ *   mb       <-> pointer to mesh builder helper structure
+ *   mr       <-> pointer to mesh reader structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_direct_dimensions(cs_mesh_t          *mesh,
+                        cs_mesh_builder_t  *mb,
+                        _mesh_reader_t     *mr)
+{
+  _mesh_file_info_t  *f = mr->file_info;
+
+  if (mr->n_files > 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Direct reading of MED or CGNS meshes is only possible\n"
+                "for a single mesh input (%d files defined)."),
+              mr->n_files);
+
+  int format = _direct_read_format(f->filename);
+
+#if defined(HAVE_MED)
+  if (format == 1)
+    cs_mesh_read_med_headers(mesh, mb, f->filename);
+#endif
+
+#if defined(HAVE_CGNS)
+  if (format == 2)
+    cs_mesh_read_cgns_headers(mesh, mb, f->filename);
+#endif
+
+  CS_UNUSED(format);
+  CS_UNUSED(mb);
+
+  if (f->n_group_renames > 0)
+    _mesh_groups_rename(mesh,
+                        0,
+                        f->n_group_renames,
+                        f->old_group_names,
+                        f->new_group_names);
+}
+
+/*----------------------------------------------------------------------------
+ * Read mesh data from a MED or CGNS file.
+ *
+ * parameters:
+ *   mesh     <-> pointer to mesh structure
+ *   mb       <-> pointer to mesh builder helper structure
+ *   mr       <-> pointer to mesh reader structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_direct_data(cs_mesh_t          *mesh,
+                  cs_mesh_builder_t  *mb,
+                  _mesh_reader_t     *mr)
+{
+  _mesh_file_info_t  *f = mr->file_info;
+
+  int format = _direct_read_format(f->filename);
+
+#if defined(HAVE_MED)
+  if (format == 1)
+    cs_mesh_read_med_data(mesh, mb, f->filename);
+#endif
+
+#if defined(HAVE_CGNS)
+  if (format == 2)
+    cs_mesh_read_cgns_data(mesh, mb, f->filename);
+#endif
+
+  CS_UNUSED(format);
+  CS_UNUSED(mesh);
+
+  if (f->matrix != NULL) {
+    cs_lnum_t n_vertices = (  mb->vertex_bi.gnum_range[1]
+                            - mb->vertex_bi.gnum_range[0]);
+    _transform_coords(n_vertices, mb->vertex_coords, f->matrix);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -2128,6 +2268,8 @@ cs_preprocessor_check_perio(void)
   _n_max_mesh_files = 0;
 
   for (int i = 0; i < _n_mesh_files; i++) {
+    if (_direct_read_format((_mesh_file_info + i)->filename) > 0)
+      continue;
     retval = _read_perio_info((_mesh_file_info + i)->filename);
     perio_flag = CS_MAX(retval, perio_flag);
   }
@@ -2173,8 +2315,13 @@ cs_preprocessor_data_read_headers(cs_mesh_t          *mesh,
 
     mr = _cs_glob_mesh_reader;
 
-    for (file_id = 0; file_id < mr->n_files; file_id++)
-      _read_dimensions(mesh, mesh_builder, mr, file_id);
+    if (_direct_read_format(mr->file_info[0].filename) > 0)
+      _read_direct_dimensions(mesh, mesh_builder, mr);
+
+    else {
+      for (file_id = 0; file_id < mr->n_files; file_id++)
+        _read_dimensions(mesh, mesh_builder, mr, file_id);
+    }
   }
 
   /* Return values */
@@ -2268,6 +2415,10 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
     cs_mesh_cartesian_connectivity(mesh, mesh_builder, echo);
     mesh->modified |= CS_MESH_MODIFIED;
   }
+  else if (_direct_read_format(mr->file_info[0].filename) > 0) {
+    _read_direct_data(mesh, mesh_builder, mr);
+    mesh->modified |= CS_MESH_MODIFIED;
+  }
   else {
     for (file_id = 0; file_id < mr->n_files; file_id++)
       _read_data(file_id, mesh, mesh_builder, mr, echo);
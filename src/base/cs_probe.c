@@ -46,7 +46,9 @@
 #include "fvm_nodal.h"
 #include "fvm_point_location.h"
 
+#include "cs_ale.h"
 #include "cs_base.h"
+#include "cs_interpolate.h"
 #include "cs_map.h"
 #include "cs_math.h"
 #include "cs_mesh.h"
@@ -57,6 +59,7 @@
 #include "cs_parall.h"
 #include "cs_selector.h"
 #include "cs_timer.h"
+#include "cs_turbomachinery.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -145,9 +148,17 @@ struct _cs_probe_set_t {
 
   char         *located;        /* 1 for located probes, 0 for unlocated */
 
+  cs_lnum_t    *elt_num_prev;   /* For transient sets, number of location
+                                   mesh element in which each probe was
+                                   previously located on this rank, or -1
+                                   (size: n_probes) */
+
   int           interpolation;  /* 0: no interpolation;
                                    1: local gradient-based interpolation */
 
+  cs_interpolate_p1_stencil_t  *p1_stencil;  /* Precomputed interpolation
+                                                stencil, or NULL */
+
   /* User-defined writers associated to this set of probes */
 
   int           n_writers;      /* Number of writers (-1 if unset) */
@@ -303,6 +314,9 @@ _probe_set_free(cs_probe_set_t   *pset)
   BFT_FREE(pset->elt_id);
   BFT_FREE(pset->vtx_id);
   BFT_FREE(pset->located);
+  BFT_FREE(pset->elt_num_prev);
+
+  cs_interpolate_p1_stencil_destroy(&(pset->p1_stencil));
 
   if (pset->labels != NULL) {
     for (int i = 0; i < pset->n_probes; i++)
@@ -388,8 +402,10 @@ _probe_set_create(const char    *name,
   pset->elt_id = NULL;
   pset->vtx_id = NULL;
   pset->located = NULL;
+  pset->elt_num_prev = NULL;
 
   pset->interpolation = 0;
+  pset->p1_stencil = NULL;
 
   pset->n_writers = -1;
   pset->writer_ids = NULL;
@@ -1429,6 +1445,10 @@ cs_probe_set_locate(cs_probe_set_t     *pset,
 
   const bool  on_boundary = (pset->flags & CS_PROBE_BOUNDARY) ? true : false;
 
+  /* Interpolation stencil is based on previous location */
+
+  cs_interpolate_p1_stencil_destroy(&(pset->p1_stencil));
+
   /* Build in local case, restore saved coordinates if snapped otherwise */
 
   if (pset->p_define_func != NULL)
@@ -1514,15 +1534,32 @@ cs_probe_set_locate(cs_probe_set_t     *pset,
     distance[i] = -1.0;
   }
 
-  fvm_point_location_nodal(location_mesh,
-                           tolerance_base,
-                           pset->tolerance,
-                           0, /* locate_on_parents */
-                           pset->n_probes,
-                           NULL, /* point_tag */
-                           (const cs_coord_t *)(pset->coords),
-                           pset->elt_id,
-                           distance);
+  /* For transient sets, start from previous location when available */
+
+  const bool use_prev = (   (pset->flags & CS_PROBE_TRANSIENT)
+                         && pset->p_define_func == NULL);
+
+  if (use_prev && pset->elt_num_prev != NULL)
+    fvm_point_location_nodal_update(location_mesh,
+                                    tolerance_base,
+                                    pset->tolerance,
+                                    0, /* locate_on_parents */
+                                    pset->n_probes,
+                                    NULL, /* point_tag */
+                                    (const cs_coord_t *)(pset->coords),
+                                    pset->elt_num_prev,
+                                    pset->elt_id,
+                                    distance);
+  else
+    fvm_point_location_nodal(location_mesh,
+                             tolerance_base,
+                             pset->tolerance,
+                             0, /* locate_on_parents */
+                             pset->n_probes,
+                             NULL, /* point_tag */
+                             (const cs_coord_t *)(pset->coords),
+                             pset->elt_id,
+                             distance);
 
   for (int i = 0; i < pset->n_probes; i++) {
     if (pset->elt_id[i] < 0) /* Not found */
@@ -1587,6 +1624,16 @@ cs_probe_set_locate(cs_probe_set_t     *pset,
 
   BFT_FREE(distance);
 
+  /* Save location relative to location mesh for next update */
+
+  if (use_prev) {
+    BFT_REALLOC(pset->elt_num_prev, pset->n_probes, cs_lnum_t);
+    for (int i = 0; i < pset->n_probes; i++)
+      pset->elt_num_prev[i] = -1;
+    for (int i = 0; i < n_loc_probes; i++)
+      pset->elt_num_prev[pset->loc_id[i]] = pset->elt_id[i];
+  }
+
   if (n_unlocated_probes > 0 && first_location) {
     bft_printf(_("\n Warning: probe set \"%s\"\n"
                  "   %lu (of %ld) probes are not located"
@@ -1785,6 +1832,20 @@ cs_probe_set_export_mesh(cs_probe_set_t   *pset,
     }
   }
 
+  /* Precompute interpolation stencil for cell-based interpolation
+     (weights depend on cell centers, so not for deforming meshes) */
+
+  cs_interpolate_p1_stencil_destroy(&(pset->p1_stencil));
+
+  if (   pset->interpolation == 1
+      && ! (pset->flags & CS_PROBE_BOUNDARY)
+      && cs_glob_ale == CS_ALE_NONE
+      && cs_turbomachinery_get_model() != CS_TURBOMACHINERY_TRANSIENT)
+    pset->p1_stencil
+      = cs_interpolate_p1_stencil_create(pset->n_loc_probes,
+                                         pset->elt_id,
+                                         (const cs_real_3_t *)probe_coords);
+
   /* Update the probe set structure */
 
   fvm_nodal_define_vertex_list(exp_mesh, pset->n_loc_probes, NULL);
@@ -2106,6 +2167,29 @@ cs_probe_set_get_elt_ids(const cs_probe_set_t  *pset,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return a probe set's precomputed P1 interpolation stencil.
+ *
+ * This stencil is built when the probe set's export mesh is defined, for
+ * probe sets located on cells using gradient-based interpolation on
+ * non-deforming meshes, and matches the export mesh's vertices.
+ *
+ * \param[in]  pset  pointer to a cs_probe_set_t structure
+ *
+ * \return  pointer to stencil structure, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_interpolate_p1_stencil_t *
+cs_probe_set_get_p1_stencil(const cs_probe_set_t  *pset)
+{
+  if (pset == NULL)
+    return NULL;
+
+  return pset->p1_stencil;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -34,6 +34,7 @@
 #include "fvm_nodal.h"
 
 #include "cs_base.h"
+#include "cs_interpolate.h"
 #include "cs_mesh.h"
 #include "cs_mesh_location.h"
 #include "fvm_nodal.h"
@@ -635,6 +636,23 @@ const cs_lnum_t *
 cs_probe_set_get_elt_ids(const cs_probe_set_t  *pset,
                          int                    mesh_location_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return a probe set's precomputed P1 interpolation stencil.
+ *
+ * This stencil is built when the probe set's export mesh is defined, for
+ * probe sets located on cells using gradient-based interpolation on
+ * non-deforming meshes, and matches the export mesh's vertices.
+ *
+ * \param[in]  pset  pointer to a cs_probe_set_t structure
+ *
+ * \return  pointer to stencil structure, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_interpolate_p1_stencil_t *
+cs_probe_set_get_p1_stencil(const cs_probe_set_t  *pset);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
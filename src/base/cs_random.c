@@ -68,6 +68,17 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Philox4x32 multipliers and Weyl sequence key increments */
+
+#define _PHILOX_M0  0xD2511F53U
+#define _PHILOX_M1  0xCD9E8D57U
+#define _PHILOX_W0  0x9E3779B9U
+#define _PHILOX_W1  0xBB67AE85U
+
+/* Number of counter blocks handled per batch */
+
+#define _PHILOX_BATCH  64
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -171,6 +182,80 @@ _normal00(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Philox4x32-10 counter-based generator for a batch of blocks.
+ *
+ * Each block generates 4 32-bit values from the 128-bit counter made of
+ * the block id (low 64 bits) and the given counter (high 64 bits).
+ * Blocks are independent, so the main loop may be vectorized.
+ *
+ * \param[in]   key      generator key
+ * \param[in]   counter  high part of counter
+ * \param[in]   b_start  id of first block
+ * \param[in]   n_b      number of blocks (<= _PHILOX_BATCH)
+ * \param[out]  r        generated values
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_philox4x32_10(uint64_t  key,
+               uint64_t  counter,
+               uint64_t  b_start,
+               int       n_b,
+               uint32_t  r[4][_PHILOX_BATCH])
+{
+  const uint32_t k0_s = (uint32_t)key, k1_s = (uint32_t)(key >> 32);
+  const uint32_t c2_s = (uint32_t)counter, c3_s = (uint32_t)(counter >> 32);
+
+# pragma omp simd
+  for (int b = 0; b < n_b; b++) {
+
+    uint64_t b_id = b_start + (uint64_t)b;
+
+    uint32_t c0 = (uint32_t)b_id, c1 = (uint32_t)(b_id >> 32);
+    uint32_t c2 = c2_s, c3 = c3_s;
+    uint32_t k0 = k0_s, k1 = k1_s;
+
+    for (int i = 0; i < 10; i++) {
+      uint64_t p0 = (uint64_t)_PHILOX_M0 * c0;
+      uint64_t p1 = (uint64_t)_PHILOX_M1 * c2;
+      c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+      c1 = (uint32_t)p1;
+      c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+      c3 = (uint32_t)p0;
+      k0 += _PHILOX_W0;
+      k1 += _PHILOX_W1;
+    }
+
+    r[0][b] = c0;
+    r[1][b] = c1;
+    r[2][b] = c2;
+    r[3][b] = c3;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build a double in [0, 1[ from 2 32-bit values (53 random bits).
+ *
+ * \param[in]  a  first value
+ * \param[in]  b  second value
+ *
+ * \return  value in [0, 1[
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline double
+_u32_to_double(uint32_t  a,
+               uint32_t  b)
+{
+  const double scale = 1.0 / 9007199254740992.0; /* 2^-53 */
+  uint64_t m = ((uint64_t)(a >> 5) << 26) | (uint64_t)(b >> 6);
+  return (double)m * scale;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -525,6 +610,99 @@ cs_random_poisson(cs_lnum_t  n,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based uniform distribution random number generator.
+ *
+ * Philox4x32-10 generator (Salmon et al., SC'11). Values depend only on
+ * the (key, counter) pair and on their position in the array, not on any
+ * internal state, so this function is thread-safe, and results do not
+ * depend on the number of ranks or threads as long as keys and counters
+ * are associated with the generating entity (for example a particle)
+ * rather than its local numbering. Different counter values (such as
+ * time step numbers) provide independent sequences for a given key.
+ *
+ * \param[in]   key      generator key
+ * \param[in]   counter  generator counter
+ * \param[in]   n        number of values to compute
+ * \param[out]  a        pseudo-random numbers following uniform distribution
+ *                       in [0, 1[
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_uniform(uint64_t   key,
+                          uint64_t   counter,
+                          cs_lnum_t  n,
+                          cs_real_t  a[])
+{
+  uint32_t r[4][_PHILOX_BATCH];
+
+  /* Each block provides 2 values */
+
+  for (cs_lnum_t s_id = 0; s_id < n; s_id += 2*_PHILOX_BATCH) {
+
+    cs_lnum_t n_v = CS_MIN(n - s_id, 2*_PHILOX_BATCH);
+    int n_b = (n_v + 1) / 2;
+
+    _philox4x32_10(key, counter, s_id/2, n_b, r);
+
+    for (cs_lnum_t i = 0; i < n_v; i++) {
+      int b = i/2, j = (i%2)*2;
+      a[s_id + i] = _u32_to_double(r[j][b], r[j+1][b]);
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based normal distribution random number generator.
+ *
+ * Box-Muller method applied to uniform values from the same Philox4x32-10
+ * generator as \ref cs_random_counter_uniform; the same properties apply.
+ *
+ * \param[in]   key      generator key
+ * \param[in]   counter  generator counter
+ * \param[in]   n        number of values to compute
+ * \param[out]  x        pseudo-random numbers following normal distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_normal(uint64_t   key,
+                         uint64_t   counter,
+                         cs_lnum_t  n,
+                         cs_real_t  x[])
+{
+  const double twopi = 6.2831853071795862;
+
+  uint32_t r[4][_PHILOX_BATCH];
+  double g[2*_PHILOX_BATCH];
+
+  /* Each block provides 2 values */
+
+  for (cs_lnum_t s_id = 0; s_id < n; s_id += 2*_PHILOX_BATCH) {
+
+    cs_lnum_t n_v = CS_MIN(n - s_id, 2*_PHILOX_BATCH);
+    int n_b = (n_v + 1) / 2;
+
+    _philox4x32_10(key, counter, s_id/2, n_b, r);
+
+#   pragma omp simd
+    for (int b = 0; b < n_b; b++) {
+      double r1 = twopi * _u32_to_double(r[0][b], r[1][b]);
+      double r2 = sqrt(-2.*(log(1. - _u32_to_double(r[2][b], r[3][b]))));
+      g[2*b]   = cos(r1) * r2;
+      g[2*b+1] = sin(r1) * r2;
+    }
+
+    for (cs_lnum_t i = 0; i < n_v; i++)
+      x[s_id + i] = g[i];
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Save static variables used by random number generator.
@@ -120,6 +120,52 @@ cs_random_poisson(cs_lnum_t  n,
                   cs_real_t  mu,
                   int        p[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based uniform distribution random number generator.
+ *
+ * Philox4x32-10 generator (Salmon et al., SC'11). Values depend only on
+ * the (key, counter) pair and on their position in the array, not on any
+ * internal state, so this function is thread-safe, and results do not
+ * depend on the number of ranks or threads as long as keys and counters
+ * are associated with the generating entity (for example a particle)
+ * rather than its local numbering. Different counter values (such as
+ * time step numbers) provide independent sequences for a given key.
+ *
+ * \param[in]   key      generator key
+ * \param[in]   counter  generator counter
+ * \param[in]   n        number of values to compute
+ * \param[out]  a        pseudo-random numbers following uniform distribution
+ *                       in [0, 1[
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_uniform(uint64_t   key,
+                          uint64_t   counter,
+                          cs_lnum_t  n,
+                          cs_real_t  a[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based normal distribution random number generator.
+ *
+ * Box-Muller method applied to uniform values from the same Philox4x32-10
+ * generator as \ref cs_random_counter_uniform; the same properties apply.
+ *
+ * \param[in]   key      generator key
+ * \param[in]   counter  generator counter
+ * \param[in]   n        number of values to compute
+ * \param[out]  x        pseudo-random numbers following normal distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_normal(uint64_t   key,
+                         uint64_t   counter,
+                         cs_lnum_t  n,
+                         cs_real_t  x[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Save static variables used by random number generator.
@@ -935,6 +935,63 @@ cs_range_set_sync(const cs_range_set_t  *rs,
   if (rs == NULL)
     return;
 
+  else if (rs->ifs != NULL) {
+    cs_range_set_sync_start(rs, datatype, stride, false, val);
+    cs_range_set_sync_wait(rs, datatype, stride, false, val);
+  }
+
+  else if (rs->halo != NULL) {
+    if (datatype == CS_REAL_TYPE) {
+      if (stride == 1)
+        cs_halo_sync_var(rs->halo, CS_HALO_STANDARD, val);
+      else
+        cs_halo_sync_var_strided(rs->halo, CS_HALO_STANDARD, val, stride);
+    }
+    else {
+      size_t d_size = cs_datatype_size[datatype]*stride;
+      cs_halo_sync_untyped(rs->halo, CS_HALO_STANDARD, d_size, val);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start synchronizing values elements associated with a range set.
+ *
+ * When the range set is associated with an interface set, this function
+ * posts the exchanges and returns without waiting for their completion,
+ * so that computations not involving the values may be overlapped with
+ * communication; \ref cs_range_set_sync_wait must then be called with the
+ * same arguments before the values are used. Several such synchronizations
+ * may be pending at the same time, as long as they apply to different
+ * value buffers.
+ *
+ * When the range set is associated with a halo, synchronization is
+ * completed here.
+ *
+ * If float_exchange is true and datatype is CS_DOUBLE, values are
+ * exchanged in single precision through interface sets (see
+ * \ref cs_interface_set_sum_start); this should be restricted to cases
+ * where the loss of precision is acceptable, such as preconditioning.
+ *
+ * \param[in]       rs              pointer to range set structure, or NULL
+ * \param[in]       datatype        type of data considered
+ * \param[in]       stride          number of values per entity (interlaced)
+ * \param[in]       float_exchange  exchange double values as floats
+ * \param[in, out]  val             values buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_range_set_sync_start(const cs_range_set_t  *rs,
+                        cs_datatype_t          datatype,
+                        cs_lnum_t              stride,
+                        bool                   float_exchange,
+                        void                  *val)
+{
+  if (rs == NULL)
+    return;
+
   else if (rs->ifs != NULL) {
     cs_lnum_t n_elts = rs->n_elts[1];
     _interface_set_zero_out_of_range(rs->ifs,
@@ -948,20 +1005,41 @@ cs_range_set_sync(const cs_range_set_t  *rs,
                                             datatype,
                                             stride,
                                             val);
-    cs_interface_set_sum(rs->ifs, n_elts, stride, true, datatype, val);
+    cs_interface_set_sum_start(rs->ifs, n_elts, stride, true, datatype,
+                               float_exchange, val);
   }
 
-  else if (rs->halo != NULL) {
-    if (datatype == CS_REAL_TYPE) {
-      if (stride == 1)
-        cs_halo_sync_var(rs->halo, CS_HALO_STANDARD, val);
-      else
-        cs_halo_sync_var_strided(rs->halo, CS_HALO_STANDARD, val, stride);
-    }
-    else {
-      size_t d_size = cs_datatype_size[datatype]*stride;
-      cs_halo_sync_untyped(rs->halo, CS_HALO_STANDARD, d_size, val);
-    }
+  else if (rs->halo != NULL)
+    cs_range_set_sync(rs, datatype, stride, val);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete synchronization of values elements associated with a
+ *        range set, started by \ref cs_range_set_sync_start.
+ *
+ * \param[in]       rs              pointer to range set structure, or NULL
+ * \param[in]       datatype        type of data considered
+ * \param[in]       stride          number of values per entity (interlaced)
+ * \param[in]       float_exchange  exchange double values as floats
+ * \param[in, out]  val             values buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_range_set_sync_wait(const cs_range_set_t  *rs,
+                       cs_datatype_t          datatype,
+                       cs_lnum_t              stride,
+                       bool                   float_exchange,
+                       void                  *val)
+{
+  if (rs == NULL)
+    return;
+
+  else if (rs->ifs != NULL) {
+    cs_lnum_t n_elts = rs->n_elts[1];
+    cs_interface_set_sum_wait(rs->ifs, n_elts, stride, true, datatype,
+                              float_exchange, val);
   }
 }
 
@@ -1061,6 +1139,39 @@ cs_range_set_scatter(const cs_range_set_t  *rs,
   if (rs == NULL)
     return;
 
+  cs_range_set_scatter_start(rs, datatype, stride, src_val, dest_val);
+  cs_range_set_sync_wait(rs, datatype, stride, false, dest_val);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start scattering element values associated with a range set to
+ *        the full set.
+ *
+ * This function is similar to \ref cs_range_set_scatter, but returns
+ * without waiting for the completion of parallel synchronization, which
+ * must be completed by calling \ref cs_range_set_sync_wait (with
+ * float_exchange set to false) on the destination buffer.
+ *
+ * \param[in]   rs        pointer to range set structure, or NULL
+ * \param[in]   datatype  type of data considered
+ * \param[in]   stride    number of values per entity (interlaced)
+ * \param[in]   src_val   source values buffer
+ * \param[out]  dest_val  destination values buffer (may be identical to
+ *                        src_val, in which case operation is "in-place")
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_range_set_scatter_start(const cs_range_set_t  *rs,
+                           cs_datatype_t          datatype,
+                           cs_lnum_t              stride,
+                           const void            *src_val,
+                           void                  *dest_val)
+{
+  if (rs == NULL)
+    return;
+
   else if (rs->halo != NULL) {
     cs_range_set_sync(rs, datatype, stride, dest_val);
     return;
@@ -1110,9 +1221,9 @@ cs_range_set_scatter(const cs_range_set_t  *rs,
 
   }
 
-  /* Now synchronize values */
+  /* Now start synchronizing values */
 
-  cs_range_set_sync(rs, datatype, stride, dest_val);
+  cs_range_set_sync_start(rs, datatype, stride, false, dest_val);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -258,6 +258,61 @@ cs_range_set_sync(const cs_range_set_t  *rs,
                   cs_lnum_t              stride,
                   void                  *val);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start synchronizing values elements associated with a range set.
+ *
+ * When the range set is associated with an interface set, this function
+ * posts the exchanges and returns without waiting for their completion,
+ * so that computations not involving the values may be overlapped with
+ * communication; \ref cs_range_set_sync_wait must then be called with the
+ * same arguments before the values are used. Several such synchronizations
+ * may be pending at the same time, as long as they apply to different
+ * value buffers.
+ *
+ * When the range set is associated with a halo, synchronization is
+ * completed here.
+ *
+ * If float_exchange is true and datatype is CS_DOUBLE, values are
+ * exchanged in single precision through interface sets (see
+ * \ref cs_interface_set_sum_start); this should be restricted to cases
+ * where the loss of precision is acceptable, such as preconditioning.
+ *
+ * \param[in]       rs              pointer to range set structure, or NULL
+ * \param[in]       datatype        type of data considered
+ * \param[in]       stride          number of values per entity (interlaced)
+ * \param[in]       float_exchange  exchange double values as floats
+ * \param[in, out]  val             values buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_range_set_sync_start(const cs_range_set_t  *rs,
+                        cs_datatype_t          datatype,
+                        cs_lnum_t              stride,
+                        bool                   float_exchange,
+                        void                  *val);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete synchronization of values elements associated with a
+ *        range set, started by \ref cs_range_set_sync_start.
+ *
+ * \param[in]       rs              pointer to range set structure, or NULL
+ * \param[in]       datatype        type of data considered
+ * \param[in]       stride          number of values per entity (interlaced)
+ * \param[in]       float_exchange  exchange double values as floats
+ * \param[in, out]  val             values buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_range_set_sync_wait(const cs_range_set_t  *rs,
+                       cs_datatype_t          datatype,
+                       cs_lnum_t              stride,
+                       bool                   float_exchange,
+                       void                  *val);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Gather element values associated with a range set to a compact set.
@@ -301,6 +356,32 @@ cs_range_set_scatter(const cs_range_set_t  *rs,
                      const void            *src_val,
                      void                  *dest_val);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start scattering element values associated with a range set to
+ *        the full set.
+ *
+ * This function is similar to \ref cs_range_set_scatter, but returns
+ * without waiting for the completion of parallel synchronization, which
+ * must be completed by calling \ref cs_range_set_sync_wait (with
+ * float_exchange set to false) on the destination buffer.
+ *
+ * \param[in]   rs        pointer to range set structure, or NULL
+ * \param[in]   datatype  type of data considered
+ * \param[in]   stride    number of values per entity (interlaced)
+ * \param[in]   src_val   source values buffer
+ * \param[out]  dest_val  destination values buffer (may be identical to
+ *                        src_val, in which case operation is "in-place")
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_range_set_scatter_start(const cs_range_set_t  *rs,
+                           cs_datatype_t          datatype,
+                           cs_lnum_t              stride,
+                           const void            *src_val,
+                           void                  *dest_val);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
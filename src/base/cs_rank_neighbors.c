@@ -40,6 +40,7 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "bft_error.h"
 #include "bft_mem.h"
 #include "bft_printf.h"
 
@@ -997,6 +998,114 @@ cs_rank_neighbors_sync_count_m(const cs_rank_neighbors_t      *n_send,
   _rank_neighbors_calls[2 + _exchange_type] += 1;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a distributed graph communicator matching send and
+ *        receive rank neighborhoods.
+ *
+ * This is a collective operation over the given communicator, so it
+ * must be called by all its ranks. The resulting communicator may be
+ * used with MPI neighborhood collectives, and must be freed by the caller
+ * using MPI_Comm_free.
+ *
+ * Ranks are not reordered, so the rank of each process in the resulting
+ * communicator is the same as in the parent communicator.
+ *
+ * \param[in]  n_send       pointer to rank neighborhood used for sending
+ * \param[in]  n_recv       pointer to rank neighborhood used for receiving
+ * \param[in]  send_weight  optional send edge weights (size: n_send->size),
+ *                          or NULL
+ * \param[in]  recv_weight  optional receive edge weights
+ *                          (size: n_recv->size), or NULL
+ *
+ * If weights are given on any rank, the graph is weighted, and unit
+ * weights are used where they are missing.
+ * \param[in]  comm         associated communicator
+ *
+ * \return  distributed graph communicator
+ */
+/*----------------------------------------------------------------------------*/
+
+MPI_Comm
+cs_rank_neighbors_create_graph_comm(const cs_rank_neighbors_t  *n_send,
+                                    const cs_rank_neighbors_t  *n_recv,
+                                    const int                  *send_weight,
+                                    const int                  *recv_weight,
+                                    MPI_Comm                    comm)
+{
+  MPI_Comm graph_comm = MPI_COMM_NULL;
+
+#if (MPI_VERSION >= 3)
+
+  /* MPI requires all ranks to agree on whether the graph is weighted,
+     and both directions to be weighted or unweighted; weights may be
+     given on some ranks only (for example ranks with no neighbors),
+     so the decision is collective, and unit weights are used for
+     missing ones. */
+
+  int l_weighted = (send_weight != NULL || recv_weight != NULL) ? 1 : 0;
+  int weighted = 0;
+  MPI_Allreduce(&l_weighted, &weighted, 1, MPI_INT, MPI_MAX, comm);
+
+  int *_send_weight = NULL, *_recv_weight = NULL;
+  const int *s_weight = MPI_UNWEIGHTED, *r_weight = MPI_UNWEIGHTED;
+
+  if (weighted) {
+
+    if (n_send->size == 0)
+      s_weight = MPI_WEIGHTS_EMPTY;
+    else if (send_weight != NULL)
+      s_weight = send_weight;
+    else {
+      BFT_MALLOC(_send_weight, n_send->size, int);
+      for (int i = 0; i < n_send->size; i++)
+        _send_weight[i] = 1;
+      s_weight = _send_weight;
+    }
+
+    if (n_recv->size == 0)
+      r_weight = MPI_WEIGHTS_EMPTY;
+    else if (recv_weight != NULL)
+      r_weight = recv_weight;
+    else {
+      BFT_MALLOC(_recv_weight, n_recv->size, int);
+      for (int i = 0; i < n_recv->size; i++)
+        _recv_weight[i] = 1;
+      r_weight = _recv_weight;
+    }
+
+  }
+
+  MPI_Dist_graph_create_adjacent(comm,
+                                 n_recv->size,
+                                 n_recv->rank,
+                                 r_weight,
+                                 n_send->size,
+                                 n_send->rank,
+                                 s_weight,
+                                 MPI_INFO_NULL,
+                                 0, /* no reorder */
+                                 &graph_comm);
+
+  BFT_FREE(_recv_weight);
+  BFT_FREE(_send_weight);
+
+#else
+
+  CS_UNUSED(n_send);
+  CS_UNUSED(n_recv);
+  CS_UNUSED(send_weight);
+  CS_UNUSED(recv_weight);
+  CS_UNUSED(comm);
+
+  bft_error(__FILE__, __LINE__, 0,
+            _("%s requires MPI 3 or above."), __func__);
+
+#endif /* (MPI_VERSION >= 3) */
+
+  return graph_comm;
+}
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------*/
@@ -216,6 +216,34 @@ cs_rank_neighbors_sync_count_m(const cs_rank_neighbors_t      *n_send,
                                cs_rank_neighbors_exchange_t    exchange_type,
                                MPI_Comm                        comm);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a distributed graph communicator matching send and
+ *        receive rank neighborhoods.
+ *
+ * This is a collective operation over the given communicator. The resulting
+ * communicator may be used with MPI neighborhood collectives, and must be
+ * freed by the caller using MPI_Comm_free.
+ *
+ * \param[in]  n_send       pointer to rank neighborhood used for sending
+ * \param[in]  n_recv       pointer to rank neighborhood used for receiving
+ * \param[in]  send_weight  optional send edge weights (size: n_send->size),
+ *                          or NULL
+ * \param[in]  recv_weight  optional receive edge weights
+ *                          (size: n_recv->size), or NULL
+ * \param[in]  comm         associated communicator
+ *
+ * \return  distributed graph communicator
+ */
+/*----------------------------------------------------------------------------*/
+
+MPI_Comm
+cs_rank_neighbors_create_graph_comm(const cs_rank_neighbors_t  *n_send,
+                                    const cs_rank_neighbors_t  *n_recv,
+                                    const int                  *send_weight,
+                                    const int                  *recv_weight,
+                                    MPI_Comm                    comm);
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------*/
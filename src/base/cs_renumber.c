@@ -88,16 +88,21 @@ extern "C" {
 
 #include "fvm_morton.h"
 #include "fvm_hilbert.h"
+#include "fvm_selector.h"
 
 #include "cs_defs.h"
+#include "cs_boundary_zone.h"
 #include "cs_halo.h"
 #include "cs_join.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
 #include "cs_order.h"
 #include "cs_parall.h"
 #include "cs_post.h"
 #include "cs_sort.h"
+#include "cs_timer.h"
 #include "cs_prototypes.h"
 
 /*----------------------------------------------------------------------------
@@ -134,8 +139,16 @@ BEGIN_C_DECLS
        Order cells using domain-local Morton space-filling curve.
   \var CS_RENUMBER_CELLS_HILBERT
        Order cells using domain-local Hilbert space-filling curve.
+  \var CS_RENUMBER_CELLS_HILBERT_TILES
+       Order cells using domain-local Hilbert space-filling curve,
+       and split the curve into cache-sized tiles of contiguous cells;
+       with multipass interior face numbering, faces of each thread
+       are then ordered tile by tile.
   \var CS_RENUMBER_CELLS_RCM
        Order cells using domain-local reverse Cuthill-McKee algorithm.
+  \var CS_RENUMBER_CELLS_AUTO
+       Try several cell numbering algorithms on the local partition,
+       and keep the one with the fastest (benchmarked) face loop.
   \var CS_RENUMBER_CELLS_NONE
        No cells renumbering.
 
@@ -154,6 +167,11 @@ BEGIN_C_DECLS
   \var CS_RENUMBER_I_FACES_SIMD
        Renumber to allow SIMD operations in interior face->cell gather
        operations (such as SpMV products with native matrix representation).
+  \var CS_RENUMBER_I_FACES_COLOR
+       Use a distance-1 coloring of interior faces (no two faces of
+       a given color share a cell), with one group per color.
+       This should produce a small number of groups of similar size,
+       each split evenly across threads.
   \var CS_RENUMBER_I_FACES_NONE
        No interior face renumbering.
 
@@ -167,6 +185,10 @@ BEGIN_C_DECLS
   \var CS_RENUMBER_I_FACES_SIMD
        Renumber to allow SIMD operations in boundary face->cell gather
        operations.
+  \var CS_RENUMBER_B_FACES_ZONE
+       Renumber for threads as with CS_RENUMBER_B_FACES_THREAD, with faces
+       ordered by boundary zone inside each thread block, so that zones
+       are defined by contiguous ranges in each block.
   \var CS_RENUMBER_I_FACES_NONE
        No interior face renumbering.
 
@@ -217,6 +239,16 @@ static int _cs_renumber_n_threads = 0;
 static cs_lnum_t  _min_i_subset_size = 256;
 static cs_lnum_t  _min_b_subset_size = 256;
 
+/* Cells per tile for tiled numbering (2048 cells with 16 values
+   of 8 bytes each use 256 KiB, which fits in most L2 caches) */
+
+static cs_lnum_t  _cells_tile_size = 2048;
+
+/* Re-initialize mesh arrays after renumbering for NUMA first touch
+   (-1: if multiple threads are used; 0: no; 1: yes) */
+
+static int _first_touch = -1;
+
 static bool _renumber_ghost_cells = true;
 static bool _cells_adjacent_to_halo_last = false;
 static bool _i_faces_adjacent_to_halo_last = false;
@@ -252,18 +284,22 @@ static const char *_cell_renum_name[]
      N_("fill-reducing ordering with METIS"),
      N_("Morton curve in local bounding box"),
      N_("Hilbert curve in local bounding box"),
+     N_("Hilbert curve in local bounding box, cache-sized tiles"),
      N_("Reverse Cuthill-McKee"),
+     N_("automatic selection"),
      N_("no renumbering")};
 
 static const char *_i_face_renum_name[]
   = {N_("coloring, no shared cell in block"),
      N_("multipass"),
      N_("vectorizing"),
+     N_("distance-1 coloring"),
      N_("adjacent cells")};
 
 static const char *_b_face_renum_name[]
   = {N_("no shared cell across threads"),
      N_("vectorizing"),
+     N_("no shared cell across threads, ordered by zone"),
      N_("adjacent cells")};
 
 static const char *_vertices_renum_name[]
@@ -2523,6 +2559,84 @@ _renum_face_multipass(cs_mesh_t    *mesh,
   return 0;
 }
 
+/*----------------------------------------------------------------------------
+ * Order interior faces tile by tile inside each group and thread subset.
+ *
+ * Tiles are ranges of tile_size contiguous cells (strips along the
+ * space-filling curve when cells are numbered accordingly). Each face is
+ * associated with the tile of its highest local adjacent cell id, so that
+ * a thread handles faces of a given tile and its boundary with previous
+ * tiles before moving to the next tile, keeping a cache-sized working set.
+ *
+ * As faces are only permuted inside a given subset, the thread safety
+ * of the group/thread numbering is preserved.
+ *
+ * parameters:
+ *   mesh           <-- pointer to global mesh structure
+ *   tile_size      <-- number of cells per tile
+ *   n_i_threads    <-- number of threads required for interior faces
+ *   n_i_groups     <-- number of groups of interior faces
+ *   i_group_index  <-- group/thread index
+ *   new_to_old_i   <-> interior faces renumbering array
+ *----------------------------------------------------------------------------*/
+
+static void
+_renum_i_faces_by_tile(const cs_mesh_t  *mesh,
+                       cs_lnum_t         tile_size,
+                       int               n_i_threads,
+                       int               n_i_groups,
+                       const cs_lnum_t   i_group_index[],
+                       cs_lnum_t         new_to_old_i[])
+{
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_faces = mesh->n_i_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)mesh->i_face_cells;
+
+  cs_lnum_t *number, *order, *_new_to_old;
+
+  if (tile_size < 1 || n_faces < 1)
+    return;
+
+  BFT_MALLOC(number, n_faces*3, cs_lnum_t);
+
+  /* Sort keys: subset (thread and group), tile, previous position */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      cs_lnum_t s_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+      cs_lnum_t e_id = i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+      cs_lnum_t subset_id = g_id*n_i_threads + t_id;
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+        cs_lnum_t f_id = new_to_old_i[i];
+        cs_lnum_t c_id_0 = i_face_cells[f_id][0];
+        cs_lnum_t c_id_1 = i_face_cells[f_id][1];
+        cs_lnum_t c_id = CS_MAX(c_id_0, c_id_1);
+        if (c_id >= n_cells)
+          c_id = CS_MIN(c_id_0, c_id_1);
+        number[i*3] = subset_id;
+        number[i*3 + 1] = c_id / tile_size;
+        number[i*3 + 2] = i;
+      }
+    }
+  }
+
+  BFT_MALLOC(order, n_faces, cs_lnum_t);
+
+  cs_order_lnum_allocated_s(NULL, number, 3, order, n_faces);
+
+  BFT_FREE(number);
+
+  BFT_MALLOC(_new_to_old, n_faces, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_faces; i++)
+    _new_to_old[i] = new_to_old_i[order[i]];
+
+  memcpy(new_to_old_i, _new_to_old, n_faces*sizeof(cs_lnum_t));
+
+  BFT_FREE(_new_to_old);
+  BFT_FREE(order);
+}
+
 /*----------------------------------------------------------------------------
  * Compute renumbering of faces using groups in which no two faces share
  * a cell.
@@ -2582,6 +2696,169 @@ _renum_i_faces_no_share_cell_in_block(cs_mesh_t    *mesh,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute renumbering of interior faces using a distance-1 coloring.
+ *
+ * No two faces of a given color share a cell, so each color may be used
+ * as a group, with faces split evenly across threads. To balance colors,
+ * each face is assigned the least populated color among those available,
+ * considering only the first max_degree + 1 colors (where max_degree is
+ * the maximum number of interior faces per cell) unless none of those is
+ * available. Inside each color, faces keep their previous (cell adjacency)
+ * relative order, so that each thread works on a contiguous range of cells.
+ *
+ * parameters:
+ *   mesh           <-> pointer to global mesh structure
+ *   n_i_threads    <-- number of threads required for interior faces
+ *   new_to_old_i   --> interior faces renumbering array
+ *   n_i_groups     --> number of groups of interior faces
+ *   i_group_index  --> group/thread index
+ *
+ * returns:
+ *   0 on success, -1 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_renum_i_faces_color(cs_mesh_t    *mesh,
+                     int           n_i_threads,
+                     cs_lnum_t     new_to_old_i[],
+                     int          *n_i_groups,
+                     cs_lnum_t   **i_group_index)
+{
+  const int n_colors_max = 64;
+
+  const cs_lnum_t n_faces = mesh->n_i_faces;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)(mesh->i_face_cells);
+
+  int retval = 0;
+
+  if (n_faces <= _min_i_subset_size)
+    return -1;
+
+  uint64_t *cell_colors;
+  cs_lnum_t *n_cell_faces;
+  int *f_color;
+
+  BFT_MALLOC(cell_colors, n_cells_ext, uint64_t);
+  BFT_MALLOC(n_cell_faces, n_cells_ext, cs_lnum_t);
+  BFT_MALLOC(f_color, n_faces, int);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    cell_colors[c_id] = 0;
+    n_cell_faces[c_id] = 0;
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+    n_cell_faces[i_face_cells[f_id][0]] += 1;
+    n_cell_faces[i_face_cells[f_id][1]] += 1;
+  }
+
+  cs_lnum_t max_degree = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+    max_degree = CS_MAX(max_degree, n_cell_faces[c_id]);
+
+  BFT_FREE(n_cell_faces);
+
+  const int n_colors_target = CS_MIN(max_degree + 1, n_colors_max);
+
+  cs_lnum_t color_size[64];
+  for (int i = 0; i < n_colors_max; i++)
+    color_size[i] = 0;
+
+  int n_colors = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_faces && retval == 0; f_id++) {
+
+    cs_lnum_t c_id_0 = i_face_cells[f_id][0];
+    cs_lnum_t c_id_1 = i_face_cells[f_id][1];
+
+    uint64_t used = cell_colors[c_id_0] | cell_colors[c_id_1];
+
+    int f_c = -1;
+
+    /* Least populated available color among target colors */
+
+    for (int i = 0; i < n_colors_target; i++) {
+      if (! (used & ((uint64_t)1 << i))) {
+        if (f_c < 0 || color_size[i] < color_size[f_c])
+          f_c = i;
+      }
+    }
+
+    /* Otherwise, first available color */
+
+    for (int i = n_colors_target; i < n_colors_max && f_c < 0; i++) {
+      if (! (used & ((uint64_t)1 << i)))
+        f_c = i;
+    }
+
+    if (f_c < 0) {
+      retval = -1;
+      break;
+    }
+
+    f_color[f_id] = f_c;
+    color_size[f_c] += 1;
+    cell_colors[c_id_0] |= ((uint64_t)1 << f_c);
+    cell_colors[c_id_1] |= ((uint64_t)1 << f_c);
+
+    if (f_c >= n_colors)
+      n_colors = f_c + 1;
+
+  }
+
+  BFT_FREE(cell_colors);
+
+  if (retval != 0) {
+    BFT_FREE(f_color);
+    return retval;
+  }
+
+  /* Remove empty colors and order faces by color (stable) */
+
+  int n_groups = 0;
+  int color_group[64];
+  cs_lnum_t *g_size;
+  BFT_MALLOC(g_size, n_colors, cs_lnum_t);
+
+  for (int i = 0; i < n_colors; i++) {
+    color_group[i] = -1;
+    if (color_size[i] > 0) {
+      color_group[i] = n_groups;
+      g_size[n_groups] = color_size[i];
+      n_groups++;
+    }
+  }
+
+  cs_lnum_t g_shift[65];
+  g_shift[0] = 0;
+  for (int g_id = 0; g_id < n_groups; g_id++)
+    g_shift[g_id+1] = g_shift[g_id] + g_size[g_id];
+
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+    int g_id = color_group[f_color[f_id]];
+    new_to_old_i[g_shift[g_id]] = f_id;
+    g_shift[g_id] += 1;
+  }
+
+  BFT_FREE(f_color);
+
+  BFT_MALLOC(*i_group_index, n_i_threads*n_groups*2, cs_lnum_t);
+
+  retval = _thread_bounds_by_group_size(n_faces,
+                                        n_groups,
+                                        n_i_threads,
+                                        g_size,
+                                        *i_group_index);
+
+  BFT_FREE(g_size);
+
+  *n_i_groups = n_groups;
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Compute renumbering of boundary faces for threads.
  *
@@ -2680,238 +2957,300 @@ _renum_b_faces_no_share_cell_across_thread(cs_mesh_t   *mesh,
 }
 
 /*----------------------------------------------------------------------------
- * Compute renumbering of interior faces for vectorizing.
+ * Compute the boundary zone id associated with each boundary face, based
+ * on the current zone definitions.
  *
- * parameters:
- *   mesh         <-> pointer to global mesh structure
- *   vector_size  <-- target size for groups
- *   group_size   <-- target group size
- *   new_to_old_i --> interior faces renumbering array
+ * As this is called before selectors and mesh quantities are available,
+ * a temporary selector is used. Zones defined by a function or varying
+ * in time are ignored, so the result is only a hint for face ordering.
  *
- * returns:
- *   0 on success, -1 otherwise
-  *----------------------------------------------------------------------------*/
+ * parameters:
+ *   mesh     <-> pointer to global mesh structure
+ *   zone_id  --> associated zone id, or 0 (size: n_b_faces)
+ *----------------------------------------------------------------------------*/
 
-static int
-_renum_i_faces_for_vectorizing(cs_mesh_t  *mesh,
-                               int         vector_size,
-                               cs_lnum_t   new_to_old_i[])
+static void
+_b_face_zone_ids(cs_mesh_t  *mesh,
+                 int         zone_id[])
 {
-  int retval = -1;
-
-  const cs_lnum_t n_i_faces = mesh->n_i_faces;
-  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)(mesh->i_face_cells);
-
-  /* Initialize variables to avoid compiler warnings */
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
 
-  cs_lnum_t swap_id = -1;
+  for (cs_lnum_t i = 0; i < n_b_faces; i++)
+    zone_id[i] = 0;
 
-  /* Initialization */
+  const int n_zones = cs_boundary_zone_n_zones();
 
-  for (cs_lnum_t face_id = 0; face_id < mesh->n_i_faces; face_id++)
-    new_to_old_i[face_id] = face_id;
+  if (n_zones < 2 || n_b_faces < 1)
+    return;
 
-  /* Order interior faces (we choose to place the "remainder" at the end) */
+  fvm_group_class_set_t *class_defs = cs_mesh_create_group_classes(mesh);
 
-  /* determine remainder and number of complete registers */
+  cs_real_t *b_face_cog = NULL, *b_face_normal = NULL;
+  cs_mesh_quantities_b_faces(mesh, &b_face_cog, &b_face_normal);
 
-  cs_lnum_t irelii = n_i_faces % vector_size;
-  cs_lnum_t nregii = n_i_faces / vector_size;
+  fvm_selector_t *select_b_faces = fvm_selector_create(mesh->dim,
+                                                       n_b_faces,
+                                                       class_defs,
+                                                       mesh->b_face_family,
+                                                       1,
+                                                       b_face_cog,
+                                                       b_face_normal);
 
-  /* External loop */
+  cs_lnum_t *elt_ids;
+  BFT_MALLOC(elt_ids, n_b_faces, cs_lnum_t);
 
-  for (int loop_id = 0; loop_id < 100; loop_id++) {
+  /* Later zones have priority, as when building zones with overlays */
 
-    int mod_prev = 0; /* indicates if elements were exchanged in array new_to_old_i */
+  for (int z_id = 1; z_id < n_zones; z_id++) {
 
-    cs_lnum_t iregic = 0; /* Previous register */
+    const cs_zone_t *z = cs_boundary_zone_by_id(z_id);
+    if (z->time_varying)
+      continue;
 
-    cs_lnum_t block_id = 0;  /* Counter to avoid exchanging all elements
-                                of new_to_old_i more than n times */
+    const char *criteria
+      = cs_mesh_location_get_selection_string(z->location_id);
+    if (criteria == NULL)
+      continue;
 
-    /* Loop on elements of new_to_old_i */
+    cs_lnum_t n_elts = 0;
+    fvm_selector_get_list(select_b_faces, criteria, 0, &n_elts, elt_ids);
 
-    for (cs_lnum_t jj = 0;
-         jj < mesh->n_i_faces && block_id > -1;
-         jj++) {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      zone_id[elt_ids[i]] = z_id;
 
-      cs_lnum_t last_id, inext;
+  }
 
-      /* Current register and position inside it */
+  BFT_FREE(elt_ids);
 
-      cs_lnum_t iregip = iregic;
-      cs_lnum_t jregic = (jj % vector_size) + 1;
-      iregic = jj / vector_size + 1;
+  select_b_faces = fvm_selector_destroy(select_b_faces);
 
-      /* Test between last_id, start of register, and current position;
-         take the worst case between remainder at beginning and end:
-         remaninder at beginning */
+  BFT_FREE(b_face_normal);
+  BFT_FREE(b_face_cog);
 
-      if (iregic == 1)
-        last_id = 0;
-      else if (jregic <= irelii)
-        last_id = (iregic-2)*vector_size+irelii;
-      else
-        last_id = (iregic-1)*vector_size;
-
-      /* Swap starting from inext, start of next register */
+  class_defs = fvm_group_class_set_destroy(class_defs);
+}
 
-      if ((iregic == nregii && jregic > irelii) || (iregic == nregii+1))
-        inext = 0;
-      else if (jregic > irelii)
-        inext = iregic*vector_size+irelii;
-      else
-        inext = iregic*vector_size;
+/*----------------------------------------------------------------------------
+ * Stable counting sort of a range of a renumbering array based on
+ * an integer key.
+ *
+ * parameters:
+ *   s_id        <-- start id of range
+ *   e_id        <-- end id of range (excluded)
+ *   n_keys      <-- number of key values
+ *   key         <-- key associated with each element, in [0, n_keys[
+ *   key_idx     <-> work array (size: n_keys + 1)
+ *   tmp_ids     <-> work array (size: e_id)
+ *   new_to_old  <-> renumbering array
+ *----------------------------------------------------------------------------*/
 
-      if (iregic != iregip) swap_id = inext - 1;
+static void
+_sort_range_by_key(cs_lnum_t        s_id,
+                   cs_lnum_t        e_id,
+                   int              n_keys,
+                   const int        key[],
+                   cs_lnum_t        key_idx[],
+                   cs_lnum_t        tmp_ids[],
+                   cs_lnum_t        new_to_old[])
+{
+  for (int k = 0; k < n_keys + 1; k++)
+    key_idx[k] = 0;
 
-      block_id = 0;
+  for (cs_lnum_t i = s_id; i < e_id; i++)
+    key_idx[key[new_to_old[i]] + 1] += 1;
 
-      /* Test with all preceding elements since last_id:
-       * swap_id indicates with which element of new_to_old_i we swap
-       * mod_prev indicates we modify an already seen element
-       * block_id indicates we have seen all elements and we must mix
-       * (there is no solution) */
+  key_idx[0] = s_id;
+  for (int k = 0; k < n_keys; k++)
+    key_idx[k + 1] += key_idx[k];
 
-      bool test_all_since_last = true;
+  for (cs_lnum_t i = s_id; i < e_id; i++) {
+    cs_lnum_t e_id_old = new_to_old[i];
+    tmp_ids[key_idx[key[e_id_old]]++] = e_id_old;
+  }
 
-      while (test_all_since_last) {
+  for (cs_lnum_t i = s_id; i < e_id; i++)
+    new_to_old[i] = tmp_ids[i];
+}
 
-        test_all_since_last = false;
-        cs_lnum_t face_id = new_to_old_i[jj];
+/*----------------------------------------------------------------------------
+ * Order boundary faces by zone inside each thread block.
+ *
+ * Faces are ordered by zone, then by family, using stable sorts, so that
+ * their relative order (by adjacent cell) is maintained for a given
+ * zone and family. As selectors list elements by group class, zones
+ * defined by groups are then contiguous ranges in each block. Since faces
+ * stay in their thread block, no cell is shared across threads.
+ *
+ * parameters:
+ *   mesh          <-> pointer to global mesh structure
+ *   n_b_threads   <-- number of threads (blocks)
+ *   b_group_index <-- start and end ids for each thread
+ *                     (size: n_b_threads*2)
+ *   new_to_old_b  <-> boundary faces renumbering array
+ *----------------------------------------------------------------------------*/
 
-        for (cs_lnum_t ii = last_id; ii < jj; ii++) {
+static void
+_renum_b_faces_by_zone(cs_mesh_t        *mesh,
+                       int               n_b_threads,
+                       const cs_lnum_t   b_group_index[],
+                       cs_lnum_t         new_to_old_b[])
+{
+  const int n_zones = cs_boundary_zone_n_zones();
 
-          cs_lnum_t cn0 = i_face_cells[new_to_old_i[ii]][0];
-          cs_lnum_t cn1 = i_face_cells[new_to_old_i[ii]][1];
-          cs_lnum_t cr0 = i_face_cells[face_id][0];
-          cs_lnum_t cr1 = i_face_cells[face_id][1];
+  if (n_zones < 2)
+    return;
 
-          if (cn0 == cr0 || cn1 == cr1 || cn0 == cr1 || cn1 == cr0) {
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
 
-            swap_id += 1;
+  int *zone_id, *family_id;
+  BFT_MALLOC(zone_id, n_b_faces, int);
+  BFT_MALLOC(family_id, n_b_faces, int);
 
-            if (swap_id >= n_i_faces) {
-              swap_id = 0;
-              block_id = block_id + 1;
-            }
-            if (swap_id < jj) mod_prev = 1;
-            if (block_id >= 2) {
-              block_id = -1;
-              break;
-            }
+  _b_face_zone_ids(mesh, zone_id);
 
-            cs_lnum_t itmp = new_to_old_i[swap_id];
-            new_to_old_i[swap_id] = new_to_old_i[jj];
-            new_to_old_i[jj] = itmp;
+  int n_families = 1;
+  for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+    family_id[i] = CS_MAX(mesh->b_face_family[i], 0);
+    n_families = CS_MAX(n_families, family_id[i] + 1);
+  }
 
-            test_all_since_last = true;
-            break;
+  cs_lnum_t *key_idx, *tmp_ids;
+  BFT_MALLOC(key_idx, CS_MAX(n_zones, n_families) + 1, cs_lnum_t);
+  BFT_MALLOC(tmp_ids, n_b_faces, cs_lnum_t);
 
-          }
+  for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-        }
+    cs_lnum_t s_id = b_group_index[t_id*2];
+    cs_lnum_t e_id = b_group_index[t_id*2 + 1];
 
-      } /* test_all_since_last */;
+    _sort_range_by_key(s_id, e_id, n_families, family_id,
+                       key_idx, tmp_ids, new_to_old_b);
+    _sort_range_by_key(s_id, e_id, n_zones, zone_id,
+                       key_idx, tmp_ids, new_to_old_b);
 
-    } /* loop on jj (faces) */
+  }
 
-    /* If we did not touch elements preceding the current one,
-       the algorithm has succeeded */
+  BFT_FREE(tmp_ids);
+  BFT_FREE(key_idx);
+  BFT_FREE(family_id);
+  BFT_FREE(zone_id);
+}
 
-    if (mod_prev == 0 && block_id > -1) {
-      retval = 0;
-      break;
-    }
+/*----------------------------------------------------------------------------
+ * Compute renumbering of interior faces for vectorizing.
+ *
+ * Faces are assigned (in their current order) to consecutive blocks of
+ * vector_size faces, each face being placed in the current block only if
+ * none of its adjacent cells is already referenced by that block; faces
+ * which could not be placed are considered again for following blocks.
+ *
+ * All blocks are thus conflict-free by construction, so that vector
+ * operations may be used inside each block without conflict detection.
+ * Faces remaining when no complete block can be built any more are
+ * placed at the end, and should be handled in scalar mode.
+ *
+ * parameters:
+ *   mesh         <-> pointer to global mesh structure
+ *   vector_size  <-- target size for groups
+ *   new_to_old_i --> interior faces renumbering array
+ *   n_block_i    --> number of interior faces in complete blocks
+ *
+ * returns:
+ *   0 on success, -1 otherwise
+  *----------------------------------------------------------------------------*/
 
-    /* Shuffle if there is no solution or we looped 10 times */
+static int
+_renum_i_faces_for_vectorizing(cs_mesh_t  *mesh,
+                               int         vector_size,
+                               cs_lnum_t   new_to_old_i[],
+                               cs_lnum_t  *n_block_i)
+{
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)(mesh->i_face_cells);
 
-    if (loop_id < 100 && (((loop_id+1)%10 == 0) || block_id == -1)) {
-      for (cs_lnum_t ii = 0; ii < (n_i_faces-4)/2; ii += 2) {
-        cs_lnum_t jj = n_i_faces-ii-1;
-        cs_lnum_t itmp = new_to_old_i[ii];
-        new_to_old_i[ii] = new_to_old_i[jj];
-        new_to_old_i[jj] = itmp;
-      }
-    }
+  *n_block_i = 0;
 
-  } /* Loop on loop_id */
+  if (n_i_faces < vector_size)
+    return -1;
 
-  /* Checks */
+  cs_lnum_t *cell_block, *next;
 
-  if (retval == 0) {
+  BFT_MALLOC(cell_block, n_cells_ext, cs_lnum_t);
+  BFT_MALLOC(next, n_i_faces + 1, cs_lnum_t);
 
-    cs_lnum_t iok = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+    cell_block[c_id] = -1;
 
-    cs_lnum_t *order;
-    BFT_MALLOC(order, n_i_faces, cs_lnum_t);
-    cs_order_lnum_allocated(NULL, new_to_old_i, order, n_i_faces);
+  /* Linked list of faces not assigned yet, with head at n_i_faces */
 
-    for (cs_lnum_t ii = 0; ii < n_i_faces; ii++) {
-      if (new_to_old_i[order[ii]] !=  n_i_faces-ii-1)
-        iok -= 1;
-    }
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++)
+    next[f_id] = f_id + 1;
+  next[n_i_faces] = 0;
 
-    BFT_FREE(order);
+  cs_lnum_t n_new = 0;
+  cs_lnum_t block_id = 0;
 
-    /* Classical test looping on previous faces */
+  while (n_i_faces - n_new >= vector_size) {
 
-    if (iok == 0) {
+    cs_lnum_t b_size = 0;
+    cs_lnum_t prev = n_i_faces;
 
-      for (cs_lnum_t jj = 0; jj < mesh->n_i_faces; jj++) {
+    for (cs_lnum_t f_id = next[n_i_faces];
+         f_id < n_i_faces && b_size < vector_size;
+         f_id = next[f_id]) {
 
-        /* Current register and position inside it */
+      cs_lnum_t c_id_0 = i_face_cells[f_id][0];
+      cs_lnum_t c_id_1 = i_face_cells[f_id][1];
 
-        cs_lnum_t iregic = jj / vector_size + 1;
-        cs_lnum_t jregic = (jj % vector_size) + 1;
+      if (cell_block[c_id_0] == block_id || cell_block[c_id_1] == block_id)
+        prev = f_id;
 
-        /* Test between last_id, start of register, and current position;
-           take the worst case between remainder at beginning and end:
-           remaninder at beginning */
+      else {
+        cell_block[c_id_0] = block_id;
+        cell_block[c_id_1] = block_id;
+        new_to_old_i[n_new + b_size] = f_id;
+        b_size++;
+        next[prev] = next[f_id];
+      }
 
-        cs_lnum_t last_id;
+    }
 
-        if (iregic == 1)
-          last_id = 0;
-        else if (jregic < irelii)
-          last_id = (iregic-2)*vector_size+irelii;
-        else
-          last_id = (iregic-1)*vector_size;
+    /* Faces of an incomplete block are left for the remainder */
 
-        /* Test with all preceding elements since last_id */
+    if (b_size < vector_size)
+      break;
 
-        for (cs_lnum_t ii = last_id; ii < jj; ii++) {
+    n_new += b_size;
+    block_id++;
 
-          cs_lnum_t face_id = new_to_old_i[jj];
+  }
 
-          cs_lnum_t cn0 = i_face_cells[new_to_old_i[ii]][0];
-          cs_lnum_t cn1 = i_face_cells[new_to_old_i[ii]][1];
-          cs_lnum_t cr0 = i_face_cells[face_id][0];
-          cs_lnum_t cr1 = i_face_cells[face_id][1];
+  *n_block_i = n_new;
 
-          if (cn0 == cr0 || cn1 == cr1 || cn0 == cr1 || cn1 == cr0)
-            iok -= 1;
+  /* Remaining faces are placed last, in the current order;
+     faces of an incomplete last block were unlinked, so use markers */
 
-        }
-      }
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++)
+    next[f_id] = 0;
+  for (cs_lnum_t i = 0; i < n_new; i++)
+    next[new_to_old_i[i]] = 1;
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (next[f_id] == 0)
+      new_to_old_i[n_new++] = f_id;
+  }
 
-    }
+  assert(n_new == n_i_faces);
 
-    if (iok != 0 && mesh->verbosity > 2) {
-      cs_base_warn(__FILE__, __LINE__);
-      bft_printf(_("Faces renumbering for vectorization:\n"
-                   "====================================\n\n"
-                   "%llu errors in interior face renumbering array.\n\n"
-                   "Faces are not renumbered, and vectorization of face loops\n"
-                   "will not be forced.\n"), (unsigned long long)iok);
-      retval = -1;
-    }
+  BFT_FREE(next);
+  BFT_FREE(cell_block);
 
-  }
+  /* Renumbering is not considered useful if only the remainder is left */
 
-  /* Return value */
+  if (*n_block_i == 0)
+    return -1;
 
-  return retval;
+  return 0;
 }
 
 /*----------------------------------------------------------------------------
@@ -4485,6 +4824,247 @@ _renum_cells_rcm(const cs_mesh_t  *mesh,
   BFT_FREE(rl);
 }
 
+/*----------------------------------------------------------------------------
+ * Evaluate the quality of a given cell renumbering.
+ *
+ * Interior faces are ordered lexicographically relative to renumbered
+ * cells (as will be done by interior face renumbering), and a face-based
+ * SpMV-like loop is timed, keeping the best of several measures.
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   new_to_old  <-- new to old cell renumbering, or NULL for current
+ *   bandwidth   --> matrix bandwidth
+ *   profile     --> matrix profile / lines
+ *
+ * returns:
+ *   elapsed time for one face loop
+ *----------------------------------------------------------------------------*/
+
+static double
+_renum_cells_evaluate(const cs_mesh_t  *mesh,
+                      const cs_lnum_t   new_to_old[],
+                      cs_lnum_t        *bandwidth,
+                      cs_gnum_t        *profile)
+{
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t n_faces = mesh->n_i_faces;
+
+  cs_lnum_t *old_to_new, *fc_num, *order, *max_distance;
+  cs_lnum_2_t *fc;
+  cs_real_t *x, *y;
+
+  BFT_MALLOC(old_to_new, n_cells_ext, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+    old_to_new[i] = i;
+  if (new_to_old != NULL) {
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      old_to_new[new_to_old[i]] = i;
+  }
+
+  BFT_MALLOC(fc_num, n_faces*2, cs_lnum_t);
+
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+    cs_lnum_t c_id_0 = old_to_new[mesh->i_face_cells[f_id][0]];
+    cs_lnum_t c_id_1 = old_to_new[mesh->i_face_cells[f_id][1]];
+    fc_num[f_id*2] = CS_MIN(c_id_0, c_id_1);
+    fc_num[f_id*2 + 1] = CS_MAX(c_id_0, c_id_1);
+  }
+
+  BFT_FREE(old_to_new);
+
+  BFT_MALLOC(order, n_faces, cs_lnum_t);
+
+  cs_order_lnum_allocated_s(NULL, fc_num, 2, order, n_faces);
+
+  BFT_MALLOC(fc, n_faces, cs_lnum_2_t);
+
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+    fc[f_id][0] = fc_num[order[f_id]*2];
+    fc[f_id][1] = fc_num[order[f_id]*2 + 1];
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(fc_num);
+
+  /* Bandwidth and profile */
+
+  BFT_MALLOC(max_distance, n_cells_ext, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+    max_distance[i] = 0;
+
+  cs_lnum_t _bandwidth = 0;
+  cs_gnum_t _profile = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+    cs_lnum_t distance = fc[f_id][1] - fc[f_id][0];
+    if (distance > _bandwidth)
+      _bandwidth = distance;
+    if (distance > max_distance[fc[f_id][0]])
+      max_distance[fc[f_id][0]] = distance;
+    if (distance > max_distance[fc[f_id][1]])
+      max_distance[fc[f_id][1]] = distance;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _profile += max_distance[i];
+
+  if (n_cells > 0)
+    _profile /= n_cells;
+
+  BFT_FREE(max_distance);
+
+  /* Face loop benchmark */
+
+  BFT_MALLOC(x, n_cells_ext, cs_real_t);
+  BFT_MALLOC(y, n_cells_ext, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells_ext; i++) {
+    x[i] = 1.0 + (i%7)*0.125;
+    y[i] = 0.;
+  }
+
+  int n_runs = 1;
+  if (n_faces > 0 && n_faces < 1000000)
+    n_runs = 1000000 / n_faces;
+
+  double t_min = HUGE_VAL;
+
+  for (int pass = 0; pass < 3; pass++) {
+    double t0 = cs_timer_wtime();
+    for (int run = 0; run < n_runs; run++) {
+      for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+        cs_lnum_t c_id_0 = fc[f_id][0];
+        cs_lnum_t c_id_1 = fc[f_id][1];
+        y[c_id_0] += 0.5*x[c_id_1];
+        y[c_id_1] += 0.5*x[c_id_0];
+      }
+    }
+    double t1 = cs_timer_wtime();
+    if (t1 - t0 < t_min)
+      t_min = t1 - t0;
+  }
+
+  BFT_FREE(y);
+  BFT_FREE(x);
+  BFT_FREE(fc);
+
+  *bandwidth = _bandwidth;
+  *profile = _profile;
+
+  return t_min / n_runs;
+}
+
+/*----------------------------------------------------------------------------
+ * Renumber cells using the best of several algorithms.
+ *
+ * Candidate algorithms are applied to the local partition, and the one
+ * leading to the fastest face loop benchmark is kept (the current numbering
+ * is also considered as a candidate).
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   new_to_old  --> new to old cell renumbering
+ *
+ * returns:
+ *   0 if a renumbering was selected, 1 if the current numbering is kept
+ *----------------------------------------------------------------------------*/
+
+static int
+_renum_cells_auto(const cs_mesh_t  *mesh,
+                  cs_lnum_t         new_to_old[])
+{
+  const cs_renumber_cells_type_t candidates[]
+    = {CS_RENUMBER_CELLS_NONE,
+       CS_RENUMBER_CELLS_RCM,
+       CS_RENUMBER_CELLS_MORTON,
+       CS_RENUMBER_CELLS_HILBERT,
+       CS_RENUMBER_CELLS_SCOTCH_ORDER};
+
+  const int n_candidates = sizeof(candidates) / sizeof(candidates[0]);
+
+  int retval = 1;
+  double t_best = HUGE_VAL;
+  int c_best = -1;
+
+  cs_lnum_t *_new_to_old;
+  BFT_MALLOC(_new_to_old, mesh->n_cells, cs_lnum_t);
+
+  bft_printf
+    (_("\n"
+       " Automatic cell numbering selection:\n\n"
+       "   algorithm                            bandwidth    profile"
+       "    face loop (s)\n"));
+
+  for (int c_id = 0; c_id < n_candidates; c_id++) {
+
+    int c_retval = 0;
+    const cs_lnum_t *c_new_to_old = _new_to_old;
+
+    for (cs_lnum_t i = 0; i < mesh->n_cells; i++)
+      _new_to_old[i] = i;
+
+    switch (candidates[c_id]) {
+    case CS_RENUMBER_CELLS_NONE:
+      c_new_to_old = NULL;
+      break;
+    case CS_RENUMBER_CELLS_RCM:
+      _renum_cells_rcm(mesh, _new_to_old);
+      break;
+    case CS_RENUMBER_CELLS_MORTON:
+      _renum_cells_morton(mesh, _new_to_old);
+      break;
+    case CS_RENUMBER_CELLS_HILBERT:
+      _renum_cells_hilbert(mesh, _new_to_old);
+      break;
+#if defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH)
+    case CS_RENUMBER_CELLS_SCOTCH_ORDER:
+      c_retval = _renum_cells_scotch_order(mesh, _new_to_old);
+      break;
+#endif
+    default:
+      c_retval = -1;
+    }
+
+    if (c_retval != 0)
+      continue;
+
+    cs_lnum_t bandwidth;
+    cs_gnum_t profile;
+
+    double t = _renum_cells_evaluate(mesh, c_new_to_old, &bandwidth, &profile);
+
+    bft_printf("   %-36s %10llu %10llu   %12.5e\n",
+               _(_cell_renum_name[candidates[c_id]]),
+               (unsigned long long)bandwidth,
+               (unsigned long long)profile,
+               t);
+
+    if (t < t_best) {
+      t_best = t;
+      c_best = c_id;
+      if (c_new_to_old != NULL) {
+        memcpy(new_to_old, _new_to_old, mesh->n_cells*sizeof(cs_lnum_t));
+        retval = 0;
+      }
+      else
+        retval = 1;
+    }
+
+  }
+
+  BFT_FREE(_new_to_old);
+
+  if (c_best > -1)
+    bft_printf(_("\n   selected: %s\n"),
+               _(_cell_renum_name[candidates[c_best]]));
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Renumber cells for locality.
  *
@@ -4538,6 +5118,7 @@ _cells_locality_renumbering(cs_mesh_t                 *mesh,
     break;
 
   case CS_RENUMBER_CELLS_HILBERT:
+  case CS_RENUMBER_CELLS_HILBERT_TILES:
     _renum_cells_hilbert(mesh, new_to_old_c);
     break;
 
@@ -4545,6 +5126,10 @@ _cells_locality_renumbering(cs_mesh_t                 *mesh,
     _renum_cells_rcm(mesh, new_to_old_c);
     break;
 
+  case CS_RENUMBER_CELLS_AUTO:
+    retval = _renum_cells_auto(mesh, new_to_old_c);
+    break;
+
   case CS_RENUMBER_CELLS_NONE:
     retval = 1;
     break;
@@ -4936,6 +5521,7 @@ _renumber_i_faces(cs_mesh_t  *mesh)
 {
   int  n_i_groups = 1, n_i_no_adj_halo_groups = 0;
   cs_lnum_t  max_group_size = 1014;       /* Default */
+  cs_lnum_t  n_i_block_faces = 0;
   cs_lnum_t  ii;
   cs_lnum_t  *new_to_old_i = NULL;
   cs_lnum_t  *i_group_index = NULL;
@@ -4994,6 +5580,24 @@ _renumber_i_faces(cs_mesh_t  *mesh)
                                    &n_i_groups,
                                    &n_i_no_adj_halo_groups,
                                    &i_group_index);
+    if (   retval == 0
+        && _cells_algorithm[1] == CS_RENUMBER_CELLS_HILBERT_TILES)
+      _renum_i_faces_by_tile(mesh,
+                             _cells_tile_size,
+                             n_i_threads,
+                             n_i_groups,
+                             i_group_index,
+                             new_to_old_i);
+    break;
+
+  case CS_RENUMBER_I_FACES_COLOR:
+    numbering_type = CS_NUMBERING_THREADS;
+    _renumber_i_faces_by_cell_adjacency(mesh);
+    retval = _renum_i_faces_color(mesh,
+                                  n_i_threads,
+                                  new_to_old_i,
+                                  &n_i_groups,
+                                  &i_group_index);
     break;
 
   case CS_RENUMBER_I_FACES_SIMD:
@@ -5001,7 +5605,8 @@ _renumber_i_faces(cs_mesh_t  *mesh)
     _renumber_i_faces_by_cell_adjacency(mesh);
     retval = _renum_i_faces_for_vectorizing(mesh,
                                             _cs_renumber_vector_size,
-                                            new_to_old_i);
+                                            new_to_old_i,
+                                            &n_i_block_faces);
     break;
 
   case CS_RENUMBER_I_FACES_NONE:
@@ -5037,8 +5642,9 @@ _renumber_i_faces(cs_mesh_t  *mesh)
   }
   else if (numbering_type == CS_NUMBERING_VECTORIZE && retval == 0) {
     mesh->i_face_numbering
-      = cs_numbering_create_vectorized(mesh->n_i_faces,
-                                       _cs_renumber_vector_size);
+      = cs_numbering_create_vectorized_blocks(mesh->n_i_faces,
+                                              n_i_block_faces,
+                                              _cs_renumber_vector_size);
   }
   else
     mesh->i_face_numbering
@@ -5113,6 +5719,18 @@ _renumber_b_faces(cs_mesh_t  *mesh)
                                                         &b_group_index);
     break;
 
+  case CS_RENUMBER_B_FACES_ZONE:
+    numbering_type = CS_NUMBERING_THREADS;
+    retval = _renum_b_faces_no_share_cell_across_thread(mesh,
+                                                        n_b_threads,
+                                                        _min_b_subset_size,
+                                                        new_to_old_b,
+                                                        &n_b_groups,
+                                                        &b_group_index);
+    if (retval == 0)
+      _renum_b_faces_by_zone(mesh, n_b_threads, b_group_index, new_to_old_b);
+    break;
+
   case CS_RENUMBER_B_FACES_SIMD:
     numbering_type = CS_NUMBERING_VECTORIZE;
     _renumber_b_faces_by_cell_adjacency(mesh);
@@ -5346,18 +5964,32 @@ _renumber_i_test(cs_mesh_t  *mesh)
 
       cs_lnum_t counter = 0;
 
+      const cs_lnum_t vector_size = mesh->i_face_numbering->vector_size;
+      const cs_lnum_t n_block_faces
+        =   mesh->i_face_numbering->group_index[1]
+          - mesh->i_face_numbering->group_index[1] % vector_size;
+
       BFT_MALLOC(accumulator, mesh->n_cells_with_ghosts, cs_lnum_t);
 
       for (c_id_0 = 0; c_id_0 < mesh->n_cells_with_ghosts; c_id_0++)
         accumulator[c_id_0] = 0;
 
-#     if defined(HAVE_OPENMP_SIMD)
-#       pragma omp simd safelen(CS_NUMBERING_SIMD_SIZE)
-#     else
-#       pragma dir nodep
-#       pragma GCC ivdep
-#     endif
-      for (f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+      for (cs_lnum_t b_id = 0; b_id < n_block_faces; b_id += vector_size) {
+#       if defined(HAVE_OPENMP_SIMD)
+#         pragma omp simd
+#       else
+#         pragma dir nodep
+#         pragma GCC ivdep
+#       endif
+        for (f_id = b_id; f_id < b_id + vector_size; f_id++) {
+          c_id_0 = mesh->i_face_cells[f_id][0];
+          c_id_1 = mesh->i_face_cells[f_id][1];
+          accumulator[c_id_0] += 1;
+          accumulator[c_id_1] += 1;
+        }
+      }
+
+      for (f_id = n_block_faces; f_id < mesh->n_i_faces; f_id++) {
         c_id_0 = mesh->i_face_cells[f_id][0];
         c_id_1 = mesh->i_face_cells[f_id][1];
         accumulator[c_id_0] += 1;
@@ -5373,12 +6005,10 @@ _renumber_i_test(cs_mesh_t  *mesh)
 
       if (face_errors == 0) {
 
-        const cs_lnum_t vector_size = mesh->i_face_numbering->vector_size;
-
         for (c_id_0 = 0; c_id_0 < mesh->n_cells_with_ghosts; c_id_0++)
           accumulator[c_id_0] = -1;
 
-        for (f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+        for (f_id = 0; f_id < n_block_faces; f_id++) {
           cs_lnum_t block_id = f_id / vector_size;
           c_id_0 = mesh->i_face_cells[f_id][0];
           c_id_1 = mesh->i_face_cells[f_id][1];
@@ -5646,6 +6276,11 @@ _renumber_mesh(cs_mesh_t  *mesh)
        _(no_yes[c_halo_adj_last]),
        _(_cell_renum_name[_cells_algorithm[1]]));
 
+    if (_cells_algorithm[1] == CS_RENUMBER_CELLS_HILBERT_TILES)
+      bft_printf
+        (_("     cells per tile:                      %ld\n"),
+         (long)_cells_tile_size);
+
     bft_printf
       (_("\n"
          "   renumbering for interior faces:\n"
@@ -5687,6 +6322,89 @@ _renumber_mesh(cs_mesh_t  *mesh)
       ("\n ----------------------------------------------------------\n");
 }
 
+/*----------------------------------------------------------------------------
+ * Replace an array by a copy first touched by the threads operating on it.
+ *
+ * parameters:
+ *   numbering <-- associated numbering, or NULL
+ *   n_elts    <-- number of elements in array
+ *   elt_size  <-- element size
+ *   array     <-> pointer to array
+ *----------------------------------------------------------------------------*/
+
+static void
+_first_touch_array(const cs_numbering_t  *numbering,
+                   cs_lnum_t              n_elts,
+                   size_t                 elt_size,
+                   void                 **array)
+{
+  if (*array == NULL || n_elts < 1)
+    return;
+
+  unsigned char *_array;
+  BFT_MALLOC(_array, n_elts*elt_size, unsigned char);
+
+  cs_numbering_first_touch(numbering, n_elts, elt_size, *array, _array);
+
+  BFT_FREE(*array);
+  *array = _array;
+}
+
+/*----------------------------------------------------------------------------
+ * Re-initialize main mesh arrays so that they are first touched
+ * by the threads operating on them, based on the mesh numberings.
+ *
+ * On NUMA systems, arrays built serially are otherwise placed on the
+ * memory of a single socket.
+ *
+ * parameters:
+ *   mesh <-> pointer to global mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_first_touch_mesh(cs_mesh_t  *mesh)
+{
+  const cs_numbering_t *c_num = mesh->cell_numbering;
+  const cs_numbering_t *i_num = mesh->i_face_numbering;
+  const cs_numbering_t *b_num = mesh->b_face_numbering;
+  const cs_numbering_t *v_num = mesh->vtx_numbering;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+
+  _first_touch_array(c_num, mesh->n_cells_with_ghosts, sizeof(int),
+                     (void **)&(mesh->cell_family));
+  _first_touch_array(c_num, n_cells, sizeof(cs_gnum_t),
+                     (void **)&(mesh->global_cell_num));
+
+  _first_touch_array(i_num, n_i_faces, sizeof(cs_lnum_2_t),
+                     (void **)&(mesh->i_face_cells));
+  _first_touch_array(i_num, n_i_faces + 1, sizeof(cs_lnum_t),
+                     (void **)&(mesh->i_face_vtx_idx));
+  _first_touch_array(i_num, n_i_faces, sizeof(int),
+                     (void **)&(mesh->i_face_family));
+  _first_touch_array(i_num, n_i_faces, sizeof(char),
+                     (void **)&(mesh->i_face_r_gen));
+  _first_touch_array(i_num, n_i_faces, sizeof(cs_gnum_t),
+                     (void **)&(mesh->global_i_face_num));
+
+  _first_touch_array(b_num, n_b_faces, sizeof(cs_lnum_t),
+                     (void **)&(mesh->b_face_cells));
+  _first_touch_array(b_num, n_b_faces + 1, sizeof(cs_lnum_t),
+                     (void **)&(mesh->b_face_vtx_idx));
+  _first_touch_array(b_num, n_b_faces, sizeof(int),
+                     (void **)&(mesh->b_face_family));
+  _first_touch_array(b_num, n_b_faces, sizeof(cs_gnum_t),
+                     (void **)&(mesh->global_b_face_num));
+
+  _first_touch_array(v_num, n_vertices, 3*sizeof(cs_real_t),
+                     (void **)&(mesh->vtx_coord));
+  _first_touch_array(v_num, n_vertices, sizeof(cs_gnum_t),
+                     (void **)&(mesh->global_vtx_num));
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -5775,6 +6493,84 @@ cs_renumber_get_min_subset_size(cs_lnum_t  *min_i_subset_size,
     *min_b_subset_size = _min_b_subset_size;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the number of cells per tile for tiled cell renumbering.
+ *
+ * This is used with the \ref CS_RENUMBER_CELLS_HILBERT_TILES algorithm;
+ * the working set associated with a tile should fit in the L2 cache.
+ *
+ * \param[in]  tile_size  number of cells per tile
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_set_tile_size(cs_lnum_t  tile_size)
+{
+  if (tile_size < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: tile size must be strictly positive (%ld)."),
+              __func__, (long)tile_size);
+
+  _cells_tile_size = tile_size;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get the number of cells per tile for tiled cell renumbering.
+ *
+ * \return  number of cells per tile
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_renumber_get_tile_size(void)
+{
+  return _cells_tile_size;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether main mesh arrays should be re-initialized
+ *        after renumbering so as to be first touched by the threads
+ *        operating on them.
+ *
+ * On NUMA systems, this ensures memory pages are distributed on the
+ * sockets whose cores later operate on them, using the same loop
+ * structure as the computational loops (based on the mesh numberings).
+ * By default, this is done when multiple OpenMP threads are used.
+ *
+ * \param[in]  first_touch  true if arrays should be re-initialized
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_set_first_touch(bool  first_touch)
+{
+  _first_touch = (first_touch) ? 1 : 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether main mesh arrays are re-initialized after
+ *        renumbering so as to be first touched by the threads operating
+ *        on them.
+ *
+ * Mesh quantities arrays are also initialized in the same manner.
+ *
+ * \return  true if arrays are re-initialized, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_renumber_get_first_touch(void)
+{
+  if (_first_touch < 0)
+    return (cs_glob_n_threads > 1) ? true : false;
+
+  return (_first_touch > 0) ? true : false;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Select the algorithm for mesh renumbering.
@@ -5904,6 +6700,9 @@ cs_renumber_mesh(cs_mesh_t  *mesh)
   _renumber_i_test(mesh);
   _renumber_b_test(mesh);
 
+  if (cs_renumber_get_first_touch())
+    _first_touch_mesh(mesh);
+
   if (mesh->verbosity > 0)
     _log_bandwidth_info(mesh, _("volume mesh"));
 }
@@ -56,7 +56,9 @@ typedef enum {
   CS_RENUMBER_CELLS_METIS_ORDER,     /* METIS ordering */
   CS_RENUMBER_CELLS_MORTON,          /* Morton space filling curve */
   CS_RENUMBER_CELLS_HILBERT,         /* Hilbert space filling curve */
+  CS_RENUMBER_CELLS_HILBERT_TILES,   /* Hilbert curve, with cache-sized tiles */
   CS_RENUMBER_CELLS_RCM,             /* Reverse Cuthill-McKee */
+  CS_RENUMBER_CELLS_AUTO,            /* Automatic selection by benchmark */
   CS_RENUMBER_CELLS_NONE             /* No cells renumbering */
 
 } cs_renumber_cells_type_t;
@@ -66,6 +68,7 @@ typedef enum {
   CS_RENUMBER_I_FACES_BLOCK,         /* No shared cell in block */
   CS_RENUMBER_I_FACES_MULTIPASS,     /* Use multipass face numbering */
   CS_RENUMBER_I_FACES_SIMD,          /* Renumber for vector (SIMD) operations */
+  CS_RENUMBER_I_FACES_COLOR,         /* Distance-1 coloring of faces */
   CS_RENUMBER_I_FACES_NONE           /* No interior face numbering */
 
 } cs_renumber_i_faces_type_t;
@@ -74,6 +77,8 @@ typedef enum {
 
   CS_RENUMBER_B_FACES_THREAD,        /* No cell shared between threads */
   CS_RENUMBER_B_FACES_SIMD,          /* Renumber for vector (SIMD) operations */
+  CS_RENUMBER_B_FACES_ZONE,          /* No cell shared between threads,
+                                        ordered by zone in thread blocks */
   CS_RENUMBER_B_FACES_NONE           /* No boundary face numbering */
 
 } cs_renumber_b_faces_type_t;
@@ -150,6 +155,55 @@ void
 cs_renumber_get_min_subset_size(cs_lnum_t  *min_i_subset_size,
                                 cs_lnum_t  *min_b_subset_size);
 
+/*----------------------------------------------------------------------------
+ * Set the number of cells per tile for tiled cell renumbering.
+ *
+ * parameters:
+ *   tile_size <-- number of cells per tile
+ *----------------------------------------------------------------------------*/
+
+void
+cs_renumber_set_tile_size(cs_lnum_t  tile_size);
+
+/*----------------------------------------------------------------------------
+ * Get the number of cells per tile for tiled cell renumbering.
+ *
+ * returns:
+ *   number of cells per tile
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_renumber_get_tile_size(void);
+
+/*----------------------------------------------------------------------------
+ * Indicate whether main mesh arrays should be re-initialized after
+ * renumbering so as to be first touched by the threads operating on them.
+ *
+ * On NUMA systems, this ensures memory pages are distributed on the
+ * sockets whose cores later operate on them, using the same loop
+ * structure as the computational loops (based on the mesh numberings).
+ * By default, this is done when multiple OpenMP threads are used.
+ *
+ * parameters:
+ *   first_touch <-- true if arrays should be re-initialized
+ *----------------------------------------------------------------------------*/
+
+void
+cs_renumber_set_first_touch(bool  first_touch);
+
+/*----------------------------------------------------------------------------
+ * Indicate whether main mesh arrays are re-initialized after renumbering
+ * so as to be first touched by the threads operating on them.
+ *
+ * Mesh quantities arrays are also initialized in the same manner.
+ *
+ * returns:
+ *   true if arrays are re-initialized, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_renumber_get_first_touch(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Select the algorithm for mesh renumbering.
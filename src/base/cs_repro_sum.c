@@ -0,0 +1,703 @@
+/*============================================================================
+ * Reproducible (exact) summation of floating-point values
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+
+#include "cs_timer.h"
+#include "cs_timer_stats.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_repro_sum.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_repro_sum.c
+        Reproducible summation of floating-point values.
+
+  Values are summed exactly in a fixed-point accumulator covering the
+  whole double precision range (in the manner of Kulisch's long
+  accumulator, as used by ExBLAS). Each double is split into 3 signed
+  32-bit digits which are added to 64-bit words, so that additions are
+  exact integer operations, and the sum is independent of the order in
+  which values are added, of the number of threads, and of the number
+  of MPI ranks. Carries are only propagated when normalizing, that is
+  before merging or rounding accumulators, and at least every 2^30
+  additions.
+
+  To limit the cost of array operations, values are first processed
+  by blocks, using the error-free extraction of Rump, Ogita and Oishi
+  (AccSum): high order parts of a block's values relative to a power
+  of 2 based on the block's maximum are summed exactly in floating-point
+  arithmetic (in vectorizable loops), and only these partial sums are
+  added to the accumulator; this is repeated on the remainders until
+  they are all zero, so the result is still exact.
+
+  Reproducible sums are not active by default; they are activated
+  through \ref cs_repro_sum_set_active, or when selecting the
+  \ref CS_BLAS_REDUCE_REPRODUCIBLE reduction algorithm.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+#define _N_WORDS CS_REPRO_SUM_N_WORDS
+
+/* Digit mask */
+
+#define _W_MASK  0xffffffffULL
+
+/* Number of values decomposed simultaneously (vectorizable loop) */
+
+#define _BLOCK_SIZE 64
+
+/* Number of independent partial reductions in block loops */
+
+#define _N_LANES 8
+
+/* Extraction factor for blocks: 2^_EXTRACT_M >= _BLOCK_SIZE + 2 */
+
+#define _EXTRACT_M  7
+
+/* Maximum number of extraction passes on a block */
+
+#define _N_EXTRACT_MAX  4
+
+/* Maximum number of additions between normalizations */
+
+#define _N_ADD_MAX  (1 << 30)
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static bool _repro_sum_active = false;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Propagate carries in an accumulator, so that all digits except the
+ * most significant one are in the [0, 2^32[ range.
+ *
+ * The resulting representation is unique for a given value.
+ *
+ * parameters:
+ *   s <-> accumulator
+ *----------------------------------------------------------------------------*/
+
+static void
+_normalize(cs_repro_sum_t  *s)
+{
+  for (int i = 0; i < _N_WORDS - 1; i++) {
+    int64_t l = s->w[i] & (int64_t)_W_MASK;
+    int64_t c = (s->w[i] - l) / ((int64_t)1 << 32);
+    s->w[i] = l;
+    s->w[i+1] += c;
+  }
+  s->n_add = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Add a block of values to an accumulator.
+ *
+ * Values are first decomposed into signed digits in a vectorizable loop,
+ * then scattered to the accumulator words.
+ *
+ * parameters:
+ *   s <-> accumulator
+ *   n <-- number of values (at most _BLOCK_SIZE)
+ *   v <-- values
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_add_block(cs_repro_sum_t  *s,
+           int              n,
+           const double     v[])
+{
+  int w_id[_BLOCK_SIZE];
+  int64_t d0[_BLOCK_SIZE], d1[_BLOCK_SIZE], d2[_BLOCK_SIZE];
+
+  int n_nf = 0;
+
+#if defined(HAVE_OPENMP_SIMD)
+# pragma omp simd reduction(+:n_nf)
+#endif
+  for (int j = 0; j < n; j++) {
+    uint64_t u;
+    memcpy(&u, v + j, sizeof(uint64_t));
+    int e = (int)((u >> 52) & 0x7ff);
+    uint64_t m = u & 0xfffffffffffffULL;
+    if (e > 0)
+      m |= 0x10000000000000ULL;
+    if (e == 0x7ff) {
+      m = 0;
+      n_nf += 1;
+    }
+    /* value = m.2^(pos - 1074) */
+    int pos = (e > 0) ? e - 1 : 0;
+    int shift = pos & 31;
+    uint64_t r = m >> (32 - shift);
+    int64_t sgn = -(int64_t)(u >> 63);
+    w_id[j] = pos >> 5;
+    d0[j] = ((int64_t)((m << shift) & _W_MASK) ^ sgn) - sgn;
+    d1[j] = ((int64_t)(r & _W_MASK) ^ sgn) - sgn;
+    d2[j] = ((int64_t)(r >> 32) ^ sgn) - sgn;
+  }
+
+  for (int j = 0; j < n; j++) {
+    int64_t *w = s->w + w_id[j];
+    w[0] += d0[j];
+    w[1] += d1[j];
+    w[2] += d2[j];
+  }
+
+  if (n_nf > 0) {
+    for (int j = 0; j < n; j++) {
+      if (!isfinite(v[j]))
+        s->nf += v[j];
+    }
+  }
+
+  s->n_add += n;
+  if (s->n_add > _N_ADD_MAX)
+    _normalize(s);
+}
+
+/*----------------------------------------------------------------------------
+ * Add a block of values to an accumulator using error-free extraction.
+ *
+ * For sigma = 2^M.2^ceil(log2(max|v|)), with 2^M >= n+2, the high order
+ * parts q = (sigma + v) - sigma and remainders v - q are exact, and the
+ * sum of the q values is exact whatever the summation order.
+ * Remaining values (after the maximum number of passes, or when values
+ * are too large or non-finite) are added directly.
+ *
+ * Reductions use _N_LANES independent partial results, to avoid
+ * serializing vectorized loops on addition latency. Partial sums are
+ * buffered, and added to the accumulator when the buffer is full.
+ *
+ * parameters:
+ *   s     <-> accumulator
+ *   v     <-> values (overwritten, padded with zeroes)
+ *   tau   <-> buffer for partial sums
+ *   n_tau <-> number of buffered partial sums
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_add_block_extract(cs_repro_sum_t  *s,
+                   double           v[_BLOCK_SIZE],
+                   double           tau[_BLOCK_SIZE],
+                   int             *n_tau)
+{
+  double l_max[_N_LANES], l_aux[_N_LANES];
+
+  for (int k = 0; k < _N_LANES; k++) {
+    l_max[k] = 0.;
+    l_aux[k] = 0.;
+  }
+
+  /* v - v is NaN for non-finite values, 0 otherwise */
+
+  for (int j = 0; j < _BLOCK_SIZE; j += _N_LANES) {
+    for (int k = 0; k < _N_LANES; k++) {
+      double a = fabs(v[j+k]);
+      l_max[k] = (a > l_max[k]) ? a : l_max[k];
+      l_aux[k] += v[j+k] - v[j+k];
+    }
+  }
+
+  double v_max = 0., v_nf = 0.;
+  for (int k = 0; k < _N_LANES; k++) {
+    v_max = (l_max[k] > v_max) ? l_max[k] : v_max;
+    v_nf += l_aux[k];
+  }
+
+  if (isnan(v_nf)) {
+    _add_block(s, _BLOCK_SIZE, v);
+    return;
+  }
+
+  for (int pass = 0; pass < _N_EXTRACT_MAX; pass++) {
+
+    if (v_max <= 0.)
+      return;
+    else if (v_max > 1e300)
+      break;
+
+    /* sigma = 2^(ceil(log2(v_max)) + _EXTRACT_M), from exponent bits */
+
+    uint64_t u;
+    memcpy(&u, &v_max, sizeof(uint64_t));
+    u = ((u >> 52) + 1 + _EXTRACT_M) << 52;
+
+    double sigma;
+    memcpy(&sigma, &u, sizeof(double));
+
+    for (int k = 0; k < _N_LANES; k++) {
+      l_max[k] = 0.;
+      l_aux[k] = 0.;
+    }
+
+    for (int j = 0; j < _BLOCK_SIZE; j += _N_LANES) {
+      for (int k = 0; k < _N_LANES; k++) {
+        double q = (sigma + v[j+k]) - sigma;
+        double r = v[j+k] - q;
+        double a = fabs(r);
+        v[j+k] = r;
+        l_aux[k] += q;
+        l_max[k] = (a > l_max[k]) ? a : l_max[k];
+      }
+    }
+
+    double t = 0.;
+    v_max = 0.;
+    for (int k = 0; k < _N_LANES; k++) {
+      t += l_aux[k];
+      v_max = (l_max[k] > v_max) ? l_max[k] : v_max;
+    }
+
+    tau[*n_tau] = t;
+    *n_tau += 1;
+    if (*n_tau == _BLOCK_SIZE) {
+      _add_block(s, _BLOCK_SIZE, tau);
+      *n_tau = 0;
+    }
+
+  }
+
+  if (v_max > 0.)
+    _add_block(s, _BLOCK_SIZE, v);
+}
+
+/*----------------------------------------------------------------------------
+ * Add the sum of products of up to 3 arrays to an accumulator:
+ * s += sum(x.y.w), with y and w optional.
+ *
+ * Each thread uses its own accumulator; as accumulators are merged
+ * exactly, the result does not depend on the number of threads.
+ *
+ * parameters:
+ *   s <-> accumulator
+ *   n <-- size of arrays
+ *   x <-- array of floating-point values
+ *   y <-- array of floating-point values, or NULL
+ *   w <-- array of weights, or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_products(cs_repro_sum_t    *s,
+              cs_lnum_t          n,
+              const cs_real_t   *x,
+              const cs_real_t   *y,
+              const cs_real_t   *w)
+{
+# pragma omp parallel if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id = 0, e_id = n;
+
+#if defined(HAVE_OPENMP)
+    int t_id = omp_get_thread_num();
+    int n_t = omp_get_num_threads();
+    cs_lnum_t t_n = (n + n_t - 1) / n_t;
+    s_id = CS_MIN(t_id * t_n, n);
+    e_id = CS_MIN((t_id + 1) * t_n, n);
+#endif
+
+    cs_repro_sum_t t;
+    cs_repro_sum_init(&t);
+
+    double p[_BLOCK_SIZE], tau[_BLOCK_SIZE];
+    int n_tau = 0;
+
+    for (cs_lnum_t b_id = s_id; b_id < e_id; b_id += _BLOCK_SIZE) {
+
+      const int n_b = CS_MIN(_BLOCK_SIZE, e_id - b_id);
+      const cs_real_t *_x = x + b_id;
+
+      if (y == NULL) {
+        for (int j = 0; j < n_b; j++)
+          p[j] = _x[j];
+      }
+      else if (w == NULL) {
+        const cs_real_t *_y = y + b_id;
+        for (int j = 0; j < n_b; j++)
+          p[j] = _x[j] * _y[j];
+      }
+      else {
+        const cs_real_t *_y = y + b_id;
+        const cs_real_t *_w = w + b_id;
+        for (int j = 0; j < n_b; j++)
+          p[j] = _x[j] * _y[j] * _w[j];
+      }
+
+      for (int j = n_b; j < _BLOCK_SIZE; j++)
+        p[j] = 0.;
+
+      _add_block_extract(&t, p, tau, &n_tau);
+
+    }
+
+    _add_block(&t, n_tau, tau);
+
+#   pragma omp critical
+    cs_repro_sum_merge(s, &t);
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate reproducible parallel sums.
+ *
+ * When active, \ref cs_parall_sum sums double precision values exactly
+ * across ranks, so the result does not depend on the reduction order.
+ *
+ * \param[in]  active  true to activate, false to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_set_active(bool  active)
+{
+  _repro_sum_active = active;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether reproducible parallel sums are active.
+ *
+ * \return  true if active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_repro_sum_is_active(void)
+{
+  return _repro_sum_active;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize (zero) an accumulator.
+ *
+ * \param[out]  s  accumulator
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_init(cs_repro_sum_t  *s)
+{
+  for (int i = 0; i < _N_WORDS; i++)
+    s->w[i] = 0;
+  s->nf = 0.;
+  s->n_add = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a value to an accumulator.
+ *
+ * \param[in, out]  s  accumulator
+ * \param[in]       v  value to add
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_add(cs_repro_sum_t  *s,
+                 double           v)
+{
+  _add_block(s, 1, &v);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the values of an array to an accumulator: s += sum(x).
+ *
+ * \param[in, out]  s  accumulator
+ * \param[in]       n  size of array x
+ * \param[in]       x  array of floating-point values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_add_array(cs_repro_sum_t    *s,
+                       cs_lnum_t          n,
+                       const cs_real_t   *x)
+{
+  _add_products(s, n, x, NULL, NULL);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the dot product of 2 arrays to an accumulator: s += x.y
+ *
+ * \param[in, out]  s  accumulator
+ * \param[in]       n  size of arrays x and y
+ * \param[in]       x  array of floating-point values
+ * \param[in]       y  array of floating-point values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_add_dot(cs_repro_sum_t    *s,
+                     cs_lnum_t          n,
+                     const cs_real_t   *x,
+                     const cs_real_t   *y)
+{
+  _add_products(s, n, x, y, NULL);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the weighted dot product of 2 arrays to an accumulator:
+ *        s += sum(x.y.w)
+ *
+ * \param[in, out]  s  accumulator
+ * \param[in]       n  size of arrays w, x and y
+ * \param[in]       w  array of weights
+ * \param[in]       x  array of floating-point values
+ * \param[in]       y  array of floating-point values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_add_wdot(cs_repro_sum_t    *s,
+                      cs_lnum_t          n,
+                      const cs_real_t   *w,
+                      const cs_real_t   *x,
+                      const cs_real_t   *y)
+{
+  _add_products(s, n, x, y, w);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add an accumulator to another one: s += t.
+ *
+ * \param[in, out]  s  accumulator
+ * \param[in]       t  accumulator to add
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_merge(cs_repro_sum_t        *s,
+                   const cs_repro_sum_t  *t)
+{
+  cs_repro_sum_t _t = *t;
+
+  _normalize(s);
+  _normalize(&_t);
+
+  for (int i = 0; i < _N_WORDS; i++)
+    s->w[i] += _t.w[i];
+  s->nf += _t.nf;
+
+  _normalize(s);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the (rounded) value of an accumulator.
+ *
+ * The result depends only on the exact sum, not on the order in which
+ * values were added.
+ *
+ * \param[in]  s  accumulator
+ *
+ * \return  accumulated value
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_repro_sum_value(const cs_repro_sum_t  *s)
+{
+  if (!isfinite(s->nf))
+    return s->nf;
+
+  cs_repro_sum_t t = *s;
+  _normalize(&t);
+
+  double sign = 1.;
+  if (t.w[_N_WORDS - 1] < 0) {
+    for (int i = 0; i < _N_WORDS; i++)
+      t.w[i] = -t.w[i];
+    _normalize(&t);
+    sign = -1.;
+  }
+
+  int top = _N_WORDS - 1;
+  while (top >= 0 && t.w[top] == 0)
+    top--;
+
+  if (top < 0)
+    return 0.;
+
+  /* Highest double precision bit is 2097, in word 65 */
+
+  else if (top > 65)
+    return sign*HUGE_VAL;
+
+  /* Round from the 3 most significant digits */
+
+  uint64_t hi = (uint64_t)t.w[top] << 32;
+  if (top > 0)
+    hi |= (uint64_t)t.w[top-1];
+  double lo = (top > 1) ? (double)t.w[top-2] : 0.;
+
+  double v =   ldexp((double)hi, 32*(top-1) - 1074)
+             + ldexp(lo, 32*(top-2) - 1074);
+
+  return sign*v;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sum accumulators over all ranks of the default communicator.
+ *
+ * \param[in]       n  number of accumulators
+ * \param[in, out]  s  local accumulators in, global accumulators out
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_parall_merge(int              n,
+                          cs_repro_sum_t   s[])
+{
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    int64_t *w;
+    double *nf;
+    BFT_MALLOC(w, (size_t)n*_N_WORDS, int64_t);
+    BFT_MALLOC(nf, n, double);
+
+    /* Normalized digits are non-negative and lower than 2^32 (except for
+       the leading one), so integer sums over ranks are exact */
+
+    for (int i = 0; i < n; i++) {
+      _normalize(s + i);
+      memcpy(w + (size_t)i*_N_WORDS, s[i].w, _N_WORDS*sizeof(int64_t));
+      nf[i] = s[i].nf;
+    }
+
+    cs_timer_t t0 = cs_timer_time();
+
+    MPI_Allreduce(MPI_IN_PLACE, w, n*_N_WORDS, cs_datatype_to_mpi[CS_INT64],
+                  MPI_SUM, cs_glob_mpi_comm);
+    MPI_Allreduce(MPI_IN_PLACE, nf, n, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_stats_add_mpi_wait("allreduce", &t0, &t1);
+
+    for (int i = 0; i < n; i++) {
+      memcpy(s[i].w, w + (size_t)i*_N_WORDS, _N_WORDS*sizeof(int64_t));
+      s[i].nf = nf[i];
+      _normalize(s + i);
+    }
+
+    BFT_FREE(nf);
+    BFT_FREE(w);
+
+  }
+
+#else
+
+  CS_UNUSED(n);
+  CS_UNUSED(s);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sum double precision values over all ranks of the default
+ *        communicator, with a result independent of the reduction order.
+ *
+ * \param[in]       n    number of values
+ * \param[in, out]  val  local values in, global sums out
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_parall(int      n,
+                    double   val[])
+{
+  if (cs_glob_n_ranks < 2)
+    return;
+
+  cs_repro_sum_t *s;
+  BFT_MALLOC(s, n, cs_repro_sum_t);
+
+  for (int i = 0; i < n; i++) {
+    cs_repro_sum_init(s + i);
+    cs_repro_sum_add(s + i, val[i]);
+  }
+
+  cs_repro_sum_parall_merge(n, s);
+
+  for (int i = 0; i < n; i++)
+    val[i] = cs_repro_sum_value(s + i);
+
+  BFT_FREE(s);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
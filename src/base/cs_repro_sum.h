@@ -0,0 +1,228 @@
+#ifndef __CS_REPRO_SUM_H__
+#define __CS_REPRO_SUM_H__
+
+/*============================================================================
+ * Reproducible (exact) summation of floating-point values
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/* Number of 32-bit digits (stored in 64-bit words) of an accumulator,
+   covering the whole double precision range with carry headroom */
+
+#define CS_REPRO_SUM_N_WORDS  68
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Exact (fixed-point) accumulator for double precision values */
+
+typedef struct {
+
+  int64_t  w[CS_REPRO_SUM_N_WORDS];  /* digits, least significant first */
+  double   nf;                       /* sum of non-finite values */
+  int      n_add;                    /* additions since normalization */
+
+} cs_repro_sum_t;
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate reproducible parallel sums.
+ *
+ * When active, \ref cs_parall_sum sums double precision values exactly
+ * across ranks, so the result does not depend on the reduction order.
+ *
+ * \param[in]  active  true to activate, false to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_set_active(bool  active);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether reproducible parallel sums are active.
+ *
+ * \return  true if active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_repro_sum_is_active(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize (zero) an accumulator.
+ *
+ * \param[out]  s  accumulator
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_init(cs_repro_sum_t  *s);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a value to an accumulator.
+ *
+ * \param[in, out]  s  accumulator
+ * \param[in]       v  value to add
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_add(cs_repro_sum_t  *s,
+                 double           v);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the values of an array to an accumulator: s += sum(x).
+ *
+ * \param[in, out]  s  accumulator
+ * \param[in]       n  size of array x
+ * \param[in]       x  array of floating-point values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_add_array(cs_repro_sum_t    *s,
+                       cs_lnum_t          n,
+                       const cs_real_t   *x);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the dot product of 2 arrays to an accumulator: s += x.y
+ *
+ * \param[in, out]  s  accumulator
+ * \param[in]       n  size of arrays x and y
+ * \param[in]       x  array of floating-point values
+ * \param[in]       y  array of floating-point values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_add_dot(cs_repro_sum_t    *s,
+                     cs_lnum_t          n,
+                     const cs_real_t   *x,
+                     const cs_real_t   *y);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the weighted dot product of 2 arrays to an accumulator:
+ *        s += sum(x.y.w)
+ *
+ * \param[in, out]  s  accumulator
+ * \param[in]       n  size of arrays w, x and y
+ * \param[in]       w  array of weights
+ * \param[in]       x  array of floating-point values
+ * \param[in]       y  array of floating-point values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_add_wdot(cs_repro_sum_t    *s,
+                      cs_lnum_t          n,
+                      const cs_real_t   *w,
+                      const cs_real_t   *x,
+                      const cs_real_t   *y);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add an accumulator to another one: s += t.
+ *
+ * \param[in, out]  s  accumulator
+ * \param[in]       t  accumulator to add
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_merge(cs_repro_sum_t        *s,
+                   const cs_repro_sum_t  *t);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the (rounded) value of an accumulator.
+ *
+ * The result depends only on the exact sum, not on the order in which
+ * values were added.
+ *
+ * \param[in]  s  accumulator
+ *
+ * \return  accumulated value
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_repro_sum_value(const cs_repro_sum_t  *s);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sum accumulators over all ranks of the default communicator.
+ *
+ * \param[in]       n  number of accumulators
+ * \param[in, out]  s  local accumulators in, global accumulators out
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_parall_merge(int              n,
+                          cs_repro_sum_t   s[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sum double precision values over all ranks of the default
+ *        communicator, with a result independent of the reduction order.
+ *
+ * \param[in]       n    number of values
+ * \param[in, out]  val  local values in, global sums out
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repro_sum_parall(int      n,
+                    double   val[]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_REPRO_SUM_H__ */
@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -48,6 +49,18 @@
 #include <mpi.h>
 #endif
 
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
+#if defined(HAVE_HDF5)
+#include <hdf5.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -69,7 +82,9 @@
 #include "cs_mesh_location.h"
 #include "cs_part_to_block.h"
 #include "cs_parall.h"
+#include "cs_log.h"
 #include "cs_timer.h"
+#include "cs_time_plot.h"
 #include "cs_time_step.h"
 
 /*----------------------------------------------------------------------------
@@ -112,14 +127,50 @@ typedef struct _location_t {
                                          or NULL */
   cs_gnum_t        *_ent_global_num;  /* Private global entity numbers,
                                          or NULL */
+  cs_gnum_t         ent_block_range[2]; /* Global numbers [start, end[ of
+                                           local entities if contiguous by
+                                           increasing rank, or {0, 0} */
 
 } _location_t;
 
+/* Data block staged for asynchronous writing */
+
+typedef struct {
+
+  cs_file_off_t     offset;           /* Offset of data in file */
+  size_t            size;             /* Data size (in bytes) */
+  cs_byte_t        *data;             /* Data already in file format */
+
+} _staged_block_t;
+
+/* Checkpoint file data staged for asynchronous writing */
+
+typedef struct _staged_file_t {
+
+  char              *name;            /* Name of associated file */
+  int                generation;      /* Associated checkpoint generation */
+  int                fd;              /* File descriptor used for writing */
+  int                err_num;         /* Error number in case of failure */
+
+  size_t             n_blocks;        /* Number of staged blocks */
+  size_t             n_blocks_max;    /* Allocated number of staged blocks */
+  _staged_block_t   *blocks;          /* Staged blocks */
+
+  struct _staged_file_t  *next;       /* Next file in queue */
+
+} _staged_file_t;
+
 struct _cs_restart_t {
 
   char              *name;           /* Name of restart file */
 
+  cs_restart_backend_t  backend;     /* File format */
+
   cs_io_t           *fh;             /* Pointer to associated file handle */
+#if defined(HAVE_HDF5)
+  hid_t              h5_file;        /* HDF5 file id, or -1 */
+  hid_t              h5_dxpl;        /* HDF5 data transfer properties */
+#endif
   int                rank_step;      /* Block rank step for parallel IO */
   int                min_block_size; /* Minimum block size for parallel IO */
 
@@ -128,8 +179,44 @@ struct _cs_restart_t {
 
   cs_restart_mode_t  mode;           /* Read or write */
 
+  _staged_file_t    *staged;         /* Data staged for asynchronous
+                                        writing, or NULL */
+
+  cs_restart_codec_t  codec;         /* Compression of written sections */
+  double              codec_tolerance; /* Relative error bound for
+                                          lossy compression */
+
+  int                writer_id;      /* Associated multiwriter id for
+                                        incremental checkpoints, or -1 */
+  int                generation;     /* Version of file for this writer */
+
 };
 
+/* Section info for incremental checkpoints */
+
+typedef struct {
+
+  char                  *name;             /* Section name */
+  int                    location_id;      /* Associated location id */
+  int                    n_location_vals;  /* Number of values per location */
+  cs_restart_val_type_t  val_type;         /* Value type */
+  cs_gnum_t              n_glob_ents;      /* Global number of entities */
+  uint64_t               hash;             /* Hash of section contents */
+  int                    generation;       /* Generation of file version
+                                              containing data, or -1 */
+
+} _delta_section_t;
+
+/* Data holder (hard link to a previous version of a checkpoint file)
+   for incremental checkpoints */
+
+typedef struct {
+
+  int    generation;        /* Generation of linked file version */
+  int    last_ref;          /* Last generation referencing this file */
+
+} _delta_holder_t;
+
 typedef struct {
 
   int    id;                 /* Id of the writer */
@@ -143,6 +230,12 @@ typedef struct {
                                been written */
   char **prev_files;        /* Names of the previous versions */
 
+  int                n_delta_sections;  /* Number of hashed sections */
+  _delta_section_t  *delta_sections;    /* Hashed sections info for
+                                           incremental checkpoints */
+  int                n_delta_holders;   /* Number of data holder files */
+  _delta_holder_t   *delta_holders;     /* Data holder files info */
+
 } _restart_multiwriter_t;
 
 /*============================================================================
@@ -208,6 +301,56 @@ static double _checkpoint_wt_interval = -1.; /* wall-clock interval */
 static double _checkpoint_wt_next = -1.;     /* next forced wall-clock value */
 static double _checkpoint_wt_last = 0.;      /* wall-clock time of last
                                                 checkpointing */
+/* Asynchronous checkpoint writing */
+
+static int    _checkpoint_async = 0;         /* use asynchronous writes */
+static int    _checkpoint_generation = 0;    /* current checkpoint id */
+
+/* Incremental checkpoint writing */
+
+static int    _checkpoint_delta = 0;         /* reference unchanged sections */
+
+#if defined(HAVE_PTHREAD)
+
+static pthread_mutex_t  _async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   _async_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t        _async_thread;
+static bool             _async_thread_created = false;
+static bool             _async_thread_active = false;
+static _staged_file_t  *_async_queue = NULL;  /* files being flushed */
+static _staged_file_t  *_async_done = NULL;   /* flushed files */
+
+#endif
+
+/* Compression of written sections */
+
+static cs_restart_codec_t  _codec_default = CS_RESTART_CODEC_NONE;
+static double              _codec_tolerance_default = 0.;
+
+static const char  _codec_id[] = {'\0',  /* uncompressed */
+                                  'z',   /* byte shuffling + deflate */
+                                  'q'};  /* quantization + 'z' */
+
+static const char  _delta_ref_id = 'r';   /* reference to another file */
+
+/* File format and HDF5 options */
+
+static cs_restart_backend_t  _backend_default = CS_RESTART_BACKEND_CS_IO;
+
+static size_t  _h5_chunk_size = 1048576;        /* target chunk bytes */
+static size_t  _h5_chunk_cache_size = 8388608;  /* chunk cache bytes */
+
+/* Maximum size of global windows for streamed parallel reads (0: none) */
+
+static size_t  _read_window_size = 0;
+
+#if defined(HAVE_ZLIB)
+
+static const cs_gnum_t  _codec_chunk_size = 65536;   /* entities per chunk */
+static const size_t     _codec_prologue_size = 32;   /* prologue bytes */
+
+#endif
+
 /* Are we restarting from a NCFD file ? */
 
 static int    _restart_from_ncfd = 0;
@@ -317,6 +460,8 @@ _locations_from_index(cs_restart_t  *r)
 
       loc->ent_global_num = NULL;
       loc->_ent_global_num = NULL;
+      loc->ent_block_range[0] = 0;
+      loc->ent_block_range[1] = 0;
 
       r->n_locations += 1;
     }
@@ -324,221 +469,2047 @@ _locations_from_index(cs_restart_t  *r)
   }
 }
 
-/*----------------------------------------------------------------------------
- * Initialize a checkpoint / restart file management structure;
- *
- * parameters:
- *   r <-> associated restart file pointer
- *----------------------------------------------------------------------------*/
-
-static void
-_add_file(cs_restart_t  *r)
-{
-  double timing[2];
-  cs_file_access_t method;
-
-  const char magic_string[] = "Checkpoint / restart, R0";
-  const long echo = CS_IO_ECHO_NONE;
-
-  timing[0] = cs_timer_wtime();
-
-  /* In read mode, open file to detect header first */
-
-#if defined(HAVE_MPI)
-  {
-    MPI_Info           hints;
-    MPI_Comm           block_comm, comm;
-
-    cs_file_get_default_comm(NULL, &block_comm, &comm);
-
-    r->rank_step = 1;
-    r->min_block_size = cs_parall_get_min_coll_buf_size();
-    assert(comm == cs_glob_mpi_comm || comm == MPI_COMM_NULL);
-
-    if (r->mode == CS_RESTART_MODE_READ) {
-      cs_file_get_default_access(CS_FILE_MODE_READ, &method, &hints);
-      r->fh = cs_io_initialize_with_index(r->name,
-                                          magic_string,
-                                          method,
-                                          echo,
-                                          hints,
-                                          block_comm,
-                                          comm);
-      _locations_from_index(r);
-    }
-    else {
-      cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
-      r->fh = cs_io_initialize(r->name,
-                               magic_string,
-                               CS_IO_MODE_WRITE,
-                               method,
-                               echo,
-                               hints,
-                               block_comm,
-                               comm);
-    }
-  }
-#else
-  {
-    if (r->mode == CS_RESTART_MODE_READ) {
-      cs_file_get_default_access(CS_FILE_MODE_READ, &method);
-      r->fh = cs_io_initialize_with_index(r->name,
-                                          magic_string,
-                                          method,
-                                          echo);
-      _locations_from_index(r);
-    }
-    else {
-      cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
-      r->fh = cs_io_initialize(r->name,
-                               magic_string,
-                               CS_IO_MODE_WRITE,
-                               method,
-                               echo);
-    }
-  }
-#endif
-
-  timing[1] = cs_timer_wtime();
-  _restart_wtime[r->mode] += timing[1] - timing[0];
-
-  _restart_n_opens[r->mode] += 1;
-}
-
-#if defined(HAVE_MPI)
+#if defined(HAVE_HDF5)
 
 /*----------------------------------------------------------------------------
- * Read variable values defined on a mesh location.
+ * Return HDF5 memory datatype associated with a restart value type.
  *
  * parameters:
- *   r           <-> associated restart file pointer
- *   header          <-- header associated with current position in file
- *   n_glob_ents     <-- global number of entities
- *   n_ents          <-- local number of entities
- *   ent_global_num  <-- global entity numbers (1 to n numbering)
- *   n_location_vals <-- number of values par location
- *   val_type        <-- data type
- *   vals            --> array of values
+ *   val_type <-- data type
+ *
+ * returns:
+ *   matching HDF5 native datatype
  *----------------------------------------------------------------------------*/
 
-static void
-_read_ent_values(cs_restart_t           *r,
-                 cs_io_sec_header_t     *header,
-                 cs_gnum_t               n_glob_ents,
-                 cs_lnum_t               n_ents,
-                 const cs_gnum_t         ent_global_num[],
-                 int                     n_location_vals,
-                 cs_restart_val_type_t   val_type,
-                 cs_byte_t               vals[])
+static hid_t
+_h5_type(cs_restart_val_type_t  val_type)
 {
-  cs_byte_t  *buffer = NULL;
-
-  cs_lnum_t  block_buf_size = 0;
-
-  size_t  nbr_byte_ent;
-
-  /* Initialization */
+  hid_t retval = -1;
 
   switch (val_type) {
   case CS_TYPE_char:
-    nbr_byte_ent = n_location_vals;
+    retval = H5T_NATIVE_CHAR;
     break;
   case CS_TYPE_int:
-    nbr_byte_ent = n_location_vals * sizeof(int);
-    cs_io_set_cs_lnum(header, r->fh);
+    retval = H5T_NATIVE_INT;
     break;
   case CS_TYPE_cs_gnum_t:
-    nbr_byte_ent = n_location_vals * sizeof(cs_gnum_t);
-    cs_io_set_cs_gnum(header, r->fh);
+    retval = (sizeof(cs_gnum_t) == 8) ? H5T_NATIVE_UINT64 : H5T_NATIVE_UINT32;
     break;
   case CS_TYPE_cs_real_t:
-    nbr_byte_ent = n_location_vals * sizeof(cs_real_t);
+    retval =   (sizeof(cs_real_t) == sizeof(double))
+             ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
     break;
   default:
-    nbr_byte_ent = 0;
     assert(0);
   }
 
-  cs_block_dist_info_t bi
-    = cs_block_dist_compute_sizes(cs_glob_rank_id,
-                                  cs_glob_n_ranks,
-                                  r->rank_step,
-                                  r->min_block_size / nbr_byte_ent,
-                                  n_glob_ents);
-
-  cs_all_to_all_t *d
-    = cs_all_to_all_create_from_block(n_ents,
-                                      CS_ALL_TO_ALL_USE_DEST_ID,
-                                      ent_global_num,
-                                      bi,
-                                      cs_glob_mpi_comm);
-
-  /* Read blocks */
+  return retval;
+}
 
-  block_buf_size = (bi.gnum_range[1] - bi.gnum_range[0]) * nbr_byte_ent;
+/*----------------------------------------------------------------------------
+ * Write a scalar attribute to an HDF5 object.
+ *
+ * parameters:
+ *   obj_id    <-- HDF5 object (group or dataset) id
+ *   attr_name <-- attribute name
+ *   type_id   <-- HDF5 memory datatype
+ *   val       <-- pointer to attribute value
+ *----------------------------------------------------------------------------*/
 
-  if (block_buf_size > 0)
-    BFT_MALLOC(buffer, block_buf_size, cs_byte_t);
+static void
+_h5_write_attr(hid_t        obj_id,
+               const char  *attr_name,
+               hid_t        type_id,
+               const void  *val)
+{
+  hid_t space_id = H5Screate(H5S_SCALAR);
+  hid_t attr_id = H5Acreate2(obj_id, attr_name, type_id, space_id,
+                             H5P_DEFAULT, H5P_DEFAULT);
 
-  cs_io_read_block(header,
-                   bi.gnum_range[0],
-                   bi.gnum_range[1],
-                   buffer,
-                   r->fh);
+  H5Awrite(attr_id, type_id, val);
 
- /* Distribute blocks on ranks */
+  H5Aclose(attr_id);
+  H5Sclose(space_id);
+}
 
-  cs_all_to_all_copy_array(d,
-                           header->elt_type,
-                           n_location_vals,
-                           true,  /* reverse */
-                           buffer,
-                           vals);
+/*----------------------------------------------------------------------------
+ * Read a scalar attribute from an HDF5 object.
+ *
+ * parameters:
+ *   obj_id    <-- HDF5 object (group or dataset) id
+ *   attr_name <-- attribute name
+ *   type_id   <-- HDF5 memory datatype
+ *   val       --> pointer to attribute value
+ *
+ * returns:
+ *   0 in case of success, -1 if not present
+ *----------------------------------------------------------------------------*/
 
-  /* Free buffer */
+static int
+_h5_read_attr(hid_t        obj_id,
+              const char  *attr_name,
+              hid_t        type_id,
+              void        *val)
+{
+  if (H5Aexists(obj_id, attr_name) <= 0)
+    return -1;
 
-  BFT_FREE(buffer);
+  hid_t attr_id = H5Aopen(obj_id, attr_name, H5P_DEFAULT);
+  herr_t status = H5Aread(attr_id, type_id, val);
+  H5Aclose(attr_id);
 
-  cs_all_to_all_destroy(&d);
+  return (status < 0) ? -1 : 0;
 }
 
 /*----------------------------------------------------------------------------
- * Write variable values defined on a mesh location.
+ * Open the HDF5 group associated with a restart location.
+ *
+ * Sections defined on location 0 are stored in the root group, and
+ * sections defined on other locations in a "locations/<name>" group.
  *
  * parameters:
- *   r               <-> associated restart file pointer
- *   sec_name        <-- section name
- *   n_glob_ents     <-- global number of entities
- *   n_ents          <-- local number of entities
- *   ent_global_num  <-- global entity numbers (1 to n numbering)
- *   location_id     <-- id of corresponding location
- *   n_location_vals <-- number of values par location
- *   val_type        <-- data type
- *   vals            --> array of values
+ *   r           <-- associated restart file pointer
+ *   location_id <-- location id
+ *
+ * returns:
+ *   HDF5 group id, to be closed by the caller
  *----------------------------------------------------------------------------*/
 
-static void
-_write_ent_values(const cs_restart_t     *r,
-                  const char             *sec_name,
-                  cs_gnum_t               n_glob_ents,
-                  cs_lnum_t               n_ents,
-                  const cs_gnum_t        *ent_global_num,
-                  int                     location_id,
-                  int                     n_location_vals,
-                  cs_restart_val_type_t   val_type,
-                  const cs_byte_t        *vals)
+static hid_t
+_h5_location_group(const cs_restart_t  *r,
+                   int                  location_id)
 {
-  cs_lnum_t  block_buf_size = 0;
+  hid_t retval = -1;
 
-  cs_datatype_t elt_type = CS_DATATYPE_NULL;
-  size_t      nbr_byte_ent = 0;
-  cs_byte_t  *buffer = NULL;
+  if (location_id == 0)
+    retval = H5Gopen2(r->h5_file, "/", H5P_DEFAULT);
 
-  cs_block_dist_info_t bi;
+  else {
+    hid_t g_id = H5Gopen2(r->h5_file, "locations", H5P_DEFAULT);
+    retval = H5Gopen2(g_id, r->location[location_id-1].name, H5P_DEFAULT);
+    H5Gclose(g_id);
+  }
 
-  cs_part_to_block_t *d = NULL;
+  return retval;
+}
 
-  /* Initialization */
+/*----------------------------------------------------------------------------
+ * Check if a restart file is an HDF5 file.
+ *
+ * parameters:
+ *   name <-- restart file name
+ *
+ * returns:
+ *   true if the file exists and is in HDF5 format, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_h5_is_hdf5(const char  *name)
+{
+  int retval = 0;
+
+  if (cs_glob_rank_id < 1) {
+    if (cs_file_isreg(name))
+      retval = (H5Fis_hdf5(name) > 0) ? 1 : 0;
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Bcast(&retval, 1, MPI_INT, 0, cs_glob_mpi_comm);
+#endif
+
+  return (retval) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Build locations from the "locations" group of an HDF5 restart file.
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_h5_locations_from_file(cs_restart_t  *r)
+{
+  if (H5Lexists(r->h5_file, "locations", H5P_DEFAULT) <= 0)
+    return;
+
+  hid_t g_id = H5Gopen2(r->h5_file, "locations", H5P_DEFAULT);
+
+  H5G_info_t g_info;
+  H5Gget_info(g_id, &g_info);
+
+  size_t n_locations = g_info.nlinks;
+
+  BFT_MALLOC(r->location, n_locations, _location_t);
+  for (size_t i = 0; i < n_locations; i++)
+    r->location[i].name = NULL;
+
+  for (size_t i = 0; i < n_locations; i++) {
+
+    char *name = NULL;
+    int location_id = 0;
+    cs_gnum_t n_glob_ents = 0;
+
+    ssize_t l = H5Lget_name_by_idx(g_id, ".", H5_INDEX_NAME, H5_ITER_INC,
+                                   i, NULL, 0, H5P_DEFAULT);
+    BFT_MALLOC(name, l + 1, char);
+    H5Lget_name_by_idx(g_id, ".", H5_INDEX_NAME, H5_ITER_INC,
+                       i, name, l + 1, H5P_DEFAULT);
+
+    hid_t l_id = H5Gopen2(g_id, name, H5P_DEFAULT);
+    _h5_read_attr(l_id, "location_id", H5T_NATIVE_INT, &location_id);
+    _h5_read_attr(l_id, "n_glob_ents", _h5_type(CS_TYPE_cs_gnum_t),
+                  &n_glob_ents);
+    H5Gclose(l_id);
+
+    if (   location_id < 1 || location_id > (int)n_locations
+        || r->location[location_id-1].name != NULL)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Restart file \"%s\" declares location \"%s\"\n"
+                  "with invalid or duplicate number %d."),
+                r->name, name, location_id);
+
+    _location_t  *loc = r->location + location_id - 1;
+
+    loc->name = name;
+    loc->id = location_id;
+    loc->n_ents = 0;
+    loc->n_glob_ents = 0;
+    loc->n_glob_ents_f = n_glob_ents;
+    loc->ent_global_num = NULL;
+    loc->_ent_global_num = NULL;
+    loc->ent_block_range[0] = 0;
+    loc->ent_block_range[1] = 0;
+
+  }
+
+  r->n_locations = n_locations;
+
+  H5Gclose(g_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Open an HDF5 restart file.
+ *
+ * With a parallel HDF5 library, the file is opened by all ranks, and
+ * collective MPI-IO is used. Otherwise, the file is written by rank 0
+ * only (data being gathered to a single block), and read independently
+ * by all ranks.
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_h5_open_file(cs_restart_t  *r)
+{
+  bool io_rank = true;
+
+  hid_t fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+
+  r->h5_file = -1;
+  r->h5_dxpl = H5Pcreate(H5P_DATASET_XFER);
+
+#if defined(HAVE_MPI) && defined(H5_HAVE_PARALLEL)
+
+  if (cs_glob_n_ranks > 1) {
+    MPI_Info hints;
+    cs_file_access_t method;
+    cs_file_get_default_access((r->mode == CS_RESTART_MODE_READ) ?
+                               CS_FILE_MODE_READ : CS_FILE_MODE_WRITE,
+                               &method, &hints);
+    H5Pset_fapl_mpio(fapl_id, cs_glob_mpi_comm, hints);
+#if H5_VERSION_GE(1, 10, 0)
+    H5Pset_all_coll_metadata_ops(fapl_id, true);
+    H5Pset_coll_metadata_write(fapl_id, true);
+#endif
+    H5Pset_dxpl_mpio(r->h5_dxpl, H5FD_MPIO_COLLECTIVE);
+  }
+
+#else
+
+  if (r->mode == CS_RESTART_MODE_WRITE) {
+    r->rank_step = CS_MAX(cs_glob_n_ranks, 1);
+    if (cs_glob_rank_id > 0)
+      io_rank = false;
+  }
+
+#endif
+
+  /* Default raw data chunk cache size for datasets of this file */
+
+  {
+    int mdc_n_elts;
+    size_t rdcc_n_slots, rdcc_n_bytes;
+    double rdcc_w0;
+    H5Pget_cache(fapl_id, &mdc_n_elts, &rdcc_n_slots, &rdcc_n_bytes,
+                 &rdcc_w0);
+    H5Pset_cache(fapl_id, mdc_n_elts, rdcc_n_slots, _h5_chunk_cache_size,
+                 rdcc_w0);
+  }
+
+  if (io_rank) {
+
+    if (r->mode == CS_RESTART_MODE_READ)
+      r->h5_file = H5Fopen(r->name, H5F_ACC_RDONLY, fapl_id);
+    else
+      r->h5_file = H5Fcreate(r->name, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+
+    if (r->h5_file < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error opening file \"%s\" using HDF5."), r->name);
+
+    if (r->mode == CS_RESTART_MODE_READ)
+      _h5_locations_from_file(r);
+    else {
+      hid_t g_id = H5Gcreate2(r->h5_file, "locations",
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+      H5Gclose(g_id);
+    }
+
+  }
+
+  H5Pclose(fapl_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Close an HDF5 restart file.
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_h5_close_file(cs_restart_t  *r)
+{
+  if (r->h5_file >= 0)
+    H5Fclose(r->h5_file);
+  r->h5_file = -1;
+
+  if (r->h5_dxpl >= 0)
+    H5Pclose(r->h5_dxpl);
+  r->h5_dxpl = -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Add a location definition to an HDF5 restart file.
+ *
+ * parameters:
+ *   r             <-- associated restart file pointer
+ *   location_id   <-- location id
+ *   n_glob_ents   <-- global number of entities
+ *----------------------------------------------------------------------------*/
+
+static void
+_h5_add_location(const cs_restart_t  *r,
+                 int                  location_id,
+                 cs_gnum_t            n_glob_ents)
+{
+  if (r->h5_file < 0)
+    return;
+
+  hid_t g_id = H5Gopen2(r->h5_file, "locations", H5P_DEFAULT);
+  hid_t l_id = H5Gcreate2(g_id, r->location[location_id-1].name,
+                          H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+  _h5_write_attr(l_id, "location_id", H5T_NATIVE_INT, &location_id);
+  _h5_write_attr(l_id, "n_glob_ents", _h5_type(CS_TYPE_cs_gnum_t),
+                 &n_glob_ents);
+
+  H5Gclose(l_id);
+  H5Gclose(g_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Select a block of rows of a dataset, and the matching memory space.
+ *
+ * parameters:
+ *   file_space_id   <-- dataset's dataspace
+ *   gnum_range      <-- global number range of selected rows
+ *                       (1 to n numbering)
+ *   n_location_vals <-- number of values per row
+ *
+ * returns:
+ *   matching memory dataspace id, to be closed by the caller
+ *----------------------------------------------------------------------------*/
+
+static hid_t
+_h5_select_block(hid_t            file_space_id,
+                 const cs_gnum_t  gnum_range[2],
+                 int              n_location_vals)
+{
+  int rank = H5Sget_simple_extent_ndims(file_space_id);
+
+  hsize_t start[2] = {gnum_range[0] - 1, 0};
+  hsize_t count[2] = {gnum_range[1] - gnum_range[0], n_location_vals};
+
+  hid_t mem_space_id = H5Screate_simple(rank, count, NULL);
+
+  if (count[0] > 0)
+    H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET,
+                        start, NULL, count, NULL);
+  else {
+    H5Sselect_none(file_space_id);
+    H5Sselect_none(mem_space_id);
+  }
+
+  return mem_space_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a block of a section to an HDF5 restart file.
+ *
+ * The dataset is created first (collectively in the case of parallel HDF5).
+ * Sections on mesh locations use 2-dimensional datasets, chunked based
+ * on the current chunk size setting.
+ *
+ * parameters:
+ *   r               <-- associated restart file pointer
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_glob_ents     <-- global number of entities (or values for location 0)
+ *   n_location_vals <-- number of values per location
+ *   val_type        <-- data type
+ *   gnum_range      <-- global number range of local block
+ *   vals            <-- array of values for local block
+ *----------------------------------------------------------------------------*/
+
+static void
+_h5_write_block(const cs_restart_t     *r,
+                const char             *sec_name,
+                int                     location_id,
+                cs_gnum_t               n_glob_ents,
+                int                     n_location_vals,
+                cs_restart_val_type_t   val_type,
+                const cs_gnum_t         gnum_range[2],
+                const void             *vals)
+{
+  if (r->h5_file < 0)
+    return;
+
+  const hid_t type_id = _h5_type(val_type);
+  const int rank = (location_id == 0) ? 1 : 2;
+
+  hsize_t dims[2] = {n_glob_ents, n_location_vals};
+
+  hid_t file_space_id = H5Screate_simple(rank, dims, NULL);
+  hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+
+  H5Pset_fill_time(dcpl_id, H5D_FILL_TIME_NEVER);
+
+  if (location_id > 0 && n_glob_ents > 0) {
+
+    size_t row_size = H5Tget_size(type_id) * n_location_vals;
+    hsize_t chunk[2] = {_h5_chunk_size / row_size, n_location_vals};
+    if (chunk[0] < 1)
+      chunk[0] = 1;
+    else if (chunk[0] > n_glob_ents)
+      chunk[0] = n_glob_ents;
+
+    H5Pset_chunk(dcpl_id, 2, chunk);
+
+    /* Filters require collective writes with parallel HDF5 >= 1.10.2 */
+
+#if defined(H5_HAVE_PARALLEL) && !H5_VERSION_GE(1, 10, 2)
+    bool use_filters = (cs_glob_n_ranks > 1) ? false : true;
+#else
+    bool use_filters = true;
+#endif
+
+    if (   r->codec != CS_RESTART_CODEC_NONE && use_filters
+        && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) {
+      H5Pset_shuffle(dcpl_id);
+      H5Pset_deflate(dcpl_id, 1);
+    }
+
+  }
+
+  hid_t g_id = _h5_location_group(r, location_id);
+
+  if (H5Lexists(g_id, sec_name, H5P_DEFAULT) > 0)
+    H5Ldelete(g_id, sec_name, H5P_DEFAULT);
+
+  hid_t dset_id = H5Dcreate2(g_id, sec_name, type_id, file_space_id,
+                             H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+
+  hid_t mem_space_id = _h5_select_block(file_space_id,
+                                        gnum_range,
+                                        n_location_vals);
+
+  /* Avoid a NULL buffer for empty selections */
+
+  const char empty_buf[1] = {'\0'};
+  const void *_vals = (vals != NULL) ? vals : empty_buf;
+
+  herr_t status = H5Dwrite(dset_id, type_id, mem_space_id, file_space_id,
+                           r->h5_dxpl, _vals);
+
+  if (dset_id < 0 || status < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error writing section \"%s\" to restart file \"%s\"."),
+              sec_name, r->name);
+
+  H5Sclose(mem_space_id);
+  H5Dclose(dset_id);
+  H5Gclose(g_id);
+  H5Pclose(dcpl_id);
+  H5Sclose(file_space_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a block of a section from an HDF5 restart file.
+ *
+ * parameters:
+ *   r               <-- associated restart file pointer
+ *   dset_id         <-- associated dataset id
+ *   n_location_vals <-- number of values per location
+ *   val_type        <-- data type
+ *   gnum_range      <-- global number range of local block
+ *   vals            --> array of values for local block
+ *----------------------------------------------------------------------------*/
+
+static void
+_h5_read_block(const cs_restart_t     *r,
+               hid_t                   dset_id,
+               int                     n_location_vals,
+               cs_restart_val_type_t   val_type,
+               const cs_gnum_t         gnum_range[2],
+               void                   *vals)
+{
+  hid_t file_space_id = H5Dget_space(dset_id);
+  hid_t mem_space_id = _h5_select_block(file_space_id,
+                                        gnum_range,
+                                        n_location_vals);
+
+  char empty_buf[1];
+  void *_vals = (vals != NULL) ? vals : empty_buf;
+
+  herr_t status = H5Dread(dset_id, _h5_type(val_type),
+                          mem_space_id, file_space_id,
+                          r->h5_dxpl, _vals);
+
+  if (status < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading data from restart file \"%s\"."), r->name);
+
+  H5Sclose(mem_space_id);
+  H5Sclose(file_space_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Print the datasets of an HDF5 restart file group.
+ *
+ * The "locations" group is skipped.
+ *
+ * parameters:
+ *   g_id   <-- HDF5 group id
+ *   prefix <-- prefix for printed names
+ *----------------------------------------------------------------------------*/
+
+static void
+_h5_dump_group(hid_t        g_id,
+               const char  *prefix)
+{
+  H5G_info_t g_info;
+  H5Gget_info(g_id, &g_info);
+
+  for (hsize_t i = 0; i < g_info.nlinks; i++) {
+
+    char *name = NULL;
+    ssize_t l = H5Lget_name_by_idx(g_id, ".", H5_INDEX_NAME, H5_ITER_INC,
+                                   i, NULL, 0, H5P_DEFAULT);
+    BFT_MALLOC(name, l + 1, char);
+    H5Lget_name_by_idx(g_id, ".", H5_INDEX_NAME, H5_ITER_INC,
+                       i, name, l + 1, H5P_DEFAULT);
+
+    if (strcmp(name, "locations") == 0) {
+      BFT_FREE(name);
+      continue;
+    }
+
+    hsize_t dims[2] = {0, 1};
+    hid_t dset_id = H5Dopen2(g_id, name, H5P_DEFAULT);
+    hid_t space_id = H5Dget_space(dset_id);
+    H5Sget_simple_extent_dims(space_id, dims, NULL);
+    H5Sclose(space_id);
+    H5Dclose(dset_id);
+
+    bft_printf(_("    %s%s: %llu x %llu\n"), prefix, name,
+               (unsigned long long)dims[0], (unsigned long long)dims[1]);
+
+    BFT_FREE(name);
+
+  }
+}
+
+#endif /* defined(HAVE_HDF5) */
+
+/*----------------------------------------------------------------------------
+ * Initialize a checkpoint / restart file management structure;
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_file(cs_restart_t  *r)
+{
+  double timing[2];
+  cs_file_access_t method;
+
+  const char magic_string[] = "Checkpoint / restart, R0";
+  const long echo = CS_IO_ECHO_NONE;
+
+  timing[0] = cs_timer_wtime();
+
+#if defined(HAVE_HDF5)
+
+  /* HDF5 format is detected automatically in read mode */
+
+  if (r->mode == CS_RESTART_MODE_READ && _h5_is_hdf5(r->name))
+    r->backend = CS_RESTART_BACKEND_HDF5;
+
+  if (r->backend == CS_RESTART_BACKEND_HDF5) {
+
+#if defined(HAVE_MPI)
+    r->rank_step = 1;
+    r->min_block_size = cs_parall_get_min_coll_buf_size();
+#endif
+
+    _h5_open_file(r);
+
+    timing[1] = cs_timer_wtime();
+    _restart_wtime[r->mode] += timing[1] - timing[0];
+
+    _restart_n_opens[r->mode] += 1;
+
+    return;
+  }
+
+#endif /* defined(HAVE_HDF5) */
+
+  /* In read mode, open file to detect header first */
+
+#if defined(HAVE_MPI)
+  {
+    MPI_Info           hints;
+    MPI_Comm           block_comm, comm;
+
+    cs_file_get_default_comm(NULL, &block_comm, &comm);
+
+    r->rank_step = 1;
+    r->min_block_size = cs_parall_get_min_coll_buf_size();
+    assert(comm == cs_glob_mpi_comm || comm == MPI_COMM_NULL);
+
+    /* With asynchronous writes, data is staged on (and written by)
+       the block IO ranks only */
+
+    if (r->staged != NULL)
+      cs_file_get_default_comm(&(r->rank_step), NULL, NULL);
+
+    if (r->mode == CS_RESTART_MODE_READ) {
+      cs_file_get_default_access(CS_FILE_MODE_READ, &method, &hints);
+      r->fh = cs_io_initialize_with_index(r->name,
+                                          magic_string,
+                                          method,
+                                          echo,
+                                          hints,
+                                          block_comm,
+                                          comm);
+      _locations_from_index(r);
+    }
+    else {
+      cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+      r->fh = cs_io_initialize(r->name,
+                               magic_string,
+                               CS_IO_MODE_WRITE,
+                               method,
+                               echo,
+                               hints,
+                               block_comm,
+                               comm);
+    }
+  }
+#else
+  {
+    if (r->mode == CS_RESTART_MODE_READ) {
+      cs_file_get_default_access(CS_FILE_MODE_READ, &method);
+      r->fh = cs_io_initialize_with_index(r->name,
+                                          magic_string,
+                                          method,
+                                          echo);
+      _locations_from_index(r);
+    }
+    else {
+      cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
+      r->fh = cs_io_initialize(r->name,
+                               magic_string,
+                               CS_IO_MODE_WRITE,
+                               method,
+                               echo);
+    }
+  }
+#endif
+
+  timing[1] = cs_timer_wtime();
+  _restart_wtime[r->mode] += timing[1] - timing[0];
+
+  _restart_n_opens[r->mode] += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a structure for data staged for asynchronous writing.
+ *
+ * parameters:
+ *   name       <-- associated file name
+ *   generation <-- associated checkpoint generation
+ *
+ * returns:
+ *   pointer to new staged file structure
+ *----------------------------------------------------------------------------*/
+
+static _staged_file_t *
+_staged_file_create(const char  *name,
+                    int          generation)
+{
+  _staged_file_t *sf = NULL;
+
+  BFT_MALLOC(sf, 1, _staged_file_t);
+
+  BFT_MALLOC(sf->name, strlen(name) + 1, char);
+  strcpy(sf->name, name);
+
+  sf->generation = generation;
+  sf->fd = -1;
+  sf->err_num = 0;
+
+  sf->n_blocks = 0;
+  sf->n_blocks_max = 0;
+  sf->blocks = NULL;
+
+  sf->next = NULL;
+
+  return sf;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Add a data block to a staged file structure.
+ *
+ * The staged file structure takes ownership of the data.
+ *
+ * parameters:
+ *   sf     <-> pointer to staged file structure
+ *   offset <-- offset of data in file
+ *   size   <-- data size, in bytes
+ *   data   <-- data, already in file format
+ *----------------------------------------------------------------------------*/
+
+static void
+_staged_file_add_block(_staged_file_t  *sf,
+                       cs_file_off_t    offset,
+                       size_t           size,
+                       cs_byte_t       *data)
+{
+  if (sf->n_blocks >= sf->n_blocks_max) {
+    sf->n_blocks_max = CS_MAX(sf->n_blocks_max*2, 16);
+    BFT_REALLOC(sf->blocks, sf->n_blocks_max, _staged_block_t);
+  }
+
+  _staged_block_t *b = sf->blocks + sf->n_blocks;
+
+  b->offset = offset;
+  b->size = size;
+  b->data = data;
+
+  sf->n_blocks += 1;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Destroy a staged file structure, checking for write errors.
+ *
+ * parameters:
+ *   sf <-> pointer to staged file structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_staged_file_destroy(_staged_file_t  **sf)
+{
+  _staged_file_t *_sf = *sf;
+
+  if (_sf->err_num != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error writing checkpoint file \"%s\":\n\n  %s"),
+              _sf->name, strerror(_sf->err_num));
+
+  for (size_t i = 0; i < _sf->n_blocks; i++)
+    BFT_FREE(_sf->blocks[i].data);
+
+  BFT_FREE(_sf->blocks);
+  BFT_FREE(_sf->name);
+
+  BFT_FREE(*sf);
+}
+
+/*----------------------------------------------------------------------------
+ * Write staged data to the associated file descriptor, then close it.
+ *
+ * This function may be called from a background thread, so it does not
+ * allocate memory, use MPI, or raise errors (they are only recorded).
+ *
+ * parameters:
+ *   sf <-> pointer to staged file structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_staged_file_flush(_staged_file_t  *sf)
+{
+  for (size_t i = 0; i < sf->n_blocks && sf->err_num == 0; i++) {
+
+    const cs_byte_t *p = sf->blocks[i].data;
+    size_t n = sf->blocks[i].size;
+    off_t offset = sf->blocks[i].offset;
+
+    while (n > 0) {
+      ssize_t n_w = pwrite(sf->fd, p, n, offset);
+      if (n_w < 0) {
+        if (errno == EINTR)
+          continue;
+        sf->err_num = errno;
+        break;
+      }
+      p += n_w;
+      n -= n_w;
+      offset += n_w;
+    }
+
+  }
+
+  if (close(sf->fd) != 0 && sf->err_num == 0)
+    sf->err_num = errno;
+
+  sf->fd = -1;
+}
+
+#if defined(HAVE_PTHREAD)
+
+/*----------------------------------------------------------------------------
+ * Main function of the background checkpoint writing thread.
+ *
+ * Files are flushed in queue order; a file remains in the queue until
+ * it has been flushed, so that waits may be based on the queue contents.
+ *
+ * parameters:
+ *   arg <-- unused
+ *
+ * returns:
+ *   NULL
+ *----------------------------------------------------------------------------*/
+
+static void *
+_async_thread_main(void  *arg)
+{
+  CS_UNUSED(arg);
+
+  pthread_mutex_lock(&_async_mutex);
+
+  while (_async_queue != NULL) {
+
+    _staged_file_t *sf = _async_queue;
+
+    pthread_mutex_unlock(&_async_mutex);
+
+    _staged_file_flush(sf);
+
+    pthread_mutex_lock(&_async_mutex);
+
+    _async_queue = sf->next;
+    sf->next = _async_done;
+    _async_done = sf;
+
+    pthread_cond_broadcast(&_async_cond);
+
+  }
+
+  _async_thread_active = false;
+  pthread_cond_broadcast(&_async_cond);
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  return NULL;
+}
+
+#endif /* defined(HAVE_PTHREAD) */
+
+/*----------------------------------------------------------------------------
+ * Free structures associated with already flushed files.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_free_done(void)
+{
+#if defined(HAVE_PTHREAD)
+
+  pthread_mutex_lock(&_async_mutex);
+
+  _staged_file_t *sf = _async_done;
+  _async_done = NULL;
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  while (sf != NULL) {
+    _staged_file_t *sf_next = sf->next;
+    _staged_file_destroy(&sf);
+    sf = sf_next;
+  }
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Submit staged data for writing.
+ *
+ * The associated file must already have been closed by all ranks.
+ * With thread support, data is written by a background thread; otherwise,
+ * it is written immediately.
+ *
+ * parameters:
+ *   sf <-> pointer to staged file structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_submit(_staged_file_t  *sf)
+{
+  if (sf->n_blocks == 0) {
+    _staged_file_destroy(&sf);
+    return;
+  }
+
+  sf->fd = open(sf->name, O_WRONLY);
+
+  if (sf->fd < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error opening file \"%s\":\n\n  %s"),
+              sf->name, strerror(errno));
+
+#if defined(HAVE_PTHREAD)
+
+  pthread_mutex_lock(&_async_mutex);
+
+  if (_async_queue == NULL)
+    _async_queue = sf;
+  else {
+    _staged_file_t *sf_last = _async_queue;
+    while (sf_last->next != NULL)
+      sf_last = sf_last->next;
+    sf_last->next = sf;
+  }
+
+  /* (Re)start background thread if needed; a previous thread which
+     found an empty queue has exited or is about to, so join it first */
+
+  if (_async_thread_active == false) {
+    if (_async_thread_created)
+      pthread_join(_async_thread, NULL);
+    _async_thread_active = true;
+    _async_thread_created = true;
+    if (pthread_create(&_async_thread, NULL, _async_thread_main, NULL) != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error creating checkpoint writing thread:\n\n  %s"),
+                strerror(errno));
+  }
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  _async_free_done();
+
+#else
+
+  _staged_file_flush(sf);
+  _staged_file_destroy(&sf);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of asynchronous writes.
+ *
+ * parameters:
+ *   name       <-- if non-NULL, only wait for writes to this file
+ *   generation <-- if >= 0, only wait for writes of this checkpoint
+ *                  generation or older ones
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_wait(const char  *name,
+            int          generation)
+{
+#if defined(HAVE_PTHREAD)
+
+  pthread_mutex_lock(&_async_mutex);
+
+  bool pending = true;
+
+  while (pending) {
+    pending = false;
+    for (_staged_file_t *sf = _async_queue; sf != NULL; sf = sf->next) {
+      if (   (name == NULL || strcmp(sf->name, name) == 0)
+          && (generation < 0 || sf->generation <= generation)) {
+        pending = true;
+        break;
+      }
+    }
+    if (pending)
+      pthread_cond_wait(&_async_cond, &_async_mutex);
+  }
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  _async_free_done();
+
+#else
+
+  CS_UNUSED(name);
+  CS_UNUSED(generation);
+
+#endif
+}
+
+#if defined(HAVE_ZLIB)
+
+/*----------------------------------------------------------------------------
+ * Store a 64-bit unsigned integer in little-endian byte order.
+ *
+ * parameters:
+ *   b <-> pointer to 8-byte destination
+ *   v <-- value
+ *----------------------------------------------------------------------------*/
+
+static void
+_codec_put_u64(unsigned char  *b,
+               uint64_t        v)
+{
+  for (int i = 0; i < 8; i++)
+    b[i] = (v >> (8*i)) & 0xff;
+}
+
+/*----------------------------------------------------------------------------
+ * Load a 64-bit unsigned integer stored in little-endian byte order.
+ *
+ * parameters:
+ *   b <-- pointer to 8-byte source
+ *
+ * returns:
+ *   loaded value
+ *----------------------------------------------------------------------------*/
+
+static uint64_t
+_codec_get_u64(const unsigned char  *b)
+{
+  uint64_t v = 0;
+
+  for (int i = 0; i < 8; i++)
+    v |= ((uint64_t)b[i]) << (8*i);
+
+  return v;
+}
+
+/*----------------------------------------------------------------------------
+ * Return byte position of a given significance in a multibyte value,
+ * so that shuffled data does not depend on the host's endianness.
+ *
+ * parameters:
+ *   elt_size <-- element size
+ *   p        <-- byte significance (0 for least significant byte)
+ *
+ * returns:
+ *   byte position in value
+ *----------------------------------------------------------------------------*/
+
+static inline size_t
+_codec_byte_pos(size_t  elt_size,
+                size_t  p)
+{
+  const unsigned int one = 1;
+
+  if (*((const unsigned char *)&one) == 1)
+    return p;
+  else
+    return elt_size - 1 - p;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the quantization step used for a section with lossy compression.
+ *
+ * The error bound is relative to the maximum absolute value of the section,
+ * so the associated reduction is global. A zero step is returned when
+ * quantization is not applicable (in which case lossless compression
+ * is used).
+ *
+ * parameters:
+ *   r      <-- associated restart file pointer
+ *   n_vals <-- local number of values
+ *   vals   <-- values
+ *
+ * returns:
+ *   quantization step, or 0
+ *----------------------------------------------------------------------------*/
+
+static double
+_codec_q_step(const cs_restart_t  *r,
+              size_t               n_vals,
+              const cs_real_t      vals[])
+{
+  double v_max = 0.;
+
+  for (size_t i = 0; i < n_vals; i++) {
+    double v = fabs(vals[i]);
+    if (v > v_max)
+      v_max = v;
+    else if (isnan(v))
+      v_max = HUGE_VAL;
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    double v_max_l = v_max;
+    MPI_Allreduce(&v_max_l, &v_max, 1, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  double q_step = 2. * r->codec_tolerance * v_max;
+
+  /* Keep quantized values well within 64-bit integer range */
+
+  if (!isfinite(v_max) || !(q_step > 0.) || v_max / q_step > 1.e15)
+    q_step = 0.;
+
+  return q_step;
+}
+
+/*----------------------------------------------------------------------------
+ * Encode a range of real values, in chunks of consecutive entities.
+ *
+ * Byte planes of values (or of zigzag-encoded differences of quantized
+ * values, if q_step > 0) are gathered, and the result is compressed
+ * using deflate.
+ *
+ * The caller is responsible for freeing the returned arrays.
+ *
+ * parameters:
+ *   q_step          <-- quantization step, or 0 for lossless encoding
+ *   n_ents          <-- number of entities
+ *   n_location_vals <-- number of values per entity
+ *   vals            <-- values
+ *   n_chunks        --> number of encoded chunks
+ *   chunk_info      --> number of entities and encoded size of each chunk
+ *   n_bytes         --> encoded data size
+ *
+ * returns:
+ *   encoded data
+ *----------------------------------------------------------------------------*/
+
+static unsigned char *
+_codec_encode(double            q_step,
+              cs_gnum_t         n_ents,
+              int               n_location_vals,
+              const cs_real_t   vals[],
+              cs_gnum_t        *n_chunks,
+              cs_gnum_t       **chunk_info,
+              size_t           *n_bytes)
+{
+  const size_t stride = n_location_vals;
+  const size_t elt_size = (q_step > 0.) ? 8 : sizeof(cs_real_t);
+  const cs_gnum_t chunk_size = _codec_chunk_size;
+
+  cs_gnum_t _n_chunks = (n_ents + chunk_size - 1) / chunk_size;
+
+  size_t raw_size = CS_MIN(n_ents, chunk_size) * stride * elt_size;
+  size_t out_size = 0, out_max = 0;
+  unsigned char *raw = NULL, *out = NULL;
+  cs_gnum_t *_chunk_info = NULL;
+
+  BFT_MALLOC(raw, raw_size, unsigned char);
+  BFT_MALLOC(_chunk_info, _n_chunks*2, cs_gnum_t);
+
+  for (cs_gnum_t c_id = 0; c_id < _n_chunks; c_id++) {
+
+    const cs_gnum_t e_s = c_id*chunk_size;
+    const cs_gnum_t e_e = CS_MIN(e_s + chunk_size, n_ents);
+    const size_t n_c_vals = (e_e - e_s) * stride;
+    const cs_real_t *c_vals = vals + e_s*stride;
+
+    /* Byte shuffling (with prior quantization and prediction if lossy) */
+
+    if (q_step > 0.) {
+      for (size_t j = 0; j < stride; j++) {
+        int64_t q_prev = 0;
+        for (size_t k = j; k < n_c_vals; k += stride) {
+          int64_t q = llround(c_vals[k] / q_step);
+          int64_t d = q - q_prev;
+          uint64_t z = ((uint64_t)d << 1) ^ (uint64_t)(d >> 63);
+          q_prev = q;
+          for (size_t p = 0; p < 8; p++)
+            raw[p*n_c_vals + k] = (z >> (8*p)) & 0xff;
+        }
+      }
+    }
+    else {
+      const unsigned char *b = (const unsigned char *)c_vals;
+      for (size_t p = 0; p < elt_size; p++) {
+        const size_t b_pos = _codec_byte_pos(elt_size, p);
+        for (size_t k = 0; k < n_c_vals; k++)
+          raw[p*n_c_vals + k] = b[k*elt_size + b_pos];
+      }
+    }
+
+    /* Compression */
+
+    uLong c_raw_size = n_c_vals * elt_size;
+    uLongf c_size = compressBound(c_raw_size);
+
+    if (out_size + c_size > out_max) {
+      out_max = CS_MAX(out_max*2, out_size + c_size);
+      BFT_REALLOC(out, out_max, unsigned char);
+    }
+
+    int z_ret = compress2(out + out_size, &c_size, raw, c_raw_size,
+                          Z_BEST_SPEED);
+
+    if (z_ret != Z_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error compressing restart data (zlib error %d)."),
+                z_ret);
+
+    _chunk_info[c_id*2]     = e_e - e_s;
+    _chunk_info[c_id*2 + 1] = c_size;
+    out_size += c_size;
+  }
+
+  BFT_FREE(raw);
+
+  *n_chunks = _n_chunks;
+  *chunk_info = _chunk_info;
+  *n_bytes = out_size;
+
+  return out;
+}
+
+/*----------------------------------------------------------------------------
+ * Decode a range of encoded chunks.
+ *
+ * parameters:
+ *   sec_name        <-- section name (for error messages)
+ *   q_step          <-- quantization step, or 0 for lossless encoding
+ *   elt_size        <-- size of values in file (for lossless encoding)
+ *   n_chunks        <-- number of chunks
+ *   chunk_info      <-- number of entities and encoded size of each chunk
+ *   n_location_vals <-- number of values per entity
+ *   data            <-- encoded data
+ *   vals            --> decoded values
+ *----------------------------------------------------------------------------*/
+
+static void
+_codec_decode(const char            *sec_name,
+              double                 q_step,
+              size_t                 elt_size,
+              cs_gnum_t              n_chunks,
+              const cs_gnum_t        chunk_info[],
+              int                    n_location_vals,
+              const unsigned char   *data,
+              cs_real_t              vals[])
+{
+  const size_t stride = n_location_vals;
+
+  size_t raw_max = 0;
+  unsigned char *raw = NULL;
+
+  if (q_step > 0.)
+    elt_size = 8;
+
+  for (cs_gnum_t c_id = 0; c_id < n_chunks; c_id++) {
+
+    const size_t n_c_vals = chunk_info[c_id*2] * stride;
+
+    uLongf c_raw_size = n_c_vals * elt_size;
+
+    if (c_raw_size > raw_max) {
+      raw_max = c_raw_size;
+      BFT_REALLOC(raw, raw_max, unsigned char);
+    }
+
+    int z_ret = uncompress(raw, &c_raw_size, data, chunk_info[c_id*2 + 1]);
+
+    if (z_ret != Z_OK || c_raw_size != n_c_vals * elt_size)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error decompressing restart section \"%s\"."),
+                sec_name);
+
+    if (q_step > 0.) {
+      for (size_t j = 0; j < stride; j++) {
+        int64_t q = 0;
+        for (size_t k = j; k < n_c_vals; k += stride) {
+          uint64_t z = 0;
+          for (size_t p = 0; p < 8; p++)
+            z |= ((uint64_t)raw[p*n_c_vals + k]) << (8*p);
+          q += (int64_t)(z >> 1) ^ -(int64_t)(z & 1);
+          vals[k] = q * q_step;
+        }
+      }
+    }
+    else {
+      unsigned char v[8];
+      for (size_t k = 0; k < n_c_vals; k++) {
+        for (size_t p = 0; p < elt_size; p++)
+          v[_codec_byte_pos(elt_size, p)] = raw[p*n_c_vals + k];
+        if (elt_size == sizeof(cs_real_t))
+          memcpy(vals + k, v, elt_size);
+        else if (elt_size == sizeof(float)) {
+          float f;
+          memcpy(&f, v, elt_size);
+          vals[k] = f;
+        }
+        else {
+          double d;
+          memcpy(&d, v, elt_size);
+          vals[k] = d;
+        }
+      }
+    }
+
+    data += chunk_info[c_id*2 + 1];
+    vals += n_c_vals;
+  }
+
+  BFT_FREE(raw);
+}
+
+#endif /* defined(HAVE_ZLIB) */
+
+/*----------------------------------------------------------------------------
+ * Write compressed real values defined on a mesh location.
+ *
+ * Values are given for a contiguous range of entities (in global number
+ * order), with successive ranks holding successive ranges.
+ *
+ * The section data consists of a prologue (element size, number of values
+ * per entity, quantization step, and number of chunks), a table of chunk
+ * sizes (number of entities and encoded size), and encoded chunks.
+ * Chunks of an already encoded section may thus be decoded by different
+ * ranks than those which encoded them.
+ *
+ * With asynchronous writing, the local data is staged instead of written.
+ *
+ * parameters:
+ *   r               <-> associated restart file pointer
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values par location
+ *   n_ents          <-- local number of entities
+ *   vals            <-- array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_compressed(const cs_restart_t  *r,
+                  const char          *sec_name,
+                  int                  location_id,
+                  int                  n_location_vals,
+                  cs_gnum_t            n_ents,
+                  const cs_real_t      vals[])
+{
+#if defined(HAVE_ZLIB)
+
+  cs_gnum_t n_chunks = 0;
+  cs_gnum_t *chunk_info = NULL;
+  size_t n_bytes = 0;
+  unsigned char *c_data = NULL;
+
+  double q_step = 0.;
+
+  if (r->codec == CS_RESTART_CODEC_LOSSY)
+    q_step = _codec_q_step(r, n_ents*n_location_vals, vals);
+
+  c_data = _codec_encode(q_step, n_ents, n_location_vals, vals,
+                         &n_chunks, &chunk_info, &n_bytes);
+
+  /* Gather chunk table on rank 0 */
+
+  cs_gnum_t n_g_chunks = n_chunks;
+  cs_gnum_t *g_chunk_info = chunk_info;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    int _n_chunks = n_chunks;
+    int *count = NULL, *displ = NULL;
+
+    if (cs_glob_rank_id == 0) {
+      BFT_MALLOC(count, cs_glob_n_ranks, int);
+      BFT_MALLOC(displ, cs_glob_n_ranks, int);
+    }
+
+    MPI_Gather(&_n_chunks, 1, MPI_INT, count, 1, MPI_INT, 0,
+               cs_glob_mpi_comm);
+
+    if (cs_glob_rank_id == 0) {
+      n_g_chunks = 0;
+      for (int i = 0; i < cs_glob_n_ranks; i++) {
+        count[i] *= 2;
+        displ[i] = n_g_chunks*2;
+        n_g_chunks += count[i]/2;
+      }
+      BFT_MALLOC(g_chunk_info, n_g_chunks*2, cs_gnum_t);
+    }
+
+    MPI_Gatherv(chunk_info, _n_chunks*2, CS_MPI_GNUM,
+                g_chunk_info, count, displ, CS_MPI_GNUM,
+                0, cs_glob_mpi_comm);
+
+    BFT_FREE(displ);
+    BFT_FREE(count);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Prepend prologue and chunk table on rank 0 */
+
+  if (cs_glob_rank_id < 1) {
+
+    size_t p_size = _codec_prologue_size + n_g_chunks*16;
+    unsigned char *p_data = NULL;
+    uint64_t q_bits;
+    memcpy(&q_bits, &q_step, 8);
+
+    BFT_MALLOC(p_data, p_size + n_bytes, unsigned char);
+
+    _codec_put_u64(p_data,      sizeof(cs_real_t));
+    _codec_put_u64(p_data + 8,  n_location_vals);
+    _codec_put_u64(p_data + 16, q_bits);
+    _codec_put_u64(p_data + 24, n_g_chunks);
+
+    for (cs_gnum_t i = 0; i < n_g_chunks*2; i++)
+      _codec_put_u64(p_data + _codec_prologue_size + i*8, g_chunk_info[i]);
+
+    if (n_bytes > 0)
+      memcpy(p_data + p_size, c_data, n_bytes);
+
+    BFT_FREE(c_data);
+    c_data = p_data;
+    n_bytes += p_size;
+  }
+
+  if (g_chunk_info != chunk_info)
+    BFT_FREE(g_chunk_info);
+  BFT_FREE(chunk_info);
+
+  /* Write data, tagging the section header with the codec id */
+
+  if (q_step > 0.)
+    cs_io_set_codec(r->fh, _codec_id[CS_RESTART_CODEC_LOSSY]);
+  else
+    cs_io_set_codec(r->fh, _codec_id[CS_RESTART_CODEC_LOSSLESS]);
+
+  if (cs_glob_n_ranks == 1)
+    cs_io_write_global(sec_name,
+                       n_bytes,
+                       location_id,
+                       0,
+                       n_location_vals,
+                       CS_CHAR,
+                       c_data,
+                       r->fh);
+
+#if defined(HAVE_MPI)
+
+  else {
+
+    cs_gnum_t l_size = n_bytes, g_start = 0, n_g_bytes = 0;
+
+    MPI_Exscan(&l_size, &g_start, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+    MPI_Allreduce(&l_size, &n_g_bytes, 1, CS_MPI_GNUM, MPI_SUM,
+                  cs_glob_mpi_comm);
+
+    if (cs_glob_rank_id == 0)
+      g_start = 0;
+    g_start += 1;
+
+    if (r->staged != NULL) {
+
+      cs_file_off_t offset = cs_io_write_block_deferred(sec_name,
+                                                        n_g_bytes,
+                                                        g_start,
+                                                        g_start + l_size,
+                                                        location_id,
+                                                        0,
+                                                        n_location_vals,
+                                                        CS_CHAR,
+                                                        c_data,
+                                                        r->fh);
+
+      if (n_bytes > 0) {
+        _staged_file_add_block(r->staged, offset, n_bytes,
+                               (cs_byte_t *)c_data);
+        c_data = NULL;
+      }
+
+    }
+
+    else
+      cs_io_write_block_buffer(sec_name,
+                               n_g_bytes,
+                               g_start,
+                               g_start + l_size,
+                               location_id,
+                               0,
+                               n_location_vals,
+                               CS_CHAR,
+                               c_data,
+                               r->fh);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  cs_io_set_codec(r->fh, 0);
+
+  BFT_FREE(c_data);
+
+#else
+
+  CS_UNUSED(r);
+  CS_UNUSED(sec_name);
+  CS_UNUSED(location_id);
+  CS_UNUSED(n_location_vals);
+  CS_UNUSED(n_ents);
+  CS_UNUSED(vals);
+
+  assert(0);  /* codec is always reset when zlib is not available */
+
+#endif /* defined(HAVE_ZLIB) */
+}
+
+/*----------------------------------------------------------------------------
+ * Read compressed real values defined on a mesh location.
+ *
+ * The file position should already be set to the section's data.
+ *
+ * In serial mode, values are returned in global entity order.
+ * In parallel, chunks are distributed evenly among ranks for decoding,
+ * and decoded values are then redistributed to the ranks needing them.
+ *
+ * parameters:
+ *   r               <-> associated restart file pointer
+ *   header          <-- header associated with current position in file
+ *   rec_id          <-- id of section in file index
+ *   n_glob_ents     <-- global number of entities
+ *   n_ents          <-- local number of entities
+ *   ent_global_num  <-- global entity numbers (1 to n numbering)
+ *   n_location_vals <-- number of values par location
+ *   vals            --> array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_compressed(cs_restart_t        *r,
+                 cs_io_sec_header_t  *header,
+                 size_t               rec_id,
+                 cs_gnum_t            n_glob_ents,
+                 cs_lnum_t            n_ents,
+                 const cs_gnum_t     *ent_global_num,
+                 int                  n_location_vals,
+                 cs_real_t            vals[])
+{
+#if defined(HAVE_ZLIB)
+
+  unsigned char prologue[32];
+  unsigned char *c_data = NULL;
+  cs_gnum_t *chunk_info = NULL;
+
+  /* Read prologue and chunk table */
+
+  memset(prologue, 0, _codec_prologue_size);
+
+  if (cs_glob_n_ranks == 1)
+    c_data = cs_io_read_global(header, NULL, r->fh);
+
+#if defined(HAVE_MPI)
+
+  else {
+    cs_gnum_t p_start = (cs_glob_rank_id == 0) ? 1 : _codec_prologue_size+1;
+    cs_io_read_block(header, p_start, _codec_prologue_size + 1,
+                     prologue, r->fh);
+    MPI_Bcast(prologue, _codec_prologue_size, MPI_UNSIGNED_CHAR, 0,
+              cs_glob_mpi_comm);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (   c_data != NULL
+      && header->n_vals >= (cs_file_off_t)_codec_prologue_size)
+    memcpy(prologue, c_data, _codec_prologue_size);
+
+  const size_t elt_size = _codec_get_u64(prologue);
+  const cs_gnum_t n_chunks = _codec_get_u64(prologue + 24);
+  const uint64_t q_bits = _codec_get_u64(prologue + 16);
+  double q_step;
+  memcpy(&q_step, &q_bits, 8);
+
+  const cs_gnum_t p_size = _codec_prologue_size + n_chunks*16;
+
+  if (   (elt_size != 4 && elt_size != 8)
+      || _codec_get_u64(prologue + 8) != (uint64_t)n_location_vals
+      || (cs_gnum_t)(header->n_vals) < p_size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Compressed restart section \"%s\" is not consistent."),
+              header->sec_name);
+
+  BFT_MALLOC(chunk_info, n_chunks*2, cs_gnum_t);
+
+  if (cs_glob_n_ranks == 1) {
+    for (cs_gnum_t i = 0; i < n_chunks*2; i++)
+      chunk_info[i] = _codec_get_u64(c_data + _codec_prologue_size + i*8);
+  }
+
+#if defined(HAVE_MPI)
+
+  else {
+    unsigned char *p_data = NULL;
+    BFT_MALLOC(p_data, p_size, unsigned char);
+    cs_io_set_indexed_position(r->fh, header, rec_id);
+    cs_io_read_block(header, (cs_glob_rank_id == 0) ? 1 : p_size + 1,
+                     p_size + 1, p_data, r->fh);
+    MPI_Bcast(p_data, p_size, MPI_UNSIGNED_CHAR, 0, cs_glob_mpi_comm);
+    for (cs_gnum_t i = 0; i < n_chunks*2; i++)
+      chunk_info[i] = _codec_get_u64(p_data + _codec_prologue_size + i*8);
+    BFT_FREE(p_data);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  cs_gnum_t n_c_ents = 0, n_c_bytes = 0;
+  for (cs_gnum_t i = 0; i < n_chunks; i++) {
+    n_c_ents += chunk_info[i*2];
+    n_c_bytes += chunk_info[i*2 + 1];
+  }
+
+  if (   n_c_ents != n_glob_ents
+      || p_size + n_c_bytes != (cs_gnum_t)(header->n_vals))
+    bft_error(__FILE__, __LINE__, 0,
+              _("Compressed restart section \"%s\" is not consistent."),
+              header->sec_name);
+
+  /* Serial mode: decode all chunks */
+
+  if (cs_glob_n_ranks == 1) {
+
+    _codec_decode(header->sec_name, q_step, elt_size,
+                  n_chunks, chunk_info, n_location_vals,
+                  c_data + p_size, vals);
+
+    BFT_FREE(c_data);
+
+  }
+
+#if defined(HAVE_MPI)
+
+  /* Parallel mode: decode a range of chunks on each rank */
+
+  else {
+
+    const size_t nbr_byte_ent = n_location_vals * sizeof(cs_real_t);
+    const cs_datatype_t elt_type
+      =   (sizeof(cs_real_t) == cs_datatype_size[CS_DOUBLE])
+        ? CS_DOUBLE : CS_FLOAT;
+
+    cs_gnum_t c_s = (n_chunks * cs_glob_rank_id) / cs_glob_n_ranks;
+    cs_gnum_t c_e = (n_chunks * (cs_glob_rank_id + 1)) / cs_glob_n_ranks;
+
+    cs_gnum_t e_s = 0, b_s = 0, b_e = 0, n_d_ents = 0;
+    for (cs_gnum_t i = 0; i < c_e; i++) {
+      if (i < c_s) {
+        e_s += chunk_info[i*2];
+        b_s += chunk_info[i*2 + 1];
+      }
+      else {
+        n_d_ents += chunk_info[i*2];
+        b_e += chunk_info[i*2 + 1];
+      }
+    }
+    b_e += b_s;
+
+    /* Rank 0 reads from the section start, and skips the chunk table */
+
+    cs_gnum_t r_s = (cs_glob_rank_id == 0) ? 1 : p_size + b_s + 1;
+    cs_gnum_t r_e = p_size + b_e + 1;
+
+    BFT_MALLOC(c_data, r_e - r_s, unsigned char);
+
+    cs_io_set_indexed_position(r->fh, header, rec_id);
+    cs_io_read_block(header, r_s, r_e, c_data, r->fh);
+
+    cs_real_t *d_vals = NULL;
+    cs_gnum_t *d_gnum = NULL;
+    BFT_MALLOC(d_vals, n_d_ents*n_location_vals, cs_real_t);
+    BFT_MALLOC(d_gnum, n_d_ents, cs_gnum_t);
+
+    _codec_decode(header->sec_name, q_step, elt_size,
+                  c_e - c_s, chunk_info + c_s*2, n_location_vals,
+                  c_data + (p_size + b_s + 1 - r_s), d_vals);
+
+    BFT_FREE(c_data);
+
+    for (cs_gnum_t i = 0; i < n_d_ents; i++)
+      d_gnum[i] = e_s + i + 1;
+
+    /* Redistribute decoded values to blocks, then to ranks */
+
+    cs_block_dist_info_t bi
+      = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    r->rank_step,
+                                    r->min_block_size / nbr_byte_ent,
+                                    n_glob_ents);
+
+    cs_part_to_block_t *pd
+      = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        bi,
+                                        n_d_ents,
+                                        d_gnum);
+
+    cs_real_t *b_vals = NULL;
+    BFT_MALLOC(b_vals,
+               (bi.gnum_range[1] - bi.gnum_range[0]) * n_location_vals,
+               cs_real_t);
+
+    cs_part_to_block_copy_array(pd,
+                                elt_type,
+                                n_location_vals,
+                                d_vals,
+                                b_vals);
+
+    cs_part_to_block_destroy(&pd);
+
+    BFT_FREE(d_gnum);
+    BFT_FREE(d_vals);
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_ents,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        ent_global_num,
+                                        bi,
+                                        cs_glob_mpi_comm);
+
+    cs_all_to_all_copy_array(d,
+                             elt_type,
+                             n_location_vals,
+                             true,  /* reverse */
+                             b_vals,
+                             vals);
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(b_vals);
+  }
+
+#else
+
+  CS_UNUSED(rec_id);
+  CS_UNUSED(n_ents);
+  CS_UNUSED(ent_global_num);
+
+#endif /* defined(HAVE_MPI) */
+
+  BFT_FREE(chunk_info);
+
+#else
+
+  CS_UNUSED(r);
+  CS_UNUSED(rec_id);
+  CS_UNUSED(n_glob_ents);
+  CS_UNUSED(n_ents);
+  CS_UNUSED(ent_global_num);
+  CS_UNUSED(n_location_vals);
+  CS_UNUSED(vals);
+
+  bft_error(__FILE__, __LINE__, 0,
+            _("Restart section \"%s\" is compressed, but this build\n"
+              "does not include zlib support."), header->sec_name);
+
+#endif /* defined(HAVE_ZLIB) */
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Read variable values defined on a mesh location, one window of global
+ * entity numbers at a time.
+ *
+ * Each window is read by blocks and redistributed separately, so that
+ * temporary buffers are bounded by the window size rather than by the
+ * section size. Windows are read in sequence, and their size is a
+ * multiple of 256 entities, so that no body alignment padding is
+ * expected between them.
+ *
+ * parameters:
+ *   r               <-> associated restart file pointer
+ *   header          <-- header associated with current position in file
+ *   n_glob_ents     <-- global number of entities
+ *   n_ents          <-- local number of entities
+ *   ent_global_num  <-- global entity numbers (1 to n numbering)
+ *   n_location_vals <-- number of values par location
+ *   nbr_byte_ent    <-- number of bytes per entity
+ *   n_w_ents        <-- number of entities per window
+ *   vals            --> array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_ent_values_by_window(cs_restart_t           *r,
+                           cs_io_sec_header_t     *header,
+                           cs_gnum_t               n_glob_ents,
+                           cs_lnum_t               n_ents,
+                           const cs_gnum_t         ent_global_num[],
+                           int                     n_location_vals,
+                           size_t                  nbr_byte_ent,
+                           cs_gnum_t               n_w_ents,
+                           cs_byte_t               vals[])
+{
+  cs_lnum_t  *w_ids = NULL;
+  cs_gnum_t  *w_gnum = NULL;
+  cs_byte_t  *w_vals = NULL, *buffer = NULL;
+
+  for (cs_gnum_t w_start = 1; w_start <= n_glob_ents; w_start += n_w_ents) {
+
+    cs_gnum_t w_end = CS_MIN(w_start + n_w_ents, n_glob_ents + 1);
+
+    /* Local entities in window, with window-relative global numbers */
+
+    cs_lnum_t n_w = 0;
+    for (cs_lnum_t i = 0; i < n_ents; i++) {
+      if (ent_global_num[i] >= w_start && ent_global_num[i] < w_end)
+        n_w++;
+    }
+
+    BFT_REALLOC(w_ids, n_w, cs_lnum_t);
+    BFT_REALLOC(w_gnum, n_w, cs_gnum_t);
+    BFT_REALLOC(w_vals, n_w*nbr_byte_ent, cs_byte_t);
+
+    n_w = 0;
+    for (cs_lnum_t i = 0; i < n_ents; i++) {
+      if (ent_global_num[i] >= w_start && ent_global_num[i] < w_end) {
+        w_ids[n_w] = i;
+        w_gnum[n_w] = ent_global_num[i] - w_start + 1;
+        n_w++;
+      }
+    }
+
+    cs_block_dist_info_t bi
+      = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    r->rank_step,
+                                    r->min_block_size / nbr_byte_ent,
+                                    w_end - w_start);
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_w,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        w_gnum,
+                                        bi,
+                                        cs_glob_mpi_comm);
+
+    /* Read window blocks (file position advances with each window) */
+
+    BFT_REALLOC(buffer,
+                (bi.gnum_range[1] - bi.gnum_range[0]) * nbr_byte_ent,
+                cs_byte_t);
+
+    cs_io_read_block(header,
+                     bi.gnum_range[0],
+                     bi.gnum_range[1],
+                     buffer,
+                     r->fh);
+
+    /* Distribute blocks on ranks, then scatter to local entities */
+
+    cs_all_to_all_copy_array(d,
+                             header->elt_type,
+                             n_location_vals,
+                             true,  /* reverse */
+                             buffer,
+                             w_vals);
+
+    cs_all_to_all_destroy(&d);
+
+    for (cs_lnum_t j = 0; j < n_w; j++)
+      memcpy(vals + w_ids[j]*nbr_byte_ent,
+             w_vals + j*nbr_byte_ent,
+             nbr_byte_ent);
+
+  }
+
+  BFT_FREE(buffer);
+  BFT_FREE(w_vals);
+  BFT_FREE(w_gnum);
+  BFT_FREE(w_ids);
+}
+
+/*----------------------------------------------------------------------------
+ * Read variable values defined on a mesh location.
+ *
+ * parameters:
+ *   r           <-> associated restart file pointer
+ *   header          <-- header associated with current position in file
+ *   n_glob_ents     <-- global number of entities
+ *   n_ents          <-- local number of entities
+ *   ent_global_num  <-- global entity numbers (1 to n numbering)
+ *   n_location_vals <-- number of values par location
+ *   val_type        <-- data type
+ *   vals            --> array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_ent_values(cs_restart_t           *r,
+                 cs_io_sec_header_t     *header,
+                 cs_gnum_t               n_glob_ents,
+                 cs_lnum_t               n_ents,
+                 const cs_gnum_t         ent_global_num[],
+                 int                     n_location_vals,
+                 cs_restart_val_type_t   val_type,
+                 cs_byte_t               vals[])
+{
+  cs_byte_t  *buffer = NULL;
+
+  cs_lnum_t  block_buf_size = 0;
+
+  size_t  nbr_byte_ent;
+
+  /* Initialization */
+
+  switch (val_type) {
+  case CS_TYPE_char:
+    nbr_byte_ent = n_location_vals;
+    break;
+  case CS_TYPE_int:
+    nbr_byte_ent = n_location_vals * sizeof(int);
+    cs_io_set_cs_lnum(header, r->fh);
+    break;
+  case CS_TYPE_cs_gnum_t:
+    nbr_byte_ent = n_location_vals * sizeof(cs_gnum_t);
+    cs_io_set_cs_gnum(header, r->fh);
+    break;
+  case CS_TYPE_cs_real_t:
+    nbr_byte_ent = n_location_vals * sizeof(cs_real_t);
+    break;
+  default:
+    nbr_byte_ent = 0;
+    assert(0);
+  }
+
+  /* Streamed reads for large sections */
+
+  if (_read_window_size > 0) {
+    cs_gnum_t n_w_ents = (_read_window_size / nbr_byte_ent) / 256 * 256;
+    if (n_w_ents < 256)
+      n_w_ents = 256;
+    if (n_w_ents < n_glob_ents) {
+      _read_ent_values_by_window(r,
+                                 header,
+                                 n_glob_ents,
+                                 n_ents,
+                                 ent_global_num,
+                                 n_location_vals,
+                                 nbr_byte_ent,
+                                 n_w_ents,
+                                 vals);
+      return;
+    }
+  }
+
+  cs_block_dist_info_t bi
+    = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                  cs_glob_n_ranks,
+                                  r->rank_step,
+                                  r->min_block_size / nbr_byte_ent,
+                                  n_glob_ents);
+
+  cs_all_to_all_t *d
+    = cs_all_to_all_create_from_block(n_ents,
+                                      CS_ALL_TO_ALL_USE_DEST_ID,
+                                      ent_global_num,
+                                      bi,
+                                      cs_glob_mpi_comm);
+
+  /* Read blocks */
+
+  block_buf_size = (bi.gnum_range[1] - bi.gnum_range[0]) * nbr_byte_ent;
+
+  if (block_buf_size > 0)
+    BFT_MALLOC(buffer, block_buf_size, cs_byte_t);
+
+  cs_io_read_block(header,
+                   bi.gnum_range[0],
+                   bi.gnum_range[1],
+                   buffer,
+                   r->fh);
+
+ /* Distribute blocks on ranks */
+
+  cs_all_to_all_copy_array(d,
+                           header->elt_type,
+                           n_location_vals,
+                           true,  /* reverse */
+                           buffer,
+                           vals);
+
+  /* Free buffer */
+
+  BFT_FREE(buffer);
+
+  cs_all_to_all_destroy(&d);
+}
+
+/*----------------------------------------------------------------------------
+ * Write variable values defined on a mesh location.
+ *
+ * parameters:
+ *   r               <-> associated restart file pointer
+ *   sec_name        <-- section name
+ *   n_glob_ents     <-- global number of entities
+ *   n_ents          <-- local number of entities
+ *   ent_global_num  <-- global entity numbers (1 to n numbering)
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values par location
+ *   val_type        <-- data type
+ *   vals            --> array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_ent_values(const cs_restart_t     *r,
+                  const char             *sec_name,
+                  cs_gnum_t               n_glob_ents,
+                  cs_lnum_t               n_ents,
+                  const cs_gnum_t        *ent_global_num,
+                  int                     location_id,
+                  int                     n_location_vals,
+                  cs_restart_val_type_t   val_type,
+                  const cs_byte_t        *vals)
+{
+  cs_lnum_t  block_buf_size = 0;
+
+  cs_datatype_t elt_type = CS_DATATYPE_NULL;
+  size_t      nbr_byte_ent = 0;
+  cs_byte_t  *buffer = NULL;
+
+  cs_block_dist_info_t bi;
+
+  cs_part_to_block_t *d = NULL;
+
+  /* Initialization */
 
   switch (val_type) {
   case CS_TYPE_char:
@@ -588,18 +2559,59 @@ _write_ent_values(const cs_restart_t     *r,
                               vals,
                               buffer);
 
-  /* Write blocks */
+  /* Write blocks, or stage them for asynchronous writing */
+
+#if defined(HAVE_HDF5)
+  if (r->backend == CS_RESTART_BACKEND_HDF5)
+    _h5_write_block(r,
+                    sec_name,
+                    location_id,
+                    n_glob_ents,
+                    n_location_vals,
+                    val_type,
+                    bi.gnum_range,
+                    buffer);
+  else
+#endif
+  if (r->codec != CS_RESTART_CODEC_NONE && val_type == CS_TYPE_cs_real_t)
+    _write_compressed(r,
+                      sec_name,
+                      location_id,
+                      n_location_vals,
+                      bi.gnum_range[1] - bi.gnum_range[0],
+                      (const cs_real_t *)buffer);
+
+  else if (r->staged != NULL) {
+
+    cs_file_off_t offset = cs_io_write_block_deferred(sec_name,
+                                                      n_glob_ents,
+                                                      bi.gnum_range[0],
+                                                      bi.gnum_range[1],
+                                                      location_id,
+                                                      0,
+                                                      n_location_vals,
+                                                      elt_type,
+                                                      buffer,
+                                                      r->fh);
+
+    if (block_buf_size > 0) {
+      _staged_file_add_block(r->staged, offset, block_buf_size, buffer);
+      buffer = NULL;
+    }
 
-  cs_io_write_block_buffer(sec_name,
-                           n_glob_ents,
-                           bi.gnum_range[0],
-                           bi.gnum_range[1],
-                           location_id,
-                           0,
-                           n_location_vals,
-                           elt_type,
-                           buffer,
-                           r->fh);
+  }
+
+  else
+    cs_io_write_block_buffer(sec_name,
+                             n_glob_ents,
+                             bi.gnum_range[0],
+                             bi.gnum_range[1],
+                             location_id,
+                             0,
+                             n_location_vals,
+                             elt_type,
+                             buffer,
+                             r->fh);
 
   /* Free buffer */
 
@@ -608,6 +2620,100 @@ _write_ent_values(const cs_restart_t     *r,
   cs_part_to_block_destroy(&d);
 }
 
+/*----------------------------------------------------------------------------
+ * Write variable values defined on a location whose global numbering
+ * is contiguous by increasing rank.
+ *
+ * Each rank writes its own values directly as a block of the section,
+ * so no redistribution is required.
+ *
+ * parameters:
+ *   r               <-> associated restart file pointer
+ *   sec_name        <-- section name
+ *   n_glob_ents     <-- global number of entities
+ *   block_range     <-- global numbers [start, end[ of local entities
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values par location
+ *   val_type        <-- data type
+ *   vals            --> array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_ent_values_contiguous(const cs_restart_t     *r,
+                             const char             *sec_name,
+                             cs_gnum_t               n_glob_ents,
+                             const cs_gnum_t         block_range[2],
+                             int                     location_id,
+                             int                     n_location_vals,
+                             cs_restart_val_type_t   val_type,
+                             const cs_byte_t        *vals)
+{
+  cs_datatype_t elt_type = CS_DATATYPE_NULL;
+  size_t      nbr_byte_ent = 0;
+
+  switch (val_type) {
+  case CS_TYPE_char:
+    nbr_byte_ent = n_location_vals;
+    elt_type = CS_CHAR;
+    break;
+  case CS_TYPE_int:
+    nbr_byte_ent = n_location_vals * sizeof(int);
+    elt_type = (sizeof(int) == 8) ? CS_INT64 : CS_INT32;
+    break;
+  case CS_TYPE_cs_gnum_t:
+    nbr_byte_ent = n_location_vals * sizeof(cs_gnum_t);
+    elt_type = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+    break;
+  case CS_TYPE_cs_real_t:
+    nbr_byte_ent = n_location_vals * sizeof(cs_real_t);
+    elt_type =   (sizeof(cs_real_t) == cs_datatype_size[CS_DOUBLE])
+               ? CS_DOUBLE : CS_FLOAT;
+    break;
+  default:
+    assert(0);
+  }
+
+  if (r->staged != NULL) {
+
+    /* Staged blocks are owned by the staging queue, so copy values */
+
+    size_t n_bytes = (block_range[1] - block_range[0]) * nbr_byte_ent;
+    cs_byte_t *buffer = NULL;
+
+    if (n_bytes > 0) {
+      BFT_MALLOC(buffer, n_bytes, cs_byte_t);
+      memcpy(buffer, vals, n_bytes);
+    }
+
+    cs_file_off_t offset = cs_io_write_block_deferred(sec_name,
+                                                      n_glob_ents,
+                                                      block_range[0],
+                                                      block_range[1],
+                                                      location_id,
+                                                      0,
+                                                      n_location_vals,
+                                                      elt_type,
+                                                      buffer,
+                                                      r->fh);
+
+    if (n_bytes > 0)
+      _staged_file_add_block(r->staged, offset, n_bytes, buffer);
+
+  }
+
+  else
+    cs_io_write_block(sec_name,
+                      n_glob_ents,
+                      block_range[0],
+                      block_range[1],
+                      location_id,
+                      0,
+                      n_location_vals,
+                      elt_type,
+                      vals,
+                      r->fh);
+}
+
 #endif /* #if defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
@@ -804,34 +2910,372 @@ _restart_permute_write(cs_lnum_t               n_ents,
             = val_cur[ii++];
       }
 
-      return (cs_byte_t *)val_ord;
-    }
-    break;
+      return (cs_byte_t *)val_ord;
+    }
+    break;
+
+  case CS_TYPE_cs_real_t:
+    {
+      cs_real_t  *val_ord;
+      const cs_real_t  *val_cur = (const cs_real_t *)vals;
+
+      BFT_MALLOC(val_ord, n_ents * n_location_vals, cs_real_t);
+
+      for (ent_id = 0; ent_id < n_ents; ent_id++) {
+        for (jj = 0; jj < n_location_vals; jj++)
+          val_ord[(ini_ent_num[ent_id] - 1) * n_location_vals + jj]
+            = val_cur[ii++];
+      }
+
+      return (cs_byte_t *)val_ord;
+    }
+    break;
+
+  default:
+    assert(0);
+    return NULL;
+
+  }
+}
+
+#if defined(HAVE_HDF5)
+
+/*----------------------------------------------------------------------------
+ * Check the presence and compatibility of a section in an HDF5
+ * restart file.
+ *
+ * Location checks are assumed to have been done by the caller.
+ *
+ * parameters:
+ *   restart         <-- associated restart file pointer
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val_type        <-- value type
+ *   verbose         <-- if true, log reason for incompatibility
+ *   dset_id         --> if non-NULL, id of open dataset in case of success
+ *
+ * returns:
+ *   0 (CS_RESTART_SUCCESS) in case of success,
+ *   or error code (CS_RESTART_ERR_xxx) in case of error
+ *----------------------------------------------------------------------------*/
+
+static int
+_h5_check_section(const cs_restart_t     *restart,
+                  const char             *sec_name,
+                  int                     location_id,
+                  int                     n_location_vals,
+                  cs_restart_val_type_t   val_type,
+                  bool                    verbose,
+                  hid_t                  *dset_id)
+{
+  int retval = CS_RESTART_SUCCESS;
+
+  hid_t g_id = _h5_location_group(restart, location_id);
+
+  /* If the section is not found, search other locations */
+
+  if (H5Lexists(g_id, sec_name, H5P_DEFAULT) <= 0) {
+
+    H5Gclose(g_id);
+
+    retval = CS_RESTART_ERR_EXISTS;
+
+    for (int l_id = 0; l_id <= (int)(restart->n_locations); l_id++) {
+      if (l_id == location_id)
+        continue;
+      g_id = _h5_location_group(restart, l_id);
+      htri_t exists = H5Lexists(g_id, sec_name, H5P_DEFAULT);
+      H5Gclose(g_id);
+      if (exists > 0) {
+        if (verbose)
+          bft_printf(_("  %s: section \"%s\" at location id %d "
+                       "but not at %d.\n"),
+                     restart->name, sec_name, l_id, location_id);
+        retval = CS_RESTART_ERR_LOCATION;
+        break;
+      }
+    }
+
+    if (retval == CS_RESTART_ERR_EXISTS && verbose)
+      bft_printf(_("  %s: section \"%s\" not present.\n"),
+                 restart->name, sec_name);
+
+    return retval;
+  }
+
+  hid_t _dset_id = H5Dopen2(g_id, sec_name, H5P_DEFAULT);
+
+  H5Gclose(g_id);
+
+  /* Check the number of values per location */
+
+  hsize_t dims[2] = {0, 0};
+  hid_t space_id = H5Dget_space(_dset_id);
+  int rank = H5Sget_simple_extent_ndims(space_id);
+  H5Sget_simple_extent_dims(space_id, dims, NULL);
+  H5Sclose(space_id);
+
+  if (location_id > 0 && (rank != 2 || dims[1] != (hsize_t)n_location_vals)) {
+    if (verbose)
+      bft_printf(_("  %s: section \"%s\" has %d values per location and "
+                   " not %d.\n"),
+                 restart->name, sec_name,
+                 (rank == 2) ? (int)dims[1] : 1, n_location_vals);
+    retval = CS_RESTART_ERR_N_VALS;
+  }
+  else if (location_id == 0 && dims[0] != (hsize_t)n_location_vals) {
+    if (verbose)
+      bft_printf(_("  %s: section \"%s\" has %d values and not %d.\n"),
+                 restart->name, sec_name, (int)dims[0], n_location_vals);
+    retval = CS_RESTART_ERR_N_VALS;
+  }
+
+  /* Check the type of values */
+
+  if (retval == CS_RESTART_SUCCESS) {
+
+    hid_t type_id = H5Dget_type(_dset_id);
+    H5T_class_t t_class = H5Tget_class(type_id);
+    size_t t_size = H5Tget_size(type_id);
+    H5T_sign_t t_sign = H5Tget_sign(type_id);
+    H5Tclose(type_id);
+
+    const char *type_name = NULL;
+
+    if (t_class == H5T_INTEGER && t_size == 1) {
+      if (val_type != CS_TYPE_char)
+        type_name = _("character");
+    }
+    else if (t_class == H5T_INTEGER && t_sign != H5T_SGN_NONE) {
+      if (val_type != CS_TYPE_int)
+        type_name = _("integer");
+    }
+    else if (t_class == H5T_INTEGER) {
+      if (val_type != CS_TYPE_cs_gnum_t && val_type != CS_TYPE_int)
+        type_name = _("global number");
+    }
+    else if (t_class == H5T_FLOAT) {
+      if (val_type != CS_TYPE_cs_real_t)
+        type_name = _("floating-point");
+    }
+    else
+      type_name = _("supported");
+
+    if (type_name != NULL) {
+      if (verbose)
+        bft_printf(_("  %s: section \"%s\" is not of %s type.\n"),
+                   restart->name, sec_name, type_name);
+      retval = CS_RESTART_ERR_VAL_TYPE;
+    }
+
+  }
+
+  if (retval == CS_RESTART_SUCCESS && dset_id != NULL)
+    *dset_id = _dset_id;
+  else
+    H5Dclose(_dset_id);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a section from an HDF5 restart file.
+ *
+ * Location checks are assumed to have been done by the caller.
+ *
+ * parameters:
+ *   restart         <-- associated restart file pointer
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val_type        <-- value type
+ *   val             --> array of values
+ *
+ * returns:
+ *   0 (CS_RESTART_SUCCESS) in case of success,
+ *   or error code (CS_RESTART_ERR_xxx) in case of error
+ *----------------------------------------------------------------------------*/
+
+static int
+_h5_read_section(cs_restart_t           *restart,
+                 const char             *sec_name,
+                 int                     location_id,
+                 int                     n_location_vals,
+                 cs_restart_val_type_t   val_type,
+                 void                   *val)
+{
+  hid_t dset_id = -1;
+
+  int retval = _h5_check_section(restart,
+                                 sec_name,
+                                 location_id,
+                                 n_location_vals,
+                                 val_type,
+                                 true,
+                                 &dset_id);
+
+  if (retval != CS_RESTART_SUCCESS)
+    return retval;
+
+  /* In single processor mode or for global values */
+
+  if (cs_glob_n_ranks == 1 || location_id == 0) {
+
+    cs_gnum_t n_glob_ents = n_location_vals;
+    int _n_location_vals = 1;
+    cs_lnum_t n_ents = 0;
+    const cs_gnum_t *ent_global_num = NULL;
+
+    if (location_id > 0) {
+      n_glob_ents = restart->location[location_id-1].n_glob_ents;
+      _n_location_vals = n_location_vals;
+      n_ents = restart->location[location_id-1].n_ents;
+      ent_global_num = restart->location[location_id-1].ent_global_num;
+    }
+
+    const cs_gnum_t gnum_range[2] = {1, n_glob_ents + 1};
+
+    _h5_read_block(restart, dset_id, _n_location_vals, val_type,
+                   gnum_range, val);
+
+    if (ent_global_num != NULL)
+      _restart_permute_read(n_ents,
+                            ent_global_num,
+                            _n_location_vals,
+                            val_type,
+                            val);
+  }
+
+#if defined(HAVE_MPI)
+
+  /* In parallel mode for a distributed mesh location */
+
+  else {
+
+    const _location_t *loc = restart->location + location_id - 1;
+
+    cs_datatype_t elt_type = CS_DATATYPE_NULL;
+    size_t nbr_byte_ent = H5Tget_size(_h5_type(val_type)) * n_location_vals;
+
+    switch (val_type) {
+    case CS_TYPE_char:
+      elt_type = CS_CHAR;
+      break;
+    case CS_TYPE_int:
+      elt_type = (sizeof(int) == 8) ? CS_INT64 : CS_INT32;
+      break;
+    case CS_TYPE_cs_gnum_t:
+      elt_type = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+      break;
+    case CS_TYPE_cs_real_t:
+      elt_type =   (sizeof(cs_real_t) == cs_datatype_size[CS_DOUBLE])
+                 ? CS_DOUBLE : CS_FLOAT;
+      break;
+    default:
+      assert(0);
+    }
+
+    cs_block_dist_info_t bi
+      = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    restart->rank_step,
+                                    restart->min_block_size / nbr_byte_ent,
+                                    loc->n_glob_ents);
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(loc->n_ents,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        loc->ent_global_num,
+                                        bi,
+                                        cs_glob_mpi_comm);
+
+    cs_byte_t *buffer = NULL;
+    cs_lnum_t block_buf_size
+      = (bi.gnum_range[1] - bi.gnum_range[0]) * nbr_byte_ent;
+
+    if (block_buf_size > 0)
+      BFT_MALLOC(buffer, block_buf_size, cs_byte_t);
+
+    _h5_read_block(restart, dset_id, n_location_vals, val_type,
+                   bi.gnum_range, buffer);
 
-  case CS_TYPE_cs_real_t:
-    {
-      cs_real_t  *val_ord;
-      const cs_real_t  *val_cur = (const cs_real_t *)vals;
+    cs_all_to_all_copy_array(d,
+                             elt_type,
+                             n_location_vals,
+                             true,  /* reverse */
+                             buffer,
+                             val);
 
-      BFT_MALLOC(val_ord, n_ents * n_location_vals, cs_real_t);
+    BFT_FREE(buffer);
 
-      for (ent_id = 0; ent_id < n_ents; ent_id++) {
-        for (jj = 0; jj < n_location_vals; jj++)
-          val_ord[(ini_ent_num[ent_id] - 1) * n_location_vals + jj]
-            = val_cur[ii++];
-      }
+    cs_all_to_all_destroy(&d);
+  }
 
-      return (cs_byte_t *)val_ord;
-    }
-    break;
+#endif /* #if defined(HAVE_MPI) */
 
-  default:
-    assert(0);
-    return NULL;
+  H5Dclose(dset_id);
+
+  return CS_RESTART_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a section to an HDF5 restart file from a single rank.
+ *
+ * This is used for global values, in serial mode, or for empty locations;
+ * values are written by rank 0.
+ *
+ * parameters:
+ *   restart         <-- associated restart file pointer
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val_type        <-- value type
+ *   val             <-- array of values
+ *----------------------------------------------------------------------------*/
 
+static void
+_h5_write_section_serial(const cs_restart_t     *restart,
+                         const char             *sec_name,
+                         int                     location_id,
+                         int                     n_location_vals,
+                         cs_restart_val_type_t   val_type,
+                         const void             *val)
+{
+  cs_gnum_t n_glob_ents = n_location_vals;
+  int _n_location_vals = 1;
+  cs_byte_t *val_tmp = NULL;
+
+  if (location_id > 0) {
+    const _location_t *loc = restart->location + location_id - 1;
+    n_glob_ents = loc->n_glob_ents;
+    _n_location_vals = n_location_vals;
+    if (loc->ent_global_num != NULL && n_glob_ents > 0)
+      val_tmp = _restart_permute_write(loc->n_ents,
+                                       loc->ent_global_num,
+                                       _n_location_vals,
+                                       val_type,
+                                       (const cs_byte_t *)val);
   }
+
+  cs_gnum_t gnum_range[2] = {1, n_glob_ents + 1};
+  if (cs_glob_rank_id > 0)
+    gnum_range[1] = 1;
+
+  _h5_write_block(restart,
+                  sec_name,
+                  location_id,
+                  n_glob_ents,
+                  _n_location_vals,
+                  val_type,
+                  gnum_range,
+                  (val_tmp != NULL) ? val_tmp : val);
+
+  BFT_FREE(val_tmp);
 }
 
+#endif /* defined(HAVE_HDF5) */
+
 /*----------------------------------------------------------------------------
  * Find a given record in an indexed restart file.
  *
@@ -885,6 +3329,22 @@ _restart_section_id(cs_restart_t     *restart,
 
   /* Search for the record in the index */
 
+#if defined(HAVE_HDF5)
+  if (restart->backend == CS_RESTART_BACKEND_HDF5) {
+    index_size = 1;
+    rec_id = 1;
+    for (int l_id = 0; l_id <= (int)(restart->n_locations); l_id++) {
+      hid_t g_id = _h5_location_group(restart, l_id);
+      htri_t exists = H5Lexists(g_id, sec_name, H5P_DEFAULT);
+      H5Gclose(g_id);
+      if (exists > 0) {
+        rec_id = 0;
+        break;
+      }
+    }
+  }
+  else
+#endif
   for (rec_id = 0; rec_id < (int)index_size; rec_id++) {
     const char * cmp_name = cs_io_get_indexed_sec_name(restart->fh, rec_id);
     if (strcmp(cmp_name, sec_name) == 0)
@@ -996,21 +3456,448 @@ _default_p_rank(cs_block_dist_info_t  *p_bi,
   free_particle_io_num = fvm_io_num_create_from_scan(n_free_particles);
   free_particle_num = fvm_io_num_get_global_num(free_particle_io_num);
 
-  /* Determine rank based on global numbering */
-  for (i = 0; i < n_free_particles; i++) {
-    default_rank[free_particle_ids[i]]
-      =    ((free_particle_num[i] - 1) / free_particle_bi.block_size)
-         * free_particle_bi.rank_step;
-  }
+  /* Determine rank based on global numbering */
+  for (i = 0; i < n_free_particles; i++) {
+    default_rank[free_particle_ids[i]]
+      =    ((free_particle_num[i] - 1) / free_particle_bi.block_size)
+         * free_particle_bi.rank_step;
+  }
+
+  free_particle_io_num = fvm_io_num_destroy(free_particle_io_num);
+  BFT_FREE(free_particle_ids);
+
+  return default_rank;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Compute a hash of section values for incremental checkpointing.
+ *
+ * A 64-bit FNV-1a hash of local values is computed, and local hashes
+ * are combined in rank order, so the result depends on the partitioning
+ * (which is constant during a given computation).
+ *
+ * parameters:
+ *   n_ents          <-- local number of entities
+ *   n_location_vals <-- number of values per location
+ *   val_type        <-- data type
+ *   val             <-- array of values
+ *
+ * returns:
+ *   global hash value
+ *----------------------------------------------------------------------------*/
+
+static uint64_t
+_delta_hash(cs_lnum_t               n_ents,
+            int                     n_location_vals,
+            cs_restart_val_type_t   val_type,
+            const void             *val)
+{
+  const uint64_t fnv_prime = 1099511628211ULL;
+  uint64_t h = 14695981039346656037ULL;
+
+  size_t elt_size = 0;
+
+  switch (val_type) {
+  case CS_TYPE_char:
+    elt_size = 1;
+    break;
+  case CS_TYPE_int:
+    elt_size = sizeof(int);
+    break;
+  case CS_TYPE_cs_gnum_t:
+    elt_size = sizeof(cs_gnum_t);
+    break;
+  case CS_TYPE_cs_real_t:
+    elt_size = sizeof(cs_real_t);
+    break;
+  default:
+    assert(0);
+  }
+
+  const unsigned char *p = (const unsigned char *)val;
+  const size_t n_bytes = (size_t)n_ents * n_location_vals * elt_size;
+
+  for (size_t i = 0; i < n_bytes; i++) {
+    h ^= p[i];
+    h *= fnv_prime;
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    uint64_t *l_h = NULL;
+    BFT_MALLOC(l_h, cs_glob_n_ranks, uint64_t);
+
+    MPI_Allgather(&h, 1, MPI_UINT64_T, l_h, 1, MPI_UINT64_T,
+                  cs_glob_mpi_comm);
+
+    h = 14695981039346656037ULL;
+    for (int i = 0; i < cs_glob_n_ranks; i++) {
+      h ^= l_h[i];
+      h *= fnv_prime;
+    }
+
+    BFT_FREE(l_h);
+  }
+
+#endif
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the path of the file holding data of a given checkpoint generation.
+ *
+ * Data holders are hard links to previous versions of a checkpoint file,
+ * in the same directory, named "<file_name>.gen<generation>".
+ *
+ * parameters:
+ *   path       <-- path of the checkpoint file
+ *   generation <-- generation of the file containing data
+ *
+ * returns:
+ *   path of holder file, to be freed by the caller
+ *----------------------------------------------------------------------------*/
+
+static char *
+_delta_holder_path(const char  *path,
+                   int          generation)
+{
+  char *h_path = NULL;
+
+  BFT_MALLOC(h_path, strlen(path) + 16, char);
+  sprintf(h_path, "%s.gen%04d", path, generation);
+
+  return h_path;
+}
+
+/*----------------------------------------------------------------------------
+ * Find a data holder of a multiwriter.
+ *
+ * parameters:
+ *   mw         <-- pointer to multiwriter structure
+ *   generation <-- generation of the file containing data
+ *
+ * returns:
+ *   pointer to data holder info, or NULL if not present
+ *----------------------------------------------------------------------------*/
+
+static _delta_holder_t *
+_delta_holder(_restart_multiwriter_t  *mw,
+              int                      generation)
+{
+  for (int i = 0; i < mw->n_delta_holders; i++) {
+    if (mw->delta_holders[i].generation == generation)
+      return mw->delta_holders + i;
+  }
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a section of an incremental checkpoint as a reference if unchanged.
+ *
+ * If the section's contents are the same as when it was last written,
+ * and the file holding its data is available, a reference to that file is
+ * written instead of the data. Otherwise, the section's hash is updated,
+ * and the caller is responsible for writing the data.
+ *
+ * parameters:
+ *   restart         <-- associated restart file pointer
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val_type        <-- value type
+ *   val             <-- array of values
+ *
+ * returns:
+ *   true if a reference was written, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_delta_write_section(cs_restart_t           *restart,
+                     const char             *sec_name,
+                     int                     location_id,
+                     int                     n_location_vals,
+                     cs_restart_val_type_t   val_type,
+                     const void             *val)
+{
+  _restart_multiwriter_t *mw = _restart_multiwriter[restart->writer_id];
+  const _location_t *loc = restart->location + location_id - 1;
+
+  uint64_t hash = _delta_hash(loc->n_ents, n_location_vals, val_type, val);
+
+  /* Search for section info from previous checkpoints */
+
+  _delta_section_t *ds = NULL;
+
+  for (int i = 0; i < mw->n_delta_sections; i++) {
+    if (   mw->delta_sections[i].location_id == location_id
+        && strcmp(mw->delta_sections[i].name, sec_name) == 0) {
+      ds = mw->delta_sections + i;
+      break;
+    }
+  }
+
+  if (ds == NULL) {
+    BFT_REALLOC(mw->delta_sections, mw->n_delta_sections + 1,
+                _delta_section_t);
+    ds = mw->delta_sections + mw->n_delta_sections;
+    BFT_MALLOC(ds->name, strlen(sec_name) + 1, char);
+    strcpy(ds->name, sec_name);
+    ds->location_id = location_id;
+    ds->generation = -1;
+    mw->n_delta_sections += 1;
+  }
+
+  _delta_holder_t *dh = NULL;
+
+  if (   ds->generation > -1 && ds->generation < restart->generation
+      && ds->hash == hash
+      && ds->n_location_vals == n_location_vals
+      && ds->val_type == val_type
+      && ds->n_glob_ents == loc->n_glob_ents)
+    dh = _delta_holder(mw, ds->generation);
+
+  /* Section changed: data must be written */
+
+  if (dh == NULL) {
+    ds->n_location_vals = n_location_vals;
+    ds->val_type = val_type;
+    ds->n_glob_ents = loc->n_glob_ents;
+    ds->hash = hash;
+    ds->generation = restart->generation;
+    return false;
+  }
+
+  /* Section unchanged: write reference to data holder, relative
+     to the checkpoint file's directory */
+
+  char *h_path = _delta_holder_path(restart->name, ds->generation);
+
+  const char *ref_name = h_path;
+  for (int i = strlen(h_path) - 1; i > -1; i--) {
+    if (h_path[i] == _dir_separator) {
+      ref_name = h_path + i + 1;
+      break;
+    }
+  }
+
+  cs_io_set_codec(restart->fh, _delta_ref_id);
+
+  cs_io_write_global(sec_name,
+                     strlen(ref_name) + 1,
+                     location_id,
+                     0,
+                     n_location_vals,
+                     CS_CHAR,
+                     ref_name,
+                     restart->fh);
+
+  cs_io_set_codec(restart->fh, 0);
+
+  BFT_FREE(h_path);
+
+  dh->last_ref = restart->generation;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Open the file referenced by a section of an incremental checkpoint.
+ *
+ * The referenced file is searched for first in the directory of the
+ * referencing file, then in its parent directory (for previous versions
+ * of files moved to a sub-directory). Locations matching those of the
+ * referencing file are shared.
+ *
+ * parameters:
+ *   restart  <-- associated restart file pointer
+ *   header   <-- header associated with reference section
+ *   rec_id   <-- associated record id in index
+ *
+ * returns:
+ *   pointer to referenced restart file structure
+ *----------------------------------------------------------------------------*/
+
+static cs_restart_t *
+_delta_open_ref(cs_restart_t        *restart,
+                cs_io_sec_header_t  *header,
+                size_t               rec_id)
+{
+  char *ref_name = NULL;
+
+  BFT_MALLOC(ref_name, header->n_vals + 1, char);
+
+  cs_io_set_indexed_position(restart->fh, header, rec_id);
+  cs_io_read_global(header, ref_name, restart->fh);
+  ref_name[header->n_vals] = '\0';
+
+  /* Search in directory of current file, then parent directory */
+
+  int l_dir[2] = {0, -1};
+
+  for (int i = strlen(restart->name) - 1, j = 0; i > -1 && j < 2; i--) {
+    if (restart->name[i] == _dir_separator)
+      l_dir[j++] = i + 1;
+  }
+
+  char *path = NULL;
+  BFT_MALLOC(path, strlen(restart->name) + strlen(ref_name) + 1, char);
+
+  strncpy(path, restart->name, l_dir[0]);
+  strcpy(path + l_dir[0], ref_name);
+
+  if (cs_file_isreg(path) == 0 && l_dir[1] > -1) {
+    strncpy(path, restart->name, l_dir[1]);
+    strcpy(path + l_dir[1], ref_name);
+    if (cs_file_isreg(path) == 0) {
+      strncpy(path, restart->name, l_dir[0]);
+      strcpy(path + l_dir[0], ref_name);
+    }
+  }
+
+  BFT_FREE(ref_name);
+
+  /* Initialize structure */
+
+  cs_restart_t *r = NULL;
+  BFT_MALLOC(r, 1, cs_restart_t);
+
+  r->name = path;
+  r->backend = CS_RESTART_BACKEND_CS_IO;
+  r->fh = NULL;
+#if defined(HAVE_HDF5)
+  r->h5_file = -1;
+  r->h5_dxpl = -1;
+#endif
+  r->rank_step = 1;
+  r->min_block_size = 0;
+  r->n_locations = 0;
+  r->location = NULL;
+  r->mode = CS_RESTART_MODE_READ;
+  r->staged = NULL;
+  r->codec = CS_RESTART_CODEC_NONE;
+  r->codec_tolerance = 0.;
+  r->writer_id = -1;
+  r->generation = -1;
+
+  _add_file(r);
+
+  /* Share matching locations */
+
+  for (size_t i = 0; i < r->n_locations; i++) {
+    _location_t *loc = r->location + i;
+    for (size_t j = 0; j < restart->n_locations; j++) {
+      const _location_t *p_loc = restart->location + j;
+      if (strcmp(loc->name, p_loc->name) == 0) {
+        loc->n_ents = p_loc->n_ents;
+        loc->n_glob_ents = p_loc->n_glob_ents;
+        loc->ent_global_num = p_loc->ent_global_num;
+        break;
+      }
+    }
+  }
+
+  return r;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a data holder for the previous version of a checkpoint file
+ * before it is renamed, if incremental checkpoint sections may refer to it.
+ *
+ * parameters:
+ *   mw    <-> pointer to multiwriter structure
+ *   path  <-- path to current version of the checkpoint file
+ *----------------------------------------------------------------------------*/
+
+static void
+_delta_add_holder(_restart_multiwriter_t  *mw,
+                  const char              *path)
+{
+  const int generation = mw->n_prev_files_tot;
+
+  bool needed = false;
+  for (int i = 0; i < mw->n_delta_sections; i++) {
+    if (mw->delta_sections[i].generation == generation)
+      needed = true;
+  }
+
+  if (needed == false || _delta_holder(mw, generation) != NULL)
+    return;
+
+  int retval = -1;
+
+  if (cs_glob_rank_id < 1) {
+
+    char *h_path = _delta_holder_path(path, generation);
+
+#if defined(HAVE_LINKAT) && defined(HAVE_FCNTL_H)
+
+    retval = linkat(AT_FDCWD, path, AT_FDCWD, h_path, AT_SYMLINK_FOLLOW);
+
+    if (retval != 0) {
+      cs_base_warn(__FILE__, __LINE__);
+      bft_printf(_("Failure hard-linking %s to %s:\n"
+                   "%s\n"),
+                 path, h_path, strerror(errno));
+    }
+
+#endif
+
+    BFT_FREE(h_path);
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Bcast(&retval, 1, MPI_INT, 0, cs_glob_mpi_comm);
+#endif
+
+  if (retval == 0) {
+    BFT_REALLOC(mw->delta_holders, mw->n_delta_holders + 1, _delta_holder_t);
+    mw->delta_holders[mw->n_delta_holders].generation = generation;
+    mw->delta_holders[mw->n_delta_holders].last_ref = -1;
+    mw->n_delta_holders += 1;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Remove data holders of a multiwriter which are not referenced
+ * by any retained version of the checkpoint file.
+ *
+ * parameters:
+ *   mw <-> pointer to multiwriter structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_delta_clean_holders(_restart_multiwriter_t  *mw)
+{
+  const int min_generation = mw->n_prev_files_tot - mw->n_prev_files;
+
+  int j = 0;
+
+  for (int i = 0; i < mw->n_delta_holders; i++) {
+
+    if (mw->delta_holders[i].last_ref >= min_generation) {
+      mw->delta_holders[j++] = mw->delta_holders[i];
+      continue;
+    }
+
+    if (cs_glob_rank_id < 1) {
+      char *h_path = _delta_holder_path(mw->path,
+                                        mw->delta_holders[i].generation);
+      cs_file_remove(h_path);
+      BFT_FREE(h_path);
+    }
 
-  free_particle_io_num = fvm_io_num_destroy(free_particle_io_num);
-  BFT_FREE(free_particle_ids);
+  }
 
-  return default_rank;
+  mw->n_delta_holders = j;
 }
 
-#endif /* defined(HAVE_MPI) */
-
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check the presence of a given section in a restart file.
@@ -1065,6 +3952,17 @@ _check_section(cs_restart_t           *restart,
     n_ents  = (restart->location[location_id-1]).n_ents;
   }
 
+#if defined(HAVE_HDF5)
+  if (restart->backend == CS_RESTART_BACKEND_HDF5)
+    return _h5_check_section(restart,
+                             sec_name,
+                             location_id,
+                             n_location_vals,
+                             val_type,
+                             false,
+                             NULL);
+#endif
+
   /* Search for the corresponding record in the index */
 
   for (rec_id = 0; rec_id < index_size; rec_id++) {
@@ -1109,9 +4007,27 @@ _check_section(cs_restart_t           *restart,
   else if (header.location_id == 0 && header.n_vals != n_ents)
     return CS_RESTART_ERR_N_VALS;
 
+  /* Section data held by another file (incremental checkpoint) */
+
+  if (header.codec == _delta_ref_id) {
+    cs_restart_t *r_ref = _delta_open_ref(restart, &header, rec_id);
+    int retval = _check_section(r_ref,
+                                context,
+                                sec_name,
+                                location_id,
+                                n_location_vals,
+                                val_type);
+    cs_restart_destroy(&r_ref);
+    return retval;
+  }
+
   /* If the type of value does not match */
 
-  if (header.elt_type == CS_CHAR) {
+  if (header.codec != 0) {
+    if (val_type != CS_TYPE_cs_real_t)
+      return CS_RESTART_ERR_VAL_TYPE;
+  }
+  else if (header.elt_type == CS_CHAR) {
     if (val_type != CS_TYPE_char)
       return CS_RESTART_ERR_VAL_TYPE;
   }
@@ -1205,6 +4121,16 @@ _read_section(cs_restart_t           *restart,
     ent_global_num = (restart->location[location_id-1]).ent_global_num;
   }
 
+#if defined(HAVE_HDF5)
+  if (restart->backend == CS_RESTART_BACKEND_HDF5)
+    return _h5_read_section(restart,
+                            sec_name,
+                            location_id,
+                            n_location_vals,
+                            val_type,
+                            val);
+#endif
+
   /* Search for the corresponding record in the index */
 
   for (rec_id = 0; rec_id < index_size; rec_id++) {
@@ -1266,9 +4192,38 @@ _read_section(cs_restart_t           *restart,
     return CS_RESTART_ERR_N_VALS;
   }
 
+  /* Section data held by another file (incremental checkpoint) */
+
+  if (header.codec == _delta_ref_id) {
+    cs_restart_t *r_ref = _delta_open_ref(restart, &header, rec_id);
+    int retval = _read_section(r_ref,
+                               context,
+                               sec_name,
+                               location_id,
+                               n_location_vals,
+                               val_type,
+                               val);
+    cs_restart_destroy(&r_ref);
+    return retval;
+  }
+
   /* If the type of value does not match */
 
-  if (header.elt_type == CS_CHAR) {
+  if (header.codec != 0) {
+    if (   header.codec != _codec_id[CS_RESTART_CODEC_LOSSLESS]
+        && header.codec != _codec_id[CS_RESTART_CODEC_LOSSY]) {
+      bft_printf(_("  %s: section \"%s\" uses unknown compression "
+                   "codec '%c'.\n"),
+                 restart->name, sec_name, header.codec);
+      return CS_RESTART_ERR_VAL_TYPE;
+    }
+    if (val_type != CS_TYPE_cs_real_t) {
+      bft_printf(_("  %s: section \"%s\" is not of floating-point type.\n"),
+                 restart->name, sec_name);
+      return CS_RESTART_ERR_VAL_TYPE;
+    }
+  }
+  else if (header.elt_type == CS_CHAR) {
     if (val_type != CS_TYPE_char) {
       bft_printf(_("  %s: section \"%s\" is not of character type.\n"),
                  restart->name, sec_name);
@@ -1302,6 +4257,30 @@ _read_section(cs_restart_t           *restart,
 
   cs_io_set_indexed_position(restart->fh, &header, rec_id);
 
+  /* Compressed sections */
+
+  if (header.codec != 0) {
+
+    if (n_glob_ents > 0)
+      _read_compressed(restart,
+                       &header,
+                       rec_id,
+                       n_glob_ents,
+                       n_ents,
+                       ent_global_num,
+                       _n_location_vals,
+                       val);
+
+    if (cs_glob_n_ranks == 1 && ent_global_num != NULL)
+      _restart_permute_read(n_ents,
+                            ent_global_num,
+                            _n_location_vals,
+                            val_type,
+                            val);
+
+    return CS_RESTART_SUCCESS;
+  }
+
   /* Now define conversion info */
 
   if (header.elt_type == CS_UINT32 || header.elt_type == CS_UINT64) {
@@ -1432,6 +4411,32 @@ _write_section(cs_restart_t           *restart,
   /* Section contents */
   /*------------------*/
 
+  /* Unchanged sections of incremental checkpoints on mesh locations */
+
+  if (   restart->writer_id > -1
+      && location_id > 0 && location_id <= CS_MESH_LOCATION_VERTICES) {
+    if (_delta_write_section(restart,
+                             sec_name,
+                             location_id,
+                             n_location_vals,
+                             val_type,
+                             val))
+      return;
+  }
+
+#if defined(HAVE_HDF5)
+  if (   restart->backend == CS_RESTART_BACKEND_HDF5
+      && (location_id == 0 || cs_glob_n_ranks == 1 || n_glob_ents == 0)) {
+    _h5_write_section_serial(restart,
+                             sec_name,
+                             location_id,
+                             n_location_vals,
+                             val_type,
+                             val);
+    return;
+  }
+#endif
+
   /* In single processor mode of for global values */
 
   if (location_id == 0)
@@ -1455,14 +4460,24 @@ _write_section(cs_restart_t           *restart,
                                        _n_location_vals,
                                        val_type,
                                        val);
-    cs_io_write_global(sec_name,
-                       n_tot_vals,
-                       location_id,
-                       0,
-                       _n_location_vals,
-                       elt_type,
-                       (val_tmp != NULL) ? val_tmp : val,
-                       restart->fh);
+
+    if (   restart->codec != CS_RESTART_CODEC_NONE
+        && val_type == CS_TYPE_cs_real_t && n_glob_ents > 0)
+      _write_compressed(restart,
+                        sec_name,
+                        location_id,
+                        _n_location_vals,
+                        n_ents,
+                        (val_tmp != NULL) ? (cs_real_t *)val_tmp : val);
+    else
+      cs_io_write_global(sec_name,
+                         n_tot_vals,
+                         location_id,
+                         0,
+                         _n_location_vals,
+                         elt_type,
+                         (val_tmp != NULL) ? val_tmp : val,
+                         restart->fh);
 
     if (val_tmp != NULL)
       BFT_FREE (val_tmp);
@@ -1470,6 +4485,26 @@ _write_section(cs_restart_t           *restart,
 
 #if defined(HAVE_MPI)
 
+  /* In parallel mode for a location numbered contiguously by rank
+     (except for compressed sections, which use their own layout) */
+
+  else if (   (restart->location[location_id-1]).ent_block_range[0] > 0
+           && (   restart->codec == CS_RESTART_CODEC_NONE
+               || val_type != CS_TYPE_cs_real_t)
+#if defined(HAVE_HDF5)
+           && restart->backend != CS_RESTART_BACKEND_HDF5
+#endif
+           )
+    _write_ent_values_contiguous(restart,
+                                 sec_name,
+                                 n_glob_ents,
+                                 (restart->location[location_id-1])
+                                   .ent_block_range,
+                                 location_id,
+                                 _n_location_vals,
+                                 val_type,
+                                 (const cs_byte_t *)val);
+
   /* In parallel mode for a distributed mesh location */
 
   else
@@ -1621,6 +4656,11 @@ _restart_multiwriter_create(void)
   new_writer->n_prev_files_tot = 0;
   new_writer->prev_files = NULL;
 
+  new_writer->n_delta_sections = 0;
+  new_writer->delta_sections = NULL;
+  new_writer->n_delta_holders = 0;
+  new_writer->delta_holders = NULL;
+
   return new_writer;
 }
 
@@ -2078,6 +5118,97 @@ cs_restart_checkpoint_done(const cs_time_step_t  *ts)
     if (wt - _checkpoint_wt_last >= _checkpoint_wt_interval)
       _checkpoint_wt_last = cs_timer_wtime();
   }
+
+  /* With asynchronous writes, the current checkpoint may still be
+     in progress, but the previous one is guaranteed to be complete */
+
+  if (_checkpoint_async)
+    _async_wait(NULL, _checkpoint_generation - 1);
+
+  _checkpoint_generation += 1;
+
+  /* Flush buffered time plots and logs, so they are consistent with
+     the checkpoint in case of a later crash */
+
+  cs_time_plot_flush_all();
+  cs_log_printf_flush(CS_LOG_N_TYPES);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether checkpoint files are written asynchronously.
+ *
+ * In asynchronous mode, data written to checkpoint files is redistributed
+ * to blocks on the block IO ranks (based on \ref cs_file_get_default_comm)
+ * and staged in memory; only section headers are written synchronously.
+ * Staged data is then written by a background thread (if available) once
+ * the file is closed, while the computation carries on.
+ *
+ * Writing of a checkpoint file is guaranteed to be complete when the same
+ * file is written again, and writing of all files of a given checkpoint
+ * is guaranteed to be complete upon the next call to
+ * \ref cs_restart_checkpoint_done (so that a consistent checkpoint is
+ * always available), or to \ref cs_restart_checkpoint_wait.
+ *
+ * \param[in]  mode  if 0, write checkpoint files synchronously (default)
+ *                   if 1, write checkpoint files asynchronously
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async_mode(int  mode)
+{
+  _checkpoint_async = mode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether checkpoint files are written incrementally.
+ *
+ * In incremental mode, a hash of each section defined on a base mesh
+ * location is computed when writing a checkpoint file. If a section is
+ * unchanged since it was last written to a previous version of the same
+ * file, only a reference to that version is written. Previous versions
+ * holding referenced data are kept as hard links named
+ * "<file_name>.gen<nnnn>" in the checkpoint directory, and removed along
+ * with the history of checkpoints referring to them
+ * (see \ref cs_restart_clean_multiwriters_history).
+ *
+ * References are resolved transparently when reading, as long as the
+ * referenced files are kept alongside the checkpoint file.
+ *
+ * This only applies to the default (non-HDF5) file format, and requires
+ * hard link support.
+ *
+ * \param[in]  mode  if 0, write all sections (default)
+ *                   if 1, only write sections modified since the previous
+ *                   version of each checkpoint file
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_delta_mode(int  mode)
+{
+  _checkpoint_delta = mode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Wait for completion of pending asynchronous checkpoint writes.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_wait(void)
+{
+  _async_wait(NULL, -1);
+
+#if defined(HAVE_PTHREAD)
+  if (_async_thread_created) {
+    pthread_join(_async_thread, NULL);
+    _async_thread_created = false;
+  }
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2136,6 +5267,8 @@ cs_restart_create(const char         *name,
 
   const cs_mesh_t  *mesh = cs_glob_mesh;
 
+  int delta_writer_id = -1, delta_generation = -1;
+
   /* Ensure mesh checkpoint is updated on first call */
 
   if (    mode == CS_RESTART_MODE_WRITE
@@ -2209,6 +5342,11 @@ cs_restart_create(const char         *name,
 
   } else if (mode == CS_RESTART_MODE_WRITE) {
 
+    /* Ensure a previous asynchronous write of this file is complete */
+
+    if (_checkpoint_async)
+      _async_wait(_name, -1);
+
     /* Check if file already exists, and if so rename and delete if needed */
     int writer_id = _add_restart_multiwriter(name, _name);
     _restart_multiwriter_t *mw = _restart_multiwriter_by_id(writer_id);
@@ -2216,6 +5354,10 @@ cs_restart_create(const char         *name,
     /* Rename an already existing file */
     if (cs_file_isreg(_name) && mw->n_prev_files > -1) {
 
+      /* Keep data referenced by incremental checkpoints */
+      if (_checkpoint_delta)
+        _delta_add_holder(mw, _name);
+
       char _subdir[19];
       sprintf(_subdir, "previous_dump_%04d", mw->n_prev_files_tot);
       size_t lsdir = strlen(_subdir);
@@ -2253,6 +5395,11 @@ cs_restart_create(const char         *name,
     }
     else
       mw->n_prev_files = 0;
+
+    if (_checkpoint_delta && _backend_default == CS_RESTART_BACKEND_CS_IO) {
+      delta_writer_id = writer_id;
+      delta_generation = mw->n_prev_files_tot;
+    }
   }
 
   /* Allocate and initialize base structure */
@@ -2269,11 +5416,31 @@ cs_restart_create(const char         *name,
 
   restart->mode = mode;
 
+  restart->backend = (mode == CS_RESTART_MODE_WRITE) ?
+    _backend_default : CS_RESTART_BACKEND_CS_IO;
+
   restart->fh = NULL;
+#if defined(HAVE_HDF5)
+  restart->h5_file = -1;
+  restart->h5_dxpl = -1;
+#endif
 
   restart->rank_step = 1;
   restart->min_block_size = 0;
 
+  restart->staged = NULL;
+  if (   mode == CS_RESTART_MODE_WRITE
+      && restart->backend == CS_RESTART_BACKEND_CS_IO
+      && _checkpoint_async && cs_glob_n_ranks > 1)
+    restart->staged = _staged_file_create(restart->name,
+                                          _checkpoint_generation);
+
+  restart->codec = _codec_default;
+  restart->codec_tolerance = _codec_tolerance_default;
+
+  restart->writer_id = delta_writer_id;
+  restart->generation = delta_generation;
+
   /* Initialize location data */
 
   restart->n_locations = 0;
@@ -2330,6 +5497,21 @@ cs_restart_destroy(cs_restart_t  **restart)
   if (r->fh != NULL)
     cs_io_finalize(&(r->fh));
 
+#if defined(HAVE_HDF5)
+  if (r->backend == CS_RESTART_BACKEND_HDF5)
+    _h5_close_file(r);
+#endif
+
+  /* Write staged data once the file is closed by all ranks */
+
+  if (r->staged != NULL) {
+#if defined(HAVE_MPI)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+    _async_submit(r->staged);
+    r->staged = NULL;
+  }
+
   /* Free locations array */
 
   if (r->n_locations > 0) {
@@ -2452,6 +5634,8 @@ cs_restart_add_location(cs_restart_t     *restart,
         (restart->location[loc_id]).n_ents  = n_ents;
         (restart->location[loc_id]).ent_global_num = ent_global_num;
         (restart->location[loc_id])._ent_global_num = NULL;
+        (restart->location[loc_id]).ent_block_range[0] = 0;
+        (restart->location[loc_id]).ent_block_range[1] = 0;
 
         timing[1] = cs_timer_wtime();
         _restart_wtime[restart->mode] += timing[1] - timing[0];
@@ -2491,7 +5675,14 @@ cs_restart_add_location(cs_restart_t     *restart,
     (restart->location[restart->n_locations-1]).n_ents         = n_ents;
     (restart->location[restart->n_locations-1]).ent_global_num = ent_global_num;
     (restart->location[restart->n_locations-1])._ent_global_num = NULL;
+    (restart->location[restart->n_locations-1]).ent_block_range[0] = 0;
+    (restart->location[restart->n_locations-1]).ent_block_range[1] = 0;
 
+#if defined(HAVE_HDF5)
+    if (restart->backend == CS_RESTART_BACKEND_HDF5)
+      _h5_add_location(restart, restart->n_locations, n_glob_ents);
+    else
+#endif
     cs_io_write_global(location_name, 1, restart->n_locations, 0, 0,
                        gnum_type, &n_glob_ents,
                        restart->fh);
@@ -2555,6 +5746,8 @@ cs_restart_add_location_ref(const char       *location_name,
   (_location_ref[_n_locations_ref-1]).n_ents         = n_ents;
   (_location_ref[_n_locations_ref-1]).ent_global_num
     = (_location_ref[_n_locations_ref-1])._ent_global_num;
+  (_location_ref[_n_locations_ref-1]).ent_block_range[0] = 0;
+  (_location_ref[_n_locations_ref-1]).ent_block_range[1] = 0;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2661,6 +5854,174 @@ cs_restart_set_write_section_func(cs_restart_write_section_t  *func)
   return p;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set default compression of restart files opened for writing.
+ *
+ * Compression only applies to floating-point sections defined on
+ * mesh locations; for lossy compression, the tolerance defines the
+ * maximum absolute error relative to the maximum absolute value of
+ * each section.
+ *
+ * Compression requires zlib support; it is ignored otherwise.
+ *
+ * \param[in]  codec      compression type
+ * \param[in]  tolerance  relative error bound for lossy compression
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_default_codec(cs_restart_codec_t  codec,
+                             double              tolerance)
+{
+#if defined(HAVE_ZLIB)
+  _codec_default = codec;
+#else
+  _codec_default = CS_RESTART_CODEC_NONE;
+#endif
+  _codec_tolerance_default = tolerance;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set compression of sections written next to a restart file.
+ *
+ * This allows choosing compression options per section: the settings apply
+ * to sections written until the next call to this function.
+ * See \ref cs_restart_set_default_codec for details.
+ *
+ * \param[in, out]  restart    associated restart file pointer
+ * \param[in]       codec      compression type
+ * \param[in]       tolerance  relative error bound for lossy compression
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_codec(cs_restart_t        *restart,
+                     cs_restart_codec_t   codec,
+                     double               tolerance)
+{
+  assert(restart != NULL);
+
+#if defined(HAVE_ZLIB)
+  restart->codec = codec;
+#else
+  restart->codec = CS_RESTART_CODEC_NONE;
+#endif
+  restart->codec_tolerance = tolerance;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query compression of sections written next to a restart file.
+ *
+ * \param[in]   restart    associated restart file pointer
+ * \param[out]  codec      compression type, or NULL
+ * \param[out]  tolerance  relative error bound for lossy compression,
+ *                         or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_get_codec(const cs_restart_t  *restart,
+                     cs_restart_codec_t  *codec,
+                     double              *tolerance)
+{
+  assert(restart != NULL);
+
+  if (codec != NULL)
+    *codec = restart->codec;
+  if (tolerance != NULL)
+    *tolerance = restart->codec_tolerance;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set default file format for restart files opened for writing.
+ *
+ * The HDF5 backend writes a single HDF5 file per checkpoint, with one
+ * dataset per section, grouped by location. When the HDF5 library
+ * supports parallel I/O, datasets are written and read using
+ * collective MPI-IO; otherwise, data is written by a single rank.
+ * Asynchronous checkpoint writing only applies to the default format.
+ *
+ * The format of files opened for reading is detected automatically.
+ *
+ * The HDF5 backend requires HDF5 support; it is ignored otherwise.
+ *
+ * \param[in]  backend  file format
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_default_backend(cs_restart_backend_t  backend)
+{
+#if defined(HAVE_HDF5)
+  _backend_default = backend;
+#else
+  CS_UNUSED(backend);
+  _backend_default = CS_RESTART_BACKEND_CS_IO;
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return default file format for restart files opened for writing.
+ *
+ * \return  default file format
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_restart_backend_t
+cs_restart_get_default_backend(void)
+{
+  return _backend_default;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set chunking options for the HDF5 restart file backend.
+ *
+ * Sections defined on mesh locations are stored in chunks of whole
+ * entities of about the given size. The chunk cache size applies to
+ * each dataset opened for reading or writing.
+ *
+ * \param[in]  chunk_size        target chunk size, in bytes
+ * \param[in]  chunk_cache_size  chunk cache size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_hdf5_options(size_t  chunk_size,
+                            size_t  chunk_cache_size)
+{
+  if (chunk_size > 0)
+    _h5_chunk_size = chunk_size;
+  _h5_chunk_cache_size = chunk_cache_size;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the maximum window size for streamed parallel reads.
+ *
+ * When reading a section defined on a mesh location in parallel, values
+ * are read and redistributed by windows of consecutive global entity
+ * numbers, whose size (all ranks combined) does not exceed the given
+ * value. This bounds temporary memory use independently of the section
+ * size, at the cost of additional collective operations for large
+ * sections.
+ *
+ * \param[in]  window_size  maximum window size, in bytes, or 0 to read
+ *                          each section at once (default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_read_window_size(size_t  window_size)
+{
+  _read_window_size = window_size;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return name of restart file
@@ -2734,6 +6095,28 @@ cs_restart_dump_index(const cs_restart_t  *restart)
 
   bft_printf(_("  General information associated with the restart file:\n"));
 
+#if defined(HAVE_HDF5)
+  if (restart->backend == CS_RESTART_BACKEND_HDF5) {
+    bft_printf(_("\n  HDF5 file: \"%s\"\n"), restart->name);
+    if (restart->h5_file >= 0) {
+      for (loc_id = 0; loc_id <= restart->n_locations; loc_id++) {
+        hid_t g_id = _h5_location_group(restart, loc_id);
+        if (loc_id == 0)
+          _h5_dump_group(g_id, "");
+        else {
+          char prefix[128];
+          snprintf(prefix, 127, "%s/", restart->location[loc_id-1].name);
+          prefix[127] = '\0';
+          _h5_dump_group(g_id, prefix);
+        }
+        H5Gclose(g_id);
+      }
+    }
+    bft_printf("\n");
+    return;
+  }
+#endif
+
   cs_io_dump(restart->fh);
 }
 
@@ -2950,15 +6333,32 @@ cs_restart_read_particles_info(cs_restart_t  *restart,
     if (block_buf_size > 0)
       BFT_MALLOC(part_cell_num, block_buf_size, cs_gnum_t);
 
-    header = cs_io_get_indexed_sec_header(restart->fh, rec_id);
+#if defined(HAVE_HDF5)
+    if (restart->backend == CS_RESTART_BACKEND_HDF5) {
+      char *sec_name = NULL;
+      BFT_MALLOC(sec_name, strlen(name) + strlen("_cell_num") + 1, char);
+      sprintf(sec_name, "%s_cell_num", name);
+      hid_t g_id = _h5_location_group(restart, loc_id + 1);
+      hid_t dset_id = H5Dopen2(g_id, sec_name, H5P_DEFAULT);
+      _h5_read_block(restart, dset_id, 1, CS_TYPE_cs_gnum_t,
+                     part_bi.gnum_range, part_cell_num);
+      H5Dclose(dset_id);
+      H5Gclose(g_id);
+      BFT_FREE(sec_name);
+    }
+    else
+#endif
+    {
+      header = cs_io_get_indexed_sec_header(restart->fh, rec_id);
 
-    cs_io_set_indexed_position(restart->fh, &header, rec_id);
+      cs_io_set_indexed_position(restart->fh, &header, rec_id);
 
-    cs_io_read_block(&header,
-                     part_bi.gnum_range[0],
-                     part_bi.gnum_range[1],
-                     part_cell_num,
-                     restart->fh);
+      cs_io_read_block(&header,
+                       part_bi.gnum_range[0],
+                       part_bi.gnum_range[1],
+                       part_cell_num,
+                       restart->fh);
+    }
 
     /* Build block distribution cell rank info */
 
@@ -3162,7 +6562,9 @@ cs_restart_read_particles(cs_restart_t  *restart,
  * \param[in]  number_by_coords   if true, numbering is based on current
  *                                coordinates; otherwise, it is simply based
  *                                on local numbers, plus the sum of particles
- *                                on lower MPI ranks
+ *                                on lower MPI ranks (in which case sections
+ *                                on this location are written directly by
+ *                                each rank, without redistribution)
  * \param[in]  n_particles        local number of particles
  * \param[in]  particle_cell_id   local cell id (0 to n-1) to which particles
  *                                belong
@@ -3198,19 +6600,47 @@ cs_restart_write_particles(cs_restart_t     *restart,
 
   /* Build global numbering */
 
-  cs_parall_counter(&n_glob_particles, 1);
+  cs_gnum_t  block_range[2] = {0, 0};
+
+  if (number_by_coords) {
+    cs_parall_counter(&n_glob_particles, 1);
 
-  if (number_by_coords)
     io_num = fvm_io_num_create_from_sfc(particle_coords,
                                         3,
                                         n_particles,
                                         FVM_IO_NUM_SFC_MORTON_BOX);
 
-  else
-    io_num = fvm_io_num_create_from_scan(n_particles);
+    global_particle_num = fvm_io_num_transfer_global_num(io_num);
+    fvm_io_num_destroy(io_num);
+  }
+
+  else {
+
+    /* Particles are numbered contiguously by rank, so that sections
+       may be written by each rank without redistribution */
+
+    cs_gnum_t  g_start = 0;
+
+#if defined(HAVE_MPI)
+    if (cs_glob_n_ranks > 1) {
+      cs_gnum_t  l_size = n_particles;
+      MPI_Exscan(&l_size, &g_start, 1, CS_MPI_GNUM, MPI_SUM,
+                 cs_glob_mpi_comm);
+      MPI_Allreduce(&l_size, &n_glob_particles, 1, CS_MPI_GNUM, MPI_SUM,
+                    cs_glob_mpi_comm);
+      if (cs_glob_rank_id == 0)
+        g_start = 0;
+    }
+#endif
+
+    BFT_MALLOC(global_particle_num, n_particles, cs_gnum_t);
+    for (i = 0; i < n_particles; i++)
+      global_particle_num[i] = g_start + i + 1;
+
+    block_range[0] = g_start + 1;
+    block_range[1] = g_start + n_particles + 1;
 
-  global_particle_num = fvm_io_num_transfer_global_num(io_num);
-  fvm_io_num_destroy(io_num);
+  }
 
   /* Create a new location, with ownership of global numbers */
 
@@ -3223,6 +6653,9 @@ cs_restart_write_particles(cs_restart_t     *restart,
   (restart->location[loc_id-1])._ent_global_num = global_particle_num;
   assert((restart->location[loc_id-1]).ent_global_num == global_particle_num);
 
+  (restart->location[loc_id-1]).ent_block_range[0] = block_range[0];
+  (restart->location[loc_id-1]).ent_block_range[1] = block_range[1];
+
   /* Write particle coordinates */
 
   BFT_MALLOC(sec_name, strlen(name) + strlen(coords_postfix) + 1, char);
@@ -4117,6 +7550,9 @@ cs_restart_clean_multiwriters_history(void)
       /* No need for extra reallocation of mw->prev_files */
     }
 
+    if (mw->n_delta_holders > 0)
+      _delta_clean_holders(mw);
+
   }
 }
 
@@ -4140,6 +7576,11 @@ cs_restart_multiwriters_destroy_all(void)
         BFT_FREE(w->prev_files[j]);
       BFT_FREE(w->prev_files);
 
+      for (int j = 0; j < w->n_delta_sections; j++)
+        BFT_FREE(w->delta_sections[j].name);
+      BFT_FREE(w->delta_sections);
+      BFT_FREE(w->delta_holders);
+
       BFT_FREE(w);
 
     }
@@ -85,6 +85,27 @@ typedef enum {
   CS_TYPE_cs_real_t,
 } cs_restart_val_type_t;
 
+/*! Compression of restart sections */
+
+typedef enum {
+
+  CS_RESTART_CODEC_NONE,        /*!< No compression */
+  CS_RESTART_CODEC_LOSSLESS,    /*!< Byte shuffling and deflate */
+  CS_RESTART_CODEC_LOSSY        /*!< Error-bounded quantization, followed
+                                     by lossless compression */
+
+} cs_restart_codec_t;
+
+/*! Restart file format */
+
+typedef enum {
+
+  CS_RESTART_BACKEND_CS_IO,     /*!< Native format, one section per record */
+  CS_RESTART_BACKEND_HDF5       /*!< Single HDF5 file, one dataset per
+                                     section */
+
+} cs_restart_backend_t;
+
 /*
   Pointer associated with a restart file structure. The structure itself
   is defined in "cs_restart.c", and is opaque outside that unit.
@@ -391,6 +412,67 @@ cs_restart_checkpoint_required(const cs_time_step_t  *ts);
 void
 cs_restart_checkpoint_done(const cs_time_step_t  *ts);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether checkpoint files are written asynchronously.
+ *
+ * In asynchronous mode, data written to checkpoint files is redistributed
+ * to blocks on the block IO ranks (based on \ref cs_file_get_default_comm)
+ * and staged in memory; only section headers are written synchronously.
+ * Staged data is then written by a background thread (if available) once
+ * the file is closed, while the computation carries on.
+ *
+ * Writing of a checkpoint file is guaranteed to be complete when the same
+ * file is written again, and writing of all files of a given checkpoint
+ * is guaranteed to be complete upon the next call to
+ * \ref cs_restart_checkpoint_done (so that a consistent checkpoint is
+ * always available), or to \ref cs_restart_checkpoint_wait.
+ *
+ * \param[in]  mode  if 0, write checkpoint files synchronously (default)
+ *                   if 1, write checkpoint files asynchronously
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async_mode(int  mode);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether checkpoint files are written incrementally.
+ *
+ * In incremental mode, a hash of each section defined on a base mesh
+ * location is computed when writing a checkpoint file. If a section is
+ * unchanged since it was last written to a previous version of the same
+ * file, only a reference to that version is written. Previous versions
+ * holding referenced data are kept as hard links named
+ * "<file_name>.gen<nnnn>" in the checkpoint directory, and removed along
+ * with the history of checkpoints referring to them
+ * (see \ref cs_restart_clean_multiwriters_history).
+ *
+ * References are resolved transparently when reading, as long as the
+ * referenced files are kept alongside the checkpoint file.
+ *
+ * This only applies to the default (non-HDF5) file format, and requires
+ * hard link support.
+ *
+ * \param[in]  mode  if 0, write all sections (default)
+ *                   if 1, only write sections modified since the previous
+ *                   version of each checkpoint file
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_delta_mode(int  mode);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Wait for completion of pending asynchronous checkpoint writes.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_wait(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check if we have a restart directory.
@@ -569,6 +651,129 @@ cs_restart_set_read_section_func(cs_restart_read_section_t  *func);
 cs_restart_write_section_t  *
 cs_restart_set_write_section_func(cs_restart_write_section_t  *func);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set default compression of restart files opened for writing.
+ *
+ * Compression only applies to floating-point sections defined on
+ * mesh locations; for lossy compression, the tolerance defines the
+ * maximum absolute error relative to the maximum absolute value of
+ * each section.
+ *
+ * Compression requires zlib support; it is ignored otherwise.
+ *
+ * \param[in]  codec      compression type
+ * \param[in]  tolerance  relative error bound for lossy compression
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_default_codec(cs_restart_codec_t  codec,
+                             double              tolerance);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set compression of sections written next to a restart file.
+ *
+ * This allows choosing compression options per section: the settings apply
+ * to sections written until the next call to this function.
+ * See \ref cs_restart_set_default_codec for details.
+ *
+ * \param[in, out]  restart    associated restart file pointer
+ * \param[in]       codec      compression type
+ * \param[in]       tolerance  relative error bound for lossy compression
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_codec(cs_restart_t        *restart,
+                     cs_restart_codec_t   codec,
+                     double               tolerance);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query compression of sections written next to a restart file.
+ *
+ * \param[in]   restart    associated restart file pointer
+ * \param[out]  codec      compression type, or NULL
+ * \param[out]  tolerance  relative error bound for lossy compression,
+ *                         or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_get_codec(const cs_restart_t  *restart,
+                     cs_restart_codec_t  *codec,
+                     double              *tolerance);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set default file format for restart files opened for writing.
+ *
+ * The HDF5 backend writes a single HDF5 file per checkpoint, with one
+ * dataset per section, grouped by location. When the HDF5 library
+ * supports parallel I/O, datasets are written and read using
+ * collective MPI-IO; otherwise, data is written by a single rank.
+ * Asynchronous checkpoint writing only applies to the default format.
+ *
+ * The format of files opened for reading is detected automatically.
+ *
+ * The HDF5 backend requires HDF5 support; it is ignored otherwise.
+ *
+ * \param[in]  backend  file format
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_default_backend(cs_restart_backend_t  backend);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return default file format for restart files opened for writing.
+ *
+ * \return  default file format
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_restart_backend_t
+cs_restart_get_default_backend(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set chunking options for the HDF5 restart file backend.
+ *
+ * Sections defined on mesh locations are stored in chunks of whole
+ * entities of about the given size. The chunk cache size applies to
+ * each dataset opened for reading or writing.
+ *
+ * \param[in]  chunk_size        target chunk size, in bytes
+ * \param[in]  chunk_cache_size  chunk cache size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_hdf5_options(size_t  chunk_size,
+                            size_t  chunk_cache_size);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the maximum window size for streamed parallel reads.
+ *
+ * When reading a section defined on a mesh location in parallel, values
+ * are read and redistributed by windows of consecutive global entity
+ * numbers, whose size (all ranks combined) does not exceed the given
+ * value. This bounds temporary memory use independently of the section
+ * size, at the cost of additional collective operations for large
+ * sections.
+ *
+ * \param[in]  window_size  maximum window size, in bytes, or 0 to read
+ *                          each section at once (default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_read_window_size(size_t  window_size);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return name of restart file
@@ -727,7 +932,9 @@ cs_restart_read_particles(cs_restart_t  *restart,
  * \param[in]  number_by_coords   if true, numbering is based on current
  *                                coordinates; otherwise, it is simply based
  *                                on local numbers, plus the sum of particles
- *                                on lower MPI ranks
+ *                                on lower MPI ranks (in which case sections
+ *                                on this location are written directly by
+ *                                each rank, without redistribution)
  * \param[in]  n_particles        local number of particles
  * \param[in]  particle_cell_id   local cell id (0 to n-1) to which particles
  *                                belong
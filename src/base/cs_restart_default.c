@@ -1593,6 +1593,9 @@ _read_and_convert_turb_variables(cs_restart_t  *r,
       sem_in->volume_mode = 1;
       BFT_MALLOC(sem_in->position, sem_in->n_structures, cs_real_3_t);
       BFT_MALLOC(sem_in->energy, sem_in->n_structures, cs_real_3_t);
+#if defined(HAVE_MPI)
+      sem_in->comm = cs_glob_mpi_comm;
+#endif
 
       /* Velocity fluctuations before modifications with Lund's method */
       cs_real_3_t  *fluctuations = NULL;
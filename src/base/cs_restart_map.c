@@ -52,6 +52,9 @@
 #include "fvm_nodal.h"
 #include "ple_locator.h"
 
+#include "cs_all_to_all.h"
+#include "cs_block_dist.h"
+#include "cs_file.h"
 #include "cs_io.h"
 #include "cs_coupling.h"
 #include "cs_mesh.h"
@@ -59,6 +62,7 @@
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
+#include "cs_part_to_block.h"
 #include "cs_preprocessor_data.h"
 #include "cs_timer.h"
 #include "cs_timer_stats.h"
@@ -99,6 +103,21 @@ static cs_restart_read_section_t   *_read_section_f  = NULL;
 
 static  ple_locator_t  *_locator = NULL;  /* PLE locator for restart */
 
+/* Optional mapping cache file, and mapping based on that file
+   (source values are then read using a block distribution) */
+
+static char                  *_map_cache_path = NULL;
+static bool                   _map_from_cache = false;
+
+static cs_lnum_t              _n_mapped_cells = 0;
+static cs_lnum_t             *_mapped_cell_id = NULL;
+static cs_gnum_t             *_mapped_src_num = NULL;
+static cs_block_dist_info_t   _src_cell_bi;
+
+#if defined(HAVE_MPI)
+static cs_all_to_all_t       *_src_d = NULL;
+#endif
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -178,10 +197,10 @@ _interpolate_p0(ple_locator_t          *locator,
       dest[j] = src[j];
   }
 
-  ple_locator_exchange_point_var(_locator,
+  ple_locator_exchange_point_var(locator,
                                  send_var,
                                  val,
-                                 NULL,
+                                 ple_locator_get_interior_list(locator),
                                  type_size,
                                  n_location_vals,
                                  0);
@@ -189,6 +208,514 @@ _interpolate_p0(ple_locator_t          *locator,
   BFT_FREE(send_var);
 }
 
+/*----------------------------------------------------------------------------
+ * Open mapping cache file.
+ *
+ * parameters:
+ *   mode <-- CS_IO_MODE_READ or CS_IO_MODE_WRITE
+ *
+ * returns:
+ *   pointer to kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static cs_io_t *
+_map_cache_open(cs_io_mode_t  mode)
+{
+  cs_io_t *fh = NULL;
+  cs_file_access_t  method;
+
+  const char magic_string[] = "Restart mapping, R0";
+
+  cs_file_mode_t f_mode
+    = (mode == CS_IO_MODE_READ) ? CS_FILE_MODE_READ : CS_FILE_MODE_WRITE;
+
+#if defined(HAVE_MPI)
+  {
+    MPI_Info  hints;
+    MPI_Comm  block_comm, comm;
+    cs_file_get_default_access(f_mode, &method, &hints);
+    cs_file_get_default_comm(NULL, &block_comm, &comm);
+    assert(comm == cs_glob_mpi_comm || comm == MPI_COMM_NULL);
+    fh = cs_io_initialize(_map_cache_path,
+                          magic_string,
+                          mode,
+                          method,
+                          CS_IO_ECHO_OPEN_CLOSE,
+                          hints,
+                          block_comm,
+                          comm);
+  }
+#else
+  {
+    cs_file_get_default_access(f_mode, &method);
+    fh = cs_io_initialize(_map_cache_path,
+                          magic_string,
+                          mode,
+                          method,
+                          CS_IO_ECHO_OPEN_CLOSE);
+  }
+#endif
+
+  return fh;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute sum of cell centers, used to check that a mapping cache file
+ * matches the current mesh.
+ *
+ * parameters:
+ *   cen_sum --> sum of cell center coordinates
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_cen_sum(cs_real_t  cen_sum[3])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+
+  double s[3] = {0., 0., 0.};
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    for (int j = 0; j < 3; j++)
+      s[j] += cell_cen[i][j];
+  }
+
+  cs_parall_sum(3, CS_DOUBLE, s);
+
+  for (int j = 0; j < 3; j++)
+    cen_sum[j] = s[j];
+}
+
+/*----------------------------------------------------------------------------
+ * Write mapping cache file.
+ *
+ * parameters:
+ *   src_n_g_elts  <-- global number of source cells, interior faces,
+ *                     boundary faces, and vertices
+ *   cell_src_num  <-- global number of source cell for each cell,
+ *                     or 0 if not located
+ *----------------------------------------------------------------------------*/
+
+static void
+_map_cache_write(const cs_gnum_t  src_n_g_elts[4],
+                 const cs_gnum_t  cell_src_num[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  cs_datatype_t datatype_gnum
+    = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+
+  cs_real_t cen_sum[3];
+  _cell_cen_sum(cen_sum);
+
+  cs_block_dist_info_t  bi
+    = cs_block_dist_compute_sizes(CS_MAX(cs_glob_rank_id, 0),
+                                  cs_glob_n_ranks,
+                                  1,
+                                  0,
+                                  m->n_g_cells);
+
+  cs_lnum_t n_b_cells = bi.gnum_range[1] - bi.gnum_range[0];
+
+  cs_gnum_t *b_src_num;
+  BFT_MALLOC(b_src_num, n_b_cells, cs_gnum_t);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_part_to_block_t *d
+      = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        bi,
+                                        m->n_cells,
+                                        m->global_cell_num);
+    cs_part_to_block_copy_array(d,
+                                CS_GNUM_TYPE,
+                                1,
+                                cell_src_num,
+                                b_src_num);
+    cs_part_to_block_destroy(&d);
+  }
+#endif
+
+  if (cs_glob_n_ranks < 2) {
+    for (cs_lnum_t i = 0; i < n_b_cells; i++)
+      b_src_num[i] = cell_src_num[i];
+  }
+
+  cs_io_t *fh = _map_cache_open(CS_IO_MODE_WRITE);
+
+  cs_io_write_global("n_cells",
+                     1,
+                     1,
+                     0,
+                     1,
+                     datatype_gnum,
+                     &(m->n_g_cells),
+                     fh);
+
+  cs_io_write_global("source:n_elements",
+                     4,
+                     0,
+                     0,
+                     1,
+                     datatype_gnum,
+                     src_n_g_elts,
+                     fh);
+
+  cs_io_write_global("cell_cen_sum",
+                     3,
+                     0,
+                     0,
+                     1,
+                     CS_REAL_TYPE,
+                     cen_sum,
+                     fh);
+
+  cs_io_write_block_buffer("cell:source cell number",
+                           m->n_g_cells,
+                           bi.gnum_range[0],
+                           bi.gnum_range[1],
+                           1,
+                           0,
+                           1,
+                           datatype_gnum,
+                           b_src_num,
+                           fh);
+
+  cs_io_finalize(&fh);
+
+  BFT_FREE(b_src_num);
+}
+
+/*----------------------------------------------------------------------------
+ * Read mapping cache file if present and matching the current mesh.
+ *
+ * parameters:
+ *   src_n_g_elts  --> global number of source cells, interior faces,
+ *                     boundary faces, and vertices
+ *   cell_src_num  --> global number of source cell for each cell,
+ *                     or 0 if not located (allocated here)
+ *
+ * returns:
+ *   true if the mapping was read, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_map_cache_read(cs_gnum_t    src_n_g_elts[4],
+                cs_gnum_t  **cell_src_num)
+{
+  bool retval = false;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  *cell_src_num = NULL;
+
+  if (cs_file_isreg(_map_cache_path) == 0)
+    return retval;
+
+  const char  *unexpected_msg = N_("Section of type <%s> on <%s>\n"
+                                   "unexpected or of incorrect size");
+
+  cs_io_sec_header_t  header;
+  cs_gnum_t n_g_cells = 0;
+  cs_real_t cen_sum[3] = {0, 0, 0}, cen_sum_ref[3];
+
+  cs_block_dist_info_t  bi
+    = cs_block_dist_compute_sizes(CS_MAX(cs_glob_rank_id, 0),
+                                  cs_glob_n_ranks,
+                                  1,
+                                  0,
+                                  m->n_g_cells);
+
+  cs_lnum_t n_b_cells = bi.gnum_range[1] - bi.gnum_range[0];
+  cs_gnum_t *b_src_num = NULL;
+
+  _cell_cen_sum(cen_sum_ref);
+
+  cs_io_t *fh = _map_cache_open(CS_IO_MODE_READ);
+
+  while (cs_io_read_header(fh, &header) == 0) {
+
+    if (strncmp(header.sec_name, "n_cells", CS_IO_NAME_LEN) == 0) {
+      if (header.n_vals != 1)
+        bft_error(__FILE__, __LINE__, 0,
+                  _(unexpected_msg), header.sec_name, cs_io_get_name(fh));
+      cs_io_set_cs_gnum(&header, fh);
+      cs_io_read_global(&header, &n_g_cells, fh);
+      if (n_g_cells != m->n_g_cells)
+        break;
+    }
+
+    else if (strncmp(header.sec_name, "source:n_elements",
+                     CS_IO_NAME_LEN) == 0) {
+      if (header.n_vals != 4)
+        bft_error(__FILE__, __LINE__, 0,
+                  _(unexpected_msg), header.sec_name, cs_io_get_name(fh));
+      cs_io_set_cs_gnum(&header, fh);
+      cs_io_read_global(&header, src_n_g_elts, fh);
+    }
+
+    else if (strncmp(header.sec_name, "cell_cen_sum",
+                     CS_IO_NAME_LEN) == 0) {
+      if (header.n_vals != 3)
+        bft_error(__FILE__, __LINE__, 0,
+                  _(unexpected_msg), header.sec_name, cs_io_get_name(fh));
+      cs_io_assert_cs_real(&header, fh);
+      cs_io_read_global(&header, cen_sum, fh);
+      bool match = true;
+      for (int j = 0; j < 3; j++) {
+        double d = CS_ABS(cen_sum[j] - cen_sum_ref[j]);
+        if (d > 1e-10*(CS_ABS(cen_sum_ref[j]) + 1.) * m->n_g_cells)
+          match = false;
+      }
+      if (match == false)
+        break;
+    }
+
+    else if (strncmp(header.sec_name, "cell:source cell number",
+                     CS_IO_NAME_LEN) == 0) {
+      if (header.n_vals != (cs_file_off_t)(m->n_g_cells))
+        bft_error(__FILE__, __LINE__, 0,
+                  _(unexpected_msg), header.sec_name, cs_io_get_name(fh));
+      BFT_MALLOC(b_src_num, n_b_cells, cs_gnum_t);
+      cs_io_set_cs_gnum(&header, fh);
+      cs_io_read_block(&header,
+                       bi.gnum_range[0],
+                       bi.gnum_range[1],
+                       b_src_num,
+                       fh);
+      retval = true;
+      break;
+    }
+
+    else
+      bft_error(__FILE__, __LINE__, 0,
+                _("Section of type <%s> on <%s> is unexpected."),
+                header.sec_name, cs_io_get_name(fh));
+
+  }
+
+  cs_io_finalize(&fh);
+
+  if (retval == false) {
+    bft_printf(_("\n  Restart mapping file \"%s\" does not match the\n"
+                 "  current mesh, so it will be rebuilt.\n"),
+               _map_cache_path);
+    BFT_FREE(b_src_num);
+    return retval;
+  }
+
+  /* Distribute to current partition */
+
+  BFT_MALLOC(*cell_src_num, m->n_cells, cs_gnum_t);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(m->n_cells,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        m->global_cell_num,
+                                        bi,
+                                        cs_glob_mpi_comm);
+    cs_all_to_all_copy_array(d,
+                             CS_GNUM_TYPE,
+                             1,
+                             true, /* reverse */
+                             b_src_num,
+                             *cell_src_num);
+    cs_all_to_all_destroy(&d);
+  }
+#endif
+
+  if (cs_glob_n_ranks < 2) {
+    for (cs_lnum_t i = 0; i < m->n_cells; i++)
+      (*cell_src_num)[i] = b_src_num[i];
+  }
+
+  BFT_FREE(b_src_num);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Build source cell numbers for current cells from the locator.
+ *
+ * parameters:
+ *   src_cell_num <-- global number of source (located) cells, or NULL
+ *                    for identity numbering
+ *
+ * returns:
+ *   global number of source cell for each cell, or 0 if not located
+ *   (to be freed by the caller)
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t *
+_cell_src_num_from_locator(const cs_gnum_t  src_cell_num[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  size_t  n_dist = ple_locator_get_n_dist_points(_locator);
+  const cs_lnum_t  *dist_loc = ple_locator_get_dist_locations(_locator);
+
+  cs_gnum_t *send_num, *cell_src_num;
+  BFT_MALLOC(send_num, n_dist, cs_gnum_t);
+  BFT_MALLOC(cell_src_num, n_cells, cs_gnum_t);
+
+  for (size_t i = 0; i < n_dist; i++) {
+    if (src_cell_num != NULL)
+      send_num[i] = src_cell_num[dist_loc[i]];
+    else
+      send_num[i] = dist_loc[i] + 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_src_num[i] = 0;
+
+  ple_locator_exchange_point_var(_locator,
+                                 send_num,
+                                 cell_src_num,
+                                 ple_locator_get_interior_list(_locator),
+                                 sizeof(cs_gnum_t),
+                                 1,
+                                 0);
+
+  BFT_FREE(send_num);
+
+  return cell_src_num;
+}
+
+/*----------------------------------------------------------------------------
+ * Define mapping from cached source cell numbers.
+ *
+ * Source values are then read using a block distribution, so the source
+ * mesh does not need to be read.
+ *
+ * parameters:
+ *   src_n_g_elts  <-- global number of source cells, interior faces,
+ *                     boundary faces, and vertices
+ *   cell_src_num  <-- global number of source cell for each cell,
+ *                     or 0 if not located
+ *----------------------------------------------------------------------------*/
+
+static void
+_map_cache_setup(const cs_gnum_t  src_n_g_elts[4],
+                 const cs_gnum_t  cell_src_num[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  const char *loc_name[] = {"cells",
+                            "interior_faces",
+                            "boundary_faces",
+                            "vertices"};
+
+  /* Set block-distributed reference numbering for restart */
+
+  for (int i = 0; i < 4; i++) {
+
+    cs_block_dist_info_t  bi
+      = cs_block_dist_compute_sizes(CS_MAX(cs_glob_rank_id, 0),
+                                    cs_glob_n_ranks,
+                                    1,
+                                    0,
+                                    src_n_g_elts[i]);
+
+    cs_lnum_t n_b_elts = bi.gnum_range[1] - bi.gnum_range[0];
+    cs_gnum_t *b_gnum = NULL;
+
+    if (cs_glob_n_ranks > 1) {
+      BFT_MALLOC(b_gnum, n_b_elts, cs_gnum_t);
+      for (cs_lnum_t j = 0; j < n_b_elts; j++)
+        b_gnum[j] = bi.gnum_range[0] + j;
+    }
+
+    cs_restart_add_location_ref(loc_name[i],
+                                src_n_g_elts[i], n_b_elts,
+                                b_gnum);
+
+    BFT_FREE(b_gnum);
+
+    if (i == 0)
+      _src_cell_bi = bi;
+  }
+
+  /* Compact list of located cells */
+
+  _n_mapped_cells = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    if (cell_src_num[i] > 0)
+      _n_mapped_cells += 1;
+  }
+
+  BFT_MALLOC(_mapped_cell_id, _n_mapped_cells, cs_lnum_t);
+  BFT_MALLOC(_mapped_src_num, _n_mapped_cells, cs_gnum_t);
+
+  _n_mapped_cells = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    if (cell_src_num[i] > 0) {
+      _mapped_cell_id[_n_mapped_cells] = i;
+      _mapped_src_num[_n_mapped_cells] = cell_src_num[i];
+      _n_mapped_cells += 1;
+    }
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    _src_d = cs_all_to_all_create_from_block(_n_mapped_cells,
+                                             CS_ALL_TO_ALL_USE_DEST_ID,
+                                             _mapped_src_num,
+                                             _src_cell_bi,
+                                             cs_glob_mpi_comm);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Use P0 interpolation (projection) from block-distributed source
+ *        values to destination mesh entity, based on cached mapping.
+ *
+ * \param[in]       n_location_vals  number of values per location (interlaced)
+ * \param[in]       val_type         value type
+ * \param[in]       val_src          array of block-distributed source values
+ * \param[out]      val              array of values
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_interpolate_p0_cached(int                     n_location_vals,
+                       cs_restart_val_type_t   val_type,
+                       const void             *val_src,
+                       void                   *val)
+{
+  const unsigned char *_val_src = (const unsigned char *)val_src;
+  unsigned char *_val = (unsigned char *)val;
+
+  size_t type_size = _type_size(val_type);
+  size_t loc_size = type_size*n_location_vals;
+
+  unsigned char *recv_var = NULL;
+
+#if defined(HAVE_MPI)
+  if (_src_d != NULL)
+    recv_var = cs_all_to_all_copy_array(_src_d,
+                                        CS_CHAR,
+                                        loc_size,
+                                        true, /* reverse */
+                                        val_src,
+                                        NULL);
+#endif
+
+  for (cs_lnum_t i = 0; i < _n_mapped_cells; i++) {
+    const unsigned char *src
+      = (recv_var != NULL) ?
+          recv_var + i*loc_size
+        : _val_src + (_mapped_src_num[i] - _src_cell_bi.gnum_range[0])*loc_size;
+    unsigned char *dest = _val + _mapped_cell_id[i]*loc_size;
+    memcpy(dest, src, loc_size);
+  }
+
+  BFT_FREE(recv_var);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read a section with interpolation.
@@ -252,12 +779,19 @@ _read_section_interpolate(cs_restart_t           *restart,
                              val_type,
                              read_buffer);
 
-    if (retval == CS_RESTART_SUCCESS)
-      _interpolate_p0(_locator,
-                      n_location_vals,
-                      val_type,
-                      read_buffer,
-                      val);
+    if (retval == CS_RESTART_SUCCESS) {
+      if (_locator != NULL)
+        _interpolate_p0(_locator,
+                        n_location_vals,
+                        val_type,
+                        read_buffer,
+                        val);
+      else
+        _interpolate_p0_cached(n_location_vals,
+                               val_type,
+                               read_buffer,
+                               val);
+    }
 
     BFT_FREE(read_buffer);
   }
@@ -308,6 +842,35 @@ cs_restart_map_set_options(float  tolerance_base,
   _tolerance[1] = tolerance_fraction;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set a file used to save and reuse the restart mapping.
+ *
+ * If this file exists and matches the current mesh, the mapping is read
+ * from it, so neither reading the previous mesh nor locating the current
+ * cells in it is required. Otherwise, the mapping is built as usual and
+ * saved to this file, so it may be reused by later restarts between
+ * the same pair of meshes.
+ *
+ * \param[in]  path  path to mapping file, or NULL to disable its use
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_map_set_cache_file(const char  *path)
+{
+  if (path == NULL) {
+    BFT_FREE(_map_cache_path);
+    return;
+  }
+
+  size_t n = strlen(path);
+  BFT_REALLOC(_map_cache_path, n + 1, char);
+
+  strncpy(_map_cache_path, path, n);
+  _map_cache_path[n] = '\0';
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build mapping of restart files to different mesh if defined.
@@ -323,6 +886,32 @@ cs_restart_map_build(void)
   int t_restart_id = cs_timer_stats_id_by_name("checkpoint_restart_stage");
   int t_top_id = cs_timer_stats_switch(t_restart_id);
 
+  cs_gnum_t src_n_g_elts[4] = {0, 0, 0, 0};
+  cs_gnum_t *src_cell_num = NULL;
+
+  /* Use cached mapping if available */
+
+  if (_map_cache_path != NULL) {
+
+    cs_gnum_t *cell_src_num = NULL;
+
+    if (_map_cache_read(src_n_g_elts, &cell_src_num)) {
+
+      _map_cache_setup(src_n_g_elts, cell_src_num);
+      _map_from_cache = true;
+      BFT_FREE(cell_src_num);
+
+      if (_read_section_f == NULL) {
+        _read_section_f
+          = cs_restart_set_read_section_func(_read_section_interpolate);
+      }
+
+      cs_timer_stats_switch(t_top_id);
+      return;
+    }
+
+  }
+
   /* Stash (protect) mesh to read older mesh; should not be necessary
      for reading mesh, but required for older restart, and
      may be safer at this stage */
@@ -376,6 +965,20 @@ cs_restart_map_build(void)
 
     fvm_nodal_make_vertices_private(nm);
 
+    /* Save info required for mapping cache */
+
+    if (_map_cache_path != NULL) {
+      src_n_g_elts[0] = m->n_g_cells;
+      src_n_g_elts[1] = m->n_g_i_faces;
+      src_n_g_elts[2] = m->n_g_b_faces;
+      src_n_g_elts[3] = m->n_g_vertices;
+      if (m->global_cell_num != NULL) {
+        BFT_MALLOC(src_cell_num, m->n_cells, cs_gnum_t);
+        for (cs_lnum_t i = 0; i < m->n_cells; i++)
+          src_cell_num[i] = m->global_cell_num[i];
+      }
+    }
+
     /* Destroy temporary mesh structures */
 
     cs_glob_mesh = m;
@@ -424,6 +1027,14 @@ cs_restart_map_build(void)
 
   nm = fvm_nodal_destroy(nm);
 
+  /* Save mapping for future use if required */
+
+  if (_map_cache_path != NULL) {
+    cs_gnum_t *cell_src_num = _cell_src_num_from_locator(src_cell_num);
+    _map_cache_write(src_n_g_elts, cell_src_num);
+    BFT_FREE(cell_src_num);
+    BFT_FREE(src_cell_num);
+  }
 
   /* Set associated read function if not already set */
 
@@ -447,6 +1058,7 @@ void
 cs_restart_map_free(void)
 {
   BFT_FREE(_mesh_input_path);
+  BFT_FREE(_map_cache_path);
   _tolerance[0] = 0;
   _tolerance[1] = 0.1;
 
@@ -457,6 +1069,31 @@ cs_restart_map_free(void)
     cs_restart_clear_locations_ref();
   }
 
+  /* Free mapping based on cache file */
+
+  if (_map_from_cache) {
+
+#if defined(HAVE_MPI)
+    if (_src_d != NULL)
+      cs_all_to_all_destroy(&_src_d);
+#endif
+
+    BFT_FREE(_mapped_cell_id);
+    BFT_FREE(_mapped_src_num);
+    _n_mapped_cells = 0;
+    _map_from_cache = false;
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Restart mapping\n"
+                    "  mapping read from cache file\n\n"));
+    cs_log_separator(CS_LOG_PERFORMANCE);
+
+  }
+
+  if (_locator == NULL)
+    return;
+
   double loc_times[4];
 
   ple_locator_get_times(_locator,
@@ -87,6 +87,23 @@ void
 cs_restart_map_set_options(float  tolerance_base,
                            float  tolerance_fraction);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set a file used to save and reuse the restart mapping.
+ *
+ * If this file exists and matches the current mesh, the mapping is read
+ * from it, so neither reading the previous mesh nor locating the current
+ * cells in it is required. Otherwise, the mapping is built as usual and
+ * saved to this file, so it may be reused by later restarts between
+ * the same pair of meshes.
+ *
+ * \param[in]  path  path to mapping file, or NULL to disable its use
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_map_set_cache_file(const char  *path);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build mapping of restart files to different mesh if defined.
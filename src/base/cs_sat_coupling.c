@@ -746,17 +746,18 @@ _sat_coupling_interpolate(cs_sat_coupling_t  *couplage)
 
   }
 
-  /* Get the distant weighting coefficients (reverse = 1) */
+  /* Get the distant weighting coefficients (reverse = 1);
+     the exchange is completed after computing the OF distance */
 
   reverse = 1;
 
-  ple_locator_exchange_point_var(couplage->localis_fbr,
-                                 couplage->distant_pond_fbr,
-                                 couplage->local_pond_fbr,
-                                 NULL,
-                                 sizeof(cs_real_t),
-                                 1,
-                                 reverse);
+  ple_locator_exchange_point_var_start(couplage->localis_fbr,
+                                       couplage->distant_pond_fbr,
+                                       couplage->local_pond_fbr,
+                                       NULL,
+                                       sizeof(cs_real_t),
+                                       1,
+                                       reverse);
 
   /* Calculation of the OF distance */
   /*--------------------------------*/
@@ -806,6 +807,8 @@ _sat_coupling_interpolate(cs_sat_coupling_t  *couplage)
     }
   }
 
+  ple_locator_exchange_point_var_wait(couplage->localis_fbr);
+
   reverse = 1;
 
   ple_locator_exchange_point_var(couplage->localis_fbr,
@@ -40,6 +40,8 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_order.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -52,6 +54,14 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Minimum array size above which radix sort is used instead of heap sort */
+
+#define _RADIX_MIN_SIZE 2048
+
 /*============================================================================
  * Local structure definitions
  *============================================================================*/
@@ -181,6 +191,11 @@ _sort_gnum(cs_gnum_t  number[],
 
   }
 
+  /* Use radix sort for large arrays */
+
+  else if (n_elts >= _RADIX_MIN_SIZE)
+    cs_order_radix_sort_gnum(n_elts, number, NULL);
+
   else {
 
     /* Create binary tree */
@@ -651,6 +666,11 @@ cs_sort_lnum(cs_lnum_t  number[],
 
   }
 
+  /* Use radix sort for large arrays */
+
+  else if (n_elts >= _RADIX_MIN_SIZE)
+    cs_order_radix_sort_lnum(n_elts, number, NULL);
+
   else {
 
     /* Create binary tree */
@@ -803,6 +823,11 @@ cs_sort_and_compact_gnum(cs_lnum_t  n_elts,
 
   }
 
+  /* Use radix sort for large arrays */
+
+  else if (n_elts >= _RADIX_MIN_SIZE)
+    cs_order_radix_sort_gnum(n_elts, elts, NULL);
+
   else {
 
     /* Create binary tree */
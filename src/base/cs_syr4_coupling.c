@@ -124,6 +124,10 @@ typedef struct _cs_syr4_coupling_ent_t {
 
   double            *hvol;           /* Volumetric exchange coefficient. */
 
+  /* Send buffer for pending (split-phase) exchange */
+
+  double            *send_var;       /* Values sent to SYRTHES, or NULL */
+
 } cs_syr4_coupling_ent_t;
 
 /* Structure associated with Syrthes coupling */
@@ -558,6 +562,8 @@ _create_coupled_ent(cs_syr4_coupling_t  *syr_coupling,
 
   coupling_ent->hvol = NULL;
 
+  coupling_ent->send_var = NULL;
+
   if (syr_coupling->verbosity > 0) {
     bft_printf(_("\nExtracting coupled mesh             ..."));
     bft_printf_flush();
@@ -1077,6 +1083,24 @@ _all_comm_times(void)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Complete pending send of coupling variables to SYRTHES, if present.
+ *
+ * parameters:
+ *   coupling_ent <-> associated coupling entity
+ *----------------------------------------------------------------------------*/
+
+static void
+_complete_send(cs_syr4_coupling_ent_t  *coupling_ent)
+{
+  if (coupling_ent->send_var == NULL)
+    return;
+
+  ple_locator_exchange_point_var_wait(coupling_ent->locator);
+
+  BFT_FREE(coupling_ent->send_var);
+}
+
 /*----------------------------------------------------------------------------
  * Destroy coupled entity helper structure.
  *
@@ -1092,6 +1116,8 @@ _destroy_coupled_ent(cs_syr4_coupling_ent_t **coupling_ent)
   if (ce == NULL)
     return;
 
+  _complete_send(ce);
+
   if (ce->locator != NULL)
     ce->locator = ple_locator_destroy(ce->locator);
 
@@ -1812,7 +1838,9 @@ cs_syr4_coupling_recv_tsolid(cs_syr4_coupling_t  *syr_coupling,
   if (coupling_ent == NULL)
     return;
 
-  /* Receive data */
+  /* Complete previous send, then receive data */
+
+  _complete_send(coupling_ent);
 
   ple_locator_exchange_point_var(coupling_ent->locator,
                                  NULL,
@@ -1875,7 +1903,10 @@ cs_syr4_coupling_send_tf_hf(cs_syr4_coupling_t  *syr_coupling,
   n_dist = ple_locator_get_n_dist_points(coupling_ent->locator);
   dist_loc = ple_locator_get_dist_locations(coupling_ent->locator);
 
-  /* Prepare and send data */
+  /* Prepare and send data; the send is completed before the next
+     exchange with SYRTHES, so that it may overlap with computation */
+
+  _complete_send(coupling_ent);
 
   BFT_MALLOC(send_var, n_dist*2, double);
 
@@ -1884,15 +1915,15 @@ cs_syr4_coupling_send_tf_hf(cs_syr4_coupling_t  *syr_coupling,
     send_var[ii*2 + 1] = hf[dist_loc[ii] - 1];
   }
 
-  ple_locator_exchange_point_var(coupling_ent->locator,
-                                 send_var,
-                                 NULL,
-                                 NULL,
-                                 sizeof(double),
-                                 2,
-                                 0);
+  coupling_ent->send_var = send_var;
 
-  BFT_FREE(send_var);
+  ple_locator_exchange_point_var_start(coupling_ent->locator,
+                                       send_var,
+                                       NULL,
+                                       NULL,
+                                       sizeof(double),
+                                       2,
+                                       0);
 
   if (mode == 1 && coupling_ent->n_elts > 0) {
 
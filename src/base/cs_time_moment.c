@@ -56,6 +56,8 @@
 #include "cs_restart.h"
 #include "cs_restart_default.h"
 #include "cs_prototypes.h"
+
+#include "fvm_io_num.h"
 #include "cs_time_step.h"
 
 /*----------------------------------------------------------------------------
@@ -204,6 +206,24 @@ typedef struct {
 
 } cs_time_moment_restart_info_t;
 
+/* Moment data evaluation, shared by moments based on the same data */
+/*-----------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_time_moment_data_t  *data_func;    /* Associated data elements computation
+                                           function */
+  const void             *data_input;   /* pointer to optional (untyped)
+                                           value or structure */
+  int                     location_id;  /* Associated mesh location id */
+  int                     data_dim;     /* Associated data dimension */
+
+  int                     n_uses;       /* Number of remaining uses in the
+                                           current update */
+  cs_real_t              *val;          /* Evaluated values, or NULL */
+
+} cs_time_moment_data_eval_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -224,12 +244,19 @@ static cs_time_moment_t *_moment = NULL;
 
 static  bool _restart_info_checked = false;
 static  bool _restart_uses_main = false;
+static  double _restart_tolerance = 0.;     /* lossy compression tolerance */
 static  cs_time_moment_restart_info_t *_restart_info = NULL;
 
 static double _t_prev_iter = 0.;
 
 static const cs_real_t *_p_dt = NULL; /* Mapped cell time step */
 
+/* Compact global numbering of location subsets, for restart,
+   indexed by mesh location id */
+
+static int  _n_restart_gnum = 0;
+static cs_gnum_t **_restart_gnum = NULL;
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -712,11 +739,15 @@ _build_sd_desc(int        n_fields,
  * then (field_id, component_id, component_id_0, component_id_dim-1) tuples.
  * Negative component ids in the second position mean all components are used.
  *
+ * The data location is that of the fields, unless a subset of that
+ * location is given.
+ *
  * parameters:
- *   name     <-- name of associated decription
- *   n_fields <-- number of multiplying fields
- *   field_id <-- array of ids of multiplying fields
- *   comp_id  <-- array of ids of multiplying components
+ *   name         <-- name of associated decription
+ *   sub_location <-- id of subset of field location, or -1
+ *   n_fields     <-- number of multiplying fields
+ *   field_id     <-- array of ids of multiplying fields
+ *   comp_id      <-- array of ids of multiplying components
  *
  * returns:
  *   id of matching simple data definition
@@ -724,6 +755,7 @@ _build_sd_desc(int        n_fields,
 
 static int
 _find_or_add_sd(const char  *name,
+                int          sub_location,
                 int          n_fields,
                 const int    f_id[],
                 const int    c_id[])
@@ -741,11 +773,14 @@ _find_or_add_sd(const char  *name,
      some data which could be shared will be duplicated, leading to slightly
      higher memory usage and computational cost) */
 
+  const int sd_location = (sub_location > -1) ?
+    sub_location : cs_field_by_id(f_id[0])->location_id;
+
   for (sd_id = 0; sd_id < _n_moment_sd_defs; sd_id++) {
     bool is_different = false;
     const int *msd = _moment_sd_defs[sd_id];
     const int stride = 2 + msd[1];
-    if (n_fields != msd[2])
+    if (n_fields != msd[2] || sd_location != msd[0])
       is_different = true;
     else {
       for (int i = 0; i < n_fields; i++) {
@@ -834,6 +869,25 @@ _find_or_add_sd(const char  *name,
     }
   }
 
+  /* Restrict to subset of field location if required */
+
+  if (sub_location > -1 && sub_location != location_id) {
+    if (   cs_mesh_location_get_type(sub_location)
+           != cs_mesh_location_get_type(location_id)
+        || location_id != (int)cs_mesh_location_get_type(location_id)) {
+      _build_sd_desc(n_fields, f_id, c_id, 256, sd_desc);
+      bft_error
+        (__FILE__, __LINE__, 0,
+         _("Definition of simple data used for %s:\n"
+           "%s\n"
+           "mesh location \"%s\" is not a subset of field location \"%s\"."),
+         name, sd_desc,
+         cs_mesh_location_get_name(sub_location),
+         cs_mesh_location_get_name(location_id));
+    }
+    location_id = sub_location;
+  }
+
   /* Now initialize members */
 
   int stride = 2 + dim;
@@ -938,6 +992,7 @@ _sd_moment_data(const void  *input,
   const int n_fields = msd[2];
 
   const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(location_id)[0];
+  const cs_lnum_t *elt_ids = cs_mesh_location_get_elt_ids_try(location_id);
 
   int _f_dim[16*2];
   int *f_dim;
@@ -976,12 +1031,13 @@ _sd_moment_data(const void  *input,
   /* Now compute values */
 
   for (cs_lnum_t  i = 0; i < n_elts; i++) {
+    const cs_lnum_t e_id = (elt_ids != NULL) ? elt_ids[i] : i;
     const cs_real_t *restrict v = f_val[0];
     cs_lnum_t m0 = f_dim[0];
     cs_lnum_t m1 = f_dim[1];
     for (cs_lnum_t k = 0; k < dim; k++) {
       cs_lnum_t c_id = msd[3 + 2 + k]; /* as below, with j = 0 */
-      vals[i*dim + k] = v[m0*i + m1*c_id];
+      vals[i*dim + k] = v[m0*e_id + m1*c_id];
     }
     for (int j = 1; j < n_fields; j++) {
       v = f_val[j];
@@ -989,7 +1045,7 @@ _sd_moment_data(const void  *input,
       m1 = f_dim[j*2 + 1];
       for (cs_lnum_t k = 0; k < dim; k++) {
         cs_lnum_t c_id = msd[3 + j*stride + 2 + k];
-        vals[i*dim + k] *= v[m0*i + m1*c_id];
+        vals[i*dim + k] *= v[m0*e_id + m1*c_id];
       }
     }
   }
@@ -1442,6 +1498,178 @@ _ensure_init_moment(cs_time_moment_t  *mt)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return restart location id matching a given mesh location.
+ *
+ * Main locations have matching restart locations. Other locations, which
+ * are subsets of a main location, are added to the restart file on first
+ * use, with a compact global numbering, so that moments defined on such
+ * subsets are checkpointed using the reduced layout.
+ *
+ * parameters:
+ *   r           <-- associated restart file pointer
+ *   location_id <-- id of mesh location
+ *   r_loc_id    <-> restart location id matching mesh locations
+ *                   (-1 if not added yet)
+ *
+ * returns:
+ *   id of matching restart location
+ *----------------------------------------------------------------------------*/
+
+static int
+_restart_location_id(cs_restart_t  *r,
+                     int            location_id,
+                     int            r_loc_id[])
+{
+  if (location_id == (int)cs_mesh_location_get_type(location_id))
+    return location_id;
+
+  if (r_loc_id[location_id] > -1)
+    return r_loc_id[location_id];
+
+  /* Element ids may be NULL if all local elements are selected */
+
+  const cs_lnum_t *elt_ids = cs_mesh_location_get_elt_ids_try(location_id);
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(location_id)[0];
+  cs_gnum_t n_g_elts = n_elts;
+
+  if (_n_restart_gnum < cs_mesh_location_n_locations()) {
+    int n_prev = _n_restart_gnum;
+    _n_restart_gnum = cs_mesh_location_n_locations();
+    BFT_REALLOC(_restart_gnum, _n_restart_gnum, cs_gnum_t *);
+    for (int i = n_prev; i < _n_restart_gnum; i++)
+      _restart_gnum[i] = NULL;
+  }
+
+  const cs_gnum_t *parent_gnum = NULL;
+
+  switch(cs_mesh_location_get_type(location_id)) {
+  case CS_MESH_LOCATION_CELLS:
+    parent_gnum = m->global_cell_num;
+    break;
+  case CS_MESH_LOCATION_INTERIOR_FACES:
+    parent_gnum = m->global_i_face_num;
+    break;
+  case CS_MESH_LOCATION_BOUNDARY_FACES:
+    parent_gnum = m->global_b_face_num;
+    break;
+  case CS_MESH_LOCATION_VERTICES:
+    parent_gnum = m->global_vtx_num;
+    break;
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              _("Checkpointing of time moments on mesh location \"%s\"\n"
+                "is not currently supported."),
+              cs_mesh_location_get_name(location_id));
+  }
+
+  BFT_FREE(_restart_gnum[location_id]);
+
+  if (parent_gnum != NULL) {
+    fvm_io_num_t *io_num
+      = fvm_io_num_create_from_select(elt_ids, parent_gnum, n_elts, 0);
+    n_g_elts = fvm_io_num_get_global_count(io_num);
+    _restart_gnum[location_id] = fvm_io_num_transfer_global_num(io_num);
+    fvm_io_num_destroy(io_num);
+  }
+  else {
+    BFT_MALLOC(_restart_gnum[location_id], n_elts, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      _restart_gnum[location_id][i] = i+1;
+  }
+
+  char s[64];
+  snprintf(s, 64, "time_moments:%s", cs_mesh_location_get_name(location_id));
+  s[63] = '\0';
+
+  r_loc_id[location_id] = cs_restart_add_location(r,
+                                                  s,
+                                                  n_g_elts,
+                                                  n_elts,
+                                                  _restart_gnum[location_id]);
+
+  return r_loc_id[location_id];
+}
+
+/*----------------------------------------------------------------------------
+ * Find or add data evaluation entry matching a given moment.
+ *
+ * parameters:
+ *   mt       <-- moment
+ *   n_evals  <-> number of data evaluation entries
+ *   evals    <-> data evaluation entries
+ *
+ * returns:
+ *   id of matching data evaluation entry
+ *----------------------------------------------------------------------------*/
+
+static int
+_find_or_add_data_eval(const cs_time_moment_t      *mt,
+                       int                         *n_evals,
+                       cs_time_moment_data_eval_t   evals[])
+{
+  for (int i = 0; i < *n_evals; i++) {
+    cs_time_moment_data_eval_t *me = evals + i;
+    if (   mt->data_func == me->data_func && mt->data_input == me->data_input
+        && mt->location_id == me->location_id
+        && mt->data_dim == me->data_dim)
+      return i;
+  }
+
+  int e_id = *n_evals;
+  *n_evals += 1;
+
+  cs_time_moment_data_eval_t *me = evals + e_id;
+
+  me->data_func = mt->data_func;
+  me->data_input = mt->data_input;
+  me->location_id = mt->location_id;
+  me->data_dim = mt->data_dim;
+  me->n_uses = 0;
+  me->val = NULL;
+
+  return e_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Get evaluated moment data, evaluating it on first use.
+ *
+ * parameters:
+ *   me <-> data evaluation entry
+ *
+ * returns:
+ *   pointer to evaluated data
+ *----------------------------------------------------------------------------*/
+
+static const cs_real_t *
+_data_eval_get(cs_time_moment_data_eval_t  *me)
+{
+  if (me->val == NULL) {
+    const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(me->location_id)[0];
+    BFT_MALLOC(me->val, n_elts*me->data_dim, cs_real_t);
+    me->data_func(me->data_input, me->val);
+  }
+
+  return me->val;
+}
+
+/*----------------------------------------------------------------------------
+ * Release evaluated moment data after use, freeing it after its last use.
+ *
+ * parameters:
+ *   me <-> data evaluation entry
+ *----------------------------------------------------------------------------*/
+
+static void
+_data_eval_release(cs_time_moment_data_eval_t  *me)
+{
+  me->n_uses -= 1;
+  if (me->n_uses < 1)
+    BFT_FREE(me->val);
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -1488,6 +1716,11 @@ cs_time_moment_destroy_all(void)
   _free_all_wa();
   _free_all_sd_defs();
 
+  for (int i = 0; i < _n_restart_gnum; i++)
+    BFT_FREE(_restart_gnum[i]);
+  BFT_FREE(_restart_gnum);
+  _n_restart_gnum = 0;
+
   _p_dt = NULL;
   _restart_info_checked = false;
 }
@@ -1528,7 +1761,70 @@ cs_time_moment_define_by_field_ids(const char                *name,
                                    const char                *restart_name)
 {
   int m_id = -1;
-  int sd_id =_find_or_add_sd(name, n_fields, field_id, component_id);
+  int sd_id =_find_or_add_sd(name, -1, n_fields, field_id, component_id);
+
+  const int *msd = _moment_sd_defs[sd_id];
+
+  m_id = cs_time_moment_define_by_func(name,
+                                       msd[0],
+                                       msd[1],
+                                       _sd_moment_data,
+                                       msd,
+                                       NULL,
+                                       NULL,
+                                       type,
+                                       nt_start,
+                                       t_start,
+                                       restart_mode,
+                                       restart_name);
+
+  return m_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a moment of a product of existing fields components,
+ *        restricted to a subset of the fields' location.
+ *
+ * This is similar to \ref cs_time_moment_define_by_field_ids, except
+ * that the moment and its accumulators are only defined (and stored) on
+ * the elements of the given mesh location, which must be a subset of
+ * the fields' location (for example cells selected by criteria).
+ * This allows reducing the memory footprint of statistics required
+ * only in part of the domain. The associated checkpoint sections
+ * also use this reduced layout.
+ *
+ * \param[in]  name           name of associated moment
+ * \param[in]  location_id    id of associated mesh location subset
+ * \param[in]  n_fields       number of associated fields
+ * \param[in]  field_id       ids of associated fields
+ * \param[in]  component_id   ids of matching field components (-1 for all)
+ * \param[in]  type           moment type
+ * \param[in]  nt_start       starting time step (or -1 to use t_start)
+ * \param[in]  t_start        starting time
+ * \param[in]  restart_mode   behavior in case of restart (reset,
+ *                            automatic, or strict)
+ * \param[in]  restart_name   if not NULL, previous name in case of restart
+ *
+ * \return id of new moment in case of success, -1 in case of error.
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_time_moment_define_subset_by_fields(const char               *name,
+                                       int                       location_id,
+                                       int                       n_fields,
+                                       const int                 field_id[],
+                                       const int                 component_id[],
+                                       cs_time_moment_type_t     type,
+                                       int                       nt_start,
+                                       double                    t_start,
+                                       cs_time_moment_restart_t  restart_mode,
+                                       const char               *restart_name)
+{
+  int m_id = -1;
+  int sd_id =_find_or_add_sd(name, location_id,
+                             n_fields, field_id, component_id);
 
   const int *msd = _moment_sd_defs[sd_id];
 
@@ -2008,20 +2304,71 @@ cs_time_moment_update_all(void)
   BFT_MALLOC(wa_cur_data, _n_moment_wa, cs_real_t *);
   BFT_MALLOC(wa_cur_data0, _n_moment_wa, cs_real_t);
 
-  /* Compute current weight data */
+  /* Compute current weight data, and associated weight ratio
+     w / (w + wa_sum), shared by all moments using a given accumulator */
+
+  cs_real_t **wa_ratio;
+  BFT_MALLOC(wa_ratio, _n_moment_wa, cs_real_t *);
 
   for (i = 0; i < _n_moment_wa; i++) {
     cs_time_moment_wa_t *mwa = _moment_wa + i;
+    wa_ratio[i] = NULL;
     if (mwa->nt_start > -1 && mwa->nt_start <= ts->nt_cur) {
       _ensure_init_weight_accumulator(mwa);
       wa_cur_data[i] = _compute_current_weight(mwa,
                                                dt_val,
                                                wa_cur_data0 + i);
+      const cs_real_t *restrict w = wa_cur_data[i];
+      const cs_real_t *restrict wa_sum = &(mwa->val0);
+      cs_lnum_t n_w_elts = 1;
+      if (mwa->location_id != CS_MESH_LOCATION_NONE) {
+        n_w_elts = cs_mesh_location_get_n_elts(mwa->location_id)[0];
+        wa_sum = mwa->val;
+      }
+      BFT_MALLOC(wa_ratio[i], n_w_elts, cs_real_t);
+      cs_real_t *restrict r = wa_ratio[i];
+#     pragma omp parallel for if (n_w_elts > CS_THR_MIN)
+      for (cs_lnum_t k = 0; k < n_w_elts; k++)
+        r[k] = w[k] / (w[k] + wa_sum[k]);
     }
     else
       wa_cur_data[i] = NULL;
   }
 
+  /* Determine which moments are updated in this pass (means associated
+     with a variance are updated with that variance), and count uses of
+     each data evaluation, so that data shared by several moments
+     is evaluated only once, and freed after its last use. */
+
+  int n_evals = 0;
+  int *m_eval_id;
+  cs_time_moment_data_eval_t *evals;
+
+  BFT_MALLOC(m_eval_id, _n_moments, int);
+  BFT_MALLOC(evals, _n_moments, cs_time_moment_data_eval_t);
+
+  for (i = 0; i < _n_moments; i++) {
+    cs_time_moment_t *mt = _moment + i;
+    cs_time_moment_wa_t *mwa = _moment_wa + mt->wa_id;
+    m_eval_id[i] = -1;
+    if (   mt->nt_cur < ts->nt_cur
+        && (mwa->nt_start > -1 && mwa->nt_start <= ts->nt_cur))
+      m_eval_id[i] = _find_or_add_data_eval(mt, &n_evals, evals);
+  }
+
+  for (i = 0; i < _n_moments; i++) {
+    cs_time_moment_t *mt = _moment + i;
+    if (m_eval_id[i] > -1 && mt->type == CS_TIME_MOMENT_VARIANCE) {
+      assert(mt->l_id > -1);
+      m_eval_id[mt->l_id] = -1;
+    }
+  }
+
+  for (i = 0; i < _n_moments; i++) {
+    if (m_eval_id[i] > -1)
+      evals[m_eval_id[i]].n_uses += 1;
+  }
+
   /* Loop on variances first */
 
   for (int m_type = CS_TIME_MOMENT_VARIANCE;
@@ -2033,16 +2380,15 @@ cs_time_moment_update_all(void)
       cs_time_moment_t *mt = _moment + i;
       cs_time_moment_wa_t *mwa = _moment_wa + mt->wa_id;
 
-      if (   mt->nt_cur < ts->nt_cur
-          && (int)(mt->type) == m_type
-          && (mwa->nt_start > -1 && mwa->nt_start <= ts->nt_cur)) {
+      if (m_eval_id[i] > -1 && (int)(mt->type) == m_type) {
 
         /* Current and accumulated weight */
 
         cs_lnum_t  wa_stride;
-        cs_real_t *restrict wa_sum, *restrict x;
+        const cs_real_t *restrict wa_sum;
 
-        cs_real_t *const restrict w = wa_cur_data[mt->wa_id];
+        const cs_real_t *restrict w = wa_cur_data[mt->wa_id];
+        const cs_real_t *restrict wr = wa_ratio[mt->wa_id];
 
         if (mwa->location_id == CS_MESH_LOCATION_NONE) {
           wa_sum = &(mwa->val0);
@@ -2057,11 +2403,11 @@ cs_time_moment_update_all(void)
 
         const cs_lnum_t n_elts
           = cs_mesh_location_get_n_elts(mt->location_id)[0];
-        const cs_lnum_t nd = n_elts * mt->dim;
+        const cs_lnum_t dim = mt->dim;
 
-        BFT_MALLOC(x, nd, cs_real_t);
+        cs_time_moment_data_eval_t *me = evals + m_eval_id[i];
 
-        mt->data_func(mt->data_input, x);
+        const cs_real_t *restrict x = _data_eval_get(me);
 
         _ensure_init_moment(mt);
 
@@ -2084,8 +2430,9 @@ cs_time_moment_update_all(void)
             m = f_mean->val;
           }
 
-          if (mt->dim == 6) { /* variance-covariance matrix */
+          if (dim == 6) { /* variance-covariance matrix */
             assert(mt->data_dim == 3);
+#           pragma omp parallel for if (n_elts > CS_THR_MIN)
             for (cs_lnum_t je = 0; je < n_elts; je++) {
               double delta[3], delta_n[3], r[3], m_n[3];
               const cs_lnum_t k = je*wa_stride;
@@ -2093,7 +2440,7 @@ cs_time_moment_update_all(void)
               for (cs_lnum_t l = 0; l < 3; l++) {
                 cs_lnum_t jl = je*6 + l, jml = je*3 + l;
                 delta[l]   = x[jml] - m[jml];
-                r[l] = delta[l] * (w[k] / wa_sum_n);
+                r[l] = delta[l] * wr[k];
                 m_n[l] = m[jml] + r[l];
                 delta_n[l] = x[jml] - m_n[l];
                 val[jl] =   (val[jl]*wa_sum[k] + (w[k]*delta[l]*delta_n[l]))
@@ -2120,14 +2467,19 @@ cs_time_moment_update_all(void)
           }
 
           else { /* simple variance */
-            for (cs_lnum_t j = 0; j < nd; j++) {
-              const cs_lnum_t k = (j*wa_stride) / mt->dim;
-              double wa_sum_n = w[k] + wa_sum[k];
-              double delta = x[j] - m[j];
-              double r = delta * (w[k] / wa_sum_n);
-              double m_n = m[j] + r;
-              val[j] = (val[j]*wa_sum[k] + (w[k]*delta*(x[j]-m_n))) / wa_sum_n;
-              m[j] += r;
+#           pragma omp parallel for if (n_elts > CS_THR_MIN)
+            for (cs_lnum_t je = 0; je < n_elts; je++) {
+              const cs_lnum_t k = je*wa_stride;
+              const double wa_sum_n = w[k] + wa_sum[k];
+              for (cs_lnum_t l = 0; l < dim; l++) {
+                const cs_lnum_t j = je*dim + l;
+                double delta = x[j] - m[j];
+                double r = delta * wr[k];
+                double m_n = m[j] + r;
+                val[j] =   (val[j]*wa_sum[k] + (w[k]*delta*(x[j]-m_n)))
+                         / wa_sum_n;
+                m[j] += r;
+              }
             }
           }
 
@@ -2136,16 +2488,27 @@ cs_time_moment_update_all(void)
 
         else if (mt->type == CS_TIME_MOMENT_MEAN) {
 
-          for (cs_lnum_t j = 0; j < nd; j++) {
-            const cs_lnum_t k = (j*wa_stride) / mt->dim;
-            val[j] += (x[j] - val[j]) * (w[k] / (w[k] + wa_sum[k]));
+          if (dim == 1) {
+#           pragma omp parallel for if (n_elts > CS_THR_MIN)
+            for (cs_lnum_t j = 0; j < n_elts; j++)
+              val[j] += (x[j] - val[j]) * wr[j*wa_stride];
+          }
+          else {
+#           pragma omp parallel for if (n_elts > CS_THR_MIN)
+            for (cs_lnum_t je = 0; je < n_elts; je++) {
+              const cs_real_t r = wr[je*wa_stride];
+              for (cs_lnum_t l = 0; l < dim; l++) {
+                const cs_lnum_t j = je*dim + l;
+                val[j] += (x[j] - val[j]) * r;
+              }
+            }
           }
 
         }
 
         mt->nt_cur = ts->nt_cur;
 
-        BFT_FREE(x);
+        _data_eval_release(me);
 
       } /* End of test if moment is active */
 
@@ -2153,6 +2516,12 @@ cs_time_moment_update_all(void)
 
   } /* End of loop on moment types */
 
+  for (i = 0; i < n_evals; i++)
+    BFT_FREE(evals[i].val);
+
+  BFT_FREE(evals);
+  BFT_FREE(m_eval_id);
+
   /* Update and free weight data */
 
   for (i = 0; i < _n_moment_wa; i++) {
@@ -2163,6 +2532,10 @@ cs_time_moment_update_all(void)
     }
   }
 
+  for (i = 0; i < _n_moment_wa; i++)
+    BFT_FREE(wa_ratio[i]);
+  BFT_FREE(wa_ratio);
+
   BFT_FREE(wa_cur_data0);
   BFT_FREE(wa_cur_data);
 }
@@ -2547,6 +2920,25 @@ cs_time_moment_restart_use_main(int  use_main)
     _restart_uses_main = false;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set error bound for lossy compression of moment values in
+ *        checkpoint files.
+ *
+ * The tolerance is relative to the maximum absolute value of each moment
+ * (see \ref cs_restart_set_codec). Moments are non-converged statistics,
+ * so a small error bound (such as 1e-8) is usually acceptable.
+ *
+ * \param[in]  tolerance  relative error bound, or 0 for no lossy compression
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_restart_set_tolerance(double  tolerance)
+{
+  _restart_tolerance = tolerance;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read restart moment data
@@ -2573,6 +2965,12 @@ cs_time_moment_restart_read(cs_restart_t  *restart)
 
   cs_time_moment_restart_info_t  *ri = _restart_info;
 
+  int n_locations = cs_mesh_location_n_locations();
+  int *r_loc_id;
+  BFT_MALLOC(r_loc_id, n_locations, int);
+  for (int i = 0; i < n_locations; i++)
+    r_loc_id[i] = -1;
+
   /* Read information proper */
 
   for (int i = 0; i < _n_moment_wa; i++) {
@@ -2583,7 +2981,9 @@ cs_time_moment_restart_read(cs_restart_t  *restart)
       _ensure_init_weight_accumulator(mwa);
       retcode = cs_restart_read_section(restart,
                                         s,
-                                        mwa->location_id,
+                                        _restart_location_id(restart,
+                                                             mwa->location_id,
+                                                             r_loc_id),
                                         1,
                                         CS_TYPE_cs_real_t,
                                         mwa->val);
@@ -2602,7 +3002,9 @@ cs_time_moment_restart_read(cs_restart_t  *restart)
       }
       retcode = cs_restart_read_section(restart,
                                         ri->name[mt->restart_id],
-                                        mt->location_id,
+                                        _restart_location_id(restart,
+                                                             mt->location_id,
+                                                             r_loc_id),
                                         mt->dim,
                                         CS_TYPE_cs_real_t,
                                         val);
@@ -2610,6 +3012,8 @@ cs_time_moment_restart_read(cs_restart_t  *restart)
     }
   }
 
+  BFT_FREE(r_loc_id);
+
   /* Free info */
 
   _restart_info_free();
@@ -2785,6 +3189,12 @@ cs_time_moment_restart_write(cs_restart_t  *restart)
   BFT_FREE(nt_start);
   BFT_FREE(location_id);
 
+  int n_locations = cs_mesh_location_n_locations();
+  int *r_loc_id;
+  BFT_MALLOC(r_loc_id, n_locations, int);
+  for (int i = 0; i < n_locations; i++)
+    r_loc_id[i] = -1;
+
   for (int i = 0; i < _n_moment_wa; i++) {
     int j = active_wa_id[i];
     cs_time_moment_wa_t *mwa = _moment_wa + i;
@@ -2793,7 +3203,9 @@ cs_time_moment_restart_write(cs_restart_t  *restart)
       snprintf(s, 64, "time_moments:wa:%02d:val", i);
       cs_restart_write_section(restart,
                                s,
-                               mwa->location_id,
+                               _restart_location_id(restart,
+                                                    mwa->location_id,
+                                                    r_loc_id),
                                1,
                                CS_TYPE_cs_real_t,
                                mwa->val);
@@ -2864,6 +3276,16 @@ cs_time_moment_restart_write(cs_restart_t  *restart)
   BFT_FREE(location_id);
   BFT_FREE(m_type);
 
+  /* Moment values may use lossy compression */
+
+  cs_restart_codec_t codec_prev = CS_RESTART_CODEC_NONE;
+  double tolerance_prev = 0.;
+
+  cs_restart_get_codec(restart, &codec_prev, &tolerance_prev);
+
+  if (_restart_tolerance > 0.)
+    cs_restart_set_codec(restart, CS_RESTART_CODEC_LOSSY, _restart_tolerance);
+
   for (int i = 0; i < _n_moments; i++) {
     int j = active_moment_id[i];
     if (j > -1) {
@@ -2872,7 +3294,9 @@ cs_time_moment_restart_write(cs_restart_t  *restart)
         const cs_field_t *f = cs_field_by_id(mt->f_id);
         cs_restart_write_section(restart,
                                  f->name,
-                                 f->location_id,
+                                 _restart_location_id(restart,
+                                                      f->location_id,
+                                                      r_loc_id),
                                  f->dim,
                                  CS_TYPE_cs_real_t,
                                  f->val);
@@ -2880,13 +3304,18 @@ cs_time_moment_restart_write(cs_restart_t  *restart)
       else
         cs_restart_write_section(restart,
                                  mt->name,
-                                 mt->location_id,
+                                 _restart_location_id(restart,
+                                                      mt->location_id,
+                                                      r_loc_id),
                                  mt->dim,
                                  CS_TYPE_cs_real_t,
                                  mt->val);
     }
   }
 
+  cs_restart_set_codec(restart, codec_prev, tolerance_prev);
+
+  BFT_FREE(r_loc_id);
   BFT_FREE(active_moment_id);
   BFT_FREE(active_wa_id);
 }
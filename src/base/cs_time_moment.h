@@ -175,6 +175,42 @@ cs_time_moment_define_by_field_ids(const char                *name,
                                    cs_time_moment_restart_t   restart_mode,
                                    const char                *restart_name);
 
+/*----------------------------------------------------------------------------
+ * Define a moment of a product of existing field components, restricted
+ * to a subset of the fields' location.
+ *
+ * The moment and its accumulators are only defined on the elements of
+ * the given mesh location, which must be a subset of the fields' location
+ * (such as a selection of cells); checkpoint data uses the same layout.
+ *
+ * parameters:
+ *   name         <-- name of associated moment
+ *   location_id  <-- id of associated mesh location subset
+ *   n_fields     <-- number of associated fields
+ *   field_id     <-- ids of associated fields
+ *   component_id <-- ids of matching field components (-1 for all)
+ *   type         <-- moment type
+ *   nt_start     <-- starting time step (or -1 to use t_start)
+ *   t_start      <-- starting time
+ *   restart_mode <-- behavior in case of restart (reset, auto, or strict)
+ *   restart_name <-- if not NULL, previous name in case of restart
+ *
+ * returns:
+ *   id of new moment in case of success, -1 in case of error.
+ *----------------------------------------------------------------------------*/
+
+int
+cs_time_moment_define_subset_by_fields(const char               *name,
+                                       int                       location_id,
+                                       int                       n_fields,
+                                       const int                 field_id[],
+                                       const int                 component_id[],
+                                       cs_time_moment_type_t     type,
+                                       int                       nt_start,
+                                       double                    t_start,
+                                       cs_time_moment_restart_t  restart_mode,
+                                       const char               *restart_name);
+
 /*----------------------------------------------------------------------------
  * Define a moment whose data values will be computed using a
  * specified function.
@@ -339,6 +375,16 @@ cs_time_moment_log_iteration(void);
 void
 cs_time_moment_restart_use_main(int  use_main);
 
+/*----------------------------------------------------------------------------
+ * Set error bound for lossy compression of moment values in checkpoint files.
+ *
+ * parameters:
+ *   tolerance <-- relative error bound, or 0 for no lossy compression
+ *----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_restart_set_tolerance(double  tolerance);
+
 /*----------------------------------------------------------------------------
  * Read restart moment data
  *
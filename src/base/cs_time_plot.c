@@ -576,8 +576,12 @@ _time_plot_register(cs_time_plot_t  *p)
   p->prev = _plots_tail;
   p->next = NULL;
 
-  if (_plots_head == NULL)
+  /* Ensure buffered values are written in case of error */
+
+  if (_plots_head == NULL) {
+    cs_base_error_flush_set(cs_time_plot_flush_all);
     _plots_head = p;
+  }
   else if (_plots_head->next == NULL)
     _plots_head->next = p;
 
@@ -691,11 +695,19 @@ _plot_file_check_or_write(cs_time_plot_t  *p)
 {
   size_t n_written;
 
-  /* Return immediately if we are buffering and not writing now */
+  /* Return immediately if we are buffering and not writing now
+     (buffered values are written every n_buffer_steps time steps,
+     or after the flush time interval has elapsed) */
 
   if (   p->buffer_steps[0] > 0
       && p->buffer_steps[1] < p->buffer_steps[0]) {
     p->buffer_steps[1] += 1;
+    if (p->flush_times[0] <= 0)
+      return;
+    double cur_time = cs_timer_wtime();
+    if (p->flush_times[1] < 0)
+      p->flush_times[1] = cur_time;
+    if ((cur_time - p->flush_times[1]) <= p->flush_times[0])
       return;
   }
 
@@ -724,12 +736,13 @@ _plot_file_check_or_write(cs_time_plot_t  *p)
 
   if (p->buffer_steps[0] > 0) {
 
-    assert(p->buffer_steps[1] >= p->buffer_steps[0]);
     if (fclose(p->f) != 0)
       bft_error(__FILE__, __LINE__, errno,
                   _("Error closing file: \"%s\""), p->file_name);
     p->f = NULL;
     p->buffer_steps[1] = 0;
+    if (p->flush_times[0] > 0)
+      p->flush_times[1] = cs_timer_wtime();
 
   }
   else {
@@ -1260,13 +1273,29 @@ cs_time_plot_flush(cs_time_plot_t  *p)
 void
 cs_time_plot_flush_all(void)
 {
+  /* Avoid recursion if an error occurs while flushing
+     (this function is also called by the error handler) */
+
+  static bool flushing = false;
+
+  if (flushing)
+    return;
+
+  flushing = true;
+
   for (cs_time_plot_t *p = _plots_head; p != NULL; p = p->next)
     cs_time_plot_flush(p);
+
+  flushing = false;
 }
 
 /*----------------------------------------------------------------------------
  * Set time plot file writer flush behavior defaults.
  *
+ * When both are set, buffered values are written every n_buffer_steps
+ * time steps or flush_wtime seconds, whichever comes first. Buffered
+ * values are also written at checkpoints and in case of error.
+ *
  * parameters:
  *   flush_wtime     <-- elapsed time interval between file flushes;
  *                       if < 0, no forced flush
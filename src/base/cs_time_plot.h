@@ -295,6 +295,10 @@ cs_time_plot_flush_all(void);
 /*----------------------------------------------------------------------------
  * Set time plot file writer flush behavior defaults.
  *
+ * When both are set, buffered values are written every n_buffer_steps
+ * time steps or flush_wtime seconds, whichever comes first. Buffered
+ * values are also written at checkpoints and in case of error.
+ *
  * parameters:
  *   flush_wtime     <-- elapsed time interval between file flushes;
  *                       if < 0, no forced flush
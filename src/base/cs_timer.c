@@ -201,6 +201,11 @@ static clock_t _cs_timer_clock_start;
 
 static cs_timer_t  _cs_timer_start;
 
+/* Timed event hooks */
+
+static cs_timer_event_hook_t  *_cs_timer_mpi_wait_hook = NULL;
+static cs_timer_event_hook_t  *_cs_timer_trace_hook = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -706,6 +711,65 @@ cs_timer_cpu_time_method(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define hooks called for timed events.
+ *
+ * This allows low-level modules to report communication wait times or
+ * trace events without depending on timer statistics handling.
+ *
+ * \param[in]  mpi_wait  function called for MPI wait ranges, or NULL
+ * \param[in]  trace     function called for traced events, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_set_event_hooks(cs_timer_event_hook_t  *mpi_wait,
+                         cs_timer_event_hook_t  *trace)
+{
+  _cs_timer_mpi_wait_hook = mpi_wait;
+  _cs_timer_trace_hook = trace;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Report a time range spent waiting on MPI communication, if an
+ *        associated hook is defined.
+ *
+ * \param[in]  name  name of associated operation, or NULL
+ * \param[in]  t0    oldest timer value
+ * \param[in]  t1    most recent timer value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_mpi_wait_event(const char        *name,
+                        const cs_timer_t  *t0,
+                        const cs_timer_t  *t1)
+{
+  if (_cs_timer_mpi_wait_hook != NULL)
+    _cs_timer_mpi_wait_hook(name, t0, t1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Report a timed event, if an associated hook is defined.
+ *
+ * \param[in]  name  event name
+ * \param[in]  t0    oldest timer value
+ * \param[in]  t1    most recent timer value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_trace_event(const char        *name,
+                     const cs_timer_t  *t0,
+                     const cs_timer_t  *t1)
+{
+  if (_cs_timer_trace_hook != NULL)
+    _cs_timer_trace_hook(name, t0, t1);
+}
+
 /*-----------------------------------------------------------------------------*/
 
 END_C_DECLS
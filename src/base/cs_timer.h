@@ -61,6 +61,14 @@ typedef struct {
 
 } cs_timer_counter_t;
 
+/* Function pointer type for timed event hooks (such as MPI wait
+   accounting or tracing, provided by higher level modules) */
+
+typedef void
+(cs_timer_event_hook_t) (const char        *name,
+                         const cs_timer_t  *t0,
+                         const cs_timer_t  *t1);
+
 /*============================================================================
  * Public macros
  *============================================================================*/
@@ -206,6 +214,50 @@ cs_timer_wtime_method(void);
 const char *
 cs_timer_cpu_time_method(void);
 
+/*----------------------------------------------------------------------------
+ * Define hooks called for timed events.
+ *
+ * This allows low-level modules to report communication wait times or
+ * trace events without depending on timer statistics handling.
+ *
+ * parameters:
+ *   mpi_wait <-- function called for MPI wait ranges, or NULL
+ *   trace    <-- function called for traced events, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_timer_set_event_hooks(cs_timer_event_hook_t  *mpi_wait,
+                         cs_timer_event_hook_t  *trace);
+
+/*----------------------------------------------------------------------------
+ * Report a time range spent waiting on MPI communication, if an
+ * associated hook is defined.
+ *
+ * parameters:
+ *   name <-- name of associated operation, or NULL
+ *   t0   <-- oldest timer value
+ *   t1   <-- most recent timer value
+ *----------------------------------------------------------------------------*/
+
+void
+cs_timer_mpi_wait_event(const char        *name,
+                        const cs_timer_t  *t0,
+                        const cs_timer_t  *t1);
+
+/*----------------------------------------------------------------------------
+ * Report a timed event, if an associated hook is defined.
+ *
+ * parameters:
+ *   name <-- event name
+ *   t0   <-- oldest timer value
+ *   t1   <-- most recent timer value
+ *----------------------------------------------------------------------------*/
+
+void
+cs_timer_trace_event(const char        *name,
+                     const cs_timer_t  *t0,
+                     const cs_timer_t  *t1);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
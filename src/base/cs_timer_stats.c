@@ -34,6 +34,12 @@
 #endif
 #endif
 
+#if defined(__linux__) && defined(HAVE_LINUX_PERF_EVENT_H)
+#if !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE /* for syscall() */
+#endif
+#endif
+
 /*-----------------------------------------------------------------------------*/
 
 #include "cs_defs.h"
@@ -42,17 +48,29 @@
  * Standard C library headers
  *----------------------------------------------------------------------------*/
 
+#include <errno.h>
 #include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
+#if defined(__linux__) && defined(HAVE_LINUX_PERF_EVENT_H)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
 
 #include "bft_error.h"
 #include "bft_mem.h"
+#include "bft_printf.h"
 
+#include "cs_log.h"
 #include "cs_map.h"
 #include "cs_timer.h"
 #include "cs_time_plot.h"
@@ -84,6 +102,31 @@ BEGIN_C_DECLS
   Timer statistics also allow for incrementing results from base timers
   (in addition to starting/stopping their own timers), so they may be used
   to assist logging and plotting of other timers.
+
+  Time spent waiting on MPI communication (halo exchange completion,
+  global reductions) may be attributed to the active statistics using
+  \ref cs_timer_stats_add_mpi_wait. In parallel, the distribution of
+  wall-clock, MPI wait and compute times across ranks (minimum, mean and
+  maximum) is written to a "timer_stats_ranks.csv" file, alongside the
+  "timer_stats" time plot, for totals at the end of the computation and
+  optionally at each plot output (see \ref cs_timer_stats_set_rank_output).
+
+  On Linux systems, hardware performance counters may also be associated
+  with timer statistics, using the kernel's perf_event interface (see
+  \ref cs_timer_stats_set_hw_counters, or the CS_TIMER_STATS_HW_COUNTERS
+  environment variable). Counter values are then accumulated for each
+  statistic while it is active, summed over ranks, and written at each
+  plot output to additional "timer_stats_<counter>" time plots, with
+  totals logged at the end of the computation.
+
+  A tracing mode may also be activated (see \ref cs_timer_stats_set_trace,
+  or the CS_TIMER_STATS_TRACE environment variable), in which each
+  activation range of a statistic, each MPI wait, and other timed events
+  (see \ref cs_timer_stats_trace_event) are recorded with timestamps
+  in a per-rank ring buffer. Buffers are gathered at the end of the
+  computation and written to a "timer_stats_trace.json" file using the
+  Chrome trace event format, with one process per rank and one track per
+  statistics tree (as well as one track per thread for other events).
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -92,6 +135,23 @@ BEGIN_C_DECLS
  * Local type definitions
  *-----------------------------------------------------------------------------*/
 
+/* Maximum number of hardware counters */
+
+#define _N_HW_COUNTERS_MAX 8
+
+/* Trace event */
+
+typedef struct {
+
+  uint64_t             t_start;         /* Start time (in nanoseconds since
+                                           tracing start) */
+  uint64_t             t_dur;           /* Duration (in nanoseconds) */
+  int                  id;              /* Statistic id if >= 0, or
+                                           -1 - event name id */
+  int                  thread_id;       /* Associated thread id */
+
+} _trace_event_t;
+
 /* Field key definitions */
 
 typedef struct {
@@ -108,6 +168,17 @@ typedef struct {
   cs_timer_counter_t   t_cur;           /* Counter since last output */
   cs_timer_counter_t   t_tot;           /* Total time counter */
 
+  cs_timer_counter_t   t_wait_cur;      /* MPI wait counter since last
+                                           output */
+  cs_timer_counter_t   t_wait_tot;      /* Total MPI wait counter */
+
+  uint64_t             hw_start[_N_HW_COUNTERS_MAX]; /* Hardware counter
+                                                        values at start */
+  uint64_t             hw_cur[_N_HW_COUNTERS_MAX];   /* Hardware counts
+                                                        since last output */
+  uint64_t             hw_tot[_N_HW_COUNTERS_MAX];   /* Total hardware
+                                                        counts */
+
 } cs_timer_stats_t;
 
 /*-------------------------------------------------------------------------------
@@ -125,12 +196,30 @@ static int                    _plot_buffer_steps = -1;
 static double                 _plot_flush_wtime = 3600;
 static cs_time_plot_format_t  _plot_format = CS_TIME_PLOT_CSV;
 
+static bool                   _rank_output_per_step = false;
+
 /* Timer status */
 
 static int  _time_id = -1, _start_time_id = -1;
 static int  _n_roots = 0;
 static int  *_active_id = NULL;
 static cs_time_plot_t  *_time_plot = NULL;
+static FILE  *_rank_stats_file = NULL;
+
+/* Hardware counters */
+
+static int  _n_hw_counters = 0;
+static int  _hw_fd[_N_HW_COUNTERS_MAX];
+static char  *_hw_name[_N_HW_COUNTERS_MAX];
+static cs_time_plot_t  *_hw_plot[_N_HW_COUNTERS_MAX];
+
+/* Tracing */
+
+static size_t  _trace_n_max = 0;          /* Ring buffer size */
+static uint64_t  _trace_count = 0;        /* Number of events recorded */
+static _trace_event_t  *_trace_events = NULL;
+static cs_timer_t  _trace_t0;             /* Tracing start time */
+static cs_map_name_to_id_t  *_trace_names = NULL;
 
 /* Field definitions */
 
@@ -211,6 +300,595 @@ _common_parent_id(int  id_0,
   return p0;
 }
 
+/*----------------------------------------------------------------------------
+ * Open a hardware counter for the calling process.
+ *
+ * Counters are inherited by threads created afterwards, and only count
+ * user-space events.
+ *
+ * Known names are "cycles", "instructions", "cache_references",
+ * "cache_misses" (last level cache misses), "branch_misses",
+ * "task_clock" and "page_faults" (software counters), and "r<hex>"
+ * for raw (processor-specific) event codes.
+ *
+ * parameters:
+ *   name <-- counter name
+ *
+ * returns:
+ *   file descriptor of opened counter, or -1 in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_hw_counter_open(const char  *name)
+{
+  int fd = -1;
+
+#if defined(__linux__) && defined(HAVE_LINUX_PERF_EVENT_H)
+
+  const char *hw_names[] = {"cycles",
+                            "instructions",
+                            "cache_references",
+                            "cache_misses",
+                            "branch_misses",
+                            "task_clock",
+                            "page_faults"};
+  const uint32_t hw_type[] = {PERF_TYPE_HARDWARE,
+                              PERF_TYPE_HARDWARE,
+                              PERF_TYPE_HARDWARE,
+                              PERF_TYPE_HARDWARE,
+                              PERF_TYPE_HARDWARE,
+                              PERF_TYPE_SOFTWARE,
+                              PERF_TYPE_SOFTWARE};
+  const uint64_t hw_config[] = {PERF_COUNT_HW_CPU_CYCLES,
+                                PERF_COUNT_HW_INSTRUCTIONS,
+                                PERF_COUNT_HW_CACHE_REFERENCES,
+                                PERF_COUNT_HW_CACHE_MISSES,
+                                PERF_COUNT_HW_BRANCH_MISSES,
+                                PERF_COUNT_SW_TASK_CLOCK,
+                                PERF_COUNT_SW_PAGE_FAULTS};
+
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_MAX;
+
+  for (int i = 0; i < 7; i++) {
+    if (strcmp(name, hw_names[i]) == 0) {
+      attr.type = hw_type[i];
+      attr.config = hw_config[i];
+    }
+  }
+
+  if (attr.type == PERF_TYPE_MAX && name[0] == 'r' && name[1] != '\0') {
+    char *end_ptr = NULL;
+    attr.config = strtoull(name + 1, &end_ptr, 16);
+    if (end_ptr != NULL && *end_ptr == '\0')
+      attr.type = PERF_TYPE_RAW;
+  }
+
+  if (attr.type == PERF_TYPE_MAX) {
+    if (cs_glob_rank_id < 1)
+      bft_printf(_("\nWarning: unknown hardware counter \"%s\" ignored.\n"),
+                 name);
+    return fd;
+  }
+
+  attr.read_format =   PERF_FORMAT_TOTAL_TIME_ENABLED
+                     | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+
+  fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+
+  if (fd < 0 && cs_glob_rank_id < 1)
+    bft_printf(_("\nWarning: hardware counter \"%s\" not available:\n"
+                 "  %s\n"), name, strerror(errno));
+
+#else
+
+  if (cs_glob_rank_id < 1)
+    bft_printf(_("\nWarning: hardware counter \"%s\" ignored,\n"
+                 "  as hardware counters are not available in this build.\n"),
+               name);
+
+#endif
+
+  return fd;
+}
+
+/*----------------------------------------------------------------------------
+ * Read current values of active hardware counters.
+ *
+ * Values are scaled in case of counter multiplexing.
+ *
+ * parameters:
+ *   vals --> counter values
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_hw_counters_read(uint64_t  vals[])
+{
+#if defined(__linux__) && defined(HAVE_LINUX_PERF_EVENT_H)
+
+  for (int i = 0; i < _n_hw_counters; i++) {
+    uint64_t buf[3] = {0, 0, 0};
+    vals[i] = 0;
+    if (read(_hw_fd[i], buf, sizeof(buf)) == sizeof(buf)) {
+      if (buf[2] > 0 && buf[2] < buf[1])
+        vals[i] = (uint64_t)(  (double)buf[0]
+                             * ((double)buf[1] / (double)buf[2]));
+      else
+        vals[i] = buf[0];
+    }
+  }
+
+#else
+
+  CS_UNUSED(vals);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Add difference between hardware counter values to counts.
+ *
+ * parameters:
+ *   count <-> counts to increment
+ *   v0    <-- oldest counter values
+ *   v1    <-- most recent counter values
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_hw_counters_add_diff(uint64_t        count[],
+                      const uint64_t  v0[],
+                      const uint64_t  v1[])
+{
+  for (int i = 0; i < _n_hw_counters; i++) {
+    if (v1[i] > v0[i])
+      count[i] += v1[i] - v0[i];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Close hardware counters and associated time plots.
+ *----------------------------------------------------------------------------*/
+
+static void
+_hw_counters_finalize(void)
+{
+  for (int i = 0; i < _n_hw_counters; i++) {
+#if defined(__linux__) && defined(HAVE_LINUX_PERF_EVENT_H)
+    close(_hw_fd[i]);
+#endif
+    _hw_fd[i] = -1;
+    BFT_FREE(_hw_name[i]);
+    if (_hw_plot[i] != NULL)
+      cs_time_plot_finalize(&(_hw_plot[i]));
+  }
+
+  _n_hw_counters = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Sum hardware counts of all statistics over ranks.
+ *
+ * This function is collective; the result is only significant on rank 0.
+ *
+ * parameters:
+ *   total  <-- if true, use total counts, otherwise current ones
+ *   g_vals --> summed counts, interleaved (size: _n_stats*_n_hw_counters)
+ *----------------------------------------------------------------------------*/
+
+static void
+_hw_counters_sum(bool    total,
+                 double  g_vals[])
+{
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    const uint64_t *c = (total) ? s->hw_tot : s->hw_cur;
+    for (int i = 0; i < _n_hw_counters; i++)
+      g_vals[stats_id*_n_hw_counters + i] = c[i];
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    const int n_vals = _n_stats*_n_hw_counters;
+    double *l_vals;
+    BFT_MALLOC(l_vals, n_vals, double);
+    memcpy(l_vals, g_vals, n_vals*sizeof(double));
+    MPI_Reduce(l_vals, g_vals, n_vals, MPI_DOUBLE, MPI_SUM, 0,
+               cs_glob_mpi_comm);
+    BFT_FREE(l_vals);
+  }
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Output hardware counter time plots.
+ *
+ * This function is collective; only rank 0 writes to the plots.
+ *----------------------------------------------------------------------------*/
+
+static void
+_output_hw_plots(void)
+{
+  double *g_vals;
+  BFT_MALLOC(g_vals, _n_stats*_n_hw_counters, double);
+
+  _hw_counters_sum(false, g_vals);
+
+  cs_real_t *vals;
+  BFT_MALLOC(vals, _n_stats, cs_real_t);
+
+  for (int i = 0; i < _n_hw_counters; i++) {
+
+    if (_hw_plot[i] == NULL)
+      continue;
+
+    int stats_count = 0;
+
+    for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+      cs_timer_stats_t  *s = _stats + stats_id;
+      if (s->plot) {
+        vals[stats_count] = g_vals[stats_id*_n_hw_counters + i];
+        stats_count++;
+      }
+    }
+
+    cs_time_plot_vals_write(_hw_plot[i],
+                            _time_id,
+                            -1.,
+                            stats_count,
+                            vals);
+
+  }
+
+  BFT_FREE(vals);
+  BFT_FREE(g_vals);
+}
+
+/*----------------------------------------------------------------------------
+ * Log total hardware counts for all statistics.
+ *
+ * This function is collective; only rank 0 writes to the log.
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_hw_counters(void)
+{
+  double *g_vals;
+  BFT_MALLOC(g_vals, _n_stats*_n_hw_counters, double);
+
+  _hw_counters_sum(true, g_vals);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nHardware counters for timer statistics "
+                  "(sum over ranks):\n\n"));
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "  %-32s", "");
+  for (int i = 0; i < _n_hw_counters; i++)
+    cs_log_printf(CS_LOG_PERFORMANCE, " %16s", _hw_name[i]);
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    cs_log_printf(CS_LOG_PERFORMANCE, "  %-32s", s->label);
+    for (int i = 0; i < _n_hw_counters; i++)
+      cs_log_printf(CS_LOG_PERFORMANCE, " %16.9e",
+                    g_vals[stats_id*_n_hw_counters + i]);
+    cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  cs_log_separator(CS_LOG_PERFORMANCE);
+
+  BFT_FREE(g_vals);
+}
+
+/*----------------------------------------------------------------------------
+ * Record a trace event.
+ *
+ * parameters:
+ *   id <-- statistic id if >= 0, or -1 - event name id
+ *   t0 <-- oldest timer value
+ *   t1 <-- most recent timer value
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_trace_add(int                id,
+           const cs_timer_t  *t0,
+           const cs_timer_t  *t1)
+{
+  long long ns_0 =   (t0->wall_sec - _trace_t0.wall_sec)*1000000000
+                   + (t0->wall_nsec - _trace_t0.wall_nsec);
+  long long ns_1 =   (t1->wall_sec - _trace_t0.wall_sec)*1000000000
+                   + (t1->wall_nsec - _trace_t0.wall_nsec);
+
+  if (ns_0 < 0)
+    ns_0 = 0;
+  if (ns_1 < ns_0)
+    ns_1 = ns_0;
+
+  int thread_id = 0;
+#if defined(HAVE_OPENMP)
+  thread_id = omp_get_thread_num();
+#endif
+
+  _trace_event_t *e = _trace_events + (_trace_count % _trace_n_max);
+
+  e->t_start = ns_0;
+  e->t_dur = ns_1 - ns_0;
+  e->id = id;
+  e->thread_id = thread_id;
+
+  _trace_count += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Record a trace event for an active range of a statistic.
+ *
+ * parameters:
+ *   id <-- statistic id
+ *   t0 <-- oldest timer value
+ *   t1 <-- most recent timer value
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_trace_stat(int                id,
+            const cs_timer_t  *t0,
+            const cs_timer_t  *t1)
+{
+  if (_trace_n_max > 0)
+    _trace_add(id, t0, t1);
+}
+
+/*----------------------------------------------------------------------------
+ * Record a named trace event.
+ *
+ * parameters:
+ *   name <-- event name
+ *   t0   <-- oldest timer value
+ *   t1   <-- most recent timer value
+ *----------------------------------------------------------------------------*/
+
+static void
+_trace_named(const char        *name,
+             const cs_timer_t  *t0,
+             const cs_timer_t  *t1)
+{
+#if defined(HAVE_OPENMP)
+  #pragma omp critical (_cs_timer_stats_trace)
+#endif
+  {
+    int name_id = cs_map_name_to_id(_trace_names, name);
+    _trace_add(-1 - name_id, t0, t1);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Write trace events of a given rank in Chrome trace event format.
+ *
+ * parameters:
+ *   f        <-- output file
+ *   rank_id  <-- associated rank id
+ *   n_events <-- number of events
+ *   events   <-- events, oldest first
+ *   n_names  <-- number of event names
+ *   names    <-- event names
+ *----------------------------------------------------------------------------*/
+
+static void
+_trace_write_events(FILE                  *f,
+                    int                    rank_id,
+                    size_t                 n_events,
+                    const _trace_event_t   events[],
+                    int                    n_names,
+                    const char            *names[])
+{
+  /* Track names: one per statistics tree, and one per thread for
+     other events */
+
+  int n_threads = 0;
+  for (size_t i = 0; i < n_events; i++) {
+    if (events[i].id < 0 && events[i].thread_id >= n_threads)
+      n_threads = events[i].thread_id + 1;
+  }
+
+  const char **root_name;
+  BFT_MALLOC(root_name, _n_roots, const char *);
+
+  for (int i = 0; i < _n_stats; i++) {
+    cs_timer_stats_t  *s = _stats + i;
+    if (s->parent_id < 0) {
+      root_name[s->root_id] = cs_map_name_to_id_reverse(_name_map, i);
+      fprintf(f,
+              ",\n{\"name\": \"thread_name\", \"ph\": \"M\", "
+              "\"pid\": %d, \"tid\": %d, \"args\": {\"name\": \"%s\"}}",
+              rank_id, s->root_id, root_name[s->root_id]);
+    }
+  }
+  for (int i = 0; i < n_threads; i++)
+    fprintf(f,
+            ",\n{\"name\": \"thread_name\", \"ph\": \"M\", "
+            "\"pid\": %d, \"tid\": %d, "
+            "\"args\": {\"name\": \"events (thread %d)\"}}",
+            rank_id, _n_roots + i, i);
+
+  /* Events */
+
+  for (size_t i = 0; i < n_events; i++) {
+
+    const _trace_event_t  *e = events + i;
+
+    const char *name = NULL;
+    const char *cat = "event";
+    int tid = _n_roots + e->thread_id;
+
+    if (e->id >= 0) {
+      cs_timer_stats_t  *s = _stats + e->id;
+      name = s->label;
+      cat = root_name[s->root_id];
+      tid = s->root_id;
+    }
+    else {
+      int name_id = -1 - e->id;
+      if (name_id < n_names)
+        name = names[name_id];
+    }
+
+    if (name == NULL)
+      continue;
+
+    fprintf(f,
+            ",\n{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", "
+            "\"ts\": %.3f, \"dur\": %.3f, \"pid\": %d, \"tid\": %d}",
+            name, cat, e->t_start*1e-3, e->t_dur*1e-3, rank_id, tid);
+
+  }
+
+  BFT_FREE(root_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Gather trace events from all ranks and write them to file.
+ *
+ * This function is collective; only rank 0 writes to the file.
+ *----------------------------------------------------------------------------*/
+
+static void
+_trace_write(void)
+{
+  /* Local events, oldest first */
+
+  size_t n_events = CS_MIN(_trace_count, (uint64_t)_trace_n_max);
+  size_t e_start = (_trace_count > _trace_n_max) ?
+    _trace_count % _trace_n_max : 0;
+
+  _trace_event_t *events;
+  BFT_MALLOC(events, n_events, _trace_event_t);
+  for (size_t i = 0; i < n_events; i++)
+    events[i] = _trace_events[(e_start + i) % _trace_n_max];
+
+  int n_names = cs_map_name_to_id_size(_trace_names);
+  const char **names;
+  BFT_MALLOC(names, n_names, const char *);
+  for (int i = 0; i < n_names; i++)
+    names[i] = cs_map_name_to_id_reverse(_trace_names, i);
+
+  FILE *f = NULL;
+
+  if (cs_glob_rank_id < 1) {
+
+    const char file_name[] = "timer_stats_trace.json";
+
+    f = fopen(file_name, "w");
+    if (f == NULL)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error opening file: \"%s\""), file_name);
+
+    fprintf(f, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n"
+            "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 0, "
+            "\"args\": {\"name\": \"rank 0\"}}");
+
+    _trace_write_events(f, 0, n_events, events, n_names, names);
+
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    /* Events and names of other ranks are sent to rank 0 in turn */
+
+    if (cs_glob_rank_id > 0) {
+
+      unsigned long long n_vals[3] = {n_events, n_names, 0};
+      for (int i = 0; i < n_names; i++)
+        n_vals[2] += strlen(names[i]) + 1;
+
+      char *name_buf;
+      BFT_MALLOC(name_buf, n_vals[2], char);
+      size_t k = 0;
+      for (int i = 0; i < n_names; i++) {
+        strcpy(name_buf + k, names[i]);
+        k += strlen(names[i]) + 1;
+      }
+
+      int dummy = 0;
+      MPI_Recv(&dummy, 1, MPI_INT, 0, 0, cs_glob_mpi_comm, MPI_STATUS_IGNORE);
+
+      MPI_Send(n_vals, 3, MPI_UNSIGNED_LONG_LONG, 0, 0, cs_glob_mpi_comm);
+      MPI_Send(name_buf, n_vals[2], MPI_CHAR, 0, 0, cs_glob_mpi_comm);
+      MPI_Send(events, n_events*sizeof(_trace_event_t), MPI_BYTE, 0, 0,
+               cs_glob_mpi_comm);
+
+      BFT_FREE(name_buf);
+
+    }
+    else {
+
+      for (int rank_id = 1; rank_id < cs_glob_n_ranks; rank_id++) {
+
+        int dummy = 0;
+        unsigned long long n_vals[3];
+
+        MPI_Send(&dummy, 1, MPI_INT, rank_id, 0, cs_glob_mpi_comm);
+        MPI_Recv(n_vals, 3, MPI_UNSIGNED_LONG_LONG, rank_id, 0,
+                 cs_glob_mpi_comm, MPI_STATUS_IGNORE);
+
+        _trace_event_t *r_events;
+        char *name_buf;
+        const char **r_names;
+        BFT_MALLOC(r_events, n_vals[0], _trace_event_t);
+        BFT_MALLOC(name_buf, n_vals[2], char);
+        BFT_MALLOC(r_names, n_vals[1], const char *);
+
+        MPI_Recv(name_buf, n_vals[2], MPI_CHAR, rank_id, 0,
+                 cs_glob_mpi_comm, MPI_STATUS_IGNORE);
+        MPI_Recv(r_events, n_vals[0]*sizeof(_trace_event_t), MPI_BYTE,
+                 rank_id, 0, cs_glob_mpi_comm, MPI_STATUS_IGNORE);
+
+        size_t k = 0;
+        for (unsigned long long i = 0; i < n_vals[1]; i++) {
+          r_names[i] = name_buf + k;
+          k += strlen(name_buf + k) + 1;
+        }
+
+        fprintf(f,
+                ",\n{\"name\": \"process_name\", \"ph\": \"M\", "
+                "\"pid\": %d, \"args\": {\"name\": \"rank %d\"}}",
+                rank_id, rank_id);
+
+        _trace_write_events(f, rank_id, n_vals[0], r_events,
+                            n_vals[1], r_names);
+
+        BFT_FREE(r_names);
+        BFT_FREE(name_buf);
+        BFT_FREE(r_events);
+
+      }
+
+    }
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (f != NULL) {
+    fprintf(f, "\n]}\n");
+    if (fclose(f) != 0)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error closing file: \"%s\""), "timer_stats_trace.json");
+  }
+
+  BFT_FREE(names);
+  BFT_FREE(events);
+}
+
 /*----------------------------------------------------------------------------
  * Create time plots
  *----------------------------------------------------------------------------*/
@@ -243,6 +921,26 @@ _build_time_plot(void)
                                          NULL,
                                          stats_labels);
 
+  /* Hardware counter plots share the same layout */
+
+  if (stats_count > 0) {
+    for (int i = 0; i < _n_hw_counters; i++) {
+      char plot_name[64];
+      snprintf(plot_name, 63, "timer_stats_%s", _hw_name[i]);
+      plot_name[63] = '\0';
+      _hw_plot[i] = cs_time_plot_init_probe(plot_name,
+                                            "",
+                                            _plot_format,
+                                            true,
+                                            _plot_flush_wtime,
+                                            _plot_buffer_steps,
+                                            stats_count,
+                                            NULL,
+                                            NULL,
+                                            stats_labels);
+    }
+  }
+
   BFT_FREE(stats_labels);
 }
 
@@ -277,6 +975,129 @@ _output_time_plot(void)
   BFT_FREE(vals);
 }
 
+/*----------------------------------------------------------------------------
+ * Output distribution of timer statistics across ranks.
+ *
+ * For each statistic, the minimum, mean and maximum over ranks of the
+ * wall-clock time, of the MPI wait time, and of their difference
+ * (compute time) are written, with the ratio of maximum to mean
+ * wall-clock time as an imbalance indicator.
+ *
+ * This function is collective; only rank 0 writes to the file.
+ *
+ * parameters:
+ *   time_id <-- associated time id, or -1 for totals
+ *   total   <-- if true, use total counters, otherwise current ones
+ *----------------------------------------------------------------------------*/
+
+static void
+_output_rank_stats(int   time_id,
+                   bool  total)
+{
+  const int n_vals = _n_stats*3;
+
+  double *l_vals, *g_vals;
+  BFT_MALLOC(l_vals, n_vals*2, double);
+  BFT_MALLOC(g_vals, n_vals*3, double);
+
+  /* Local wall-clock, wait and compute times; negated values are
+     appended so that both minima and maxima use the same reduction */
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+
+    cs_timer_stats_t  *s = _stats + stats_id;
+
+    const cs_timer_counter_t *c = (total) ? &(s->t_tot) : &(s->t_cur);
+    const cs_timer_counter_t *w
+      = (total) ? &(s->t_wait_tot) : &(s->t_wait_cur);
+
+    double t_wall = c->wall_nsec*1e-9;
+    double t_wait = w->wall_nsec*1e-9;
+    double t_comp = CS_MAX(t_wall - t_wait, 0.);
+
+    l_vals[stats_id*3]     = t_wall;
+    l_vals[stats_id*3 + 1] = t_wait;
+    l_vals[stats_id*3 + 2] = t_comp;
+
+  }
+
+  for (int i = 0; i < n_vals; i++)
+    l_vals[n_vals + i] = -l_vals[i];
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    MPI_Reduce(l_vals, g_vals, n_vals*2, MPI_DOUBLE, MPI_MAX, 0,
+               cs_glob_mpi_comm);
+    MPI_Reduce(l_vals, g_vals + n_vals*2, n_vals, MPI_DOUBLE, MPI_SUM, 0,
+               cs_glob_mpi_comm);
+  }
+
+#endif
+
+  if (cs_glob_n_ranks < 2) {
+    memcpy(g_vals, l_vals, n_vals*2*sizeof(double));
+    memcpy(g_vals + n_vals*2, l_vals, n_vals*sizeof(double));
+  }
+
+  BFT_FREE(l_vals);
+
+  /* Write values from rank 0 */
+
+  if (cs_glob_rank_id < 1) {
+
+    const char file_name[] = "timer_stats_ranks.csv";
+
+    if (_rank_stats_file == NULL) {
+      _rank_stats_file = fopen(file_name, "w");
+      if (_rank_stats_file == NULL)
+        bft_error(__FILE__, __LINE__, errno,
+                  _("Error opening file: \"%s\""), file_name);
+      fprintf(_rank_stats_file,
+              "iteration, id, parent_id, name, label, "
+              "wall_min, wall_mean, wall_max, "
+              "wait_min, wait_mean, wait_max, "
+              "compute_min, compute_mean, compute_max, imbalance\n");
+    }
+
+    FILE *f = _rank_stats_file;
+
+    const double *v_max = g_vals;
+    const double *v_min = g_vals + n_vals;
+    const double *v_sum = g_vals + n_vals*2;
+    const double n_ranks = cs_glob_n_ranks;
+
+    for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+
+      cs_timer_stats_t  *s = _stats + stats_id;
+
+      fprintf(f, "%8d, %d, %d, %s, \"%s\"",
+              time_id, stats_id, s->parent_id,
+              cs_map_name_to_id_reverse(_name_map, stats_id),
+              s->label);
+
+      for (int j = 0; j < 3; j++) {
+        const int k = stats_id*3 + j;
+        fprintf(f, ", %14.7e, %14.7e, %14.7e",
+                -v_min[k], v_sum[k]/n_ranks, v_max[k]);
+      }
+
+      double imbalance = 1.;
+      if (v_sum[stats_id*3] > 0)
+        imbalance = v_max[stats_id*3] / (v_sum[stats_id*3]/n_ranks);
+
+      fprintf(f, ", %14.7e\n", imbalance);
+
+    }
+
+    if (total)
+      fflush(f);
+
+  }
+
+  BFT_FREE(g_vals);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -313,6 +1134,23 @@ cs_timer_stats_initialize(void)
   cs_timer_stats_start(id);
   cs_timer_stats_set_plot(id, 0);
 
+  const char *p = getenv("CS_TIMER_STATS_HW_COUNTERS");
+  if (p != NULL)
+    cs_timer_stats_set_hw_counters(p);
+
+  p = getenv("CS_TIMER_STATS_TRACE");
+  if (p != NULL) {
+    long n_events_max = atol(p);
+    if (n_events_max == 1)
+      n_events_max = 262144;
+    if (n_events_max > 0)
+      cs_timer_stats_set_trace(n_events_max);
+  }
+
+  /* Allow low-level modules to report MPI wait times and events */
+
+  cs_timer_set_event_hooks(cs_timer_stats_add_mpi_wait,
+                           cs_timer_stats_trace_event);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -324,11 +1162,35 @@ cs_timer_stats_initialize(void)
 void
 cs_timer_stats_finalize(void)
 {
+  cs_timer_set_event_hooks(NULL, NULL);
+
   cs_timer_stats_increment_time_step();
 
   if (_time_plot != NULL)
     cs_time_plot_finalize(&_time_plot);
 
+  /* Distribution of totals across ranks */
+
+  if (cs_glob_n_ranks > 1 || _rank_stats_file != NULL)
+    _output_rank_stats(-1, true);
+
+  if (_rank_stats_file != NULL) {
+    if (fclose(_rank_stats_file) != 0)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error closing file: \"%s\""), "timer_stats_ranks.csv");
+    _rank_stats_file = NULL;
+  }
+
+  if (_n_hw_counters > 0) {
+    _log_hw_counters();
+    _hw_counters_finalize();
+  }
+
+  if (_trace_n_max > 0) {
+    _trace_write();
+    cs_timer_stats_set_trace(0);
+  }
+
   _time_id = -1;
 
   for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
@@ -396,6 +1258,164 @@ cs_timer_stats_set_plot_options(cs_time_plot_format_t   format,
   _plot_flush_wtime = flush_wtime;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable output of timer statistics distribution
+ *        across ranks at each plot output.
+ *
+ * The distribution of total times across ranks is always output at the
+ * end of a parallel computation; this allows also outputting the
+ * distribution of times since the previous output, at the plot frequency
+ * defined by \ref cs_timer_stats_set_plot_options.
+ *
+ * \param[in]  per_step  true to output distributions at each plot output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_rank_output(bool  per_step)
+{
+  _rank_output_per_step = per_step;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define hardware counters associated with timer statistics.
+ *
+ * The counter list is a comma-separated list of names among
+ * "cycles", "instructions", "cache_references", "cache_misses"
+ * (last level cache misses, from which memory bandwidth may be estimated),
+ * "branch_misses", "task_clock" and "page_faults" (software counters),
+ * and "r<hex>" for raw, processor-specific event codes (such as
+ * floating-point or vector instruction counts). The "default"
+ * keyword is equivalent to "cycles,instructions,cache_misses".
+ *
+ * Counters use the Linux perf_event interface, count user-space events
+ * of the calling thread and of threads it creates afterwards, and may not
+ * be available depending on the system's configuration, in which case
+ * a warning is printed. Previously defined counters are replaced.
+ *
+ * This function is only effective before the first call to
+ * \ref cs_timer_stats_increment_time_step. It is called at initialization
+ * with the value of the CS_TIMER_STATS_HW_COUNTERS environment variable
+ * if present, but may also be called from \ref cs_user_performance_tuning.
+ *
+ * \param[in]  counter_list  comma-separated list of counter names,
+ *                           or NULL or empty to disable counters
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_hw_counters(const char  *counter_list)
+{
+  if (_time_id > _start_time_id)
+    return;
+
+  _hw_counters_finalize();
+
+  if (counter_list == NULL)
+    return;
+
+  const char *_list = counter_list;
+  if (strcmp(counter_list, "default") == 0 || strcmp(counter_list, "1") == 0)
+    _list = "cycles,instructions,cache_misses";
+
+  /* Parse and open counters */
+
+  size_t l = strlen(_list);
+  char *list_copy;
+  BFT_MALLOC(list_copy, l + 1, char);
+  strcpy(list_copy, _list);
+
+  char *name = list_copy;
+
+  while (name != NULL && _n_hw_counters < _N_HW_COUNTERS_MAX) {
+
+    char *next = strchr(name, ',');
+    if (next != NULL) {
+      *next = '\0';
+      next += 1;
+    }
+
+    while (*name == ' ')
+      name++;
+    for (char *e = name + strlen(name); e > name && *(e-1) == ' '; e--)
+      *(e-1) = '\0';
+
+    if (strlen(name) > 0) {
+      int fd = _hw_counter_open(name);
+      if (fd > -1) {
+        _hw_fd[_n_hw_counters] = fd;
+        BFT_MALLOC(_hw_name[_n_hw_counters], strlen(name) + 1, char);
+        strcpy(_hw_name[_n_hw_counters], name);
+        _hw_plot[_n_hw_counters] = NULL;
+        _n_hw_counters += 1;
+      }
+    }
+
+    name = next;
+  }
+
+  BFT_FREE(list_copy);
+
+  /* Initialize counts for all statistics, and start values
+     for active ones */
+
+  uint64_t hw[_N_HW_COUNTERS_MAX];
+  _hw_counters_read(hw);
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    for (int i = 0; i < _N_HW_COUNTERS_MAX; i++) {
+      s->hw_start[i] = (i < _n_hw_counters) ? hw[i] : 0;
+      s->hw_cur[i] = 0;
+      s->hw_tot[i] = 0;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate tracing of timer statistics and events.
+ *
+ * Each rank keeps the most recent events in a ring buffer of the given
+ * size; buffers are gathered and written to "timer_stats_trace.json"
+ * (in Chrome trace event format) at \ref cs_timer_stats_finalize.
+ *
+ * This function is collective, as trace time origins are aligned using
+ * a barrier. Previously recorded events are discarded. It is called at
+ * initialization with the value of the CS_TIMER_STATS_TRACE environment
+ * variable (with 1 indicating a default buffer size) if present.
+ *
+ * \param[in]  n_events_max  ring buffer size, or 0 to deactivate tracing
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_trace(size_t  n_events_max)
+{
+  BFT_FREE(_trace_events);
+  if (_trace_names != NULL)
+    cs_map_name_to_id_destroy(&_trace_names);
+
+  _trace_n_max = n_events_max;
+  _trace_count = 0;
+
+  if (_trace_n_max > 0) {
+
+    BFT_MALLOC(_trace_events, _trace_n_max, _trace_event_t);
+    _trace_names = cs_map_name_to_id_create();
+
+#if defined(HAVE_MPI)
+    if (cs_glob_n_ranks > 1)
+      MPI_Barrier(cs_glob_mpi_comm);
+#endif
+
+    _trace_t0 = cs_timer_time();
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Increment time step for timer statistics.
@@ -407,6 +1427,9 @@ cs_timer_stats_increment_time_step(void)
 {
   cs_timer_t t_incr = cs_timer_time();
 
+  uint64_t hw[_N_HW_COUNTERS_MAX];
+  _hw_counters_read(hw);
+
   /* Update start and current time for active statistics
      (should be only root statistics if used properly) */
 
@@ -414,7 +1437,10 @@ cs_timer_stats_increment_time_step(void)
     cs_timer_stats_t  *s = _stats + stats_id;
     if (s->active) {
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_incr);
+      _trace_stat(stats_id, &(s->t_start), &t_incr);
       s->t_start = t_incr;
+      _hw_counters_add_diff(s->hw_cur, s->hw_start, hw);
+      memcpy(s->hw_start, hw, _n_hw_counters*sizeof(uint64_t));
     }
   }
 
@@ -429,10 +1455,22 @@ cs_timer_stats_increment_time_step(void)
     if (_time_plot != NULL)
       _output_time_plot();
 
+    if (_rank_output_per_step)
+      _output_rank_stats(_time_id, false);
+
+    if (_n_hw_counters > 0)
+      _output_hw_plots();
+
     for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
       cs_timer_stats_t  *s = _stats + stats_id;
       CS_TIMER_COUNTER_ADD(s->t_tot, s->t_tot, s->t_cur);
       CS_TIMER_COUNTER_INIT(s->t_cur);
+      CS_TIMER_COUNTER_ADD(s->t_wait_tot, s->t_wait_tot, s->t_wait_cur);
+      CS_TIMER_COUNTER_INIT(s->t_wait_cur);
+      for (int i = 0; i < _n_hw_counters; i++) {
+        s->hw_tot[i] += s->hw_cur[i];
+        s->hw_cur[i] = 0;
+      }
     }
 
   }
@@ -538,6 +1576,15 @@ cs_timer_stats_create(const char  *parent_name,
   CS_TIMER_COUNTER_INIT(s->t_cur);
   CS_TIMER_COUNTER_INIT(s->t_tot);
 
+  CS_TIMER_COUNTER_INIT(s->t_wait_cur);
+  CS_TIMER_COUNTER_INIT(s->t_wait_tot);
+
+  for (int i = 0; i < _N_HW_COUNTERS_MAX; i++) {
+    s->hw_start[i] = 0;
+    s->hw_cur[i] = 0;
+    s->hw_tot[i] = 0;
+  }
+
   return stats_id;
 }
 
@@ -606,6 +1653,46 @@ cs_timer_stats_is_active(int  id)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the cumulative compute time of a given statistic.
+ *
+ * This is the elapsed (wall-clock) time of the statistic since its
+ * creation, including the running time if it is currently active,
+ * minus the time attributed to MPI waits.
+ *
+ * \param[in]  id  id of statistic
+ *
+ * \return  local compute time (in seconds) for the statistic, or 0
+ *          if the id is not valid
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_timer_stats_get_compute_time(int  id)
+{
+  double retval = 0.;
+
+  if (id >= 0 && id < _n_stats) {
+
+    cs_timer_stats_t  *s = _stats + id;
+
+    cs_timer_counter_t c, w;
+    CS_TIMER_COUNTER_ADD(c, s->t_tot, s->t_cur);
+    CS_TIMER_COUNTER_ADD(w, s->t_wait_tot, s->t_wait_cur);
+
+    if (s->active) {
+      cs_timer_t t_now = cs_timer_time();
+      cs_timer_counter_add_diff(&c, &(s->t_start), &t_now);
+    }
+
+    retval = CS_MAX((double)(c.wall_nsec) - (double)(w.wall_nsec), 0.)*1e-9;
+
+  }
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Start a timer for a given statistic.
@@ -629,6 +1716,9 @@ cs_timer_stats_start(int  id)
 
   cs_timer_t t_start = cs_timer_time();
 
+  uint64_t hw[_N_HW_COUNTERS_MAX];
+  _hw_counters_read(hw);
+
   const int root_id = s->root_id;
 
   /* If a timer with the same root but different parents is active,
@@ -648,6 +1738,7 @@ cs_timer_stats_start(int  id)
     if (s->active == false) {
       s->active = true;
       s->t_start = t_start;
+      memcpy(s->hw_start, hw, _n_hw_counters*sizeof(uint64_t));
     }
 
   }
@@ -674,6 +1765,9 @@ cs_timer_stats_stop(int  id)
 
   cs_timer_t t_stop = cs_timer_time();
 
+  uint64_t hw[_N_HW_COUNTERS_MAX];
+  _hw_counters_read(hw);
+
   /* Stop timer and active children */
 
   const int root_id = s->root_id;
@@ -686,6 +1780,8 @@ cs_timer_stats_stop(int  id)
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_stop);
+      _trace_stat(s - _stats, &(s->t_start), &t_stop);
+      _hw_counters_add_diff(s->hw_cur, s->hw_start, hw);
     }
 
   }
@@ -721,6 +1817,9 @@ cs_timer_stats_switch(int  id)
   if (_active_id[root_id] == id)
     return retval; /* Nothing to do, already current */
 
+  uint64_t hw[_N_HW_COUNTERS_MAX];
+  _hw_counters_read(hw);
+
   int parent_id = _common_parent_id(id, _active_id[root_id]);
 
   /* Stop all active timers of same type which are lower level than the
@@ -734,6 +1833,8 @@ cs_timer_stats_switch(int  id)
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_switch);
+      _trace_stat(s - _stats, &(s->t_start), &t_switch);
+      _hw_counters_add_diff(s->hw_cur, s->hw_start, hw);
     }
 
   }
@@ -748,6 +1849,7 @@ cs_timer_stats_switch(int  id)
     if (s->active == false) {
       s->active = true;
       s->t_start = t_switch;
+      memcpy(s->hw_start, hw, _n_hw_counters*sizeof(uint64_t));
     }
 
   }
@@ -779,8 +1881,67 @@ cs_timer_stats_add_diff(int                id,
 
   cs_timer_stats_t  *s = _stats + id;
 
-  if (s->active == false)
+  if (s->active == false) {
     cs_timer_counter_add_diff(&(s->t_cur), t0, t1);
+    _trace_stat(id, t0, t1);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Attribute a time range spent waiting on MPI communication
+ *        to active timer statistics.
+ *
+ * The range is added to the MPI wait counters of the currently active
+ * statistic of each tree and of its parents, so that the compute time
+ * of each statistic may be deduced from its total time.
+ *
+ * When tracing is active, a matching event is also recorded.
+ *
+ * \param[in]  name  name of associated operation for tracing, or NULL
+ * \param[in]  t0    oldest timer value
+ * \param[in]  t1    most recent timer value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_add_mpi_wait(const char        *name,
+                            const cs_timer_t  *t0,
+                            const cs_timer_t  *t1)
+{
+  if (_trace_n_max > 0 && name != NULL)
+    _trace_named(name, t0, t1);
+
+  for (int root_id = 0; root_id < _n_roots; root_id++) {
+    for (int id = _active_id[root_id];
+         id > -1;
+         id = (_stats + id)->parent_id) {
+      cs_timer_stats_t  *s = _stats + id;
+      cs_timer_counter_add_diff(&(s->t_wait_cur), t0, t1);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Record a timed event when tracing is active.
+ *
+ * This may be used to add operations such as solver calls or
+ * communication steps to the trace, independently of timer statistics.
+ *
+ * \param[in]  name  event name
+ * \param[in]  t0    oldest timer value
+ * \param[in]  t1    most recent timer value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_trace_event(const char        *name,
+                           const cs_timer_t  *t0,
+                           const cs_timer_t  *t1)
+{
+  if (_trace_n_max > 0)
+    _trace_named(name, t0, t1);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -105,6 +105,73 @@ cs_timer_stats_set_plot_options(cs_time_plot_format_t   format,
                                 int                     n_buffer_steps,
                                 double                  flush_wtime);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable output of timer statistics distribution
+ *        across ranks at each plot output.
+ *
+ * The distribution of total times across ranks is always output at the
+ * end of a parallel computation; this allows also outputting the
+ * distribution of times since the previous output, at the plot frequency
+ * defined by \ref cs_timer_stats_set_plot_options.
+ *
+ * \param[in]  per_step  true to output distributions at each plot output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_rank_output(bool  per_step);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define hardware counters associated with timer statistics.
+ *
+ * The counter list is a comma-separated list of names among
+ * "cycles", "instructions", "cache_references", "cache_misses"
+ * (last level cache misses, from which memory bandwidth may be estimated),
+ * "branch_misses", "task_clock" and "page_faults" (software counters),
+ * and "r<hex>" for raw, processor-specific event codes (such as
+ * floating-point or vector instruction counts). The "default"
+ * keyword is equivalent to "cycles,instructions,cache_misses".
+ *
+ * Counters use the Linux perf_event interface, count user-space events
+ * of the calling thread and of threads it creates afterwards, and may not
+ * be available depending on the system's configuration, in which case
+ * a warning is printed. Previously defined counters are replaced.
+ *
+ * This function is only effective before the first call to
+ * \ref cs_timer_stats_increment_time_step. It is called at initialization
+ * with the value of the CS_TIMER_STATS_HW_COUNTERS environment variable
+ * if present, but may also be called from \ref cs_user_performance_tuning.
+ *
+ * \param[in]  counter_list  comma-separated list of counter names,
+ *                           or NULL or empty to disable counters
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_hw_counters(const char  *counter_list);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate tracing of timer statistics and events.
+ *
+ * Each rank keeps the most recent events in a ring buffer of the given
+ * size; buffers are gathered and written to "timer_stats_trace.json"
+ * (in Chrome trace event format) at \ref cs_timer_stats_finalize.
+ *
+ * This function is collective, as trace time origins are aligned using
+ * a barrier. Previously recorded events are discarded. It is called at
+ * initialization with the value of the CS_TIMER_STATS_TRACE environment
+ * variable (with 1 indicating a default buffer size) if present.
+ *
+ * \param[in]  n_events_max  ring buffer size, or 0 to deactivate tracing
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_trace(size_t  n_events_max);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Increment time step for timer statistics.
@@ -178,6 +245,24 @@ cs_timer_stats_set_plot(int  id,
 int
 cs_timer_stats_is_active(int  id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the cumulative compute time of a given statistic.
+ *
+ * This is the elapsed (wall-clock) time of the statistic since its
+ * creation, including the running time if it is currently active,
+ * minus the time attributed to MPI waits.
+ *
+ * \param[in]  id  id of statistic
+ *
+ * \return  local compute time (in seconds) for the statistic, or 0
+ *          if the id is not valid
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_timer_stats_get_compute_time(int  id);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Start a timer for a given statistic.
@@ -241,6 +326,46 @@ cs_timer_stats_add_diff(int  id,
                         const cs_timer_t    *t0,
                         const cs_timer_t    *t1);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Attribute a time range spent waiting on MPI communication
+ *        to active timer statistics.
+ *
+ * The range is added to the MPI wait counters of the currently active
+ * statistic of each tree and of its parents, so that the compute time
+ * of each statistic may be deduced from its total time.
+ *
+ * When tracing is active, a matching event is also recorded.
+ *
+ * \param[in]  name  name of associated operation for tracing, or NULL
+ * \param[in]  t0    oldest timer value
+ * \param[in]  t1    most recent timer value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_add_mpi_wait(const char        *name,
+                            const cs_timer_t  *t0,
+                            const cs_timer_t  *t1);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Record a timed event when tracing is active.
+ *
+ * This may be used to add operations such as solver calls or
+ * communication steps to the trace, independently of timer statistics.
+ *
+ * \param[in]  name  event name
+ * \param[in]  t0    oldest timer value
+ * \param[in]  t1    most recent timer value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_trace_event(const char        *name,
+                           const cs_timer_t  *t0,
+                           const cs_timer_t  *t1);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define default timer statistics
@@ -33,6 +33,7 @@
 #include <assert.h>
 #include <ctype.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -43,6 +44,8 @@
 
 #include "bft_mem.h"
 
+#include "cs_parall.h"
+
 /*----------------------------------------------------------------------------
  * Header for the current file
  *----------------------------------------------------------------------------*/
@@ -72,10 +75,28 @@ BEGIN_C_DECLS
  * Type and structure definitions
  *============================================================================*/
 
+/* Lookup index entry */
+
+typedef struct {
+
+  const cs_tree_node_t  *owner;  /* node relative to which lookup is done */
+  char                  *key;    /* lookup type and path or tag values */
+  size_t                 l;      /* key length */
+  cs_tree_node_t        *node;   /* associated node, or NULL */
+
+} _lookup_entry_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
 
+/* Hash table caching path and tag lookups; it is cleared whenever the
+   structure or values of any tree are modified */
+
+static size_t            _index_size = 0;
+static size_t            _index_n_entries = 0;
+static _lookup_entry_t  *_index = NULL;
+
 static const int _any_type
   = (  CS_TREE_NODE_CHAR | CS_TREE_NODE_INT
      | CS_TREE_NODE_REAL | CS_TREE_NODE_BOOL);
@@ -128,6 +149,221 @@ _normalize_string(char *s)
   return j;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the hash of a lookup key.
+ *
+ * \param[in]  owner  node relative to which lookup is done
+ * \param[in]  key    lookup key
+ * \param[in]  l      key length
+ *
+ * \return  hash value
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline size_t
+_lookup_hash(const cs_tree_node_t  *owner,
+             const char            *key,
+             size_t                 l)
+{
+  /* FNV-1a hash */
+
+  uint64_t h = 14695981039346656037ULL;
+
+  uintptr_t o = (uintptr_t)owner;
+  for (size_t i = 0; i < sizeof(uintptr_t); i++) {
+    h ^= (o >> (8*i)) & 0xff;
+    h *= 1099511628211ULL;
+  }
+
+  for (size_t i = 0; i < l; i++) {
+    h ^= (unsigned char)key[i];
+    h *= 1099511628211ULL;
+  }
+
+  return (size_t)h;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Search for a lookup index entry.
+ *
+ * \param[in]  owner  node relative to which lookup is done
+ * \param[in]  key    lookup key
+ * \param[in]  l      key length
+ *
+ * \return  pointer to matching entry, or to the empty slot where it
+ *          should be inserted (or NULL if the index is empty)
+ */
+/*----------------------------------------------------------------------------*/
+
+static _lookup_entry_t *
+_lookup_slot(const cs_tree_node_t  *owner,
+             const char            *key,
+             size_t                 l)
+{
+  if (_index_size == 0)
+    return NULL;
+
+  size_t i = _lookup_hash(owner, key, l) & (_index_size - 1);
+
+  while (_index[i].key != NULL) {
+    _lookup_entry_t *e = _index + i;
+    if (e->owner == owner && e->l == l && memcmp(e->key, key, l) == 0)
+      break;
+    i = (i + 1) & (_index_size - 1);
+  }
+
+  return _index + i;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Add an entry to the lookup index.
+ *
+ * \param[in]  owner  node relative to which lookup is done
+ * \param[in]  key    lookup key
+ * \param[in]  l      key length
+ * \param[in]  node   associated node, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_lookup_insert(const cs_tree_node_t  *owner,
+               const char            *key,
+               size_t                 l,
+               cs_tree_node_t        *node)
+{
+  /* Resize index if it is more than half full */
+
+  if (2*(_index_n_entries + 1) > _index_size) {
+
+    size_t old_size = _index_size;
+    _lookup_entry_t *old_index = _index;
+
+    _index_size = (old_size == 0) ? 64 : 2*old_size;
+    BFT_MALLOC(_index, _index_size, _lookup_entry_t);
+    for (size_t i = 0; i < _index_size; i++)
+      _index[i].key = NULL;
+
+    for (size_t i = 0; i < old_size; i++) {
+      if (old_index[i].key != NULL) {
+        _lookup_entry_t *e = _lookup_slot(old_index[i].owner,
+                                          old_index[i].key,
+                                          old_index[i].l);
+        *e = old_index[i];
+      }
+    }
+
+    BFT_FREE(old_index);
+  }
+
+  _lookup_entry_t *e = _lookup_slot(owner, key, l);
+
+  if (e->key == NULL) {
+    e->owner = owner;
+    BFT_MALLOC(e->key, l, char);
+    memcpy(e->key, key, l);
+    e->l = l;
+    _index_n_entries += 1;
+  }
+
+  e->node = node;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build a lookup key from a type character and strings.
+ *
+ * Strings are separated by a '\\0' character, so keys are not
+ * null-terminated strings.
+ *
+ * \param[in]       type   lookup type character
+ * \param[in]       n      number of strings
+ * \param[in]       str    strings
+ * \param[in, out]  l      key length
+ *
+ * \return  pointer to allocated key
+ */
+/*----------------------------------------------------------------------------*/
+
+static char *
+_lookup_key(char          type,
+            int           n,
+            const char   *str[],
+            size_t       *l)
+{
+  size_t _l = 1;
+  for (int i = 0; i < n; i++)
+    _l += strlen(str[i]) + 1;
+
+  char *key;
+  BFT_MALLOC(key, _l, char);
+
+  key[0] = type;
+  size_t j = 1;
+  for (int i = 0; i < n; i++) {
+    size_t l_i = strlen(str[i]) + 1;
+    memcpy(key + j, str[i], l_i);
+    j += l_i;
+  }
+
+  *l = _l;
+
+  return key;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Index tags of sibling nodes sharing a given name.
+ *
+ * For each tag value, the first node (in sibling order) of the given name
+ * with that tag value is indexed. A marker entry is also added, indicating
+ * the siblings have been indexed for that tag.
+ *
+ * \param[in]  first  first child node of its parent with the given name
+ * \param[in]  tag    name of the "tag" child
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_index_sibling_tags(cs_tree_node_t  *first,
+                    const char      *tag)
+{
+  for (cs_tree_node_t *cn = first;
+       cn != NULL;
+       cn = cs_tree_node_get_next_of_name(cn)) {
+
+    /* Tags converted to another type are not indexed; string values
+       are read directly, so as not to modify flags of unrelated nodes */
+
+    cs_tree_node_t *tn = cs_tree_node_get_child(cn, tag);
+    if (tn == NULL)
+      continue;
+    if (tn->flag & _no_char_type)
+      continue;
+
+    const char *s = (const char *)(tn->value);
+    if (s == NULL)
+      continue;
+
+    const char *str[3] = {first->name, tag, s};
+    size_t l;
+    char *key = _lookup_key('t', 3, str, &l);
+    _lookup_entry_t *e = _lookup_slot(first->parent, key, l);
+    if (e == NULL || e->key == NULL)
+      _lookup_insert(first->parent, key, l, cn);
+    BFT_FREE(key);
+
+  }
+
+  const char *str[2] = {first->name, tag};
+  size_t l;
+  char *key = _lookup_key('T', 2, str, &l);
+  _lookup_insert(first->parent, key, l, first);
+  BFT_FREE(key);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Search for a node located at path from node
@@ -256,6 +492,32 @@ _find_node(cs_tree_node_t   *parent,
   return _node;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the pointer to a node matching a given path,
+ *         without using the lookup index.
+ *
+ * \param[in]  node  pointer to the node where we start searching
+ * \param[in]  path  string describing the path access
+ *
+ * \return  pointer to the node, or NULL if not found
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_tree_node_t *
+_get_node(cs_tree_node_t  *node,
+          const char      *path)
+{
+  if (node == NULL)
+    return NULL;
+  if (path == NULL)
+    return node;
+  if (strlen(path) == 0)
+    return node;
+
+  return _find_node(node, path);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Retrieve the pointer to a node matching a given sub-path.
@@ -281,7 +543,7 @@ _find_sub_node(cs_tree_node_t  *root,
   cs_tree_node_t *tn = root->children;
 
   /* Check root first */
-  retval = cs_tree_get_node(root, sub_path);
+  retval = _get_node(root, sub_path);
 
   /* Recursively search descendants */
   while (retval == NULL && tn != NULL) {
@@ -351,6 +613,140 @@ _node_free(cs_tree_node_t  **pnode)
   BFT_FREE(*pnode);
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the size of the value associated with a node, in bytes.
+ *
+ * \param[in]  node  pointer to node
+ *
+ * \return  size of associated value
+ */
+/*----------------------------------------------------------------------------*/
+
+static size_t
+_value_size(const cs_tree_node_t  *node)
+{
+  size_t retval = 0;
+
+  if (node->value == NULL)
+    retval = 0;
+  else if (node->flag & CS_TREE_NODE_INT)
+    retval = node->size*sizeof(int);
+  else if (node->flag & CS_TREE_NODE_REAL)
+    retval = node->size*sizeof(cs_real_t);
+  else if (node->flag & CS_TREE_NODE_BOOL)
+    retval = node->size*sizeof(bool);
+  else
+    retval = strlen((const char *)(node->value)) + 1;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Serialize a branch of a tree, starting from a given node.
+ *
+ * If the buffer is NULL, only the required size is computed.
+ *
+ * Each node is serialized as its flag, size, name and description lengths,
+ * value size, and number of children, followed by the name, description,
+ * and value bytes, then by its children.
+ *
+ * \param[in]       node  pointer to node
+ * \param[in, out]  buf   serialization buffer, or NULL
+ *
+ * \return  size of serialized branch, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+static size_t
+_pack_branch(const cs_tree_node_t  *node,
+             char                  *buf)
+{
+  int n_children = 0;
+  for (cs_tree_node_t *c = node->children; c != NULL; c = c->next)
+    n_children++;
+
+  /* Lengths include the terminating '\0'; -1 is used for NULL */
+
+  int h[6] = {node->flag,
+              node->size,
+              (node->name != NULL) ? (int)strlen(node->name) + 1 : -1,
+              (node->desc != NULL) ? (int)strlen(node->desc) + 1 : -1,
+              (int)_value_size(node),
+              n_children};
+
+  size_t l = sizeof(h);
+  if (buf != NULL)
+    memcpy(buf, h, sizeof(h));
+
+  const void *p[3] = {node->name, node->desc, node->value};
+  for (int i = 0; i < 3; i++) {
+    if (h[2+i] > 0) {
+      if (buf != NULL)
+        memcpy(buf + l, p[i], h[2+i]);
+      l += h[2+i];
+    }
+  }
+
+  for (cs_tree_node_t *c = node->children; c != NULL; c = c->next)
+    l += _pack_branch(c, (buf != NULL) ? buf + l : NULL);
+
+  return l;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Rebuild a branch of a tree from its serialized form, adding it
+ *         as the last child of a given node.
+ *
+ * \param[in, out]  parent  pointer to parent node
+ * \param[in]       buf     serialization buffer
+ *
+ * \return  size of serialized branch, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+static size_t
+_unpack_branch(cs_tree_node_t  *parent,
+               const char      *buf)
+{
+  int h[6];
+  memcpy(h, buf, sizeof(h));
+  size_t l = sizeof(h);
+
+  const char *name = (h[2] > 0) ? buf + l : NULL;
+  if (h[2] > 0)
+    l += h[2];
+
+  cs_tree_node_t *node = cs_tree_add_child(parent, name);
+  node->flag = h[0];
+  node->size = h[1];
+
+  if (h[3] > 0) {
+    BFT_MALLOC(node->desc, h[3], char);
+    memcpy(node->desc, buf + l, h[3]);
+    l += h[3];
+  }
+
+  if (h[4] > 0) {
+    char *value;
+    BFT_MALLOC(value, h[4], char);
+    memcpy(value, buf + l, h[4]);
+    node->value = value;
+    l += h[4];
+  }
+
+  for (int i = 0; i < h[5]; i++)
+    l += _unpack_branch(node, buf + l);
+
+  return l;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -414,6 +810,8 @@ cs_tree_node_free(cs_tree_node_t  **pnode)
   if (root == NULL)
     return;
 
+  cs_tree_index_clear();
+
   if (root->children != NULL) { /* There is at least one child */
     cs_tree_node_t  *next_child = root->children->next;
     while (next_child != NULL) {
@@ -440,6 +838,8 @@ void
 cs_tree_node_set_name(cs_tree_node_t  *node,
                       const char      *name)
 {
+  cs_tree_index_clear();
+
   if (name == NULL)
     BFT_FREE(node->name);
 
@@ -665,6 +1065,8 @@ cs_tree_node_set_value_str(cs_tree_node_t  *node,
 {
   assert(node != NULL);
 
+  cs_tree_index_clear();
+
   node->flag = ((node->flag | _any_type) - _any_type) | CS_TREE_NODE_CHAR;
 
   if (val == NULL) {
@@ -773,6 +1175,8 @@ cs_tree_node_set_values_bool(cs_tree_node_t  *node,
 {
   assert(node != NULL);
 
+  cs_tree_index_clear();
+
   if (val == NULL)
     n = 0;
 
@@ -876,6 +1280,8 @@ cs_tree_node_set_values_int(cs_tree_node_t  *node,
 {
   assert(node != NULL);
 
+  cs_tree_index_clear();
+
   if (val == NULL)
     n = 0;
 
@@ -979,6 +1385,8 @@ cs_tree_node_set_values_real(cs_tree_node_t   *node,
 {
   assert(node != NULL);
 
+  cs_tree_index_clear();
+
   if (val == NULL)
     n = 0;
 
@@ -1140,6 +1548,37 @@ cs_tree_node_get_sibling_with_tag(cs_tree_node_t  *node,
                                   const char      *tag,
                                   const char      *tag_value)
 {
+  /* When starting from the first sibling with a given name (the usual
+     case), use the lookup index, indexing all siblings on first use */
+
+  if (node != NULL && node->parent != NULL) {
+
+    if (cs_tree_node_get_child(node->parent, node->name) == node) {
+
+      const char *str[3] = {node->name, tag, tag_value};
+      size_t l;
+      char *key = _lookup_key('T', 2, str, &l);
+      _lookup_entry_t *e = _lookup_slot(node->parent, key, l);
+      if (e == NULL || e->key == NULL)
+        _index_sibling_tags(node, tag);
+      BFT_FREE(key);
+
+      key = _lookup_key('t', 3, str, &l);
+      e = _lookup_slot(node->parent, key, l);
+      BFT_FREE(key);
+
+      cs_tree_node_t *retval = NULL;
+      if (e != NULL && e->key != NULL) {
+        retval = e->node;
+        cs_tree_node_get_tag(retval, tag);  /* set tag flags */
+      }
+
+      return retval;
+
+    }
+
+  }
+
   if (node != NULL) {
 
     cs_tree_node_t *sn = node;
@@ -1365,7 +1804,22 @@ cs_tree_get_node(cs_tree_node_t  *node,
   if (strlen(path) == 0)
     return node;
 
-  return _find_node(node, path);
+  size_t l;
+  char *key = _lookup_key('p', 1, &path, &l);
+
+  cs_tree_node_t *retval = NULL;
+  _lookup_entry_t *e = _lookup_slot(node, key, l);
+
+  if (e != NULL && e->key != NULL)
+    retval = e->node;
+  else {
+    retval = _find_node(node, path);
+    _lookup_insert(node, key, l, retval);
+  }
+
+  BFT_FREE(key);
+
+  return retval;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1401,6 +1855,37 @@ cs_tree_get_node_count(cs_tree_node_t  *node,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Clear the index caching path and tag lookups.
+ *
+ * Lookups using \ref cs_tree_get_node, \ref cs_tree_find_node and
+ * \ref cs_tree_node_get_sibling_with_tag are cached, so that repeated
+ * searches (such as one search per zone among many zone nodes) do not
+ * require traversing the tree again.
+ *
+ * The index is cleared automatically when nodes are added, renamed or freed,
+ * or when values are assigned, using the functions of this API. This
+ * function must be called by code which relinks existing nodes directly.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_tree_index_clear(void)
+{
+  if (_index == NULL)
+    return;
+
+  for (size_t i = 0; i < _index_size; i++) {
+    if (_index[i].key != NULL)
+      BFT_FREE(_index[i].key);
+  }
+
+  BFT_FREE(_index);
+  _index_size = 0;
+  _index_n_entries = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Create and add a node in a tree below the given parent node.
@@ -1419,6 +1904,8 @@ cs_tree_add_child(cs_tree_node_t  *parent,
   /* Allocate a new node */
   cs_tree_node_t  *node = cs_tree_node_create(name);
 
+  cs_tree_index_clear();
+
   if (parent == NULL) { /* node is a root */
     node->parent = NULL;
     node->prev = node->next = NULL;
@@ -1463,6 +1950,8 @@ cs_tree_add_sibling(cs_tree_node_t  *sibling,
   /* Allocate a new node */
   cs_tree_node_t  *node = cs_tree_node_create(name);
 
+  cs_tree_index_clear();
+
   if (sibling == NULL) { /* node is a root */
     node->parent = NULL;
     node->prev = node->next = NULL;
@@ -1506,7 +1995,22 @@ cs_tree_find_node(cs_tree_node_t  *root,
   if (strlen(sub_path) == 0)
     return root;
 
-  return _find_sub_node(root, sub_path);
+  size_t l;
+  char *key = _lookup_key('s', 1, &sub_path, &l);
+
+  cs_tree_node_t *retval = NULL;
+  _lookup_entry_t *e = _lookup_slot(root, key, l);
+
+  if (e != NULL && e->key != NULL)
+    retval = e->node;
+  else {
+    retval = _find_sub_node(root, sub_path);
+    _lookup_insert(root, key, l, retval);
+  }
+
+  BFT_FREE(key);
+
+  return retval;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1785,6 +2289,85 @@ cs_tree_dump(cs_log_t                log,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Broadcast the branches below a given node from one rank to all
+ *         other ranks.
+ *
+ * This allows building a tree (for example by parsing a setup file) on a
+ * single rank only. Children of the node on the root rank are serialized
+ * and broadcast; on other ranks, they are added to the node's children,
+ * after any existing children.
+ *
+ * \param[in]       root_rank  rank from which the branches are broadcast
+ * \param[in, out]  node       pointer to node whose children are broadcast
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_tree_bcast_children(int              root_rank,
+                       cs_tree_node_t  *node)
+{
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks < 2)
+    return;
+
+  assert(node != NULL);
+
+  /* Serialize branches on the root rank */
+
+  int n_children = 0;
+  int buf_size = 0;
+  char *buf = NULL;
+
+  if (cs_glob_rank_id == root_rank) {
+    size_t l = 0;
+    for (cs_tree_node_t *c = node->children; c != NULL; c = c->next) {
+      l += _pack_branch(c, NULL);
+      n_children++;
+    }
+    if (l > INT_MAX)
+      bft_error(__FILE__, __LINE__, 0,
+                "%s: serialized tree size (%llu bytes) too large.",
+                __func__, (unsigned long long)l);
+    buf_size = l;
+  }
+
+  int h[2] = {n_children, buf_size};
+  cs_parall_bcast(root_rank, 2, CS_INT_TYPE, h);
+  n_children = h[0];
+  buf_size = h[1];
+
+  BFT_MALLOC(buf, buf_size, char);
+
+  if (cs_glob_rank_id == root_rank) {
+    size_t l = 0;
+    for (cs_tree_node_t *c = node->children; c != NULL; c = c->next)
+      l += _pack_branch(c, buf + l);
+  }
+
+  cs_parall_bcast(root_rank, buf_size, CS_CHAR, buf);
+
+  /* Rebuild branches on other ranks */
+
+  if (cs_glob_rank_id != root_rank) {
+    size_t l = 0;
+    for (int i = 0; i < n_children; i++)
+      l += _unpack_branch(node, buf + l);
+    assert(l == (size_t)buf_size);
+  }
+
+  BFT_FREE(buf);
+
+#else
+
+  CS_UNUSED(root_rank);
+  CS_UNUSED(node);
+
+#endif /* defined(HAVE_MPI) */
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -641,6 +641,19 @@ cs_tree_get_or_add_node(cs_tree_node_t   *node,
   return _node;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Clear the index caching path and tag lookups.
+ *
+ * The index is cleared automatically when nodes are added, renamed or freed,
+ * or when values are assigned, using the functions of this API. This
+ * function must be called by code which relinks existing nodes directly.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_tree_index_clear(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Create and add a node in a tree below the given node.
@@ -907,6 +920,24 @@ cs_tree_dump(cs_log_t                log,
              int                     depth,
              const cs_tree_node_t   *node);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Broadcast the branches below a given node from one rank to all
+ *         other ranks.
+ *
+ * Children of the node on the root rank are serialized and broadcast;
+ * on other ranks, they are added to the node's children, after any
+ * existing children.
+ *
+ * \param[in]       root_rank  rank from which the branches are broadcast
+ * \param[in, out]  node       pointer to node whose children are broadcast
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_tree_bcast_children(int              root_rank,
+                       cs_tree_node_t  *node);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -61,6 +61,7 @@
 #include "cs_matrix_default.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_compact.h"
 #include "cs_mesh_coherency.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
@@ -119,11 +120,24 @@ typedef struct {
   cs_mesh_t                 *reference_mesh;    /* reference mesh (before
                                                    rotation and joining) */
 
+  cs_mesh_compact_index_t   *ref_i_face_vtx;    /* compact reference mesh
+                                                   interior face vertices */
+  cs_mesh_compact_index_t   *ref_b_face_vtx;    /* compact reference mesh
+                                                   boundary face vertices */
+  cs_mesh_compact_gnum_t    *ref_i_face_gnum;   /* compact reference mesh
+                                                   interior face numbers */
+  cs_mesh_compact_gnum_t    *ref_b_face_gnum;   /* compact reference mesh
+                                                   boundary face numbers */
+
   cs_lnum_t                  n_b_faces_ref;     /* reference number of
                                                    boundary faces */
 
   int                       *cell_rotor_num;    /* cell rotation axis number */
 
+  int                       *vtx_rotor_num;     /* reference mesh vertex
+                                                   rotation axis number, or
+                                                   NULL if not built yet */
+
   bool active;
 
 } cs_turbomachinery_t;
@@ -279,8 +293,13 @@ _turbomachinery_create(void)
   tbm->dt_retry = 1e-2;
 
   tbm->reference_mesh = cs_mesh_create();
+  tbm->ref_i_face_vtx = NULL;
+  tbm->ref_b_face_vtx = NULL;
+  tbm->ref_i_face_gnum = NULL;
+  tbm->ref_b_face_gnum = NULL;
   tbm->n_b_faces_ref = -1;
   tbm->cell_rotor_num = NULL;
+  tbm->vtx_rotor_num = NULL;
   tbm->model = CS_TURBOMACHINERY_NONE;
   tbm->n_couplings = 0;
 
@@ -468,29 +487,36 @@ _copy_mesh(const cs_mesh_t  *mesh,
            mesh->n_b_faces*sizeof(cs_lnum_t));
   }
 
-  BFT_MALLOC(mesh_copy->i_face_vtx_idx, mesh->n_i_faces + 1, cs_lnum_t);
-  memcpy(mesh_copy->i_face_vtx_idx,
-         mesh->i_face_vtx_idx,
-         (mesh->n_i_faces + 1)*sizeof(cs_lnum_t));
-
-  BFT_MALLOC(mesh_copy->i_face_vtx_lst,
-             mesh->i_face_vtx_connect_size,
-             cs_lnum_t);
-  memcpy(mesh_copy->i_face_vtx_lst, mesh->i_face_vtx_lst,
-         mesh->i_face_vtx_connect_size*sizeof(cs_lnum_t));
-
-  BFT_MALLOC(mesh_copy->b_face_vtx_idx, mesh->n_b_faces + 1, cs_lnum_t);
-  memcpy(mesh_copy->b_face_vtx_idx,
-         mesh->b_face_vtx_idx,
-         (mesh->n_b_faces + 1)*sizeof(cs_lnum_t));
-
-  if (mesh->b_face_vtx_connect_size > 0) {
-    BFT_MALLOC(mesh_copy->b_face_vtx_lst,
-               mesh->b_face_vtx_connect_size,
+  /* Face -> vertices connectivity may be stored in compact form
+     (and thus absent) in the reference mesh */
+
+  if (mesh->i_face_vtx_idx != NULL) {
+    BFT_MALLOC(mesh_copy->i_face_vtx_idx, mesh->n_i_faces + 1, cs_lnum_t);
+    memcpy(mesh_copy->i_face_vtx_idx,
+           mesh->i_face_vtx_idx,
+           (mesh->n_i_faces + 1)*sizeof(cs_lnum_t));
+
+    BFT_MALLOC(mesh_copy->i_face_vtx_lst,
+               mesh->i_face_vtx_connect_size,
                cs_lnum_t);
-    memcpy(mesh_copy->b_face_vtx_lst,
-           mesh->b_face_vtx_lst,
-           mesh->b_face_vtx_connect_size*sizeof(cs_lnum_t));
+    memcpy(mesh_copy->i_face_vtx_lst, mesh->i_face_vtx_lst,
+           mesh->i_face_vtx_connect_size*sizeof(cs_lnum_t));
+  }
+
+  if (mesh->b_face_vtx_idx != NULL) {
+    BFT_MALLOC(mesh_copy->b_face_vtx_idx, mesh->n_b_faces + 1, cs_lnum_t);
+    memcpy(mesh_copy->b_face_vtx_idx,
+           mesh->b_face_vtx_idx,
+           (mesh->n_b_faces + 1)*sizeof(cs_lnum_t));
+
+    if (mesh->b_face_vtx_connect_size > 0) {
+      BFT_MALLOC(mesh_copy->b_face_vtx_lst,
+                 mesh->b_face_vtx_connect_size,
+                 cs_lnum_t);
+      memcpy(mesh_copy->b_face_vtx_lst,
+             mesh->b_face_vtx_lst,
+             mesh->b_face_vtx_connect_size*sizeof(cs_lnum_t));
+    }
   }
 
   /* Global dimension */
@@ -599,6 +625,120 @@ _copy_mesh(const cs_mesh_t  *mesh,
   }
 }
 
+
+/*----------------------------------------------------------------------------
+ * Store the reference mesh's face -> vertices connectivity and face global
+ * numbers in compact form.
+ *
+ * The reference mesh is kept for the whole computation in the transient
+ * case, but only copied to the current mesh before each joining, so this
+ * reduces its memory footprint at a small decoding cost.
+ *
+ * parameters:
+ *   tbm <-> turbomachinery options structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_compact_reference_mesh(cs_turbomachinery_t  *tbm)
+{
+  cs_mesh_t *m = tbm->reference_mesh;
+
+  if (m->i_face_vtx_idx != NULL) {
+    tbm->ref_i_face_vtx = cs_mesh_compact_index_create(m->n_i_faces,
+                                                       m->i_face_vtx_idx,
+                                                       m->i_face_vtx_lst);
+    BFT_FREE(m->i_face_vtx_idx);
+    BFT_FREE(m->i_face_vtx_lst);
+  }
+
+  if (m->b_face_vtx_idx != NULL) {
+    tbm->ref_b_face_vtx = cs_mesh_compact_index_create(m->n_b_faces,
+                                                       m->b_face_vtx_idx,
+                                                       m->b_face_vtx_lst);
+    BFT_FREE(m->b_face_vtx_idx);
+    BFT_FREE(m->b_face_vtx_lst);
+  }
+
+  /* Faces are ordered by global number, so differences are small */
+
+  if (m->global_i_face_num != NULL) {
+    tbm->ref_i_face_gnum = cs_mesh_compact_gnum_create(m->n_i_faces,
+                                                       m->global_i_face_num);
+    BFT_FREE(m->global_i_face_num);
+  }
+
+  if (m->global_b_face_num != NULL) {
+    tbm->ref_b_face_gnum = cs_mesh_compact_gnum_create(m->n_b_faces,
+                                                       m->global_b_face_num);
+    BFT_FREE(m->global_b_face_num);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Free compact reference mesh arrays.
+ *
+ * parameters:
+ *   tbm <-> turbomachinery options structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_compact_reference_mesh(cs_turbomachinery_t  *tbm)
+{
+  cs_mesh_compact_index_destroy(&(tbm->ref_i_face_vtx));
+  cs_mesh_compact_index_destroy(&(tbm->ref_b_face_vtx));
+  cs_mesh_compact_gnum_destroy(&(tbm->ref_i_face_gnum));
+  cs_mesh_compact_gnum_destroy(&(tbm->ref_b_face_gnum));
+}
+
+/*----------------------------------------------------------------------------
+ * Copy the reference mesh to a given mesh, decoding arrays stored in
+ * compact form.
+ *
+ * parameters:
+ *   tbm  <-- turbomachinery options structure
+ *   mesh <-> mesh copy
+ *----------------------------------------------------------------------------*/
+
+static void
+_copy_reference_mesh(const cs_turbomachinery_t  *tbm,
+                     cs_mesh_t                  *mesh)
+{
+  _copy_mesh(tbm->reference_mesh, mesh);
+
+  if (cs_glob_n_joinings < 1)
+    return;
+
+  const cs_mesh_t *m = tbm->reference_mesh;
+
+  if (tbm->ref_i_face_vtx != NULL) {
+    BFT_MALLOC(mesh->i_face_vtx_idx, m->n_i_faces + 1, cs_lnum_t);
+    BFT_MALLOC(mesh->i_face_vtx_lst, m->i_face_vtx_connect_size, cs_lnum_t);
+    cs_mesh_compact_index_decode(tbm->ref_i_face_vtx,
+                                 mesh->i_face_vtx_idx,
+                                 mesh->i_face_vtx_lst);
+  }
+
+  if (tbm->ref_b_face_vtx != NULL) {
+    BFT_MALLOC(mesh->b_face_vtx_idx, m->n_b_faces + 1, cs_lnum_t);
+    BFT_MALLOC(mesh->b_face_vtx_lst, m->b_face_vtx_connect_size, cs_lnum_t);
+    cs_mesh_compact_index_decode(tbm->ref_b_face_vtx,
+                                 mesh->b_face_vtx_idx,
+                                 mesh->b_face_vtx_lst);
+  }
+
+  if (tbm->ref_i_face_gnum != NULL) {
+    BFT_MALLOC(mesh->global_i_face_num, m->n_i_faces, cs_gnum_t);
+    cs_mesh_compact_gnum_decode(tbm->ref_i_face_gnum,
+                                mesh->global_i_face_num);
+  }
+
+  if (tbm->ref_b_face_gnum != NULL) {
+    BFT_MALLOC(mesh->global_b_face_num, m->n_b_faces, cs_gnum_t);
+    cs_mesh_compact_gnum_decode(tbm->ref_b_face_gnum,
+                                mesh->global_b_face_num);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Update mesh vertex positions
  *
@@ -625,33 +765,33 @@ _update_angle(cs_real_t  t)
 }
 
 /*----------------------------------------------------------------------------
- * Update mesh vertex positions
+ * Mark vertices belonging to rotor cells.
+ *
+ * Vertex rotor numbers depend only on the reference mesh connectivity,
+ * which is never modified, so they are built only once and reused
+ * for all subsequent mesh updates (and joining retries).
  *
  * parameters:
- *   mesh <-> mesh to update
- *   dt   <-- associated time delta (0 for current, unmodified time)
+ *   mesh <-- mesh copied from the reference mesh
  *----------------------------------------------------------------------------*/
 
 static void
-_update_geometry(cs_mesh_t  *mesh,
-                 cs_real_t   dt)
+_mark_rotor_vertices(const cs_mesh_t  *mesh)
 {
   cs_turbomachinery_t *tbm = _turbomachinery;
 
-  cs_lnum_t  f_id, v_id;
-
-  cs_lnum_t  *vtx_rotor_num = NULL;
-
   const int  *cell_flag = tbm->cell_rotor_num;
 
-  BFT_MALLOC(vtx_rotor_num, mesh->n_vertices, cs_lnum_t);
+  BFT_REALLOC(tbm->vtx_rotor_num, mesh->n_vertices, int);
 
-  for (v_id = 0; v_id < mesh->n_vertices; v_id++)
+  int *vtx_rotor_num = tbm->vtx_rotor_num;
+
+  for (cs_lnum_t v_id = 0; v_id < mesh->n_vertices; v_id++)
     vtx_rotor_num[v_id] = 0;
 
   /* Mark from interior faces */
 
-  for (f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
     cs_lnum_t c_id_0 = mesh->i_face_cells[f_id][0];
     cs_lnum_t c_id_1 = mesh->i_face_cells[f_id][1];
     assert(c_id_0 > -1);
@@ -672,7 +812,7 @@ _update_geometry(cs_mesh_t  *mesh,
 
   /* Mark from boundary faces */
 
-  for (f_id = 0; f_id < mesh->n_b_faces; f_id++) {
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_b_faces; f_id++) {
     cs_lnum_t c_id = mesh->b_face_cells[f_id];
     if (cell_flag[c_id] != 0) {
       for (cs_lnum_t i = mesh->b_face_vtx_idx[f_id];
@@ -681,6 +821,29 @@ _update_geometry(cs_mesh_t  *mesh,
         vtx_rotor_num[mesh->b_face_vtx_lst[i]] = cell_flag[c_id];
     }
   }
+}
+
+/*----------------------------------------------------------------------------
+ * Update mesh vertex positions
+ *
+ * The mesh must have just been copied from the reference mesh, so that
+ * its vertices match those of the reference mesh.
+ *
+ * parameters:
+ *   mesh <-> mesh to update
+ *   dt   <-- associated time delta (0 for current, unmodified time)
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_geometry(cs_mesh_t  *mesh,
+                 cs_real_t   dt)
+{
+  cs_turbomachinery_t *tbm = _turbomachinery;
+
+  if (tbm->vtx_rotor_num == NULL)
+    _mark_rotor_vertices(mesh);
+
+  const int  *vtx_rotor_num = tbm->vtx_rotor_num;
 
   /* Now update coordinates */
 
@@ -697,14 +860,16 @@ _update_geometry(cs_mesh_t  *mesh,
                        m[j]);
   }
 
-  for (v_id = 0; v_id < mesh->n_vertices; v_id++) {
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+
+# pragma omp parallel for if (n_vertices > CS_THR_MIN)
+  for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
     if (vtx_rotor_num[v_id] > 0)
       _apply_vector_transfo(m[vtx_rotor_num[v_id]],
                             &(mesh->vtx_coord[3*v_id]));
   }
 
   BFT_FREE(m);
-  BFT_FREE(vtx_rotor_num);
 }
 
 /*----------------------------------------------------------------------------
@@ -826,7 +991,7 @@ _update_mesh_coupling(double   t_cur_mob,
   /* Cell and boundary face numberings can be moved from old mesh
      to new one, as the corresponding parts of the mesh should not change */
 
-  _copy_mesh(tbm->reference_mesh, cs_glob_mesh);
+  _copy_reference_mesh(tbm, cs_glob_mesh);
 
   /* Update geometry, if necessary */
 
@@ -924,7 +1089,7 @@ _update_mesh(bool     restart_mode,
 
       n_retry -= 1;
 
-      _copy_mesh(tbm->reference_mesh, cs_glob_mesh);
+      _copy_reference_mesh(tbm, cs_glob_mesh);
 
       /* Update geometry, if necessary */
 
@@ -1461,6 +1626,8 @@ cs_turbomachinery_initialize(void)
   cs_renumber_i_faces_by_gnum(tbm->reference_mesh);
   cs_renumber_b_faces_by_gnum(tbm->reference_mesh);
 
+  _compact_reference_mesh(tbm);
+
   /* Complete the mesh with rotor-stator joining */
 
   if (cs_glob_n_joinings > 0) {
@@ -1479,6 +1646,8 @@ cs_turbomachinery_initialize(void)
   if (tbm->model == CS_TURBOMACHINERY_FROZEN) {
     cs_mesh_destroy(tbm->reference_mesh);
     tbm->reference_mesh = NULL;
+    _free_compact_reference_mesh(tbm);
+    BFT_FREE(tbm->vtx_rotor_num);
   }
 
   /* Set global rotations pointer */
@@ -1506,9 +1675,11 @@ cs_turbomachinery_finalize(void)
     BFT_FREE(tbm->rotation);
 
     BFT_FREE(tbm->cell_rotor_num);
+    BFT_FREE(tbm->vtx_rotor_num);
 
     if (tbm->reference_mesh != NULL)
       cs_mesh_destroy(tbm->reference_mesh);
+    _free_compact_reference_mesh(tbm);
 
     /* Unset global rotations pointer for safety */
     cs_glob_rotation = NULL;
@@ -0,0 +1,291 @@
+/*============================================================================
+ * Velocity update steps of the velocity-pressure algorithm.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+
+#include "cs_mesh.h"
+#include "cs_mesh_quantities.h"
+#include "cs_param_types.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_velocity_pressure_update.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+ * \file cs_velocity_pressure_update.c
+ *
+ * Velocity update steps of the velocity-pressure algorithm.
+ *
+ * These kernels replace per-cell and per-face loops of the Navier-Stokes
+ * step (navstv), so that the velocity correction and the external forces
+ * update are done in a single pass over cells, and the RT0 velocity
+ * reconstruction uses the threaded face numbering.
+ */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Correct the predicted velocity with the gradient of the
+ *        pressure increment.
+ *
+ * With the hydrostatic pressure handling (iphydr = 1), the variation
+ * of external forces is also taken into account, and the external forces
+ * are updated in the same pass.
+ *
+ * \param[in]       idften  pressure diffusion type flag
+ * \param[in]       iphydr  hydrostatic pressure handling indicator
+ * \param[in]       thetap  pressure time scheme coefficient
+ * \param[in]       dt      time step (isotropic diffusion)
+ * \param[in]       dttens  time step tensor (anisotropic diffusion)
+ * \param[in]       crom    density
+ * \param[in]       dfrcxt  variation of external forces (iphydr = 1)
+ * \param[in]       gradp   gradient of the pressure increment
+ * \param[in, out]  frcxt   external forces (iphydr = 1)
+ * \param[in, out]  vel     velocity
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_velocity_pressure_correct_velocity(int                idften,
+                                      int                iphydr,
+                                      cs_real_t          thetap,
+                                      const cs_real_t    dt[],
+                                      const cs_real_6_t  dttens[],
+                                      const cs_real_t    crom[],
+                                      const cs_real_3_t  dfrcxt[],
+                                      const cs_real_3_t  gradp[],
+                                      cs_real_3_t        frcxt[],
+                                      cs_real_3_t        vel[])
+{
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  const int has_dc = mq->has_disable_flag;
+  const int *c_disable_flag = mq->c_disable_flag;
+
+  const bool isotropic = (idften & CS_ISOTROPIC_DIFFUSION) ? true : false;
+  const bool anisotropic
+    = (!isotropic && (idften & CS_ANISOTROPIC_DIFFUSION)) ? true : false;
+
+  if (!isotropic && !anisotropic && iphydr != 1)
+    return;
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    /* Pressure increment gradient, with the external forces variation
+       for the hydrostatic pressure handling */
+
+    cs_real_t dp[3];
+
+    if (iphydr == 1) {
+      for (int i = 0; i < 3; i++)
+        dp[i] = dfrcxt[c_id][i] - gradp[c_id][i];
+    }
+    else {
+      for (int i = 0; i < 3; i++)
+        dp[i] = -gradp[c_id][i];
+    }
+
+    /* Scalar diffusion for the pressure */
+
+    if (isotropic) {
+      const cs_real_t dtsrom = thetap*dt[c_id]/crom[c_id];
+      for (int i = 0; i < 3; i++)
+        vel[c_id][i] += dtsrom*dp[i];
+    }
+
+    /* Tensorial diffusion for the pressure */
+
+    else if (anisotropic) {
+      const cs_real_t unsrom = thetap/crom[c_id];
+      const cs_real_t *t = dttens[c_id];
+      vel[c_id][0] += unsrom*(t[0]*dp[0] + t[3]*dp[1] + t[5]*dp[2]);
+      vel[c_id][1] += unsrom*(t[3]*dp[0] + t[1]*dp[1] + t[4]*dp[2]);
+      vel[c_id][2] += unsrom*(t[5]*dp[0] + t[4]*dp[1] + t[2]*dp[2]);
+    }
+
+    /* Update external forces for the computation of the gradients */
+
+    if (iphydr == 1) {
+      const cs_real_t is_active = 1 - has_dc*c_disable_flag[has_dc*c_id];
+      for (int i = 0; i < 3; i++)
+        frcxt[c_id][i] = frcxt[c_id][i]*is_active + dfrcxt[c_id][i];
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reconstruct the cell velocity from the mass fluxes (RT0 update).
+ *
+ * The velocity is set to 1 / (rho Vol) SUM mass_flux (X_f - X_i),
+ * or 1 / Vol SUM vol_flux (X_f - X_i) with the VoF model (for which
+ * the fluxes are volume fluxes). Ghost cell values are set to zero, and
+ * must be synchronized by the caller.
+ *
+ * \param[in]   ivofmt      VoF model indicator
+ * \param[in]   crom        density
+ * \param[in]   i_massflux  interior faces mass flux
+ * \param[in]   b_massflux  boundary faces mass flux
+ * \param[out]  vel         velocity
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_velocity_pressure_velocity_from_mass_flux(int              ivofmt,
+                                             const cs_real_t  crom[],
+                                             const cs_real_t  i_massflux[],
+                                             const cs_real_t  b_massflux[],
+                                             cs_real_3_t      vel[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)mq->cell_cen;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)mq->i_face_cog;
+  const cs_real_3_t *restrict b_face_cog
+    = (const cs_real_3_t *restrict)mq->b_face_cog;
+  const cs_real_t *restrict cell_f_vol = mq->cell_f_vol;
+
+  const int has_dc = mq->has_disable_flag;
+  const int *c_disable_flag = mq->c_disable_flag;
+
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  /* Divisor of face fluxes for each cell: rho Vol, or Vol for volume
+     fluxes; disabled (solid) cells get no contribution */
+
+  cs_real_t *c_div;
+  BFT_MALLOC(c_div, n_cells_ext, cs_real_t);
+
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    if (ivofmt == 0)
+      c_div[c_id] = crom[c_id] * cell_f_vol[c_id];
+    else
+      c_div[c_id] = cell_f_vol[c_id];
+    for (int i = 0; i < 3; i++)
+      vel[c_id][i] = 0.;
+  }
+
+  /* Interior faces */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        cs_real_t flux_i = 0., flux_j = 0.;
+        if (has_dc == 0 || c_disable_flag[ii] == 0)
+          flux_i = i_massflux[face_id] / c_div[ii];
+        if (has_dc == 0 || c_disable_flag[jj] == 0)
+          flux_j = i_massflux[face_id] / c_div[jj];
+
+        for (int i = 0; i < 3; i++) {
+          vel[ii][i] += flux_i * (i_face_cog[face_id][i] - cell_cen[ii][i]);
+          vel[jj][i] -= flux_j * (i_face_cog[face_id][i] - cell_cen[jj][i]);
+        }
+
+      }
+    }
+  }
+
+  /* Boundary faces */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+#   pragma omp parallel for if (m->n_b_faces > CS_THR_MIN)
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = b_face_cells[face_id];
+
+        cs_real_t flux_i = 0.;
+        if (has_dc == 0 || c_disable_flag[ii] == 0)
+          flux_i = b_massflux[face_id] / c_div[ii];
+
+        for (int i = 0; i < 3; i++)
+          vel[ii][i] += flux_i * (b_face_cog[face_id][i] - cell_cen[ii][i]);
+
+      }
+    }
+  }
+
+  BFT_FREE(c_div);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
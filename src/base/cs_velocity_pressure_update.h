@@ -0,0 +1,106 @@
+#ifndef __CS_VELOCITY_PRESSURE_UPDATE_H__
+#define __CS_VELOCITY_PRESSURE_UPDATE_H__
+
+/*============================================================================
+ * Velocity update steps of the velocity-pressure algorithm.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Correct the predicted velocity with the gradient of the
+ *        pressure increment.
+ *
+ * With the hydrostatic pressure handling (iphydr = 1), the variation
+ * of external forces is also taken into account, and the external forces
+ * are updated in the same pass.
+ *
+ * \param[in]       idften  pressure diffusion type flag
+ * \param[in]       iphydr  hydrostatic pressure handling indicator
+ * \param[in]       thetap  pressure time scheme coefficient
+ * \param[in]       dt      time step (isotropic diffusion)
+ * \param[in]       dttens  time step tensor (anisotropic diffusion)
+ * \param[in]       crom    density
+ * \param[in]       dfrcxt  variation of external forces (iphydr = 1)
+ * \param[in]       gradp   gradient of the pressure increment
+ * \param[in, out]  frcxt   external forces (iphydr = 1)
+ * \param[in, out]  vel     velocity
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_velocity_pressure_correct_velocity(int                idften,
+                                      int                iphydr,
+                                      cs_real_t          thetap,
+                                      const cs_real_t    dt[],
+                                      const cs_real_6_t  dttens[],
+                                      const cs_real_t    crom[],
+                                      const cs_real_3_t  dfrcxt[],
+                                      const cs_real_3_t  gradp[],
+                                      cs_real_3_t        frcxt[],
+                                      cs_real_3_t        vel[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reconstruct the cell velocity from the mass fluxes (RT0 update).
+ *
+ * The velocity is set to 1 / (rho Vol) SUM mass_flux (X_f - X_i),
+ * or 1 / Vol SUM vol_flux (X_f - X_i) with the VoF model (for which
+ * the fluxes are volume fluxes). Ghost cell values are set to zero, and
+ * must be synchronized by the caller.
+ *
+ * \param[in]   ivofmt      VoF model indicator
+ * \param[in]   crom        density
+ * \param[in]   i_massflux  interior faces mass flux
+ * \param[in]   b_massflux  boundary faces mass flux
+ * \param[out]  vel         velocity
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_velocity_pressure_velocity_from_mass_flux(int              ivofmt,
+                                             const cs_real_t  crom[],
+                                             const cs_real_t  i_massflux[],
+                                             const cs_real_t  b_massflux[],
+                                             cs_real_3_t      vel[]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_VELOCITY_PRESSURE_UPDATE_H__ */
@@ -288,6 +288,153 @@ cs_f_cavitation_get_pointers(double **presat,
                              double **mcav,
                              int    **itscvi);
 
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute the Deshpande drift flux at an interior face.
+ *
+ * parameters:
+ *   cdrift      <-- drift flux factor
+ *   maxfluxsurf <-- maximum of volume flux over surface on all faces
+ *   delta       <-- stabilization factor
+ *   volflux     <-- face volume flux
+ *   face_surf   <-- face surface
+ *   face_normal <-- face normal
+ *   grad_i      <-- void fraction gradient at first adjacent cell
+ *   grad_j      <-- void fraction gradient at second adjacent cell
+ *
+ * returns:
+ *   drift flux
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_deshpande_face_flux(cs_real_t        cdrift,
+                     cs_real_t        maxfluxsurf,
+                     cs_real_t        delta,
+                     cs_real_t        volflux,
+                     cs_real_t        face_surf,
+                     const cs_real_t  face_normal[3],
+                     const cs_real_t  grad_i[3],
+                     const cs_real_t  grad_j[3])
+{
+  cs_real_3_t gradface, normalface;
+
+  cs_real_t fluxfactor
+    = CS_MIN(cdrift*CS_ABS(volflux)/face_surf, maxfluxsurf);
+
+  for (int idim = 0; idim < 3; idim++)
+    gradface[idim] = (grad_i[idim] + grad_j[idim])/2.;
+
+  cs_real_t normgrad = sqrt(pow(gradface[0],2)+
+                            pow(gradface[1],2)+
+                            pow(gradface[2],2));
+
+  for (int idim = 0; idim < 3; idim++)
+    normalface[idim] = gradface[idim] / (normgrad+delta);
+
+  return fluxfactor*(normalface[0]*face_normal[0]+
+                     normalface[1]*face_normal[1]+
+                     normalface[2]*face_normal[2]);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the Deshpande stabilization factor and the maximum of the
+ * volume flux over surface ratio on interior faces.
+ *
+ * parameters:
+ *   domain      <-- pointer to computational domain
+ *   i_volflux   <-- interior faces volume flux
+ *   delta       --> stabilization factor
+ *   maxfluxsurf --> maximum of volume flux over surface on all faces
+ *----------------------------------------------------------------------------*/
+
+static void
+_deshpande_factors(const cs_domain_t  *domain,
+                   const cs_real_t     i_volflux[],
+                   cs_real_t          *delta,
+                   cs_real_t          *maxfluxsurf)
+{
+  const cs_mesh_t *m = domain->mesh;
+  const cs_mesh_quantities_t *mq = domain->mesh_quantities;
+
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_real_t *i_face_surf = (const cs_real_t *)mq->i_face_surf;
+
+  /* Stabilization factor */
+  *delta = pow(10,-8)/pow(mq->tot_vol/m->n_g_cells,(1./3.));
+
+  /* Compute the max of flux/Surf over the entire domain*/
+  cs_real_t _maxfluxsurf = 0.;
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (_maxfluxsurf < CS_ABS(i_volflux[f_id])/i_face_surf[f_id])
+      _maxfluxsurf = CS_ABS(i_volflux[f_id])/i_face_surf[f_id];
+  }
+  cs_parall_max(1, CS_DOUBLE, &_maxfluxsurf);
+
+  *maxfluxsurf = _maxfluxsurf;
+}
+
+/*----------------------------------------------------------------------------
+ * Build lists of interior faces in the interface band.
+ *
+ * Drift and diffusion fluxes vanish on faces whose adjacent cells have
+ * the same pure phase void fraction (0 or 1), which is the case on
+ * most faces. Other faces are listed for each thread and group range
+ * of the interior faces numbering, starting at the range's first face
+ * position, so that ranges may be processed as for the full numbering.
+ *
+ * parameters:
+ *   m             <-- pointer to mesh
+ *   pvar          <-- void fraction
+ *   band_face_ids --> ids of faces in band, per range (size: n_i_faces)
+ *   band_end      --> past-the-end position of each range's list
+ *
+ * returns:
+ *   local number of faces in band
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_interface_band_faces(const cs_mesh_t  *m,
+                      const cs_real_t   pvar[],
+                      cs_lnum_t         band_face_ids[],
+                      cs_lnum_t         band_end[])
+{
+  const int n_i_ranges
+    = m->i_face_numbering->n_groups * m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+
+  cs_lnum_t n_band_faces = 0;
+
+# pragma omp parallel for reduction(+:n_band_faces)
+  for (int r_id = 0; r_id < n_i_ranges; r_id++) {
+
+    cs_lnum_t n = i_group_index[r_id*2];
+
+    for (cs_lnum_t face_id = i_group_index[r_id*2];
+         face_id < i_group_index[r_id*2 + 1];
+         face_id++) {
+
+      const cs_real_t a_i = pvar[i_face_cells[face_id][0]];
+      const cs_real_t a_j = pvar[i_face_cells[face_id][1]];
+
+      if (CS_ABS(a_i - a_j) > 0. || CS_ABS(a_i*(1.-a_i)) > 0.)
+        band_face_ids[n++] = face_id;
+
+    }
+
+    band_end[r_id] = n;
+    n_band_faces += n - i_group_index[r_id*2];
+
+  }
+
+  return n_band_faces;
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -736,10 +883,8 @@ cs_vof_deshpande_drift_flux(const cs_domain_t *domain)
   const cs_mesh_quantities_t *mq = domain->mesh_quantities;
 
   const cs_lnum_t n_i_faces = m->n_i_faces;
-  const cs_gnum_t n_g_cells = m->n_g_cells;
   const cs_lnum_t n_cells_with_ghosts = m->n_cells_with_ghosts;
 
-  const cs_real_t tot_vol = mq->tot_vol;
   const cs_real_t *i_face_surf = (const cs_real_t *)mq->i_face_surf;
   const cs_real_3_t *i_face_normal = (const cs_real_3_t *)mq->i_face_normal;
   const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
@@ -768,39 +913,23 @@ cs_vof_deshpande_drift_flux(const cs_domain_t *domain)
                            true,           // _recompute_cocg
                            voidf_grad);
 
-  /* Stabilization factor */
-  cs_real_t delta = pow(10,-8)/pow(tot_vol/n_g_cells,(1./3.));
-
-  /* Compute the max of flux/Surf over the entire domain*/
-  cs_real_t maxfluxsurf = 0.;
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-    if (maxfluxsurf < CS_ABS(i_volflux[f_id])/i_face_surf[f_id])
-      maxfluxsurf = CS_ABS(i_volflux[f_id])/i_face_surf[f_id];
-  }
-  cs_parall_max(1, CS_DOUBLE, &maxfluxsurf);
+  /* Stabilization factor and max of flux/Surf over the entire domain */
+  cs_real_t delta, maxfluxsurf;
+  _deshpande_factors(domain, i_volflux, &delta, &maxfluxsurf);
 
   /* Compute the relative velocity at internal faces */
-  cs_real_3_t gradface, normalface;
   for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
     cs_lnum_t cell_id1 = i_face_cells[f_id][0];
     cs_lnum_t cell_id2 = i_face_cells[f_id][1];
-    cs_real_t fluxfactor =
-      CS_MIN(cdrift*CS_ABS(i_volflux[f_id])/i_face_surf[f_id], maxfluxsurf);
-
-    for (int idim = 0; idim < 3; idim++)
-      gradface[idim] = (  voidf_grad[cell_id1][idim]
-                        + voidf_grad[cell_id2][idim])/2.;
-
-    cs_real_t normgrad = sqrt(pow(gradface[0],2)+
-                              pow(gradface[1],2)+
-                              pow(gradface[2],2));
 
-    for (int idim = 0; idim < 3; idim++)
-      normalface[idim] = gradface[idim] / (normgrad+delta);
-
-    cpro_idriftf[f_id] = fluxfactor*(normalface[0]*i_face_normal[f_id][0]+
-                                     normalface[1]*i_face_normal[f_id][1]+
-                                     normalface[2]*i_face_normal[f_id][2]);
+    cpro_idriftf[f_id] = _deshpande_face_flux(cdrift,
+                                              maxfluxsurf,
+                                              delta,
+                                              i_volflux[f_id],
+                                              i_face_surf[f_id],
+                                              i_face_normal[f_id],
+                                              voidf_grad[cell_id1],
+                                              voidf_grad[cell_id2]);
   }
 
   BFT_FREE(voidf_grad);
@@ -819,6 +948,10 @@ cs_vof_deshpande_drift_flux(const cs_domain_t *domain)
  *        \alpha_\celli^{n+1} \right) \left( \dot{m}_\fij^{d} \right)^{-}
  *       \right)
  * \f]
+ *
+ * Only interior faces near the interface are processed, since the drift
+ * and diffusion fluxes vanish between cells of a same pure phase.
+ *
  * \param[in]     imrgra        indicator
  *                               - 0 iterative gradient
  *                               - 1 least squares gradient
@@ -855,6 +988,7 @@ cs_vof_drift_term(int                        imrgra,
 
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
   const int n_i_groups = m->i_face_numbering->n_groups;
   const int n_i_threads = m->i_face_numbering->n_threads;
   const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
@@ -863,6 +997,8 @@ cs_vof_drift_term(int                        imrgra,
     = (const cs_lnum_2_t *restrict)m->i_face_cells;
   const cs_real_t *restrict i_dist = fvq->i_dist;
   const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
 
   /* Local variables */
 
@@ -880,6 +1016,20 @@ cs_vof_drift_term(int                        imrgra,
 
   const cs_real_t  *restrict _pvar = (pvar != NULL) ? pvar : pvara;
 
+  /*======================================================================
+    Faces in the interface band
+    ======================================================================*/
+
+  cs_lnum_t *band_face_ids, *band_end;
+  BFT_MALLOC(band_face_ids, n_i_faces, cs_lnum_t);
+  BFT_MALLOC(band_end, n_i_groups*n_i_threads, cs_lnum_t);
+
+  cs_lnum_t n_band_faces
+    = _interface_band_faces(m, _pvar, band_face_ids, band_end);
+
+  cs_gnum_t n_g_band_faces = n_band_faces;
+  cs_parall_counter(&n_g_band_faces, 1);
+
   /*======================================================================
     Computation of the drift flux
     ======================================================================*/
@@ -888,10 +1038,44 @@ cs_vof_drift_term(int                        imrgra,
   cs_field_t *idriftflux = cs_field_by_name_try("inner_drift_velocity_flux");
   cs_field_t *bdriftflux = cs_field_by_name_try("boundary_drift_velocity_flux");
 
+  /* The Deshpande drift flux is only needed on band faces, so it is
+     computed in the convection loop below (cs_vof_deshpande_drift_flux
+     computes it on all faces) */
+
+  const cs_real_t cdrift = _vof_parameters.cdrift;
+  const cs_real_t *restrict i_volflux = NULL;
+  cs_real_t delta = 0., maxfluxsurf = 0.;
+  cs_real_3_t *voidf_grad = NULL;
+
   if (_vof_parameters.idrift == 1) {
 
     // FIXME Handle boundary terms bdriftflux
-    cs_vof_deshpande_drift_flux(cs_glob_domain);
+
+    /* Check if field exists */
+    if (idriftflux == NULL)
+      bft_error(__FILE__, __LINE__, 0,_("error drift velocity not defined\n"));
+
+    cs_real_t *cpro_idriftf = idriftflux->val;
+
+#   pragma omp parallel for if(n_i_faces > CS_THR_MIN)
+    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
+      cpro_idriftf[face_id] = 0.;
+
+    if (n_g_band_faces > 0) {
+      const int kimasf = cs_field_key_id("inner_mass_flux_id");
+      i_volflux
+        = cs_field_by_id(cs_field_get_key_int(CS_F_(void_f), kimasf))->val;
+
+      _deshpande_factors(cs_glob_domain, i_volflux, &delta, &maxfluxsurf);
+
+      /* Compute the gradient of the void fraction */
+      BFT_MALLOC(voidf_grad, n_cells_ext, cs_real_3_t);
+      cs_field_gradient_scalar(CS_F_(void_f),
+                               true,           // use_previous_t
+                               1,              // inc
+                               true,           // _recompute_cocg
+                               voidf_grad);
+    }
 
   } else {
 
@@ -970,18 +1154,34 @@ cs_vof_drift_term(int                        imrgra,
     }
   }
 
+  /* Only faces in the interface band have non-zero fluxes */
+
   for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#   pragma omp parallel for
+#   pragma omp parallel for if(n_band_faces > CS_THR_MIN)
     for (int t_id = 0; t_id < n_i_threads; t_id++) {
-      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-           face_id++) {
+      const int r_id = t_id*n_i_groups + g_id;
+      for (cs_lnum_t b_id = i_group_index[r_id*2];
+           b_id < band_end[r_id];
+           b_id++) {
+
+        cs_lnum_t face_id = band_face_ids[b_id];
 
         cs_lnum_t ii = i_face_cells[face_id][0];
         cs_lnum_t jj = i_face_cells[face_id][1];
 
         cs_real_t irvf = 0.;
-        if (idriftflux != NULL)
+        if (voidf_grad != NULL) {
+          irvf = _deshpande_face_flux(cdrift,
+                                      maxfluxsurf,
+                                      delta,
+                                      i_volflux[face_id],
+                                      i_face_surf[face_id],
+                                      i_face_normal[face_id],
+                                      voidf_grad[ii],
+                                      voidf_grad[jj]);
+          idriftflux->val[face_id] = irvf;
+        }
+        else if (idriftflux != NULL)
           irvf = idriftflux->val[face_id];
 
         cs_real_2_t fluxij = {0.,0.};
@@ -1018,6 +1218,10 @@ cs_vof_drift_term(int                        imrgra,
       }
     }
   }
+
+  BFT_FREE(voidf_grad);
+  BFT_FREE(band_end);
+  BFT_FREE(band_face_ids);
 }
 
 /*----------------------------------------------------------------------------
@@ -259,6 +259,9 @@ cs_vof_deshpande_drift_flux(const cs_domain_t *domain);
  *       \right)
  * \f]
  *
+ * Only interior faces near the interface are processed, since the drift
+ * and diffusion fluxes vanish between cells of a same pure phase.
+ *
  * \param[in]     imrgra        indicator
  *                               - 0 iterative gradient
  *                               - 1 least squares gradient
@@ -470,13 +470,14 @@ cs_volume_mass_injection_eval(int        nvar,
   cs_lnum_t  *z_shift;
   BFT_MALLOC(z_shift, n_zones, cs_lnum_t);
 
-  cs_lnum_t c_shift = 0;
+  cs_lnum_t c_shift = 0, n_z_max = 0;
 
   for (int z_id = 0; z_id < n_zones; z_id++) {
     const cs_zone_t *z = cs_volume_zone_by_id(z_id);
     if (z->type & CS_VOLUME_ZONE_MASS_SOURCE_TERM) {
       z_shift[z_id] = c_shift;
       c_shift += z->n_elts;
+      n_z_max = CS_MAX(n_z_max, z->n_elts);
     }
     else
       z_shift[z_id] = -1;
@@ -484,6 +485,19 @@ cs_volume_mass_injection_eval(int        nvar,
 
   int n_fields = cs_field_n_fields();
 
+  /* Zone-local work array, shared by all definitions
+     (sized for the largest zone and field dimension) */
+
+  int dim_max = 1;
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+    const cs_field_t  *f = cs_field_by_id(f_id);
+    if (f->type & CS_FIELD_VARIABLE)
+      dim_max = CS_MAX(dim_max, f->dim);
+  }
+
+  cs_real_t *st_loc;
+  BFT_MALLOC(st_loc, n_z_max*(cs_lnum_t)dim_max, cs_real_t);
+
   for (int f_id = 0; f_id < n_fields; f_id++) {
 
     cs_field_t  *f = cs_field_by_id(f_id);
@@ -510,10 +524,7 @@ cs_volume_mass_injection_eval(int        nvar,
 
       const cs_lnum_t n_z_vals = z->n_elts*(cs_lnum_t)(f->dim);
 
-      cs_real_t *st_loc;
-      BFT_MALLOC(st_loc, n_z_vals, cs_real_t);
-      for (cs_lnum_t j = 0; j < n_z_vals; j++)
-        st_loc[j] = 0;
+      cs_array_set_value_real(n_z_vals, 1, 0, st_loc);
 
       _volume_mass_injection_eval(v_inj, st_loc);
 
@@ -534,12 +545,11 @@ cs_volume_mass_injection_eval(int        nvar,
         }
       }
 
-      BFT_FREE(st_loc);
-
     }
 
   }
 
+  BFT_FREE(st_loc);
   BFT_FREE(z_shift);
 }
 
@@ -0,0 +1,559 @@
+/*============================================================================
+ * Geometric (nearest wall face) wall distance computation
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+
+#include "cs_all_to_all.h"
+#include "cs_halo.h"
+#include "cs_math.h"
+#include "cs_mesh.h"
+#include "cs_mesh_quantities.h"
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_wall_distance_geom.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_wall_distance_geom.c
+        Geometric wall distance computation.
+
+  The distance from each cell center to the nearest wall face center is
+  computed directly, using a search in a balanced k-d tree built over the
+  local wall face centers.
+
+  In parallel, a small sample of wall face centers from each rank is first
+  shared by all ranks, so as to provide an upper bound of the distance
+  for every cell. Cells are then only sent to the ranks whose wall faces
+  bounding box is closer than this bound, and the distance is updated
+  with the nearest wall face center found on those ranks.
+
+  The cost of this computation is of the order of n_cells.log(n_wall_faces),
+  with no linear system to solve, so it may be recomputed at each time step
+  when walls move.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Maximum number of points in a k-d tree leaf */
+
+#define _KD_LEAF_SIZE  8
+
+/* Number of wall face centers sampled on each rank */
+
+#define _N_SAMPLES  16
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Partially sort a set of points along a given direction so that the
+ * point at position k is the one that would be at this position if the
+ * set was fully sorted (quickselect).
+ *
+ * parameters:
+ *   coords <-> point coordinates
+ *   s      <-- start of range
+ *   e      <-- past-the-end of range
+ *   k      <-- position of selected point
+ *   dim    <-- sorting direction
+ *----------------------------------------------------------------------------*/
+
+static void
+_kd_select(cs_real_3_t  coords[],
+           cs_lnum_t    s,
+           cs_lnum_t    e,
+           cs_lnum_t    k,
+           int          dim)
+{
+  cs_lnum_t l = s, r = e - 1;
+
+  while (r > l) {
+
+    const cs_real_t pivot = coords[(l+r)/2][dim];
+
+    cs_lnum_t i = l, j = r;
+    while (i <= j) {
+      while (coords[i][dim] < pivot)
+        i++;
+      while (coords[j][dim] > pivot)
+        j--;
+      if (i <= j) {
+        for (int l_id = 0; l_id < 3; l_id++) {
+          cs_real_t t = coords[i][l_id];
+          coords[i][l_id] = coords[j][l_id];
+          coords[j][l_id] = t;
+        }
+        i++;
+        j--;
+      }
+    }
+
+    if (k <= j)
+      r = j;
+    else if (k >= i)
+      l = i;
+    else
+      break;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build an implicit balanced k-d tree over a range of points.
+ *
+ * Points are reordered so that the median point of each range which is
+ * larger than a leaf separates the points of its lower and upper halves
+ * relative to the split direction, which is saved for that point.
+ *
+ * parameters:
+ *   coords <-> point coordinates
+ *   split  <-> split direction of each median point
+ *   s      <-- start of range
+ *   e      <-- past-the-end of range
+ *----------------------------------------------------------------------------*/
+
+static void
+_kd_build(cs_real_3_t     coords[],
+          unsigned char   split[],
+          cs_lnum_t       s,
+          cs_lnum_t       e)
+{
+  if (e - s <= _KD_LEAF_SIZE)
+    return;
+
+  /* Split along direction of largest extent */
+
+  cs_real_t lo[3] = {coords[s][0], coords[s][1], coords[s][2]};
+  cs_real_t hi[3] = {coords[s][0], coords[s][1], coords[s][2]};
+
+  for (cs_lnum_t i = s+1; i < e; i++) {
+    for (int l_id = 0; l_id < 3; l_id++) {
+      lo[l_id] = CS_MIN(lo[l_id], coords[i][l_id]);
+      hi[l_id] = CS_MAX(hi[l_id], coords[i][l_id]);
+    }
+  }
+
+  int dim = 0;
+  for (int l_id = 1; l_id < 3; l_id++) {
+    if (hi[l_id] - lo[l_id] > hi[dim] - lo[dim])
+      dim = l_id;
+  }
+
+  cs_lnum_t mid = (s + e) / 2;
+
+  _kd_select(coords, s, e, mid, dim);
+  split[mid] = dim;
+
+  _kd_build(coords, split, s, mid);
+  _kd_build(coords, split, mid + 1, e);
+}
+
+/*----------------------------------------------------------------------------
+ * Update the squared distance from a point to the nearest point of a
+ * range of a k-d tree.
+ *
+ * parameters:
+ *   coords <-- tree point coordinates
+ *   split  <-- split direction of each median point
+ *   s      <-- start of range
+ *   e      <-- past-the-end of range
+ *   x      <-- coordinates of queried point
+ *   d2     <-> current squared distance bound
+ *----------------------------------------------------------------------------*/
+
+static void
+_kd_nearest(const cs_real_3_t     coords[],
+            const unsigned char   split[],
+            cs_lnum_t             s,
+            cs_lnum_t             e,
+            const cs_real_t       x[3],
+            cs_real_t            *d2)
+{
+  if (e - s <= _KD_LEAF_SIZE) {
+    for (cs_lnum_t i = s; i < e; i++) {
+      cs_real_t d = cs_math_3_square_distance(x, coords[i]);
+      if (d < *d2)
+        *d2 = d;
+    }
+    return;
+  }
+
+  cs_lnum_t mid = (s + e) / 2;
+  int dim = split[mid];
+
+  cs_real_t d = cs_math_3_square_distance(x, coords[mid]);
+  if (d < *d2)
+    *d2 = d;
+
+  cs_real_t delta = x[dim] - coords[mid][dim];
+
+  if (delta < 0) {
+    _kd_nearest(coords, split, s, mid, x, d2);
+    if (delta*delta < *d2)
+      _kd_nearest(coords, split, mid + 1, e, x, d2);
+  }
+  else {
+    _kd_nearest(coords, split, mid + 1, e, x, d2);
+    if (delta*delta < *d2)
+      _kd_nearest(coords, split, s, mid, x, d2);
+  }
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Update squared wall distances using wall faces of other ranks.
+ *
+ * parameters:
+ *   n_w     <-- number of local wall faces
+ *   w_xyz   <-- local wall face centers, in k-d tree order
+ *   w_split <-- local k-d tree split directions
+ *   d2      <-> squared wall distance at cells
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_parall(cs_lnum_t              n_w,
+               const cs_real_3_t      w_xyz[],
+               const unsigned char    w_split[],
+               cs_real_t              d2[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+
+  const int n_ranks = cs_glob_n_ranks;
+  const int l_rank = cs_glob_rank_id;
+  MPI_Comm comm = cs_glob_mpi_comm;
+
+  /* Bounding box of each rank's wall faces (empty if min > max) */
+
+  cs_real_t l_box[6] = {cs_math_infinite_r,
+                        cs_math_infinite_r,
+                        cs_math_infinite_r,
+                        -cs_math_infinite_r,
+                        -cs_math_infinite_r,
+                        -cs_math_infinite_r};
+
+  for (cs_lnum_t i = 0; i < n_w; i++) {
+    for (int l_id = 0; l_id < 3; l_id++) {
+      l_box[l_id] = CS_MIN(l_box[l_id], w_xyz[i][l_id]);
+      l_box[3+l_id] = CS_MAX(l_box[3+l_id], w_xyz[i][l_id]);
+    }
+  }
+
+  cs_real_t *g_box;
+  BFT_MALLOC(g_box, n_ranks*6, cs_real_t);
+
+  MPI_Allgather(l_box, 6, CS_MPI_REAL, g_box, 6, CS_MPI_REAL, comm);
+
+  /* Share a sample of each rank's wall face centers to obtain an
+     initial distance bound for all cells */
+
+  int n_l_samples = CS_MIN(n_w, _N_SAMPLES);
+  cs_real_t l_samples[_N_SAMPLES*3];
+
+  for (int i = 0; i < n_l_samples; i++) {
+    cs_lnum_t j = ((cs_gnum_t)i * (cs_gnum_t)n_w) / n_l_samples;
+    for (int l_id = 0; l_id < 3; l_id++)
+      l_samples[i*3 + l_id] = w_xyz[j][l_id];
+  }
+
+  int *s_count, *s_displ;
+  BFT_MALLOC(s_count, n_ranks, int);
+  BFT_MALLOC(s_displ, n_ranks, int);
+
+  int n_l_vals = n_l_samples*3;
+  MPI_Allgather(&n_l_vals, 1, MPI_INT, s_count, 1, MPI_INT, comm);
+
+  int n_g_vals = 0;
+  for (int i = 0; i < n_ranks; i++) {
+    s_displ[i] = n_g_vals;
+    n_g_vals += s_count[i];
+  }
+
+  cs_lnum_t n_s = n_g_vals / 3;
+  cs_real_3_t *s_xyz;
+  unsigned char *s_split;
+  BFT_MALLOC(s_xyz, n_s, cs_real_3_t);
+  BFT_MALLOC(s_split, n_s, unsigned char);
+
+  MPI_Allgatherv(l_samples, n_l_vals, CS_MPI_REAL,
+                 s_xyz, s_count, s_displ, CS_MPI_REAL, comm);
+
+  BFT_FREE(s_displ);
+  BFT_FREE(s_count);
+
+  _kd_build(s_xyz, s_split, 0, n_s);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    _kd_nearest((const cs_real_3_t *)s_xyz, s_split, 0, n_s,
+                cell_cen[c_id], d2 + c_id);
+
+  BFT_FREE(s_split);
+  BFT_FREE(s_xyz);
+
+  /* Determine queries to other ranks */
+
+  cs_lnum_t n_queries = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (int r = 0; r < n_ranks; r++) {
+      const cs_real_t *box = g_box + r*6;
+      if (r == l_rank || box[0] > box[3])
+        continue;
+      cs_real_t bd2 = 0;
+      for (int l_id = 0; l_id < 3; l_id++) {
+        cs_real_t c = cell_cen[c_id][l_id];
+        cs_real_t d = CS_MAX(CS_MAX(box[l_id] - c, c - box[3+l_id]), 0.);
+        bd2 += d*d;
+      }
+      if (bd2 < d2[c_id])
+        n_queries++;
+    }
+  }
+
+  int *dest_rank;
+  cs_lnum_t *q_c_id;
+  cs_real_t *q_send;
+  BFT_MALLOC(dest_rank, n_queries, int);
+  BFT_MALLOC(q_c_id, n_queries, cs_lnum_t);
+  BFT_MALLOC(q_send, n_queries*4, cs_real_t);
+
+  n_queries = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (int r = 0; r < n_ranks; r++) {
+      const cs_real_t *box = g_box + r*6;
+      if (r == l_rank || box[0] > box[3])
+        continue;
+      cs_real_t bd2 = 0;
+      for (int l_id = 0; l_id < 3; l_id++) {
+        cs_real_t c = cell_cen[c_id][l_id];
+        cs_real_t d = CS_MAX(CS_MAX(box[l_id] - c, c - box[3+l_id]), 0.);
+        bd2 += d*d;
+      }
+      if (bd2 < d2[c_id]) {
+        dest_rank[n_queries] = r;
+        q_c_id[n_queries] = c_id;
+        for (int l_id = 0; l_id < 3; l_id++)
+          q_send[n_queries*4 + l_id] = cell_cen[c_id][l_id];
+        q_send[n_queries*4 + 3] = d2[c_id];
+        n_queries++;
+      }
+    }
+  }
+
+  BFT_FREE(g_box);
+
+  /* Exchange queries, search local wall faces, and return results */
+
+  cs_all_to_all_t *d = cs_all_to_all_create(n_queries,
+                                            0,     /* flags */
+                                            NULL,  /* dest_id */
+                                            dest_rank,
+                                            comm);
+
+  cs_all_to_all_transfer_dest_rank(d, &dest_rank);
+
+  cs_real_t *q_recv = cs_all_to_all_copy_array(d,
+                                               CS_REAL_TYPE,
+                                               4,
+                                               false, /* reverse */
+                                               q_send,
+                                               NULL);
+
+  BFT_FREE(q_send);
+
+  cs_lnum_t n_recv = cs_all_to_all_n_elts_dest(d);
+
+  cs_real_t *r_d2;
+  BFT_MALLOC(r_d2, n_recv, cs_real_t);
+
+# pragma omp parallel for if (n_recv > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_recv; i++) {
+    r_d2[i] = q_recv[i*4 + 3];
+    _kd_nearest(w_xyz, w_split, 0, n_w, q_recv + i*4, r_d2 + i);
+  }
+
+  BFT_FREE(q_recv);
+
+  cs_real_t *q_d2 = cs_all_to_all_copy_array(d,
+                                             CS_REAL_TYPE,
+                                             1,
+                                             true, /* reverse */
+                                             r_d2,
+                                             NULL);
+
+  BFT_FREE(r_d2);
+
+  cs_all_to_all_destroy(&d);
+
+  for (cs_lnum_t i = 0; i < n_queries; i++) {
+    cs_lnum_t c_id = q_c_id[i];
+    if (q_d2[i] < d2[c_id])
+      d2[c_id] = q_d2[i];
+  }
+
+  BFT_FREE(q_d2);
+  BFT_FREE(q_c_id);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the distance from each cell center to the nearest
+ *        wall face center.
+ *
+ * The search is exact relative to wall face centers, and uses k-d trees
+ * over local wall faces; in parallel, only cells whose current distance
+ * bound may be improved by another rank's wall faces (based on their
+ * bounding box) are sent to that rank.
+ *
+ * If there are no wall faces, the distance is set to \ref cs_math_big_r.
+ *
+ * This function may be called again whenever walls move (for ALE or
+ * turbomachinery computations), as it does not rely on a previous solution.
+ *
+ * \param[in]   n_wall_faces   number of local wall faces
+ * \param[in]   wall_face_ids  ids of local wall faces
+ * \param[out]  wall_dist      wall distance at cells
+ *                             (size: n_cells_with_ghosts)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_distance_geom_compute(cs_lnum_t        n_wall_faces,
+                              const cs_lnum_t  wall_face_ids[],
+                              cs_real_t        wall_dist[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+  const cs_real_3_t *b_face_cog
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->b_face_cog;
+
+  cs_gnum_t n_g_wall_faces = n_wall_faces;
+  cs_parall_counter(&n_g_wall_faces, 1);
+
+  if (n_g_wall_faces == 0) {
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+      wall_dist[c_id] = cs_math_big_r;
+    return;
+  }
+
+  /* Build k-d tree over local wall face centers */
+
+  cs_real_3_t *w_xyz;
+  unsigned char *w_split;
+  BFT_MALLOC(w_xyz, n_wall_faces, cs_real_3_t);
+  BFT_MALLOC(w_split, n_wall_faces, unsigned char);
+
+  for (cs_lnum_t i = 0; i < n_wall_faces; i++) {
+    cs_lnum_t f_id = wall_face_ids[i];
+    for (int l_id = 0; l_id < 3; l_id++)
+      w_xyz[i][l_id] = b_face_cog[f_id][l_id];
+  }
+
+  _kd_build(w_xyz, w_split, 0, n_wall_faces);
+
+  /* Search local wall faces */
+
+  cs_real_t *d2;
+  BFT_MALLOC(d2, n_cells, cs_real_t);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    d2[c_id] = cs_math_infinite_r;
+    _kd_nearest((const cs_real_3_t *)w_xyz, w_split, 0, n_wall_faces,
+                cell_cen[c_id], d2 + c_id);
+  }
+
+  /* Search wall faces of other ranks */
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    _update_parall(n_wall_faces,
+                   (const cs_real_3_t *)w_xyz,
+                   w_split,
+                   d2);
+#endif
+
+  BFT_FREE(w_split);
+  BFT_FREE(w_xyz);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    wall_dist[c_id] = sqrt(d2[c_id]);
+
+  BFT_FREE(d2);
+
+  if (m->halo != NULL)
+    cs_halo_sync_var(m->halo, CS_HALO_STANDARD, wall_dist);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,75 @@
+#ifndef __CS_WALL_DISTANCE_GEOM_H__
+#define __CS_WALL_DISTANCE_GEOM_H__
+
+/*============================================================================
+ * Geometric (nearest wall face) wall distance computation
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the distance from each cell center to the nearest
+ *        wall face center.
+ *
+ * The search is exact relative to wall face centers, and uses k-d trees
+ * over local wall faces; in parallel, only cells whose current distance
+ * bound may be improved by another rank's wall faces (based on their
+ * bounding box) are sent to that rank.
+ *
+ * If there are no wall faces, the distance is set to \ref cs_math_big_r.
+ *
+ * This function may be called again whenever walls move (for ALE or
+ * turbomachinery computations), as it does not rely on a previous solution.
+ *
+ * \param[in]   n_wall_faces   number of local wall faces
+ * \param[in]   wall_face_ids  ids of local wall faces
+ * \param[out]  wall_dist      wall distance at cells
+ *                             (size: n_cells_with_ghosts)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_distance_geom_compute(cs_lnum_t        n_wall_faces,
+                              const cs_lnum_t  wall_face_ids[],
+                              cs_real_t        wall_dist[]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_WALL_DISTANCE_GEOM_H__ */
@@ -595,6 +595,157 @@ cs_wall_functions_scalar(cs_wall_f_s_type_t  iwalfs,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the friction velocity and \f$y^+\f$ / \f$u^+\f$ for a set
+ *        of boundary faces.
+ *
+ * This is equivalent to calling \ref cs_wall_functions_velocity for each
+ * selected face, with a loop on faces which may be multithreaded.
+ * All arrays are indexed by boundary face id (size: n_b_faces).
+ *
+ * \param[in]     iwallf        wall function type
+ * \param[in]     n_faces       number of selected faces
+ * \param[in]     face_ids      ids of selected boundary faces, or NULL
+ *                              (all faces 0 to n_faces-1 selected)
+ * \param[in]     l_visc        kinematic viscosity
+ * \param[in]     t_visc        turbulent kinematic viscosity
+ * \param[in]     vel           wall projected cell center velocity
+ * \param[in]     y             wall distance
+ * \param[in]     rough_d       roughness length scale, or NULL
+ * \param[in]     rnnb          \f$\vec{n}.(\tens{R}\vec{n})\f$
+ * \param[in]     kinetic_en    turbulent kinetic energy (cell center)
+ * \param[out]    iuntur        indicator: 0 in the viscous sublayer
+ * \param[in,out] nsubla        counter of cell in the viscous sublayer
+ * \param[in,out] nlogla        counter of cell in the log-layer
+ * \param[out]    ustar         friction velocity
+ * \param[out]    uk            friction velocity
+ * \param[out]    yplus         dimensionless distance to the wall
+ * \param[out]    ypup          yplus projected vel ratio
+ * \param[out]    cofimp        \f$\frac{|U_F|}{|U_I^p|}\f$ to ensure a good
+ *                              turbulence production
+ * \param[out]    dplus         dimensionless shift to the wall for scalable
+ *                              wall functions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_functions_velocity_faces(cs_wall_f_type_t  iwallf,
+                                 cs_lnum_t         n_faces,
+                                 const cs_lnum_t   face_ids[],
+                                 const cs_real_t   l_visc[],
+                                 const cs_real_t   t_visc[],
+                                 const cs_real_t   vel[],
+                                 const cs_real_t   y[],
+                                 const cs_real_t   rough_d[],
+                                 const cs_real_t   rnnb[],
+                                 const cs_real_t   kinetic_en[],
+                                 int               iuntur[],
+                                 cs_lnum_t        *nsubla,
+                                 cs_lnum_t        *nlogla,
+                                 cs_real_t         ustar[],
+                                 cs_real_t         uk[],
+                                 cs_real_t         yplus[],
+                                 cs_real_t         ypup[],
+                                 cs_real_t         cofimp[],
+                                 cs_real_t         dplus[])
+{
+  cs_lnum_t _nsubla = 0, _nlogla = 0;
+
+  /* Values are computed independently for each face */
+
+# pragma omp parallel for reduction(+:_nsubla, _nlogla) \
+                          if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    cs_lnum_t f_id = (face_ids != NULL) ? face_ids[i] : i;
+    cs_real_t _rough_d = (rough_d != NULL) ? rough_d[f_id] : 0.;
+
+    cs_wall_functions_velocity(iwallf,
+                               f_id + 1,
+                               l_visc[f_id],
+                               t_visc[f_id],
+                               vel[f_id],
+                               y[f_id],
+                               _rough_d,
+                               rnnb[f_id],
+                               kinetic_en[f_id],
+                               iuntur + f_id,
+                               &_nsubla,
+                               &_nlogla,
+                               ustar + f_id,
+                               uk + f_id,
+                               yplus + f_id,
+                               ypup + f_id,
+                               cofimp + f_id,
+                               dplus + f_id);
+  }
+
+  *nsubla += _nsubla;
+  *nlogla += _nlogla;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the correction of the exchange coefficient between the
+ *        fluid and the wall for a turbulent flow, for a set of boundary faces.
+ *
+ * This is equivalent to calling \ref cs_wall_functions_scalar for each
+ * selected face, with a loop on faces which may be multithreaded.
+ * All arrays are indexed by boundary face id (size: n_b_faces).
+ *
+ * \param[in]     iwalfs        type of wall functions for scalar
+ * \param[in]     n_faces       number of selected faces
+ * \param[in]     face_ids      ids of selected boundary faces, or NULL
+ *                              (all faces 0 to n_faces-1 selected)
+ * \param[in]     l_visc        kinematic viscosity
+ * \param[in]     prl           laminar Prandtl number
+ * \param[in]     prt           turbulent Prandtl number
+ * \param[in]     rough_t       scalar roughness length scale, or NULL
+ * \param[in]     uk            velocity scale based on TKE
+ * \param[in]     yplus         dimensionless distance to the wall
+ * \param[in]     dplus         dimensionless distance for scalable
+ *                              wall functions
+ * \param[out]    htur          corrected exchange coefficient
+ * \param[out]    yplim         value of the limit for \f$ y^+ \f$, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_functions_scalar_faces(cs_wall_f_s_type_t  iwalfs,
+                               cs_lnum_t           n_faces,
+                               const cs_lnum_t     face_ids[],
+                               const cs_real_t     l_visc[],
+                               const cs_real_t     prl[],
+                               cs_real_t           prt,
+                               const cs_real_t     rough_t[],
+                               const cs_real_t     uk[],
+                               const cs_real_t     yplus[],
+                               const cs_real_t     dplus[],
+                               cs_real_t           htur[],
+                               cs_real_t           yplim[])
+{
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    cs_lnum_t f_id = (face_ids != NULL) ? face_ids[i] : i;
+    cs_real_t _rough_t = (rough_t != NULL) ? rough_t[f_id] : 0.;
+    cs_real_t _yplim = (yplim != NULL) ? yplim[f_id] : 0.;
+
+    cs_wall_functions_scalar(iwalfs,
+                             l_visc[f_id],
+                             prl[f_id],
+                             prt,
+                             _rough_t,
+                             uk[f_id],
+                             yplus[f_id],
+                             dplus[f_id],
+                             htur + f_id,
+                             &_yplim);
+
+    if (yplim != NULL)
+      yplim[f_id] = _yplim;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -142,8 +142,11 @@ do iscal = 1, nscal
     endif
   endif
 
+  ! Constant values are set on ghost cells too, so that no halo
+  ! synchronization is needed for each scalar
+
   if (imucpp.eq.0) then
-    do iel = 1, ncel
+    do iel = 1, ncelet
       xcpp(iel) = 1.d0
     enddo
   elseif (imucpp.eq.1) then
@@ -151,18 +154,17 @@ do iscal = 1, nscal
       do iel = 1, ncel
         xcpp(iel) = cpro_cp(iel)
       enddo
+      ! Handle parallelism and periodicity
+      if (irangp.ge.0.or.iperio.eq.1) then
+        call synsca(xcpp)
+      endif
    else
-      do iel = 1, ncel
+      do iel = 1, ncelet
         xcpp(iel) = cp0
       enddo
     endif
   endif
 
-  ! Handle parallelism and periodicity
-  if (irangp.ge.0.or.iperio.eq.1) then
-    call synsca(xcpp)
-  endif
-
   call field_get_key_struct_var_cal_opt(ivarfl(ivar), vcopt)
 
   f_id0  = -1
@@ -25,8 +25,8 @@
 ! --------
 
 !> \file distpr2.f90
-!> \brief Compute distance to wall by a brute force geometric approach
-!>        (serial only)
+!> \brief Compute distance to wall by a geometric approach
+!>        (distance to the nearest wall face center)
 !>
 !------------------------------------------------------------------------------
 
@@ -72,15 +72,18 @@ integer          itypfb(nfabor)
 
 integer          f_id
 integer          ifac  , iel
+integer          nfpar
 
-double precision xdis, dismax, dismin
+double precision dismax, dismin
+
+integer, allocatable, dimension(:) :: lstfpa
 
 double precision, dimension(:), pointer :: distpa
 
 !===============================================================================
 
-! normalement, on ne passe pas en parallele ici,  mais au cas ou ...
-if (irangp.ge.0 .or. iperio.gt.0) then
+! A wall may be closer through a periodic boundary
+if (iperio.gt.0) then
   call csexit(1)
 endif
 
@@ -88,32 +91,22 @@ call field_get_id("wall_distance", f_id)
 call field_get_val_s(f_id, distpa)
 
 !===============================================================================
-! Deprecated model to compute wall distance
+! Compute distance to nearest wall face center
 !===============================================================================
 
-! on fera attention en parallelisme ou periodicite
-!    (une paroi peut etre plus proche en traversant un bord ...)
-
-do iel = 1, ncel
-  distpa(iel) = grand*grand
-enddo
+allocate(lstfpa(nfabor))
 
+nfpar = 0
 do ifac = 1, nfabor
   if (itypfb(ifac).eq.iparoi .or. itypfb(ifac).eq.iparug) then
-    do iel = 1, ncel
-      xdis =   (cdgfbo(1,ifac)-xyzcen(1,iel))**2            &
-             + (cdgfbo(2,ifac)-xyzcen(2,iel))**2            &
-             + (cdgfbo(3,ifac)-xyzcen(3,iel))**2
-      if (distpa(iel).gt.xdis) then
-        distpa(iel) = xdis
-      endif
-    enddo
+    nfpar = nfpar + 1
+    lstfpa(nfpar) = ifac - 1
   endif
 enddo
 
-do iel = 1, ncel
-  distpa(iel) = sqrt(distpa(iel))
-enddo
+call wall_distance_geom_compute(nfpar, lstfpa, distpa)
+
+deallocate(lstfpa)
 
 !===============================================================================
 ! Compute bounds and print info
@@ -127,6 +120,11 @@ do iel = 1, ncel
   dismax = max(distpa(iel),dismax)
 enddo
 
+if (irangp.ge.0) then
+  call parmin(dismin)
+  call parmax(dismax)
+endif
+
 write(nfecra,1000) dismin, dismax
 
 !===============================================================================
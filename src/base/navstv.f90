@@ -123,7 +123,7 @@ integer          ndircp, icpt
 integer          numcpl
 integer          f_dim , iflwgr
 double precision rnorm , rnormt, rnorma, rnormi, vitnor
-double precision dtsrom, unsrom, rhom, rovolsdt
+double precision rhom, rovolsdt
 double precision epsrgp, climgp, xyzmax(3), xyzmin(3)
 double precision thetap, xdu, xdv, xdw
 double precision rhofac, dtfac
@@ -134,7 +134,6 @@ double precision distbf, srfbnf, hint
 double precision rnx, rny, rnz
 double precision vr(3), vr1(3), vr2(3), vrn
 double precision disp_fac(3)
-double precision mass_fl_drhovol1, mass_fl_drhovol2
 
 double precision, allocatable, dimension(:,:,:), target :: viscf
 double precision, allocatable, dimension(:), target :: viscb
@@ -920,52 +919,20 @@ if (ippmod(icompf).lt.0.or.ippmod(icompf).eq.3) then
                                   iccocg, iphydr,                      &
                                   dfrcxt, gradp)
 
-    ! Update the velocity field
-    !--------------------------
+    ! Update the velocity field (and external forces with the
+    ! hydrostatic pressure handling)
+    !--------------------------------------------------------
     thetap = vcopt_p%thetav
 
+    call cs_velocity_pressure_correct_velocity(vcopt_p%idften, iphydr, &
+                                               thetap, dt, dttens,     &
+                                               crom, dfrcxt, gradp,    &
+                                               frcxt, vel)
+
     ! Specific handling of hydrostatic pressure
     !------------------------------------------
     if (iphydr.eq.1) then
 
-      ! Scalar diffusion for the pressure
-      if (iand(vcopt_p%idften, ISOTROPIC_DIFFUSION).ne.0) then
-        !$omp parallel do private(dtsrom, isou)
-        do iel = 1, ncel
-          dtsrom = thetap*dt(iel)/crom(iel)
-          do isou = 1, 3
-            vel(isou,iel) = vel(isou,iel)                            &
-                 + dtsrom*(dfrcxt(isou, iel)-gradp(isou,iel))
-          enddo
-        enddo
-
-      ! Tensorial diffusion for the pressure
-      elseif (iand(vcopt_p%idften, ANISOTROPIC_DIFFUSION).ne.0) then
-        !$omp parallel do private(unsrom)
-        do iel = 1, ncel
-          unsrom = thetap/crom(iel)
-
-          vel(1, iel) = vel(1, iel)                              &
-               + unsrom*(                                        &
-                 dttens(1,iel)*(dfrcxt(1, iel)-gradp(1,iel))     &
-               + dttens(4,iel)*(dfrcxt(2, iel)-gradp(2,iel))     &
-               + dttens(6,iel)*(dfrcxt(3, iel)-gradp(3,iel))     &
-               )
-          vel(2, iel) = vel(2, iel)                              &
-               + unsrom*(                                        &
-                 dttens(4,iel)*(dfrcxt(1, iel)-gradp(1,iel))     &
-               + dttens(2,iel)*(dfrcxt(2, iel)-gradp(2,iel))     &
-               + dttens(5,iel)*(dfrcxt(3, iel)-gradp(3,iel))     &
-               )
-          vel(3, iel) = vel(3, iel)                              &
-               + unsrom*(                                        &
-                 dttens(6,iel)*(dfrcxt(1 ,iel)-gradp(1,iel))     &
-               + dttens(5,iel)*(dfrcxt(2 ,iel)-gradp(2,iel))     &
-               + dttens(3,iel)*(dfrcxt(3 ,iel)-gradp(3,iel))     &
-               )
-        enddo
-      endif
-
       ! Update of the Dirichlet boundary conditions on the
       ! pressure for the outlet
       call field_get_coefa_s(ivarfl(ipr), coefa_p)
@@ -982,50 +949,6 @@ if (ippmod(icompf).lt.0.or.ippmod(icompf).eq.3) then
         endif
       enddo
 
-
-      ! Standard handling of hydrostatic pressure
-      !------------------------------------------
-    else
-
-      ! Scalar diffusion for the pressure
-      if (iand(vcopt_p%idften, ISOTROPIC_DIFFUSION).ne.0) then
-
-        !$omp parallel do private(dtsrom, isou)
-        do iel = 1, ncel
-          dtsrom = thetap*dt(iel)/crom(iel)
-          do isou = 1, 3
-            vel(isou,iel) = vel(isou,iel) - dtsrom*gradp(isou,iel)
-          enddo
-        enddo
-
-      ! Tensorial diffusion for the pressure
-      else if (iand(vcopt_p%idften, ANISOTROPIC_DIFFUSION).ne.0) then
-
-        !$omp parallel do private(unsrom)
-        do iel = 1, ncel
-          unsrom = thetap/crom(iel)
-
-          vel(1, iel) = vel(1, iel)                              &
-                      - unsrom*(                                 &
-                                 dttens(1,iel)*(gradp(1,iel))    &
-                               + dttens(4,iel)*(gradp(2,iel))    &
-                               + dttens(6,iel)*(gradp(3,iel))    &
-                               )
-          vel(2, iel) = vel(2, iel)                              &
-                      - unsrom*(                                 &
-                                 dttens(4,iel)*(gradp(1,iel))    &
-                               + dttens(2,iel)*(gradp(2,iel))    &
-                               + dttens(5,iel)*(gradp(3,iel))    &
-                               )
-          vel(3, iel) = vel(3, iel)                              &
-                      - unsrom*(                                 &
-                                 dttens(6,iel)*(gradp(1,iel))    &
-                               + dttens(5,iel)*(gradp(2,iel))    &
-                               + dttens(3,iel)*(gradp(3,iel))    &
-                               )
-        enddo
-
-      endif
     endif
 
     !Free memory
@@ -1034,136 +957,33 @@ if (ippmod(icompf).lt.0.or.ippmod(icompf).eq.3) then
   ! RT0 update from the mass fluxes
   else
 
-    ! Initialization to 0
-    do iel = 1, ncelet
-      vel(1, iel) = 0.d0
-      vel(2, iel) = 0.d0
-      vel(3, iel) = 0.d0
-    enddo
-
     ! vel = 1 / (rho Vol) SUM mass_flux (X_f - X_i)
-    if (ivofmt.eq.0) then
-      do ifac = 1, nfac
-
-        iel1 = ifacel(1,ifac)
-        iel2 = ifacel(2,ifac)
-
-        mass_fl_drhovol1 = 0.d0
-        ! If it is not a solid cell
-        if (cell_is_active(iel1).eq.1) &
-          mass_fl_drhovol1 = imasfl(ifac) / (crom(iel1) * cell_f_vol(iel1))
-
-
-        mass_fl_drhovol2 = 0.d0
-        ! If it is not a solid cell
-        if (cell_is_active(iel2).eq.1) &
-          mass_fl_drhovol2 = imasfl(ifac) / (crom(iel2) * cell_f_vol(iel2))
-
-        vel(1, iel1) = vel(1, iel1) &
-          + mass_fl_drhovol1 * (cdgfac(1, ifac) - xyzcen(1, iel1))
-        vel(2, iel1) = vel(2, iel1) &
-          + mass_fl_drhovol1 * (cdgfac(2, ifac) - xyzcen(2, iel1))
-        vel(3, iel1) = vel(3, iel1) &
-          + mass_fl_drhovol1 * (cdgfac(3, ifac) - xyzcen(3, iel1))
-
-        vel(1, iel2) = vel(1, iel2) &
-          - mass_fl_drhovol2 * (cdgfac(1, ifac) - xyzcen(1, iel2))
-        vel(2, iel2) = vel(2, iel2) &
-          - mass_fl_drhovol2 * (cdgfac(2, ifac) - xyzcen(2, iel2))
-        vel(3, iel2) = vel(3, iel2) &
-          - mass_fl_drhovol2 * (cdgfac(3, ifac) - xyzcen(3, iel2))
-
-      enddo
-
-      do ifac = 1, nfabor
-        iel1 = ifabor(ifac)
-
-        mass_fl_drhovol1 = 0.d0
-        ! If it is not a solid cell
-        if (cell_is_active(iel1).eq.1) &
-          mass_fl_drhovol1 = bmasfl(ifac) / (crom(iel1) * cell_f_vol(iel1))
-
-        vel(1, iel1) = vel(1, iel1) &
-          + mass_fl_drhovol1 * (cdgfbo(1, ifac) - xyzcen(1, iel1))
-        vel(2, iel1) = vel(2, iel1) &
-          + mass_fl_drhovol1 * (cdgfbo(2, ifac) - xyzcen(2, iel1))
-        vel(3, iel1) = vel(3, iel1) &
-          + mass_fl_drhovol1 * (cdgfbo(3, ifac) - xyzcen(3, iel1))
-
-      enddo
-
-      ! vel = 1 / (Vol) SUM vol_flux (X_f - X_i)
-    else
-
-      do ifac = 1, nfac
-
-        iel1 = ifacel(1,ifac)
-        iel2 = ifacel(2,ifac)
-
-        mass_fl_drhovol1 = 0.d0
-        ! If it is not a solid cell
-        if (cell_is_active(iel1).eq.1) &
-          mass_fl_drhovol1 = imasfl(ifac) / cell_f_vol(iel1)
-
-
-        mass_fl_drhovol2 = 0.d0
-        ! If it is not a solid cell
-        if (cell_is_active(iel2).eq.1) &
-          mass_fl_drhovol2 = imasfl(ifac) / cell_f_vol(iel2)
-
-        vel(1, iel1) = vel(1, iel1) &
-          + mass_fl_drhovol1 * (cdgfac(1, ifac) - xyzcen(1, iel1))
-        vel(2, iel1) = vel(2, iel1) &
-          + mass_fl_drhovol1 * (cdgfac(2, ifac) - xyzcen(2, iel1))
-        vel(3, iel1) = vel(3, iel1) &
-          + mass_fl_drhovol1 * (cdgfac(3, ifac) - xyzcen(3, iel1))
+    ! or vel = 1 / (Vol) SUM vol_flux (X_f - X_i) for VoF
+    call cs_velocity_pressure_velocity_from_mass_flux(ivofmt, crom,      &
+                                                      imasfl, bmasfl,    &
+                                                      vel)
 
-        vel(1, iel2) = vel(1, iel2) &
-          - mass_fl_drhovol2 * (cdgfac(1, ifac) - xyzcen(1, iel2))
-        vel(2, iel2) = vel(2, iel2) &
-          - mass_fl_drhovol2 * (cdgfac(2, ifac) - xyzcen(2, iel2))
-        vel(3, iel2) = vel(3, iel2) &
-          - mass_fl_drhovol2 * (cdgfac(3, ifac) - xyzcen(3, iel2))
-
-      enddo
-
-      do ifac = 1, nfabor
-        iel1 = ifabor(ifac)
-
-        mass_fl_drhovol1 = 0.d0
-        ! If it is not a solid cell
-        if (cell_is_active(iel1).eq.1) &
-          mass_fl_drhovol1 = bmasfl(ifac) / cell_f_vol(iel1)
+    call synvin(vel)
 
-        vel(1, iel1) = vel(1, iel1) &
-          + mass_fl_drhovol1 * (cdgfbo(1, ifac) - xyzcen(1, iel1))
-        vel(2, iel1) = vel(2, iel1) &
-          + mass_fl_drhovol1 * (cdgfbo(2, ifac) - xyzcen(2, iel1))
-        vel(3, iel1) = vel(3, iel1) &
-          + mass_fl_drhovol1 * (cdgfbo(3, ifac) - xyzcen(3, iel1))
+    if (iphydr.eq.1) then
 
+      ! Update external forces for the computation of the gradients
+      !$omp parallel do
+      do iel=1,ncel
+        frcxt(1 ,iel) = frcxt(1 ,iel) * cell_is_active(iel) + dfrcxt(1 ,iel)
+        frcxt(2 ,iel) = frcxt(2 ,iel) * cell_is_active(iel) + dfrcxt(2 ,iel)
+        frcxt(3 ,iel) = frcxt(3 ,iel) * cell_is_active(iel) + dfrcxt(3 ,iel)
       enddo
 
     endif
 
-    call synvin(vel)
-
   endif
 
+  ! External forces were updated with the velocity for irevmc = 0
   if (iphydr.eq.1) then
-
-    ! Update external forces for the computation of the gradients
-    !$omp parallel do
-    do iel=1,ncel
-      frcxt(1 ,iel) = frcxt(1 ,iel) * cell_is_active(iel) + dfrcxt(1 ,iel)
-      frcxt(2 ,iel) = frcxt(2 ,iel) * cell_is_active(iel) + dfrcxt(2 ,iel)
-      frcxt(3 ,iel) = frcxt(3 ,iel) * cell_is_active(iel) + dfrcxt(3 ,iel)
-    enddo
-
     if (irangp.ge.0.or.iperio.eq.1) then
       call synvin(frcxt)
     endif
-
   endif
 
 endif
@@ -1060,7 +1060,8 @@ module optcal
   !> at a calculation restart, it is mandatory for the user to set \ref icdpar
   !> explicitly to -1, otherwise the distance to the wall used will not
   !> correspond to the actual position of the walls.\n The former algorithm
-  !> is not compatible with parallelism nor periodicity. Also, whatever the
+  !> (distance to the nearest wall face center) is not compatible with
+  !> periodicity. Also, whatever the
   !> value chosen for \ref icdpar, the calculation of the distance to the wall
   !> is made at the most> once for all at the beginning of the calculation; it
   !> is therefore not compatible with moving walls. Please contact the
@@ -704,17 +704,6 @@ if (iperot.gt.0) then
   endif
 endif
 
-!===============================================================================
-! 5. TABLEAUX DE parall : formats 6000 (limitations)
-!===============================================================================
-
-! --- parallelisme incompatible avec le mode de calcul
-!       direct de la distance a la paroi
-if (irangp.ge.0.and.ineedy.eq.1.and.abs(icdpar).eq.2) then
-  write(nfecra,6005)irangp, icdpar
-  iok = iok + 1
-endif
-
 !===============================================================================
 ! 6. METHODE ALE (albase, alstru)
 !===============================================================================
@@ -1615,28 +1604,6 @@ endif
 '@',                                                            /,&
 '@',                                                            /,&
 '@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@',/,&
-'@',                                                            /)
- 6005 format(                                                     &
-'@',                                                            /,&
-'@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@',/,&
-'@',                                                            /,&
-'@ @@  WARNING:   STOP WHILE READING INPUT DATA',               /,&
-'@    =========',                                               /,&
-'@    THIS METHOD FOR COMPUTING WALL DISTANCES',                /,&
-'@    IS NOT COMPATIBLE WITH PARALLEL COMPUTING',               /,&
-'@',                                                            /,&
-'@  Computation CAN NOT run',                                   /,&
-'@',                                                            /,&
-'@  The present CPU has rank', i10,                             /,&
-'@',                                                            /,&
-'@  Wall distance is necessary for RSTM wall echo terms, or,',  /,&
-'@     van Driest damping or k-omega SST).',                    /,&
-'@  The method for computing wall distance defined by',         /,&
-'@    ICDPAR = ', i10, ' does not allow for parallel computing', /,&
-'@',                                                            /,&
-'@  Use ICDPAR = 1 or -1.',                                     /,&
-'@',                                                            /,&
-'@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@',/,&
 '@',                                                            /)
  7010 format(                                                     &
 '@',                                                            /,&
@@ -48,6 +48,10 @@
 #include <string.h>
 #include <stdlib.h>
 
+#if defined(HAVE_MMAP)
+#include <sys/mman.h>
+#endif
+
 /*
  * Optional library and BFT headers
  */
@@ -80,6 +84,26 @@ BEGIN_C_DECLS
 
   The functions provided here are otherwise based on the matching C library
   functions.
+
+  Large blocks may optionally be handled by a pool (see
+  \ref bft_mem_pool_set_params and \ref bft_mem_pool_scope_begin).
+  Such blocks are aligned on 64 bytes, rounded up to one of 4 size classes
+  per power of 2, and, when freed, are kept in a cache from which
+  later allocations of the same class are served, avoiding repeated
+  page faults for large temporary arrays. Pooled blocks are never
+  zeroed, so their pages are placed (on NUMA systems) by the first
+  touching thread, and keep that placement when reused.
+  Blocks of at least 2 MiB are also marked as eligible for transparent
+  huge pages where available.
+
+  Memory may also be allocated in page-locked host or unified (managed)
+  memory using \ref BFT_MALLOC_HD, once the matching allocation functions
+  have been provided by the device support layer (see
+  \ref bft_mem_hd_set_functions). The allocation mode of such blocks is
+  recorded in a header placed just before the returned pointer, so
+  \ref BFT_REALLOC and \ref BFT_FREE handle them transparently, and
+  placement hints may be given using \ref bft_mem_prefetch and
+  \ref bft_mem_advise.
 */
 
 /*-------------------------------------------------------------------------------
@@ -119,6 +143,19 @@ BEGIN_C_DECLS
  * \param [in, out] _ptr  pointer to allocated memory.
  */
 
+/*! \fn BFT_MALLOC_HD(_ptr, _ni, _type, _mode)
+ * \brief Allocate memory for _ni elements of type _type, using a given
+ *        host/device allocation mode.
+ *
+ * This macro calls bft_mem_malloc_hd(), automatically setting the
+ * allocated variable name and source file name and line arguments.
+ *
+ * \param [out] _ptr  pointer to allocated memory.
+ * \param [in]  _ni   number of elements.
+ * \param [in]  _type element type.
+ * \param [in]  _mode allocation mode.
+ */
+
 /*! \fn BFT_MEMALIGN(_ptr, _align, _ni, _type)
  * \brief Allocate aligned memory for _ni elements of type _type.
  *
@@ -143,6 +180,24 @@ BEGIN_C_DECLS
 
 #define DIR_SEPARATOR '/'
 
+/* Memory pool parameters */
+
+#define _BFT_MEM_POOL_HEADER_SIZE   64    /* header size, also alignment */
+#define _BFT_MEM_POOL_PAGE_SIZE     4096  /* minimum block base alignment */
+#define _BFT_MEM_POOL_HUGE_SIZE     (2*1024*1024)
+#define _BFT_MEM_POOL_N_CLASSES     (64*4)
+
+#define _BFT_MEM_POOL_MAGIC         0x626674706f6f6cUL
+
+/* Host/device block magic number */
+
+#define _BFT_MEM_HD_MAGIC           0x6266746864616cUL
+
+/* Tagged block header size and magic number */
+
+#define _BFT_MEM_TAG_HEADER_SIZE    16    /* keeps malloc() alignment */
+#define _BFT_MEM_TAG_MAGIC          0x62667474UL
+
 /*-------------------------------------------------------------------------------
  * Local type definitions
  *-----------------------------------------------------------------------------*/
@@ -158,6 +213,47 @@ struct _bft_mem_block_t {
 
 };
 
+/*
+ * Header of memory pool blocks (placed just before the returned pointer)
+ */
+
+typedef struct {
+
+  uintptr_t  magic;     /* _BFT_MEM_POOL_MAGIC ^ header address */
+  size_t     size;      /* block size, including header */
+  size_t     used;      /* requested size */
+  void      *next;      /* next cached block of same size class */
+  int        tag;       /* subsystem tag, or -1 if not accounted */
+
+} _bft_mem_pool_header_t;
+
+/*
+ * Header of host/device blocks (placed just before the returned pointer,
+ * with the same offset relative to a page as memory pool blocks).
+ */
+
+typedef struct {
+
+  uintptr_t       magic;     /* _BFT_MEM_HD_MAGIC ^ header address */
+  void           *base;      /* base address of allocated block */
+  size_t          used;      /* requested size */
+  bft_mem_mode_t  mode;      /* allocation mode */
+  int             tag;       /* subsystem tag, or -1 if not accounted */
+
+} _bft_mem_hd_header_t;
+
+/*
+ * Header of tagged standard blocks (placed just before the returned pointer)
+ */
+
+typedef struct {
+
+  uint32_t   magic;     /* _BFT_MEM_TAG_MAGIC ^ header address (low bits) */
+  int32_t    tag;       /* subsystem tag */
+  size_t     used;      /* requested size */
+
+} _bft_mem_tag_header_t;
+
 /*-----------------------------------------------------------------------------
  * Local function prototypes
  *-----------------------------------------------------------------------------*/
@@ -211,6 +307,54 @@ static bft_error_handler_t  *_bft_mem_error_handler
 static omp_lock_t _bft_mem_lock;
 #endif
 
+static int  _bft_mem_thread_safe = 0;  /* lock even outside OpenMP
+                                          parallel regions if nonzero */
+
+/* Memory pool */
+
+static size_t  _bft_mem_pool_min_size = 256*1024;
+static size_t  _bft_mem_pool_max_cached = 0;
+static size_t  _bft_mem_pool_cached = 0;
+static int     _bft_mem_pool_scope_depth = 0;
+
+static size_t  _bft_mem_pool_n_live = 0;
+static size_t  _bft_mem_pool_n_allocs = 0;
+static size_t  _bft_mem_pool_n_reuses = 0;
+static size_t  _bft_mem_pool_cached_max = 0;
+
+static _bft_mem_pool_header_t  *_bft_mem_pool_cache[_BFT_MEM_POOL_N_CLASSES];
+
+#if defined(HAVE_OPENMP)
+static int         _bft_mem_pool_lock_initialized = 0;
+static omp_lock_t  _bft_mem_pool_lock;
+#endif
+
+/* Host/device allocation */
+
+static bft_mem_hd_malloc_t    *_bft_mem_hd_malloc_func = NULL;
+static bft_mem_hd_free_t      *_bft_mem_hd_free_func = NULL;
+static bft_mem_hd_prefetch_t  *_bft_mem_hd_prefetch_func = NULL;
+static bft_mem_hd_advise_t    *_bft_mem_hd_advise_func = NULL;
+
+static size_t  _bft_mem_hd_n_live = 0;
+
+/* Tagged allocation accounting */
+
+static int  _bft_mem_tag_active = 0;
+static int  _bft_mem_tag_used = 0;  /* nonzero once activated */
+static int  _bft_mem_tag_current = BFT_MEM_TAG_OTHER;
+
+static size_t  _bft_mem_tag_cur[BFT_MEM_N_TAGS];
+static size_t  _bft_mem_tag_max[BFT_MEM_N_TAGS];
+
+static const char  *_bft_mem_tag_names[] = {"other",
+                                            "mesh",
+                                            "fields",
+                                            "matrices",
+                                            "multigrid",
+                                            "Lagrangian",
+                                            "postprocessing"};
+
 /*-----------------------------------------------------------------------------
  * Local function definitions
  *-----------------------------------------------------------------------------*/
@@ -547,25 +691,706 @@ _bft_mem_block_free(const void *p_free)
        idx > 0 && (_bft_mem_global_block_array + idx)->p_bloc != p_free;
        idx--);
 
-  if ((_bft_mem_global_block_array + idx)->p_bloc != p_free)
-    _bft_mem_error(__FILE__, __LINE__, 0,
-                   _("Adress [%10p] does not correspond to "
-                     "the beginning of an allocated block."),
-                   p_free);
+  if ((_bft_mem_global_block_array + idx)->p_bloc != p_free)
+    _bft_mem_error(__FILE__, __LINE__, 0,
+                   _("Adress [%10p] does not correspond to "
+                     "the beginning of an allocated block."),
+                   p_free);
+
+  else {
+
+    /* We move the contents of the array's final block to the position
+       of the freed block, and shorten the array's useful part by one. */
+
+    pinfo = _bft_mem_global_block_array + idx;
+    pmove = _bft_mem_global_block_array + _bft_mem_global_block_nbr - 1;
+    pinfo->p_bloc = pmove->p_bloc;
+    pinfo->size   = pmove->size;
+
+    _bft_mem_global_block_nbr -= 1;
+
+  }
+}
+
+/*
+ * Return tag to be assigned to a new block.
+ *
+ * returns:
+ *   current subsystem tag, or -1 if accounting is not active.
+ */
+
+static inline int
+_bft_mem_tag_get(void)
+{
+  return (_bft_mem_tag_active) ? _bft_mem_tag_current : -1;
+}
+
+/*
+ * Update accounting for a tagged block.
+ *
+ * The current size is updated atomically; the peak update may miss
+ * a concurrent maximum by a few blocks, which is acceptable here.
+ *
+ * parameters:
+ *   tag      <-- block tag, or -1 if not accounted
+ *   size_add <-- added size
+ *   size_sub <-- removed size
+ */
+
+static inline void
+_bft_mem_tag_count(int     tag,
+                   size_t  size_add,
+                   size_t  size_sub)
+{
+  if (tag < 0)
+    return;
+
+  size_t s_cur;
+
+# pragma omp atomic capture
+  {
+    _bft_mem_tag_cur[tag] += size_add - size_sub;
+    s_cur = _bft_mem_tag_cur[tag];
+  }
+
+  if (s_cur > _bft_mem_tag_max[tag])
+    _bft_mem_tag_max[tag] = s_cur;
+}
+
+/*
+ * Return the tagged block header associated with a pointer, if present.
+ *
+ * Host/device and memory pool blocks must have been filtered first.
+ * Untagged blocks are preceded by the allocator's own block header,
+ * so reading the location is safe.
+ *
+ * parameters:
+ *   p <-- pointer to memory area
+ *
+ * returns:
+ *   pointer to header, or NULL if not a tagged block.
+ */
+
+static inline _bft_mem_tag_header_t *
+_bft_mem_tag_header(void  *p)
+{
+  if (_bft_mem_tag_used == 0)
+    return NULL;
+
+  _bft_mem_tag_header_t *h
+    = (_bft_mem_tag_header_t *)((char *)p - _BFT_MEM_TAG_HEADER_SIZE);
+
+  if (h->magic != (uint32_t)(_BFT_MEM_TAG_MAGIC ^ (uintptr_t)h))
+    return NULL;
+
+  return h;
+}
+
+/*
+ * Allocate a tagged standard block.
+ *
+ * parameters:
+ *   size <-- requested size
+ *   tag  <-- subsystem tag
+ *
+ * returns:
+ *   pointer to allocated memory, or NULL in case of failure.
+ */
+
+static void *
+_bft_mem_tag_malloc(size_t  size,
+                    int     tag)
+{
+  _bft_mem_tag_header_t *h = malloc(size + _BFT_MEM_TAG_HEADER_SIZE);
+
+  if (h == NULL)
+    return NULL;
+
+  h->magic = (uint32_t)(_BFT_MEM_TAG_MAGIC ^ (uintptr_t)h);
+  h->tag = tag;
+  h->used = size;
+
+  _bft_mem_tag_count(tag, size, 0);
+
+  return (char *)h + _BFT_MEM_TAG_HEADER_SIZE;
+}
+
+/*
+ * Initialize the memory pool lock if not done yet.
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ */
+
+static void
+_bft_mem_pool_lock_init(void)
+{
+#if defined(HAVE_OPENMP)
+  if (_bft_mem_pool_lock_initialized == 0) {
+    omp_init_lock(&_bft_mem_pool_lock);
+    _bft_mem_pool_lock_initialized = 1;
+  }
+#endif
+}
+
+/*
+ * Lock memory pool operations.
+ */
+
+static inline void
+_bft_mem_pool_lock_set(void)
+{
+#if defined(HAVE_OPENMP)
+  omp_set_lock(&_bft_mem_pool_lock);
+#endif
+}
+
+/*
+ * Unlock memory pool operations.
+ */
+
+static inline void
+_bft_mem_pool_lock_unset(void)
+{
+#if defined(HAVE_OPENMP)
+  omp_unset_lock(&_bft_mem_pool_lock);
+#endif
+}
+
+/*
+ * Return the size class of a memory pool block.
+ *
+ * Classes are defined with 4 subdivisions per power of 2, so that
+ * rounding up never wastes more than 25% of the requested size.
+ *
+ * parameters:
+ *   size     <-- requested block size, including header
+ *   class_id --> associated class id
+ *
+ * returns:
+ *   block size for the given class.
+ */
+
+static size_t
+_bft_mem_pool_class(size_t   size,
+                    int     *class_id)
+{
+  int k = 0;
+  for (size_t s = size; s > 1; s >>= 1)
+    k++;
+
+  size_t step = (size_t)1 << (k-2);
+  size_t n = (size + step - 1) / step;
+
+  if (n > 7) {
+    k += 1;
+    step *= 2;
+    n = 4;
+  }
+
+  *class_id = k*4 + (n-4);
+
+  return n*step;
+}
+
+/*
+ * Return the memory pool header associated with a pointer, if present.
+ *
+ * Pooled blocks are always allocated on (at least) page boundaries,
+ * with the returned pointer following the header, so only pointers
+ * with that offset relative to a page may be pooled blocks; the header
+ * is then always in the same page as the pointer, so reading it is safe.
+ *
+ * parameters:
+ *   p <-- pointer to memory area
+ *
+ * returns:
+ *   pointer to header, or NULL if not allocated through the pool.
+ */
+
+static inline _bft_mem_pool_header_t *
+_bft_mem_pool_header(void  *p)
+{
+  if (_bft_mem_pool_n_live == 0)
+    return NULL;
+
+  if (((uintptr_t)p & (_BFT_MEM_POOL_PAGE_SIZE - 1))
+      != _BFT_MEM_POOL_HEADER_SIZE)
+    return NULL;
+
+  _bft_mem_pool_header_t *h
+    = (_bft_mem_pool_header_t *)((char *)p - _BFT_MEM_POOL_HEADER_SIZE);
+
+  if (h->magic != (_BFT_MEM_POOL_MAGIC ^ (uintptr_t)h))
+    return NULL;
+
+  return h;
+}
+
+/*
+ * Release a memory pool block to the system.
+ *
+ * parameters:
+ *   h <-- pointer to block header
+ */
+
+static void
+_bft_mem_pool_release(_bft_mem_pool_header_t  *h)
+{
+  h->magic = 0;
+  free(h);
+}
+
+/*
+ * Release cached memory pool blocks until the cached size is
+ * no larger than a given value.
+ *
+ * Larger blocks are released first.
+ *
+ * parameters:
+ *   max_cached <-- maximum size of blocks remaining in cache
+ */
+
+static void
+_bft_mem_pool_trim(size_t  max_cached)
+{
+  _bft_mem_pool_lock_set();
+
+  for (int c = _BFT_MEM_POOL_N_CLASSES - 1;
+       c > -1 && _bft_mem_pool_cached > max_cached;
+       c--) {
+    while (   _bft_mem_pool_cache[c] != NULL
+           && _bft_mem_pool_cached > max_cached) {
+      _bft_mem_pool_header_t *h = _bft_mem_pool_cache[c];
+      _bft_mem_pool_cache[c] = h->next;
+      _bft_mem_pool_cached -= h->size;
+      _bft_mem_pool_release(h);
+    }
+  }
+
+  _bft_mem_pool_lock_unset();
+}
+
+/*
+ * Allocate a memory pool block.
+ *
+ * parameters:
+ *   size <-- requested size
+ *   tag  <-- subsystem tag, or -1 if not accounted
+ *
+ * returns:
+ *   pointer to allocated memory, or NULL in case of failure
+ *   (with errno set).
+ */
+
+static void *
+_bft_mem_pool_malloc(size_t  size,
+                     int     tag)
+{
+  int class_id;
+  size_t b_size = _bft_mem_pool_class(size + _BFT_MEM_POOL_HEADER_SIZE,
+                                      &class_id);
+
+  _bft_mem_pool_header_t *h = NULL;
+
+  _bft_mem_pool_lock_set();
+
+  h = _bft_mem_pool_cache[class_id];
+  if (h != NULL) {
+    _bft_mem_pool_cache[class_id] = h->next;
+    _bft_mem_pool_cached -= b_size;
+    _bft_mem_pool_n_reuses += 1;
+  }
+  _bft_mem_pool_n_allocs += 1;
+  _bft_mem_pool_n_live += 1;
+
+  _bft_mem_pool_lock_unset();
+
+  if (h == NULL) {
+
+    void *p_base = NULL;
+    size_t alignment = (b_size >= _BFT_MEM_POOL_HUGE_SIZE) ?
+      _BFT_MEM_POOL_HUGE_SIZE : _BFT_MEM_POOL_PAGE_SIZE;
+
+#if defined(HAVE_POSIX_MEMALIGN)
+    int retval = posix_memalign(&p_base, alignment, b_size);
+    if (retval != 0) {
+      errno = retval;
+      p_base = NULL;
+    }
+#endif
+
+    if (p_base == NULL) {
+      _bft_mem_pool_lock_set();
+      _bft_mem_pool_n_live -= 1;
+      _bft_mem_pool_lock_unset();
+      return NULL;
+    }
+
+#if defined(HAVE_MMAP) && defined(MADV_HUGEPAGE)
+    if (b_size >= _BFT_MEM_POOL_HUGE_SIZE)
+      madvise(p_base, b_size, MADV_HUGEPAGE);
+#endif
+
+    h = p_base;
+    h->magic = _BFT_MEM_POOL_MAGIC ^ (uintptr_t)h;
+    h->size = b_size;
+
+  }
+
+  h->used = size;
+  h->next = NULL;
+  h->tag = tag;
+
+  _bft_mem_tag_count(tag, size, 0);
+
+  return (char *)h + _BFT_MEM_POOL_HEADER_SIZE;
+}
+
+/*
+ * Free a memory pool block, keeping it in cache if possible.
+ *
+ * parameters:
+ *   h <-- pointer to block header
+ */
+
+static void
+_bft_mem_pool_free(_bft_mem_pool_header_t  *h)
+{
+  int class_id;
+  _bft_mem_pool_class(h->size, &class_id);
+
+  _bft_mem_tag_count(h->tag, 0, h->used);
+
+  _bft_mem_pool_lock_set();
+
+  _bft_mem_pool_n_live -= 1;
+
+  if (   _bft_mem_pool_scope_depth > 0
+      || _bft_mem_pool_cached + h->size <= _bft_mem_pool_max_cached) {
+    h->next = _bft_mem_pool_cache[class_id];
+    _bft_mem_pool_cache[class_id] = h;
+    _bft_mem_pool_cached += h->size;
+    if (_bft_mem_pool_cached > _bft_mem_pool_cached_max)
+      _bft_mem_pool_cached_max = _bft_mem_pool_cached;
+    h = NULL;
+  }
+
+  _bft_mem_pool_lock_unset();
+
+  if (h != NULL)
+    _bft_mem_pool_release(h);
+}
+
+/*
+ * Return the host/device block header associated with a pointer,
+ * if present.
+ *
+ * As for memory pool blocks, only pointers with a given offset relative
+ * to a page may be host/device blocks, and the header is then always
+ * in the same page as the pointer.
+ *
+ * parameters:
+ *   p <-- pointer to memory area
+ *
+ * returns:
+ *   pointer to header, or NULL if not allocated as a host/device block.
+ */
+
+static inline const _bft_mem_hd_header_t *
+_bft_mem_hd_header_const(const void  *p)
+{
+  if (_bft_mem_hd_n_live == 0 || p == NULL)
+    return NULL;
+
+  if (((uintptr_t)p & (_BFT_MEM_POOL_PAGE_SIZE - 1))
+      != _BFT_MEM_POOL_HEADER_SIZE)
+    return NULL;
+
+  const _bft_mem_hd_header_t *h
+    = (const _bft_mem_hd_header_t *)((const char *)p
+                                     - _BFT_MEM_POOL_HEADER_SIZE);
+
+  if (h->magic != (_BFT_MEM_HD_MAGIC ^ (uintptr_t)h))
+    return NULL;
+
+  return h;
+}
+
+/*
+ * Return the modifiable host/device block header associated with a
+ * pointer, if present.
+ *
+ * parameters:
+ *   p <-- pointer to memory area
+ *
+ * returns:
+ *   pointer to header, or NULL if not allocated as a host/device block.
+ */
+
+static inline _bft_mem_hd_header_t *
+_bft_mem_hd_header(void  *p)
+{
+  if (_bft_mem_hd_header_const(p) == NULL)
+    return NULL;
+
+  return (_bft_mem_hd_header_t *)((char *)p - _BFT_MEM_POOL_HEADER_SIZE);
+}
+
+/*
+ * Allocate a host/device block.
+ *
+ * The block is over-allocated by one page, so that the header may be
+ * placed at the start of a page whatever the alignment returned by
+ * the allocation function.
+ *
+ * parameters:
+ *   mode <-- allocation mode
+ *   size <-- requested size
+ *   tag  <-- subsystem tag, or -1 if not accounted
+ *
+ * returns:
+ *   pointer to allocated memory, or NULL in case of failure.
+ */
+
+static void *
+_bft_mem_hd_malloc(bft_mem_mode_t  mode,
+                   size_t          size,
+                   int             tag)
+{
+  size_t b_size = size + _BFT_MEM_POOL_PAGE_SIZE + _BFT_MEM_POOL_HEADER_SIZE;
+
+  char *p_base = _bft_mem_hd_malloc_func(mode, b_size);
+
+  if (p_base == NULL)
+    return NULL;
+
+  uintptr_t h_addr =   ((uintptr_t)p_base + _BFT_MEM_POOL_PAGE_SIZE - 1)
+                     & ~((uintptr_t)_BFT_MEM_POOL_PAGE_SIZE - 1);
+
+  _bft_mem_hd_header_t *h = (_bft_mem_hd_header_t *)h_addr;
+  h->magic = _BFT_MEM_HD_MAGIC ^ h_addr;
+  h->base = p_base;
+  h->used = size;
+  h->mode = mode;
+  h->tag = tag;
+
+  _bft_mem_tag_count(tag, size, 0);
+
+# pragma omp atomic
+  _bft_mem_hd_n_live += 1;
+
+  return (char *)h + _BFT_MEM_POOL_HEADER_SIZE;
+}
+
+/*
+ * Free a host/device block.
+ *
+ * parameters:
+ *   h <-- pointer to block header
+ */
+
+static void
+_bft_mem_hd_free(_bft_mem_hd_header_t  *h)
+{
+  void *p_base = h->base;
+  bft_mem_mode_t mode = h->mode;
+
+  _bft_mem_tag_count(h->tag, 0, h->used);
+
+  h->magic = 0;
+  _bft_mem_hd_free_func(mode, p_base);
+
+# pragma omp atomic
+  _bft_mem_hd_n_live -= 1;
+}
+
+/*
+ * Allocate memory, using the memory pool for large blocks when active.
+ *
+ * parameters:
+ *   size <-- requested size
+ *   tag  <-- subsystem tag, or -1 if not accounted
+ *
+ * returns:
+ *   pointer to allocated memory, or NULL in case of failure.
+ */
+
+static inline void *
+_bft_mem_raw_malloc(size_t  size,
+                    int     tag)
+{
+  if (   size >= _bft_mem_pool_min_size
+      && (_bft_mem_pool_max_cached > 0 || _bft_mem_pool_scope_depth > 0))
+    return _bft_mem_pool_malloc(size, tag);
+
+  if (tag > -1)
+    return _bft_mem_tag_malloc(size, tag);
+
+  return malloc(size);
+}
+
+/*
+ * Reallocate memory, handling memory pool blocks.
+ *
+ * Blocks not allocated through the pool are simply reallocated.
+ *
+ * parameters:
+ *   p    <-- pointer to previous memory location
+ *   size <-- requested size
+ *
+ * returns:
+ *   pointer to reallocated memory, or NULL in case of failure.
+ */
+
+static void *
+_bft_mem_raw_realloc(void    *p,
+                     size_t   size)
+{
+  /* Host/device blocks keep their allocation mode */
+
+  _bft_mem_hd_header_t *h_hd = _bft_mem_hd_header(p);
+
+  if (h_hd != NULL) {
+    void *p_new = _bft_mem_hd_malloc(h_hd->mode, size, h_hd->tag);
+    if (p_new != NULL) {
+      memcpy(p_new, p, (size < h_hd->used) ? size : h_hd->used);
+      _bft_mem_hd_free(h_hd);
+    }
+    return p_new;
+  }
+
+  _bft_mem_pool_header_t *h = _bft_mem_pool_header(p);
+
+  if (h == NULL) {
+
+    /* Tagged standard blocks keep their tag */
+
+    _bft_mem_tag_header_t *h_t = _bft_mem_tag_header(p);
+
+    if (h_t == NULL)
+      return realloc(p, size);
+
+    int tag = h_t->tag;
+    size_t old_size = h_t->used;
+
+    h_t->magic = 0;
+    _bft_mem_tag_header_t *h_new
+      = realloc(h_t, size + _BFT_MEM_TAG_HEADER_SIZE);
+    if (h_new == NULL) {
+      h_t->magic = (uint32_t)(_BFT_MEM_TAG_MAGIC ^ (uintptr_t)h_t);
+      return NULL;
+    }
+
+    h_new->magic = (uint32_t)(_BFT_MEM_TAG_MAGIC ^ (uintptr_t)h_new);
+    h_new->used = size;
+
+    _bft_mem_tag_count(tag, size, old_size);
+
+    return (char *)h_new + _BFT_MEM_TAG_HEADER_SIZE;
+  }
+
+  /* Keep block if size class is sufficient and not too large */
+
+  if (   size + _BFT_MEM_POOL_HEADER_SIZE <= h->size
+      && size >= h->size/2) {
+    _bft_mem_tag_count(h->tag, size, h->used);
+    h->used = size;
+    return p;
+  }
+
+  void *p_new = _bft_mem_raw_malloc(size, h->tag);
+
+  if (p_new != NULL) {
+    memcpy(p_new, p, (size < h->used) ? size : h->used);
+    _bft_mem_pool_free(h);
+  }
+
+  return p_new;
+}
+
+/*
+ * Free memory, handling memory pool blocks.
+ *
+ * parameters:
+ *   p <-- pointer to memory location
+ */
+
+static inline void
+_bft_mem_raw_free(void  *p)
+{
+  _bft_mem_hd_header_t *h_hd = _bft_mem_hd_header(p);
+
+  if (h_hd != NULL) {
+    _bft_mem_hd_free(h_hd);
+    return;
+  }
+
+  _bft_mem_pool_header_t *h = _bft_mem_pool_header(p);
+
+  if (h != NULL) {
+    _bft_mem_pool_free(h);
+    return;
+  }
+
+  _bft_mem_tag_header_t *h_t = _bft_mem_tag_header(p);
+
+  if (h_t != NULL) {
+    _bft_mem_tag_count(h_t->tag, 0, h_t->used);
+    h_t->magic = 0;
+    free(h_t);
+  }
+  else
+    free(p);
+}
+
+/*
+ * Update memory allocation counting and logging for an allocated block.
+ *
+ * parameters:
+ *   p_loc      <-- pointer to allocated memory
+ *   alloc_size <-- allocated size
+ *   var_name   <-- allocated variable name string
+ *   file_name  <-- name of calling source file
+ *   line_num   <-- line number in calling source file
+ */
+
+static void
+_bft_mem_count_malloc(void        *p_loc,
+                      size_t       alloc_size,
+                      const char  *var_name,
+                      const char  *file_name,
+                      int          line_num)
+{
+#if defined(HAVE_OPENMP)
+  int in_parallel = (omp_in_parallel() || _bft_mem_thread_safe);
+  if (in_parallel)
+    omp_set_lock(&_bft_mem_lock);
+#endif
+
+  _bft_mem_global_alloc_cur += alloc_size;
 
-  else {
+  if (_bft_mem_global_alloc_max < _bft_mem_global_alloc_cur)
+    _bft_mem_global_alloc_max = _bft_mem_global_alloc_cur;
 
-    /* We move the contents of the array's final block to the position
-       of the freed block, and shorten the array's useful part by one. */
+  if (_bft_mem_global_file != NULL) {
+    fprintf(_bft_mem_global_file, "\n  alloc: %-27s:%6d : %-39s: %9lu",
+            _bft_mem_basename(file_name), line_num,
+            var_name, (unsigned long)alloc_size);
+    fprintf(_bft_mem_global_file, " : (+%9lu) : %12lu : [%10p]",
+            (unsigned long)alloc_size,
+            (unsigned long)_bft_mem_global_alloc_cur,
+            p_loc);
+    fflush(_bft_mem_global_file);
+  }
 
-    pinfo = _bft_mem_global_block_array + idx;
-    pmove = _bft_mem_global_block_array + _bft_mem_global_block_nbr - 1;
-    pinfo->p_bloc = pmove->p_bloc;
-    pinfo->size   = pmove->size;
+  _bft_mem_block_malloc(p_loc, alloc_size);
 
-    _bft_mem_global_block_nbr -= 1;
+  _bft_mem_global_n_allocs += 1;
 
-  }
+#if defined(HAVE_OPENMP)
+  if (in_parallel)
+    omp_unset_lock(&_bft_mem_lock);
+#endif
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -743,6 +1568,24 @@ bft_mem_initialized(void)
   return _bft_mem_global_initialized;
 }
 
+/*!
+ * \brief Indicate whether bft_mem_...() functions may be called
+ * concurrently by threads not managed by OpenMP.
+ *
+ * This is the case when background threads (for example for
+ * asynchronous output) allocate memory, so memory tracking must then
+ * be protected by a lock even outside of OpenMP parallel regions.
+ * This protection requires OpenMP support.
+ *
+ * \param [in] mode  1 if concurrent calls may occur, 0 otherwise.
+ */
+
+void
+bft_mem_set_thread_safe(int  mode)
+{
+  _bft_mem_thread_safe = mode;
+}
+
 /*!
  * \brief Allocate memory for ni elements of size bytes.
  *
@@ -774,7 +1617,7 @@ bft_mem_malloc(size_t       ni,
 
   /* Allocate memory and check return */
 
-  p_loc = malloc(alloc_size);
+  p_loc = _bft_mem_raw_malloc(alloc_size, _bft_mem_tag_get());
 
   if (p_loc == NULL) {
     _bft_mem_error(file_name, line_num, errno,
@@ -787,38 +1630,7 @@ bft_mem_malloc(size_t       ni,
 
   /* Memory allocation counting */
 
-  {
-#if defined(HAVE_OPENMP)
-    int in_parallel = omp_in_parallel();
-    if (in_parallel)
-      omp_set_lock(&_bft_mem_lock);
-#endif
-
-    _bft_mem_global_alloc_cur += alloc_size;
-
-    if (_bft_mem_global_alloc_max < _bft_mem_global_alloc_cur)
-      _bft_mem_global_alloc_max = _bft_mem_global_alloc_cur;
-
-    if (_bft_mem_global_file != NULL) {
-      fprintf(_bft_mem_global_file, "\n  alloc: %-27s:%6d : %-39s: %9lu",
-              _bft_mem_basename(file_name), line_num,
-              var_name, (unsigned long)alloc_size);
-      fprintf(_bft_mem_global_file, " : (+%9lu) : %12lu : [%10p]",
-              (unsigned long)alloc_size,
-              (unsigned long)_bft_mem_global_alloc_cur,
-              p_loc);
-      fflush(_bft_mem_global_file);
-    }
-
-    _bft_mem_block_malloc(p_loc, alloc_size);
-
-    _bft_mem_global_n_allocs += 1;
-
-#if defined(HAVE_OPENMP)
-    if (in_parallel)
-      omp_unset_lock(&_bft_mem_lock);
-#endif
-  }
+  _bft_mem_count_malloc(p_loc, alloc_size, var_name, file_name, line_num);
 
   /* Return pointer to allocated memory */
 
@@ -873,7 +1685,7 @@ bft_mem_realloc(void        *ptr,
   /* If the old size equals the new size, nothing needs to be done. */
 
 #if defined(HAVE_OPENMP)
-  int in_parallel = omp_in_parallel();
+  int in_parallel = (omp_in_parallel() || _bft_mem_thread_safe);
   if (in_parallel)
     omp_set_lock(&_bft_mem_lock);
 #endif
@@ -905,7 +1717,7 @@ bft_mem_realloc(void        *ptr,
 
     size_diff = new_size - old_size;
 
-    p_loc = realloc(ptr, new_size);
+    p_loc = _bft_mem_raw_realloc(ptr, new_size);
 
     if (p_loc == NULL) {
       _bft_mem_error(file_name, line_num, errno,
@@ -992,7 +1804,7 @@ bft_mem_free(void        *ptr,
   if (_bft_mem_global_initialized != 0) {
 
 #if defined(HAVE_OPENMP)
-    int in_parallel = omp_in_parallel();
+    int in_parallel = (omp_in_parallel() || _bft_mem_thread_safe);
     if (in_parallel)
       omp_set_lock(&_bft_mem_lock);
 #endif
@@ -1022,7 +1834,7 @@ bft_mem_free(void        *ptr,
 #endif
   }
 
-  free(ptr);
+  _bft_mem_raw_free(ptr);
 
   return NULL;
 }
@@ -1091,7 +1903,7 @@ bft_mem_memalign(size_t       alignment,
 
   {
 #if defined(HAVE_OPENMP)
-    int in_parallel = omp_in_parallel();
+    int in_parallel = (omp_in_parallel() || _bft_mem_thread_safe);
     if (in_parallel)
       omp_set_lock(&_bft_mem_lock);
 #endif
@@ -1207,6 +2019,392 @@ bft_mem_have_memalign(void)
 #endif
 }
 
+/*!
+ * \brief Define memory pool parameters.
+ *
+ * When the maximum cached size is nonzero, blocks allocated by
+ * bft_mem_malloc() or bft_mem_realloc() whose size is at least the given
+ * minimum size are handled by the memory pool, and freed blocks are kept
+ * in a cache (up to the given maximum cumulative size) from which later
+ * allocations are served.
+ *
+ * Setting the maximum cached size to 0 releases all cached blocks and
+ * deactivates the pool outside of pool scopes. Blocks already allocated
+ * through the pool remain valid, and must be freed (or reallocated) using
+ * the bft_mem_...() functions, as always.
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ *
+ * \param [in] min_size    minimum size of pooled blocks (in bytes).
+ * \param [in] max_cached  maximum cumulative size of cached blocks
+ *                         (in bytes).
+ */
+
+void
+bft_mem_pool_set_params(size_t  min_size,
+                        size_t  max_cached)
+{
+#if defined(HAVE_POSIX_MEMALIGN)
+
+  _bft_mem_pool_lock_init();
+
+  /* Ensure size classes are multiples of the page size */
+
+  _bft_mem_pool_min_size = (min_size > 4*_BFT_MEM_POOL_PAGE_SIZE) ?
+    min_size : 4*_BFT_MEM_POOL_PAGE_SIZE;
+
+  _bft_mem_pool_max_cached = max_cached;
+
+  if (_bft_mem_pool_scope_depth == 0)
+    _bft_mem_pool_trim(_bft_mem_pool_max_cached);
+
+#endif
+}
+
+/*!
+ * \brief Begin a memory pool scope.
+ *
+ * Inside a scope (scopes may be nested), blocks eligible for the
+ * memory pool are handled by it even if the pool cache size has not
+ * been set, and are always cached when freed, so temporary arrays
+ * freed and reallocated in an iterative process are reused. At the end
+ * of the outermost scope, the cache is trimmed to the size defined by
+ * \ref bft_mem_pool_set_params.
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ */
+
+void
+bft_mem_pool_scope_begin(void)
+{
+#if defined(HAVE_POSIX_MEMALIGN)
+
+  _bft_mem_pool_lock_init();
+
+  _bft_mem_pool_lock_set();
+  _bft_mem_pool_scope_depth += 1;
+  _bft_mem_pool_lock_unset();
+
+#endif
+}
+
+/*!
+ * \brief End a memory pool scope.
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ */
+
+void
+bft_mem_pool_scope_end(void)
+{
+#if defined(HAVE_POSIX_MEMALIGN)
+
+  if (_bft_mem_pool_scope_depth < 1)
+    return;
+
+  _bft_mem_pool_lock_set();
+  _bft_mem_pool_scope_depth -= 1;
+  _bft_mem_pool_lock_unset();
+
+  if (_bft_mem_pool_scope_depth == 0)
+    _bft_mem_pool_trim(_bft_mem_pool_max_cached);
+
+#endif
+}
+
+/*!
+ * \brief Return memory pool statistics.
+ *
+ * \param [out] n_allocs    number of pooled block allocations, or NULL.
+ * \param [out] n_reuses    number of allocations served from cache, or NULL.
+ * \param [out] cached_max  maximum cached size (in kB), or NULL.
+ */
+
+void
+bft_mem_pool_get_stats(size_t  *n_allocs,
+                       size_t  *n_reuses,
+                       size_t  *cached_max)
+{
+  if (n_allocs != NULL)
+    *n_allocs = _bft_mem_pool_n_allocs;
+  if (n_reuses != NULL)
+    *n_reuses = _bft_mem_pool_n_reuses;
+  if (cached_max != NULL)
+    *cached_max = _bft_mem_pool_cached_max / 1024;
+}
+
+/*!
+ * \brief Activate or deactivate tagged allocation accounting.
+ *
+ * When active, blocks allocated by bft_mem_malloc(), bft_mem_realloc()
+ * or bft_mem_malloc_hd() are attributed to the current subsystem tag
+ * (see \ref bft_mem_tag_begin), and current and peak sizes are counted
+ * for each tag. This only adds a small header to each block and a few
+ * atomic updates, so it may be used in production runs, unlike full
+ * tracing. Blocks allocated while accounting is inactive are not counted,
+ * and blocks allocated by bft_mem_memalign() are never counted.
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ *
+ * \param [in] mode  1 to activate accounting, 0 to deactivate it.
+ */
+
+void
+bft_mem_tag_set_active(int  mode)
+{
+  _bft_mem_tag_active = (mode != 0) ? 1 : 0;
+
+  if (_bft_mem_tag_active)
+    _bft_mem_tag_used = 1;
+}
+
+/*!
+ * \brief Indicate if tagged allocation accounting is active.
+ *
+ * \returns 1 if accounting is active, 0 otherwise.
+ */
+
+int
+bft_mem_tag_is_active(void)
+{
+  return _bft_mem_tag_active;
+}
+
+/*!
+ * \brief Begin a tagged allocation scope.
+ *
+ * Blocks allocated inside the scope are attributed to the given tag,
+ * unless an enclosing scope already defined a tag other than
+ * BFT_MEM_TAG_OTHER, which then takes precedence (so that matrices built
+ * for multigrid coarse levels are counted as multigrid, for example).
+ * Reallocated blocks keep their initial tag.
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ *
+ * \param [in] tag  subsystem tag
+ *
+ * \returns previous tag, to be passed to \ref bft_mem_tag_end.
+ */
+
+bft_mem_tag_t
+bft_mem_tag_begin(bft_mem_tag_t  tag)
+{
+  bft_mem_tag_t prev_tag = _bft_mem_tag_current;
+
+  if (prev_tag == BFT_MEM_TAG_OTHER && tag >= 0 && tag < BFT_MEM_N_TAGS)
+    _bft_mem_tag_current = tag;
+
+  return prev_tag;
+}
+
+/*!
+ * \brief End a tagged allocation scope.
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ *
+ * \param [in] prev_tag  tag returned by the matching
+ *                       \ref bft_mem_tag_begin call.
+ */
+
+void
+bft_mem_tag_end(bft_mem_tag_t  prev_tag)
+{
+  _bft_mem_tag_current = prev_tag;
+}
+
+/*!
+ * \brief Return name associated with a subsystem tag.
+ *
+ * \param [in] tag  subsystem tag
+ *
+ * \returns pointer to tag name.
+ */
+
+const char *
+bft_mem_tag_name(bft_mem_tag_t  tag)
+{
+  if (tag < 0 || tag >= BFT_MEM_N_TAGS)
+    return NULL;
+
+  return _bft_mem_tag_names[tag];
+}
+
+/*!
+ * \brief Return allocation accounting statistics for a subsystem tag.
+ *
+ * \param [in]  tag       subsystem tag
+ * \param [out] size_cur  current allocated size (in kB), or NULL.
+ * \param [out] size_max  maximum allocated size (in kB), or NULL.
+ */
+
+void
+bft_mem_tag_get_stats(bft_mem_tag_t   tag,
+                      size_t         *size_cur,
+                      size_t         *size_max)
+{
+  size_t s_cur = 0, s_max = 0;
+
+  if (tag >= 0 && tag < BFT_MEM_N_TAGS) {
+    s_cur = _bft_mem_tag_cur[tag] / 1024;
+    s_max = _bft_mem_tag_max[tag] / 1024;
+  }
+
+  if (size_cur != NULL)
+    *size_cur = s_cur;
+  if (size_max != NULL)
+    *size_max = s_max;
+}
+
+/*!
+ * \brief Define functions used for host/device memory allocations.
+ *
+ * These functions are usually provided by the device support layer
+ * when a device is selected. As long as they are not defined,
+ * allocations with modes other than BFT_MEM_HOST fall back to standard
+ * host memory.
+ *
+ * Blocks already allocated with previously defined functions must
+ * be freed before those functions are replaced.
+ *
+ * \param [in] malloc_func   allocation function, or NULL
+ * \param [in] free_func     matching free function, or NULL
+ * \param [in] prefetch_func unified memory prefetch function, or NULL
+ * \param [in] advise_func   unified memory advice function, or NULL
+ */
+
+void
+bft_mem_hd_set_functions(bft_mem_hd_malloc_t    *malloc_func,
+                         bft_mem_hd_free_t      *free_func,
+                         bft_mem_hd_prefetch_t  *prefetch_func,
+                         bft_mem_hd_advise_t    *advise_func)
+{
+  if (malloc_func == NULL || free_func == NULL) {
+    malloc_func = NULL;
+    free_func = NULL;
+  }
+
+  _bft_mem_hd_malloc_func = malloc_func;
+  _bft_mem_hd_free_func = free_func;
+  _bft_mem_hd_prefetch_func = prefetch_func;
+  _bft_mem_hd_advise_func = advise_func;
+}
+
+/*!
+ * \brief Allocate memory for ni elements of size bytes, using a given
+ *        host/device allocation mode.
+ *
+ * For BFT_MEM_HOST mode, or if no host/device allocation functions
+ * are defined, this is equivalent to bft_mem_malloc().
+ *
+ * \param [in] ni        number of elements.
+ * \param [in] size      element size.
+ * \param [in] mode      allocation mode.
+ * \param [in] var_name  allocated variable name string.
+ * \param [in] file_name name of calling source file.
+ * \param [in] line_num  line number in calling source file.
+ *
+ * \returns pointer to allocated memory.
+ */
+
+void *
+bft_mem_malloc_hd(size_t           ni,
+                  size_t           size,
+                  bft_mem_mode_t   mode,
+                  const char      *var_name,
+                  const char      *file_name,
+                  int              line_num)
+{
+  if (mode == BFT_MEM_HOST || _bft_mem_hd_malloc_func == NULL)
+    return bft_mem_malloc(ni, size, var_name, file_name, line_num);
+
+  void       *p_loc;
+  size_t      alloc_size = ni * size;
+
+  if (ni == 0)
+    return NULL;
+
+  /* Allocate memory and check return */
+
+  p_loc = _bft_mem_hd_malloc(mode, alloc_size, _bft_mem_tag_get());
+
+  if (p_loc == NULL) {
+    _bft_mem_error(file_name, line_num, 0,
+                   _("Failure to allocate \"%s\" (%lu bytes, mode %d)"),
+                   var_name, (unsigned long)alloc_size, (int)mode);
+    return NULL;
+  }
+  else if (_bft_mem_global_initialized == 0)
+    return p_loc;
+
+  /* Memory allocation counting */
+
+  _bft_mem_count_malloc(p_loc, alloc_size, var_name, file_name, line_num);
+
+  return p_loc;
+}
+
+/*!
+ * \brief Return the host/device allocation mode of a given allocation.
+ *
+ * \param [in] ptr  pointer to start of allocated memory, or NULL.
+ *
+ * \returns allocation mode (BFT_MEM_HOST for memory not allocated through
+ *          bft_mem_malloc_hd() with another mode).
+ */
+
+bft_mem_mode_t
+bft_mem_get_mode(const void  *ptr)
+{
+  const _bft_mem_hd_header_t *h = _bft_mem_hd_header_const(ptr);
+
+  if (h != NULL)
+    return h->mode;
+
+  return BFT_MEM_HOST;
+}
+
+/*!
+ * \brief Prefetch unified memory to a given location.
+ *
+ * This function does nothing for memory not allocated with
+ * the BFT_MEM_HOST_DEVICE mode.
+ *
+ * \param [in] ptr       pointer to start of allocated memory, or NULL.
+ * \param [in] location  target location.
+ */
+
+void
+bft_mem_prefetch(const void          *ptr,
+                 bft_mem_location_t   location)
+{
+  const _bft_mem_hd_header_t *h = _bft_mem_hd_header_const(ptr);
+
+  if (   h != NULL && h->mode == BFT_MEM_HOST_DEVICE
+      && _bft_mem_hd_prefetch_func != NULL)
+    _bft_mem_hd_prefetch_func(ptr, h->used, location);
+}
+
+/*!
+ * \brief Give usage advice for unified memory.
+ *
+ * This function does nothing for memory not allocated with
+ * the BFT_MEM_HOST_DEVICE mode.
+ *
+ * \param [in] ptr     pointer to start of allocated memory, or NULL.
+ * \param [in] advice  usage advice.
+ */
+
+void
+bft_mem_advise(const void        *ptr,
+               bft_mem_advice_t   advice)
+{
+  const _bft_mem_hd_header_t *h = _bft_mem_hd_header_const(ptr);
+
+  if (   h != NULL && h->mode == BFT_MEM_HOST_DEVICE
+      && _bft_mem_hd_advise_func != NULL)
+    _bft_mem_hd_advise_func(ptr, h->used, advice);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -43,6 +43,108 @@ BEGIN_C_DECLS
  * Public types
  *============================================================================*/
 
+/* Host/device allocation modes */
+
+typedef enum {
+
+  BFT_MEM_HOST,            /* Standard host memory */
+  BFT_MEM_HOST_PINNED,     /* Page-locked host memory, for faster and
+                              asynchronous transfers to devices */
+  BFT_MEM_HOST_DEVICE      /* Unified (managed) memory, migrated between
+                              host and device on demand */
+
+} bft_mem_mode_t;
+
+/* Location hints for unified memory */
+
+typedef enum {
+
+  BFT_MEM_LOC_HOST,        /* Host */
+  BFT_MEM_LOC_DEVICE       /* Current device */
+
+} bft_mem_location_t;
+
+/* Usage advice for unified memory */
+
+typedef enum {
+
+  BFT_MEM_ADVISE_READ_MOSTLY,       /* Mostly read, so may be duplicated */
+  BFT_MEM_ADVISE_PREFER_HOST,       /* Preferably resides on host */
+  BFT_MEM_ADVISE_PREFER_DEVICE      /* Preferably resides on device */
+
+} bft_mem_advice_t;
+
+/* Subsystem tags for allocation accounting */
+
+typedef enum {
+
+  BFT_MEM_TAG_OTHER,       /* Allocations outside of tagged scopes */
+  BFT_MEM_TAG_MESH,        /* Mesh and mesh quantities */
+  BFT_MEM_TAG_FIELDS,      /* Field values and boundary coefficients */
+  BFT_MEM_TAG_MATRICES,    /* Matrix structures and coefficients */
+  BFT_MEM_TAG_MULTIGRID,   /* Multigrid hierarchy */
+  BFT_MEM_TAG_LAGRANGIAN,  /* Lagrangian particle tracking */
+  BFT_MEM_TAG_POST,        /* Postprocessing and output */
+
+  BFT_MEM_N_TAGS
+
+} bft_mem_tag_t;
+
+/*
+ * Function allocating host/device memory.
+ *
+ * parameters:
+ *   mode <-- allocation mode (BFT_MEM_HOST_PINNED or BFT_MEM_HOST_DEVICE)
+ *   size <-- size in bytes
+ *
+ * returns:
+ *   pointer to allocated memory, or NULL in case of failure.
+ */
+
+typedef void *
+(bft_mem_hd_malloc_t)(bft_mem_mode_t  mode,
+                      size_t          size);
+
+/*
+ * Function freeing host/device memory.
+ *
+ * parameters:
+ *   mode <-- allocation mode
+ *   p    <-- pointer to memory allocated by matching bft_mem_hd_malloc_t
+ */
+
+typedef void
+(bft_mem_hd_free_t)(bft_mem_mode_t   mode,
+                    void            *p);
+
+/*
+ * Function prefetching unified memory to a given location.
+ *
+ * parameters:
+ *   p        <-- pointer to memory
+ *   size     <-- size in bytes
+ *   location <-- target location
+ */
+
+typedef void
+(bft_mem_hd_prefetch_t)(const void          *p,
+                        size_t               size,
+                        bft_mem_location_t   location);
+
+/*
+ * Function giving usage advice for unified memory.
+ *
+ * parameters:
+ *   p      <-- pointer to memory
+ *   size   <-- size in bytes
+ *   advice <-- usage advice
+ */
+
+typedef void
+(bft_mem_hd_advise_t)(const void        *p,
+                      size_t             size,
+                      bft_mem_advice_t   advice);
+
 /*============================================================================
  * Public macros
  *============================================================================*/
@@ -120,6 +222,26 @@ _ptr = bft_mem_free(_ptr, #_ptr, __FILE__, __LINE__)
 _ptr = (_type *) bft_mem_memalign(_align, _ni, sizeof(_type), \
                                   #_ptr, __FILE__, __LINE__)
 
+/*
+ * Allocate memory for _ni items of type _type, using a given
+ * host/device allocation mode.
+ *
+ * This macro calls bft_mem_malloc_hd(), automatically setting the
+ * allocated variable name and source file name and line arguments.
+ * Memory is freed or reallocated using BFT_FREE and BFT_REALLOC, which
+ * preserve the allocation mode.
+ *
+ * parameters:
+ *   _ptr  --> pointer to allocated memory.
+ *   _ni   <-- number of items.
+ *   _type <-- element type.
+ *   _mode <-- allocation mode (bft_mem_mode_t).
+ */
+
+#define BFT_MALLOC_HD(_ptr, _ni, _type, _mode) \
+_ptr = (_type *) bft_mem_malloc_hd(_ni, sizeof(_type), _mode, \
+                                   #_ptr, __FILE__, __LINE__)
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -174,6 +296,22 @@ bft_mem_end(void);
 int
 bft_mem_initialized(void);
 
+/*
+ * Indicate whether bft_mem_...() functions may be called concurrently
+ * by threads not managed by OpenMP.
+ *
+ * This is the case when background threads (for example for asynchronous
+ * output) allocate memory, so memory tracking must then be protected by
+ * a lock even outside of OpenMP parallel regions. This protection
+ * requires OpenMP support.
+ *
+ * parameter:
+ *   mode <-- 1 if concurrent calls may occur, 0 otherwise.
+ */
+
+void
+bft_mem_set_thread_safe(int  mode);
+
 /*
  * Allocate memory for ni items of size bytes.
  *
@@ -336,6 +474,252 @@ bft_mem_error_handler_get(void);
 void
 bft_mem_error_handler_set(bft_error_handler_t *handler);
 
+/*
+ * Define memory pool parameters.
+ *
+ * When the maximum cached size is nonzero, blocks allocated by
+ * bft_mem_malloc() or bft_mem_realloc() whose size is at least the given
+ * minimum size are handled by the memory pool, and freed blocks are kept
+ * in a cache (up to the given maximum cumulative size) from which later
+ * allocations are served.
+ *
+ * Setting the maximum cached size to 0 releases all cached blocks and
+ * deactivates the pool outside of pool scopes. Blocks already allocated
+ * through the pool remain valid, and must be freed (or reallocated) using
+ * the bft_mem_...() functions, as always.
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ *
+ * parameters:
+ *   min_size   <-- minimum size of pooled blocks (in bytes).
+ *   max_cached <-- maximum cumulative size of cached blocks (in bytes).
+ */
+
+void
+bft_mem_pool_set_params(size_t  min_size,
+                        size_t  max_cached);
+
+/*
+ * Begin a memory pool scope.
+ *
+ * Inside a scope (scopes may be nested), blocks eligible for the
+ * memory pool are handled by it even if the pool cache size has not
+ * been set, and are always cached when freed, so temporary arrays
+ * freed and reallocated in an iterative process are reused. At the end
+ * of the outermost scope, the cache is trimmed to the size defined by
+ * bft_mem_pool_set_params().
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ */
+
+void
+bft_mem_pool_scope_begin(void);
+
+/*
+ * End a memory pool scope.
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ */
+
+void
+bft_mem_pool_scope_end(void);
+
+/*
+ * Return memory pool statistics.
+ *
+ * parameters:
+ *   n_allocs   --> number of pooled block allocations, or NULL.
+ *   n_reuses   --> number of allocations served from cache, or NULL.
+ *   cached_max --> maximum cached size (in kB), or NULL.
+ */
+
+void
+bft_mem_pool_get_stats(size_t  *n_allocs,
+                       size_t  *n_reuses,
+                       size_t  *cached_max);
+
+/*
+ * Activate or deactivate tagged allocation accounting.
+ *
+ * When active, blocks allocated by bft_mem_malloc(), bft_mem_realloc()
+ * or bft_mem_malloc_hd() are attributed to the current subsystem tag
+ * (see bft_mem_tag_begin()), and current and peak sizes are counted for
+ * each tag. This only adds a small header to each block and a few atomic
+ * updates, so it may be used in production runs, unlike full tracing.
+ * Blocks allocated while accounting is inactive are not counted, and
+ * blocks allocated by bft_mem_memalign() are never counted.
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ *
+ * parameters:
+ *   mode <-- 1 to activate accounting, 0 to deactivate it.
+ */
+
+void
+bft_mem_tag_set_active(int  mode);
+
+/*
+ * Indicate if tagged allocation accounting is active.
+ *
+ * returns:
+ *   1 if accounting is active, 0 otherwise.
+ */
+
+int
+bft_mem_tag_is_active(void);
+
+/*
+ * Begin a tagged allocation scope.
+ *
+ * Blocks allocated inside the scope are attributed to the given tag,
+ * unless an enclosing scope already defined a tag other than
+ * BFT_MEM_TAG_OTHER, which then takes precedence (so that matrices built
+ * for multigrid coarse levels are counted as multigrid, for example).
+ * Reallocated blocks keep their initial tag.
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ *
+ * parameters:
+ *   tag <-- subsystem tag
+ *
+ * returns:
+ *   previous tag, to be passed to bft_mem_tag_end().
+ */
+
+bft_mem_tag_t
+bft_mem_tag_begin(bft_mem_tag_t  tag);
+
+/*
+ * End a tagged allocation scope.
+ *
+ * This function must be called outside of OpenMP parallel regions.
+ *
+ * parameters:
+ *   prev_tag <-- tag returned by the matching bft_mem_tag_begin() call.
+ */
+
+void
+bft_mem_tag_end(bft_mem_tag_t  prev_tag);
+
+/*
+ * Return name associated with a subsystem tag.
+ *
+ * parameters:
+ *   tag <-- subsystem tag
+ *
+ * returns:
+ *   pointer to tag name.
+ */
+
+const char *
+bft_mem_tag_name(bft_mem_tag_t  tag);
+
+/*
+ * Return allocation accounting statistics for a subsystem tag.
+ *
+ * parameters:
+ *   tag      <-- subsystem tag
+ *   size_cur --> current allocated size (in kB), or NULL.
+ *   size_max --> maximum allocated size (in kB), or NULL.
+ */
+
+void
+bft_mem_tag_get_stats(bft_mem_tag_t   tag,
+                      size_t         *size_cur,
+                      size_t         *size_max);
+
+/*
+ * Define functions used for host/device memory allocations.
+ *
+ * These functions are usually provided by the device support layer
+ * when a device is selected. As long as they are not defined,
+ * allocations with modes other than BFT_MEM_HOST fall back to standard
+ * host memory.
+ *
+ * parameters:
+ *   malloc_func   <-- allocation function, or NULL
+ *   free_func     <-- matching free function, or NULL
+ *   prefetch_func <-- unified memory prefetch function, or NULL
+ *   advise_func   <-- unified memory advice function, or NULL
+ */
+
+void
+bft_mem_hd_set_functions(bft_mem_hd_malloc_t    *malloc_func,
+                         bft_mem_hd_free_t      *free_func,
+                         bft_mem_hd_prefetch_t  *prefetch_func,
+                         bft_mem_hd_advise_t    *advise_func);
+
+/*
+ * Allocate memory for ni elements of size bytes, using a given
+ * host/device allocation mode.
+ *
+ * For BFT_MEM_HOST mode, or if no host/device allocation functions
+ * are defined, this is equivalent to bft_mem_malloc().
+ *
+ * parameters:
+ *   ni        <-- number of elements.
+ *   size      <-- element size.
+ *   mode      <-- allocation mode.
+ *   var_name  <-- allocated variable name string.
+ *   file_name <-- name of calling source file.
+ *   line_num  <-- line number in calling source file.
+ *
+ * returns:
+ *   pointer to allocated memory.
+ */
+
+void *
+bft_mem_malloc_hd(size_t           ni,
+                  size_t           size,
+                  bft_mem_mode_t   mode,
+                  const char      *var_name,
+                  const char      *file_name,
+                  int              line_num);
+
+/*
+ * Return the host/device allocation mode of a given allocation.
+ *
+ * parameters:
+ *   ptr <-- pointer to start of allocated memory, or NULL.
+ *
+ * returns:
+ *   allocation mode (BFT_MEM_HOST for memory not allocated through
+ *   bft_mem_malloc_hd() with another mode).
+ */
+
+bft_mem_mode_t
+bft_mem_get_mode(const void  *ptr);
+
+/*
+ * Prefetch unified memory to a given location.
+ *
+ * This function does nothing for memory not allocated with
+ * the BFT_MEM_HOST_DEVICE mode.
+ *
+ * parameters:
+ *   ptr      <-- pointer to start of allocated memory, or NULL.
+ *   location <-- target location.
+ */
+
+void
+bft_mem_prefetch(const void          *ptr,
+                 bft_mem_location_t   location);
+
+/*
+ * Give usage advice for unified memory.
+ *
+ * This function does nothing for memory not allocated with
+ * the BFT_MEM_HOST_DEVICE mode.
+ *
+ * parameters:
+ *   ptr    <-- pointer to start of allocated memory, or NULL.
+ *   advice <-- usage advice.
+ */
+
+void
+bft_mem_advise(const void        *ptr,
+               bft_mem_advice_t   advice);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -78,6 +78,25 @@ BEGIN_C_DECLS
 #define CS_ADVECTION_FIELD_ID_NOT_SET      -1
 #define CS_ADVECTION_FIELD_ID_TO_BE_SET    -2
 
+/* Cache of cellwise fluxes. Values related to a cell are valid if they
+   have been computed for the same state of the advection field (the state
+   is incremented at each update). Fluxes of definitions depending on the
+   evaluation time (analytic or DoF functions) are not cached. Dual face
+   fluxes are indexed as c2e, primal face fluxes as c2f. */
+
+typedef struct {
+
+  cs_flag_t    loc;         /* Locations of the cached fluxes */
+  int          state;       /* Incremented each time the field changes */
+
+  int         *d_state;     /* State of cached dual face fluxes by cell */
+  cs_real_t   *d_fluxes;    /* Cached dual face fluxes */
+
+  int         *p_state;     /* State of cached primal face fluxes by cell */
+  cs_real_t   *p_fluxes;    /* Cached primal face fluxes */
+
+} _cw_flux_cache_t;
+
 /*============================================================================
  * Private variables
  *============================================================================*/
@@ -125,6 +144,31 @@ _get_dim_def(const cs_adv_field_t   *adv)
   return dim;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if cellwise fluxes of an advection field may be cached.
+ *         Definitions by analytic or DoF functions depend on the evaluation
+ *         time, so that their fluxes are not cached.
+ *
+ * \param[in]      def      pointer to the definition of the advection field
+ *
+ * \return true if the cached fluxes only depend on the state of the field
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+_cw_flux_cache_is_usable(const cs_xdef_t   *def)
+{
+  if (def == NULL)
+    return false;
+
+  if (   def->type == CS_XDEF_BY_ANALYTIC_FUNCTION
+      || def->type == CS_XDEF_BY_DOF_FUNCTION)
+    return false;
+
+  return true;
+}
+
 /*============================================================================
  * Private function prototypes
  *============================================================================*/
@@ -513,6 +557,8 @@ cs_advection_field_add(const char                    *name,
   adv->bdy_flux_defs = NULL;
   adv->bdy_def_ids = NULL;
 
+  adv->cw_flux_cache = NULL;
+
   adv->cell_field_id = CS_ADVECTION_FIELD_ID_NOT_SET;
   adv->int_field_id = CS_ADVECTION_FIELD_ID_NOT_SET;
 
@@ -567,6 +613,16 @@ cs_advection_field_destroy_all(void)
     if (adv->n_bdy_flux_defs > 0) BFT_FREE(adv->bdy_flux_defs);
     if (adv->bdy_def_ids != NULL)   BFT_FREE(adv->bdy_def_ids);
 
+    _cw_flux_cache_t  *cache = adv->cw_flux_cache;
+    if (cache != NULL) {
+      BFT_FREE(cache->d_state);
+      BFT_FREE(cache->d_fluxes);
+      BFT_FREE(cache->p_state);
+      BFT_FREE(cache->p_fluxes);
+      BFT_FREE(cache);
+      adv->cw_flux_cache = NULL;
+    }
+
     BFT_FREE(adv->name);
     BFT_FREE(adv);
 
@@ -666,6 +722,17 @@ cs_advection_field_log_setup(void)
       cs_log_printf(CS_LOG_SETUP,
                     "  * %s | Postprocess the Courant number\n", adv->name);
 
+    if (adv->cw_flux_cache != NULL) {
+      const _cw_flux_cache_t  *cache = adv->cw_flux_cache;
+      cs_log_printf(CS_LOG_SETUP,
+                    "  * %s | Cellwise flux caching: dual faces: %s;"
+                    " primal faces: %s\n", adv->name,
+                    cs_base_strtf(cs_flag_test(cache->loc,
+                                               cs_flag_dual_face_byc)),
+                    cs_base_strtf(cs_flag_test(cache->loc,
+                                               cs_flag_primal_face)));
+    }
+
     /* Where fields are defined */
     bool  at_cells =
       (adv->cell_field_id > CS_ADVECTION_FIELD_ID_NOT_SET) ? true : false;
@@ -723,6 +790,68 @@ cs_advection_field_set_postprocess(cs_adv_field_t            *adv,
   adv->post_flag |= post_flag;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate the cellwise caching of the fluxes of an advection field.
+ *         Fluxes computed by \ref cs_advection_field_cw_dface_flux (if loc
+ *         includes cs_flag_dual_face_byc) and/or by
+ *         \ref cs_advection_field_cw_face_flux (if loc includes
+ *         cs_flag_primal_face) are then stored for each cell and reused by
+ *         all equations sharing this advection field, as long as the
+ *         field is not updated. Fluxes of definitions by analytic or DoF
+ *         functions, which depend on the evaluation time, are not cached.
+ *         Arrays are allocated in \ref cs_advection_field_finalize_setup.
+ *
+ * \param[in, out]  adv   pointer to a cs_adv_field_t structure
+ * \param[in]       loc   location(s) of the fluxes to cache
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_advection_field_set_cw_flux_caching(cs_adv_field_t            *adv,
+                                       cs_flag_t                  loc)
+{
+  if (adv == NULL)
+    bft_error(__FILE__, __LINE__, 0, _(_err_empty_adv));
+
+  _cw_flux_cache_t  *cache = adv->cw_flux_cache;
+
+  if (cache == NULL) {
+    BFT_MALLOC(cache, 1, _cw_flux_cache_t);
+    cache->loc = 0;
+    cache->state = 0;
+    cache->d_state = NULL;
+    cache->d_fluxes = NULL;
+    cache->p_state = NULL;
+    cache->p_fluxes = NULL;
+    adv->cw_flux_cache = cache;
+  }
+
+  cache->loc |= loc;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the cached cellwise fluxes of an advection field. This
+ *         has to be called each time the values used by the definition of
+ *         the advection field are modified outside
+ *         \ref cs_advection_field_update.
+ *
+ * \param[in, out]  adv   pointer to a cs_adv_field_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_advection_field_reset_cw_flux_cache(cs_adv_field_t            *adv)
+{
+  if (adv == NULL)
+    return;
+
+  _cw_flux_cache_t  *cache = adv->cw_flux_cache;
+  if (cache != NULL)
+    cache->state += 1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define the value of a cs_adv_field_t structure
@@ -1286,6 +1415,32 @@ cs_advection_field_finalize_setup(void)
 
     } /* More than one definition */
 
+    /* Allocate the optional cache of cellwise fluxes */
+    _cw_flux_cache_t  *cache = adv->cw_flux_cache;
+    if (cache != NULL) {
+
+      const cs_lnum_t  n_cells = cs_cdo_quant->n_cells;
+
+      if (cs_flag_test(cache->loc, cs_flag_dual_face_byc)) {
+        BFT_MALLOC(cache->d_state, n_cells, int);
+        BFT_MALLOC(cache->d_fluxes, cs_cdo_connect->c2e->idx[n_cells],
+                   cs_real_t);
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
+        for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+          cache->d_state[c_id] = -1;
+      }
+
+      if (cs_flag_test(cache->loc, cs_flag_primal_face)) {
+        BFT_MALLOC(cache->p_state, n_cells, int);
+        BFT_MALLOC(cache->p_fluxes, cs_cdo_connect->c2f->idx[n_cells],
+                   cs_real_t);
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
+        for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+          cache->p_state[c_id] = -1;
+      }
+
+    }
+
   } /* Loop on advection fields */
 
 }
@@ -2643,6 +2798,22 @@ cs_advection_field_cw_face_flux(const cs_cell_mesh_t       *cm,
     return;
   }
 
+  /* Use cached values if they are still valid */
+  _cw_flux_cache_t  *cache = adv->cw_flux_cache;
+  cs_real_t  *c_fluxes = NULL;
+
+  if (   cache != NULL && cache->p_fluxes != NULL
+      && _cw_flux_cache_is_usable(adv->definition)) {
+
+    c_fluxes = cache->p_fluxes + cs_cdo_connect->c2f->idx[cm->c_id];
+
+    if (cache->p_state[cm->c_id] == cache->state) {
+      memcpy(fluxes, c_fluxes, cm->n_fc*sizeof(cs_real_t));
+      return;
+    }
+
+  }
+
   cs_xdef_t  *def = adv->definition;
   assert(def != NULL); /* Sanity check */
 
@@ -2807,6 +2978,12 @@ cs_advection_field_cw_face_flux(const cs_cell_mesh_t       *cm,
 
   } /* Velocity vector */
 
+  /* Store the computed values in the cache */
+  if (c_fluxes != NULL) {
+    memcpy(c_fluxes, fluxes, cm->n_fc*sizeof(cs_real_t));
+    cache->p_state[cm->c_id] = cache->state;
+  }
+
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2836,6 +3013,22 @@ cs_advection_field_cw_dface_flux(const cs_cell_mesh_t     *cm,
     return;
   }
 
+  /* Use cached values if they are still valid */
+  _cw_flux_cache_t  *cache = adv->cw_flux_cache;
+  cs_real_t  *c_fluxes = NULL;
+
+  if (   cache != NULL && cache->d_fluxes != NULL
+      && _cw_flux_cache_is_usable(adv->definition)) {
+
+    c_fluxes = cache->d_fluxes + cs_cdo_connect->c2e->idx[cm->c_id];
+
+    if (cache->d_state[cm->c_id] == cache->state) {
+      memcpy(fluxes, c_fluxes, cm->n_ec*sizeof(cs_real_t));
+      return;
+    }
+
+  }
+
   cs_xdef_t  *def = adv->definition;
 
   /* Sanity checks */
@@ -3116,6 +3309,12 @@ cs_advection_field_cw_dface_flux(const cs_cell_mesh_t     *cm,
 
   } /* def_type */
 
+  /* Store the computed values in the cache */
+  if (c_fluxes != NULL) {
+    memcpy(c_fluxes, fluxes, cm->n_ec*sizeof(cs_real_t));
+    cache->d_state[cm->c_id] = cache->state;
+  }
+
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3142,6 +3341,8 @@ cs_advection_field_update(cs_real_t    t_eval,
     if (t_eval > 0 && (adv->status & CS_ADVECTION_FIELD_STEADY))
       continue;
 
+    cs_advection_field_reset_cw_flux_cache(adv);
+
     /* GWF and NAVSTO categories of advection fields are updated elsewhere
        except if there is a field defined at vertices */
 
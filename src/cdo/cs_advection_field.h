@@ -190,6 +190,9 @@ typedef struct {
    *
    * \var bdy_flux_defs
    * Array of pointers to the definitions of the normal flux at the boundary
+   *
+   * \var cw_flux_cache
+   * Optional cellwise cache of fluxes (NULL if not used)
    */
 
   int                           id;
@@ -211,6 +214,9 @@ typedef struct {
   cs_xdef_t                   **bdy_flux_defs;
   short int                    *bdy_def_ids;
 
+  /* Optional: cache of cellwise fluxes shared among equations */
+  void                         *cw_flux_cache;
+
 } cs_adv_field_t;
 
 /*============================================================================
@@ -520,6 +526,41 @@ void
 cs_advection_field_set_postprocess(cs_adv_field_t            *adv,
                                    cs_flag_t                  post_flag);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate the cellwise caching of the fluxes of an advection field.
+ *         Fluxes computed by \ref cs_advection_field_cw_dface_flux (if loc
+ *         includes cs_flag_dual_face_byc) and/or by
+ *         \ref cs_advection_field_cw_face_flux (if loc includes
+ *         cs_flag_primal_face) are then stored for each cell and reused by
+ *         all equations sharing this advection field, as long as the
+ *         field is not updated. Fluxes of definitions by analytic or DoF
+ *         functions, which depend on the evaluation time, are not cached.
+ *         Arrays are allocated in \ref cs_advection_field_finalize_setup.
+ *
+ * \param[in, out]  adv   pointer to a cs_adv_field_t structure
+ * \param[in]       loc   location(s) of the fluxes to cache
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_advection_field_set_cw_flux_caching(cs_adv_field_t            *adv,
+                                       cs_flag_t                  loc);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the cached cellwise fluxes of an advection field. This
+ *         has to be called each time the values used by the definition of
+ *         the advection field are modified outside
+ *         \ref cs_advection_field_update.
+ *
+ * \param[in, out]  adv   pointer to a cs_adv_field_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_advection_field_reset_cw_flux_cache(cs_adv_field_t            *adv);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define the value of a cs_adv_field_t structure
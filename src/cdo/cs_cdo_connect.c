@@ -1077,9 +1077,11 @@ cs_cdo_connect_init(cs_mesh_t      *mesh,
   /* Already defined. */
   connect->interfaces[CS_CDO_CONNECT_VTX_SCAL] = mesh->vtx_interfaces;
 
-  /* CDO vertex- or vertex+cell-based schemes for scalar-valued variables */
+  /* CDO vertex- or vertex+cell-based schemes for scalar-valued variables.
+     Also needed by edge-based schemes (auxiliary space preconditioning) */
   if (vb_scheme_flag & CS_FLAG_SCHEME_SCALAR ||
-      vcb_scheme_flag & CS_FLAG_SCHEME_SCALAR) {
+      vcb_scheme_flag & CS_FLAG_SCHEME_SCALAR ||
+      eb_scheme_flag > 0) {
 
     _assign_vtx_ifs_rs(mesh, 1,
                        connect->interfaces + CS_CDO_CONNECT_VTX_SCAL,
@@ -1218,6 +1220,100 @@ cs_cdo_connect_free(cs_cdo_connect_t   *connect)
   return NULL;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build a coloring of the cells such that two cells of the same color
+ *        do not share any entity of the given cell --> entities connectivity
+ *        (vertices for instance). A greedy algorithm is used.
+ *        Cell ids of the same color are stored in increasing order.
+ *
+ * \param[in]  n_x       number of entities (vertices, faces...)
+ * \param[in]  c2x       cell --> entities connectivity
+ *
+ * \return a pointer to a new allocated cs_adjacency_t structure (color -->
+ *         cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_adjacency_t *
+cs_cdo_connect_build_cell_colors(cs_lnum_t               n_x,
+                                 const cs_adjacency_t   *c2x)
+{
+  if (c2x == NULL)
+    return NULL;
+
+  const cs_lnum_t  n_cells = c2x->n_elts;
+
+  cs_adjacency_t  *x2c = cs_adjacency_transpose(n_x, c2x);
+
+  /* Greedy coloring: each cell takes the lowest color which is not already
+     used by a neighboring cell (i.e. a cell sharing an entity) */
+  int  n_colors = 0, n_max_colors = 64;
+  int  *c_color = NULL;
+  cs_lnum_t  *color_mark = NULL;
+
+  BFT_MALLOC(c_color, n_cells, int);
+  BFT_MALLOC(color_mark, n_max_colors, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    for (cs_lnum_t j = c2x->idx[c_id]; j < c2x->idx[c_id+1]; j++) {
+
+      const cs_lnum_t  x_id = c2x->ids[j];
+      for (cs_lnum_t k = x2c->idx[x_id]; k < x2c->idx[x_id+1]; k++) {
+        const cs_lnum_t  c2_id = x2c->ids[k];
+        if (c2_id < c_id) /* Already colored */
+          color_mark[c_color[c2_id]] = c_id;
+      }
+
+    }
+
+    int  color = 0;
+    while (color < n_colors && color_mark[color] == c_id)
+      color++;
+
+    if (color == n_colors) { /* Add a new color */
+
+      if (n_colors == n_max_colors) {
+        n_max_colors *= 2;
+        BFT_REALLOC(color_mark, n_max_colors, cs_lnum_t);
+      }
+      n_colors++;
+
+    }
+
+    color_mark[color] = -1;
+    c_color[c_id] = color;
+
+  } /* Loop on cells */
+
+  cs_adjacency_destroy(&x2c);
+  BFT_FREE(color_mark);
+
+  /* Build the color --> cells connectivity */
+  cs_adjacency_t  *colors = cs_adjacency_create(0, -1, n_colors);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    colors->idx[c_color[c_id]+1] += 1;
+  for (int i = 0; i < n_colors; i++)
+    colors->idx[i+1] += colors->idx[i];
+
+  BFT_MALLOC(colors->ids, n_cells, cs_lnum_t);
+
+  cs_lnum_t  *shift = NULL;
+  BFT_MALLOC(shift, n_colors, cs_lnum_t);
+  for (int i = 0; i < n_colors; i++)
+    shift[i] = colors->idx[i];
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    colors->ids[shift[c_color[c_id]]++] = c_id;
+
+  BFT_FREE(shift);
+  BFT_FREE(c_color);
+
+  return colors;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute the discrete curl operator across each primal faces.
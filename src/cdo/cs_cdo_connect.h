@@ -220,6 +220,25 @@ cs_cdo_connect_init(cs_mesh_t      *mesh,
 cs_cdo_connect_t *
 cs_cdo_connect_free(cs_cdo_connect_t   *connect);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build a coloring of the cells such that two cells of the same color
+ *        do not share any entity of the given cell --> entities connectivity
+ *        (vertices for instance). A greedy algorithm is used.
+ *        Cell ids of the same color are stored in increasing order.
+ *
+ * \param[in]  n_x       number of entities (vertices, faces...)
+ * \param[in]  c2x       cell --> entities connectivity
+ *
+ * \return a pointer to a new allocated cs_adjacency_t structure (color -->
+ *         cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_adjacency_t *
+cs_cdo_connect_build_cell_colors(cs_lnum_t               n_x,
+                                 const cs_adjacency_t   *c2x);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute the discrete curl operator across each primal faces.
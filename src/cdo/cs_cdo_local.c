@@ -1937,6 +1937,94 @@ cs_face_mesh_light_build(const cs_cell_mesh_t    *cm,
   for (short int v = 0; v < fm->n_vf; v++) fm->wvf[v] *= invf;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate a cs_cell_sdm_cache_t structure.
+ *         The number of rows of the local matrix of a cell is the number of
+ *         entities related to this cell in the given adjacency, plus n_extra.
+ *         Cells are cached in increasing order until the memory budget is
+ *         reached.
+ *
+ * \param[in]  c2x        pointer to a cell -> entities adjacency
+ * \param[in]  n_extra    number of additional rows (e.g. cell DoF)
+ * \param[in]  max_size   memory budget in MB (<= 0: no cache)
+ *
+ * \return a pointer to a new allocated cs_cell_sdm_cache_t structure or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_cell_sdm_cache_t *
+cs_cell_sdm_cache_create(const cs_adjacency_t    *c2x,
+                         int                      n_extra,
+                         double                   max_size)
+{
+  if (c2x == NULL || max_size <= 0)
+    return NULL;
+
+  const size_t  max_n_vals = max_size*1024*1024/sizeof(cs_real_t);
+  const cs_lnum_t  n_x_cells = c2x->n_elts;
+
+  /* Count the number of cells which can be cached */
+  cs_lnum_t  n_cells = 0;
+  size_t  n_vals = 0;
+  while (n_cells < n_x_cells) {
+    size_t  n = c2x->idx[n_cells+1] - c2x->idx[n_cells] + n_extra;
+    if (n_vals + n*n > max_n_vals)
+      break;
+    n_vals += n*n;
+    n_cells++;
+  }
+
+  if (n_cells == 0)
+    return NULL;
+
+  cs_cell_sdm_cache_t  *cache = NULL;
+
+  BFT_MALLOC(cache, 1, cs_cell_sdm_cache_t);
+
+  cache->n_cells = n_cells;
+
+  BFT_MALLOC(cache->idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(cache->n_rows, n_cells, int);
+  BFT_MALLOC(cache->is_set, n_cells, bool);
+  BFT_MALLOC(cache->val, n_vals, cs_real_t);
+
+  cache->idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_lnum_t  n = c2x->idx[c_id+1] - c2x->idx[c_id] + n_extra;
+    cache->idx[c_id+1] = cache->idx[c_id] + n*n;
+    cache->n_rows[c_id] = n;
+    cache->is_set[c_id] = false;
+  }
+
+  return cache;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_cell_sdm_cache_t structure
+ *
+ * \param[in, out]  p_cache   pointer of pointer to a cs_cell_sdm_cache_t
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_sdm_cache_free(cs_cell_sdm_cache_t     **p_cache)
+{
+  cs_cell_sdm_cache_t  *cache = *p_cache;
+
+  if (cache == NULL)
+    return;
+
+  BFT_FREE(cache->idx);
+  BFT_FREE(cache->n_rows);
+  BFT_FREE(cache->is_set);
+  BFT_FREE(cache->val);
+
+  BFT_FREE(cache);
+  *p_cache = NULL;
+}
+
 /*----------------------------------------------------------------------------*/
 
 #undef _dp3
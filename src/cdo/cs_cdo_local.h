@@ -282,6 +282,23 @@ typedef struct {
 
 } cs_face_mesh_light_t;
 
+/*
+   A cs_cell_sdm_cache_t structure stores a square local dense matrix for
+   each cell (for instance a cellwise operator built from a time-invariant
+   property on a fixed mesh) so that it is computed only once.
+   Due to the memory budget, only the first cells may be cached.
+*/
+
+typedef struct {
+
+  cs_lnum_t    n_cells;   /* number of cells which may be cached */
+  cs_lnum_t   *idx;       /* index on values (size: n_cells + 1) */
+  int         *n_rows;    /* number of rows of each matrix */
+  bool        *is_set;    /* true if values are stored for this cell */
+  cs_real_t   *val;       /* cached values */
+
+} cs_cell_sdm_cache_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -302,6 +319,68 @@ extern cs_face_mesh_light_t  **cs_cdo_local_face_meshes_light;
  * Static inline function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Copy a cached local matrix (if available) for a given cell
+ *
+ * \param[in]      cache    pointer to a cs_cell_sdm_cache_t structure or NULL
+ * \param[in]      c_id     cell id
+ * \param[in, out] mat      pointer to the cs_sdm_t structure to set
+ *
+ * \return true if the matrix was retrieved from the cache, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+cs_cell_sdm_cache_get(const cs_cell_sdm_cache_t  *cache,
+                      cs_lnum_t                   c_id,
+                      cs_sdm_t                   *mat)
+{
+  if (cache == NULL)
+    return false;
+  if (c_id >= cache->n_cells)
+    return false;
+  if (cache->is_set[c_id] == false)
+    return false;
+
+  const int  n = cache->n_rows[c_id];
+
+  mat->n_rows = mat->n_cols = n;
+  memcpy(mat->val, cache->val + cache->idx[c_id], n*n*sizeof(cs_real_t));
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Store a local matrix in the cache (if there is room for it)
+ *
+ * \param[in, out] cache    pointer to a cs_cell_sdm_cache_t structure or NULL
+ * \param[in]      c_id     cell id
+ * \param[in]      mat      pointer to the cs_sdm_t structure to store
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+cs_cell_sdm_cache_set(cs_cell_sdm_cache_t  *cache,
+                      cs_lnum_t             c_id,
+                      const cs_sdm_t       *mat)
+{
+  if (cache == NULL)
+    return;
+  if (c_id >= cache->n_cells)
+    return;
+
+  const int  n = mat->n_rows;
+
+  assert(mat->n_cols == n);
+  assert(n*n <= cache->idx[c_id+1] - cache->idx[c_id]);
+
+  cache->n_rows[c_id] = n;
+  memcpy(cache->val + cache->idx[c_id], mat->val, n*n*sizeof(cs_real_t));
+  cache->is_set[c_id] = true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Retrieve the size of the auxiliary buffer of double
@@ -828,6 +907,38 @@ cs_face_mesh_light_build(const cs_cell_mesh_t    *cm,
                          short int                f,
                          cs_face_mesh_light_t    *fm);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate a cs_cell_sdm_cache_t structure.
+ *         The number of rows of the local matrix of a cell is the number of
+ *         entities related to this cell in the given adjacency, plus n_extra.
+ *         Cells are cached in increasing order until the memory budget is
+ *         reached.
+ *
+ * \param[in]  c2x        pointer to a cell -> entities adjacency
+ * \param[in]  n_extra    number of additional rows (e.g. cell DoF)
+ * \param[in]  max_size   memory budget in MB (<= 0: no cache)
+ *
+ * \return a pointer to a new allocated cs_cell_sdm_cache_t structure or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_cell_sdm_cache_t *
+cs_cell_sdm_cache_create(const cs_adjacency_t    *c2x,
+                         int                      n_extra,
+                         double                   max_size);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_cell_sdm_cache_t structure
+ *
+ * \param[in, out]  p_cache   pointer of pointer to a cs_cell_sdm_cache_t
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_sdm_cache_free(cs_cell_sdm_cache_t     **p_cache);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
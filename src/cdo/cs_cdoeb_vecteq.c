@@ -55,6 +55,7 @@
 
 #include "cs_cdo_diffusion.h"
 #include "cs_evaluate.h"
+#include "cs_param_sles.h"
 #include "cs_reco.h"
 
 #include "cs_cdoeb_vecteq.h"
@@ -515,6 +516,12 @@ cs_cdoeb_vecteq_init_common(const cs_cdo_quantities_t    *quant,
   cs_shared_time_step = time_step;
   cs_shared_ms = ms;
 
+  /* Auxiliary data needed if an AMS preconditioner is requested */
+  cs_param_sles_set_ams_auxiliary(connect->e2v,
+                                  connect->range_sets[CS_CDO_CONNECT_EDGE_SCAL],
+                                  connect->range_sets[CS_CDO_CONNECT_VTX_SCAL],
+                                  quant->vtx_coord);
+
   /* Structure used to build the final system by a cell-wise process */
   assert(cs_glob_n_threads > 0);  /* Sanity check */
 
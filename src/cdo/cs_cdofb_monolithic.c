@@ -671,8 +671,11 @@ _init_system_default(cs_cdofb_monolithic_t        *sc)
 {
   assert(sc != NULL); /* sanity check */
 
-  /* Initialize the local matrix */
-  cs_matrix_t  *matrix = cs_matrix_create(cs_shared_matrix_structure);
+  /* Initialize the local matrix. The matrix is kept between two
+     resolutions when the setup of the linear solver is reused. */
+  cs_matrix_t  *matrix = sc->msles->block_matrices[0];
+  if (matrix == NULL)
+    matrix = cs_matrix_create(cs_shared_matrix_structure);
 
   sc->msles->block_matrices[0] = matrix;
 
@@ -2119,6 +2122,9 @@ cs_cdofb_monolithic_init_scheme_context(const cs_navsto_param_t  *nsp,
 
   }
 
+  for (int i = 0; i < msles->n_row_blocks*msles->n_row_blocks; i++)
+    msles->block_matrices[i] = NULL;
+
   /* Set the pointer storing linear algebra features */
   sc->msles = msles;
 
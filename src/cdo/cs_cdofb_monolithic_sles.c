@@ -1152,6 +1152,180 @@ _schur_approximation(const cs_navsto_param_t       *nsp,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a block preconditioner and the setup of the SLES related to
+ *        its Schur complement approximation
+ *
+ * \param[in, out] p_sbp       double pointer to the structure to free
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_block_precond(cs_saddle_block_precond_t     **p_sbp)
+{
+  if (p_sbp == NULL || *p_sbp == NULL)
+    return;
+
+  cs_saddle_block_precond_t  *sbp = *p_sbp;
+
+  /* The Schur approximation is rebuilt at the next call */
+  cs_sles_free(sbp->schur_sles);
+
+  cs_saddle_block_precond_free(p_sbp);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set again the coefficients of the Schur complement approximation.
+ *        The matrix relies on the shared native matrix structure whose
+ *        coefficients may have been changed since the last call.
+ *
+ * \param[in, out] sbp         pointer to a cs_saddle_block_precond_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_restore_schur_matrix(cs_saddle_block_precond_t     *sbp)
+{
+  if (sbp->schur_matrix == NULL || sbp->schur_diag == NULL)
+    return;
+
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+
+  cs_lnum_t  db_size[4] = {1, 1, 1, 1}; /* 1, 1, 1, 1*1 */
+  cs_lnum_t  eb_size[4] = {1, 1, 1, 1}; /* 1, 1, 1, 1*1 */
+
+  cs_matrix_set_coefficients(sbp->schur_matrix, false, /* symmetry */
+                             db_size, eb_size,
+                             m->n_i_faces, i_face_cells,
+                             sbp->schur_diag, sbp->schur_xtra);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Retrieve the block preconditioner to use. If the setup is reused,
+ *        the preconditioner built during a previous call is returned.
+ *        Otherwise, a new one is created (with its Schur approximation).
+ *
+ * \param[in]      nsp         pointer to a cs_navsto_param_t structure
+ * \param[in]      eqp         pointer to a cs_equation_param_t structure
+ * \param[in]      block_type  type of block preconditioner
+ * \param[in]      with_schur  true if a Schur approximation is built
+ * \param[in]      ssys        pointer to a saddle-point system structure
+ * \param[in, out] msles       pointer to a cs_cdofb_monolithic_sles_t struct.
+ *
+ * \return a pointer to a cs_saddle_block_precond_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_saddle_block_precond_t *
+_get_block_precond(const cs_navsto_param_t       *nsp,
+                   const cs_equation_param_t     *eqp,
+                   cs_param_precond_block_t       block_type,
+                   bool                           with_schur,
+                   const cs_saddle_system_t      *ssys,
+                   cs_cdofb_monolithic_sles_t    *msles)
+{
+  cs_saddle_block_precond_t  *sbp = msles->sbp;
+
+  if (sbp != NULL) { /* Reuse the setup from a previous call */
+
+    assert(sbp->block_type == block_type);
+    _restore_schur_matrix(sbp);
+
+    return sbp;
+  }
+
+  sbp = cs_saddle_block_precond_create(block_type,
+                                       nsp->sles_param->schur_approximation,
+                                       eqp->sles_param,
+                                       msles->sles);
+
+  /* Define an approximation of the Schur complement */
+  if (with_schur)
+    _schur_approximation(nsp, ssys, msles->schur_sles, sbp);
+
+  return sbp;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Decide if the setup of the linear solvers (matrix, SLES for the
+ *        velocity block and block preconditioner) is kept for the next
+ *        resolution. The setup is rebuilt when the number of iterations
+ *        grows too much with respect to the number of iterations observed
+ *        just after the last setup (stagnation of the convergence).
+ *
+ * \param[in]      nslesp      pointer to a cs_navsto_param_sles_t structure
+ * \param[in]      n_iter      number of iterations of the last resolution
+ * \param[in, out] msles       pointer to a cs_cdofb_monolithic_sles_t struct.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_setup_reuse(const cs_navsto_param_sles_t  *nslesp,
+                    int                            n_iter,
+                    cs_cdofb_monolithic_sles_t    *msles)
+{
+  if (nslesp->setup_reuse_ratio <= 0) {
+    msles->keep_setup = false;
+    return;
+  }
+
+  if (msles->n_ref_iter < 0) { /* First resolution after a new setup */
+
+    msles->n_ref_iter = CS_MAX(n_iter, 1);
+    msles->keep_setup = true;
+
+  }
+  else if (n_iter > nslesp->setup_reuse_ratio*msles->n_ref_iter) {
+
+    if (nslesp->il_algo_verbosity > 0)
+      cs_log_printf(CS_LOG_DEFAULT,
+                    " -cvg- inner_algo: n_iters: %d (ref.: %d)"
+                    " --> New setup of the linear solvers\n",
+                    n_iter, msles->n_ref_iter);
+
+    /* The setup is rebuilt at the next resolution */
+    msles->n_ref_iter = -1;
+    msles->keep_setup = false;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Release the block preconditioner after a resolution. It is kept
+ *        for the next resolution if the setup is reused.
+ *
+ * \param[in]      nslesp      pointer to a cs_navsto_param_sles_t structure
+ * \param[in]      n_iter      number of iterations of the last resolution
+ * \param[in, out] msles       pointer to a cs_cdofb_monolithic_sles_t struct.
+ * \param[in, out] p_sbp       double pointer to the block preconditioner
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_release_block_precond(const cs_navsto_param_sles_t  *nslesp,
+                       int                            n_iter,
+                       cs_cdofb_monolithic_sles_t    *msles,
+                       cs_saddle_block_precond_t    **p_sbp)
+{
+  _update_setup_reuse(nslesp, n_iter, msles);
+
+  if (msles->keep_setup) {
+    msles->sbp = *p_sbp;
+    *p_sbp = NULL;
+  }
+  else {
+    msles->sbp = NULL;
+    _free_block_precond(p_sbp);
+  }
+}
+
 #if defined(HAVE_PETSC)
 /*----------------------------------------------------------------------------*/
 /*!
@@ -2369,12 +2543,21 @@ _apply_div_op_transpose(const cs_real_t   *div_op,
       const cs_real_t  *_div_f = div_op + 3*j;
 
       cs_real_t  *_dt_q = dt_q + 3*c2f->ids[j];
+#if CS_CDO_OMP_SYNC_SECTIONS > 0 /* OpenMP with critical section */
 #     pragma omp critical
       {
         _dt_q[0] += qc * _div_f[0];
         _dt_q[1] += qc * _div_f[1];
         _dt_q[2] += qc * _div_f[2];
       }
+#else  /* Use atomic barrier */
+#     pragma omp atomic
+      _dt_q[0] += qc * _div_f[0];
+#     pragma omp atomic
+      _dt_q[1] += qc * _div_f[1];
+#     pragma omp atomic
+      _dt_q[2] += qc * _div_f[2];
+#endif
 
     } /* Loop on cell faces */
 
@@ -2891,6 +3074,10 @@ cs_cdofb_monolithic_sles_create(void)
   msles->sles = NULL;
   msles->schur_sles = NULL;
 
+  msles->keep_setup = false;
+  msles->n_ref_iter = -1;
+  msles->sbp = NULL;
+
   msles->n_faces = 0;
   msles->n_cells = 0;
 
@@ -2940,6 +3127,8 @@ cs_cdofb_monolithic_sles_init(cs_lnum_t                     n_cells,
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Reset to zero rhs and clean the cs_sles_t structure
+ *         The matrices and the setup of the linear solvers are kept if the
+ *         setup is reused.
  *
  * \param[in, out]  msles   pointer to the structure to reset
  */
@@ -2951,13 +3140,17 @@ cs_cdofb_monolithic_sles_reset(cs_cdofb_monolithic_sles_t   *msles)
   if (msles == NULL)
     return;
 
-  for (int i = 0; i < msles->n_row_blocks*msles->n_row_blocks; i++)
-    cs_matrix_destroy(&(msles->block_matrices[i]));
-
   cs_matrix_destroy(&msles->compatible_laplacian);
 
-  cs_sles_free(msles->sles);
-  cs_sles_free(msles->schur_sles);
+  if (!msles->keep_setup) {
+
+    for (int i = 0; i < msles->n_row_blocks*msles->n_row_blocks; i++)
+      cs_matrix_destroy(&(msles->block_matrices[i]));
+
+    cs_sles_free(msles->sles);
+    cs_sles_free(msles->schur_sles);
+
+  }
 
   cs_lnum_t  full_size = 3*msles->n_faces + msles->n_cells;
 
@@ -2974,6 +3167,8 @@ cs_cdofb_monolithic_sles_reset(cs_cdofb_monolithic_sles_t   *msles)
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Free a part of the structure
+ *         The matrices and the setup of the linear solvers are kept if the
+ *         setup is reused.
  *
  * \param[in, out]  msles   pointer to the structure to clean
  */
@@ -2985,11 +3180,15 @@ cs_cdofb_monolithic_sles_clean(cs_cdofb_monolithic_sles_t   *msles)
   if (msles == NULL)
     return;
 
-  cs_sles_free(msles->sles);
-  cs_sles_free(msles->schur_sles);
+  if (!msles->keep_setup) {
+
+    cs_sles_free(msles->sles);
+    cs_sles_free(msles->schur_sles);
 
-  for (int i = 0; i < msles->n_row_blocks*msles->n_row_blocks; i++)
-    cs_matrix_destroy(&(msles->block_matrices[i]));
+    for (int i = 0; i < msles->n_row_blocks*msles->n_row_blocks; i++)
+      cs_matrix_destroy(&(msles->block_matrices[i]));
+
+  }
 
   /* b_f and b_c are stored consecutively */
   BFT_FREE(msles->b_f);
@@ -3011,6 +3210,18 @@ cs_cdofb_monolithic_sles_free(cs_cdofb_monolithic_sles_t   **p_msles)
   if (msles == NULL)
     return;
 
+  /* Setup kept from the last resolution */
+  if (msles->keep_setup) {
+
+    cs_sles_free(msles->sles);
+
+    for (int i = 0; i < msles->n_row_blocks*msles->n_row_blocks; i++)
+      cs_matrix_destroy(&(msles->block_matrices[i]));
+
+  }
+
+  _free_block_precond(&(msles->sbp));
+
   BFT_FREE(msles->block_matrices);
   BFT_FREE(msles->div_op);
   /* other pointer are shared, thus no free at this stage */
@@ -3501,40 +3712,31 @@ cs_cdofb_monolithic_krylov_block_precond(const cs_navsto_param_t       *nsp,
       else if (nslesp->strategy == CS_NAVSTO_SLES_UZAWA_SCHUR_GCR)
         block_type = CS_PARAM_PRECOND_BLOCK_UZAWA;
 
-      /* Define block preconditionning */
+      /* Define block preconditionning and an approximation of the Schur
+         complement (or reuse them) */
       cs_saddle_block_precond_t  *sbp =
-        cs_saddle_block_precond_create(block_type,
-                                       nslesp->schur_approximation,
-                                       eqp->sles_param,
-                                       msles->sles);
-
-      /* Define an approximation of the Schur complement */
-      _schur_approximation(nsp, ssys, msles->schur_sles, sbp);
+        _get_block_precond(nsp, eqp, block_type, true, ssys, msles);
 
       /* Call the inner linear algorithm */
       cs_saddle_gcr(nslesp->il_algo_restart, ssys, sbp,
                     xu, msles->p_c, saddle_info);
 
-      cs_saddle_block_precond_free(&sbp);
+      _release_block_precond(nslesp, saddle_info->n_algo_iter, msles, &sbp);
     }
     break;
 
   case CS_NAVSTO_SLES_DIAG_SCHUR_MINRES:
     {
-      /* Define block preconditionning */
+      /* Define block preconditionning and an approximation of the Schur
+         complement (or reuse them) */
       cs_saddle_block_precond_t  *sbp =
-        cs_saddle_block_precond_create(CS_PARAM_PRECOND_BLOCK_DIAG,
-                                       nslesp->schur_approximation,
-                                       eqp->sles_param,
-                                       msles->sles);
-
-      /* Define an approximation of the Schur complement */
-      _schur_approximation(nsp, ssys, msles->schur_sles, sbp);
+        _get_block_precond(nsp, eqp, CS_PARAM_PRECOND_BLOCK_DIAG, true,
+                           ssys, msles);
 
       /* Call the inner linear algorithm */
       cs_saddle_minres(ssys, sbp, xu, msles->p_c, saddle_info);
 
-      cs_saddle_block_precond_free(&sbp);
+      _release_block_precond(nslesp, saddle_info->n_algo_iter, msles, &sbp);
     }
     break;
 
@@ -3549,16 +3751,14 @@ cs_cdofb_monolithic_krylov_block_precond(const cs_navsto_param_t       *nsp,
 
   case CS_NAVSTO_SLES_USER:     /* User-defined strategy */
     {
-      /* Define block preconditionning by default */
+      /* Define block preconditionning by default (or reuse it) */
       cs_saddle_block_precond_t  *sbp =
-        cs_saddle_block_precond_create(CS_PARAM_PRECOND_BLOCK_DIAG,
-                                       nslesp->schur_approximation,
-                                       eqp->sles_param,
-                                       msles->sles);
+        _get_block_precond(nsp, eqp, CS_PARAM_PRECOND_BLOCK_DIAG, false,
+                           ssys, msles);
 
       cs_user_navsto_sles_solve(nslesp, ssys, sbp, xu, msles->p_c, saddle_info);
 
-      cs_saddle_block_precond_free(&sbp);
+      _release_block_precond(nslesp, saddle_info->n_algo_iter, msles, &sbp);
     }
     break;
 
@@ -4450,6 +4650,14 @@ cs_cdofb_monolithic_uzawa_al_solve(const cs_navsto_param_t       *nsp,
 
   int n_inner_iter = uza->info->n_inner_iter;
 
+  /* The setup of the velocity block can be kept only with in-house solvers
+     since the current matrix is used inside the iterative process. External
+     libraries rely on a copy of the matrix done during the setup step. */
+  if (eqp->sles_param->solver_class == CS_PARAM_SLES_CLASS_CS)
+    _update_setup_reuse(nsp->sles_param, n_inner_iter, msles);
+  else
+    msles->keep_setup = false;
+
   /* Last step: Free temporary memory */
   _free_uza_builder(&uza);
   cs_param_sles_free(&slesp);
@@ -4658,6 +4866,14 @@ cs_cdofb_monolithic_uzawa_al_incr_solve(const cs_navsto_param_t       *nsp,
 
   int n_inner_iter = uza->info->n_inner_iter;
 
+  /* The setup of the velocity block can be kept only with in-house solvers
+     since the current matrix is used inside the iterative process. External
+     libraries rely on a copy of the matrix done during the setup step. */
+  if (eqp->sles_param->solver_class == CS_PARAM_SLES_CLASS_CS)
+    _update_setup_reuse(nsp->sles_param, n_inner_iter, msles);
+  else
+    msles->keep_setup = false;
+
   /* Last step: Free temporary memory */
   _free_uza_builder(&uza);
 
@@ -39,6 +39,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_navsto_param.h"
+#include "cs_saddle_itsol.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -104,6 +105,17 @@ typedef struct {
   cs_real_t      graddiv_coef;  /* value of the grad-div coefficient in case
                                  * of augmented system */
 
+  /* Reuse of the setup across resolutions (cf. setup_reuse_ratio in
+   * cs_navsto_param_sles_t). If keep_setup is true, the block matrices, the
+   * setup of the main SLES and the block preconditioner are kept when the
+   * structure is reset or cleaned */
+
+  bool           keep_setup;
+  int            n_ref_iter;    /* number of iterations just after the last
+                                 * setup (-1 if not set) */
+
+  cs_saddle_block_precond_t  *sbp;  /* block preconditioner (or NULL) */
+
 } cs_cdofb_monolithic_sles_t;
 
 /*============================================================================
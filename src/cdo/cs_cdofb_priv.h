@@ -80,6 +80,7 @@ struct  _cs_cdofb_t {
   /* Pointer of function to build the diffusion term */
   cs_hodge_t               **diffusion_hodge;
   cs_hodge_compute_t        *get_stiffness_matrix;
+  cs_cell_sdm_cache_t       *diffusion_cache;
   cs_cdo_enforce_bc_t       *enforce_dirichlet;
   cs_cdo_enforce_bc_t       *enforce_robin_bc;
   cs_cdo_enforce_bc_t       *enforce_sliding;
@@ -344,8 +344,11 @@ _sfb_conv_diff_reac(const cs_equation_param_t     *eqp,
                                      diff_hodge);
 
     /* Define the local stiffness matrix: local matrix owned by the cellwise
-       builder (store in cb->loc) */
-    eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+       builder (store in cb->loc). Use the cached matrix if available. */
+    if (!cs_cell_sdm_cache_get(eqc->diffusion_cache, cm->c_id, cb->loc)) {
+      eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+      cs_cell_sdm_cache_set(eqc->diffusion_cache, cm->c_id, cb->loc);
+    }
 
     /* Add the local diffusion operator to the local system */
     cs_sdm_add(csys->mat, cb->loc);
@@ -897,6 +900,7 @@ cs_cdofb_scaleq_init_context(const cs_equation_param_t   *eqp,
 
   /* Diffusion term */
   eqc->get_stiffness_matrix = NULL;
+  eqc->diffusion_cache = NULL;
   eqc->diffusion_hodge = NULL;
 
   if (cs_equation_param_has_diffusion(eqp)) {
@@ -936,6 +940,14 @@ cs_cdofb_scaleq_init_context(const cs_equation_param_t   *eqp,
       eqb->msh_flag |= cs_quadrature_get_flag(diff_def->qtype,
                                               cs_flag_primal_cell);
 
+    /* Cellwise stiffness matrices may be kept from one build to another
+       if the diffusion property does not vary in time (face and cell DoFs) */
+    if (   eqp->cellwise_cache_size > 0
+        && cs_property_is_steady(eqp->diffusion_property))
+      eqc->diffusion_cache = cs_cell_sdm_cache_create(connect->c2f,
+                                                      1,
+                                                      eqp->cellwise_cache_size);
+
   } /* Diffusion */
 
   eqc->enforce_robin_bc = cs_cdo_diffusion_sfb_cost_robin;
@@ -1076,6 +1088,7 @@ cs_cdofb_scaleq_free_context(void   *data)
     return eqc;
 
   cs_hodge_free_context(&(eqc->diffusion_hodge));
+  cs_cell_sdm_cache_free(&(eqc->diffusion_cache));
   cs_hodge_free_context(&(eqc->mass_hodge));
 
   /* Free temporary buffers */
@@ -2494,8 +2507,11 @@ cs_cdofb_scaleq_balance(const cs_equation_param_t     *eqp,
                                          diff_hodge);
 
         /* Define the local stiffness matrix: local matrix owned by the cellwise
-           builder (store in cb->loc) */
-        eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+           builder (store in cb->loc). Use the cached matrix if available. */
+        if (!cs_cell_sdm_cache_get(eqc->diffusion_cache, cm->c_id, cb->loc)) {
+          eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+          cs_cell_sdm_cache_set(eqc->diffusion_cache, cm->c_id, cb->loc);
+        }
 
         cs_real_t  *res = cb->values;
         memset(res, 0, (cm->n_fc + 1)*sizeof(cs_real_t));
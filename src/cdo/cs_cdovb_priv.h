@@ -79,6 +79,10 @@ struct _cs_cdovb_t {
   /* Assembly process */
   cs_equation_assembly_t   *assemble;
 
+  /* Coloring of cells (cells of the same color share no vertex) used to
+     assemble without synchronization or NULL */
+  const cs_adjacency_t     *cell_colors;
+
   /* Boundary conditions */
   cs_flag_t                *vtx_bc_flag;
   cs_cdo_enforce_bc_t      *enforce_dirichlet;
@@ -91,6 +95,9 @@ struct _cs_cdovb_t {
   cs_hodge_t              **diffusion_hodge;
   cs_hodge_compute_t       *get_stiffness_matrix;
 
+  /* Cache of cellwise stiffness matrices (time-invariant property) or NULL */
+  cs_cell_sdm_cache_t      *diffusion_cache;
+
   /* Pointer of function to build the advection term */
   cs_cdovb_advection_t     *get_advection_matrix;
   cs_cdovb_advection_bc_t  *add_advection_bc;
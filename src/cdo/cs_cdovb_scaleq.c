@@ -59,6 +59,7 @@
 #include "cs_parall.h"
 #include "cs_post.h"
 #include "cs_quadrature.h"
+#include "cs_range_set.h"
 #include "cs_reco.h"
 #include "cs_scheme_geometry.h"
 #include "cs_search.h"
@@ -105,6 +106,32 @@ BEGIN_C_DECLS
 /* Algebraic system for CDO vertex-based discretization */
 typedef struct _cs_cdovb_t cs_cdovb_scaleq_t;
 
+/* Context for the matrix-free application of the global operator: the
+   cellwise systems are rebuilt at each matrix.vector product from the
+   same data as those used during the system building */
+
+typedef struct {
+
+  const cs_equation_param_t     *eqp;
+  const cs_equation_builder_t   *eqb;
+  const cs_cdovb_scaleq_t       *eqc;
+
+  const cs_real_t               *dir_values;  /* Dirichlet values at vertices */
+  const cs_lnum_t               *forced_ids;  /* Internal enforcement or NULL */
+  const cs_real_t               *field_tn;    /* Values of the variable field
+                                                 (only used for the rhs) */
+
+  cs_real_t                      t_eval;      /* Evaluation time */
+  cs_real_t                      inv_dtcur;   /* 1/dt (implicit Euler)
+                                                 or 0 (steady system) */
+
+  cs_real_t                     *x_full;      /* Work buffer (n_vertices) */
+  cs_real_t                     *y_full;      /* Work buffer (n_vertices) */
+  cs_real_t                     *diag;        /* Diagonal of the operator
+                                                 (rows of the local rank) */
+
+} cs_cdovb_scaleq_mf_t;
+
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
 /*============================================================================
@@ -115,6 +142,10 @@ typedef struct _cs_cdovb_t cs_cdovb_scaleq_t;
 static cs_cell_sys_t      **_svb_cell_system = NULL;
 static cs_cell_builder_t  **_svb_cell_builder = NULL;
 
+/* Coloring of cells used for an assembly without synchronization (shared
+   among equations and built only if needed) */
+static cs_adjacency_t      *_svb_cell_colors = NULL;
+
 /* Pointer to shared structures */
 static const cs_cdo_quantities_t    *cs_shared_quant;
 static const cs_cdo_connect_t       *cs_shared_connect;
@@ -331,10 +362,8 @@ _svb_init_cell_system(const cs_cell_mesh_t          *cm,
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief  Build the local matrices arising from the diffusion, advection,
- *         reaction terms.
- *         mass_hodge could be set to NULL if a Voronoi algo. is used.
- *         Otherwise, the mass matrix is computed.
+ * \brief  Build the local matrices arising from the diffusion and advection
+ *         terms and add them to the local system.
  *         Case of scalar-valued CDO-Vb schemes
  *
  * \param[in]      eqp         pointer to a cs_equation_param_t structure
@@ -342,7 +371,6 @@ _svb_init_cell_system(const cs_cell_mesh_t          *cm,
  * \param[in]      eqc         context for this kind of discretization
  * \param[in]      cm          pointer to a cellwise view of the mesh
  * \param[in, out] fm          pointer to a facewise view of the mesh
- * \param[in, out] mass_hodge  pointer to a cs_hodge_t structure (mass matrix)
  * \param[in, out] diff_hodge  pointer to a cs_hodge_t structure (diffusion)
  * \param[in, out] csys        pointer to a cellwise view of the system
  * \param[in, out] cb          pointer to a cellwise builder
@@ -350,32 +378,15 @@ _svb_init_cell_system(const cs_cell_mesh_t          *cm,
 /*----------------------------------------------------------------------------*/
 
 static void
-_svb_conv_diff_reac(const cs_equation_param_t     *eqp,
-                    const cs_equation_builder_t   *eqb,
-                    const cs_cdovb_scaleq_t       *eqc,
-                    const cs_cell_mesh_t          *cm,
-                    cs_face_mesh_t                *fm,
-                    cs_hodge_t                    *mass_hodge,
-                    cs_hodge_t                    *diff_hodge,
-                    cs_cell_sys_t                 *csys,
-                    cs_cell_builder_t             *cb)
+_svb_conv_diff(const cs_equation_param_t     *eqp,
+               const cs_equation_builder_t   *eqb,
+               const cs_cdovb_scaleq_t       *eqc,
+               const cs_cell_mesh_t          *cm,
+               cs_face_mesh_t                *fm,
+               cs_hodge_t                    *diff_hodge,
+               cs_cell_sys_t                 *csys,
+               cs_cell_builder_t             *cb)
 {
-  if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX) { /* MASS MATRIX
-                                                  * =========== */
-    assert(mass_hodge != NULL);
-
-    /* Build the mass matrix and store it in mass_hodge->matrix */
-    eqc->get_mass_matrix(cm, mass_hodge, cb);
-
-#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-    if (cs_dbg_cw_test(eqp, cm, csys)) {
-      cs_log_printf(CS_LOG_DEFAULT, ">> Celll mass matrix");
-      cs_sdm_dump(csys->c_id, csys->dof_ids, csys->dof_ids,
-                  mass_hodge->matrix);
-    }
-#endif
-  }
-
   if (cs_equation_param_has_diffusion(eqp)) {   /* DIFFUSION TERM
                                                  * ============== */
     assert(diff_hodge != NULL);
@@ -386,8 +397,11 @@ _svb_conv_diff_reac(const cs_equation_param_t     *eqp,
                                      diff_hodge);
 
     /* Define the local stiffness matrix: local matrix owned by the cellwise
-       builder (store in cb->loc) */
-    eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+       builder (store in cb->loc). Use the cached matrix if available. */
+    if (!cs_cell_sdm_cache_get(eqc->diffusion_cache, cm->c_id, cb->loc)) {
+      eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+      cs_cell_sdm_cache_set(eqc->diffusion_cache, cm->c_id, cb->loc);
+    }
 
     /* Add the local diffusion operator to the local system */
     cs_sdm_add(csys->mat, cb->loc);
@@ -433,7 +447,32 @@ _svb_conv_diff_reac(const cs_equation_param_t     *eqp,
       cs_cell_sys_dump("\n>> Cell system after advection", csys);
 #endif
   }
+}
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build the local matrix arising from the reaction terms and add it
+ *         to the local system. The mass matrix should have been computed
+ *         before if needed.
+ *         Case of scalar-valued CDO-Vb schemes
+ *
+ * \param[in]      eqp         pointer to a cs_equation_param_t structure
+ * \param[in]      eqb         pointer to a cs_equation_builder_t structure
+ * \param[in]      cm          pointer to a cellwise view of the mesh
+ * \param[in]      mass_hodge  pointer to a cs_hodge_t structure (mass matrix)
+ * \param[in, out] csys        pointer to a cellwise view of the system
+ * \param[in, out] cb          pointer to a cellwise builder
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_reac(const cs_equation_param_t     *eqp,
+          const cs_equation_builder_t   *eqb,
+          const cs_cell_mesh_t          *cm,
+          const cs_hodge_t              *mass_hodge,
+          cs_cell_sys_t                 *csys,
+          cs_cell_builder_t             *cb)
+{
   if (cs_equation_param_has_reaction(eqp)) { /* REACTION TERM
                                               * ============= */
 
@@ -465,6 +504,124 @@ _svb_conv_diff_reac(const cs_equation_param_t     *eqp,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build the local matrices arising from the diffusion, advection,
+ *         reaction terms.
+ *         mass_hodge could be set to NULL if a Voronoi algo. is used.
+ *         Otherwise, the mass matrix is computed.
+ *         Case of scalar-valued CDO-Vb schemes
+ *
+ * \param[in]      eqp         pointer to a cs_equation_param_t structure
+ * \param[in]      eqb         pointer to a cs_equation_builder_t structure
+ * \param[in]      eqc         context for this kind of discretization
+ * \param[in]      cm          pointer to a cellwise view of the mesh
+ * \param[in, out] fm          pointer to a facewise view of the mesh
+ * \param[in, out] mass_hodge  pointer to a cs_hodge_t structure (mass matrix)
+ * \param[in, out] diff_hodge  pointer to a cs_hodge_t structure (diffusion)
+ * \param[in, out] csys        pointer to a cellwise view of the system
+ * \param[in, out] cb          pointer to a cellwise builder
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_conv_diff_reac(const cs_equation_param_t     *eqp,
+                    const cs_equation_builder_t   *eqb,
+                    const cs_cdovb_scaleq_t       *eqc,
+                    const cs_cell_mesh_t          *cm,
+                    cs_face_mesh_t                *fm,
+                    cs_hodge_t                    *mass_hodge,
+                    cs_hodge_t                    *diff_hodge,
+                    cs_cell_sys_t                 *csys,
+                    cs_cell_builder_t             *cb)
+{
+  if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX) { /* MASS MATRIX
+                                                  * =========== */
+    assert(mass_hodge != NULL);
+
+    /* Build the mass matrix and store it in mass_hodge->matrix */
+    eqc->get_mass_matrix(cm, mass_hodge, cb);
+
+#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
+    if (cs_dbg_cw_test(eqp, cm, csys)) {
+      cs_log_printf(CS_LOG_DEFAULT, ">> Celll mass matrix");
+      cs_sdm_dump(csys->c_id, csys->dof_ids, csys->dof_ids,
+                  mass_hodge->matrix);
+    }
+#endif
+  }
+
+  _svb_conv_diff(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+
+  _svb_reac(eqp, eqb, cm, mass_hodge, csys, cb);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if two scalar-valued CDO-Vb equations lead to the same local
+ *         diffusion and advection matrices, i.e. they rely on the same
+ *         diffusion property, the same advection field and the same
+ *         discretization settings for these terms.
+ *
+ * \param[in]  eqp1    pointer to the cs_equation_param_t of the first eq.
+ * \param[in]  eqb1    pointer to the cs_equation_builder_t of the first eq.
+ * \param[in]  eqc1    context of the first equation
+ * \param[in]  eqp2    pointer to the cs_equation_param_t of the second eq.
+ * \param[in]  eqb2    pointer to the cs_equation_builder_t of the second eq.
+ * \param[in]  eqc2    context of the second equation
+ *
+ * \return true if the local diffusion/advection operators are the same
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_svb_same_conv_diff(const cs_equation_param_t     *eqp1,
+                    const cs_equation_builder_t   *eqb1,
+                    const cs_cdovb_scaleq_t       *eqc1,
+                    const cs_equation_param_t     *eqp2,
+                    const cs_equation_builder_t   *eqb2,
+                    const cs_cdovb_scaleq_t       *eqc2)
+{
+  const bool  has_diff = cs_equation_param_has_diffusion(eqp1);
+  const bool  has_conv = cs_equation_param_has_convection(eqp1);
+
+  if (has_diff != cs_equation_param_has_diffusion(eqp2) ||
+      has_conv != cs_equation_param_has_convection(eqp2))
+    return false;
+
+  if (has_diff) {
+
+    const cs_hodge_param_t  h1 = eqp1->diffusion_hodgep;
+    const cs_hodge_param_t  h2 = eqp2->diffusion_hodgep;
+
+    if (eqp1->diffusion_property != eqp2->diffusion_property ||
+        eqb1->diff_pty_uniform != eqb2->diff_pty_uniform ||
+        eqc1->get_stiffness_matrix != eqc2->get_stiffness_matrix ||
+        h1.inv_pty != h2.inv_pty ||
+        h1.type != h2.type ||
+        h1.algo != h2.algo ||
+        CS_ABS(h1.coef - h2.coef) > 0.)
+      return false;
+
+  }
+
+  if (has_conv) {
+
+    if (eqp1->adv_field != eqp2->adv_field ||
+        eqp1->adv_scaling_property != eqp2->adv_scaling_property ||
+        eqp1->adv_formulation != eqp2->adv_formulation ||
+        eqp1->adv_scheme != eqp2->adv_scheme ||
+        eqp1->adv_strategy != eqp2->adv_strategy ||
+        eqp1->adv_extrapol != eqp2->adv_extrapol ||
+        eqc1->get_advection_matrix != eqc2->get_advection_matrix ||
+        CS_ABS(eqp1->upwind_portion - eqp2->upwind_portion) > 0.)
+      return false;
+
+  }
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  First pass to apply boundary conditions enforced weakly in CDO-Vb
@@ -586,6 +743,75 @@ _svb_enforce_values(const cs_equation_param_t     *eqp,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Add the unsteady term with an implicit Euler time scheme to the
+ *          cellwise system
+ *
+ * \param[in]      eqp         pointer to a cs_equation_param_t structure
+ * \param[in]      eqb         pointer to a cs_equation_builder_t structure
+ * \param[in]      cm          pointer to a cellwise view of the mesh
+ * \param[in]      mass_hodge  pointer to a Hodge structure for the mass matrix
+ * \param[in]      inv_dtcur   inverse of the current time step
+ * \param[in, out] csys        pointer to a cellwise view of the system
+ * \param[in, out] cb          pointer to a cellwise builder
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_implicit_time_term(const cs_equation_param_t     *eqp,
+                        const cs_equation_builder_t   *eqb,
+                        const cs_cell_mesh_t          *cm,
+                        const cs_hodge_t              *mass_hodge,
+                        const cs_real_t                inv_dtcur,
+                        cs_cell_sys_t                 *csys,
+                        cs_cell_builder_t             *cb)
+{
+  if (!(eqb->time_pty_uniform))
+    cb->tpty_val = cs_property_value_in_cell(cm, eqp->time_property,
+                                             cb->t_pty_eval);
+
+  if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) { /* Mass lumping */
+
+    /* |c|*wvc = |dual_cell(v) cap c| */
+    CS_CDO_OMP_ASSERT(cs_eflag_test(eqb->msh_flag, CS_FLAG_COMP_PVQ));
+    const double  ptyc = cb->tpty_val * cm->vol_c * inv_dtcur;
+
+    /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
+     *       >> Update the cellwise system with the time matrix */
+    for (short int i = 0; i < cm->n_vc; i++) {
+
+      const double  dval =  ptyc * cm->wvc[i];
+
+      /* Update the RHS with values at time t_n */
+      csys->rhs[i] += dval * csys->val_n[i];
+
+      /* Add the diagonal contribution from time matrix */
+      csys->mat->val[i*(cm->n_vc + 1)] += dval;
+
+    }
+
+  }
+  else { /* Use the mass matrix */
+
+    const double  tpty_coef = cb->tpty_val * inv_dtcur;
+    const cs_sdm_t  *mass_mat = mass_hodge->matrix;
+
+    /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
+     *       >> Update the cellwise system with the time matrix */
+
+    /* Update rhs with csys->mat*p^n */
+    double  *time_pn = cb->values;
+    cs_sdm_square_matvec(mass_mat, csys->val_n, time_pn);
+    for (short int i = 0; i < csys->n_dofs; i++)
+      csys->rhs[i] += tpty_coef*time_pn[i];
+
+    /* Update the cellwise system with the time matrix */
+    cs_sdm_add_mult(csys->mat, tpty_coef, mass_mat);
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the residual normalization at the cellwise level according
@@ -642,6 +868,37 @@ _svb_cw_rhs_normalization(cs_param_resnorm_type_t     type,
   return _rhs_norm;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the list of cells to consider for a given color.
+ *         When no cell coloring is used, there is only one color gathering
+ *         all the cells.
+ *
+ * \param[in]   eqc            pointer to a cs_cdovb_scaleq_t structure
+ * \param[in]   color          id of the color
+ * \param[out]  n_color_cells  number of cells of this color
+ *
+ * \return a pointer to the list of cell ids or NULL (all cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static const cs_lnum_t *
+_svb_color_cells(const cs_cdovb_scaleq_t     *eqc,
+                 int                          color,
+                 cs_lnum_t                   *n_color_cells)
+{
+  const cs_adjacency_t  *colors = eqc->cell_colors;
+
+  if (colors == NULL) {
+    *n_color_cells = cs_shared_quant->n_cells;
+    return NULL;
+  }
+
+  *n_color_cells = colors->idx[color+1] - colors->idx[color];
+
+  return colors->ids + colors->idx[color];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Perform the assembly step for scalar-valued CDO Vb schemes
@@ -652,6 +909,9 @@ _svb_cw_rhs_normalization(cs_param_resnorm_type_t     type,
  * \param[in]      rs     pointer to a cs_range_set_t structure
  * \param[in, out] eqa    pointer to a cs_equation_assemble_t structure
  * \param[in, out] mav    pointer to a cs_matrix_assembler_values_t structure
+ *                        or NULL in matrix-free mode
+ * \param[in, out] diag   diagonal of the operator in matrix-free mode
+ *                        or NULL
  * \param[in, out] rhs    right-hand side array
  */
 /*----------------------------------------------------------------------------*/
@@ -663,10 +923,36 @@ _svb_assemble(const cs_cdovb_scaleq_t           *eqc,
               const cs_range_set_t              *rs,
               cs_equation_assemble_t            *eqa,
               cs_matrix_assembler_values_t      *mav,
+              cs_real_t                         *diag,
               cs_real_t                         *rhs)
 {
-  /* Matrix assembly */
-  eqc->assemble(csys->mat, csys->dof_ids, rs, eqa, mav);
+  /* Matrix assembly (only the diagonal is kept in matrix-free mode) */
+  if (mav != NULL)
+    eqc->assemble(csys->mat, csys->dof_ids, rs, eqa, mav);
+
+  if (eqc->cell_colors != NULL) {
+
+    /* Cells assembled concurrently have the same color and thus do not
+       share any vertex: no synchronization is needed */
+    if (mav == NULL)
+      for (int v = 0; v < cm->n_vc; v++)
+        diag[cm->v_ids[v]] += csys->mat->val[v*(cm->n_vc + 1)];
+
+    for (int v = 0; v < cm->n_vc; v++)
+      rhs[cm->v_ids[v]] += csys->rhs[v];
+
+    if (eqc->source_terms != NULL)
+      for (int v = 0; v < cm->n_vc; v++) /* Source term assembly */
+        eqc->source_terms[cm->v_ids[v]] += csys->source[v];
+
+    return;
+  }
+
+  if (mav == NULL) {
+    for (int v = 0; v < cm->n_vc; v++)
+#     pragma omp atomic
+      diag[cm->v_ids[v]] += csys->mat->val[v*(cm->n_vc + 1)];
+  }
 
   /* RHS assembly */
 #if CS_CDO_OMP_SYNC_SECTIONS > 0
@@ -676,25 +962,263 @@ _svb_assemble(const cs_cdovb_scaleq_t           *eqc,
       rhs[cm->v_ids[v]] += csys->rhs[v];
   }
 
-  if (eqc->source_terms != NULL) {
-#   pragma omp critical
-    {
-      for (int v = 0; v < cm->n_vc; v++) /* Source term assembly */
-        eqc->source_terms[cm->v_ids[v]] += csys->source[v];
-    }
-  }
-#else  /* Use atomic barrier */
+  if (eqc->source_terms != NULL) {
+#   pragma omp critical
+    {
+      for (int v = 0; v < cm->n_vc; v++) /* Source term assembly */
+        eqc->source_terms[cm->v_ids[v]] += csys->source[v];
+    }
+  }
+#else  /* Use atomic barrier */
+
+  for (int v = 0; v < cm->n_vc; v++)
+#   pragma omp atomic
+    rhs[cm->v_ids[v]] += csys->rhs[v];
+
+  if (eqc->source_terms != NULL) {
+    for (int v = 0; v < cm->n_vc; v++) /* Source term assembly */
+#     pragma omp atomic
+      eqc->source_terms[cm->v_ids[v]] += csys->source[v];
+  }
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Matrix.vector product with the global operator of a scalar-valued
+ *         CDO Vb scheme, without assembling it (matrix-free mode).
+ *         Cellwise systems are rebuilt (cached cellwise diffusion operators
+ *         are used if available) and applied to the local values of x.
+ *         This function matches the cs_matrix_shell_product_t prototype.
+ *
+ * \param[in]   input   pointer to a cs_cdovb_scaleq_mf_t structure
+ * \param[in]   x       multiplying vector values (rows of the local rank)
+ * \param[out]  y       resulting vector (rows of the local rank)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_matrix_free_product(const void        *input,
+                         const cs_real_t   *x,
+                         cs_real_t         *y)
+{
+  const cs_cdovb_scaleq_mf_t  *mf = (const cs_cdovb_scaleq_mf_t *)input;
+  const cs_equation_param_t  *eqp = mf->eqp;
+  const cs_equation_builder_t  *eqb = mf->eqb;
+  const cs_cdovb_scaleq_t  *eqc = mf->eqc;
+  const cs_cdo_connect_t  *connect = cs_shared_connect;
+  const cs_range_set_t  *rs = connect->range_sets[CS_CDO_CONNECT_VTX_SCAL];
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_lnum_t  n_vertices = quant->n_vertices;
+
+  cs_real_t  *x_full = mf->x_full;
+  cs_real_t  *y_full = mf->y_full;
+
+  /* Local view of x (values at shared vertices are synchronized) */
+  if (rs != NULL)
+    cs_range_set_scatter(rs, CS_REAL_TYPE, 1, x, x_full);
+  else
+    memcpy(x_full, x, n_vertices*sizeof(cs_real_t));
+
+# pragma omp parallel for if (n_vertices > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vertices; i++) y_full[i] = 0.;
+
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)
+  {
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+    int  t_id = omp_get_thread_num();
+#else
+    int  t_id = 0;
+#endif
+
+    cs_face_mesh_t  *fm = cs_cdo_local_get_face_mesh(t_id);
+    cs_cell_mesh_t  *cm = cs_cdo_local_get_cell_mesh(t_id);
+    cs_cell_sys_t  *csys = _svb_cell_system[t_id];
+    cs_cell_builder_t  *cb = _svb_cell_builder[t_id];
+    cs_hodge_t  *diff_hodge =
+      (eqc->diffusion_hodge == NULL) ? NULL : eqc->diffusion_hodge[t_id];
+    cs_hodge_t  *mass_hodge =
+      (eqc->mass_hodge == NULL) ? NULL : eqc->mass_hodge[t_id];
+
+    /* Same evaluation times as during the system building */
+    cb->t_pty_eval = mf->t_eval;
+    cb->t_bc_eval = mf->t_eval;
+    cb->t_st_eval = mf->t_eval;
+
+    cs_equation_init_properties(eqp, eqb, diff_hodge, cb);
+
+#   pragma omp for CS_CDO_OMP_SCHEDULE
+    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+
+      cb->cell_flag = connect->cell_flag[c_id];
+
+      cs_cell_mesh_build(c_id,
+                         cs_equation_cell_mesh_flag(cb->cell_flag, eqb),
+                         connect, quant, cm);
+
+      /* Rebuild the cellwise matrix (the right-hand side is not used) */
+      _svb_init_cell_system(cm, eqp, eqb,
+                            mf->dir_values, eqc->vtx_bc_flag, mf->forced_ids,
+                            mf->field_tn,
+                            csys, cb);
+
+      _svb_conv_diff_reac(eqp, eqb, eqc, cm,
+                          fm, mass_hodge, diff_hodge, csys, cb);
+
+      _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+
+      if (mf->inv_dtcur > 0)
+        _svb_implicit_time_term(eqp, eqb, cm, mass_hodge, mf->inv_dtcur,
+                                csys, cb);
+
+      _svb_enforce_values(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+
+      /* Cellwise product and assembly of the result */
+      cs_real_t  *_x = cb->values;
+      cs_real_t  *_y = cb->values + cm->n_vc;
+
+      for (short int v = 0; v < cm->n_vc; v++)
+        _x[v] = x_full[cm->v_ids[v]];
+
+      cs_sdm_square_matvec(csys->mat, _x, _y);
+
+      for (short int v = 0; v < cm->n_vc; v++)
+#       pragma omp atomic
+        y_full[cm->v_ids[v]] += _y[v];
+
+    } /* Loop on cells */
+
+  } /* OpenMP block */
+
+  /* Add the contributions of distant ranks to shared vertices */
+  if (rs != NULL) {
+    if (rs->ifs != NULL)
+      cs_interface_set_sum(rs->ifs,
+                           n_vertices, 1, false, CS_REAL_TYPE,
+                           y_full);
+
+    cs_range_set_gather(rs, CS_REAL_TYPE, 1, y_full, y);
+  }
+  else
+    memcpy(y, y_full, n_vertices*sizeof(cs_real_t));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create the context for a matrix-free resolution.
+ *         The diagonal of the operator is accumulated during the system
+ *         building.
+ *
+ * \param[in]  eqp         pointer to a cs_equation_param_t structure
+ * \param[in]  eqb         pointer to a cs_equation_builder_t structure
+ * \param[in]  eqc         context for this kind of discretization
+ * \param[in]  dir_values  Dirichlet values at vertices
+ * \param[in]  forced_ids  ids of enforced vertices or NULL
+ * \param[in]  field_tn    values of the variable field
+ * \param[in]  t_eval      time at which quantities are evaluated
+ * \param[in]  inv_dtcur   inverse of the time step (0 if steady)
+ *
+ * \return a pointer to a new allocated cs_cdovb_scaleq_mf_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_cdovb_scaleq_mf_t *
+_svb_matrix_free_create(const cs_equation_param_t     *eqp,
+                        const cs_equation_builder_t   *eqb,
+                        const cs_cdovb_scaleq_t       *eqc,
+                        const cs_real_t                dir_values[],
+                        const cs_lnum_t                forced_ids[],
+                        const cs_real_t                field_tn[],
+                        cs_real_t                      t_eval,
+                        cs_real_t                      inv_dtcur)
+{
+  const cs_lnum_t  n_vertices = cs_shared_quant->n_vertices;
+
+  cs_cdovb_scaleq_mf_t  *mf = NULL;
+
+  BFT_MALLOC(mf, 1, cs_cdovb_scaleq_mf_t);
+
+  mf->eqp = eqp;
+  mf->eqb = eqb;
+  mf->eqc = eqc;
+
+  mf->dir_values = dir_values;
+  mf->forced_ids = forced_ids;
+  mf->field_tn = field_tn;
+
+  mf->t_eval = t_eval;
+  mf->inv_dtcur = inv_dtcur;
+
+  BFT_MALLOC(mf->x_full, n_vertices, cs_real_t);
+  BFT_MALLOC(mf->y_full, n_vertices, cs_real_t);
+  BFT_MALLOC(mf->diag, n_vertices, cs_real_t);
+
+# pragma omp parallel for if (n_vertices > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vertices; i++) mf->diag[i] = 0.;
+
+  return mf;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Finalize the diagonal of the operator and build the matrix-free
+ *         matrix used by the linear solver
+ *
+ * \param[in, out]  mf    pointer to a cs_cdovb_scaleq_mf_t structure
+ *
+ * \return a pointer to a new allocated (shell) cs_matrix_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_matrix_t *
+_svb_matrix_free_matrix(cs_cdovb_scaleq_mf_t   *mf)
+{
+  const cs_range_set_t  *rs =
+    cs_shared_connect->range_sets[CS_CDO_CONNECT_VTX_SCAL];
 
-  for (int v = 0; v < cm->n_vc; v++)
-#   pragma omp atomic
-    rhs[cm->v_ids[v]] += csys->rhs[v];
+  cs_lnum_t  n_rows = cs_shared_quant->n_vertices;
 
-  if (eqc->source_terms != NULL) {
-    for (int v = 0; v < cm->n_vc; v++) /* Source term assembly */
-#     pragma omp atomic
-      eqc->source_terms[cm->v_ids[v]] += csys->source[v];
+  if (rs != NULL) {
+    if (rs->ifs != NULL)
+      cs_interface_set_sum(rs->ifs,
+                           n_rows, 1, false, CS_REAL_TYPE,
+                           mf->diag);
+
+    cs_range_set_gather(rs, CS_REAL_TYPE, 1, mf->diag, mf->diag);
+    n_rows = rs->n_elts[0];
   }
-#endif
+
+  bool  symmetric = (mf->eqb->sys_flag & CS_FLAG_SYS_SYM) ? true : false;
+
+  return cs_matrix_create_shell(n_rows,
+                                symmetric,
+                                mf->diag,
+                                _svb_matrix_free_product,
+                                mf);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free the context for a matrix-free resolution
+ *
+ * \param[in, out]  p_mf    pointer of pointer to a cs_cdovb_scaleq_mf_t
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_matrix_free_free(cs_cdovb_scaleq_mf_t   **p_mf)
+{
+  cs_cdovb_scaleq_mf_t  *mf = *p_mf;
+
+  if (mf == NULL)
+    return;
+
+  BFT_FREE(mf->x_full);
+  BFT_FREE(mf->y_full);
+  BFT_FREE(mf->diag);
+
+  BFT_FREE(mf);
+  *p_mf = NULL;
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -829,6 +1353,8 @@ cs_cdovb_scaleq_finalize_common(void)
   BFT_FREE(_svb_cell_builder);
   _svb_cell_system = NULL;
   _svb_cell_builder = NULL;
+
+  cs_adjacency_destroy(&_svb_cell_colors);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -887,6 +1413,7 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
   /* Diffusion term */
   eqc->diffusion_hodge = NULL;
   eqc->get_stiffness_matrix = NULL;
+  eqc->diffusion_cache = NULL;
 
   if (cs_equation_param_has_diffusion(eqp)) {
 
@@ -942,6 +1469,14 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
 
     } /* Switch on Hodge algo. */
 
+    /* Cellwise stiffness matrices may be kept from one build to another
+       if the diffusion property does not vary in time */
+    if (   eqp->cellwise_cache_size > 0
+        && cs_property_is_steady(eqp->diffusion_property))
+      eqc->diffusion_cache = cs_cell_sdm_cache_create(connect->c2v,
+                                                      0,
+                                                      eqp->cellwise_cache_size);
+
   } /* Diffusion term is requested */
 
   /* Boundary conditions */
@@ -1276,8 +1811,83 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
   eqc->get_mass_matrix = cs_hodge_get_func(__func__, eqc->mass_hodgep);
 
   /* Assembly process */
-  eqc->assemble = cs_equation_assemble_set(CS_SPACE_SCHEME_CDOVB,
-                                           CS_CDO_CONNECT_VTX_SCAL);
+  eqc->cell_colors = NULL;
+
+  if (eqp->omp_assembly_choice == CS_PARAM_ASSEMBLE_OMP_COLOR &&
+      cs_glob_n_threads > 1) {
+
+    /* Cells are processed color by color. The coloring is shared among all
+       the equations relying on this strategy */
+    if (_svb_cell_colors == NULL) {
+
+      _svb_cell_colors = cs_cdo_connect_build_cell_colors(connect->n_vertices,
+                                                          connect->c2v);
+
+      cs_log_printf(CS_LOG_SETUP,
+                    " %s: %d cell colors for the assembly without"
+                    " synchronization\n", __func__,
+                    (int)_svb_cell_colors->n_elts);
+
+    }
+
+    eqc->cell_colors = _svb_cell_colors;
+    eqc->assemble = cs_equation_assemble_set_no_sync(CS_SPACE_SCHEME_CDOVB,
+                                                     CS_CDO_CONNECT_VTX_SCAL);
+
+  }
+  else
+    eqc->assemble = cs_equation_assemble_set(CS_SPACE_SCHEME_CDOVB,
+                                             CS_CDO_CONNECT_VTX_SCAL);
+
+  /* Matrix-free resolution: the operator is only known through its
+     diagonal and matrix-vector products, which restricts the choice of the
+     time scheme and of the linear solver */
+  if (eqp->matrix_free) {
+
+    const cs_param_sles_t  *slesp = eqp->sles_param;
+
+    if (cs_equation_param_has_time(eqp) &&
+        eqp->time_scheme != CS_TIME_SCHEME_EULER_IMPLICIT)
+      bft_error(__FILE__, __LINE__, 0,
+                " %s: Eq. %s\n"
+                " Matrix-free resolution is only available for steady\n"
+                " equations or with an implicit Euler time scheme.",
+                __func__, eqp->name);
+
+    bool  valid_sles = (slesp->solver_class == CS_PARAM_SLES_CLASS_CS);
+
+    switch (slesp->solver) {
+    case CS_PARAM_ITSOL_BICG:
+    case CS_PARAM_ITSOL_BICGSTAB2:
+    case CS_PARAM_ITSOL_CG:
+    case CS_PARAM_ITSOL_CR3:
+    case CS_PARAM_ITSOL_FCG:
+    case CS_PARAM_ITSOL_GCR:
+    case CS_PARAM_ITSOL_JACOBI:
+      break;
+    default:
+      valid_sles = false;
+    }
+
+    switch (slesp->precond) {
+    case CS_PARAM_PRECOND_NONE:
+    case CS_PARAM_PRECOND_DIAG:
+    case CS_PARAM_PRECOND_POLY1:
+    case CS_PARAM_PRECOND_POLY2:
+      break;
+    default:
+      valid_sles = false;
+    }
+
+    if (!valid_sles)
+      bft_error(__FILE__, __LINE__, 0,
+                " %s: Eq. %s\n"
+                " Matrix-free resolution requires an iterative solver of\n"
+                " code_saturne with no, diagonal or polynomial"
+                " preconditioning.",
+                __func__, eqp->name);
+
+  }
 
   /* Array used for extra-operations */
   eqc->cell_values = NULL;
@@ -1309,6 +1919,7 @@ cs_cdovb_scaleq_free_context(void   *builder)
   BFT_FREE(eqc->vtx_bc_flag);
 
   cs_hodge_free_context(&(eqc->diffusion_hodge));
+  cs_cell_sdm_cache_free(&(eqc->diffusion_cache));
   cs_hodge_free_context(&(eqc->mass_hodge));
 
   /* Last free */
@@ -1474,7 +2085,7 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
     eqb->init_step = false;
 
   /* Initialize the local system: matrix and rhs */
-  cs_matrix_t  *matrix = cs_matrix_create(cs_shared_ms);
+  cs_matrix_t  *matrix = NULL;
   cs_real_t  *rhs = NULL;
   double  rhs_norm = 0.0;
 
@@ -1482,14 +2093,28 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
 # pragma omp parallel for if  (n_vertices > CS_THR_MIN)
   for (cs_lnum_t i = 0; i < n_vertices; i++) rhs[i] = 0.0;
 
-  /* Initialize the structure to assemble values */
-  cs_matrix_assembler_values_t  *mav
-    = cs_matrix_assembler_values_init(matrix, NULL, NULL);
+  /* Initialize the structure to assemble values. In matrix-free mode, only
+     the diagonal of the operator is assembled */
+  cs_matrix_assembler_values_t  *mav = NULL;
+  cs_cdovb_scaleq_mf_t  *mf = NULL;
+
+  if (eqp->matrix_free)
+    mf = _svb_matrix_free_create(eqp, eqb, eqc, dir_values, forced_ids,
+                                 fld->val, time_eval, 0.);
+  else {
+    matrix = cs_matrix_create(cs_shared_ms);
+    mav = cs_matrix_assembler_values_init(matrix, NULL, NULL);
+  }
 
   /* ------------------------- */
   /* Main OpenMP block on cell */
   /* ------------------------- */
 
+  /* Cells are processed color by color when a cell coloring is used to
+     avoid any synchronization during the assembly */
+  const int  n_colors =
+    (eqc->cell_colors == NULL) ? 1 : eqc->cell_colors->n_elts;
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
     /* Set variables and structures inside the OMP section so that each thread
@@ -1525,92 +2150,375 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (int color = 0; color < n_colors; color++) {
+
+      cs_lnum_t  n_color_cells = 0;
+      const cs_lnum_t  *color_cells = _svb_color_cells(eqc, color,
+                                                       &n_color_cells);
+
+#     pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
+      for (cs_lnum_t c_idx = 0; c_idx < n_color_cells; c_idx++) {
+
+        const cs_lnum_t  c_id
+          = (color_cells == NULL) ? c_idx : color_cells[c_idx];
+
+        /* Set the current cell flag */
+        cb->cell_flag = connect->cell_flag[c_id];
+
+        /* Set the local mesh structure for the current cell */
+        cs_cell_mesh_build(c_id,
+                           cs_equation_cell_mesh_flag(cb->cell_flag, eqb),
+                           connect, quant, cm);
+
+        /* Set the local (i.e. cellwise) structures for the current cell */
+        _svb_init_cell_system(cm, eqp, eqb,
+                              dir_values, eqc->vtx_bc_flag, forced_ids,
+                              fld->val, csys, cb);
+
+        /* Build and add the diffusion/advection/reaction terms into the local
+         * system.
+         * A mass matrix is also built if needed (stored in mass_hodge->matrix)
+         */
+        _svb_conv_diff_reac(eqp, eqb, eqc, cm,
+                            fm, mass_hodge, diff_hodge, csys, cb);
+
+        if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                      * =========== */
+          /* Reset the local contribution */
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+
+          /* Source term contribution to the algebraic system */
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          cb->t_st_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
+
+          /* Update the RHS */
+          for (short int v = 0; v < cm->n_vc; v++)
+            csys->rhs[v] += csys->source[v];
+
+        } /* End of term source */
+
+        /* Compute a cellwise norm of the RHS for the normalization of the
+           residual during the resolution of the linear system */
+        rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                              cm, csys);
+
+        /* Apply boundary conditions (those which are weakly enforced) */
+        _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+
+        /* Enforce values if needed (internal or Dirichlet) */
+        _svb_enforce_values(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+
+#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+#endif
+
+        /* Assembly process
+         * ================ */
+
+        _svb_assemble(eqc, cm, csys, rs, eqa, mav,
+                      (mf != NULL) ? mf->diag : NULL, rhs);
+
+      } /* Main loop on cells */
+
+    } /* Loop on cell colors */
+
+  } /* OPENMP Block */
+
+  if (mf == NULL) {
+    cs_matrix_assembler_values_done(mav); /* optional */
+    cs_matrix_assembler_values_finalize(&mav);
+  }
+  else
+    matrix = _svb_matrix_free_matrix(mf);
+
+  /* Free temporary buffers and structures (still needed to rebuild the
+     cellwise systems in matrix-free mode) */
+  if (mf == NULL) {
+    BFT_FREE(dir_values);
+    BFT_FREE(forced_ids);
+  }
+
+  /* End of the system building */
+  cs_timer_t  t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(eqb->tcb), &t0, &t1);
+
+  /* Copy current field values to previous values */
+  if (cur2prev)
+    cs_field_current_to_previous(fld);
+
+  /* Solve the linear system */
+  /* ======================= */
+
+  /* Last step in the computation of the renormalization coefficient */
+  cs_equation_sync_rhs_normalization(eqp->sles_param->resnorm_type,
+                                     eqc->n_dofs,
+                                     rhs,
+                                     &rhs_norm);
+
+  cs_sles_t  *sles = cs_sles_find_or_add(eqp->sles_param->field_id, NULL);
+
+  cs_equation_solve_scalar_system(eqc->n_dofs,
+                                  eqp->sles_param,
+                                  matrix,
+                                  rs,
+                                  rhs_norm,
+                                  true, /* rhs_redux */
+                                  sles,
+                                  fld->val,
+                                  rhs);
+
+  cs_timer_t  t2 = cs_timer_time();
+  cs_timer_counter_add_diff(&(eqb->tcs), &t1, &t2);
+
+  /* Free remaining buffers */
+  BFT_FREE(rhs);
+  cs_sles_free(sles);
+  cs_matrix_destroy(&matrix);
+  _svb_matrix_free_free(&mf);
+  BFT_FREE(dir_values);
+  BFT_FREE(forced_ids);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build and solve the linear system arising from a scalar unsteady
+ *         convection/diffusion/reaction equation with a CDO-Vb scheme
+ *         Implicit time scheme is used to progress in time.
+ *         One works cellwise and then process to the assembly
+ *
+ * \param[in]      cur2prev   true="current to previous" operation is performed
+ * \param[in]      mesh       pointer to a cs_mesh_t structure
+ * \param[in]      field_id   id of the variable field related to this equation
+ * \param[in]      eqp        pointer to a cs_equation_param_t structure
+ * \param[in, out] eqb        pointer to a cs_equation_builder_t structure
+ * \param[in, out] context    pointer to cs_cdovb_scaleq_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
+                               const cs_mesh_t            *mesh,
+                               const int                   field_id,
+                               const cs_equation_param_t  *eqp,
+                               cs_equation_builder_t      *eqb,
+                               void                       *context)
+{
+  cs_timer_t  t0 = cs_timer_time();
+
+  const cs_cdo_connect_t  *connect = cs_shared_connect;
+  const cs_range_set_t  *rs = connect->range_sets[CS_CDO_CONNECT_VTX_SCAL];
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_time_step_t  *ts = cs_shared_time_step;
+  const cs_lnum_t  n_vertices = quant->n_vertices;
+
+  assert(cs_equation_param_has_time(eqp) == true);
+  assert(eqp->time_scheme == CS_TIME_SCHEME_EULER_IMPLICIT);
+
+  cs_cdovb_scaleq_t  *eqc = (cs_cdovb_scaleq_t *)context;
+  cs_field_t  *fld = cs_field_by_id(field_id);
+
+  /* Build an array storing the Dirichlet values at vertices and another one
+     to detect vertices with an enforcement */
+  cs_real_t  *dir_values = NULL;
+  cs_lnum_t  *forced_ids = NULL;
+
+  _svb_setup(ts->t_cur + ts->dt[0], mesh, eqp, eqb, eqc->vtx_bc_flag,
+             &dir_values,  &forced_ids);
+
+  if (eqb->init_step)
+    eqb->init_step = false;
+
+  /* Initialize the local system: matrix and rhs */
+  cs_matrix_t  *matrix = NULL;
+  cs_real_t  *rhs = NULL;
+  double  rhs_norm = 0.;
+
+  BFT_MALLOC(rhs, n_vertices, cs_real_t);
+# pragma omp parallel for if  (n_vertices > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vertices; i++) rhs[i] = 0.0;
+
+  /* Initialize the structure to assemble values. In matrix-free mode, only
+     the diagonal of the operator is assembled */
+  cs_matrix_assembler_values_t  *mav = NULL;
+  cs_cdovb_scaleq_mf_t  *mf = NULL;
+
+  if (eqp->matrix_free)
+    mf = _svb_matrix_free_create(eqp, eqb, eqc, dir_values, forced_ids,
+                                 fld->val,
+                                 ts->t_cur + ts->dt[0], 1./ts->dt[0]);
+  else {
+    matrix = cs_matrix_create(cs_shared_ms);
+    mav = cs_matrix_assembler_values_init(matrix, NULL, NULL);
+  }
+
+  /* ------------------------- */
+  /* Main OpenMP block on cell */
+  /* ------------------------- */
+
+  /* Cells are processed color by color when a cell coloring is used to
+     avoid any synchronization during the assembly */
+  const int  n_colors =
+    (eqc->cell_colors == NULL) ? 1 : eqc->cell_colors->n_elts;
+
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)
+  {
+    /* Set variables and structures inside the OMP section so that each thread
+       has its own value */
+
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+    int  t_id = omp_get_thread_num();
+#else
+    int  t_id = 0;
+#endif
+
+    /* Each thread get back its related structures:
+       Get the cell-wise view of the mesh and the algebraic system */
+    cs_equation_assemble_t  *eqa = cs_equation_assemble_get(t_id);
+    cs_face_mesh_t  *fm = cs_cdo_local_get_face_mesh(t_id);
+    cs_cell_mesh_t  *cm = cs_cdo_local_get_cell_mesh(t_id);
+    cs_cell_sys_t  *csys = _svb_cell_system[t_id];
+    cs_cell_builder_t  *cb = _svb_cell_builder[t_id];
+    cs_hodge_t  *diff_hodge =
+      (eqc->diffusion_hodge == NULL) ? NULL : eqc->diffusion_hodge[t_id];
+    cs_hodge_t  *mass_hodge =
+      (eqc->mass_hodge == NULL) ? NULL : eqc->mass_hodge[t_id];
+
+    const cs_real_t  time_eval = ts->t_cur + ts->dt[0];
+    const cs_real_t  inv_dtcur = 1./ts->dt[0];
+
+    /* Set times at which one evaluates quantities if needed */
+    cb->t_pty_eval = time_eval;
+    cb->t_bc_eval = time_eval;
+    cb->t_st_eval = time_eval;
+
+    /* Initialization of the values of properties */
+    cs_equation_init_properties(eqp, eqb, diff_hodge, cb);
+
+    /* --------------------------------------------- */
+    /* Main loop on cells to build the linear system */
+    /* --------------------------------------------- */
+
+    for (int color = 0; color < n_colors; color++) {
+
+      cs_lnum_t  n_color_cells = 0;
+      const cs_lnum_t  *color_cells = _svb_color_cells(eqc, color,
+                                                       &n_color_cells);
+
+#     pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
+      for (cs_lnum_t c_idx = 0; c_idx < n_color_cells; c_idx++) {
+
+        const cs_lnum_t  c_id
+          = (color_cells == NULL) ? c_idx : color_cells[c_idx];
+
+        /* Set the current cell flag */
+        cb->cell_flag = connect->cell_flag[c_id];
+
+        /* Set the local mesh structure for the current cell */
+        cs_cell_mesh_build(c_id,
+                           cs_equation_cell_mesh_flag(cb->cell_flag, eqb),
+                           connect, quant, cm);
+
+        /* Set the local (i.e. cellwise) structures for the current cell */
+        _svb_init_cell_system(cm, eqp, eqb, dir_values, eqc->vtx_bc_flag,
+                              forced_ids, fld->val,
+                              csys, cb);
 
-      /* Set the current cell flag */
-      cb->cell_flag = connect->cell_flag[c_id];
+        /* Build and add the diffusion/advection/reaction term to the local
+           system. A mass matrix is also built if needed */
+        _svb_conv_diff_reac(eqp, eqb, eqc, cm,
+                            fm, mass_hodge, diff_hodge, csys, cb);
 
-      /* Set the local mesh structure for the current cell */
-      cs_cell_mesh_build(c_id,
-                         cs_equation_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
+        if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                      * =========== */
+          /* Reset the local contribution */
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
-      _svb_init_cell_system(cm, eqp, eqb,
-                            dir_values, eqc->vtx_bc_flag, forced_ids, fld->val,
-                            csys, cb);
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          cb->t_st_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
 
-      /* Build and add the diffusion/advection/reaction terms into the local
-       * system.
-       * A mass matrix is also built if needed (stored in mass_hodge->matrix)
-       */
-      _svb_conv_diff_reac(eqp, eqb, eqc, cm,
-                          fm, mass_hodge, diff_hodge, csys, cb);
+          for (short int v = 0; v < cm->n_vc; v++)
+            csys->rhs[v] += csys->source[v];
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
-        /* Reset the local contribution */
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+        } /* End of term source */
 
-        /* Source term contribution to the algebraic system */
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        /* Apply boundary conditions (those which are weakly enforced) */
+        _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
-        /* Update the RHS */
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += csys->source[v];
+        /* Unsteady term + time scheme
+         * =========================== */
 
-      } /* End of term source */
+        _svb_implicit_time_term(eqp, eqb, cm, mass_hodge, inv_dtcur, csys, cb);
 
-      /* Compute a cellwise norm of the RHS for the normalization of the
-         residual during the resolution of the linear system */
-      rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
-                                            cm, csys);
+#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump("\n>> Cell system after time", csys);
+#endif
 
-      /* Apply boundary conditions (those which are weakly enforced) */
-      _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+        /* Compute a norm of the RHS for the normalization of the residual
+           of the linear system to solve */
+        rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                              cm, csys);
 
-      /* Enforce values if needed (internal or Dirichlet) */
-      _svb_enforce_values(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+        /* Enforce values if needed (internal or Dirichlet) */
+        _svb_enforce_values(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
 #endif
 
-      /* Assembly process
-       * ================ */
+        /* Assembly process
+         * ================ */
+        _svb_assemble(eqc, cm, csys, rs, eqa, mav,
+                      (mf != NULL) ? mf->diag : NULL, rhs);
 
-      _svb_assemble(eqc, cm, csys, rs, eqa, mav, rhs);
+      } /* Main loop on cells */
 
-    } /* Main loop on cells */
+    } /* Loop on cell colors */
 
   } /* OPENMP Block */
 
-  cs_matrix_assembler_values_done(mav); /* optional */
+  if (mf == NULL) {
+    cs_matrix_assembler_values_done(mav); /* optional */
+    cs_matrix_assembler_values_finalize(&mav);
+  }
+  else
+    matrix = _svb_matrix_free_matrix(mf);
 
-  /* Free temporary buffers and structures */
-  BFT_FREE(dir_values);
-  BFT_FREE(forced_ids);
+  /* Free temporary buffers and structures (still needed to rebuild the
+     cellwise systems in matrix-free mode) */
+  if (mf == NULL) {
+    BFT_FREE(dir_values);
+    BFT_FREE(forced_ids);
+  }
 
-  cs_matrix_assembler_values_finalize(&mav);
+  /* Copy current field values to previous values */
+  if (cur2prev)
+    cs_field_current_to_previous(fld);
 
   /* End of the system building */
   cs_timer_t  t1 = cs_timer_time();
   cs_timer_counter_add_diff(&(eqb->tcb), &t0, &t1);
 
-  /* Copy current field values to previous values */
-  if (cur2prev)
-    cs_field_current_to_previous(fld);
-
   /* Solve the linear system */
   /* ======================= */
 
@@ -1639,32 +2547,46 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
   BFT_FREE(rhs);
   cs_sles_free(sles);
   cs_matrix_destroy(&matrix);
+  _svb_matrix_free_free(&mf);
+  BFT_FREE(dir_values);
+  BFT_FREE(forced_ids);
 }
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief  Build and solve the linear system arising from a scalar unsteady
- *         convection/diffusion/reaction equation with a CDO-Vb scheme
- *         Implicit time scheme is used to progress in time.
- *         One works cellwise and then process to the assembly
+ * \brief  Build and solve the linear systems arising from a set of scalar
+ *         unsteady convection/diffusion/reaction equations with a CDO-Vb
+ *         scheme and an implicit time scheme.
+ *         The cellwise view of the mesh is built only once for each cell and
+ *         then shared by the local builders of all the equations. Each
+ *         equation keeps its own matrix, right-hand side and linear solver.
+ *         When several equations share the same diffusion property and the
+ *         same advection field (e.g. tracers in the same soils), the local
+ *         diffusion/advection operator is built once for all of them. Only
+ *         the reaction and unsteady terms are then built for each equation.
  *
  * \param[in]      cur2prev   true="current to previous" operation is performed
  * \param[in]      mesh       pointer to a cs_mesh_t structure
- * \param[in]      field_id   id of the variable field related to this equation
- * \param[in]      eqp        pointer to a cs_equation_param_t structure
- * \param[in, out] eqb        pointer to a cs_equation_builder_t structure
- * \param[in, out] context    pointer to cs_cdovb_scaleq_t structure
+ * \param[in]      n_eqs      number of equations to solve
+ * \param[in]      field_ids  ids of the variable fields (size: n_eqs)
+ * \param[in]      eqps       pointers to cs_equation_param_t structures
+ * \param[in, out] eqbs       pointers to cs_equation_builder_t structures
+ * \param[in, out] contexts   pointers to cs_cdovb_scaleq_t structures
  */
 /*----------------------------------------------------------------------------*/
 
 void
-cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
-                               const cs_mesh_t            *mesh,
-                               const int                   field_id,
-                               const cs_equation_param_t  *eqp,
-                               cs_equation_builder_t      *eqb,
-                               void                       *context)
+cs_cdovb_scaleq_solve_implicit_group(bool                         cur2prev,
+                                     const cs_mesh_t             *mesh,
+                                     int                          n_eqs,
+                                     const int                    field_ids[],
+                                     const cs_equation_param_t   *eqps[],
+                                     cs_equation_builder_t       *eqbs[],
+                                     void                        *contexts[])
 {
+  if (n_eqs < 1)
+    return;
+
   cs_timer_t  t0 = cs_timer_time();
 
   const cs_cdo_connect_t  *connect = cs_shared_connect;
@@ -1672,36 +2594,119 @@ cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
   const cs_cdo_quantities_t  *quant = cs_shared_quant;
   const cs_time_step_t  *ts = cs_shared_time_step;
   const cs_lnum_t  n_vertices = quant->n_vertices;
+  const cs_real_t  time_eval = ts->t_cur + ts->dt[0];
+  const cs_real_t  inv_dtcur = 1./ts->dt[0];
+
+  /* Size of the buffer storing the uniform property values of an equation */
+  const int  pty_stride = 2 + CS_CDO_N_MAX_REACTIONS;
+
+  cs_field_t  **fields = NULL;
+  cs_cdovb_scaleq_t  **eqcs = NULL;
+  cs_real_t  **dir_values = NULL, **rhs = NULL;
+  cs_lnum_t  **forced_ids = NULL;
+  cs_matrix_t  **matrices = NULL;
+  cs_matrix_assembler_values_t  **mavs = NULL;
+  cs_cdovb_scaleq_mf_t  **mfs = NULL;
+  double  *rhs_norms = NULL;
+  int  *ref_ids = NULL;
+  bool  *is_ref = NULL;
+
+  BFT_MALLOC(fields, n_eqs, cs_field_t *);
+  BFT_MALLOC(eqcs, n_eqs, cs_cdovb_scaleq_t *);
+  BFT_MALLOC(dir_values, n_eqs, cs_real_t *);
+  BFT_MALLOC(rhs, n_eqs, cs_real_t *);
+  BFT_MALLOC(forced_ids, n_eqs, cs_lnum_t *);
+  BFT_MALLOC(matrices, n_eqs, cs_matrix_t *);
+  BFT_MALLOC(mavs, n_eqs, cs_matrix_assembler_values_t *);
+  BFT_MALLOC(mfs, n_eqs, cs_cdovb_scaleq_mf_t *);
+  BFT_MALLOC(rhs_norms, n_eqs, double);
+  BFT_MALLOC(ref_ids, n_eqs, int);
+  BFT_MALLOC(is_ref, n_eqs, bool);
+
+  /* Flags to build the cellwise view of the mesh. This is the union of the
+     flags requested by each equation */
+  cs_eflag_t  msh_flag = 0, bd_msh_flag = 0;
+
+  /* Cell coloring (shared by all the equations relying on it) */
+  const cs_cdovb_scaleq_t  *color_eqc = NULL;
+
+  for (int e = 0; e < n_eqs; e++) {
+
+    const cs_equation_param_t  *eqp = eqps[e];
+    cs_equation_builder_t  *eqb = eqbs[e];
+    cs_cdovb_scaleq_t  *eqc = (cs_cdovb_scaleq_t *)contexts[e];
+
+    assert(cs_equation_param_has_time(eqp) == true);
+    assert(eqp->time_scheme == CS_TIME_SCHEME_EULER_IMPLICIT);
+
+    eqcs[e] = eqc;
+    fields[e] = cs_field_by_id(field_ids[e]);
+
+    msh_flag |= eqb->msh_flag | eqb->st_msh_flag;
+    bd_msh_flag |= eqb->bd_msh_flag;
+
+    if (eqc->cell_colors != NULL)
+      color_eqc = eqc;
+
+    /* Build an array storing the Dirichlet values at vertices and another one
+       to detect vertices with an enforcement */
+    dir_values[e] = NULL;
+    forced_ids[e] = NULL;
+
+    _svb_setup(time_eval, mesh, eqp, eqb, eqc->vtx_bc_flag,
+               dir_values + e, forced_ids + e);
+
+    if (eqb->init_step)
+      eqb->init_step = false;
+
+    /* Initialize the local system: matrix and rhs */
+    rhs_norms[e] = 0.;
+    BFT_MALLOC(rhs[e], n_vertices, cs_real_t);
+    cs_real_t  *_rhs = rhs[e];
+#   pragma omp parallel for if  (n_vertices > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_vertices; i++) _rhs[i] = 0.0;
+
+    /* Initialize the structure to assemble values. In matrix-free mode, only
+       the diagonal of the operator is assembled */
+    matrices[e] = NULL;
+    mavs[e] = NULL;
+    mfs[e] = NULL;
+
+    if (eqp->matrix_free)
+      mfs[e] = _svb_matrix_free_create(eqp, eqb, eqc,
+                                       dir_values[e], forced_ids[e],
+                                       fields[e]->val,
+                                       time_eval, inv_dtcur);
+    else {
+      matrices[e] = cs_matrix_create(cs_shared_ms);
+      mavs[e] = cs_matrix_assembler_values_init(matrices[e], NULL, NULL);
+    }
 
-  assert(cs_equation_param_has_time(eqp) == true);
-  assert(eqp->time_scheme == CS_TIME_SCHEME_EULER_IMPLICIT);
-
-  cs_cdovb_scaleq_t  *eqc = (cs_cdovb_scaleq_t *)context;
-  cs_field_t  *fld = cs_field_by_id(field_id);
+  } /* Loop on equations */
 
-  /* Build an array storing the Dirichlet values at vertices and another one
-     to detect vertices with an enforcement */
-  cs_real_t  *dir_values = NULL;
-  cs_lnum_t  *forced_ids = NULL;
+  /* Detect equations sharing their local diffusion/advection operator with a
+     previous equation (the reference one) */
+  for (int e = 0; e < n_eqs; e++) {
 
-  _svb_setup(ts->t_cur + ts->dt[0], mesh, eqp, eqb, eqc->vtx_bc_flag,
-             &dir_values,  &forced_ids);
+    ref_ids[e] = -1;
+    is_ref[e] = false;
 
-  if (eqb->init_step)
-    eqb->init_step = false;
+    for (int r = 0; r < e && ref_ids[e] < 0; r++) {
+      if (ref_ids[r] < 0 &&
+          _svb_same_conv_diff(eqps[r], eqbs[r], eqcs[r],
+                              eqps[e], eqbs[e], eqcs[e])) {
+        ref_ids[e] = r;
+        is_ref[r] = true;
+      }
+    }
 
-  /* Initialize the local system: matrix and rhs */
-  cs_matrix_t  *matrix = cs_matrix_create(cs_shared_ms);
-  cs_real_t  *rhs = NULL;
-  double  rhs_norm = 0.;
+  } /* Loop on equations */
 
-  BFT_MALLOC(rhs, n_vertices, cs_real_t);
-# pragma omp parallel for if  (n_vertices > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_vertices; i++) rhs[i] = 0.0;
+  const int  n_colors =
+    (color_eqc == NULL) ? 1 : color_eqc->cell_colors->n_elts;
 
-  /* Initialize the structure to assemble values */
-  cs_matrix_assembler_values_t  *mav
-    = cs_matrix_assembler_values_init(matrix, NULL, NULL);
+  if (color_eqc == NULL)
+    color_eqc = eqcs[0];
 
   /* ------------------------- */
   /* Main OpenMP block on cell */
@@ -1725,189 +2730,273 @@ cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
     cs_cell_mesh_t  *cm = cs_cdo_local_get_cell_mesh(t_id);
     cs_cell_sys_t  *csys = _svb_cell_system[t_id];
     cs_cell_builder_t  *cb = _svb_cell_builder[t_id];
-    cs_hodge_t  *diff_hodge =
-      (eqc->diffusion_hodge == NULL) ? NULL : eqc->diffusion_hodge[t_id];
-    cs_hodge_t  *mass_hodge =
-      (eqc->mass_hodge == NULL) ? NULL : eqc->mass_hodge[t_id];
-
-    const cs_real_t  time_eval = ts->t_cur + ts->dt[0];
-    const cs_real_t  inv_dtcur = 1./ts->dt[0];
 
     /* Set times at which one evaluates quantities if needed */
     cb->t_pty_eval = time_eval;
     cb->t_bc_eval = time_eval;
     cb->t_st_eval = time_eval;
 
-    /* Initialization of the values of properties */
-    cs_equation_init_properties(eqp, eqb, diff_hodge, cb);
+    /* Initialization of the values of properties. The cell builder is
+       shared by all the equations so that the uniform values are stored
+       for each equation and set again before each local build. */
+    double  *pty_vals = NULL, *t_rhs_norms = NULL;
+    BFT_MALLOC(pty_vals, pty_stride*n_eqs, double);
+    BFT_MALLOC(t_rhs_norms, n_eqs, double);
+
+    /* Local diffusion/advection operators of reference equations */
+    cs_sdm_t  **cd_mats = NULL;
+    BFT_MALLOC(cd_mats, n_eqs, cs_sdm_t *);
+    for (int e = 0; e < n_eqs; e++)
+      cd_mats[e] = (is_ref[e]) ?
+        cs_sdm_square_create(connect->n_max_vbyc) : NULL;
+
+    for (int e = 0; e < n_eqs; e++) {
+
+      const cs_cdovb_scaleq_t  *eqc = eqcs[e];
+      cs_hodge_t  *diff_hodge =
+        (eqc->diffusion_hodge == NULL) ? NULL : eqc->diffusion_hodge[t_id];
+
+      cs_equation_init_properties(eqps[e], eqbs[e], diff_hodge, cb);
+
+      double  *_vals = pty_vals + pty_stride*e;
+      _vals[0] = cb->gpty_val;
+      _vals[1] = cb->tpty_val;
+      for (int r = 0; r < CS_CDO_N_MAX_REACTIONS; r++)
+        _vals[2+r] = cb->rpty_vals[r];
+
+      t_rhs_norms[e] = 0.;
+
+    }
 
     /* --------------------------------------------- */
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (int color = 0; color < n_colors; color++) {
 
-      /* Set the current cell flag */
-      cb->cell_flag = connect->cell_flag[c_id];
+      cs_lnum_t  n_color_cells = 0;
+      const cs_lnum_t  *color_cells = _svb_color_cells(color_eqc, color,
+                                                       &n_color_cells);
 
-      /* Set the local mesh structure for the current cell */
-      cs_cell_mesh_build(c_id,
-                         cs_equation_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
+#     pragma omp for CS_CDO_OMP_SCHEDULE
+      for (cs_lnum_t c_idx = 0; c_idx < n_color_cells; c_idx++) {
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
-      _svb_init_cell_system(cm, eqp, eqb, dir_values, eqc->vtx_bc_flag,
-                            forced_ids, fld->val,
-                            csys, cb);
+        const cs_lnum_t  c_id
+          = (color_cells == NULL) ? c_idx : color_cells[c_idx];
 
-      /* Build and add the diffusion/advection/reaction term to the local
-         system. A mass matrix is also built if needed */
-      _svb_conv_diff_reac(eqp, eqb, eqc, cm,
-                          fm, mass_hodge, diff_hodge, csys, cb);
+        /* Set the current cell flag */
+        cb->cell_flag = connect->cell_flag[c_id];
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
-        /* Reset the local contribution */
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+        /* Set the local mesh structure for the current cell. This is done
+           only once for all the equations */
+        cs_eflag_t  _flag = msh_flag;
+        if (cb->cell_flag & CS_FLAG_BOUNDARY_CELL_BY_FACE)
+          _flag |= bd_msh_flag;
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        cs_cell_mesh_build(c_id, _flag, connect, quant, cm);
 
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += csys->source[v];
+        for (int e = 0; e < n_eqs; e++) {
 
-      } /* End of term source */
+          const cs_equation_param_t  *eqp = eqps[e];
+          const cs_cdovb_scaleq_t  *eqc = eqcs[e];
+          cs_equation_builder_t  *eqb = eqbs[e];
+          cs_hodge_t  *diff_hodge =
+            (eqc->diffusion_hodge == NULL) ? NULL : eqc->diffusion_hodge[t_id];
+          cs_hodge_t  *mass_hodge =
+            (eqc->mass_hodge == NULL) ? NULL : eqc->mass_hodge[t_id];
 
-      /* Apply boundary conditions (those which are weakly enforced) */
-      _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+          /* Set again the uniform property values of this equation */
+          const double  *_vals = pty_vals + pty_stride*e;
+          cb->gpty_val = _vals[0];
+          cb->tpty_val = _vals[1];
+          for (int r = 0; r < CS_CDO_N_MAX_REACTIONS; r++)
+            cb->rpty_vals[r] = _vals[2+r];
 
-      /* Unsteady term + time scheme
-       * =========================== */
+          /* Set the local (i.e. cellwise) structures for the current cell */
+          _svb_init_cell_system(cm, eqp, eqb, dir_values[e], eqc->vtx_bc_flag,
+                                forced_ids[e], fields[e]->val,
+                                csys, cb);
 
-      if (!(eqb->time_pty_uniform))
-        cb->tpty_val = cs_property_value_in_cell(cm, eqp->time_property,
-                                                 cb->t_pty_eval);
+          /* Build and add the diffusion/advection/reaction term to the local
+             system. A mass matrix is also built if needed */
+          if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX)
+            eqc->get_mass_matrix(cm, mass_hodge, cb);
 
-      if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) { /* Mass lumping */
+          if (ref_ids[e] < 0) {
 
-        /* |c|*wvc = |dual_cell(v) cap c| */
-        CS_CDO_OMP_ASSERT(cs_eflag_test(eqb->msh_flag, CS_FLAG_COMP_PVQ));
-        const double  ptyc = cb->tpty_val * cm->vol_c * inv_dtcur;
+            _svb_conv_diff(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
 
-        /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
-         *       >> Update the cellwise system with the time matrix */
-        for (short int i = 0; i < cm->n_vc; i++) {
+            /* Keep the local operator for the equations sharing it */
+            if (is_ref[e])
+              cs_sdm_copy(cd_mats[e], csys->mat);
 
-          const double  dval =  ptyc * cm->wvc[i];
+          }
+          else {
 
-          /* Update the RHS with values at time t_n */
-          csys->rhs[i] += dval * csys->val_n[i];
+            /* The diffusion property is still needed by the boundary
+               conditions */
+            if (cs_equation_param_has_diffusion(eqp) &&
+                !(eqb->diff_pty_uniform))
+              cs_hodge_set_property_value_cw(cm, cb->t_pty_eval,
+                                             cb->cell_flag, diff_hodge);
 
-          /* Add the diagonal contribution from time matrix */
-          csys->mat->val[i*(cm->n_vc + 1)] += dval;
+            cs_sdm_copy(csys->mat, cd_mats[ref_ids[e]]);
 
-        }
+          }
 
-      }
-      else { /* Use the mass matrix */
+          _svb_reac(eqp, eqb, cm, mass_hodge, csys, cb);
 
-        const double  tpty_coef = cb->tpty_val * inv_dtcur;
-        const cs_sdm_t  *mass_mat = mass_hodge->matrix;
+          if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                        * =========== */
+            /* Reset the local contribution */
+            memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-        /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
-         *       >> Update the cellwise system with the time matrix */
+            cs_source_term_compute_cellwise(eqp->n_source_terms,
+                        (cs_xdef_t *const *)eqp->source_terms,
+                                            cm,
+                                            eqb->source_mask,
+                                            eqb->compute_source,
+                                            cb->t_st_eval,
+                                            mass_hodge,
+                                            cb,
+                                            csys->source);
 
-        /* Update rhs with csys->mat*p^n */
-        double  *time_pn = cb->values;
-        cs_sdm_square_matvec(mass_mat, csys->val_n, time_pn);
-        for (short int i = 0; i < csys->n_dofs; i++)
-          csys->rhs[i] += tpty_coef*time_pn[i];
+            for (short int v = 0; v < cm->n_vc; v++)
+              csys->rhs[v] += csys->source[v];
 
-        /* Update the cellwise system with the time matrix */
-        cs_sdm_add_mult(csys->mat, tpty_coef, mass_mat);
+          } /* End of term source */
 
-      }
+          /* Apply boundary conditions (those which are weakly enforced) */
+          _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
-#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump("\n>> Cell system after time", csys);
-#endif
+          /* Unsteady term + time scheme
+           * =========================== */
 
-      /* Compute a norm of the RHS for the normalization of the residual
-         of the linear system to solve */
-      rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
-                                            cm, csys);
+          _svb_implicit_time_term(eqp, eqb, cm, mass_hodge, inv_dtcur,
+                                  csys, cb);
 
-      /* Enforce values if needed (internal or Dirichlet) */
-      _svb_enforce_values(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+          /* Compute a norm of the RHS for the normalization of the residual
+             of the linear system to solve */
+          t_rhs_norms[e] +=
+            _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                      cm, csys);
+
+          /* Enforce values if needed (internal or Dirichlet) */
+          _svb_enforce_values(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+          if (cs_dbg_cw_test(eqp, cm, csys))
+            cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
 #endif
 
-      /* Assembly process
-       * ================ */
-      _svb_assemble(eqc, cm, csys, rs, eqa, mav, rhs);
+          /* Assembly process
+           * ================ */
+          _svb_assemble(eqc, cm, csys, rs, eqa, mavs[e],
+                        (mfs[e] != NULL) ? mfs[e]->diag : NULL, rhs[e]);
 
-    } /* Main loop on cells */
+        } /* Loop on equations */
+
+      } /* Main loop on cells */
+
+    } /* Loop on cell colors */
+
+    for (int e = 0; e < n_eqs; e++) {
+#     pragma omp atomic
+      rhs_norms[e] += t_rhs_norms[e];
+    }
+
+    for (int e = 0; e < n_eqs; e++)
+      if (cd_mats[e] != NULL)
+        cd_mats[e] = cs_sdm_free(cd_mats[e]);
+
+    BFT_FREE(pty_vals);
+    BFT_FREE(t_rhs_norms);
+    BFT_FREE(cd_mats);
 
   } /* OPENMP Block */
 
-  cs_matrix_assembler_values_done(mav); /* optional */
+  for (int e = 0; e < n_eqs; e++) {
 
-  /* Free temporary buffers and structures */
-  BFT_FREE(dir_values);
-  BFT_FREE(forced_ids);
-  cs_matrix_assembler_values_finalize(&mav);
+    if (mfs[e] == NULL) {
+      cs_matrix_assembler_values_done(mavs[e]); /* optional */
+      cs_matrix_assembler_values_finalize(&(mavs[e]));
 
-  /* Copy current field values to previous values */
-  if (cur2prev)
-    cs_field_current_to_previous(fld);
+      /* Free temporary buffers and structures (still needed to rebuild the
+         cellwise systems in matrix-free mode) */
+      BFT_FREE(dir_values[e]);
+      BFT_FREE(forced_ids[e]);
+    }
+    else
+      matrices[e] = _svb_matrix_free_matrix(mfs[e]);
 
-  /* End of the system building */
+    /* Copy current field values to previous values */
+    if (cur2prev)
+      cs_field_current_to_previous(fields[e]);
+
+  }
+
+  /* End of the system building. The elapsed time is shared among the
+     equations */
   cs_timer_t  t1 = cs_timer_time();
-  cs_timer_counter_add_diff(&(eqb->tcb), &t0, &t1);
+  cs_timer_counter_t  tcb = cs_timer_diff(&t0, &t1);
+  tcb.wall_nsec /= n_eqs;
+  tcb.cpu_nsec /= n_eqs;
 
-  /* Solve the linear system */
-  /* ======================= */
+  /* Solve the linear systems */
+  /* ======================== */
 
-  /* Last step in the computation of the renormalization coefficient */
-  cs_equation_sync_rhs_normalization(eqp->sles_param->resnorm_type,
-                                     eqc->n_dofs,
-                                     rhs,
-                                     &rhs_norm);
+  for (int e = 0; e < n_eqs; e++) {
 
-  cs_sles_t  *sles = cs_sles_find_or_add(eqp->sles_param->field_id, NULL);
+    const cs_equation_param_t  *eqp = eqps[e];
+    cs_equation_builder_t  *eqb = eqbs[e];
+    cs_cdovb_scaleq_t  *eqc = eqcs[e];
 
-  cs_equation_solve_scalar_system(eqc->n_dofs,
-                                  eqp->sles_param,
-                                  matrix,
-                                  rs,
-                                  rhs_norm,
-                                  true, /* rhs_redux */
-                                  sles,
-                                  fld->val,
-                                  rhs);
+    CS_TIMER_COUNTER_ADD(eqb->tcb, eqb->tcb, tcb);
 
-  cs_timer_t  t2 = cs_timer_time();
-  cs_timer_counter_add_diff(&(eqb->tcs), &t1, &t2);
+    cs_timer_t  t2 = cs_timer_time();
 
-  /* Free remaining buffers */
+    /* Last step in the computation of the renormalization coefficient */
+    cs_equation_sync_rhs_normalization(eqp->sles_param->resnorm_type,
+                                       eqc->n_dofs,
+                                       rhs[e],
+                                       rhs_norms + e);
+
+    cs_sles_t  *sles = cs_sles_find_or_add(eqp->sles_param->field_id, NULL);
+
+    cs_equation_solve_scalar_system(eqc->n_dofs,
+                                    eqp->sles_param,
+                                    matrices[e],
+                                    rs,
+                                    rhs_norms[e],
+                                    true, /* rhs_redux */
+                                    sles,
+                                    fields[e]->val,
+                                    rhs[e]);
+
+    cs_timer_t  t3 = cs_timer_time();
+    cs_timer_counter_add_diff(&(eqb->tcs), &t2, &t3);
+
+    /* Free remaining buffers */
+    BFT_FREE(rhs[e]);
+    cs_sles_free(sles);
+    cs_matrix_destroy(matrices + e);
+    _svb_matrix_free_free(mfs + e);
+    BFT_FREE(dir_values[e]);
+    BFT_FREE(forced_ids[e]);
+
+  } /* Loop on equations */
+
+  BFT_FREE(fields);
+  BFT_FREE(eqcs);
+  BFT_FREE(dir_values);
   BFT_FREE(rhs);
-  cs_sles_free(sles);
-  cs_matrix_destroy(&matrix);
+  BFT_FREE(forced_ids);
+  BFT_FREE(matrices);
+  BFT_FREE(mavs);
+  BFT_FREE(mfs);
+  BFT_FREE(rhs_norms);
+  BFT_FREE(ref_ids);
+  BFT_FREE(is_ref);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2011,6 +3100,11 @@ cs_cdovb_scaleq_solve_theta(bool                        cur2prev,
   /* Main OpenMP block on cell */
   /* ------------------------- */
 
+  /* Cells are processed color by color when a cell coloring is used to
+     avoid any synchronization during the assembly */
+  const int  n_colors =
+    (eqc->cell_colors == NULL) ? 1 : eqc->cell_colors->n_elts;
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
     /* Set variables and structures inside the OMP section so that each thread
@@ -2052,158 +3146,170 @@ cs_cdovb_scaleq_solve_theta(bool                        cur2prev,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (int color = 0; color < n_colors; color++) {
 
-      /* Set the current cell flag */
-      cb->cell_flag = connect->cell_flag[c_id];
+      cs_lnum_t  n_color_cells = 0;
+      const cs_lnum_t  *color_cells = _svb_color_cells(eqc, color,
+                                                       &n_color_cells);
 
-      /* Set the local mesh structure for the current cell */
-      cs_cell_mesh_build(c_id,
-                         cs_equation_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
+#     pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
+      for (cs_lnum_t c_idx = 0; c_idx < n_color_cells; c_idx++) {
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
-      _svb_init_cell_system(cm, eqp, eqb, dir_values, eqc->vtx_bc_flag,
-                            forced_ids, fld->val,
-                            csys, cb);
+        const cs_lnum_t  c_id
+          = (color_cells == NULL) ? c_idx : color_cells[c_idx];
 
-      /* Build and add the diffusion/advection/reaction term to the local
-         system. A mass matrix is also built if needed (mass_hodge->matrix) */
-      _svb_conv_diff_reac(eqp, eqb, eqc, cm,
-                          fm, mass_hodge, diff_hodge, csys, cb);
+        /* Set the current cell flag */
+        cb->cell_flag = connect->cell_flag[c_id];
+
+        /* Set the local mesh structure for the current cell */
+        cs_cell_mesh_build(c_id,
+                           cs_equation_cell_mesh_flag(cb->cell_flag, eqb),
+                           connect, quant, cm);
+
+        /* Set the local (i.e. cellwise) structures for the current cell */
+        _svb_init_cell_system(cm, eqp, eqb, dir_values, eqc->vtx_bc_flag,
+                              forced_ids, fld->val,
+                              csys, cb);
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
-        if (compute_initial_source) {
+        /* Build and add the diffusion/advection/reaction term to the local
+           system. A mass matrix is also built if needed (mass_hodge->matrix) */
+        _svb_conv_diff_reac(eqp, eqb, eqc, cm,
+                            fm, mass_hodge, diff_hodge, csys, cb);
+
+        if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                      * =========== */
+          if (compute_initial_source) {
+
+            /* Reset the local contribution */
+            memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+
+            cs_source_term_compute_cellwise(eqp->n_source_terms,
+                        (cs_xdef_t *const *)eqp->source_terms,
+                                            cm,
+                                            eqb->source_mask,
+                                            eqb->compute_source,
+                                            t_cur,
+                                            mass_hodge,
+                                            cb,
+                                            csys->source);
+
+            for (short int v = 0; v < cm->n_vc; v++)
+              csys->rhs[v] += tcoef * csys->source[v];
+
+          }
 
           /* Reset the local contribution */
           memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
           cs_source_term_compute_cellwise(eqp->n_source_terms,
                       (cs_xdef_t *const *)eqp->source_terms,
                                           cm,
                                           eqb->source_mask,
                                           eqb->compute_source,
-                                          t_cur,
+                                          cb->t_st_eval,
                                           mass_hodge,
                                           cb,
                                           csys->source);
 
           for (short int v = 0; v < cm->n_vc; v++)
-            csys->rhs[v] += tcoef * csys->source[v];
-
-        }
+            csys->rhs[v] += eqp->theta * csys->source[v];
 
-        /* Reset the local contribution */
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+        } /* End of term source */
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
-
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += eqp->theta * csys->source[v];
-
-      } /* End of term source */
+        /* Apply boundary conditions (those which are weakly enforced) */
+        _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
-      /* Apply boundary conditions (those which are weakly enforced) */
-      _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+        /* Unsteady term + time scheme
+         * =========================== */
 
-      /* Unsteady term + time scheme
-       * =========================== */
+        /* STEP.1 >> Compute the contribution of the "adr" to the RHS:
+         *           tcoef*adr_pn where adr_pn = csys->mat * p_n */
+        double  *adr_pn = cb->values;
+        cs_sdm_square_matvec(csys->mat, csys->val_n, adr_pn);
+        for (short int i = 0; i < csys->n_dofs; i++) /* n_dofs = n_vc */
+          csys->rhs[i] -= tcoef * adr_pn[i];
 
-      /* STEP.1 >> Compute the contribution of the "adr" to the RHS:
-       *           tcoef*adr_pn where adr_pn = csys->mat * p_n */
-      double  *adr_pn = cb->values;
-      cs_sdm_square_matvec(csys->mat, csys->val_n, adr_pn);
-      for (short int i = 0; i < csys->n_dofs; i++) /* n_dofs = n_vc */
-        csys->rhs[i] -= tcoef * adr_pn[i];
+        /* STEP.2 >> Multiply csys->mat by theta */
+        for (int i = 0; i < csys->n_dofs*csys->n_dofs; i++)
+          csys->mat->val[i] *= eqp->theta;
 
-      /* STEP.2 >> Multiply csys->mat by theta */
-      for (int i = 0; i < csys->n_dofs*csys->n_dofs; i++)
-        csys->mat->val[i] *= eqp->theta;
+        /* STEP.3 >> Handle the mass matrix
+         * Two contributions for the mass matrix
+         *  a) add to csys->mat
+         *  b) add to rhs mass_mat * p_n */
+        if (!(eqb->time_pty_uniform))
+          cb->tpty_val = cs_property_value_in_cell(cm, eqp->time_property,
+                                                   cb->t_pty_eval);
 
-      /* STEP.3 >> Handle the mass matrix
-       * Two contributions for the mass matrix
-       *  a) add to csys->mat
-       *  b) add to rhs mass_mat * p_n */
-      if (!(eqb->time_pty_uniform))
-        cb->tpty_val = cs_property_value_in_cell(cm, eqp->time_property,
-                                                 cb->t_pty_eval);
+        if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) { /* Mass lumping */
 
-      if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) { /* Mass lumping */
+          /* |c|*wvc = |dual_cell(v) cap c| */
+          const double  ptyc = cb->tpty_val * cm->vol_c * inv_dtcur;
 
-        /* |c|*wvc = |dual_cell(v) cap c| */
-        const double  ptyc = cb->tpty_val * cm->vol_c * inv_dtcur;
+          /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
+           *       >> Update the cellwise system with the time matrix */
+          for (short int i = 0; i < cm->n_vc; i++) {
 
-        /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
-         *       >> Update the cellwise system with the time matrix */
-        for (short int i = 0; i < cm->n_vc; i++) {
+            const double  dval = ptyc * cm->wvc[i];
 
-          const double  dval = ptyc * cm->wvc[i];
+            /* Update the RHS with mass_mat * values at time t_n */
+            csys->rhs[i] += dval * csys->val_n[i];
 
-          /* Update the RHS with mass_mat * values at time t_n */
-          csys->rhs[i] += dval * csys->val_n[i];
+            /* Add the diagonal contribution from time matrix to the local
+               system */
+            csys->mat->val[i*(cm->n_vc + 1)] += dval;
 
-          /* Add the diagonal contribution from time matrix to the local
-             system */
-          csys->mat->val[i*(cm->n_vc + 1)] += dval;
+          }
 
         }
+        else { /* Use the mass matrix */
 
-      }
-      else { /* Use the mass matrix */
-
-        const double  tpty_coef = cb->tpty_val * inv_dtcur;
-        const cs_sdm_t  *mass_mat = mass_hodge->matrix;
+          const double  tpty_coef = cb->tpty_val * inv_dtcur;
+          const cs_sdm_t  *mass_mat = mass_hodge->matrix;
 
-        /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
-           >> Update the cellwise system with the time matrix */
+          /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
+             >> Update the cellwise system with the time matrix */
 
-        /* Update rhs with mass_mat*p^n */
-        double  *time_pn = cb->values;
-        cs_sdm_square_matvec(mass_mat, csys->val_n, time_pn);
-        for (short int i = 0; i < csys->n_dofs; i++)
-          csys->rhs[i] += tpty_coef*time_pn[i];
+          /* Update rhs with mass_mat*p^n */
+          double  *time_pn = cb->values;
+          cs_sdm_square_matvec(mass_mat, csys->val_n, time_pn);
+          for (short int i = 0; i < csys->n_dofs; i++)
+            csys->rhs[i] += tpty_coef*time_pn[i];
 
-        /* Update the cellwise system with the time matrix */
-        cs_sdm_add_mult(csys->mat, tpty_coef, mass_mat);
+          /* Update the cellwise system with the time matrix */
+          cs_sdm_add_mult(csys->mat, tpty_coef, mass_mat);
 
-      }
+        }
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump("\n>> Cell system after adding time", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump("\n>> Cell system after adding time", csys);
 #endif
 
-      /* Compute a norm of the RHS for the normalization of the residual
-         of the linear system to solve */
-      rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
-                                            cm, csys);
+        /* Compute a norm of the RHS for the normalization of the residual
+           of the linear system to solve */
+        rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                              cm, csys);
 
-      /* Enforce values if needed (internal or Dirichlet) */
-      _svb_enforce_values(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+        /* Enforce values if needed (internal or Dirichlet) */
+        _svb_enforce_values(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
 #endif
 
-      /* Assembly process
-       * ================ */
-      _svb_assemble(eqc, cm, csys, rs, eqa, mav, rhs);
+        /* Assembly process
+         * ================ */
+        _svb_assemble(eqc, cm, csys, rs, eqa, mav, NULL, rhs);
 
-    } /* Main loop on cells */
+      } /* Main loop on cells */
+
+    } /* Loop on cell colors */
 
   } /* OPENMP Block */
 
@@ -2519,8 +3625,11 @@ cs_cdovb_scaleq_balance(const cs_equation_param_t     *eqp,
                                          diff_hodge);
 
         /* Define the local stiffness matrix: local matrix owned by the cellwise
-           builder (store in cb->loc) */
-        eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+           builder (store in cb->loc). Use the cached matrix if available. */
+        if (!cs_cell_sdm_cache_get(eqc->diffusion_cache, cm->c_id, cb->loc)) {
+          eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+          cs_cell_sdm_cache_set(eqc->diffusion_cache, cm->c_id, cb->loc);
+        }
 
         cs_real_t  *res = cb->values;
         memset(res, 0, cm->n_vc*sizeof(cs_real_t));
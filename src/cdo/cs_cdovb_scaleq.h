@@ -211,6 +211,34 @@ cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
                                cs_equation_builder_t      *eqb,
                                void                       *context);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build and solve the linear systems arising from a set of scalar
+ *         unsteady convection/diffusion/reaction equations with a CDO-Vb
+ *         scheme and an implicit time scheme.
+ *         The cellwise view of the mesh is built only once for each cell and
+ *         then shared by the local builders of all the equations. Each
+ *         equation keeps its own matrix, right-hand side and linear solver.
+ *
+ * \param[in]      cur2prev   true="current to previous" operation is performed
+ * \param[in]      mesh       pointer to a cs_mesh_t structure
+ * \param[in]      n_eqs      number of equations to solve
+ * \param[in]      field_ids  ids of the variable fields (size: n_eqs)
+ * \param[in]      eqps       pointers to cs_equation_param_t structures
+ * \param[in, out] eqbs       pointers to cs_equation_builder_t structures
+ * \param[in, out] contexts   pointers to cs_cdovb_scaleq_t structures
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_solve_implicit_group(bool                         cur2prev,
+                                     const cs_mesh_t             *mesh,
+                                     int                          n_eqs,
+                                     const int                    field_ids[],
+                                     const cs_equation_param_t   *eqps[],
+                                     cs_equation_builder_t       *eqbs[],
+                                     void                        *contexts[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build and solve the linear system arising from a scalar unsteady
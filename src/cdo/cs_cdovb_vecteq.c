@@ -851,6 +851,8 @@ cs_cdovb_vecteq_init_context(const cs_equation_param_t   *eqp,
   /* Diffusion term */
   eqc->get_stiffness_matrix = NULL;
   eqc->get_stiffness_matrix = NULL;
+  eqc->diffusion_cache = NULL;
+  eqc->cell_colors = NULL;
 
   if (cs_equation_param_has_diffusion(eqp)) {
 
@@ -2690,6 +2690,88 @@ cs_equation_solve(bool                        cur2prev,
     cs_timer_stats_stop(eq->main_ts_id);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build and then solve the linear systems for a set of independent
+ *         equations with an unsteady term.
+ *         Equations relying on a scalar-valued CDO-Vb scheme with an implicit
+ *         time scheme are built in a single loop on cells so that the
+ *         cellwise view of the mesh is built only once. Other equations are
+ *         solved one by one. The order of resolution is thus not preserved.
+ *
+ * \param[in]      cur2prev   true="current to previous" operation is performed
+ * \param[in]      mesh       pointer to a cs_mesh_t structure
+ * \param[in]      n_eqs      number of equations to solve
+ * \param[in, out] eqs        list of pointers to cs_equation_t structures
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_solve_group(bool                        cur2prev,
+                        const cs_mesh_t            *mesh,
+                        int                         n_eqs,
+                        cs_equation_t              *eqs[])
+{
+  if (n_eqs < 1)
+    return;
+
+  /* Gather the equations which can be built together */
+  int  n_group_eqs = 0;
+  int  *field_ids = NULL;
+  const cs_equation_param_t  **eqps = NULL;
+  cs_equation_builder_t  **eqbs = NULL;
+  cs_equation_t  **group_eqs = NULL;
+  void  **contexts = NULL;
+
+  BFT_MALLOC(field_ids, n_eqs, int);
+  BFT_MALLOC(eqps, n_eqs, const cs_equation_param_t *);
+  BFT_MALLOC(eqbs, n_eqs, cs_equation_builder_t *);
+  BFT_MALLOC(group_eqs, n_eqs, cs_equation_t *);
+  BFT_MALLOC(contexts, n_eqs, void *);
+
+  for (int i = 0; i < n_eqs; i++) {
+
+    cs_equation_t  *eq = eqs[i];
+
+    if (eq == NULL)
+      bft_error(__FILE__, __LINE__, 0,
+                "%s: Empty equation structure", __func__);
+    assert(cs_equation_uses_new_mechanism(eq));
+
+    if (eq->solve == cs_cdovb_scaleq_solve_implicit) {
+
+      field_ids[n_group_eqs] = eq->field_id;
+      eqps[n_group_eqs] = eq->param;
+      eqbs[n_group_eqs] = eq->builder;
+      group_eqs[n_group_eqs] = eq;
+      contexts[n_group_eqs] = eq->scheme_context;
+      n_group_eqs++;
+
+    }
+    else
+      cs_equation_solve(cur2prev, mesh, eq);
+
+  } /* Loop on equations */
+
+  if (n_group_eqs == 1)
+    cs_equation_solve(cur2prev, mesh, group_eqs[0]);
+
+  else if (n_group_eqs > 1)
+    cs_cdovb_scaleq_solve_implicit_group(cur2prev,
+                                         mesh,
+                                         n_group_eqs,
+                                         field_ids,
+                                         eqps,
+                                         eqbs,
+                                         contexts);
+
+  BFT_FREE(field_ids);
+  BFT_FREE(eqps);
+  BFT_FREE(eqbs);
+  BFT_FREE(group_eqs);
+  BFT_FREE(contexts);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Apply the current to previous to all fields (and potentially arrays)
@@ -611,6 +611,28 @@ cs_equation_solve(bool                        cur2prev,
                   const cs_mesh_t            *mesh,
                   cs_equation_t              *eq);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build and then solve the linear systems for a set of independent
+ *         equations with an unsteady term.
+ *         Equations relying on a scalar-valued CDO-Vb scheme with an implicit
+ *         time scheme are built in a single loop on cells so that the
+ *         cellwise view of the mesh is built only once. Other equations are
+ *         solved one by one. The order of resolution is thus not preserved.
+ *
+ * \param[in]      cur2prev   true="current to previous" operation is performed
+ * \param[in]      mesh       pointer to a cs_mesh_t structure
+ * \param[in]      n_eqs      number of equations to solve
+ * \param[in, out] eqs        list of pointers to cs_equation_t structures
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_solve_group(bool                        cur2prev,
+                        const cs_mesh_t            *mesh,
+                        int                         n_eqs,
+                        cs_equation_t              *eqs[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build the linear system for this equation
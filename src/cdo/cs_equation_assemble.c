@@ -145,18 +145,21 @@ struct _cs_equation_assemble_t {
  * \brief  Choose which function will be used to perform the matrix assembly
  *         Case of scalar-valued matrices.
  *
+ * \param[in] omp_sync   true if concurrent cellwise assemblies may update
+ *                       the same rows (synchronization with OpenMP)
+ *
  * \return  a pointer to a function
  */
 /*----------------------------------------------------------------------------*/
 
 static inline cs_equation_assembly_t *
-_set_scalar_assembly_func(void)
+_set_scalar_assembly_func(bool    omp_sync)
 {
 #if defined(HAVE_MPI)
 
   if (cs_glob_n_ranks > 1) {  /* Parallel */
 
-    if (cs_glob_n_threads < 2) /* Without OpenMP */
+    if (cs_glob_n_threads < 2 || !omp_sync) /* Without OpenMP sync. */
       return cs_equation_assemble_matrix_mpis;
     else                       /* With OpenMP */
       return cs_equation_assemble_matrix_mpit;
@@ -167,7 +170,7 @@ _set_scalar_assembly_func(void)
 
   if (cs_glob_n_ranks <= 1) { /* Sequential */
 
-    if (cs_glob_n_threads < 2) /* Without OpenMP */
+    if (cs_glob_n_threads < 2 || !omp_sync) /* Without OpenMP sync. */
       return cs_equation_assemble_matrix_seqs;
     else                       /* With OpenMP */
       return cs_equation_assemble_matrix_seqt;
@@ -182,18 +185,21 @@ _set_scalar_assembly_func(void)
  * \brief  Choose which function will be used to perform the matrix assembly
  *         Case of block 3x3 matrices.
  *
+ * \param[in] omp_sync   true if concurrent cellwise assemblies may update
+ *                       the same rows (synchronization with OpenMP)
+ *
  * \return  a pointer to a function
  */
 /*----------------------------------------------------------------------------*/
 
 static inline cs_equation_assembly_t *
-_set_block33_assembly_func(void)
+_set_block33_assembly_func(bool    omp_sync)
 {
 #if defined(HAVE_MPI)
 
   if (cs_glob_n_ranks > 1) {  /* Parallel */
 
-    if (cs_glob_n_threads < 2) /* Without OpenMP */
+    if (cs_glob_n_threads < 2 || !omp_sync) /* Without OpenMP sync. */
       return cs_equation_assemble_eblock33_matrix_mpis;
     else                      /* With OpenMP */
       return cs_equation_assemble_eblock33_matrix_mpit;
@@ -204,7 +210,7 @@ _set_block33_assembly_func(void)
 
   if (cs_glob_n_ranks <= 1) {  /* Sequential */
 
-    if (cs_glob_n_threads < 2) /* Without OpenMP */
+    if (cs_glob_n_threads < 2 || !omp_sync) /* Without OpenMP sync. */
       return cs_equation_assemble_eblock33_matrix_seqs;
     else                      /* With OpenMP */
       return cs_equation_assemble_eblock33_matrix_seqt;
@@ -219,18 +225,21 @@ _set_block33_assembly_func(void)
  * \brief  Choose which function will be used to perform the matrix assembly
  *         Case of block NxN matrices.
  *
+ * \param[in] omp_sync   true if concurrent cellwise assemblies may update
+ *                       the same rows (synchronization with OpenMP)
+ *
  * \return  a pointer to a function
  */
 /*----------------------------------------------------------------------------*/
 
 static inline cs_equation_assembly_t *
-_set_block_assembly_func(void)
+_set_block_assembly_func(bool    omp_sync)
 {
 #if defined(HAVE_MPI)
 
   if (cs_glob_n_ranks > 1) {  /* Parallel */
 
-    if (cs_glob_n_threads < 2) /* Without OpenMP */
+    if (cs_glob_n_threads < 2 || !omp_sync) /* Without OpenMP sync. */
       return cs_equation_assemble_eblock_matrix_mpis;
     else                      /* With OpenMP */
       return cs_equation_assemble_eblock_matrix_mpit;
@@ -241,7 +250,7 @@ _set_block_assembly_func(void)
 
   if (cs_glob_n_ranks <= 1) {  /* Sequential */
 
-    if (cs_glob_n_threads < 2) /* Without OpenMP */
+    if (cs_glob_n_threads < 2 || !omp_sync) /* Without OpenMP sync. */
       return cs_equation_assemble_eblock_matrix_seqs;
     else                      /* With OpenMP */
       return cs_equation_assemble_eblock_matrix_seqt;
@@ -908,6 +917,66 @@ _build_matrix_assembler(cs_lnum_t                n_elts,
   return ma;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define the function pointer used to assemble the algebraic system
+ *
+ * \param[in] scheme     space discretization scheme
+ * \param[in] ma_id      id in the array of matrix assembler
+ * \param[in] omp_sync   true if concurrent cellwise assemblies may update
+ *                       the same rows
+ *
+ * \return a function pointer cs_equation_assembly_t
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_equation_assembly_t *
+_set_assembly_func(cs_param_space_scheme_t    scheme,
+                   int                        ma_id,
+                   bool                       omp_sync)
+{
+  switch (scheme) {
+
+  case CS_SPACE_SCHEME_CDOVB:
+    if (ma_id == CS_CDO_CONNECT_VTX_SCAL)
+      return _set_scalar_assembly_func(omp_sync);
+    else if (ma_id == CS_CDO_CONNECT_VTX_VECT)
+      return _set_block33_assembly_func(omp_sync);
+    break;
+
+  case CS_SPACE_SCHEME_CDOVCB:
+    if (ma_id == CS_CDO_CONNECT_VTX_SCAL)
+      return _set_scalar_assembly_func(omp_sync);
+    break;
+
+  case CS_SPACE_SCHEME_HHO_P0:
+  case CS_SPACE_SCHEME_CDOFB:
+    if (ma_id == CS_CDO_CONNECT_FACE_SP0)
+      return _set_scalar_assembly_func(omp_sync);
+    else if (ma_id == CS_CDO_CONNECT_FACE_VP0)
+      return _set_block33_assembly_func(omp_sync);
+    break;
+
+  case CS_SPACE_SCHEME_HHO_P1:
+  case CS_SPACE_SCHEME_HHO_P2:
+    if (ma_id == CS_CDO_CONNECT_FACE_SP1)
+      return _set_block33_assembly_func(omp_sync);
+    else
+      return _set_block_assembly_func(omp_sync);
+    break;
+
+  case CS_SPACE_SCHEME_CDOEB:
+    if (ma_id == CS_CDO_CONNECT_EDGE_SCAL)
+      return _set_scalar_assembly_func(omp_sync);
+    break;
+
+  default:
+    return NULL; /* Case not handle */
+  }
+
+  return NULL;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1290,46 +1359,28 @@ cs_equation_assembly_t *
 cs_equation_assemble_set(cs_param_space_scheme_t    scheme,
                          int                        ma_id)
 {
-  switch (scheme) {
-
-  case CS_SPACE_SCHEME_CDOVB:
-    if (ma_id == CS_CDO_CONNECT_VTX_SCAL)
-      return _set_scalar_assembly_func();
-    else if (ma_id == CS_CDO_CONNECT_VTX_VECT)
-      return _set_block33_assembly_func();
-    break;
-
-  case CS_SPACE_SCHEME_CDOVCB:
-    if (ma_id == CS_CDO_CONNECT_VTX_SCAL)
-      return _set_scalar_assembly_func();
-    break;
-
-  case CS_SPACE_SCHEME_HHO_P0:
-  case CS_SPACE_SCHEME_CDOFB:
-    if (ma_id == CS_CDO_CONNECT_FACE_SP0)
-      return _set_scalar_assembly_func();
-    else if (ma_id == CS_CDO_CONNECT_FACE_VP0)
-      return _set_block33_assembly_func();
-    break;
-
-  case CS_SPACE_SCHEME_HHO_P1:
-  case CS_SPACE_SCHEME_HHO_P2:
-    if (ma_id == CS_CDO_CONNECT_FACE_SP1)
-      return _set_block33_assembly_func();
-    else
-      return _set_block_assembly_func();
-    break;
-
-  case CS_SPACE_SCHEME_CDOEB:
-    if (ma_id == CS_CDO_CONNECT_EDGE_SCAL)
-      return _set_scalar_assembly_func();
-    break;
+  return _set_assembly_func(scheme, ma_id, true);
+}
 
-  default:
-    return NULL; /* Case not handle */
-  }
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define the function pointer used to assemble the algebraic system
+ *         without any OpenMP synchronization. The caller has to ensure that
+ *         cellwise systems which are assembled concurrently do not share any
+ *         DoF (for instance when cells are processed color by color).
+ *
+ * \param[in] scheme     space discretization scheme
+ * \param[in] ma_id      id in the array of matrix assembler
+ *
+ * \return a function pointer cs_equation_assembly_t
+ */
+/*----------------------------------------------------------------------------*/
 
-  return NULL;
+cs_equation_assembly_t *
+cs_equation_assemble_set_no_sync(cs_param_space_scheme_t    scheme,
+                                 int                        ma_id)
+{
+  return _set_assembly_func(scheme, ma_id, false);
 }
 
 #if defined(HAVE_MPI)
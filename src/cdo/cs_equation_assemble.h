@@ -155,6 +155,24 @@ cs_equation_assembly_t *
 cs_equation_assemble_set(cs_param_space_scheme_t    scheme,
                          int                        ma_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define the function pointer used to assemble the algebraic system
+ *         without any OpenMP synchronization. The caller has to ensure that
+ *         cellwise systems which are assembled concurrently do not share any
+ *         DoF (for instance when cells are processed color by color).
+ *
+ * \param[in] scheme     space discretization scheme
+ * \param[in] ma_id      id in the array of matrix assembler
+ *
+ * \return a function pointer cs_equation_assembly_t
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_equation_assembly_t *
+cs_equation_assemble_set_no_sync(cs_param_space_scheme_t    scheme,
+                                 int                        ma_id);
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------*/
@@ -272,6 +272,15 @@ _set_key(cs_equation_param_t   *eqp,
                 __func__, eqp->weak_pena_bc_coeff);
     break;
 
+  case CS_EQKEY_CELLWISE_CACHE_SIZE:
+    eqp->cellwise_cache_size = atof(keyval);
+    if (eqp->cellwise_cache_size < 0.)
+      bft_error(__FILE__, __LINE__, 0,
+                " %s: Invalid value of the cellwise cache size %5.3e\n"
+                " This should be positive.",
+                __func__, eqp->cellwise_cache_size);
+    break;
+
   case CS_EQKEY_DO_LUMPING:
     if (strcmp(keyval, "true") == 0 || strcmp(keyval, "1") == 0)
       eqp->do_lumping = true;
@@ -490,11 +499,20 @@ _set_key(cs_equation_param_t   *eqp,
     eqp->sles_param->restart = atoi(keyval);
     break;
 
+  case CS_EQKEY_MATRIX_FREE:
+    if (strcmp(keyval, "true") == 0 || strcmp(keyval, "1") == 0)
+      eqp->matrix_free = true;
+    else
+      eqp->matrix_free = false;  /* Should be the default behavior */
+    break;
+
   case CS_EQKEY_OMP_ASSEMBLY_STRATEGY:
     if (strcmp(keyval, "critical") == 0)
       eqp->omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_CRITICAL;
     else if (strcmp(keyval, "atomic") == 0)
       eqp->omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_ATOMIC;
+    else if (strcmp(keyval, "color") == 0)
+      eqp->omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_COLOR;
     else {
       const char *_val = keyval;
       bft_error(__FILE__, __LINE__, 0,
@@ -599,6 +617,10 @@ _set_key(cs_equation_param_t   *eqp,
     }
     else if (strcmp(keyval, "as") == 0)
       eqp->sles_param->precond = CS_PARAM_PRECOND_AS;
+    else if (strcmp(keyval, "ams") == 0) {
+      eqp->sles_param->precond = CS_PARAM_PRECOND_AMS;
+      eqp->sles_param->solver_class = CS_PARAM_SLES_CLASS_HYPRE;
+    }
     else {
       const char *_val = keyval;
       bft_error(__FILE__, __LINE__, 0,
@@ -925,6 +947,10 @@ cs_equation_create_param(const char            *name,
   /* Settings for the OpenMP strategy */
   eqp->omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_CRITICAL;
 
+  /* Settings for caching cellwise operators and matrix-free resolution */
+  eqp->cellwise_cache_size = 0.;
+  eqp->matrix_free = false;
+
   return eqp;
 }
 
@@ -1108,6 +1134,8 @@ cs_equation_copy_param_from(const cs_equation_param_t   *ref,
 
   /* Settings related to the performance */
   dst->omp_assembly_choice = ref->omp_assembly_choice;
+  dst->cellwise_cache_size = ref->cellwise_cache_size;
+  dst->matrix_free = ref->matrix_free;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1405,8 +1433,18 @@ cs_equation_param_log(const cs_equation_param_t   *eqp)
     else if (eqp->omp_assembly_choice == CS_PARAM_ASSEMBLE_OMP_ATOMIC)
       cs_log_printf(CS_LOG_SETUP, "  * %s | OpenMP.Assembly.Choice:  %s\n",
                     eqname, "atomic");
+    else if (eqp->omp_assembly_choice == CS_PARAM_ASSEMBLE_OMP_COLOR)
+      cs_log_printf(CS_LOG_SETUP, "  * %s | OpenMP.Assembly.Choice:  %s\n",
+                    eqname, "color");
   }
 
+  if (eqp->cellwise_cache_size > 0)
+    cs_log_printf(CS_LOG_SETUP, "  * %s | Cellwise cache size:  %g MB\n",
+                  eqname, eqp->cellwise_cache_size);
+  if (eqp->matrix_free)
+    cs_log_printf(CS_LOG_SETUP, "  * %s | Matrix-free resolution: true\n",
+                  eqname);
+
   /* Boundary conditions */
   cs_log_printf(CS_LOG_SETUP, "\n### %s | Boundary condition settings\n",
                 eqname);
@@ -803,9 +803,20 @@ typedef struct {
    *
    * \var omp_assembly_choice
    * When OpenMP is active, choice of parallel reduction for the assembly
+   *
+   * \var cellwise_cache_size
+   * Memory budget (in MB) for caching cellwise operators which do not change
+   * along the computation (0: no cache)
+   *
+   * \var matrix_free
+   * If true, the global matrix is not assembled: the linear solver applies
+   * the operator by rebuilding the cellwise systems (only available with
+   * scalar-valued CDO vertex-based schemes)
    */
 
   cs_param_assemble_omp_strategy_t     omp_assembly_choice;
+  double                               cellwise_cache_size;
+  bool                                 matrix_free;
 
   /*! @} */
 
@@ -917,6 +928,13 @@ typedef struct {
  * cf. \ref CS_PARAM_BC_ENFORCE_WEAK_NITSCHE
  * or  \ref CS_PARAM_BC_ENFORCE_WEAK_SYM
  *
+ * \var CS_EQKEY_CELLWISE_CACHE_SIZE
+ * Set the memory budget (in MB) used to store cellwise operators which do
+ * not change along the computation (diffusion operator built from a steady
+ * property), so that they are not rebuilt at each resolution. Cells beyond
+ * the budget are handled as usual. The default value is 0 (no cache).
+ * - Example: "256"
+ *
  * \var CS_EQKEY_DOF_REDUCTION
  * Set how is defined each degree of freedom (DoF).
  * - "de_rham" (default): Evaluation at vertices for potentials, integral
@@ -1044,10 +1062,22 @@ typedef struct {
  * buffer of double with a size equal to restart*sizeof(solution array)
  * - Example: "20"
  *
+ * \var CS_EQKEY_MATRIX_FREE
+ * Solve the linear system without assembling its matrix: the operator is
+ * applied by rebuilding the cellwise systems at each matrix-vector product.
+ * This saves the memory of the assembled matrix at the price of more
+ * computations. Only available with scalar-valued CDO vertex-based schemes
+ * (steady or implicit Euler time scheme), with an iterative solver of
+ * code_saturne using no or a diagonal/polynomial preconditioner.
+ * - "true" or "false" (default)
+ *
  * \var CS_EQKEY_OMP_ASSEMBLY_STRATEGY
  * Choice of the way to perform the assembly when OpenMP is active
  * Available choices are:
  * - "atomic" or "critical"
+ * - "color": cells are processed color by color so that cells of the same
+ *   color share no DoF and no synchronization is needed (only for
+ *   scalar-valued CDO vertex-based schemes; "atomic" is used otherwise)
  *
  * \var CS_EQKEY_PRECOND
  * Specify the preconditioner associated to an iterative solver. Available
@@ -1063,6 +1093,8 @@ typedef struct {
  * - "amg": algebraic multigrid
  * - "amg_block": algebraic multigrid by block (useful for vector-valued
  *                equations)
+ * - "ams": auxiliary-space Maxwell preconditioner for CDO edge-based
+ *          schemes (only with PETSc and HYPRE)
  *
  * \var CS_EQKEY_SLES_VERBOSITY
  * Level of details written by the code for the resolution of the linear system
@@ -1116,6 +1148,7 @@ typedef enum {
   CS_EQKEY_BC_QUADRATURE,
   CS_EQKEY_BC_STRONG_PENA_COEFF,
   CS_EQKEY_BC_WEAK_PENA_COEFF,
+  CS_EQKEY_CELLWISE_CACHE_SIZE,
   CS_EQKEY_DO_LUMPING,
   CS_EQKEY_DOF_REDUCTION,
   CS_EQKEY_EXTRA_OP,
@@ -1128,6 +1161,7 @@ typedef enum {
   CS_EQKEY_ITSOL_MAX_ITER,
   CS_EQKEY_ITSOL_RESNORM_TYPE,
   CS_EQKEY_ITSOL_RESTART,
+  CS_EQKEY_MATRIX_FREE,
   CS_EQKEY_OMP_ASSEMBLY_STRATEGY,
   CS_EQKEY_PRECOND,
   CS_EQKEY_SLES_VERBOSITY,
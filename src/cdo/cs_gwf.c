@@ -449,6 +449,9 @@ _update_darcy_flux(const cs_real_t              t_eval,
   /* Update the velocity field at cell centers induced by the Darcy flux */
   cs_field_t  *vel = cs_advection_field_get_field(adv, CS_MESH_LOCATION_CELLS);
 
+  /* Cached cellwise fluxes (if any) are no longer valid */
+  cs_advection_field_reset_cw_flux_cache(gw->adv_field);
+
   assert(vel != NULL); /* Sanity check */
   if (cur2prev)
     cs_field_current_to_previous(vel);
@@ -1086,8 +1089,33 @@ cs_gwf_add_tracer_terms(void)
               _(" Groundwater module is activated but no soil is defined."));
 
   /* Loop on tracer equations */
-  for (int i = 0; i < gw->n_tracers; i++)
-    gw->add_tracer_terms[i](gw->tracers[i]);
+  for (int i = 0; i < gw->n_tracers; i++) {
+
+    cs_gwf_tracer_t  *tracer = gw->tracers[i];
+
+    /* Tracers with the same diffusion parameters share the diffusion tensor
+       of the first one. It is thus updated only once and the local diffusion
+       operator is built only once when tracers are solved together. */
+    if (gw->add_tracer_terms[i] == cs_gwf_tracer_add_terms) {
+
+      for (int j = 0; j < i; j++) {
+
+        const cs_gwf_tracer_t  *ref = gw->tracers[j];
+
+        if (gw->add_tracer_terms[j] == cs_gwf_tracer_add_terms &&
+            ref->diffusivity != NULL &&
+            cs_gwf_tracer_same_diffusion(ref, tracer)) {
+          tracer->diffusivity = ref->diffusivity;
+          break;
+        }
+
+      }
+
+    }
+
+    gw->add_tracer_terms[i](tracer);
+
+  } /* Loop on tracer equations */
 
 }
 
@@ -1317,6 +1345,12 @@ cs_gwf_update(const cs_mesh_t             *mesh,
 
     } /* Loop on soils */
 
+    /* Values have been updated in place: cellwise caches (if any) are not
+       valid anymore */
+    cs_property_reset_cell_cache(gw->permeability);
+    cs_property_reset_cell_cache(gw->moisture_content);
+    cs_property_reset_cell_cache(gw->soil_capacity);
+
   } /* Not all saturated */
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_GWF_DBG > 1
@@ -1433,22 +1467,40 @@ cs_gwf_compute(const cs_mesh_t              *mesh,
 
   }
 
+  /* Tracer equations are independent. They are built together when they
+     share the same discretization so that the cellwise view of the mesh is
+     built only once for all of them */
+  int  n_unsteady_tracers = 0;
+  cs_equation_t  **tracer_eqs = NULL;
+  BFT_MALLOC(tracer_eqs, gw->n_tracers, cs_equation_t *);
+
   for (int i = 0; i < gw->n_tracers; i++) {
 
     cs_gwf_tracer_t  *tracer = gw->tracers[i];
 
-    if (!cs_equation_is_steady(tracer->eq)) { /* unsteady ? */
+    if (!cs_equation_is_steady(tracer->eq)) /* unsteady ? */
+      tracer_eqs[n_unsteady_tracers++] = tracer->eq;
+
+  }
 
-      /* Solve the algebraic system. By default, a current to previous operation
-         is performed */
-      cs_equation_solve(cur2prev, mesh, tracer->eq);
+  /* Solve the algebraic systems. By default, a current to previous operation
+     is performed */
+  cs_equation_solve_group(cur2prev, mesh, n_unsteady_tracers, tracer_eqs);
+
+  BFT_FREE(tracer_eqs);
+
+  for (int i = 0; i < gw->n_tracers; i++) {
+
+    cs_gwf_tracer_t  *tracer = gw->tracers[i];
+
+    if (!cs_equation_is_steady(tracer->eq)) { /* unsteady ? */
 
       if (tracer->update_precipitation != NULL)
         tracer->update_precipitation(tracer,
                                      time_step->t_cur,
                                      mesh, connect, cdoq);
 
-    } /* Solve this equation which is unsteady */
+    } /* This equation is unsteady */
 
   } /* Loop on tracer equations */
 
@@ -789,6 +789,47 @@ cs_gwf_set_precip_tracer_param(cs_gwf_tracer_t   *tracer,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if two tracers relying on the default modelling have the same
+ *         water molecular diffusivity and dispersivities in each soil. In
+ *         this case, both tracers share the same diffusion tensor.
+ *
+ * \param[in]  t1      pointer to a first cs_gwf_tracer_t structure
+ * \param[in]  t2      pointer to a second cs_gwf_tracer_t structure
+ *
+ * \return true if the diffusion tensor is the same for both tracers
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_gwf_tracer_same_diffusion(const cs_gwf_tracer_t     *t1,
+                             const cs_gwf_tracer_t     *t2)
+{
+  if (t1 == NULL || t2 == NULL)
+    return false;
+  if ((t1->model & CS_GWF_TRACER_USER) || (t2->model & CS_GWF_TRACER_USER))
+    return false;
+
+  const cs_gwf_tracer_input_t  *in1 = (cs_gwf_tracer_input_t *)t1->input;
+  const cs_gwf_tracer_input_t  *in2 = (cs_gwf_tracer_input_t *)t2->input;
+
+  if (in1 == NULL || in2 == NULL)
+    return false;
+
+  const int n_soils = cs_gwf_get_n_soils();
+  for (int soil_id = 0; soil_id < n_soils; soil_id++) {
+
+    if (fabs(in1->wmd[soil_id] - in2->wmd[soil_id]) > 0. ||
+        fabs(in1->alpha_l[soil_id] - in2->alpha_l[soil_id]) > 0. ||
+        fabs(in1->alpha_t[soil_id] - in2->alpha_t[soil_id]) > 0.)
+      return false;
+
+  } /* Loop on soils */
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Add terms to the algebraic system related to a tracer equation
@@ -835,7 +876,19 @@ cs_gwf_tracer_add_terms(cs_gwf_tracer_t     *tracer)
   const int  c_loc_id = cs_mesh_location_get_id_by_name("cells");
   const int  post_key = cs_field_key_id("post_vis");
 
-  if (do_diffusion) { /* Add a new diffusion property for this equation */
+  if (do_diffusion && tracer->diffusivity != NULL) {
+
+    /* The diffusion tensor is shared with a previous tracer (same property
+       and same field). It is updated by this tracer only. */
+    cs_property_t *diff_pty = cs_property_by_name(tracer->diffusivity->name);
+    assert(diff_pty != NULL);
+
+    cs_equation_add_diffusion(eqp, diff_pty);
+
+    tracer->update_diff_tensor = NULL;
+
+  }
+  else if (do_diffusion) { /* Add a new diffusion property for this equation */
 
     int  len = strlen(eq_name) + strlen("_diffusivity") + 1;
     if (len > max_len) {
@@ -956,7 +1009,9 @@ cs_gwf_tracer_setup(const cs_cdo_connect_t      *connect,
 
     cs_property_t  *diff_pty = cs_equation_get_diffusion_property(tracer->eq);
 
-    cs_property_def_by_field(diff_pty, tracer->diffusivity);
+    /* Already done if the property is shared with a previous tracer */
+    if (diff_pty->n_definitions == 0)
+      cs_property_def_by_field(diff_pty, tracer->diffusivity);
 
   } /* diffusion */
 
@@ -1092,6 +1147,10 @@ cs_gwf_tracer_log_setup(const cs_gwf_tracer_t     *tracer)
   else {
 
     cs_log_printf(CS_LOG_SETUP, "  * GWF | Tracer: Default model\n");
+    if (tracer->diffusivity != NULL && tracer->update_diff_tensor == NULL)
+      cs_log_printf(CS_LOG_SETUP,
+                    "  * GWF | Shared diffusion tensor: %s\n",
+                    tracer->diffusivity->name);
     if (tracer->model & CS_GWF_TRACER_PRECIPITATION)
       cs_log_printf(CS_LOG_SETUP, "  * GWF | + Precipitation effects\n");
     if (tracer->model & CS_GWF_TRACER_SORPTION_EK_3_PARAMETERS)
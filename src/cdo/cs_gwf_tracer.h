@@ -206,7 +206,10 @@ struct _gwf_tracer_t{
   cs_gwf_tracer_model_t        model;
 
   cs_field_t                  *diffusivity; /* NULL if no diffusion term is
-                                               build in the tracer equation */
+                                               build in the tracer equation.
+                                               May be shared with a previous
+                                               tracer with the same diffusion
+                                               parameters */
   int                          reaction_id; /* id related to the reaction
                                                term in the tracer equation */
 
@@ -338,6 +341,23 @@ cs_gwf_set_precip_tracer_param(cs_gwf_tracer_t   *tracer,
                                const char        *soil_name,
                                double             conc_w_star);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if two tracers relying on the default modelling have the same
+ *         water molecular diffusivity and dispersivities in each soil. In
+ *         this case, both tracers share the same diffusion tensor.
+ *
+ * \param[in]  t1      pointer to a first cs_gwf_tracer_t structure
+ * \param[in]  t2      pointer to a second cs_gwf_tracer_t structure
+ *
+ * \return true if the diffusion tensor is the same for both tracers
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_gwf_tracer_same_diffusion(const cs_gwf_tracer_t     *t1,
+                             const cs_gwf_tracer_t     *t2);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Add terms to the algebraic system related to a tracer equation
@@ -33,6 +33,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <string.h>
 
 /*----------------------------------------------------------------------------
  * Local headers
@@ -67,6 +68,8 @@ BEGIN_C_DECLS
  * Private variables
  *============================================================================*/
 
+static bool  _cache_operators = false;
+
 /*============================================================================
  * Private function prototypes
  *============================================================================*/
@@ -1441,6 +1444,181 @@ cs_hho_builder_diffusion(const cs_cell_mesh_t      *cm,
     BFT_FREE(array);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set whether the cellwise diffusion operators of HHO schemes
+ *         are cached when the diffusion property is constant.
+ *         Caching is off by default, since the memory footprint is high
+ *         for higher-order schemes.
+ *
+ * \param[in] status    true to cache operators, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_set_operator_caching(bool  status)
+{
+  _cache_operators = status;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return true if the cellwise diffusion operators of HHO schemes
+ *         may be cached.
+ *
+ * \return true if caching is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_hho_builder_get_operator_caching(void)
+{
+  return _cache_operators;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a cache for the cellwise diffusion operators if operator
+ *         caching is active and the diffusion property is constant.
+ *
+ * \param[in] c2f         cell to faces connectivity
+ * \param[in] diff_pty    pointer to the diffusion property
+ * \param[in] face_size   size of the (scalar-valued) face basis
+ * \param[in] cell_size   size of the (scalar-valued) cell basis
+ *
+ * \return a pointer to a new cache structure, or NULL if not relevant
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hho_builder_cache_t *
+cs_hho_builder_cache_create(const cs_adjacency_t   *c2f,
+                            const cs_property_t    *diff_pty,
+                            int                     face_size,
+                            int                     cell_size)
+{
+  if (_cache_operators == false || diff_pty == NULL || c2f == NULL)
+    return NULL;
+
+  if (cs_property_is_constant(diff_pty) == false)
+    return NULL;
+
+  cs_hho_builder_cache_t  *cache = NULL;
+
+  BFT_MALLOC(cache, 1, cs_hho_builder_cache_t);
+
+  const cs_lnum_t  n_cells = c2f->n_elts;
+
+  cache->n_cells = n_cells;
+  cache->is_set = false;
+
+  BFT_MALLOC(cache->idx, n_cells + 1, cs_lnum_t);
+
+  cache->idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_lnum_t  n_fc = c2f->idx[c_id+1] - c2f->idx[c_id];
+    const cs_lnum_t  tots = n_fc*face_size + cell_size;
+    cache->idx[c_id+1] = cache->idx[c_id] + tots*tots;
+  }
+
+  BFT_MALLOC(cache->val, cache->idx[n_cells], cs_real_t);
+
+  cs_log_printf(CS_LOG_SETUP,
+                _(" HHO: cellwise diffusion operators cached"
+                  " (%llu values)\n"),
+                (unsigned long long)(cache->idx[n_cells]));
+
+  return cache;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_hho_builder_cache_t structure
+ *
+ * \param[in, out] p_cache  pointer of pointer to a cache structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_cache_free(cs_hho_builder_cache_t  **p_cache)
+{
+  cs_hho_builder_cache_t  *cache = *p_cache;
+
+  if (cache == NULL)
+    return;
+
+  BFT_FREE(cache->idx);
+  BFT_FREE(cache->val);
+
+  BFT_FREE(cache);
+  *p_cache = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the diffusion operator (stored in cb->loc), using cached
+ *         values when available.
+ *         If a cache is given and not set yet, the computed operator is
+ *         stored in it. The cache must be flagged as set once all cells
+ *         have been handled.
+ *
+ * \param[in]       cm         pointer to a cs_cell_mesh_t structure
+ * \param[in]       diff_pty   pointer to a cs_property_data_t structure
+ * \param[in, out]  cache      pointer to a cache structure, or NULL
+ * \param[in, out]  cb         pointer to a cell builder_t structure
+ * \param[in, out]  hhob       pointer to a cs_hho_builder_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_diffusion_cached(const cs_cell_mesh_t      *cm,
+                                const cs_property_data_t  *diff_pty,
+                                cs_hho_builder_cache_t    *cache,
+                                cs_cell_builder_t         *cb,
+                                cs_hho_builder_t          *hhob)
+{
+  if (hhob == NULL)
+    return;
+
+  if (cache == NULL) {
+    cs_hho_builder_compute_grad_reco(cm, diff_pty, cb, hhob);
+    cs_hho_builder_diffusion(cm, diff_pty, cb, hhob);
+    return;
+  }
+
+  const cs_lnum_t  c_id = cm->c_id;
+  cs_real_t  *c_val = cache->val + cache->idx[c_id];
+
+  if (cache->is_set) {
+
+    /* Same block structure as in cs_hho_builder_diffusion */
+    const int  fs = hhob->face_basis[0]->size;
+    for (int f = 0; f < cm->n_fc; f++)
+      cb->ids[f] = fs;
+    cb->ids[cm->n_fc] = hhob->cell_basis->size;
+
+    cs_sdm_block_init(cb->loc, cm->n_fc + 1, cm->n_fc + 1, cb->ids, cb->ids);
+
+    assert(cb->loc->n_rows*cb->loc->n_cols
+           == cache->idx[c_id+1] - cache->idx[c_id]);
+
+    memcpy(cb->loc->val, c_val,
+           cb->loc->n_rows*cb->loc->n_cols*sizeof(cs_real_t));
+
+  }
+  else {
+
+    cs_hho_builder_compute_grad_reco(cm, diff_pty, cb, hhob);
+    cs_hho_builder_diffusion(cm, diff_pty, cb, hhob);
+
+    assert(cb->loc->n_rows*cb->loc->n_cols
+           == cache->idx[c_id+1] - cache->idx[c_id]);
+
+    memcpy(c_val, cb->loc->val,
+           cb->loc->n_rows*cb->loc->n_cols*sizeof(cs_real_t));
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the reduction onto the polynomial spaces (cell and faces)
@@ -72,6 +72,20 @@ typedef struct {
 
 } cs_hho_builder_t;
 
+/* Cache of cellwise (scalar-valued) diffusion operators. Operators only
+   depend on the cell geometry and on the diffusion property, so they may be
+   reused from one build to another if the property is constant. */
+typedef struct {
+
+  cs_lnum_t   n_cells;
+
+  bool        is_set;   /* true once all cellwise operators are stored */
+
+  cs_lnum_t  *idx;      /* index on cells of cached values (size n_cells+1) */
+  cs_real_t  *val;      /* cached values (size idx[n_cells]) */
+
+} cs_hho_builder_cache_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -185,6 +199,86 @@ cs_hho_builder_diffusion(const cs_cell_mesh_t      *cm,
                          cs_cell_builder_t         *cb,
                          cs_hho_builder_t          *hhob);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set whether the cellwise diffusion operators of HHO schemes
+ *         are cached when the diffusion property is constant.
+ *         Caching is off by default, since the memory footprint is high
+ *         for higher-order schemes.
+ *
+ * \param[in] status    true to cache operators, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_set_operator_caching(bool  status);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return true if the cellwise diffusion operators of HHO schemes
+ *         may be cached.
+ *
+ * \return true if caching is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_hho_builder_get_operator_caching(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a cache for the cellwise diffusion operators if operator
+ *         caching is active and the diffusion property is constant.
+ *
+ * \param[in] c2f         cell to faces connectivity
+ * \param[in] diff_pty    pointer to the diffusion property
+ * \param[in] face_size   size of the (scalar-valued) face basis
+ * \param[in] cell_size   size of the (scalar-valued) cell basis
+ *
+ * \return a pointer to a new cache structure, or NULL if not relevant
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hho_builder_cache_t *
+cs_hho_builder_cache_create(const cs_adjacency_t   *c2f,
+                            const cs_property_t    *diff_pty,
+                            int                     face_size,
+                            int                     cell_size);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_hho_builder_cache_t structure
+ *
+ * \param[in, out] p_cache  pointer of pointer to a cache structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_cache_free(cs_hho_builder_cache_t  **p_cache);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the diffusion operator (stored in cb->loc), using cached
+ *         values when available.
+ *         If a cache is given and not set yet, the computed operator is
+ *         stored in it. The cache must be flagged as set once all cells
+ *         have been handled.
+ *
+ * \param[in]       cm         pointer to a cs_cell_mesh_t structure
+ * \param[in]       diff_pty   pointer to a cs_property_data_t structure
+ * \param[in, out]  cache      pointer to a cache structure, or NULL
+ * \param[in, out]  cb         pointer to a cell builder_t structure
+ * \param[in, out]  hhob       pointer to a cs_hho_builder_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_diffusion_cached(const cs_cell_mesh_t      *cm,
+                                const cs_property_data_t  *diff_pty,
+                                cs_hho_builder_cache_t    *cache,
+                                cs_cell_builder_t         *cb,
+                                cs_hho_builder_t          *hhob);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the reduction onto the polynomial spaces (cell and faces)
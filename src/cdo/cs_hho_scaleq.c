@@ -141,6 +141,9 @@ struct _cs_hho_scaleq_t {
      usage */
   cs_sdm_t                       *acf_tilda;
 
+  /* Cache of cellwise diffusion operators (NULL if not used) */
+  cs_hho_builder_cache_t         *diff_cache;
+
 };
 
 /*============================================================================
@@ -925,6 +928,15 @@ cs_hho_scaleq_init_context(const cs_equation_param_t   *eqp,
 
   } /* Has diffusion term to handle */
 
+  /* Cellwise diffusion operators may be cached */
+  eqc->diff_cache = NULL;
+  if (cs_equation_param_has_diffusion(eqp))
+    eqc->diff_cache
+      = cs_hho_builder_cache_create(connect->c2f,
+                                    eqp->diffusion_property,
+                                    eqc->n_face_dofs,
+                                    eqc->n_cell_dofs);
+
   return eqc;
 }
 
@@ -955,6 +967,8 @@ cs_hho_scaleq_free_context(void   *data)
 
   cs_sdm_free(eqc->acf_tilda);
 
+  cs_hho_builder_cache_free(&(eqc->diff_cache));
+
   /* Last free */
   BFT_FREE(eqc);
 
@@ -1189,11 +1203,10 @@ cs_hho_scaleq_build_system(const cs_mesh_t            *mesh,
 
         }
 
-        /* Define the local stiffness matrix */
-        cs_hho_builder_compute_grad_reco(cm, diff_pty, cb, hhob);
-
-        /* Local matrix owned by the cellwise builder (store in cb->loc) */
-        cs_hho_builder_diffusion(cm, diff_pty, cb, hhob);
+        /* Define the local stiffness matrix (or get it from the cache).
+           Local matrix owned by the cellwise builder (store in cb->loc) */
+        cs_hho_builder_diffusion_cached(cm, diff_pty, eqc->diff_cache,
+                                        cb, hhob);
 
         /* Add the local diffusion operator to the local system */
         cs_sdm_block_add(csys->mat, cb->loc);
@@ -1300,6 +1313,9 @@ cs_hho_scaleq_build_system(const cs_mesh_t            *mesh,
 
   } /* OPENMP Block */
 
+  if (eqc->diff_cache != NULL)
+    eqc->diff_cache->is_set = true;
+
   cs_matrix_assembler_values_done(mav); // optional
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_HHO_SCALEQ_DBG > 2
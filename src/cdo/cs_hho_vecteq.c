@@ -137,6 +137,9 @@ struct _cs_hho_vecteq_t {
      usage */
   cs_sdm_t                      *acf_tilda;
 
+  /* Cache of cellwise diffusion operators (NULL if not used) */
+  cs_hho_builder_cache_t        *diff_cache;
+
 };
 
 /*============================================================================
@@ -913,6 +916,15 @@ cs_hho_vecteq_init_context(const cs_equation_param_t   *eqp,
 
   } /* Loop on BC definitions */
 
+  /* Cellwise diffusion operators may be cached */
+  eqc->diff_cache = NULL;
+  if (cs_equation_param_has_diffusion(eqp))
+    eqc->diff_cache
+      = cs_hho_builder_cache_create(connect->c2f,
+                                    eqp->diffusion_property,
+                                    eqc->n_face_dofs/3,
+                                    eqc->n_cell_dofs/3);
+
   return eqc;
 }
 
@@ -943,6 +955,8 @@ cs_hho_vecteq_free_context(void   *data)
 
   cs_sdm_free(eqc->acf_tilda);
 
+  cs_hho_builder_cache_free(&(eqc->diff_cache));
+
   /* Last free */
   BFT_FREE(eqc);
 
@@ -1271,11 +1285,10 @@ cs_hho_vecteq_build_system(const cs_mesh_t            *mesh,
 
         }
 
-        /* Define the local stiffness matrix */
-        cs_hho_builder_compute_grad_reco(cm, diff_pty, cb, hhob);
-
-        /* Local matrix owned by the cellwise builder (store in cb->loc) */
-        cs_hho_builder_diffusion(cm, diff_pty, cb, hhob);
+        /* Define the local stiffness matrix (or get it from the cache).
+           Local matrix owned by the cellwise builder (store in cb->loc) */
+        cs_hho_builder_diffusion_cached(cm, diff_pty, eqc->diff_cache,
+                                        cb, hhob);
 
         /* Add the local diffusion operator to the local system */
         int n_blocks = cb->loc->block_desc->n_col_blocks;
@@ -1405,6 +1418,9 @@ cs_hho_vecteq_build_system(const cs_mesh_t            *mesh,
 
   } /* OPENMP Block */
 
+  if (eqc->diff_cache != NULL)
+    eqc->diff_cache->is_set = true;
+
   cs_matrix_assembler_values_done(mav); /* optional */
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_HHO_VECTEQ_DBG > 2
@@ -315,6 +315,7 @@ _navsto_param_sles_create(cs_navsto_param_model_t         model,
   nslesp->il_algo_dtol = 1e3;
   nslesp->il_algo_verbosity = 0;
   nslesp->il_algo_restart = 10;
+  nslesp->setup_reuse_ratio = 0;
 
   switch (algo_coupling) {
 
@@ -524,6 +525,11 @@ _navsto_param_sles_log(const cs_navsto_param_sles_t    *nslesp)
                 navsto, nslesp->il_algo_rtol, nslesp->il_algo_atol,
                 nslesp->il_algo_dtol, nslesp->il_algo_verbosity);
 
+  if (nslesp->setup_reuse_ratio > 0)
+    cs_log_printf(CS_LOG_SETUP, "%s Reuse of the solver setup:"
+                  " rebuilt when n_iter > %.2f x n_iter_ref\n",
+                  navsto, nslesp->setup_reuse_ratio);
+
   /* Additional settings for the Schur complement solver */
   if (nslesp->strategy == CS_NAVSTO_SLES_UZAWA_CG          ||
       nslesp->strategy == CS_NAVSTO_SLES_DIAG_SCHUR_MINRES ||
@@ -1061,6 +1067,14 @@ cs_navsto_param_set(cs_navsto_param_t    *nsp,
     }
     break;
 
+  case CS_NSKEY_SETUP_REUSE_RATIO:
+    nsp->sles_param->setup_reuse_ratio = atof(val);
+    if (nsp->sles_param->setup_reuse_ratio < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                " %s: Invalid value for the ratio used to reuse the setup"
+                " of the linear solvers\n", __func__);
+    break;
+
   case CS_NSKEY_SLES_STRATEGY:
 
     /* In-house strategies. Do not need a third-part library. */
@@ -521,6 +521,16 @@ typedef struct {
    */
   int                           il_algo_verbosity;
 
+  /*! \var setup_reuse_ratio
+   *  If > 0, the velocity block, the setup of its solver (the AMG hierarchy
+   *  for instance) and the Schur complement approximation are kept from one
+   *  resolution to the next one (Picard or time iterations). They are
+   *  rebuilt as soon as the number of iterations of the inner linear
+   *  algorithm exceeds this ratio times the number of iterations observed
+   *  just after the last rebuild. (default 0: rebuilt at each resolution)
+   */
+  cs_real_t                     setup_reuse_ratio;
+
   /*!
    * @}
    * @name Non-linear algorithm
@@ -981,6 +991,13 @@ typedef struct {
  * Set the way to define the Schur complement approximation
  * (cf. \ref cs_param_schur_approx_t)
  *
+ * \var CS_NSKEY_SETUP_REUSE_RATIO
+ * Keep the setup of the velocity block solver and the Schur complement
+ * approximation across resolutions while the number of inner iterations
+ * remains below this ratio times its value after the last setup (cf.
+ * \ref cs_navsto_param_sles_t). Only used with Krylov block-preconditioned
+ * strategies and with the Uzawa-AL algorithm. 0 (default): no reuse.
+ *
  * \var CS_NSKEY_SLES_STRATEGY
  * Strategy for solving the SLES arising from the discretization of the
  * Navier-Stokes system
@@ -1029,6 +1046,7 @@ typedef enum {
   CS_NSKEY_NL_ALGO_VERBOSITY,
   CS_NSKEY_QUADRATURE,
   CS_NSKEY_SCHUR_STRATEGY,
+  CS_NSKEY_SETUP_REUSE_RATIO,
   CS_NSKEY_SLES_STRATEGY,
   CS_NSKEY_SPACE_SCHEME,
   CS_NSKEY_THERMAL_TOLERANCE,
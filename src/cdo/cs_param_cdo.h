@@ -93,6 +93,9 @@ typedef enum {
 
   CS_PARAM_ASSEMBLE_OMP_ATOMIC,
   CS_PARAM_ASSEMBLE_OMP_CRITICAL,
+  CS_PARAM_ASSEMBLE_OMP_COLOR,    /* Cells are gathered by colors so that
+                                     cells of the same color share no DoF.
+                                     No synchronization is needed. */
   CS_PARAM_ASSEMBLE_OMP_N_STRATEGIES
 
 } cs_param_assemble_omp_strategy_t;
@@ -594,6 +594,242 @@ _define_pty_by_product(cs_property_t          *pty)
   pty->get_eval_at_cell_cw[id] = NULL;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if the evaluation of a property may change with time or with
+ *         the state of the computation
+ *
+ * \param[in]  pty       pointer to a cs_property_t structure
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_has_time_or_state_dependency(const cs_property_t   *pty)
+{
+  for (int i = 0; i < pty->n_definitions; i++)
+    if (pty->defs[i]->dep_flag & (CS_XDEF_DEP_TIME | CS_XDEF_DEP_STATE))
+      return true;
+
+  for (int i = 0; i < pty->n_related_properties; i++)
+    if (_has_time_or_state_dependency(pty->related_properties[i]))
+      return true;
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate the cellwise cache of a property if requested
+ *
+ * \param[in, out]  pty       pointer to a cs_property_t structure
+ * \param[in]       n_cells   number of cells
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_allocate_cell_cache(cs_property_t   *pty,
+                     cs_lnum_t        n_cells)
+{
+  if (!(pty->process_flag &
+        (CS_PROPERTY_CELL_CACHE | CS_PROPERTY_CELL_CACHE_FLOAT)))
+    return;
+  if (pty->cell_cache_stamp != NULL) /* Already done */
+    return;
+
+  const int  dim = _get_pty_dim(pty->type);
+
+  BFT_MALLOC(pty->cell_cache_stamp, n_cells, int);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    pty->cell_cache_stamp[i] = -1; /* Not computed */
+
+  if (_has_time_or_state_dependency(pty))
+    BFT_MALLOC(pty->cell_cache_time, n_cells, cs_real_t);
+
+  if (pty->process_flag & CS_PROPERTY_CELL_CACHE_FLOAT)
+    BFT_MALLOC(pty->cell_cache_f, dim*n_cells, float);
+  else
+    BFT_MALLOC(pty->cell_cache, dim*n_cells, cs_real_t);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the cached values of a property in a cell if they are
+ *         still valid
+ *
+ * \param[in]      pty       pointer to a cs_property_t structure
+ * \param[in]      c_id      id of the cell
+ * \param[in]      t_eval    physical time at which one evaluates the term
+ * \param[in, out] val       values (size = dimension of the property)
+ *
+ * \return true if values have been retrieved, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+_cell_cache_get(const cs_property_t   *pty,
+                cs_lnum_t              c_id,
+                cs_real_t              t_eval,
+                cs_real_t              val[])
+{
+  if (pty->cell_cache_stamp == NULL)
+    return false;
+  if (pty->cell_cache_stamp[c_id] != pty->cache_state)
+    return false;
+  if (pty->cell_cache_time != NULL)
+    if (fabs(pty->cell_cache_time[c_id] - t_eval) > 0)
+      return false;
+
+  const int  dim = _get_pty_dim(pty->type);
+
+  if (pty->cell_cache_f != NULL) {
+    const float  *_val = pty->cell_cache_f + dim*c_id;
+    for (int k = 0; k < dim; k++)
+      val[k] = _val[k];
+  }
+  else {
+    const cs_real_t  *_val = pty->cell_cache + dim*c_id;
+    for (int k = 0; k < dim; k++)
+      val[k] = _val[k];
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Store the values of a property in a cell inside the cache (if any)
+ *
+ * \param[in]  pty       pointer to a cs_property_t structure
+ * \param[in]  c_id      id of the cell
+ * \param[in]  t_eval    physical time at which one evaluates the term
+ * \param[in]  val       values (size = dimension of the property)
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_cell_cache_set(const cs_property_t   *pty,
+                cs_lnum_t              c_id,
+                cs_real_t              t_eval,
+                const cs_real_t        val[])
+{
+  if (pty->cell_cache_stamp == NULL)
+    return;
+
+  const int  dim = _get_pty_dim(pty->type);
+
+  if (pty->cell_cache_f != NULL) {
+    float  *_val = pty->cell_cache_f + dim*c_id;
+    for (int k = 0; k < dim; k++)
+      _val[k] = (float)val[k];
+  }
+  else {
+    cs_real_t  *_val = pty->cell_cache + dim*c_id;
+    for (int k = 0; k < dim; k++)
+      _val[k] = val[k];
+  }
+
+  if (pty->cell_cache_time != NULL)
+    pty->cell_cache_time[c_id] = t_eval;
+  pty->cell_cache_stamp[c_id] = pty->cache_state;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the cached tensor of a property in a cell if it is still
+ *         valid
+ *
+ * \param[in]      pty       pointer to a cs_property_t structure
+ * \param[in]      c_id      id of the cell
+ * \param[in]      t_eval    physical time at which one evaluates the term
+ * \param[in, out] tensor    3x3 matrix (extra-diag. values already set to 0)
+ *
+ * \return true if the tensor has been retrieved, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+_cell_cache_get_tensor(const cs_property_t   *pty,
+                       cs_lnum_t              c_id,
+                       cs_real_t              t_eval,
+                       cs_real_t              tensor[3][3])
+{
+  cs_real_t  val[9];
+
+  if (!_cell_cache_get(pty, c_id, t_eval, val))
+    return false;
+
+  if (pty->type & CS_PROPERTY_ISO)
+    tensor[0][0] = tensor[1][1] = tensor[2][2] = val[0];
+  else if (pty->type & CS_PROPERTY_ORTHO) {
+    for (int k = 0; k < 3; k++)
+      tensor[k][k] = val[k];
+  }
+  else if (pty->type & CS_PROPERTY_ANISO_SYM) {
+    tensor[0][0] = val[0];
+    tensor[1][1] = val[1];
+    tensor[2][2] = val[2];
+    tensor[0][1] = tensor[1][0] = val[3];
+    tensor[0][2] = tensor[2][0] = val[4];
+    tensor[1][2] = tensor[2][1] = val[5];
+  }
+  else {
+    for (int k = 0; k < 3; k++)
+      for (int l = 0; l < 3; l++)
+        tensor[k][l] = val[3*k+l];
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Store the tensor of a property in a cell inside the cache (if any)
+ *
+ * \param[in]  pty       pointer to a cs_property_t structure
+ * \param[in]  c_id      id of the cell
+ * \param[in]  t_eval    physical time at which one evaluates the term
+ * \param[in]  tensor    3x3 matrix (not inverted)
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_cell_cache_set_tensor(const cs_property_t   *pty,
+                       cs_lnum_t              c_id,
+                       cs_real_t              t_eval,
+                       const cs_real_t        tensor[3][3])
+{
+  if (pty->cell_cache_stamp == NULL)
+    return;
+
+  cs_real_t  val[9];
+
+  if (pty->type & CS_PROPERTY_ISO)
+    val[0] = tensor[0][0];
+  else if (pty->type & CS_PROPERTY_ORTHO) {
+    for (int k = 0; k < 3; k++)
+      val[k] = tensor[k][k];
+  }
+  else if (pty->type & CS_PROPERTY_ANISO_SYM) {
+    val[0] = tensor[0][0];
+    val[1] = tensor[1][1];
+    val[2] = tensor[2][2];
+    val[3] = tensor[0][1];
+    val[4] = tensor[0][2];
+    val[5] = tensor[1][2];
+  }
+  else {
+    for (int k = 0; k < 3; k++)
+      for (int l = 0; l < 3; l++)
+        val[3*k+l] = tensor[k][l];
+  }
+
+  _cell_cache_set(pty, c_id, t_eval, val);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Create and initialize a new property structure
@@ -677,6 +913,12 @@ _create_property(const char           *name,
   pty->n_related_properties = 0;
   pty->related_properties = NULL;
 
+  pty->cache_state = 0;
+  pty->cell_cache_stamp = NULL;
+  pty->cell_cache_time = NULL;
+  pty->cell_cache = NULL;
+  pty->cell_cache_f = NULL;
+
   return pty;
 }
 
@@ -898,6 +1140,12 @@ cs_property_set_option(cs_property_t       *pty,
   case CS_PTYKEY_POST_FOURIER:
     pty->process_flag |= CS_PROPERTY_POST_FOURIER;
     break;
+  case CS_PTYKEY_CELL_CACHE:
+    pty->process_flag |= CS_PROPERTY_CELL_CACHE;
+    break;
+  case CS_PTYKEY_CELL_CACHE_FLOAT:
+    pty->process_flag |= CS_PROPERTY_CELL_CACHE_FLOAT;
+    break;
 
   default:
     bft_error(__FILE__, __LINE__, 0,
@@ -909,6 +1157,28 @@ cs_property_set_option(cs_property_t       *pty,
 }
 
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the cellwise cache of a property (if any). This has to
+ *         be called when the state on which the property depends has changed
+ *         without any change of the time of evaluation (e.g. inside
+ *         non-linear iterations).
+ *
+ * \param[in, out]  pty       pointer to a cs_property_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_property_reset_cell_cache(cs_property_t    *pty)
+{
+  if (pty == NULL)
+    return;
+  if (pty->cell_cache_stamp == NULL)
+    return;
+
+  pty->cache_state += 1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Set the reference value associated to a \ref cs_property_t structure
@@ -962,6 +1232,11 @@ cs_property_destroy_all(void)
     if (pty->n_related_properties > 0)
       BFT_FREE(pty->related_properties);
 
+    BFT_FREE(pty->cell_cache_stamp);
+    BFT_FREE(pty->cell_cache_time);
+    BFT_FREE(pty->cell_cache);
+    BFT_FREE(pty->cell_cache_f);
+
     BFT_FREE(pty);
 
   } /* Loop on properties */
@@ -994,6 +1269,11 @@ cs_property_finalize_setup(void)
     if (pty->type & CS_PROPERTY_BY_PRODUCT)
       continue;
 
+    /* Analytic definitions without any dependency (neither on time nor on
+       the state of the computation) are evaluated once for all */
+    for (int id = 0; id < pty->n_definitions; id++)
+      cs_xdef_eval_cache_at_cells(pty->defs[id], cs_cdo_quant, 0.);
+
     if (pty->n_definitions > 1) { /* Initialization of def_ids */
 
       const cs_lnum_t  n_cells = cs_cdo_quant->n_cells;
@@ -1073,6 +1353,8 @@ cs_property_finalize_setup(void)
 
     } /* Only properties defined as a product */
 
+    _allocate_cell_cache(pty, cs_cdo_quant->n_cells);
+
   } /* Loop on properties */
 
 }
@@ -2001,10 +2283,17 @@ cs_property_get_cell_tensor(cs_lnum_t               c_id,
   tensor[0][1] = tensor[1][0] = tensor[2][0] = 0;
   tensor[0][2] = tensor[1][2] = tensor[2][1] = 0;
 
-  if (pty->type & CS_PROPERTY_BY_PRODUCT)
-    _get_cell_tensor_by_property_product(c_id, t_eval, pty, tensor);
-  else
-    _get_cell_tensor(c_id, t_eval, pty, tensor);
+  if (!_cell_cache_get_tensor(pty, c_id, t_eval, tensor)) {
+
+    if (pty->type & CS_PROPERTY_BY_PRODUCT)
+      _get_cell_tensor_by_property_product(c_id, t_eval, pty, tensor);
+    else
+      _get_cell_tensor(c_id, t_eval, pty, tensor);
+
+    _cell_cache_set_tensor(pty, c_id, t_eval,
+                           (const cs_real_t (*)[3])tensor);
+
+  }
 
   if (do_inversion)
     _invert_tensor(tensor, pty->type);
@@ -2042,6 +2331,9 @@ cs_property_get_cell_value(cs_lnum_t              c_id,
               " %s: Invalid type of property for this function.\n"
               " Property %s has to be isotropic.", __func__, pty->name);
 
+  if (_cell_cache_get(pty, c_id, t_eval, &result))
+    return result;
+
   if (pty->type & CS_PROPERTY_BY_PRODUCT) {
 
     assert(pty->related_properties != NULL);
@@ -2050,7 +2342,7 @@ cs_property_get_cell_value(cs_lnum_t              c_id,
     const cs_real_t  result_b = _get_cell_value(c_id, t_eval,
                                                 pty->related_properties[1]);
 
-    return result_a * result_b;
+    result = result_a * result_b;
 
   }
   else {
@@ -2058,9 +2350,13 @@ cs_property_get_cell_value(cs_lnum_t              c_id,
     if (cs_property_is_constant(pty))
       return pty->ref_value;
     else
-      return _get_cell_value(c_id, t_eval, pty);
+      result = _get_cell_value(c_id, t_eval, pty);
 
   }
+
+  _cell_cache_set(pty, c_id, t_eval, &result);
+
+  return result;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2091,10 +2387,17 @@ cs_property_tensor_in_cell(const cs_cell_mesh_t   *cm,
   tensor[0][1] = tensor[1][0] = tensor[2][0] = 0;
   tensor[0][2] = tensor[1][2] = tensor[2][1] = 0;
 
-  if (pty->type & CS_PROPERTY_BY_PRODUCT)
-    _tensor_in_cell_by_property_product(cm, pty, t_eval, tensor);
-  else
-    _tensor_in_cell(cm, pty, t_eval, tensor);
+  if (!_cell_cache_get_tensor(pty, cm->c_id, t_eval, tensor)) {
+
+    if (pty->type & CS_PROPERTY_BY_PRODUCT)
+      _tensor_in_cell_by_property_product(cm, pty, t_eval, tensor);
+    else
+      _tensor_in_cell(cm, pty, t_eval, tensor);
+
+    _cell_cache_set_tensor(pty, cm->c_id, t_eval,
+                           (const cs_real_t (*)[3])tensor);
+
+  }
 
   if (do_inversion)
     _invert_tensor(tensor, pty->type);
@@ -2134,22 +2437,29 @@ cs_property_value_in_cell(const cs_cell_mesh_t   *cm,
               " Invalid type of property for this function.\n"
               " Property %s has to be isotropic.", pty->name);
 
+  if (_cell_cache_get(pty, cm->c_id, t_eval, &result))
+    return result;
+
   if (pty->type & CS_PROPERTY_BY_PRODUCT) {
     assert(pty->related_properties != NULL);
     const cs_real_t  result_a = _value_in_cell(cm, pty->related_properties[0],
                                                t_eval);
     const cs_real_t  result_b = _value_in_cell(cm, pty->related_properties[1],
                                                t_eval);
-    return result_a * result_b;
+    result = result_a * result_b;
   }
   else {
 
     if (cs_property_is_constant(pty))
       return pty->ref_value;
     else
-      return _value_in_cell(cm, pty, t_eval);
+      result = _value_in_cell(cm, pty, t_eval);
 
   }
+
+  _cell_cache_set(pty, cm->c_id, t_eval, &result);
+
+  return result;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2276,6 +2586,13 @@ cs_property_log_setup(void)
     else
       cs_log_printf(CS_LOG_SETUP, "\n");
 
+    if (pty->process_flag & CS_PROPERTY_CELL_CACHE_FLOAT)
+      cs_log_printf(CS_LOG_SETUP, "  * %s | Cellwise cache: single precision\n",
+                    pty->name);
+    else if (pty->process_flag & CS_PROPERTY_CELL_CACHE)
+      cs_log_printf(CS_LOG_SETUP, "  * %s | Cellwise cache: double precision\n",
+                    pty->name);
+
     cs_log_printf(CS_LOG_SETUP, "  * %s | Number of definitions: %d\n\n",
                   pty->name, pty->n_definitions);
 
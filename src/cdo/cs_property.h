@@ -59,6 +59,18 @@ BEGIN_C_DECLS
 /*!  1: Perform the computation and post-processing of the Fourier number */
 #define CS_PROPERTY_POST_FOURIER  (1 << 0)
 
+/*! \var CS_PROPERTY_CELL_CACHE
+ *  2: Store the cellwise evaluation of the property in an array of size
+ *  n_cells. An entry is evaluated again only if the definition depends on
+ *  time or on the state and if the time of evaluation has changed (or if
+ *  \ref cs_property_reset_cell_cache has been called) */
+#define CS_PROPERTY_CELL_CACHE    (1 << 1)
+
+/*! \var CS_PROPERTY_CELL_CACHE_FLOAT
+ *  4: Same as \ref CS_PROPERTY_CELL_CACHE but values are stored in single
+ *  precision to save memory */
+#define CS_PROPERTY_CELL_CACHE_FLOAT  (1 << 2)
+
 /*! @} */
 
 /*!
@@ -106,11 +118,21 @@ typedef cs_flag_t cs_property_type_t;
  *
  * \var CS_PTYKEY_POST_FOURIER
  * Perform the computation (and post-processing) of the Fourier number
+ *
+ * \var CS_PTYKEY_CELL_CACHE
+ * Store the cellwise evaluation of the property (see
+ * \ref CS_PROPERTY_CELL_CACHE)
+ *
+ * \var CS_PTYKEY_CELL_CACHE_FLOAT
+ * Store the cellwise evaluation of the property in single precision (see
+ * \ref CS_PROPERTY_CELL_CACHE_FLOAT)
  */
 
 typedef enum {
 
   CS_PTYKEY_POST_FOURIER,
+  CS_PTYKEY_CELL_CACHE,
+  CS_PTYKEY_CELL_CACHE_FLOAT,
   CS_PTYKEY_N_KEYS
 
 } cs_property_key_t;
@@ -166,6 +188,16 @@ struct _cs_property_t {
   int                     n_related_properties;
   const cs_property_t   **related_properties;
 
+  /* Optional cache of the evaluation at cells (see CS_PTYKEY_CELL_CACHE).
+     An entry is valid if its stamp is equal to cache_state and, for
+     definitions depending on time or on the state, if it has been computed
+     at the same time */
+  int                  cache_state;
+  int                 *cell_cache_stamp;
+  cs_real_t           *cell_cache_time;
+  cs_real_t           *cell_cache;
+  float               *cell_cache_f;
+
 };
 
 
@@ -433,6 +465,20 @@ void
 cs_property_set_option(cs_property_t       *pty,
                        cs_property_key_t    key);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the cellwise cache of a property (if any). This has to
+ *         be called when the state on which the property depends has changed
+ *         without any change of the time of evaluation (e.g. inside
+ *         non-linear iterations).
+ *
+ * \param[in, out]  pty       pointer to a cs_property_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_property_reset_cell_cache(cs_property_t    *pty);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Set the reference value associated to a \ref cs_property_t structure
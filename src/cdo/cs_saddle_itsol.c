@@ -400,12 +400,21 @@ _m12_vector_multiply(cs_saddle_system_t   *ssys,
       const cs_real_t  *m21_vals = ssys->m21_unassembled + 3*j;
       cs_real_t  *_m12x2 = m12x2 + 3*adj->ids[j];
 
+#if CS_CDO_OMP_SYNC_SECTIONS > 0 /* OpenMP with critical section */
 #     pragma omp critical
       {
         _m12x2[0] += m21_vals[0] * _x2;
         _m12x2[1] += m21_vals[1] * _x2;
         _m12x2[2] += m21_vals[2] * _x2;
       }
+#else  /* Use atomic barrier */
+#     pragma omp atomic
+      _m12x2[0] += m21_vals[0] * _x2;
+#     pragma omp atomic
+      _m12x2[1] += m21_vals[1] * _x2;
+#     pragma omp atomic
+      _m12x2[2] += m21_vals[2] * _x2;
+#endif
 
     } /* Loop on x1 elements associated to a given x2 element */
 
@@ -503,12 +512,21 @@ _compute_residual_3(cs_saddle_system_t   *ssys,
 
       _m21x1 += cs_math_3_dot_product(m21_vals, x1 + shift);
 
+#if CS_CDO_OMP_SYNC_SECTIONS > 0 /* OpenMP with critical section */
 #     pragma omp critical
       {
         _m12x2[0] += m21_vals[0] * _x2;
         _m12x2[1] += m21_vals[1] * _x2;
         _m12x2[2] += m21_vals[2] * _x2;
       }
+#else  /* Use atomic barrier */
+#     pragma omp atomic
+      _m12x2[0] += m21_vals[0] * _x2;
+#     pragma omp atomic
+      _m12x2[1] += m21_vals[1] * _x2;
+#     pragma omp atomic
+      _m12x2[2] += m21_vals[2] * _x2;
+#endif
 
     } /* Loop on x1 elements associated to a given x2 element */
 
@@ -594,12 +612,21 @@ _matvec_product(cs_saddle_system_t   *ssys,
 
       _m21v1 += cs_math_3_dot_product(m21_vals, v1 + shift);
 
+#if CS_CDO_OMP_SYNC_SECTIONS > 0 /* OpenMP with critical section */
 #     pragma omp critical
       {
         _m12v2[0] += m21_vals[0] * _v2;
         _m12v2[1] += m21_vals[1] * _v2;
         _m12v2[2] += m21_vals[2] * _v2;
       }
+#else  /* Use atomic barrier */
+#     pragma omp atomic
+      _m12v2[0] += m21_vals[0] * _v2;
+#     pragma omp atomic
+      _m12v2[1] += m21_vals[1] * _v2;
+#     pragma omp atomic
+      _m12v2[2] += m21_vals[2] * _v2;
+#endif
 
     } /* Loop on x1 elements associated to a given x2 element */
 
@@ -1954,13 +1981,17 @@ cs_matrix_vector_multiply_gs_allocated(const cs_range_set_t      *rset,
 
   cs_matrix_vector_multiply(CS_HALO_ROTATION_IGNORE, mat, vec, matvec);
 
-  /* gather view to scatter view (i.e. algebraic to mesh view) */
-  cs_range_set_scatter(rset,
-                       CS_REAL_TYPE, 1, /* type and stride */
-                       vec, vec);
-  cs_range_set_scatter(rset,
-                       CS_REAL_TYPE, 1, /* type and stride */
-                       matvec, matvec);
+  /* gather view to scatter view (i.e. algebraic to mesh view);
+     both synchronizations are overlapped */
+  cs_range_set_scatter_start(rset,
+                             CS_REAL_TYPE, 1, /* type and stride */
+                             vec, vec);
+  cs_range_set_scatter_start(rset,
+                             CS_REAL_TYPE, 1, /* type and stride */
+                             matvec, matvec);
+
+  cs_range_set_sync_wait(rset, CS_REAL_TYPE, 1, false, vec);
+  cs_range_set_sync_wait(rset, CS_REAL_TYPE, 1, false, matvec);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2019,14 +2050,18 @@ cs_matrix_vector_multiply_gs(const cs_range_set_t      *rset,
 
   cs_matrix_vector_multiply(CS_HALO_ROTATION_IGNORE, mat, vecx, matvec);
 
-  /* gather to scatter view (i.e. algebraic to mesh view) */
+  /* gather to scatter view (i.e. algebraic to mesh view);
+     both synchronizations are overlapped */
   if (rset != NULL) {
-    cs_range_set_scatter(rset,
-                         CS_REAL_TYPE, 1, /* type and stride */
-                         vecx, vec);
-    cs_range_set_scatter(rset,
-                         CS_REAL_TYPE, 1, /* type and stride */
-                         matvec, matvec);
+    cs_range_set_scatter_start(rset,
+                               CS_REAL_TYPE, 1, /* type and stride */
+                               vecx, vec);
+    cs_range_set_scatter_start(rset,
+                               CS_REAL_TYPE, 1, /* type and stride */
+                               matvec, matvec);
+
+    cs_range_set_sync_wait(rset, CS_REAL_TYPE, 1, false, vec);
+    cs_range_set_sync_wait(rset, CS_REAL_TYPE, 1, false, matvec);
   }
 
   /* Free allocated memory if needed */
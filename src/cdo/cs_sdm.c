@@ -116,6 +116,132 @@ _create_sdm(cs_flag_t   flag,
   return mat;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Dense matrix-vector product for a small square matrix.
+ *          Kernel shared by the fixed-size specializations: when n is a
+ *          constant, loops are fully unrolled by the compiler.
+ *
+ * \param[in]      n      number of rows (and columns)
+ * \param[in]      m      values of the matrix (row-major storage)
+ * \param[in]      vec    local vector to use
+ * \param[in, out] mv     result of the local matrix-vector product
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_square_matvec_n(const int                   n,
+                 const cs_real_t  *restrict  m,
+                 const cs_real_t  *restrict  vec,
+                 cs_real_t        *restrict  mv)
+{
+  for (int i = 0; i < n; i++) {
+    const cs_real_t  *m_i = m + i*n;
+    cs_real_t  s = 0.;
+    for (int j = 0; j < n; j++)
+      s += m_i[j] * vec[j];
+    mv[i] = s;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  LDL^T: Modified Cholesky decomposition of a SPD matrix.
+ *         Kernel shared by the fixed-size specializations: when n is a
+ *         constant, loops are fully unrolled by the compiler.
+ *         Same storage of the factorization as in cs_sdm_ldlt_compute()
+ *
+ * \param[in]      n        number of rows (and columns)
+ * \param[in]      a        values of the matrix (row-major storage)
+ * \param[in, out] facto    vector of the coefficient of the decomposition
+ * \param[in, out] dkk      store temporary the diagonal (size = n)
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_ldlt_compute_n(const int                   n,
+                const cs_real_t  *restrict  a,
+                cs_real_t        *restrict  facto,
+                cs_real_t        *restrict  dkk)
+{
+  int  rowj_idx = 0;
+
+  for (int j = 0; j < n; j++) {
+
+    rowj_idx += j;
+
+    /* d_jj = a_jj - \sum_{k=0}^{j-1} l_jk^2 * d_kk */
+    const cs_real_t  *l_j = facto + rowj_idx;
+
+    cs_real_t  sum = 0.;
+    for (int k = 0; k < j; k++)
+      sum += l_j[k]*l_j[k] * dkk[k];
+    const cs_real_t  djj = dkk[j] = a[j*n+j] - sum;
+
+    if (fabs(djj) < cs_math_zero_threshold)
+      bft_error(__FILE__, __LINE__, 0, _msg_small_p, __func__);
+
+    const cs_real_t  inv_djj = facto[rowj_idx + j] = 1. / djj;
+
+    /* l_ij = (a_ij - \sum_{k=0}^{j-1} l_ik * d_kk * l_jk ) / d_jj */
+    int  rowi_idx = rowj_idx;
+    for (int i = j+1; i < n; i++) {
+
+      rowi_idx += i;
+      cs_real_t  *l_i = facto + rowi_idx;
+      sum = 0.;
+      for (int k = 0; k < j; k++)
+        sum += l_i[k] * dkk[k] * l_j[k];
+      l_i[j] = (a[j*n+i] - sum) * inv_djj;
+
+    }
+
+  } /* Loop on column j */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve a SPD system with a L.D.L^T (Modified Cholesky decomposition)
+ *         Kernel shared by the fixed-size specializations: when n is a
+ *         constant, loops are fully unrolled by the compiler.
+ *
+ * \param[in]       n        dimension of the system to solve
+ * \param[in]       facto    vector of the coefficients of the decomposition
+ * \param[in]       rhs      right-hand side
+ * \param[in, out]  sol      solution
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_ldlt_solve_n(const int                   n,
+              const cs_real_t  *restrict  facto,
+              const cs_real_t  *restrict  rhs,
+              cs_real_t        *restrict  sol)
+{
+  /* Forward substitution: z_i = b_i - \sum_{k=0}^{i-1} l_ik * z_k */
+  int  rowi_idx = 0;
+  for (int i = 0; i < n; i++) {
+
+    rowi_idx += i;
+    const cs_real_t  *l_i = facto + rowi_idx;
+    cs_real_t  sum = 0.;
+    for (int k = 0; k < i; k++)
+      sum += sol[k] * l_i[k];
+    sol[i] = rhs[i] - sum;
+
+  }
+
+  /* Backward substitution: x_i = z_i/d_ii - \sum_{k=i+1}^{n} l_ki * x_k */
+  for (int i = n-1; i >= 0; i--) {
+
+    cs_real_t  sum = 0.;
+    for (int k = i+1; k < n; k++)
+      sum += facto[k*(k+1)/2 + i] * sol[k];
+    sol[i] = sol[i] * facto[i*(i+1)/2 + i] - sum;
+
+  }
+}
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -836,6 +962,25 @@ cs_sdm_square_matvec(const cs_sdm_t    *mat,
 
   const int  n = mat->n_rows;
 
+  /* Fixed-size specializations for the most common sizes (number of
+     vertices of a tetrahedron, a prism or an hexahedron for instance) */
+  switch (n) {
+  case 4:
+    _square_matvec_n(4, mat->val, vec, mv);
+    return;
+  case 6:
+    _square_matvec_n(6, mat->val, vec, mv);
+    return;
+  case 8:
+    _square_matvec_n(8, mat->val, vec, mv);
+    return;
+  case 12:
+    _square_matvec_n(12, mat->val, vec, mv);
+    return;
+  default:
+    break; /* Generic version */
+  }
+
   /* Initialize mv */
   const cs_real_t  v = vec[0];
   for (short int i = 0; i < n; i++)
@@ -1711,9 +1856,9 @@ cs_sdm_66_ldlt_compute(const cs_sdm_t   *m,
   const cs_real_t  l32 = facto[ 8] =
     (m->val[15] - l30*d0l20 - l31*d1l21) * facto[5];
   const cs_real_t  l42 = facto[12] =
-    (m->val[16] - l30*d0l20 - l31*d1l21) * facto[5];
+    (m->val[16] - l40*d0l20 - l41*d1l21) * facto[5];
   const cs_real_t  l52 = facto[17] =
-    (m->val[17] - l30*d0l20 - l31*d1l21) * facto[5];
+    (m->val[17] - l50*d0l20 - l51*d1l21) * facto[5];
 
   /* j=3: row 4 */
   const cs_real_t  d33 = m->val[21] - l30*l30*d00 - l31*l31*d11 - l32*l32*d22;
@@ -1777,6 +1922,25 @@ cs_sdm_ldlt_compute(const cs_sdm_t     *m,
     return;
   }
 
+  /* Fixed-size specializations for the most common sizes (HHO cell blocks
+     and gradient reconstructions for instance) */
+  switch (n) {
+  case 8:
+    _ldlt_compute_n(8, m->val, facto, dkk);
+    return;
+  case 9:
+    _ldlt_compute_n(9, m->val, facto, dkk);
+    return;
+  case 10:
+    _ldlt_compute_n(10, m->val, facto, dkk);
+    return;
+  case 12:
+    _ldlt_compute_n(12, m->val, facto, dkk);
+    return;
+  default:
+    break; /* Generic version */
+  }
+
   int  rowj_idx = 0;
 
   /* Factorization (column-major algorithm) */
@@ -1993,6 +2157,30 @@ cs_sdm_ldlt_solve(int                n_rows,
     return;
   }
 
+  /* Fixed-size specializations for the most common sizes */
+  switch (n_rows) {
+  case 4:
+    cs_sdm_44_ldlt_solve(facto, rhs, sol);
+    return;
+  case 6:
+    cs_sdm_66_ldlt_solve(facto, rhs, sol);
+    return;
+  case 8:
+    _ldlt_solve_n(8, facto, rhs, sol);
+    return;
+  case 9:
+    _ldlt_solve_n(9, facto, rhs, sol);
+    return;
+  case 10:
+    _ldlt_solve_n(10, facto, rhs, sol);
+    return;
+  case 12:
+    _ldlt_solve_n(12, facto, rhs, sol);
+    return;
+  default:
+    break; /* Generic version */
+  }
+
   /* 1 - Solving Lz = b with forward substitution :
    *     z_i = b_i - \sum_{k=0}^{i-1} l_ik * z_k
    */
@@ -713,6 +713,64 @@ _update_clc(const cs_mesh_t             *mesh,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build the narrow band of cells in which the source term of the
+ *         thermal equation has to be updated during the non-linear iterations
+ *         of the current time step. Cells which are solid at the previous time
+ *         step (or permanently solid) are discarded since their source term
+ *         is zero whatever the iterate is. The state at the previous time step
+ *         of the selected cells is stored in a compact array.
+ *         Nothing is done if the band is already built for this time step.
+ *
+ * \param[in]  connect    pointer to a cs_cdo_connect_t structure
+ * \param[in]  quant      pointer to a cs_cdo_quantities_t structure
+ * \param[in]  ts         pointer to a cs_time_step_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_band_cells(const cs_cdo_connect_t      *connect,
+                   const cs_cdo_quantities_t   *quant,
+                   const cs_time_step_t        *ts)
+{
+  cs_solidification_t  *solid = cs_solidification_structure;
+  cs_solidification_binary_alloy_t  *alloy
+    = (cs_solidification_binary_alloy_t *)solid->model_context;
+
+  if (alloy->band_time_id == ts->nt_cur)
+    return; /* Already up to date */
+
+  const cs_real_t  *c_bulk_pre = alloy->c_bulk->val_pre;
+  const cs_real_t  *t_bulk_pre = solid->temperature->val_pre;
+  const size_t  csize = quant->n_cells*sizeof(cs_real_t);
+
+  /* Cells outside the band keep a zero contribution */
+  memset(solid->thermal_reaction_coef_array, 0, csize);
+  memset(solid->thermal_source_term_array, 0, csize);
+
+  cs_lnum_t  n_band_cells = 0;
+  for (cs_lnum_t  c_id = 0; c_id < quant->n_cells; c_id++) {
+
+    if (connect->cell_flag[c_id] & CS_FLAG_SOLID_CELL)
+      continue;
+
+    cs_solidification_state_t  state_pre =
+      _which_state(alloy, t_bulk_pre[c_id], c_bulk_pre[c_id]);
+
+    if (state_pre == CS_SOLIDIFICATION_STATE_SOLID)
+      continue;
+
+    alloy->band_cell_ids[n_band_cells] = c_id;
+    alloy->band_state_pre[n_band_cells] = state_pre;
+    n_band_cells++;
+
+  } /* Loop on cells */
+
+  alloy->n_band_cells = n_band_cells;
+  alloy->band_time_id = ts->nt_cur;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Update the liquid fraction in each cell
@@ -990,18 +1048,19 @@ _update_thm_legacy(const cs_mesh_t             *mesh,
 
   const cs_real_t  rhoLovdt = solid->rho0 * alloy->latent_heat/ts->dt[0];
 
-  for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+  /* Only cells in the band are updated: 0 elsewhere */
+  _update_band_cells(connect, quant, ts);
 
-    if (connect->cell_flag[c_id] & CS_FLAG_SOLID_CELL)
-      continue; /* No update: 0 by default */
+  for (cs_lnum_t i = 0; i < alloy->n_band_cells; i++) {
 
+    const cs_lnum_t  c_id = alloy->band_cell_ids[i];
     const cs_real_t  conc = c_bulk[c_id];
     const cs_real_t  conc_pre = c_bulk_pre[c_id];
     const cs_real_t  temp_pre = t_bulk_pre[c_id];
 
     /* Knowing in which part of the phase diagram we are, then we update
      * the value of the concentration of the liquid "solute" */
-    switch (_which_state(alloy, temp_pre, conc_pre)) {
+    switch (alloy->band_state_pre[i]) {
 
     case CS_SOLIDIFICATION_STATE_SOLID:
     case CS_SOLIDIFICATION_STATE_LIQUID:
@@ -1262,11 +1321,12 @@ _update_thm_taylor(const cs_mesh_t             *mesh,
   const cs_real_t  rhoLovdt = solid->rho0 * alloy->latent_heat/ts->dt[0];
   const double  cpovL = solid->cp0/alloy->latent_heat;
 
-  for (cs_lnum_t  c_id = 0; c_id < quant->n_cells; c_id++) {
+  /* Only cells in the band are updated: 0 elsewhere */
+  _update_band_cells(connect, quant, ts);
 
-    if (connect->cell_flag[c_id] & CS_FLAG_SOLID_CELL)
-      continue; /* No update */
+  for (cs_lnum_t i = 0; i < alloy->n_band_cells; i++) {
 
+    const cs_lnum_t  c_id = alloy->band_cell_ids[i];
     const cs_real_t  conc = c_bulk[c_id];
     const cs_real_t  conc_pre = c_bulk_pre[c_id];
     const cs_real_t  temp_pre = t_bulk_pre[c_id];
@@ -1278,7 +1338,7 @@ _update_thm_taylor(const cs_mesh_t             *mesh,
 
     /* Knowing in which part of the phase diagram we are, then we update
      * the value of the concentration of the liquid "solute" */
-    switch (_which_state(alloy, temp_pre, conc_pre)) {
+    switch (alloy->band_state_pre[i]) {
 
     case CS_SOLIDIFICATION_STATE_LIQUID:
       /* From the knowledge of the previous iteration, try something
@@ -1720,11 +1780,12 @@ _update_thm_path(const cs_mesh_t             *mesh,
 
   const cs_real_t  rhoLovdt = solid->rho0 * alloy->latent_heat/ts->dt[0];
 
-  for (cs_lnum_t  c_id = 0; c_id < quant->n_cells; c_id++) {
+  /* Only cells in the band are updated: 0 elsewhere */
+  _update_band_cells(connect, quant, ts);
 
-    if (connect->cell_flag[c_id] & CS_FLAG_SOLID_CELL)
-      continue; /* No update */
+  for (cs_lnum_t i = 0; i < alloy->n_band_cells; i++) {
 
+    const cs_lnum_t  c_id = alloy->band_cell_ids[i];
     const cs_real_t  conc_kp1 = c_bulk[c_id]; /* Solute transport solved */
     const cs_real_t  conc_k = alloy->ck_bulk[c_id];
     const cs_real_t  temp_k = t_bulk[c_id];
@@ -1739,7 +1800,7 @@ _update_thm_path(const cs_mesh_t             *mesh,
 
     /* Knowing in which part of the phase diagram we are, then we update
      * the value of the concentration of the liquid "solute" */
-    switch (_which_state(alloy, temp_pre, conc_pre)) {
+    switch (alloy->band_state_pre[i]) {
 
     case CS_SOLIDIFICATION_STATE_LIQUID:
       /* ==============================
@@ -2579,6 +2640,11 @@ cs_solidification_set_binary_alloy_model(const char     *name,
   alloy->tx_bulk = NULL;
   alloy->cx_bulk = NULL;
 
+  alloy->band_time_id = -1;
+  alloy->n_band_cells = 0;
+  alloy->band_cell_ids = NULL;
+  alloy->band_state_pre = NULL;
+
   /* Physical constants */
   alloy->latent_heat = latent_heat;
 
@@ -2812,6 +2878,8 @@ cs_solidification_destroy_all(void)
     BFT_FREE(alloy->eta_coef_array);
     BFT_FREE(alloy->tk_bulk);
     BFT_FREE(alloy->ck_bulk);
+    BFT_FREE(alloy->band_cell_ids);
+    BFT_FREE(alloy->band_state_pre);
 
     if (solid->options & CS_SOLIDIFICATION_USE_EXTRAPOLATION) {
       BFT_FREE(alloy->tx_bulk);
@@ -3090,6 +3158,10 @@ cs_solidification_finalize_setup(const cs_cdo_connect_t       *connect,
     BFT_MALLOC(alloy->tk_bulk, n_cells, cs_real_t);
     BFT_MALLOC(alloy->ck_bulk, n_cells, cs_real_t);
 
+    /* Narrow band of cells where the thermal source term is updated */
+    BFT_MALLOC(alloy->band_cell_ids, n_cells, cs_lnum_t);
+    BFT_MALLOC(alloy->band_state_pre, n_cells, cs_solidification_state_t);
+
     if (solid->options & CS_SOLIDIFICATION_USE_EXTRAPOLATION) {
       BFT_MALLOC(alloy->tx_bulk, n_cells, cs_real_t);
       BFT_MALLOC(alloy->cx_bulk, n_cells, cs_real_t);
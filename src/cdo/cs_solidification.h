@@ -412,6 +412,18 @@ typedef struct {
   cs_real_t         *tx_bulk;
   cs_real_t         *cx_bulk;
 
+  /* Narrow band of cells where the source term of the thermal equation is
+   * updated during the non-linear iterations. This band gathers the cells
+   * which are not solid at the previous time step (the source term is zero
+   * elsewhere) and it is built once per time step (band_time_id).
+   * band_state_pre stores the state at the previous time step of the cells
+   * in the band (compact numbering).
+   */
+  int                          band_time_id;
+  cs_lnum_t                    n_band_cells;
+  cs_lnum_t                   *band_cell_ids;
+  cs_solidification_state_t   *band_state_pre;
+
   /* Solute concentration in the liquid phase
    * 1) array of the last computed values at cells
    * 2) array of the last computed values at faces (interior and border) */
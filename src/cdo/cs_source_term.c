@@ -713,6 +713,11 @@ cs_source_term_init(cs_param_space_scheme_t       space_scheme,
 
       case CS_XDEF_BY_ANALYTIC_FUNCTION:
         msh_flag |= CS_FLAG_COMP_PV;
+
+        /* Quadrature selected cellwise (if activated) */
+        cs_xdef_init_quadrature_cache(source_terms[st_id],
+                                      cs_cdo_quant->n_cells);
+
         if ((*sys_flag) & CS_FLAG_SYS_VECTOR) {
 
           /* Switch only to allow more precise quadratures */
@@ -2036,7 +2041,12 @@ cs_source_term_pcsd_by_analytic(const cs_xdef_t           *source,
 
   assert(source->dim == 1);
 
-  if (source->qtype == CS_QUADRATURE_BARY)
+  /* Cellwise selection of the quadrature (if activated) */
+  const cs_quadrature_type_t  qtype =
+    cs_xdef_cw_eval_select_quadrature(cm, time_eval, 1, source->qtype,
+                                      source->context);
+
+  if (qtype == CS_QUADRATURE_BARY)
     cs_source_term_pcsd_bary_by_analytic(source, cm, time_eval, cb, input,
                                          values);
 
@@ -2047,7 +2057,7 @@ cs_source_term_pcsd_by_analytic(const cs_xdef_t           *source,
     double  cell_values  = 0.0;
 
     cs_quadrature_tetra_integral_t  *qfunc =
-      cs_quadrature_get_tetra_integral(1, source->qtype);
+      cs_quadrature_get_tetra_integral(1, qtype);
 
     cs_xdef_analytic_context_t *ac =
       (cs_xdef_analytic_context_t *)source->context;
@@ -2258,7 +2268,12 @@ cs_source_term_pcvd_by_analytic(const cs_xdef_t           *source,
                        CS_FLAG_COMP_FEQ | CS_FLAG_COMP_EV));
   assert(source->dim == 3);
 
-  if (source->qtype == CS_QUADRATURE_BARY)
+  /* Cellwise selection of the quadrature (if activated) */
+  const cs_quadrature_type_t  qtype =
+    cs_xdef_cw_eval_select_quadrature(cm, time_eval, 3, source->qtype,
+                                      source->context);
+
+  if (qtype == CS_QUADRATURE_BARY)
     cs_source_term_pcvd_bary_by_analytic(source, cm, time_eval, cb, input,
                                          values);
 
@@ -2269,7 +2284,7 @@ cs_source_term_pcvd_by_analytic(const cs_xdef_t           *source,
     cs_real_3_t  cell_values = {0.0, 0.0, 0.0};
 
     cs_quadrature_tetra_integral_t  *qfunc =
-      cs_quadrature_get_tetra_integral(3, source->qtype);
+      cs_quadrature_get_tetra_integral(3, qtype);
 
     cs_xdef_analytic_context_t  *ac =
       (cs_xdef_analytic_context_t *)source->context;
@@ -118,6 +118,8 @@ cs_xdef_volume_create(cs_xdef_type_t           type,
   d->z_id = z_id;
   d->state = state;
   d->meta = meta;
+  d->dep_flag = (type == CS_XDEF_BY_VALUE) ?
+    0 : CS_XDEF_DEP_TIME | CS_XDEF_DEP_STATE;
   d->qtype = CS_QUADRATURE_BARY; /* default value */
 
   /* Now define the context pointer */
@@ -147,6 +149,10 @@ cs_xdef_volume_create(cs_xdef_type_t           type,
       b->func = a->func;
       b->input = a->input;
       b->free_input = a->free_input;
+      b->cache = NULL;
+      b->cache_stride = 0;
+      b->qtol = 0.;
+      b->qtypes = NULL;
 
       d->context = b;
     }
@@ -287,6 +293,8 @@ cs_xdef_boundary_create(cs_xdef_type_t    type,
   d->z_id = z_id;
   d->state = state;
   d->meta = meta;
+  d->dep_flag = (type == CS_XDEF_BY_VALUE) ?
+    0 : CS_XDEF_DEP_TIME | CS_XDEF_DEP_STATE;
   d->qtype = CS_QUADRATURE_BARY; /* default value */
 
   switch (type) {
@@ -316,6 +324,10 @@ cs_xdef_boundary_create(cs_xdef_type_t    type,
       b->func = a->func;
       b->input = a->input;
       b->free_input = a->free_input;
+      b->cache = NULL;
+      b->cache_stride = 0;
+      b->qtol = 0.;
+      b->qtypes = NULL;
 
       d->context = b;
     }
@@ -431,6 +443,8 @@ cs_xdef_timestep_create(cs_xdef_type_t       type,
   d->z_id = -1;                  /* no associated zone */
   d->state = state;
   d->meta = meta;
+  d->dep_flag = (type == CS_XDEF_BY_VALUE) ?
+    0 : CS_XDEF_DEP_TIME | CS_XDEF_DEP_STATE;
   d->qtype = CS_QUADRATURE_NONE; /* default value */
 
   switch (type) {
@@ -506,6 +520,8 @@ cs_xdef_free(cs_xdef_t     *d)
       if (c->free_input != NULL)
         c->input = c->free_input(c->input);
 
+      BFT_FREE(c->cache);
+      BFT_FREE(c->qtypes);
       BFT_FREE(d->context);
     }
     break;
@@ -601,6 +617,17 @@ cs_xdef_copy(cs_xdef_t     *src)
   }
 
   cpy->qtype = src->qtype;
+  cpy->dep_flag = src->dep_flag;
+
+  if (src->type == CS_XDEF_BY_ANALYTIC_FUNCTION &&
+      src->support != CS_XDEF_SUPPORT_TIME) {
+
+    const cs_xdef_analytic_context_t  *sc = src->context;
+    cs_xdef_analytic_context_t  *cc = cpy->context;
+
+    cc->qtol = sc->qtol;
+
+  }
 
   return cpy;
 }
@@ -632,6 +659,8 @@ cs_xdef_set_input_context(cs_xdef_t       *d,
       cs_xdef_analytic_context_t *c = (cs_xdef_analytic_context_t *)d->context;
 
       c->input = input;
+      BFT_FREE(c->cache); /* Cached values are not valid anymore */
+      BFT_FREE(c->qtypes);
     }
     break;
 
@@ -801,6 +830,143 @@ cs_xdef_set_quadrature(cs_xdef_t              *d,
   d->qtype = qtype;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the dependencies of the values related to the given
+ *         description (see \ref CS_XDEF_DEP_TIME and \ref CS_XDEF_DEP_STATE).
+ *         Values already cached are discarded.
+ *
+ * \param[in, out]  d          pointer to a cs_xdef_t structure
+ * \param[in]       dep_flag   flag storing the dependencies
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_set_dependency(cs_xdef_t     *d,
+                       cs_flag_t      dep_flag)
+{
+  if (d == NULL)
+    return;
+
+  d->dep_flag = dep_flag;
+
+  cs_xdef_reset_cache(d);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the flag storing the dependencies of the values related to
+ *         the given description
+ *
+ * \param[in]  d       pointer to a cs_xdef_t structure
+ *
+ * \return the value of the flag
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_flag_t
+cs_xdef_get_dependency(const cs_xdef_t     *d)
+{
+  if (d == NULL)
+    return 0;
+  else
+    return d->dep_flag;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Discard the values cached for the given description (if any).
+ *         This has to be called when the inputs of a cached definition are
+ *         modified.
+ *
+ * \param[in, out]  d       pointer to a cs_xdef_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_reset_cache(cs_xdef_t     *d)
+{
+  if (d == NULL)
+    return;
+
+  if (d->type == CS_XDEF_BY_ANALYTIC_FUNCTION) {
+
+    cs_xdef_analytic_context_t *c = (cs_xdef_analytic_context_t *)d->context;
+
+    BFT_FREE(c->cache);
+    BFT_FREE(c->qtypes);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate the cellwise selection of the quadrature in the case of a
+ *         definition by an analytic function. The cheapest quadrature for
+ *         which an estimation of the variation of the integrand is below the
+ *         given tolerance is used. The quadrature set for this definition is
+ *         the most accurate one which can be selected.
+ *         A tolerance lower or equal to zero deactivates the selection.
+ *
+ * \param[in, out]  d          pointer to a cs_xdef_t structure
+ * \param[in]       tol        tolerance used for the selection
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_set_quadrature_tolerance(cs_xdef_t     *d,
+                                 cs_real_t      tol)
+{
+  if (d == NULL)
+    return;
+
+  if (d->type != CS_XDEF_BY_ANALYTIC_FUNCTION ||
+      d->support == CS_XDEF_SUPPORT_TIME)
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Only available for a definition by an analytic function.",
+              __func__);
+
+  cs_xdef_analytic_context_t *c = (cs_xdef_analytic_context_t *)d->context;
+
+  c->qtol = tol;
+  BFT_FREE(c->qtypes);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate the array storing the quadrature selected in each cell if
+ *         the cellwise selection is activated and if the definition depends
+ *         neither on time nor on the state of the computation
+ *
+ * \param[in, out]  d          pointer to a cs_xdef_t structure
+ * \param[in]       n_cells    number of cells
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_init_quadrature_cache(cs_xdef_t     *d,
+                              cs_lnum_t      n_cells)
+{
+  if (d == NULL)
+    return;
+  if (d->type != CS_XDEF_BY_ANALYTIC_FUNCTION ||
+      d->support == CS_XDEF_SUPPORT_TIME)
+    return;
+  if (d->dep_flag & (CS_XDEF_DEP_TIME | CS_XDEF_DEP_STATE))
+    return;
+
+  cs_xdef_analytic_context_t *c = (cs_xdef_analytic_context_t *)d->context;
+
+  if (c->qtol <= 0 || c->qtypes != NULL)
+    return;
+
+  BFT_MALLOC(c->qtypes, n_cells, short int);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    c->qtypes[i] = CS_QUADRATURE_NONE;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Get the type of quadrature to use for evaluating the given
@@ -922,6 +1088,16 @@ cs_xdef_log(const char          *prefix,
   case CS_XDEF_BY_ANALYTIC_FUNCTION:
     cs_log_printf(CS_LOG_SETUP, "%s | Definition by an analytical function\n",
                   _p);
+    cs_log_printf(CS_LOG_SETUP, "%s | Time dependency %s State dependency %s\n",
+                  _p,
+                  cs_base_strtf(d->dep_flag & CS_XDEF_DEP_TIME),
+                  cs_base_strtf(d->dep_flag & CS_XDEF_DEP_STATE));
+    if (d->support != CS_XDEF_SUPPORT_TIME) {
+      const cs_xdef_analytic_context_t  *ac = d->context;
+      if (ac->qtol > 0)
+        cs_log_printf(CS_LOG_SETUP, "%s | Cellwise selection of the quadrature"
+                      " (tolerance: %5.3e)\n", _p, ac->qtol);
+    }
     break;
 
   case CS_XDEF_BY_DOF_FUNCTION:
@@ -47,6 +47,26 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/*!
+ * @name Flags specifying the dependencies of a definition
+ * @{
+ *
+ * \def CS_XDEF_DEP_TIME
+ * \brief The values related to the definition depend on time
+ *
+ * \def CS_XDEF_DEP_STATE
+ * \brief The values related to the definition depend on the state of the
+ * computation (fields, other quantities updated along the computation...)
+ *
+ * A definition by an analytic function without any dependency is evaluated
+ * once for all at cell centers and the resulting values are then cached.
+ */
+
+#define CS_XDEF_DEP_TIME     (1 << 0)  /*!< 1: depends on time */
+#define CS_XDEF_DEP_STATE    (1 << 1)  /*!< 2: depends on the state */
+
+/*! @} */
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -174,6 +194,12 @@ typedef struct {
    * These metadata may vary according to the object on which the description
    * applies.
    *
+   * \var dep_flag
+   * Flag storing the dependencies of the values related to this definition
+   * (see \ref CS_XDEF_DEP_TIME and \ref CS_XDEF_DEP_STATE). By default, one
+   * assumes that a definition depends on time and on the state except for a
+   * definition by value.
+   *
    * \var qtype
    * type of quadrature to use for evaluating the description (see
    * \ref cs_quadrature_type_t)
@@ -192,6 +218,7 @@ typedef struct {
 
   cs_flag_t              state;
   cs_flag_t              meta;
+  cs_flag_t              dep_flag;
 
   cs_quadrature_type_t   qtype;
 
@@ -266,6 +293,33 @@ typedef struct {
    */
   cs_xdef_free_input_t  *free_input;
 
+  /*! \var cache
+   * NULL or values at cell centers computed once for all when the definition
+   * depends neither on time nor on the state (size: cache_stride*n_cells).
+   * Only the values related to the cells of the zone are set.
+   */
+  cs_real_t             *cache;
+
+  /*! \var cache_stride
+   * number of cached values for each cell
+   */
+  int                    cache_stride;
+
+  /*! \var qtol
+   * tolerance used to select cellwise the cheapest quadrature. If the value
+   * is lower or equal to zero, the quadrature related to the definition is
+   * always used (default). Otherwise, this quadrature is the most accurate
+   * one which can be selected.
+   */
+  cs_real_t              qtol;
+
+  /*! \var qtypes
+   * NULL or quadrature selected in each cell (CS_QUADRATURE_NONE if not
+   * selected yet). Only allocated for a definition depending neither on time
+   * nor on the state.
+   */
+  short int             *qtypes;
+
 } cs_xdef_analytic_context_t;
 
 /*!
@@ -604,6 +658,81 @@ void
 cs_xdef_set_quadrature(cs_xdef_t              *d,
                        cs_quadrature_type_t    qtype);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the dependencies of the values related to the given
+ *         description (see \ref CS_XDEF_DEP_TIME and \ref CS_XDEF_DEP_STATE).
+ *         Values already cached are discarded.
+ *
+ * \param[in, out]  d          pointer to a cs_xdef_t structure
+ * \param[in]       dep_flag   flag storing the dependencies
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_set_dependency(cs_xdef_t     *d,
+                       cs_flag_t      dep_flag);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the flag storing the dependencies of the values related to
+ *         the given description
+ *
+ * \param[in]  d       pointer to a cs_xdef_t structure
+ *
+ * \return the value of the flag
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_flag_t
+cs_xdef_get_dependency(const cs_xdef_t     *d);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Discard the values cached for the given description (if any).
+ *         This has to be called when the inputs of a cached definition are
+ *         modified.
+ *
+ * \param[in, out]  d       pointer to a cs_xdef_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_reset_cache(cs_xdef_t     *d);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate the cellwise selection of the quadrature in the case of a
+ *         definition by an analytic function. The cheapest quadrature for
+ *         which an estimation of the variation of the integrand is below the
+ *         given tolerance is used. The quadrature set for this definition is
+ *         the most accurate one which can be selected.
+ *         A tolerance lower or equal to zero deactivates the selection.
+ *
+ * \param[in, out]  d          pointer to a cs_xdef_t structure
+ * \param[in]       tol        tolerance used for the selection
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_set_quadrature_tolerance(cs_xdef_t     *d,
+                                 cs_real_t      tol);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate the array storing the quadrature selected in each cell if
+ *         the cellwise selection is activated and if the definition depends
+ *         neither on time nor on the state of the computation
+ *
+ * \param[in, out]  d          pointer to a cs_xdef_t structure
+ * \param[in]       n_cells    number of cells
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_init_quadrature_cache(cs_xdef_t     *d,
+                              cs_lnum_t      n_cells);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Get the type of quadrature to use for evaluating the given
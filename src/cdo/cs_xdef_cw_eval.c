@@ -640,6 +640,90 @@ cs_xdef_cw_eval_by_time_func(const cs_cell_mesh_t     *cm,
   tfc->func(time_eval, tfc->input, eval);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Select the cheapest quadrature to integrate over a cell a quantity
+ *         defined by an analytic function. The variation of the integrand is
+ *         estimated from its values at the cell center and at the cell
+ *         vertices. The barycentric quadrature is kept if this variation is
+ *         below the tolerance set in the context (relatively to the magnitude
+ *         of the function), a quadrature with a single weight is used if the
+ *         variation is below the square root of the tolerance. Otherwise, the
+ *         given quadrature is used.
+ *         The choice is cached if possible (cf. \ref
+ *         cs_xdef_init_quadrature_cache). Since the estimation requires
+ *         n_vc+1 evaluations, this is worthwhile only with respect to a
+ *         quadrature relying on a subdivision into tetrahedra.
+ *
+ * \param[in]      cm       pointer to a \ref cs_cell_mesh_t structure
+ * \param[in]      t_eval   physical time at which one evaluates the term
+ * \param[in]      dim      dimension of the function (up to 9)
+ * \param[in]      qtype    most accurate quadrature which can be selected
+ * \param[in, out] context  pointer to a context structure
+ *
+ * \return the quadrature to use in this cell
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_quadrature_type_t
+cs_xdef_cw_eval_select_quadrature(const cs_cell_mesh_t       *cm,
+                                  cs_real_t                   t_eval,
+                                  int                         dim,
+                                  cs_quadrature_type_t        qtype,
+                                  void                       *context)
+{
+  cs_xdef_analytic_context_t  *ac = (cs_xdef_analytic_context_t *)context;
+
+  if (ac->qtol <= 0 || qtype <= CS_QUADRATURE_BARY)
+    return qtype;
+
+  if (ac->qtypes != NULL)
+    if (ac->qtypes[cm->c_id] != CS_QUADRATURE_NONE)
+      return (cs_quadrature_type_t)ac->qtypes[cm->c_id];
+
+  assert(dim <= 9);
+  assert(cs_eflag_test(cm->flag, CS_FLAG_COMP_PV));
+
+  cs_real_t  f_c[9], f_v[9], f_avg[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+  ac->func(t_eval, 1, NULL, cm->xc, true, ac->input, f_c);
+
+  cs_real_t  f_max = 0.;
+  for (int k = 0; k < dim; k++)
+    f_max = fmax(f_max, fabs(f_c[k]));
+
+  for (short int v = 0; v < cm->n_vc; v++) {
+
+    ac->func(t_eval, 1, NULL, cm->xv + 3*v, true, ac->input, f_v);
+
+    for (int k = 0; k < dim; k++) {
+      f_avg[k] += f_v[k];
+      f_max = fmax(f_max, fabs(f_v[k]));
+    }
+
+  }
+
+  /* The barycentric quadrature is exact for linear functions. The deviation
+     between the value at the cell center and the mean value at vertices is
+     used as an estimation of the non-linear part of the integrand */
+  const cs_real_t  inv_n_vc = 1./cm->n_vc;
+  cs_real_t  delta = 0.;
+  for (int k = 0; k < dim; k++)
+    delta = fmax(delta, fabs(inv_n_vc*f_avg[k] - f_c[k]));
+
+  cs_quadrature_type_t  q = qtype;
+  if (delta <= ac->qtol * f_max)
+    q = CS_QUADRATURE_BARY;
+  else if (delta <= sqrt(ac->qtol) * f_max)
+    q = CS_MIN(qtype, CS_QUADRATURE_HIGHER);
+
+  /* Each cell is handled by only one thread */
+  if (ac->qtypes != NULL)
+    ac->qtypes[cm->c_id] = q;
+
+  return q;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Evaluate a quantity defined using an analytic function by a
@@ -660,6 +744,15 @@ cs_xdef_cw_eval_by_analytic(const cs_cell_mesh_t       *cm,
 {
   cs_xdef_analytic_context_t  *ac = (cs_xdef_analytic_context_t *)context;
 
+  if (ac->cache != NULL) { /* Values computed once for all */
+
+    const cs_real_t  *_c = ac->cache + ac->cache_stride*cm->c_id;
+    for (int k = 0; k < ac->cache_stride; k++)
+      eval[k] = _c[k];
+    return;
+
+  }
+
   /* Evaluate the function for this time at the cell center */
   ac->func(time_eval,
            1, NULL, cm->xc, true, /* compacted output ? */
@@ -842,6 +842,38 @@ cs_xdef_cw_eval_by_time_func(const cs_cell_mesh_t     *cm,
                              void                     *context,
                              cs_real_t                *eval);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Select the cheapest quadrature to integrate over a cell a quantity
+ *         defined by an analytic function. The variation of the integrand is
+ *         estimated from its values at the cell center and at the cell
+ *         vertices. The barycentric quadrature is kept if this variation is
+ *         below the tolerance set in the context (relatively to the magnitude
+ *         of the function), a quadrature with a single weight is used if the
+ *         variation is below the square root of the tolerance. Otherwise, the
+ *         given quadrature is used.
+ *         The choice is cached if possible (cf. \ref
+ *         cs_xdef_init_quadrature_cache). Since the estimation requires
+ *         n_vc+1 evaluations, this is worthwhile only with respect to a
+ *         quadrature relying on a subdivision into tetrahedra.
+ *
+ * \param[in]      cm       pointer to a \ref cs_cell_mesh_t structure
+ * \param[in]      t_eval   physical time at which one evaluates the term
+ * \param[in]      dim      dimension of the function (up to 9)
+ * \param[in]      qtype    most accurate quadrature which can be selected
+ * \param[in, out] context  pointer to a context structure
+ *
+ * \return the quadrature to use in this cell
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_quadrature_type_t
+cs_xdef_cw_eval_select_quadrature(const cs_cell_mesh_t       *cm,
+                                  cs_real_t                   t_eval,
+                                  int                         dim,
+                                  cs_quadrature_type_t        qtype,
+                                  void                       *context);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Evaluate a quantity defined using an analytic function by a
@@ -47,6 +47,7 @@
 #include "cs_field.h"
 #include "cs_mesh_location.h"
 #include "cs_reco.h"
+#include "cs_volume_zone.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -622,6 +623,37 @@ cs_xdef_eval_at_cells_by_analytic(cs_lnum_t                    n_elts,
   /* Sanity checks */
   assert(cx != NULL);
 
+  if (cx->cache != NULL) { /* Values computed once for all */
+
+    const int  stride = cx->cache_stride;
+
+    if (elt_ids == NULL)
+      memcpy(eval, cx->cache, stride*n_elts*sizeof(cs_real_t));
+
+    else {
+
+      if (dense_output) {
+#       pragma omp parallel for if (n_elts > CS_THR_MIN)
+        for (cs_lnum_t i = 0; i < n_elts; i++) {
+          const cs_real_t  *_c = cx->cache + stride*elt_ids[i];
+          for (int k = 0; k < stride; k++)
+            eval[stride*i + k] = _c[k];
+        }
+      }
+      else {
+#       pragma omp parallel for if (n_elts > CS_THR_MIN)
+        for (cs_lnum_t i = 0; i < n_elts; i++) {
+          const cs_lnum_t  shift = stride*elt_ids[i];
+          for (int k = 0; k < stride; k++)
+            eval[shift + k] = cx->cache[shift + k];
+        }
+      }
+
+    }
+
+    return;
+  }
+
   /* Evaluate the function for this time at the cell center */
   cx->func(time_eval, n_elts, elt_ids, cell_centers, dense_output, cx->input,
            eval);
@@ -1452,6 +1484,58 @@ cs_xdef_eval_avg_at_b_faces_by_analytic(cs_lnum_t                    n_elts,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Evaluate once for all at cell centers a volume definition by an
+ *         analytic function which depends neither on time nor on the state
+ *         of the computation. The resulting values are stored inside the
+ *         context of the definition and then used by the evaluation functions
+ *         at cells instead of calling the analytic function.
+ *         Nothing is done if the definition does not fulfill these criteria.
+ *
+ * \param[in, out] def           pointer to a cs_xdef_t structure
+ * \param[in]      quant         pointer to a cs_cdo_quantities_t structure
+ * \param[in]      time_eval     physical time at which one evaluates the term
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_eval_cache_at_cells(cs_xdef_t                   *def,
+                            const cs_cdo_quantities_t   *quant,
+                            cs_real_t                    time_eval)
+{
+  if (def == NULL || quant == NULL)
+    return;
+  if (def->type != CS_XDEF_BY_ANALYTIC_FUNCTION)
+    return;
+  if (def->support != CS_XDEF_SUPPORT_VOLUME)
+    return;
+  if (def->dep_flag & (CS_XDEF_DEP_TIME | CS_XDEF_DEP_STATE))
+    return;
+
+  cs_xdef_analytic_context_t  *cx = (cs_xdef_analytic_context_t *)def->context;
+
+  assert(cx != NULL);
+  if (cx->cache != NULL) /* Already done */
+    return;
+
+  const cs_zone_t  *z = cs_volume_zone_by_id(def->z_id);
+  const cs_lnum_t  n_elts = (def->z_id == 0) ? quant->n_cells : z->n_elts;
+  const cs_lnum_t  *elt_ids = (def->z_id == 0) ? NULL : z->elt_ids;
+
+  cs_real_t  *cache = NULL;
+  BFT_MALLOC(cache, def->dim*quant->n_cells, cs_real_t);
+
+  /* Values are stored with the cell numbering (no dense output) */
+  cx->func(time_eval, n_elts, elt_ids, quant->cell_centers,
+           false, /* dense output ? */
+           cx->input,
+           cache);
+
+  cx->cache_stride = def->dim;
+  cx->cache = cache;
+}
+
 /*----------------------------------------------------------------------------*/
 
 #undef _dp3
@@ -642,6 +642,26 @@ cs_xdef_eval_avg_at_b_faces_by_analytic(cs_lnum_t                    n_elts,
                                         int                          dim,
                                         cs_real_t                   *eval);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Evaluate once for all at cell centers a volume definition by an
+ *         analytic function which depends neither on time nor on the state
+ *         of the computation. The resulting values are stored inside the
+ *         context of the definition and then used by the evaluation functions
+ *         at cells instead of calling the analytic function.
+ *         Nothing is done if the definition does not fulfill these criteria.
+ *
+ * \param[in, out] def           pointer to a cs_xdef_t structure
+ * \param[in]      quant         pointer to a cs_cdo_quantities_t structure
+ * \param[in]      time_eval     physical time at which one evaluates the term
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_eval_cache_at_cells(cs_xdef_t                   *def,
+                            const cs_cdo_quantities_t   *quant,
+                            cs_real_t                    time_eval);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -78,6 +78,50 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute the constant ratio of specific heats for a single ideal gas
+ * or stiffened gas.
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_gamma0(void)
+{
+  cs_real_t gamma0;
+  cs_real_t cp0 = cs_glob_fluid_properties->cp0;
+  cs_real_t cv0 = cs_glob_fluid_properties->cv0;
+
+  cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, 1);
+
+  return gamma0;
+}
+
+/*----------------------------------------------------------------------------
+ * Check the number of values of the ratio of specific heats smaller than 1
+ * encountered in a loop for an ideal gas mixture.
+ *
+ * Counting these values instead of testing each one keeps the loop
+ * computing gamma free of calls to the error handler.
+ *
+ * parameters:
+ *   n_err <-- number of values of gamma smaller than 1
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_check_gamma_mix(cs_lnum_t  n_err)
+{
+  if (n_err > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error in thermodynamics computations for "
+                "compressible flows:\n"
+                "Value of gamma smaller to 1. encountered.\n"
+                "Gamma (specific heat ratio) must be a real number "
+                "greater or equal to 1.\n"));
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -349,46 +393,43 @@ cs_cf_thermo_te_from_dp(cs_real_t   *cp,
 {
   /* local variables */
   int ieos = cs_glob_cf_model->ieos;
+  const cs_real_t psginf = cs_glob_cf_model->psginf;
 
   /* calculation of temperature and energy from pressure and density */
 
   /* single ideal gas or stiffened gas eos - constant gamma */
   if (ieos == CS_EOS_IDEAL_GAS || ieos == CS_EOS_STIFFENED_GAS) {
-    cs_real_t gamma0;
-    cs_real_t cp0 = cs_glob_fluid_properties->cp0;
-    cs_real_t cv0 = cs_glob_fluid_properties->cv0;
-    cs_real_t psginf = cs_glob_cf_model->psginf;
-    cs_lnum_t l_size0 = 1;
-
-    cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
+    const cs_real_t gamma0 = _gamma0();
+    const cs_real_t gm1 = gamma0 - 1.;
+    const cs_real_t gm1_cv0 = gm1*cs_glob_fluid_properties->cv0;
+    const cs_real_t gpsginf = gamma0*psginf;
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  temperature */
-      temp[ii] = (pres[ii]+psginf) / ((gamma0-1.)*dens[ii]*cv0);
+      temp[ii] = (pres[ii]+psginf) / (gm1_cv0*dens[ii]);
       /*  total energy */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      ener[ii] = (pres[ii]+gamma0*psginf) / ((gamma0-1.)*dens[ii]) + 0.5*v2;
+      ener[ii] = (pres[ii]+gpsginf) / (gm1*dens[ii]) + 0.5*v2;
     }
   }
   /* ideal gas mixture */
   else if (ieos == CS_EOS_GAS_MIX) {
-    cs_real_t *gamma;
-    cs_real_t psginf = cs_glob_cf_model->psginf;
-
-    BFT_MALLOC(gamma, l_size, cs_real_t);
-
-    cs_cf_thermo_gamma(cp, cv, gamma, l_size);
+    cs_lnum_t n_err = 0;
 
+#   pragma omp parallel for reduction(+:n_err) if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
+      const cs_real_t gamma = cp[ii]/cv[ii];
+      n_err += (gamma < 1.);
       /*  temperature */
-      temp[ii] = (pres[ii]+psginf) / ((gamma[ii]-1.)*dens[ii]*cv[ii]);
+      temp[ii] = (pres[ii]+psginf) / ((gamma-1.)*dens[ii]*cv[ii]);
       /*  total energy */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      ener[ii] =  (pres[ii]+gamma[ii]*psginf) / ((gamma[ii]-1.)*dens[ii])
+      ener[ii] =  (pres[ii]+gamma*psginf) / ((gamma-1.)*dens[ii])
                 + 0.5*v2;
     }
 
-    BFT_FREE(gamma);
+    _check_gamma_mix(n_err);
   }
 }
 
@@ -419,44 +460,41 @@ cs_cf_thermo_de_from_pt(cs_real_t   *cp,
 {
   /* Local variables */
   int ieos = cs_glob_cf_model->ieos;
+  const cs_real_t psginf = cs_glob_cf_model->psginf;
 
   /* single ideal gas or stiffened gas eos - constant gamma */
   if (ieos == CS_EOS_IDEAL_GAS || ieos == CS_EOS_STIFFENED_GAS) {
-    cs_real_t gamma0;
-    cs_real_t cp0 = cs_glob_fluid_properties->cp0;
-    cs_real_t cv0 = cs_glob_fluid_properties->cv0;
-    cs_real_t psginf = cs_glob_cf_model->psginf;
-    cs_lnum_t l_size0 = 1;
-
-    cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
+    const cs_real_t gamma0 = _gamma0();
+    const cs_real_t gm1 = gamma0 - 1.;
+    const cs_real_t gm1_cv0 = gm1*cs_glob_fluid_properties->cv0;
+    const cs_real_t gpsginf = gamma0*psginf;
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  Density */
-      dens[ii] = (pres[ii]+psginf) / ((gamma0-1.)*temp[ii]*cv0);
+      dens[ii] = (pres[ii]+psginf) / (gm1_cv0*temp[ii]);
       /*  Total energy */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      ener[ii] = (pres[ii]+gamma0*psginf) / ((gamma0-1.)*dens[ii]) + 0.5*v2;
+      ener[ii] = (pres[ii]+gpsginf) / (gm1*dens[ii]) + 0.5*v2;
     }
   }
   /* ideal gas mixture */
   else if (ieos == CS_EOS_GAS_MIX) {
-    cs_real_t *gamma;
-    cs_real_t psginf = cs_glob_cf_model->psginf;
-
-    BFT_MALLOC(gamma, l_size, cs_real_t);
-
-    cs_cf_thermo_gamma(cp, cv, gamma, l_size);
+    cs_lnum_t n_err = 0;
 
+#   pragma omp parallel for reduction(+:n_err) if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
+      const cs_real_t gamma = cp[ii]/cv[ii];
+      n_err += (gamma < 1.);
       /*  Density */
-      dens[ii] = (pres[ii]+psginf) / ((gamma[ii]-1.)*temp[ii]*cv[ii]);
+      dens[ii] = (pres[ii]+psginf) / ((gamma-1.)*temp[ii]*cv[ii]);
       /*  Total energy */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      ener[ii] =  (pres[ii]+gamma[ii]*psginf) / ((gamma[ii]-1.)*dens[ii])
+      ener[ii] =  (pres[ii]+gamma*psginf) / ((gamma-1.)*dens[ii])
                 + 0.5*v2;
     }
 
-    BFT_FREE(gamma);
+    _check_gamma_mix(n_err);
   }
 }
 
@@ -486,53 +524,50 @@ cs_cf_thermo_dt_from_pe(cs_real_t   *cp,
                         cs_lnum_t    l_size)
 {
   /* Local variables */
-  cs_real_t enint;
   int ieos = cs_glob_cf_model->ieos;
+  const cs_real_t psginf = cs_glob_cf_model->psginf;
 
   /* single ideal gas or stiffened gas eos - constant gamma */
   if (ieos == CS_EOS_IDEAL_GAS || ieos == CS_EOS_STIFFENED_GAS) {
-    cs_real_t gamma0;
-    cs_real_t cp0 = cs_glob_fluid_properties->cp0;
-    cs_real_t cv0 = cs_glob_fluid_properties->cv0;
-    cs_real_t psginf = cs_glob_cf_model->psginf;
-    cs_lnum_t l_size0 = 1;
-
-    cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
+    const cs_real_t gamma0 = _gamma0();
+    const cs_real_t gm1 = gamma0 - 1.;
+    const cs_real_t gm1_cv0 = gm1*cs_glob_fluid_properties->cv0;
+    const cs_real_t gpsginf = gamma0*psginf;
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  Internal energy (to avoid the need to divide by the temperature
           to compute density) */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      enint =  ener[ii] - 0.5*v2;
+      cs_real_t enint =  ener[ii] - 0.5*v2;
 
       /*  Density */
-      dens[ii] = (pres[ii]+gamma0*psginf) / ((gamma0-1.)*enint);
+      dens[ii] = (pres[ii]+gpsginf) / (gm1*enint);
       /*  Temperature */
-      temp[ii] = (pres[ii]+psginf) / ((gamma0-1.)*dens[ii]*cv0);
+      temp[ii] = (pres[ii]+psginf) / (gm1_cv0*dens[ii]);
     }
   }
   /* ideal gas mixture */
   else if (ieos == CS_EOS_GAS_MIX) {
-    cs_real_t *gamma;
-    cs_real_t psginf = cs_glob_cf_model->psginf;
-
-    BFT_MALLOC(gamma, l_size, cs_real_t);
-
-    cs_cf_thermo_gamma(cp, cv, gamma, l_size);
+    cs_lnum_t n_err = 0;
 
+#   pragma omp parallel for reduction(+:n_err) if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
+      const cs_real_t gamma = cp[ii]/cv[ii];
+      n_err += (gamma < 1.);
+
       /*  Internal energy (to avoid the need to divide by the temperature
           to compute density) */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      enint =  ener[ii] - 0.5*v2;
+      cs_real_t enint =  ener[ii] - 0.5*v2;
 
       /*  Density */
-      dens[ii] = (pres[ii]+gamma[ii]*psginf) / ((gamma[ii]-1.)*enint);
+      dens[ii] = (pres[ii]+gamma*psginf) / ((gamma-1.)*enint);
       /*  Temperature */
-      temp[ii] = (pres[ii]+psginf) / ((gamma[ii]-1.)*dens[ii]*cv[ii]);
+      temp[ii] = (pres[ii]+psginf) / ((gamma-1.)*dens[ii]*cv[ii]);
     }
 
-    BFT_FREE(gamma);
+    _check_gamma_mix(n_err);
   }
 }
 
@@ -563,42 +598,40 @@ cs_cf_thermo_pe_from_dt(cs_real_t   *cp,
 {
   /* Local variables */
   int ieos = cs_glob_cf_model->ieos;
+  const cs_real_t psginf = cs_glob_cf_model->psginf;
 
   /* single ideal gas or stiffened gas eos - constant gamma */
   if (ieos == CS_EOS_IDEAL_GAS || ieos == CS_EOS_STIFFENED_GAS) {
-    cs_real_t gamma0;
-    cs_real_t cp0 = cs_glob_fluid_properties->cp0;
-    cs_real_t cv0 = cs_glob_fluid_properties->cv0;
-    cs_real_t psginf = cs_glob_cf_model->psginf;
-    cs_lnum_t l_size0 = 1;
-
-    cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
+    const cs_real_t gamma0 = _gamma0();
+    const cs_real_t gm1 = gamma0 - 1.;
+    const cs_real_t gm1_cv0 = gm1*cs_glob_fluid_properties->cv0;
+    const cs_real_t gpsginf = gamma0*psginf;
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  Pressure */
-      pres[ii] = (gamma0-1.)*cv0*dens[ii]*temp[ii] - psginf;
+      pres[ii] = gm1_cv0*dens[ii]*temp[ii] - psginf;
       /*  Total energy */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      ener[ii] = (pres[ii]+gamma0*psginf) / ((gamma0-1.)*dens[ii]) + 0.5*v2;
+      ener[ii] = (pres[ii]+gpsginf) / (gm1*dens[ii]) + 0.5*v2;
     }
   }
   /* ideal gas mixture */
   else if (ieos == CS_EOS_GAS_MIX) {
-    cs_real_t *gamma;
-    cs_real_t psginf = cs_glob_cf_model->psginf;
-    BFT_MALLOC(gamma, l_size, cs_real_t);
-
-    cs_cf_thermo_gamma(cp, cv, gamma, l_size);
+    cs_lnum_t n_err = 0;
 
+#   pragma omp parallel for reduction(+:n_err) if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
+      const cs_real_t gamma = cp[ii]/cv[ii];
+      n_err += (gamma < 1.);
       /*  Pressure */
-      pres[ii] = (gamma[ii]-1.)*cv[ii]*dens[ii]*temp[ii] - psginf;
+      pres[ii] = (gamma-1.)*cv[ii]*dens[ii]*temp[ii] - psginf;
       /*  Total energy */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      ener[ii] = (pres[ii]+gamma[ii]*psginf) / ((gamma[ii]-1.)*dens[ii]) + 0.5*v2;
+      ener[ii] = (pres[ii]+gamma*psginf) / ((gamma-1.)*dens[ii]) + 0.5*v2;
     }
 
-    BFT_FREE(gamma);
+    _check_gamma_mix(n_err);
   }
 }
 
@@ -634,59 +667,59 @@ cs_cf_thermo_pt_from_de(cs_real_t   *cp,
                         cs_lnum_t    l_size)
 {
   /*  Local variables */
-  cs_real_t enint;
   int ieos = cs_glob_cf_model->ieos;
+  const cs_real_t psginf = cs_glob_cf_model->psginf;
 
   /* single ideal gas or stiffened gas eos - constant gamma */
   if (ieos == CS_EOS_IDEAL_GAS || ieos == CS_EOS_STIFFENED_GAS) {
-    cs_real_t gamma0;
-    cs_real_t cp0 = cs_glob_fluid_properties->cp0;
-    cs_real_t cv0 = cs_glob_fluid_properties->cv0;
-    cs_real_t psginf = cs_glob_cf_model->psginf;
-    cs_lnum_t l_size0 = 1;
-
-    cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
+    const cs_real_t gamma0 = _gamma0();
+    const cs_real_t gm1 = gamma0 - 1.;
+    const cs_real_t gm1_cv0 = gm1*cs_glob_fluid_properties->cv0;
+    const cs_real_t gpsginf = gamma0*psginf;
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       /*  Internal energy (to avoid the need to divide by the temperature
           to compute density) */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      enint =  ener[ii] - 0.5*v2;
+      cs_real_t enint =  ener[ii] - 0.5*v2;
 
       /*  Pressure */
-      pres[ii] = (gamma0-1.)*dens[ii]*enint - gamma0*psginf;
+      pres[ii] = gm1*dens[ii]*enint - gpsginf;
       /*  Temperature */
-      temp[ii] = (pres[ii]+psginf) / ((gamma0-1.)*dens[ii]*cv0);
+      temp[ii] = (pres[ii]+psginf) / (gm1_cv0*dens[ii]);
     }
   }
   /* ideal gas mixture */
   else if (ieos == CS_EOS_GAS_MIX) {
-    cs_real_t *gamma;
-    cs_real_t psginf = cs_glob_cf_model->psginf;
-    BFT_MALLOC(gamma, l_size, cs_real_t);
-
-    cs_cf_thermo_gamma(cp, cv, gamma, l_size);
+    cs_lnum_t n_err = 0;
 
+#   pragma omp parallel for reduction(+:n_err) if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
+      const cs_real_t gamma = cp[ii]/cv[ii];
+      n_err += (gamma < 1.);
+
       /*  Internal energy (to avoid the need to divide by the temperature
           to compute density) */
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
-      enint =  ener[ii] - 0.5*v2;
+      cs_real_t enint =  ener[ii] - 0.5*v2;
 
       /*  Pressure */
-      pres[ii] = (gamma[ii]-1.)*dens[ii]*enint - gamma[ii]*psginf;
+      pres[ii] = (gamma-1.)*dens[ii]*enint - gamma*psginf;
       /*  Temperature */
-      temp[ii] = (pres[ii]+psginf) / ((gamma[ii]-1.)*dens[ii]*cv[ii]);
+      temp[ii] = (pres[ii]+psginf) / ((gamma-1.)*dens[ii]*cv[ii]);
     }
 
-    BFT_FREE(gamma);
+    _check_gamma_mix(n_err);
   }
-  /* homogeneous two phase */
+  /* homogeneous two phase: the equilibrium computations of
+     different cells are independent */
   else if (ieos == CS_EOS_HOMOGENEOUS_TWO_PHASE) {
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       cs_real_t v2 = cs_math_3_square_norm(vel[ii]);
 
-      enint =  ener[ii] - 0.5*v2;
+      cs_real_t enint =  ener[ii] - 0.5*v2;
 
       cs_real_t tau = 1./dens[ii];
 
@@ -733,37 +766,87 @@ cs_cf_thermo_c_square(cs_real_t *cp,
                       cs_real_t *frace,
                       cs_real_t *c2,
                       cs_lnum_t  l_size)
+{
+  cs_cf_thermo_gamma_c_square(cp, cv, pres, dens, fracv, fracm, frace,
+                              NULL, c2, l_size);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the ratio of specific heats and the square of sound
+ *        velocity in a single sweep.
+ *
+ * For the homogeneous two-phase model, the ratio of specific heats is
+ * replaced by the isentropic exponent \f$ \rho c^2 / p \f$ of the mixture.
+ *
+ * \param[in]     cp      array of isobaric specific heat values
+ * \param[in]     cv      array of isochoric specific heat values
+ * \param[in]     pres    array of pressure values
+ * \param[in]     dens    array of density values
+ * \param[in,out] fracv   array of volume fraction values
+ * \param[in,out] fracm   array of mass fraction values
+ * \param[in,out] frace   array of energy fraction values
+ * \param[out]    gamma   array of values of ratio of specific heat,
+ *                        or NULL
+ * \param[out]    c2      array of the values of the square of sound velocity
+ * \param[in]     l_size  l_size of the array
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cf_thermo_gamma_c_square(cs_real_t *cp,
+                            cs_real_t *cv,
+                            cs_real_t *pres,
+                            cs_real_t *dens,
+                            cs_real_t *fracv,
+                            cs_real_t *fracm,
+                            cs_real_t *frace,
+                            cs_real_t *gamma,
+                            cs_real_t *c2,
+                            cs_lnum_t  l_size)
 {
   /*  Local variables */
   int ieos = cs_glob_cf_model->ieos;
+  const cs_real_t psginf = cs_glob_cf_model->psginf;
 
   /* single ideal gas or stiffened gas eos - constant gamma */
   if (ieos == CS_EOS_IDEAL_GAS || ieos == CS_EOS_STIFFENED_GAS) {
-    cs_real_t gamma0;
-    cs_real_t cp0 = cs_glob_fluid_properties->cp0;
-    cs_real_t cv0 = cs_glob_fluid_properties->cv0;
-    cs_real_t psginf = cs_glob_cf_model->psginf;
-    cs_lnum_t l_size0 = 1;
-
-    cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
+    const cs_real_t gamma0 = _gamma0();
 
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++)
       c2[ii] = gamma0 * (pres[ii]+psginf) / dens[ii];
+
+    if (gamma != NULL) {
+      for (cs_lnum_t ii = 0; ii < l_size; ii++)
+        gamma[ii] = gamma0;
+    }
   }
   /* ideal gas mixture */
   else if (ieos == CS_EOS_GAS_MIX) {
-    cs_real_t *gamma;
-    cs_real_t psginf = cs_glob_cf_model->psginf;
-    BFT_MALLOC(gamma, l_size, cs_real_t);
-
-    cs_cf_thermo_gamma(cp, cv, gamma, l_size);
-
-    for (cs_lnum_t ii = 0; ii < l_size; ii++)
-      c2[ii] = gamma[ii] * (pres[ii]+psginf) / dens[ii];
+    cs_lnum_t n_err = 0;
+
+    if (gamma != NULL) {
+#     pragma omp parallel for reduction(+:n_err) if (l_size > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < l_size; ii++) {
+        gamma[ii] = cp[ii]/cv[ii];
+        n_err += (gamma[ii] < 1.);
+        c2[ii] = gamma[ii] * (pres[ii]+psginf) / dens[ii];
+      }
+    }
+    else {
+#     pragma omp parallel for reduction(+:n_err) if (l_size > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < l_size; ii++) {
+        const cs_real_t _gamma = cp[ii]/cv[ii];
+        n_err += (_gamma < 1.);
+        c2[ii] = _gamma * (pres[ii]+psginf) / dens[ii];
+      }
+    }
 
-    BFT_FREE(gamma);
+    _check_gamma_mix(n_err);
   }
   else if (ieos == CS_EOS_HOMOGENEOUS_TWO_PHASE){
+#   pragma omp parallel for if (l_size > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < l_size; ii++) {
       cs_real_t tau = 1./dens[ii];
 
@@ -772,6 +855,9 @@ cs_cf_thermo_c_square(cs_real_t *cp,
                                 frace[ii],
                                 pres[ii],
                                 tau);
+
+      if (gamma != NULL)
+        gamma[ii] = dens[ii]*c2[ii] / pres[ii];
     }
   }
 }
@@ -554,6 +554,38 @@ cs_cf_thermo_c_square(cs_real_t *cp,
                       cs_real_t *c2,
                       cs_lnum_t  l_size);
 
+/*----------------------------------------------------------------------------
+ * Compute the ratio of specific heats and the square of sound velocity
+ * in a single sweep.
+ *
+ * For the homogeneous two-phase model, the ratio of specific heats is
+ * replaced by the isentropic exponent rho.c2/p of the mixture.
+ *
+ * parameters:
+ *   cp     <-- array of isobaric specific heat values
+ *   cv     <-- array of isochoric specific heat values
+ *   pres   <-- array of pressure values
+ *   dens   <-- array of density values
+ *   fracv  <-> array of volume fraction values
+ *   fracm  <-> array of mass fraction values
+ *   frace  <-> array of energy fraction values
+ *   gamma  --> array of values of ratio of specific heat, or NULL
+ *   c2     --> array of the values of the square of sound velocity
+ *   l_size <-- l_size of the array
+ *----------------------------------------------------------------------------*/
+
+void
+cs_cf_thermo_gamma_c_square(cs_real_t *cp,
+                            cs_real_t *cv,
+                            cs_real_t *pres,
+                            cs_real_t *dens,
+                            cs_real_t *fracv,
+                            cs_real_t *fracm,
+                            cs_real_t *frace,
+                            cs_real_t *gamma,
+                            cs_real_t *c2,
+                            cs_lnum_t  l_size);
+
 /*----------------------------------------------------------------------------
  * Compute the thermal expansion coefficient for a perfect gas.
  *
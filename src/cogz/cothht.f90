@@ -84,9 +84,9 @@ double precision temper , enthal
 
 ! Local variables
 
-integer          it , iesp
+integer          it , iesp , it0 , it1
 
-double precision eh1 , eh0
+double precision eh1 , eh0 , ehm
 
 !===============================================================================
 !===============================================================================
@@ -95,40 +95,43 @@ double precision eh1 , eh0
 
 if ( mode.eq.-1 ) then
 
-  it = npo
-  if ( temper.ge.th(it) ) then
+  if ( temper.ge.th(npo) ) then
     enthal = zero
     do iesp = 1, nespec
-      enthal = enthal + xespec(iesp)*eh(iesp,it)
+      enthal = enthal + xespec(iesp)*eh(iesp,npo)
     enddo
-    go to 11
-  endif
 
-  it = 1
-  if ( temper.le.th(it) ) then
+  else if ( temper.le.th(1) ) then
     enthal = zero
     do iesp = 1, nespec
-      enthal = enthal + xespec(iesp)*eh(iesp,it)
+      enthal = enthal + xespec(iesp)*eh(iesp,1)
+    enddo
+
+  else
+
+    ! Recherche par dichotomie de l'intervalle th(it0) < temper <= th(it1)
+
+    it0 = 1
+    it1 = npo
+    do while (it1-it0 .gt. 1)
+      it = (it0+it1)/2
+      if ( temper.le.th(it) ) then
+        it1 = it
+      else
+        it0 = it
+      endif
     enddo
-    go to 11
-  endif
- 10     continue
 
-  it = it + 1
-  if ( temper.le.th(it) ) then
     eh0 = zero
     eh1 = zero
     do iesp = 1, nespec
-      eh0 = eh0 + xespec(iesp)*eh(iesp,it-1)
-      eh1 = eh1 + xespec(iesp)*eh(iesp,it  )
+      eh0 = eh0 + xespec(iesp)*eh(iesp,it0)
+      eh1 = eh1 + xespec(iesp)*eh(iesp,it1)
     enddo
     enthal = eh0                                                  &
-           + (eh1-eh0)*(temper-th(it-1))/(th(it)-th(it-1))
-    goto 11
-  endif
-  goto 10
- 11     continue
+           + (eh1-eh0)*(temper-th(it0))/(th(it1)-th(it0))
 
+  endif
 
 !===============================================================================
 ! 2. CALCUL DE LA TEMPERATURE A PARTIR DE l'ENTHALPIE
@@ -136,32 +139,48 @@ if ( mode.eq.-1 ) then
 
 else if ( mode.eq.1 ) then
 
-  it  = npo-1
   eh1 = zero
   do iesp = 1, nespec
-    eh1 = eh1 + xespec(iesp)*eh(iesp,it+1)
+    eh1 = eh1 + xespec(iesp)*eh(iesp,npo)
   enddo
-  if ( enthal.ge.eh1 ) temper = th(it+1)
 
-  it  = 1
   eh0 = zero
   do iesp = 1, nespec
-    eh0 = eh0 + xespec(iesp)*eh(iesp,it  )
+    eh0 = eh0 + xespec(iesp)*eh(iesp,1)
   enddo
-  if ( enthal.le.eh0 ) temper = th(it)
 
-  do it = 1, npo-1
-    eh0 = zero
-    eh1 = zero
-    do iesp = 1, nespec
-      eh0 = eh0 + xespec(iesp)*eh(iesp,it  )
-      eh1 = eh1 + xespec(iesp)*eh(iesp,it+1)
+  if ( enthal.ge.eh1 ) then
+    temper = th(npo)
+
+  else if ( enthal.le.eh0 ) then
+    temper = th(1)
+
+  else
+
+    ! L'enthalpie du melange croit avec la temperature : recherche
+    ! par dichotomie de l'intervalle eh0 < enthal < eh1
+
+    it0 = 1
+    it1 = npo
+    do while (it1-it0 .gt. 1)
+      it = (it0+it1)/2
+      ehm = zero
+      do iesp = 1, nespec
+        ehm = ehm + xespec(iesp)*eh(iesp,it)
+      enddo
+      if ( enthal.lt.ehm ) then
+        it1 = it
+        eh1 = ehm
+      else
+        it0 = it
+        eh0 = ehm
+      endif
     enddo
-    if ( enthal.ge.eh0 .and. enthal.le.eh1 )                      &
-      temper = th(it)                                             &
-             + (enthal-eh0)*(th(it+1)-th(it))/(eh1-eh0)
-  enddo
 
+    temper = th(it0)                                              &
+           + (enthal-eh0)*(th(it1)-th(it0))/(eh1-eh0)
+
+  endif
 
 else
 
@@ -144,6 +144,12 @@ struct _cs_ctwr_zone_t {
   cs_lnum_t  n_outlet_cells;     /* Number of outlet cells */
   cs_lnum_t *outlet_cells_ids;   /* List of outlet cells */
 
+#if defined(HAVE_MPI)
+  MPI_Comm   comm;               /* Associated communicator, restricted to
+                                    ranks with cells or faces of the zone
+                                    (MPI_COMM_NULL on other ranks) */
+#endif
+
   cs_real_t  q_l_in;          /* Water entry flow */
   cs_real_t  q_l_out;         /* Water exit flow */
   cs_real_t  t_l_in;          /* Mean water entry temperature */
@@ -313,6 +319,86 @@ _lewis_factor(const int        evap_model,
   return xlew;
 }
 
+/*----------------------------------------------------------------------------
+ * Build the communicator associated with a packing zone.
+ *
+ * Only ranks owning cells, inlet or outlet faces of the zone belong to
+ * this communicator, so that reductions relative to the zone do not
+ * involve the whole job.
+ *
+ * parameters:
+ *   ct <-> pointer to packing zone structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_zone_comm_build(cs_ctwr_zone_t  *ct)
+{
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    int color = MPI_UNDEFINED;
+    if (ct->n_cells > 0 || ct->n_inlet_faces > 0 || ct->n_outlet_faces > 0)
+      color = 1;
+
+    MPI_Comm_split(cs_glob_mpi_comm, color, cs_glob_rank_id, &(ct->comm));
+  }
+
+#else
+
+  CS_UNUSED(ct);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Check if the local rank is concerned by a packing zone.
+ *
+ * parameters:
+ *   ct <-- pointer to packing zone structure
+ *
+ * returns:
+ *   true if the local rank has cells or faces of the zone
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_zone_is_local(const cs_ctwr_zone_t  *ct)
+{
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    return (ct->comm != MPI_COMM_NULL);
+#endif
+
+  CS_UNUSED(ct);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Sum values of a given array over the ranks concerned by a packing zone.
+ *
+ * This function may be called only on ranks concerned by the zone.
+ *
+ * parameters:
+ *   ct   <-- pointer to packing zone structure
+ *   n    <-- number of values
+ *   vals <-> local values in, sums out
+ *----------------------------------------------------------------------------*/
+
+static void
+_zone_parall_sum(const cs_ctwr_zone_t  *ct,
+                 int                    n,
+                 cs_real_t              vals[])
+{
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Allreduce(MPI_IN_PLACE, vals, n, CS_MPI_REAL, MPI_SUM, ct->comm);
+#else
+  CS_UNUSED(ct);
+  CS_UNUSED(n);
+  CS_UNUSED(vals);
+#endif
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -440,6 +526,10 @@ cs_ctwr_define(const char           zone_criteria[],
   ct->n_outlet_cells = 0;
   ct->outlet_cells_ids = NULL;
 
+#if defined(HAVE_MPI)
+  ct->comm = MPI_COMM_NULL;
+#endif
+
   ct->q_l_in = 0.0;
   ct->q_l_out = 0.0;
   ct->t_l_in = 0.0;
@@ -608,6 +698,10 @@ cs_ctwr_all_destroy(void)
     BFT_FREE(ct->inlet_faces_ids);
     BFT_FREE(ct->outlet_faces_ids);
     BFT_FREE(ct->outlet_cells_ids);
+#if defined(HAVE_MPI)
+    if (ct->comm != MPI_COMM_NULL)
+      MPI_Comm_free(&(ct->comm));
+#endif
     BFT_FREE(ct);
 
   }
@@ -821,13 +915,13 @@ cs_ctwr_log_balance(void)
       ct->q_h_in  += sign * mass_flow[face_id];
     }
 
-    cs_parall_sum(1, CS_DOUBLE, &(ct->t_l_out));
-    cs_parall_sum(1, CS_DOUBLE, &(ct->q_l_out));
-    cs_parall_sum(1, CS_DOUBLE, &(ct->h_l_out));
+    double otmp[6] = {ct->t_l_out, ct->q_l_out, ct->h_l_out,
+                      ct->t_h_in, ct->h_h_in, ct->q_h_in};
+
+    cs_parall_sum(6, CS_DOUBLE, otmp);
 
-    cs_parall_sum(1, CS_DOUBLE, &(ct->t_h_in));
-    cs_parall_sum(1, CS_DOUBLE, &(ct->h_h_in));
-    cs_parall_sum(1, CS_DOUBLE, &(ct->q_h_in));
+    ct->t_l_out = otmp[0]; ct->q_l_out = otmp[1]; ct->h_l_out = otmp[2];
+    ct->t_h_in = otmp[3]; ct->h_h_in = otmp[4]; ct->q_h_in = otmp[5];
 
     ct->t_l_out /= ct->q_l_out;
     ct->h_l_out /= ct->q_l_out;
@@ -1257,8 +1351,12 @@ cs_ctwr_init_flow_vars(cs_real_t  liq_mass_flow[])
     BFT_REALLOC(ct->outlet_faces_ids, ct->n_outlet_faces, cs_lnum_t);
     BFT_REALLOC(ct->outlet_cells_ids, ct->n_outlet_cells, cs_lnum_t);
 
-    cs_parall_sum(1, CS_DOUBLE, &(ct->surface_in));
-    cs_parall_sum(1, CS_DOUBLE, &(ct->surface_out));
+    double stmp[2] = {ct->surface_in, ct->surface_out};
+    cs_parall_sum(2, CS_DOUBLE, stmp);
+    ct->surface_in = stmp[0]; ct->surface_out = stmp[1];
+
+    /* Ranks concerned by the zone are now known */
+    _zone_comm_build(ct);
   }
 
   BFT_FREE(packing_cell);
@@ -1637,10 +1735,11 @@ cs_ctwr_phyvar_update(cs_real_t  rho0,
       }
     }
 
-    /* Update Inlet packing zone temperature if imposed */
-    if (ct->delta_t > 0) {
+    /* Update Inlet packing zone temperature if imposed;
+       only ranks concerned by the zone need (and compute) it */
+    if (ct->delta_t > 0 && _zone_is_local(ct)) {
       /* Recompute outgoing temperature */
-      ct->t_l_out = 0.0;
+      cs_real_t stmp[2] = {0., 0.};
 
       /* Compute liquid water quantities
        * And humid air quantities at liquid outlet */
@@ -1661,15 +1760,14 @@ cs_ctwr_phyvar_update(cs_real_t  rho0,
 
         /* h_l is in fact (y_l. h_l),
          * and the transport field is (y_l*liq_mass_flow) */
-        ct->t_l_out += sign * t_l[cell_id_l]
+        stmp[0] += sign * t_l[cell_id_l]
           * y_l[cell_id_l] * liq_mass_flow[face_id];
-        ct->q_l_out += sign * y_l[cell_id_l] * liq_mass_flow[face_id];
+        stmp[1] += sign * y_l[cell_id_l] * liq_mass_flow[face_id];
       }
 
-      cs_parall_sum(1, CS_DOUBLE, &(ct->t_l_out));
-      cs_parall_sum(1, CS_DOUBLE, &(ct->q_l_out));
+      _zone_parall_sum(ct, 2, stmp);
 
-      ct->t_l_out /= ct->q_l_out;
+      ct->t_l_out = stmp[0] / stmp[1];
 
       /* Relaxation of ct->t_l_bc */
       ct->t_l_bc = (1. - ct->relax) * ct->t_l_bc
@@ -54,6 +54,7 @@
 #include "cs_math.h"
 #include "cs_mesh_quantities.h"
 #include "cs_mesh_location.h"
+#include "cs_multigrid.h"
 #include "cs_time_step.h"
 #include "cs_parameters.h"
 #include "cs_field_pointer.h"
@@ -66,6 +67,10 @@
 #include "cs_gui_specific_physics.h"
 #include "cs_gui_util.h"
 #include "cs_post.h"
+#include "cs_sles.h"
+#include "cs_sles_default.h"
+#include "cs_sles_it.h"
+#include "cs_sles_pc.h"
 #include "cs_prototypes.h"
 
 /*----------------------------------------------------------------------------
@@ -241,7 +246,8 @@ static cs_elec_option_t  _elec_option = {.ixkabe = -1,
                                          .puisim = 0.,
                                          .coejou = 0.,
                                          .elcou = 0.,
-                                         .srrom = 0.};
+                                         .srrom = 0.,
+                                         .mg_setup_reuse = 0};
 
 static cs_data_elec_t  _elec_properties = {.ngaz = 0,
                                            .npoint = 0,
@@ -459,6 +465,45 @@ _field_pointer_properties_map_electric_arcs(void)
                        cs_field_by_name_try("electric_field"));
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute global min and max of a potential gradient and of the
+ *        associated current density in a single pass.
+ *
+ * \param[in]   n_cells  number of cells
+ * \param[in]   sig      electrical conductivity
+ * \param[in]   grad     potential gradient
+ * \param[out]  vrmin    minimum of gradient (0-2) and current (3-5)
+ * \param[out]  vrmax    maximum of gradient (0-2) and current (3-5)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_grad_current_min_max(cs_lnum_t          n_cells,
+                      const cs_real_t    sig[],
+                      const cs_real_3_t  grad[],
+                      double             vrmin[6],
+                      double             vrmax[6])
+{
+  for (int i = 0; i < 6; i++) {
+    vrmin[i] = HUGE_VAL;
+    vrmax[i] = -HUGE_VAL;
+  }
+
+  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+    for (int i = 0; i < 3; i++) {
+      double c = -sig[iel] * grad[iel][i];
+      vrmin[i] = CS_MIN(vrmin[i], grad[iel][i]);
+      vrmax[i] = CS_MAX(vrmax[i], grad[iel][i]);
+      vrmin[3+i] = CS_MIN(vrmin[3+i], c);
+      vrmax[3+i] = CS_MAX(vrmax[3+i], c);
+    }
+  }
+
+  cs_parall_min(6, CS_DOUBLE, vrmin);
+  cs_parall_max(6, CS_DOUBLE, vrmax);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -590,6 +635,7 @@ cs_electrical_model_initialize(void)
   _elec_option.modrec    = 1;    /* standard model */
   _elec_option.idreca    = 3;
   _elec_option.srrom     = 0.;
+  _elec_option.mg_setup_reuse = 0;
 
   for (int i = 0; i < 3; i++)
     _elec_option.crit_reca[i] = 0.;
@@ -642,6 +688,54 @@ cs_electrical_model_finalize(void)
   BFT_FREE(_elec_option.izreca);
 }
 
+/*----------------------------------------------------------------------------
+ * Define default linear solvers for electric potentials
+ *
+ * The potentials are solved at each time step with matrices which vary
+ * only through the electrical conductivity, so the multigrid hierarchy
+ * may be kept over several solves (see mg_setup_reuse option).
+ * Solvers already defined by the user are not modified, and nothing is
+ * done if no electric model is active.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_elec_define_linear_solvers(void)
+{
+  const char *names[] = {"elec_pot_r", "elec_pot_i", "vec_potential"};
+
+  if (   cs_glob_physical_model_flag[CS_JOULE_EFFECT] < 1
+      && cs_glob_physical_model_flag[CS_ELECTRIC_ARCS] < 1)
+    return;
+
+  if (_elec_option.mg_setup_reuse < 1)
+    return;
+
+  for (int i = 0; i < 3; i++) {
+
+    const cs_field_t *f = cs_field_by_name_try(names[i]);
+    if (f == NULL)
+      continue;
+    if (cs_sles_find(f->id, NULL) != NULL)
+      continue;
+
+    cs_sles_it_t *c = cs_sles_it_define(f->id,
+                                        NULL,
+                                        CS_SLES_FCG,
+                                        -1,      /* poly_degree */
+                                        10000);  /* n_max_iter */
+
+    cs_sles_pc_t *pc = cs_multigrid_pc_create(CS_MULTIGRID_V_CYCLE);
+
+    cs_multigrid_t *mg = cs_sles_pc_get_context(pc);
+    cs_multigrid_set_setup_reuse(mg, _elec_option.mg_setup_reuse, 1.5);
+
+    cs_sles_it_transfer_pc(c, &pc);
+
+    cs_sles_set_error_handler(cs_sles_find(f->id, NULL),
+                              cs_sles_default_error);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Specific initialization for electric arc
  *----------------------------------------------------------------------------*/
@@ -1380,34 +1474,29 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
                              true, /* recompute_cocg */
                              grad);
 
-    /* compute electric field E = - grad (potR) */
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-      cpro_elefl[iel][0] = grad[iel][0];
-      cpro_elefl[iel][1] = grad[iel][1];
-      cpro_elefl[iel][2] = grad[iel][2];
-    }
+    /* compute electric field E = - grad (potR), current density
+       j = sig E and Joule effect j . E in a single pass */
 
-    /* compute current density j = sig E */
     int diff_id = cs_field_get_key_int(CS_F_(potr), keysca);
     cs_field_t *c_prop = NULL;
     if (diff_id > -1)
       c_prop = cs_field_by_id(diff_id);
 
-    if (ieljou > 0 || ielarc > 0) {
-      cs_real_3_t *cpro_curre = (cs_real_3_t *)(CS_F_(curre)->val);
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-        cpro_curre[iel][0] = -c_prop->val[iel] * grad[iel][0];
-        cpro_curre[iel][1] = -c_prop->val[iel] * grad[iel][1];
-        cpro_curre[iel][2] = -c_prop->val[iel] * grad[iel][2];
-      }
-    }
+    const cs_real_t *sig = c_prop->val;
+    cs_real_t *cpro_joulp = CS_F_(joulp)->val;
+    cs_real_3_t *cpro_curre = NULL;
+    if (ieljou > 0 || ielarc > 0)
+      cpro_curre = (cs_real_3_t *)(CS_F_(curre)->val);
 
-    /* compute joule effect : j . E */
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-      CS_F_(joulp)->val[iel] =  c_prop->val[iel] *
-                               (grad[iel][0] * grad[iel][0] +
-                                grad[iel][1] * grad[iel][1] +
-                                grad[iel][2] * grad[iel][2]);
+      for (int i = 0; i < 3; i++)
+        cpro_elefl[iel][i] = grad[iel][i];
+      if (cpro_curre != NULL) {
+        for (int i = 0; i < 3; i++)
+          cpro_curre[iel][i] = -sig[iel] * grad[iel][i];
+      }
+      cpro_joulp[iel] = sig[iel] * cs_math_3_square_norm(grad[iel]);
     }
 
     /* compute min max for E and J */
@@ -1416,23 +1505,10 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
                  "   Variable         Minimum       Maximum\n"
                  "-----------------------------------------\n");
 
-      /* Grad PotR = -E */
-      double vrmin[3], vrmax[3];
-
-      for (int i = 0; i < 3; i++) {
-        vrmin[i] = HUGE_VAL;
-        vrmax[i] = -HUGE_VAL;
-      }
-
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-        for (int i = 0; i < 3; i++) {
-          vrmin[i] = CS_MIN(vrmin[i], grad[iel][i]);
-          vrmax[i] = CS_MAX(vrmax[i], grad[iel][i]);
-        }
-      }
+      /* Grad PotR = -E and current real, in a single pass */
+      double vrmin[6], vrmax[6];
 
-      cs_parall_min(3, CS_DOUBLE, vrmin);
-      cs_parall_max(3, CS_DOUBLE, vrmax);
+      _grad_current_min_max(n_cells, sig, grad, vrmin, vrmax);
 
       for (int i = 0; i < 3; i++) {
         bft_printf("v  Gr_PotR%s    %12.5e  %12.5e\n",
@@ -1440,26 +1516,10 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
                    vrmin[i], vrmax[i]);
       }
 
-      /* current real */
-      for (int i = 0; i < 3; i++) {
-        vrmin[i] = HUGE_VAL;
-        vrmax[i] = -HUGE_VAL;
-      }
-
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-        for (int i = 0; i < 3; i++) {
-          vrmin[i] = CS_MIN(vrmin[i], -c_prop->val[iel] * grad[iel][i]);
-          vrmax[i] = CS_MAX(vrmax[i], -c_prop->val[iel] * grad[iel][i]);
-        }
-      }
-
-      cs_parall_min(3, CS_DOUBLE, vrmin);
-      cs_parall_max(3, CS_DOUBLE, vrmax);
-
       for (int i = 0; i < 3; i++) {
         bft_printf("v  Cour_Re%s    %12.5E  %12.5E\n",
                    cs_glob_field_comp_name_3[i],
-                   vrmin[i], vrmax[i]);
+                   vrmin[3+i], vrmax[3+i]);
       }
       bft_printf("-----------------------------------------\n");
     }
@@ -1473,50 +1533,35 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
                                true, /* recompute_cocg */
                                grad);
 
-      /* compute electric field E = - grad (potI) */
+      /* compute electric field E = - grad (potI),
+         current density j = sig E and Joule effect j . E */
 
-      /* compute current density j = sig E */
       int diff_id_i = cs_field_get_key_int(CS_F_(poti), keysca);
       cs_field_t *c_propi = NULL;
       if (diff_id_i > -1)
         c_propi = cs_field_by_id(diff_id_i);
 
-      if (ieljou == 4) {
-        cs_real_3_t *cpro_curim = (cs_real_3_t *)(CS_F_(curim)->val);
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-          cpro_curim[iel][0] = -c_propi->val[iel] * grad[iel][0];
-          cpro_curim[iel][1] = -c_propi->val[iel] * grad[iel][1];
-          cpro_curim[iel][2] = -c_propi->val[iel] * grad[iel][2];
-        }
-      }
+      const cs_real_t *sigi = c_propi->val;
+      cs_real_3_t *cpro_curim = NULL;
+      if (ieljou == 4)
+        cpro_curim = (cs_real_3_t *)(CS_F_(curim)->val);
 
-      /* compute joule effect : j . E */
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-        CS_F_(joulp)->val[iel] +=   c_propi->val[iel]
-                                  * cs_math_3_square_norm(grad[iel]);
+        if (cpro_curim != NULL) {
+          for (int i = 0; i < 3; i++)
+            cpro_curim[iel][i] = -sigi[iel] * grad[iel][i];
+        }
+        cpro_joulp[iel] += sigi[iel] * cs_math_3_square_norm(grad[iel]);
       }
 
       /* compute min max for E and J */
       if (log_active) {
 
-        double vrmin[3], vrmax[3];
+        /* Grad PotI = -Ei and imaginary current */
+        double vrmin[6], vrmax[6];
 
-        /* Grad PotR = -Ei */
-
-        for (int i = 0; i < 3; i++) {
-          vrmin[i] = HUGE_VAL;
-          vrmax[i] = -HUGE_VAL;
-        }
-
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-          for (int i = 0; i < 3; i++) {
-            vrmin[i] = CS_MIN(vrmin[i], grad[iel][0]);
-            vrmax[i] = CS_MAX(vrmax[i], grad[iel][0]);
-          }
-        }
-
-        cs_parall_min(3, CS_DOUBLE, vrmin);
-        cs_parall_max(3, CS_DOUBLE, vrmax);
+        _grad_current_min_max(n_cells, sigi, grad, vrmin, vrmax);
 
         for (int i = 0; i < 3; i++) {
           bft_printf("v  Gr_PotI%s    %12.5E  %12.5E\n",
@@ -1524,27 +1569,10 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
                      vrmin[i], vrmax[i]);
         }
 
-        /* Imaginary current */
-
-        for (int i = 0; i < 3; i++) {
-          vrmin[i] = HUGE_VAL;
-          vrmax[i] = -HUGE_VAL;
-        }
-
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-          for (int i = 0; i < 3; i++) {
-            vrmin[i] = CS_MIN(vrmin[i], -c_propi->val[iel] * grad[iel][i]);
-            vrmax[i] = CS_MAX(vrmax[i], -c_propi->val[iel] * grad[iel][i]);
-          }
-        }
-
-        cs_parall_min(3, CS_DOUBLE, vrmin);
-        cs_parall_max(3, CS_DOUBLE, vrmax);
-
         for (int i = 0; i < 3; i++) {
           bft_printf("v  Cour_Im%s    %12.5E  %12.5E\n",
                      cs_glob_field_comp_name_3[i],
-                     vrmin[i], vrmax[i]);
+                     vrmin[3+i], vrmax[3+i]);
         }
       }
     }
@@ -1557,9 +1585,12 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
   else if (call_id == 2) {
 
     cs_real_3_t *cpro_magfl = (cs_real_3_t *)(CS_F_(magfl)->val);
+    cs_real_3_t *cpro_laplf = (cs_real_3_t *)(CS_F_(laplf)->val);
+    const cs_real_3_t *cpro_curre = (const cs_real_3_t *)(CS_F_(curre)->val);
 
     if (ielarc == 2) {
-      /* compute magnetic field component B */
+      /* compute magnetic field component B and laplace effect j x B
+         in a single pass */
       cs_field_t  *fp = cs_field_by_name_try("vec_potential");
 
       cs_real_33_t *gradv = NULL;
@@ -1570,28 +1601,29 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
                                1,    /* inc */
                                gradv);
 
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
         cpro_magfl[iel][0] = -gradv[iel][1][2]+gradv[iel][2][1];
         cpro_magfl[iel][1] =  gradv[iel][0][2]-gradv[iel][2][0];
         cpro_magfl[iel][2] = -gradv[iel][0][1]+gradv[iel][1][0];
+        cs_math_3_cross_product(cpro_curre[iel],
+                                cpro_magfl[iel],
+                                cpro_laplf[iel]);
       }
 
       BFT_FREE(gradv);
     }
-    else if (ielarc == 1)
-      bft_error(__FILE__, __LINE__, 0,
-                _("Error electric arc with ampere theorem not available\n"));
+    else {
+      if (ielarc == 1)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Error electric arc with ampere theorem not available\n"));
 
-    /* compute laplace effect j x B */
-    cs_real_3_t *cpro_laplf = (cs_real_3_t *)(CS_F_(laplf)->val);
-    cs_real_3_t *cpro_curre = (cs_real_3_t *)(CS_F_(curre)->val);
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-      cpro_laplf[iel][0] =    cpro_curre[iel][1] * cpro_magfl[iel][2]
-                            - cpro_curre[iel][2] * cpro_magfl[iel][1];
-      cpro_laplf[iel][1] =    cpro_curre[iel][2] * cpro_magfl[iel][0]
-                            - cpro_curre[iel][0] * cpro_magfl[iel][2];
-      cpro_laplf[iel][2] =    cpro_curre[iel][0] * cpro_magfl[iel][1]
-                            - cpro_curre[iel][1] * cpro_magfl[iel][0];
+      /* compute laplace effect j x B */
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
+      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+        cs_math_3_cross_product(cpro_curre[iel],
+                                cpro_magfl[iel],
+                                cpro_laplf[iel]);
     }
 
     /* compute min max for B */
@@ -109,6 +109,7 @@ typedef struct {
   cs_real_t   coejou;
   cs_real_t   elcou;
   cs_real_t   srrom;
+  int         mg_setup_reuse;
 } cs_elec_option_t;
 
 /*============================================================================
@@ -194,6 +195,16 @@ cs_electrical_model_initialize(void);
 void
 cs_electrical_model_finalize(void);
 
+/*----------------------------------------------------------------------------
+ * Define default linear solvers for electric potentials
+ *
+ * Solvers already defined by the user are not modified, and nothing is
+ * done if no electric model is active.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_elec_define_linear_solvers(void);
+
 /*----------------------------------------------------------------------------
  * Specific initialization for electric arc
  *----------------------------------------------------------------------------*/
@@ -76,6 +76,21 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Block distributions whose maximum local size exceeds this factor times
+   the mean size (and the minimum size below) are considered imbalanced,
+   in which case sample-based splitting is used instead */
+
+#define _BLOCK_IMBALANCE_FACTOR  2.0
+#define _BLOCK_IMBALANCE_MIN     16384
+
+/* Maximum number of samples per rank for sample-based splitting */
+
+#define _SAMPLE_MAX  128
+
 /*============================================================================
  * Local structure definitions
  *============================================================================*/
@@ -632,6 +647,216 @@ _fvm_io_num_global_max_unordered(const fvm_io_num_t  *const this_io_num,
   return global_max;
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a block distribution is imbalanced.
+ *
+ * Global numbers of selected entities are often clustered (for example
+ * vertices of a boundary subset), so that distribution to blocks based on
+ * their value may assign most entities to a few ranks.
+ *
+ * parameters:
+ *   n_elts_dest <-- number of elements received on this rank
+ *   comm        <-- associated MPI communicator
+ *
+ * returns:
+ *   true if the distribution is imbalanced on any rank, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_block_is_imbalanced(cs_lnum_t  n_elts_dest,
+                     MPI_Comm   comm)
+{
+  int n_ranks = 1;
+  MPI_Comm_size(comm, &n_ranks);
+
+  cs_gnum_t n_loc = n_elts_dest, n_max = 0, n_sum = 0;
+
+  MPI_Allreduce(&n_loc, &n_max, 1, CS_MPI_GNUM, MPI_MAX, comm);
+  MPI_Allreduce(&n_loc, &n_sum, 1, CS_MPI_GNUM, MPI_SUM, comm);
+
+  bool retval = false;
+
+  if (   n_max > _BLOCK_IMBALANCE_MIN
+      && n_max > _BLOCK_IMBALANCE_FACTOR * ((double)n_sum / n_ranks))
+    retval = true;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Lexicographical comparison of two strided global number tuples.
+ *
+ * parameters:
+ *   stride <-- number of values per tuple
+ *   a      <-- first tuple
+ *   b      <-- second tuple
+ *
+ * returns:
+ *   -1 if a < b, 0 if a == b, 1 if a > b
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_tuple_compare(size_t           stride,
+               const cs_gnum_t  a[],
+               const cs_gnum_t  b[])
+{
+  for (size_t k = 0; k < stride; k++) {
+    if (a[k] < b[k])
+      return -1;
+    else if (a[k] > b[k])
+      return 1;
+  }
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Determine destination ranks for strided global number tuples using
+ * sample-based splitting.
+ *
+ * Each rank provides regularly spaced samples from its locally ordered
+ * tuples, weighted by its local number of tuples; splitters are chosen
+ * from the ordered samples so that each rank receives a similar number
+ * of tuples. Rank r receives tuples in ]splitter[r-1], splitter[r]], so
+ * identical tuples are sent to the same rank, and tuples on successive
+ * ranks are ordered lexicographically, as with a block distribution.
+ *
+ * parameters:
+ *   stride     <-- values per entity
+ *   n_ent      <-- local number of entities
+ *   global_num <-- global number tuples
+ *   dest_rank  --> destination rank for each entity
+ *   comm       <-- associated MPI communicator
+ *----------------------------------------------------------------------------*/
+
+static void
+_sample_dest_rank_s(size_t           stride,
+                    cs_lnum_t        n_ent,
+                    const cs_gnum_t  global_num[],
+                    int              dest_rank[],
+                    MPI_Comm         comm)
+{
+  int n_ranks = 1;
+  MPI_Comm_size(comm, &n_ranks);
+
+  /* Local ordering and selection of weighted samples */
+
+  int n_samples = CS_MIN(n_ranks - 1, _SAMPLE_MAX);
+  if (n_samples > n_ent)
+    n_samples = n_ent;
+
+  cs_gnum_t *l_samples;
+  double *l_weights;
+  BFT_MALLOC(l_samples, n_samples*stride + 1, cs_gnum_t);
+  BFT_MALLOC(l_weights, n_samples + 1, double);
+
+  if (n_samples > 0) {
+
+    cs_lnum_t *order;
+    BFT_MALLOC(order, n_ent, cs_lnum_t);
+
+    cs_order_gnum_allocated_s(NULL, global_num, stride, order, n_ent);
+
+    for (int i = 0; i < n_samples; i++) {
+      cs_lnum_t j = order[((cs_gnum_t)n_ent * (i+1)) / (n_samples+1)];
+      for (size_t k = 0; k < stride; k++)
+        l_samples[i*stride + k] = global_num[j*stride + k];
+      l_weights[i] = (double)n_ent / n_samples;
+    }
+
+    BFT_FREE(order);
+
+  }
+
+  /* Gather samples (identical on all ranks) */
+
+  int *recv_count, *recv_displ;
+  BFT_MALLOC(recv_count, n_ranks, int);
+  BFT_MALLOC(recv_displ, n_ranks, int);
+
+  MPI_Allgather(&n_samples, 1, MPI_INT, recv_count, 1, MPI_INT, comm);
+
+  int n_g_samples = 0;
+  for (int i = 0; i < n_ranks; i++) {
+    recv_displ[i] = n_g_samples;
+    n_g_samples += recv_count[i];
+  }
+
+  double *g_weights;
+  cs_gnum_t *g_samples;
+  BFT_MALLOC(g_weights, n_g_samples + 1, double);
+  BFT_MALLOC(g_samples, n_g_samples*stride + 1, cs_gnum_t);
+
+  MPI_Allgatherv(l_weights, n_samples, MPI_DOUBLE,
+                 g_weights, recv_count, recv_displ, MPI_DOUBLE, comm);
+
+  for (int i = 0; i < n_ranks; i++) {
+    recv_count[i] *= stride;
+    recv_displ[i] *= stride;
+  }
+
+  MPI_Allgatherv(l_samples, n_samples*stride, CS_MPI_GNUM,
+                 g_samples, recv_count, recv_displ, CS_MPI_GNUM, comm);
+
+  BFT_FREE(recv_displ);
+  BFT_FREE(recv_count);
+  BFT_FREE(l_weights);
+  BFT_FREE(l_samples);
+
+  /* Choose splitters (as sample ids) */
+
+  cs_lnum_t *s_order;
+  int *splitter;
+  BFT_MALLOC(s_order, n_g_samples + 1, cs_lnum_t);
+  BFT_MALLOC(splitter, n_ranks, int);
+
+  cs_order_gnum_allocated_s(NULL, g_samples, stride, s_order, n_g_samples);
+
+  {
+    double w_tot = 0, w_sum = 0;
+    for (int i = 0; i < n_g_samples; i++)
+      w_tot += g_weights[i];
+
+    int s_id = 0;
+    for (int r = 0; r < n_ranks - 1; r++) {
+      double w_target = w_tot * (r+1) / n_ranks;
+      while (s_id < n_g_samples - 1 && w_sum < w_target) {
+        w_sum += g_weights[s_order[s_id]];
+        s_id++;
+      }
+      splitter[r] = (n_g_samples > 0) ? s_order[s_id] : -1;
+    }
+  }
+
+  BFT_FREE(s_order);
+  BFT_FREE(g_weights);
+
+  /* Destination rank is that of the first splitter >= tuple */
+
+  if (n_g_samples == 0) {
+    for (cs_lnum_t i = 0; i < n_ent; i++)
+      dest_rank[i] = 0;
+  }
+  else {
+#   pragma omp parallel for if (n_ent > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_ent; i++) {
+      int l = 0, h = n_ranks - 1;
+      while (l < h) {
+        int m = (l + h) / 2;
+        if (_tuple_compare(stride,
+                           g_samples + splitter[m]*stride,
+                           global_num + i*stride) < 0)
+          l = m + 1;
+        else
+          h = m;
+      }
+      dest_rank[i] = l;
+    }
+  }
+
+  BFT_FREE(splitter);
+  BFT_FREE(g_samples);
+}
+
 /*----------------------------------------------------------------------------
  * Global ordering associated with an I/O numbering structure.
  *
@@ -699,13 +924,6 @@ _fvm_io_num_global_order(fvm_io_num_t       *this_io_num,
                                          bi,
                                          comm);
 
-  cs_gnum_t *b_gnum = cs_all_to_all_copy_array(d,
-                                               CS_GNUM_TYPE,
-                                               1,
-                                               false, /* reverse */
-                                               this_io_num->global_num,
-                                               NULL);
-
   cs_lnum_t b_size = cs_all_to_all_n_elts_dest(d);
 
   /* Do we have sub-entities ? */
@@ -715,6 +933,34 @@ _fvm_io_num_global_order(fvm_io_num_t       *this_io_num,
 
   MPI_Allreduce(&have_sub_loc, &have_sub_glob, 1, MPI_INT, MPI_MAX, comm);
 
+  /* If blocks are imbalanced (clustered numbers) and the numbering
+     is a simple ranking, use a sample sort instead; this leads to
+     the same result, with a balanced work distribution */
+
+  if (   have_sub_glob == 0
+      && this_io_num->_global_num != NULL
+      && _block_is_imbalanced(b_size, comm)) {
+
+    cs_all_to_all_destroy(&d);
+
+    this_io_num->global_count
+      = cs_order_gnum_sample_sort(this_io_num->global_num_size,
+                                  this_io_num->global_num,
+                                  this_io_num->_global_num,
+                                  comm);
+
+    _fvm_io_num_order_finalize(this_io_num, NULL, may_be_shared);
+
+    return;
+  }
+
+  cs_gnum_t *b_gnum = cs_all_to_all_copy_array(d,
+                                               CS_GNUM_TYPE,
+                                               1,
+                                               false, /* reverse */
+                                               this_io_num->global_num,
+                                               NULL);
+
   if (have_sub_glob > 0)
     b_nsub = cs_all_to_all_copy_array(d,
                                       CS_LNUM_TYPE,
@@ -889,6 +1135,28 @@ _fvm_io_num_global_order_s(fvm_io_num_t       *this_io_num,
                               dest_rank,
                               comm);
 
+  /* Blocks based on the first value of each tuple are often imbalanced
+     (for example edges of a boundary subset); in this case, use
+     sample-based splitting on complete tuples */
+
+  if (_block_is_imbalanced(cs_all_to_all_n_elts_dest(d), comm)) {
+
+    cs_all_to_all_destroy(&d);
+
+    _sample_dest_rank_s(stride,
+                        this_io_num->global_num_size,
+                        global_num,
+                        dest_rank,
+                        comm);
+
+    d = cs_all_to_all_create(this_io_num->global_num_size,
+                             0,      /* flags */
+                             NULL,  /* dest_id */
+                             dest_rank,
+                             comm);
+
+  }
+
   cs_all_to_all_transfer_dest_rank(d, &dest_rank);
 
   cs_gnum_t *b_gnum = cs_all_to_all_copy_array(d,
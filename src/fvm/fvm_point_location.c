@@ -2191,7 +2191,8 @@ _locate_in_cell_3d(cs_lnum_t          elt_num,
   int i, j, k, n_vertices;
   cs_lnum_t coord_idx, vertex_id;
 
-  double uvw[3], dist, shapef[8], max_dist;
+  double uvw[3], dist, max_dist;
+  double shapef[8] = {0., 0., 0., 0., 0., 0., 0., 0.};
   double  _vertex_coords[8][3];
 
   n_vertices = fvm_nodal_n_vertices_element[elt_type];
@@ -3389,6 +3390,230 @@ fvm_point_location_nodal(const fvm_nodal_t  *this_nodal,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Find elements in a given nodal mesh containing points, using a previous
+ * location as a starting guess: updates the location[] and distance[]
+ * arrays associated with a set of points as fvm_point_location_nodal().
+ *
+ * For points with a previous location in a regular (non-polyhedral)
+ * volume element, this element is tested first; a point found inside it
+ * is considered located, and the full search is done only for the
+ * remaining points. This is intended for points moving slowly relative
+ * to the mesh (such as transient probes), for which most points remain
+ * in the same element.
+ *
+ * parameters:
+ *   this_nodal           <-- pointer to nodal mesh representation structure
+ *   tolerance_base       <-- associated base tolerance (used for bounding
+ *                            box check only, not for location test)
+ *   tolerance_multiplier <-- associated fraction of element bounding boxes
+ *                            added to tolerance
+ *   locate_on_parents    <-- location relative to parent element numbers if 1,
+ *                            id of element + 1 in concatenated sections of
+ *                            same element dimension if 0
+ *   n_points             <-- number of points to locate
+ *   point_tag            <-- optional point tag
+ *   point_coords         <-- point coordinates
+ *   prev_location        <-- number of element in which each point was
+ *                            previously located, or < 1 if unknown, using
+ *                            the same numbering as location[]
+ *                            (size: n_points)
+ *   location             <-> number of element containing or closest to each
+ *                            point (size: n_points)
+ *   distance             <-> distance from point to element indicated by
+ *                            location[]: < 0 if unlocated, 0 - 1 if inside,
+ *                            and > 1 if outside a volume element, or absolute
+ *                            distance to a surface element (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_point_location_nodal_update(const fvm_nodal_t  *this_nodal,
+                                float               tolerance_base,
+                                float               tolerance_fraction,
+                                int                 locate_on_parents,
+                                cs_lnum_t           n_points,
+                                const int          *point_tag,
+                                const cs_coord_t    point_coords[],
+                                const cs_lnum_t     prev_location[],
+                                cs_lnum_t           location[],
+                                float               distance[])
+{
+  if (this_nodal == NULL)
+    return;
+
+  const int max_entity_dim = fvm_nodal_get_max_entity_dim(this_nodal);
+
+  /* Only volume elements in 3d are handled by the fast path */
+
+  cs_lnum_t n_prev = 0;
+
+  if (this_nodal->dim == 3 && max_entity_dim == 3 && prev_location != NULL) {
+    for (cs_lnum_t i = 0; i < n_points; i++) {
+      if (prev_location[i] > 0)
+        n_prev++;
+    }
+  }
+
+  if (n_prev == 0) {
+    fvm_point_location_nodal(this_nodal,
+                             tolerance_base,
+                             tolerance_fraction,
+                             locate_on_parents,
+                             n_points,
+                             point_tag,
+                             point_coords,
+                             location,
+                             distance);
+    return;
+  }
+
+  /* Build mapping from element number to section and element id */
+
+  cs_lnum_t max_elt_num = 0, base_element_num = 1;
+
+  for (int s_id = 0; s_id < this_nodal->n_sections; s_id++) {
+    const fvm_nodal_section_t  *this_section = this_nodal->sections[s_id];
+    if (this_section->entity_dim != max_entity_dim)
+      continue;
+    if (locate_on_parents == 1 && this_section->parent_element_num != NULL) {
+      for (cs_lnum_t j = 0; j < this_section->n_elements; j++)
+        max_elt_num = CS_MAX(max_elt_num,
+                             this_section->parent_element_num[j]);
+    }
+    else if (locate_on_parents == 1)
+      max_elt_num = CS_MAX(max_elt_num, this_section->n_elements);
+    else
+      max_elt_num += this_section->n_elements;
+  }
+
+  int *elt_section_id;
+  cs_lnum_t *elt_id;
+  BFT_MALLOC(elt_section_id, max_elt_num + 1, int);
+  BFT_MALLOC(elt_id, max_elt_num + 1, cs_lnum_t);
+
+  for (cs_lnum_t j = 0; j < max_elt_num + 1; j++)
+    elt_section_id[j] = -1;
+
+  for (int s_id = 0; s_id < this_nodal->n_sections; s_id++) {
+    const fvm_nodal_section_t  *this_section = this_nodal->sections[s_id];
+    if (this_section->entity_dim != max_entity_dim)
+      continue;
+    if (this_section->type != FVM_CELL_POLY) {
+      for (cs_lnum_t j = 0; j < this_section->n_elements; j++) {
+        cs_lnum_t elt_num = base_element_num + j;
+        if (locate_on_parents == 1) {
+          if (this_section->parent_element_num != NULL)
+            elt_num = this_section->parent_element_num[j];
+          else
+            elt_num = j + 1;
+        }
+        elt_section_id[elt_num] = s_id;
+        elt_id[elt_num] = j;
+      }
+    }
+    base_element_num += this_section->n_elements;
+  }
+
+  /* Test previous element first */
+
+  cs_lnum_t n_search = 0;
+  cs_lnum_t *search_id;
+  BFT_MALLOC(search_id, n_points, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+
+    cs_lnum_t elt_num = prev_location[i];
+    int s_id = -1;
+
+    if (elt_num > 0 && elt_num <= max_elt_num)
+      s_id = elt_section_id[elt_num];
+
+    if (s_id > -1) {
+
+      const fvm_nodal_section_t  *this_section = this_nodal->sections[s_id];
+      const cs_lnum_t j = elt_id[elt_num];
+
+      bool same_tag = false;
+      if (this_section->tag != NULL && point_tag != NULL)
+        same_tag = (this_section->tag[j] == point_tag[i]);
+
+      if (same_tag == false)
+        _locate_in_cell_3d(elt_num,
+                           this_section->type,
+                           this_section->vertex_num + j*this_section->stride,
+                           this_nodal->parent_vertex_num,
+                           this_nodal->vertex_coords,
+                           point_coords,
+                           1,
+                           &i,
+                           tolerance_fraction,
+                           location,
+                           distance);
+
+      if (   location[i] == elt_num
+          && distance[i] >= 0 && distance[i] <= 1)
+        continue;
+
+    }
+
+    search_id[n_search++] = i;
+
+  }
+
+  BFT_FREE(elt_id);
+  BFT_FREE(elt_section_id);
+
+  /* Full search for remaining points */
+
+  if (n_search > 0) {
+
+    int *_point_tag = NULL;
+    cs_coord_t *_point_coords;
+    cs_lnum_t *_location;
+    float *_distance;
+
+    BFT_MALLOC(_point_coords, n_search*3, cs_coord_t);
+    BFT_MALLOC(_location, n_search, cs_lnum_t);
+    BFT_MALLOC(_distance, n_search, float);
+    if (point_tag != NULL)
+      BFT_MALLOC(_point_tag, n_search, int);
+
+    for (cs_lnum_t k = 0; k < n_search; k++) {
+      cs_lnum_t i = search_id[k];
+      for (int l = 0; l < 3; l++)
+        _point_coords[k*3 + l] = point_coords[i*3 + l];
+      _location[k] = location[i];
+      _distance[k] = distance[i];
+      if (point_tag != NULL)
+        _point_tag[k] = point_tag[i];
+    }
+
+    fvm_point_location_nodal(this_nodal,
+                             tolerance_base,
+                             tolerance_fraction,
+                             locate_on_parents,
+                             n_search,
+                             _point_tag,
+                             _point_coords,
+                             _location,
+                             _distance);
+
+    for (cs_lnum_t k = 0; k < n_search; k++) {
+      cs_lnum_t i = search_id[k];
+      location[i] = _location[k];
+      distance[i] = _distance[k];
+    }
+
+    BFT_FREE(_point_tag);
+    BFT_FREE(_distance);
+    BFT_FREE(_location);
+    BFT_FREE(_point_coords);
+
+  }
+
+  BFT_FREE(search_id);
+}
+
 /*----------------------------------------------------------------------------
  * For each point previously located in a element, find among vertices of this
  * element the closest vertex relative to this point.
@@ -93,6 +93,54 @@ fvm_point_location_nodal(const fvm_nodal_t  *this_nodal,
                          cs_lnum_t           location[],
                          float               distance[]);
 
+/*----------------------------------------------------------------------------
+ * Find elements in a given nodal mesh containing points, using a previous
+ * location as a starting guess: updates the location[] and distance[]
+ * arrays associated with a set of points as fvm_point_location_nodal().
+ *
+ * For points with a previous location in a regular (non-polyhedral)
+ * volume element, this element is tested first; a point found inside it
+ * is considered located, and the full search is done only for the
+ * remaining points. This is intended for points moving slowly relative
+ * to the mesh (such as transient probes), for which most points remain
+ * in the same element.
+ *
+ * parameters:
+ *   this_nodal           <-- pointer to nodal mesh representation structure
+ *   tolerance_base       <-- associated base tolerance (used for bounding
+ *                            box check only, not for location test)
+ *   tolerance_multiplier <-- associated fraction of element bounding boxes
+ *                            added to tolerance
+ *   locate_on_parents    <-- location relative to parent element numbers if 1,
+ *                            id of element + 1 in concatenated sections of
+ *                            same element dimension if 0
+ *   n_points             <-- number of points to locate
+ *   point_tag            <-- optional point tag
+ *   point_coords         <-- point coordinates
+ *   prev_location        <-- number of element in which each point was
+ *                            previously located, or < 1 if unknown, using
+ *                            the same numbering as location[]
+ *                            (size: n_points)
+ *   location             <-> number of element containing or closest to each
+ *                            point (size: n_points)
+ *   distance             <-> distance from point to element indicated by
+ *                            location[]: < 0 if unlocated, 0 - 1 if inside,
+ *                            and > 1 if outside a volume element, or absolute
+ *                            distance to a surface element (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_point_location_nodal_update(const fvm_nodal_t  *this_nodal,
+                                float               tolerance_base,
+                                float               tolerance_fraction,
+                                int                 locate_on_parents,
+                                cs_lnum_t           n_points,
+                                const int          *point_tag,
+                                const cs_coord_t    point_coords[],
+                                const cs_lnum_t     prev_location[],
+                                cs_lnum_t           location[],
+                                float               distance[]);
+
 /*----------------------------------------------------------------------------
  * For each point previously located in a element, find among vertices of this
  * element the closest vertex relative to this point.
@@ -44,6 +44,7 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "cs_map.h"
 #include "cs_timer.h"
 
 #include "fvm_defs.h"
@@ -86,6 +87,9 @@ typedef struct {
 
   fvm_selector_postfix_t **postfix;    /* Array of postfix operations */
 
+  cs_map_name_to_id_t     *criteria;   /* Map from criteria strings to
+                                          operation ids */
+
   size_t *n_calls;                     /* Number of calls per operation */
 
   int    *n_group_classes;             /* Array of group class numbers
@@ -125,6 +129,17 @@ struct _fvm_selector_t {
   int              **attribute_ids;            /* Id of attributes per class in
                                                   attribute */
 
+  int               *_group_gc_idx;            /* Index of group classes
+                                                  per group (with extra
+                                                  entry for classes with no
+                                                  group or attribute),
+                                                  or NULL */
+  int               *_group_gc_ids;            /* Group classes per group */
+  int               *_attribute_gc_idx;        /* Index of group classes
+                                                  per attribute, or NULL */
+  int               *_attribute_gc_ids;        /* Group classes per
+                                                  attribute */
+
   const double      *coords;                   /* Element coordinates
                                                   (i.e. centers), interlaced */
   double            *_coords;                  /* private coords, or NULL */
@@ -502,6 +517,8 @@ _operation_list_allocate(void)
              ops->n_max_operations,
              fvm_selector_postfix_t *);
 
+  ops->criteria = cs_map_name_to_id_create();
+
   BFT_MALLOC(ops->n_calls, ops->n_max_operations, size_t);
 
   BFT_MALLOC(ops->n_group_classes, ops->n_max_operations, int);
@@ -580,6 +597,7 @@ _operation_list_free(_operation_list_t  *ops)
         fvm_selector_postfix_destroy(ops->postfix + i);
     }
     BFT_FREE(ops->postfix);
+    cs_map_name_to_id_destroy(&(ops->criteria));
     BFT_FREE(ops->group_class_set);
     BFT_FREE(ops);
   }
@@ -587,20 +605,95 @@ _operation_list_free(_operation_list_t  *ops)
   return NULL;
 }
 
+/*----------------------------------------------------------------------------
+ * Build index of group classes containing each group or attribute.
+ *
+ * An additional entry is added to the groups index, for group classes
+ * containing no group or attribute.
+ *
+ * parameters:
+ *   this_selector <-> selector structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_group_class_index(fvm_selector_t  *this_selector)
+{
+  fvm_selector_t *ts = this_selector;
+
+  const int n_groups = ts->n_groups;
+  const int n_attributes = ts->n_attributes;
+
+  BFT_MALLOC(ts->_group_gc_idx, n_groups + 2, int);
+  BFT_MALLOC(ts->_attribute_gc_idx, n_attributes + 1, int);
+
+  int *g_idx = ts->_group_gc_idx;
+  int *a_idx = ts->_attribute_gc_idx;
+
+  for (int i = 0; i < n_groups + 2; i++)
+    g_idx[i] = 0;
+  for (int i = 0; i < n_attributes + 1; i++)
+    a_idx[i] = 0;
+
+  /* Counting pass */
+
+  for (int gc_id = 0; gc_id < ts->n_group_classes; gc_id++) {
+    for (int j = 0; j < ts->n_class_groups[gc_id]; j++)
+      g_idx[ts->group_ids[gc_id][j] + 1] += 1;
+    for (int j = 0; j < ts->n_class_attributes[gc_id]; j++)
+      a_idx[ts->attribute_ids[gc_id][j] + 1] += 1;
+    if (ts->n_class_groups[gc_id] == 0 && ts->n_class_attributes[gc_id] == 0)
+      g_idx[n_groups + 1] += 1;
+  }
+
+  for (int i = 0; i < n_groups + 1; i++)
+    g_idx[i+1] += g_idx[i];
+  for (int i = 0; i < n_attributes; i++)
+    a_idx[i+1] += a_idx[i];
+
+  BFT_MALLOC(ts->_group_gc_ids, g_idx[n_groups + 1], int);
+  BFT_MALLOC(ts->_attribute_gc_ids, a_idx[n_attributes], int);
+
+  /* Definition pass (group classes are added in increasing order) */
+
+  for (int gc_id = 0; gc_id < ts->n_group_classes; gc_id++) {
+    for (int j = 0; j < ts->n_class_groups[gc_id]; j++) {
+      int g_id = ts->group_ids[gc_id][j];
+      ts->_group_gc_ids[g_idx[g_id]++] = gc_id;
+    }
+    for (int j = 0; j < ts->n_class_attributes[gc_id]; j++) {
+      int a_id = ts->attribute_ids[gc_id][j];
+      ts->_attribute_gc_ids[a_idx[a_id]++] = gc_id;
+    }
+    if (ts->n_class_groups[gc_id] == 0 && ts->n_class_attributes[gc_id] == 0)
+      ts->_group_gc_ids[g_idx[n_groups]++] = gc_id;
+  }
+
+  /* Shift index back */
+
+  for (int i = n_groups; i > 0; i--)
+    g_idx[i] = g_idx[i-1];
+  g_idx[0] = 0;
+  for (int i = n_attributes; i > 0; i--)
+    a_idx[i] = a_idx[i-1];
+  a_idx[0] = 0;
+}
+
 /*----------------------------------------------------------------------------
  * Interpret the postfix string for the last operation of operations list to
  * build the group class list which corresponds to this operation.
  *
+ * The postfix expression is evaluated for all group classes at once,
+ * using bit masks.
+ *
  * parameters:
- *   this_selector <-- selector structure
+ *   this_selector <-> selector structure
  *   operations    <-> operations list to be updated
  *----------------------------------------------------------------------------*/
 
 static void
-_create_operation_group_class_set(const fvm_selector_t  *this_selector,
-                                  _operation_list_t     *operations)
+_create_operation_group_class_set(fvm_selector_t     *this_selector,
+                                  _operation_list_t  *operations)
 {
-  int gc_id;
   int *group_class_set;
 
   int n_group_classes = 0;
@@ -608,32 +701,55 @@ _create_operation_group_class_set(const fvm_selector_t  *this_selector,
   const fvm_selector_postfix_t  *pf
     = operations->postfix[operations->n_operations -1];
 
+  if (this_selector->_group_gc_idx == NULL)
+    _build_group_class_index(this_selector);
+
+  const int n_gcs = this_selector->n_group_classes;
+  const int n_words = (n_gcs + 63) / 64;
+
+  uint64_t *gc_mask;
+  BFT_MALLOC(gc_mask, n_words, uint64_t);
+
+  fvm_selector_postfix_eval_masks(pf,
+                                  this_selector->n_groups,
+                                  this_selector->n_attributes,
+                                  n_gcs,
+                                  this_selector->_group_gc_idx,
+                                  this_selector->_group_gc_ids,
+                                  this_selector->_attribute_gc_idx,
+                                  this_selector->_attribute_gc_ids,
+                                  gc_mask);
+
+  for (int i = 0; i < n_words; i++) {
+    uint64_t w = gc_mask[i];
+    if (i == n_words - 1 && n_gcs % 64)
+      w &= ((uint64_t)1 << (n_gcs % 64)) - 1;
+    while (w) {
+      w &= w - 1;
+      n_group_classes++;
+    }
+  }
+
   BFT_MALLOC(operations->group_class_set[operations->n_operations - 1],
-             this_selector->n_group_classes,
+             n_group_classes,
              int);
 
   group_class_set
     = operations->group_class_set[operations->n_operations - 1];
 
-  for (gc_id = 0; gc_id < this_selector->n_group_classes; gc_id++) {
+  n_group_classes = 0;
+
+  for (int gc_id = 0; gc_id < n_gcs; gc_id++) {
 
     /* update group class list for current operation */
 
-    if (fvm_selector_postfix_eval(pf,
-                                  this_selector->n_class_groups[gc_id],
-                                  this_selector->n_class_attributes[gc_id],
-                                  this_selector->group_ids[gc_id],
-                                  this_selector->attribute_ids[gc_id],
-                                  NULL,
-                                  NULL))
+    if (gc_mask[gc_id / 64] & ((uint64_t)1 << (gc_id % 64)))
       group_class_set[n_group_classes++] = gc_id;
   }
 
   operations->n_group_classes[operations->n_operations-1] = n_group_classes;
 
-  BFT_REALLOC(operations->group_class_set[operations->n_operations-1],
-              n_group_classes,
-              int);
+  BFT_FREE(gc_mask);
 
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
   bft_printf("  - group_classes list: ");
@@ -682,6 +798,7 @@ _add_new_operation(fvm_selector_t  *selector,
   /* update n_operations */
 
   selector->_operations->postfix[selector->_operations->n_operations] = pf;
+  cs_map_name_to_id(selector->_operations->criteria, infix_string);
   selector->_operations->n_operations++;
 
 
@@ -720,15 +837,13 @@ _get_criteria_id(fvm_selector_t  *selector,
   if (selector->_operations == NULL)
     selector->_operations = _operation_list_allocate();
 
-  for (op = 0; op < selector->_operations->n_operations; op++) {
-    const fvm_selector_postfix_t *pf = selector->_operations->postfix[op];
-    if (!strcmp(fvm_selector_postfix_get_infix(pf), teststr))
-      break;
-  }
+  op = cs_map_name_to_id_try(selector->_operations->criteria, teststr);
 
   /* if teststr is not in the list : add teststrcpy in the list */
-  if (op == selector->_operations->n_operations)
+  if (op < 0) {
+    op = selector->_operations->n_operations;
     _add_new_operation(selector, teststr);
+  }
 
   return op;
 }
@@ -795,6 +910,11 @@ fvm_selector_create(int                           dim,
   selector->n_class_attributes = NULL;
   selector->attribute_ids = NULL;
 
+  selector->_group_gc_idx = NULL;
+  selector->_group_gc_ids = NULL;
+  selector->_attribute_gc_idx = NULL;
+  selector->_attribute_gc_ids = NULL;
+
   selector->coords = coords;
   selector->_coords = NULL;
   selector->normals = normals;
@@ -892,6 +1012,11 @@ fvm_selector_destroy(fvm_selector_t  *this_selector)
   BFT_FREE(this_selector->group_ids);
   BFT_FREE(this_selector->attribute_ids);
 
+  BFT_FREE(this_selector->_group_gc_idx);
+  BFT_FREE(this_selector->_group_gc_ids);
+  BFT_FREE(this_selector->_attribute_gc_idx);
+  BFT_FREE(this_selector->_attribute_gc_ids);
+
   if (this_selector->_group_class_elements != NULL) {
     for (i = 0; i < this_selector->n_group_classes; i++)
       BFT_FREE(this_selector->_group_class_elements[i]);
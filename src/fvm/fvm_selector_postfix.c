@@ -2747,6 +2747,32 @@ _eval_coord_le(const fvm_selector_postfix_t  *pf,
   return (coords[coord_id] <= cmp_val ? true : false);
 }
 
+/*----------------------------------------------------------------------------
+ * Add group classes containing a range of groups or attributes to a mask.
+ *
+ * parameters:
+ *   start_id <-- id of first group or attribute
+ *   end_id   <-- id of last group or attribute (included)
+ *   gc_idx   <-- index of group classes for each group or attribute
+ *   gc_ids   <-- group classes for each group or attribute
+ *   mask     <-> group classes bit mask
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_add_to_mask(int         start_id,
+             int         end_id,
+             const int   gc_idx[],
+             const int   gc_ids[],
+             uint64_t    mask[])
+{
+  for (int k = start_id; k <= end_id; k++) {
+    for (int l = gc_idx[k]; l < gc_idx[k+1]; l++) {
+      int gc_id = gc_ids[l];
+      mask[gc_id / 64] |= ((uint64_t)1 << (gc_id % 64));
+    }
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -3159,6 +3185,204 @@ fvm_selector_postfix_eval(const fvm_selector_postfix_t  *pf,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Evaluate a postfix expression for a set of group classes at once,
+ * using bit masks.
+ *
+ * Masks contain one bit per group class, group class i being represented
+ * by bit (i % 64) of word (i / 64). Bits beyond the number of group classes
+ * in the last word may be set in the result, and should be ignored.
+ *
+ * Group classes containing a given group or attribute are defined using
+ * an index, so that operand masks are built only when needed. Group classes
+ * with no group or attribute are accessed as those of group n_groups
+ * (using the group_gc_idx[n_groups] to group_gc_idx[n_groups+1] range).
+ *
+ * This function may only be used for expressions which do not depend
+ * on coordinates or normals.
+ *
+ * parameters:
+ *   pf               <-- pointer to postfix structure
+ *   n_groups         <-- total number of groups
+ *   n_attributes     <-- total number of attributes
+ *   n_group_classes  <-- number of group classes
+ *   group_gc_idx     <-- index of group classes containing each group
+ *                        (size: n_groups + 2)
+ *   group_gc_ids     <-- group classes containing each group
+ *   attr_gc_idx      <-- index of group classes containing each attribute
+ *                        (size: n_attributes + 1)
+ *   attr_gc_ids      <-- group classes containing each attribute
+ *   result           --> group classes verifying the expression
+ *                        (size: (n_group_classes + 63) / 64)
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_selector_postfix_eval_masks(const fvm_selector_postfix_t  *pf,
+                                int                            n_groups,
+                                int                            n_attributes,
+                                int                            n_group_classes,
+                                const int                      group_gc_idx[],
+                                const int                      group_gc_ids[],
+                                const int                      attr_gc_idx[],
+                                const int                      attr_gc_ids[],
+                                uint64_t                       result[])
+{
+  size_t i = 0, eval_size = 0, eval_max_size = BASE_STACK_SIZE;
+  uint64_t  *eval_stack = NULL;
+
+  const size_t n_words = (n_group_classes + 63) / 64;
+
+  assert(   pf->coords_dependency == false
+         && pf->normals_dependency == false);
+
+  BFT_MALLOC(eval_stack, eval_max_size*n_words, uint64_t);
+
+  /* Evaluate postfix_string */
+
+  while (i < pf->size) {
+
+    _postfix_type_t type = *((_postfix_type_t *)(pf->elements + i));
+
+    i += _postfix_type_size;
+
+    uint64_t *m0 = eval_stack + eval_size*n_words;
+
+    switch(type) {
+
+    case PF_GROUP_ID:
+    case PF_ATTRIBUTE_ID:
+      {
+        int val = *((int *)(pf->elements + i));
+        i += _postfix_int_size;
+        memset(m0, 0, n_words*sizeof(uint64_t));
+        if (type == PF_GROUP_ID && val > -1 && val < n_groups)
+          _add_to_mask(val, val, group_gc_idx, group_gc_ids, m0);
+        else if (type == PF_ATTRIBUTE_ID && val > -1 && val < n_attributes)
+          _add_to_mask(val, val, attr_gc_idx, attr_gc_ids, m0);
+        eval_size++;
+      }
+      break;
+    case PF_OPCODE:
+      {
+        size_t min_eval_size;
+        _operator_code_t oc = *((_operator_code_t *)(pf->elements + i));
+        i += _postfix_opcode_size;
+
+        if (oc == OC_NOT)
+          min_eval_size = 1;
+        else if (oc >= OC_AND && oc <= OC_XOR)
+          min_eval_size = 2;
+        else
+          min_eval_size = 0;
+
+        if (eval_size < min_eval_size) {
+          fvm_selector_postfix_dump(pf, 0, 0, NULL, NULL);
+          bft_error(__FILE__, __LINE__, 0,
+                    _("Postfix evaluation error."));
+        }
+
+        uint64_t *m1 = (eval_size > 0) ? m0 - n_words : NULL;
+        uint64_t *m2 = (eval_size > 1) ? m1 - n_words : NULL;
+
+        switch(oc) {
+
+        case OC_NOT:
+          for (size_t j = 0; j < n_words; j++)
+            m1[j] = ~m1[j];
+          break;
+        case OC_AND:
+          for (size_t j = 0; j < n_words; j++)
+            m2[j] &= m1[j];
+          eval_size--;
+          break;
+        case OC_OR:
+          for (size_t j = 0; j < n_words; j++)
+            m2[j] |= m1[j];
+          eval_size--;
+          break;
+        case OC_XOR:
+          for (size_t j = 0; j < n_words; j++)
+            m2[j] ^= m1[j];
+          eval_size--;
+          break;
+
+        case OC_ALL:
+          memset(m0, 0xff, n_words*sizeof(uint64_t));
+          eval_size++;
+          break;
+        case OC_NO_GROUP:
+          memset(m0, 0, n_words*sizeof(uint64_t));
+          _add_to_mask(n_groups, n_groups, group_gc_idx, group_gc_ids, m0);
+          eval_size++;
+          break;
+
+        case OC_RANGE:
+          {
+            _postfix_type_t type1, type2;
+            int val1, val2;
+
+            type1 = *((_postfix_type_t *)(pf->elements + i));
+            i += _postfix_type_size;
+            val1 = *((int *)(pf->elements + i));
+            i += _postfix_int_size;
+            type2 = *((_postfix_type_t *)(pf->elements + i));
+            i += _postfix_type_size;
+            val2 = *((int *)(pf->elements + i));
+            i += _postfix_int_size;
+
+            memset(m0, 0, n_words*sizeof(uint64_t));
+
+            if (type1 == PF_GROUP_ID && type1 == type2)
+              _add_to_mask(CS_MAX(val1, 0), CS_MIN(val2, n_groups - 1),
+                           group_gc_idx, group_gc_ids, m0);
+            else if (type1 == PF_ATTRIBUTE_ID && type1 == type2)
+              _add_to_mask(CS_MAX(val1, 0), CS_MIN(val2, n_attributes - 1),
+                           attr_gc_idx, attr_gc_ids, m0);
+            else {
+              fvm_selector_postfix_dump(pf, 0, 0, NULL, NULL);
+              bft_error(__FILE__, __LINE__, 0,
+                        _("Postfix error: "
+                          "range arguments of different or incorrect type."));
+            }
+
+          }
+          eval_size++;
+          break;
+
+        default:
+          bft_error(__FILE__, __LINE__, 0,
+                    _("Operator %s not handled in mask-based evaluation."),
+                    _operator_name[oc]);
+
+        } /* End of inside (operator) switch */
+
+      }
+      break;
+
+    default:
+      fvm_selector_postfix_dump(pf, 0, 0, NULL, NULL);
+      bft_error(__FILE__, __LINE__, 0,
+                _("Postfix evaluation error."));
+    }
+
+    if (eval_size == eval_max_size) {
+      eval_max_size *= 2;
+      BFT_REALLOC(eval_stack, eval_max_size*n_words, uint64_t);
+    }
+
+  } /* End of loop on postfix elements */
+
+  if (eval_size != 1) {
+    fvm_selector_postfix_dump(pf, 0, 0, NULL, NULL);
+    bft_error(__FILE__, __LINE__, 0,
+              _("Postfix evaluation error."));
+  }
+
+  memcpy(result, eval_stack, n_words*sizeof(uint64_t));
+
+  BFT_FREE(eval_stack);
+}
+
 /*----------------------------------------------------------------------------
  * Dump the contents of a postfix structure in human readable form
  *
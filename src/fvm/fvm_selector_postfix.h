@@ -179,6 +179,48 @@ fvm_selector_postfix_eval(const fvm_selector_postfix_t  *pf,
                           const double                   coords[],
                           const double                   normal[]);
 
+/*----------------------------------------------------------------------------
+ * Evaluate a postfix expression for a set of group classes at once,
+ * using bit masks.
+ *
+ * Masks contain one bit per group class, group class i being represented
+ * by bit (i % 64) of word (i / 64). Bits beyond the number of group classes
+ * in the last word may be set in the result, and should be ignored.
+ *
+ * Group classes containing a given group or attribute are defined using
+ * an index, so that operand masks are built only when needed. Group classes
+ * with no group or attribute are accessed as those of group n_groups
+ * (using the group_gc_idx[n_groups] to group_gc_idx[n_groups+1] range).
+ *
+ * This function may only be used for expressions which do not depend
+ * on coordinates or normals.
+ *
+ * parameters:
+ *   pf               <-- pointer to postfix structure
+ *   n_groups         <-- total number of groups
+ *   n_attributes     <-- total number of attributes
+ *   n_group_classes  <-- number of group classes
+ *   group_gc_idx     <-- index of group classes containing each group
+ *                        (size: n_groups + 2)
+ *   group_gc_ids     <-- group classes containing each group
+ *   attr_gc_idx      <-- index of group classes containing each attribute
+ *                        (size: n_attributes + 1)
+ *   attr_gc_ids      <-- group classes containing each attribute
+ *   result           --> group classes verifying the expression
+ *                        (size: (n_group_classes + 63) / 64)
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_selector_postfix_eval_masks(const fvm_selector_postfix_t  *pf,
+                                int                            n_groups,
+                                int                            n_attributes,
+                                int                            n_group_classes,
+                                const int                      group_gc_idx[],
+                                const int                      group_gc_ids[],
+                                const int                      attr_gc_idx[],
+                                const int                      attr_gc_ids[],
+                                uint64_t                       result[]);
+
 /*----------------------------------------------------------------------------
  * Dump the contents of a postfix structure in human readable form
  *
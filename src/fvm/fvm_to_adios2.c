@@ -0,0 +1,1368 @@
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to ADIOS2 output (files or staging).
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * ADIOS2 library header
+ *----------------------------------------------------------------------------*/
+
+#include <adios2_c.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "fvm_defs.h"
+#include "fvm_nodal.h"
+#include "fvm_nodal_priv.h"
+#include "fvm_tesselation.h"
+#include "fvm_writer_helper.h"
+#include "fvm_writer_priv.h"
+
+#include "cs_map.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_to_adios2.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* VTK cell type identifiers (used by the ADIOS2 VTX schema) */
+
+#define _VTK_LINE          3
+#define _VTK_TRIANGLE      5
+#define _VTK_POLYGON       7
+#define _VTK_QUAD          9
+#define _VTK_TETRA        10
+#define _VTK_HEXAHEDRON   12
+#define _VTK_WEDGE        13
+#define _VTK_PYRAMID      14
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * ADIOS2 output writer structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char        *name;               /* Writer name */
+  char        *filename;           /* Output file (or stream) name */
+
+  int          rank;               /* Rank of current process in communicator */
+  int          n_ranks;            /* Number of processes in communicator */
+
+  fvm_writer_time_dep_t   time_dependency;  /* Mesh time dependency */
+
+  bool         discard_polygons;   /* Option to discard polygonal elements */
+  bool         discard_polyhedra;  /* Option to discard polyhedral elements */
+  bool         divide_polygons;    /* Option to tesselate polygonal elements */
+
+  bool         staging;            /* true for staging (SST) engine */
+
+  adios2_adios   *adios;           /* ADIOS2 context */
+  adios2_io      *io;              /* ADIOS2 IO group */
+  adios2_engine  *engine;          /* ADIOS2 engine */
+
+  bool         step_open;          /* Is an output step currently open ? */
+  bool         mesh_in_step;       /* Was the mesh output in current step ? */
+  bool         schema_defined;     /* Was the VTX schema attribute defined ? */
+
+  int          nt;                 /* Time step associated with output step */
+  double       t;                  /* Time value associated with output step */
+
+  /* Local (rank) mesh piece, kept for output at each step with staging */
+
+  uint64_t     n_vertices;         /* Number of local vertices */
+  uint64_t     n_cells;            /* Number of local cells */
+  size_t       connect_size;       /* Size of connectivity array */
+
+  double      *vertex_coords;      /* Interlaced vertex coordinates */
+  int64_t     *connect;            /* VTK-style (count-prefixed) connectivity */
+  uint32_t    *cell_types;         /* VTK cell types */
+
+  cs_map_name_to_id_t  *f_map;     /* field names mapping */
+  int         *f_loc;              /* field location (0: nodes, 1: cells) */
+
+#if defined(HAVE_MPI)
+  MPI_Comm     comm;               /* Associated MPI communicator */
+#endif
+
+} fvm_to_adios2_writer_t;
+
+/*----------------------------------------------------------------------------
+ * Context structure for fvm_writer_field_helper_output_* functions.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  fvm_to_adios2_writer_t  *writer;      /* pointer to writer structure */
+
+  const char              *name;        /* current field name */
+
+} _adios2_context_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static char _adios2_version_string[32] = "";
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check the return code of an ADIOS2 function, and abort on error.
+ *
+ * parameters:
+ *   w         <-- pointer to writer structure
+ *   err       <-- ADIOS2 error code
+ *   func_name <-- name of called function
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_error(const fvm_to_adios2_writer_t  *w,
+             adios2_error                   err,
+             const char                    *func_name)
+{
+  if (err != adios2_error_none)
+    bft_error(__FILE__, __LINE__, 0,
+              _("ADIOS2 error %d calling %s\n"
+                "for output: \"%s\"."),
+              (int)err, func_name, w->filename);
+}
+
+/*----------------------------------------------------------------------------
+ * Return a local array variable, defining it if necessary, and set its
+ * local dimensions.
+ *
+ * parameters:
+ *   w     <-- pointer to writer structure
+ *   name  <-- variable name
+ *   type  <-- variable type
+ *   ndims <-- number of dimensions (1 or 2)
+ *   count <-- local dimensions
+ *
+ * returns:
+ *   pointer to ADIOS2 variable
+ *----------------------------------------------------------------------------*/
+
+static adios2_variable *
+_local_array(fvm_to_adios2_writer_t  *w,
+             const char              *name,
+             adios2_type              type,
+             size_t                   ndims,
+             const size_t             count[])
+{
+  adios2_variable *v = adios2_inquire_variable(w->io, name);
+
+  if (v == NULL)
+    v = adios2_define_variable(w->io, name, type, ndims,
+                               NULL, NULL, count,
+                               adios2_constant_dims_false);
+  else
+    _check_error(w,
+                 adios2_set_selection(v, ndims, NULL, count),
+                 "adios2_set_selection");
+
+  if (v == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("ADIOS2 error defining variable \"%s\"\n"
+                "for output: \"%s\"."), name, w->filename);
+
+  return v;
+}
+
+/*----------------------------------------------------------------------------
+ * Output a per-rank (local) value.
+ *
+ * parameters:
+ *   w     <-- pointer to writer structure
+ *   name  <-- variable name
+ *   value <-- associated value
+ *----------------------------------------------------------------------------*/
+
+static void
+_put_local_value(fvm_to_adios2_writer_t  *w,
+                 const char              *name,
+                 uint64_t                 value)
+{
+  adios2_variable *v = adios2_inquire_variable(w->io, name);
+
+  if (v == NULL) {
+    const size_t shape[1] = {adios2_local_value_dim};
+    v = adios2_define_variable(w->io, name, adios2_type_uint64_t, 1,
+                               shape, NULL, NULL,
+                               adios2_constant_dims_true);
+    if (v == NULL)
+      bft_error(__FILE__, __LINE__, 0,
+                _("ADIOS2 error defining variable \"%s\"\n"
+                  "for output: \"%s\"."), name, w->filename);
+  }
+
+  _check_error(w,
+               adios2_put(w->engine, v, &value, adios2_mode_sync),
+               "adios2_put");
+}
+
+/*----------------------------------------------------------------------------
+ * Output the local mesh piece in the current step.
+ *
+ * parameters:
+ *   w <-- pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_put_mesh(fvm_to_adios2_writer_t  *w)
+{
+  _put_local_value(w, "NumberOfNodes", w->n_vertices);
+  _put_local_value(w, "NumberOfCells", w->n_cells);
+
+  if (w->n_vertices > 0) {
+    const size_t count[2] = {w->n_vertices, 3};
+    adios2_variable *v
+      = _local_array(w, "vertices", adios2_type_double, 2, count);
+    _check_error(w,
+                 adios2_put(w->engine, v, w->vertex_coords, adios2_mode_sync),
+                 "adios2_put");
+  }
+
+  if (w->n_cells > 0) {
+    size_t count[1] = {w->connect_size};
+    adios2_variable *v
+      = _local_array(w, "connectivity", adios2_type_int64_t, 1, count);
+    _check_error(w,
+                 adios2_put(w->engine, v, w->connect, adios2_mode_sync),
+                 "adios2_put");
+    count[0] = w->n_cells;
+    v = _local_array(w, "types", adios2_type_uint32_t, 1, count);
+    _check_error(w,
+                 adios2_put(w->engine, v, w->cell_types, adios2_mode_sync),
+                 "adios2_put");
+  }
+
+  w->mesh_in_step = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Define the VTX schema attribute, so that the output may be read
+ * as a VTK unstructured grid.
+ *
+ * Only fields already known when the first step is closed are listed
+ * in the schema; fields first output at a later step are still available
+ * as regular ADIOS2 variables.
+ *
+ * parameters:
+ *   w <-- pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_schema(fvm_to_adios2_writer_t  *w)
+{
+  const char *header[] = {
+    "<?xml version=\"1.0\"?>\n"
+    "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\""
+    " byte_order=\"LittleEndian\">\n"
+    "  <UnstructuredGrid>\n"
+    "    <Piece NumberOfPoints=\"NumberOfNodes\""
+    " NumberOfCells=\"NumberOfCells\">\n"
+    "      <Points>\n"
+    "        <DataArray Name=\"vertices\" />\n"
+    "      </Points>\n"
+    "      <Cells>\n"
+    "        <DataArray Name=\"connectivity\" />\n"
+    "        <DataArray Name=\"types\" />\n"
+    "      </Cells>\n",
+    "      <PointData>\n",
+    "        <DataArray Name=\"TIME\">\n"
+    "          TIME\n"
+    "        </DataArray>\n"
+    "      </PointData>\n",
+    "      <CellData>\n",
+    "      </CellData>\n"
+    "    </Piece>\n"
+    "  </UnstructuredGrid>\n"
+    "</VTKFile>\n"};
+
+  const char da_fmt[] = "        <DataArray Name=\"%s\" />\n";
+
+  const int n_fields = cs_map_name_to_id_size(w->f_map);
+
+  size_t l = 1;
+  for (int i = 0; i < 5; i++)
+    l += strlen(header[i]);
+  for (int i = 0; i < n_fields; i++)
+    l += strlen(da_fmt) + strlen(cs_map_name_to_id_reverse(w->f_map, i));
+
+  char *s;
+  BFT_MALLOC(s, l, char);
+
+  size_t k = 0;
+  for (int i = 0; i < 5; i++) {
+    if (i == 2 || i == 4) {
+      int loc = (i == 2) ? 0 : 1;
+      for (int f_id = 0; f_id < n_fields; f_id++) {
+        if (w->f_loc[f_id] == loc)
+          k += sprintf(s + k, da_fmt,
+                       cs_map_name_to_id_reverse(w->f_map, f_id));
+      }
+    }
+    strcpy(s + k, header[i]);
+    k += strlen(header[i]);
+  }
+
+  if (adios2_define_attribute(w->io, "vtk.xml", adios2_type_string, s)
+      == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("ADIOS2 error defining attribute \"%s\"\n"
+                "for output: \"%s\"."), "vtk.xml", w->filename);
+
+  BFT_FREE(s);
+
+  w->schema_defined = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Close the current output step, if open.
+ *
+ * parameters:
+ *   w <-- pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_end_step(fvm_to_adios2_writer_t  *w)
+{
+  if (w->step_open == false)
+    return;
+
+  /* Readers of a staging engine may attach at any step, and the VTX schema
+     expects the mesh at each step, so repeat it if unchanged. */
+
+  if (w->staging && w->mesh_in_step == false && w->vertex_coords != NULL)
+    _put_mesh(w);
+
+  if (w->schema_defined == false)
+    _define_schema(w);
+
+  _check_error(w, adios2_end_step(w->engine), "adios2_end_step");
+
+  w->step_open = false;
+  w->mesh_in_step = false;
+}
+
+/*----------------------------------------------------------------------------
+ * Open an output step for the current time step, if not already done.
+ *
+ * parameters:
+ *   w <-- pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_begin_step(fvm_to_adios2_writer_t  *w)
+{
+  if (w->step_open)
+    return;
+
+  adios2_step_status status;
+
+  _check_error(w,
+               adios2_begin_step(w->engine, adios2_step_mode_append, -1.f,
+                                 &status),
+               "adios2_begin_step");
+
+  w->step_open = true;
+  w->mesh_in_step = false;
+
+  adios2_variable *v = adios2_inquire_variable(w->io, "TIME");
+  if (v == NULL)
+    v = adios2_define_variable(w->io, "TIME", adios2_type_double, 0,
+                               NULL, NULL, NULL,
+                               adios2_constant_dims_true);
+
+  if (w->rank == 0)
+    _check_error(w,
+                 adios2_put(w->engine, v, &(w->t), adios2_mode_sync),
+                 "adios2_put");
+}
+
+/*----------------------------------------------------------------------------
+ * Update the time step associated with the output step, closing the
+ * current step if the time step changes.
+ *
+ * parameters:
+ *   w          <-- pointer to writer structure
+ *   time_step  <-- time step number (< 0 for time-independent output)
+ *   time_value <-- associated time value
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_time(fvm_to_adios2_writer_t  *w,
+          int                      time_step,
+          double                   time_value)
+{
+  if (time_step < 0 || time_step == w->nt)
+    return;
+
+  _end_step(w);
+
+  w->nt = time_step;
+  w->t = time_value;
+}
+
+/*----------------------------------------------------------------------------
+ * Build list of sections to output, in order of output.
+ *
+ * The same options must be used for mesh and field output, so that
+ * element numberings match.
+ *
+ * parameters:
+ *   w    <-- pointer to writer structure
+ *   mesh <-- pointer to nodal mesh structure
+ *
+ * returns:
+ *   pointer to list of sections to output
+ *----------------------------------------------------------------------------*/
+
+static fvm_writer_section_t *
+_export_list(const fvm_to_adios2_writer_t  *w,
+             const fvm_nodal_t             *mesh)
+{
+  const int export_dim = fvm_nodal_get_max_entity_dim(mesh);
+
+  return fvm_writer_export_list(mesh,
+                                export_dim,
+                                export_dim,
+                                -1,
+                                false, /* group by type */
+                                true,  /* group all */
+                                w->discard_polygons,
+                                w->discard_polyhedra,
+                                w->divide_polygons,
+                                true); /* divide polyhedra */
+}
+
+/*----------------------------------------------------------------------------
+ * Return VTK cell type matching an FVM element type.
+ *
+ * parameters:
+ *   type <-- FVM element type
+ *
+ * returns:
+ *   VTK cell type
+ *----------------------------------------------------------------------------*/
+
+static uint32_t
+_vtk_cell_type(fvm_element_t  type)
+{
+  uint32_t retval = 0;
+
+  switch(type) {
+  case FVM_EDGE:
+    retval = _VTK_LINE;
+    break;
+  case FVM_FACE_TRIA:
+    retval = _VTK_TRIANGLE;
+    break;
+  case FVM_FACE_QUAD:
+    retval = _VTK_QUAD;
+    break;
+  case FVM_FACE_POLY:
+    retval = _VTK_POLYGON;
+    break;
+  case FVM_CELL_TETRA:
+    retval = _VTK_TETRA;
+    break;
+  case FVM_CELL_PYRAM:
+    retval = _VTK_PYRAMID;
+    break;
+  case FVM_CELL_PRISM:
+    retval = _VTK_WEDGE;
+    break;
+  case FVM_CELL_HEXA:
+    retval = _VTK_HEXAHEDRON;
+    break;
+  default:
+    assert(0);
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Append cells with strided connectivity to the local mesh piece.
+ *
+ * parameters:
+ *   w          <-> pointer to writer structure
+ *   type       <-- element type
+ *   n_elts     <-- number of elements
+ *   vertex_num <-- element vertex numbers (1 to n)
+ *----------------------------------------------------------------------------*/
+
+static void
+_append_strided_cells(fvm_to_adios2_writer_t  *w,
+                      fvm_element_t            type,
+                      cs_lnum_t                n_elts,
+                      const cs_lnum_t          vertex_num[])
+{
+  /* Vertex ordering differs from FVM for prisms only */
+
+  const int prism_order[6] = {0, 2, 1, 3, 5, 4};
+
+  const int stride = fvm_nodal_n_vertices_element[type];
+  const uint32_t vtk_type = _vtk_cell_type(type);
+
+  size_t k = w->connect_size;
+  uint64_t c_id = w->n_cells;
+
+  BFT_REALLOC(w->connect, k + (size_t)n_elts*(stride+1), int64_t);
+  BFT_REALLOC(w->cell_types, c_id + n_elts, uint32_t);
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    w->connect[k++] = stride;
+    if (type == FVM_CELL_PRISM) {
+      for (int j = 0; j < stride; j++)
+        w->connect[k++] = vertex_num[i*stride + prism_order[j]] - 1;
+    }
+    else {
+      for (int j = 0; j < stride; j++)
+        w->connect[k++] = vertex_num[i*stride + j] - 1;
+    }
+    w->cell_types[c_id++] = vtk_type;
+  }
+
+  w->connect_size = k;
+  w->n_cells = c_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Append polygons to the local mesh piece.
+ *
+ * parameters:
+ *   w       <-> pointer to writer structure
+ *   section <-- pointer to nodal mesh section
+ *----------------------------------------------------------------------------*/
+
+static void
+_append_polygons(fvm_to_adios2_writer_t     *w,
+                 const fvm_nodal_section_t  *section)
+{
+  const cs_lnum_t n_elts = section->n_elements;
+  const cs_lnum_t *vertex_index = section->vertex_index;
+
+  size_t k = w->connect_size;
+  uint64_t c_id = w->n_cells;
+
+  BFT_REALLOC(w->connect, k + n_elts + vertex_index[n_elts], int64_t);
+  BFT_REALLOC(w->cell_types, c_id + n_elts, uint32_t);
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    w->connect[k++] = vertex_index[i+1] - vertex_index[i];
+    for (cs_lnum_t j = vertex_index[i]; j < vertex_index[i+1]; j++)
+      w->connect[k++] = section->vertex_num[j] - 1;
+    w->cell_types[c_id++] = _VTK_POLYGON;
+  }
+
+  w->connect_size = k;
+  w->n_cells = c_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Append tesselated elements to the local mesh piece.
+ *
+ * parameters:
+ *   w                 <-> pointer to writer structure
+ *   export_section    <-- pointer to section helper structure
+ *   extra_vertex_base <-- starting number for added vertices
+ *----------------------------------------------------------------------------*/
+
+static void
+_append_tesselated_cells(fvm_to_adios2_writer_t      *w,
+                         const fvm_writer_section_t  *export_section,
+                         cs_lnum_t                    extra_vertex_base)
+{
+  const fvm_nodal_section_t  *section = export_section->section;
+  const fvm_tesselation_t  *tesselation = section->tesselation;
+  const fvm_element_t type = export_section->type;
+  const int stride = fvm_nodal_n_vertices_element[type];
+
+  const cs_lnum_t n_sub_elts
+    = fvm_tesselation_n_sub_elements(tesselation, type);
+
+  if (n_sub_elts < 1)
+    return;
+
+  const cs_lnum_t *sub_elt_idx
+    = fvm_tesselation_sub_elt_index(tesselation, type);
+
+  cs_lnum_t *vertex_num;
+  BFT_MALLOC(vertex_num, (size_t)n_sub_elts*stride, cs_lnum_t);
+
+  cs_lnum_t end_id = 0;
+  for (cs_lnum_t start_id = 0;
+       start_id < section->n_elements;
+       start_id = end_id) {
+
+    end_id = fvm_tesselation_decode(tesselation,
+                                    type,
+                                    start_id,
+                                    n_sub_elts,
+                                    extra_vertex_base,
+                                    vertex_num);
+
+    _append_strided_cells(w,
+                          type,
+                          sub_elt_idx[end_id] - sub_elt_idx[start_id],
+                          vertex_num);
+
+  }
+
+  BFT_FREE(vertex_num);
+}
+
+/*----------------------------------------------------------------------------
+ * Build the local mesh piece.
+ *
+ * parameters:
+ *   w    <-> pointer to writer structure
+ *   mesh <-- pointer to nodal mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_mesh(fvm_to_adios2_writer_t  *w,
+            const fvm_nodal_t       *mesh)
+{
+  BFT_FREE(w->vertex_coords);
+  BFT_FREE(w->connect);
+  BFT_FREE(w->cell_types);
+
+  w->n_cells = 0;
+  w->connect_size = 0;
+
+  /* Vertex coordinates, including vertices added by tesselation */
+
+  cs_lnum_t n_extra_vertices = 0;
+  fvm_writer_count_extra_vertices(mesh, true, NULL, &n_extra_vertices);
+
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+  const int dim = mesh->dim;
+
+  w->n_vertices = n_vertices + n_extra_vertices;
+
+  BFT_MALLOC(w->vertex_coords, CS_MAX(w->n_vertices, 1)*3, double);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    cs_lnum_t v_id = i;
+    if (mesh->parent_vertex_num != NULL)
+      v_id = mesh->parent_vertex_num[i] - 1;
+    int j;
+    for (j = 0; j < dim; j++)
+      w->vertex_coords[i*3 + j] = mesh->vertex_coords[v_id*dim + j];
+    for (; j < 3; j++)
+      w->vertex_coords[i*3 + j] = 0.;
+  }
+
+  if (n_extra_vertices > 0) {
+    cs_coord_t *extra_coords
+      = fvm_writer_extra_vertex_coords(mesh, n_extra_vertices);
+    for (cs_lnum_t i = 0; i < n_extra_vertices*3; i++)
+      w->vertex_coords[n_vertices*3 + i] = extra_coords[i];
+    BFT_FREE(extra_coords);
+  }
+
+  /* Element connectivity */
+
+  fvm_writer_section_t *export_list = _export_list(w, mesh);
+
+  const fvm_writer_section_t *export_section = export_list;
+
+  while (export_section != NULL) {
+
+    const fvm_nodal_section_t  *section = export_section->section;
+
+    if (export_section->type != section->type) {
+
+      /* Extra vertices are numbered in mesh section order */
+
+      cs_lnum_t extra_vertex_base = n_vertices + 1;
+      for (int i = 0; i < mesh->n_sections; i++) {
+        const fvm_nodal_section_t  *s = mesh->sections[i];
+        if (s == section)
+          break;
+        if (s->type == FVM_CELL_POLY && s->tesselation != NULL)
+          extra_vertex_base += fvm_tesselation_n_vertices_add(s->tesselation);
+      }
+
+      _append_tesselated_cells(w, export_section, extra_vertex_base);
+
+    }
+    else if (section->type == FVM_FACE_POLY)
+      _append_polygons(w, section);
+
+    else if (section->stride > 0)
+      _append_strided_cells(w,
+                            section->type,
+                            section->n_elements,
+                            section->vertex_num);
+
+    export_section = export_section->next;
+
+  }
+
+  BFT_FREE(export_list);
+}
+
+/*----------------------------------------------------------------------------
+ * Output function for field values.
+ *
+ * This function is passed to fvm_writer_field_helper_output_* functions.
+ *
+ * parameters:
+ *   context      <-> pointer to writer and field context
+ *   datatype     <-- output datatype
+ *   dimension    <-- output field dimension
+ *   component_id <-- output component id (if non-interleaved)
+ *   block_start  <-- start global number of element for current block
+ *   block_end    <-- past-the-end global number of element for current block
+ *   buffer       <-> associated output buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_field_output(void           *context,
+              cs_datatype_t   datatype,
+              int             dimension,
+              int             component_id,
+              cs_gnum_t       block_start,
+              cs_gnum_t       block_end,
+              void           *buffer)
+{
+  CS_UNUSED(component_id);
+
+  _adios2_context_t *c = context;
+  fvm_to_adios2_writer_t  *w = c->writer;
+
+  const size_t n_values = block_end - block_start;
+
+  if (n_values < 1)
+    return;
+
+  size_t ndims = (dimension > 1) ? 2 : 1;
+  const size_t count[2] = {n_values, (size_t)dimension};
+
+  adios2_type type
+    = (datatype == CS_FLOAT) ? adios2_type_float : adios2_type_double;
+
+  adios2_variable *v = _local_array(w, c->name, type, ndims, count);
+
+  _check_error(w,
+               adios2_put(w->engine, v, buffer, adios2_mode_sync),
+               "adios2_put");
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Returns number of library version strings associated with ADIOS2.
+ *
+ * returns:
+ *   number of library version strings associated with ADIOS2.
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_to_adios2_n_version_strings(void)
+{
+  return 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Returns a library version string associated with ADIOS2.
+ *
+ * ADIOS2 only provides compile-time version information, so the
+ * compile-time version string is returned by default, and a NULL
+ * character string is returned with the compile_time flag set.
+ *
+ * parameters:
+ *   string_index <-- index in format's version string list (0 to n-1)
+ *   compile_time <-- 0 by default, 1 if we want the compile-time version
+ *                    string, if different from the run-time version.
+ *
+ * returns:
+ *   pointer to constant string containing the library's version.
+ *----------------------------------------------------------------------------*/
+
+const char *
+fvm_to_adios2_version_string(int string_index,
+                             int compile_time)
+{
+  const char * retval = NULL;
+
+  if (string_index == 0 && compile_time == 0) {
+    snprintf(_adios2_version_string, 31, "ADIOS2 %s", ADIOS2_VERSION_STR);
+    _adios2_version_string[31] = '\0';
+    retval = _adios2_version_string;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to ADIOS2 output writer.
+ *
+ * Options are:
+ *   bp4                   use BP4 file engine
+ *   bp5                   use BP5 file engine (default)
+ *   sst                   use SST staging engine, so that data may be
+ *                         consumed in-transit by a running reader
+ *   sst_block             with SST, wait for a reader to connect and
+ *                         block when the reader's queue is full
+ *                         (by default, steps are discarded instead)
+ *   aggregators=<integer> number of file aggregators (file engines)
+ *   discard_polygons      do not output polygons
+ *   discard_polyhedra     do not output polyhedra
+ *   divide_polygons       tesselate polygons with triangles
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   path           <-- output path (may be NULL)
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque ADIOS2 output writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+void *
+fvm_to_adios2_init_writer(const char             *name,
+                          const char             *path,
+                          const char             *options,
+                          fvm_writer_time_dep_t   time_dependency,
+                          MPI_Comm                comm)
+#else
+void *
+fvm_to_adios2_init_writer(const char             *name,
+                          const char             *path,
+                          const char             *options,
+                          fvm_writer_time_dep_t   time_dependency)
+#endif
+{
+  fvm_to_adios2_writer_t  *w = NULL;
+
+  /* Initialize writer */
+
+  BFT_MALLOC(w, 1, fvm_to_adios2_writer_t);
+
+  BFT_MALLOC(w->name, strlen(name) + 1, char);
+  strcpy(w->name, name);
+
+  w->rank = 0;
+  w->n_ranks = 1;
+
+  w->time_dependency = time_dependency;
+
+  w->discard_polygons = false;
+  w->discard_polyhedra = false;
+  w->divide_polygons = false;
+
+  w->staging = false;
+
+  w->step_open = false;
+  w->mesh_in_step = false;
+  w->schema_defined = false;
+
+  w->nt = -1;
+  w->t = 0.;
+
+  w->n_vertices = 0;
+  w->n_cells = 0;
+  w->connect_size = 0;
+
+  w->vertex_coords = NULL;
+  w->connect = NULL;
+  w->cell_types = NULL;
+
+  w->f_map = cs_map_name_to_id_create();
+  w->f_loc = NULL;
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag, rank, n_ranks;
+    w->comm = MPI_COMM_NULL;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag && comm != MPI_COMM_NULL) {
+      w->comm = comm;
+      MPI_Comm_rank(w->comm, &rank);
+      MPI_Comm_size(w->comm, &n_ranks);
+      w->rank = rank;
+      w->n_ranks = n_ranks;
+    }
+  }
+#endif /* defined(HAVE_MPI) */
+
+  /* Parse options */
+
+  const char *engine_type = "BP5";
+  bool sst_block = false;
+  int n_aggregators = 0;
+
+  if (options != NULL) {
+
+    int i1 = 0, i2 = 0;
+    int l_tot = strlen(options);
+
+    const char ag[] = "aggregators=";
+    const int l_ag = strlen(ag);
+
+    while (i1 < l_tot) {
+
+      for (i2 = i1; i2 < l_tot && options[i2] != ' '; i2++);
+      int l_opt = i2 - i1;
+
+      if ((l_opt == 3) && (strncmp(options + i1, "bp4", l_opt) == 0))
+        engine_type = "BP4";
+
+      else if ((l_opt == 3) && (strncmp(options + i1, "bp5", l_opt) == 0))
+        engine_type = "BP5";
+
+      else if ((l_opt == 3) && (strncmp(options + i1, "sst", l_opt) == 0))
+        w->staging = true;
+
+      else if (   (l_opt == 9)
+               && (strncmp(options + i1, "sst_block", l_opt) == 0)) {
+        w->staging = true;
+        sst_block = true;
+      }
+
+      else if (   (l_opt == 16)
+               && (strncmp(options + i1, "discard_polygons", l_opt) == 0))
+        w->discard_polygons = true;
+
+      else if (   (l_opt == 17)
+               && (strncmp(options + i1, "discard_polyhedra", l_opt) == 0))
+        w->discard_polyhedra = true;
+
+      else if (   (l_opt == 15)
+               && (strncmp(options + i1, "divide_polygons", l_opt) == 0))
+        w->divide_polygons = true;
+
+      else if ((strncmp(options + i1, ag, l_ag) == 0)) {
+        if (l_opt < l_ag+32) { /* 32 integers more than enough
+                                  for maximum integer string */
+          char options_c[32];
+          strncpy(options_c, options+i1+l_ag, l_opt-l_ag);
+          options_c[l_opt-l_ag] = '\0';
+          n_aggregators = atoi(options_c);
+        }
+      }
+
+      for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
+
+    }
+  }
+
+  if (w->staging)
+    engine_type = "SST";
+
+  /* Output file (or stream contact file) name */
+
+  int path_len = 0;
+  if (path != NULL)
+    path_len = strlen(path);
+
+  BFT_MALLOC(w->filename, path_len + strlen(name) + strlen(".bp") + 1, char);
+  if (path != NULL)
+    strcpy(w->filename, path);
+  else
+    w->filename[0] = '\0';
+  strcat(w->filename, name);
+  strcat(w->filename, ".bp");
+
+  /* ADIOS2 context */
+
+#if defined(HAVE_MPI) && defined(ADIOS2_USE_MPI)
+  if (w->comm != MPI_COMM_NULL)
+    w->adios = adios2_init_mpi(w->comm);
+  else
+    w->adios = adios2_init_serial();
+#else
+  w->adios = adios2_init_serial();
+#endif
+
+  if (w->adios == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error initializing ADIOS2 for output: \"%s\"."),
+              w->filename);
+
+  w->io = adios2_declare_io(w->adios, name);
+  if (w->io == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error declaring ADIOS2 IO for output: \"%s\"."),
+              w->filename);
+
+  _check_error(w, adios2_set_engine(w->io, engine_type), "adios2_set_engine");
+
+  if (w->staging) {
+
+    /* By default, do not wait for readers, and discard steps rather
+       than stalling the computation when a reader lags behind. */
+
+    if (sst_block) {
+      _check_error(w,
+                   adios2_set_parameter(w->io, "RendezvousReaderCount", "1"),
+                   "adios2_set_parameter");
+      _check_error(w,
+                   adios2_set_parameter(w->io, "QueueFullPolicy", "Block"),
+                   "adios2_set_parameter");
+    }
+    else {
+      _check_error(w,
+                   adios2_set_parameter(w->io, "RendezvousReaderCount", "0"),
+                   "adios2_set_parameter");
+      _check_error(w,
+                   adios2_set_parameter(w->io, "QueueFullPolicy", "Discard"),
+                   "adios2_set_parameter");
+    }
+    _check_error(w,
+                 adios2_set_parameter(w->io, "QueueLimit", "2"),
+                 "adios2_set_parameter");
+
+  }
+  else if (n_aggregators > 0) {
+    char s[32];
+    snprintf(s, 31, "%d", n_aggregators);
+    s[31] = '\0';
+    _check_error(w,
+                 adios2_set_parameter(w->io, "NumAggregators", s),
+                 "adios2_set_parameter");
+  }
+
+  w->engine = adios2_open(w->io, w->filename, adios2_mode_write);
+  if (w->engine == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error opening ADIOS2 output: \"%s\"."),
+              w->filename);
+
+  /* Return writer */
+  return w;
+}
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to ADIOS2 output writer.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to opaque ADIOS2 writer structure.
+ *
+ * returns:
+ *   NULL pointer
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_adios2_finalize_writer(void  *this_writer_p)
+{
+  fvm_to_adios2_writer_t *w = (fvm_to_adios2_writer_t *)this_writer_p;
+
+  _end_step(w);
+
+  _check_error(w, adios2_close(w->engine), "adios2_close");
+  _check_error(w, adios2_finalize(w->adios), "adios2_finalize");
+
+  BFT_FREE(w->vertex_coords);
+  BFT_FREE(w->connect);
+  BFT_FREE(w->cell_types);
+
+  cs_map_name_to_id_destroy(&(w->f_map));
+  BFT_FREE(w->f_loc);
+
+  BFT_FREE(w->filename);
+  BFT_FREE(w->name);
+
+  BFT_FREE(w);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with an ADIOS2 geometry.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   time_step     <-- time step number
+ *   time_value    <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_adios2_set_mesh_time(void          *this_writer_p,
+                            const int      time_step,
+                            const double   time_value)
+{
+  fvm_to_adios2_writer_t *w = (fvm_to_adios2_writer_t *)this_writer_p;
+
+  _set_time(w, time_step, time_value);
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate if a elements of a given type in a mesh associated to a given
+ * ADIOS2 output writer need to be tesselated.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   mesh          <-- pointer to nodal mesh structure that should be written
+ *   element_type  <-- element type we are interested in
+ *
+ * returns:
+ *   1 if tesselation of the given element type is needed, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_to_adios2_needs_tesselation(void               *this_writer_p,
+                                const fvm_nodal_t  *mesh,
+                                fvm_element_t       element_type)
+{
+  int  retval = 0;
+  fvm_to_adios2_writer_t  *w = (fvm_to_adios2_writer_t *)this_writer_p;
+
+  const int  export_dim = fvm_nodal_get_max_entity_dim(mesh);
+
+  if (   (   element_type == FVM_FACE_POLY
+          && w->divide_polygons == true)
+      || (   element_type == FVM_CELL_POLY
+          && w->discard_polyhedra == false)) {
+
+    for (int i = 0; i < mesh->n_sections; i++) {
+
+      const fvm_nodal_section_t  *const  section = mesh->sections[i];
+
+      /* Output if entity dimension equal to highest in mesh
+         (i.e. no output of faces if cells present, or edges
+         if cells or faces) */
+
+      if (section->entity_dim == export_dim) {
+        if (section->type == element_type)
+          retval = 1;
+      }
+
+    }
+
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh to an ADIOS2 output
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   mesh          <-- pointer to nodal mesh structure that should be written
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_adios2_export_nodal(void               *this_writer_p,
+                           const fvm_nodal_t  *mesh)
+{
+  fvm_to_adios2_writer_t *w = (fvm_to_adios2_writer_t *)this_writer_p;
+
+  _build_mesh(w, mesh);
+
+  _begin_step(w);
+  _put_mesh(w);
+}
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to an ADIOS2 output.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field.
+ *
+ * parameters:
+ *   this_writer_p    <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_adios2_export_field(void                  *this_writer_p,
+                           const fvm_nodal_t     *mesh,
+                           const char            *name,
+                           fvm_writer_var_loc_t   location,
+                           int                    dimension,
+                           cs_interlace_t         interlace,
+                           int                    n_parent_lists,
+                           const cs_lnum_t        parent_num_shift[],
+                           cs_datatype_t          datatype,
+                           int                    time_step,
+                           double                 time_value,
+                           const void      *const field_values[])
+{
+  fvm_to_adios2_writer_t  *w = (fvm_to_adios2_writer_t *)this_writer_p;
+
+  _adios2_context_t  c;
+  c.writer = w;
+  c.name = name;
+
+  fvm_writer_field_helper_t   *helper = NULL;
+  fvm_writer_section_t        *export_list = NULL;
+
+  /* Register field location for schema */
+
+  int f_id = cs_map_name_to_id_try(w->f_map, name);
+  if (f_id < 0) {
+    f_id = cs_map_name_to_id(w->f_map, name);
+    int n_fields = cs_map_name_to_id_size(w->f_map);
+    BFT_REALLOC(w->f_loc, n_fields, int);
+    w->f_loc[f_id] = (location == FVM_WRITER_PER_NODE) ? 0 : 1;
+  }
+
+  _set_time(w, time_step, time_value);
+  _begin_step(w);
+
+  /* Initialize writer helper (local values only, as each rank
+     outputs its own piece) */
+
+  cs_datatype_t dest_datatype = CS_DOUBLE;
+  if (datatype == CS_FLOAT)
+    dest_datatype = CS_FLOAT;
+
+  export_list = _export_list(w, mesh);
+
+  helper = fvm_writer_field_helper_create(mesh,
+                                          export_list,
+                                          dimension,
+                                          CS_INTERLACE,
+                                          dest_datatype,
+                                          location);
+
+  /* Per node variable */
+  /*-------------------*/
+
+  if (location == FVM_WRITER_PER_NODE) {
+
+    fvm_writer_field_helper_output_n(helper,
+                                     &c,
+                                     mesh,
+                                     dimension,
+                                     interlace,
+                                     NULL,
+                                     n_parent_lists,
+                                     parent_num_shift,
+                                     datatype,
+                                     field_values,
+                                     _field_output);
+
+  }
+
+  /* Per element variable */
+  /*----------------------*/
+
+  else if (location == FVM_WRITER_PER_ELEMENT && export_list != NULL) {
+
+    fvm_writer_field_helper_output_e(helper,
+                                     &c,
+                                     export_list,
+                                     dimension,
+                                     interlace,
+                                     NULL,
+                                     n_parent_lists,
+                                     parent_num_shift,
+                                     datatype,
+                                     field_values,
+                                     _field_output);
+
+  } /* End for per element variable */
+
+  /* Free helper structures */
+
+  fvm_writer_field_helper_destroy(&helper);
+  BFT_FREE(export_list);
+}
+
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * The current ADIOS2 output step (if any) is ended, so that it may be
+ * read, either from a file or through a staging engine.
+ *
+ * parameters:
+ *   this_writer_p    <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_adios2_flush(void  *this_writer_p)
+{
+  fvm_to_adios2_writer_t *w = (fvm_to_adios2_writer_t *)this_writer_p;
+
+  _end_step(w);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,246 @@
+#ifndef __FVM_TO_ADIOS2_H__
+#define __FVM_TO_ADIOS2_H__
+
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to ADIOS2 output (files or staging).
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_defs.h"
+#include "fvm_nodal.h"
+#include "fvm_writer.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Returns number of library version strings associated with ADIOS2.
+ *
+ * returns:
+ *   number of library version strings associated with ADIOS2.
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_to_adios2_n_version_strings(void);
+
+/*----------------------------------------------------------------------------
+ * Returns a library version string associated with ADIOS2.
+ *
+ * ADIOS2 only provides compile-time version information, so the
+ * compile-time version string is returned by default, and a NULL
+ * character string is returned with the compile_time flag set.
+ *
+ * parameters:
+ *   string_index <-- index in format's version string list (0 to n-1)
+ *   compile_time <-- 0 by default, 1 if we want the compile-time version
+ *                    string, if different from the run-time version.
+ *
+ * returns:
+ *   pointer to constant string containing the library's version.
+ *----------------------------------------------------------------------------*/
+
+const char *
+fvm_to_adios2_version_string(int string_index,
+                            int compile_time);
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to ADIOS2 output writer.
+ *
+ * Options are:
+ *   bp4                   use BP4 file engine
+ *   bp5                   use BP5 file engine (default)
+ *   sst                   use SST staging engine, so that data may be
+ *                         consumed in-transit by a running reader
+ *   sst_block             with SST, wait for a reader to connect and
+ *                         block when the reader's queue is full
+ *                         (by default, steps are discarded instead)
+ *   aggregators=<integer> number of file aggregators (file engines)
+ *   discard_polygons      do not output polygons
+ *   discard_polyhedra     do not output polyhedra
+ *   divide_polygons       tesselate polygons with triangles
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   path           <-- output path (may be NULL)
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque ADIOS2 output writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+void *
+fvm_to_adios2_init_writer(const char             *name,
+                          const char             *path,
+                          const char             *options,
+                          fvm_writer_time_dep_t   time_dependency,
+                          MPI_Comm                comm);
+
+#else
+
+void *
+fvm_to_adios2_init_writer(const char             *name,
+                          const char             *path,
+                          const char             *options,
+                          fvm_writer_time_dep_t   time_dependency);
+
+#endif
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to ADIOS2 output writer.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to opaque ADIOS2 writer structure.
+ *
+ * returns:
+ *   NULL pointer.
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_adios2_finalize_writer(void  *this_writer_p);
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with an ADIOS2 geometry.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   time_step     <-- time step number
+ *   time_value    <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_adios2_set_mesh_time(void          *this_writer_p,
+                            const int      time_step,
+                            const double   time_value);
+
+/*----------------------------------------------------------------------------
+ * Indicate if a elements of a given type in a mesh associated to a given
+ * ADIOS2 output writer need to be tesselated.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   mesh          <-- pointer to nodal mesh structure that should be written
+ *   element_type  <-- element type we are interested in
+ *
+ * returns:
+ *   1 if tesselation of the given element type is needed, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_to_adios2_needs_tesselation(void               *this_writer_p,
+                                const fvm_nodal_t  *mesh,
+                                fvm_element_t       element_type);
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh to an ADIOS2 output
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer.
+ *   mesh          <-- pointer to nodal mesh structure that should be written.
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_adios2_export_nodal(void               *this_writer_p,
+                           const fvm_nodal_t  *mesh);
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to an ADIOS2 output.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field.
+ *
+ * parameters:
+ *   writer           <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_adios2_export_field(void                  *this_writer_p,
+                           const fvm_nodal_t     *mesh,
+                           const char            *name,
+                           fvm_writer_var_loc_t   location,
+                           int                    dimension,
+                           cs_interlace_t         interlace,
+                           int                    n_parent_lists,
+                           const cs_lnum_t        parent_num_shift[],
+                           cs_datatype_t          datatype,
+                           int                    time_step,
+                           double                 time_value,
+                           const void      *const field_values[]);
+
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * The current ADIOS2 output step (if any) is ended, so that it may be
+ * read, either from a file or through a staging engine.
+ *
+ * parameters:
+ *   this_writer_p    <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_adios2_flush(void  *this_writer_p);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __FVM_TO_ADIOS2_H__ */
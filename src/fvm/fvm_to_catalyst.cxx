@@ -47,6 +47,8 @@
 
 #include <assert.h>
 #include <stdio.h>
+#include <ctype.h>
+#include <float.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -168,6 +170,31 @@ typedef struct {
   bool                        modified;        /* Has output been added since
                                                   last coprocessing ? */
 
+  /* Coprocessing triggers (inactive by default) */
+
+  double                      interval;        /* Minimum time interval
+                                                  between coprocessing, or
+                                                  < 0 if unused */
+  double                      last_time;       /* Time value of last
+                                                  coprocessing */
+  bool                        has_last_time;   /* Has coprocessing been
+                                                  done yet ? */
+
+  char                       *trigger_name;    /* Name of field triggering
+                                                  coprocessing, or NULL */
+  double                      trigger_min;     /* Trigger if a value of field
+                                                  is lower than this */
+  double                      trigger_max;     /* Trigger if a value of field
+                                                  is higher than this */
+  bool                        triggered;       /* Trigger field out of range
+                                                  at current step ? */
+
+  int                         request_step;    /* Time step at which
+                                                  is_requested was last
+                                                  evaluated, or -2 */
+  bool                        is_requested;    /* Is coprocessing requested
+                                                  at request_step ? */
+
 } fvm_to_catalyst_t;
 
 /*============================================================================
@@ -649,6 +676,109 @@ _get_catalyst_mesh_id(fvm_to_catalyst_t  *writer,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Case-independent string comparison.
+ *
+ * parameters:
+ *   s1 <-- first string
+ *   s2 <-- second string
+ *
+ * returns:
+ *   true if strings are equal (ignoring case), false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_name_matches(const char  *s1,
+              const char  *s2)
+{
+  int i;
+
+  for (i = 0; s1[i] != '\0' && s2[i] != '\0'; i++) {
+    if (tolower((unsigned char)s1[i]) != tolower((unsigned char)s2[i]))
+      return false;
+  }
+
+  return (s1[i] == s2[i]);
+}
+
+/*----------------------------------------------------------------------------
+ * Build a data description for the current time step of a writer.
+ *
+ * parameters:
+ *   w               <-- Catalyst writer structure
+ *   dataDescription <-> data description
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_data_description(const fvm_to_catalyst_t  *w,
+                         vtkCPDataDescription     *dataDescription)
+{
+  if (w->input_name != NULL)
+    dataDescription->AddInput(w->input_name);
+  else
+    dataDescription->AddInput(w->name);
+  dataDescription->SetTimeData(w->time_value, w->time_step);
+}
+
+/*----------------------------------------------------------------------------
+ * Check if coprocessing may occur at the current time step.
+ *
+ * This allows skipping field value conversions when no pipeline requests
+ * data at this time step, or when the time interval trigger is not
+ * reached. The result is cached for the current time step.
+ *
+ * parameters:
+ *   w <-> Catalyst writer structure
+ *
+ * returns:
+ *   true if coprocessing may occur, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_coprocessing_is_requested(fvm_to_catalyst_t  *w)
+{
+  if (w->request_step == w->time_step)
+    return w->is_requested;
+
+  w->request_step = w->time_step;
+  w->is_requested = true;
+
+  if (   w->interval > 0 && w->has_last_time
+      && w->time_value < w->last_time + w->interval)
+    w->is_requested = false;
+
+  else {
+    vtkNew<vtkCPDataDescription> dataDescription;
+    _define_data_description(w, dataDescription);
+    if (_processor->RequestDataDescription(dataDescription) == 0)
+      w->is_requested = false;
+  }
+
+  return w->is_requested;
+}
+
+/*----------------------------------------------------------------------------
+ * Update field trigger status based on exported values.
+ *
+ * parameters:
+ *   w        <-> Catalyst writer structure
+ *   n_values <-- number of values
+ *   values   <-- exported values
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_trigger(fvm_to_catalyst_t  *w,
+                cs_lnum_t           n_values,
+                const double        values[])
+{
+  for (cs_lnum_t i = 0; i < n_values; i++) {
+    if (values[i] < w->trigger_min || values[i] > w->trigger_max) {
+      w->triggered = true;
+      break;
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Create a Catalyst mesh structure.
  *
@@ -985,9 +1115,21 @@ _export_vertex_coords(const fvm_nodal_t        *mesh,
 
   vtkNew<vtkPoints> points;
 
-  points->Allocate(mesh->n_vertices);
+  /* Coordinates shared with the parent mesh and using the VTK layout
+     are mapped directly, without copy (VTK does not free them) */
+
+  if (   mesh->dim == 3 && mesh->parent_vertex_num == NULL
+      && mesh->_vertex_coords == NULL && vertex_coords != NULL) {
+    vtkNew<vtkDoubleArray> coords;
+    coords->SetNumberOfComponents(3);
+    coords->SetArray(const_cast<double *>(vertex_coords),
+                     (vtkIdType)n_vertices*3,
+                     1);  /* save: do not delete */
+    points->SetData(coords);
+  }
 
-  if (mesh->parent_vertex_num != NULL) {
+  else if (mesh->parent_vertex_num != NULL) {
+    points->Allocate(mesh->n_vertices);
     const cs_lnum_t  *parent_vertex_num = mesh->parent_vertex_num;
     for (i = 0; i < n_vertices; i++) {
       for (j = 0; j < mesh->dim; j++)
@@ -998,6 +1140,7 @@ _export_vertex_coords(const fvm_nodal_t        *mesh,
     }
   }
   else {
+    points->Allocate(mesh->n_vertices);
     for (i = 0; i < n_vertices; i++) {
       for (j = 0; j < mesh->dim; j++)
         point[j] = vertex_coords[i*stride + j];
@@ -1007,7 +1150,10 @@ _export_vertex_coords(const fvm_nodal_t        *mesh,
     }
   }
 
-  if (mesh->global_vertex_num != NULL) {
+  /* Global ids do not change unless the connectivity changes */
+
+  if (   mesh->global_vertex_num != NULL
+      && vtk_mesh->GetPointData()->GetGlobalIds() == NULL) {
 
     const cs_gnum_t *g_vtx_num
       = fvm_io_num_get_global_num(mesh->global_vertex_num);
@@ -1393,6 +1539,12 @@ BEGIN_C_DECLS
  *   names=<fmt>         use same naming rules as <fmt> format
  *                       (default: ensight)
  *   input_name=<name>   define input name (default: writer name)
+ *   interval=<t>        minimum time interval between coprocessing
+ *                       (default: none)
+ *   trigger=<field>     only coprocess when values of the given field
+ *                       are outside [trigger_min, trigger_max]
+ *   trigger_min=<v>     lower trigger bound (default: none)
+ *   trigger_max=<v>     upper trigger bound (default: none)
  *
  * parameters:
  *   name           <-- base output case name.
@@ -1445,6 +1597,18 @@ fvm_to_catalyst_init_writer(const char             *name,
   w->ensight_names = true;
   w->input_name = NULL;
 
+  w->interval = -1;
+  w->last_time = 0;
+  w->has_last_time = false;
+
+  w->trigger_name = NULL;
+  w->trigger_min = -DBL_MAX;
+  w->trigger_max = DBL_MAX;
+  w->triggered = false;
+
+  w->request_step = -2;
+  w->is_requested = true;
+
   /* Writer name */
 
   if (name != NULL) {
@@ -1484,6 +1648,20 @@ fvm_to_catalyst_init_writer(const char             *name,
         strncpy(w->input_name, options + i1 + 11, l);
         w->input_name[l] = '\0';
       }
+      else if ((l_opt > 9) && (strncmp(options + i1, "interval=", 9) == 0))
+        w->interval = atof(options + i1 + 9);
+      else if ((l_opt > 8) && (strncmp(options + i1, "trigger=", 8) == 0)) {
+        int l = l_opt - 8;
+        BFT_MALLOC(w->trigger_name, l+1, char);
+        strncpy(w->trigger_name, options + i1 + 8, l);
+        w->trigger_name[l] = '\0';
+      }
+      else if (   (l_opt > 12)
+               && (strncmp(options + i1, "trigger_min=", 12) == 0))
+        w->trigger_min = atof(options + i1 + 12);
+      else if (   (l_opt > 12)
+               && (strncmp(options + i1, "trigger_max=", 12) == 0))
+        w->trigger_max = atof(options + i1 + 12);
 
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
 
@@ -1552,6 +1730,8 @@ fvm_to_catalyst_finalize_writer(void  *this_writer_p)
   /* Free structures */
 
   BFT_FREE(w->name);
+  BFT_FREE(w->input_name);
+  BFT_FREE(w->trigger_name);
 
   /* Free vtkUnstructuredGrid and field structures
      (reference counters should go to 0) */
@@ -1650,6 +1830,15 @@ fvm_to_catalyst_export_nodal(void               *this_writer_p,
 
   _export_vertex_coords(mesh, ugrid);
 
+  /* Connectivity is kept between steps unless it may change */
+
+  if (   w->time_dependency < FVM_WRITER_TRANSIENT_CONNECT
+      && ugrid->GetNumberOfCells() > 0) {
+    ugrid->Modified();
+    w->modified = true;
+    return;
+  }
+
   /* Element connectivity size */
   /*---------------------------*/
 
@@ -1788,6 +1977,11 @@ fvm_to_catalyst_export_field(void                  *this_writer_p,
     w->time_value = _time_value;
   }
 
+  /* Skip conversion if no coprocessing may occur at this step */
+
+  if (_coprocessing_is_requested(w) == false)
+    return;
+
   /* Get field id */
 
   field_id = _get_catalyst_field_id(w,
@@ -1836,6 +2030,20 @@ fvm_to_catalyst_export_field(void                  *this_writer_p,
                            field_values,
                            f);
 
+  /* Check trigger field */
+
+  if (w->trigger_name != NULL) {
+    if (_name_matches(w->trigger_name, name) || _name_matches(w->trigger_name,
+                                                              _name)) {
+      vtkDataArray *a = (location == FVM_WRITER_PER_NODE) ?
+        f->GetPointData()->GetArray(_name) : f->GetCellData()->GetArray(_name);
+      double *v = vtkDoubleArray::SafeDownCast(a)->GetPointer(0);
+      _update_trigger(w,
+                      a->GetNumberOfTuples()*a->GetNumberOfComponents(),
+                      v);
+    }
+  }
+
   /* Update field status */
   /*---------------------*/
 
@@ -1858,14 +2066,31 @@ fvm_to_catalyst_flush(void  *this_writer_p)
 {
   fvm_to_catalyst_t *w = (fvm_to_catalyst_t *)this_writer_p;
 
+  if (w->modified == false)
+    return;
+
+  /* Check triggers */
+
+  if (_coprocessing_is_requested(w) == false)
+    return;
+
+  if (w->trigger_name != NULL) {
+    int triggered = (w->triggered) ? 1 : 0;
+#if defined(HAVE_MPI)
+    if (_comm != MPI_COMM_NULL) {
+      int l_triggered = triggered;
+      MPI_Allreduce(&l_triggered, &triggered, 1, MPI_INT, MPI_MAX, _comm);
+    }
+#endif
+    w->triggered = false;
+    if (triggered == 0)
+      return;
+  }
+
   vtkNew<vtkCPDataDescription> dataDescription;
-  if (w->input_name != NULL)
-    dataDescription->AddInput(w->input_name);
-  else
-    dataDescription->AddInput(w->name);
-  dataDescription->SetTimeData(w->time_value, w->time_step);
+  _define_data_description(w, dataDescription);
 
-  if (_processor->RequestDataDescription(dataDescription) != 0 && w->modified) {
+  if (_processor->RequestDataDescription(dataDescription) != 0) {
     int n = dataDescription->GetNumberOfInputDescriptions();
     if (n == 1)
       dataDescription->GetInputDescription(0)->SetGrid(w->mb);
@@ -1878,6 +2103,9 @@ fvm_to_catalyst_flush(void  *this_writer_p)
 
     _processor->CoProcess(dataDescription);
     w->modified = false;
+
+    w->last_time = w->time_value;
+    w->has_last_time = true;
   }
 }
 
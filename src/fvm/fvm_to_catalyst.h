@@ -64,6 +64,12 @@ BEGIN_C_DECLS
  *   names=<fmt>         use same naming rules as <fmt> format
  *                       (default: ensight)
  *   input_name=<name>   define input name (default: writer name)
+ *   interval=<t>        minimum time interval between coprocessing
+ *                       (default: none)
+ *   trigger=<field>     only coprocess when values of the given field
+ *                       are outside [trigger_min, trigger_max]
+ *   trigger_min=<v>     lower trigger bound (default: none)
+ *   trigger_max=<v>     upper trigger bound (default: none)
  *
  * parameters:
  *   name           <-- base output case name.
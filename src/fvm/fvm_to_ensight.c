@@ -52,6 +52,7 @@
 #include "fvm_writer_helper.h"
 #include "fvm_writer_priv.h"
 
+#include "cs_base.h"
 #include "cs_block_dist.h"
 #include "cs_file.h"
 #include "cs_parall.h"
@@ -94,6 +95,12 @@ typedef struct {
   bool         divide_polygons;    /* Option to tesselate polygonal elements */
   bool         divide_polyhedra;   /* Option to tesselate polyhedral elements */
 
+  bool         merge_headers;      /* Option to write part and section headers
+                                      with the following data block
+                                      (parallel binary output) */
+  bool         write_index;        /* Option to write part and section
+                                      offsets to an index file */
+
   fvm_to_ensight_case_t  *case_info;  /* Associated case structure */
 
 #if defined(HAVE_MPI)
@@ -105,6 +112,22 @@ typedef struct {
 
 } fvm_to_ensight_writer_t;
 
+/*----------------------------------------------------------------------------
+ * Pending headers buffer, so that headers may be written with the
+ * following data block in a single collective call
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  int             rank;            /* Rank in file communicator */
+  bool            swap_endian;     /* true if values must be swapped */
+
+  size_t          size;            /* Size of pending headers */
+  size_t          max_size;        /* Allocated buffer size */
+  unsigned char  *buf;             /* Pending headers */
+
+} _ensight_headers_t;
+
 /*----------------------------------------------------------------------------
  * Indirect file structure to handle both text and binary files
  *----------------------------------------------------------------------------*/
@@ -114,6 +137,12 @@ typedef struct {
   FILE        *tf;                 /* Text file handing structure */
   cs_file_t   *bf;                 /* Binary file handling structure */
 
+  _ensight_headers_t  *h;          /* Pending headers, or NULL if headers
+                                      are written immediately */
+
+  bool         indexed;            /* true if offsets are indexed */
+  FILE        *idx;                /* Index file (on rank 0) */
+
 } _ensight_file_t;
 
 /*----------------------------------------------------------------------------
@@ -164,7 +193,7 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
                    const char                     *filename,
                    bool                            append)
 {
-  _ensight_file_t f = {NULL, NULL};
+  _ensight_file_t f = {NULL, NULL, NULL, false, NULL};
 
   if (this_writer->text_mode == true) {
     if (this_writer->rank == 0) {
@@ -203,6 +232,39 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
 
     if (this_writer->swap_endian == true)
       cs_file_set_swap_endian(f.bf, 1);
+
+#if defined(HAVE_MPI)
+
+    /* Headers are merged with data in parallel mode only, as they are
+       otherwise written by the same rank as the data. */
+
+    if (this_writer->merge_headers && this_writer->n_ranks > 1) {
+      BFT_MALLOC(f.h, 1, _ensight_headers_t);
+      f.h->rank = this_writer->rank;
+      f.h->swap_endian = this_writer->swap_endian;
+      f.h->size = 0;
+      f.h->max_size = 1024;
+      BFT_MALLOC(f.h->buf, f.h->max_size, unsigned char);
+    }
+
+#endif
+  }
+
+  /* Optional index file */
+
+  if (this_writer->write_index) {
+    f.indexed = true;
+    if (this_writer->rank == 0) {
+      char *idx_name;
+      BFT_MALLOC(idx_name, strlen(filename) + strlen(".index") + 1, char);
+      sprintf(idx_name, "%s.index", filename);
+      f.idx = fopen(idx_name, (append) ? "a" : "w");
+      if (f.idx == NULL)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Error opening file \"%s\":\n\n"
+                    "  %s"), idx_name, strerror(errno));
+      BFT_FREE(idx_name);
+    }
   }
 
   return f;
@@ -218,6 +280,23 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
 static void
 _free_ensight_file(_ensight_file_t  *f)
 {
+  if (f->idx != NULL) {
+    if (fclose(f->idx) != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error closing EnSight index file:\n\n"
+                  "  %s"), strerror(errno));
+    f->idx = NULL;
+  }
+
+  /* Write remaining headers (if no data follows them) */
+
+  if (f->h != NULL) {
+    if (f->h->size > 0)
+      cs_file_write_global(f->bf, f->h->buf, 1, f->h->size);
+    BFT_FREE(f->h->buf);
+    BFT_FREE(f->h);
+  }
+
   if (f->tf != NULL) {
     if (fclose(f->tf) != 0)
       bft_error(__FILE__, __LINE__, 0,
@@ -230,6 +309,90 @@ _free_ensight_file(_ensight_file_t  *f)
     f->bf = cs_file_free(f->bf);
 }
 
+/*----------------------------------------------------------------------------
+ * Swap bytes of values in place (endianness conversion).
+ *
+ * parameters:
+ *   buf  <-> values whose bytes should be swapped
+ *   size <-- size of each value
+ *   ni   <-- number of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_swap_endian(void    *buf,
+             size_t   size,
+             size_t   ni)
+{
+  unsigned char  *pbuf = (unsigned char *)buf;
+
+  for (size_t i = 0; i < ni; i++) {
+    size_t shift = i * size;
+    for (size_t ib = 0; ib < (size / 2); ib++) {
+      unsigned char tmpswap = pbuf[shift + ib];
+      pbuf[shift + ib] = pbuf[shift + (size - 1) - ib];
+      pbuf[shift + (size - 1) - ib] = tmpswap;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Append bytes to pending headers.
+ *
+ * parameters:
+ *   h    <-> pending headers structure
+ *   buf  <-- bytes to append
+ *   size <-- number of bytes to append
+ *----------------------------------------------------------------------------*/
+
+static void
+_append_header(_ensight_headers_t  *h,
+               const void          *buf,
+               size_t               size)
+{
+  if (h->size + size > h->max_size) {
+    while (h->size + size > h->max_size)
+      h->max_size *= 2;
+    BFT_REALLOC(h->buf, h->max_size, unsigned char);
+  }
+
+  memcpy(h->buf + h->size, buf, size);
+  h->size += size;
+}
+
+/*----------------------------------------------------------------------------
+ * Write an index entry for the current position in an EnSight Gold file.
+ *
+ * In binary mode, this function is collective, and the position accounts
+ * for pending headers.
+ *
+ * parameters:
+ *   f        <-- file to index
+ *   part_num <-- associated part number
+ *   label    <-- associated label (part or section name)
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_index(_ensight_file_t   f,
+             int               part_num,
+             const char       *label)
+{
+  if (f.indexed == false)
+    return;
+
+  long long offset = 0;
+
+  if (f.tf != NULL)
+    offset = ftell(f.tf);
+  else if (f.bf != NULL) {
+    offset = cs_file_tell(f.bf);
+    if (f.h != NULL)
+      offset += f.h->size;
+  }
+
+  if (f.idx != NULL)
+    fprintf(f.idx, "%d %s %lld\n", part_num, label, offset);
+}
+
 /*----------------------------------------------------------------------------
  * Write string to a text or C binary EnSight Gold file
  *
@@ -256,7 +419,10 @@ _write_string(_ensight_file_t   f,
     buf[80] = '\0';
     for (i = strlen(buf); i < 80; i++)
       buf[i] = '\0';
-    cs_file_write_global(f.bf, buf, 1, 80);
+    if (f.h != NULL)
+      _append_header(f.h, buf, 80);
+    else
+      cs_file_write_global(f.bf, buf, 1, 80);
   }
 }
 
@@ -276,8 +442,14 @@ _write_int(_ensight_file_t  f,
     fprintf(f.tf, "%10d\n", (int)n);
 
   else if (f.bf != NULL) {
-    int _n = n;
-    cs_file_write_global(f.bf, &_n, sizeof(int32_t), 1);
+    int32_t _n = n;
+    if (f.h != NULL) {
+      if (f.h->swap_endian)
+        _swap_endian(&_n, sizeof(int32_t), 1);
+      _append_header(f.h, &_n, sizeof(int32_t));
+    }
+    else
+      cs_file_write_global(f.bf, &_n, sizeof(int32_t), 1);
   }
 }
 
@@ -312,6 +484,72 @@ _write_geom_headers(fvm_to_ensight_writer_t  *this_writer,
 
 #if defined(HAVE_MPI)
 
+/*----------------------------------------------------------------------------
+ * Write a data block to a binary EnSight Gold file, with pending headers.
+ *
+ * If headers are pending, those are written by rank 0 with its data block,
+ * and the file offsets of other ranks are shifted accordingly, so that
+ * headers and data are written in a single collective call.
+ *
+ * The data buffer may be modified (for endianness conversion).
+ *
+ * parameters:
+ *   f         <-- file to write to
+ *   buf       <-> pointer to data block
+ *   size      <-- size of each item of data in bytes
+ *   stride    <-- number of (interlaced) values per block item
+ *   num_start <-- global number of first element for this block
+ *   num_end   <-- global number of past the last element for this block
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_block_buffer(_ensight_file_t   f,
+                    void             *buf,
+                    size_t            size,
+                    size_t            stride,
+                    cs_gnum_t         num_start,
+                    cs_gnum_t         num_end)
+{
+  if (f.h == NULL || f.h->size == 0) {
+    cs_file_write_block_buffer(f.bf, buf, size, stride, num_start, num_end);
+    return;
+  }
+
+  _ensight_headers_t  *h = f.h;
+
+  /* Values are written as bytes, so swap them here if needed */
+
+  size_t n_vals = 0;
+  if (num_end > num_start)
+    n_vals = (num_end - num_start)*stride;
+
+  if (h->swap_endian && size > 1)
+    _swap_endian(buf, size, n_vals);
+
+  /* Byte range shifted by headers size; rank 0 writes headers */
+
+  unsigned char *_buf = buf;
+  size_t n_bytes = n_vals*size;
+
+  cs_gnum_t b_start = h->size + (num_start-1)*stride*size + 1;
+
+  if (h->rank == 0) {
+    BFT_MALLOC(_buf, h->size + n_bytes, unsigned char);
+    memcpy(_buf, h->buf, h->size);
+    if (n_bytes > 0)
+      memcpy(_buf + h->size, buf, n_bytes);
+    n_bytes += h->size;
+    b_start = 1;
+  }
+
+  cs_file_write_block_buffer(f.bf, _buf, 1, 1, b_start, b_start + n_bytes);
+
+  if (_buf != buf)
+    BFT_FREE(_buf);
+
+  h->size = 0;
+}
+
 /*----------------------------------------------------------------------------
  * Write block of a vector of floats to an EnSight Gold file.
  *
@@ -340,12 +578,12 @@ _write_block_floats_g(cs_gnum_t         num_start,
      we may use use a collective call */
 
   if (f.bf != NULL)
-    cs_file_write_block_buffer(f.bf,
-                               values,
-                               sizeof(float),
-                               1,
-                               num_start,
-                               num_end);
+    _write_block_buffer(f,
+                        values,
+                        sizeof(float),
+                        1,
+                        num_start,
+                        num_end);
 
   /* If all ranks do not have a binary file structure pointer, then
      we are using a text file, open only on rank 0 */
@@ -736,12 +974,12 @@ _write_block_connect_g(int              stride,
      we may use use a collective call */
 
   if (f.bf != NULL)
-    cs_file_write_block_buffer(f.bf,
-                               block_connect,
-                               sizeof(int32_t),
-                               stride,
-                               num_start,
-                               num_end);
+    _write_block_buffer(f,
+                        block_connect,
+                        sizeof(int32_t),
+                        stride,
+                        num_start,
+                        num_end);
 
   /* If all ranks do not have a binary file structure pointer, then
      we are using a text file, open only on rank 0 */
@@ -1149,12 +1387,12 @@ _write_block_indexed(cs_gnum_t         num_start,
      we may use use a collective call */
 
   if (f.bf != NULL)
-    cs_file_write_block_buffer(f.bf,
-                               block_connect,
-                               sizeof(int32_t),
-                               1,
-                               block_start,
-                               block_end);
+    _write_block_buffer(f,
+                        block_connect,
+                        sizeof(int32_t),
+                        1,
+                        block_start,
+                        block_end);
 
   /* If all ranks do not have a binary file structure pointer, then
      we are using a text file, open only on rank 0 */
@@ -2531,6 +2769,11 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   merge_headers       in parallel, write part and section headers with
+ *                       the following data block, in a single call
+ *   index               write part and section file offsets to an
+ *                       associated ".index" file, for random access
+ *   rank_step=<integer> MPI rank step between output (aggregator) ranks
  *
  * parameters:
  *   name           <-- base output case name.
@@ -2572,6 +2815,8 @@ fvm_to_ensight_init_writer(const char             *name,
   this_writer->discard_polyhedra = false;
   this_writer->divide_polygons = false;
   this_writer->divide_polyhedra = false;
+  this_writer->merge_headers = false;
+  this_writer->write_index = false;
 
   this_writer->rank = 0;
   this_writer->n_ranks = 1;
@@ -2597,6 +2842,8 @@ fvm_to_ensight_init_writer(const char             *name,
         this_writer->min_block_size = min_block_size;
         this_writer->block_comm = w_block_comm;
       }
+      else
+        this_writer->block_comm = comm;
       this_writer->comm = comm;
     }
   }
@@ -2604,11 +2851,16 @@ fvm_to_ensight_init_writer(const char             *name,
 
   /* Parse options */
 
+  int rank_step = 1;
+
   if (options != NULL) {
 
     int i1, i2, l_opt;
     int l_tot = strlen(options);
 
+    const char rs[] = "rank_step=";
+    const int l_rs = strlen(rs);
+
     i1 = 0; i2 = 0;
     while (i1 < l_tot) {
 
@@ -2644,12 +2896,49 @@ fvm_to_ensight_init_writer(const char             *name,
                && (strncmp(options + i1, "divide_polyhedra", l_opt) == 0))
         this_writer->divide_polyhedra = true;
 
+      else if (   (l_opt == 13)
+               && (strncmp(options + i1, "merge_headers", l_opt) == 0))
+        this_writer->merge_headers = true;
+      else if (   (l_opt == 5)
+               && (strncmp(options + i1, "index", l_opt) == 0))
+        this_writer->write_index = true;
+
+      else if ((strncmp(options + i1, rs, l_rs) == 0)) {
+        if (l_opt < l_rs+32) { /* 32 integers more than enough
+                                  for maximum integer string */
+          char options_c[32];
+          strncpy(options_c, options+i1+l_rs, l_opt-l_rs);
+          options_c[l_opt-l_rs] = '\0';
+          rank_step = atoi(options_c);
+        }
+      }
+
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
 
     }
 
   }
 
+  /* Aggregate output on a subset of ranks if requested */
+
+#if defined(HAVE_MPI)
+  if (   rank_step > 1 && this_writer->n_ranks > 1
+      && this_writer->comm == cs_glob_mpi_comm) {
+    /* Adjust step so that it matches the one deduced from the
+       number of output ranks on file open */
+    int n_ranks = this_writer->n_ranks;
+    int n_io_ranks = n_ranks / rank_step + ((n_ranks % rank_step) ? 1 : 0);
+    if (n_io_ranks < 1)
+      n_io_ranks = 1;
+    rank_step = n_ranks / n_io_ranks + ((n_ranks % n_io_ranks) ? 1 : 0);
+    this_writer->min_rank_step = rank_step;
+    if (n_io_ranks > 1)
+      this_writer->block_comm = cs_base_get_rank_step_comm(rank_step);
+  }
+#else
+  CS_UNUSED(rank_step);
+#endif
+
   this_writer->case_info = fvm_to_ensight_case_create(name,
                                                       path,
                                                       time_dependency);
@@ -2776,7 +3065,7 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
   fvm_writer_section_t        *export_list = NULL;
   fvm_to_ensight_writer_t     *this_writer
                                   = (fvm_to_ensight_writer_t *)this_writer_p;
-  _ensight_file_t  f = {NULL, NULL};
+  _ensight_file_t  f = {NULL, NULL, NULL, false, NULL};
 
   const int  rank = this_writer->rank;
   const int  n_ranks = this_writer->n_ranks;
@@ -2807,6 +3096,8 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
   /* Part header */
 
+  _write_index(f, part_num, "part");
+
   _write_string(f, "part");
   _write_int(f, part_num);
   if (mesh->name != NULL)
@@ -2832,6 +3123,8 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
   /* Vertex coordinates */
   /*--------------------*/
 
+  _write_index(f, part_num, "coordinates");
+
 #if defined(HAVE_MPI)
   if (n_ranks > 1)
     _export_vertex_coords_g(this_writer, mesh, f);
@@ -2845,6 +3138,8 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
   if (export_list == NULL) {
 
+    _write_index(f, part_num, "point");
+
 #if defined(HAVE_MPI)
     if (n_ranks > 1)
       _export_point_elements_g(this_writer, mesh, f);
@@ -2888,6 +3183,8 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
       } while (next_section != NULL && next_section->continues_previous == true);
 
+      _write_index(f, part_num, _ensight_type_name[export_section->type]);
+
       _write_string(f, _ensight_type_name[export_section->type]);
       _write_int(f, n_g_elements);
     }
@@ -3044,7 +3341,7 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
   fvm_writer_field_helper_t  *helper = NULL;
   fvm_writer_section_t  *export_list = NULL;
   fvm_to_ensight_writer_t  *w = (fvm_to_ensight_writer_t *)this_writer_p;
-  _ensight_file_t  f = {NULL, NULL};
+  _ensight_file_t  f = {NULL, NULL, NULL, false, NULL};
 
   const int  rank = w->rank;
   const int  n_ranks = w->n_ranks;
@@ -3137,6 +3434,8 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
 
   /* Part header */
 
+  _write_index(f, part_num, "part");
+
   _write_string(f, "part");
   _write_int(f, part_num);
 
@@ -3145,6 +3444,8 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
 
   if (location == FVM_WRITER_PER_NODE) {
 
+    _write_index(f, part_num, "coordinates");
+
     _write_string(f, "coordinates");
 
 #if defined(HAVE_MPI)
@@ -3194,8 +3495,10 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
 
       /* Print header if start of corresponding EnSight section */
 
-      if (export_section->continues_previous == false)
+      if (export_section->continues_previous == false) {
+        _write_index(f, part_num, _ensight_type_name[export_section->type]);
         _write_string(f, _ensight_type_name[export_section->type]);
+      }
 
       /* Output per grouped sections */
 
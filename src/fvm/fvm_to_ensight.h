@@ -66,6 +66,10 @@ BEGIN_C_DECLS
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   merge_headers       in parallel, write part and section headers with
+ *                       the following data block, in a single call
+ *   index               write part and section file offsets to an
+ *                       associated ".index" file, for random access
  *
  * parameters:
  *   name           <-- base output case name.
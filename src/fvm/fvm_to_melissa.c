@@ -96,6 +96,10 @@ typedef struct {
 
   size_t       buffer_size;        /* buffer size required */
 
+  cs_gnum_t    subsample;          /* Only send values of elements whose
+                                      (global number - 1) is a multiple
+                                      of this value */
+
   cs_map_name_to_id_t  *f_map;     /* field names mapping */
   int         *f_ts;               /* last field output time step */
 
@@ -104,6 +108,7 @@ typedef struct {
   int          min_block_size;     /* Minimum block buffer size */
   MPI_Comm     block_comm;         /* Associated MPI block communicator */
   MPI_Comm     comm;               /* Associated MPI communicator */
+  bool         own_block_comm;     /* Is block communicator owned ? */
 #endif
 
 } fvm_to_melissa_writer_t;
@@ -167,6 +172,19 @@ _field_c_output(void           *context,
   assert(datatype == CS_DOUBLE);
   double *values = (double*)buffer;
 
+  /* Subsampling: compact values of selected elements in place
+     (the selection depends only on global numbers, so the number
+     of values sent is the same at each output) */
+
+  if (w->subsample > 1) {
+    cs_gnum_t j = 0;
+    for (cs_gnum_t i = 0; i < n_values; i++) {
+      if ((block_start + i - 1) % w->subsample == 0)
+        values[j++] = values[i];
+    }
+    n_values = j;
+  }
+
   /* Build component name */
 
   char tmpn[128], tmpe[6];
@@ -248,6 +266,8 @@ _field_c_output(void           *context,
  *   dry_run               trace output to <name>.log file, but do not
  *                         actually communicate with Melissa server
  *   rank_step=<integer>   MPI rank step
+ *   subsample=<integer>   only send values of one element out of the
+ *                         given number (based on global numbering)
  *   trace                 trace output to <name>.log file
  *
  * parameters:
@@ -282,6 +302,7 @@ fvm_to_melissa_init_writer(const char             *name,
   /* Parse options */
 
   int rank_step = 1;
+  long subsample = 1;
   bool trace = false;
   bool dry_run = false;
 
@@ -317,6 +338,9 @@ fvm_to_melissa_init_writer(const char             *name,
         }
       }
 
+      else if ((l_opt > 10) && (strncmp(options + i1, "subsample=", 10) == 0))
+        subsample = atol(options + i1 + 10);
+
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
 
     }
@@ -345,6 +369,8 @@ fvm_to_melissa_init_writer(const char             *name,
 
   w->buffer_size = 0;
 
+  w->subsample = (subsample > 1) ? (cs_gnum_t)subsample : 1;
+
   w->f_map = cs_map_name_to_id_create();
   w->f_ts = NULL;
 
@@ -355,6 +381,7 @@ fvm_to_melissa_init_writer(const char             *name,
     w->min_block_size = 1024*1024*8;
     w->block_comm = MPI_COMM_NULL;
     w->comm = MPI_COMM_NULL;
+    w->own_block_comm = false;
     MPI_Initialized(&mpi_flag);
     if (mpi_flag && comm != MPI_COMM_NULL) {
       w->comm = comm;
@@ -370,7 +397,15 @@ fvm_to_melissa_init_writer(const char             *name,
 #if defined(HAVE_MELISSA_MPI)
       w->min_rank_step = rank_step;
       if (rank_step > 1) {
-        w->block_comm = cs_base_get_rank_step_comm(rank_step);
+        /* Build from the given communicator, as it may be different from
+           the main communicator (when output is asynchronous) */
+        if (comm == cs_glob_mpi_comm)
+          w->block_comm = cs_base_get_rank_step_comm(rank_step);
+        else {
+          int color = (rank % rank_step == 0) ? 0 : MPI_UNDEFINED;
+          MPI_Comm_split(comm, color, rank, &(w->block_comm));
+          w->own_block_comm = true;
+        }
       }
       else
         w->block_comm = comm;
@@ -447,6 +482,11 @@ fvm_to_melissa_finalize_writer(void  *this_writer_p)
   if (w->dry_run == false)
     melissa_finalize();
 
+#if defined(HAVE_MPI)
+  if (w->own_block_comm && w->block_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(w->block_comm));
+#endif
+
   BFT_FREE(w);
 
   return NULL;
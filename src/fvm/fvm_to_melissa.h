@@ -61,6 +61,8 @@ BEGIN_C_DECLS
  *   dry_run               trace output to <name>.log file, but do not
  *                         actually communicate with Melissa server
  *   rank_step=<integer>   MPI rank step
+ *   subsample=<integer>   only send values of one element out of the
+ *                         given number (based on global numbering)
  *   trace                 trace output to <name>.log file
  *
  * parameters:
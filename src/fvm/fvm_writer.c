@@ -81,6 +81,10 @@
 #include "fvm_to_melissa.h"
 #endif
 
+#if defined(HAVE_ADIOS2) && !defined(HAVE_PLUGIN_ADIOS2)
+#include "fvm_to_adios2.h"
+#endif
+
 /*----------------------------------------------------------------------------*/
 
 BEGIN_C_DECLS
@@ -107,9 +111,9 @@ BEGIN_C_DECLS
 
 /* Number and status of defined formats */
 
-static const int _fvm_writer_n_formats = 10;
+static const int _fvm_writer_n_formats = 11;
 
-static fvm_writer_format_t _fvm_writer_format_list[10] = {
+static fvm_writer_format_t _fvm_writer_format_list[11] = {
 
   /* Built-in EnSight Gold writer */
   {
@@ -422,6 +426,51 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     NULL,
     NULL,
     NULL
+#endif
+  },
+
+  /* ADIOS2 writer */
+  {
+    "ADIOS2",
+    "2.9 +",
+    (  FVM_WRITER_FORMAT_USE_EXTERNAL
+     | FVM_WRITER_FORMAT_HAS_POLYGON
+     | FVM_WRITER_FORMAT_HAS_POLYHEDRON
+     | FVM_WRITER_FORMAT_SEPARATE_MESHES),
+    FVM_WRITER_TRANSIENT_CONNECT,
+#if !defined(HAVE_ADIOS2) || defined(HAVE_PLUGIN_ADIOS2)
+    0,                                 /* dynamic library count */
+    NULL,                              /* dynamic library */
+#if defined(HAVE_ADIOS2)
+    "fvm_adios2",                      /* dynamic library name */
+    "fvm_to_adios2_",                  /* dynamic library prefix */
+#else
+    NULL,
+    NULL,
+#endif
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+#else
+    0,                                 /* dynamic library count */
+    NULL,                              /* dynamic library */
+    NULL,                              /* dynamic library name */
+    NULL,                              /* dynamic library prefix */
+    fvm_to_adios2_n_version_strings,   /* n_version_strings_func */
+    fvm_to_adios2_version_string,      /* version_string_func */
+    fvm_to_adios2_init_writer,         /* init_func */
+    fvm_to_adios2_finalize_writer,     /* finalize_func */
+    fvm_to_adios2_set_mesh_time,       /* set_mesh_time_func */
+    fvm_to_adios2_needs_tesselation,   /* needs_tesselation_func */
+    fvm_to_adios2_export_nodal,        /* export_nodal_func */
+    fvm_to_adios2_export_field,        /* export_field_func */
+    fvm_to_adios2_flush                /* flush_func */
 #endif
   }
 
@@ -667,7 +716,7 @@ _format_writer_init(fvm_writer_t  *this_writer,
         dir_err = cs_file_mkdir_default(this_writer->path);
 #if defined(HAVE_MPI)
       if (cs_glob_n_ranks > 1)
-        MPI_Bcast(&dir_err, 1, MPI_INT, 0, cs_glob_mpi_comm);
+        MPI_Bcast(&dir_err, 1, MPI_INT, 0, this_writer->comm);
 #endif
       if (dir_err == 1)
         tmp_path[0] = '\0';
@@ -723,7 +772,7 @@ _format_writer_init(fvm_writer_t  *this_writer,
                               path,
                               this_writer->options,
                               this_writer->time_dep,
-                              cs_glob_mpi_comm);
+                              this_writer->comm);
 #else
     format_writer = init_func(name,
                               path,
@@ -797,6 +846,172 @@ _find_or_add_format_writer(fvm_writer_t        *this_writer,
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
+/*----------------------------------------------------------------------------
+ * Create FVM mesh and field output writer structure, without initializing
+ * format-specific writers.
+ *
+ * parameters:
+ *   name            <-- base name of output
+ *   path            <-- optional directory name for output
+ *   format_name     <-- name of selected format (case-independent)
+ *   format_options  <-- options for the selected format (case-independent,
+ *                       whitespace or comma separated list)
+ *   time_dependency <-- indicates if and how meshes will change with time
+ *
+ * returns:
+ *   pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+static fvm_writer_t *
+_writer_create(const char             *name,
+               const char             *path,
+               const char             *format_name,
+               const char             *format_options,
+               fvm_writer_time_dep_t   time_dependency)
+{
+  int  i;
+  char  *tmp_options = NULL;
+  fvm_writer_t  *this_writer = NULL;
+  bool separate_meshes = false;
+
+  /* Find corresponding format and check coherency */
+
+  for (i = 0 ; i < _fvm_writer_n_formats ; i++)
+    if (strcmp(format_name, _fvm_writer_format_list[i].name) == 0)
+      break;
+
+  if (i >= _fvm_writer_n_formats)
+    i = fvm_writer_get_format_id(format_name);
+
+  if (i < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Format type \"%s\" required for case \"%s\" is unknown"),
+              format_name, name);
+
+  if (!fvm_writer_format_available(i))
+    bft_error(__FILE__, __LINE__, 0,
+              _("Format type \"%s\" required for case \"%s\" is not available"),
+              format_name, name);
+
+  tmp_options = _fvm_writer_option_list(format_options);
+
+  /* Parse top-level options (consuming those handled here);
+     the options string now contains options separated by a single
+     whitespace. */
+
+  if (tmp_options != NULL) {
+
+    int i0 = 0, i1;
+
+    while (tmp_options[i0] != '\0') {
+
+      for (i1 = i0; tmp_options[i1] != '\0' && tmp_options[i1] != ' '; i1++);
+      int l_opt = i1 - i0;
+
+      if (   (l_opt == 15)
+          && (strncmp(tmp_options + i0, "separate_meshes", l_opt) == 0)) {
+        separate_meshes = true;
+        if (tmp_options[i1] == ' ')
+          strcpy(tmp_options + i0, tmp_options + i1 + 1);
+        else {
+          if (i0 > 1) {
+            assert(tmp_options[i0-1] = ' ');
+            i0--;
+          }
+          tmp_options[i0] = '\0';
+        }
+      }
+      else {
+        i0 = i1;
+        if (tmp_options[i0] == ' ')
+          i0++;
+      }
+
+      i1 = strlen(tmp_options);
+      if (i1 > 0)
+        BFT_REALLOC(tmp_options, i1+1, char);
+      else {
+        BFT_FREE(tmp_options);
+        break;
+      }
+
+    }
+
+  }
+
+  /* Initialize writer */
+
+  BFT_MALLOC(this_writer, 1, fvm_writer_t);
+
+  BFT_MALLOC(this_writer->name, strlen(name) + 1, char);
+  strcpy(this_writer->name, name);
+
+  this_writer->format = &(_fvm_writer_format_list[i]);
+
+  /* Load plugin if required */
+
+#if defined(HAVE_DLOPEN)
+  if (this_writer->format->dl_name != NULL)
+    _load_plugin(this_writer->format);
+#endif
+
+  if (path) {
+    BFT_MALLOC(this_writer->path, strlen(path) + 1, char);
+    strcpy(this_writer->path, path);
+  }
+  else
+    this_writer->path = NULL;
+
+  this_writer->options = tmp_options;
+  tmp_options = NULL;
+
+  this_writer->time_dep = CS_MIN(time_dependency,
+                                 this_writer->format->max_time_dep);
+
+  CS_TIMER_COUNTER_INIT(this_writer->mesh_time);
+  CS_TIMER_COUNTER_INIT(this_writer->field_time);
+  CS_TIMER_COUNTER_INIT(this_writer->flush_time);
+
+  if (this_writer->format->info_mask & FVM_WRITER_FORMAT_SEPARATE_MESHES)
+    separate_meshes = true;
+  else if (  this_writer->format->info_mask
+           & FVM_WRITER_FORMAT_NO_SEPARATE_MESHES)
+    separate_meshes = false;
+
+  if (separate_meshes)
+    this_writer->n_format_writers = 0; /* Delay construction */
+  else
+    this_writer->n_format_writers = 1;
+
+  this_writer->mesh_names = NULL;
+
+  this_writer->format_writer = NULL;
+
+#if defined(HAVE_MPI)
+  this_writer->comm = cs_glob_mpi_comm;
+#endif
+
+  return this_writer;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize format-specific writer of a FVM mesh and field output writer,
+ * unless construction is delayed (separate meshes).
+ *
+ * parameters:
+ *   this_writer <-> pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+static void
+_writer_start(fvm_writer_t  *this_writer)
+{
+  if  (this_writer->n_format_writers > 0) {
+    BFT_MALLOC(this_writer->format_writer, 1, void *);
+    this_writer->format_writer[0] = _format_writer_init(this_writer,
+                                                        NULL);
+  }
+}
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -848,6 +1063,8 @@ fvm_writer_get_format_id(const char  *format_name)
     strcpy(closest_name, "CCM-IO");
   else if (strncmp(tmp_name, "melissa", 7) == 0)
     strcpy(closest_name, "Melissa");
+  else if (strncmp(tmp_name, "adios", 5) == 0)
+    strcpy(closest_name, "ADIOS2");
   else
     strcpy(closest_name, tmp_name);
 
@@ -1074,6 +1291,7 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
  *   separate_meshes     use a different writer for each mesh
+ *   rank_step=<n>       MPI rank step between output ranks (EnSight)
  *
  * parameters:
  *   name            <-- base name of output
@@ -1095,137 +1313,67 @@ fvm_writer_init(const char             *name,
                 const char             *format_options,
                 fvm_writer_time_dep_t   time_dependency)
 {
-  int  i;
-  char  *tmp_options = NULL;
-  fvm_writer_t  *this_writer = NULL;
-  bool separate_meshes = false;
-
-  /* Find corresponding format and check coherency */
-
-  for (i = 0 ; i < _fvm_writer_n_formats ; i++)
-    if (strcmp(format_name, _fvm_writer_format_list[i].name) == 0)
-      break;
-
-  if (i >= _fvm_writer_n_formats)
-    i = fvm_writer_get_format_id(format_name);
+  fvm_writer_t  *this_writer = _writer_create(name,
+                                              path,
+                                              format_name,
+                                              format_options,
+                                              time_dependency);
 
-  if (i < 0)
-    bft_error(__FILE__, __LINE__, 0,
-              _("Format type \"%s\" required for case \"%s\" is unknown"),
-              format_name, name);
+  _writer_start(this_writer);
 
-  if (!fvm_writer_format_available(i))
-    bft_error(__FILE__, __LINE__, 0,
-              _("Format type \"%s\" required for case \"%s\" is not available"),
-              format_name, name);
-
-  tmp_options = _fvm_writer_option_list(format_options);
-
-  /* Parse top-level options (consuming those handled here);
-     the options string now contains options separated by a single
-     whitespace. */
-
-  if (tmp_options != NULL) {
-
-    int i0 = 0, i1;
-
-    while (tmp_options[i0] != '\0') {
-
-      for (i1 = i0; tmp_options[i1] != '\0' && tmp_options[i1] != ' '; i1++);
-      int l_opt = i1 - i0;
-
-      if (   (l_opt == 15)
-          && (strncmp(tmp_options + i0, "separate_meshes", l_opt) == 0)) {
-        separate_meshes = true;
-        if (tmp_options[i1] == ' ')
-          strcpy(tmp_options + i0, tmp_options + i1 + 1);
-        else {
-          if (i0 > 1) {
-            assert(tmp_options[i0-1] = ' ');
-            i0--;
-          }
-          tmp_options[i0] = '\0';
-        }
-      }
-      else {
-        i0 = i1;
-        if (tmp_options[i0] == ' ')
-          i0++;
-      }
-
-      i1 = strlen(tmp_options);
-      if (i1 > 0)
-        BFT_REALLOC(tmp_options, i1+1, char);
-      else {
-        BFT_FREE(tmp_options);
-        break;
-      }
-
-    }
-
-  }
-
-  /* Initialize writer */
-
-  BFT_MALLOC(this_writer, 1, fvm_writer_t);
-
-  BFT_MALLOC(this_writer->name, strlen(name) + 1, char);
-  strcpy(this_writer->name, name);
-
-  this_writer->format = &(_fvm_writer_format_list[i]);
-
-  /* Load plugin if required */
-
-#if defined(HAVE_DLOPEN)
-  if (this_writer->format->dl_name != NULL)
-    _load_plugin(this_writer->format);
-#endif
-
-  if (path) {
-    BFT_MALLOC(this_writer->path, strlen(path) + 1, char);
-    strcpy(this_writer->path, path);
-  }
-  else
-    this_writer->path = NULL;
-
-  this_writer->options = tmp_options;
-  tmp_options = NULL;
-
-  this_writer->time_dep = CS_MIN(time_dependency,
-                                 this_writer->format->max_time_dep);
-
-  CS_TIMER_COUNTER_INIT(this_writer->mesh_time);
-  CS_TIMER_COUNTER_INIT(this_writer->field_time);
-  CS_TIMER_COUNTER_INIT(this_writer->flush_time);
+  /* Return pointer to initialized writer */
 
-  if (this_writer->format->info_mask & FVM_WRITER_FORMAT_SEPARATE_MESHES)
-    separate_meshes = true;
-  else if (  this_writer->format->info_mask
-           & FVM_WRITER_FORMAT_NO_SEPARATE_MESHES)
-    separate_meshes = false;
+  return this_writer;
+}
 
-  if (separate_meshes)
-    this_writer->n_format_writers = 0; /* Delay construction */
-  else
-    this_writer->n_format_writers = 1;
+#if defined(HAVE_MPI)
 
-  this_writer->mesh_names = NULL;
+/*----------------------------------------------------------------------------
+ * Initialize FVM mesh and field output writer using a given communicator.
+ *
+ * This is similar to fvm_writer_init(), except that the writer uses
+ * the given communicator (which must contain the same ranks, in the same
+ * order, as cs_glob_mpi_comm) instead of cs_glob_mpi_comm. This allows
+ * output to be handled by a separate thread, using a duplicated
+ * communicator.
+ *
+ * parameters:
+ *   name            <-- base name of output
+ *   path            <-- optional directory name for output
+ *                       (directory automatically created if necessary)
+ *   format_name     <-- name of selected format (case-independent)
+ *   format_options  <-- options for the selected format (case-independent,
+ *                       whitespace or comma separated list)
+ *   time_dependency <-- indicates if and how meshes will change with time
+ *   comm            <-- associated MPI communicator
+ *
+ * returns:
+ *   pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
 
-  /* Initialize format-specific writer */
+fvm_writer_t *
+fvm_writer_init_comm(const char             *name,
+                     const char             *path,
+                     const char             *format_name,
+                     const char             *format_options,
+                     fvm_writer_time_dep_t   time_dependency,
+                     MPI_Comm                comm)
+{
+  fvm_writer_t  *this_writer = _writer_create(name,
+                                              path,
+                                              format_name,
+                                              format_options,
+                                              time_dependency);
 
-  if  (this_writer->n_format_writers > 0) {
-    BFT_MALLOC(this_writer->format_writer, 1, void *);
-    this_writer->format_writer[0] = _format_writer_init(this_writer,
-                                                        NULL);
-  }
-  else
-    this_writer->format_writer = NULL;
+  this_writer->comm = comm;
 
-  /* Return pointer to initialized writer */
+  _writer_start(this_writer);
 
   return this_writer;
 }
 
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Finalize FVM mesh and field output writer.
  *
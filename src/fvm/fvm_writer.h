@@ -219,6 +219,7 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
  *   separate_meshes     use a different writer for each mesh
+ *   rank_step=<n>       MPI rank step between output ranks (EnSight)
  *
  * parameters:
  *   name            <-- base name of output
@@ -240,6 +241,41 @@ fvm_writer_init(const char             *name,
                 const char             *format_options,
                 fvm_writer_time_dep_t   time_dependency);
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM mesh and field output writer using a given communicator.
+ *
+ * This is similar to fvm_writer_init(), except that the writer uses
+ * the given communicator (which must contain the same ranks, in the same
+ * order, as cs_glob_mpi_comm) instead of cs_glob_mpi_comm. This allows
+ * output to be handled by a separate thread, using a duplicated
+ * communicator.
+ *
+ * parameters:
+ *   name            <-- base name of output
+ *   path            <-- optional directory name for output
+ *                       (directory automatically created if necessary)
+ *   format_name     <-- name of selected format (case-independent)
+ *   format_options  <-- options for the selected format (case-independent,
+ *                       whitespace or comma separated list)
+ *   time_dependency <-- indicates if and how meshes will change with time
+ *   comm            <-- associated MPI communicator
+ *
+ * returns:
+ *   pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+fvm_writer_t *
+fvm_writer_init_comm(const char             *name,
+                     const char             *path,
+                     const char             *format_name,
+                     const char             *format_options,
+                     fvm_writer_time_dep_t   time_dependency,
+                     MPI_Comm                comm);
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Finalize FVM mesh and field output writer.
  *
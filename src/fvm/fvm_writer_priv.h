@@ -184,6 +184,10 @@ struct _fvm_writer_t {
   cs_timer_counter_t      field_time;        /* Fields output timer */
   cs_timer_counter_t      flush_time;        /* output "completion" timer */
 
+#if defined(HAVE_MPI)
+  MPI_Comm                comm;              /* associated MPI communicator */
+#endif
+
 };
 
 /*----------------------------------------------------------------------------*/
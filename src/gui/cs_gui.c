@@ -154,6 +154,8 @@ BEGIN_C_DECLS
 static void
 _tree_node_remove(cs_tree_node_t  *tn)
 {
+  cs_tree_index_clear();
+
   if (tn->prev != NULL)
     tn->prev->next = tn->next;
   if (tn->next != NULL)
@@ -1194,6 +1196,8 @@ _ensure_zones_order(void)
     tn_tail->next = tn_parent->children;
     tn_parent->children = tn_head;
 
+    cs_tree_index_clear();
+
     BFT_FREE(order);
     BFT_FREE(z_ids);
   }
@@ -1286,6 +1290,8 @@ _ensure_zones_order(void)
     tn_tail->next = tn_parent->children;
     tn_parent->children = tn_head;
 
+    cs_tree_index_clear();
+
     BFT_FREE(order);
     BFT_FREE(tn_bcs);
   }
@@ -3813,6 +3819,8 @@ cs_gui_linear_solvers(void)
         sles_it_type = CS_SLES_FCG;
       else if (cs_gui_strcmp(algo_choice, "inexact_conjugate_gradient"))
         sles_it_type = CS_SLES_IPCG;
+      else if (cs_gui_strcmp(algo_choice, "pipelined_conjugate_gradient"))
+        sles_it_type = CS_SLES_PIPELINED_PCG;
       else if (cs_gui_strcmp(algo_choice, "jacobi"))
         sles_it_type = CS_SLES_JACOBI;
       else if (cs_gui_strcmp(algo_choice, "bi_cgstab"))
@@ -3821,6 +3829,8 @@ cs_gui_linear_solvers(void)
         sles_it_type = CS_SLES_BICGSTAB2;
       else if (cs_gui_strcmp(algo_choice, "gmres"))
         sles_it_type = CS_SLES_GMRES;
+      else if (cs_gui_strcmp(algo_choice, "s_step_gmres"))
+        sles_it_type = CS_SLES_S_STEP_GMRES;
       else if (cs_gui_strcmp(algo_choice, "gauss_seidel"))
         sles_it_type = CS_SLES_P_GAUSS_SEIDEL;
       else if (cs_gui_strcmp(algo_choice, "symmetric_gauss_seidel"))
@@ -3932,6 +3942,8 @@ cs_gui_parallel_io(void)
         m = CS_FILE_STDIO_SERIAL;
       else if (!strcmp(method_name, "stdio parallel"))
         m = CS_FILE_STDIO_PARALLEL;
+      else if (!strcmp(method_name, "mmap"))
+        m = CS_FILE_MMAP;
       else if (!strcmp(method_name, "mpi independent"))
         m = CS_FILE_MPI_INDEPENDENT;
       else if (!strcmp(method_name, "mpi noncollective"))
@@ -4086,6 +4098,8 @@ cs_gui_mpi_algorithms(void)
       a = CS_ALL_TO_ALL_MPI_DEFAULT;
     else if (!strcmp(all_to_all_name, "crystal router"))
       a = CS_ALL_TO_ALL_CRYSTAL_ROUTER;
+    else if (!strcmp(all_to_all_name, "automatic"))
+      a = CS_ALL_TO_ALL_AUTO;
     cs_all_to_all_set_type(a);
   }
 }
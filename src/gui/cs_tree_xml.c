@@ -674,10 +674,10 @@ void
 cs_tree_xml_read(cs_tree_node_t  *r,
                  const char       path[])
 {
-  /* Read buffer */
+  /* The file is read and parsed on rank 0 only, to a temporary root
+     so that only the new branches are broadcast to other ranks */
 
-  cs_xml_t *doc = NULL;
-  BFT_MALLOC(doc, 1, cs_xml_t);
+  cs_tree_node_t *tr = cs_tree_node_create(NULL);
 
   cs_gnum_t f_size;
   if (cs_glob_rank_id < 1)
@@ -688,40 +688,82 @@ cs_tree_xml_read(cs_tree_node_t  *r,
     bft_error(__FILE__, __LINE__, 0,
               _("File \"%s\" seems empty."), path);
 
-  doc->size = f_size;
-  BFT_MALLOC(doc->buf, doc->size + 1, char);
-  doc->buffer_name = path;
-  doc->byte = 0;
-  doc->line = 1;
-  doc->s_char = '\0';
-  doc->depth = 0;
-  doc->have_attrs = false;
-  doc->first = true;
-  doc->node = r;
-  doc->parent = NULL;
+  if (cs_glob_rank_id < 1) {
+
+    /* Read buffer */
+
+    cs_xml_t *doc = NULL;
+    BFT_MALLOC(doc, 1, cs_xml_t);
+
+    doc->size = f_size;
+    BFT_MALLOC(doc->buf, doc->size + 1, char);
+    doc->buffer_name = path;
+    doc->byte = 0;
+    doc->line = 1;
+    doc->s_char = '\0';
+    doc->depth = 0;
+    doc->have_attrs = false;
+    doc->first = true;
+    doc->node = tr;
+    doc->parent = NULL;
+
+#if defined(HAVE_MPI)
+    cs_file_t *f = cs_file_open(path,
+                                CS_FILE_MODE_READ,
+                                CS_FILE_STDIO_SERIAL,
+                                MPI_INFO_NULL,
+                                MPI_COMM_NULL,
+                                MPI_COMM_NULL);
+#else
+    cs_file_t *f = cs_file_open(path,
+                                CS_FILE_MODE_READ,
+                                CS_FILE_STDIO_SERIAL);
+#endif
+    cs_file_read_global(f, doc->buf, 1, f_size);
+    f = cs_file_free(f);
 
-  cs_file_t *f = cs_file_open_serial(path, CS_FILE_MODE_READ);
-  cs_file_read_global(f, doc->buf, 1, f_size);
-  f = cs_file_free(f);
+    doc->buf[doc->size] = '\0';
 
-  doc->buf[doc->size] = '\0';
+    /* Now parse buffer */
 
-  /* Now parse buffer */
+    {
+      /* Read XML header */
+      _read_header(doc);
 
-  {
-    /* Read XML header */
-    _read_header(doc);
+      /* Now parse tree */
 
-    /* Now parse tree */
+      const char *s = NULL;
+      do {
+        s = _read_element(doc);
+      } while (s != NULL);
+    }
+
+    BFT_FREE(doc->buf);
+    BFT_FREE(doc);
+
+  }
 
-    const char *s = NULL;
-    do {
-      s = _read_element(doc);
-    } while (s != NULL);
+  cs_tree_bcast_children(0, tr);
+
+  /* Move branches to the root node */
+
+  if (tr->children != NULL) {
+    cs_tree_node_t *tn_tail = r->children;
+    if (tn_tail != NULL) {
+      while (tn_tail->next != NULL)
+        tn_tail = tn_tail->next;
+      tn_tail->next = tr->children;
+      tr->children->prev = tn_tail;
+    }
+    else
+      r->children = tr->children;
+    for (cs_tree_node_t *tn = tr->children; tn != NULL; tn = tn->next)
+      tn->parent = r;
+    tr->children = NULL;
+    cs_tree_index_clear();
   }
 
-  BFT_FREE(doc->buf);
-  BFT_FREE(doc);
+  cs_tree_node_free(&tr);
 
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
   cs_tree_dump(CS_LOG_DEFAULT, 0, r);
@@ -390,6 +390,11 @@ static cs_lagr_coal_comb_t _lagr_coal_comb
 static cs_lagr_zone_data_t  *_boundary_conditions = NULL;
 static cs_lagr_zone_data_t  *_volume_conditions = NULL;
 
+/* agglomeration/fragmentation lookup of new parcels by class
+   (kept between cells and time steps to avoid reallocations) */
+
+static cs_lagr_agglo_class_bins_t  *_agglo_class_bins = NULL;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -981,6 +986,11 @@ _update_boundary_face_type(void)
 
     BFT_FREE(bc_flag);
   }
+
+  /* Near-wall cell data for the deposition model */
+
+  if (cs_glob_lagr_model->deposition > 0)
+    cs_lagr_tracking_update_wall_cells();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1204,6 +1214,14 @@ cs_lagr_finalize(void)
 
   cs_lagr_stat_finalize();
 
+  /* Injection */
+
+  cs_lagr_injection_finalize();
+
+  /* Agglomeration and fragmentation */
+
+  cs_lagr_agglo_class_bins_destroy(&_agglo_class_bins);
+
   /* Also close log file (TODO move this) */
 
   cs_lagr_print_finalize();
@@ -1715,6 +1733,8 @@ cs_lagr_solve_initialize(const cs_real_t  *dt)
 {
   CS_UNUSED(dt);
 
+  bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_LAGRANGIAN);
+
   /* Allocate pressure and velocity gradients */
   cs_lagr_extra_module_t *extra = cs_glob_lagr_extra_module;
   cs_lnum_t ncelet = cs_glob_mesh->n_cells_with_ghosts;
@@ -1764,6 +1784,8 @@ cs_lagr_solve_initialize(const cs_real_t  *dt)
   /* Read statistics restart data */
 
   cs_lagr_stat_restart_read();
+
+  bft_mem_tag_end(mem_tag);
 }
 
 /*----------------------------------------------------------------------------
@@ -1796,6 +1818,8 @@ cs_lagr_solve_time_step(const int         itypfb[],
   cs_real_t *surfbo = cs_glob_mesh_quantities->b_face_surf;
   cs_real_t *surfbn = cs_glob_mesh_quantities->b_face_normal;
 
+  bft_mem_tag_t mem_tag = bft_mem_tag_begin(BFT_MEM_TAG_LAGRANGIAN);
+
   /* Allocate arrays depending on user options */
 
   cs_real_t *tempp = NULL;
@@ -2329,6 +2353,9 @@ cs_lagr_solve_time_step(const int         itypfb[],
 
         cs_lnum_t enter_parts = p_set->n_particles;
 
+        if (_agglo_class_bins == NULL)
+          _agglo_class_bins = cs_lagr_agglo_class_bins_create();
+
         /* Loop on all cells that contain at least one particle */
         for (cs_lnum_t icell = 0; icell < n_occupied_cells; ++icell) {
 
@@ -2347,7 +2374,8 @@ cs_lagr_solve_time_step(const int         itypfb[],
                                   dt[0],
                                   minimum_particle_diam,
                                   start_part,
-                                  end_part);
+                                  end_part,
+                                  _agglo_class_bins);
           }
 
           /* Save number of created particles */
@@ -2403,7 +2431,8 @@ cs_lagr_solve_time_step(const int         itypfb[],
                                   start_part,
                                   end_part - deleted_parts,
                                   init_particles,
-                                  p_set->n_particles);
+                                  p_set->n_particles,
+                                  _agglo_class_bins);
           }
           cs_lnum_t inserted_parts_frag = p_set->n_particles - init_particles;
 
@@ -2417,7 +2446,8 @@ cs_lagr_solve_time_step(const int         itypfb[],
         cs_lagr_new_v(p_set,
                       n_occupied_cells,
                       occupied_cell_ids,
-                      cell_particle_idx);
+                      cell_particle_idx,
+                      NULL);
         p_set->n_particles += cell_particle_idx[n_occupied_cells];
 
         BFT_FREE(cell_particle_idx);
@@ -2681,6 +2711,8 @@ cs_lagr_solve_time_step(const int         itypfb[],
       || lagr_model->roughness == 1
       || lagr_model->dlvo == 1)
     BFT_FREE(tempp);
+
+  bft_mem_tag_end(mem_tag);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -97,6 +97,27 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Lookup structure for new parcels by agglomeration class */
+
+struct _cs_lagr_agglo_class_bins_t {
+
+  cs_lnum_t   n_slots;         /* number of hash table slots (power of 2) */
+  cs_lnum_t   n_classes;       /* number of classes present */
+  cs_lnum_t   n_parcels;       /* number of binned parcels */
+  cs_lnum_t   n_parcels_max;   /* allocated number of parcels */
+
+  cs_lnum_t  *slot_class;      /* class associated with each slot, or -1 */
+  cs_lnum_t  *slot_head;       /* first parcel of each slot */
+  cs_lnum_t  *slot_tail;       /* last parcel of each slot */
+  cs_lnum_t  *used_slot;       /* ids of used slots (size: n_slots/2) */
+  cs_lnum_t  *next;            /* next parcel of same class, or -1 */
+
+};
+
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
@@ -286,12 +307,266 @@ _gaps_classes(cs_lnum_2_t  *array,
   return 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the hash table slot associated with a given class.
+ *
+ * Open addressing with linear probing is used; the returned slot
+ * either contains the given class, or is empty.
+ *
+ * \param[in]  class_bins  pointer to class lookup structure
+ * \param[in]  class_id    agglomeration class
+ *
+ * \return  slot id
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_class_bins_slot(const cs_lagr_agglo_class_bins_t  *class_bins,
+                 cs_lnum_t                          class_id)
+{
+  const cs_lnum_t mask = class_bins->n_slots - 1;
+
+  /* Multiplicative (Fibonacci) hashing */
+
+  cs_lnum_t s_id = ((uint32_t)class_id * 2654435761u) & mask;
+
+  while (   class_bins->slot_class[s_id] > -1
+         && class_bins->slot_class[s_id] != class_id)
+    s_id = (s_id + 1) & mask;
+
+  return s_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Resize the hash table of a class lookup structure.
+ *
+ * \param[in, out]  class_bins  pointer to class lookup structure
+ * \param[in]       n_slots     new number of slots (power of 2)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_class_bins_resize(cs_lagr_agglo_class_bins_t  *class_bins,
+                   cs_lnum_t                    n_slots)
+{
+  const cs_lnum_t n_classes = class_bins->n_classes;
+
+  cs_lnum_t *o_class = NULL, *o_head = NULL, *o_tail = NULL;
+  BFT_MALLOC(o_class, n_classes, cs_lnum_t);
+  BFT_MALLOC(o_head, n_classes, cs_lnum_t);
+  BFT_MALLOC(o_tail, n_classes, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_classes; i++) {
+    cs_lnum_t s_id = class_bins->used_slot[i];
+    o_class[i] = class_bins->slot_class[s_id];
+    o_head[i] = class_bins->slot_head[s_id];
+    o_tail[i] = class_bins->slot_tail[s_id];
+  }
+
+  class_bins->n_slots = n_slots;
+
+  BFT_REALLOC(class_bins->slot_class, n_slots, cs_lnum_t);
+  BFT_REALLOC(class_bins->slot_head, n_slots, cs_lnum_t);
+  BFT_REALLOC(class_bins->slot_tail, n_slots, cs_lnum_t);
+  BFT_REALLOC(class_bins->used_slot, n_slots/2, cs_lnum_t);
+
+  for (cs_lnum_t s_id = 0; s_id < n_slots; s_id++)
+    class_bins->slot_class[s_id] = -1;
+
+  for (cs_lnum_t i = 0; i < n_classes; i++) {
+    cs_lnum_t s_id = _class_bins_slot(class_bins, o_class[i]);
+    class_bins->slot_class[s_id] = o_class[i];
+    class_bins->slot_head[s_id] = o_head[i];
+    class_bins->slot_tail[s_id] = o_tail[i];
+    class_bins->used_slot[i] = s_id;
+  }
+
+  BFT_FREE(o_tail);
+  BFT_FREE(o_head);
+  BFT_FREE(o_class);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a lookup structure for new parcels by agglomeration class.
+ *
+ * This structure replaces linear searches among parcels created in a
+ * given cell by a hash table associating each class to the chained list
+ * of matching parcels (in creation order). It may be reused for
+ * successive cells and time steps, so as to avoid reallocations.
+ *
+ * \return  pointer to new structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lagr_agglo_class_bins_t *
+cs_lagr_agglo_class_bins_create(void)
+{
+  cs_lagr_agglo_class_bins_t *class_bins = NULL;
+
+  BFT_MALLOC(class_bins, 1, cs_lagr_agglo_class_bins_t);
+
+  class_bins->n_slots = 0;
+  class_bins->n_classes = 0;
+  class_bins->n_parcels = 0;
+  class_bins->n_parcels_max = 0;
+
+  class_bins->slot_class = NULL;
+  class_bins->slot_head = NULL;
+  class_bins->slot_tail = NULL;
+  class_bins->used_slot = NULL;
+  class_bins->next = NULL;
+
+  _class_bins_resize(class_bins, 64);
+
+  return class_bins;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a lookup structure for new parcels by agglomeration class.
+ *
+ * \param[in, out]  class_bins  pointer to structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_bins_destroy(cs_lagr_agglo_class_bins_t  **class_bins)
+{
+  if (class_bins != NULL) {
+    cs_lagr_agglo_class_bins_t *_class_bins = *class_bins;
+    if (_class_bins != NULL) {
+      BFT_FREE(_class_bins->slot_class);
+      BFT_FREE(_class_bins->slot_head);
+      BFT_FREE(_class_bins->slot_tail);
+      BFT_FREE(_class_bins->used_slot);
+      BFT_FREE(_class_bins->next);
+      BFT_FREE(*class_bins);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Empty a lookup structure for new parcels by agglomeration class.
+ *
+ * Only the entries used since the previous reset are cleared, so the
+ * cost is proportional to the number of binned parcels.
+ *
+ * \param[in, out]  class_bins  pointer to structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_bins_reset(cs_lagr_agglo_class_bins_t  *class_bins)
+{
+  for (cs_lnum_t i = 0; i < class_bins->n_classes; i++)
+    class_bins->slot_class[class_bins->used_slot[i]] = -1;
+
+  class_bins->n_classes = 0;
+  class_bins->n_parcels = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a parcel to a lookup structure by agglomeration class.
+ *
+ * Parcel ids are relative to the first new parcel, and must be added
+ * in increasing order starting from 0 after each reset.
+ *
+ * \param[in, out]  class_bins  pointer to structure
+ * \param[in]       class_id    agglomeration class of parcel
+ * \param[in]       parcel_id   parcel id
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_bins_add(cs_lagr_agglo_class_bins_t  *class_bins,
+                             cs_lnum_t                    class_id,
+                             cs_lnum_t                    parcel_id)
+{
+  assert(parcel_id == class_bins->n_parcels);
+  assert(class_id >= 0);
+
+  if (parcel_id >= class_bins->n_parcels_max) {
+    class_bins->n_parcels_max = CS_MAX(parcel_id + 1,
+                                       class_bins->n_parcels_max*2);
+    BFT_REALLOC(class_bins->next, class_bins->n_parcels_max, cs_lnum_t);
+  }
+
+  class_bins->next[parcel_id] = -1;
+  class_bins->n_parcels += 1;
+
+  /* Keep load factor below 1/2 */
+
+  if (2*(class_bins->n_classes + 1) > class_bins->n_slots)
+    _class_bins_resize(class_bins, class_bins->n_slots*2);
+
+  cs_lnum_t s_id = _class_bins_slot(class_bins, class_id);
+
+  if (class_bins->slot_class[s_id] < 0) {
+    class_bins->slot_class[s_id] = class_id;
+    class_bins->slot_head[s_id] = parcel_id;
+    class_bins->used_slot[class_bins->n_classes] = s_id;
+    class_bins->n_classes += 1;
+  }
+  else
+    class_bins->next[class_bins->slot_tail[s_id]] = parcel_id;
+
+  class_bins->slot_tail[s_id] = parcel_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the first parcel of a given agglomeration class.
+ *
+ * \param[in]  class_bins  pointer to structure
+ * \param[in]  class_id    agglomeration class
+ *
+ * \return  id of first parcel added with this class, or -1 if none
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_bins_first(const cs_lagr_agglo_class_bins_t  *class_bins,
+                               cs_lnum_t                          class_id)
+{
+  cs_lnum_t s_id = _class_bins_slot(class_bins, class_id);
+
+  if (class_bins->slot_class[s_id] < 0)
+    return -1;
+
+  return class_bins->slot_head[s_id];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the next parcel of the same agglomeration class.
+ *
+ * \param[in]  class_bins  pointer to structure
+ * \param[in]  parcel_id   current parcel id
+ *
+ * \return  id of next parcel added with the same class, or -1 if none
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_bins_next(const cs_lagr_agglo_class_bins_t  *class_bins,
+                              cs_lnum_t                          parcel_id)
+{
+  assert(parcel_id >= 0 && parcel_id < class_bins->n_parcels);
+
+  return class_bins->next[parcel_id];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Merge two sorted arrays in a third sorted array
@@ -376,6 +651,8 @@ cs_lagr_agglo_merge_arrays(cs_lnum_2_t  arr1[],
  * \param[in]  minimum_particle_diam  minumum diameter (monomere diameter)
  * \param[in]  start_particle         index of the first particle
  * \param[in]  end_particle           index after the last particle
+ * \param[in]  class_bins             lookup structure for new parcels
+ *                                    by class (work array)
  *
  * \returns a modified list of particles, containing newly
  *          created parcels at the end
@@ -383,11 +660,12 @@ cs_lagr_agglo_merge_arrays(cs_lnum_2_t  arr1[],
 /*----------------------------------------------------------------------------*/
 
 cs_lnum_t
-cs_lagr_agglomeration(cs_lnum_t  cell_id,
-                      cs_real_t  dt,
-                      cs_real_t  minimum_particle_diam,
-                      cs_lnum_t  start_particle,
-                      cs_lnum_t  end_particle)
+cs_lagr_agglomeration(cs_lnum_t                    cell_id,
+                      cs_real_t                    dt,
+                      cs_real_t                    minimum_particle_diam,
+                      cs_lnum_t                    start_particle,
+                      cs_lnum_t                    end_particle,
+                      cs_lagr_agglo_class_bins_t  *class_bins)
 {
   /* Initialisation */
   cs_lnum_t ret_val = 0;
@@ -415,6 +693,8 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
     return 0;
   }
 
+  cs_lagr_agglo_class_bins_reset(class_bins);
+
   /* Create local array (containing the class and particle index) */
   cs_lnum_2_t *interf;
 
@@ -565,15 +845,14 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
 
       cs_lnum_t add_to_end = 1;
 
-      for (cs_lnum_t indx = p_set->n_particles;
-          indx < p_set->n_particles + newpart;
-          indx++) {
-        cs_lnum_t stat_class
-          = cs_lagr_particles_get_lnum(p_set, indx, CS_LAGR_AGGLO_CLASS_ID);
+      for (cs_lnum_t k = cs_lagr_agglo_class_bins_first(class_bins,
+                                                         n_classes_new);
+           k > -1;
+           k = cs_lagr_agglo_class_bins_next(class_bins, k)) {
+        cs_lnum_t indx = p_set->n_particles + k;
         cs_real_t stat_weight
           = cs_lagr_particles_get_real(p_set, indx, CS_LAGR_STAT_WEIGHT);
-        if (   (stat_class == n_classes_new)
-            && (stat_weight + vp <= agglo_max_weight)) {
+        if (stat_weight + vp <= agglo_max_weight) {
           cs_lagr_particles_set_real(p_set, indx, CS_LAGR_STAT_WEIGHT,
                                      round(stat_weight)+vp);
 
@@ -623,6 +902,8 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
         cs_lagr_particles_set_lnum(p_set, inserted_parts-1,
                                    CS_LAGR_AGGLO_CLASS_ID, n_classes_new);
 
+        cs_lagr_agglo_class_bins_add(class_bins, n_classes_new, newpart-1);
+
         /* Set particle velocity */
 
         cs_real_t * inserted_vel
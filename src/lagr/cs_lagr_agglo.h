@@ -41,10 +41,107 @@
 
 BEGIN_C_DECLS
 
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Lookup structure for new parcels by agglomeration class (opaque) */
+
+typedef struct _cs_lagr_agglo_class_bins_t  cs_lagr_agglo_class_bins_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a lookup structure for new parcels by agglomeration class.
+ *
+ * This structure replaces linear searches among parcels created in a
+ * given cell by a hash table associating each class to the chained list
+ * of matching parcels (in creation order). It may be reused for
+ * successive cells and time steps, so as to avoid reallocations.
+ *
+ * \return  pointer to new structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lagr_agglo_class_bins_t *
+cs_lagr_agglo_class_bins_create(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a lookup structure for new parcels by agglomeration class.
+ *
+ * \param[in, out]  class_bins  pointer to structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_bins_destroy(cs_lagr_agglo_class_bins_t  **class_bins);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Empty a lookup structure for new parcels by agglomeration class.
+ *
+ * Only the entries used since the previous reset are cleared, so the
+ * cost is proportional to the number of binned parcels.
+ *
+ * \param[in, out]  class_bins  pointer to structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_bins_reset(cs_lagr_agglo_class_bins_t  *class_bins);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a parcel to a lookup structure by agglomeration class.
+ *
+ * Parcel ids are relative to the first new parcel, and must be added
+ * in increasing order starting from 0 after each reset.
+ *
+ * \param[in, out]  class_bins  pointer to structure
+ * \param[in]       class_id    agglomeration class of parcel
+ * \param[in]       parcel_id   parcel id
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_bins_add(cs_lagr_agglo_class_bins_t  *class_bins,
+                             cs_lnum_t                    class_id,
+                             cs_lnum_t                    parcel_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the first parcel of a given agglomeration class.
+ *
+ * \param[in]  class_bins  pointer to structure
+ * \param[in]  class_id    agglomeration class
+ *
+ * \return  id of first parcel added with this class, or -1 if none
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_bins_first(const cs_lagr_agglo_class_bins_t  *class_bins,
+                               cs_lnum_t                          class_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the next parcel of the same agglomeration class.
+ *
+ * \param[in]  class_bins  pointer to structure
+ * \param[in]  parcel_id   current parcel id
+ *
+ * \return  id of next parcel added with the same class, or -1 if none
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_bins_next(const cs_lagr_agglo_class_bins_t  *class_bins,
+                              cs_lnum_t                          parcel_id);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Merge two sorted arrays in a third sorted array
@@ -95,6 +192,8 @@ cs_lagr_agglo_merge_arrays(cs_lnum_2_t  arr1[],
  * \param[in]  minimum_particle_diam  minumum diameter (monomere diameter)
  * \param[in]  start_particle         index of the first particle
  * \param[in]  end_particle           index after the last particle
+ * \param[in]  class_bins             lookup structure for new parcels
+ *                                    by class (work array)
  *
  * \returns a modified list of particles, containing newly
  *          created parcels at the end
@@ -106,7 +205,8 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
                       cs_real_t  dt,
                       cs_real_t  minimum_particle_diam,
                       cs_lnum_t  start_particle,
-                      cs_lnum_t  end_particle);
+                      cs_lnum_t  end_particle,
+                      cs_lagr_agglo_class_bins_t  *class_bins);
 
 /*----------------------------------------------------------------------------*/
 
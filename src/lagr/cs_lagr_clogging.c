@@ -235,6 +235,7 @@ cs_lagr_clogging_barrier(const void                     *particle,
   int        contact_count[1];
   cs_real_t  value;
   cs_lnum_t  i;
+  cs_real_t  dist[101], var_edl[101];
 
   /* Computation of the number of particles in contact with */
   /* the depositing particle */
@@ -287,29 +288,31 @@ cs_lagr_clogging_barrier(const void                     *particle,
 
     /* Computation of the energy barrier */
 
-    for (i = 0; i < 101; i++) {
+    cs_real_t  step = cs_lagr_clogging_param.debye_length[iel]/30.0;
+
+    for (i = 0; i < 101; i++)
+      dist[i] = _d_cut_off + i*step;
 
-      cs_real_t  step = cs_lagr_clogging_param.debye_length[iel]/30.0;
+    cs_lagr_edl_sphere_plane_n(101,
+                               dist,
+                               depositing_radius,
+                               cs_lagr_clogging_param.valen,
+                               cs_lagr_clogging_param.phi_p,
+                               cs_lagr_clogging_param.phi_s,
+                               cs_lagr_clogging_param.temperature[iel],
+                               cs_lagr_clogging_param.debye_length[iel],
+                               cs_lagr_clogging_param.water_permit,
+                               var_edl);
 
-      cs_real_t distp = _d_cut_off + i*step;
+    for (i = 0; i < 101; i++) {
 
       cs_real_t var1
-        = cs_lagr_van_der_waals_sphere_plane(distp,
+        = cs_lagr_van_der_waals_sphere_plane(dist[i],
                                              depositing_radius,
                                              cs_lagr_clogging_param.lambda_vdw,
                                              cs_lagr_clogging_param.cstham);
 
-      cs_real_t var2
-        = cs_lagr_edl_sphere_plane(distp,
-                                   depositing_radius,
-                                   cs_lagr_clogging_param.valen,
-                                   cs_lagr_clogging_param.phi_p,
-                                   cs_lagr_clogging_param.phi_s,
-                                   cs_lagr_clogging_param.temperature[iel],
-                                   cs_lagr_clogging_param.debye_length[iel],
-                                   cs_lagr_clogging_param.water_permit);
-
-      cs_real_t var = var1 + var2;
+      cs_real_t var = var1 + var_edl[i];
 
       if (var > *energy_barrier)
         *energy_barrier = var;
@@ -326,32 +329,35 @@ cs_lagr_clogging_barrier(const void                     *particle,
     *energy_barrier = 0.0;
 
     /* Computation of the energy barrier */
-    for (i = 0; i < 101; i++) {
 
-      cs_real_t  step = cs_lagr_clogging_param.debye_length[iel]/30.0;
+    cs_real_t  step = cs_lagr_clogging_param.debye_length[iel]/30.0;
+
+    for (i = 0; i < 101; i++)
+      dist[i] =   _d_cut_off + i*step
+                + depositing_radius + deposited_radius;
 
-      cs_real_t distcc =   _d_cut_off + i*step
-                         + depositing_radius + deposited_radius;
+    cs_lagr_edl_sphere_sphere_n(101,
+                                dist,
+                                deposited_radius,
+                                depositing_radius,
+                                cs_lagr_clogging_param.valen,
+                                cs_lagr_clogging_param.phi_p,
+                                cs_lagr_clogging_param.phi_p,
+                                cs_lagr_clogging_param.temperature[iel],
+                                cs_lagr_clogging_param.debye_length[iel],
+                                cs_lagr_clogging_param.water_permit,
+                                var_edl);
+
+    for (i = 0; i < 101; i++) {
 
       cs_real_t var1
-        = cs_lagr_van_der_waals_sphere_sphere(distcc,
+        = cs_lagr_van_der_waals_sphere_sphere(dist[i],
                                               deposited_radius,
                                               depositing_radius,
                                               cs_lagr_clogging_param.lambda_vdw,
                                               cs_lagr_clogging_param.csthpp);
 
-      cs_real_t var2
-        = cs_lagr_edl_sphere_sphere(distcc,
-                                    deposited_radius,
-                                    depositing_radius,
-                                    cs_lagr_clogging_param.valen,
-                                    cs_lagr_clogging_param.phi_p,
-                                    cs_lagr_clogging_param.phi_p,
-                                    cs_lagr_clogging_param.temperature[iel],
-                                    cs_lagr_clogging_param.debye_length[iel],
-                                    cs_lagr_clogging_param.water_permit);
-
-      cs_real_t var = contact_count[0] * (var1 + var2);
+      cs_real_t var = contact_count[0] * (var1 + var_edl[i]);
 
       if (var > *energy_barrier)
         *energy_barrier = var;
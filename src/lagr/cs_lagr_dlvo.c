@@ -85,6 +85,16 @@ BEGIN_C_DECLS
 
 static cs_lagr_dlvo_param_t cs_lagr_dlvo_param;
 
+/* Distance-independent terms of EDL interactions */
+
+typedef struct {
+
+  cs_real_t  lphi1;   /* extended reduced zeta potential of first body */
+  cs_real_t  lphi2;   /* extended reduced zeta potential of second body */
+  cs_real_t  coeff;   /* leading constant factor */
+
+} cs_lagr_edl_coeffs_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -103,6 +113,196 @@ static const cs_real_t _free_space_permit = 8.854e-12;
 /* Faraday constant */
 static const cs_real_t _faraday_cst = 9.648e4;
 
+/* Elementary charge */
+static const cs_real_t _charge = 1.6e-19;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute the distance-independent terms of the EDL interaction
+ * between a sphere and a plane.
+ *
+ * parameters:
+ *   rpart         <-- particle radius
+ *   valen         <-- valency
+ *   phi1          <-- zeta potential of the particle
+ *   phi2          <-- zeta potential of the plane
+ *   temp          <-- temperature
+ *   debye_length  <-- Debye length
+ *   water_permit  <-- water permittivity
+ *
+ * returns:
+ *   associated coefficients
+ *----------------------------------------------------------------------------*/
+
+static inline cs_lagr_edl_coeffs_t
+_edl_sphere_plane_coeffs(cs_real_t  rpart,
+                         cs_real_t  valen,
+                         cs_real_t  phi1,
+                         cs_real_t  phi2,
+                         cs_real_t  temp,
+                         cs_real_t  debye_length,
+                         cs_real_t  water_permit)
+{
+  cs_lagr_edl_coeffs_t c;
+
+  /* Reduced zeta potential */
+  cs_real_t lphi1 =  valen * _charge * phi1 /  _k_boltzmann / temp;
+  cs_real_t lphi2 =  valen * _charge * phi2 /  _k_boltzmann / temp;
+
+  cs_real_t tau = rpart / debye_length;
+
+  /* Extended reduced zeta potential */
+  /* (following the work from Ohshima et al, 1982, JCIS, 90, 17-26) */
+
+  c.lphi1 = 8. * tanh(lphi1 / 4.) /
+           ( 1. + pow(1. - (2. * tau + 1.) / (pow(tau + 1,2))
+           * pow(tanh(lphi1 / 4.),2),0.5));
+
+  c.lphi2 = 4. * tanh(lphi2 / 4.) ;
+
+  c.coeff = 2 * _pi * _free_space_permit * water_permit
+          * pow((_k_boltzmann * temp / (1. * valen) / _charge),2)
+          * rpart;
+
+  return c;
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate the EDL interaction between a sphere and a plane
+ * using precomputed distance-independent terms.
+ *
+ * parameters:
+ *   c             <-- distance-independent terms
+ *   distp         <-- distance between the sphere and the plane
+ *   rpart         <-- particle radius
+ *   debye_length  <-- Debye length
+ *
+ * returns:
+ *   EDL interaction energy
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_edl_sphere_plane_eval(const cs_lagr_edl_coeffs_t  c,
+                       cs_real_t                   distp,
+                       cs_real_t                   rpart,
+                       cs_real_t                   debye_length)
+{
+  const cs_real_t lphi1 = c.lphi1, lphi2 = c.lphi2;
+
+  cs_real_t alpha =   sqrt((distp + rpart) / rpart)
+                    + sqrt(rpart / (distp + rpart));
+  cs_real_t omega1 = pow(lphi1,2) + pow(lphi2,2) + alpha * lphi1 * lphi2;
+  cs_real_t omega2 = pow(lphi1,2) + pow(lphi2,2) - alpha * lphi1 * lphi2;
+  cs_real_t gamma =   sqrt(rpart / (distp + rpart))
+                    * exp(-1./debye_length * distp);
+
+  cs_real_t var = c.coeff * (distp + rpart) / (distp + 2 * rpart)
+                  * (omega1 * log(1 + gamma) + omega2 * log(1 - gamma));
+
+  return var;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the distance-independent terms of the EDL interaction
+ * between two spheres.
+ *
+ * parameters:
+ *   rpart1        <-- radius of first sphere
+ *   rpart2        <-- radius of second sphere
+ *   valen         <-- valency
+ *   phi1          <-- zeta potential of first sphere
+ *   phi2          <-- zeta potential of second sphere
+ *   temp          <-- temperature
+ *   debye_length  <-- Debye length
+ *   water_permit  <-- water permittivity
+ *
+ * returns:
+ *   associated coefficients
+ *----------------------------------------------------------------------------*/
+
+static inline cs_lagr_edl_coeffs_t
+_edl_sphere_sphere_coeffs(cs_real_t  rpart1,
+                          cs_real_t  rpart2,
+                          cs_real_t  valen,
+                          cs_real_t  phi1,
+                          cs_real_t  phi2,
+                          cs_real_t  temp,
+                          cs_real_t  debye_length,
+                          cs_real_t  water_permit)
+{
+  cs_lagr_edl_coeffs_t c;
+
+  /* Reduced zeta potential */
+  cs_real_t lphi1 =  valen * _charge * phi1 /  _k_boltzmann / temp;
+  cs_real_t lphi2 =  valen * _charge * phi2 /  _k_boltzmann / temp;
+
+  /* Extended reduced zeta potential */
+  /* (following the work from Ohshima et al, 1982, JCIS, 90, 17-26) */
+
+  cs_real_t tau1 = rpart1 / debye_length;
+  c.lphi1 = 8. * tanh(lphi1 / 4.) /
+    ( 1. + pow(1. - (2. * tau1 + 1.) / (pow(tau1 + 1,2))
+               * pow(tanh(lphi1 / 4.),2),0.5));
+
+  cs_real_t tau2 = rpart2 / debye_length;
+  c.lphi2 = 8. * tanh(lphi2 / 4.) /
+         ( 1. + pow(1. - (2. * tau2 + 1.) / (pow(tau2 + 1,2))
+          * pow(tanh(lphi2 / 4.),2),0.5));
+
+  c.coeff = 2 * _pi * _free_space_permit * water_permit
+          * pow((_k_boltzmann * temp / _charge),2)
+          * rpart1 * rpart2;
+
+  return c;
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate the EDL interaction between two spheres
+ * using precomputed distance-independent terms.
+ *
+ * parameters:
+ *   c             <-- distance-independent terms
+ *   distcc        <-- distance between sphere centers
+ *   rpart1        <-- radius of first sphere
+ *   rpart2        <-- radius of second sphere
+ *   debye_length  <-- Debye length
+ *
+ * returns:
+ *   EDL interaction energy
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_edl_sphere_sphere_eval(const cs_lagr_edl_coeffs_t  c,
+                        cs_real_t                   distcc,
+                        cs_real_t                   rpart1,
+                        cs_real_t                   rpart2,
+                        cs_real_t                   debye_length)
+{
+  const cs_real_t lphi1 = c.lphi1, lphi2 = c.lphi2;
+
+  cs_real_t alpha =    sqrt(rpart2 * (distcc - rpart2)
+                    / (rpart1 * (distcc - rpart1)))
+                     + sqrt(rpart1 * (distcc - rpart1)
+                    / (rpart2 * (distcc - rpart2)));
+
+  cs_real_t omega1 = pow(lphi1,2) + pow(lphi2,2) + alpha * lphi1 * lphi2;
+
+  cs_real_t omega2 = pow(lphi1,2) + pow(lphi2,2) - alpha * lphi1 * lphi2;
+
+  cs_real_t gamma = sqrt(rpart1 * rpart2 / (distcc-rpart1) / (distcc-rpart2))
+                    *exp(1. / debye_length * (rpart1 + rpart2 - distcc));
+
+  cs_real_t var = c.coeff * (distcc - rpart1) * (distcc - rpart2)
+                  / (distcc * (  distcc * (rpart1  + rpart2)
+                               - pow(rpart1,2) - pow(rpart2,2)))
+                  * (omega1 * log(1 + gamma) + omega2 * log(1 - gamma));
+
+  return var;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -203,24 +403,31 @@ cs_lagr_barrier(const void                     *particle,
                 cs_lnum_t                       iel,
                 cs_real_t                      *energy_barrier)
 {
-  cs_lnum_t i;
   cs_real_t rpart = cs_lagr_particle_get_real(particle, attr_map,
                                               CS_LAGR_DIAMETER) * 0.5;
 
-  *energy_barrier = 0.;
+  const cs_real_t  debye_length = cs_lagr_dlvo_param.debye_length[iel];
+  const cs_real_t  step = debye_length/30.0;
 
-  cs_real_t barr = 0.;
-  cs_real_t distp = 0.;
+  const cs_lagr_edl_coeffs_t  edl_c
+    = _edl_sphere_plane_coeffs(rpart,
+                               cs_lagr_dlvo_param.valen,
+                               cs_lagr_dlvo_param.phi_p,
+                               cs_lagr_dlvo_param.phi_s,
+                               cs_lagr_dlvo_param.temperature[iel],
+                               debye_length,
+                               cs_lagr_dlvo_param.water_permit);
 
-  /* Computation of the energy barrier */
+  /* Computation of the energy barrier
+     (the maximum is initialized to 0, so it is never negative) */
 
-  for (i = 0; i < 1001; i++) {
+  cs_real_t barr_max = 0.;
 
-    cs_real_t  step = cs_lagr_dlvo_param.debye_length[iel]/30.0;
+  for (int i = 0; i < 1001; i++) {
 
     /* Interaction between the sphere and the plate */
 
-    distp = _d_cut_off + i * step;
+    cs_real_t distp = _d_cut_off + i * step;
 
     cs_real_t var1
       = cs_lagr_van_der_waals_sphere_plane(distp,
@@ -228,25 +435,15 @@ cs_lagr_barrier(const void                     *particle,
                                            cs_lagr_dlvo_param.lambda_vdw,
                                            cs_lagr_dlvo_param.cstham);
 
-    cs_real_t var2
-      = cs_lagr_edl_sphere_plane(distp,
-                                 rpart,
-                                 cs_lagr_dlvo_param.valen,
-                                 cs_lagr_dlvo_param.phi_p,
-                                 cs_lagr_dlvo_param.phi_s,
-                                 cs_lagr_dlvo_param.temperature[iel],
-                                 cs_lagr_dlvo_param.debye_length[iel],
-                                 cs_lagr_dlvo_param.water_permit);
-
-    barr = (var1 + var2);
-
-    if (barr >  *energy_barrier)
-      *energy_barrier = barr;
-    if ( *energy_barrier < 0)
-      *energy_barrier = 0;
-   }
-
-  *energy_barrier = *energy_barrier / rpart;
+    cs_real_t var2 = _edl_sphere_plane_eval(edl_c, distp, rpart, debye_length);
+
+    cs_real_t barr = (var1 + var2);
+
+    if (barr > barr_max)
+      barr_max = barr;
+  }
+
+  *energy_barrier = barr_max / rpart;
 }
 
 /*----------------------------------------------------------------------------
@@ -260,13 +457,25 @@ cs_lagr_barrier_pp(cs_real_t                       dpart,
 {
   cs_real_t rpart = dpart * 0.5;
 
-  *energy_barrier = 0.;
+  const cs_real_t  debye_length = cs_lagr_dlvo_param.debye_length[iel];
+  const cs_real_t  step = debye_length / 30.0;
 
-  /* Computation of the energy barrier */
+  const cs_lagr_edl_coeffs_t  edl_c
+    = _edl_sphere_sphere_coeffs(rpart,
+                                rpart,
+                                cs_lagr_dlvo_param.valen,
+                                cs_lagr_dlvo_param.phi_p,
+                                cs_lagr_dlvo_param.phi_p,
+                                cs_lagr_dlvo_param.temperature[iel],
+                                debye_length,
+                                cs_lagr_dlvo_param.water_permit);
 
-  for (int i = 0; i < 1001; i++) {
+  /* Computation of the energy barrier
+     (the maximum is initialized to 0, so it is never negative) */
 
-    cs_real_t step = cs_lagr_dlvo_param.debye_length[iel] / 30.0;
+  cs_real_t barr_max = 0.;
+
+  for (int i = 0; i < 1001; i++) {
 
     /* Interaction between two spheres */
 
@@ -279,26 +488,16 @@ cs_lagr_barrier_pp(cs_real_t                       dpart,
                                             cs_lagr_dlvo_param.lambda_vdw,
                                             cs_lagr_dlvo_param.csthpp);
 
-    cs_real_t var2
-      = cs_lagr_edl_sphere_sphere(distcc,
-                                  rpart,
-                                  rpart,
-                                  cs_lagr_dlvo_param.valen,
-                                  cs_lagr_dlvo_param.phi_p,
-                                  cs_lagr_dlvo_param.phi_p,
-                                  cs_lagr_dlvo_param.temperature[iel],
-                                  cs_lagr_dlvo_param.debye_length[iel],
-                                  cs_lagr_dlvo_param.water_permit);
+    cs_real_t var2 = _edl_sphere_sphere_eval(edl_c, distcc, rpart, rpart,
+                                             debye_length);
 
     cs_real_t barr = (var1 + var2);
 
-    if (barr >  *energy_barrier)
-      *energy_barrier = barr;
-    if (*energy_barrier < 0)
-      *energy_barrier = 0;
-   }
+    if (barr > barr_max)
+      barr_max = barr;
+  }
 
-  *energy_barrier = *energy_barrier / rpart;
+  *energy_barrier = barr_max / rpart;
 }
 
 /*----------------------------------------------------------------------------
@@ -370,35 +569,38 @@ cs_lagr_edl_sphere_plane(cs_real_t  distp,
                          cs_real_t  debye_length,
                          cs_real_t  water_permit)
 {
+  const cs_lagr_edl_coeffs_t  c
+    = _edl_sphere_plane_coeffs(rpart, valen, phi1, phi2, temp,
+                               debye_length, water_permit);
 
-  cs_real_t charge = 1.6e-19;
-  /* Reduced zeta potential */
-  cs_real_t lphi1 =  valen * charge * phi1 /  _k_boltzmann / temp;
-  cs_real_t lphi2 =  valen * charge * phi2 /  _k_boltzmann / temp;
-
-  cs_real_t tau = rpart / debye_length;
-
-  /* Extended reduced zeta potential */
-  /* (following the work from Ohshima et al, 1982, JCIS, 90, 17-26) */
-
-  lphi1 = 8. * tanh(lphi1 / 4.) /
-         ( 1. + pow(1. - (2. * tau + 1.) / (pow(tau + 1,2))
-         * pow(tanh(lphi1 / 4.),2),0.5));
-
-  lphi2 = 4. * tanh(lphi2 / 4.) ;
+  return _edl_sphere_plane_eval(c, distp, rpart, debye_length);
+}
 
-  cs_real_t alpha =   sqrt((distp + rpart) / rpart)
-                    + sqrt(rpart / (distp + rpart));
-  cs_real_t omega1 = pow(lphi1,2) + pow(lphi2,2) + alpha * lphi1 * lphi2;
-  cs_real_t omega2 = pow(lphi1,2) + pow(lphi2,2) - alpha * lphi1 * lphi2;
-  cs_real_t gamma = sqrt(rpart / (distp + rpart)) * exp(-1./debye_length * distp);
+/*----------------------------------------------------------------------------
+ * EDL interaction between a sphere and a plane for a series of distances.
+ *
+ * Terms which do not depend on the distance are computed only once,
+ * and results are identical to those of cs_lagr_edl_sphere_plane.
+ *----------------------------------------------------------------------------*/
 
-  cs_real_t var = 2 * _pi * _free_space_permit * water_permit
-    * pow((_k_boltzmann * temp / (1. * valen) / charge),2)
-                  * rpart * (distp + rpart) / (distp + 2 * rpart)
-                  * (omega1 * log(1 + gamma) + omega2 * log(1 - gamma));
+void
+cs_lagr_edl_sphere_plane_n(cs_lnum_t        n,
+                           const cs_real_t  distp[],
+                           cs_real_t        rpart,
+                           cs_real_t        valen,
+                           cs_real_t        phi1,
+                           cs_real_t        phi2,
+                           cs_real_t        temp,
+                           cs_real_t        debye_length,
+                           cs_real_t        water_permit,
+                           cs_real_t        var[])
+{
+  const cs_lagr_edl_coeffs_t  c
+    = _edl_sphere_plane_coeffs(rpart, valen, phi1, phi2, temp,
+                               debye_length, water_permit);
 
-  return var;
+  for (cs_lnum_t i = 0; i < n; i++)
+    var[i] = _edl_sphere_plane_eval(c, distp[i], rpart, debye_length);
 }
 
 /*----------------------------------------------------------------------------
@@ -418,46 +620,40 @@ cs_lagr_edl_sphere_sphere(cs_real_t  distcc,
                           cs_real_t  debye_length,
                           cs_real_t  water_permit)
 {
-  cs_real_t charge = 1.6e-19;
-
-  /* Reduced zeta potential */
-  cs_real_t lphi1 =  valen * charge * phi1 /  _k_boltzmann / temp;
-  cs_real_t lphi2 =  valen * charge * phi2 /  _k_boltzmann / temp;
-
-
-  /* Extended reduced zeta potential */
-  /* (following the work from Ohshima et al, 1982, JCIS, 90, 17-26) */
-
-  cs_real_t tau1 = rpart1 / debye_length;
-  lphi1 = 8. * tanh(lphi1 / 4.) /
-    ( 1. + pow(1. - (2. * tau1 + 1.) / (pow(tau1 + 1,2))
-               * pow(tanh(lphi1 / 4.),2),0.5));
-
-  cs_real_t tau2 = rpart2 / debye_length;
-  lphi2 = 8. * tanh(lphi2 / 4.) /
-         ( 1. + pow(1. - (2. * tau2 + 1.) / (pow(tau2 + 1,2))
-          * pow(tanh(lphi2 / 4.),2),0.5));
-
-  cs_real_t alpha =    sqrt(rpart2 * (distcc - rpart2)
-                    / (rpart1 * (distcc - rpart1)))
-                     + sqrt(rpart1 * (distcc - rpart1)
-                    / (rpart2 * (distcc - rpart2)));
-
-  cs_real_t omega1 = pow(lphi1,2) + pow(lphi2,2) + alpha * lphi1 * lphi2;
+  const cs_lagr_edl_coeffs_t  c
+    = _edl_sphere_sphere_coeffs(rpart1, rpart2, valen, phi1, phi2, temp,
+                                debye_length, water_permit);
 
-  cs_real_t omega2 = pow(lphi1,2) + pow(lphi2,2) - alpha * lphi1 * lphi2;
+  return _edl_sphere_sphere_eval(c, distcc, rpart1, rpart2, debye_length);
+}
 
-  cs_real_t gamma = sqrt(rpart1 * rpart2 / (distcc-rpart1) / (distcc-rpart2))
-                    *exp(1. / debye_length * (rpart1 + rpart2 - distcc));
+/*----------------------------------------------------------------------------
+ * EDL interaction between two spheres for a series of distances.
+ *
+ * Terms which do not depend on the distance are computed only once,
+ * and results are identical to those of cs_lagr_edl_sphere_sphere.
+ *----------------------------------------------------------------------------*/
 
-  cs_real_t var = 2 * _pi * _free_space_permit * water_permit
-                  * pow((_k_boltzmann * temp / charge),2)
-                  * rpart1 * rpart2 * (distcc - rpart1) * (distcc - rpart2)
-                  / (distcc * (  distcc * (rpart1  + rpart2)
-                               - pow(rpart1,2) - pow(rpart2,2)))
-                  * (omega1 * log(1 + gamma) + omega2 * log(1 - gamma));
+void
+cs_lagr_edl_sphere_sphere_n(cs_lnum_t        n,
+                            const cs_real_t  distcc[],
+                            cs_real_t        rpart1,
+                            cs_real_t        rpart2,
+                            cs_real_t        valen,
+                            cs_real_t        phi1,
+                            cs_real_t        phi2,
+                            cs_real_t        temp,
+                            cs_real_t        debye_length,
+                            cs_real_t        water_permit,
+                            cs_real_t        var[])
+{
+  const cs_lagr_edl_coeffs_t  c
+    = _edl_sphere_sphere_coeffs(rpart1, rpart2, valen, phi1, phi2, temp,
+                                debye_length, water_permit);
 
-  return var;
+  for (cs_lnum_t i = 0; i < n; i++)
+    var[i] = _edl_sphere_sphere_eval(c, distcc[i], rpart1, rpart2,
+                                     debye_length);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -143,6 +143,25 @@ cs_lagr_edl_sphere_plane (cs_real_t  distp,
                           cs_real_t  debye_length,
                           cs_real_t  water_permit);
 
+/*----------------------------------------------------------------------------
+ * EDL interaction between a sphere and a plane for a series of distances.
+ *
+ * Terms which do not depend on the distance are computed only once,
+ * and results are identical to those of cs_lagr_edl_sphere_plane.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_lagr_edl_sphere_plane_n(cs_lnum_t        n,
+                           const cs_real_t  distp[],
+                           cs_real_t        rpart,
+                           cs_real_t        valen,
+                           cs_real_t        phi1,
+                           cs_real_t        phi2,
+                           cs_real_t        temp,
+                           cs_real_t        debye_length,
+                           cs_real_t        water_permit,
+                           cs_real_t        var[]);
+
 /*----------------------------------------------------------------------------
  * Calculation of the EDL interaction between two spheres
  * using the formula from Bell & al (1970)
@@ -160,6 +179,26 @@ cs_lagr_edl_sphere_sphere(cs_real_t  distcc,
                           cs_real_t  debye_length,
                           cs_real_t  water_permit);
 
+/*----------------------------------------------------------------------------
+ * EDL interaction between two spheres for a series of distances.
+ *
+ * Terms which do not depend on the distance are computed only once,
+ * and results are identical to those of cs_lagr_edl_sphere_sphere.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_lagr_edl_sphere_sphere_n(cs_lnum_t        n,
+                            const cs_real_t  distcc[],
+                            cs_real_t        rpart1,
+                            cs_real_t        rpart2,
+                            cs_real_t        valen,
+                            cs_real_t        phi1,
+                            cs_real_t        phi2,
+                            cs_real_t        temp,
+                            cs_real_t        debye_length,
+                            cs_real_t        water_permit,
+                            cs_real_t        var[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
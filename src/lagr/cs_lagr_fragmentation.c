@@ -211,6 +211,10 @@ _find_class(cs_lnum_t  array[][2],
  * \param[in]  mass                    mass of the particles
  * \param[in]  agglo_max_weight                 maximum statistical weight that a
  *                                     particle can have
+ * \param[in]  interf                  class and index of particles in cell,
+ *                                     sorted by class
+ * \param[in]  class_bins              lookup structure for new parcels
+ *                                     by class
  */
 /*----------------------------------------------------------------------------*/
 
@@ -223,8 +227,9 @@ _add_particle(cs_lnum_t   lnum_particles,
               cs_lnum_t   newclass,
               cs_real_t   minimum_particle_diam,
               cs_real_t   mass,
-              cs_real_t   agglo_max_weight,
-              cs_lnum_t   interf[][2])
+              cs_real_t                    agglo_max_weight,
+              cs_lnum_t                    interf[][2],
+              cs_lagr_agglo_class_bins_t  *class_bins)
 {
   /* Get information on the new fragment*/
   cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
@@ -246,15 +251,13 @@ _add_particle(cs_lnum_t   lnum_particles,
 
   /* Add a new particle at the end of the set (otherwise)*/
   cs_lnum_t add_to_end = 1;
-  for (cs_lnum_t indx = p_set->n_particles;
-       indx < p_set->n_particles + *newpart;
-       indx++) {
-    int stat_class = cs_lagr_particles_get_lnum(p_set, indx,
-                                                CS_LAGR_AGGLO_CLASS_ID);
+  for (cs_lnum_t k = cs_lagr_agglo_class_bins_first(class_bins, newclass);
+       k > -1;
+       k = cs_lagr_agglo_class_bins_next(class_bins, k)) {
+    cs_lnum_t indx = p_set->n_particles + k;
     cs_real_t stat_weight = cs_lagr_particles_get_real(p_set, indx,
                                                        CS_LAGR_STAT_WEIGHT);
-    if ((stat_class == newclass)
-       && (stat_weight + vp <= agglo_max_weight)) {
+    if (stat_weight + vp <= agglo_max_weight) {
       long long int auxx = round(stat_weight);
       cs_lagr_particles_set_real(p_set, indx, CS_LAGR_STAT_WEIGHT, auxx+vp);
 
@@ -267,6 +270,7 @@ _add_particle(cs_lnum_t   lnum_particles,
     (*newpart)++;
     _insert_particles(*newpart, vp, corr, frag_idx, newclass,
                       minimum_particle_diam, mass);
+    cs_lagr_agglo_class_bins_add(class_bins, newclass, *newpart - 1);
   }
 }
 
@@ -412,6 +416,8 @@ _compare_interface(const void  *a,
  *                                    created by the agglomeration
  * \param[in]  agglo_end              index after the last particle in cell,
  *                                    created by the agglomeration
+ * \param[in]  class_bins             lookup structure for new parcels
+ *                                    by class (work array)
  *
  * \returns  modified list of particles containing newly created parcels
  *           at the end
@@ -419,12 +425,13 @@ _compare_interface(const void  *a,
 /*----------------------------------------------------------------------------*/
 
 cs_lnum_t
-cs_lagr_fragmentation(cs_real_t  dt,
-                      cs_real_t  minimum_particle_diam,
-                      cs_lnum_t  main_start,
-                      cs_lnum_t  main_end,
-                      cs_lnum_t  agglo_start,
-                      cs_lnum_t  agglo_end)
+cs_lagr_fragmentation(cs_real_t                    dt,
+                      cs_real_t                    minimum_particle_diam,
+                      cs_lnum_t                    main_start,
+                      cs_lnum_t                    main_end,
+                      cs_lnum_t                    agglo_start,
+                      cs_lnum_t                    agglo_end,
+                      cs_lagr_agglo_class_bins_t  *class_bins)
 {
   /* Initialization */
   cs_lnum_t ret_val = 0;
@@ -445,6 +452,8 @@ cs_lagr_fragmentation(cs_real_t  dt,
     return 0;
   }
 
+  cs_lagr_agglo_class_bins_reset(class_bins);
+
   /* Create local array (containing the particle index) */
   cs_lnum_t *corr;
   BFT_MALLOC(corr, lnum_particles, cs_lnum_t);
@@ -521,16 +530,16 @@ cs_lagr_fragmentation(cs_real_t  dt,
 
           _add_particle(lnum_particles, &newpart, vp, corr, i, class_nb_1,
                         minimum_particle_diam, mass*class_nb_1/class_nb,
-                        agglo_max_weight, interf);
+                        agglo_max_weight, interf, class_bins);
           _add_particle(lnum_particles, &newpart, vp, corr, i, class_nb_2,
                         minimum_particle_diam, mass*class_nb_2/class_nb,
-                        agglo_max_weight, interf);
+                        agglo_max_weight, interf, class_bins);
         }
         else {
           cs_lnum_t class_nb_even = class_nb / 2;
           _add_particle(lnum_particles, &newpart, 2*vp, corr, i, class_nb_even,
                         minimum_particle_diam, mass*0.5, agglo_max_weight,
-                        interf);
+                        interf, class_bins);
         }
       }
     }
@@ -37,6 +37,8 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "cs_lagr_agglo.h"
+
 /*----------------------------------------------------------------------------*/
 
 BEGIN_C_DECLS
@@ -79,6 +81,8 @@ BEGIN_C_DECLS
  *                                    created by the agglomeration
  * \param[in]  agglo_end              index after the last particle in cell,
  *                                    created by the agglomeration
+ * \param[in]  class_bins             lookup structure for new parcels
+ *                                    by class (work array)
  *
  * \returns  modified list of particles containing newly created parcels
  *           at the end
@@ -86,12 +90,13 @@ BEGIN_C_DECLS
 /*----------------------------------------------------------------------------*/
 
 cs_lnum_t
-cs_lagr_fragmentation(cs_real_t  dt,
-                      cs_real_t  minimum_particle_diam,
-                      cs_lnum_t  main_start,
-                      cs_lnum_t  main_end,
-                      cs_lnum_t  agglo_start,
-                      cs_lnum_t  agglo_end);
+cs_lagr_fragmentation(cs_real_t                    dt,
+                      cs_real_t                    minimum_particle_diam,
+                      cs_lnum_t                    main_start,
+                      cs_lnum_t                    main_end,
+                      cs_lnum_t                    agglo_start,
+                      cs_lnum_t                    agglo_end,
+                      cs_lagr_agglo_class_bins_t  *class_bins);
 
 /*----------------------------------------------------------------------------*/
 
@@ -48,6 +48,7 @@
 #include "bft_error.h"
 #include "bft_mem.h"
 
+#include "cs_ale.h"
 #include "cs_base.h"
 #include "cs_math.h"
 
@@ -63,6 +64,7 @@
 #include "cs_physical_constants.h"
 #include "cs_prototypes.h"
 #include "cs_time_step.h"
+#include "cs_turbomachinery.h"
 
 #include "cs_field.h"
 #include "cs_field_pointer.h"
@@ -87,6 +89,63 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+/* Number of values per counter-based random number generator key */
+
+#define CS_LAGR_INJECTION_RNG_CHUNK 256
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Cumulative distribution of injection weights over a zone's local elements */
+
+typedef struct {
+
+  bool        valid;          /* true if up to date */
+  cs_lnum_t   n_elts;         /* number of local elements */
+  double      l_weight;       /* total local weight */
+  cs_real_t  *cm_weight;      /* normalized cumulative weight */
+
+} cs_lagr_injection_cdf_t;
+
+/* Injection set active at the current time step */
+
+typedef struct {
+
+  const cs_lagr_injection_set_t  *zis;         /* injection set */
+
+  int               loc_id;                    /* 0: boundary, 1: volume */
+  cs_lnum_t         n_elts;                    /* number of zone elements */
+  const cs_lnum_t  *elt_ids;                   /* zone element ids */
+
+  double            l_weight;                  /* total local weight */
+  const cs_real_t  *cm_weight;                 /* normalized cumulative
+                                                  weight */
+  cs_real_t        *_cm_weight;                /* cm_weight if owner,
+                                                  NULL if cached */
+
+  cs_lnum_t         n_inject;                  /* number of particles
+                                                  injected on local rank */
+
+} cs_lagr_injection_active_set_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Use counter-based random number generator for injection */
+
+static bool _counter_rng = false;
+
+/* Cached cumulative weight distributions for boundary and volume zones */
+
+static int                       _n_zone_cdfs[2] = {0, 0};
+static cs_lagr_injection_cdf_t  *_zone_cdfs[2] = {NULL, NULL};
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -134,36 +193,48 @@ _segment_binary_search(cs_lnum_t     n,
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Distribute new particles in a given region.
+ * \brief Return counter-based random number generator counter for
+ *        a given injection set at the current time step.
  *
- * \param[in]   n_g_particles     global number of particles to inject
- * \param[in]   n_elts            number of elements in region
- * \param[in]   elt_id            element ids (or NULL)
- * \param[in]   elt_weight        parent element weights
- *                                (i.e. all local surfaces or volumes)
- * \param[in]   elt_profile       optional profile values for elements (or NULL)
- * \param[out]  elt_particle_idx  start index of added particles for each
- *                                element (size: n_elts + 1)
+ * \param[in]  set_id     id of active injection set for this time step
+ * \param[in]  stream_id  id of random variable set for a given injection
  *
- * \return  number of particles added on local rank
+ * \return  generator counter
  */
 /*----------------------------------------------------------------------------*/
 
-static cs_lnum_t
-_distribute_particles(cs_gnum_t         n_g_particles,
-                      cs_lnum_t         n_elts,
-                      const cs_lnum_t   elt_id[],
-                      const cs_real_t   elt_weight[],
-                      const cs_real_t  *elt_profile,
-                      cs_lnum_t         elt_particle_idx[])
+static inline uint64_t
+_rng_counter(int  set_id,
+             int  stream_id)
 {
-  cs_lnum_t n_particles = (cs_glob_n_ranks > 1) ? 0 : n_g_particles;
-
-  /* Compute local element weight */
+  return   ((uint64_t)(cs_glob_time_step->nt_cur) << 24)
+         + ((uint64_t)set_id << 4) + (uint64_t)stream_id;
+}
 
-  cs_real_t *elt_cm_weight = NULL;
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the normalized cumulative weight of elements in a region.
+ *
+ * \param[in]   n_elts        number of elements in region
+ * \param[in]   elt_id        element ids (or NULL)
+ * \param[in]   elt_weight    parent element weights
+ *                            (i.e. all local surfaces or volumes)
+ * \param[in]   elt_profile   optional profile values for elements (or NULL)
+ * \param[out]  elt_cm_weight normalized cumulative element weights
+ *                            (size: n_elts)
+ *
+ * \return  total local weight of region
+ */
+/*----------------------------------------------------------------------------*/
 
-  BFT_MALLOC(elt_cm_weight, n_elts, cs_real_t);
+static double
+_cumulative_weight(cs_lnum_t         n_elts,
+                   const cs_lnum_t   elt_id[],
+                   const cs_real_t   elt_weight[],
+                   const cs_real_t  *elt_profile,
+                   cs_real_t         elt_cm_weight[])
+{
+  /* Compute local element weight */
 
   if (elt_id != NULL) {
     if (elt_profile != NULL) {
@@ -201,73 +272,264 @@ _distribute_particles(cs_gnum_t         n_g_particles,
     l_weight = d;
   }
 
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    elt_cm_weight[i] /= l_weight;
+
+  return l_weight;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the cached cumulative weight distribution of a zone.
+ *
+ * The distribution is computed on first use, and kept as long as the
+ * zone and mesh do not change.
+ *
+ * \param[in]  loc_id      location type (0: boundary, 1: volume)
+ * \param[in]  z           pointer to zone
+ * \param[in]  elt_weight  parent element weights
+ *                         (i.e. all local surfaces or volumes)
+ *
+ * \return  pointer to zone distribution, or NULL if it may not be cached
+ */
+/*----------------------------------------------------------------------------*/
+
+static const cs_lagr_injection_cdf_t *
+_zone_cdf(int               loc_id,
+          const cs_zone_t  *z,
+          const cs_real_t   elt_weight[])
+{
+  if (   z->time_varying
+      || cs_glob_mesh->time_dep != CS_MESH_FIXED
+      || cs_glob_ale != CS_ALE_NONE
+      || cs_turbomachinery_get_model() == CS_TURBOMACHINERY_TRANSIENT)
+    return NULL;
+
+  if (z->id >= _n_zone_cdfs[loc_id]) {
+    BFT_REALLOC(_zone_cdfs[loc_id], z->id + 1, cs_lagr_injection_cdf_t);
+    for (int i = _n_zone_cdfs[loc_id]; i < z->id + 1; i++) {
+      cs_lagr_injection_cdf_t *cdf = _zone_cdfs[loc_id] + i;
+      cdf->valid = false;
+      cdf->n_elts = 0;
+      cdf->l_weight = 0;
+      cdf->cm_weight = NULL;
+    }
+    _n_zone_cdfs[loc_id] = z->id + 1;
+  }
+
+  cs_lagr_injection_cdf_t *cdf = _zone_cdfs[loc_id] + z->id;
+
+  if (cdf->valid == false || cdf->n_elts != z->n_elts) {
+    cdf->n_elts = z->n_elts;
+    BFT_REALLOC(cdf->cm_weight, cdf->n_elts, cs_real_t);
+    cdf->l_weight = _cumulative_weight(z->n_elts,
+                                       z->elt_ids,
+                                       elt_weight,
+                                       NULL,
+                                       cdf->cm_weight);
+    cdf->valid = true;
+  }
+
+  return cdf;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Distribute new particles of active injection sets among ranks.
+ *
+ * A single collective operation is used for all sets. With the
+ * counter-based random number generator, all ranks obtain the
+ * same distribution, so each rank computes its own share in parallel;
+ * otherwise, the distribution is computed on a root rank and scattered.
+ *
+ * \param[in]       n_sets  number of active injection sets
+ * \param[in, out]  sets    active injection sets (n_inject set on output)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_distribute_ranks(int                              n_sets,
+                  cs_lagr_injection_active_set_t   sets[])
+{
+  for (int s_id = 0; s_id < n_sets; s_id++)
+    sets[s_id].n_inject = sets[s_id].zis->n_inject;
+
 #if defined(HAVE_MPI)
 
-  /* Pre_distribution to various ranks; we assume that the number of
-     injected particles at a given time is not huge, so it is cheaper
-     to precompute the distribution on a single rank and broadcast it.
-     For a higher number of particles, computing by blocs and then
-     redistributing (with "all to all" operations) could be more efficient. */
+  if (cs_glob_n_ranks < 2 || n_sets < 1)
+    return;
+
+  int n_ranks = cs_glob_n_ranks;
+  int l_rank = cs_glob_rank_id;
 
-  if (cs_glob_n_ranks > 1) {
+  double *l_weight = NULL, *cm_weight = NULL;
 
-    int n_ranks = cs_glob_n_ranks;
-    int l_rank = cs_glob_rank_id;
-    int r_rank = 0; /* Root rank for serialized operations */
+  BFT_MALLOC(l_weight, n_sets, double);
+  for (int s_id = 0; s_id < n_sets; s_id++)
+    l_weight[s_id] = sets[s_id].l_weight;
 
-    cs_lnum_t  *n_rank_particles = NULL;
-    double     *cm_weight = NULL;
+  if (_counter_rng) {
 
-    if (l_rank == r_rank) {
+    BFT_MALLOC(cm_weight, n_ranks*n_sets, double);
 
-      BFT_MALLOC(n_rank_particles, n_ranks, cs_lnum_t);
-      BFT_MALLOC(cm_weight, n_ranks, double);
+    MPI_Allgather(l_weight, n_sets, MPI_DOUBLE, cm_weight, n_sets, MPI_DOUBLE,
+                  cs_glob_mpi_comm);
 
-      for (int i = 0; i < n_ranks; i++)
-        n_rank_particles[i] = 0;
+    for (int s_id = 0; s_id < n_sets; s_id++) {
+
+      /* Scan (cumulative sum) operation */
+
+      double w_s = 0, w_e = 0, tot_weight = 0;
+      for (int i = 0; i < n_ranks; i++) {
+        if (i == l_rank)
+          w_s = tot_weight;
+        tot_weight += cm_weight[i*n_sets + s_id];
+        if (i == l_rank)
+          w_e = tot_weight;
+      }
+
+      sets[s_id].n_inject = 0;
+
+      if (tot_weight <= 0.)
+        continue;
+
+      /* Values in ]r_s, r_e] are assigned to local rank (matching
+         the binary search used in the serialized distribution) */
+
+      const double r_s = (l_rank > 0) ? w_s / tot_weight : -1.;
+      const double r_e = (l_rank < n_ranks-1) ? w_e / tot_weight : 2.;
+
+      const cs_gnum_t n_g_particles = sets[s_id].zis->n_inject;
+      const cs_gnum_t n_chunks
+        = (n_g_particles + CS_LAGR_INJECTION_RNG_CHUNK - 1)
+          / CS_LAGR_INJECTION_RNG_CHUNK;
+      const uint64_t counter = _rng_counter(s_id, 0);
+
+      cs_lnum_t n_particles = 0;
+
+#     pragma omp parallel for reduction(+:n_particles) \
+                              if (n_g_particles > CS_THR_MIN)
+      for (cs_gnum_t c_id = 0; c_id < n_chunks; c_id++) {
+        cs_real_t r[CS_LAGR_INJECTION_RNG_CHUNK];
+        cs_gnum_t s = c_id*CS_LAGR_INJECTION_RNG_CHUNK;
+        cs_lnum_t n = CS_MIN(n_g_particles - s, CS_LAGR_INJECTION_RNG_CHUNK);
+        cs_random_counter_uniform(c_id, counter, n, r);
+        for (cs_lnum_t i = 0; i < n; i++) {
+          if (r[i] > r_s && r[i] <= r_e)
+            n_particles += 1;
+        }
+      }
+
+      sets[s_id].n_inject = n_particles;
+
+    }
+
+  }
+
+  else {
+
+    /* Pre_distribution to various ranks; we assume that the number of
+       injected particles at a given time is not huge, so it is cheaper
+       to precompute the distribution on a single rank and scatter it. */
+
+    int r_rank = 0; /* Root rank for serialized operations */
 
+    cs_lnum_t  *n_rank_particles = NULL, *n_particles = NULL;
+
+    BFT_MALLOC(n_particles, n_sets, cs_lnum_t);
+
+    if (l_rank == r_rank) {
+      BFT_MALLOC(n_rank_particles, n_ranks*n_sets, cs_lnum_t);
+      BFT_MALLOC(cm_weight, n_ranks*n_sets, double);
     }
 
-    MPI_Gather(&l_weight, 1, MPI_DOUBLE, cm_weight, 1, MPI_DOUBLE,
+    MPI_Gather(l_weight, n_sets, MPI_DOUBLE, cm_weight, n_sets, MPI_DOUBLE,
                r_rank, cs_glob_mpi_comm);
 
     if (l_rank == r_rank) {
 
-      /* Scan (cumulative sum) operation */
-      for (int i = 1; i < n_ranks; i++)
-        cm_weight[i] += cm_weight[i-1];
+      double *s_cm_weight = NULL;
+      BFT_MALLOC(s_cm_weight, n_ranks, double);
+
+      for (int i = 0; i < n_ranks*n_sets; i++)
+        n_rank_particles[i] = 0;
+
+      for (int s_id = 0; s_id < n_sets; s_id++) {
+
+        /* Scan (cumulative sum) operation */
 
-      /* Scale to [0, 1] */
-      double tot_weight = cm_weight[n_ranks-1];
+        s_cm_weight[0] = cm_weight[s_id];
+        for (int i = 1; i < n_ranks; i++)
+          s_cm_weight[i] = s_cm_weight[i-1] + cm_weight[i*n_sets + s_id];
 
-      if (tot_weight > 0.) {
+        /* Scale to [0, 1] */
 
-        for (int i = 0; i < n_ranks; i++)
-          cm_weight[i] /= tot_weight;
+        double tot_weight = s_cm_weight[n_ranks-1];
 
-        /* Compute distribution */
+        if (tot_weight > 0.) {
+
+          for (int i = 0; i < n_ranks; i++)
+            s_cm_weight[i] /= tot_weight;
+
+          /* Compute distribution */
+
+          const cs_gnum_t n_g_particles = sets[s_id].zis->n_inject;
+
+          for (cs_gnum_t i = 0; i < n_g_particles; i++) {
+            cs_real_t r;
+            cs_random_uniform(1, &r);
+            int r_id = _segment_binary_search(n_ranks, r, s_cm_weight);
+            n_rank_particles[r_id*n_sets + s_id] += 1;
+          }
 
-        for (cs_gnum_t i = 0; i < n_g_particles; i++) {
-          cs_real_t r;
-          cs_random_uniform(1, &r);
-          int r_id = _segment_binary_search(n_ranks, r, cm_weight);
-          n_rank_particles[r_id] += 1;
         }
 
       }
 
-      BFT_FREE(cm_weight);
+      BFT_FREE(s_cm_weight);
     }
 
-    MPI_Scatter(n_rank_particles, 1, CS_MPI_LNUM,
-                &n_particles, 1, CS_MPI_LNUM,
+    MPI_Scatter(n_rank_particles, n_sets, CS_MPI_LNUM,
+                n_particles, n_sets, CS_MPI_LNUM,
                 r_rank, cs_glob_mpi_comm);
 
+    for (int s_id = 0; s_id < n_sets; s_id++)
+      sets[s_id].n_inject = n_particles[s_id];
+
+    BFT_FREE(n_particles);
     BFT_FREE(n_rank_particles);
+
   }
 
+  BFT_FREE(cm_weight);
+  BFT_FREE(l_weight);
+
 #endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Distribute new particles of a given set among local elements.
+ *
+ * \param[in]   n_particles       number of particles to inject on local rank
+ * \param[in]   n_elts            number of elements in region
+ * \param[in]   elt_cm_weight     normalized cumulative element weights
+ * \param[in]   rng_seed          counter-based generator key and counter,
+ *                                or NULL for sequential generator
+ * \param[out]  elt_particle_idx  start index of added particles for each
+ *                                element (size: n_elts + 1)
+ *
+ * \return  number of particles added on local rank
+ */
+/*----------------------------------------------------------------------------*/
 
+static cs_lnum_t
+_distribute_particles(cs_lnum_t         n_particles,
+                      cs_lnum_t         n_elts,
+                      const cs_real_t   elt_cm_weight[],
+                      const uint64_t   *rng_seed,
+                      cs_lnum_t         elt_particle_idx[])
+{
   /* Check for empty zones */
 
   if (n_particles > 0 && n_elts < 1)
@@ -279,19 +541,43 @@ _distribute_particles(cs_gnum_t         n_g_particles,
     elt_particle_idx[i] = 0;
   elt_particle_idx[n_elts] = 0;
 
-  for (cs_lnum_t i = 0; i < n_elts; i++)
-    elt_cm_weight[i] /= l_weight;
-
   /* Compute distribution */
 
-  for (cs_lnum_t i = 0; i < n_particles; i++) {
-    cs_real_t r;
-    cs_random_uniform(1, &r);
-    cs_lnum_t e_id = _segment_binary_search(n_elts, r, elt_cm_weight);
-    elt_particle_idx[e_id+1] += 1;
+  if (rng_seed != NULL) {
+
+    const cs_lnum_t n_chunks
+      = (n_particles + CS_LAGR_INJECTION_RNG_CHUNK - 1)
+        / CS_LAGR_INJECTION_RNG_CHUNK;
+
+    cs_lnum_t *p_elt_id = NULL;
+    BFT_MALLOC(p_elt_id, n_particles, cs_lnum_t);
+
+#   pragma omp parallel for if (n_particles > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+      cs_real_t r[CS_LAGR_INJECTION_RNG_CHUNK];
+      cs_lnum_t s = c_id*CS_LAGR_INJECTION_RNG_CHUNK;
+      cs_lnum_t n = CS_MIN(n_particles - s, CS_LAGR_INJECTION_RNG_CHUNK);
+      cs_random_counter_uniform(rng_seed[0] + c_id, rng_seed[1], n, r);
+      for (cs_lnum_t i = 0; i < n; i++)
+        p_elt_id[s + i] = _segment_binary_search(n_elts, r[i], elt_cm_weight);
+    }
+
+    for (cs_lnum_t i = 0; i < n_particles; i++)
+      elt_particle_idx[p_elt_id[i]+1] += 1;
+
+    BFT_FREE(p_elt_id);
+
   }
+  else {
 
-  BFT_FREE(elt_cm_weight);
+    for (cs_lnum_t i = 0; i < n_particles; i++) {
+      cs_real_t r;
+      cs_random_uniform(1, &r);
+      cs_lnum_t e_id = _segment_binary_search(n_elts, r, elt_cm_weight);
+      elt_particle_idx[e_id+1] += 1;
+    }
+
+  }
 
   /* transform count to index */
 
@@ -1425,12 +1711,22 @@ cs_lagr_injection(int        time_id,
 
   }
 
-  /* Now inject new particles
-     ------------------------ */
+  /* Determine active injection sets and their local weights
+     and distribute particles among ranks
+     -------------------------------------------------------- */
 
-  cs_lnum_t n_elts_m = CS_MAX(mesh->n_b_faces, mesh->n_cells);
-  cs_lnum_t *elt_particle_idx = NULL;
-  BFT_MALLOC(elt_particle_idx, n_elts_m+1, cs_lnum_t);
+  int n_sets = 0;
+  cs_lagr_injection_active_set_t *sets = NULL;
+
+  for (int i_loc = 0; i_loc < 2; i_loc++) {
+    cs_lagr_zone_data_t *zd = zda[i_loc];
+    for (int z_id = 0; z_id < zd->n_zones; z_id++)
+      n_sets += zd->n_injection_sets[z_id];
+  }
+
+  BFT_MALLOC(sets, n_sets, cs_lagr_injection_active_set_t);
+
+  n_sets = 0;
 
   /* Loop in injection type (boundary, volume) */
 
@@ -1457,19 +1753,12 @@ cs_lagr_injection(int        time_id,
 
       /* Loop on injected sets */
 
-      cs_lnum_t         n_z_elts = 0;
-      const cs_lnum_t  *z_elt_ids = NULL;
+      const cs_zone_t  *z = NULL;
 
-      if (i_loc == 0) {
-        const cs_zone_t  *z = cs_boundary_zone_by_id(z_id);
-        n_z_elts = z->n_elts;
-        z_elt_ids = z->elt_ids;
-      }
-      else {
-        const cs_zone_t  *z = cs_volume_zone_by_id(z_id);
-        n_z_elts = z->n_elts;
-        z_elt_ids = z->elt_ids;
-      }
+      if (i_loc == 0)
+        z = cs_boundary_zone_by_id(z_id);
+      else
+        z = cs_volume_zone_by_id(z_id);
 
       for (int set_id = 0;
            set_id < zd->n_injection_sets[z_id];
@@ -1493,243 +1782,312 @@ cs_lagr_injection(int        time_id,
         if (ts->nt_cur % injection_frequency != 0)
           continue;
 
-        cs_real_t *elt_profile = NULL;
-        if (zis->injection_profile_func != NULL) {
-          BFT_MALLOC(elt_profile, n_z_elts, cs_real_t);
-          zis->injection_profile_func(zis->zone_id,
-                                      zis->location_id,
-                                      zis->injection_profile_input,
-                                      n_z_elts,
-                                      z_elt_ids,
-                                      elt_profile);
-        }
+        cs_lagr_injection_active_set_t *as = sets + n_sets;
 
-        cs_lnum_t n_inject = _distribute_particles(zis->n_inject,
-                                                   n_z_elts,
-                                                   z_elt_ids,
-                                                   elt_weight,
-                                                   elt_profile,
-                                                   elt_particle_idx);
+        as->zis = zis;
+        as->loc_id = i_loc;
+        as->n_elts = z->n_elts;
+        as->elt_ids = z->elt_ids;
+        as->_cm_weight = NULL;
+        as->n_inject = 0;
 
-        BFT_FREE(elt_profile);
+        /* Reuse zone distribution when possible */
 
-        if (cs_lagr_particle_set_resize(p_set->n_particles + n_inject) < 0)
-          bft_error(__FILE__, __LINE__, 0,
-                    "Lagrangian module internal error: \n"
-                    "  resizing of particle set impossible but previous\n"
-                    "  size computation did not detect this issue.");
+        const cs_lagr_injection_cdf_t *cdf = NULL;
+        if (zis->injection_profile_func == NULL)
+          cdf = _zone_cdf(i_loc, z, elt_weight);
 
-        /* Define particle coordinates and place on faces/cells */
+        if (cdf != NULL) {
+          as->l_weight = cdf->l_weight;
+          as->cm_weight = cdf->cm_weight;
+        }
 
-        if (zis->location_id == CS_MESH_LOCATION_BOUNDARY_FACES)
-          cs_lagr_new(p_set,
-                      n_z_elts,
-                      z_elt_ids,
-                      elt_particle_idx);
-        else
-          cs_lagr_new_v(p_set,
-                        n_z_elts,
-                        z_elt_ids,
-                        elt_particle_idx);
-
-        BFT_FREE(elt_profile);
-
-        /* Initialize other particle attributes */
-
-        _init_particles(p_set,
-                        zis,
-                        time_id,
-                        n_z_elts,
-                        z_elt_ids,
-                        elt_particle_idx);
-
-        assert(n_inject == elt_particle_idx[n_z_elts]);
-
-        cs_lnum_t particle_range[2] = {p_set->n_particles,
-                                       p_set->n_particles + n_inject};
-
-        cs_lagr_new_particle_init(particle_range,
-                                  time_id,
-                                  visc_length);
-
-        /* Advanced user modification:
-
-           WARNING: the user may change the particle coordinates but is
-           prevented from changing the previous location (otherwise, if
-           the particle is not in the same cell anymore, it would be lost).
-
-           Moreover, a precaution has to be taken when calling
-           "current to previous" in the tracking stage.
-        */
-
-        {
-          cs_lnum_t *particle_face_ids = NULL;
-
-          if (zis->location_id == CS_MESH_LOCATION_BOUNDARY_FACES)
-            particle_face_ids = _get_particle_face_ids(n_z_elts,
-                                                       z_elt_ids,
-                                                       elt_particle_idx);
-
-          cs_lnum_t *saved_cell_id;
-          cs_real_3_t *saved_coords;
-          BFT_MALLOC(saved_cell_id, n_inject, cs_lnum_t);
-          BFT_MALLOC(saved_coords, n_inject, cs_real_3_t);
-
-          for (cs_lnum_t i = 0; i < n_inject; i++) {
-            cs_lnum_t p_id = particle_range[0] + i;
-
-            saved_cell_id[i] = cs_lagr_particles_get_lnum(p_set,
-                                                           p_id,
-                                                           CS_LAGR_CELL_ID);
-            const cs_real_t *p_coords
-              = cs_lagr_particles_attr_const(p_set,
-                                             p_id,
-                                             CS_LAGR_COORDS);
-            for (cs_lnum_t j = 0; j < 3; j++)
-              saved_coords[i][j] = p_coords[j];
+        else {
+          cs_real_t *elt_profile = NULL;
+          if (zis->injection_profile_func != NULL) {
+            BFT_MALLOC(elt_profile, z->n_elts, cs_real_t);
+            zis->injection_profile_func(zis->zone_id,
+                                        zis->location_id,
+                                        zis->injection_profile_input,
+                                        z->n_elts,
+                                        z->elt_ids,
+                                        elt_profile);
           }
 
-          cs_user_lagr_in(p_set,
-                          zis,
-                          particle_range,
-                          particle_face_ids,
-                          visc_length);
+          BFT_MALLOC(as->_cm_weight, z->n_elts, cs_real_t);
+          as->l_weight = _cumulative_weight(z->n_elts,
+                                            z->elt_ids,
+                                            elt_weight,
+                                            elt_profile,
+                                            as->_cm_weight);
+          as->cm_weight = as->_cm_weight;
 
-          /* For safety, build values at previous time step, but reset saved values
-             for previous cell number and particle coordinates */
+          BFT_FREE(elt_profile);
+        }
 
-          for (cs_lnum_t i = 0; i < n_inject; i++) {
-            cs_lnum_t p_id = particle_range[0] + i;
+        n_sets++;
 
-            cs_lagr_particles_current_to_previous(p_set, p_id);
+      } /* end of loop on sets */
 
-            cs_lagr_particles_set_lnum_n(p_set,
-                                         p_id,
-                                         1,
-                                         CS_LAGR_CELL_ID,
-                                         saved_cell_id[i]);
-            cs_real_t *p_coords_prev
-              = cs_lagr_particles_attr_n(p_set,
-                                         p_id,
-                                         1,
-                                         CS_LAGR_COORDS);
-            for (cs_lnum_t j = 0; j < 3; j++)
-              p_coords_prev[j] = saved_coords[i][j];
+    } /* end of loop on zones */
 
-            /* Just after injection, compute the next particle position with
-             * a reduce integration time so as to simulate continuous injection
-             */
-            cs_real_t res_time = cs_lagr_particles_get_real(p_set, p_id,
-                                                            CS_LAGR_RESIDENCE_TIME);
+  } /* end of loop on zone types (boundary/volume) */
 
-            if (res_time < 0) {
+  _distribute_ranks(n_sets, sets);
 
-              cs_real_t *p_coords
-                = cs_lagr_particles_attr(p_set,
-                                         p_id,
-                                         CS_LAGR_COORDS);
-              cs_real_t *p_vel =
-                cs_lagr_particles_attr(p_set, p_id, CS_LAGR_VELOCITY);
-              cs_real_t t_fraction = (cs_glob_lagr_time_step->dtp + res_time);
+  /* Now inject new particles
+     ------------------------ */
 
-              for (cs_lnum_t j = 0; j < 3; j++)
-                p_coords[j] = p_coords_prev[j] + t_fraction * p_vel[j];
+  cs_lnum_t n_elts_m = CS_MAX(mesh->n_b_faces, mesh->n_cells);
+  cs_lnum_t *elt_particle_idx = NULL;
+  BFT_MALLOC(elt_particle_idx, n_elts_m+1, cs_lnum_t);
 
-            }
+  /* Counter-based generator seed (key and counter); keys are based
+     on the rank id so as to differ between ranks */
 
-          }
+  uint64_t _rng_seed[2] = {(uint64_t)(CS_MAX(cs_glob_rank_id, 0)) << 40, 0};
+  uint64_t *rng_seed = (_counter_rng) ? _rng_seed : NULL;
 
-          BFT_FREE(saved_coords);
-          BFT_FREE(saved_cell_id);
+  /* Loop on active injection sets */
 
-          /* Add particle tracking events for boundary injection */
+  for (int s_id = 0; s_id < n_sets; s_id++) {
 
-          if (   particle_face_ids != NULL
-              && cs_lagr_stat_is_active(CS_LAGR_STAT_GROUP_TRACKING_EVENT)) {
+    const cs_lagr_injection_set_t *zis = sets[s_id].zis;
 
-            cs_lagr_event_set_t  *events
-              = cs_lagr_event_set_boundary_interaction();
+    cs_lagr_zone_data_t *zd = zda[sets[s_id].loc_id];
 
-            /* Event set "expected" size: n boundary faces*2 */
-            cs_lnum_t events_min_size = mesh->n_b_faces * 2;
-            if (events->n_events_max < events_min_size)
-              cs_lagr_event_set_resize(events, events_min_size);
+    const int z_id = zis->zone_id;
+    const cs_lnum_t n_z_elts = sets[s_id].n_elts;
+    const cs_lnum_t *z_elt_ids = sets[s_id].elt_ids;
 
-            for (cs_lnum_t i = 0; i < n_inject; i++) {
-              cs_lnum_t p_id = particle_range[0] + i;
+    if (rng_seed != NULL)
+      rng_seed[1] = _rng_counter(s_id, 1);
 
-              cs_lnum_t event_id = events->n_events;
-              events->n_events += 1;
+    cs_lnum_t n_inject = _distribute_particles(sets[s_id].n_inject,
+                                               n_z_elts,
+                                               sets[s_id].cm_weight,
+                                               rng_seed,
+                                               elt_particle_idx);
 
-              if (event_id >= events->n_events_max) {
-                /* flush events */
-                cs_lagr_stat_update_event(events,
-                                          CS_LAGR_STAT_GROUP_TRACKING_EVENT);
-                events->n_events = 0;
-                event_id = 0;
-              }
+    BFT_FREE(sets[s_id]._cm_weight);
 
-              cs_lagr_event_init_from_particle(events, p_set, event_id, p_id);
+    if (cs_lagr_particle_set_resize(p_set->n_particles + n_inject) < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                "Lagrangian module internal error: \n"
+                "  resizing of particle set impossible but previous\n"
+                "  size computation did not detect this issue.");
 
-              cs_lnum_t face_id = particle_face_ids[i];
-              cs_lagr_events_set_lnum(events,
-                                      event_id,
-                                      CS_LAGR_E_FACE_ID,
-                                      face_id);
+    /* Define particle coordinates and place on faces/cells */
 
-              cs_lnum_t *e_flag = cs_lagr_events_attr(events,
-                                                      event_id,
-                                                      CS_LAGR_E_FLAG);
+    if (rng_seed != NULL)
+      rng_seed[1] = _rng_counter(s_id, 2);
 
-              *e_flag = *e_flag | CS_EVENT_INFLOW;
+    if (zis->location_id == CS_MESH_LOCATION_BOUNDARY_FACES)
+      cs_lagr_new(p_set,
+                  n_z_elts,
+                  z_elt_ids,
+                  elt_particle_idx,
+                  rng_seed);
+    else
+      cs_lagr_new_v(p_set,
+                    n_z_elts,
+                    z_elt_ids,
+                    elt_particle_idx,
+                    rng_seed);
 
-            }
+    /* Initialize other particle attributes */
 
-          }
+    _init_particles(p_set,
+                    zis,
+                    time_id,
+                    n_z_elts,
+                    z_elt_ids,
+                    elt_particle_idx);
 
-          BFT_FREE(particle_face_ids);
+    assert(n_inject == elt_particle_idx[n_z_elts]);
+
+    cs_lnum_t particle_range[2] = {p_set->n_particles,
+                                   p_set->n_particles + n_inject};
+
+    cs_lagr_new_particle_init(particle_range,
+                              time_id,
+                              visc_length);
+
+    /* Advanced user modification:
+
+       WARNING: the user may change the particle coordinates but is
+       prevented from changing the previous location (otherwise, if
+       the particle is not in the same cell anymore, it would be lost).
+
+       Moreover, a precaution has to be taken when calling
+       "current to previous" in the tracking stage.
+    */
+
+    {
+      cs_lnum_t *particle_face_ids = NULL;
+
+      if (zis->location_id == CS_MESH_LOCATION_BOUNDARY_FACES)
+        particle_face_ids = _get_particle_face_ids(n_z_elts,
+                                                   z_elt_ids,
+                                                   elt_particle_idx);
+
+      cs_lnum_t *saved_cell_id;
+      cs_real_3_t *saved_coords;
+      BFT_MALLOC(saved_cell_id, n_inject, cs_lnum_t);
+      BFT_MALLOC(saved_coords, n_inject, cs_real_3_t);
+
+      for (cs_lnum_t i = 0; i < n_inject; i++) {
+        cs_lnum_t p_id = particle_range[0] + i;
+
+        saved_cell_id[i] = cs_lagr_particles_get_lnum(p_set,
+                                                       p_id,
+                                                       CS_LAGR_CELL_ID);
+        const cs_real_t *p_coords
+          = cs_lagr_particles_attr_const(p_set,
+                                         p_id,
+                                         CS_LAGR_COORDS);
+        for (cs_lnum_t j = 0; j < 3; j++)
+          saved_coords[i][j] = p_coords[j];
+      }
+
+      cs_user_lagr_in(p_set,
+                      zis,
+                      particle_range,
+                      particle_face_ids,
+                      visc_length);
+
+      /* For safety, build values at previous time step, but reset saved values
+         for previous cell number and particle coordinates */
+
+      for (cs_lnum_t i = 0; i < n_inject; i++) {
+        cs_lnum_t p_id = particle_range[0] + i;
+
+        cs_lagr_particles_current_to_previous(p_set, p_id);
+
+        cs_lagr_particles_set_lnum_n(p_set,
+                                     p_id,
+                                     1,
+                                     CS_LAGR_CELL_ID,
+                                     saved_cell_id[i]);
+        cs_real_t *p_coords_prev
+          = cs_lagr_particles_attr_n(p_set,
+                                     p_id,
+                                     1,
+                                     CS_LAGR_COORDS);
+        for (cs_lnum_t j = 0; j < 3; j++)
+          p_coords_prev[j] = saved_coords[i][j];
+
+        /* Just after injection, compute the next particle position with
+         * a reduce integration time so as to simulate continuous injection
+         */
+        cs_real_t res_time = cs_lagr_particles_get_real(p_set, p_id,
+                                                        CS_LAGR_RESIDENCE_TIME);
+
+        if (res_time < 0) {
+
+          cs_real_t *p_coords
+            = cs_lagr_particles_attr(p_set,
+                                     p_id,
+                                     CS_LAGR_COORDS);
+          cs_real_t *p_vel =
+            cs_lagr_particles_attr(p_set, p_id, CS_LAGR_VELOCITY);
+          cs_real_t t_fraction = (cs_glob_lagr_time_step->dtp + res_time);
+
+          for (cs_lnum_t j = 0; j < 3; j++)
+            p_coords[j] = p_coords_prev[j] + t_fraction * p_vel[j];
 
         }
 
-        /* check some particle attributes consistency */
+      }
+
+      BFT_FREE(saved_coords);
+      BFT_FREE(saved_cell_id);
+
+      /* Add particle tracking events for boundary injection */
 
-        _check_particles(p_set, zis, n_z_elts, elt_particle_idx);
+      if (   particle_face_ids != NULL
+          && cs_lagr_stat_is_active(CS_LAGR_STAT_GROUP_TRACKING_EVENT)) {
 
-        /* update counters and balances */
+        cs_lagr_event_set_t  *events
+          = cs_lagr_event_set_boundary_interaction();
 
-        cs_real_t z_weight = 0.;
+        /* Event set "expected" size: n boundary faces*2 */
+        cs_lnum_t events_min_size = mesh->n_b_faces * 2;
+        if (events->n_events_max < events_min_size)
+          cs_lagr_event_set_resize(events, events_min_size);
 
-        for (cs_lnum_t p_id = particle_range[0];
-             p_id < particle_range[1];
-             p_id++) {
-          cs_real_t s_weight = cs_lagr_particles_get_real(p_set, p_id,
-                                                          CS_LAGR_STAT_WEIGHT);
-          cs_real_t flow_rate = (  s_weight
-                                 * cs_lagr_particles_get_real(p_set, p_id,
-                                                              CS_LAGR_MASS));
+        for (cs_lnum_t i = 0; i < n_inject; i++) {
+          cs_lnum_t p_id = particle_range[0] + i;
 
-          zd->particle_flow_rate[z_id*n_stats] += flow_rate;
+          cs_lnum_t event_id = events->n_events;
+          events->n_events += 1;
 
-          if (n_stats > 1) {
-            int class_id = cs_lagr_particles_get_lnum(p_set, p_id,
-                                                      CS_LAGR_STAT_CLASS);
-            if (class_id > 0 && class_id < n_stats)
-              zd->particle_flow_rate[z_id*n_stats + class_id] += flow_rate;
+          if (event_id >= events->n_events_max) {
+            /* flush events */
+            cs_lagr_stat_update_event(events,
+                                      CS_LAGR_STAT_GROUP_TRACKING_EVENT);
+            events->n_events = 0;
+            event_id = 0;
           }
 
-          z_weight += s_weight;
+          cs_lagr_event_init_from_particle(events, p_set, event_id, p_id);
+
+          cs_lnum_t face_id = particle_face_ids[i];
+          cs_lagr_events_set_lnum(events,
+                                  event_id,
+                                  CS_LAGR_E_FACE_ID,
+                                  face_id);
+
+          cs_lnum_t *e_flag = cs_lagr_events_attr(events,
+                                                  event_id,
+                                                  CS_LAGR_E_FLAG);
+
+          *e_flag = *e_flag | CS_EVENT_INFLOW;
+
         }
 
-        p_set->n_particles += n_inject;
-        p_set->n_part_new += n_inject;
-        p_set->weight_new += z_weight;
+      }
 
-      } /* end of loop on sets */
+      BFT_FREE(particle_face_ids);
 
-    } /* end of loop on zones */
+    }
 
-  } /* end of loop on zone types (boundary/volume) */
+    /* check some particle attributes consistency */
+
+    _check_particles(p_set, zis, n_z_elts, elt_particle_idx);
+
+    /* update counters and balances */
 
+    cs_real_t z_weight = 0.;
+
+    for (cs_lnum_t p_id = particle_range[0];
+         p_id < particle_range[1];
+         p_id++) {
+      cs_real_t s_weight = cs_lagr_particles_get_real(p_set, p_id,
+                                                      CS_LAGR_STAT_WEIGHT);
+      cs_real_t flow_rate = (  s_weight
+                             * cs_lagr_particles_get_real(p_set, p_id,
+                                                          CS_LAGR_MASS));
+
+      zd->particle_flow_rate[z_id*n_stats] += flow_rate;
+
+      if (n_stats > 1) {
+        int class_id = cs_lagr_particles_get_lnum(p_set, p_id,
+                                                  CS_LAGR_STAT_CLASS);
+        if (class_id > 0 && class_id < n_stats)
+          zd->particle_flow_rate[z_id*n_stats + class_id] += flow_rate;
+      }
+
+      z_weight += s_weight;
+    }
+
+    p_set->n_particles += n_inject;
+    p_set->n_part_new += n_inject;
+    p_set->weight_new += z_weight;
+
+  } /* end of loop on active sets */
+
+  BFT_FREE(sets);
   BFT_FREE(elt_particle_idx);
 
   /* Update global particle counters */
@@ -1738,6 +2096,43 @@ cs_lagr_injection(int        time_id,
   pc->n_g_total += pc->n_g_new;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the random number generator used for particle injection.
+ *
+ * By default, the sequential generator of \ref cs_random_uniform is used,
+ * and the distribution of particles among ranks is computed on a
+ * single rank. With the counter-based generator
+ * (\ref cs_random_counter_uniform), each rank computes its own share,
+ * and particles are distributed among elements and positioned in parallel.
+ *
+ * \param[in]  use_counter_rng  use counter-based generator if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_injection_set_counter_rng(bool  use_counter_rng)
+{
+  _counter_rng = use_counter_rng;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free data cached for particle injection.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_injection_finalize(void)
+{
+  for (int i_loc = 0; i_loc < 2; i_loc++) {
+    for (int i = 0; i < _n_zone_cdfs[i_loc]; i++)
+      BFT_FREE(_zone_cdfs[i_loc][i].cm_weight);
+    BFT_FREE(_zone_cdfs[i_loc]);
+    _n_zone_cdfs[i_loc] = 0;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
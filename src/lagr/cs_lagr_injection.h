@@ -59,6 +59,32 @@ cs_lagr_injection(int        time_id,
                   const int  itypfb[],
                   cs_real_t  visc_length[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the random number generator used for particle injection.
+ *
+ * By default, the sequential generator of \ref cs_random_uniform is used,
+ * and the distribution of particles among ranks is computed on a
+ * single rank. With the counter-based generator
+ * (\ref cs_random_counter_uniform), each rank computes its own share,
+ * and particles are distributed among elements and positioned in parallel.
+ *
+ * \param[in]  use_counter_rng  use counter-based generator if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_injection_set_counter_rng(bool  use_counter_rng);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free data cached for particle injection.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_injection_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -201,6 +201,7 @@ _face_sub_surfaces(cs_lnum_t        n_vertices,
  * If the face has one or more concave angles, the point will be assigned
  * to a randomly determined edge.
  *
+ * \param[in]   r_in           random values in [0, 1[ (size: 3)
  * \param[in]   n_vertices     number of face vertices
  * \param[in]   vertex_ids     ids of face vertices
  * \param[in]   vertex_coords  vertex coordinates
@@ -213,7 +214,8 @@ _face_sub_surfaces(cs_lnum_t        n_vertices,
 /*----------------------------------------------------------------------------*/
 
 static void
-_random_point_in_face(cs_lnum_t        n_vertices,
+_random_point_in_face(const cs_real_t  r_in[3],
+                      cs_lnum_t        n_vertices,
                       const cs_lnum_t  vertex_ids[],
                       const cs_real_t  vertex_coords[][3],
                       const cs_real_t  face_center[3],
@@ -221,12 +223,10 @@ _random_point_in_face(cs_lnum_t        n_vertices,
                       cs_real_t        coords[3])
 {
   cs_lnum_t tri_id = 0;
-  cs_real_t r[3];
+  cs_real_t r[3] = {r_in[0], r_in[1], r_in[2]};
 
   /* determine triangle to choose */
 
-  cs_random_uniform(3, r);
-
   if (r[2] > 1) /* account for possible ? rounding errors */
     r[2] = 1;
 
@@ -290,11 +290,18 @@ _random_point_in_face(cs_lnum_t        n_vertices,
  *
  * The fluid velocity and other variables and attributes are computed here.
  *
+ * If a counter-based generator seed is given, random values for the i-th
+ * added particle are obtained using \ref cs_random_counter_uniform with
+ * key rng_seed[0] + i and counter rng_seed[1], and faces are handled in
+ * parallel; otherwise, the sequential generator is used.
+ *
  * \param[in,out]  particles          pointer to particle set
  * \param[in]      n_faces            number of faces in zone
  * \param[in]      face_ids           ids of faces in zone
  * \param[in]      face_particle_idx  starting index of added particles
  *                                    for each face in zone
+ * \param[in]      rng_seed           counter-based generator key and
+ *                                    counter, or NULL
  */
 /*----------------------------------------------------------------------------*/
 
@@ -302,77 +309,94 @@ void
 cs_lagr_new(cs_lagr_particle_set_t  *particles,
             cs_lnum_t                n_faces,
             const cs_lnum_t          face_ids[],
-            const cs_lnum_t          face_particle_idx[])
+            const cs_lnum_t          face_particle_idx[],
+            const uint64_t          *rng_seed)
 {
   const double d_eps = 1e-3;
 
   cs_mesh_t  *mesh = cs_glob_mesh;
   cs_mesh_quantities_t *fvq  = cs_glob_mesh_quantities;
 
-  cs_real_t  *acc_surf_r = NULL;
-  cs_lnum_t   n_vertices_max = 0;
+  /* The sequential generator is not thread-safe */
+
+  const bool parallel = (rng_seed != NULL && n_faces > CS_THR_MIN);
 
   /* Loop on faces */
 
-  for (cs_lnum_t li = 0; li < n_faces; li++) {
+# pragma omp parallel if (parallel)
+  {
+    cs_real_t  *acc_surf_r = NULL;
+    cs_lnum_t   n_vertices_max = 0;
 
-    cs_lnum_t n_f_p = face_particle_idx[li+1] - face_particle_idx[li];
+#   pragma omp for schedule(dynamic, CS_CL_SIZE)
+    for (cs_lnum_t li = 0; li < n_faces; li++) {
 
-    if (n_f_p < 1)
-      continue;
+      cs_lnum_t n_f_p = face_particle_idx[li+1] - face_particle_idx[li];
 
-    cs_lnum_t p_s_id = particles->n_particles + face_particle_idx[li];
+      if (n_f_p < 1)
+        continue;
 
-    const cs_lnum_t face_id = (face_ids != NULL) ? face_ids[li] : li;
+      cs_lnum_t p_s_id = particles->n_particles + face_particle_idx[li];
 
-    cs_lnum_t n_vertices =   mesh->b_face_vtx_idx[face_id+1]
-                           - mesh->b_face_vtx_idx[face_id];
+      const cs_lnum_t face_id = (face_ids != NULL) ? face_ids[li] : li;
 
-    const cs_lnum_t *vertex_ids =   mesh->b_face_vtx_lst
-                                  + mesh->b_face_vtx_idx[face_id];
+      cs_lnum_t n_vertices =   mesh->b_face_vtx_idx[face_id+1]
+                             - mesh->b_face_vtx_idx[face_id];
 
-    if (n_vertices > n_vertices_max) {
-      n_vertices_max = n_vertices*2;
-      BFT_REALLOC(acc_surf_r, n_vertices_max, cs_real_t);
-    }
+      const cs_lnum_t *vertex_ids =   mesh->b_face_vtx_lst
+                                    + mesh->b_face_vtx_idx[face_id];
 
-    _face_sub_surfaces(n_vertices,
-                       vertex_ids,
-                       (const cs_real_3_t *)mesh->vtx_coord,
-                       fvq->b_face_cog + 3*face_id,
-                       acc_surf_r);
+      if (n_vertices > n_vertices_max) {
+        n_vertices_max = n_vertices*2;
+        BFT_REALLOC(acc_surf_r, n_vertices_max, cs_real_t);
+      }
+
+      _face_sub_surfaces(n_vertices,
+                         vertex_ids,
+                         (const cs_real_3_t *)mesh->vtx_coord,
+                         fvq->b_face_cog + 3*face_id,
+                         acc_surf_r);
 
-    /* distribute new particles */
+      /* distribute new particles */
 
-    cs_lnum_t c_id = mesh->b_face_cells[face_id];
-    const cs_real_t *c_cen = fvq->cell_cen + c_id*3;
+      cs_lnum_t c_id = mesh->b_face_cells[face_id];
+      const cs_real_t *c_cen = fvq->cell_cen + c_id*3;
 
-    for (cs_lnum_t i = 0; i < n_f_p; i++) {
+      for (cs_lnum_t i = 0; i < n_f_p; i++) {
 
-      cs_lnum_t p_id = p_s_id + i;
+        cs_lnum_t p_id = p_s_id + i;
 
-      cs_lagr_particles_set_lnum(particles, p_id, CS_LAGR_CELL_ID, c_id);
+        cs_lagr_particles_set_lnum(particles, p_id, CS_LAGR_CELL_ID, c_id);
 
-      cs_real_t *part_coord
-        = cs_lagr_particles_attr(particles, p_id, CS_LAGR_COORDS);
+        cs_real_t *part_coord
+          = cs_lagr_particles_attr(particles, p_id, CS_LAGR_COORDS);
 
-      _random_point_in_face(n_vertices,
-                            vertex_ids,
-                            (const cs_real_3_t *)mesh->vtx_coord,
-                            fvq->b_face_cog + 3*face_id,
-                            acc_surf_r,
-                            part_coord);
+        cs_real_t r[3];
+        if (rng_seed != NULL)
+          cs_random_counter_uniform(rng_seed[0] + face_particle_idx[li] + i,
+                                    rng_seed[1], 3, r);
+        else
+          cs_random_uniform(3, r);
 
-      /* For safety, move particle slightly inside cell */
+        _random_point_in_face(r,
+                              n_vertices,
+                              vertex_ids,
+                              (const cs_real_3_t *)mesh->vtx_coord,
+                              fvq->b_face_cog + 3*face_id,
+                              acc_surf_r,
+                              part_coord);
 
-      for (cs_lnum_t j = 0; j < 3; j++)
-        part_coord[j] += (c_cen[j] - part_coord[j])*d_eps;
+        /* For safety, move particle slightly inside cell */
+
+        for (cs_lnum_t j = 0; j < 3; j++)
+          part_coord[j] += (c_cen[j] - part_coord[j])*d_eps;
+
+      }
 
     }
 
+    BFT_FREE(acc_surf_r);
   }
-
-  BFT_FREE(acc_surf_r);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -383,11 +407,18 @@ cs_lagr_new(cs_lagr_particle_set_t  *particles,
  *
  * The fluid velocity and other variables and attributes are computed here.
  *
+ * If a counter-based generator seed is given, random values for the i-th
+ * added particle are obtained using \ref cs_random_counter_uniform with
+ * key rng_seed[0] + i and counter rng_seed[1], and cells are handled in
+ * parallel; otherwise, the sequential generator is used.
+ *
  * \param[in,out]  particles          pointer to particle set
  * \param[in]      n_cells            number of cells in zone
  * \param[in]      cell_ids           ids of cells in zone
  * \param[in]      cell_particle_idx  starting index of added particles
  *                                    for each cell in zone
+ * \param[in]      rng_seed           counter-based generator key and
+ *                                    counter, or NULL
  */
 /*----------------------------------------------------------------------------*/
 
@@ -395,7 +426,8 @@ void
 cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
               cs_lnum_t                n_cells,
               const cs_lnum_t          cell_ids[],
-              const cs_lnum_t          cell_particle_idx[])
+              const cs_lnum_t          cell_particle_idx[],
+              const uint64_t          *rng_seed)
 {
   const double w_eps = 1e-24;
   const double d_eps = 1e-3;
@@ -408,217 +440,234 @@ cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
   cs_lagr_get_cell_face_connectivity(&cell_face_idx,
                                      &cell_face_lst);
 
-  cs_lnum_t  *cell_subface_index = NULL;
-  cs_real_t  *acc_vol_r = NULL;
-  cs_real_t  *acc_surf_r = NULL;
-  cs_lnum_t  n_divisions_max = 0, n_faces_max = 0;
+  /* The sequential generator is not thread-safe */
+
+  const bool parallel = (rng_seed != NULL && n_cells > CS_THR_MIN);
 
   /* Loop on cells */
 
-  for (cs_lnum_t li = 0; li < n_cells; li++) {
+# pragma omp parallel if (parallel)
+  {
+    cs_lnum_t  *cell_subface_index = NULL;
+    cs_real_t  *acc_vol_r = NULL;
+    cs_real_t  *acc_surf_r = NULL;
+    cs_lnum_t  n_divisions_max = 0, n_faces_max = 0;
 
-    cs_lnum_t n_c_p = cell_particle_idx[li+1] - cell_particle_idx[li];
+#   pragma omp for schedule(dynamic, CS_CL_SIZE)
+    for (cs_lnum_t li = 0; li < n_cells; li++) {
 
-    if (n_c_p < 1) /* ignore cells with no injected particles */
-      continue;
+      cs_lnum_t n_c_p = cell_particle_idx[li+1] - cell_particle_idx[li];
 
-    cs_lnum_t p_s_id = particles->n_particles +  cell_particle_idx[li];
+      if (n_c_p < 1) /* ignore cells with no injected particles */
+        continue;
 
-    const cs_lnum_t cell_id = (cell_ids != NULL) ? cell_ids[li] : li;
-    const cs_lnum_t n_cell_faces = cell_face_idx[cell_id+1] - cell_face_idx[cell_id];
+      cs_lnum_t p_s_id = particles->n_particles +  cell_particle_idx[li];
 
-    const cs_real_t *cell_cen = fvq->cell_cen + cell_id*3;
+      const cs_lnum_t cell_id = (cell_ids != NULL) ? cell_ids[li] : li;
+      const cs_lnum_t n_cell_faces
+        = cell_face_idx[cell_id+1] - cell_face_idx[cell_id];
 
-    if (n_cell_faces > n_faces_max) {
-      n_faces_max = n_cell_faces*2;
-      BFT_REALLOC(cell_subface_index, n_faces_max+1, cs_lnum_t);
-      BFT_REALLOC(acc_vol_r, n_faces_max, cs_real_t);
-    }
+      const cs_real_t *cell_cen = fvq->cell_cen + cell_id*3;
 
-    cell_subface_index[0] = 0;
+      if (n_cell_faces > n_faces_max) {
+        n_faces_max = n_cell_faces*2;
+        BFT_REALLOC(cell_subface_index, n_faces_max+1, cs_lnum_t);
+        BFT_REALLOC(acc_vol_r, n_faces_max, cs_real_t);
+      }
 
-    /* Loop on cell faces to determine volumes */
+      cell_subface_index[0] = 0;
 
-    bool fallback = false;
-    cs_real_t t_vol = 0;
+      /* Loop on cell faces to determine volumes */
 
-    for (cs_lnum_t i = 0; i < n_cell_faces; i++) {
+      bool fallback = false;
+      cs_real_t t_vol = 0;
 
-      cs_lnum_t face_id, n_vertices;
-      const cs_lnum_t *vertex_ids;
-      const cs_real_t *face_cog, *face_normal;
+      for (cs_lnum_t i = 0; i < n_cell_faces; i++) {
 
-      /* Outward normal: always well oriented for external faces,
-         depend on the connectivity for internal faces */
+        cs_lnum_t face_id, n_vertices;
+        const cs_lnum_t *vertex_ids;
+        const cs_real_t *face_cog, *face_normal;
 
-      cs_real_t v_mult = 1;
+        /* Outward normal: always well oriented for external faces,
+           depend on the connectivity for internal faces */
 
-      const cs_lnum_t face_num = cell_face_lst[cell_face_idx[cell_id] + i];
+        cs_real_t v_mult = 1;
 
-      if (face_num > 0) { /* Interior face */
+        const cs_lnum_t face_num = cell_face_lst[cell_face_idx[cell_id] + i];
 
-        face_id = face_num - 1;
+        if (face_num > 0) { /* Interior face */
 
-        if (cell_id == mesh->i_face_cells[face_id][1])
-          v_mult = -1;
-        cs_lnum_t vtx_s = mesh->i_face_vtx_idx[face_id];
-        n_vertices = mesh->i_face_vtx_idx[face_id+1] - vtx_s;
-        vertex_ids = mesh->i_face_vtx_lst + vtx_s;
-        face_cog = fvq->i_face_cog + (3*face_id);
-        face_normal = fvq->i_face_normal + (3*face_id);
+          face_id = face_num - 1;
 
-      }
-      else { /* Boundary faces */
+          if (cell_id == mesh->i_face_cells[face_id][1])
+            v_mult = -1;
+          cs_lnum_t vtx_s = mesh->i_face_vtx_idx[face_id];
+          n_vertices = mesh->i_face_vtx_idx[face_id+1] - vtx_s;
+          vertex_ids = mesh->i_face_vtx_lst + vtx_s;
+          face_cog = fvq->i_face_cog + (3*face_id);
+          face_normal = fvq->i_face_normal + (3*face_id);
 
-        assert(face_num < 0);
+        }
+        else { /* Boundary faces */
 
-        face_id = -face_num - 1;
+          assert(face_num < 0);
 
-        cs_lnum_t vtx_s = mesh->b_face_vtx_idx[face_id];
-        n_vertices = mesh->b_face_vtx_idx[face_id+1] - vtx_s;
-        vertex_ids = mesh->b_face_vtx_lst + vtx_s;
-        face_cog = fvq->b_face_cog + (3*face_id);
-        face_normal = fvq->b_face_normal + (3*face_id);
+          face_id = -face_num - 1;
 
-      }
+          cs_lnum_t vtx_s = mesh->b_face_vtx_idx[face_id];
+          n_vertices = mesh->b_face_vtx_idx[face_id+1] - vtx_s;
+          vertex_ids = mesh->b_face_vtx_lst + vtx_s;
+          face_cog = fvq->b_face_cog + (3*face_id);
+          face_normal = fvq->b_face_normal + (3*face_id);
 
-      cell_subface_index[i+1] = cell_subface_index[i] + n_vertices;
+        }
 
-      if (cell_subface_index[i+1] > n_divisions_max) {
-        n_divisions_max = cell_subface_index[i+1]*2;
-        BFT_REALLOC(acc_surf_r, n_divisions_max, cs_real_t);
-      }
+        cell_subface_index[i+1] = cell_subface_index[i] + n_vertices;
 
-      cs_real_t f_surf
-        = _face_sub_surfaces(n_vertices,
-                             vertex_ids,
-                             (const cs_real_3_t *)mesh->vtx_coord,
-                             face_cog,
-                             acc_surf_r + cell_subface_index[i]);
+        if (cell_subface_index[i+1] > n_divisions_max) {
+          n_divisions_max = cell_subface_index[i+1]*2;
+          BFT_REALLOC(acc_surf_r, n_divisions_max, cs_real_t);
+        }
 
-      cs_real_t fh = 0;
-      if (f_surf > 0) {
-        /* face normal should have length f_surf, so no need to divide here */
-        for (cs_lnum_t j = 0; j < 3; j++)
-          fh += (face_cog[j] - cell_cen[j]) * face_normal[j];
-      }
-      fh *= v_mult;
+        cs_real_t f_surf
+          = _face_sub_surfaces(n_vertices,
+                               vertex_ids,
+                               (const cs_real_3_t *)mesh->vtx_coord,
+                               face_cog,
+                               acc_surf_r + cell_subface_index[i]);
 
-      t_vol += CS_ABS(fh);
-      acc_vol_r[i] = t_vol;
+        cs_real_t fh = 0;
+        if (f_surf > 0) {
+          /* face normal should have length f_surf, so no need to divide here */
+          for (cs_lnum_t j = 0; j < 3; j++)
+            fh += (face_cog[j] - cell_cen[j]) * face_normal[j];
+        }
+        fh *= v_mult;
 
-      if (fh <= 0 || f_surf <= 0)
-        fallback = true;
+        t_vol += CS_ABS(fh);
+        acc_vol_r[i] = t_vol;
 
-    }
+        if (fh <= 0 || f_surf <= 0)
+          fallback = true;
 
-    if (t_vol >= w_eps) {
-      for (cs_lnum_t i = 0; i < n_cell_faces; i++)
-        acc_vol_r[i] /= t_vol;
-    }
-    else {
-      for (cs_lnum_t i = 0; i < n_cell_faces; i++)
-        acc_vol_r[i] = 1;
-    }
-    acc_vol_r[n_cell_faces - 1] = 1;
-
-    /* If needed, apply fallback to all faces, as in non-convex cases,
-       some cones may be partially masked by inverted cones;
-       weight is not based strictly on edge length in this case,
-       but bias cannot be avoid in this mode anyways, so do not bother
-       with extra steps. */
-
-    if (fallback) {
-      for (cs_lnum_t i = 0; i < cell_subface_index[n_cell_faces]; i++) {
-        if (acc_surf_r[i] > 0)
-          acc_surf_r[i] *= -1;
       }
-    }
 
-    /* distribute new particles */
-
-    for (cs_lnum_t i = 0; i < n_c_p; i++) {
+      if (t_vol >= w_eps) {
+        for (cs_lnum_t i = 0; i < n_cell_faces; i++)
+          acc_vol_r[i] /= t_vol;
+      }
+      else {
+        for (cs_lnum_t i = 0; i < n_cell_faces; i++)
+          acc_vol_r[i] = 1;
+      }
+      acc_vol_r[n_cell_faces - 1] = 1;
+
+      /* If needed, apply fallback to all faces, as in non-convex cases,
+         some cones may be partially masked by inverted cones;
+         weight is not based strictly on edge length in this case,
+         but bias cannot be avoid in this mode anyways, so do not bother
+         with extra steps. */
+
+      if (fallback) {
+        for (cs_lnum_t i = 0; i < cell_subface_index[n_cell_faces]; i++) {
+          if (acc_surf_r[i] > 0)
+            acc_surf_r[i] *= -1;
+        }
+      }
 
-      cs_lnum_t p_id = p_s_id + i;
+      /* distribute new particles */
 
-      cs_lagr_particles_set_lnum(particles, p_id, CS_LAGR_CELL_ID, cell_id);
+      for (cs_lnum_t i = 0; i < n_c_p; i++) {
 
-      cs_real_t *part_coord
-        = cs_lagr_particles_attr(particles, p_id, CS_LAGR_COORDS);
+        cs_lnum_t p_id = p_s_id + i;
 
-      /* search for matching center-to-face cone */
+        cs_lagr_particles_set_lnum(particles, p_id, CS_LAGR_CELL_ID, cell_id);
 
-      cs_real_t r[2];
-      cs_random_uniform(2, r);
+        cs_real_t *part_coord
+          = cs_lagr_particles_attr(particles, p_id, CS_LAGR_COORDS);
 
-      cs_lnum_t c_id = 0;
-      while (c_id < n_cell_faces && r[0] > acc_vol_r[c_id])
-        c_id++;
+        /* search for matching center-to-face cone */
 
-      cs_lnum_t face_id, n_vertices;
-      const cs_lnum_t *vertex_ids;
-      const cs_real_t *face_cog;
+        cs_real_t r[5];
+        if (rng_seed != NULL)
+          cs_random_counter_uniform(rng_seed[0] + cell_particle_idx[li] + i,
+                                    rng_seed[1], 5, r);
+        else {
+          cs_random_uniform(2, r);
+          cs_random_uniform(3, r + 2);
+        }
 
-      const cs_lnum_t face_num = cell_face_lst[cell_face_idx[cell_id] + c_id];
+        cs_lnum_t c_id = 0;
+        while (c_id < n_cell_faces && r[0] > acc_vol_r[c_id])
+          c_id++;
 
-      if (face_num > 0) { /* Interior face */
+        cs_lnum_t face_id, n_vertices;
+        const cs_lnum_t *vertex_ids;
+        const cs_real_t *face_cog;
 
-        face_id = face_num - 1;
+        const cs_lnum_t face_num = cell_face_lst[cell_face_idx[cell_id] + c_id];
 
-        cs_lnum_t vtx_s = mesh->i_face_vtx_idx[face_id];
-        n_vertices = mesh->i_face_vtx_idx[face_id+1] - vtx_s;
-        vertex_ids = mesh->i_face_vtx_lst + vtx_s;
-        face_cog = fvq->i_face_cog + (3*face_id);
+        if (face_num > 0) { /* Interior face */
 
-      }
-      else { /* Boundary faces */
+          face_id = face_num - 1;
 
-        assert(face_num < 0);
+          cs_lnum_t vtx_s = mesh->i_face_vtx_idx[face_id];
+          n_vertices = mesh->i_face_vtx_idx[face_id+1] - vtx_s;
+          vertex_ids = mesh->i_face_vtx_lst + vtx_s;
+          face_cog = fvq->i_face_cog + (3*face_id);
 
-        face_id = -face_num - 1;
+        }
+        else { /* Boundary faces */
 
-        cs_lnum_t vtx_s = mesh->b_face_vtx_idx[face_id];
-        n_vertices = mesh->b_face_vtx_idx[face_id+1] - vtx_s;
-        vertex_ids = mesh->b_face_vtx_lst + vtx_s;
-        face_cog = fvq->b_face_cog + (3*face_id);
+          assert(face_num < 0);
 
-      }
+          face_id = -face_num - 1;
 
-      _random_point_in_face(n_vertices,
-                            vertex_ids,
-                            (const cs_real_3_t *)mesh->vtx_coord,
-                            face_cog,
-                            acc_surf_r + cell_subface_index[c_id],
-                            part_coord);
+          cs_lnum_t vtx_s = mesh->b_face_vtx_idx[face_id];
+          n_vertices = mesh->b_face_vtx_idx[face_id+1] - vtx_s;
+          vertex_ids = mesh->b_face_vtx_lst + vtx_s;
+          face_cog = fvq->b_face_cog + (3*face_id);
 
-      /* In regular case, place point on segment joining cell center and
-         point in cell; volume of truncated cone proportional to
-         cube of distance along segment, so distribution compensates for this */
+        }
 
-      if (fallback == false) {
+        _random_point_in_face(r + 2,
+                              n_vertices,
+                              vertex_ids,
+                              (const cs_real_3_t *)mesh->vtx_coord,
+                              face_cog,
+                              acc_surf_r + cell_subface_index[c_id],
+                              part_coord);
 
-        cs_real_t t = pow(r[1], 1./3.) * (1.0 - d_eps);
-        for (cs_lnum_t j = 0; j < 3; j++)
-          part_coord[j] += (cell_cen[j] - part_coord[j]) * (1. - t);
-      }
+        /* In regular case, place point on segment joining cell center and
+           point in cell; volume of truncated cone proportional to
+           cube of distance along segment, so distribution compensates
+           for this */
 
-      /* Move particle slightly towards cell center cell
-         (assuming cell is star-shaped) */
+        if (fallback == false) {
 
-      else {
-        if (fvq->cell_vol[cell_id] > 0) {
+          cs_real_t t = pow(r[1], 1./3.) * (1.0 - d_eps);
           for (cs_lnum_t j = 0; j < 3; j++)
-            part_coord[j] += (cell_cen[j] - part_coord[j])*d_eps;
+            part_coord[j] += (cell_cen[j] - part_coord[j]) * (1. - t);
+        }
+
+        /* Move particle slightly towards cell center cell
+           (assuming cell is star-shaped) */
+
+        else {
+          if (fvq->cell_vol[cell_id] > 0) {
+            for (cs_lnum_t j = 0; j < 3; j++)
+              part_coord[j] += (cell_cen[j] - part_coord[j])*d_eps;
+          }
         }
-      }
 
-    } /* end of loop on new particles */
+      } /* end of loop on new particles */
 
-  } /* end of loop on cells */
+    } /* end of loop on cells */
 
-  BFT_FREE(acc_surf_r);
-  BFT_FREE(acc_vol_r);
-  BFT_FREE(cell_subface_index);
+    BFT_FREE(acc_surf_r);
+    BFT_FREE(acc_vol_r);
+    BFT_FREE(cell_subface_index);
+  }
 }
 
 /*----------------------------------------------------------------------------*/
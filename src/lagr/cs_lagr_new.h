@@ -61,11 +61,18 @@ BEGIN_C_DECLS
  *
  * The fluid velocity and other variables and attributes are computed here.
  *
+ * If a counter-based generator seed is given, random values for the i-th
+ * added particle are obtained using \ref cs_random_counter_uniform with
+ * key rng_seed[0] + i and counter rng_seed[1], and faces are handled in
+ * parallel; otherwise, the sequential generator is used.
+ *
  * \param[in,out]  particles          pointer to particle set
  * \param[in]      n_faces            number of faces in zone
  * \param[in]      face_ids           ids of faces in zone
  * \param[in]      face_particle_idx  starting index of added particles
  *                                    for each face in zone
+ * \param[in]      rng_seed           counter-based generator key and
+ *                                    counter, or NULL
  */
 /*----------------------------------------------------------------------------*/
 
@@ -73,7 +80,8 @@ void
 cs_lagr_new(cs_lagr_particle_set_t  *particles,
             cs_lnum_t                n_faces,
             const cs_lnum_t          face_ids[],
-            const cs_lnum_t          face_particle_idx[]);
+            const cs_lnum_t          face_particle_idx[],
+            const uint64_t          *rng_seed);
 
 /*----------------------------------------------------------------------------*/
 /*!
@@ -83,11 +91,18 @@ cs_lagr_new(cs_lagr_particle_set_t  *particles,
  *
  * The fluid velocity and other variables and attributes are computed here.
  *
+ * If a counter-based generator seed is given, random values for the i-th
+ * added particle are obtained using \ref cs_random_counter_uniform with
+ * key rng_seed[0] + i and counter rng_seed[1], and cells are handled in
+ * parallel; otherwise, the sequential generator is used.
+ *
  * \param[in,out]  particles          pointer to particle set
  * \param[in]      n_cells            number of cells in zone
  * \param[in]      cell_ids           ids of cells in zone
  * \param[in]      cell_particle_idx  starting index of added particles
  *                                    for each cell in zone
+ * \param[in]      rng_seed           counter-based generator key and
+ *                                    counter, or NULL
  */
 /*----------------------------------------------------------------------------*/
 
@@ -95,7 +110,8 @@ void
 cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
               cs_lnum_t                n_cells,
               const cs_lnum_t          cell_ids[],
-              const cs_lnum_t          cell_particle_idx[]);
+              const cs_lnum_t          cell_particle_idx[],
+              const uint64_t          *rng_seed);
 
 /*----------------------------------------------------------------------------*/
 /*!
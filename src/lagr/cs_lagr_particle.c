@@ -1269,6 +1269,109 @@ cs_lagr_particles_current_to_previous(cs_lagr_particle_set_t  *particles,
   *((cs_lnum_t *)(p_buf + p_am->displ[1][CS_LAGR_RANK_ID])) = cs_glob_rank_id;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reorder particles of a set by cell id (counting sort).
+ *
+ * Particles of a given cell are contiguous after this operation, and
+ * keep their relative order (the sort is stable). If \p cell_idx is
+ * non-NULL, it is filled with the matching cell -> particles index,
+ * so that particles of cell i are in range [cell_idx[i], cell_idx[i+1][.
+ * That index remains valid only until particles are added or removed.
+ *
+ * All particles are assumed to be located in a local cell.
+ *
+ * \param[in, out]  particles  associated particle set
+ * \param[in]       n_cells    number of local cells
+ * \param[out]      cell_idx   cell -> particles index (size: n_cells + 1),
+ *                             or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particles,
+                                  cs_lnum_t                n_cells,
+                                  cs_lnum_t                cell_idx[])
+{
+  const cs_lnum_t n_particles = particles->n_particles;
+  const size_t p_extents = particles->p_am->extents;
+  const ptrdiff_t cell_id_displ = particles->p_am->displ[0][CS_LAGR_CELL_ID];
+
+  cs_lnum_t *_cell_idx = cell_idx;
+  if (_cell_idx == NULL)
+    BFT_MALLOC(_cell_idx, n_cells+1, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells+1; i++)
+    _cell_idx[i] = 0;
+
+  /* Count particles per cell */
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    cs_lnum_t cell_id
+      = *((const cs_lnum_t *)(  particles->p_buffer + p_extents*i
+                              + cell_id_displ));
+    assert(cell_id > -1 && cell_id < n_cells);
+    _cell_idx[cell_id+1] += 1;
+  }
+
+  /* Convert count to index */
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _cell_idx[i+1] += _cell_idx[i];
+
+  assert(n_particles == _cell_idx[n_cells]);
+
+  /* Determine destination of each particle; the set is
+     often already (mostly) sorted, so check for that */
+
+  cs_lnum_t *dest_id;
+  BFT_MALLOC(dest_id, n_particles, cs_lnum_t);
+
+  bool is_sorted = true;
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    cs_lnum_t cell_id
+      = *((const cs_lnum_t *)(  particles->p_buffer + p_extents*i
+                              + cell_id_displ));
+    dest_id[i] = _cell_idx[cell_id];
+    _cell_idx[cell_id] += 1;
+    if (dest_id[i] != i)
+      is_sorted = false;
+  }
+
+  /* Shift index back */
+
+  for (cs_lnum_t i = n_cells; i > 0; i--)
+    _cell_idx[i] = _cell_idx[i-1];
+  _cell_idx[0] = 0;
+
+  /* Scatter particle data to a new buffer, which replaces the
+     previous one (avoiding an intermediate copy) */
+
+  if (is_sorted == false) {
+
+    unsigned char *p_buffer;
+    BFT_MALLOC(p_buffer,
+               (size_t)(particles->n_particles_max) * p_extents,
+               unsigned char);
+
+#   pragma omp parallel for if (n_particles > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_particles; i++)
+      memcpy(p_buffer + p_extents*dest_id[i],
+             particles->p_buffer + p_extents*i,
+             p_extents);
+
+    BFT_FREE(particles->p_buffer);
+    particles->p_buffer = p_buffer;
+
+  }
+
+  BFT_FREE(dest_id);
+
+  if (_cell_idx != cell_idx)
+    BFT_FREE(_cell_idx);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Dump a cs_lagr_particle_set_t structure
@@ -1440,6 +1440,30 @@ void
 cs_lagr_particles_current_to_previous(cs_lagr_particle_set_t  *particles,
                                       cs_lnum_t                particle_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reorder particles of a set by cell id (counting sort).
+ *
+ * Particles of a given cell are contiguous after this operation, and
+ * keep their relative order (the sort is stable). If \p cell_idx is
+ * non-NULL, it is filled with the matching cell -> particles index,
+ * so that particles of cell i are in range [cell_idx[i], cell_idx[i+1][.
+ * That index remains valid only until particles are added or removed.
+ *
+ * All particles are assumed to be located in a local cell.
+ *
+ * \param[in, out]  particles  associated particle set
+ * \param[in]       n_cells    number of local cells
+ * \param[out]      cell_idx   cell -> particles index (size: n_cells + 1),
+ *                             or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particles,
+                                  cs_lnum_t                n_cells,
+                                  cs_lnum_t                cell_idx[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Dump a cs_lagr_particle_set_t structure
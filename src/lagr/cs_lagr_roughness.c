@@ -220,7 +220,7 @@ cs_lagr_roughness_barrier(const void                     *particle,
   cs_real_t param2, value;
   cs_lnum_t param1,contact,compt_max;
   cs_lnum_t iclas, ints, np, iasp;
-  cs_real_t rpart2[2], udlvor[500];
+  cs_real_t rpart2[2], udlvor[500], distp[500], distcc[500], var2[500];
   cs_real_t distasp, posasp1[2000], posasp2[2000];
   cs_real_t posasp3[2000], posasp4[2000], disminp;
   cs_real_t scov[2], seff[1];
@@ -372,63 +372,73 @@ cs_lagr_roughness_barrier(const void                     *particle,
 
    /* Calculation of the energy barrier */
 
-   /* Loop on the separation distance */
-  for (np = 0; np <  500; np++) {
-    udlvor[np] = 0.;
-    cs_real_t distp =   dismin + (np + 1)
-                      * cs_lagr_roughness_param->debye_length[iel]/30.0;
+   /* Separation distances */
+  for (np = 0; np <  500; np++)
+    distp[np] =   dismin + (np + 1)
+                * cs_lagr_roughness_param->debye_length[iel]/30.0;
+
+  /* DLVO between the particle and the rough plate */
 
-    /* DLVO between the particle and the rough plate */
+  /* Sum of the interaction {particle-plate} and {particule-asperity};
+     EDL interactions are evaluated for all separation distances at once,
+     so that terms independent of the distance are computed only once. */
 
-    /* Sum of the interaction {particle-plate} and {particule-asperity} */
+  /* Sphere-plate interaction */
 
-    /* Sphere-plate interaction */
+  cs_lagr_edl_sphere_plane_n(500,
+                             distp,
+                             rpart,
+                             cs_lagr_roughness_param->valen,
+                             cs_lagr_roughness_param->phi_p,
+                             cs_lagr_roughness_param->phi_s,
+                             cs_lagr_roughness_param->temperature[iel],
+                             cs_lagr_roughness_param->debye_length[iel],
+                             cs_lagr_roughness_param->water_permit,
+                             var2);
+
+  for (np = 0; np <  500; np++) {
     cs_real_t var1
-      = cs_lagr_van_der_waals_sphere_plane(distp,
+      = cs_lagr_van_der_waals_sphere_plane(distp[np],
                                            rpart,
                                            cs_lagr_roughness_param->cstham,
                                            cs_lagr_roughness_param->lambda_vdw);
 
-    cs_real_t var2
-      = cs_lagr_edl_sphere_plane(distp,
-                                 rpart,
-                                 cs_lagr_roughness_param->valen,
-                                 cs_lagr_roughness_param->phi_p,
-                                 cs_lagr_roughness_param->phi_s,
-                                 cs_lagr_roughness_param->temperature[iel],
-                                 cs_lagr_roughness_param->debye_length[iel],
-                                 cs_lagr_roughness_param->water_permit);
-
-    udlvor[np] = (var1 + var2) * (1. - scovtot);
-
-    /* Sphere-asperity interactions */
-
-    for (iasp = 0; iasp <  nasptot; iasp++) {
-      cs_real_t distcc = sqrt(  pow(distp + rpart- posasp3[iasp], 2)
-                              + pow(posasp1[iasp],2));
+    udlvor[np] = (var1 + var2[np]) * (1. - scovtot);
+  }
 
-      var1
-        = cs_lagr_van_der_waals_sphere_sphere(distcc,
+  /* Sphere-asperity interactions */
+
+  for (iasp = 0; iasp <  nasptot; iasp++) {
+
+    for (np = 0; np <  500; np++)
+      distcc[np] = sqrt(  pow(distp[np] + rpart- posasp3[iasp], 2)
+                        + pow(posasp1[iasp],2));
+
+    cs_lagr_edl_sphere_sphere_n(500,
+                                distcc,
+                                rpart,
+                                posasp4[iasp],
+                                cs_lagr_roughness_param->valen,
+                                cs_lagr_roughness_param->phi_p,
+                                cs_lagr_roughness_param->phi_s,
+                                cs_lagr_roughness_param->temperature[iel],
+                                cs_lagr_roughness_param->debye_length[iel],
+                                cs_lagr_roughness_param->water_permit,
+                                var2);
+
+    for (np = 0; np <  500; np++) {
+      cs_real_t var1
+        = cs_lagr_van_der_waals_sphere_sphere(distcc[np],
                                               rpart,
                                               posasp4[iasp],
                                               cs_lagr_roughness_param->cstham,
                                               cs_lagr_roughness_param->lambda_vdw);
 
-      var2 = cs_lagr_edl_sphere_sphere(distcc,
-                                       rpart,
-                                       posasp4[iasp],
-                                       cs_lagr_roughness_param->valen,
-                                       cs_lagr_roughness_param->phi_p,
-                                       cs_lagr_roughness_param->phi_s,
-                                       cs_lagr_roughness_param->temperature[iel],
-                                       cs_lagr_roughness_param->debye_length[iel],
-                                       cs_lagr_roughness_param->water_permit);
-
-      udlvor[np] =   udlvor[np] + (var1 + var2)
-                   * (distp + rpart - posasp3[iasp]) / distcc;
+      udlvor[np] =   udlvor[np] + (var1 + var2[np])
+                   * (distp[np] + rpart - posasp3[iasp]) / distcc[np];
     }
 
-  } /* End of the loop on the separation distance */
+  } /* End of the loop on asperities */
 
   /* Tracking of the energy barrier */
   cs_real_t barren = 0.;
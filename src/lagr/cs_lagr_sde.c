@@ -36,6 +36,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <math.h>
+#include <string.h>
 
 /*----------------------------------------------------------------------------
  *  Local headers
@@ -52,6 +53,7 @@
 #include "cs_prototypes.h"
 #include "cs_random.h"
 #include "cs_thermal_model.h"
+#include "cs_time_step.h"
 
 #include "cs_lagr.h"
 #include "cs_lagr_adh.h"
@@ -80,6 +82,9 @@ BEGIN_C_DECLS
 /* Boltzmann constant */
 static const double _k_boltz = 1.38e-23;
 
+/* Use counter-based random number generator for Gaussian variables */
+static bool _counter_rng = false;
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -90,6 +95,50 @@ static const double _k_boltz = 1.38e-23;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return counter-based random number generator key for a particle.
+ *
+ * The key is based on the particle's associated random value, which is
+ * set at injection and migrates with the particle, so it does not depend
+ * on the particle's rank or local id.
+ *
+ * \param[in]  p_set  pointer to particle set
+ * \param[in]  p_id   particle id
+ *
+ * \return  generator key
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline uint64_t
+_particle_rng_key(const cs_lagr_particle_set_t  *p_set,
+                  cs_lnum_t                      p_id)
+{
+  cs_real_t r = cs_lagr_particles_get_real(p_set, p_id, CS_LAGR_RANDOM_VALUE);
+
+  uint64_t key = 0;
+  memcpy(&key, &r, CS_MIN(sizeof(cs_real_t), sizeof(uint64_t)));
+
+  return key;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return counter-based random number generator counter for
+ *        the current time step.
+ *
+ * \param[in]  stream_id  id of random variable set for a given time step
+ *
+ * \return  generator counter
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline uint64_t
+_rng_counter(int  stream_id)
+{
+  return ((uint64_t)(cs_glob_time_step->nt_cur) << 8) + (uint64_t)stream_id;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add a resulspension event
@@ -2713,6 +2762,13 @@ cs_lagr_sde(cs_real_t           dt_p,
         }
       }
     }
+    else if (_counter_rng) {
+      const uint64_t counter = _rng_counter(0);
+#     pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
+      for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++)
+        cs_random_counter_normal(_particle_rng_key(p_set, ip), counter,
+                                 9, &(vagaus[ip][0][0]));
+    }
     else {
       for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++)
         cs_random_normal(9, &(vagaus[ip][0][0]));
@@ -2742,6 +2798,13 @@ cs_lagr_sde(cs_real_t           dt_p,
           brgaus[ip*6 + id] = _br_gauss[id];
       }
     }
+    else if (_counter_rng) {
+      const uint64_t counter = _rng_counter(1);
+#     pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
+      for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++)
+        cs_random_counter_normal(_particle_rng_key(p_set, ip), counter,
+                                 6, &(brgaus[6 * ip]));
+    }
     else {
       for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++)
         cs_random_normal(6, &(brgaus[6 * ip]));
@@ -3012,6 +3075,28 @@ cs_lagr_sde_attr(cs_lagr_attribute_t   attr,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the random number generator used for the Gaussian
+ *        variables of the particle SDEs (turbulent dispersion and
+ *        Brownian motion).
+ *
+ * By default, the sequential generator of \ref cs_random_normal is used.
+ * With the counter-based generator (\ref cs_random_counter_normal),
+ * values are generated in parallel, and depend only on the particle and
+ * the time step, not on the number of ranks or threads, or on the
+ * order of particles.
+ *
+ * \param[in]  use_counter_rng  use counter-based generator if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_sde_set_counter_rng(bool  use_counter_rng)
+{
+  _counter_rng = use_counter_rng;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -92,6 +92,25 @@ cs_lagr_sde_attr(cs_lagr_attribute_t   attr,
                  cs_real_t            *tcarac,
                  cs_real_t            *pip);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the random number generator used for the Gaussian
+ *        variables of the particle SDEs (turbulent dispersion and
+ *        Brownian motion).
+ *
+ * By default, the sequential generator of \ref cs_random_normal is used.
+ * With the counter-based generator (\ref cs_random_counter_normal),
+ * values are generated in parallel, and depend only on the particle and
+ * the time step, not on the number of ranks or threads, or on the
+ * order of particles.
+ *
+ * \param[in]  use_counter_rng  use counter-based generator if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_sde_set_counter_rng(bool  use_counter_rng);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -2611,6 +2611,329 @@ _compute_current_weight_m(cs_lagr_moment_wa_t  *mwa,
   return w;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute current particle-based weights for a given accumulator.
+ *
+ * Cell ids and weights of all particles are gathered in contiguous arrays,
+ * so that loops on moments sharing this accumulator do not need to
+ * access those particle attributes again.
+ *
+ * \param[in]   mwa        moment weight accumulator
+ * \param[in]   p_set      particle set
+ * \param[in]   dt         cell time step values
+ * \param[in]   dt_mult    time step multiplier (1 if local, 0 otherwise)
+ * \param[out]  p_cell_id  cell id of each particle, or -1 for particles
+ *                         outside the domain or not in the accumulator's
+ *                         class (size: p_set->n_particles)
+ * \param[out]  p_weight   weight of each particle, multiplied by the
+ *                         time step (size: p_set->n_particles)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_compute_current_weight_p(const cs_lagr_moment_wa_t     *mwa,
+                          const cs_lagr_particle_set_t  *p_set,
+                          const cs_real_t               *restrict dt,
+                          cs_lnum_t                      dt_mult,
+                          cs_lnum_t                     *restrict p_cell_id,
+                          cs_real_t                     *restrict p_weight)
+{
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+  const bool have_class = (p_am->displ[0][CS_LAGR_STAT_CLASS] > 0);
+
+  for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
+
+    const unsigned char *particle = p_set->p_buffer + p_am->extents * part;
+
+    cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_am,
+                                                  CS_LAGR_CELL_ID);
+
+    int p_class = 0;
+    if (have_class)
+      p_class = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_STAT_CLASS);
+
+    if (cell_id >= 0 && (p_class == mwa->class || mwa->class == 0)) {
+
+      cs_real_t w;
+
+      if (mwa->p_data_func == NULL)
+        w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+      else
+        mwa->p_data_func(mwa->data_input, particle, p_am, &w);
+
+      p_cell_id[part] = cell_id;
+      p_weight[part] = w * dt[cell_id*dt_mult];
+
+    }
+    else {
+      p_cell_id[part] = -1;
+      p_weight[part] = 0.;
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Split particles in ranges which may be handled by separate threads.
+ *
+ * Ranges are built so that no cell is shared by different ranges, which is
+ * possible only if particles are sorted by cell (as is the case after
+ * the particle displacement step). Otherwise, a single range is used.
+ *
+ * \param[in]   n_particles  number of particles
+ * \param[in]   p_cell_id    cell id of each particle, or -1 for ignored
+ *                           particles (size: n_particles)
+ * \param[out]  t_range      start of particle range for each thread
+ *                           (size: cs_glob_n_threads + 1)
+ *
+ * \return  number of ranges
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_particle_thread_ranges(cs_lnum_t                  n_particles,
+                        const cs_lnum_t  *restrict p_cell_id,
+                        cs_lnum_t                  t_range[])
+{
+  int n_threads = cs_glob_n_threads;
+
+  if (n_particles < CS_THR_MIN*n_threads)
+    n_threads = 1;
+
+  /* Check particles are ordered by cell */
+
+  if (n_threads > 1) {
+    cs_lnum_t c_prev = -1;
+    for (cs_lnum_t i = 0; i < n_particles; i++) {
+      cs_lnum_t c_id = p_cell_id[i];
+      if (c_id > -1) {
+        if (c_id < c_prev) {
+          n_threads = 1;
+          break;
+        }
+        c_prev = c_id;
+      }
+    }
+  }
+
+  t_range[0] = 0;
+
+  /* Move range starts to the next cell change */
+
+  for (int t_id = 1; t_id < n_threads; t_id++) {
+
+    cs_lnum_t s_id = CS_MAX((cs_lnum_t)(((double)n_particles*t_id)/n_threads),
+                            t_range[t_id-1]);
+
+    cs_lnum_t c_prev = -1;
+    for (cs_lnum_t i = s_id - 1; i >= t_range[t_id-1] && c_prev < 0; i--)
+      c_prev = p_cell_id[i];
+
+    while (   s_id < n_particles
+           && (p_cell_id[s_id] < 0 || p_cell_id[s_id] == c_prev))
+      s_id++;
+
+    t_range[t_id] = s_id;
+
+  }
+
+  t_range[n_threads] = n_particles;
+
+  return n_threads;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update particle-based moments sharing a weight accumulator.
+ *
+ * All moments are updated in a single sweep on particles. When particles
+ * are sorted by cell, ranges of particles in disjoint cell sets are
+ * handled by different threads; the update order within a cell is
+ * unchanged, so results do not depend on the number of threads.
+ *
+ * \param[in]       p_set        particle set
+ * \param[in]       n_moments    number of moments to update
+ * \param[in]       moments      pointers to moments to update
+ * \param[in]       p_cell_id    cell id of each particle, or -1
+ * \param[in]       p_weight_dt  weight of each particle, multiplied by
+ *                               the time step
+ * \param[in, out]  l_wa_sum     accumulator weight sum for each cell
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_particle_moments(const cs_lagr_particle_set_t  *p_set,
+                         int                            n_moments,
+                         cs_lagr_moment_t              *moments[],
+                         const cs_lnum_t               *restrict p_cell_id,
+                         const cs_real_t               *restrict p_weight_dt,
+                         cs_real_t                     *restrict l_wa_sum)
+{
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+
+  /* Prepare moment values and work buffers */
+
+  int max_data_dim = 1;
+  cs_real_t **m_val, **m_mean_val;
+  BFT_MALLOC(m_val, n_moments, cs_real_t *);
+  BFT_MALLOC(m_mean_val, n_moments, cs_real_t *);
+
+  for (int m_id = 0; m_id < n_moments; m_id++) {
+    cs_lagr_moment_t *mt = moments[m_id];
+    m_val[m_id] = cs_field_by_id(mt->f_id)->val;
+    m_mean_val[m_id] = NULL;
+    if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+      cs_lagr_moment_t *mt_mean = _lagr_moments + mt->l_id;
+      m_mean_val[m_id] = cs_field_by_id(mt_mean->f_id)->val;
+    }
+    max_data_dim = CS_MAX(max_data_dim, mt->data_dim);
+  }
+
+  cs_lnum_t *t_range;
+  BFT_MALLOC(t_range, cs_glob_n_threads + 1, cs_lnum_t);
+
+  const int n_threads
+    = _particle_thread_ranges(p_set->n_particles, p_cell_id, t_range);
+
+  cs_real_t *t_pval;
+  BFT_MALLOC(t_pval, n_threads*max_data_dim, cs_real_t);
+
+# pragma omp parallel for num_threads(n_threads) if (n_threads > 1)
+  for (int t_id = 0; t_id < n_threads; t_id++) {
+
+    cs_real_t *pval_w = t_pval + t_id*max_data_dim;
+
+    for (cs_lnum_t part = t_range[t_id]; part < t_range[t_id+1]; part++) {
+
+      cs_lnum_t cell_id = p_cell_id[part];
+
+      if (cell_id < 0)
+        continue;
+
+      const unsigned char *particle = p_set->p_buffer + p_am->extents * part;
+
+      /* weight associated to current particle */
+
+      const cs_real_t p_weight = p_weight_dt[part];
+
+      /* update weight sum with new particle weight */
+
+      const cs_real_t wa_sum_n = CS_MAX(p_weight + l_wa_sum[cell_id], 1e-100);
+
+      for (int m_id = 0; m_id < n_moments; m_id++) {
+
+        const cs_lagr_moment_t *mt = moments[m_id];
+        cs_real_t *restrict val = m_val[m_id];
+        cs_real_t *restrict mean_val = m_mean_val[m_id];
+
+        const cs_real_t *pval = pval_w;
+
+        if (mt->p_data_func == NULL) {
+          int attr_id = cs_lagr_stat_type_to_attr_id(mt->stat_type);
+          pval = cs_lagr_particle_attr_const(particle, p_am, attr_id);
+        }
+        else
+          mt->p_data_func(mt->data_input, particle, p_am, pval_w);
+
+        if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+
+          if (mt->dim == 6) { /* variance-covariance matrix */
+
+            assert(mt->data_dim == 3);
+
+            double delta[3], delta_n[3], r[3], m_n[3];
+
+            for (int l = 0; l < 3; l++) {
+
+              cs_lnum_t jl = cell_id*6 + l;
+              cs_lnum_t jml = cell_id*3 + l;
+              delta[l]   = pval[l] - mean_val[jml];
+              r[l] = delta[l] * (p_weight / wa_sum_n);
+              m_n[l] = mean_val[jml] + r[l];
+              delta_n[l] = pval[l] - m_n[l];
+              val[jl] = (  val[jl]*l_wa_sum[cell_id]
+                         + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
+
+            }
+
+            /* Covariance terms.
+               Note we could have a symmetric formula using
+               0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
+               instead of
+               delta[i]*delta_n[j]
+               but unit tests in cs_moment_test.c do not seem to favor
+               one variant over the other; we use the simplest one.  */
+
+            cs_lnum_t j3 = cell_id*6 + 3,
+                      j4 = cell_id*6 + 4,
+                      j5 = cell_id*6 + 5;
+
+            val[j3] = (  val[j3]*l_wa_sum[cell_id]
+                       + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
+            val[j4] = (  val[j4]*l_wa_sum[cell_id]
+                       + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
+            val[j5] = (  val[j5]*l_wa_sum[cell_id]
+                       + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
+
+            /* update mean value */
+
+            for (cs_lnum_t l = 0; l < 3; l++)
+              mean_val[cell_id*3 + l] += r[l];
+
+          }
+
+          else { /* simple variance */
+
+            const cs_lnum_t dim = mt->dim;
+
+            for (cs_lnum_t l = 0; l < dim; l++) {
+
+              double delta = pval[l] - mean_val[cell_id*dim+l];
+              double r = delta * (p_weight / wa_sum_n);
+              double m_n = mean_val[cell_id*dim+l] + r;
+
+              val[cell_id*dim+l]
+                = (  val[cell_id*dim+l]*l_wa_sum[cell_id]
+                   + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
+
+              /* update mean value */
+
+              mean_val[cell_id*dim+l] += r;
+
+            }
+
+          }
+
+        }
+
+        else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
+
+          const cs_lnum_t dim = mt->dim;
+
+          for (cs_lnum_t l = 0; l < dim; l++)
+            val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
+                                  * p_weight / wa_sum_n;
+
+        } /* End of test if moment is a variance or a mean */
+
+      } /* End of loop on moments */
+
+      /* update local weight associated to current class */
+
+      l_wa_sum[cell_id] += p_weight;
+
+    } /* End of loop on particles */
+
+  } /* End of loop on threads */
+
+  BFT_FREE(t_pval);
+  BFT_FREE(t_range);
+  BFT_FREE(m_mean_val);
+  BFT_FREE(m_val);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Reset unsteady stats (all accumulators and particle-based moments).
@@ -2862,6 +3185,17 @@ _cs_lagr_stat_update_all(void)
     cs_real_t m_w0[1];
     cs_real_t *restrict m_weight = _compute_current_weight_m(mwa, dt_val, m_w0);
 
+    /* Particle-based weights, computed when first needed */
+
+    cs_lnum_t *restrict p_cell_id = NULL;
+    cs_real_t *restrict p_weight_dt = NULL;
+
+    /* Particle-based moments to update */
+
+    int n_p_moments = 0;
+    cs_lagr_moment_t **p_moments = NULL;
+    BFT_MALLOC(p_moments, _n_lagr_moments, cs_lagr_moment_t *);
+
     /* Loop on variances first, then means */
 
     for (int m_type = CS_LAGR_MOMENT_VARIANCE;
@@ -2878,186 +3212,36 @@ _cs_lagr_stat_update_all(void)
             && mwa->nt_start <= ts->nt_cur
             && mt->nt_cur < ts->nt_cur) {
 
-          int attr_id = cs_lagr_stat_type_to_attr_id(mt->stat_type);
-
           _ensure_init_moment(mt);
 
-          /* Copy weight sum content to a local array
-             for every new moment inside the current class */
+          /* Copy weight sum content to a local array */
 
-          if (m_weight == NULL && l_wa_sum == NULL)
+          if (m_weight == NULL && l_wa_sum == NULL) {
             BFT_MALLOC(l_wa_sum, n_w_elts, cs_real_t);
+            for (cs_lnum_t j = 0; j < n_w_elts; j++)
+              l_wa_sum[j] = g_wa_sum[j];
+          }
 
-          for (cs_lnum_t j = 0; j < n_w_elts; j++)
-            l_wa_sum[j] = g_wa_sum[j];
-
-          /* Case where data is particle-based */
-          /*-----------------------------------*/
+          /* Case where data is particle-based: moments are
+             updated together after this loop, in a single
+             sweep on particles */
+          /*------------------------------------------------*/
 
           if (mt->m_data_func == NULL) {
 
-            cs_field_t *f = cs_field_by_id(mt->f_id);
-            cs_real_t *restrict val = f->val;
-
-            /* prepare submoment definition */
-
-            cs_lagr_moment_t *mt_mean = NULL;
-            cs_real_t *restrict mean_val = NULL;
-
             /* Check if lower moment is defined and attached */
 
             if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
               assert(mt->l_id > -1);
-              mt_mean = _lagr_moments + mt->l_id;
+              cs_lagr_moment_t *mt_mean = _lagr_moments + mt->l_id;
               _ensure_init_moment(mt_mean);
-
-              cs_field_t *f_mean = cs_field_by_id(mt_mean->f_id);
-              mean_val = f_mean->val;
+              mt_mean->nt_cur = ts->nt_cur;
             }
 
-            cs_real_t *pval = NULL;
-            if (mt->p_data_func != NULL)
-              BFT_MALLOC(pval, mt->data_dim, cs_real_t);
-
-            for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
-
-              unsigned char *particle
-                = p_set->p_buffer + p_set->p_am->extents * part;
-
-              cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_set->p_am,
-                                                            CS_LAGR_CELL_ID);
-
-              int p_class = 0;
-              if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
-                p_class = cs_lagr_particle_get_lnum(particle,
-                                                    p_set->p_am,
-                                                    CS_LAGR_STAT_CLASS);
-
-              if (cell_id >= 0 && (p_class == mt->class || mt->class == 0)) {
-
-                /* weight associated to current particle */
-
-                cs_real_t p_weight;
-
-                if (mwa->p_data_func == NULL)
-                  p_weight = cs_lagr_particle_get_real(particle,
-                                                       p_set->p_am,
-                                                       CS_LAGR_STAT_WEIGHT);
-                else
-                  mwa->p_data_func(mwa->data_input,
-                                   particle,
-                                   p_set->p_am,
-                                   &p_weight);
-                p_weight *= dt_val[cell_id*dt_mult];
-
-                if (mt->p_data_func == NULL)
-                  pval = cs_lagr_particle_attr(particle, p_set->p_am, attr_id);
-                else
-                  mt->p_data_func(mt->data_input, particle, p_set->p_am, pval);
-
-                /* update weight sum with new particle weight */
-                const cs_real_t wa_sum_n = CS_MAX(p_weight + l_wa_sum[cell_id],
-                                                  1e-100);
-
-                if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
-
-                  if (mt->dim == 6) { /* variance-covariance matrix */
-
-                    assert(mt->data_dim == 3);
-
-                    double delta[3], delta_n[3], r[3], m_n[3];
-
-                    for (int l = 0; l < 3; l++) {
-
-                      cs_lnum_t jl = cell_id*6 + l;
-                      cs_lnum_t jml = cell_id*3 + l;
-                      delta[l]   = pval[l] - mean_val[jml];
-                      r[l] = delta[l] * (p_weight / wa_sum_n);
-                      m_n[l] = mean_val[jml] + r[l];
-                      delta_n[l] = pval[l] - m_n[l];
-                      val[jl] = (  val[jl]*l_wa_sum[cell_id]
-                                 + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
-
-                    }
-
-                    /* Covariance terms.
-                       Note we could have a symmetric formula using
-                       0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                       instead of
-                       delta[i]*delta_n[j]
-                       but unit tests in cs_moment_test.c do not seem to favor
-                       one variant over the other; we use the simplest one.  */
-
-                    cs_lnum_t j3 = cell_id*6 + 3,
-                              j4 = cell_id*6 + 4,
-                              j5 = cell_id*6 + 5;
-
-                    val[j3] = (  val[j3]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
-                    val[j4] = (  val[j4]*l_wa_sum[cell_id]
-                               + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
-                    val[j5] = (  val[j5]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
-
-                    /* update mean value */
-
-                    for (cs_lnum_t l = 0; l < 3; l++)
-                      mean_val[cell_id*3 + l] += r[l];
-
-                  }
-
-                  else { /* simple variance */
-
-                    /* new weight for the cell: weight attached to
-                       current particle (=dt*weight) plus old weight */
-
-                    const cs_lnum_t dim = mt->dim;
-
-                    for (cs_lnum_t l = 0; l < dim; l++) {
-
-                      double delta = pval[l] - mean_val[cell_id*dim+l];
-                      double r = delta * (p_weight / wa_sum_n);
-                      double m_n = mean_val[cell_id*dim+l] + r;
-
-                      val[cell_id*dim+l]
-                        = (  val[cell_id*dim+l]*l_wa_sum[cell_id]
-                           + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
-
-                      /* update mean value */
-
-                      mean_val[cell_id*dim+l] += r;
-
-                    }
-
-                  }
-
-                }
-
-                else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
-
-                  const cs_lnum_t dim = mt->dim;
-
-                  for (cs_lnum_t l = 0; l < dim; l++)
-                    val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
-                                          * p_weight / wa_sum_n;
-
-                } /* End of test if moment is a variance or a mean */
-
-                /* update local weight associated to current moment and class */
-
-                l_wa_sum[cell_id] += p_weight;
-
-              } /* End of test if particle is in a cell
-                   and if particle class corresponds to moment class */
-
-            } /* end of loop on particles */
+            mt->nt_cur = ts->nt_cur;
 
-            if (mt->p_data_func != NULL)
-              BFT_FREE(pval);
+            p_moments[n_p_moments++] = mt;
 
-            mt->nt_cur = ts->nt_cur;
-            if (mt->m_type == CS_LAGR_MOMENT_VARIANCE)
-              mt_mean->nt_cur = ts->nt_cur;
           }
 
           /* Case where data is mesh-based */
@@ -3075,6 +3259,29 @@ _cs_lagr_stat_update_all(void)
 
     } /* End of loop on moments */
 
+    /* Update particle-based moments */
+
+    if (n_p_moments > 0) {
+
+      /* Particle cells and weights are shared by all moments
+         using this accumulator */
+
+      BFT_MALLOC(p_cell_id, p_set->n_particles, cs_lnum_t);
+      BFT_MALLOC(p_weight_dt, p_set->n_particles, cs_real_t);
+      _compute_current_weight_p(mwa, p_set, dt_val, dt_mult,
+                                p_cell_id, p_weight_dt);
+
+      _update_particle_moments(p_set,
+                               n_p_moments,
+                               p_moments,
+                               p_cell_id,
+                               p_weight_dt,
+                               l_wa_sum);
+
+    }
+
+    BFT_FREE(p_moments);
+
     /* At end of loop on moments inside a class, update
        global class weight array */
 
@@ -3090,48 +3297,40 @@ _cs_lagr_stat_update_all(void)
     }
     else if (n_w_elts > 0) { /* Case where accumulator has no moments */
 
-      for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
-
-        unsigned char *particle
-          = p_set->p_buffer + p_set->p_am->extents * part;
-
-        cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_set->p_am,
-                                                      CS_LAGR_CELL_ID);
+      BFT_MALLOC(p_cell_id, p_set->n_particles, cs_lnum_t);
+      BFT_MALLOC(p_weight_dt, p_set->n_particles, cs_real_t);
+      _compute_current_weight_p(mwa, p_set, dt_val, dt_mult,
+                                p_cell_id, p_weight_dt);
 
-        int p_class = 0;
-        if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
-          p_class = cs_lagr_particle_get_lnum(particle,
-                                              p_set->p_am,
-                                              CS_LAGR_STAT_CLASS);
+      cs_lnum_t *t_range;
+      BFT_MALLOC(t_range, cs_glob_n_threads + 1, cs_lnum_t);
 
-        if (cell_id >= 0 && (p_class == mwa->class || mwa->class == 0)) {
+      const int n_threads
+        = _particle_thread_ranges(p_set->n_particles, p_cell_id, t_range);
 
-          /* weight associated to current particle */
+#     pragma omp parallel for num_threads(n_threads) if (n_threads > 1)
+      for (int t_id = 0; t_id < n_threads; t_id++) {
 
-          cs_real_t p_weight;
+        for (cs_lnum_t part = t_range[t_id]; part < t_range[t_id+1]; part++) {
 
-          if (mwa->p_data_func == NULL)
-            p_weight = cs_lagr_particle_get_real(particle,
-                                                 p_set->p_am,
-                                                 CS_LAGR_STAT_WEIGHT);
-          else
-            mwa->p_data_func(mwa->data_input,
-                             particle,
-                             p_set->p_am,
-                             &p_weight);
-          p_weight *= dt_val[cell_id*dt_mult];
+          cs_lnum_t cell_id = p_cell_id[part];
 
           /* update accumulator weight */
 
-          if (p_weight > 1e-100)
-            g_wa_sum[cell_id] += p_weight;
+          if (cell_id >= 0 && p_weight_dt[part] > 1e-100)
+            g_wa_sum[cell_id] += p_weight_dt[part];
 
-        }
+        } /* end of loop on particles */
 
-      } /* end of loop on particles */
+      }
+
+      BFT_FREE(t_range);
 
     }
 
+    BFT_FREE(p_cell_id);
+    BFT_FREE(p_weight_dt);
+
   } /* End of loop on active weight accumulators */
 }
 
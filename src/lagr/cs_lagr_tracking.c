@@ -54,6 +54,7 @@
 
 #include "fvm_periodicity.h"
 
+#include "cs_all_to_all.h"
 #include "cs_base.h"
 #include "cs_boundary_zone.h"
 #include "cs_physical_constants.h"
@@ -66,10 +67,12 @@
 #include "cs_mesh_quantities.h"
 #include "cs_order.h"
 #include "cs_parall.h"
+#include "cs_partition.h"
 #include "cs_porous_model.h"
 #include "cs_random.h"
 #include "cs_rotation.h"
 #include "cs_search.h"
+#include "cs_time_step.h"
 #include "cs_timer_stats.h"
 #include "cs_turbomachinery.h"
 
@@ -145,6 +148,22 @@ typedef struct {
 
 } cs_lagr_tracking_info_t;
 
+/* Particle set counters updated during the displacement stage */
+/* ------------------------------------------------------------ */
+
+/* These counters are private to each thread during local propagation,
+ * and added to those of the particle set once propagation is done. */
+
+typedef struct {
+
+  cs_lnum_t  n_part_dep;            /* number of deposited particles */
+  cs_lnum_t  n_part_fou;            /* number of fouling particles */
+
+  cs_real_t  weight_dep;            /* weight of deposited particles */
+  cs_real_t  weight_fou;            /* weight of fouling particles */
+
+} cs_lagr_tracking_counters_t;
+
 /* face_yplus auxiliary type */
 /* ------------------------- */
 
@@ -155,6 +174,20 @@ typedef struct {
 
 } face_yplus_t;
 
+/* Near-wall cell data for the deposition model */
+/* -------------------------------------------- */
+
+typedef struct {
+
+  cs_lnum_t     n_cells;       /* Number of cells */
+
+  cs_lnum_t    *cell_idx;      /* Index of deposition faces for each cell
+                                  (size: n_cells + 1) */
+  cs_lnum_t    *face_id;       /* Ids of adjacent deposition faces */
+  cs_real_3_t  *face_normal;   /* Unit normals of adjacent deposition faces */
+
+} cs_lagr_wall_cells_t;
+
 /* Manage the exchange of particles between communicating ranks */
 /* -------------------------------------------------------------*/
 
@@ -217,8 +250,24 @@ typedef struct {
 
 static  cs_lagr_track_builder_t  *_particle_track_builder = NULL;
 
+/* Deposition faces adjacent to each cell (rebuilt with boundary types) */
+
+static  cs_lagr_wall_cells_t  *_wall_cells = NULL;
+
 static  int            _max_propagation_loops = 100;
 
+/* Use packed all-to-all exchange (true) or halo-based exchange with
+   an MPI datatype (false) for particles changing rank */
+
+static  bool           _packed_exchange = false;
+
+/* Particle-weighted partitioning output parameters */
+
+static  double         _balance_threshold = -1.;
+static  double         _balance_p_weight = 1.;
+static  int            _balance_interval = 100;
+static  int            _balance_nt_prev = -1;
+
 /* MPI datatype associated to each particle "structure" */
 
 #if defined(HAVE_MPI)
@@ -827,6 +876,28 @@ _destroy_track_builder(cs_lagr_track_builder_t  *builder)
   return NULL;
 }
 
+/*----------------------------------------------------------------------------
+ * Destroy a cs_lagr_wall_cells_t structure.
+ *
+ * parameters:
+ *   wall_cells   <-> pointer to pointer to a cs_lagr_wall_cells_t structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_wall_cells(cs_lagr_wall_cells_t  **wall_cells)
+{
+  cs_lagr_wall_cells_t  *wc = *wall_cells;
+
+  if (wc == NULL)
+    return;
+
+  BFT_FREE(wc->cell_idx);
+  BFT_FREE(wc->face_id);
+  BFT_FREE(wc->face_normal);
+
+  BFT_FREE(*wall_cells);
+}
+
 /*----------------------------------------------------------------------------
  * Manage detected errors
  *
@@ -881,6 +952,7 @@ _manage_error(cs_lnum_t                       failsafe_mode,
  *
  * parameters:
  *   particles       <-- pointer to particle set
+ *   counters        <-> particle set counters for the current thread
  *   p_id            <-- particle id
  *   face_id         <-- index of the treated face
  *   t_intersect     <-- used to compute the intersection of the trajectory and
@@ -891,10 +963,11 @@ _manage_error(cs_lnum_t                       failsafe_mode,
  *----------------------------------------------------------------------------*/
 
 static cs_lagr_tracking_state_t
-_internal_treatment(cs_lagr_particle_set_t  *particles,
-                    cs_lnum_t                p_id,
-                    cs_lnum_t                face_id,
-                    double                   t_intersect)
+_internal_treatment(cs_lagr_particle_set_t       *particles,
+                    cs_lagr_tracking_counters_t  *counters,
+                    cs_lnum_t                     p_id,
+                    cs_lnum_t                     face_id,
+                    double                        t_intersect)
 {
   cs_lagr_tracking_state_t  particle_state = CS_LAGR_PART_TO_SYNC;
 
@@ -1006,12 +1079,14 @@ _internal_treatment(cs_lagr_particle_set_t  *particles,
 
       particle_state = CS_LAGR_PART_TREATED;
 
-      particles->n_part_dep += 1;
-      particles->weight_dep += particle_stat_weight;
+      counters->n_part_dep += 1;
+      counters->weight_dep += particle_stat_weight;
 
     }
   }
-  else if (internal_conditions->i_face_zone_id[face_id] == CS_LAGR_BC_USER)
+  else if (internal_conditions->i_face_zone_id[face_id] == CS_LAGR_BC_USER) {
+    /* User-defined interactions are not assumed to be thread-safe */
+#   pragma omp critical (_cs_lagr_tracking_serial)
     cs_lagr_user_internal_interaction(particles,
                                       p_id,
                                       face_id,
@@ -1019,6 +1094,7 @@ _internal_treatment(cs_lagr_particle_set_t  *particles,
                                       intersect_pt,
                                       t_intersect,
                                       &particle_state);
+  }
 
   /* FIXME: JBORD* (user-defined boundary condition) not yet implemented
      nor defined by a macro */
@@ -1032,6 +1108,39 @@ _internal_treatment(cs_lagr_particle_set_t  *particles,
   return particle_state;
 }
 
+/*----------------------------------------------------------------------------
+ * Get id for a new event in a given event set.
+ *
+ * The shared boundary interaction event set is flushed when full, while
+ * thread-private event sets are grown, as statistics may not be updated
+ * during threaded particle propagation.
+ *
+ * parameters:
+ *   events  <-> events structure
+ *
+ * returns:
+ *   id of new event
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_new_event_id(cs_lagr_event_set_t  *events)
+{
+  cs_lnum_t event_id = events->n_events;
+
+  if (event_id >= events->n_events_max) {
+    if (events == cs_lagr_event_set_boundary_interaction()) {
+      cs_lagr_stat_update_event(events,
+                                CS_LAGR_STAT_GROUP_TRACKING_EVENT);
+      events->n_events = 0;
+      event_id = 0;
+    }
+    else
+      cs_lagr_event_set_resize(events, events->n_events_max*2);
+  }
+
+  return event_id;
+}
+
 /*----------------------------------------------------------------------------
  * Add event when particle rolls off an interior face
  *
@@ -1050,13 +1159,7 @@ _roll_off_event(cs_lagr_particle_set_t    *particles,
 {
   /* Get event id, flushing events if necessary */
 
-  cs_lnum_t event_id = events->n_events;
-  if (event_id >= events->n_events_max) {
-    cs_lagr_stat_update_event(events,
-                              CS_LAGR_STAT_GROUP_TRACKING_EVENT);
-    events->n_events = 0;
-    event_id = 0;
-  }
+  cs_lnum_t event_id = _new_event_id(events);
   events->n_events += 1;
 
   /* Now set event values */
@@ -1089,6 +1192,7 @@ _roll_off_event(cs_lagr_particle_set_t    *particles,
  * parameters:
  *   particles       <-- pointer to particle set
  *   events          <-> events structure
+ *   counters        <-> particle set counters for the current thread
  *   p_id            <-- particle id
  *   face_id         <-- boundary face id
  *   face_norm       <-- unit face (or face subdivision) normal
@@ -1102,13 +1206,14 @@ _roll_off_event(cs_lagr_particle_set_t    *particles,
  *----------------------------------------------------------------------------*/
 
 static cs_lagr_tracking_state_t
-_boundary_treatment(cs_lagr_particle_set_t    *particles,
-                    cs_lagr_event_set_t       *events,
-                    cs_lnum_t                  p_id,
-                    cs_lnum_t                  face_id,
-                    cs_real_t                 *face_norm,
-                    double                     t_intersect,
-                    int                        b_z_id)
+_boundary_treatment(cs_lagr_particle_set_t       *particles,
+                    cs_lagr_event_set_t          *events,
+                    cs_lagr_tracking_counters_t  *counters,
+                    cs_lnum_t                     p_id,
+                    cs_lnum_t                     face_id,
+                    cs_real_t                    *face_norm,
+                    double                        t_intersect,
+                    int                           b_z_id)
 {
   const cs_mesh_t  *mesh = cs_glob_mesh;
   const double pi = cs_math_pi;
@@ -1183,14 +1288,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
 
   if (events != NULL) {
 
-    event_id = events->n_events;
-    if (event_id >= events->n_events_max) {
-      /* flush events */
-      cs_lagr_stat_update_event(events,
-                                CS_LAGR_STAT_GROUP_TRACKING_EVENT);
-      events->n_events = 0;
-      event_id = 0;
-    }
+    event_id = _new_event_id(events);
 
     cs_lagr_event_init_from_particle(events, particles, event_id, p_id);
 
@@ -1215,8 +1313,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
     particle_state = CS_LAGR_PART_OUT;
 
     if (b_type == CS_LAGR_DEPO1) {
-      particles->n_part_dep += 1;
-      particles->weight_dep += particle_stat_weight;
+      counters->n_part_dep += 1;
+      counters->weight_dep += particle_stat_weight;
       cs_lagr_particles_set_flag(particles, p_id, CS_LAGR_PART_DEPOSITED);
       event_flag = event_flag | CS_EVENT_DEPOSITION;
     }
@@ -1237,8 +1335,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
       particle_coord[k] = intersect_pt[k] + bc_epsilon * vect_cen[k];
     }
 
-    particles->n_part_dep += 1;
-    particles->weight_dep += particle_stat_weight;
+    counters->n_part_dep += 1;
+    counters->weight_dep += particle_stat_weight;
 
     /* Specific treatment in case of particle resuspension modeling */
 
@@ -1303,11 +1401,15 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
     }
     else {
 
-      if (cs_glob_lagr_model->roughness > 0)
+      /* The roughness barrier uses the (shared) random number generator */
+
+      if (cs_glob_lagr_model->roughness > 0) {
+#       pragma omp critical (_cs_lagr_tracking_serial)
         cs_lagr_roughness_barrier(particle,
                                   p_am,
                                   face_id,
                                   &energt);
+      }
 
       else if (cs_glob_lagr_model->roughness == 0) {
         cs_lagr_barrier(particle,
@@ -1330,8 +1432,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
       if (!cs_glob_lagr_model->clogging && !cs_glob_lagr_model->resuspension) {
         cs_lagr_particles_set_flag(particles, p_id, CS_LAGR_PART_DEPOSITED);
 
-        particles->n_part_dep += 1;
-        particles->weight_dep += particle_stat_weight;
+        counters->n_part_dep += 1;
+        counters->weight_dep += particle_stat_weight;
 
         cs_lagr_particles_set_flag(particles, p_id, CS_LAGR_PART_FIXED);
         particle_state = CS_LAGR_PART_STUCK;
@@ -1349,8 +1451,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
           particle_velocity[k] = 0.0;
           particle_coord[k] = intersect_pt[k] + bc_epsilon * vect_cen[k];
         }
-        particles->n_part_dep += 1;
-        particles->weight_dep += particle_stat_weight;
+        counters->n_part_dep += 1;
+        counters->weight_dep += particle_stat_weight;
         particle_state = CS_LAGR_PART_TREATED;
 
       }
@@ -1397,8 +1499,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
           cs_lagr_particle_set_lnum(particle, p_am, CS_LAGR_NEIGHBOR_FACE_ID,
                                     face_id);
 
-          particles->n_part_dep += 1;
-          particles->weight_dep += particle_stat_weight;
+          counters->n_part_dep += 1;
+          counters->weight_dep += particle_stat_weight;
           particle_state = CS_LAGR_PART_TREATED;
         }
         else {
@@ -1542,8 +1644,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
                                     * particle_stat_weight / cur_part_stat_weight);
 
           particle_state = CS_LAGR_PART_OUT;
-          particles->n_part_dep += 1;
-          particles->weight_dep += particle_stat_weight;
+          counters->n_part_dep += 1;
+          counters->weight_dep += particle_stat_weight;
 
           cur_part_height   = cs_lagr_particle_get_real(cur_part, p_am,
                                                         CS_LAGR_HEIGHT);
@@ -1684,6 +1786,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
         viscp = 0.1e0 * exp(log(10.e0)*tmp);
 
       if (viscp >= visref_icoal) {
+#       pragma omp critical (_cs_lagr_tracking_serial)
         cs_random_uniform(1, &random);
         trap = 1.e0- (visref_icoal / viscp);
       }
@@ -1696,8 +1799,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
         particle_state = CS_LAGR_PART_OUT;
 
         /* Recording for log/lagrangian.log */
-        particles->n_part_fou += 1;
-        particles->weight_fou += particle_stat_weight;
+        counters->n_part_fou += 1;
+        counters->weight_fou += particle_stat_weight;
 
         /* Recording for statistics */
         /* FIXME: For post-processing by trajectory purpose */
@@ -1749,7 +1852,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
 
   }
 
-  else if (b_type == CS_LAGR_BC_USER)
+  else if (b_type == CS_LAGR_BC_USER) {
+    /* User-defined interactions are not assumed to be thread-safe */
+#   pragma omp critical (_cs_lagr_tracking_serial)
     cs_lagr_user_boundary_interaction(particles,
                                       p_id,
                                       face_id,
@@ -1759,6 +1864,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
                                       b_z_id,
                                       &event_flag,
                                       &particle_state);
+  }
 
   else
     bft_error(__FILE__, __LINE__, 0,
@@ -1806,14 +1912,19 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
     cs_real_t fr =   particle_stat_weight
                    * cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
 
+    /* Zone and face values may be shared with other threads */
+
+#   pragma omp atomic
     bdy_conditions->particle_flow_rate[b_z_id*n_stats] -= fr;
 
     if (n_stats > 1) {
       int class_id
         = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_STAT_CLASS);
-      if (class_id > 0 && class_id < n_stats)
+      if (class_id > 0 && class_id < n_stats) {
+#       pragma omp atomic
         bdy_conditions->particle_flow_rate[  b_z_id*n_stats
                                            + class_id] -= fr;
+      }
     }
   }
 
@@ -1824,9 +1935,11 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
        || b_type == CS_LAGR_FOULING) {
 
     /* Number of particle-boundary interactions  */
-    if (cs_glob_lagr_boundary_interactions->has_part_impact_nbr > 0)
+    if (cs_glob_lagr_boundary_interactions->has_part_impact_nbr > 0) {
+#     pragma omp atomic
       bound_stat[cs_glob_lagr_boundary_interactions->inbr * n_b_faces + face_id]
         += particle_stat_weight;
+    }
 
   }
 
@@ -1839,6 +1952,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
  * parameters:
  *   particles                <-> pointer to particle set
  *   events                   <-> events structure
+ *   counters                 <-> particle set counters for current thread
  *   p_id                     <-- particle id
  *   displacement_step_id     <-- id of displacement step
  *   failsafe_mode            <-- with (0) / without (1) failure capability
@@ -1853,6 +1967,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
 static cs_lnum_t
 _local_propagation(cs_lagr_particle_set_t         *particles,
                    cs_lagr_event_set_t            *events,
+                   cs_lagr_tracking_counters_t    *counters,
                    cs_lnum_t                       p_id,
                    int                             displacement_step_id,
                    int                             failsafe_mode,
@@ -2166,6 +2281,7 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
 
       particle_state
         = _internal_treatment(cs_glob_lagr_particle_set,
+                              counters,
                               p_id,
                               face_id,
                               t_intersect);
@@ -2250,6 +2366,7 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
       particle_state
         = _boundary_treatment(particles,
                               events,
+                              counters,
                               p_id,
                               face_num - 1,
                               face_norm,
@@ -2488,22 +2605,178 @@ _exchange_particles(const cs_halo_t         *halo,
 }
 
 /*----------------------------------------------------------------------------
- * Determine particle halo sizes
+ * Exchange particles using a single packed all-to-all exchange.
+ *
+ * Particle data is handled as a sequence of 64-bit words, preceded by
+ * a bit mask indicating which words are non-zero; only those words
+ * are sent, as zero (unset or default) values are frequent in particle
+ * data, especially for previous time values and optional attributes.
+ *
+ * Contrary to the halo-based exchange, receive counts do not need to be
+ * exchanged beforehand, and the particle set is resized here.
+ *
+ * parameters:
+ *  halo      <-- pointer to a cs_halo_t structure
+ *  lag_halo  <-> pointer to a cs_lagr_halo_t structure
+ *  particles <-- set of particles to update
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+static void
+_exchange_particles_packed(const cs_halo_t         *halo,
+                           cs_lagr_halo_t          *lag_halo,
+                           cs_lagr_particle_set_t  *particles)
+{
+  const size_t extents = particles->p_am->extents;
+  const size_t n_words = extents / sizeof(uint64_t);
+  const size_t mask_size = (n_words + 7) / 8;
+
+  assert(extents % sizeof(uint64_t) == 0);
+
+  /* This is a collective operation, so ranks without halo
+     take part with no particles to send */
+
+  const int n_c_domains = (halo != NULL) ? halo->n_c_domains : 0;
+
+  cs_lnum_t  n_send = 0;
+  for (int rank = 0; rank < n_c_domains; rank++)
+    n_send += lag_halo->send_count[rank];
+
+  /* Pack non-zero words */
+
+  int *dest_rank = NULL;
+  cs_lnum_t *send_idx = NULL;
+  unsigned char *send_data = NULL;
+
+  BFT_MALLOC(dest_rank, n_send, int);
+  BFT_MALLOC(send_idx, n_send + 1, cs_lnum_t);
+  BFT_MALLOC(send_data, n_send*(mask_size + extents), unsigned char);
+
+  send_idx[0] = 0;
+
+  for (int rank = 0; rank < n_c_domains; rank++) {
+
+    cs_lnum_t s_id = lag_halo->send_shift[rank];
+    cs_lnum_t e_id = s_id + lag_halo->send_count[rank];
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+
+      const unsigned char *src = lag_halo->send_buf + extents*i;
+      unsigned char *mask = send_data + send_idx[i];
+      unsigned char *dest = mask + mask_size;
+
+      memset(mask, 0, mask_size);
+
+      for (size_t j = 0; j < n_words; j++) {
+        uint64_t w;
+        memcpy(&w, src + j*sizeof(uint64_t), sizeof(uint64_t));
+        if (w != 0) {
+          mask[j/8] |= (1 << (j%8));
+          memcpy(dest, &w, sizeof(uint64_t));
+          dest += sizeof(uint64_t);
+        }
+      }
+
+      dest_rank[i] = halo->c_domain_rank[rank];
+      send_idx[i+1] = dest - send_data;
+
+    }
+
+  }
+
+  /* Exchange */
+
+  cs_all_to_all_t *d
+    = cs_all_to_all_create(n_send,
+                           CS_ALL_TO_ALL_ORDER_BY_SRC_RANK,
+                           NULL,
+                           dest_rank,
+                           cs_glob_mpi_comm);
+
+  cs_all_to_all_transfer_dest_rank(d, &dest_rank);
+
+  cs_lnum_t *recv_idx = cs_all_to_all_copy_index(d,
+                                                 false, /* reverse */
+                                                 send_idx,
+                                                 NULL);
+
+  unsigned char *recv_data = cs_all_to_all_copy_indexed(d,
+                                                        CS_CHAR,
+                                                        false, /* reverse */
+                                                        send_idx,
+                                                        send_data,
+                                                        recv_idx,
+                                                        NULL);
+
+  cs_lnum_t n_recv_particles = cs_all_to_all_n_elts_dest(d);
+
+  cs_all_to_all_destroy(&d);
+
+  BFT_FREE(send_data);
+  BFT_FREE(send_idx);
+
+  /* Unpack received particles */
+
+  cs_lagr_particle_set_resize(particles->n_particles + n_recv_particles);
+
+  cs_real_t tot_weight = 0.;
+
+  for (cs_lnum_t i = 0; i < n_recv_particles; i++) {
+
+    cs_lnum_t j = particles->n_particles + i;
+
+    const unsigned char *mask = recv_data + recv_idx[i];
+    const unsigned char *src = mask + mask_size;
+    unsigned char *dest = particles->p_buffer + extents*j;
+
+    for (size_t k = 0; k < n_words; k++) {
+      if (mask[k/8] & (1 << (k%8))) {
+        memcpy(dest + k*sizeof(uint64_t), src, sizeof(uint64_t));
+        src += sizeof(uint64_t);
+      }
+      else
+        memset(dest + k*sizeof(uint64_t), 0, sizeof(uint64_t));
+    }
+
+    cs_real_t cur_part_stat_weight
+      = cs_lagr_particles_get_real(particles, j, CS_LAGR_STAT_WEIGHT);
+
+    tot_weight += cur_part_stat_weight;
+
+    _tracking_info(particles, j)->state = CS_LAGR_PART_TO_SYNC;
+
+  }
+
+  BFT_FREE(recv_data);
+  BFT_FREE(recv_idx);
+
+  particles->n_particles += n_recv_particles;
+  particles->weight += tot_weight;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Determine number of particles to send through particle halo.
  *
  * parameters:
  *   mesh      <-- pointer to associated mesh
  *   lag_halo  <-> pointer to particle halo structure to update
  *   particles <-- set of particles to update
+ *
+ * returns:
+ *   local number of particles to send
  *----------------------------------------------------------------------------*/
 
-static void
+static cs_lnum_t
 _lagr_halo_count(const cs_mesh_t               *mesh,
                  cs_lagr_halo_t                *lag_halo,
                  const cs_lagr_particle_set_t  *particles)
 {
   cs_lnum_t  i, ghost_id;
 
-  cs_lnum_t  n_recv_particles = 0, n_send_particles = 0;
+  cs_lnum_t  n_send_particles = 0;
 
   const cs_halo_t  *halo = mesh->halo;
 
@@ -2530,32 +2803,57 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
 
   } /* End of loop on particles */
 
+  for (i = 0; i < halo->n_c_domains; i++)
+    n_send_particles += lag_halo->send_count[i];
+
+  lag_halo->send_shift[0] = 0;
+
+  for (i = 1; i < halo->n_c_domains; i++)
+    lag_halo->send_shift[i] =  lag_halo->send_shift[i-1]
+                             + lag_halo->send_count[i-1];
+
+  /* Resize halo only if needed */
+
+  _resize_lagr_halo(lag_halo, n_send_particles);
+
+  return n_send_particles;
+}
+
+/*----------------------------------------------------------------------------
+ * Determine number of particles to receive through particle halo.
+ *
+ * This requires exchanging counters with neighboring ranks, and is
+ * not needed for the packed exchange.
+ *
+ * parameters:
+ *   halo      <-- pointer to a cs_halo_t structure
+ *   lag_halo  <-> pointer to particle halo structure to update
+ *   particles <-- set of particles to update
+ *----------------------------------------------------------------------------*/
+
+static void
+_lagr_halo_recv_count(const cs_halo_t               *halo,
+                      cs_lagr_halo_t                *lag_halo,
+                      const cs_lagr_particle_set_t  *particles)
+{
+  cs_lnum_t  n_recv_particles = 0;
+
   /* Exchange counters */
 
   _exchange_counter(halo, lag_halo);
 
-  for (i = 0; i < halo->n_c_domains; i++) {
+  for (int i = 0; i < halo->n_c_domains; i++)
     n_recv_particles += lag_halo->recv_count[i];
-    n_send_particles += lag_halo->send_count[i];
-  }
 
-  lag_halo->send_shift[0] = 0;
   lag_halo->recv_shift[0] = 0;
 
-  for (i = 1; i < halo->n_c_domains; i++) {
-
-    lag_halo->send_shift[i] =  lag_halo->send_shift[i-1]
-                             + lag_halo->send_count[i-1];
-
+  for (int i = 1; i < halo->n_c_domains; i++)
     lag_halo->recv_shift[i] =  lag_halo->recv_shift[i-1]
                              + lag_halo->recv_count[i-1];
 
-  }
-
-  /* Resize particle set and/or halo only if needed */
+  /* Resize particle set only if needed */
 
   cs_lagr_particle_set_resize(particles->n_particles + n_recv_particles);
-  _resize_lagr_halo(lag_halo, n_send_particles);
 }
 
 /*----------------------------------------------------------------------------
@@ -2574,7 +2872,6 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
   cs_lnum_t  i, k, tr_id, rank, shift, ghost_id;
   cs_real_t matrix[3][4];
 
-  cs_lnum_t  n_recv_particles = 0;
   cs_lnum_t  particle_count = 0;
 
   cs_lnum_t  n_merged_particles = 0;
@@ -2598,16 +2895,27 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
   const fvm_periodicity_t *periodicity = mesh->periodicity;
   const cs_interface_set_t  *face_ifs = builder->face_ifs;
 
+  /* Displacement continues if particles change rank on any rank;
+     this is the only global reduction of a displacement step, and
+     no exchange is needed when it is 0 */
+
   int continue_displacement = 0;
 
   if (halo != NULL) {
+    if (_lagr_halo_count(mesh, lag_halo, particles) > 0)
+      continue_displacement = 1;
+  }
 
-    _lagr_halo_count(mesh, lag_halo, particles);
+  cs_parall_max(1, CS_INT_TYPE, &continue_displacement);
+
+  if (continue_displacement && halo != NULL) {
+
+    if (_packed_exchange == false || cs_glob_n_ranks < 2)
+      _lagr_halo_recv_count(halo, lag_halo, particles);
 
-    for (i = 0; i < halo->n_c_domains; i++) {
-      n_recv_particles += lag_halo->recv_count[i];
+    for (i = 0; i < halo->n_c_domains; i++)
       lag_halo->send_count[i] = 0;
-    }
+
   }
 
   /* Loop on particles, transferring particles to synchronize to send_buf
@@ -2625,8 +2933,6 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
     if (cur_part_state == CS_LAGR_PART_TO_SYNC_NEXT) {
 
-      continue_displacement = 1;
-
       ghost_id =   cs_lagr_particles_get_lnum(particles, i, CS_LAGR_CELL_ID)
                  - halo->n_local_elts;
       rank = lag_halo->rank[ghost_id];
@@ -2814,10 +3120,15 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
   /* Exchange particles, then update set */
 
-  if (halo != NULL)
-    _exchange_particles(halo, lag_halo, particles);
-
-  cs_parall_max(1, CS_INT_TYPE, &continue_displacement);
+  if (continue_displacement) {
+#if defined(HAVE_MPI)
+    if (_packed_exchange && cs_glob_n_ranks > 1)
+      _exchange_particles_packed(halo, lag_halo, particles);
+    else
+#endif
+    if (halo != NULL)
+      _exchange_particles(halo, lag_halo, particles);
+  }
 
   return continue_displacement;
 }
@@ -2935,82 +3246,93 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles)
 static void
 _finalize_displacement(cs_lagr_particle_set_t  *particles)
 {
-  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
-  const cs_lnum_t  n_cells = cs_glob_mesh->n_cells;
-
-  const cs_lnum_t n_particles = particles->n_particles;
-
-  cs_lnum_t *cell_idx;
-  unsigned char *swap_buffer;
-  size_t swap_buffer_size = p_am->extents * ((size_t)n_particles);
-
-  BFT_MALLOC(cell_idx, n_cells+1, cs_lnum_t);
-  BFT_MALLOC(swap_buffer, swap_buffer_size, unsigned char);
-
-  /* Cell index (count first) */
-
-  for (cs_lnum_t i = 0; i < n_cells+1; i++)
-    cell_idx[i] = 0;
-
-  /* Copy unordered particle data to buffer */
-
-  for (cs_lnum_t i = 0; i < n_particles; i++) {
-
+#if defined(DEBUG) && !defined(NDEBUG)
+  for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
     cs_lnum_t cur_part_state = _get_tracking_info(particles, i)->state;
-
     assert(   cur_part_state < CS_LAGR_PART_OUT
            && cur_part_state != CS_LAGR_PART_TO_SYNC);
+  }
+#endif
 
-    cs_lnum_t cell_id = cs_lagr_particles_get_lnum(particles, i,
-                                                   CS_LAGR_CELL_ID);
+  /* Reorder particles by cell for locality of subsequent gathers */
 
-    memcpy(swap_buffer + p_am->extents*i,
-           particles->p_buffer + p_am->extents*i,
-           p_am->extents);
+  cs_lagr_particle_set_sort_by_cell(particles, cs_glob_mesh->n_cells, NULL);
 
-    cell_idx[cell_id+1] += 1;
+#if 0 && defined(DEBUG) && !defined(NDEBUG)
+  bft_printf("\n Particle set after %s\n", __func__);
+  cs_lagr_particle_set_dump(particles);
+#endif
 
-  }
+  if (cs_turbomachinery_get_model() == CS_TURBOMACHINERY_TRANSIENT)
+    _particle_track_builder = _destroy_track_builder(_particle_track_builder);
+}
 
-  /* Convert count to index */
+/*----------------------------------------------------------------------------
+ * Check particle load balance, and write a particle-weighted partitioning
+ * if the imbalance is above the user-defined threshold.
+ *
+ * parameters:
+ *   particles <-- pointer to particle set
+ *----------------------------------------------------------------------------*/
 
-  for (cs_lnum_t i = 1; i < n_cells; i++)
-    cell_idx[i+1] += cell_idx[i];
+static void
+_check_load_balance(const cs_lagr_particle_set_t  *particles)
+{
+  if (_balance_threshold <= 0 || cs_glob_n_ranks < 2)
+    return;
 
-  assert(n_particles == cell_idx[n_cells]);
+  const int nt_cur = cs_glob_time_step->nt_cur;
 
-  /* Now copy particle data and update some statistics */
+  if (   _balance_nt_prev > -1
+      && nt_cur < _balance_nt_prev + _balance_interval)
+    return;
 
-  const cs_lnum_t p_extents = particles->p_am->extents;
-  const cs_lnum_t cell_num_displ = particles->p_am->displ[0][CS_LAGR_CELL_ID];
+  /* Imbalance ratio: maximum to mean number of particles per rank */
 
-  for (cs_lnum_t i = 0; i < n_particles; i++) {
+  cs_gnum_t  n_g_particles = particles->n_particles;
+  cs_lnum_t  n_max_particles = particles->n_particles;
 
-    cs_lnum_t cell_id
-      = *((const cs_lnum_t *)(swap_buffer + p_extents*i + cell_num_displ));
+  cs_parall_counter(&n_g_particles, 1);
+  cs_parall_counter_max(&n_max_particles, 1);
 
-    assert(cell_id > -1);
+  if (n_g_particles == 0)
+    return;
 
-    cs_lnum_t particle_id = cell_idx[cell_id];
+  double imbalance =   (double)n_max_particles * cs_glob_n_ranks
+                     / (double)n_g_particles;
 
-    cell_idx[cell_id] += 1;
+  if (imbalance <= _balance_threshold)
+    return;
+
+  /* Cell weights: unit weight per cell, plus a weight per particle */
+
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+
+  cs_real_t  *cell_weight = NULL;
+  BFT_MALLOC(cell_weight, mesh->n_cells, cs_real_t);
 
-    memcpy(particles->p_buffer + p_am->extents*particle_id,
-           swap_buffer + p_am->extents*i,
-           p_am->extents);
+  for (cs_lnum_t c_id = 0; c_id < mesh->n_cells; c_id++)
+    cell_weight[c_id] = 1.;
 
+  for (cs_lnum_t p_id = 0; p_id < particles->n_particles; p_id++) {
+    cs_lnum_t c_id = cs_lagr_particles_get_lnum(particles, p_id,
+                                                CS_LAGR_CELL_ID);
+    if (c_id > -1 && c_id < mesh->n_cells)
+      cell_weight[c_id] += _balance_p_weight;
   }
 
-  BFT_FREE(swap_buffer);
-  BFT_FREE(cell_idx);
+  bft_printf(_("\n Lagrangian particles imbalance (max/mean per rank): %g\n"
+               " (threshold %g); writing particle-weighted partitioning,\n"
+               " which may be used for a restart\n"),
+             imbalance, _balance_threshold);
 
-#if 0 && defined(DEBUG) && !defined(NDEBUG)
-  bft_printf("\n Particle set after %s\n", __func__);
-  cs_lagr_particle_set_dump(particles);
-#endif
+  cs_partition_write_weighted(mesh,
+                              cs_glob_mesh_quantities->cell_cen,
+                              cell_weight);
 
-  if (cs_turbomachinery_get_model() == CS_TURBOMACHINERY_TRANSIENT)
-    _particle_track_builder = _destroy_track_builder(_particle_track_builder);
+  BFT_FREE(cell_weight);
+
+  _balance_nt_prev = nt_cur;
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -3101,13 +3423,43 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   _initialize_displacement(particles);
 
+  /* Particles are propagated independently, using thread-private
+     counters and event sets; the clogging model requires a serial
+     loop, as deposition then depends on previously deposited particles. */
+
+  const int n_threads = (lagr_model->clogging) ? 1 : cs_glob_n_threads;
+
+  cs_lagr_tracking_counters_t  *t_counters = NULL;
+  cs_lagr_event_set_t  **t_events = NULL;
+
+  BFT_MALLOC(t_counters, n_threads, cs_lagr_tracking_counters_t);
+  BFT_MALLOC(t_events, n_threads, cs_lagr_event_set_t *);
+
+  for (int t_id = 0; t_id < n_threads; t_id++) {
+    t_counters[t_id].n_part_dep = 0;
+    t_counters[t_id].n_part_fou = 0;
+    t_counters[t_id].weight_dep = 0.;
+    t_counters[t_id].weight_fou = 0.;
+    if (events == NULL)
+      t_events[t_id] = NULL;
+    else if (n_threads == 1)
+      t_events[t_id] = events;
+    else
+      t_events[t_id] = cs_lagr_event_set_create();
+  }
+
   /* Main loop on particles: global propagation */
 
   while (continue_displacement) {
 
-    /* Local propagation */
+    /* Local propagation; particles leaving the domain are only marked here,
+       and removed when synchronizing the particle set */
 
-    for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
+    const cs_lnum_t n_particles = particles->n_particles;
+
+#   pragma omp parallel for schedule(dynamic, CS_CL_SIZE) \
+                            num_threads(n_threads) if (n_threads > 1)
+    for (cs_lnum_t i = 0; i < n_particles; i++) {
 
       /* Local copies of the current and previous particles state vectors
          to be used in case of the first pass of _local_propagation fails */
@@ -3117,10 +3469,17 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
       if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
 
+#if defined(HAVE_OPENMP)
+        int t_id = omp_get_thread_num();
+#else
+        int t_id = 0;
+#endif
+
         /* Main particle displacement stage */
 
         cur_part_state = _local_propagation(particles,
-                                            events,
+                                            t_events[t_id],
+                                            t_counters + t_id,
                                             i,
                                             displacement_step_id,
                                             failsafe_mode,
@@ -3134,6 +3493,18 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
     } /* End of loop on particles */
 
+    /* Update statistics with thread-private events */
+
+    if (events != NULL && n_threads > 1) {
+      for (int t_id = 0; t_id < n_threads; t_id++) {
+        if (t_events[t_id]->n_events > 0) {
+          cs_lagr_stat_update_event(t_events[t_id],
+                                    CS_LAGR_STAT_GROUP_TRACKING_EVENT);
+          t_events[t_id]->n_events = 0;
+        }
+      }
+    }
+
     /* Update of the particle set structure. Delete exited particles,
        update for particles which change domain. */
 
@@ -3151,10 +3522,25 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   } /* End of while (global displacement) */
 
+  for (int t_id = 0; t_id < n_threads; t_id++) {
+    particles->n_part_dep += t_counters[t_id].n_part_dep;
+    particles->n_part_fou += t_counters[t_id].n_part_fou;
+    particles->weight_dep += t_counters[t_id].weight_dep;
+    particles->weight_fou += t_counters[t_id].weight_fou;
+    if (events != NULL && n_threads > 1)
+      cs_lagr_event_set_destroy(t_events + t_id);
+  }
+
+  BFT_FREE(t_events);
+  BFT_FREE(t_counters);
+
   /* Deposition sub-model additional loop */
 
   if (lagr_model->deposition > 0) {
 
+    /* Particles are independent here */
+
+#   pragma omp parallel for if (particles->n_particles > CS_THR_MIN)
     for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
 
       unsigned char *particle = particles->p_buffer + p_am->extents * i;
@@ -3316,9 +3702,66 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   _finalize_displacement(particles);
 
+  _check_load_balance(particles);
+
   cs_timer_stats_switch(t_top_id);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define particle-weighted partitioning output parameters.
+ *
+ * When the ratio of the maximum to mean number of particles per rank
+ * exceeds the given threshold after a particle movement step, a
+ * partitioning of the mesh in which each cell is weighted by
+ * 1 + particle_weight * (number of particles in cell) is written to
+ * "partition_output/domain_number_<n_ranks>". That file may be used as
+ * partition input for a restart on the same number of ranks, so as to
+ * balance the Lagrangian work.
+ *
+ * The partitioning is written at most once every \c interval time steps.
+ * It is not written in serial mode or when the threshold is <= 0
+ * (the default).
+ *
+ * \param[in]  imbalance_threshold  particle imbalance ratio threshold
+ * \param[in]  particle_weight      weight of a particle relative to a cell
+ * \param[in]  interval             minimum number of time steps between
+ *                                  successive outputs
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_set_load_balance(double  imbalance_threshold,
+                                  double  particle_weight,
+                                  int     interval)
+{
+  _balance_threshold = imbalance_threshold;
+  _balance_p_weight = particle_weight;
+  _balance_interval = interval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the exchange method for particles changing rank.
+ *
+ * By default, particles are exchanged with neighboring ranks using an
+ * MPI datatype matching the particle structure, after an exchange
+ * of particle counts. With the packed exchange, particles are sent
+ * through a single \ref cs_all_to_all_t exchange per displacement step,
+ * with zero-valued particle data elided, which reduces both message sizes
+ * and the number of synchronizations.
+ *
+ * \param[in]  packed  true to use the packed exchange, false for the
+ *                     default halo-based exchange
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_set_packed_exchange(bool  packed)
+{
+  _packed_exchange = packed;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Finalize Lagrangian module.
@@ -3342,6 +3785,8 @@ cs_lagr_tracking_finalize(void)
   /* Destroy builder */
   _particle_track_builder = _destroy_track_builder(_particle_track_builder);
 
+  _destroy_wall_cells(&_wall_cells);
+
   /* Destroy internal condition structure*/
 
   cs_lagr_finalize_internal_cond();
@@ -3368,6 +3813,89 @@ cs_lagr_tracking_finalize(void)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update the deposition faces adjacent to each cell.
+ *
+ * This compact cell -> deposition face list, with associated unit normals,
+ * is used by \ref cs_lagr_test_wall_cell, so that cells not adjacent
+ * to a deposition face are skipped immediately, and face normals are not
+ * normalized again for each particle.
+ *
+ * It must be called whenever Lagrangian boundary face types or the mesh
+ * geometry may have changed (i.e. once per Lagrangian time step).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_update_wall_cells(void)
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_lnum_t  n_cells = mesh->n_cells;
+
+  const cs_lnum_t  *cell_b_face_idx
+    = cs_glob_mesh_adjacencies->cell_b_faces_idx;
+  const cs_lnum_t  *cell_b_faces = cs_glob_mesh_adjacencies->cell_b_faces;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->b_face_normal;
+
+  assert(cs_glob_lagr_boundary_conditions != NULL);
+
+  const char *b_type = cs_glob_lagr_boundary_conditions->elt_type;
+
+  if (_wall_cells == NULL) {
+    BFT_MALLOC(_wall_cells, 1, cs_lagr_wall_cells_t);
+    _wall_cells->n_cells = 0;
+    _wall_cells->cell_idx = NULL;
+    _wall_cells->face_id = NULL;
+    _wall_cells->face_normal = NULL;
+  }
+
+  cs_lagr_wall_cells_t  *wc = _wall_cells;
+
+  wc->n_cells = n_cells;
+  BFT_REALLOC(wc->cell_idx, n_cells + 1, cs_lnum_t);
+
+  /* Count, then fill */
+
+  wc->cell_idx[0] = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_lnum_t n_w_faces = 0;
+    for (cs_lnum_t i = cell_b_face_idx[c_id];
+         i < cell_b_face_idx[c_id+1];
+         i++) {
+      const char f_type = b_type[cell_b_faces[i]];
+      if (   (f_type == CS_LAGR_DEPO1)
+          || (f_type == CS_LAGR_DEPO2)
+          || (f_type == CS_LAGR_DEPO_DLVO))
+        n_w_faces++;
+    }
+    wc->cell_idx[c_id+1] = wc->cell_idx[c_id] + n_w_faces;
+  }
+
+  BFT_REALLOC(wc->face_id, wc->cell_idx[n_cells], cs_lnum_t);
+  BFT_REALLOC(wc->face_normal, wc->cell_idx[n_cells], cs_real_3_t);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_lnum_t j = wc->cell_idx[c_id];
+    for (cs_lnum_t i = cell_b_face_idx[c_id];
+         i < cell_b_face_idx[c_id+1];
+         i++) {
+      cs_lnum_t f_id = cell_b_faces[i];
+      const char f_type = b_type[f_id];
+      if (   (f_type == CS_LAGR_DEPO1)
+          || (f_type == CS_LAGR_DEPO2)
+          || (f_type == CS_LAGR_DEPO_DLVO)) {
+        wc->face_id[j] = f_id;
+        cs_math_3_normalise(b_face_normal[f_id], wc->face_normal[j]);
+        j++;
+      }
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Determine the number of the closest wall face from the particle
@@ -3375,6 +3903,10 @@ cs_lagr_tracking_finalize(void)
  *
  * Used for the deposition model.
  *
+ * If \ref cs_lagr_tracking_update_wall_cells has been called, only the
+ * deposition faces of the particle's cell are considered, using their
+ * precomputed unit normals.
+ *
  * \param[in]   particle     particle attributes for current time step
  * \param[in]   p_am         pointer to attributes map for current time step
  * \param[in]   visc_length  viscous layer thickness
@@ -3396,16 +3928,47 @@ cs_lagr_test_wall_cell(const void                     *particle,
   *yplus = 10000;
   *face_id = -1;
 
-  cs_lnum_t  *cell_b_face_idx = cs_glob_mesh_adjacencies->cell_b_faces_idx;
-  cs_lnum_t  *cell_b_faces = cs_glob_mesh_adjacencies->cell_b_faces;
-  const cs_real_3_t *restrict b_face_normal
-    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->b_face_normal;
   const cs_real_3_t *restrict b_face_cog
     = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->b_face_cog;
 
   const cs_real_t  *particle_coord
     = cs_lagr_particle_attr_const(particle, p_am, CS_LAGR_COORDS);
 
+  /* Use near-wall cell data when available */
+
+  if (_wall_cells != NULL) {
+
+    const cs_lagr_wall_cells_t  *wc = _wall_cells;
+
+    assert(cell_id < wc->n_cells);
+
+    for (cs_lnum_t i = wc->cell_idx[cell_id];
+         i < wc->cell_idx[cell_id+1];
+         i++) {
+
+      cs_lnum_t f_id = wc->face_id[i];
+
+      /* [(x_f - x_p) . n ] / L */
+      cs_real_t dist_norm = CS_ABS(
+          cs_math_3_distance_dot_product(b_face_cog[f_id],
+                                         particle_coord,
+                                         wc->face_normal[i]))
+                            / visc_length[f_id];
+      if (dist_norm  < *yplus) {
+        *yplus = dist_norm;
+        *face_id = f_id;
+      }
+
+    }
+
+    return;
+  }
+
+  cs_lnum_t  *cell_b_face_idx = cs_glob_mesh_adjacencies->cell_b_faces_idx;
+  cs_lnum_t  *cell_b_faces = cs_glob_mesh_adjacencies->cell_b_faces;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->b_face_normal;
+
   cs_lnum_t  start = cell_b_face_idx[cell_id];
   cs_lnum_t  end =  cell_b_face_idx[cell_id + 1];
 
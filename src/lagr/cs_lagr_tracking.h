@@ -89,6 +89,53 @@ cs_lagr_tracking_initialize(void);
 void
 cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define particle-weighted partitioning output parameters.
+ *
+ * When the ratio of the maximum to mean number of particles per rank
+ * exceeds the given threshold after a particle movement step, a
+ * partitioning of the mesh in which each cell is weighted by
+ * 1 + particle_weight * (number of particles in cell) is written to
+ * "partition_output/domain_number_<n_ranks>". That file may be used as
+ * partition input for a restart on the same number of ranks, so as to
+ * balance the Lagrangian work.
+ *
+ * The partitioning is written at most once every \c interval time steps.
+ * It is not written in serial mode or when the threshold is <= 0
+ * (the default).
+ *
+ * \param[in]  imbalance_threshold  particle imbalance ratio threshold
+ * \param[in]  particle_weight      weight of a particle relative to a cell
+ * \param[in]  interval             minimum number of time steps between
+ *                                  successive outputs
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_set_load_balance(double  imbalance_threshold,
+                                  double  particle_weight,
+                                  int     interval);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the exchange method for particles changing rank.
+ *
+ * By default, particles are exchanged with neighboring ranks using an
+ * MPI datatype matching the particle structure, after an exchange
+ * of particle counts. With the packed exchange, particles are sent
+ * through a single \ref cs_all_to_all_t exchange per displacement step,
+ * with zero-valued particle data elided, which reduces both message sizes
+ * and the number of synchronizations.
+ *
+ * \param[in]  packed  true to use the packed exchange, false for the
+ *                     default halo-based exchange
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_set_packed_exchange(bool  packed);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Finalize Lagrangian module.
@@ -98,6 +145,23 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[]);
 void
 cs_lagr_tracking_finalize(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update the deposition faces adjacent to each cell.
+ *
+ * This compact cell -> deposition face list, with associated unit normals,
+ * is used by \ref cs_lagr_test_wall_cell, so that cells not adjacent
+ * to a deposition face are skipped immediately, and face normals are not
+ * normalized again for each particle.
+ *
+ * It must be called whenever Lagrangian boundary face types or the mesh
+ * geometry may have changed (i.e. once per Lagrangian time step).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_update_wall_cells(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Determine the number of the closest wall face from the particle
@@ -105,6 +169,10 @@ cs_lagr_tracking_finalize(void);
  *
  * Used for the deposition model.
  *
+ * If \ref cs_lagr_tracking_update_wall_cells has been called, only the
+ * deposition faces of the particle's cell are considered, using their
+ * precomputed unit normals.
+ *
  * \param[in]   particle     particle attributes for current time step
  * \param[in]   p_am         pointer to attributes map for current time step
  * \param[in]   visc_length  viscous layer thickness
@@ -1513,56 +1513,96 @@ _join_performance_log(const cs_join_t  *this_join)
        (unsigned long long)stats->box_mem_final[0],
        (unsigned long long)stats->box_mem_required[0]);
 
-  cs_log_printf
-    (CS_LOG_PERFORMANCE,
-     _("  Associated times:\n"
-       "    Face bounding boxes tree construction:          %10.3g\n"
-       "    Face bounding boxes neighborhood query:         %10.3g\n"),
-     stats->t_box_build.wall_nsec*1.e-9,
-     stats->t_box_query.wall_nsec*1.e-9);
-
-  cs_log_printf
-    (CS_LOG_PERFORMANCE,
-     _("    Sorting possible intersections between faces:   %10.3g\n"),
-     stats->t_inter_sort.wall_nsec*1e-9);
-
-  cs_log_printf
-    (CS_LOG_PERFORMANCE,
-     _("    Definition of local joining mesh:               %10.3g\n"),
-     stats->t_l_join_mesh.wall_nsec*1e-9);
-
-  cs_log_printf
-    (CS_LOG_PERFORMANCE,
-     _("    Edge intersections:                             %10.3g\n"),
-     stats->t_edge_inter.wall_nsec*1e-9);
-
-  cs_log_printf
-    (CS_LOG_PERFORMANCE,
-     _("    Creation of new vertices:                       %10.3g\n"),
-     stats->t_new_vtx.wall_nsec*1e-9);
-
-  cs_log_printf
-    (CS_LOG_PERFORMANCE,
-     _("    Merging vertices:                               %10.3g\n"),
-     stats->t_merge_vtx.wall_nsec*1e-9);
-
-  cs_log_printf
-    (CS_LOG_PERFORMANCE,
-     _("    Updating structures with vertex merging:        %10.3g\n"),
-     stats->t_u_merge_vtx.wall_nsec*1e-9);
-
-  cs_log_printf
-    (CS_LOG_PERFORMANCE,
-     _("    Split old faces and reconstruct new faces:      %10.3g\n"),
-     stats->t_split_faces.wall_nsec*1e-9);
-
-  cs_log_printf
-    (CS_LOG_PERFORMANCE,
-     _("\n"
-       "  Complete treatment for joining %2d:\n"
-       "    wall clock time:                                %10.3g\n"),
-     this_join->param.num,
-     stats->t_total.wall_nsec*1e-9);
+  /* Times per phase; in parallel, the local rank's times are replaced
+     by the mean, minimum, and maximum over ranks, so that load imbalance
+     between ranks in a given phase may be detected */
+
+  const char *t_name[] = {
+    N_("Face bounding boxes tree construction:"),
+    N_("Face bounding boxes neighborhood query:"),
+    N_("Sorting possible intersections between faces:"),
+    N_("Selection of faces and vertices:"),
+    N_("Definition of local joining mesh:"),
+    N_("Edge intersections:"),
+    N_("Creation of new vertices:"),
+    N_("Merging vertices:"),
+    N_("Updating structures with vertex merging:"),
+    N_("Split old faces and reconstruct new faces:"),
+    N_("Cleaning of joined mesh:"),
+    N_("Complete treatment:")};
+
+  const cs_timer_counter_t *t_counter[] = {&(stats->t_box_build),
+                                           &(stats->t_box_query),
+                                           &(stats->t_inter_sort),
+                                           &(stats->t_select),
+                                           &(stats->t_l_join_mesh),
+                                           &(stats->t_edge_inter),
+                                           &(stats->t_new_vtx),
+                                           &(stats->t_merge_vtx),
+                                           &(stats->t_u_merge_vtx),
+                                           &(stats->t_split_faces),
+                                           &(stats->t_clean),
+                                           &(stats->t_total)};
+
+  const int n_t = sizeof(t_counter) / sizeof(t_counter[0]);
+
+  double t_mean[12], t_min[12], t_max[12];
+
+  assert(n_t <= 12);
+
+  for (int i = 0; i < n_t; i++) {
+    t_mean[i] = t_counter[i]->wall_nsec*1e-9;
+    t_min[i] = t_mean[i];
+    t_max[i] = t_mean[i];
+  }
+
+  cs_parall_sum(n_t, CS_DOUBLE, t_mean);
+  cs_parall_min(n_t, CS_DOUBLE, t_min);
+  cs_parall_max(n_t, CS_DOUBLE, t_max);
+
+  if (cs_glob_n_ranks > 1) {
+
+    for (int i = 0; i < n_t; i++)
+      t_mean[i] /= cs_glob_n_ranks;
+
+    cs_log_printf
+      (CS_LOG_PERFORMANCE,
+       _("  Associated times:                                  rank mean"
+         "      minimum      maximum\n"));
+
+    for (int i = 0; i < n_t - 1; i++)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "    %-47s %10.3g | %10.3g | %10.3g\n",
+                    _(t_name[i]), t_mean[i], t_min[i], t_max[i]);
+
+    cs_log_printf
+      (CS_LOG_PERFORMANCE,
+       _("\n"
+         "  Complete treatment for joining %2d:\n"
+         "    wall clock time:                                %10.3g |"
+         " %10.3g | %10.3g\n"),
+       this_join->param.num,
+       t_mean[n_t-1], t_min[n_t-1], t_max[n_t-1]);
+
+  }
+  else {
+
+    cs_log_printf(CS_LOG_PERFORMANCE, _("  Associated times:\n"));
+
+    for (int i = 0; i < n_t - 1; i++)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "    %-47s %10.3g\n",
+                    _(t_name[i]), t_mean[i]);
+
+    cs_log_printf
+      (CS_LOG_PERFORMANCE,
+       _("\n"
+         "  Complete treatment for joining %2d:\n"
+         "    wall clock time:                                %10.3g\n"),
+       this_join->param.num,
+       t_mean[n_t-1]);
+
+  }
 
   cs_log_printf_flush(CS_LOG_PERFORMANCE);
 }
@@ -1802,8 +1842,13 @@ cs_join_all(bool  preprocess)
        will be destroyed after joining and rebuilt for each new join
        operation in order to take into account mesh modification  */
 
+    cs_timer_t ts0 = cs_timer_time();
+
     _select_entities(this_join, mesh);
 
+    cs_timer_t ts1 = cs_timer_time();
+    cs_timer_counter_add_diff(&(this_join->stats.t_select), &ts0, &ts1);
+
     /* Now execute the joining operation */
 
     if (this_join->selection->n_g_faces > 0) {
@@ -1922,8 +1967,13 @@ cs_join_all(bool  preprocess)
 
       /* Clean mesh (delete redundant edge definition) */
 
+      ts0 = cs_timer_time();
+
       cs_join_update_mesh_clean(join_param, mesh);
 
+      ts1 = cs_timer_time();
+      cs_timer_counter_add_diff(&(this_join->stats.t_clean), &ts0, &ts1);
+
     }
     else
       bft_printf(_("\nStop joining algorithm: no face selected...\n"));
@@ -589,6 +589,95 @@ _local_spread(const cs_join_eset_t  *vtx_eset,
 
 #if defined(HAVE_MPI)
 
+/*----------------------------------------------------------------------------
+ * Shortcut global vtx_tag values (pointer jumping).
+ *
+ * Each tag is the global number of a vertex of the same set of equivalent
+ * vertices, so it may be replaced by the tag of that vertex. This halves
+ * the length of chains of equivalences at each global iteration, so the
+ * number of global iterations required grows only logarithmically with
+ * the number of ranks spanned by a chain.
+ *
+ * parameters:
+ *   block_size   <-- size of block for the current rank
+ *   glob_vtx_tag <-> global vtx_tag affected to the local rank
+ *                    (size: block_size)
+ *---------------------------------------------------------------------------*/
+
+static void
+_global_shortcut(cs_lnum_t   block_size,
+                 cs_gnum_t   glob_vtx_tag[])
+{
+  const cs_gnum_t  _n_ranks = cs_glob_n_ranks;
+  const cs_gnum_t  _local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  /* Only tags referring to another vertex need to be queried */
+
+  cs_lnum_t  n_send = 0;
+  cs_lnum_t  *send_id = NULL;
+
+  BFT_MALLOC(send_id, block_size, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < block_size; i++) {
+    cs_gnum_t  gi = i;
+    if (glob_vtx_tag[i] != gi*_n_ranks + _local_rank + 1)
+      send_id[n_send++] = i;
+  }
+
+  int  *dest_rank;
+  cs_gnum_t  *send_buf;
+
+  BFT_MALLOC(dest_rank, n_send, int);
+  BFT_MALLOC(send_buf, n_send, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_send; i++) {
+    cs_gnum_t  t_id = glob_vtx_tag[send_id[i]] - 1;
+    dest_rank[i] = t_id % _n_ranks;
+    send_buf[i] = t_id / _n_ranks;
+  }
+
+  cs_all_to_all_t *d
+    = cs_all_to_all_create(n_send,
+                           0, /* flags */
+                           NULL,
+                           dest_rank,
+                           cs_glob_mpi_comm);
+
+  cs_all_to_all_transfer_dest_rank(d, &dest_rank);
+
+  cs_gnum_t  *recv_buf = cs_all_to_all_copy_array(d,
+                                                  CS_GNUM_TYPE,
+                                                  1,
+                                                  false,  /* reverse */
+                                                  send_buf,
+                                                  NULL);
+
+  /* Reply with the tag of the referred vertex */
+
+  const cs_lnum_t n_recv = cs_all_to_all_n_elts_dest(d);
+
+  for (cs_lnum_t i = 0; i < n_recv; i++)
+    recv_buf[i] = glob_vtx_tag[recv_buf[i]];
+
+  cs_all_to_all_copy_array(d,
+                           CS_GNUM_TYPE,
+                           1,
+                           true,  /* reverse */
+                           recv_buf,
+                           send_buf);
+
+  cs_all_to_all_destroy(&d);
+
+  for (cs_lnum_t i = 0; i < n_send; i++) {
+    cs_lnum_t  cur_id = send_id[i];
+    glob_vtx_tag[cur_id] = CS_MIN(glob_vtx_tag[cur_id], send_buf[i]);
+  }
+
+  BFT_FREE(recv_buf);
+  BFT_FREE(send_buf);
+  BFT_FREE(send_id);
+}
+
 /*----------------------------------------------------------------------------
  * Exchange local vtx_tag buffer over the ranks and update global vtx_tag
  * buffers. Apply modifications observed on the global vtx_tag to the local
@@ -651,6 +740,8 @@ _global_spread(cs_lnum_t              block_size,
     glob_vtx_tag[cur_id] = CS_MIN(glob_vtx_tag[cur_id], recv_glob_buffer[i]);
   }
 
+  _global_shortcut(block_size, glob_vtx_tag);
+
   int local_value = _is_spread_not_converged(block_size,
                                              prev_glob_vtx_tag,
                                              glob_vtx_tag);
@@ -249,12 +249,14 @@ _join_stats_init(void)
   CS_TIMER_COUNTER_INIT(stats.t_box_query);
   CS_TIMER_COUNTER_INIT(stats.t_inter_sort);
 
+  CS_TIMER_COUNTER_INIT(stats.t_select);
   CS_TIMER_COUNTER_INIT(stats.t_l_join_mesh);
   CS_TIMER_COUNTER_INIT(stats.t_edge_inter);
   CS_TIMER_COUNTER_INIT(stats.t_new_vtx);
   CS_TIMER_COUNTER_INIT(stats.t_merge_vtx);
   CS_TIMER_COUNTER_INIT(stats.t_u_merge_vtx);
   CS_TIMER_COUNTER_INIT(stats.t_split_faces);
+  CS_TIMER_COUNTER_INIT(stats.t_clean);
 
   CS_TIMER_COUNTER_INIT(stats.t_total);
 
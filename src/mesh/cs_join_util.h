@@ -97,12 +97,14 @@ typedef struct {
 
   /* other info */
 
+  cs_timer_counter_t  t_select;       /* face and vertex selection times */
   cs_timer_counter_t  t_l_join_mesh;  /* build local joining mesh times */
   cs_timer_counter_t  t_edge_inter;   /* edge intersection times */
   cs_timer_counter_t  t_new_vtx;      /* new vertices times */
   cs_timer_counter_t  t_merge_vtx;    /* merge vertices times */
   cs_timer_counter_t  t_u_merge_vtx;  /* update after merge vertices times */
   cs_timer_counter_t  t_split_faces;  /* split faces times */
+  cs_timer_counter_t  t_clean;        /* final mesh cleaning times */
 
   cs_timer_counter_t  t_total;        /* total time */
 
@@ -0,0 +1,464 @@
+/*============================================================================
+ * Indicator-driven mesh adaptation (refinement and coarsening)
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <float.h>
+#include <string.h>
+#include <stdlib.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_file.h"
+#include "cs_log.h"
+#include "cs_mesh_coarsen.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_refine.h"
+#include "cs_parall.h"
+#include "cs_restart.h"
+#include "cs_restart_map.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_adapt.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Number of bisection iterations for threshold determination */
+
+#define _N_BISECT_ITER 50
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute refinement level of each cell.
+ *
+ * The refinement level of a cell is the highest generation of its
+ * interior faces, as in the coarsening algorithm.
+ *
+ * parameters:
+ *   m       <-- pointer to mesh structure
+ *   c_level --> refinement level of each cell (size: n_cells)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_r_level(const cs_mesh_t  *m,
+              int               c_level[])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    c_level[i] = 0;
+
+  if (m->i_face_r_gen == NULL)
+    return;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    int r_gen = m->i_face_r_gen[f_id];
+    if (r_gen < 1)
+      continue;
+    for (cs_lnum_t i = 0; i < 2; i++) {
+      cs_lnum_t c_id = m->i_face_cells[f_id][i];
+      if (c_id < n_cells && r_gen > c_level[c_id])
+        c_level[c_id] = r_gen;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Count eligible cells whose signed indicator value is above a threshold.
+ *
+ * parameters:
+ *   n_cells   <-- number of cells
+ *   sign      <-- 1 to compare values, -1 to compare opposite values
+ *   threshold <-- threshold
+ *   indicator <-- cell indicator
+ *   eligible  <-- eligibility flag for each cell
+ *
+ * returns:
+ *   global number of cells above threshold
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_count_above(cs_lnum_t         n_cells,
+             double            sign,
+             double            threshold,
+             const cs_real_t   indicator[],
+             const int         eligible[])
+{
+  cs_gnum_t count = 0;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    if (eligible[i] && sign*indicator[i] > threshold)
+      count++;
+  }
+
+  cs_parall_counter(&count, 1);
+
+  return count;
+}
+
+/*----------------------------------------------------------------------------
+ * Flag a given fraction of eligible cells with highest signed indicator
+ * values.
+ *
+ * The associated threshold is determined by bisection, so that the
+ * number of flagged cells (over all ranks) does not exceed the
+ * requested fraction of eligible cells.
+ *
+ * parameters:
+ *   n_cells   <-- number of cells
+ *   sign      <-- 1 to select highest values, -1 to select lowest values
+ *   fraction  <-- fraction of eligible cells to flag
+ *   indicator <-- cell indicator
+ *   eligible  <-- eligibility flag for each cell
+ *   cell_flag <-> flag for each cell (set to 1 for selected cells)
+ *
+ * returns:
+ *   global number of flagged cells
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_flag_fraction(cs_lnum_t         n_cells,
+               double            sign,
+               double            fraction,
+               const cs_real_t   indicator[],
+               const int         eligible[],
+               int               cell_flag[])
+{
+  cs_gnum_t n_eligible = 0;
+  double v_range[2] = {DBL_MAX, -DBL_MAX};
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    if (eligible[i]) {
+      double v = sign*indicator[i];
+      if (v < v_range[0])
+        v_range[0] = v;
+      if (v > v_range[1])
+        v_range[1] = v;
+      n_eligible++;
+    }
+  }
+
+  cs_parall_counter(&n_eligible, 1);
+  cs_parall_min(1, CS_DOUBLE, v_range);
+  cs_parall_max(1, CS_DOUBLE, v_range + 1);
+
+  cs_gnum_t n_target = fraction * n_eligible;
+
+  if (n_target < 1)
+    return 0;
+
+  /* Threshold is always kept in a range such that the number of values
+     above t_max does not exceed the target, and those above t_min do */
+
+  double t_min = v_range[0], t_max = v_range[1];
+
+  if (_count_above(n_cells, sign, t_min, indicator, eligible) <= n_target)
+    t_max = t_min;
+
+  for (int iter = 0; iter < _N_BISECT_ITER && t_max > t_min; iter++) {
+    double t_mid = 0.5*(t_min + t_max);
+    if (t_mid <= t_min || t_mid >= t_max)
+      break;
+    if (_count_above(n_cells, sign, t_mid, indicator, eligible) > n_target)
+      t_min = t_mid;
+    else
+      t_max = t_mid;
+  }
+
+  cs_gnum_t n_flagged = 0;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    if (eligible[i] && sign*indicator[i] > t_max) {
+      cell_flag[i] = 1;
+      n_flagged++;
+    }
+  }
+
+  cs_parall_counter(&n_flagged, 1);
+
+  return n_flagged;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Adapt mesh based on a cell error indicator.
+ *
+ * A fixed-fraction strategy is used: the given fraction of cells with the
+ * highest indicator values (over all ranks) is refined, and the given
+ * fraction of previously refined cells with the lowest values is coarsened
+ * (siblings are merged only when all of them are selected).
+ *
+ * Coarsening is applied first, then refinement. The mesh is flagged for
+ * repartitioning, so load balance is restored when this function is
+ * called during the mesh preprocessing stage (i.e. from
+ * \ref cs_user_mesh_modify).
+ *
+ * \param[in, out]  m                 pointer to mesh structure
+ * \param[in]       indicator         cell error indicator (size: n_cells)
+ * \param[in]       refine_fraction   fraction of cells to refine
+ * \param[in]       coarsen_fraction  fraction of refined cells to coarsen
+ * \param[in]       max_level         maximum refinement level,
+ *                                    or < 0 for no limit
+ *
+ * \return  true if cells were selected for adaptation, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_by_indicator(cs_mesh_t        *m,
+                           const cs_real_t   indicator[],
+                           double            refine_fraction,
+                           double            coarsen_fraction,
+                           int               max_level)
+{
+  cs_timer_t t0 = cs_timer_time();
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_gnum_t n_g_cells_ini = m->n_g_cells;
+
+  int *c_level, *eligible, *refine_flag, *coarsen_flag;
+  BFT_MALLOC(c_level, n_cells, int);
+  BFT_MALLOC(eligible, n_cells, int);
+  BFT_MALLOC(refine_flag, n_cells, int);
+  BFT_MALLOC(coarsen_flag, n_cells, int);
+
+  _cell_r_level(m, c_level);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    refine_flag[i] = 0;
+    coarsen_flag[i] = 0;
+  }
+
+  /* Select cells to refine */
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    eligible[i] = (max_level < 0 || c_level[i] < max_level) ? 1 : 0;
+
+  cs_gnum_t n_g_refine = 0;
+  if (refine_fraction > 0)
+    n_g_refine = _flag_fraction(n_cells, 1., refine_fraction,
+                                indicator, eligible, refine_flag);
+
+  /* Select cells to coarsen among refined cells not selected
+     for refinement */
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    eligible[i] = (c_level[i] > 0 && refine_flag[i] == 0) ? 1 : 0;
+
+  cs_gnum_t n_g_coarsen = 0;
+  if (coarsen_fraction > 0)
+    n_g_coarsen = _flag_fraction(n_cells, -1., coarsen_fraction,
+                                 indicator, eligible, coarsen_flag);
+
+  BFT_FREE(eligible);
+  BFT_FREE(c_level);
+
+  /* Coarsen first, then transfer refinement flags to the coarsened mesh;
+     cells flagged for refinement are never merged, so they are
+     mapped one to one. */
+
+  if (n_g_coarsen > 0) {
+
+    cs_lnum_t *c_o2n = NULL;
+    cs_mesh_coarsen_simple_map(m, coarsen_flag, &c_o2n);
+
+    if (n_g_refine > 0) {
+      int *r_flag_c;
+      BFT_MALLOC(r_flag_c, m->n_cells, int);
+      for (cs_lnum_t i = 0; i < m->n_cells; i++)
+        r_flag_c[i] = 0;
+      for (cs_lnum_t i = 0; i < n_cells; i++) {
+        if (refine_flag[i])
+          r_flag_c[c_o2n[i]] = 1;
+      }
+      BFT_FREE(refine_flag);
+      refine_flag = r_flag_c;
+    }
+
+    BFT_FREE(c_o2n);
+
+  }
+
+  BFT_FREE(coarsen_flag);
+
+  if (n_g_refine > 0)
+    cs_mesh_refine_simple(m, true, refine_flag);
+
+  BFT_FREE(refine_flag);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_t dt = cs_timer_diff(&t0, &t1);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n"
+                  " Mesh adaptation:\n"
+                  "   cells selected for refinement:  %llu\n"
+                  "   cells selected for coarsening:  %llu\n"
+                  "   number of cells:                %llu -> %llu\n"),
+                (unsigned long long)n_g_refine,
+                (unsigned long long)n_g_coarsen,
+                (unsigned long long)n_g_cells_ini,
+                (unsigned long long)m->n_g_cells);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nMesh adaptation (%.3g s)\n"),
+                (double)(dt.wall_nsec*1.e-9));
+
+  return (n_g_refine + n_g_coarsen > 0) ? true : false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Adapt mesh based on a cell indicator read from a restart file.
+ *
+ * The indicator is read from the given section of a restart file in the
+ * "restart" directory, on the "cells" location; the current mesh must thus
+ * be the one matching the restart (i.e. "restart/mesh_input.csm"
+ * used as mesh input). If the indicator cannot be read, a warning is
+ * issued and the mesh is left unchanged.
+ *
+ * If the mesh is adapted, mapping of restart files to the previous mesh
+ * is activated, so that the computation restarts on the new mesh with
+ * values transferred from the parent (or containing) cells.
+ *
+ * \param[in, out]  m                 pointer to mesh structure
+ * \param[in]       restart_name      name of restart file ("main.csc", ...)
+ * \param[in]       section_name      name of indicator section
+ * \param[in]       refine_fraction   fraction of cells to refine
+ * \param[in]       coarsen_fraction  fraction of refined cells to coarsen
+ * \param[in]       max_level         maximum refinement level,
+ *                                    or < 0 for no limit
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_from_restart(cs_mesh_t   *m,
+                           const char  *restart_name,
+                           const char  *section_name,
+                           double       refine_fraction,
+                           double       coarsen_fraction,
+                           int          max_level)
+{
+  /* Determine previous mesh path */
+
+  const char *mesh_path[] = {"restart/mesh_input.csm",
+                             "restart/mesh_input"};
+
+  int path_id = -1;
+  if (cs_glob_rank_id < 1) {
+    for (int i = 0; i < 2 && path_id < 0; i++) {
+      if (cs_file_isreg(mesh_path[i]))
+        path_id = i;
+    }
+  }
+  cs_parall_bcast(0, 1, CS_INT_TYPE, &path_id);
+
+  if (path_id < 0) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Mesh adaptation requires a restart mesh\n"
+                 "(\"%s\"); the mesh is not adapted.\n"),
+               mesh_path[0]);
+    return;
+  }
+
+  /* Read indicator */
+
+  cs_real_t *indicator;
+  BFT_MALLOC(indicator, m->n_cells, cs_real_t);
+
+  cs_restart_t *r = cs_restart_create(restart_name,
+                                      NULL,
+                                      CS_RESTART_MODE_READ);
+
+  int retval = cs_restart_read_section(r,
+                                       section_name,
+                                       CS_MESH_LOCATION_CELLS,
+                                       1,
+                                       CS_TYPE_cs_real_t,
+                                       indicator);
+
+  cs_restart_destroy(&r);
+
+  if (retval != CS_RESTART_SUCCESS) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Mesh adaptation indicator \"%s\" could not be read\n"
+                 "from restart file \"%s\" (error %d);\n"
+                 "the mesh is not adapted.\n"),
+               section_name, restart_name, retval);
+    BFT_FREE(indicator);
+    return;
+  }
+
+  bool adapted = cs_mesh_adapt_by_indicator(m,
+                                            indicator,
+                                            refine_fraction,
+                                            coarsen_fraction,
+                                            max_level);
+
+  BFT_FREE(indicator);
+
+  /* Map restart data from previous mesh */
+
+  if (adapted)
+    cs_restart_map_set_mesh_input(mesh_path[path_id]);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,112 @@
+#ifndef __CS_MESH_ADAPT_H__
+#define __CS_MESH_ADAPT_H__
+
+/*============================================================================
+ * Indicator-driven mesh adaptation (refinement and coarsening)
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "cs_mesh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public C function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Adapt mesh based on a cell error indicator.
+ *
+ * A fixed-fraction strategy is used: the given fraction of cells with the
+ * highest indicator values (over all ranks) is refined, and the given
+ * fraction of previously refined cells with the lowest values is coarsened
+ * (siblings are merged only when all of them are selected).
+ *
+ * Coarsening is applied first, then refinement. The mesh is flagged for
+ * repartitioning, so load balance is restored when this function is
+ * called during the mesh preprocessing stage (i.e. from
+ * \ref cs_user_mesh_modify).
+ *
+ * \param[in, out]  m                 pointer to mesh structure
+ * \param[in]       indicator         cell error indicator (size: n_cells)
+ * \param[in]       refine_fraction   fraction of cells to refine
+ * \param[in]       coarsen_fraction  fraction of refined cells to coarsen
+ * \param[in]       max_level         maximum refinement level,
+ *                                    or < 0 for no limit
+ *
+ * \return  true if cells were selected for adaptation, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_by_indicator(cs_mesh_t        *m,
+                           const cs_real_t   indicator[],
+                           double            refine_fraction,
+                           double            coarsen_fraction,
+                           int               max_level);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Adapt mesh based on a cell indicator read from a restart file.
+ *
+ * The indicator is read from the given section of a restart file in the
+ * "restart" directory, on the "cells" location; the current mesh must thus
+ * be the one matching the restart (i.e. "restart/mesh_input.csm"
+ * used as mesh input). If the indicator cannot be read, a warning is
+ * issued and the mesh is left unchanged.
+ *
+ * If the mesh is adapted, mapping of restart files to the previous mesh
+ * is activated, so that the computation restarts on the new mesh with
+ * values transferred from the parent (or containing) cells.
+ *
+ * \param[in, out]  m                 pointer to mesh structure
+ * \param[in]       restart_name      name of restart file ("main.csc", ...)
+ * \param[in]       section_name      name of indicator section
+ * \param[in]       refine_fraction   fraction of cells to refine
+ * \param[in]       coarsen_fraction  fraction of refined cells to coarsen
+ * \param[in]       max_level         maximum refinement level,
+ *                                    or < 0 for no limit
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_from_restart(cs_mesh_t   *m,
+                           const char  *restart_name,
+                           const char  *section_name,
+                           double       refine_fraction,
+                           double       coarsen_fraction,
+                           int          max_level);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_ADAPT_H__ */
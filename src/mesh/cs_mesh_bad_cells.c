@@ -45,6 +45,7 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "cs_bad_cells_regularisation.h"
 #include "cs_halo.h"
 #include "cs_mesh.h"
 #include "cs_mesh_quantities.h"
@@ -116,162 +117,158 @@ static int  _call_type_visualize = 0;
  *============================================================================*/
 
 /*----------------------------------------------------------------------------
- * Evaluate cell's non-orthogonality.
+ * Evaluate face-based cell quality criteria.
  *
- * Compute orthogonal normal using the distance between two consecutive
- * cell centers and the surface vector orthogonal to the face.
- * Evaluates a level of non-orthogonality and tags identified bad cells.
+ * Non-orthogonality (based on the distance between two consecutive cell
+ * centers and the surface vector orthogonal to the face), center offsetting
+ * and volume ratio are evaluated in a single pass on faces, for the criteria
+ * selected in the given mask, and identified bad cells are tagged.
+ *
+ * Faces are processed by thread groups so as no two threads update the
+ * flag of a same cell. Halo values are not synchronized.
  *
  * parameters:
  *   mesh                 <-- pointer to associated mesh structure.
  *   mesh_quantities      <-- pointer to associated mesh quantities structure
- *   bad_cell_flag        <-- array of bad cell flags for various uses
+ *   criteria             <-- mask of criteria to evaluate
+ *   bad_cell_flag        <-> array of bad cell flags for various uses
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_ortho_norm(const cs_mesh_t             *mesh,
-                    const cs_mesh_quantities_t  *mesh_quantities,
-                    unsigned                     bad_cell_flag[])
+_compute_face_criteria(const cs_mesh_t             *mesh,
+                       const cs_mesh_quantities_t  *mesh_quantities,
+                       unsigned                     criteria,
+                       unsigned                     bad_cell_flag[])
 {
-  cs_lnum_t  i, face_id, cell1, cell2;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)mesh->i_face_cells;
+  const cs_lnum_t *b_face_cells = mesh->b_face_cells;
 
-  cs_real_t  cell_center1[3], cell_center2[3];
-  cs_real_t  face_center[3];
-  cs_real_t  face_normal[3], vect[3];
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)mesh_quantities->cell_cen;
+  const cs_real_3_t *i_face_normal
+    = (const cs_real_3_t *)mesh_quantities->i_face_normal;
+  const cs_real_3_t *b_face_normal
+    = (const cs_real_3_t *)mesh_quantities->b_face_normal;
+  const cs_real_3_t *b_face_cog
+    = (const cs_real_3_t *)mesh_quantities->b_face_cog;
+  const cs_real_3_t *dofij
+    = (const cs_real_3_t *)mesh_quantities->dofij;
+  const cs_real_t *volume = mesh_quantities->cell_vol;
 
-  double  cos_alpha, i_face_ortho, b_face_ortho;
+  const int n_i_groups = mesh->i_face_numbering->n_groups;
+  const int n_i_threads = mesh->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = mesh->i_face_numbering->group_index;
 
-  const cs_lnum_t  dim = 3;
+  const int n_b_groups = mesh->b_face_numbering->n_groups;
+  const int n_b_threads = mesh->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict b_group_index = mesh->b_face_numbering->group_index;
 
   /* Loop on interior faces */
   /*------------------------*/
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-    /* Get information on mesh quantities */
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
 
-    for (i = 0; i < dim; i++) {
+        cs_lnum_t cell1 = i_face_cells[face_id][0];
+        cs_lnum_t cell2 = i_face_cells[face_id][1];
 
-      /* Center of gravity for each cell */
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
-      cell_center2[i] = mesh_quantities->cell_cen[cell2*dim + i];
+        unsigned flag1 = 0, flag2 = 0;
 
-      /* Surface vector (orthogonal to the face) */
-      face_normal[i] = mesh_quantities->i_face_normal[face_id*dim + i];
+        /* Condition 1: non-orthogonality */
 
-    }
+        if (criteria & CS_BAD_CELL_ORTHO_NORM) {
 
-    /* Evaluate the non-orthogonality. */
+          cs_real_t vect[3];
+          for (int i = 0; i < 3; i++)
+            vect[i] = cell_cen[cell2][i] - cell_cen[cell1][i];
 
-    for (i = 0; i < dim; i++)
-      vect[i] = cell_center2[i] - cell_center1[i];
+          double i_face_ortho = _COSINE_3D(vect, i_face_normal[face_id]);
 
-    cos_alpha = _COSINE_3D(vect, face_normal);
+          if (i_face_ortho < 0.1) {
+            flag1 |= CS_BAD_CELL_ORTHO_NORM;
+            flag2 |= CS_BAD_CELL_ORTHO_NORM;
+          }
 
-    i_face_ortho = cos_alpha;
+        }
 
-    if (i_face_ortho < 0.1) {
-      bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
-      bad_cell_flag[cell2] |= CS_BAD_CELL_ORTHO_NORM;
-    }
-  }
+        /* Condition 2: center offsetting, computed in a manner consistent
+           with iterative gradient reconstruction */
 
-  /* Loop on boundary faces */
-  /*------------------------*/
+        if (criteria & CS_BAD_CELL_OFFSET) {
 
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
+          double of_n =   _MODULE_3D(dofij[face_id])
+                        * _MODULE_3D(i_face_normal[face_id]);
 
-    cell1 = mesh->b_face_cells[face_id];
+          double off_1 = 1 - pow(of_n / volume[cell1], 1/3.);
+          double off_2 = 1 - pow(of_n / volume[cell2], 1/3.);
 
-    /* Get information on mesh quantities */
+          if (off_1 < 0.1)
+            flag1 |= CS_BAD_CELL_OFFSET;
+          if (off_2 < 0.1)
+            flag2 |= CS_BAD_CELL_OFFSET;
 
-    for (i = 0; i < dim; i++) {
+        }
 
-      /* Center of gravity of the cell */
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
+        /* Condition 4: volume ratio */
 
-      /* Face center coordinates */
-      face_center[i] = mesh_quantities->b_face_cog[face_id*dim + i];
+        if (criteria & CS_BAD_CELL_RATIO) {
 
-      /* Surface vector (orthogonal to the face) */
-      face_normal[i] = mesh_quantities->b_face_normal[face_id*dim + i];
+          double vol_ratio = fmin(volume[cell1] / volume[cell2],
+                                  volume[cell2] / volume[cell1]);
 
-    }
+          if (vol_ratio < 0.1*0.1) {
+            flag1 |= CS_BAD_CELL_RATIO;
+            flag2 |= CS_BAD_CELL_RATIO;
+          }
 
-    /* Evaluate the non-orthogonality. */
-    for (i = 0; i < dim; i++)
-      vect[i] = face_center[i] - cell_center1[i];
+        }
 
-    cos_alpha = _COSINE_3D(vect, face_normal);
+        bad_cell_flag[cell1] |= flag1;
+        bad_cell_flag[cell2] |= flag2;
 
-    b_face_ortho = cos_alpha;
+      } /* Loop on faces */
 
-    if (b_face_ortho < 0.1)
-      bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
-  }
+    } /* Loop on threads */
 
-  if (mesh->halo != NULL)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
-}
+  } /* Loop on groups */
 
-/*----------------------------------------------------------------------------
- * Evaluate cell's center offsetting.
- *
- * Compute center offsetting coefficient for interior faces.
- * Evaluates a non-matching level (offset) and tags identified bad cells.
- *
- * parameters:
- *   mesh                   <-- pointer to associated mesh structure
- *   mesh_quantities        <-- pointer to associated mesh quantities
- *                              structure
- *   bad_cell_flag          <-- array of bad cell flags for various uses
- *----------------------------------------------------------------------------*/
+  /* Loop on boundary faces (only non-orthogonality) */
+  /*-------------------------------------------------*/
 
-static void
-_compute_offsetting(const cs_mesh_t             *mesh,
-                    const cs_mesh_quantities_t  *mesh_quantities,
-                    unsigned                     bad_cell_flag[])
-{
-  cs_lnum_t  face_id, cell1, cell2;
-  double  of_n, off_1, off_2;
+  if (!(criteria & CS_BAD_CELL_ORTHO_NORM))
+    return;
 
-  const cs_real_t *v_of, *v_n;
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-  /* Loop on interior faces */
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
 
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+        cs_lnum_t cell1 = b_face_cells[face_id];
 
-    /* Compute center offsetting coefficient,
-       in a manner consistent with iterative gradient reconstruction */
+        cs_real_t vect[3];
+        for (int i = 0; i < 3; i++)
+          vect[i] = b_face_cog[face_id][i] - cell_cen[cell1][i];
 
-    v_of = &(mesh_quantities->dofij[face_id*3]);
-    v_n = &(mesh_quantities->i_face_normal[face_id*3]);
-    of_n = _MODULE_3D(v_of) * _MODULE_3D(v_n);
+        double b_face_ortho = _COSINE_3D(vect, b_face_normal[face_id]);
 
-    off_1 = 1 - pow(of_n / mesh_quantities->cell_vol[cell1], 1/3.);
-    off_2 = 1 - pow(of_n / mesh_quantities->cell_vol[cell2], 1/3.);
+        if (b_face_ortho < 0.1)
+          bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
 
-    if (off_1 < 0.1)
-      bad_cell_flag[cell1] |= CS_BAD_CELL_OFFSET;
-    if (off_2 < 0.1)
-      bad_cell_flag[cell2] |= CS_BAD_CELL_OFFSET;
+      } /* Loop on faces */
 
-  }
+    } /* Loop on threads */
 
-  if (mesh->halo != NULL)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
+  } /* Loop on groups */
 }
 
 /*----------------------------------------------------------------------------
@@ -279,7 +276,7 @@ _compute_offsetting(const cs_mesh_t             *mesh,
  *
  * Compute Least Squares Gradient coefficient for cells.
  * Evaluates a distorsion level (based on LSQ Gradient Method) and tags
- * identified bad cells.
+ * identified bad cells. Halo values are not synchronized.
  *
  * parameters:
  *   mesh               <-- pointer to associated mesh structure
@@ -292,20 +289,24 @@ _compute_least_squares(const cs_mesh_t             *mesh,
                        const cs_mesh_quantities_t  *mesh_quantities,
                        unsigned                     bad_cell_flag[])
 {
-  cs_real_t lsq;
-  const cs_lnum_t  dim = mesh->dim;
   const cs_lnum_t  n_cells = mesh->n_cells;
   const cs_lnum_t  n_cells_wghosts = mesh->n_cells_with_ghosts;
 
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)mesh->i_face_cells;
+  const cs_lnum_t *b_face_cells = mesh->b_face_cells;
+
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)mesh_quantities->cell_cen;
   const cs_real_3_t *b_face_normal
     = (const cs_real_3_t *)mesh_quantities->b_face_normal;
 
-  cs_lnum_t     i, k, face_id, cell1, cell2, cell_id;
-  cs_real_3_t   cell_center1, cell_center2, vect, dij, eigenvalues;
-  cs_real_33_t  w2;
+  const int n_i_groups = mesh->i_face_numbering->n_groups;
+  const int n_i_threads = mesh->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = mesh->i_face_numbering->group_index;
 
-  double unsdij, surfn, surf_n_inv, min_diag, max_diag;
-  double xam, q, p, r, phi;
+  const int n_b_groups = mesh->b_face_numbering->n_groups;
+  const int n_b_threads = mesh->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict b_group_index = mesh->b_face_numbering->group_index;
 
   cs_real_t *w1 = NULL;
 
@@ -313,67 +314,93 @@ _compute_least_squares(const cs_mesh_t             *mesh,
 
   BFT_MALLOC(w1, 6 * n_cells_wghosts, cs_real_t);
 
-  for (i = 0; i < 6 * n_cells_wghosts; i++)
+# pragma omp parallel for if (n_cells_wghosts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < 6 * n_cells_wghosts; i++)
     w1[i] = 0.;
 
   /* Loop on interior faces */
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-    /* Center of gravity for each cell */
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
 
-    for (i = 0; i < dim; i++) {
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
-      cell_center2[i] = mesh_quantities->cell_cen[cell2*dim + i];
-      vect[i] = cell_center2[i] - cell_center1[i];
-    }
+        cs_lnum_t cell1 = i_face_cells[face_id][0];
+        cs_lnum_t cell2 = i_face_cells[face_id][1];
 
-    unsdij = 1.0 / _MODULE_3D(vect);
+        cs_real_3_t vect, dij;
 
-    for (i = 0; i < dim; i++)
-      dij[i] = vect[i] * unsdij;
+        for (int i = 0; i < 3; i++)
+          vect[i] = cell_cen[cell2][i] - cell_cen[cell1][i];
 
-    w1[cell1] += dij[0] * dij[0];
-    w1[cell1 + n_cells_wghosts] += dij[1] * dij[1];
-    w1[cell1 + 2 * n_cells_wghosts] += dij[2] * dij[2];
-    w1[cell1 + 3 * n_cells_wghosts] += dij[0] * dij[1];
-    w1[cell1 + 4 * n_cells_wghosts] += dij[0] * dij[2];
-    w1[cell1 + 5 * n_cells_wghosts] += dij[1] * dij[2];
+        double unsdij = 1.0 / _MODULE_3D(vect);
 
-    w1[cell2] += dij[0] * dij[0];
-    w1[cell2 + n_cells_wghosts] += dij[1] * dij[1];
-    w1[cell2 + 2 * n_cells_wghosts] += dij[2] * dij[2];
-    w1[cell2 + 3 * n_cells_wghosts] += dij[0] * dij[1];
-    w1[cell2 + 4 * n_cells_wghosts] += dij[0] * dij[2];
-    w1[cell2 + 5 * n_cells_wghosts] += dij[1] * dij[2];
+        for (int i = 0; i < 3; i++)
+          dij[i] = vect[i] * unsdij;
 
-  }
+        w1[cell1] += dij[0] * dij[0];
+        w1[cell1 + n_cells_wghosts] += dij[1] * dij[1];
+        w1[cell1 + 2 * n_cells_wghosts] += dij[2] * dij[2];
+        w1[cell1 + 3 * n_cells_wghosts] += dij[0] * dij[1];
+        w1[cell1 + 4 * n_cells_wghosts] += dij[0] * dij[2];
+        w1[cell1 + 5 * n_cells_wghosts] += dij[1] * dij[2];
+
+        w1[cell2] += dij[0] * dij[0];
+        w1[cell2 + n_cells_wghosts] += dij[1] * dij[1];
+        w1[cell2 + 2 * n_cells_wghosts] += dij[2] * dij[2];
+        w1[cell2 + 3 * n_cells_wghosts] += dij[0] * dij[1];
+        w1[cell2 + 4 * n_cells_wghosts] += dij[0] * dij[2];
+        w1[cell2 + 5 * n_cells_wghosts] += dij[1] * dij[2];
+
+      } /* Loop on faces */
+
+    } /* Loop on threads */
+
+  } /* Loop on groups */
 
   /* Loop on boundary faces */
   /*------------------------*/
 
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
-    cell1 = mesh->b_face_cells[face_id];
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-    surfn = _MODULE_3D(b_face_normal[face_id]);
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-    surf_n_inv = 1.0 / surfn;
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
 
-    for (i = 0; i < dim; i++)
-      dij[i] = b_face_normal[face_id][i] * surf_n_inv;
+        cs_lnum_t cell1 = b_face_cells[face_id];
 
-    w1[cell1] += dij[0] * dij[0];
-    w1[cell1 + n_cells_wghosts] += dij[1] * dij[1];
-    w1[cell1 + 2 * n_cells_wghosts] += dij[2] * dij[2];
-    w1[cell1 + 3 * n_cells_wghosts] += dij[0] * dij[1];
-    w1[cell1 + 4 * n_cells_wghosts] += dij[0] * dij[2];
-    w1[cell1 + 5 * n_cells_wghosts] += dij[1] * dij[2];
-  }
+        cs_real_3_t dij;
+
+        double surf_n_inv = 1.0 / _MODULE_3D(b_face_normal[face_id]);
+
+        for (int i = 0; i < 3; i++)
+          dij[i] = b_face_normal[face_id][i] * surf_n_inv;
+
+        w1[cell1] += dij[0] * dij[0];
+        w1[cell1 + n_cells_wghosts] += dij[1] * dij[1];
+        w1[cell1 + 2 * n_cells_wghosts] += dij[2] * dij[2];
+        w1[cell1 + 3 * n_cells_wghosts] += dij[0] * dij[1];
+        w1[cell1 + 4 * n_cells_wghosts] += dij[0] * dij[2];
+        w1[cell1 + 5 * n_cells_wghosts] += dij[1] * dij[2];
+
+      } /* Loop on faces */
+
+    } /* Loop on threads */
+
+  } /* Loop on groups */
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
 
-  for (cell_id = 0; cell_id < n_cells; cell_id++) {
+    cs_real_3_t   eigenvalues;
+    cs_real_33_t  w2;
 
     w2[0][0] = w1[cell_id];
     w2[1][1] = w1[cell_id + n_cells_wghosts];
@@ -387,27 +414,27 @@ _compute_least_squares(const cs_mesh_t             *mesh,
 
     /* Compute the eigenvalues for a given real symmetric 3x3 matrix */
 
-    xam = w2[0][1] * w2[0][1] + w2[0][2] * w2[0][2] + w2[1][2] * w2[1][2];
+    double xam = w2[0][1] * w2[0][1] + w2[0][2] * w2[0][2] + w2[1][2] * w2[1][2];
 
     /* First check if the matrix is diagonal */
     if (xam <= 0.) {
-      for (i = 0; i < 3; i++)
+      for (int i = 0; i < 3; i++)
         eigenvalues[i] = w2[i][i];
     }
 
     /* If the matrix is not diagonal, we get the eigenvalues from a
        trigonometric solution                                       */
     else {
-      q = (w2[0][0] + w2[1][1] + w2[2][2]) / 3.;
+      double q = (w2[0][0] + w2[1][1] + w2[2][2]) / 3.;
 
-      p = (w2[0][0] - q) * (w2[0][0] - q) +
-          (w2[1][1] - q) * (w2[1][1] - q) +
-          (w2[2][2] - q) * (w2[2][2] - q) + 2. * xam;
+      double p = (w2[0][0] - q) * (w2[0][0] - q) +
+                 (w2[1][1] - q) * (w2[1][1] - q) +
+                 (w2[2][2] - q) * (w2[2][2] - q) + 2. * xam;
 
       p = sqrt(p / 6.);
 
-      for (i = 0; i < 3; i++) {
-        for (k = 0; k < 3; k++) {
+      for (int i = 0; i < 3; i++) {
+        for (int k = 0; k < 3; k++) {
           if (i == k)
             w2[i][k] = (1. / p) * (w2[i][k] - q);
           else
@@ -415,17 +442,18 @@ _compute_least_squares(const cs_mesh_t             *mesh,
         }
       }
 
-      r =   w2[0][0] * w2[1][1] * w2[2][2]
-          + w2[0][1] * w2[1][2] * w2[2][0]
-          + w2[0][2] * w2[1][0] * w2[2][1]
-          - w2[0][2] * w2[1][1] * w2[2][0]
-          - w2[0][1] * w2[1][0] * w2[2][2]
-          - w2[0][0] * w2[1][2] * w2[2][1];
+      double r =   w2[0][0] * w2[1][1] * w2[2][2]
+                 + w2[0][1] * w2[1][2] * w2[2][0]
+                 + w2[0][2] * w2[1][0] * w2[2][1]
+                 - w2[0][2] * w2[1][1] * w2[2][0]
+                 - w2[0][1] * w2[1][0] * w2[2][2]
+                 - w2[0][0] * w2[1][2] * w2[2][1];
 
       r *= 0.5;
 
       /* In exact arithmetic for a symmetric matrix  -1 <= r <= 1
          but computation error can leave it slightly outside this range */
+      double phi;
       if (r <= -1.)
         phi = pi / 3.;
       else if (r >= 1.)
@@ -440,74 +468,21 @@ _compute_least_squares(const cs_mesh_t             *mesh,
       eigenvalues[1] = 3. * q - eigenvalues[0] - eigenvalues[2];
     }
 
-    min_diag = 1.e15;
-    max_diag = 0.;
+    double min_diag = 1.e15;
+    double max_diag = 0.;
 
-    for (i = 0; i < 3; i++) {
+    for (int i = 0; i < 3; i++) {
       min_diag = fmin(min_diag, fabs(eigenvalues[i]));
       max_diag = fmax(max_diag, fabs(eigenvalues[i]));
     }
 
-    lsq = min_diag / max_diag;
+    double lsq = min_diag / max_diag;
 
     if (lsq < 0.1)
       bad_cell_flag[cell_id] |= CS_BAD_CELL_LSQ_GRAD;
   }
 
   BFT_FREE(w1);
-
-  if (mesh->halo != NULL)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
-}
-
-/*----------------------------------------------------------------------------
- * Evaluate cell's volume ratio.
- *
- * Compute Volume Ratio coefficient for cells.
- * Evaluates a the cell's geometric continuity (based on volume ratio) and
- * tags identified bad cells.
- *
- * parameters:
- *   mesh                <-- pointer to associated mesh structure
- *   mesh_quantities     <-- pointer to associated mesh quantities structure
- *   bad_cell_flag       --> array of bad cell flags for various uses
- *----------------------------------------------------------------------------*/
-
-static void
-_compute_volume_ratio(const cs_mesh_t             *mesh,
-                      const cs_mesh_quantities_t  *mesh_quantities,
-                      unsigned                     bad_cell_flag[])
-{
-  double vol_ratio;
-  cs_real_t *volume = mesh_quantities->cell_vol;
-
-  cs_lnum_t   face_id, cell1, cell2;
-
-  /* Loop on interior faces */
-  /*------------------------*/
-
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
-
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
-
-    vol_ratio = fmin(volume[cell1] / volume[cell2],
-                     volume[cell2] / volume[cell1]);
-
-    if (vol_ratio < 0.1*0.1) {
-      bad_cell_flag[cell1] |= CS_BAD_CELL_RATIO;
-      bad_cell_flag[cell2] |= CS_BAD_CELL_RATIO;
-    }
-  }
-
-  if (mesh->halo != NULL)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
 }
 
 /*----------------------------------------------------------------------------
@@ -877,8 +852,13 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
 
   bad_cell_flag = mesh_quantities->bad_cell_flag;
 
-  for (i = 0; i < n_cells_wghosts; i++)
-    bad_cell_flag[i] = 0;
+# pragma omp parallel for if (n_cells_wghosts > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_wghosts; c_id++)
+    bad_cell_flag[c_id] = 0;
+
+  /* Regularisation matrix coefficients depend on the flags */
+
+  cs_bad_cells_regularisation_reset();
 
   /* Possible warning printed in the log --> flag initialization */
 
@@ -888,131 +868,79 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   /* Evaluate mesh quality criteria */
   /*--------------------------------*/
 
-  /* Condition 1: Orthogonal Normal */
-  /*--------------------------------*/
-
-  if (_type_flag_compute[call_type] & CS_BAD_CELL_ORTHO_NORM)
-    _compute_ortho_norm(mesh,
-                        mesh_quantities,
-                        bad_cell_flag);
+  /* Conditions 1, 2 and 4 (orthogonal normal, orthogonal A-frame and
+     volume ratio) rely on a single pass on faces, condition 3 (least
+     squares gradient) on a pass on faces and cells */
 
+  unsigned face_criteria = CS_BAD_CELL_ORTHO_NORM | CS_BAD_CELL_RATIO;
+  if (cs_glob_mesh_quantities->min_vol >= 0.)
+    face_criteria |= CS_BAD_CELL_OFFSET;
 
-  if (_type_flag_compute[call_type_log] & CS_BAD_CELL_ORTHO_NORM) {
+  const unsigned compute_criteria
+    = _type_flag_compute[call_type] & (face_criteria | CS_BAD_CELL_LSQ_GRAD);
 
-    ibad = 0;
-    for (i = 0; i < n_cells; i++) {
-      if (bad_cell_flag[i] & CS_BAD_CELL_ORTHO_NORM) {
-        ibad++;
-        iwarning++;
-      }
-    }
-
-    if (cs_glob_rank_id >= 0) {
-      cs_parall_counter(&ibad, 1);
-      cs_parall_counter(&iwarning, 1);
-    }
-
-    /* Display log output */
-    bft_printf(_("\n  Criterion 1: Orthogonality:\n"));
-    bft_printf(_("    Number of bad cells detected: %llu --> %3.0f %%\n"),
-               (unsigned long long)ibad,
-               (double)ibad / (double)n_cells_tot * 100.0);
-
-  }
-
-  /* Condition 2: Orthogonal A-Frame */
-  /*---------------------------------*/
-
-  if (   _type_flag_compute[call_type] & CS_BAD_CELL_OFFSET
-      && cs_glob_mesh_quantities->min_vol >= 0.)
-    _compute_offsetting(mesh,
-                        mesh_quantities,
-                        bad_cell_flag);
-
-  if (   _type_flag_compute[call_type_log] & CS_BAD_CELL_OFFSET
-      && cs_glob_mesh_quantities->min_vol >= 0.) {
+  if (compute_criteria & face_criteria)
+    _compute_face_criteria(mesh,
+                           mesh_quantities,
+                           compute_criteria & face_criteria,
+                           bad_cell_flag);
 
-    ibad = 0;
-    for (i = 0; i < n_cells; i++) {
-      if (bad_cell_flag[i] & CS_BAD_CELL_OFFSET) {
-        ibad++;
-        iwarning++;
-      }
-    }
+  if (compute_criteria & CS_BAD_CELL_LSQ_GRAD)
+    _compute_least_squares(mesh,
+                           mesh_quantities,
+                           bad_cell_flag);
 
-    if (cs_glob_rank_id >= 0) {
-      cs_parall_counter(&ibad, 1);
-      cs_parall_counter(&iwarning, 1);
-    }
+  if (compute_criteria && mesh->halo != NULL)
+    cs_halo_sync_untyped(mesh->halo,
+                         CS_HALO_EXTENDED,
+                         sizeof(unsigned),
+                         bad_cell_flag);
 
-    /* Display log output */
-    bft_printf(_("\n  Criterion 2: Offset:\n"));
-    bft_printf(_("    Number of bad cells detected: %llu --> %3.0f %%\n"),
-               (unsigned long long)ibad,
-               (double)ibad / (double)n_cells_tot * 100.0);
+  /* Count bad cells for all criteria at once */
 
-  }
+  const unsigned log_criteria
+    = _type_flag_compute[call_type_log] & (face_criteria | CS_BAD_CELL_LSQ_GRAD);
 
-  /* Condition 3: Least Squares Gradient */
-  /*-------------------------------------*/
+  if (log_criteria) {
 
-  if (_type_flag_compute[call_type] & CS_BAD_CELL_LSQ_GRAD)
-    _compute_least_squares(mesh,
-                           mesh_quantities,
-                           bad_cell_flag);
+    const unsigned criteria[4] = {CS_BAD_CELL_ORTHO_NORM,
+                                  CS_BAD_CELL_OFFSET,
+                                  CS_BAD_CELL_LSQ_GRAD,
+                                  CS_BAD_CELL_RATIO};
+    const char *criteria_name[4] = {N_("Orthogonality"),
+                                    N_("Offset"),
+                                    N_("Least-Squares Gradient Quality"),
+                                    N_("Cells Volume Ratio")};
 
-  if (_type_flag_compute[call_type_log] & CS_BAD_CELL_LSQ_GRAD) {
+    cs_gnum_t n_bad[4] = {0, 0, 0, 0};
 
-    ibad = 0;
     for (i = 0; i < n_cells; i++) {
-      if (bad_cell_flag[i] & CS_BAD_CELL_LSQ_GRAD) {
-        ibad++;
-        iwarning++;
+      if (bad_cell_flag[i] & log_criteria) {
+        for (int j = 0; j < 4; j++) {
+          if (bad_cell_flag[i] & criteria[j])
+            n_bad[j]++;
+        }
       }
     }
 
-    if (cs_glob_rank_id >= 0) {
-      cs_parall_counter(&ibad, 1);
-      cs_parall_counter(&iwarning, 1);
-    }
+    cs_parall_counter(n_bad, 4);
 
-    /* Display log output */
-    bft_printf(_("\n  Criterion 3: Least-Squares Gradient Quality:\n"));
-    bft_printf(_("    Number of bad cells detected: %llu --> %3.0f %%\n"),
-               (unsigned long long)ibad,
-               (double)ibad / (double)n_cells_tot * 100.0);
+    for (int j = 0; j < 4; j++) {
 
-  }
+      if (!(log_criteria & criteria[j]))
+        continue;
 
-  /* Condition 4: Volume Ratio */
-  /*---------------------------*/
+      ibad = n_bad[j];
+      iwarning += ibad;
 
-  if (_type_flag_compute[call_type] & CS_BAD_CELL_RATIO)
-    _compute_volume_ratio(mesh,
-                          mesh_quantities,
-                          bad_cell_flag);
-
-  if (_type_flag_compute[call_type_log] & CS_BAD_CELL_RATIO) {
-
-    ibad = 0;
-    for (i = 0; i < n_cells; i++) {
-      if (bad_cell_flag[i] & CS_BAD_CELL_RATIO) {
-        ibad++;
-        iwarning++;
-      }
-    }
+      /* Display log output */
+      bft_printf(_("\n  Criterion %d: %s:\n"), j+1, _(criteria_name[j]));
+      bft_printf(_("    Number of bad cells detected: %llu --> %3.0f %%\n"),
+                 (unsigned long long)ibad,
+                 (double)ibad / (double)n_cells_tot * 100.0);
 
-    if (cs_glob_rank_id >= 0) {
-      cs_parall_counter(&ibad, 1);
-      cs_parall_counter(&iwarning, 1);
     }
 
-    /* Display log output */
-    bft_printf(_("\n  Criterion 4: Cells Volume Ratio:\n"));
-    bft_printf(_("    Number of bad cells detected: %llu --> %3.0f %%\n"),
-               (unsigned long long)ibad,
-               (double)ibad / (double)n_cells_tot * 100.0);
-
   }
 
   /* 5: Guilt by association */
@@ -738,6 +738,13 @@ cs_mesh_cartesian_get_ncells(int idim)
 
 /*----------------------------------------------------------------------------*/
 /*! \brief Build unstructured connectivity needed for partitionning.
+ *
+ * Each rank only builds the faces and vertices of its own blocks, using
+ * index arithmetic on global numbers, so the cost is proportional to the
+ * local block sizes and no file or global array is involved. Cells are
+ * numbered lexicographically, so the initial block distribution is
+ * slab-based; a space-filling curve partitioning (which also works on
+ * block-distributed data) may be used for the main partitioning.
  *
  * \param[in] m     pointer to cs_mesh_t structure
  * \param[in] mb    pointer to cs_mesh_builder_t structure
@@ -770,7 +777,7 @@ cs_mesh_cartesian_connectivity(cs_mesh_t          *m,
   cs_gnum_t n_g_faces = 3*n_g_cells + nx*ny + nx*nz + ny*nz;
 
   mb->n_g_faces = n_g_faces;
-  mb->n_g_face_connect_size = n_g_faces * 2;
+  mb->n_g_face_connect_size = n_g_faces * 4;
 
   m->n_g_cells = n_g_cells;
   m->n_g_vertices = n_g_vtx;
@@ -809,101 +816,66 @@ cs_mesh_cartesian_connectivity(cs_mesh_t          *m,
   BFT_REALLOC(mb->face_cells, 2*n_faces, cs_gnum_t);
   BFT_REALLOC(mb->face_vertices, 4*n_faces, cs_gnum_t);
 
-  /* Global numbering starts at 1! */
-
-  cs_lnum_t f_id = 0;
-  cs_gnum_t g_f_num = 1;
+  /* Each face of the local block is built directly from its global number
+     (which starts at 1): faces are numbered by normal direction, then
+     lexicographically, so (i, j, k) indexes are obtained by division,
+     and no loop on the global structure is needed. */
 
-  /* We should find a better way of filtering what is built on the
-     current rank, but currently ignore everything which is out of range */
-  cs_gnum_t g_f_num_min = mb->face_bi.gnum_range[0];
-  cs_gnum_t g_f_num_max = mb->face_bi.gnum_range[1];
+  const cs_gnum_t n_g_x_faces = nxp1*ny*nz;
+  const cs_gnum_t n_g_y_faces = nx*nyp1*nz;
 
-  /* X normal faces */
+  const cs_gnum_t g_f_num_min = mb->face_bi.gnum_range[0];
 
-  for (cs_gnum_t k = 0; k < nz && g_f_num < g_f_num_max; k++) {
-    for (cs_gnum_t j = 0; j < ny && g_f_num < g_f_num_max; j++) {
-      for (cs_gnum_t i = 0; i < nxp1 && g_f_num < g_f_num_max; i++) {
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
 
-        if (g_f_num >= g_f_num_min) {
-          _add_nx_face(mb, f_id, nx, ny, nz, i, j, k);
-          f_id += 1;
-        }
-        g_f_num += 1;
+    cs_gnum_t g_f_id = g_f_num_min + (cs_gnum_t)f_id - 1;
 
-      }
+    if (g_f_id < n_g_x_faces) {
+      cs_gnum_t i = g_f_id % nxp1, l = g_f_id / nxp1;
+      _add_nx_face(mb, f_id, nx, ny, nz, i, l % ny, l / ny);
     }
-  }
-
-  /* Y normal faces */
-  for (cs_gnum_t k = 0; k < nz && g_f_num < g_f_num_max; k++) {
-    for (cs_gnum_t j = 0; j < nyp1 && g_f_num < g_f_num_max; j++) {
-      for (cs_gnum_t i = 0; i < nx && g_f_num < g_f_num_max; i++) {
-
-        if (g_f_num >= g_f_num_min) {
-          _add_ny_face(mb, f_id, nx, ny, nz, i, j, k);
-          f_id += 1;
-        }
-        g_f_num += 1;
-
-      }
+    else if (g_f_id < n_g_x_faces + n_g_y_faces) {
+      g_f_id -= n_g_x_faces;
+      cs_gnum_t i = g_f_id % nx, l = g_f_id / nx;
+      _add_ny_face(mb, f_id, nx, ny, nz, i, l % nyp1, l / nyp1);
+    }
+    else {
+      g_f_id -= n_g_x_faces + n_g_y_faces;
+      cs_gnum_t i = g_f_id % nx, l = g_f_id / nx;
+      _add_nz_face(mb, f_id, nx, ny, nz, i, l % ny, l / ny);
     }
+
   }
 
-  /* Z normal faces */
-  for (cs_gnum_t k = 0; k < nzp1 && g_f_num < g_f_num_max; k++) {
-    for (cs_gnum_t j = 0; j < ny && g_f_num < g_f_num_max; j++) {
-      for (cs_gnum_t i = 0; i < nx && g_f_num < g_f_num_max; i++) {
+  /* Vertex coords, built from global numbers in the same manner */
 
-        if (g_f_num >= g_f_num_min) {
-          _add_nz_face(mb, f_id, nx, ny, nz, i, j, k);
-          f_id += 1;
-        }
-        g_f_num += 1;
+  BFT_REALLOC(mb->vertex_coords, n_vertices*3, cs_real_t);
 
-      }
-    }
-  }
+  const cs_gnum_t g_v_num_min = mb->vertex_bi.gnum_range[0];
 
-  BFT_REALLOC(mb->vertex_coords, n_vertices*3, cs_real_t);
+# pragma omp parallel for if (n_vertices > CS_THR_MIN)
+  for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
 
-  /* We should find a better way of filtering what is built on the
-     current rank, but currently ignore everything which is out of range */
-  cs_gnum_t g_v_num_min = mb->vertex_bi.gnum_range[0];
-  cs_gnum_t g_v_num_max = mb->vertex_bi.gnum_range[1];
-
-  /* Vertex coords */
-  cs_lnum_t v_id = 0;
-
-  for (cs_gnum_t k = 0; k < nzp1; k++) {
-    for (cs_gnum_t j = 0; j < nyp1; j++) {
-      for (cs_gnum_t i = 0; i < nxp1; i++) {
-        cs_gnum_t g_v_num = 1 + i + j*nxp1 + k*nxp1*nyp1;
-
-        if (g_v_num >= g_v_num_min && g_v_num < g_v_num_max) {
-
-          /* X coord */
-          cs_lnum_t ijk[3] = {i,j,k};
-          for (cs_lnum_t idim = 0; idim < 3; idim++) {
-            /* Constant step: xyz[idim] = xyzmin[idim] + ijk*dx[idim] */
-            if (mp->params[idim]->law == CS_MESH_CARTESIAN_CONSTANT_LAW) {
-              mb->vertex_coords[3*v_id + idim]
-                = mp->params[idim]->smin + ijk[idim] * mp->params[idim]->s[0];
-            }
-            /* Non constant step: We allready stored the vertices in dx,
-             * since dx[j+1] - dx[j] == dx of cell j */
-            else {
-              mb->vertex_coords[3*v_id + idim] = mp->params[idim]->s[ijk[idim]];
-            }
-          }
+    cs_gnum_t g_v_id = g_v_num_min + (cs_gnum_t)v_id - 1;
+    cs_gnum_t l = g_v_id / nxp1;
 
-          v_id++;
-        }
+    cs_gnum_t ijk[3] = {g_v_id % nxp1, l % nyp1, l / nyp1};
 
+    for (cs_lnum_t idim = 0; idim < 3; idim++) {
+      /* Constant step: xyz[idim] = xyzmin[idim] + ijk*dx[idim] */
+      if (mp->params[idim]->law == CS_MESH_CARTESIAN_CONSTANT_LAW) {
+        mb->vertex_coords[3*v_id + idim]
+          = mp->params[idim]->smin + ijk[idim] * mp->params[idim]->s[0];
+      }
+      /* Non constant step: We allready stored the vertices in dx,
+       * since dx[j+1] - dx[j] == dx of cell j */
+      else {
+        mb->vertex_coords[3*v_id + idim] = mp->params[idim]->s[ijk[idim]];
       }
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -166,6 +166,13 @@ cs_mesh_cartesian_get_ncells(int idim);
 
 /*----------------------------------------------------------------------------*/
 /*! \brief Build unstructured connectivity needed for partitionning.
+ *
+ * Each rank only builds the faces and vertices of its own blocks, using
+ * index arithmetic on global numbers, so the cost is proportional to the
+ * local block sizes and no file or global array is involved. Cells are
+ * numbered lexicographically, so the initial block distribution is
+ * slab-based; a space-filling curve partitioning (which also works on
+ * block-distributed data) may be used for the main partitioning.
  *
  * \param[in] m     pointer to cs_mesh_t structure
  * \param[in] mb    pointer to cs_mesh_builder_t structure
@@ -690,25 +690,20 @@ _build_merged_face(cs_lnum_t                    n_faces,
   return n_vertices;
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*============================================================================
- * Public function definitions
- *============================================================================*/
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Coarsen flagged mesh cells.
+/*----------------------------------------------------------------------------
+ * Coarsen flagged mesh cells, optionally returning the cell mapping.
  *
- * \param[in, out]  m           mesh
- * \param[in]       cell_flag   coarsening flag for each cell
- *                              (0: do not coarsen; 1: coarsen)
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   m         <-> mesh
+ *   cell_flag <-- coarsening flag for each cell (0: no; 1: yes)
+ *   c_o2n     --> if non-NULL, set to old to new cells mapping
+ *                 (allocated; caller is responsible for freeing it)
+ *----------------------------------------------------------------------------*/
 
-void
-cs_mesh_coarsen_simple(cs_mesh_t  *m,
-                       const int   cell_flag[])
+static void
+_coarsen_simple(cs_mesh_t   *m,
+                const int    cell_flag[],
+                cs_lnum_t  **c_o2n_p)
 {
   /* Timers:
      0: total
@@ -760,7 +755,10 @@ cs_mesh_coarsen_simple(cs_mesh_t  *m,
 
   _merge_cells(m, n_c_new, c_o2n);
 
-  BFT_FREE(c_o2n);
+  if (c_o2n_p != NULL)
+    *c_o2n_p = c_o2n;
+  else
+    BFT_FREE(c_o2n);
 
   m->modified |= (CS_MESH_MODIFIED | CS_MESH_MODIFIED_BALANCE);
 
@@ -802,6 +800,54 @@ cs_mesh_coarsen_simple(cs_mesh_t  *m,
   }
 }
 
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Coarsen flagged mesh cells.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       cell_flag   coarsening flag for each cell
+ *                              (0: do not coarsen; 1: coarsen)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_coarsen_simple(cs_mesh_t  *m,
+                       const int   cell_flag[])
+{
+  _coarsen_simple(m, cell_flag, NULL);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Coarsen flagged mesh cells, returning the associated cell mapping.
+ *
+ * Cells which are not merged keep their relative order; merged cells
+ * are assigned the new id of their first (lowest id) sibling.
+ *
+ * The caller is responsible for freeing the returned array.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       cell_flag   coarsening flag for each cell
+ *                              (0: do not coarsen; 1: coarsen)
+ * \param[out]      c_o2n       old to new cells mapping
+ *                              (size: initial number of cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_coarsen_simple_map(cs_mesh_t   *m,
+                           const int    cell_flag[],
+                           cs_lnum_t  **c_o2n)
+{
+  _coarsen_simple(m, cell_flag, c_o2n);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Coarsen selected mesh cells.
@@ -64,6 +64,28 @@ void
 cs_mesh_coarsen_simple(cs_mesh_t  *m,
                        const int   cell_flag[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Coarsen flagged mesh cells, returning the associated cell mapping.
+ *
+ * Cells which are not merged keep their relative order; merged cells
+ * are assigned the new id of their first (lowest id) sibling.
+ *
+ * The caller is responsible for freeing the returned array.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       cell_flag   coarsening flag for each cell
+ *                              (0: do not coarsen; 1: coarsen)
+ * \param[out]      c_o2n       old to new cells mapping
+ *                              (size: initial number of cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_coarsen_simple_map(cs_mesh_t   *m,
+                           const int    cell_flag[],
+                           cs_lnum_t  **c_o2n);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Coarsen selected mesh cells.
@@ -0,0 +1,463 @@
+/*============================================================================
+ * Compact (delta-encoded) storage of mesh connectivity and numbering
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <string.h>
+#include <stdlib.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_compact.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Map a signed difference to an unsigned value (zigzag encoding), so that
+ * small differences of either sign lead to small values.
+ *
+ * parameters:
+ *   d <-- signed difference
+ *
+ * returns:
+ *   encoded value
+ *----------------------------------------------------------------------------*/
+
+static inline uint64_t
+_zigzag(int64_t  d)
+{
+  return ((uint64_t)d << 1) ^ (uint64_t)(d >> 63);
+}
+
+/*----------------------------------------------------------------------------
+ * Inverse of zigzag encoding.
+ *
+ * parameters:
+ *   u <-- encoded value
+ *
+ * returns:
+ *   signed difference
+ *----------------------------------------------------------------------------*/
+
+static inline int64_t
+_unzigzag(uint64_t  u)
+{
+  return (int64_t)(u >> 1) ^ -(int64_t)(u & 1);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the number of bytes needed to store a variable-length integer.
+ *
+ * parameters:
+ *   u <-- value
+ *
+ * returns:
+ *   number of bytes
+ *----------------------------------------------------------------------------*/
+
+static inline size_t
+_varint_size(uint64_t  u)
+{
+  size_t n = 1;
+  while (u >= 0x80) {
+    u >>= 7;
+    n++;
+  }
+  return n;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a variable-length integer (7 bits per byte, high bit marking
+ * continuation).
+ *
+ * parameters:
+ *   u <-- value
+ *   p <-- pointer to output position
+ *
+ * returns:
+ *   pointer to next output position
+ *----------------------------------------------------------------------------*/
+
+static inline unsigned char *
+_varint_write(uint64_t        u,
+              unsigned char  *p)
+{
+  while (u >= 0x80) {
+    *p++ = (unsigned char)(u | 0x80);
+    u >>= 7;
+  }
+  *p++ = (unsigned char)u;
+  return p;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a variable-length integer.
+ *
+ * parameters:
+ *   p <-- pointer to input position
+ *   u --> value
+ *
+ * returns:
+ *   pointer to next input position
+ *----------------------------------------------------------------------------*/
+
+static inline const unsigned char *
+_varint_read(const unsigned char  *p,
+             uint64_t             *u)
+{
+  uint64_t v = 0;
+  int shift = 0;
+  while (*p & 0x80) {
+    v |= (uint64_t)(*p++ & 0x7f) << shift;
+    shift += 7;
+  }
+  v |= (uint64_t)(*p++) << shift;
+  *u = v;
+  return p;
+}
+
+/*----------------------------------------------------------------------------
+ * Decode values of an element of a compact indexed list.
+ *
+ * parameters:
+ *   p    <-- pointer to element data
+ *   vals --> element values
+ *
+ * returns:
+ *   number of values
+ *----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_decode_elt(const unsigned char  *p,
+            cs_lnum_t             vals[])
+{
+  uint64_t u;
+  p = _varint_read(p, &u);
+  cs_lnum_t n = u;
+
+  int64_t v = 0;
+  for (cs_lnum_t j = 0; j < n; j++) {
+    p = _varint_read(p, &u);
+    v += _unzigzag(u);
+    vals[j] = v;
+  }
+
+  return n;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a compact indexed list.
+ *
+ * \param[in]  n_elts  number of elements
+ * \param[in]  idx     index of values for each element (size: n_elts + 1)
+ * \param[in]  vals    values
+ *
+ * \return  pointer to compact indexed list
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_mesh_compact_index_t *
+cs_mesh_compact_index_create(cs_lnum_t        n_elts,
+                             const cs_lnum_t  idx[],
+                             const cs_lnum_t  vals[])
+{
+  cs_mesh_compact_index_t *ci;
+  BFT_MALLOC(ci, 1, cs_mesh_compact_index_t);
+
+  ci->n_elts = n_elts;
+  ci->n_vals = idx[n_elts];
+  ci->max_n_vals = 0;
+
+  BFT_MALLOC(ci->offset, n_elts + 1, uint32_t);
+
+  /* First pass: compute offsets */
+
+  size_t size = 0;
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+
+    if (size > UINT32_MAX)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Compact indexed list data exceeds 32-bit offsets."));
+
+    ci->offset[i] = size;
+
+    cs_lnum_t n = idx[i+1] - idx[i];
+    if (n > ci->max_n_vals)
+      ci->max_n_vals = n;
+
+    size += _varint_size(n);
+
+    int64_t v_prev = 0;
+    for (cs_lnum_t j = idx[i]; j < idx[i+1]; j++) {
+      size += _varint_size(_zigzag((int64_t)vals[j] - v_prev));
+      v_prev = vals[j];
+    }
+
+  }
+
+  if (size > UINT32_MAX)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Compact indexed list data exceeds 32-bit offsets."));
+
+  ci->offset[n_elts] = size;
+
+  /* Second pass: encode */
+
+  BFT_MALLOC(ci->data, size, unsigned char);
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+
+    unsigned char *p = ci->data + ci->offset[i];
+    p = _varint_write(idx[i+1] - idx[i], p);
+
+    int64_t v_prev = 0;
+    for (cs_lnum_t j = idx[i]; j < idx[i+1]; j++) {
+      p = _varint_write(_zigzag((int64_t)vals[j] - v_prev), p);
+      v_prev = vals[j];
+    }
+
+    assert(p == ci->data + ci->offset[i+1]);
+
+  }
+
+  return ci;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a compact indexed list.
+ *
+ * \param[in, out]  ci  pointer to compact indexed list pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_compact_index_destroy(cs_mesh_compact_index_t  **ci)
+{
+  if (ci == NULL || *ci == NULL)
+    return;
+
+  cs_mesh_compact_index_t *_ci = *ci;
+
+  BFT_FREE(_ci->offset);
+  BFT_FREE(_ci->data);
+
+  BFT_FREE(*ci);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get values associated with a given element of a compact
+ *        indexed list.
+ *
+ * \param[in]   ci      pointer to compact indexed list
+ * \param[in]   elt_id  element id
+ * \param[out]  vals    element values (size: ci->max_n_vals)
+ *
+ * \return  number of values for this element
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_mesh_compact_index_get(const cs_mesh_compact_index_t  *ci,
+                          cs_lnum_t                       elt_id,
+                          cs_lnum_t                       vals[])
+{
+  assert(elt_id >= 0 && elt_id < ci->n_elts);
+
+  return _decode_elt(ci->data + ci->offset[elt_id], vals);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Decode a compact indexed list to a regular indexed list.
+ *
+ * \param[in]   ci    pointer to compact indexed list
+ * \param[out]  idx   index of values for each element
+ *                    (size: ci->n_elts + 1)
+ * \param[out]  vals  values (size: ci->n_vals)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_compact_index_decode(const cs_mesh_compact_index_t  *ci,
+                             cs_lnum_t                       idx[],
+                             cs_lnum_t                       vals[])
+{
+  const cs_lnum_t n_elts = ci->n_elts;
+
+  /* Build index first (only the count at the start of each element's
+     data needs to be decoded), so values may be decoded in parallel */
+
+  idx[0] = 0;
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    uint64_t n;
+    _varint_read(ci->data + ci->offset[i], &n);
+    idx[i+1] = idx[i] + (cs_lnum_t)n;
+  }
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    _decode_elt(ci->data + ci->offset[i], vals + idx[i]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return memory used by a compact indexed list.
+ *
+ * \param[in]  ci  pointer to compact indexed list
+ *
+ * \return  size of associated arrays, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_mesh_compact_index_memory(const cs_mesh_compact_index_t  *ci)
+{
+  if (ci == NULL)
+    return 0;
+
+  return   (ci->n_elts + 1)*sizeof(uint32_t)
+         + ci->offset[ci->n_elts];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a compact global numbering.
+ *
+ * \param[in]  n_elts      number of elements
+ * \param[in]  global_num  global numbers (size: n_elts)
+ *
+ * \return  pointer to compact global numbering
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_mesh_compact_gnum_t *
+cs_mesh_compact_gnum_create(cs_lnum_t        n_elts,
+                            const cs_gnum_t  global_num[])
+{
+  cs_mesh_compact_gnum_t *cg;
+  BFT_MALLOC(cg, 1, cs_mesh_compact_gnum_t);
+
+  cg->n_elts = n_elts;
+
+  size_t size = 0;
+  cs_gnum_t g_prev = 0;
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    size += _varint_size(_zigzag((int64_t)(global_num[i] - g_prev)));
+    g_prev = global_num[i];
+  }
+
+  cg->size = size;
+  BFT_MALLOC(cg->data, size, unsigned char);
+
+  unsigned char *p = cg->data;
+  g_prev = 0;
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    p = _varint_write(_zigzag((int64_t)(global_num[i] - g_prev)), p);
+    g_prev = global_num[i];
+  }
+
+  return cg;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a compact global numbering.
+ *
+ * \param[in, out]  cg  pointer to compact global numbering pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_compact_gnum_destroy(cs_mesh_compact_gnum_t  **cg)
+{
+  if (cg == NULL || *cg == NULL)
+    return;
+
+  BFT_FREE((*cg)->data);
+  BFT_FREE(*cg);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Decode a compact global numbering.
+ *
+ * \param[in]   cg          pointer to compact global numbering
+ * \param[out]  global_num  global numbers (size: cg->n_elts)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_compact_gnum_decode(const cs_mesh_compact_gnum_t  *cg,
+                            cs_gnum_t                      global_num[])
+{
+  const unsigned char *p = cg->data;
+  cs_gnum_t g = 0;
+
+  for (cs_lnum_t i = 0; i < cg->n_elts; i++) {
+    uint64_t u;
+    p = _varint_read(p, &u);
+    g += (cs_gnum_t)_unzigzag(u);
+    global_num[i] = g;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
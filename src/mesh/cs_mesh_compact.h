@@ -0,0 +1,197 @@
+#ifndef __CS_MESH_COMPACT_H__
+#define __CS_MESH_COMPACT_H__
+
+/*============================================================================
+ * Compact (delta-encoded) storage of mesh connectivity and numbering
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Compact indexed list (such as face -> vertices connectivity)
+ *
+ * For each element, the number of values and the first value are stored
+ * as variable-length integers, followed by the (zigzag-encoded)
+ * differences between successive values. 32-bit offsets to each
+ * element's data allow direct access. */
+
+typedef struct {
+
+  cs_lnum_t       n_elts;       /*!< number of elements */
+  cs_lnum_t       n_vals;       /*!< total number of values */
+  cs_lnum_t       max_n_vals;   /*!< maximum number of values per element */
+
+  uint32_t       *offset;       /*!< offset of each element's data
+                                     (size: n_elts + 1) */
+  unsigned char  *data;         /*!< encoded data */
+
+} cs_mesh_compact_index_t;
+
+/*! Compact global numbering
+ *
+ * Global numbers are stored as variable-length (zigzag-encoded)
+ * differences between successive values, so that access is sequential
+ * only; this is most efficient for ordered numberings. */
+
+typedef struct {
+
+  cs_lnum_t       n_elts;       /*!< number of elements */
+  size_t          size;         /*!< size of encoded data */
+  unsigned char  *data;         /*!< encoded data */
+
+} cs_mesh_compact_gnum_t;
+
+/*============================================================================
+ * Public C function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a compact indexed list.
+ *
+ * \param[in]  n_elts  number of elements
+ * \param[in]  idx     index of values for each element (size: n_elts + 1)
+ * \param[in]  vals    values
+ *
+ * \return  pointer to compact indexed list
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_mesh_compact_index_t *
+cs_mesh_compact_index_create(cs_lnum_t        n_elts,
+                             const cs_lnum_t  idx[],
+                             const cs_lnum_t  vals[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a compact indexed list.
+ *
+ * \param[in, out]  ci  pointer to compact indexed list pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_compact_index_destroy(cs_mesh_compact_index_t  **ci);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get values associated with a given element of a compact
+ *        indexed list.
+ *
+ * \param[in]   ci      pointer to compact indexed list
+ * \param[in]   elt_id  element id
+ * \param[out]  vals    element values (size: ci->max_n_vals)
+ *
+ * \return  number of values for this element
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_mesh_compact_index_get(const cs_mesh_compact_index_t  *ci,
+                          cs_lnum_t                       elt_id,
+                          cs_lnum_t                       vals[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Decode a compact indexed list to a regular indexed list.
+ *
+ * \param[in]   ci    pointer to compact indexed list
+ * \param[out]  idx   index of values for each element
+ *                    (size: ci->n_elts + 1)
+ * \param[out]  vals  values (size: ci->n_vals)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_compact_index_decode(const cs_mesh_compact_index_t  *ci,
+                             cs_lnum_t                       idx[],
+                             cs_lnum_t                       vals[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return memory used by a compact indexed list.
+ *
+ * \param[in]  ci  pointer to compact indexed list
+ *
+ * \return  size of associated arrays, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_mesh_compact_index_memory(const cs_mesh_compact_index_t  *ci);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a compact global numbering.
+ *
+ * \param[in]  n_elts      number of elements
+ * \param[in]  global_num  global numbers (size: n_elts)
+ *
+ * \return  pointer to compact global numbering
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_mesh_compact_gnum_t *
+cs_mesh_compact_gnum_create(cs_lnum_t        n_elts,
+                            const cs_gnum_t  global_num[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a compact global numbering.
+ *
+ * \param[in, out]  cg  pointer to compact global numbering pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_compact_gnum_destroy(cs_mesh_compact_gnum_t  **cg);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Decode a compact global numbering.
+ *
+ * \param[in]   cg          pointer to compact global numbering
+ * \param[out]  global_num  global numbers (size: cg->n_elts)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_compact_gnum_decode(const cs_mesh_compact_gnum_t  *cg,
+                            cs_gnum_t                      global_num[]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_COMPACT_H__ */
@@ -0,0 +1,568 @@
+/*============================================================================
+ * Build mesh builder faces from cell-vertex connectivity
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <string.h>
+#include <stdlib.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_all_to_all.h"
+#include "cs_block_dist.h"
+#include "cs_order.h"
+#include "cs_parall.h"
+
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_face_builder.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Face record: sorted vertices key (4), oriented vertices (4),
+   adjacent cell (0 for a boundary element), group class id */
+
+#define _FR_STRIDE 10
+
+/* Joined face record: global number, adjacent cells (2), group class id,
+   oriented vertices (4) */
+
+#define _JF_STRIDE 8
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Number of faces and face vertices (outwards orientation)
+   for tetrahedra, pyramids, prisms and hexahedra;
+   -1 marks the absent 4th vertex of triangles */
+
+static const int _n_cell_faces[4] = {4, 5, 5, 6};
+
+static const int _cell_face_vtx[4][6][4]
+  = {{{0, 2, 1, -1}, {0, 1, 3, -1}, {0, 3, 2, -1}, {1, 2, 3, -1},
+      {-1, -1, -1, -1}, {-1, -1, -1, -1}},
+     {{0, 1, 4, -1}, {0, 4, 3, -1}, {1, 2, 4, -1}, {2, 3, 4, -1},
+      {0, 3, 2, 1}, {-1, -1, -1, -1}},
+     {{0, 2, 1, -1}, {3, 4, 5, -1}, {0, 1, 4, 3}, {0, 3, 5, 2},
+      {1, 2, 5, 4}, {-1, -1, -1, -1}},
+     {{0, 3, 2, 1}, {0, 1, 5, 4}, {0, 4, 7, 3}, {1, 2, 6, 5},
+      {2, 3, 7, 6}, {4, 5, 6, 7}}};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Define a face record from its oriented vertices.
+ *
+ * parameters:
+ *   n_vtx    <-- number of face vertices (3 or 4)
+ *   vtx      <-- oriented face vertices global numbers
+ *   c_num    <-- adjacent cell global number, or 0
+ *   gc_id    <-- group class id, or 0
+ *   fr       --> face record
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_face_record(int              n_vtx,
+                    const cs_gnum_t  vtx[],
+                    cs_gnum_t        c_num,
+                    int              gc_id,
+                    cs_gnum_t        fr[_FR_STRIDE])
+{
+  for (int i = 0; i < 4; i++) {
+    fr[i] = 0;
+    fr[4+i] = 0;
+  }
+
+  /* Sorted key (insertion sort on at most 4 values) */
+
+  for (int i = 0; i < n_vtx; i++) {
+    cs_gnum_t v = vtx[i];
+    int j = i;
+    while (j > 0 && fr[j-1] > v) {
+      fr[j] = fr[j-1];
+      j--;
+    }
+    fr[j] = v;
+    fr[4+i] = vtx[i];
+  }
+
+  fr[8] = c_num;
+  fr[9] = gc_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare keys of 2 face records.
+ *
+ * parameters:
+ *   fr0 <-- first face record
+ *   fr1 <-- second face record
+ *
+ * returns:
+ *   true if keys are identical, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_same_face_key(const cs_gnum_t  fr0[],
+               const cs_gnum_t  fr1[])
+{
+  return (   fr0[0] == fr1[0] && fr0[1] == fr1[1]
+          && fr0[2] == fr1[2] && fr0[3] == fr1[3]);
+}
+
+/*----------------------------------------------------------------------------
+ * Generate face records for cells and boundary elements.
+ *
+ * parameters:
+ *   mb              <-- pointer to mesh builder structure
+ *   n_cells         <-- number of cells in local block
+ *   cell_type       <-- type of each cell
+ *   cell_vtx_idx    <-- cell vertices index
+ *   cell_vtx        <-- cell vertices global numbers
+ *   n_b_faces       <-- number of local boundary elements
+ *   b_face_vtx_idx  <-- boundary element vertices index
+ *   b_face_vtx      <-- boundary element vertices global numbers
+ *   b_face_gc_id    <-- boundary element group class ids
+ *   n_records       --> number of face records
+ *
+ * returns:
+ *   pointer to array of face records
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t *
+_face_records(const cs_mesh_builder_t  *mb,
+              cs_lnum_t                 n_cells,
+              const fvm_element_t       cell_type[],
+              const cs_lnum_t           cell_vtx_idx[],
+              const cs_gnum_t           cell_vtx[],
+              cs_lnum_t                 n_b_faces,
+              const cs_lnum_t           b_face_vtx_idx[],
+              const cs_gnum_t           b_face_vtx[],
+              const int                 b_face_gc_id[],
+              cs_lnum_t                *n_records)
+{
+  cs_lnum_t n_fr = n_b_faces;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    int t_id = cell_type[i] - FVM_CELL_TETRA;
+    if (t_id < 0 || t_id > 3)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: cell %llu has unhandled element type %d."),
+                __func__,
+                (unsigned long long)(mb->cell_bi.gnum_range[0] + i),
+                (int)cell_type[i]);
+    n_fr += _n_cell_faces[t_id];
+  }
+
+  cs_gnum_t *fr;
+  BFT_MALLOC(fr, n_fr*_FR_STRIDE, cs_gnum_t);
+
+  cs_lnum_t fr_id = 0;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+
+    const int t_id = cell_type[i] - FVM_CELL_TETRA;
+    const cs_gnum_t *c_vtx = cell_vtx + cell_vtx_idx[i];
+    const cs_gnum_t c_num = mb->cell_bi.gnum_range[0] + i;
+
+    for (int j = 0; j < _n_cell_faces[t_id]; j++) {
+      const int *f_tpl = _cell_face_vtx[t_id][j];
+      int n_f_vtx = (f_tpl[3] < 0) ? 3 : 4;
+      cs_gnum_t f_vtx[4];
+      for (int k = 0; k < n_f_vtx; k++)
+        f_vtx[k] = c_vtx[f_tpl[k]];
+      _define_face_record(n_f_vtx, f_vtx, c_num, 0,
+                          fr + fr_id*_FR_STRIDE);
+      fr_id++;
+    }
+
+  }
+
+  /* Boundary elements other than triangles or quadrangles
+     cannot match standard cell faces, and are ignored */
+
+  for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+    cs_lnum_t n_f_vtx = b_face_vtx_idx[i+1] - b_face_vtx_idx[i];
+    if (n_f_vtx < 3 || n_f_vtx > 4)
+      continue;
+    int gc_id = (b_face_gc_id != NULL) ? b_face_gc_id[i] : 0;
+    _define_face_record(n_f_vtx, b_face_vtx + b_face_vtx_idx[i], 0, gc_id,
+                        fr + fr_id*_FR_STRIDE);
+    fr_id++;
+  }
+
+  *n_records = fr_id;
+
+  return fr;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Distribute records to ranks based on a given global number.
+ *
+ * The input array is freed and replaced by the received records.
+ *
+ * parameters:
+ *   bi          <-- block distribution info matching global numbers
+ *   stride      <-- record stride
+ *   gnum_shift  <-- position of global number in record
+ *   n_records   <-> number of records
+ *   records     <-> records
+ *----------------------------------------------------------------------------*/
+
+static void
+_distribute_records(cs_block_dist_info_t   bi,
+                    int                    stride,
+                    int                    gnum_shift,
+                    cs_lnum_t             *n_records,
+                    cs_gnum_t            **records)
+{
+  cs_lnum_t n_send = *n_records;
+  cs_gnum_t *send_rec = *records;
+
+  cs_gnum_t *r_gnum;
+  BFT_MALLOC(r_gnum, n_send, cs_gnum_t);
+  for (cs_lnum_t i = 0; i < n_send; i++)
+    r_gnum[i] = send_rec[i*stride + gnum_shift];
+
+  cs_all_to_all_t *d
+    = cs_all_to_all_create_from_block(n_send,
+                                      0,  /* flags */
+                                      r_gnum,
+                                      bi,
+                                      cs_glob_mpi_comm);
+
+  BFT_FREE(r_gnum);
+
+  cs_gnum_t *recv_rec = cs_all_to_all_copy_array(d,
+                                                 CS_GNUM_TYPE,
+                                                 stride,
+                                                 false, /* reverse */
+                                                 send_rec,
+                                                 NULL);
+
+  *n_records = cs_all_to_all_n_elts_dest(d);
+
+  cs_all_to_all_destroy(&d);
+
+  BFT_FREE(send_rec);
+  *records = recv_rec;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Join face records sharing the same vertices.
+ *
+ * Records must have been distributed based on their lowest vertex, so
+ * that all records of a given face are present on the same rank.
+ *
+ * parameters:
+ *   n_records  <-- number of face records
+ *   fr         <-- face records
+ *   n_faces    --> number of joined faces
+ *
+ * returns:
+ *   pointer to array of joined face records
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t *
+_join_face_records(cs_lnum_t         n_records,
+                   const cs_gnum_t   fr[],
+                   cs_lnum_t        *n_faces)
+{
+  cs_lnum_t *order;
+  cs_gnum_t *f_key;
+
+  BFT_MALLOC(order, n_records, cs_lnum_t);
+  BFT_MALLOC(f_key, n_records*4, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_records; i++) {
+    for (int j = 0; j < 4; j++)
+      f_key[i*4 + j] = fr[i*_FR_STRIDE + j];
+  }
+
+  cs_order_gnum_allocated_s(NULL, f_key, 4, order, n_records);
+
+  BFT_FREE(f_key);
+
+  cs_gnum_t *jf;
+  BFT_MALLOC(jf, n_records*_JF_STRIDE, cs_gnum_t);
+
+  cs_lnum_t f_id = 0;
+  cs_lnum_t s_id = 0;
+
+  while (s_id < n_records) {
+
+    const cs_gnum_t *fr_s = fr + order[s_id]*_FR_STRIDE;
+
+    cs_lnum_t e_id = s_id + 1;
+    while (   e_id < n_records
+           && _same_face_key(fr_s, fr + order[e_id]*_FR_STRIDE))
+      e_id++;
+
+    int n_f_cells = 0;
+    int gc_id = 0;
+    const cs_gnum_t *f_fr[2] = {NULL, NULL};
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      const cs_gnum_t *_fr = fr + order[i]*_FR_STRIDE;
+      if (_fr[8] > 0) {
+        if (n_f_cells < 2)
+          f_fr[n_f_cells] = _fr;
+        n_f_cells++;
+      }
+      else
+        gc_id = _fr[9];
+    }
+
+    if (n_f_cells > 2)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: face with vertices %llu %llu %llu %llu\n"
+                  "is shared by %d cells."),
+                __func__,
+                (unsigned long long)fr_s[0], (unsigned long long)fr_s[1],
+                (unsigned long long)fr_s[2], (unsigned long long)fr_s[3],
+                n_f_cells);
+
+    /* Isolated boundary elements are ignored; for interior faces,
+       keep the orientation of the cell with the lowest number */
+
+    if (n_f_cells > 0) {
+
+      if (n_f_cells == 2 && f_fr[1][8] < f_fr[0][8]) {
+        const cs_gnum_t *_fr = f_fr[0];
+        f_fr[0] = f_fr[1];
+        f_fr[1] = _fr;
+      }
+
+      cs_gnum_t *_jf = jf + f_id*_JF_STRIDE;
+      _jf[0] = 0;
+      _jf[1] = f_fr[0][8];
+      _jf[2] = (n_f_cells == 2) ? f_fr[1][8] : 0;
+      _jf[3] = gc_id;
+      for (int j = 0; j < 4; j++)
+        _jf[4+j] = f_fr[0][4+j];
+
+      f_id++;
+
+    }
+
+    s_id = e_id;
+
+  }
+
+  BFT_FREE(order);
+
+  BFT_REALLOC(jf, f_id*_JF_STRIDE, cs_gnum_t);
+
+  *n_faces = f_id;
+
+  return jf;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build face connectivity of a mesh builder from cell-vertex
+ *        connectivity.
+ *
+ * Cells are given by block, matching the builder's cell block distribution,
+ * with standard element types (tetrahedra, pyramids, prisms and hexahedra)
+ * and vertices in the usual (EnSight/FVM) local numbering.
+ * Faces are generated in parallel: each face is sent to the rank owning
+ * the vertex block of its lowest vertex global number, where matching
+ * faces are joined. Face group classes are determined by matching optional
+ * boundary (face) elements.
+ *
+ * On output, the builder's face block distribution and face arrays
+ * (face_cells, face_vertices_idx, face_vertices and face_gc_id) are defined.
+ *
+ * \param[in, out]  mb              pointer to mesh builder structure
+ * \param[in]       n_cells         number of cells in local block
+ * \param[in]       cell_type       type of each cell
+ * \param[in]       cell_vtx_idx    cell vertices index (size: n_cells + 1)
+ * \param[in]       cell_vtx        cell vertices global numbers
+ * \param[in]       n_b_faces       number of local boundary elements
+ * \param[in]       b_face_vtx_idx  boundary element vertices index
+ *                                  (size: n_b_faces + 1)
+ * \param[in]       b_face_vtx      boundary element vertices global numbers
+ * \param[in]       b_face_gc_id    boundary element group class ids
+ *                                  (1 to n, 0 for none)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_face_builder_from_cells(cs_mesh_builder_t    *mb,
+                                cs_lnum_t             n_cells,
+                                const fvm_element_t   cell_type[],
+                                const cs_lnum_t       cell_vtx_idx[],
+                                const cs_gnum_t       cell_vtx[],
+                                cs_lnum_t             n_b_faces,
+                                const cs_lnum_t       b_face_vtx_idx[],
+                                const cs_gnum_t       b_face_vtx[],
+                                const int             b_face_gc_id[])
+{
+  assert(  n_cells
+         == (cs_lnum_t)(mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0]));
+
+  /* Generate face records, and send them to the rank
+     handling their lowest vertex */
+
+  cs_lnum_t n_records = 0;
+  cs_gnum_t *fr = _face_records(mb,
+                                n_cells,
+                                cell_type,
+                                cell_vtx_idx,
+                                cell_vtx,
+                                n_b_faces,
+                                b_face_vtx_idx,
+                                b_face_vtx,
+                                b_face_gc_id,
+                                &n_records);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    _distribute_records(mb->vertex_bi, _FR_STRIDE, 0, &n_records, &fr);
+#endif
+
+  /* Join matching faces */
+
+  cs_lnum_t n_faces = 0;
+  cs_gnum_t *jf = _join_face_records(n_records, fr, &n_faces);
+
+  BFT_FREE(fr);
+
+  /* Number faces */
+
+  cs_gnum_t n_g_faces = n_faces;
+  cs_gnum_t g_shift = 0;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t l_count = n_faces;
+    MPI_Scan(&l_count, &g_shift, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+    g_shift -= l_count;
+    cs_parall_counter(&n_g_faces, 1);
+  }
+#endif
+
+  for (cs_lnum_t i = 0; i < n_faces; i++)
+    jf[i*_JF_STRIDE] = g_shift + i + 1;
+
+  mb->n_g_faces = n_g_faces;
+  mb->face_bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                            cs_glob_n_ranks,
+                                            mb->min_rank_step,
+                                            0,
+                                            n_g_faces);
+
+  /* Send faces to their block */
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    _distribute_records(mb->face_bi, _JF_STRIDE, 0, &n_faces, &jf);
+#endif
+
+  assert(  n_faces
+         == (cs_lnum_t)(mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0]));
+
+  /* Now define builder arrays */
+
+  BFT_REALLOC(mb->face_cells, n_faces*2, cs_gnum_t);
+  BFT_REALLOC(mb->face_gc_id, n_faces, int);
+  BFT_REALLOC(mb->face_vertices_idx, n_faces+1, cs_lnum_t);
+
+  cs_lnum_t *f_id;
+  BFT_MALLOC(f_id, n_faces, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    const cs_gnum_t *_jf = jf + i*_JF_STRIDE;
+    cs_lnum_t j = _jf[0] - mb->face_bi.gnum_range[0];
+    f_id[i] = j;
+    mb->face_cells[j*2]     = _jf[1];
+    mb->face_cells[j*2 + 1] = _jf[2];
+    mb->face_gc_id[j] = _jf[3];
+    mb->face_vertices_idx[j+1] = (_jf[7] > 0) ? 4 : 3;
+  }
+
+  mb->face_vertices_idx[0] = 0;
+  for (cs_lnum_t i = 0; i < n_faces; i++)
+    mb->face_vertices_idx[i+1] += mb->face_vertices_idx[i];
+
+  BFT_REALLOC(mb->face_vertices,
+              mb->face_vertices_idx[n_faces],
+              cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    const cs_gnum_t *_jf = jf + i*_JF_STRIDE;
+    cs_lnum_t s_id = mb->face_vertices_idx[f_id[i]];
+    cs_lnum_t n_f_vtx = mb->face_vertices_idx[f_id[i]+1] - s_id;
+    for (cs_lnum_t j = 0; j < n_f_vtx; j++)
+      mb->face_vertices[s_id + j] = _jf[4+j];
+  }
+
+  BFT_FREE(f_id);
+  BFT_FREE(jf);
+
+  mb->n_g_face_connect_size = mb->face_vertices_idx[n_faces];
+  cs_parall_counter(&(mb->n_g_face_connect_size), 1);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
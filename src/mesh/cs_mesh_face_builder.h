@@ -0,0 +1,91 @@
+#ifndef __CS_MESH_FACE_BUILDER_H__
+#define __CS_MESH_FACE_BUILDER_H__
+
+/*============================================================================
+ * Build mesh builder faces from cell-vertex connectivity
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "fvm_defs.h"
+
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public C function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build face connectivity of a mesh builder from cell-vertex
+ *        connectivity.
+ *
+ * Cells are given by block, matching the builder's cell block distribution,
+ * with standard element types (tetrahedra, pyramids, prisms and hexahedra)
+ * and vertices in the usual (EnSight/FVM) local numbering.
+ * Faces are generated in parallel: each face is sent to the rank owning
+ * the vertex block of its lowest vertex global number, where matching
+ * faces are joined. Face group classes are determined by matching optional
+ * boundary (face) elements.
+ *
+ * On output, the builder's face block distribution and face arrays
+ * (face_cells, face_vertices_idx, face_vertices and face_gc_id) are defined.
+ *
+ * \param[in, out]  mb              pointer to mesh builder structure
+ * \param[in]       n_cells         number of cells in local block
+ * \param[in]       cell_type       type of each cell
+ * \param[in]       cell_vtx_idx    cell vertices index (size: n_cells + 1)
+ * \param[in]       cell_vtx        cell vertices global numbers
+ * \param[in]       n_b_faces       number of local boundary elements
+ * \param[in]       b_face_vtx_idx  boundary element vertices index
+ *                                  (size: n_b_faces + 1)
+ * \param[in]       b_face_vtx      boundary element vertices global numbers
+ * \param[in]       b_face_gc_id    boundary element group class ids
+ *                                  (1 to n, 0 for none)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_face_builder_from_cells(cs_mesh_builder_t    *mb,
+                                cs_lnum_t             n_cells,
+                                const fvm_element_t   cell_type[],
+                                const cs_lnum_t       cell_vtx_idx[],
+                                const cs_gnum_t       cell_vtx[],
+                                cs_lnum_t             n_b_faces,
+                                const cs_lnum_t       b_face_vtx_idx[],
+                                const cs_gnum_t       b_face_vtx[],
+                                const int             b_face_gc_id[]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_FACE_BUILDER_H__ */
@@ -44,11 +44,15 @@
 
 #include "fvm_periodicity.h"
 
+#include "cs_all_to_all.h"
 #include "cs_base.h"
 #include "cs_interface.h"
 #include "cs_mesh.h"
 #include "cs_order.h"
 #include "cs_halo.h"
+#include "cs_rank_neighbors.h"
+#include "cs_search.h"
+#include "cs_sort.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -2964,6 +2968,567 @@ _create_gcell_faces_connect(cs_mesh_t                 *mesh,
   *p_cell_faces_lst = cell_faces_lst;
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Determine owning rank, distant id and global number of mesh ghost cells.
+ *
+ * parameters:
+ *   mesh     <-- pointer to mesh structure
+ *   mg_rank  --> rank owning each ghost cell
+ *   mg_id    --> id of each ghost cell on its owning rank
+ *   mg_num   --> global number of each ghost cell
+ *---------------------------------------------------------------------------*/
+
+static void
+_deep_halo_mesh_ghosts(const cs_mesh_t   *mesh,
+                       int              **mg_rank,
+                       cs_lnum_t        **mg_id,
+                       cs_gnum_t        **mg_num)
+{
+  const cs_halo_t  *halo = mesh->halo;
+  const cs_lnum_t  n_cells = mesh->n_cells;
+  const cs_lnum_t  n_ghosts = mesh->n_ghost_cells;
+
+  int  *_mg_rank = NULL;
+  cs_lnum_t  *c_id = NULL;
+  cs_gnum_t  *c_num = NULL;
+
+  BFT_MALLOC(_mg_rank, n_ghosts, int);
+  BFT_MALLOC(c_id, n_cells + n_ghosts, cs_lnum_t);
+  BFT_MALLOC(c_num, n_cells + n_ghosts, cs_gnum_t);
+
+  if (halo != NULL) {
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+      for (cs_lnum_t i = halo->index[2*rank_id];
+           i < halo->index[2*rank_id + 2];
+           i++)
+        _mg_rank[i] = halo->c_domain_rank[rank_id];
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    c_id[i] = i;
+    c_num[i] = mesh->global_cell_num[i];
+  }
+
+  if (halo != NULL) {
+    cs_halo_sync_untyped(halo, CS_HALO_EXTENDED, sizeof(cs_lnum_t), c_id);
+    cs_halo_sync_untyped(halo, CS_HALO_EXTENDED, sizeof(cs_gnum_t), c_num);
+  }
+
+  memmove(c_id, c_id + n_cells, n_ghosts*sizeof(cs_lnum_t));
+  memmove(c_num, c_num + n_cells, n_ghosts*sizeof(cs_gnum_t));
+  BFT_REALLOC(c_id, n_ghosts, cs_lnum_t);
+  BFT_REALLOC(c_num, n_ghosts, cs_gnum_t);
+
+  *mg_rank = _mg_rank;
+  *mg_id = c_id;
+  *mg_num = c_num;
+}
+
+/*----------------------------------------------------------------------------
+ * Query the interior faces adjacent to distant cells.
+ *
+ * For each face adjacent to a queried cell, 7 values are returned:
+ * the face id on the cell's owning rank, followed by the global number,
+ * owning rank, and id on owning rank of each of the face's 2 cells.
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   cell_f_idx  <-- local cells -> interior faces index
+ *   cell_f      <-- local cells -> interior faces adjacency
+ *   mg_rank     <-- rank owning each mesh ghost cell
+ *   mg_id       <-- id of each mesh ghost cell on its owning rank
+ *   mg_num      <-- global number of each mesh ghost cell
+ *   n_req       <-- number of queried cells
+ *   req_rank    <-- rank owning each queried cell
+ *   req_id      <-- id of each queried cell on its owning rank
+ *   f_idx       --> index of returned values for each queried cell
+ *   f_val       --> returned values
+ *---------------------------------------------------------------------------*/
+
+static void
+_deep_halo_query_faces(const cs_mesh_t   *mesh,
+                       const cs_lnum_t    cell_f_idx[],
+                       const cs_lnum_t    cell_f[],
+                       const int          mg_rank[],
+                       const cs_lnum_t    mg_id[],
+                       const cs_gnum_t    mg_num[],
+                       cs_lnum_t          n_req,
+                       const int          req_rank[],
+                       const cs_lnum_t    req_id[],
+                       cs_lnum_t        **f_idx,
+                       cs_gnum_t        **f_val)
+{
+  const cs_lnum_t  n_cells = mesh->n_cells;
+  const cs_gnum_t  local_rank = cs_glob_rank_id;
+
+  cs_all_to_all_t *d = cs_all_to_all_create(n_req,
+                                            0,     /* flags */
+                                            NULL,  /* dest_id */
+                                            req_rank,
+                                            cs_glob_mpi_comm);
+
+  cs_lnum_t *recv_id = cs_all_to_all_copy_array(d,
+                                                CS_LNUM_TYPE,
+                                                1,
+                                                false, /* reverse */
+                                                req_id,
+                                                NULL);
+
+  cs_lnum_t n_recv = cs_all_to_all_n_elts_dest(d);
+
+  /* Build reply */
+
+  cs_lnum_t *s_idx = NULL;
+  cs_gnum_t *s_val = NULL;
+
+  BFT_MALLOC(s_idx, n_recv + 1, cs_lnum_t);
+
+  s_idx[0] = 0;
+  for (cs_lnum_t i = 0; i < n_recv; i++) {
+    cs_lnum_t c_id = recv_id[i];
+    s_idx[i+1] = s_idx[i] + 7*(cell_f_idx[c_id+1] - cell_f_idx[c_id]);
+  }
+
+  BFT_MALLOC(s_val, s_idx[n_recv], cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_recv; i++) {
+    cs_lnum_t c_id = recv_id[i];
+    cs_gnum_t *_s_val = s_val + s_idx[i];
+    for (cs_lnum_t j = cell_f_idx[c_id]; j < cell_f_idx[c_id+1]; j++) {
+      cs_lnum_t f_id = cell_f[j];
+      _s_val[0] = f_id;
+      for (int k = 0; k < 2; k++) {
+        cs_lnum_t c_id_k = mesh->i_face_cells[f_id][k];
+        if (c_id_k < n_cells) {
+          _s_val[1 + 3*k] = mesh->global_cell_num[c_id_k];
+          _s_val[2 + 3*k] = local_rank;
+          _s_val[3 + 3*k] = c_id_k;
+        }
+        else {
+          cs_lnum_t g_id = c_id_k - n_cells;
+          _s_val[1 + 3*k] = mg_num[g_id];
+          _s_val[2 + 3*k] = mg_rank[g_id];
+          _s_val[3 + 3*k] = mg_id[g_id];
+        }
+      }
+      _s_val += 7;
+    }
+  }
+
+  BFT_FREE(recv_id);
+
+  /* Return reply to querying ranks */
+
+  *f_idx = cs_all_to_all_copy_index(d, true, s_idx, NULL);
+  *f_val = cs_all_to_all_copy_indexed(d,
+                                      CS_GNUM_TYPE,
+                                      true, /* reverse */
+                                      s_idx,
+                                      s_val,
+                                      *f_idx,
+                                      NULL);
+
+  BFT_FREE(s_val);
+  BFT_FREE(s_idx);
+
+  cs_all_to_all_destroy(&d);
+}
+
+/*----------------------------------------------------------------------------
+ * Create a halo structure from distant element ranks and ids ordered
+ * lexicographically.
+ *
+ * parameters:
+ *   n_local_elts    <-- number of local elements
+ *   n_distant_elts  <-- number of distant elements
+ *   elt_rank        <-- rank of each distant element
+ *   elt_id          <-- id of each distant element on its rank
+ *
+ * returns:
+ *   pointer to created halo structure
+ *---------------------------------------------------------------------------*/
+
+static cs_halo_t *
+_deep_halo_create_halo(cs_lnum_t        n_local_elts,
+                       cs_lnum_t        n_distant_elts,
+                       const int        elt_rank[],
+                       const cs_lnum_t  elt_id[])
+{
+  int *elt_rank_id = NULL;
+
+  cs_rank_neighbors_t *rn = cs_rank_neighbors_create(n_distant_elts,
+                                                     elt_rank);
+
+  cs_rank_neighbors_symmetrize(rn, cs_glob_mpi_comm);
+
+  BFT_MALLOC(elt_rank_id, n_distant_elts, int);
+
+  cs_rank_neighbors_to_index(rn, n_distant_elts, elt_rank, elt_rank_id);
+
+  cs_halo_t *halo = cs_halo_create_from_rank_neighbors(rn,
+                                                       n_local_elts,
+                                                       n_distant_elts,
+                                                       elt_rank_id,
+                                                       elt_id);
+
+  cs_halo_update_buffers(halo);
+
+  BFT_FREE(elt_rank_id);
+  cs_rank_neighbors_destroy(&rn);
+
+  return halo;
+}
+
+/*----------------------------------------------------------------------------
+ * Build ghost cells, ghost faces, and associated halos of a multi-layer
+ * cell halo structure.
+ *
+ * parameters:
+ *   mesh  <-- pointer to mesh structure
+ *   dh    <-> pointer to deep halo structure
+ *---------------------------------------------------------------------------*/
+
+static void
+_deep_halo_build(const cs_mesh_t      *mesh,
+                 cs_mesh_halo_deep_t  *dh)
+{
+  const cs_lnum_t  n_cells = mesh->n_cells;
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t  n_mesh_ghosts = mesh->n_ghost_cells;
+  const int  local_rank = cs_glob_rank_id;
+
+  /* Owning rank, distant id and global number of mesh ghost cells */
+
+  int        *mg_rank = NULL;
+  cs_lnum_t  *mg_id = NULL;
+  cs_gnum_t  *mg_num = NULL;
+
+  _deep_halo_mesh_ghosts(mesh, &mg_rank, &mg_id, &mg_num);
+
+  /* Local cells -> interior faces adjacency */
+
+  cs_lnum_t  *cell_f_idx = NULL, *cell_f = NULL;
+
+  BFT_MALLOC(cell_f_idx, n_cells + 1, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+    cell_f_idx[i] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (int k = 0; k < 2; k++) {
+      cs_lnum_t c_id = mesh->i_face_cells[f_id][k];
+      if (c_id < n_cells)
+        cell_f_idx[c_id + 1] += 1;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_f_idx[i+1] += cell_f_idx[i];
+
+  BFT_MALLOC(cell_f, cell_f_idx[n_cells], cs_lnum_t);
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (int k = 0; k < 2; k++) {
+      cs_lnum_t c_id = mesh->i_face_cells[f_id][k];
+      if (c_id < n_cells)
+        cell_f[cell_f_idx[c_id]++] = f_id;
+    }
+  }
+
+  for (cs_lnum_t i = n_cells; i > 0; i--)
+    cell_f_idx[i] = cell_f_idx[i-1];
+  cell_f_idx[0] = 0;
+
+  /* Ghost cells of first layer: standard mesh halo */
+
+  cs_lnum_t  n_ghosts = 0, n_ghosts_max = CS_MAX(n_mesh_ghosts, 16);
+  int        *g_rank = NULL, *g_layer = NULL;
+  cs_lnum_t  *g_id = NULL;
+  cs_gnum_t  *g_num = NULL;
+
+  BFT_MALLOC(g_rank, n_ghosts_max, int);
+  BFT_MALLOC(g_layer, n_ghosts_max, int);
+  BFT_MALLOC(g_id, n_ghosts_max, cs_lnum_t);
+  BFT_MALLOC(g_num, n_ghosts_max, cs_gnum_t);
+
+  if (mesh->halo != NULL) {
+    const cs_halo_t  *halo = mesh->halo;
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+      for (cs_lnum_t i = halo->index[2*rank_id];
+           i < halo->index[2*rank_id + 1];
+           i++) {
+        g_rank[n_ghosts] = mg_rank[i];
+        g_layer[n_ghosts] = 1;
+        g_id[n_ghosts] = mg_id[i];
+        g_num[n_ghosts] = mg_num[i];
+        n_ghosts++;
+      }
+    }
+  }
+
+  /* Sorted global numbers of known (local or ghost) cells */
+
+  cs_lnum_t  n_known = 0;
+  cs_gnum_t  *known = NULL;
+
+  /* Ghost faces: global numbers of adjacent cells (ordered), rank and id
+     on that rank from which they were obtained, and first cell number */
+
+  cs_lnum_t  n_g_faces = 0, n_g_faces_max = 16;
+  cs_gnum_t  *g_f_val = NULL;
+
+  BFT_MALLOC(g_f_val, n_g_faces_max*5, cs_gnum_t);
+
+  /* Expand layers by face neighborhood */
+
+  cs_lnum_t  layer_s = 0;
+
+  for (int layer = 1; layer < dh->depth; layer++) {
+
+    cs_lnum_t  layer_e = n_ghosts;
+
+    BFT_REALLOC(known, n_cells + n_ghosts, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      known[i] = mesh->global_cell_num[i];
+    for (cs_lnum_t i = 0; i < n_ghosts; i++)
+      known[n_cells + i] = g_num[i];
+    n_known = cs_sort_and_compact_gnum(n_cells + n_ghosts, known);
+
+    cs_lnum_t  *f_idx = NULL;
+    cs_gnum_t  *f_val = NULL;
+
+    _deep_halo_query_faces(mesh,
+                           cell_f_idx,
+                           cell_f,
+                           mg_rank,
+                           mg_id,
+                           mg_num,
+                           layer_e - layer_s,
+                           g_rank + layer_s,
+                           g_id + layer_s,
+                           &f_idx,
+                           &f_val);
+
+    /* Candidate new cells (global number, rank, id) */
+
+    cs_lnum_t  n_new = 0, n_new_max = 16;
+    cs_gnum_t  *new_val = NULL;
+
+    BFT_MALLOC(new_val, n_new_max*3, cs_gnum_t);
+
+    for (cs_lnum_t i = 0; i < layer_e - layer_s; i++) {
+
+      for (cs_lnum_t j = f_idx[i]; j < f_idx[i+1]; j += 7) {
+
+        const cs_gnum_t *_f_val = f_val + j;
+
+        /* Faces adjacent to local cells are already known */
+
+        if (   _f_val[2] == (cs_gnum_t)local_rank
+            || _f_val[5] == (cs_gnum_t)local_rank)
+          continue;
+
+        if (n_g_faces >= n_g_faces_max) {
+          n_g_faces_max *= 2;
+          BFT_REALLOC(g_f_val, n_g_faces_max*5, cs_gnum_t);
+        }
+
+        cs_gnum_t *_g_f_val = g_f_val + n_g_faces*5;
+        _g_f_val[0] = CS_MIN(_f_val[1], _f_val[4]);
+        _g_f_val[1] = CS_MAX(_f_val[1], _f_val[4]);
+        _g_f_val[2] = g_rank[layer_s + i];
+        _g_f_val[3] = _f_val[0];
+        _g_f_val[4] = _f_val[1];
+        n_g_faces++;
+
+        for (int k = 0; k < 2; k++) {
+          const cs_gnum_t *c_val = _f_val + 1 + 3*k;
+          if (cs_search_g_binary(n_known, c_val[0], known) < 0) {
+            if (n_new >= n_new_max) {
+              n_new_max *= 2;
+              BFT_REALLOC(new_val, n_new_max*3, cs_gnum_t);
+            }
+            for (int l = 0; l < 3; l++)
+              new_val[n_new*3 + l] = c_val[l];
+            n_new++;
+          }
+        }
+
+      }
+
+    }
+
+    BFT_FREE(f_idx);
+    BFT_FREE(f_val);
+
+    /* Add new cells (removing duplicates) to next layer */
+
+    cs_lnum_t *order = cs_order_gnum_s(NULL, new_val, 3, n_new);
+
+    if (n_ghosts + n_new > n_ghosts_max) {
+      n_ghosts_max = CS_MAX(n_ghosts + n_new, 2*n_ghosts_max);
+      BFT_REALLOC(g_rank, n_ghosts_max, int);
+      BFT_REALLOC(g_layer, n_ghosts_max, int);
+      BFT_REALLOC(g_id, n_ghosts_max, cs_lnum_t);
+      BFT_REALLOC(g_num, n_ghosts_max, cs_gnum_t);
+    }
+
+    for (cs_lnum_t i = 0; i < n_new; i++) {
+      const cs_gnum_t *c_val = new_val + order[i]*3;
+      if (i > 0 && c_val[0] == g_num[n_ghosts - 1])
+        continue;
+      g_num[n_ghosts] = c_val[0];
+      g_rank[n_ghosts] = c_val[1];
+      g_id[n_ghosts] = c_val[2];
+      g_layer[n_ghosts] = layer + 1;
+      n_ghosts++;
+    }
+
+    BFT_FREE(order);
+    BFT_FREE(new_val);
+
+    layer_s = layer_e;
+
+  }
+
+  BFT_FREE(known);
+  BFT_FREE(cell_f);
+  BFT_FREE(cell_f_idx);
+
+  /* Order ghost cells by owning rank and distant id */
+
+  cs_lnum_t  *order = NULL, *num_order = NULL;
+  cs_gnum_t  *key = NULL;
+  int        *s_rank = NULL;
+  cs_lnum_t  *s_id = NULL;
+
+  BFT_MALLOC(key, n_ghosts*2, cs_gnum_t);
+  for (cs_lnum_t i = 0; i < n_ghosts; i++) {
+    key[i*2] = g_rank[i];
+    key[i*2 + 1] = g_id[i];
+  }
+
+  order = cs_order_gnum_s(NULL, key, 2, n_ghosts);
+
+  BFT_MALLOC(s_rank, n_ghosts, int);
+  BFT_MALLOC(s_id, n_ghosts, cs_lnum_t);
+  BFT_MALLOC(dh->ghost_cell_layer, n_ghosts, int);
+
+  for (cs_lnum_t i = 0; i < n_ghosts; i++) {
+    cs_lnum_t j = order[i];
+    s_rank[i] = g_rank[j];
+    s_id[i] = g_id[j];
+    dh->ghost_cell_layer[i] = g_layer[j];
+    key[i] = g_num[j];
+  }
+
+  dh->n_ghost_cells = n_ghosts;
+
+  BFT_FREE(order);
+  BFT_FREE(g_layer);
+  BFT_FREE(g_id);
+  BFT_FREE(g_rank);
+
+  /* Lookup of ghost cell ids by global number */
+
+  num_order = cs_order_gnum(NULL, key, n_ghosts);
+
+  for (cs_lnum_t i = 0; i < n_ghosts; i++)
+    g_num[i] = key[num_order[i]];
+
+  BFT_FREE(key);
+
+  for (cs_lnum_t i = 0; i < n_mesh_ghosts; i++) {
+    int j = cs_search_g_binary(n_ghosts, mg_num[i], g_num);
+    dh->mesh_ghost_id[i] = (j > -1) ? num_order[j] : -1;
+  }
+
+  BFT_FREE(mg_num);
+  BFT_FREE(mg_id);
+  BFT_FREE(mg_rank);
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (int k = 0; k < 2; k++) {
+      cs_lnum_t c_id = dh->i_face_cells[f_id][k];
+      if (c_id >= n_cells) {
+        assert(dh->mesh_ghost_id[c_id - n_cells] > -1);
+        dh->i_face_cells[f_id][k]
+          = n_cells + dh->mesh_ghost_id[c_id - n_cells];
+      }
+    }
+  }
+
+  /* Ghost cell halo */
+
+  dh->halo = _deep_halo_create_halo(n_cells, n_ghosts, s_rank, s_id);
+
+  /* Remove duplicate ghost faces, keeping the one from the lowest rank,
+     then order them by rank and distant id */
+
+  cs_lnum_t  n_f = 0;
+
+  order = cs_order_gnum_s(NULL, g_f_val, 5, n_g_faces);
+
+  for (cs_lnum_t i = 0; i < n_g_faces; i++) {
+    const cs_gnum_t *_g_f_val = g_f_val + order[i]*5;
+    if (i > 0) {
+      const cs_gnum_t *_g_f_val_p = g_f_val + order[i-1]*5;
+      if (   _g_f_val[0] == _g_f_val_p[0]
+          && _g_f_val[1] == _g_f_val_p[1])
+        continue;
+    }
+    order[n_f++] = order[i];
+  }
+
+  BFT_MALLOC(key, n_f*2, cs_gnum_t);
+  for (cs_lnum_t i = 0; i < n_f; i++) {
+    key[i*2] = g_f_val[order[i]*5 + 2];
+    key[i*2 + 1] = g_f_val[order[i]*5 + 3];
+  }
+
+  cs_lnum_t *f_order = cs_order_gnum_s(NULL, key, 2, n_f);
+
+  BFT_FREE(key);
+
+  dh->n_ghost_i_faces = n_f;
+
+  BFT_REALLOC(dh->i_face_cells, n_i_faces + n_f, cs_lnum_2_t);
+  BFT_REALLOC(s_rank, n_f, int);
+  BFT_REALLOC(s_id, n_f, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_f; i++) {
+    const cs_gnum_t *_g_f_val = g_f_val + order[f_order[i]]*5;
+    cs_gnum_t c_num[2] = {_g_f_val[4],
+                          (_g_f_val[4] == _g_f_val[0]) ?
+                          _g_f_val[1] : _g_f_val[0]};
+    for (int k = 0; k < 2; k++) {
+      int j = cs_search_g_binary(n_ghosts, c_num[k], g_num);
+      assert(j > -1);
+      dh->i_face_cells[n_i_faces + i][k] = n_cells + num_order[j];
+    }
+    s_rank[i] = _g_f_val[2];
+    s_id[i] = _g_f_val[3];
+  }
+
+  BFT_FREE(f_order);
+  BFT_FREE(order);
+  BFT_FREE(g_f_val);
+  BFT_FREE(num_order);
+  BFT_FREE(g_num);
+
+  /* Ghost face halo */
+
+  dh->i_face_halo = _deep_halo_create_halo(n_i_faces, n_f, s_rank, s_id);
+
+  BFT_FREE(s_id);
+  BFT_FREE(s_rank);
+}
+
+#endif /* HAVE_MPI */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -3095,6 +3660,179 @@ cs_mesh_halo_define(cs_mesh_t           *mesh,
 #endif
 }
 
+/*----------------------------------------------------------------------------
+ * Create a multi-layer cell halo structure for a given mesh.
+ *
+ * Ghost cell layers are built from the standard mesh halo by repeated
+ * face neighbor expansion; periodicity is not handled.
+ *
+ * This is a collective operation, and all ranks must use the same depth.
+ *
+ * parameters:
+ *   mesh   <-- pointer to mesh structure
+ *   depth  <-- number of ghost cell layers (>= 1)
+ *
+ * returns:
+ *   pointer to created deep halo structure
+ *---------------------------------------------------------------------------*/
+
+cs_mesh_halo_deep_t *
+cs_mesh_halo_deep_create(const cs_mesh_t  *mesh,
+                         int               depth)
+{
+  cs_mesh_halo_deep_t  *dh = NULL;
+
+  if (depth < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: halo depth must be at least 1 (%d requested)."),
+              __func__, depth);
+
+  if (mesh->n_init_perio > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: periodicity is not handled for multi-layer halos."),
+              __func__);
+
+  BFT_MALLOC(dh, 1, cs_mesh_halo_deep_t);
+
+  dh->depth = depth;
+
+  dh->n_cells = mesh->n_cells;
+  dh->n_ghost_cells = 0;
+  dh->n_i_faces = mesh->n_i_faces;
+  dh->n_ghost_i_faces = 0;
+
+  dh->ghost_cell_layer = NULL;
+
+  BFT_MALLOC(dh->mesh_ghost_id, mesh->n_ghost_cells, cs_lnum_t);
+  for (cs_lnum_t i = 0; i < mesh->n_ghost_cells; i++)
+    dh->mesh_ghost_id[i] = -1;
+
+  BFT_MALLOC(dh->i_face_cells, mesh->n_i_faces, cs_lnum_2_t);
+  memcpy(dh->i_face_cells,
+         mesh->i_face_cells,
+         mesh->n_i_faces*sizeof(cs_lnum_2_t));
+
+  dh->halo = NULL;
+  dh->i_face_halo = NULL;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1)
+    _deep_halo_build(mesh, dh);
+
+#endif
+
+  return dh;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a multi-layer cell halo structure.
+ *
+ * parameters:
+ *   dh  <-> pointer to pointer to deep halo structure
+ *---------------------------------------------------------------------------*/
+
+void
+cs_mesh_halo_deep_destroy(cs_mesh_halo_deep_t  **dh)
+{
+  if (dh == NULL)
+    return;
+
+  cs_mesh_halo_deep_t  *_dh = *dh;
+
+  if (_dh == NULL)
+    return;
+
+  BFT_FREE(_dh->ghost_cell_layer);
+  BFT_FREE(_dh->mesh_ghost_id);
+  BFT_FREE(_dh->i_face_cells);
+
+  cs_halo_destroy(&(_dh->halo));
+  cs_halo_destroy(&(_dh->i_face_halo));
+
+  BFT_FREE(*dh);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute successive products y_p = A.y_(p-1), p = 1 to n_powers, with
+ * y_0 = x, for a scalar matrix defined by face-based (native) coefficients
+ * on a multi-layer halo, using a single halo exchange.
+ *
+ * Coefficients must be defined on ghost cells and ghost faces, for example
+ * by synchronizing them once with dh->halo and dh->i_face_halo.
+ * Values of y_p are correct for local cells and ghost cells of layers
+ * up to depth - p.
+ *
+ * parameters:
+ *   dh         <-- pointer to deep halo structure
+ *   n_powers   <-- number of products (1 to dh->depth)
+ *   symmetric  <-- true if extra-diagonal coefficients are symmetric
+ *   da         <-- diagonal coefficients
+ *                  (size: n_cells + n_ghost_cells)
+ *   xa         <-- extra-diagonal coefficients
+ *                  (size: (n_i_faces + n_ghost_i_faces)*(symmetric ? 1 : 2))
+ *   x          <-> input vector, ghost values updated
+ *                  (size: n_cells + n_ghost_cells)
+ *   y          --> successive products
+ *                  (size: n_powers*(n_cells + n_ghost_cells))
+ *---------------------------------------------------------------------------*/
+
+void
+cs_mesh_halo_deep_native_powers(const cs_mesh_halo_deep_t  *dh,
+                                int                         n_powers,
+                                bool                        symmetric,
+                                const cs_real_t             da[],
+                                const cs_real_t             xa[],
+                                cs_real_t                   x[],
+                                cs_real_t                   y[])
+{
+  if (n_powers < 1 || n_powers > dh->depth)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: %d products requested for a halo of depth %d."),
+              __func__, n_powers, dh->depth);
+
+  const cs_lnum_t  n_cells_ext = dh->n_cells + dh->n_ghost_cells;
+  const cs_lnum_t  n_faces = dh->n_i_faces + dh->n_ghost_i_faces;
+  const cs_lnum_2_t  *restrict face_cells
+    = (const cs_lnum_2_t *restrict)dh->i_face_cells;
+
+  /* Single exchange for all products */
+
+  if (dh->halo != NULL)
+    cs_halo_sync_var(dh->halo, CS_HALO_STANDARD, x);
+
+  const cs_real_t  *restrict x_p = x;
+
+  for (int p = 0; p < n_powers; p++) {
+
+    cs_real_t  *restrict y_p = y + (size_t)p*n_cells_ext;
+
+#   pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+      y_p[i] = da[i] * x_p[i];
+
+    if (symmetric) {
+      for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+        cs_lnum_t ii = face_cells[f_id][0];
+        cs_lnum_t jj = face_cells[f_id][1];
+        y_p[ii] += xa[f_id] * x_p[jj];
+        y_p[jj] += xa[f_id] * x_p[ii];
+      }
+    }
+    else {
+      for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+        cs_lnum_t ii = face_cells[f_id][0];
+        cs_lnum_t jj = face_cells[f_id][1];
+        y_p[ii] += xa[2*f_id] * x_p[jj];
+        y_p[jj] += xa[2*f_id + 1] * x_p[ii];
+      }
+    }
+
+    x_p = y_p;
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -39,6 +39,46 @@
 
 BEGIN_C_DECLS
 
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Multi-layer (deep) cell halo, built by repeated face neighbor expansion.
+
+   Ghost cells of layer 1 are those of the standard mesh halo, and ghost
+   cells of layer k + 1 are the face neighbors of layer k ghost cells not
+   already known. Interior faces adjacent to a ghost cell of layer < depth
+   are also available, so that up to depth successive face-based sweeps
+   may be done on local cells with a single halo exchange. */
+
+typedef struct {
+
+  int           depth;            /* Number of ghost cell layers */
+
+  cs_lnum_t     n_cells;          /* Number of local cells */
+  cs_lnum_t     n_ghost_cells;    /* Number of ghost cells (all layers) */
+  cs_lnum_t     n_i_faces;        /* Number of local interior faces */
+  cs_lnum_t     n_ghost_i_faces;  /* Number of interior faces joining
+                                     ghost cells only */
+
+  int          *ghost_cell_layer; /* Layer (1 to depth) of each ghost cell */
+  cs_lnum_t    *mesh_ghost_id;    /* Matching ghost cell id for each ghost
+                                     cell of mesh->halo, or -1
+                                     (size: mesh->n_ghost_cells) */
+
+  cs_lnum_2_t  *i_face_cells;     /* Interior faces -> cells connectivity,
+                                     local faces first, followed by ghost
+                                     faces; ghost cells are numbered
+                                     n_cells to n_cells + n_ghost_cells - 1
+                                     (size: n_i_faces + n_ghost_i_faces) */
+
+  cs_halo_t    *halo;             /* Halo for cell values (all layers),
+                                     or NULL */
+  cs_halo_t    *i_face_halo;      /* Halo for interior face values
+                                     (ghost faces), or NULL */
+
+} cs_mesh_halo_deep_t;
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -61,6 +101,69 @@ cs_mesh_halo_define(cs_mesh_t           *mesh,
                     cs_lnum_t           *p_gcell_vtx_idx[],
                     cs_lnum_t           *p_gcell_vtx_lst[]);
 
+/*----------------------------------------------------------------------------
+ * Create a multi-layer cell halo structure for a given mesh.
+ *
+ * Ghost cell layers are built from the standard mesh halo by repeated
+ * face neighbor expansion; periodicity is not handled.
+ *
+ * This is a collective operation, and all ranks must use the same depth.
+ *
+ * parameters:
+ *   mesh   <-- pointer to mesh structure
+ *   depth  <-- number of ghost cell layers (>= 1)
+ *
+ * returns:
+ *   pointer to created deep halo structure
+ *---------------------------------------------------------------------------*/
+
+cs_mesh_halo_deep_t *
+cs_mesh_halo_deep_create(const cs_mesh_t  *mesh,
+                         int               depth);
+
+/*----------------------------------------------------------------------------
+ * Destroy a multi-layer cell halo structure.
+ *
+ * parameters:
+ *   dh  <-> pointer to pointer to deep halo structure
+ *---------------------------------------------------------------------------*/
+
+void
+cs_mesh_halo_deep_destroy(cs_mesh_halo_deep_t  **dh);
+
+/*----------------------------------------------------------------------------
+ * Compute successive products y_p = A.y_(p-1), p = 1 to n_powers, with
+ * y_0 = x, for a scalar matrix defined by face-based (native) coefficients
+ * on a multi-layer halo, using a single halo exchange.
+ *
+ * Coefficients must be defined on ghost cells and ghost faces, for example
+ * by synchronizing them once with dh->halo and dh->i_face_halo.
+ * Values of y_p are correct for local cells and ghost cells of layers
+ * up to depth - p.
+ *
+ * parameters:
+ *   dh         <-- pointer to deep halo structure
+ *   n_powers   <-- number of products (1 to dh->depth)
+ *   symmetric  <-- true if extra-diagonal coefficients are symmetric
+ *   da         <-- diagonal coefficients
+ *                  (size: n_cells + n_ghost_cells)
+ *   xa         <-- extra-diagonal coefficients
+ *                  (size: (n_i_faces + n_ghost_i_faces)*(symmetric ? 1 : 2))
+ *   x          <-> input vector, ghost values updated
+ *                  (size: n_cells + n_ghost_cells)
+ *   y          --> successive products
+ *                  (size: n_powers*(n_cells + n_ghost_cells))
+ *---------------------------------------------------------------------------*/
+
+void
+cs_mesh_halo_deep_native_powers(const cs_mesh_halo_deep_t  *dh,
+                                int                         n_powers,
+                                bool                        symmetric,
+                                const cs_real_t             da[],
+                                const cs_real_t             xa[],
+                                cs_real_t                   x[],
+                                cs_real_t                   y[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
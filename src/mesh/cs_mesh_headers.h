@@ -41,6 +41,7 @@
 #include "cs_join_update.h"
 #include "cs_join_util.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adapt.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_bad_cells.h"
 #include "cs_mesh_boundary.h"
@@ -49,6 +50,7 @@
 #include "cs_mesh_cartesian.h"
 #include "cs_mesh_coarsen.h"
 #include "cs_mesh_coherency.h"
+#include "cs_mesh_compact.h"
 #include "cs_mesh_connect.h"
 #include "cs_mesh_extrude.h"
 #include "cs_mesh_from_builder.h"
@@ -446,28 +446,27 @@ _compute_orthogonality(const cs_mesh_t             *mesh,
                        cs_real_t                    i_face_ortho[],
                        cs_real_t                    b_face_ortho[])
 {
-  cs_lnum_t  i, face_id, cell1, cell2;
-  double  cos_alpha;
-  cs_real_t  cell_center1[3], cell_center2[3];
-  cs_real_t  face_center[3];
-  cs_real_t  face_normal[3], vect[3];
-
   const double  rad_to_deg = 180. / acos(-1.);
   const cs_lnum_t  dim = mesh->dim;
 
   /* Loop on internal faces */
   /*------------------------*/
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+# pragma omp parallel for if (mesh->n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+
+    double  cos_alpha;
+    cs_real_t  cell_center1[3], cell_center2[3];
+    cs_real_t  face_normal[3], vect[3];
 
     /* Get local number of the cells beside the face */
 
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+    cs_lnum_t cell1 = mesh->i_face_cells[face_id][0];
+    cs_lnum_t cell2 = mesh->i_face_cells[face_id][1];
 
     /* Get information on mesh quantities */
 
-    for (i = 0; i < dim; i++) {
+    for (cs_lnum_t i = 0; i < dim; i++) {
 
       /* Center of gravity for each cell */
 
@@ -482,7 +481,7 @@ _compute_orthogonality(const cs_mesh_t             *mesh,
 
     /* Compute angle which evaluates the non-orthogonality. */
 
-    for (i = 0; i < dim; i++)
+    for (cs_lnum_t i = 0; i < dim; i++)
       vect[i] = cell_center2[i] - cell_center1[i];
 
     cos_alpha = _COSINE_3D(vect, face_normal);
@@ -499,15 +498,21 @@ _compute_orthogonality(const cs_mesh_t             *mesh,
   /* Loop on border faces */
   /*----------------------*/
 
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
+# pragma omp parallel for if (mesh->n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < mesh->n_b_faces; face_id++) {
+
+    double  cos_alpha;
+    cs_real_t  cell_center1[3];
+    cs_real_t  face_center[3];
+    cs_real_t  face_normal[3], vect[3];
 
     /* Get local number of the cell beside the face */
 
-    cell1 = mesh->b_face_cells[face_id];
+    cs_lnum_t cell1 = mesh->b_face_cells[face_id];
 
     /* Get information on mesh quantities */
 
-    for (i = 0; i < dim; i++) {
+    for (cs_lnum_t i = 0; i < dim; i++) {
 
       /* Center of gravity of the cell */
 
@@ -525,7 +530,7 @@ _compute_orthogonality(const cs_mesh_t             *mesh,
 
     /* Compute alpha: angle wich evaluate the difference with orthogonality. */
 
-    for (i = 0; i < dim; i++)
+    for (cs_lnum_t i = 0; i < dim; i++)
       vect[i] = face_center[i] - cell_center1[i];
 
     cos_alpha = _COSINE_3D(vect, face_normal);
@@ -934,9 +939,6 @@ cs_mesh_quality_compute_warping(const cs_mesh_t    *mesh,
                                 cs_real_t           i_face_warping[],
                                 cs_real_t           b_face_warping[])
 {
-  cs_lnum_t  i, face_id, idx_start, idx_end;
-  cs_real_t  this_face_normal[3];
-
   const cs_lnum_t  dim = mesh->dim;
   const cs_lnum_t  *i_face_vtx_idx = mesh->i_face_vtx_idx;
   const cs_lnum_t  *b_face_vtx_idx = mesh->b_face_vtx_idx;
@@ -946,17 +948,20 @@ cs_mesh_quality_compute_warping(const cs_mesh_t    *mesh,
   /* Compute warping for internal faces */
   /*------------------------------------*/
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+# pragma omp parallel for if (mesh->n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+
+    cs_real_t  this_face_normal[3];
 
     /* Get normal to the face */
 
-    for (i = 0; i < dim; i++)
+    for (cs_lnum_t i = 0; i < dim; i++)
       this_face_normal[i] = i_face_normal[face_id*dim + i];
 
     /* Evaluate warping for each edge of face. Keep the max. */
 
-    idx_start = i_face_vtx_idx[face_id];
-    idx_end = i_face_vtx_idx[face_id + 1];
+    cs_lnum_t idx_start = i_face_vtx_idx[face_id];
+    cs_lnum_t idx_end = i_face_vtx_idx[face_id + 1];
 
     _get_face_warping(idx_start,
                       idx_end,
@@ -970,17 +975,20 @@ cs_mesh_quality_compute_warping(const cs_mesh_t    *mesh,
   /* Compute warping for border faces */
   /*----------------------------------*/
 
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
+# pragma omp parallel for if (mesh->n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < mesh->n_b_faces; face_id++) {
+
+    cs_real_t  this_face_normal[3];
 
     /* Get face normal */
 
-    for (i = 0; i < dim; i++)
+    for (cs_lnum_t i = 0; i < dim; i++)
       this_face_normal[i] = b_face_normal[face_id*dim + i];
 
     /* Evaluate warping for each edge */
 
-    idx_start = b_face_vtx_idx[face_id];
-    idx_end = b_face_vtx_idx[face_id + 1];
+    cs_lnum_t idx_start = b_face_vtx_idx[face_id];
+    cs_lnum_t idx_end = b_face_vtx_idx[face_id + 1];
 
     _get_face_warping(idx_start,
                       idx_end,
@@ -37,6 +37,10 @@
 #include <string.h>
 #include <assert.h>
 
+#if defined(HAVE_OPENMP_TARGET)
+#include <omp.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -51,7 +55,9 @@
 #include "cs_math.h"
 #include "cs_mesh.h"
 #include "cs_mesh_connect.h"
+#include "cs_numbering.h"
 #include "cs_parall.h"
+#include "cs_renumber.h"
 #include "cs_bad_cells_regularisation.h"
 
 /*----------------------------------------------------------------------------
@@ -110,6 +116,18 @@ unsigned cs_glob_mesh_quantities_flag =
 
 static int _n_computations = 0;
 
+/* Arrays mapped to the OpenMP target device */
+
+#if defined(HAVE_OPENMP_TARGET)
+
+#define CS_MESH_QUANTITIES_N_DEVICE_ARRAYS 20
+
+static int     _n_device_arrays = 0;
+static char   *_device_array[CS_MESH_QUANTITIES_N_DEVICE_ARRAYS];
+static size_t  _device_array_size[CS_MESH_QUANTITIES_N_DEVICE_ARRAYS];
+
+#endif
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -122,6 +140,93 @@ cs_f_mesh_quantities_fluid_vol_reductions(void);
  * Private function definitions
  *============================================================================*/
 
+#if defined(HAVE_OPENMP_TARGET)
+
+/*----------------------------------------------------------------------------
+ * Map an array to the OpenMP target device, and register it so that
+ * it may be unmapped later.
+ *
+ * parameters:
+ *   p    <-- pointer to array, or NULL
+ *   size <-- array size, in bytes
+ *----------------------------------------------------------------------------*/
+
+static void
+_device_map_array(const void  *p,
+                  size_t       size)
+{
+  if (p == NULL || size == 0)
+    return;
+
+  assert(_n_device_arrays < CS_MESH_QUANTITIES_N_DEVICE_ARRAYS);
+
+  char *_p = (char *)p;
+
+# pragma omp target enter data map(to:_p[0:size])
+
+  _device_array[_n_device_arrays] = _p;
+  _device_array_size[_n_device_arrays] = size;
+  _n_device_arrays++;
+}
+
+#endif /* defined(HAVE_OPENMP_TARGET) */
+
+/*----------------------------------------------------------------------------
+ * Get the thread group index to use for face -> cell accumulation loops.
+ *
+ * If the face numbering is threaded and covers all faces, its groups are
+ * used, so that faces processed concurrently by different threads do not
+ * share adjacent cells; otherwise, a single group handled by a single
+ * thread is returned, so the loop remains serial.
+ *
+ * parameters:
+ *   numbering     <-- associated face numbering, or NULL
+ *   n_faces       <-- number of faces in loop
+ *   default_index <-> index used when the numbering is not usable (size: 2)
+ *   n_groups      --> number of groups
+ *   n_threads     --> number of threads
+ *   group_index   --> group index (see cs_numbering_t)
+ *----------------------------------------------------------------------------*/
+
+static void
+_face_group_index(const cs_numbering_t   *numbering,
+                  cs_lnum_t               n_faces,
+                  cs_lnum_t               default_index[2],
+                  int                    *n_groups,
+                  int                    *n_threads,
+                  const cs_lnum_t       **group_index)
+{
+  default_index[0] = 0;
+  default_index[1] = n_faces;
+
+  *n_groups = 1;
+  *n_threads = 1;
+  *group_index = default_index;
+
+  if (numbering == NULL)
+    return;
+
+  if (numbering->type != CS_NUMBERING_THREADS)
+    return;
+
+  const int _n_groups = numbering->n_groups;
+  const int _n_threads = numbering->n_threads;
+  const cs_lnum_t *_group_index = numbering->group_index;
+
+  /* Check the numbering matches the faces handled here */
+
+  cs_lnum_t n_g_faces = 0;
+  for (int i = 0; i < _n_groups*_n_threads; i++)
+    n_g_faces += _group_index[i*2 + 1] - _group_index[i*2];
+
+  if (n_g_faces != n_faces)
+    return;
+
+  *n_groups = _n_groups;
+  *n_threads = _n_threads;
+  *group_index = _group_index;
+}
+
 /*----------------------------------------------------------------------------
  * Build the geometrical matrix linear gradient correction
  *
@@ -1149,44 +1254,68 @@ _compute_cell_quantities(const cs_mesh_t    *mesh,
 
   /* Initialization */
 
-  for (cs_lnum_t j = 0; j < n_cells_ext; j++)
-    cell_vol[j] = 0.;
-
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
   for (cs_lnum_t j = 0; j < n_cells_ext; j++) {
+    cell_vol[j] = 0.;
     for (cs_lnum_t i = 0; i < 3; i++)
       cell_cen[j][i] = 0.;
   }
 
+  /* Thread groups ensure faces handled concurrently share no cell */
+
+  cs_lnum_t i_index[2], b_index[2];
+  int n_i_groups, n_i_threads, n_b_groups, n_b_threads;
+  const cs_lnum_t *i_group_index, *b_group_index;
+
+  _face_group_index(mesh->i_face_numbering, n_i_faces, i_index,
+                    &n_i_groups, &n_i_threads, &i_group_index);
+  _face_group_index(mesh->b_face_numbering, mesh->n_b_faces, b_index,
+                    &n_b_groups, &n_b_threads, &b_group_index);
+
   /* Loop on interior faces
      ---------------------- */
 
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-    /* For each cell sharing the internal face, we update
-     * cell_cen and cell_area */
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
 
-    /* Implicit subdivision of cell into face vertices-cell-center pyramids */
+        /* For each cell sharing the internal face, we update
+         * cell_cen and cell_area */
+
+        cs_lnum_t c_id1 = i_face_cells[f_id][0];
+        cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+        /* Implicit subdivision of cell into face vertices-cell-center
+           pyramids */
+
+        if (c_id1 > -1) {
+          cs_real_t pyra_vol_3
+            = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
+                                             i_face_cog[f_id],
+                                             i_face_norm[f_id]);
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
+                                               + 0.25*a_cell_cen[c_id1][i]);
+          cell_vol[c_id1] += pyra_vol_3;
+        }
+        if (c_id2 > -1) {
+          cs_real_t pyra_vol_3
+            = cs_math_3_distance_dot_product(i_face_cog[f_id],
+                                             a_cell_cen[c_id2],
+                                             i_face_norm[f_id]);
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[c_id2][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
+                                               + 0.25*a_cell_cen[c_id2][i]);
+          cell_vol[c_id2] += pyra_vol_3;
+        }
+
+      }
 
-    if (c_id1 > -1) {
-      cs_real_t pyra_vol_3 = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
-                                                            i_face_cog[f_id],
-                                                            i_face_norm[f_id]);
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
-                                           + 0.25*a_cell_cen[c_id1][i]);
-      cell_vol[c_id1] += pyra_vol_3;
-    }
-    if (c_id2 > -1) {
-      cs_real_t pyra_vol_3 = cs_math_3_distance_dot_product(i_face_cog[f_id],
-                                                            a_cell_cen[c_id2],
-                                                            i_face_norm[f_id]);
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[c_id2][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
-                                           + 0.25*a_cell_cen[c_id2][i]);
-      cell_vol[c_id2] += pyra_vol_3;
     }
 
   } /* End of loop on interior faces */
@@ -1194,16 +1323,46 @@ _compute_cell_quantities(const cs_mesh_t    *mesh,
   /* Loop on boundary faces
      --------------------- */
 
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-    /* For each cell sharing a border face, we update the numerator
-     * of cell_cen and cell_area */
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-    cs_lnum_t c_id1 = b_face_cells[f_id];
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
+
+        /* For each cell sharing a border face, we update the numerator
+         * of cell_cen and cell_area */
+
+        cs_lnum_t c_id1 = b_face_cells[f_id];
+
+        /* Computation of the area of the face
+           (note that c_id1 == -1 may happen for isolated faces,
+           which are cleaned afterwards) */
+
+        if (c_id1 > -1) {
+          cs_real_t pyra_vol_3
+            = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
+                                             b_face_cog[f_id],
+                                             b_face_norm[f_id]);
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*b_face_cog[f_id][i]
+                                               + 0.25*a_cell_cen[c_id1][i]);
+          cell_vol[c_id1] += pyra_vol_3;
+        }
+
+      }
+
+    }
+
+  }
 
-    /* Computation of the area of the face
-       (note that c_id1 == -1 may happen for isolated faces,
-       which are cleaned afterwards) */
+  /* Remaining (isolated) boundary faces, not covered by the numbering */
+
+  for (cs_lnum_t f_id = mesh->n_b_faces; f_id < n_b_faces; f_id++) {
+
+    cs_lnum_t c_id1 = b_face_cells[f_id];
 
     if (c_id1 > -1) {
       cs_real_t pyra_vol_3 = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
@@ -1222,6 +1381,7 @@ _compute_cell_quantities(const cs_mesh_t    *mesh,
   /* Loop on cells to finalize the computation
      ----------------------------------------- */
 
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
     for (cs_lnum_t i = 0; i < 3; i++)
@@ -1527,29 +1687,82 @@ _compute_cell_volume(const cs_mesh_t   *mesh,
 {
   const cs_real_t  a_third = 1.0/3.0;
 
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+
   /* Initialization */
 
-  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells_with_ghosts; cell_id++)
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++)
     cell_vol[cell_id] = 0;
 
+  /* Thread groups ensure faces handled concurrently share no cell */
+
+  cs_lnum_t i_index[2], b_index[2];
+  int n_i_groups, n_i_threads, n_b_groups, n_b_threads;
+  const cs_lnum_t *i_group_index, *b_group_index;
+
+  _face_group_index(mesh->i_face_numbering, mesh->n_i_faces, i_index,
+                    &n_i_groups, &n_i_threads, &i_group_index);
+  _face_group_index(mesh->b_face_numbering, mesh->n_b_faces, b_index,
+                    &n_b_groups, &n_b_threads, &b_group_index);
+
   /* Loop on internal faces */
 
-  for (cs_lnum_t fac_id = 0; fac_id < mesh->n_i_faces; fac_id++) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-    cs_lnum_t cell_id1 = mesh->i_face_cells[fac_id][0];
-    cs_lnum_t cell_id2 = mesh->i_face_cells[fac_id][1];
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t fac_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           fac_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           fac_id++) {
+
+        cs_lnum_t cell_id1 = mesh->i_face_cells[fac_id][0];
+        cs_lnum_t cell_id2 = mesh->i_face_cells[fac_id][1];
+
+        cell_vol[cell_id1]
+          += cs_math_3_distance_dot_product(cell_cen[cell_id1],
+                                            i_face_cog[fac_id],
+                                            i_face_norm[fac_id]);
+        cell_vol[cell_id2]
+          -= cs_math_3_distance_dot_product(cell_cen[cell_id2],
+                                            i_face_cog[fac_id],
+                                            i_face_norm[fac_id]);
+      }
+
+    }
 
-    cell_vol[cell_id1] += cs_math_3_distance_dot_product(cell_cen[cell_id1],
-                                                         i_face_cog[fac_id],
-                                                         i_face_norm[fac_id]);
-    cell_vol[cell_id2] -= cs_math_3_distance_dot_product(cell_cen[cell_id2],
-                                                         i_face_cog[fac_id],
-                                                         i_face_norm[fac_id]);
   }
 
   /* Loop on border faces */
 
-  for (cs_lnum_t fac_id = 0; fac_id < mesh->n_b_faces_all; fac_id++) {
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t fac_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           fac_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           fac_id++) {
+
+        cs_lnum_t cell_id1 = mesh->b_face_cells[fac_id];
+
+        cell_vol[cell_id1]
+          += cs_math_3_distance_dot_product(cell_cen[cell_id1],
+                                            b_face_cog[fac_id],
+                                            b_face_norm[fac_id]);
+      }
+
+    }
+
+  }
+
+  /* Remaining (isolated) boundary faces, not covered by the numbering */
+
+  for (cs_lnum_t fac_id = mesh->n_b_faces;
+       fac_id < mesh->n_b_faces_all;
+       fac_id++) {
 
     cs_lnum_t cell_id1 = mesh->b_face_cells[fac_id];
 
@@ -1560,7 +1773,8 @@ _compute_cell_volume(const cs_mesh_t   *mesh,
 
   /* First Computation of the volume */
 
-  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells; cell_id++)
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
     cell_vol[cell_id] *= a_third;
 }
 
@@ -1683,6 +1897,7 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
 
   /* Interior faces */
 
+# pragma omp parallel for reduction(+:w_count) if (n_i_faces > CS_THR_MIN)
   for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
 
     const cs_real_t *face_nomal = i_face_normal[face_id];
@@ -1748,6 +1963,7 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
 
   w_count = 0;
 
+# pragma omp parallel for reduction(+:w_count) if (n_b_faces > CS_THR_MIN)
   for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
 
     const cs_real_t *face_nomal = b_face_normal[face_id];
@@ -1847,39 +2063,33 @@ _compute_face_vectors(int                dim,
                       cs_real_t          diipb[],
                       cs_real_t          dofij[])
 {
-  cs_lnum_t face_id;
-  cs_lnum_t cell_id;
-
-  cs_real_t dipjp, pond;
-  cs_real_t surfnx, surfny, surfnz;
-  cs_real_t vecijx, vecijy, vecijz;
-
   /* Interior faces */
 
-  for (face_id = 0; face_id < n_i_faces; face_id++) {
+# pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
 
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
 
     /* Normalized normal */
-    surfnx = i_face_normal[face_id*dim]     / i_face_surf[face_id];
-    surfny = i_face_normal[face_id*dim + 1] / i_face_surf[face_id];
-    surfnz = i_face_normal[face_id*dim + 2] / i_face_surf[face_id];
+    cs_real_t surfnx = i_face_normal[face_id*dim]     / i_face_surf[face_id];
+    cs_real_t surfny = i_face_normal[face_id*dim + 1] / i_face_surf[face_id];
+    cs_real_t surfnz = i_face_normal[face_id*dim + 2] / i_face_surf[face_id];
 
     /* ---> IJ */
-    vecijx = cell_cen[cell_id2*dim]     - cell_cen[cell_id1*dim];
-    vecijy = cell_cen[cell_id2*dim + 1] - cell_cen[cell_id1*dim + 1];
-    vecijz = cell_cen[cell_id2*dim + 2] - cell_cen[cell_id1*dim + 2];
+    cs_real_t vecijx = cell_cen[cell_id2*dim]     - cell_cen[cell_id1*dim];
+    cs_real_t vecijy = cell_cen[cell_id2*dim + 1] - cell_cen[cell_id1*dim + 1];
+    cs_real_t vecijz = cell_cen[cell_id2*dim + 2] - cell_cen[cell_id1*dim + 2];
 
     /* ---> DIJPP = IJ.NIJ */
-    dipjp = vecijx*surfnx + vecijy*surfny + vecijz*surfnz;
+    cs_real_t dipjp = vecijx*surfnx + vecijy*surfny + vecijz*surfnz;
 
     /* ---> DIJPF = (IJ.NIJ).NIJ */
     dijpf[face_id*dim]     = dipjp*surfnx;
     dijpf[face_id*dim + 1] = dipjp*surfny;
     dijpf[face_id*dim + 2] = dipjp*surfnz;
 
-    pond = weight[face_id];
+    cs_real_t pond = weight[face_id];
 
     /* ---> DOFIJ = OF */
     dofij[face_id*dim]     = i_face_cog[face_id*dim]
@@ -1898,9 +2108,10 @@ _compute_face_vectors(int                dim,
   /* Boundary faces */
   cs_gnum_t w_count = 0;
 
-  for (face_id = 0; face_id < n_b_faces; face_id++) {
+# pragma omp parallel for reduction(+:w_count) if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
 
-    cell_id = b_face_cells[face_id];
+    cs_lnum_t cell_id = b_face_cells[face_id];
 
     cs_real_3_t normal;
     /* Normal is vector 0 if the b_face_normal norm is too small */
@@ -1998,6 +2209,7 @@ _compute_face_sup_vectors(const cs_lnum_t    n_cells,
 
   /* Interior faces */
 
+# pragma omp parallel for reduction(+:w_count) if (n_i_faces > CS_THR_MIN)
   for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
 
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
@@ -2130,6 +2342,27 @@ _b_thickness(const cs_mesh_t             *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Initialize a newly allocated mesh quantities array so that its memory
+ * is first touched by the threads operating on it, if this option is set.
+ *
+ * parameters:
+ *   numbering <-- associated numbering, or NULL
+ *   n_elts    <-- number of elements in array
+ *   elt_size  <-- element size
+ *   array     <-> array to initialize
+ *----------------------------------------------------------------------------*/
+
+static void
+_first_touch(const cs_numbering_t  *numbering,
+             cs_lnum_t              n_elts,
+             size_t                 elt_size,
+             void                  *array)
+{
+  if (cs_renumber_get_first_touch())
+    cs_numbering_first_touch(numbering, n_elts, elt_size, NULL, array);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -2245,6 +2478,7 @@ cs_mesh_quantities_create(void)
   mesh_quantities->has_disable_flag = 0;
   mesh_quantities->c_disable_flag = NULL;
   mesh_quantities->bad_cell_flag = NULL;
+  mesh_quantities->device_mapped = 0;
 
   return (mesh_quantities);
 }
@@ -2280,6 +2514,8 @@ cs_mesh_quantities_destroy(cs_mesh_quantities_t  *mq)
 void
 cs_mesh_quantities_free_all(cs_mesh_quantities_t  *mq)
 {
+  cs_mesh_quantities_device_unmap(mq);
+
   BFT_FREE(mq->cell_cen);
   BFT_FREE(mq->cell_vol);
   BFT_FREE(mq->i_face_normal);
@@ -2303,6 +2539,105 @@ cs_mesh_quantities_free_all(cs_mesh_quantities_t  *mq)
   BFT_FREE(mq->bad_cell_flag);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Map mesh connectivity and quantities used by offloaded loops
+ *         to the default OpenMP target device.
+ *
+ * Mapped arrays remain present on the device until
+ * \ref cs_mesh_quantities_device_unmap is called, so offloaded loops
+ * only need to transfer variable-dependent arrays. If OpenMP target
+ * offload is not available or no device is present, this function
+ * does nothing, and the host loops are used.
+ *
+ * \param[in]       m   pointer to mesh structure
+ * \param[in, out]  mq  pointer to mesh quantities structures
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_device_map(const cs_mesh_t       *m,
+                              cs_mesh_quantities_t  *mq)
+{
+#if defined(HAVE_OPENMP_TARGET)
+
+  if (mq->device_mapped || omp_get_num_devices() < 1)
+    return;
+
+  const size_t n_cells_ext = m->n_cells_with_ghosts;
+  const size_t n_i_faces = m->n_i_faces;
+  const size_t n_b_faces = m->n_b_faces;
+  const size_t r_size = sizeof(cs_real_t);
+
+  _device_map_array(m->i_face_cells, n_i_faces*sizeof(cs_lnum_2_t));
+  _device_map_array(m->b_face_cells, n_b_faces*sizeof(cs_lnum_t));
+
+  if (m->cell_cells_idx != NULL) {
+    const size_t n_cells = m->n_cells;
+    _device_map_array(m->cell_cells_idx, (n_cells+1)*sizeof(cs_lnum_t));
+    _device_map_array(m->cell_cells_lst,
+                      m->cell_cells_idx[n_cells]*sizeof(cs_lnum_t));
+  }
+
+  _device_map_array(mq->cell_cen, n_cells_ext*3*r_size);
+  _device_map_array(mq->cell_vol, n_cells_ext*r_size);
+
+  _device_map_array(mq->i_face_normal, n_i_faces*3*r_size);
+  _device_map_array(mq->i_face_cog, n_i_faces*3*r_size);
+  _device_map_array(mq->i_face_surf, n_i_faces*r_size);
+  _device_map_array(mq->i_dist, n_i_faces*r_size);
+  _device_map_array(mq->weight, n_i_faces*r_size);
+  _device_map_array(mq->diipf, n_i_faces*3*r_size);
+  _device_map_array(mq->djjpf, n_i_faces*3*r_size);
+
+  _device_map_array(mq->b_face_normal, n_b_faces*3*r_size);
+  _device_map_array(mq->b_face_surf, n_b_faces*r_size);
+  _device_map_array(mq->b_dist, n_b_faces*r_size);
+  _device_map_array(mq->diipb, n_b_faces*3*r_size);
+
+  mq->device_mapped = 1;
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n Mesh quantities mapped to OpenMP target device %d.\n"),
+                omp_get_default_device());
+
+#else
+
+  CS_UNUSED(m);
+  CS_UNUSED(mq);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Remove mesh connectivity and quantities from the OpenMP
+ *         target device.
+ *
+ * \param[in, out]  mq  pointer to mesh quantities structures
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_device_unmap(cs_mesh_quantities_t  *mq)
+{
+#if defined(HAVE_OPENMP_TARGET)
+
+  if (mq->device_mapped == 0)
+    return;
+
+  for (int i = 0; i < _n_device_arrays; i++) {
+#   pragma omp target exit data \
+      map(delete:_device_array[i][0:_device_array_size[i]])
+  }
+
+  _n_device_arrays = 0;
+
+#endif
+
+  mq->device_mapped = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute mesh quantities needed for preprocessing.
@@ -2322,29 +2657,53 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *m,
 
   /* If this is not an update, allocate members of the structure */
 
-  if (mq->i_face_normal == NULL)
+  if (mq->i_face_normal == NULL) {
     BFT_MALLOC(mq->i_face_normal, n_i_faces*3, cs_real_t);
+    _first_touch(m->i_face_numbering, n_i_faces, 3*sizeof(cs_real_t),
+                 mq->i_face_normal);
+  }
 
-  if (mq->i_face_cog == NULL)
+  if (mq->i_face_cog == NULL) {
     BFT_MALLOC(mq->i_face_cog, n_i_faces*3, cs_real_t);
+    _first_touch(m->i_face_numbering, n_i_faces, 3*sizeof(cs_real_t),
+                 mq->i_face_cog);
+  }
 
-  if (mq->b_face_normal == NULL)
+  if (mq->b_face_normal == NULL) {
     BFT_MALLOC(mq->b_face_normal, n_b_faces*3, cs_real_t);
+    _first_touch(m->b_face_numbering, n_b_faces, 3*sizeof(cs_real_t),
+                 mq->b_face_normal);
+  }
 
-  if (mq->b_face_cog == NULL)
+  if (mq->b_face_cog == NULL) {
     BFT_MALLOC(mq->b_face_cog, n_b_faces*3, cs_real_t);
+    _first_touch(m->b_face_numbering, n_b_faces, 3*sizeof(cs_real_t),
+                 mq->b_face_cog);
+  }
 
-  if (mq->cell_cen == NULL)
+  if (mq->cell_cen == NULL) {
     BFT_MALLOC(mq->cell_cen, n_cells_with_ghosts*3, cs_real_t);
+    _first_touch(m->cell_numbering, n_cells_with_ghosts, 3*sizeof(cs_real_t),
+                 mq->cell_cen);
+  }
 
-  if (mq->cell_vol == NULL)
+  if (mq->cell_vol == NULL) {
     BFT_MALLOC(mq->cell_vol, n_cells_with_ghosts, cs_real_t);
+    _first_touch(m->cell_numbering, n_cells_with_ghosts, sizeof(cs_real_t),
+                 mq->cell_vol);
+  }
 
-  if (mq->i_face_surf == NULL)
+  if (mq->i_face_surf == NULL) {
     BFT_MALLOC(mq->i_face_surf, n_i_faces, cs_real_t);
+    _first_touch(m->i_face_numbering, n_i_faces, sizeof(cs_real_t),
+                 mq->i_face_surf);
+  }
 
-  if (mq->b_face_surf == NULL)
+  if (mq->b_face_surf == NULL) {
     BFT_MALLOC(mq->b_face_surf, n_b_faces, cs_real_t);
+    _first_touch(m->b_face_numbering, n_b_faces, sizeof(cs_real_t),
+                 mq->b_face_surf);
+  }
 
   /* Compute face centers of gravity, normals, and surfaces */
 
@@ -2553,6 +2912,11 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
   cs_lnum_t  n_b_faces = m->n_b_faces;
   cs_lnum_t  n_cells_with_ghosts = m->n_cells_with_ghosts;
 
+  /* Arrays may be resized or updated, so remap them afterwards */
+
+  const int device_remap = mq->device_mapped;
+  cs_mesh_quantities_device_unmap(mq);
+
   /* Update the number of passes */
 
   _n_computations++;
@@ -2586,29 +2950,53 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
   mq->max_f_vol = mq->max_vol;
   mq->tot_f_vol = mq->tot_vol;
 
-  if (mq->i_dist == NULL)
+  if (mq->i_dist == NULL) {
     BFT_MALLOC(mq->i_dist, n_i_faces, cs_real_t);
+    _first_touch(m->i_face_numbering, n_i_faces, sizeof(cs_real_t),
+                 mq->i_dist);
+  }
 
-  if (mq->b_dist == NULL)
+  if (mq->b_dist == NULL) {
     BFT_MALLOC(mq->b_dist, n_b_faces, cs_real_t);
+    _first_touch(m->b_face_numbering, n_b_faces, sizeof(cs_real_t),
+                 mq->b_dist);
+  }
 
-  if (mq->weight == NULL)
+  if (mq->weight == NULL) {
     BFT_MALLOC(mq->weight, n_i_faces, cs_real_t);
+    _first_touch(m->i_face_numbering, n_i_faces, sizeof(cs_real_t),
+                 mq->weight);
+  }
 
-  if (mq->dijpf == NULL)
+  if (mq->dijpf == NULL) {
     BFT_MALLOC(mq->dijpf, n_i_faces*dim, cs_real_t);
+    _first_touch(m->i_face_numbering, n_i_faces, dim*sizeof(cs_real_t),
+                 mq->dijpf);
+  }
 
-  if (mq->diipb == NULL)
+  if (mq->diipb == NULL) {
     BFT_MALLOC(mq->diipb, n_b_faces*dim, cs_real_t);
+    _first_touch(m->b_face_numbering, n_b_faces, dim*sizeof(cs_real_t),
+                 mq->diipb);
+  }
 
-  if (mq->dofij == NULL)
+  if (mq->dofij == NULL) {
     BFT_MALLOC(mq->dofij, n_i_faces*dim, cs_real_t);
+    _first_touch(m->i_face_numbering, n_i_faces, dim*sizeof(cs_real_t),
+                 mq->dofij);
+  }
 
-  if (mq->diipf == NULL)
+  if (mq->diipf == NULL) {
     BFT_MALLOC(mq->diipf, n_i_faces*dim, cs_real_t);
+    _first_touch(m->i_face_numbering, n_i_faces, dim*sizeof(cs_real_t),
+                 mq->diipf);
+  }
 
-  if (mq->djjpf == NULL)
+  if (mq->djjpf == NULL) {
     BFT_MALLOC(mq->djjpf, n_i_faces*dim, cs_real_t);
+    _first_touch(m->i_face_numbering, n_i_faces, dim*sizeof(cs_real_t),
+                 mq->djjpf);
+  }
 
   if (mq->b_sym_flag == NULL) {
     BFT_MALLOC(mq->b_sym_flag, n_b_faces, int);
@@ -2690,6 +3078,9 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
                    "volume.\n"));
     }
   }
+
+  if (device_remap)
+    cs_mesh_quantities_device_map(m, mq);
 }
 
 /*----------------------------------------------------------------------------
@@ -2994,6 +3385,7 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
 
   BFT_MALLOC(cell_area, n_cells_with_ghosts, cs_real_t);
 
+# pragma omp parallel for if (n_cells_with_ghosts > CS_THR_MIN)
   for (cs_lnum_t j = 0; j < n_cells_with_ghosts; j++) {
 
     cell_area[j] = 0.;
@@ -3003,30 +3395,53 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
 
   }
 
+  /* Thread groups ensure faces handled concurrently share no cell;
+     the mesh may not be renumbered yet, in which case loops are serial. */
+
+  cs_lnum_t i_index[2], b_index[2];
+  int n_i_groups, n_i_threads, n_b_groups, n_b_threads;
+  const cs_lnum_t *i_group_index, *b_group_index;
+
+  _face_group_index(mesh->i_face_numbering, n_i_faces, i_index,
+                    &n_i_groups, &n_i_threads, &i_group_index);
+  _face_group_index(mesh->b_face_numbering, n_b_faces, b_index,
+                    &n_b_groups, &n_b_threads, &b_group_index);
+
   /* Loop on interior faces
      ---------------------- */
 
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-    /* For each cell sharing the internal face, we update
-     * cell_cen and cell_area */
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
 
-    /* Computation of the area of the face */
+        /* For each cell sharing the internal face, we update
+         * cell_cen and cell_area */
 
-    cs_real_t area = cs_math_3_norm(i_face_norm + 3*f_id);
+        cs_lnum_t c_id1 = i_face_cells[f_id][0];
+        cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+        /* Computation of the area of the face */
+
+        cs_real_t area = cs_math_3_norm(i_face_norm + 3*f_id);
+
+        if (c_id1 > -1) {
+          cell_area[c_id1] += area;
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[3*c_id1 + i] += i_face_cog[3*f_id + i]*area;
+        }
+        if (c_id2 > -1) {
+          cell_area[c_id2] += area;
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[3*c_id2 + i] += i_face_cog[3*f_id + i]*area;
+        }
+
+      }
 
-    if (c_id1 > -1) {
-      cell_area[c_id1] += area;
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[3*c_id1 + i] += i_face_cog[3*f_id + i]*area;
-    }
-    if (c_id2 > -1) {
-      cell_area[c_id2] += area;
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[3*c_id2 + i] += i_face_cog[3*f_id + i]*area;
     }
 
   } /* End of loop on interior faces */
@@ -3034,27 +3449,38 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
   /* Loop on boundary faces
      --------------------- */
 
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-    /* For each cell sharing a border face, we update the numerator
-     * of cell_cen and cell_area */
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-    cs_lnum_t c_id1 = b_face_cells[f_id];
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
 
-    /* Computation of the area of the face
-       (note that c_id1 == -1 may happen for isolated faces,
-       which are cleaned afterwards) */
+        /* For each cell sharing a border face, we update the numerator
+         * of cell_cen and cell_area */
 
-    if (c_id1 > -1) {
+        cs_lnum_t c_id1 = b_face_cells[f_id];
 
-      cs_real_t area = cs_math_3_norm(b_face_norm + 3*f_id);
+        /* Computation of the area of the face
+           (note that c_id1 == -1 may happen for isolated faces,
+           which are cleaned afterwards) */
 
-      cell_area[c_id1] += area;
+        if (c_id1 > -1) {
 
-      /* Computation of the numerator */
+          cs_real_t area = cs_math_3_norm(b_face_norm + 3*f_id);
 
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[3*c_id1 + i] += b_face_cog[3*f_id + i]*area;
+          cell_area[c_id1] += area;
+
+          /* Computation of the numerator */
+
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[3*c_id1 + i] += b_face_cog[3*f_id + i]*area;
+
+        }
+
+      }
 
     }
 
@@ -3063,6 +3489,7 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
   /* Loop on cells to finalize the computation of center of gravity
      -------------------------------------------------------------- */
 
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
     for (cs_lnum_t i = 0; i < 3; i++)
@@ -146,6 +146,12 @@ typedef struct {
                                       used for fluid solid and porous modelling */
   unsigned     *bad_cell_flag;     /* Flag (mask) for bad cells detected */
 
+  int           device_mapped;     /* Are connectivity and quantities used
+                                      by offloaded loops mapped to the
+                                      OpenMP target device ?
+                                      0: no
+                                      1: yes */
+
 } cs_mesh_quantities_t ;
 
 /*============================================================================
@@ -229,6 +235,38 @@ cs_mesh_quantities_destroy(cs_mesh_quantities_t  *mq);
 void
 cs_mesh_quantities_free_all(cs_mesh_quantities_t  *mq);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Map mesh connectivity and quantities used by offloaded loops
+ *         to the default OpenMP target device.
+ *
+ * Mapped arrays remain present on the device until
+ * \ref cs_mesh_quantities_device_unmap is called, so offloaded loops
+ * only need to transfer variable-dependent arrays. If OpenMP target
+ * offload is not available or no device is present, this function
+ * does nothing, and the host loops are used.
+ *
+ * \param[in]       m   pointer to mesh structure
+ * \param[in, out]  mq  pointer to mesh quantities structures
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_device_map(const cs_mesh_t       *m,
+                              cs_mesh_quantities_t  *mq);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Remove mesh connectivity and quantities from the OpenMP
+ *         target device.
+ *
+ * \param[in, out]  mq  pointer to mesh quantities structures
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_device_unmap(cs_mesh_quantities_t  *mq);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute mesh quantities needed for preprocessing.
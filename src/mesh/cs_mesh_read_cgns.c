@@ -0,0 +1,709 @@
+/*============================================================================
+ * Direct reading of CGNS meshes into a mesh builder
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * CGNS library headers
+ *----------------------------------------------------------------------------*/
+
+#include <cgnslib.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "fvm_defs.h"
+
+#include "cs_block_dist.h"
+#include "cs_mesh_face_builder.h"
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_read_cgns.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+#define CS_CGNS_NAME_SIZE      32      /* Maximum CGNS name length */
+
+/* Compatibility with different CGNS library versions */
+
+#if !defined(CGNS_ENUMV)
+#define CGNS_ENUMV(e) e
+#endif
+
+#if !defined(CGNS_ENUMT)
+#define CGNS_ENUMT(e) e
+#endif
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Boundary condition defined on elements */
+
+typedef struct {
+
+  char        name[CS_CGNS_NAME_SIZE + 1];  /* BC name */
+  bool        is_range;                     /* true for element range,
+                                               false for element list */
+  cgsize_t    n_elts;                       /* Number of listed elements */
+  cgsize_t   *elts;                         /* Sorted element ids, or
+                                               range bounds */
+
+} _cgns_bc_t;
+
+/* CGNS file and zone access */
+
+typedef struct {
+
+  int          fn;                /* CGNS file index */
+  int          base;              /* Base index (always 1) */
+  int          zone;              /* Zone index (always 1) */
+  int          phys_dim;          /* Physical dimension */
+
+  cgsize_t     n_g_vertices;      /* Number of zone vertices */
+
+  int          n_sections;        /* Number of element sections */
+  CGNS_ENUMT(ElementType_t) *s_type;       /* Section element types */
+  cgsize_t    *s_range;           /* Section element range (2 per section) */
+
+  int          n_bcs;             /* Number of element-based BCs */
+  _cgns_bc_t  *bcs;               /* Element-based BCs */
+
+} _cgns_input_t;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return id of a handled cell type, or -1.
+ *
+ * For handled types, CGNS and FVM local vertex numberings are identical.
+ *
+ * parameters:
+ *   type <-- CGNS element type
+ *
+ * returns:
+ *   0 for tetrahedra, 1 for pyramids, 2 for prisms, 3 for hexahedra,
+ *   -1 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_cell_type_id(CGNS_ENUMT(ElementType_t)  type)
+{
+  int t_id = -1;
+
+  switch(type) {
+  case CGNS_ENUMV(TETRA_4):
+    t_id = 0;
+    break;
+  case CGNS_ENUMV(PYRA_5):
+    t_id = 1;
+    break;
+  case CGNS_ENUMV(PENTA_6):
+    t_id = 2;
+    break;
+  case CGNS_ENUMV(HEXA_8):
+    t_id = 3;
+    break;
+  default:
+    break;
+  }
+
+  return t_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare element ids (qsort function).
+ *
+ * parameters:
+ *   x <-- pointer to first element id
+ *   y <-- pointer to second element id
+ *
+ * returns:
+ *   -1 if x < y, 1 if x > y, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_elt_ids(const void  *x,
+                 const void  *y)
+{
+  cgsize_t e0 = *((const cgsize_t *)x);
+  cgsize_t e1 = *((const cgsize_t *)y);
+
+  if (e0 < e1)
+    return -1;
+  else if (e0 > e1)
+    return 1;
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Open a CGNS file for reading and read zone metadata.
+ *
+ * parameters:
+ *   filename <-- name of CGNS file
+ *   read_bcs <-- if true, read boundary condition element lists
+ *   ci       --> CGNS input structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_cgns_input_open(const char     *filename,
+                 bool            read_bcs,
+                 _cgns_input_t  *ci)
+{
+  int retval = CG_OK;
+
+  memset(ci, 0, sizeof(_cgns_input_t));
+
+  ci->base = 1;
+  ci->zone = 1;
+
+  /* Each rank reads its own blocks using read-only serial access */
+
+  if (cg_open(filename, CG_MODE_READ, &(ci->fn)) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("cg_open() failed to open file \"%s\" : \n%s"),
+              filename, cg_get_error());
+
+  int n_bases = 0, n_zones = 0, cell_dim = 0;
+  char base_name[CS_CGNS_NAME_SIZE + 1];
+  char zone_name[CS_CGNS_NAME_SIZE + 1];
+  CGNS_ENUMT(ZoneType_t) zone_type = CGNS_ENUMV(ZoneTypeNull);
+  cgsize_t zone_size[3];
+
+  retval = cg_nbases(ci->fn, &n_bases);
+  if (retval == CG_OK && n_bases > 0)
+    retval = cg_base_read(ci->fn, ci->base, base_name,
+                          &cell_dim, &(ci->phys_dim));
+  if (retval == CG_OK && n_bases > 0)
+    retval = cg_nzones(ci->fn, ci->base, &n_zones);
+  if (retval == CG_OK && n_zones == 1)
+    retval = cg_zone_type(ci->fn, ci->base, ci->zone, &zone_type);
+
+  if (   retval != CG_OK || n_bases < 1 || n_zones != 1
+      || cell_dim != 3 || zone_type != CGNS_ENUMV(Unstructured))
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS file \"%s\":\n"
+                "the direct reader requires a single base with a single\n"
+                "unstructured 3D zone.\n"
+                "Use the Preprocessor for this mesh."),
+              filename);
+
+  if (cg_zone_read(ci->fn, ci->base, ci->zone, zone_name, zone_size)
+      != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("cg_zone_read() failed for file \"%s\" : \n%s"),
+              filename, cg_get_error());
+
+  ci->n_g_vertices = zone_size[0];
+
+  /* Sections */
+
+  if (cg_nsections(ci->fn, ci->base, ci->zone, &(ci->n_sections)) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("cg_nsections() failed for file \"%s\" : \n%s"),
+              filename, cg_get_error());
+
+  BFT_MALLOC(ci->s_type, ci->n_sections, CGNS_ENUMT(ElementType_t));
+  BFT_MALLOC(ci->s_range, ci->n_sections*2, cgsize_t);
+
+  for (int i = 0; i < ci->n_sections; i++) {
+
+    char s_name[CS_CGNS_NAME_SIZE + 1];
+    int n_bndry = 0, parent_flag = 0;
+
+    retval = cg_section_read(ci->fn, ci->base, ci->zone, i+1, s_name,
+                             ci->s_type + i,
+                             ci->s_range + i*2, ci->s_range + i*2 + 1,
+                             &n_bndry, &parent_flag);
+
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cg_section_read() failed for file \"%s\" : \n%s"),
+                filename, cg_get_error());
+
+    CGNS_ENUMT(ElementType_t) type = ci->s_type[i];
+
+    if (   type == CGNS_ENUMV(MIXED)
+        || type == CGNS_ENUMV(NFACE_n)
+        || (   type > CGNS_ENUMV(QUAD_9) && type != CGNS_ENUMV(NGON_n)
+            && _cell_type_id(type) < 0))
+      bft_error(__FILE__, __LINE__, 0,
+                _("CGNS file \"%s\":\n"
+                  "section \"%s\" has mixed, polyhedral or higher order\n"
+                  "elements, which are not handled by the direct reader.\n"
+                  "Use the Preprocessor for this mesh."),
+                filename, s_name);
+
+  }
+
+  /* Element-based boundary conditions */
+
+  int n_bcs = 0;
+  if (cg_nbocos(ci->fn, ci->base, ci->zone, &n_bcs) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("cg_nbocos() failed for file \"%s\" : \n%s"),
+              filename, cg_get_error());
+
+  BFT_MALLOC(ci->bcs, n_bcs, _cgns_bc_t);
+
+  int n_vtx_bcs = 0;
+
+  for (int i = 0; i < n_bcs; i++) {
+
+    _cgns_bc_t *bc = ci->bcs + ci->n_bcs;
+
+    CGNS_ENUMT(BCType_t) bc_type;
+    CGNS_ENUMT(PointSetType_t) pset_type;
+    CGNS_ENUMT(DataType_t) normal_type;
+    CGNS_ENUMT(GridLocation_t) location = CGNS_ENUMV(Vertex);
+    int normal_index[3], n_datasets;
+    cgsize_t n_pnts, normal_size;
+
+    retval = cg_boco_info(ci->fn, ci->base, ci->zone, i+1, bc->name,
+                          &bc_type, &pset_type, &n_pnts,
+                          normal_index, &normal_size, &normal_type,
+                          &n_datasets);
+
+    if (retval == CG_OK)
+      retval = cg_boco_gridlocation_read(ci->fn, ci->base, ci->zone, i+1,
+                                         &location);
+
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cg_boco_info() failed for file \"%s\" : \n%s"),
+                filename, cg_get_error());
+
+    if (   pset_type == CGNS_ENUMV(ElementRange)
+        || (pset_type == CGNS_ENUMV(PointRange)
+            && location != CGNS_ENUMV(Vertex)))
+      bc->is_range = true;
+    else if (   pset_type == CGNS_ENUMV(ElementList)
+             || (pset_type == CGNS_ENUMV(PointList)
+                 && location != CGNS_ENUMV(Vertex)))
+      bc->is_range = false;
+    else {
+      n_vtx_bcs++;
+      continue;
+    }
+
+    bc->n_elts = n_pnts;
+    bc->elts = NULL;
+
+    if (read_bcs) {
+      BFT_MALLOC(bc->elts, n_pnts, cgsize_t);
+      if (cg_boco_read(ci->fn, ci->base, ci->zone, i+1, bc->elts, NULL)
+          != CG_OK)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("cg_boco_read() failed for file \"%s\" : \n%s"),
+                  filename, cg_get_error());
+      if (! bc->is_range)
+        qsort(bc->elts, n_pnts, sizeof(cgsize_t), _compare_elt_ids);
+    }
+
+    ci->n_bcs += 1;
+
+  }
+
+  if (n_vtx_bcs > 0 && read_bcs == false)
+    bft_printf(_("   %d vertex-based boundary conditions ignored by "
+                 "the direct reader.\n"), n_vtx_bcs);
+}
+
+/*----------------------------------------------------------------------------
+ * Close a CGNS file.
+ *
+ * parameters:
+ *   ci <-> CGNS input structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_cgns_input_close(_cgns_input_t  *ci)
+{
+  for (int i = 0; i < ci->n_bcs; i++)
+    BFT_FREE(ci->bcs[i].elts);
+  BFT_FREE(ci->bcs);
+
+  BFT_FREE(ci->s_range);
+  BFT_FREE(ci->s_type);
+
+  if (cg_close(ci->fn) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("cg_close() failed :\n%s"), cg_get_error());
+}
+
+/*----------------------------------------------------------------------------
+ * Return group class id matching a CGNS element id.
+ *
+ * Group class ids match the first boundary condition containing the
+ * element; elements with no boundary condition are assigned to the
+ * last group class.
+ *
+ * parameters:
+ *   ci     <-- CGNS input structure
+ *   elt_id <-- CGNS element id
+ *
+ * returns:
+ *   group class id (1 to n)
+ *----------------------------------------------------------------------------*/
+
+static int
+_elt_gc_id(const _cgns_input_t  *ci,
+           cgsize_t              elt_id)
+{
+  for (int i = 0; i < ci->n_bcs; i++) {
+
+    const _cgns_bc_t *bc = ci->bcs + i;
+
+    if (bc->is_range) {
+      if (elt_id >= bc->elts[0] && elt_id <= bc->elts[1])
+        return i+1;
+    }
+    else {
+      cgsize_t start_id = 0;
+      cgsize_t end_id = bc->n_elts;
+      while (start_id < end_id) {
+        cgsize_t mid_id = (start_id + end_id) / 2;
+        if (bc->elts[mid_id] < elt_id)
+          start_id = mid_id + 1;
+        else
+          end_id = mid_id;
+      }
+      if (start_id < bc->n_elts && bc->elts[start_id] == elt_id)
+        return i+1;
+    }
+
+  }
+
+  return ci->n_bcs + 1;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read mesh dimensions and group definitions from a CGNS file.
+ *
+ * The file must contain a single unstructured zone. Groups are defined
+ * from the zone's element-based boundary conditions, with an additional
+ * family (the last one) used for elements belonging to no group.
+ *
+ * \param[in, out]  mesh      pointer to mesh structure
+ * \param[in, out]  mb        pointer to mesh builder structure
+ * \param[in]       filename  name of CGNS file
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_read_cgns_headers(cs_mesh_t          *mesh,
+                          cs_mesh_builder_t  *mb,
+                          const char         *filename)
+{
+  _cgns_input_t ci;
+
+  bft_printf(_(" Reading metadata from file: \"%s\"\n"), filename);
+
+  _cgns_input_open(filename, false, &ci);
+
+  mesh->n_g_cells = 0;
+  for (int i = 0; i < ci.n_sections; i++) {
+    if (_cell_type_id(ci.s_type[i]) > -1)
+      mesh->n_g_cells += ci.s_range[i*2 + 1] - ci.s_range[i*2] + 1;
+  }
+
+  mesh->n_g_vertices = ci.n_g_vertices;
+
+  /* Faces are only known once built */
+
+  mb->n_g_faces = 0;
+  mb->n_g_face_connect_size = 0;
+
+  /* One family per boundary condition, and a last family
+     for elements with no group */
+
+  mesh->n_families = ci.n_bcs + 1;
+  mesh->n_max_family_items = 1;
+
+  BFT_REALLOC(mesh->family_item, mesh->n_families, int);
+
+  mesh->n_groups = ci.n_bcs;
+  BFT_REALLOC(mesh->group_idx, mesh->n_groups + 1, int);
+
+  mesh->group_idx[0] = 0;
+  for (int i = 0; i < ci.n_bcs; i++) {
+    mesh->group_idx[i+1] = mesh->group_idx[i] + strlen(ci.bcs[i].name) + 1;
+    mesh->family_item[i] = -(i+1);
+  }
+  mesh->family_item[ci.n_bcs] = 0;
+
+  BFT_REALLOC(mesh->group, mesh->group_idx[mesh->n_groups], char);
+  for (int i = 0; i < ci.n_bcs; i++)
+    strcpy(mesh->group + mesh->group_idx[i], ci.bcs[i].name);
+
+  _cgns_input_close(&ci);
+
+  bft_printf(_("   %llu cells, %llu vertices\n"),
+             (unsigned long long)(mesh->n_g_cells),
+             (unsigned long long)(mesh->n_g_vertices));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read mesh data from a CGNS file, by block.
+ *
+ * Each rank reads the vertices and cells of its block using partial
+ * reads; faces are then built in parallel from the cell connectivity.
+ *
+ * Block ranges for cells and vertices must have been defined.
+ *
+ * \param[in, out]  mesh      pointer to mesh structure
+ * \param[in, out]  mb        pointer to mesh builder structure
+ * \param[in]       filename  name of CGNS file
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_read_cgns_data(cs_mesh_t          *mesh,
+                       cs_mesh_builder_t  *mb,
+                       const char         *filename)
+{
+  _cgns_input_t ci;
+
+  bft_printf(_(" Reading mesh from file: \"%s\"\n"), filename);
+
+  _cgns_input_open(filename, true, &ci);
+
+  /* Vertex coordinates */
+
+  {
+    const char *coord_name[3] = {"CoordinateX",
+                                 "CoordinateY",
+                                 "CoordinateZ"};
+
+    cs_lnum_t n_vertices = (  mb->vertex_bi.gnum_range[1]
+                            - mb->vertex_bi.gnum_range[0]);
+
+    cs_real_t *coords;
+    BFT_MALLOC(coords, n_vertices, cs_real_t);
+
+    BFT_REALLOC(mb->vertex_coords, n_vertices*3, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_vertices*3; i++)
+      mb->vertex_coords[i] = 0.;
+
+    cgsize_t r_min = mb->vertex_bi.gnum_range[0];
+    cgsize_t r_max = mb->vertex_bi.gnum_range[1] - 1;
+
+    for (int j = 0; j < ci.phys_dim && n_vertices > 0; j++) {
+      if (cg_coord_read(ci.fn, ci.base, ci.zone, coord_name[j],
+                        CGNS_ENUMV(RealDouble), &r_min, &r_max, coords)
+          != CG_OK)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("cg_coord_read() failed to read %s:\n%s"),
+                  coord_name[j], cg_get_error());
+      for (cs_lnum_t i = 0; i < n_vertices; i++)
+        mb->vertex_coords[i*3 + j] = coords[i];
+    }
+
+    BFT_FREE(coords);
+  }
+
+  /* Cells: global numbering follows volume sections */
+
+  cs_lnum_t n_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+  fvm_element_t *cell_type;
+  cs_lnum_t *cell_vtx_idx;
+  cs_gnum_t *cell_vtx;
+
+  const fvm_element_t fvm_cell_type[4]
+    = {FVM_CELL_TETRA, FVM_CELL_PYRAM, FVM_CELL_PRISM, FVM_CELL_HEXA};
+
+  BFT_MALLOC(cell_type, n_cells, fvm_element_t);
+  BFT_MALLOC(cell_vtx_idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(cell_vtx, n_cells*8, cs_gnum_t);
+  BFT_REALLOC(mb->cell_gc_id, n_cells, int);
+
+  cell_vtx_idx[0] = 0;
+
+  /* Boundary elements, distributed by block for each section */
+
+  cs_lnum_t n_b_faces = 0;
+  cs_lnum_t *b_face_vtx_idx;
+  cs_gnum_t *b_face_vtx = NULL;
+  int *b_face_gc_id = NULL;
+
+  BFT_MALLOC(b_face_vtx_idx, 1, cs_lnum_t);
+  b_face_vtx_idx[0] = 0;
+
+  cs_gnum_t c_shift = 0;
+  cs_lnum_t c_id = 0;
+
+  for (int s_id = 0; s_id < ci.n_sections; s_id++) {
+
+    const CGNS_ENUMT(ElementType_t) type = ci.s_type[s_id];
+    const int t_id = _cell_type_id(type);
+    const cgsize_t s_start = ci.s_range[s_id*2];
+    const cs_gnum_t n_g_s_elts = ci.s_range[s_id*2 + 1] - s_start + 1;
+
+    cs_gnum_t e_start = 0, e_end = 0; /* 0-based range in section */
+
+    if (t_id > -1) {
+      e_start = CS_MAX(mb->cell_bi.gnum_range[0] - 1, c_shift);
+      e_end = CS_MIN(mb->cell_bi.gnum_range[1] - 1, c_shift + n_g_s_elts);
+      if (e_end > e_start) {
+        e_start -= c_shift;
+        e_end -= c_shift;
+      }
+      else
+        e_start = e_end = 0;
+      c_shift += n_g_s_elts;
+    }
+    else if (   type == CGNS_ENUMV(TRI_3)
+             || type == CGNS_ENUMV(QUAD_4)) {
+      cs_block_dist_info_t bi
+        = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                      cs_glob_n_ranks,
+                                      mb->min_rank_step,
+                                      0,
+                                      n_g_s_elts);
+      e_start = bi.gnum_range[0] - 1;
+      e_end = bi.gnum_range[1] - 1;
+    }
+
+    if (e_end <= e_start)
+      continue;
+
+    int n_vtx = 0;
+    cg_npe(type, &n_vtx);
+
+    cs_lnum_t n_elts = e_end - e_start;
+
+    cgsize_t *elt_vtx;
+    BFT_MALLOC(elt_vtx, n_elts*n_vtx, cgsize_t);
+
+    if (cg_elements_partial_read(ci.fn, ci.base, ci.zone, s_id+1,
+                                 s_start + e_start, s_start + e_end - 1,
+                                 elt_vtx, NULL) != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cg_elements_partial_read() failed:\n%s"),
+                cg_get_error());
+
+    if (t_id > -1) {
+      for (cs_lnum_t i = 0; i < n_elts; i++) {
+        cell_type[c_id] = fvm_cell_type[t_id];
+        for (int j = 0; j < n_vtx; j++)
+          cell_vtx[cell_vtx_idx[c_id] + j] = elt_vtx[i*n_vtx + j];
+        cell_vtx_idx[c_id+1] = cell_vtx_idx[c_id] + n_vtx;
+        mb->cell_gc_id[c_id] = mesh->n_families;
+        c_id++;
+      }
+    }
+    else {
+      BFT_REALLOC(b_face_vtx_idx, n_b_faces + n_elts + 1, cs_lnum_t);
+      BFT_REALLOC(b_face_vtx,
+                  b_face_vtx_idx[n_b_faces] + n_elts*n_vtx,
+                  cs_gnum_t);
+      BFT_REALLOC(b_face_gc_id, n_b_faces + n_elts, int);
+      for (cs_lnum_t i = 0; i < n_elts; i++) {
+        cs_lnum_t f_id = n_b_faces + i;
+        for (int j = 0; j < n_vtx; j++)
+          b_face_vtx[b_face_vtx_idx[f_id] + j] = elt_vtx[i*n_vtx + j];
+        b_face_vtx_idx[f_id+1] = b_face_vtx_idx[f_id] + n_vtx;
+        b_face_gc_id[f_id] = _elt_gc_id(&ci, s_start + e_start + i);
+      }
+      n_b_faces += n_elts;
+    }
+
+    BFT_FREE(elt_vtx);
+
+  }
+
+  assert(c_id == n_cells);
+
+  _cgns_input_close(&ci);
+
+  /* Build faces */
+
+  cs_mesh_face_builder_from_cells(mb,
+                                  n_cells,
+                                  cell_type,
+                                  cell_vtx_idx,
+                                  cell_vtx,
+                                  n_b_faces,
+                                  b_face_vtx_idx,
+                                  b_face_vtx,
+                                  b_face_gc_id);
+
+  BFT_FREE(b_face_gc_id);
+  BFT_FREE(b_face_vtx);
+  BFT_FREE(b_face_vtx_idx);
+  BFT_FREE(cell_vtx);
+  BFT_FREE(cell_vtx_idx);
+  BFT_FREE(cell_type);
+
+  /* Faces not matching a boundary element use the default family */
+
+  cs_lnum_t n_faces = mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0];
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    if (mb->face_gc_id[i] == 0)
+      mb->face_gc_id[i] = mesh->n_families;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
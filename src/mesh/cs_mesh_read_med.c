@@ -0,0 +1,835 @@
+/*============================================================================
+ * Direct reading of MED meshes into a mesh builder
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * MED library headers
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+#include <med.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "fvm_defs.h"
+
+#include "cs_block_dist.h"
+#include "cs_file.h"
+#include "cs_mesh_face_builder.h"
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_read_med.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* MED file and mesh access */
+
+typedef struct {
+
+  med_idt   fid;                          /* MED file id */
+  char      mesh_name[MED_NAME_SIZE + 1]; /* MED mesh name */
+  med_int   space_dim;                    /* Spatial dimension */
+
+  int       n_families;                   /* Number of element families */
+  med_int  *family_num;                   /* Sorted element family numbers */
+
+} _med_input_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Handled cell and face types, and matching vertex permutation
+   (MED to FVM local numbering; these permutations are involutions) */
+
+static const med_geometry_type _med_cell_type[4]
+  = {MED_TETRA4, MED_PYRA5, MED_PENTA6, MED_HEXA8};
+
+static const fvm_element_t _fvm_cell_type[4]
+  = {FVM_CELL_TETRA, FVM_CELL_PYRAM, FVM_CELL_PRISM, FVM_CELL_HEXA};
+
+static const int _med_cell_n_vtx[4] = {4, 5, 6, 8};
+
+static const int _med_cell_vtx_perm[4][8]
+  = {{0, 2, 1, 3, -1, -1, -1, -1},
+     {0, 3, 2, 1, 4, -1, -1, -1},
+     {0, 2, 1, 3, 5, 4, -1, -1},
+     {0, 3, 2, 1, 4, 7, 6, 5}};
+
+static const med_geometry_type _med_face_type[2] = {MED_TRIA3, MED_QUAD4};
+
+static const int _med_face_n_vtx[2] = {3, 4};
+
+/* Volume element types not handled by this reader */
+
+static const med_geometry_type _med_unhandled_type[6]
+  = {MED_TETRA10, MED_PYRA13, MED_PENTA15, MED_HEXA20, MED_HEXA27,
+     MED_OCTA12};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Open a MED file for reading and select its first mesh.
+ *
+ * parameters:
+ *   filename <-- name of MED file
+ *   mi       --> MED input structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_med_input_open(const char    *filename,
+                _med_input_t  *mi)
+{
+  mi->fid = -1;
+
+#if defined(HAVE_MED_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    MPI_Info hints;
+    cs_file_get_default_access(CS_FILE_MODE_READ, NULL, &hints);
+    mi->fid = MEDparFileOpen(filename, MED_ACC_RDONLY,
+                             cs_glob_mpi_comm, hints);
+    if (mi->fid < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("MEDparFileOpen() failed to open file: %s"), filename);
+  }
+
+#endif
+
+  /* Without MED parallel I/O, each rank reads its own blocks
+     using a separate read-only serial access */
+
+  if (mi->fid < 0) {
+    mi->fid = MEDfileOpen(filename, MED_ACC_RDONLY);
+    if (mi->fid < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("MEDfileOpen() failed to open file: %s"), filename);
+  }
+
+  /* Select first mesh */
+
+  if (MEDnMesh(mi->fid) < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("No mesh found in MED file: %s"), filename);
+
+  med_int n_axes = MEDmeshnAxis(mi->fid, 1);
+  if (n_axes < 1 || n_axes > 3)
+    bft_error(__FILE__, __LINE__, 0,
+              _("MED file \"%s\":\n"
+                "first mesh has unhandled number of axes (%d)."),
+              filename, (int)n_axes);
+
+  med_int mesh_dim, n_step;
+  med_mesh_type mesh_type;
+  med_sorting_type sorting_type;
+  med_axis_type axis_type;
+  char description[MED_COMMENT_SIZE + 1];
+  char dt_unit[MED_SNAME_SIZE + 1];
+  char axis_name[3*MED_SNAME_SIZE + 1];
+  char axis_unit[3*MED_SNAME_SIZE + 1];
+
+  med_err retval = MEDmeshInfo(mi->fid,
+                               1,
+                               mi->mesh_name,
+                               &(mi->space_dim),
+                               &mesh_dim,
+                               &mesh_type,
+                               description,
+                               dt_unit,
+                               &sorting_type,
+                               &n_step,
+                               &axis_type,
+                               axis_name,
+                               axis_unit);
+
+  if (retval < 0 || mesh_type != MED_UNSTRUCTURED_MESH)
+    bft_error(__FILE__, __LINE__, 0,
+              _("MED file \"%s\":\n"
+                "first mesh is not a readable unstructured mesh."),
+              filename);
+
+  /* Element families (with negative numbers) */
+
+  mi->n_families = 0;
+  mi->family_num = NULL;
+
+  med_int n_fam = MEDnFamily(mi->fid, mi->mesh_name);
+
+  BFT_MALLOC(mi->family_num, n_fam, med_int);
+
+  for (med_int i = 0; i < n_fam; i++) {
+    med_int n_fam_groups = MEDnFamilyGroup(mi->fid, mi->mesh_name, i+1);
+    char fam_name[MED_NAME_SIZE + 1];
+    char *group_names;
+    med_int fam_num = 0;
+    BFT_MALLOC(group_names, MED_LNAME_SIZE*n_fam_groups + 1, char);
+    MEDfamilyInfo(mi->fid, mi->mesh_name, i+1, fam_name, &fam_num,
+                  group_names);
+    BFT_FREE(group_names);
+    if (fam_num < 0)
+      mi->family_num[mi->n_families++] = fam_num;
+  }
+
+  /* Sort family numbers (few families, insertion sort is sufficient) */
+
+  for (int i = 1; i < mi->n_families; i++) {
+    med_int f = mi->family_num[i];
+    int j = i;
+    while (j > 0 && mi->family_num[j-1] > f) {
+      mi->family_num[j] = mi->family_num[j-1];
+      j--;
+    }
+    mi->family_num[j] = f;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Close a MED file.
+ *
+ * parameters:
+ *   mi <-> MED input structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_med_input_close(_med_input_t  *mi)
+{
+  BFT_FREE(mi->family_num);
+
+  if (MEDfileClose(mi->fid) != 0)
+    bft_error(__FILE__, __LINE__, 0, _("MEDfileClose() failed."));
+
+  mi->fid = -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Return group class id matching a MED family number.
+ *
+ * Elements with no family (or an unknown family) are assigned to
+ * the last group class.
+ *
+ * parameters:
+ *   mi      <-- MED input structure
+ *   fam_num <-- MED family number
+ *
+ * returns:
+ *   group class id (1 to n)
+ *----------------------------------------------------------------------------*/
+
+static int
+_family_gc_id(const _med_input_t  *mi,
+              med_int              fam_num)
+{
+  int start_id = 0;
+  int end_id = mi->n_families;
+
+  while (start_id < end_id) {
+    int mid_id = (start_id + end_id) / 2;
+    if (mi->family_num[mid_id] < fam_num)
+      start_id = mid_id + 1;
+    else
+      end_id = mid_id;
+  }
+
+  if (start_id < mi->n_families && mi->family_num[start_id] == fam_num)
+    return start_id + 1;
+
+  return mi->n_families + 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Return global number of elements of a given type.
+ *
+ * parameters:
+ *   mi        <-- MED input structure
+ *   entity    <-- MED entity type
+ *   geo_type  <-- MED geometric type
+ *   data_type <-- MED data type
+ *
+ * returns:
+ *   number of elements
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_n_g_med_entities(const _med_input_t  *mi,
+                  med_entity_type      entity,
+                  med_geometry_type    geo_type,
+                  med_data_type        data_type)
+{
+  med_bool changement, transformation;
+
+  med_int n = MEDmeshnEntity(mi->fid,
+                             mi->mesh_name,
+                             MED_NO_DT,
+                             MED_NO_IT,
+                             entity,
+                             geo_type,
+                             data_type,
+                             (entity == MED_NODE) ? MED_NO_CMODE : MED_NODAL,
+                             &changement,
+                             &transformation);
+
+  return (n > 0) ? n : 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a MED filter for a contiguous block of entities.
+ *
+ * parameters:
+ *   mi        <-- MED input structure
+ *   n_g_ents  <-- global number of entities
+ *   n_comp    <-- number of values per entity
+ *   start_id  <-- id of first entity in block (0 to n-1)
+ *   n_ents    <-- number of entities in block
+ *   filter    --> MED filter
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_filter(const _med_input_t  *mi,
+              cs_gnum_t            n_g_ents,
+              int                  n_comp,
+              cs_gnum_t            start_id,
+              cs_lnum_t            n_ents,
+              med_filter          *filter)
+{
+  med_int count = (n_ents > 0) ? 1 : 0;
+
+  med_err retval = MEDfilterBlockOfEntityCr(mi->fid,
+                                            n_g_ents,
+                                            1,
+                                            n_comp,
+                                            MED_ALL_CONSTITUENT,
+                                            MED_FULL_INTERLACE,
+                                            MED_COMPACT_STMODE,
+                                            MED_NO_PROFILE,
+                                            start_id + 1, /* start */
+                                            n_ents,       /* stride */
+                                            count,
+                                            n_ents,       /* blocksize */
+                                            0,            /* lastblocksize */
+                                            filter);
+
+  if (retval < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("MEDfilterBlockOfEntityCr() failed for mesh \"%s\"."),
+              mi->mesh_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a block of element connectivity and family numbers.
+ *
+ * parameters:
+ *   mi        <-- MED input structure
+ *   geo_type  <-- MED geometric type
+ *   n_g_elts  <-- global number of elements of this type
+ *   n_vtx     <-- number of vertices per element
+ *   start_id  <-- id of first element in block (0 to n-1)
+ *   n_elts    <-- number of elements in block
+ *   elt_vtx   --> element vertices (size: n_elts*n_vtx)
+ *   elt_fam   --> element family numbers (size: n_elts)
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_element_block(const _med_input_t  *mi,
+                    med_geometry_type    geo_type,
+                    cs_gnum_t            n_g_elts,
+                    int                  n_vtx,
+                    cs_gnum_t            start_id,
+                    cs_lnum_t            n_elts,
+                    med_int              elt_vtx[],
+                    med_int              elt_fam[])
+{
+  med_filter filter = MED_FILTER_INIT;
+  med_err retval = 0;
+
+  _block_filter(mi, n_g_elts, n_vtx, start_id, n_elts, &filter);
+
+  retval = MEDmeshElementConnectivityAdvancedRd(mi->fid,
+                                                mi->mesh_name,
+                                                MED_NO_DT,
+                                                MED_NO_IT,
+                                                MED_CELL,
+                                                geo_type,
+                                                MED_NODAL,
+                                                &filter,
+                                                elt_vtx);
+
+  if (retval < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("MEDmeshElementConnectivityAdvancedRd() failed:\n"
+                "Associated mesh: \"%s\"\n"
+                "Associated MED geometrical element: \"%i\"\n"),
+              mi->mesh_name, (int)geo_type);
+
+  MEDfilterClose(&filter);
+
+  /* Family numbers are optional */
+
+  cs_gnum_t n_g_fam = _n_g_med_entities(mi, MED_CELL, geo_type,
+                                        MED_FAMILY_NUMBER);
+
+  if (n_g_fam == n_g_elts) {
+
+    _block_filter(mi, n_g_elts, 1, start_id, n_elts, &filter);
+
+    retval = MEDmeshEntityAttributeAdvancedRd(mi->fid,
+                                              mi->mesh_name,
+                                              MED_FAMILY_NUMBER,
+                                              MED_NO_DT,
+                                              MED_NO_IT,
+                                              MED_CELL,
+                                              geo_type,
+                                              &filter,
+                                              elt_fam);
+
+    if (retval < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("MEDmeshEntityAttributeAdvancedRd() failed to read "
+                  "family numbers:\n"
+                  "Associated mesh: \"%s\"\n"
+                  "Associated MED geometrical element: \"%i\"\n"),
+                mi->mesh_name, (int)geo_type);
+
+    MEDfilterClose(&filter);
+
+  }
+  else {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      elt_fam[i] = 0;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Define mesh families and groups from MED families.
+ *
+ * parameters:
+ *   mi   <-- MED input structure
+ *   mesh <-> pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_families(const _med_input_t  *mi,
+                 cs_mesh_t           *mesh)
+{
+  med_int n_fam = MEDnFamily(mi->fid, mi->mesh_name);
+
+  /* Count groups */
+
+  med_int n_max_groups = 1;
+  for (med_int i = 0; i < n_fam; i++) {
+    med_int n_fam_groups = MEDnFamilyGroup(mi->fid, mi->mesh_name, i+1);
+    n_max_groups = CS_MAX(n_max_groups, n_fam_groups);
+  }
+
+  /* Last family is used for elements with no family */
+
+  mesh->n_families = mi->n_families + 1;
+  mesh->n_max_family_items = n_max_groups;
+
+  BFT_REALLOC(mesh->family_item,
+              mesh->n_families * mesh->n_max_family_items,
+              int);
+  for (int i = 0; i < mesh->n_families * mesh->n_max_family_items; i++)
+    mesh->family_item[i] = 0;
+
+  mesh->n_groups = 0;
+  BFT_REALLOC(mesh->group_idx, 1, int);
+  mesh->group_idx[0] = 0;
+
+  char *group_names;
+  BFT_MALLOC(group_names, MED_LNAME_SIZE*n_max_groups + 1, char);
+
+  for (med_int i = 0; i < n_fam; i++) {
+
+    char fam_name[MED_NAME_SIZE + 1];
+    med_int fam_num = 0;
+    med_int n_fam_groups = MEDnFamilyGroup(mi->fid, mi->mesh_name, i+1);
+
+    MEDfamilyInfo(mi->fid, mi->mesh_name, i+1, fam_name, &fam_num,
+                  group_names);
+
+    if (fam_num >= 0)
+      continue;
+
+    int gc_id = _family_gc_id(mi, fam_num);
+
+    for (med_int j = 0; j < n_fam_groups; j++) {
+
+      char g_name[MED_LNAME_SIZE + 1];
+      strncpy(g_name, group_names + MED_LNAME_SIZE*j, MED_LNAME_SIZE);
+      g_name[MED_LNAME_SIZE] = '\0';
+      for (int k = strlen(g_name) - 1; k > -1 && g_name[k] == ' '; k--)
+        g_name[k] = '\0';
+
+      size_t l = strlen(g_name) + 1;
+      int g_start = mesh->group_idx[mesh->n_groups];
+
+      BFT_REALLOC(mesh->group_idx, mesh->n_groups + 2, int);
+      BFT_REALLOC(mesh->group, g_start + l, char);
+      strcpy(mesh->group + g_start, g_name);
+
+      mesh->group_idx[mesh->n_groups + 1] = g_start + l;
+      mesh->n_groups += 1;
+
+      mesh->family_item[mesh->n_families*j + gc_id - 1] = - mesh->n_groups;
+
+    }
+
+  }
+
+  BFT_FREE(group_names);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read mesh dimensions and group definitions from a MED file.
+ *
+ * The first mesh in the file is used. Groups are defined from
+ * the file's element families, with an additional family (the last one)
+ * used for elements belonging to no family.
+ *
+ * \param[in, out]  mesh      pointer to mesh structure
+ * \param[in, out]  mb        pointer to mesh builder structure
+ * \param[in]       filename  name of MED file
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_read_med_headers(cs_mesh_t          *mesh,
+                         cs_mesh_builder_t  *mb,
+                         const char         *filename)
+{
+  _med_input_t mi;
+
+  bft_printf(_(" Reading metadata from file: \"%s\"\n"), filename);
+
+  _med_input_open(filename, &mi);
+
+  /* Check for unhandled element types */
+
+  cs_gnum_t n_g_unhandled = _n_g_med_entities(&mi, MED_CELL, MED_POLYHEDRON,
+                                              MED_INDEX_FACE);
+  for (int i = 0; i < 6; i++)
+    n_g_unhandled += _n_g_med_entities(&mi, MED_CELL, _med_unhandled_type[i],
+                                       MED_CONNECTIVITY);
+
+  if (n_g_unhandled > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("MED file \"%s\":\n"
+                "mesh \"%s\" contains polyhedra or higher order cells,\n"
+                "which are not handled by the direct reader.\n"
+                "Use the Preprocessor for this mesh."),
+              filename, mi.mesh_name);
+
+  mesh->n_g_cells = 0;
+  for (int i = 0; i < 4; i++)
+    mesh->n_g_cells += _n_g_med_entities(&mi, MED_CELL, _med_cell_type[i],
+                                         MED_CONNECTIVITY);
+
+  mesh->n_g_vertices = _n_g_med_entities(&mi, MED_NODE, MED_NONE,
+                                         MED_COORDINATE);
+
+  /* Faces are only known once built */
+
+  mb->n_g_faces = 0;
+  mb->n_g_face_connect_size = 0;
+
+  _define_families(&mi, mesh);
+
+  _med_input_close(&mi);
+
+  bft_printf(_("   Mesh \"%s\": %llu cells, %llu vertices\n"),
+             mi.mesh_name,
+             (unsigned long long)(mesh->n_g_cells),
+             (unsigned long long)(mesh->n_g_vertices));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read mesh data from a MED file, by block.
+ *
+ * Each rank reads the vertices and cells of its block, using collective
+ * parallel I/O when MED is built with MPI support; faces are then built
+ * in parallel from the cell connectivity.
+ *
+ * Block ranges for cells and vertices must have been defined.
+ *
+ * \param[in, out]  mesh      pointer to mesh structure
+ * \param[in, out]  mb        pointer to mesh builder structure
+ * \param[in]       filename  name of MED file
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_read_med_data(cs_mesh_t          *mesh,
+                      cs_mesh_builder_t  *mb,
+                      const char         *filename)
+{
+  _med_input_t mi;
+
+  bft_printf(_(" Reading mesh from file: \"%s\"\n"), filename);
+
+  _med_input_open(filename, &mi);
+
+  /* Vertex coordinates */
+
+  {
+    cs_lnum_t n_vertices = (  mb->vertex_bi.gnum_range[1]
+                            - mb->vertex_bi.gnum_range[0]);
+
+    med_float *coords;
+    BFT_MALLOC(coords, n_vertices*mi.space_dim, med_float);
+
+    med_filter filter = MED_FILTER_INIT;
+    _block_filter(&mi,
+                  mesh->n_g_vertices,
+                  mi.space_dim,
+                  mb->vertex_bi.gnum_range[0] - 1,
+                  n_vertices,
+                  &filter);
+
+    med_err retval = MEDmeshNodeCoordinateAdvancedRd(mi.fid,
+                                                     mi.mesh_name,
+                                                     MED_NO_DT,
+                                                     MED_NO_IT,
+                                                     &filter,
+                                                     coords);
+
+    if (retval < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("MEDmeshNodeCoordinateAdvancedRd() failed to read coords.\n"
+                  "Associated mesh: \"%s\"\n"),
+                mi.mesh_name);
+
+    MEDfilterClose(&filter);
+
+    BFT_REALLOC(mb->vertex_coords, n_vertices*3, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_vertices; i++) {
+      for (med_int j = 0; j < mi.space_dim; j++)
+        mb->vertex_coords[i*3 + j] = coords[i*mi.space_dim + j];
+      for (med_int j = mi.space_dim; j < 3; j++)
+        mb->vertex_coords[i*3 + j] = 0.;
+    }
+
+    BFT_FREE(coords);
+  }
+
+  /* Cells: global numbering follows element types */
+
+  cs_lnum_t n_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+  fvm_element_t *cell_type;
+  cs_lnum_t *cell_vtx_idx;
+  cs_gnum_t *cell_vtx;
+
+  BFT_MALLOC(cell_type, n_cells, fvm_element_t);
+  BFT_MALLOC(cell_vtx_idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(cell_vtx, n_cells*8, cs_gnum_t);
+  BFT_REALLOC(mb->cell_gc_id, n_cells, int);
+
+  cell_vtx_idx[0] = 0;
+
+  {
+    cs_gnum_t t_shift = 0;
+    cs_lnum_t c_id = 0;
+
+    for (int t_id = 0; t_id < 4; t_id++) {
+
+      cs_gnum_t n_g_t_cells = _n_g_med_entities(&mi,
+                                                MED_CELL,
+                                                _med_cell_type[t_id],
+                                                MED_CONNECTIVITY);
+      if (n_g_t_cells == 0)
+        continue;
+
+      /* Intersection of type section with cell block (0-based) */
+
+      cs_gnum_t s_id = CS_MAX(mb->cell_bi.gnum_range[0] - 1, t_shift);
+      cs_gnum_t e_id = CS_MIN(mb->cell_bi.gnum_range[1] - 1,
+                              t_shift + n_g_t_cells);
+      cs_lnum_t n_t_cells = (e_id > s_id) ? e_id - s_id : 0;
+      if (n_t_cells == 0)
+        s_id = 0;
+      else
+        s_id -= t_shift;
+
+      const int n_vtx = _med_cell_n_vtx[t_id];
+      const int *perm = _med_cell_vtx_perm[t_id];
+
+      med_int *elt_vtx, *elt_fam;
+      BFT_MALLOC(elt_vtx, n_t_cells*n_vtx, med_int);
+      BFT_MALLOC(elt_fam, n_t_cells, med_int);
+
+      _read_element_block(&mi, _med_cell_type[t_id], n_g_t_cells, n_vtx,
+                          s_id, n_t_cells, elt_vtx, elt_fam);
+
+      for (cs_lnum_t i = 0; i < n_t_cells; i++) {
+        cell_type[c_id] = _fvm_cell_type[t_id];
+        for (int j = 0; j < n_vtx; j++)
+          cell_vtx[cell_vtx_idx[c_id] + j] = elt_vtx[i*n_vtx + perm[j]];
+        cell_vtx_idx[c_id+1] = cell_vtx_idx[c_id] + n_vtx;
+        mb->cell_gc_id[c_id] = _family_gc_id(&mi, elt_fam[i]);
+        c_id++;
+      }
+
+      BFT_FREE(elt_fam);
+      BFT_FREE(elt_vtx);
+
+      t_shift += n_g_t_cells;
+
+    }
+
+    assert(c_id == n_cells);
+  }
+
+  /* Boundary elements, distributed by block for each type */
+
+  cs_lnum_t n_b_faces = 0;
+  cs_lnum_t *b_face_vtx_idx;
+  cs_gnum_t *b_face_vtx = NULL;
+  int *b_face_gc_id = NULL;
+
+  BFT_MALLOC(b_face_vtx_idx, 1, cs_lnum_t);
+  b_face_vtx_idx[0] = 0;
+
+  for (int t_id = 0; t_id < 2; t_id++) {
+
+    cs_gnum_t n_g_t_faces = _n_g_med_entities(&mi,
+                                              MED_CELL,
+                                              _med_face_type[t_id],
+                                              MED_CONNECTIVITY);
+    if (n_g_t_faces == 0)
+      continue;
+
+    cs_block_dist_info_t bi
+      = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    mb->min_rank_step,
+                                    0,
+                                    n_g_t_faces);
+
+    cs_lnum_t n_t_faces = bi.gnum_range[1] - bi.gnum_range[0];
+    const int n_vtx = _med_face_n_vtx[t_id];
+
+    med_int *elt_vtx, *elt_fam;
+    BFT_MALLOC(elt_vtx, n_t_faces*n_vtx, med_int);
+    BFT_MALLOC(elt_fam, n_t_faces, med_int);
+
+    _read_element_block(&mi, _med_face_type[t_id], n_g_t_faces, n_vtx,
+                        bi.gnum_range[0] - 1, n_t_faces, elt_vtx, elt_fam);
+
+    BFT_REALLOC(b_face_vtx_idx, n_b_faces + n_t_faces + 1, cs_lnum_t);
+    BFT_REALLOC(b_face_vtx,
+                b_face_vtx_idx[n_b_faces] + n_t_faces*n_vtx,
+                cs_gnum_t);
+    BFT_REALLOC(b_face_gc_id, n_b_faces + n_t_faces, int);
+
+    for (cs_lnum_t i = 0; i < n_t_faces; i++) {
+      cs_lnum_t f_id = n_b_faces + i;
+      for (int j = 0; j < n_vtx; j++)
+        b_face_vtx[b_face_vtx_idx[f_id] + j] = elt_vtx[i*n_vtx + j];
+      b_face_vtx_idx[f_id+1] = b_face_vtx_idx[f_id] + n_vtx;
+      b_face_gc_id[f_id] = _family_gc_id(&mi, elt_fam[i]);
+    }
+
+    n_b_faces += n_t_faces;
+
+    BFT_FREE(elt_fam);
+    BFT_FREE(elt_vtx);
+
+  }
+
+  _med_input_close(&mi);
+
+  /* Build faces */
+
+  cs_mesh_face_builder_from_cells(mb,
+                                  n_cells,
+                                  cell_type,
+                                  cell_vtx_idx,
+                                  cell_vtx,
+                                  n_b_faces,
+                                  b_face_vtx_idx,
+                                  b_face_vtx,
+                                  b_face_gc_id);
+
+  BFT_FREE(b_face_gc_id);
+  BFT_FREE(b_face_vtx);
+  BFT_FREE(b_face_vtx_idx);
+  BFT_FREE(cell_vtx);
+  BFT_FREE(cell_vtx_idx);
+  BFT_FREE(cell_type);
+
+  /* Faces not matching a boundary element use the default family */
+
+  cs_lnum_t n_faces = mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0];
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    if (mb->face_gc_id[i] == 0)
+      mb->face_gc_id[i] = mesh->n_families;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
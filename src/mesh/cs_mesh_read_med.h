@@ -0,0 +1,89 @@
+#ifndef __CS_MESH_READ_MED_H__
+#define __CS_MESH_READ_MED_H__
+
+/*============================================================================
+ * Direct reading of MED meshes into a mesh builder
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public C function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read mesh dimensions and group definitions from a MED file.
+ *
+ * The first mesh in the file is used. Groups are defined from
+ * the file's element families, with an additional family (the last one)
+ * used for elements belonging to no family.
+ *
+ * \param[in, out]  mesh      pointer to mesh structure
+ * \param[in, out]  mb        pointer to mesh builder structure
+ * \param[in]       filename  name of MED file
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_read_med_headers(cs_mesh_t          *mesh,
+                         cs_mesh_builder_t  *mb,
+                         const char         *filename);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read mesh data from a MED file, by block.
+ *
+ * Each rank reads the vertices and cells of its block, using collective
+ * parallel I/O when MED is built with MPI support; faces are then built
+ * in parallel from the cell connectivity.
+ *
+ * Block ranges for cells and vertices must have been defined.
+ *
+ * \param[in, out]  mesh      pointer to mesh structure
+ * \param[in, out]  mb        pointer to mesh builder structure
+ * \param[in]       filename  name of MED file
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_read_med_data(cs_mesh_t          *mesh,
+                      cs_mesh_builder_t  *mb,
+                      const char         *filename);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_READ_MED_H__ */
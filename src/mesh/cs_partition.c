@@ -90,6 +90,7 @@ extern "C" {
 
 #include "cs_all_to_all.h"
 #include "cs_base.h"
+#include "cs_blas.h"
 #include "cs_block_dist.h"
 #include "cs_block_to_part.h"
 #include "cs_file.h"
@@ -97,9 +98,18 @@ extern "C" {
 #include "cs_log.h"
 #include "cs_mesh.h"
 #include "cs_mesh_builder.h"
+#include "cs_mesh_quantities.h"
 #include "cs_order.h"
+#include "cs_parall.h"
 #include "cs_part_to_block.h"
+#include "cs_time_step.h"
 #include "cs_timer.h"
+#include "cs_timer_stats.h"
+
+#if defined(HAVE_CUDA)
+#include "cs_base_cuda.h"
+#include "cs_blas_cuda.h"
+#endif
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -209,6 +219,22 @@ static int                        _part_n_extra_partitions = 0;
 static int                       *_part_extra_partitions_list = NULL;
 
 static bool                       _part_uniform_sfc_block_size = false;
+static bool                       _part_node_aware = false;
+
+static cs_partition_builder_weight_t  *_part_weight_func = NULL;
+static void                           *_part_weight_input = NULL;
+
+static double                    *_part_rank_fraction = NULL; /* relative
+                                                                 throughput
+                                                                 per rank */
+
+static double                     _balance_threshold = -1.;
+static int                        _balance_interval = 100;
+static int                        _balance_nt_prev = -1;
+static double                     _balance_t_prev = 0.;
+
+static cs_partition_cell_weight_t  *_balance_weight_func = NULL;
+static void                        *_balance_weight_input = NULL;
 
 #if defined(WIN32) || defined(_WIN32)
 static const char _dir_separator = '\\';
@@ -936,14 +962,329 @@ _precompute_cell_center_l(const cs_mesh_builder_t  *mb,
   BFT_FREE(weight);
 }
 
+/*----------------------------------------------------------------------------
+ * Measure the throughput of the current rank using a simple
+ * memory-bandwidth bound kernel (dot product).
+ *
+ * If a CUDA device is available for this rank, the kernel is also run on
+ * the device, and the highest throughput is returned.
+ *
+ * returns:
+ *   estimated throughput, in values per second
+ *----------------------------------------------------------------------------*/
+
+static double
+_measure_rank_speed(void)
+{
+  const cs_lnum_t n = 1 << 21;
+  const int n_runs = 10;
+
+  cs_real_t *x = NULL;
+  BFT_MALLOC(x, n, cs_real_t);
+
+# pragma omp parallel for if (n > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n; i++)
+    x[i] = 1. + (i%7)*0.1;
+
+  double s = cs_dot(n, x, x); /* warm-up */
+
+  double t0 = cs_timer_wtime();
+  for (int j = 0; j < n_runs; j++)
+    s += cs_dot(n, x, x);
+  double dt = cs_timer_wtime() - t0;
+
+  double speed = (dt > 0) ? (double)n*n_runs / dt : 1.;
+
+#if defined(HAVE_CUDA)
+
+  if (cs_base_cuda_select_default_device() > -1) {
+
+    cs_real_t *x_d = cs_base_cuda_malloc(n*sizeof(cs_real_t));
+    cs_base_cuda_copy_h2d(x_d, x, n*sizeof(cs_real_t));
+
+    s += cs_blas_cuda_dot(n, x_d, x_d); /* warm-up */
+
+    t0 = cs_timer_wtime();
+    for (int j = 0; j < n_runs; j++)
+      s += cs_blas_cuda_dot(n, x_d, x_d);
+    dt = cs_timer_wtime() - t0;
+
+    cs_base_cuda_free(x_d);
+
+    if (dt > 0)
+      speed = CS_MAX(speed, (double)n*n_runs / dt);
+
+  }
+
+#endif
+
+  BFT_FREE(x);
+
+  if (s < 0) /* never true; avoids optimizing away the kernel */
+    speed = 1.;
+
+  return speed;
+}
+
+/*----------------------------------------------------------------------------
+ * Return relative throughput fraction of each rank if defined and
+ * applicable to a given number of partitions.
+ *
+ * Rank throughput fractions only apply to partitions matching the current
+ * number of ranks (and not to extra partitions for later runs).
+ *
+ * parameters:
+ *   n_parts <-- number of partitions
+ *
+ * returns:
+ *   pointer to rank fractions (sum 1), or NULL for uniform distribution
+ *----------------------------------------------------------------------------*/
+
+static const double *
+_rank_fraction(int  n_parts)
+{
+  if (n_parts == cs_glob_n_ranks && n_parts > 1)
+    return _part_rank_fraction;
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Build upper bounds of cumulative weight for each rank.
+ *
+ * parameters:
+ *   n_ranks    <-- number of ranks in partition
+ *   r_fraction <-- throughput fraction of each rank, or NULL
+ *   w_sum      <-- total weight
+ *
+ * returns:
+ *   newly allocated cumulative weight bounds array, or NULL if
+ *   ranks have uniform throughput
+ *----------------------------------------------------------------------------*/
+
+static double *
+_rank_weight_bounds(int            n_ranks,
+                    const double   r_fraction[],
+                    double         w_sum)
+{
+  if (r_fraction == NULL)
+    return NULL;
+
+  double *w_bound = NULL;
+  BFT_MALLOC(w_bound, n_ranks, double);
+
+  double f_sum = 0;
+  for (int r = 0; r < n_ranks; r++) {
+    f_sum += r_fraction[r];
+    w_bound[r] = f_sum * w_sum;
+  }
+
+  return w_bound;
+}
+
+/*----------------------------------------------------------------------------
+ * Define element ranks by splitting a space-filling curve ordering so that
+ * each rank is assigned a similar total weight.
+ *
+ * A rank is assigned to each element based on the prefix sum of weights
+ * along the curve, evaluated at the element's mid-weight.
+ *
+ * If rank throughput fractions are given, each rank is assigned a share
+ * of the total weight proportional to its throughput instead.
+ *
+ * parameters:
+ *   n_g_elts    <-- global number of elements
+ *   n_ranks     <-- number of ranks in partition
+ *   n_elts      <-- local number of elements
+ *   sfc_num     <-- global element number along curve (1 to n)
+ *   elt_weight  <-- weight associated with each element
+ *   r_fraction  <-- throughput fraction of each rank, or NULL
+ *   elt_rank    --> element rank (0 to n-1 numbering)
+ *   comm        <-- associated MPI communicator
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+static void
+_sfc_weighted_rank(cs_gnum_t         n_g_elts,
+                   int               n_ranks,
+                   cs_lnum_t         n_elts,
+                   const cs_gnum_t   sfc_num[],
+                   const cs_real_t   elt_weight[],
+                   const double      r_fraction[],
+                   int               elt_rank[],
+                   MPI_Comm          comm)
+
+#else
+
+static void
+_sfc_weighted_rank(cs_gnum_t         n_g_elts,
+                   int               n_ranks,
+                   cs_lnum_t         n_elts,
+                   const cs_gnum_t   sfc_num[],
+                   const cs_real_t   elt_weight[],
+                   const double      r_fraction[],
+                   int               elt_rank[])
+
+#endif
+{
+  int comm_size = 1;
+
+#if defined(HAVE_MPI)
+
+  if (comm != MPI_COMM_NULL)
+    MPI_Comm_size(comm, &comm_size);
+
+  if (comm_size > 1) {
+
+    int comm_rank;
+    MPI_Comm_rank(comm, &comm_rank);
+
+    cs_datatype_t real_type = (sizeof(cs_real_t) == 8) ? CS_DOUBLE : CS_FLOAT;
+
+    /* Distribute weights by blocks in curve order */
+
+    cs_block_dist_info_t sfc_bi
+      = cs_block_dist_compute_sizes(comm_rank,
+                                    comm_size,
+                                    1,
+                                    0,
+                                    n_g_elts);
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_elts,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        sfc_num,
+                                        sfc_bi,
+                                        comm);
+
+    cs_real_t *sfc_weight = cs_all_to_all_copy_array(d,
+                                                     real_type,
+                                                     1,
+                                                     false,
+                                                     elt_weight,
+                                                     NULL);
+
+    cs_lnum_t n_sfc = cs_all_to_all_n_elts_dest(d);
+
+    /* Split curve based on cumulative weight */
+
+    double w_sum[2] = {0, 0}, w_shift = 0;
+
+    for (cs_lnum_t i = 0; i < n_sfc; i++)
+      w_sum[0] += sfc_weight[i];
+
+    MPI_Exscan(w_sum, &w_shift, 1, MPI_DOUBLE, MPI_SUM, comm);
+    MPI_Allreduce(w_sum, w_sum + 1, 1, MPI_DOUBLE, MPI_SUM, comm);
+
+    if (comm_rank == 0)
+      w_shift = 0;
+
+    double w_rank = (w_sum[1] > 0) ? w_sum[1] / n_ranks : 1;
+    double *w_bound = _rank_weight_bounds(n_ranks, r_fraction, w_sum[1]);
+
+    int *sfc_rank = NULL;
+    BFT_MALLOC(sfc_rank, n_sfc, int);
+
+    if (w_bound == NULL) {
+      for (cs_lnum_t i = 0; i < n_sfc; i++) {
+        double w_mid = w_shift + 0.5*sfc_weight[i];
+        w_shift += sfc_weight[i];
+        int r = w_mid / w_rank;
+        sfc_rank[i] = CS_MIN(r, n_ranks - 1);
+      }
+    }
+    else {
+      int r = 0;
+      for (cs_lnum_t i = 0; i < n_sfc; i++) {
+        double w_mid = w_shift + 0.5*sfc_weight[i];
+        w_shift += sfc_weight[i];
+        while (r < n_ranks - 1 && w_mid >= w_bound[r])
+          r++;
+        sfc_rank[i] = r;
+      }
+      BFT_FREE(w_bound);
+    }
+
+    BFT_FREE(sfc_weight);
+
+    /* Return ranks to initial distribution */
+
+    cs_all_to_all_copy_array(d,
+                             CS_INT_TYPE,
+                             1,
+                             true,  /* reverse */
+                             sfc_rank,
+                             elt_rank);
+
+    BFT_FREE(sfc_rank);
+
+    cs_all_to_all_destroy(&d);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (comm_size == 1) {
+
+    CS_UNUSED(n_g_elts);
+    assert((cs_gnum_t)n_elts == n_g_elts);
+
+    cs_lnum_t *sfc_order = NULL;
+    BFT_MALLOC(sfc_order, n_elts, cs_lnum_t);
+
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      sfc_order[sfc_num[i] - 1] = i;
+
+    double w_sum = 0, w_shift = 0;
+
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      w_sum += elt_weight[i];
+
+    double w_rank = (w_sum > 0) ? w_sum / n_ranks : 1;
+    double *w_bound = _rank_weight_bounds(n_ranks, r_fraction, w_sum);
+
+    if (w_bound == NULL) {
+      for (cs_lnum_t i = 0; i < n_elts; i++) {
+        cs_lnum_t j = sfc_order[i];
+        double w_mid = w_shift + 0.5*elt_weight[j];
+        w_shift += elt_weight[j];
+        int r = w_mid / w_rank;
+        elt_rank[j] = CS_MIN(r, n_ranks - 1);
+      }
+    }
+    else {
+      int r = 0;
+      for (cs_lnum_t i = 0; i < n_elts; i++) {
+        cs_lnum_t j = sfc_order[i];
+        double w_mid = w_shift + 0.5*elt_weight[j];
+        w_shift += elt_weight[j];
+        while (r < n_ranks - 1 && w_mid >= w_bound[r])
+          r++;
+        elt_rank[j] = r;
+      }
+      BFT_FREE(w_bound);
+    }
+
+    BFT_FREE(sfc_order);
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Define cell ranks using a space-filling curve.
  *
+ * If cell weights are given, the curve is split so that each rank is
+ * assigned a similar total weight; otherwise, it is split so that each
+ * rank is assigned a similar number of cells. If rank throughput
+ * fractions are defined, shares are proportional to those fractions.
+ *
  * parameters:
  *   n_g_cells   <-- global number of cells
  *   n_ranks     <-- number of ranks in partition
  *   mb          <-- pointer to mesh builder helper structure
  *   sfc_type    <-- type of space-filling curve
+ *   cell_weight <-- weight associated with each cell, or NULL
  *   cell_rank   --> cell rank (1 to n numbering)
  *   comm        <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -955,6 +1296,7 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
                   int                       n_ranks,
                   const cs_mesh_builder_t  *mb,
                   fvm_io_num_sfc_t          sfc_type,
+                  const cs_real_t           cell_weight[],
                   int                       cell_rank[],
                   MPI_Comm                  comm)
 
@@ -965,6 +1307,7 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
                   int                       n_ranks,
                   const cs_mesh_builder_t  *mb,
                   fvm_io_num_sfc_t          sfc_type,
+                  const cs_real_t           cell_weight[],
                   int                       cell_rank[])
 
 #endif
@@ -1019,7 +1362,35 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
 
   /* Determine rank based on global numbering with SFC ordering; */
 
-  if (_part_uniform_sfc_block_size == false) {
+  const double *r_fraction = _rank_fraction(n_ranks);
+
+  if (cell_weight != NULL || r_fraction != NULL) {
+
+    /* Use unit weights if only rank throughputs are non-uniform */
+
+    cs_real_t *_cell_weight = NULL;
+    const cs_real_t *c_weight = cell_weight;
+    if (c_weight == NULL) {
+      BFT_MALLOC(_cell_weight, n_cells, cs_real_t);
+      for (i = 0; i < n_cells; i++)
+        _cell_weight[i] = 1.;
+      c_weight = _cell_weight;
+    }
+
+#if defined(HAVE_MPI)
+    _sfc_weighted_rank(n_g_cells, n_ranks, n_cells, cell_num,
+                       c_weight, r_fraction, cell_rank,
+                       (cs_glob_n_ranks > 1) ? comm : MPI_COMM_NULL);
+#else
+    _sfc_weighted_rank(n_g_cells, n_ranks, n_cells, cell_num,
+                       c_weight, r_fraction, cell_rank);
+#endif
+
+    BFT_FREE(_cell_weight);
+
+  }
+
+  else if (_part_uniform_sfc_block_size == false) {
 
     cs_gnum_t cells_per_rank = n_g_cells / n_ranks;
     cs_lnum_t rmdr = n_g_cells - cells_per_rank * (cs_gnum_t)n_ranks;
@@ -1364,15 +1735,17 @@ _metis_cell_cells(size_t       n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *----------------------------------------------------------------------------*/
 
 static void
-_part_metis(size_t   n_cells,
-            int      n_parts,
-            idx_t   *cell_idx,
-            idx_t   *cell_neighbors,
-            int     *cell_part)
+_part_metis(size_t      n_cells,
+            int         n_parts,
+            idx_t      *cell_idx,
+            idx_t      *cell_neighbors,
+            const int  *cell_weight,
+            int        *cell_part)
 {
   size_t i;
   double  start_time, end_time;
@@ -1384,6 +1757,7 @@ _part_metis(size_t   n_cells,
   idx_t   _n_cells = n_cells;
   idx_t   _n_parts = n_parts;
   idx_t  *_cell_part = NULL;
+  idx_t  *_cell_weight = NULL;
 
   start_time = cs_timer_wtime();
 
@@ -1393,6 +1767,23 @@ _part_metis(size_t   n_cells,
   else
     BFT_MALLOC(_cell_part, n_cells, idx_t);
 
+  if (cell_weight != NULL) {
+    BFT_MALLOC(_cell_weight, n_cells, idx_t);
+    for (i = 0; i < n_cells; i++)
+      _cell_weight[i] = cell_weight[i];
+  }
+
+  /* Target partition weights based on rank throughput, if defined */
+
+  real_t *tpwgts = NULL;
+  const double *r_fraction = _rank_fraction(n_parts);
+
+  if (r_fraction != NULL) {
+    BFT_MALLOC(tpwgts, n_parts, real_t);
+    for (int j = 0; j < n_parts; j++)
+      tpwgts[j] = r_fraction[j];
+  }
+
   if (n_parts < 8) {
 
     bft_printf(_("\n"
@@ -1404,11 +1795,11 @@ _part_metis(size_t   n_cells,
                              &_n_constraints,
                              cell_idx,
                              cell_neighbors,
-                             NULL,       /* vwgt:   cell weights */
+                             _cell_weight, /* vwgt:   cell weights */
                              NULL,       /* vsize:  size of the vertices */
                              NULL,       /* adjwgt: face weights */
                              &_n_parts,
-                             NULL,       /* tpwgts */
+                             tpwgts,     /* tpwgts */
                              NULL,       /* ubvec: load imbalance tolerance */
                              NULL,       /* options */
                              &edgecut,
@@ -1427,11 +1818,11 @@ _part_metis(size_t   n_cells,
                         &_n_constraints,
                         cell_idx,
                         cell_neighbors,
-                        NULL,       /* vwgt:   cell weights */
+                        _cell_weight, /* vwgt:   cell weights */
                         NULL,       /* vsize:  size of the vertices */
                         NULL,       /* adjwgt: face weights */
                         &_n_parts,
-                        NULL,       /* tpwgts */
+                        tpwgts,     /* tpwgts */
                         NULL,       /* ubvec: load imbalance tolerance */
                         NULL,       /* options */
                         &edgecut,
@@ -1441,6 +1832,9 @@ _part_metis(size_t   n_cells,
 
   end_time = cs_timer_wtime();
 
+  BFT_FREE(tpwgts);
+  BFT_FREE(_cell_weight);
+
   bft_printf(_("\n"
                "  Total number of faces on parallel boundaries: %llu\n"
                "  wall-clock time: %f s\n\n"),
@@ -1471,6 +1865,7 @@ _part_metis(size_t   n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *   comm          <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -1481,6 +1876,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
                int         n_parts,
                idx_t      *cell_idx,
                idx_t      *cell_neighbors,
+               const int  *cell_weight,
                int        *cell_part,
                MPI_Comm    comm)
 {
@@ -1495,6 +1891,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
   idx_t     vtxend = cell_range[1] - 1;
   idx_t    *vtxdist = NULL;
   idx_t    *_cell_part = NULL;
+  idx_t    *_cell_weight = NULL;
   MPI_Datatype mpi_idx_t = MPI_DATATYPE_NULL;
 
   start_time = cs_timer_wtime();
@@ -1519,6 +1916,12 @@ _part_parmetis(cs_gnum_t   n_g_cells,
   else
     BFT_MALLOC(_cell_part, n_cells, idx_t);
 
+  if (cell_weight != NULL) {
+    BFT_MALLOC(_cell_weight, n_cells, idx_t);
+    for (i = 0; i < n_cells; i++)
+      _cell_weight[i] = cell_weight[i];
+  }
+
   bft_printf(_("\n"
                " Partitioning %llu cells to %d domains on %d ranks\n"
                "   (ParMETIS_V3_PartKway).\n"),
@@ -1543,20 +1946,31 @@ _part_parmetis(cs_gnum_t   n_g_cells,
     idx_t  numflag  = 0; /* 0 to n-1 numbering (C type) */
     idx_t  wgtflag  = 0; /* No weighting for faces or cells */
 
+    if (_cell_weight != NULL)
+      wgtflag = 2; /* Weights on cells only */
+
     real_t wgt = 1.0/n_parts;
     real_t ubvec[]  = {1.5};
     real_t *tpwgts = NULL;
 
+    const double *r_fraction = _rank_fraction(n_parts);
+
     BFT_MALLOC(tpwgts, n_parts, real_t);
 
-    for (j = 0; j < n_parts; j++)
-      tpwgts[j] = wgt;
+    if (r_fraction != NULL) {
+      for (j = 0; j < n_parts; j++)
+        tpwgts[j] = r_fraction[j];
+    }
+    else {
+      for (j = 0; j < n_parts; j++)
+        tpwgts[j] = wgt;
+    }
 
     int retval = ParMETIS_V3_PartKway
                    (vtxdist,
                     cell_idx,
                     cell_neighbors,
-                    NULL,       /* vwgt:   cell weights */
+                    _cell_weight, /* vwgt:   cell weights */
                     NULL,       /* adjwgt: face weights */
                     &wgtflag,
                     &numflag,
@@ -1582,6 +1996,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
   end_time = cs_timer_wtime();
 
   BFT_FREE(vtxdist);
+  BFT_FREE(_cell_weight);
 
   if (edgecut > 0)
     bft_printf(_("\n"
@@ -1857,6 +2272,51 @@ _scotch_cell_cells(size_t        n_cells,
   *cell_neighbors = _cell_neighbors;
 }
 
+/*----------------------------------------------------------------------------
+ * Build weighted complete graph target architecture for SCOTCH mapping
+ * based on rank throughput fractions, if defined.
+ *
+ * parameters:
+ *   n_parts  <-- number of partitions
+ *   archdat  --> SCOTCH target architecture (initialized if true returned)
+ *
+ * returns:
+ *   true if a weighted architecture was built, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_scotch_weighted_arch(int           n_parts,
+                      SCOTCH_Arch  *archdat)
+{
+  const double *r_fraction = _rank_fraction(n_parts);
+
+  if (r_fraction == NULL)
+    return false;
+
+  /* SCOTCH uses integer weights; scale so that 1% of a uniform share
+     is still represented. */
+
+  SCOTCH_Num *velotab = NULL;
+  BFT_MALLOC(velotab, n_parts, SCOTCH_Num);
+
+  for (int i = 0; i < n_parts; i++) {
+    double w = r_fraction[i] * n_parts * 100.;
+    velotab[i] = CS_MAX((SCOTCH_Num)(w + 0.5), 1);
+  }
+
+  SCOTCH_archInit(archdat);
+  int retval = SCOTCH_archCmpltw(archdat, n_parts, velotab);
+
+  BFT_FREE(velotab);
+
+  if (retval != 0) {
+    SCOTCH_archExit(archdat);
+    return false;
+  }
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Compute partition using SCOTCH
  *
@@ -1865,6 +2325,7 @@ _scotch_cell_cells(size_t        n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *----------------------------------------------------------------------------*/
 
@@ -1873,6 +2334,7 @@ _part_scotch(SCOTCH_Num   n_cells,
              int          n_parts,
              SCOTCH_Num  *cell_idx,
              SCOTCH_Num  *cell_neighbors,
+             const int   *cell_weight,
              int         *cell_part)
 {
   SCOTCH_Num  i;
@@ -1885,6 +2347,7 @@ _part_scotch(SCOTCH_Num   n_cells,
 
   SCOTCH_Num    edgecut = 0; /* <-- Number of faces on partition */
   SCOTCH_Num  *_cell_part = NULL;
+  SCOTCH_Num  *_cell_weight = NULL;
 
   /* Initialization */
 
@@ -1895,6 +2358,12 @@ _part_scotch(SCOTCH_Num   n_cells,
   else
     BFT_MALLOC(_cell_part, n_cells, SCOTCH_Num);
 
+  if (cell_weight != NULL) {
+    BFT_MALLOC(_cell_weight, n_cells, SCOTCH_Num);
+    for (i = 0; i < n_cells; i++)
+      _cell_weight[i] = cell_weight[i];
+  }
+
   bft_printf(_("\n"
                " Partitioning %llu cells to %d domains\n"
                "   (SCOTCH_graphPart).\n"),
@@ -1910,7 +2379,7 @@ _part_scotch(SCOTCH_Num   n_cells,
                         n_cells,            /* vertnbr */
                         cell_idx,           /* verttab */
                         NULL,               /* vendtab: verttab + 1 or NULL */
-                        NULL,               /* velotab: vertex weights */
+                        _cell_weight,       /* velotab: vertex weights */
                         NULL,               /* vlbltab; vertex labels */
                         cell_idx[n_cells],  /* edgenbr */
                         cell_neighbors,     /* edgetab */
@@ -1920,14 +2389,23 @@ _part_scotch(SCOTCH_Num   n_cells,
 
     SCOTCH_stratInit(&stradat);
 
-    if (SCOTCH_graphCheck(&grafdat) == 0)
-      retval = SCOTCH_graphPart(&grafdat, n_parts, &stradat, _cell_part);
+    if (SCOTCH_graphCheck(&grafdat) == 0) {
+      SCOTCH_Arch  archdat;
+      if (_scotch_weighted_arch(n_parts, &archdat)) {
+        retval = SCOTCH_graphMap(&grafdat, &archdat, &stradat, _cell_part);
+        SCOTCH_archExit(&archdat);
+      }
+      else
+        retval = SCOTCH_graphPart(&grafdat, n_parts, &stradat, _cell_part);
+    }
 
     SCOTCH_stratExit(&stradat);
   }
 
   SCOTCH_graphExit(&grafdat);
 
+  BFT_FREE(_cell_weight);
+
   /* Shift cell_part values to 1 to n numbering and free possible temporary */
 
   if (sizeof(SCOTCH_Num) != sizeof(int)) {
@@ -1986,6 +2464,7 @@ _part_scotch(SCOTCH_Num   n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *   comm          <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -1996,6 +2475,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
                int          n_parts,
                SCOTCH_Num  *cell_idx,
                SCOTCH_Num  *cell_neighbors,
+               const int   *cell_weight,
                int         *cell_part,
                MPI_Comm     comm)
 {
@@ -2010,6 +2490,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
 
   SCOTCH_Num    n_cells = cell_range[1] - cell_range[0];
   SCOTCH_Num  *_cell_part = NULL;
+  SCOTCH_Num  *_cell_weight = NULL;
 
   /* Initialization */
 
@@ -2022,6 +2503,12 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
   else
     BFT_MALLOC(_cell_part, n_cells, SCOTCH_Num);
 
+  if (cell_weight != NULL) {
+    BFT_MALLOC(_cell_weight, n_cells, SCOTCH_Num);
+    for (i = 0; i < n_cells; i++)
+      _cell_weight[i] = cell_weight[i];
+  }
+
   bft_printf(_("\n"
                " Partitioning %llu cells to %d domains on %d ranks\n"
                "   (SCOTCH_dgraphPart).\n"),
@@ -2039,7 +2526,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
                 n_cells,            /* vertlocmax (= vertlocnbr) */
                 cell_idx,           /* vertloctab */
                 NULL,               /* vendloctab: vertloctab + 1 or NULL */
-                NULL,               /* veloloctab: vertex weights */
+                _cell_weight,       /* veloloctab: vertex weights */
                 NULL,               /* vlblloctab; vertex labels */
                 cell_idx[n_cells],  /* edgelocnbr */
                 cell_idx[n_cells],  /* edgelocsiz */
@@ -2052,14 +2539,23 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
 
     SCOTCH_stratInit(&stradat);
 
-    if (SCOTCH_dgraphCheck(&grafdat) == 0)
-      retval = SCOTCH_dgraphPart(&grafdat, n_parts, &stradat, _cell_part);
+    if (SCOTCH_dgraphCheck(&grafdat) == 0) {
+      SCOTCH_Arch  archdat;
+      if (_scotch_weighted_arch(n_parts, &archdat)) {
+        retval = SCOTCH_dgraphMap(&grafdat, &archdat, &stradat, _cell_part);
+        SCOTCH_archExit(&archdat);
+      }
+      else
+        retval = SCOTCH_dgraphPart(&grafdat, n_parts, &stradat, _cell_part);
+    }
 
     SCOTCH_stratExit(&stradat);
   }
 
   SCOTCH_dgraphExit(&grafdat);
 
+  BFT_FREE(_cell_weight);
+
   /* Shift cell_part values to 1 to n numbering and free possible temporary */
 
   if (sizeof(SCOTCH_Num) != sizeof(int)) {
@@ -2253,6 +2749,114 @@ _prepare_input(const cs_mesh_t           *mesh,
   cell_range[1] = cell_bi.gnum_range[1];
 }
 
+#if   defined(HAVE_METIS) || defined(HAVE_PARMETIS) \
+   || defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH)
+
+/*----------------------------------------------------------------------------
+ * Build integer cell weights for graph partitioners, distributed so as
+ * to match the partitioning cell range.
+ *
+ * Weights are scaled relative to their global mean, so that a cell with
+ * mean weight has an integer weight of 100 (with a minimum of 1).
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   mb          <-- pointer to mesh builder structure
+ *   rank_step   <-- Step between active partitioning ranks
+ *                   (1 in basic case, > 1 if we seek to partition on a
+ *                   reduced number of ranks)
+ *   cell_range  <-- first and past-the-last cell numbers for this rank
+ *   cell_weight <-- weight of cells in mesh builder block distribution,
+ *                   or NULL
+ *
+ * returns:
+ *   pointer to allocated integer weights matching cell_range, or NULL
+ *----------------------------------------------------------------------------*/
+
+static int *
+_graph_cell_weights(const cs_mesh_t           *mesh,
+                    const cs_mesh_builder_t   *mb,
+                    int                        rank_step,
+                    const cs_gnum_t            cell_range[2],
+                    const cs_real_t            cell_weight[])
+{
+  if (cell_weight == NULL)
+    return NULL;
+
+  cs_lnum_t n_b_cells = 0;
+  if (mb->cell_bi.gnum_range[1] > mb->cell_bi.gnum_range[0])
+    n_b_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+  double w_sum = 0;
+  for (cs_lnum_t i = 0; i < n_b_cells; i++)
+    w_sum += cell_weight[i];
+
+  cs_parall_sum(1, CS_DOUBLE, &w_sum);
+
+  double w_scale = (w_sum > 0) ? 100. * mesh->n_g_cells / w_sum : 1.;
+
+  int *b_weight = NULL;
+  BFT_MALLOC(b_weight, n_b_cells, int);
+
+  for (cs_lnum_t i = 0; i < n_b_cells; i++) {
+    double w = cell_weight[i]*w_scale + 0.5;
+    b_weight[i] = (w > 1) ? (int)w : 1;
+  }
+
+  /* Distribute weights if necessary */
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1 && (mb->cell_bi.rank_step != rank_step)) {
+
+    cs_block_dist_info_t cell_bi
+      = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    rank_step,
+                                    0,
+                                    mesh->n_g_cells);
+
+    cs_gnum_t *global_cell_num = NULL;
+    BFT_MALLOC(global_cell_num, n_b_cells, cs_gnum_t);
+
+    for (cs_lnum_t i = 0; i < n_b_cells; i++)
+      global_cell_num[i] = mb->cell_bi.gnum_range[0] + (cs_gnum_t)i;
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_b_cells,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        global_cell_num,
+                                        cell_bi,
+                                        cs_glob_mpi_comm);
+
+    int *p_weight = cs_all_to_all_copy_array(d,
+                                             CS_INT_TYPE,
+                                             1,
+                                             false,
+                                             b_weight,
+                                             NULL);
+
+    assert(   cs_all_to_all_n_elts_dest(d)
+           == (cs_lnum_t)(cell_range[1] - cell_range[0]));
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(global_cell_num);
+    BFT_FREE(b_weight);
+
+    b_weight = p_weight;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  CS_UNUSED(cell_range);
+
+  return b_weight;
+}
+
+#endif /*    defined(HAVE_METIS) || defined(HAVE_PARMETIS) \
+          || defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH) */
+
 #if   defined(HAVE_METIS) || defined(HAVE_PARMETIS) \
    || defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH)
 
@@ -2329,20 +2933,346 @@ _distribute_output(const cs_mesh_builder_t   *mb,
           || defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH) */
 
 /*----------------------------------------------------------------------------
- * Write output file.
+ * Renumber partition ranks so as to minimize the number of faces
+ * on inter-node boundaries.
+ *
+ * Compute nodes are determined as shared-memory groups of ranks. Partition
+ * parts are viewed as vertices of a quotient graph, whose edges are
+ * weighted by the number of faces shared by parts. Parts are then grouped
+ * by locally greedy region growing on that graph, each group having the
+ * size of a node, and the parts of a group are assigned to the ranks of
+ * the matching node.
+ *
+ * This function is collective on all ranks, and does nothing if all ranks
+ * are on a single node or on separate nodes.
  *
  * parameters:
- *   n_g_cells   <-- global number of cells
- *   cell_range  <-- first and past-the-last cell numbers for this rank
- *   n_ranks     <-- number of ranks corresonding to output file
- *   domain_rank <-- domain rank array (size: n_cells)
+ *   mb         <-- pointer to mesh builder structure
+ *   cell_rank  <-> cell rank (0 to n-1 numbering, size: n_cells in
+ *                  mesh builder block distribution, for all ranks)
  *----------------------------------------------------------------------------*/
 
 static void
-_write_output(cs_gnum_t  n_g_cells,
-              cs_gnum_t  cell_range[2],
-              int        n_ranks,
-              const int  domain_rank[])
+_cell_rank_by_node(const cs_mesh_builder_t  *mb,
+                   int                       cell_rank[])
+{
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+
+  const int n_ranks = cs_glob_n_ranks;
+  MPI_Comm comm = cs_glob_mpi_comm;
+
+  /* Determine node of each rank; node leaders are the lowest ranks
+     of each shared-memory group */
+
+  int leader = cs_glob_rank_id;
+
+  MPI_Comm sh_comm;
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0,
+                      MPI_INFO_NULL, &sh_comm);
+  MPI_Bcast(&leader, 1, MPI_INT, 0, sh_comm);
+  MPI_Comm_free(&sh_comm);
+
+  int *rank_node = NULL;
+  BFT_MALLOC(rank_node, n_ranks, int);
+
+  MPI_Allgather(&leader, 1, MPI_INT, rank_node, 1, MPI_INT, comm);
+
+  int n_nodes = 0;
+  for (int r = 0; r < n_ranks; r++) {
+    if (rank_node[r] == r)
+      rank_node[r] = n_nodes++;
+    else
+      rank_node[r] = rank_node[rank_node[r]];
+  }
+
+  if (n_nodes < 2 || n_nodes == n_ranks) {
+    BFT_FREE(rank_node);
+    return;
+  }
+
+  bft_printf(_("\n Mapping partition to %d compute nodes.\n"), n_nodes);
+
+  cs_datatype_t gnum_type = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+
+  /* Query rank of cells adjacent to each interior face */
+
+  cs_lnum_t n_faces = 0;
+  if (mb->face_bi.gnum_range[1] > mb->face_bi.gnum_range[0])
+    n_faces = mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0];
+
+  cs_lnum_t n_i_faces = 0;
+  cs_gnum_t *f_cell_num = NULL;
+  BFT_MALLOC(f_cell_num, n_faces*2, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    if (mb->face_cells[i*2] > 0 && mb->face_cells[i*2+1] > 0) {
+      f_cell_num[n_i_faces*2]     = mb->face_cells[i*2];
+      f_cell_num[n_i_faces*2 + 1] = mb->face_cells[i*2+1];
+      n_i_faces++;
+    }
+  }
+
+  cs_all_to_all_t *d
+    = cs_all_to_all_create_from_block(n_i_faces*2,
+                                      0, /* flags */
+                                      f_cell_num,
+                                      mb->cell_bi,
+                                      comm);
+
+  cs_gnum_t *b_cell_num = cs_all_to_all_copy_array(d,
+                                                   gnum_type,
+                                                   1,
+                                                   false,
+                                                   f_cell_num,
+                                                   NULL);
+
+  BFT_FREE(f_cell_num);
+
+  cs_lnum_t n_b = cs_all_to_all_n_elts_dest(d);
+
+  int *b_cell_rank = NULL;
+  BFT_MALLOC(b_cell_rank, n_b, int);
+
+  for (cs_lnum_t i = 0; i < n_b; i++)
+    b_cell_rank[i] = cell_rank[b_cell_num[i] - mb->cell_bi.gnum_range[0]];
+
+  BFT_FREE(b_cell_num);
+
+  int *f_cell_rank = cs_all_to_all_copy_array(d,
+                                              CS_INT_TYPE,
+                                              1,
+                                              true,  /* reverse */
+                                              b_cell_rank,
+                                              NULL);
+
+  BFT_FREE(b_cell_rank);
+
+  cs_all_to_all_destroy(&d);
+
+  /* Local quotient graph edges, with (r0 < r1) keys */
+
+  cs_lnum_t n_edges = 0;
+  cs_gnum_t *edge_key = NULL;
+  BFT_MALLOC(edge_key, n_i_faces, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_i_faces; i++) {
+    int r0 = f_cell_rank[i*2], r1 = f_cell_rank[i*2 + 1];
+    if (r0 != r1)
+      edge_key[n_edges++] =   (cs_gnum_t)CS_MIN(r0, r1)*n_ranks
+                            + (cs_gnum_t)CS_MAX(r0, r1);
+  }
+
+  BFT_FREE(f_cell_rank);
+
+  /* Gather edges on rank 0 */
+
+  int l_count = n_edges;
+  int *g_count = NULL, *g_displ = NULL;
+  cs_gnum_t *g_edge_key = NULL;
+
+  if (cs_glob_rank_id == 0) {
+    BFT_MALLOC(g_count, n_ranks, int);
+    BFT_MALLOC(g_displ, n_ranks + 1, int);
+  }
+
+  MPI_Gather(&l_count, 1, MPI_INT, g_count, 1, MPI_INT, 0, comm);
+
+  if (cs_glob_rank_id == 0) {
+    g_displ[0] = 0;
+    for (int r = 0; r < n_ranks; r++)
+      g_displ[r+1] = g_displ[r] + g_count[r];
+    BFT_MALLOC(g_edge_key, g_displ[n_ranks], cs_gnum_t);
+  }
+
+  MPI_Gatherv(edge_key, l_count, CS_MPI_GNUM,
+              g_edge_key, g_count, g_displ, CS_MPI_GNUM, 0, comm);
+
+  BFT_FREE(edge_key);
+
+  int *part_rank = NULL;
+  BFT_MALLOC(part_rank, n_ranks, int);
+
+  if (cs_glob_rank_id == 0) {
+
+    cs_lnum_t n_g_edges = g_displ[n_ranks];
+
+    BFT_FREE(g_count);
+    BFT_FREE(g_displ);
+
+    /* Build part -> parts adjacency, with face count weights */
+
+    cs_lnum_t *order = cs_order_gnum(NULL, g_edge_key, n_g_edges);
+
+    cs_lnum_t *p_idx = NULL;
+    BFT_MALLOC(p_idx, n_ranks + 1, cs_lnum_t);
+    for (int r = 0; r < n_ranks + 1; r++)
+      p_idx[r] = 0;
+
+    cs_lnum_t n_u_edges = 0;
+    for (cs_lnum_t i = 0; i < n_g_edges; i++) {
+      cs_gnum_t k = g_edge_key[order[i]];
+      if (i == 0 || k != g_edge_key[order[i-1]]) {
+        p_idx[k / n_ranks + 1] += 1;
+        p_idx[k % n_ranks + 1] += 1;
+        n_u_edges++;
+      }
+    }
+
+    for (int r = 0; r < n_ranks; r++)
+      p_idx[r+1] += p_idx[r];
+
+    int *p_adj = NULL;
+    cs_lnum_t *p_adj_w = NULL, *p_count = NULL;
+    BFT_MALLOC(p_adj, n_u_edges*2, int);
+    BFT_MALLOC(p_adj_w, n_u_edges*2, cs_lnum_t);
+    BFT_MALLOC(p_count, n_ranks, cs_lnum_t);
+
+    for (int r = 0; r < n_ranks; r++)
+      p_count[r] = 0;
+
+    for (cs_lnum_t i = 0; i < n_g_edges; ) {
+      cs_gnum_t k = g_edge_key[order[i]];
+      cs_lnum_t w = 0;
+      while (i < n_g_edges && g_edge_key[order[i]] == k) {
+        w++;
+        i++;
+      }
+      int r0 = k / n_ranks, r1 = k % n_ranks;
+      cs_lnum_t j0 = p_idx[r0] + p_count[r0]++;
+      cs_lnum_t j1 = p_idx[r1] + p_count[r1]++;
+      p_adj[j0] = r1; p_adj_w[j0] = w;
+      p_adj[j1] = r0; p_adj_w[j1] = w;
+    }
+
+    BFT_FREE(order);
+    BFT_FREE(g_edge_key);
+
+    /* Ranks of each node, in increasing order */
+
+    int *node_idx = NULL, *node_ranks = NULL;
+    BFT_MALLOC(node_idx, n_nodes + 1, int);
+    BFT_MALLOC(node_ranks, n_ranks, int);
+
+    for (int n = 0; n < n_nodes + 1; n++)
+      node_idx[n] = 0;
+    for (int r = 0; r < n_ranks; r++)
+      node_idx[rank_node[r] + 1] += 1;
+    for (int n = 0; n < n_nodes; n++)
+      node_idx[n+1] += node_idx[n];
+    for (int n = 0; n < n_nodes; n++)
+      p_count[n] = 0;
+    for (int r = 0; r < n_ranks; r++) {
+      int n = rank_node[r];
+      node_ranks[node_idx[n] + p_count[n]] = r;
+      p_count[n] += 1;
+    }
+
+    /* Group parts by greedy region growing: the unassigned part most
+       connected to the current group is added first, or the lowest
+       numbered unassigned part if none is connected */
+
+    cs_lnum_t *gain = p_count;
+    int *frontier = NULL;
+    BFT_MALLOC(frontier, n_ranks, int);
+
+    for (int r = 0; r < n_ranks; r++) {
+      part_rank[r] = -1;
+      gain[r] = -1;
+    }
+
+    int next_seed = 0;
+
+    for (int n = 0; n < n_nodes; n++) {
+
+      int n_frontier = 0;
+
+      for (int k = node_idx[n]; k < node_idx[n+1]; k++) {
+
+        int p = -1;
+        cs_lnum_t g_max = 0;
+
+        for (int j = 0; j < n_frontier; j++) {
+          int q = frontier[j];
+          if (part_rank[q] < 0 && gain[q] > g_max) {
+            g_max = gain[q];
+            p = q;
+          }
+        }
+
+        if (p < 0) {
+          while (part_rank[next_seed] > -1)
+            next_seed++;
+          p = next_seed;
+        }
+
+        part_rank[p] = node_ranks[k];
+
+        for (cs_lnum_t j = p_idx[p]; j < p_idx[p+1]; j++) {
+          int q = p_adj[j];
+          if (part_rank[q] < 0) {
+            if (gain[q] < 0) {
+              gain[q] = 0;
+              frontier[n_frontier++] = q;
+            }
+            gain[q] += p_adj_w[j];
+          }
+        }
+
+      }
+
+      for (int j = 0; j < n_frontier; j++)
+        gain[frontier[j]] = -1;
+
+    }
+
+    BFT_FREE(frontier);
+    BFT_FREE(node_ranks);
+    BFT_FREE(node_idx);
+    BFT_FREE(p_count);
+    BFT_FREE(p_adj_w);
+    BFT_FREE(p_adj);
+    BFT_FREE(p_idx);
+
+  }
+
+  BFT_FREE(rank_node);
+
+  MPI_Bcast(part_rank, n_ranks, MPI_INT, 0, comm);
+
+  /* Apply renumbering */
+
+  cs_lnum_t n_cells = 0;
+  if (mb->cell_bi.gnum_range[1] > mb->cell_bi.gnum_range[0])
+    n_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_rank[i] = part_rank[cell_rank[i]];
+
+  BFT_FREE(part_rank);
+
+#else
+
+  CS_UNUSED(mb);
+  CS_UNUSED(cell_rank);
+
+#endif /* defined(HAVE_MPI) && (MPI_VERSION >= 3) */
+}
+
+/*----------------------------------------------------------------------------
+ * Write output file.
+ *
+ * parameters:
+ *   n_g_cells   <-- global number of cells
+ *   cell_range  <-- first and past-the-last cell numbers for this rank
+ *   n_ranks     <-- number of ranks corresonding to output file
+ *   domain_rank <-- domain rank array (size: n_cells)
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_output(cs_gnum_t  n_g_cells,
+              cs_gnum_t  cell_range[2],
+              int        n_ranks,
+              const int  domain_rank[])
 {
   size_t i;
   int n_ranks_size;
@@ -2968,6 +3898,27 @@ cs_partition_set_write_level(int  write_flag)
   _part_write_output = write_flag;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate compute node awareness for the main
+ *        partitioning stage.
+ *
+ * When active, the parts of a partitioning on all ranks are mapped to
+ * ranks so that parts sharing many faces are assigned to ranks of the
+ * same compute node (i.e. shared-memory group), using a greedy grouping
+ * of the parts adjacency graph. This reduces the volume of inter-node
+ * halo exchanges, without modifying the parts themselves.
+ *
+ * \param[in]  node_aware  true to activate, false to deactivate (default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_node_aware(bool  node_aware)
+{
+  _part_node_aware = node_aware;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define hints indicating if initial partitioning fo a preprocessing
@@ -3073,6 +4024,93 @@ cs_partition_add_partitions(int  n_extra_partitions,
            sizeof(int)*n_extra_partitions);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a function providing cell weights for the main
+ *        partitioning stage.
+ *
+ * Weights may for example represent the relative cost of cells based on
+ * their type or local physical models. When defined, space-filling curve
+ * partitionings are split so that each rank is assigned a similar total
+ * weight, and weights are passed to graph partitioners as vertex weights.
+ * They are ignored by the naive block partitioning.
+ *
+ * The function is called with cells in the mesh builder block
+ * distribution, that is for global cell numbers in the
+ * [mb->cell_bi.gnum_range[0], mb->cell_bi.gnum_range[1][ range.
+ *
+ * \param[in]  weight_func   cell weight function, or NULL for unweighted
+ *                           partitioning
+ * \param[in]  weight_input  pointer to optional (untyped) value or
+ *                           structure passed to weight_func
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weights(cs_partition_builder_weight_t  *weight_func,
+                              void                           *weight_input)
+{
+  _part_weight_func = weight_func;
+  _part_weight_input = weight_input;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the relative speed (throughput) of the current rank, so
+ *        that partitionings assign to each rank a share of cells
+ *        proportional to its speed.
+ *
+ * This is useful for heterogeneous runs, in which some ranks drive
+ * accelerators while others are CPU-only.
+ *
+ * If \c speed is <= 0, it is measured using a short dot product kernel,
+ * on the CUDA device associated to this rank if available.
+ * User-defined and measured speeds should not be mixed across ranks.
+ *
+ * Rank speeds apply to SFC, METIS and SCOTCH-based partitionings done
+ * up to the main partitioning stage (but not to extra partitionings
+ * for a different number of ranks).
+ *
+ * This function is collective on all ranks.
+ *
+ * \param[in]  speed  relative speed of the current rank, or <= 0 to
+ *                    measure it
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_rank_speed(double  speed)
+{
+  BFT_FREE(_part_rank_fraction);
+
+  if (cs_glob_n_ranks < 2)
+    return;
+
+  if (speed <= 0)
+    speed = _measure_rank_speed();
+
+  BFT_MALLOC(_part_rank_fraction, cs_glob_n_ranks, double);
+
+#if defined(HAVE_MPI)
+  MPI_Allgather(&speed, 1, MPI_DOUBLE,
+                _part_rank_fraction, 1, MPI_DOUBLE,
+                cs_glob_mpi_comm);
+#endif
+
+  double s_sum = 0, s_min = _part_rank_fraction[0], s_max = s_min;
+  for (int i = 0; i < cs_glob_n_ranks; i++) {
+    s_sum += _part_rank_fraction[i];
+    s_min = CS_MIN(s_min, _part_rank_fraction[i]);
+    s_max = CS_MAX(s_max, _part_rank_fraction[i]);
+  }
+
+  for (int i = 0; i < cs_glob_n_ranks; i++)
+    _part_rank_fraction[i] /= s_sum;
+
+  bft_printf(_("\n Partitioning rank speeds: min/max ratio %.3g\n"),
+             (s_max > 0) ? s_min / s_max : 1.);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Partition mesh based on current options.
@@ -3095,6 +4133,7 @@ cs_partition(cs_mesh_t             *mesh,
   cs_partition_algorithm_t _algorithm = _select_algorithm(stage);
 
   bool write_output = false;
+  bool node_aware = false;
   int  n_extra_partitions = 0;
 
   int  *cell_part = NULL;
@@ -3114,6 +4153,7 @@ cs_partition(cs_mesh_t             *mesh,
     else if (_part_write_output > 1)
       write_output = true;
     n_extra_partitions = _part_n_extra_partitions;
+    node_aware = _part_node_aware;
   }
 
   if (n_part_ranks < 1)
@@ -3130,8 +4170,11 @@ cs_partition(cs_mesh_t             *mesh,
     if (   stage != CS_PARTITION_MAIN
         || cs_partition_get_preprocess() == false) {
       _read_cell_rank(mesh, mb, CS_IO_ECHO_OPEN_CLOSE);
-      if (mb->have_cell_rank)
+      if (mb->have_cell_rank) {
+        if (stage == CS_PARTITION_MAIN)
+          BFT_FREE(_part_rank_fraction);
         return;
+      }
     }
   }
   else { /* if (cs_glob_n_ranks == 1) */
@@ -3153,6 +4196,22 @@ cs_partition(cs_mesh_t             *mesh,
 
   t0 = cs_timer_time();
 
+  /* User-defined cell weights, in mesh builder block distribution */
+
+  cs_real_t  *cell_weight = NULL;
+
+  if (stage == CS_PARTITION_MAIN && _part_weight_func != NULL) {
+    cs_lnum_t n_b_cells = 0;
+    if (mb->cell_bi.gnum_range[1] > mb->cell_bi.gnum_range[0])
+      n_b_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+    BFT_MALLOC(cell_weight, n_b_cells, cs_real_t);
+    _part_weight_func(_part_weight_input, mesh, mb, cell_weight);
+    bft_printf(_("\n Using user-defined cell weights.\n"));
+  }
+
+  if (_part_rank_fraction != NULL)
+    bft_printf(_("\n Using rank speed weights.\n"));
+
   /* Adapt builder data for partitioning */
 
   if (_algorithm == CS_PARTITION_METIS || _algorithm == CS_PARTITION_SCOTCH) {
@@ -3185,6 +4244,12 @@ cs_partition(cs_mesh_t             *mesh,
     cs_timer_t  t2;
     idx_t  *cell_idx = NULL, *cell_neighbors = NULL;
 
+    int  *g_cell_weight = _graph_cell_weights(mesh,
+                                              mb,
+                                              _part_rank_step[stage],
+                                              cell_range,
+                                              cell_weight);
+
     _metis_cell_cells(n_cells,
                       n_faces,
                       cell_range[0],
@@ -3234,6 +4299,7 @@ cs_partition(cs_mesh_t             *mesh,
                          n_ranks,
                          cell_idx,
                          cell_neighbors,
+                         g_cell_weight,
                          cell_part,
                          part_comm);
 
@@ -3242,6 +4308,9 @@ cs_partition(cs_mesh_t             *mesh,
                            cell_range,
                            &cell_part);
 
+        if (node_aware && n_ranks == cs_glob_n_ranks)
+          _cell_rank_by_node(mb, cell_part);
+
         _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
         if (write_output || i < n_extra_partitions)
@@ -3281,6 +4350,7 @@ cs_partition(cs_mesh_t             *mesh,
                       n_ranks,
                       cell_idx,
                       cell_neighbors,
+                      g_cell_weight,
                       cell_part);
 
         _distribute_output(mb,
@@ -3288,6 +4358,9 @@ cs_partition(cs_mesh_t             *mesh,
                            cell_range,
                            &cell_part);
 
+        if (node_aware && n_ranks == cs_glob_n_ranks)
+          _cell_rank_by_node(mb, cell_part);
+
         _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
         if (write_output || i < n_extra_partitions)
@@ -3298,6 +4371,7 @@ cs_partition(cs_mesh_t             *mesh,
       }
     }
 
+    BFT_FREE(g_cell_weight);
     BFT_FREE(cell_idx);
     BFT_FREE(cell_neighbors);
   }
@@ -3312,6 +4386,12 @@ cs_partition(cs_mesh_t             *mesh,
     cs_timer_t  t2;
     SCOTCH_Num  *cell_idx = NULL, *cell_neighbors = NULL;
 
+    int  *g_cell_weight = _graph_cell_weights(mesh,
+                                              mb,
+                                              _part_rank_step[stage],
+                                              cell_range,
+                                              cell_weight);
+
     _scotch_cell_cells(n_cells,
                        n_faces,
                        cell_range[0],
@@ -3361,6 +4441,7 @@ cs_partition(cs_mesh_t             *mesh,
                          n_ranks,
                          cell_idx,
                          cell_neighbors,
+                         g_cell_weight,
                          cell_part,
                          part_comm);
 
@@ -3369,6 +4450,9 @@ cs_partition(cs_mesh_t             *mesh,
                            cell_range,
                            &cell_part);
 
+        if (node_aware && n_ranks == cs_glob_n_ranks)
+          _cell_rank_by_node(mb, cell_part);
+
         _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
         if (write_output || i < n_extra_partitions)
@@ -3408,6 +4492,7 @@ cs_partition(cs_mesh_t             *mesh,
                        n_ranks,
                        cell_idx,
                        cell_neighbors,
+                       g_cell_weight,
                        cell_part);
 
         _distribute_output(mb,
@@ -3415,6 +4500,9 @@ cs_partition(cs_mesh_t             *mesh,
                            cell_range,
                            &cell_part);
 
+        if (node_aware && n_ranks == cs_glob_n_ranks)
+          _cell_rank_by_node(mb, cell_part);
+
         _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
         if (write_output || i < n_extra_partitions)
@@ -3425,6 +4513,7 @@ cs_partition(cs_mesh_t             *mesh,
       }
     }
 
+    BFT_FREE(g_cell_weight);
     BFT_FREE(cell_idx);
     BFT_FREE(cell_neighbors);
   }
@@ -3459,12 +4548,17 @@ cs_partition(cs_mesh_t             *mesh,
                         n_ranks,
                         mb,
                         sfc_type,
+                        cell_weight,
                         cell_part,
                         cs_glob_mpi_comm);
 #else
-      _cell_rank_by_sfc(mesh->n_g_cells, n_ranks, mb, sfc_type, cell_part);
+      _cell_rank_by_sfc(mesh->n_g_cells, n_ranks, mb, sfc_type,
+                        cell_weight, cell_part);
 #endif
 
+      if (node_aware && n_ranks == cs_glob_n_ranks)
+        _cell_rank_by_node(mb, cell_part);
+
       _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
       if (write_output || i < n_extra_partitions)
@@ -3486,6 +4580,8 @@ cs_partition(cs_mesh_t             *mesh,
 
   }
 
+  BFT_FREE(cell_weight);
+
   /* Reset extra partitions list if used */
 
   if (n_extra_partitions > 0) {
@@ -3493,6 +4589,11 @@ cs_partition(cs_mesh_t             *mesh,
     _part_n_extra_partitions = 0;
   }
 
+  /* Rank speeds are not needed after the main stage */
+
+  if (stage == CS_PARTITION_MAIN)
+    BFT_FREE(_part_rank_fraction);
+
   /* Copy to mesh builder */
 
   mb->have_cell_rank = true;
@@ -3518,6 +4619,257 @@ cs_partition(cs_mesh_t             *mesh,
   cs_log_separator(CS_LOG_PERFORMANCE);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a cell-weighted partitioning of the current mesh, and
+ *        write it to file for use by a subsequent calculation.
+ *
+ * Cells are ordered along the space-filling curve used by the main
+ * partitioning stage (or a Morton curve if a graph-based partitioner is
+ * used), and the curve is split so that each rank is assigned a similar
+ * total weight.
+ *
+ * The resulting "partition_output/domain_number_<n_ranks>" file may be
+ * used as partition input for a restart on the same number of ranks,
+ * as long as the mesh global cell numbering does not change (i.e. when
+ * restarting from the checkpoint mesh or from an unmodified mesh).
+ *
+ * This function is collective on all ranks, and does nothing in
+ * serial mode.
+ *
+ * \param[in]  mesh         pointer to mesh structure
+ * \param[in]  cell_center  cell centers (size: mesh->n_cells*3)
+ * \param[in]  cell_weight  positive weight associated with each cell
+ *                          (size: mesh->n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_write_weighted(const cs_mesh_t  *mesh,
+                            const cs_real_t   cell_center[],
+                            const cs_real_t   cell_weight[])
+{
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks < 2)
+    return;
+
+  const int n_ranks = cs_glob_n_ranks;
+  const cs_lnum_t n_cells = mesh->n_cells;
+
+  int rank_step = 1;
+  cs_file_get_default_comm(&rank_step, NULL, NULL);
+
+  cs_partition_algorithm_t _algorithm = _select_algorithm(CS_PARTITION_MAIN);
+
+  fvm_io_num_sfc_t sfc_type = FVM_IO_NUM_SFC_MORTON_BOX;
+  if (   _algorithm >= CS_PARTITION_SFC_MORTON_BOX
+      && _algorithm <= CS_PARTITION_SFC_HILBERT_CUBE)
+    sfc_type = _algorithm - CS_PARTITION_SFC_MORTON_BOX;
+
+  bft_printf(_("\n Weighted partitioning by space-filling curve: %s.\n"),
+             _(fvm_io_num_sfc_type_name[sfc_type]));
+
+  /* Order cells along space-filling curve */
+
+  cs_coord_t *_cell_center = NULL;
+  BFT_MALLOC(_cell_center, n_cells*3, cs_coord_t);
+
+  for (cs_lnum_t i = 0; i < n_cells*3; i++)
+    _cell_center[i] = cell_center[i];
+
+  fvm_io_num_t *sfc_io_num
+    = fvm_io_num_create_from_sfc(_cell_center, 3, n_cells, sfc_type);
+
+  BFT_FREE(_cell_center);
+
+  /* Split curve based on cumulative weight */
+
+  int *sfc_rank = NULL;
+  BFT_MALLOC(sfc_rank, n_cells, int);
+
+  _sfc_weighted_rank(mesh->n_g_cells,
+                     n_ranks,
+                     n_cells,
+                     fvm_io_num_get_global_num(sfc_io_num),
+                     cell_weight,
+                     NULL,  /* measured costs already include rank speed */
+                     sfc_rank,
+                     cs_glob_mpi_comm);
+
+  sfc_io_num = fvm_io_num_destroy(sfc_io_num);
+
+  /* Distribute ranks by blocks in cell number order for output */
+
+  cs_block_dist_info_t cell_bi
+    = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                  n_ranks,
+                                  rank_step,
+                                  0,
+                                  mesh->n_g_cells);
+
+  cs_all_to_all_t *d
+    = cs_all_to_all_create_from_block(n_cells,
+                                      CS_ALL_TO_ALL_USE_DEST_ID,
+                                      mesh->global_cell_num,
+                                      cell_bi,
+                                      cs_glob_mpi_comm);
+
+  int *cell_rank = cs_all_to_all_copy_array(d,
+                                            CS_INT_TYPE,
+                                            1,
+                                            false,
+                                            sfc_rank,
+                                            NULL);
+
+  cs_all_to_all_destroy(&d);
+
+  BFT_FREE(sfc_rank);
+
+  _cell_part_histogram(cell_bi.gnum_range, n_ranks, cell_rank);
+
+  _write_output(mesh->n_g_cells, cell_bi.gnum_range, n_ranks, cell_rank);
+
+  BFT_FREE(cell_rank);
+
+#else
+
+  CS_UNUSED(mesh);
+  CS_UNUSED(cell_center);
+  CS_UNUSED(cell_weight);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the runtime load balance check for the computation stage.
+ *
+ * When the ratio of the maximum to mean cost per rank exceeds the given
+ * threshold, a partitioning of the mesh in which each cell is weighted
+ * by its estimated cost is written to
+ * "partition_output/domain_number_<n_ranks>" (see
+ * \ref cs_partition_write_weighted). That file may be used as partition
+ * input for a restart on the same number of ranks.
+ *
+ * If no weight function is given, the cost of each rank is its compute
+ * time (i.e. excluding time spent waiting on MPI communication) since
+ * the previous check, as measured by the timer statistics, distributed
+ * uniformly over its cells.
+ *
+ * The load balance is checked at most once every \c interval time steps.
+ * No check is done in serial mode or when the threshold is <= 0
+ * (the default).
+ *
+ * \param[in]  imbalance_threshold  cost imbalance ratio threshold
+ * \param[in]  interval             minimum number of time steps between
+ *                                  successive checks
+ * \param[in]  weight_func          cell weight function, or NULL
+ * \param[in]  weight_input         pointer to optional (untyped) value or
+ *                                  structure passed to weight_func
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_load_balance(double                        imbalance_threshold,
+                              int                           interval,
+                              cs_partition_cell_weight_t   *weight_func,
+                              void                         *weight_input)
+{
+  _balance_threshold = imbalance_threshold;
+  _balance_interval = interval;
+  _balance_weight_func = weight_func;
+  _balance_weight_input = weight_input;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check the runtime load balance of the computation stage, and
+ *        write a cost-weighted partitioning if it is above the threshold
+ *        defined by \ref cs_partition_set_load_balance.
+ *
+ * This function is collective on all ranks, and should be called at
+ * the end of each time step.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_check_load_balance(void)
+{
+  if (_balance_threshold <= 0 || cs_glob_n_ranks < 2)
+    return;
+
+  const int nt_cur = cs_glob_time_step->nt_cur;
+  const int stats_id = cs_timer_stats_id_by_name("operations");
+
+  /* Initialize reference time on first call */
+
+  if (_balance_nt_prev < 0) {
+    _balance_nt_prev = nt_cur;
+    _balance_t_prev = cs_timer_stats_get_compute_time(stats_id);
+    if (_balance_weight_func == NULL)
+      return;
+  }
+  else if (nt_cur < _balance_nt_prev + _balance_interval)
+    return;
+
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_lnum_t  n_cells = mesh->n_cells;
+
+  cs_real_t  *cell_weight = NULL;
+  BFT_MALLOC(cell_weight, n_cells, cs_real_t);
+
+  /* Cell weights: user-defined, or measured compute time per cell */
+
+  double t_cur = cs_timer_stats_get_compute_time(stats_id);
+
+  if (_balance_weight_func != NULL)
+    _balance_weight_func(_balance_weight_input, mesh, cell_weight);
+
+  else {
+    double c_weight = (n_cells > 0) ? (t_cur - _balance_t_prev) / n_cells : 0;
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      cell_weight[c_id] = c_weight;
+  }
+
+  _balance_nt_prev = nt_cur;
+  _balance_t_prev = t_cur;
+
+  /* Imbalance ratio: maximum to mean cost per rank */
+
+  double w_rank[2] = {0, 0};
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    w_rank[0] += cell_weight[c_id];
+
+  w_rank[1] = w_rank[0];
+
+  cs_parall_sum(1, CS_DOUBLE, w_rank);
+  cs_parall_max(1, CS_DOUBLE, w_rank + 1);
+
+  if (w_rank[0] > 0) {
+
+    double imbalance = w_rank[1] * cs_glob_n_ranks / w_rank[0];
+
+    if (imbalance > _balance_threshold) {
+
+      bft_printf(_("\n Load imbalance (max/mean cost per rank): %g\n"
+                   " (threshold %g); writing cost-weighted partitioning,\n"
+                   " which may be used for a restart\n"),
+                 imbalance, _balance_threshold);
+
+      cs_partition_write_weighted(mesh,
+                                  cs_glob_mesh_quantities->cell_cen,
+                                  cell_weight);
+
+    }
+
+  }
+
+  BFT_FREE(cell_weight);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -115,6 +115,42 @@ typedef enum {
 
 } cs_partition_algorithm_t;
 
+/*----------------------------------------------------------------------------
+ * Function pointer for definition of cell weights used for partitioning.
+ *
+ * Cells are defined in the mesh builder block distribution, that is for
+ * global cell numbers in [mb->cell_bi.gnum_range[0], gnum_range[1][.
+ *
+ * parameters:
+ *   input       <-> pointer to optional (untyped) value or structure
+ *   mesh        <-- pointer to mesh structure
+ *   mb          <-- pointer to mesh builder structure
+ *   cell_weight --> positive weight associated with each cell
+ *                   (size: mb->cell_bi.gnum_range[1] - gnum_range[0])
+ *----------------------------------------------------------------------------*/
+
+typedef void
+(cs_partition_builder_weight_t) (void                     *input,
+                                 const cs_mesh_t          *mesh,
+                                 const cs_mesh_builder_t  *mb,
+                                 cs_real_t                 cell_weight[]);
+
+/*----------------------------------------------------------------------------
+ * Function pointer for definition of cell weights used for runtime
+ * load balance checks.
+ *
+ * parameters:
+ *   input       <-> pointer to optional (untyped) value or structure
+ *   mesh        <-- pointer to mesh structure
+ *   cell_weight --> positive weight associated with each cell
+ *                   (size: mesh->n_cells)
+ *----------------------------------------------------------------------------*/
+
+typedef void
+(cs_partition_cell_weight_t) (void              *input,
+                              const cs_mesh_t   *mesh,
+                              cs_real_t          cell_weight[]);
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -169,6 +205,21 @@ cs_partition_set_algorithm(cs_partition_stage_t      stage,
 void
 cs_partition_set_write_level(int  write_flag);
 
+/*----------------------------------------------------------------------------
+ * Activate or deactivate compute node awareness for the main
+ * partitioning stage.
+ *
+ * When active, the parts of a partitioning on all ranks are mapped to
+ * ranks so that parts sharing many faces are assigned to ranks of the
+ * same compute node (i.e. shared-memory group).
+ *
+ * parameters:
+ *   node_aware <-- true to activate, false to deactivate (default)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_node_aware(bool  node_aware);
+
 /*----------------------------------------------------------------------------
  * Define hints indicating if initial partitioning fo a preprocessing
  * stage is required.
@@ -224,6 +275,41 @@ void
 cs_partition_add_partitions(int  n_extra_partitions,
                             int  extra_partitions_list[]);
 
+/*----------------------------------------------------------------------------
+ * Define a function providing cell weights for the main partitioning stage.
+ *
+ * When defined, space-filling curve partitionings are split so that each
+ * rank is assigned a similar total weight, and weights are passed to graph
+ * partitioners as vertex weights.
+ *
+ * parameters:
+ *   weight_func  <-- cell weight function, or NULL for unweighted
+ *                    partitioning
+ *   weight_input <-- pointer to optional (untyped) value or structure
+ *                    passed to weight_func
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weights(cs_partition_builder_weight_t  *weight_func,
+                              void                           *weight_input);
+
+/*----------------------------------------------------------------------------
+ * Define the relative speed (throughput) of the current rank, so that
+ * partitionings assign to each rank a share of cells proportional to
+ * its speed.
+ *
+ * If speed is <= 0, it is measured using a short dot product kernel,
+ * on the CUDA device associated to this rank if available.
+ *
+ * This function is collective on all ranks.
+ *
+ * parameters:
+ *   speed <-- relative speed of the current rank, or <= 0 to measure it
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_rank_speed(double  speed);
+
 /*----------------------------------------------------------------------------
  * Compute partitioning for a given mesh.
  *
@@ -238,6 +324,71 @@ cs_partition(cs_mesh_t             *mesh,
              cs_mesh_builder_t     *mesh_builder,
              cs_partition_stage_t   stage);
 
+/*----------------------------------------------------------------------------
+ * Compute a cell-weighted partitioning of the current mesh, and write it
+ * to file for use by a subsequent calculation.
+ *
+ * Cells are ordered along the space-filling curve used by the main
+ * partitioning stage (or a Morton curve if a graph-based partitioner is
+ * used), and the curve is split so that each rank is assigned a similar
+ * total weight.
+ *
+ * The resulting "partition_output/domain_number_<n_ranks>" file may be
+ * used as partition input for a restart on the same number of ranks,
+ * as long as the mesh global cell numbering does not change.
+ *
+ * This function is collective on all ranks, and does nothing in
+ * serial mode.
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   cell_center <-- cell centers (size: mesh->n_cells*3)
+ *   cell_weight <-- positive weight associated with each cell
+ *                   (size: mesh->n_cells)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_write_weighted(const cs_mesh_t  *mesh,
+                            const cs_real_t   cell_center[],
+                            const cs_real_t   cell_weight[]);
+
+/*----------------------------------------------------------------------------
+ * Define the runtime load balance check for the computation stage.
+ *
+ * When the ratio of the maximum to mean cost per rank exceeds the given
+ * threshold, a partitioning of the mesh in which each cell is weighted
+ * by its estimated cost is written to
+ * "partition_output/domain_number_<n_ranks>". That file may be used as
+ * partition input for a restart on the same number of ranks.
+ *
+ * If no weight function is given, the cost of each rank is its compute
+ * time since the previous check, distributed uniformly over its cells.
+ *
+ * parameters:
+ *   imbalance_threshold <-- cost imbalance ratio threshold (<= 0 to disable)
+ *   interval            <-- minimum number of time steps between checks
+ *   weight_func         <-- cell weight function, or NULL
+ *   weight_input        <-- pointer to optional (untyped) value or
+ *                           structure passed to weight_func
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_load_balance(double                        imbalance_threshold,
+                              int                           interval,
+                              cs_partition_cell_weight_t   *weight_func,
+                              void                         *weight_input);
+
+/*----------------------------------------------------------------------------
+ * Check the runtime load balance of the computation stage, and write
+ * a cost-weighted partitioning if it is above the defined threshold.
+ *
+ * This function is collective on all ranks, and should be called at
+ * the end of each time step.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_check_load_balance(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
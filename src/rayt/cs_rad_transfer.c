@@ -63,6 +63,9 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_rad_transfer.h"
+#include "cs_rad_transfer_modak.h"
+#include "cs_rad_transfer_pun.h"
+#include "cs_rad_transfer_solve.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -247,6 +250,11 @@ cs_rad_transfer_params_t _rt_params = {
   .atmo_ir_id = -1,
   .dispersion = false,
   .dispersion_coeff = 1.,
+  .dir_batch_size = 0,
+  .subcycling_threshold = 0.,
+  .absorption_cache_threshold = 0.,
+  .p1_setup_reuse = 0,
+  .p1_warm_start = false,
   .time_control = {
     .type = CS_TIME_CONTROL_TIME_STEP,
     .at_start = false,
@@ -312,6 +320,10 @@ cs_rad_transfer_finalize(void)
   BFT_FREE(_rt_params.vect_s);
   BFT_FREE(_rt_params.angsol);
   BFT_FREE(_rt_params.wq);
+
+  cs_rad_transfer_solve_finalize();
+  cs_rad_transfer_modak_finalize();
+  cs_rad_transfer_pun_finalize();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -181,6 +181,37 @@ typedef struct {
                                        with point source) test case; the default
                                        value of 1 already improves precision in
                                        both cases. */
+  int           dir_batch_size;      /*!< DOM without dispersion: if > 0,
+                                       number of directions handled together
+                                       by direct upwind sweeps instead of
+                                       a linear solver for each direction
+                                       (only without atmospheric model) */
+  cs_real_t     subcycling_threshold; /*!< if > 0, when the radiation is
+                                       updated, a full resolution is done
+                                       only if the maximum relative variation
+                                       of the temperature or of the absorption
+                                       coefficient since the last resolution
+                                       exceeds this value. Otherwise, source
+                                       terms are linearized and updated
+                                       (for a gray gas without particles and
+                                       semi-analytic source terms only) */
+  cs_real_t     absorption_cache_threshold; /*!< if > 0, gas absorption
+                                       coefficients computed by the Modak
+                                       model are reused in cells where the
+                                       relative variation of temperature and
+                                       composition since their last
+                                       evaluation does not exceed this
+                                       value */
+  int           p1_setup_reuse;      /*!< P-1 model: if > 0 and no linear
+                                       solver is defined by the user for
+                                       "radiation_p1", use a multigrid
+                                       preconditioned conjugate gradient,
+                                       whose grid hierarchy is reused by all
+                                       bands for up to this number of
+                                       successive solves */
+  bool          p1_warm_start;       /*!< P-1 model: start the solve of each
+                                       band from its solution at the
+                                       previous radiation call */
 
   cs_time_control_t  time_control;   /* Time control for radiation updates */
 
@@ -141,6 +141,78 @@ _line_to_array(FILE      *radfile,
   *nvalues = index;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Determine the interval and interpolation ratio of a value
+ *        in a table of increasing values.
+ *
+ * Values outside the table range are clipped to its bounds.
+ *
+ * \param[in]   n      number of tabulated values
+ * \param[in]   table  tabulated values
+ * \param[in]   x      value to locate
+ * \param[out]  i      interval start index (0 to n-2)
+ * \param[out]  r      interpolation ratio in interval
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_table_position(int              n,
+                const cs_real_t  table[],
+                cs_real_t        x,
+                int             *i,
+                cs_real_t       *r)
+{
+  if (x <= table[0]) {
+    *r = 0.0;
+    *i = 0;
+  }
+  else if (x >= table[n - 1]) {
+    *r = 1.0;
+    *i = n - 2;
+  }
+  else {
+    /* Bisection, with table[lo] < x <= table[hi] */
+    int lo = 0, hi = n - 1;
+    while (hi - lo > 1) {
+      int mid = (lo + hi) / 2;
+      if (x > table[mid])
+        lo = mid;
+      else
+        hi = mid;
+    }
+    *i = lo;
+    *r = (x - table[lo]) / (table[lo + 1] - table[lo]);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Bilinear interpolation in a table of values.
+ *
+ * \param[in]  v    pointer to tabulated value at start of both intervals
+ * \param[in]  sx   stride between values in the first direction
+ * \param[in]  st   stride between values in the second direction
+ * \param[in]  rx   interpolation ratio in the first direction
+ * \param[in]  rt   interpolation ratio in the second direction
+ *
+ * \return  interpolated value
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_bilinear(const cs_real_t  v[],
+          cs_lnum_t        sx,
+          cs_lnum_t        st,
+          cs_real_t        rx,
+          cs_real_t        rt)
+{
+  return   (1.0 - rt) * (1.0 - rx) * v[0]
+         + (1.0 - rt) * rx * v[sx]
+         + rt * (1.0 - rx) * v[st]
+         + rt * rx * v[sx + st];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Determine the radiation coefficients of the ADF 08 model
@@ -169,19 +241,20 @@ cs_rad_transfer_adf08(const cs_real_t  pco2[],
   int nwsgg = cs_glob_rad_transfer_params->nwsgg;
   cs_real_t  tkelvi = 273.15;
 
-  cs_real_t  tref, xh2oref, rt, rx;
+  cs_real_t  tref, xh2oref;
 
   /* Memory allocation and initialization */
 
-  cs_real_t *y, *tpaadf;
+  cs_real_t *_tpaadf = NULL;
+  const cs_real_t *tpaadf;
   cs_field_t *f_b_temp = cs_field_by_name_try("boundary_temperature");
-  BFT_MALLOC(y, cs_glob_mesh->n_cells_with_ghosts, cs_real_t);
 
   if (cs_glob_thermal_model->itpscl == CS_TEMPERATURE_SCALE_CELSIUS) {
 
-    BFT_MALLOC(tpaadf, nfabor, cs_real_t );
+    BFT_MALLOC(_tpaadf, nfabor, cs_real_t);
     for (cs_lnum_t ifac = 0; ifac < nfabor; ifac++)
-      tpaadf[ifac] = f_b_temp->val[ifac] + tkelvi;
+      _tpaadf[ifac] = f_b_temp->val[ifac] + tkelvi;
+    tpaadf = _tpaadf;
 
   }
   else
@@ -281,128 +354,66 @@ cs_rad_transfer_adf08(const cs_real_t  pco2[],
     }
   }
 
-  int it, ix, l;
+  const cs_real_t p_coeff = 100.0 * (cs_glob_fluid_properties->p0 / 100000.0);
+  const cs_lnum_t sx = nwsgg, st = nysto * nwsgg;
+
+# pragma omp parallel for if (ncells > CS_THR_MIN)
   for (cs_lnum_t iel = 0; iel < ncells; iel++) {
-    if (pco2[iel] > 0.0)
-      y[iel] = ph2o[iel] / pco2[iel];
-    else
-      y[iel] = ysto[nysto - 1];
+
+    int it, ix;
+    cs_real_t rt, rx;
+
+    cs_real_t y = (pco2[iel] > 0.0) ? ph2o[iel] / pco2[iel] : ysto[nysto - 1];
 
     /* Interpolation temperature */
-    if (teloc[iel] <= tsto[0]) {
-      rt = 0.0;
-      it = 0;
-    }
-    else if (teloc[iel] >= tsto[ntsto - 1]) {
-      rt = 1.0;
-      it = ntsto - 2;
-    }
-    else {
-      l = 0;
-      while (teloc[iel] > tsto[l])
-        l++;
-      it = l - 1;
-      rt = (teloc[iel] - tsto[it]) / (tsto[it + 1] - tsto[it]);
-    }
+    _table_position(ntsto, tsto, teloc[iel], &it, &rt);
 
     /* Interpolation H2O-molefraction */
-    if (y[iel] <= ysto[0]) {
-      rx = 0.0;
-      ix = 0;
-    }
-    else if (y[iel] >= ysto[nysto - 1]) {
-      rx = 1.0;
-      ix = nysto - 2;
-    }
-    else {
-      l = 0;
-      while (y[iel] > ysto[l])
-        l++;
-      ix = l - 1;
-      rx = (y[iel] - ysto[ix]) / (ysto[ix + 1] - ysto[ix]);
-    }
+    _table_position(nysto, ysto, y, &ix, &rx);
 
     /* Absortion Coefficient */
 
+    const cs_lnum_t s_id = ix * sx + it * st;
+
     for (int i = 0; i < nwsgg; i++) {
-      cs_real_t kmloc =    (1.0 - rt) * (1.0 - rx)
-                         * ksto2[i + ix * nwsgg + it * nysto * nwsgg]
-                       +   (1.0 - rt) * (rx)
-                         * ksto2[i + (ix + 1) * nwsgg + it * nysto * nwsgg]
-                       +   rt * (1.0 - rx)
-                         * ksto2[i + ix * nysto + (it + 1) * nysto * nwsgg]
-                       + rt * rx
-                         * ksto2[i + (ix + 1) * nwsgg + (it + 1) * nysto * nwsgg];
-
-      kloc[iel + i * ncells] =  pco2[iel] * kmloc * 100.0
-                              * (cs_glob_fluid_properties->p0 / 100000.0);
+      cs_real_t kmloc = _bilinear(ksto2 + s_id + i, sx, st, rx, rt);
+
+      kloc[iel + i * ncells] = pco2[iel] * kmloc * p_coeff;
 
       /* Local radiation coefficient of the i-th grey gas    */
-      aloc[iel + i * ncells]
-        =   (1.0 - rt) * (1.0 - rx) * asto[i + ix * nwsgg + it * nysto * nwsgg]
-          + (1.0 - rt) * (rx) * asto[i + (ix + 1) * nwsgg + it * nysto * nwsgg]
-          + rt * (1.0 - rx) * asto[i + ix * nysto + (it + 1) * nysto * nwsgg]
-          + rt * rx * asto[i + (ix + 1) * nwsgg + (it + 1) * nysto * nwsgg];
+      aloc[iel + i * ncells] = _bilinear(asto + s_id + i, sx, st, rx, rt);
       /* Local weight of the i-th grey gas   */
     }
 
   }
 
+# pragma omp parallel for if (nfabor > CS_THR_MIN)
   for (cs_lnum_t ifac = 0; ifac < nfabor; ifac++) {
     cs_lnum_t iel = cs_glob_mesh->b_face_cells[ifac];
-    if (pco2[iel] > 0.0)
-      y[iel] = ph2o[iel] / pco2[iel];
-    else
-      y[iel] = ysto[nysto - 1];
+
+    int it, ix;
+    cs_real_t rt, rx;
+
+    cs_real_t y = (pco2[iel] > 0.0) ? ph2o[iel] / pco2[iel] : ysto[nysto - 1];
 
     /* Interpolation temperature */
-    if (tpaadf[ifac] <= tsto[0]) {
-      rt = 0.0;
-      it = 0;
-    }
-    else if (tpaadf[ifac] >= tsto[ntsto - 1]) {
-      rt = 1.0;
-      it = ntsto - 2;
-    }
-    else {
-      l = 0;
-      while (tpaadf[ifac] > tsto[l])
-        l++;
-      it = l - 1;
-      rt = (tpaadf[ifac] - tsto[it]) / (tsto[it + 1] - tsto[it]);
-    }
+    _table_position(ntsto, tsto, tpaadf[ifac], &it, &rt);
 
     /* Interpolation H2O-molefraction */
-    if (y[iel] <= ysto[0]) {
-      rx = 0.0;
-      ix = 0;
-    }
-    else if (y[iel] >= ysto[nysto - 1]) {
-      rx = 1.0;
-      ix = nysto - 2;
-    }
-    else {
-      l = 0;
-      while (y[iel] > ysto[l])
-        l++;
-      ix = l - 1;
-      rx = (y[iel] - ysto[ix]) / (ysto[ix + 1] - ysto[ix]);
-    }
+    _table_position(nysto, ysto, y, &ix, &rx);
 
     /* Absortion Coefficient     */
 
+    const cs_lnum_t s_id = ix * sx + it * st;
+
     for (int i = 0; i < nwsgg; i++)
-      alocb[ifac + i * nfabor]
-        =   (1.0 - rt) * (1.0 - rx) * asto[i + ix * nwsgg + it * nysto * nwsgg]
-          + (1.0 - rt) * rx * asto[i + (ix + 1) * nwsgg + it * nysto * nwsgg]
-          + rt * (1.0 - rx) * asto[i + ix * nwsgg + (it + 1) * nysto * nwsgg]
-          + rt * rx * asto[i + (ix + 1) * nwsgg + (it + 1) * nysto * nwsgg];
+      alocb[ifac + i * nfabor] = _bilinear(asto + s_id + i, sx, st, rx, rt);
 
     /* Local weight of the i-th grey gas   */
 
   }
 
-  BFT_FREE(tpaadf);
+  BFT_FREE(_tpaadf);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -439,18 +450,20 @@ cs_rad_transfer_adf50(const cs_real_t  pco2[],
   int nwsgg = cs_glob_rad_transfer_params->nwsgg;
   cs_real_t  tkelvi = 273.15;
 
-  cs_real_t  tref, xh2oref, rt, rx;
+  cs_real_t  tref, xh2oref;
 
   /* Memory allocation and initialization */
 
-  cs_real_t *tpaadf;
+  cs_real_t *_tpaadf = NULL;
+  const cs_real_t *tpaadf;
   cs_field_t *f_b_temp = cs_field_by_name_try("boundary_temperature");
 
   if (cs_glob_thermal_model->itpscl == CS_TEMPERATURE_SCALE_CELSIUS) {
 
-    BFT_MALLOC(tpaadf, nfabor, cs_real_t );
+    BFT_MALLOC(_tpaadf, nfabor, cs_real_t);
     for (cs_lnum_t ifac = 0; ifac < nfabor; ifac++)
-      tpaadf[ifac] = f_b_temp->val[ifac] + tkelvi;
+      _tpaadf[ifac] = f_b_temp->val[ifac] + tkelvi;
+    tpaadf = _tpaadf;
 
   }
   else
@@ -555,127 +568,65 @@ cs_rad_transfer_adf50(const cs_real_t  pco2[],
     }
   }
 
-  int it, ix, l;
+  const cs_real_t p_coeff = 100.0 * (cs_glob_fluid_properties->p0 / 100000.0);
+  const cs_lnum_t sx = nwsgg, st = nxh2osto * nwsgg;
+
+# pragma omp parallel for if (ncells > CS_THR_MIN)
   for (cs_lnum_t iel = 0; iel < ncells; iel++) {
 
+    int it, ix;
+    cs_real_t rt, rx;
+
     /* Interpolation temperature */
-    if (teloc[iel] <= tsto[0]) {
-      rt = 0.0;
-      it = 0;
-    }
-    else if (teloc[iel] >= tsto[ntsto - 1]) {
-      rt = 1.0;
-      it = ntsto - 2;
-    }
-    else {
-      l = 0;
-      while (teloc[iel] > tsto[l])
-        l++;
-      it = l - 1;
-      rt = (teloc[iel] - tsto[it]) / (tsto[it + 1] - tsto[it]);
-    }
+    _table_position(ntsto, tsto, teloc[iel], &it, &rt);
 
     /* Interpolation H2O-molefraction */
-    if (ph2o[iel] <= xh2osto[0]) {
-      rx = 0.0;
-      ix = 0;
-    }
-    else if (ph2o[iel] >= xh2osto[nxh2osto - 1]) {
-      rx = 1.0;
-      ix = nxh2osto - 2;
-    }
-    else {
-      l = 0;
-      while (ph2o[iel] > xh2osto[l])
-        l++;
-      ix = l - 1;
-      rx = (ph2o[iel] - xh2osto[ix]) / (xh2osto[ix + 1] - xh2osto[ix]);
-    }
+    _table_position(nxh2osto, xh2osto, ph2o[iel], &ix, &rx);
 
     /* Absortion Coefficient */
+
+    const cs_lnum_t s_id = ix * sx + it * st;
+
     for (int i = 0; i < nwsgg; i++) {
       cs_real_t kco2loc =  ksto1[i + it * nwsgg]
                          + rt * (  ksto1[i + (it+1) * nwsgg]
                                  - ksto1[i + it * nwsgg]);
-      cs_real_t kh2oloc =   (1.0 - rt) * (1.0 - rx)
-                          * ksto2[i + ix * nwsgg + it * nxh2osto * nwsgg]
-                         +  (1.0 - rt) * (rx)
-                          * ksto2[i + (ix + 1) * nwsgg + it * nxh2osto * nwsgg]
-                         +  rt * (1.0 - rx)
-                          * ksto2[i + ix * nxh2osto + (it + 1) * nxh2osto * nwsgg]
-                         +  rt * rx
-                          * ksto2[i + (ix + 1) * nwsgg + (it + 1) * nxh2osto * nwsgg];
-
-      kloc[iel + i * ncells] =  (pco2[iel] * kco2loc + ph2o[iel] * kh2oloc) * 100.0
-                              * (cs_glob_fluid_properties->p0 / 100000.0);
+      cs_real_t kh2oloc = _bilinear(ksto2 + s_id + i, sx, st, rx, rt);
+
+      kloc[iel + i * ncells] =  (pco2[iel] * kco2loc + ph2o[iel] * kh2oloc)
+                              * p_coeff;
 
       /* Local radiation coefficient of the i-th grey gas */
-      aloc[iel + i * ncells] =   (1.0 - rt) * (1.0 - rx)
-                               * asto[i + ix * nwsgg + it * nxh2osto * nwsgg]
-                              +  (1.0 - rt) * (rx)
-                               * asto[i + (ix + 1) * nwsgg + it * nxh2osto * nwsgg]
-                              +  rt * (1.0 - rx)
-                               * asto[i + ix * nxh2osto + (it + 1) * nxh2osto * nwsgg]
-                              +  rt * rx
-                               * asto[i + (ix + 1) * nwsgg + (it + 1) * nxh2osto * nwsgg];
-                              /* Local weight of the i-th grey gas */
+      aloc[iel + i * ncells] = _bilinear(asto + s_id + i, sx, st, rx, rt);
+      /* Local weight of the i-th grey gas */
     }
 
   }
 
+# pragma omp parallel for if (nfabor > CS_THR_MIN)
   for (cs_lnum_t ifac = 0; ifac < nfabor; ifac++) {
     cs_lnum_t iel = cs_glob_mesh->b_face_cells[ifac];
 
+    int it, ix;
+    cs_real_t rt, rx;
+
     /* Interpolation temperature */
-    if (tpaadf[ifac] <= tsto[0]) {
-      rt = 0.0;
-      it = 0;
-    }
-    else if (tpaadf[ifac] >= tsto[ntsto - 1]) {
-      rt = 1.0;
-      it = ntsto - 2;
-    }
-    else {
-      l = 0;
-      while (tpaadf[ifac] > tsto[l])
-        l++;
-      it = l - 1;
-      rt = (tpaadf[ifac] - tsto[it]) / (tsto[it + 1] - tsto[it]);
-    }
+    _table_position(ntsto, tsto, tpaadf[ifac], &it, &rt);
 
     /* Interpolation H2O-molefraction */
-    if (ph2o[iel] <= xh2osto[0]) {
-      rx = 0.0;
-      ix = 0;
-    }
-    else if (ph2o[iel] >= xh2osto[nxh2osto - 1]) {
-      rx = 1.0;
-      ix = nxh2osto - 2;
-    }
-    else {
-      l = 0;
-      while (ph2o[iel] > xh2osto[l])
-        l++;
-      ix = l - 1;
-      rx = (ph2o[iel] - xh2osto[ix]) / (xh2osto[ix + 1] - xh2osto[ix]);
-    }
+    _table_position(nxh2osto, xh2osto, ph2o[iel], &ix, &rx);
 
     /* Absortion Coefficient     */
 
+    const cs_lnum_t s_id = ix * sx + it * st;
+
     for (int i = 0; i < nwsgg; i++)
-      alocb[ifac + i * nfabor] =   (1.0 - rt) * (1.0 - rx)
-                                  * asto[i + ix * nwsgg + it * nxh2osto * nwsgg]
-                                 +  (1.0 - rt) * rx
-                                  * asto[i + (ix + 1) * nwsgg + it * nxh2osto * nwsgg]
-                                 +  rt * (1.0 - rx)
-                                  * asto[i + ix * nwsgg + (it + 1) * nxh2osto * nwsgg]
-                                 +  rt * rx
-                                  * asto[i + (ix + 1) * nwsgg + (it + 1) * nxh2osto * nwsgg];
-                                 /* Local weight of the i-th grey gas   */
+      alocb[ifac + i * nfabor] = _bilinear(asto + s_id + i, sx, st, rx, rt);
+    /* Local weight of the i-th grey gas   */
 
   }
 
-  BFT_FREE(tpaadf);
+  BFT_FREE(_tpaadf);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -52,6 +52,7 @@
 #include "cs_log.h"
 #include "cs_mesh.h"
 #include "cs_mesh_quantities.h"
+#include "cs_node_shared.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
 #include "cs_sles.h"
@@ -643,6 +644,7 @@ _simple_interpg (int        nxy,
  * \param[in]     interp_method Interpolation method
  * \param[out]    gdb
  * \param[out]    kdb
+ * \param[out]    work          work array (size: ng*(4*4*4*4 + 4*4*4 + 4*4 + 4))
  */
 /*----------------------------------------------------------------------------*/
 
@@ -653,23 +655,21 @@ _interpolation4d(cs_real_t trad,
                  cs_real_t xh2o,
                  int       interp_method,
                  cs_real_t gdb[],
-                 cs_real_t kdb[])
+                 cs_real_t kdb[],
+                 cs_real_t work[])
 {
   int     itx[4][4];
   int     nix, nit;
 
-  cs_real_t *karray, *kint1, *kint2, *kint3;
-  BFT_MALLOC(karray, ng*4*4*4*4, cs_real_t);
-  BFT_MALLOC(kint1,  ng*4*4*4, cs_real_t);
-  BFT_MALLOC(kint2,  ng*4*4, cs_real_t);
-  BFT_MALLOC(kint3,  ng*4, cs_real_t);
+  /* Work arrays are provided by the caller, as this function is called
+     several times for each cell and boundary face */
 
-  cs_real_t *b, *c, *d, *kg_t2, *kg_x2;
-  BFT_MALLOC(b, 4, cs_real_t);
-  BFT_MALLOC(c, 4, cs_real_t);
-  BFT_MALLOC(d, 4, cs_real_t);
-  BFT_MALLOC(kg_t2, 4, cs_real_t);
-  BFT_MALLOC(kg_x2, 4, cs_real_t);
+  cs_real_t *karray = work;
+  cs_real_t *kint1 = karray + ng*4*4*4*4;
+  cs_real_t *kint2 = kint1 + ng*4*4*4;
+  cs_real_t *kint3 = kint2 + ng*4*4;
+
+  cs_real_t b[4], c[4], d[4], kg_t2[4], kg_x2[4];
 
   /* Determine positions in x and T
    * in the NB database for interpolation. */
@@ -892,17 +892,6 @@ _interpolation4d(cs_real_t trad,
       kdb[ig] = wt * kint3[1 + ig*4] + (1.0 - wt) * kint3[0 + ig*4];
     }
   }
-
-  /* Free memory */
-  BFT_FREE(karray);
-  BFT_FREE(kint1);
-  BFT_FREE(kint2);
-  BFT_FREE(kint3);
-  BFT_FREE(b);
-  BFT_FREE(c);
-  BFT_FREE(d);
-  BFT_FREE(kg_t2);
-  BFT_FREE(kg_x2);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -950,6 +939,9 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
   BFT_MALLOC(aw, cs_glob_rad_transfer_params->nwsgg, cs_real_t);
   BFT_MALLOC(kloctmp, cs_glob_rad_transfer_params->nwsgg, cs_real_t);
 
+  cs_real_t *w_interp;
+  BFT_MALLOC(w_interp, ng*(4*4*4*4 + 4*4*4 + 4*4 + 4), cs_real_t);
+
   cs_field_t *f_bound_t = cs_field_by_name_try("boundary_temperature");
   cs_real_t *tpfsck = f_bound_t->val;
 
@@ -962,17 +954,22 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
     const char *pathdatadir = cs_base_get_pkgdatadir();
     char filepath[256];
 
-    BFT_MALLOC(gi,    ng, cs_real_t);
     BFT_MALLOC(tt,    nt, cs_real_t);
     BFT_MALLOC(kpco2, nt, cs_real_t);
     BFT_MALLOC(kph2o, nt, cs_real_t);
     BFT_MALLOC(wv,    nband, cs_real_t);
     BFT_MALLOC(dwv,   nband, cs_real_t);
 
-    BFT_MALLOC(kmfs, nconc * nconc * nt *nt *ng, cs_real_t);
+    /* The k-distributions table is the largest one, so a single copy
+       is read and stored per compute node */
+
+    bool is_writer = true;
+    gi = cs_node_shared_malloc(ng*sizeof(cs_real_t), &is_writer);
+    kmfs = cs_node_shared_malloc(  (size_t)nconc * nconc * nt * nt * ng
+                                 * sizeof(cs_real_t), &is_writer);
 
     /* Read k-distributions */
-    {
+    if (is_writer) {
       snprintf(filepath, 256, "%s/data/thch/dp_radiat_MFS", pathdatadir);
       radfile = fopen(filepath, "r");
       char line[256];
@@ -1001,6 +998,9 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
       fclose(radfile);
     }
 
+    cs_node_shared_sync(gi);
+    cs_node_shared_sync(kmfs);
+
     /* Read the Planck coefficients */
     {
       snprintf(filepath, 256, "%s/data/thch/dp_radiat_Planck_CO2", pathdatadir);
@@ -1220,7 +1220,8 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
                    ph2oref,
                    interp_method,
                    gfskref,
-                   kfskref);
+                   kfskref,
+                   w_interp);
 
   /* [m^-1] */
   for (int i = 0; i < ng; i++)
@@ -1239,7 +1240,8 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
                       ph2o[iel],
                       interp_method,
                       gfsk,
-                      kfsk);
+                      kfsk,
+                      w_interp);
     /* [m^-1] */
     for (int i = 0; i < ng; i++)
       kfsk[i] /= 100.0;
@@ -1264,7 +1266,8 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
                      ph2oref,
                      interp_method,
                      gg1,
-                     kg1);
+                     kg1,
+                     w_interp);
     /* [m^-1] */
     for (int i = 0; i < ng; i++)
       kg1[i] *= 100.0;
@@ -1296,7 +1299,8 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
                      ph2oref,
                      interp_method,
                      gg1,
-                     kg1);
+                     kg1,
+                     w_interp);
     for (int i = 0; i < ng; i++)
       kg1[i] *= 100.0;
     _simple_interpg(ng,
@@ -1306,7 +1310,7 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
                     kfskref,
                     gfsk);
     as[0]  = (gfsk[1] - gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
-    as[ng] = (gfsk[ng] - gfsk[ng - 1]) / (gfskref[ng] - gfskref[ng - 1] + 1e-15);
+    as[ng-1] = (gfsk[ng-1] - gfsk[ng - 2]) / (gfskref[ng-1] - gfskref[ng - 2] + 1e-15);
     for (int k = 1; k < ng - 1; k++)
       as[k] = (gfsk[k + 1] - gfsk[k - 1]) / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
     _simple_interpg(ng,
@@ -1321,17 +1325,20 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
 
   /* free memory */
   if (cs_glob_time_step->nt_cur == cs_glob_time_step->nt_max) {
-    BFT_FREE(gi);
+    cs_node_shared_free(gi);
+    gi = NULL;
     BFT_FREE(tt);
     BFT_FREE(kpco2);
     BFT_FREE(kph2o);
     BFT_FREE(wv);
     BFT_FREE(dwv);
-    BFT_FREE(kmfs);
+    cs_node_shared_free(kmfs);
+    kmfs = NULL;
     BFT_FREE(gq);
   }
 
   BFT_FREE(kloctmp);
+  BFT_FREE(w_interp);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -51,6 +51,7 @@
 
 #include "cs_parameters.h"
 #include "cs_mesh.h"
+#include "cs_rad_transfer.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -78,6 +79,66 @@ BEGIN_C_DECLS
  * Local type definitions
  *============================================================================*/
 
+/*=============================================================================
+ * Local const variables
+ *============================================================================*/
+
+/* Chebyshev polynomial coefficients for CO2 */
+
+static const cs_real_t _cc[3][4][4] = {
+  {
+    {      -2.754568,      -0.2997857,      -0.1232494,      0.01279287},
+    {       1.503051,       0.3156449,      0.01058126,     -0.03729625},
+    {      -0.247411,     -0.03323846,     -0.01819471,      0.02289789},
+    {     0.04994029,    -0.001986786,     0.003007898,    -0.001175598}
+  },
+  {
+    {    0.005737722,    -0.009328458,     0.002906286,     0.000422752},
+    {   -0.003151784,     0.005632821,    -0.003260295,    0.0007065884},
+    {   0.0001668751,   -0.0007326533,    0.0003639855,    0.0003228318},
+    {   0.0007386638,   -0.0007277073,    0.0005925968,   -0.0002021413}
+  },
+  {
+    {    0.003385611,    -0.005439185,      0.00176456,    0.0003036031},
+    {     -0.0018627,     0.003236275,     -0.00195225,    0.0003474022},
+    {   0.0001204807,   -0.0004479927,    0.0002497521,    0.0001812996},
+    {   0.0004218169,   -0.0004046608,    0.0003256861,   -9.514981e-05}
+  }
+};
+
+/* Chebyshev polynomial coefficients for H2O */
+
+static const cs_real_t _cw[3][4][4] = {
+  {
+    {      -2.594279,      -0.7118472,   -0.0009956839,       0.0122656},
+    {       2.510331,       0.6481808,     -0.03330587,    -0.005524345},
+    {     -0.4191636,       -0.137518,       0.0387793,    0.0008862328},
+    {     -0.0322912,     -0.01820241,     -0.02223133,   -0.0005940781}
+  },
+  {
+    {      0.1126869,     -0.08133829,       0.0151494,      0.00139398},
+    {   -0.009298805,       0.0455066,     -0.02082008,     0.002013361},
+    {    -0.04375032,      0.01924597,     0.008859877,    -0.004618414},
+    {    0.007077876,     -0.02096188,     0.001458262,     0.003851421}
+  },
+  {
+    {     0.05341517,     -0.03407693,     0.004354611,     0.001492038},
+    {   -0.004708178,      0.02086896,    -0.009477533,    0.0006153272},
+    {    -0.02104622,     0.007515796,     0.005965509,    -0.002756144},
+    {    0.004318975,     -0.01005744,    0.0004091084,     0.002550435}
+  }
+};
+
+/*=============================================================================
+ * Local static variables
+ *============================================================================*/
+
+/* Values at cells of the last evaluation, for optional reuse
+   (interleaved pco2, ph2o, fv, temp, ck) */
+
+static cs_lnum_t   _n_cache_cells = 0;
+static cs_real_t  *_cache = NULL;
+
 /*============================================================================
  * Public function definitions for fortran API
  *============================================================================*/
@@ -266,145 +327,43 @@ _scrtch(cs_real_t  pp,
         cs_real_t  te,
         int        index)
 {
-  cs_real_t cc[3][4][4], cw[3][4][4];
-
-  /* CC represents an array of 48 elements for CO2 */
-  if (index != 2) {
-    cc[0][0][0] = -2.754568;
-    cc[0][0][1] = -0.2997857;
-    cc[0][0][2] = -0.1232494;
-    cc[0][0][3] =  0.01279287;
-    cc[0][1][0] =  1.503051;
-    cc[0][1][1] =  0.3156449;
-    cc[0][1][2] =  0.01058126;
-    cc[0][1][3] = -0.03729625;
-    cc[0][2][0] = -0.247411;
-    cc[0][2][1] = -0.03323846;
-    cc[0][2][2] = -0.01819471;
-    cc[0][2][3] =  0.02289789;
-    cc[0][3][0] =  0.04994029;
-    cc[0][3][1] = -0.001986786;
-    cc[0][3][2] =  0.003007898;
-    cc[0][3][3] = -0.001175598;
-    cc[1][0][0] =  0.005737722;
-    cc[1][0][1] = -0.009328458;
-    cc[1][0][2] =  0.002906286;
-    cc[1][0][3] =  0.000422752;
-    cc[1][1][0] = -0.003151784;
-    cc[1][1][1] =  0.005632821;
-    cc[1][1][2] = -0.003260295;
-    cc[1][1][3] =  0.0007065884;
-    cc[1][2][0] =  0.0001668751;
-    cc[1][2][1] = -0.0007326533;
-    cc[1][2][2] =  0.0003639855;
-    cc[1][2][3] =  0.0003228318;
-    cc[1][3][0] =  0.0007386638;
-    cc[1][3][1] = -0.0007277073;
-    cc[1][3][2] =  0.0005925968;
-    cc[1][3][3] = -0.0002021413;
-    cc[2][0][0] =  0.003385611;
-    cc[2][0][1] = -0.005439185;
-    cc[2][0][2] =  0.00176456;
-    cc[2][0][3] =  0.0003036031;
-    cc[2][1][0] = -0.0018627;
-    cc[2][1][1] =  0.003236275;
-    cc[2][1][2] = -0.00195225;
-    cc[2][1][3] =  0.0003474022;
-    cc[2][2][0] =  0.0001204807;
-    cc[2][2][1] = -0.0004479927;
-    cc[2][2][2] =  0.0002497521;
-    cc[2][2][3] =  0.0001812996;
-    cc[2][3][0] =  0.0004218169;
-    cc[2][3][1] = -0.0004046608;
-    cc[2][3][2] =  0.0003256861;
-    cc[2][3][3] = -9.514981e-05;
-  }
+  /* CC represents an array of 48 elements for CO2,
+     CW represents an array of 48 elements for H2O */
 
-  /* CW represents an array of 48 elements for H2O */
-  else {
-    cw[0][0][0] = -2.594279;
-    cw[0][0][1] = -0.7118472;
-    cw[0][0][2] = -0.0009956839;
-    cw[0][0][3] =  0.0122656;
-    cw[0][1][0] =  2.510331;
-    cw[0][1][1] =  0.6481808;
-    cw[0][1][2] = -0.03330587;
-    cw[0][1][3] = -0.005524345;
-    cw[0][2][0] = -0.4191636;
-    cw[0][2][1] = -0.137518;
-    cw[0][2][2] =  0.0387793;
-    cw[0][2][3] =  0.0008862328;
-    cw[0][3][0] = -0.0322912;
-    cw[0][3][1] = -0.01820241;
-    cw[0][3][2] = -0.02223133;
-    cw[0][3][3] = -0.0005940781;
-    cw[1][0][0] =  0.1126869;
-    cw[1][0][1] = -0.08133829;
-    cw[1][0][2] =  0.0151494;
-    cw[1][0][3] =  0.00139398;
-    cw[1][1][0] = -0.009298805;
-    cw[1][1][1] =  0.0455066;
-    cw[1][1][2] = -0.02082008;
-    cw[1][1][3] =  0.002013361;
-    cw[1][2][0] = -0.04375032;
-    cw[1][2][1] =  0.01924597;
-    cw[1][2][2] =  0.008859877;
-    cw[1][2][3] = -0.004618414;
-    cw[1][3][0] =  0.007077876;
-    cw[1][3][1] = -0.02096188;
-    cw[1][3][2] =  0.001458262;
-    cw[1][3][3] =  0.003851421;
-    cw[2][0][0] =  0.05341517;
-    cw[2][0][1] = -0.03407693;
-    cw[2][0][2] =  0.004354611;
-    cw[2][0][3] =  0.001492038;
-    cw[2][1][0] = -0.004708178;
-    cw[2][1][1] =  0.02086896;
-    cw[2][1][2] = -0.009477533;
-    cw[2][1][3] =  0.0006153272;
-    cw[2][2][0] = -0.02104622;
-    cw[2][2][1] =  0.007515796;
-    cw[2][2][2] =  0.005965509;
-    cw[2][2][3] = -0.002756144;
-    cw[2][3][0] =  0.004318975;
-    cw[2][3][1] = -0.01005744;
-    cw[2][3][2] =  0.0004091084;
-    cw[2][3][3] =  0.002550435;
-  }
+  const cs_real_t (*c)[4][4] = (index == 2) ? _cw : _cc;
 
   cs_real_t xx = log(pp) / 3.45 + 1.0;
   cs_real_t yy = (log(pl) + 2.555) / 4.345;
   cs_real_t zz = (te - 1150.0) / 850.0;
 
+  /* Polynomial values do not depend on the coefficient indexes
+     of the other directions, so compute them only once */
+
+  cs_real_t tix[3], tjy[4], tkz[4];
+
+  for (int ii = 0; ii < 3; ii++)
+    tix[ii] = _chebyc(ii, xx);
+
+  for (int jj = 0; jj < 4; jj++) {
+    tjy[jj] = _chebyc(jj, yy);
+    tkz[jj] = _chebyc(jj, zz);
+  }
+
   cs_real_t value = 0.0;
 
   for (int ii = 0; ii < 3; ii++) {
 
-    cs_real_t tix;
-    tix = _chebyc(ii, xx);
-
     cs_real_t v6 = 0.0;
     for (int jj = 0; jj < 4; jj++) {
 
-      cs_real_t tjy;
-      tjy = _chebyc(jj, yy);
       cs_real_t v7 = 0.0;
+      for (int kk = 0; kk < 4; kk++)
+        v7 += tkz[kk] * c[ii][jj][kk];
 
-      for (int kk = 0; kk < 4; kk++) {
-
-        cs_real_t tkz = _chebyc(kk, zz);
-
-        if (index == 1)
-          v7 += tkz * cc[ii][jj][kk];
-        if (index == 2)
-          v7 += tkz * cw[ii][jj][kk];
-
-
-      }
-      v6 += v7 * tjy;
+      v6 += v7 * tjy[jj];
     }
 
-    value += v6 * tix;
+    value += v6 * tix[ii];
   }
 
   return exp(value);
@@ -580,6 +539,26 @@ _absorb(cs_real_t  ts,
   return 1e-08;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a value is close to a reference value.
+ *
+ * \param[in]  v          value
+ * \param[in]  v_ref      reference value
+ * \param[in]  threshold  allowed relative variation
+ *
+ * \return  true if the relative variation is below the threshold
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+_is_close(cs_real_t  v,
+          cs_real_t  v_ref,
+          cs_real_t  threshold)
+{
+  return (CS_ABS(v - v_ref) <= threshold * CS_ABS(v_ref));
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -613,9 +592,39 @@ cs_rad_transfer_modak(cs_real_t        ck[],
   cs_real_t tmax = 2000.0;
   cs_real_t tmin = 300.0;
 
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  /* Optional reuse of values from the last evaluation */
+
+  const cs_real_t threshold
+    = cs_glob_rad_transfer_params->absorption_cache_threshold;
+
+  bool use_cache = false;
+
+  if (threshold > 0) {
+    if (_cache != NULL && _n_cache_cells == n_cells)
+      use_cache = true;
+    else {
+      BFT_REALLOC(_cache, n_cells*5, cs_real_t);
+      _n_cache_cells = n_cells;
+    }
+  }
+
   /* Caution: temperatures used by Modak are in Kelvin */
 
-  for (cs_lnum_t cell_id = 0; cell_id < cs_glob_mesh->n_cells; cell_id++) {
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+    if (use_cache) {
+      const cs_real_t *c_v = _cache + cell_id*5;
+      if (   _is_close(pco2[cell_id], c_v[0], threshold)
+          && _is_close(ph2o[cell_id], c_v[1], threshold)
+          && _is_close(fv[cell_id], c_v[2], threshold)
+          && _is_close(temp[cell_id], c_v[3], threshold)) {
+        ck[cell_id] = c_v[4];
+        continue;
+      }
+    }
 
     cs_real_t te; /* gas mix temperature */
     cs_real_t ts; /* black body temperature */
@@ -663,9 +672,31 @@ cs_rad_transfer_modak(cs_real_t        ck[],
 
     /* Compute absorption coefficient */
     ck[cell_id] = -log(1.0 - alpha) / path;
+
+    if (threshold > 0) {
+      cs_real_t *c_v = _cache + cell_id*5;
+      c_v[0] = pco2[cell_id];
+      c_v[1] = ph2o[cell_id];
+      c_v[2] = fv[cell_id];
+      c_v[3] = temp[cell_id];
+      c_v[4] = ck[cell_id];
+    }
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free values saved by the Modak model for reuse.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_modak_finalize(void)
+{
+  BFT_FREE(_cache);
+  _n_cache_cells = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
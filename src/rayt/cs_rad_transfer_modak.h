@@ -76,6 +76,15 @@ cs_rad_transfer_modak(cs_real_t        ck[],
                       const cs_real_t  fv[],
                       const cs_real_t  temp[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free values saved by the Modak model for reuse.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_modak_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
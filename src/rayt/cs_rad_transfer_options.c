@@ -353,6 +353,38 @@ cs_rad_transfer_log_setup(void)
         (CS_LOG_SETUP,
          _("    ndirec:       %d\n"),
          cs_glob_rad_transfer_params->ndirec);
+    if (cs_glob_rad_transfer_params->dir_batch_size > 0)
+      cs_log_printf
+        (CS_LOG_SETUP,
+         _("    dir_batch_size: %d (direct upwind sweeps)\n"),
+         cs_glob_rad_transfer_params->dir_batch_size);
+  }
+
+  else if (cs_glob_rad_transfer_params->type == CS_RAD_TRANSFER_P1) {
+    if (cs_glob_rad_transfer_params->p1_setup_reuse > 0)
+      cs_log_printf
+        (CS_LOG_SETUP,
+         _("    p1_setup_reuse: %d (multigrid hierarchy reuse)\n"),
+         cs_glob_rad_transfer_params->p1_setup_reuse);
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("    p1_warm_start: %s\n"),
+       cs_base_strtf(cs_glob_rad_transfer_params->p1_warm_start));
+  }
+
+  if (cs_glob_rad_transfer_params->subcycling_threshold > 0) {
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("    subcycling_threshold: %g\n"),
+       cs_glob_rad_transfer_params->subcycling_threshold);
+  }
+
+  if (   cs_glob_rad_transfer_params->absorption_cache_threshold > 0
+      && cs_glob_rad_transfer_params->imodak == 1) {
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("    absorption_cache_threshold: %g\n"),
+       cs_glob_rad_transfer_params->absorption_cache_threshold);
   }
 
   const char *imodak_value_str[]
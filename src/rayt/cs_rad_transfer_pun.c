@@ -60,6 +60,10 @@
 #include "cs_face_viscosity.h"
 #include "cs_equation_iterative_solve.h"
 #include "cs_gradient.h"
+#include "cs_multigrid.h"
+#include "cs_sles.h"
+#include "cs_sles_it.h"
+#include "cs_sles_pc.h"
 #include "cs_face_viscosity.h"
 
 #include "cs_gui_radiative_transfer.h"
@@ -92,6 +96,17 @@ BEGIN_C_DECLS
  * Local type definitions
  *============================================================================*/
 
+/*=============================================================================
+ * Local static variables
+ *============================================================================*/
+
+/* Solutions of the previous call for each band, for warm start */
+
+static int         _n_bands = 0;
+static cs_lnum_t   _n_cells_ext = 0;
+static bool       *_has_prev = NULL;
+static cs_real_t  *_theta4_prev = NULL;
+
 /*============================================================================
  * Public function definitions for fortran API
  *============================================================================*/
@@ -100,6 +115,75 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the linear solver used for the P-1 model if not already done.
+ *
+ * A flexible conjugate gradient with a multigrid preconditioner is used,
+ * with the grid hierarchy kept between successive setups, so that all bands
+ * and successive radiation calls share the same hierarchy.
+ *
+ * \param[in]  name         linear system name
+ * \param[in]  n_max_reuse  maximum number of successive setups reusing
+ *                          the grid hierarchy
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_define_sles(const char  *name,
+             int          n_max_reuse)
+{
+  if (cs_sles_find(-1, name) != NULL)
+    return;
+
+  cs_sles_it_t *c = cs_sles_it_define(-1,
+                                      name,
+                                      CS_SLES_FCG,
+                                      -1,      /* poly_degree */
+                                      10000);  /* n_max_iter */
+
+  cs_sles_pc_t *pc = cs_multigrid_pc_create(CS_MULTIGRID_V_CYCLE);
+
+  cs_multigrid_t *mg = cs_sles_pc_get_context(pc);
+  cs_multigrid_set_setup_reuse(mg, n_max_reuse, 1.5);
+
+  cs_sles_it_transfer_pc(c, &pc);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get the saved solution of a given band for warm start,
+ *        resizing the saved solutions if needed.
+ *
+ * \param[in]   iband        band id
+ * \param[in]   n_bands      number of bands
+ * \param[in]   n_cells_ext  number of cells with ghosts
+ * \param[out]  has_prev     true if a previous solution is available
+ *
+ * \return  pointer to saved solution of the given band
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_band_prev_solution(int         iband,
+                    int         n_bands,
+                    cs_lnum_t   n_cells_ext,
+                    bool      **has_prev)
+{
+  if (n_bands != _n_bands || n_cells_ext != _n_cells_ext) {
+    BFT_REALLOC(_has_prev, n_bands, bool);
+    BFT_REALLOC(_theta4_prev, (size_t)n_bands*n_cells_ext, cs_real_t);
+    for (int i = 0; i < n_bands; i++)
+      _has_prev[i] = false;
+    _n_bands = n_bands;
+    _n_cells_ext = n_cells_ext;
+  }
+
+  *has_prev = _has_prev + iband;
+
+  return _theta4_prev + (size_t)iband*n_cells_ext;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -200,13 +284,36 @@ cs_rad_transfer_pun(int              iband,
   /* all boundary convective flux with upwind */
   int icvflb = 0;
 
-  /* Reset arrays before solve */
-  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-    theta4[cell_id] = 0.0;
-    thetaa[cell_id] = 0.0;
+  if (cs_glob_rad_transfer_params->p1_setup_reuse > 0)
+    _define_sles("radiation_p1",
+                 cs_glob_rad_transfer_params->p1_setup_reuse);
+
+  /* Reset arrays before solve, or start from the previous solution
+     of this band */
+
+  bool *has_prev = NULL;
+  cs_real_t *theta4_prev = NULL;
+
+  if (cs_glob_rad_transfer_params->p1_warm_start)
+    theta4_prev = _band_prev_solution(iband,
+                                      cs_glob_rad_transfer_params->nwsgg,
+                                      n_cells_ext,
+                                      &has_prev);
+
+  if (theta4_prev != NULL && *has_prev) {
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+      theta4[cell_id] = theta4_prev[cell_id];
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++)
+      thetaa[cell_id] = theta4_prev[cell_id];
+  }
+  else {
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      theta4[cell_id] = 0.0;
+      thetaa[cell_id] = 0.0;
+    }
+    for (cs_lnum_t cell_id = n_cells; cell_id < n_cells_ext; cell_id++)
+      thetaa[cell_id] = 0.0;
   }
-  for (cs_lnum_t cell_id = n_cells; cell_id < n_cells_ext; cell_id++)
-    thetaa[cell_id] = 0.0;
 
   for (cs_lnum_t ifac = 0; ifac < cs_glob_mesh->n_i_faces; ifac++)
     flurds[ifac] = 0.0;
@@ -261,6 +368,16 @@ cs_rad_transfer_pun(int              iband,
                                      NULL,
                                      NULL);
 
+  /* Save solution for the next call */
+
+  if (theta4_prev != NULL) {
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+      theta4_prev[cell_id] = theta4[cell_id];
+    for (cs_lnum_t cell_id = n_cells; cell_id < n_cells_ext; cell_id++)
+      theta4_prev[cell_id] = 0.0;
+    *has_prev = true;
+  }
+
   /* Radiative flux density Q */
 
   int inc = 1;
@@ -368,6 +485,21 @@ cs_rad_transfer_pun(int              iband,
   BFT_FREE(thetaa);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free solutions saved by the P-1 model for warm start.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_pun_finalize(void)
+{
+  BFT_FREE(_has_prev);
+  BFT_FREE(_theta4_prev);
+  _n_bands = 0;
+  _n_cells_ext = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
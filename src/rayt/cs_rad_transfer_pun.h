@@ -104,6 +104,15 @@ cs_rad_transfer_pun(int              iband,
                     cs_real_t        int_rad_domega[],
                     cs_real_t        theta4[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free solutions saved by the P-1 model for warm start.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_pun_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -57,8 +57,10 @@
 #include "cs_field_pointer.h"
 #include "cs_gui_util.h"
 #include "cs_log.h"
+#include "cs_halo.h"
 #include "cs_math.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
 #include "cs_parameters_check.h"
@@ -99,6 +101,22 @@ BEGIN_C_DECLS
 
 static int ipadom = 0;
 
+/* Structures shared by the direct upwind sweeps: cells to faces adjacency
+   and ordering of cells for each direction */
+
+static cs_adjacency_t  *_sweep_c2f = NULL;
+static cs_lnum_t       *_sweep_order = NULL;
+
+/* State at the last full resolution, used for sub-cycling: temperature,
+   absorption coefficient, absorption, emission and derivative of the
+   emission with respect to the temperature */
+
+static cs_real_t  *_sc_tempk = NULL;
+static cs_real_t  *_sc_ck = NULL;
+static cs_real_t  *_sc_abso = NULL;
+static cs_real_t  *_sc_emi = NULL;
+static cs_real_t  *_sc_demi = NULL;
+
 /*=============================================================================
  * Local Macro Definitions
  *============================================================================*/
@@ -215,6 +233,439 @@ _order_axis(const cs_real_t  s[],
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if the DOM directions are solved by direct upwind sweeps.
+ *
+ * \return  true if direct upwind sweeps are used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_use_sweeps(void)
+{
+  const cs_rad_transfer_params_t *rt_params = cs_glob_rad_transfer_params;
+
+  if (   rt_params->dir_batch_size > 0
+      && rt_params->dispersion == false
+      && rt_params->atmo_model == CS_RAD_ATMO_3D_NONE)
+    return true;
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the vector of a direction given by its global id.
+ *
+ * Global ids follow the loops on octants then on the directions of the
+ * quadrature, as in the resolution loop.
+ *
+ * \param[in]   kdir    global direction id (0 to 8*ndirs - 1)
+ * \param[out]  s       direction vector
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_direction_vector(int        kdir,
+                  cs_real_t  s[3])
+{
+  const cs_rad_transfer_params_t *rt_params = cs_glob_rad_transfer_params;
+
+  const int octant = kdir / rt_params->ndirs;
+  const int dir_id = kdir % rt_params->ndirs;
+
+  const int ii = 2*(octant / 4) - 1;
+  const int jj = 2*((octant / 2) % 2) - 1;
+  const int kk = 2*(octant % 2) - 1;
+
+  s[0] = ii * rt_params->vect_s[dir_id][0];
+  s[1] = jj * rt_params->vect_s[dir_id][1];
+  s[2] = kk * rt_params->vect_s[dir_id][2];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build structures shared by the direct upwind sweeps.
+ *
+ * Cells are ordered along each direction, so that a sweep handles
+ * upwind cells first.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_sweep_setup(void)
+{
+  if (_sweep_c2f != NULL)
+    return;
+
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+
+  const int n_dirs = 8*cs_glob_rad_transfer_params->ndirs;
+
+  _sweep_c2f = cs_mesh_adjacency_c2f(m, 1); /* boundary faces last */
+
+  BFT_MALLOC(_sweep_order, (size_t)n_dirs*n_cells, cs_lnum_t);
+
+# pragma omp parallel if (n_dirs > 1)
+  {
+    cs_real_t *s;
+    BFT_MALLOC(s, n_cells, cs_real_t);
+
+#   pragma omp for schedule(dynamic)
+    for (int kdir = 0; kdir < n_dirs; kdir++) {
+
+      cs_real_t v[3];
+      _direction_vector(kdir, v);
+
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+        s[c_id] = cs_math_3_dot_product(v, cell_cen[c_id]);
+
+      _order_axis(s, _sweep_order + (size_t)kdir*n_cells, n_cells);
+
+    }
+
+    BFT_FREE(s);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve the radiance for a batch of directions by direct upwind sweeps.
+ *
+ * The upwind system assembled by cs_equation_iterative_solve_scalar for
+ * a pure convection with an implicit source term is solved cell by cell,
+ * following the ordering of cells along each direction. When this ordering
+ * is compatible with the upwind dependencies, a single sweep is exact, and
+ * a second one only checks convergence. Across ranks, directions of the
+ * batch are swept independently between halo synchronizations.
+ *
+ * Directions of a batch share the cells to faces adjacency and are handled
+ * by different threads.
+ *
+ * \param[in]   kdir_s     global id of the first direction of the batch
+ * \param[in]   n_b_dirs   number of directions in the batch
+ * \param[in]   coefap     boundary condition array for the radiance
+ *                         (explicit part)
+ * \param[in]   coefbp     boundary condition array for the radiance
+ *                         (implicit part)
+ * \param[in]   rovsdt     implicit source term
+ * \param[in]   rhs        explicit source term
+ * \param[in]   epsrsm     relative tolerance on the radiance update
+ * \param[in]   verbosity  verbosity level
+ * \param[out]  radiance   radiance for each direction of the batch
+ *                         (size: n_b_dirs*n_cells_ext)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_sweep_directions(int                        kdir_s,
+                  int                        n_b_dirs,
+                  const cs_real_t  *restrict coefap,
+                  const cs_real_t  *restrict coefbp,
+                  const cs_real_t  *restrict rovsdt,
+                  const cs_real_t  *restrict rhs,
+                  cs_real_t                  epsrsm,
+                  int                        verbosity,
+                  cs_real_t        *restrict radiance)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->b_face_normal;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->i_face_normal;
+
+  const cs_adjacency_t *c2f = _sweep_c2f;
+
+  const int n_max_iter = 1000;
+
+  for (cs_lnum_t i = 0; i < n_b_dirs*n_cells_ext; i++)
+    radiance[i] = 0.;
+
+  /* Update and magnitude of the radiance for each direction */
+
+  cs_real_t *delta;
+  BFT_MALLOC(delta, 2*n_b_dirs, cs_real_t);
+
+  int n_iter = 0;
+  bool converged = false;
+
+  while (converged == false && n_iter < n_max_iter) {
+
+    n_iter++;
+
+    if (m->halo != NULL) {
+      for (int d = 0; d < n_b_dirs; d++)
+        cs_halo_sync_var(m->halo, CS_HALO_STANDARD,
+                         radiance + d*n_cells_ext);
+    }
+
+#   pragma omp parallel for schedule(dynamic) if (n_b_dirs > 1)
+    for (int d = 0; d < n_b_dirs; d++) {
+
+      cs_real_t s[3];
+      _direction_vector(kdir_s + d, s);
+
+      const cs_lnum_t *restrict order
+        = _sweep_order + (size_t)(kdir_s + d)*n_cells;
+      cs_real_t *restrict r = radiance + d*n_cells_ext;
+
+      cs_real_t d_max = 0., r_max = 0.;
+
+      for (cs_lnum_t k = 0; k < n_cells; k++) {
+
+        const cs_lnum_t c_id = order[k];
+
+        cs_real_t diag = rovsdt[c_id];
+        cs_real_t b = rhs[c_id];
+
+        /* Only upwind faces contribute */
+
+        for (cs_lnum_t j = c2f->idx[c_id]; j < c2f->idx[c_id+1]; j++) {
+
+          const cs_lnum_t f_id = c2f->ids[j];
+
+          if (f_id < n_i_faces) {
+            const cs_real_t flux
+              = c2f->sgn[j]*cs_math_3_dot_product(s, i_face_normal[f_id]);
+            if (flux < 0.) {
+              const cs_lnum_t c_id_up = (i_face_cells[f_id][0] == c_id) ?
+                i_face_cells[f_id][1] : i_face_cells[f_id][0];
+              diag -= flux;
+              b -= flux*r[c_id_up];
+            }
+          }
+          else {
+            const cs_lnum_t bf_id = f_id - n_i_faces;
+            const cs_real_t flux
+              = cs_math_3_dot_product(s, b_face_normal[bf_id]);
+            if (flux < 0.) {
+              diag -= flux*(1. - coefbp[bf_id]);
+              b -= flux*coefap[bf_id];
+            }
+          }
+
+        }
+
+        if (diag > 0.) {
+          const cs_real_t r_new = b / diag;
+          d_max = CS_MAX(d_max, CS_ABS(r_new - r[c_id]));
+          r_max = CS_MAX(r_max, CS_ABS(r_new));
+          r[c_id] = r_new;
+        }
+
+      } /* Loop on ordered cells */
+
+      delta[2*d] = d_max;
+      delta[2*d+1] = r_max;
+
+    } /* Loop on directions of the batch */
+
+    cs_parall_max(2*n_b_dirs, CS_REAL_TYPE, delta);
+
+    converged = true;
+    for (int d = 0; d < n_b_dirs; d++)
+      if (delta[2*d] > epsrsm*delta[2*d+1])
+        converged = false;
+
+  }
+
+  if (verbosity > 0)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("  Radiation directions %03d to %03d: %d sweeps%s\n"),
+                  kdir_s + 1, kdir_s + n_b_dirs, n_iter,
+                  (converged) ? "" : _(" (not converged)"));
+
+  BFT_FREE(delta);
+
+  if (m->halo != NULL) {
+    for (int d = 0; d < n_b_dirs; d++)
+      cs_halo_sync_var(m->halo, CS_HALO_STANDARD, radiance + d*n_cells_ext);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if radiative source terms may be updated without a full
+ *        resolution (sub-cycling).
+ *
+ * \param[in]  n_classes  number of particle classes
+ *
+ * \return  true if sub-cycling is allowed, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_subcycling_allowed(int  n_classes)
+{
+  const cs_rad_transfer_params_t *rt_params = cs_glob_rad_transfer_params;
+
+  if (   rt_params->subcycling_threshold > 0
+      && rt_params->nwsgg == 1
+      && rt_params->imoadf == 0
+      && rt_params->imfsck == 0
+      && rt_params->idiver == 0
+      && rt_params->atmo_model == CS_RAD_ATMO_3D_NONE
+      && n_classes == 0)
+    return true;
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free the state of the last full resolution used for sub-cycling.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_subcycling_free(void)
+{
+  BFT_FREE(_sc_tempk);
+  BFT_FREE(_sc_ck);
+  BFT_FREE(_sc_abso);
+  BFT_FREE(_sc_emi);
+  BFT_FREE(_sc_demi);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Store the state of the last full resolution for sub-cycling.
+ *
+ * \param[in]  tempk   temperature in Kelvin
+ * \param[in]  ckg     absorption coefficient
+ * \param[in]  dcp     inverse of the specific heat
+ * \param[in]  absom   absorption
+ * \param[in]  emim    emission
+ * \param[in]  istm    implicit source term
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_subcycling_store(const cs_real_t  tempk[],
+                  const cs_real_t  ckg[],
+                  const cs_real_t  dcp[],
+                  const cs_real_t  absom[],
+                  const cs_real_t  emim[],
+                  const cs_real_t  istm[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  if (_sc_tempk == NULL) {
+    BFT_MALLOC(_sc_tempk, n_cells, cs_real_t);
+    BFT_MALLOC(_sc_ck, n_cells, cs_real_t);
+    BFT_MALLOC(_sc_abso, n_cells, cs_real_t);
+    BFT_MALLOC(_sc_emi, n_cells, cs_real_t);
+    BFT_MALLOC(_sc_demi, n_cells, cs_real_t);
+  }
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    _sc_tempk[cell_id] = tempk[cell_id];
+    _sc_ck[cell_id] = ckg[cell_id];
+    _sc_abso[cell_id] = absom[cell_id];
+    _sc_emi[cell_id] = emim[cell_id];
+    _sc_demi[cell_id] = istm[cell_id] / dcp[cell_id];
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update radiative source terms without a full resolution if the
+ *        temperature and absorption coefficient did not vary too much since
+ *        the last one.
+ *
+ * The absorption and emission are proportional to the absorption
+ * coefficient for a gray gas, and the emission is linearized with respect
+ * to the temperature. The incident radiation of the last resolution is kept.
+ *
+ * \param[in]       tempk      temperature in Kelvin
+ * \param[in]       ckg        absorption coefficient
+ * \param[in]       dcp        inverse of the specific heat
+ * \param[in]       verbosity  verbosity level
+ * \param[in, out]  absom      absorption
+ * \param[in, out]  emim       emission
+ * \param[in, out]  istm       implicit source term
+ * \param[in, out]  estm       explicit source term
+ *
+ * \return  true if source terms were updated, false if a full resolution
+ *          is needed
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_subcycling_update(const cs_real_t  tempk[],
+                   const cs_real_t  ckg[],
+                   const cs_real_t  dcp[],
+                   int              verbosity,
+                   cs_real_t        absom[],
+                   cs_real_t        emim[],
+                   cs_real_t        istm[],
+                   cs_real_t        estm[])
+{
+  if (_sc_tempk == NULL)
+    return false;
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_real_t threshold = cs_glob_rad_transfer_params->subcycling_threshold;
+
+  /* Maximum relative variations of temperature and absorption coefficient */
+
+  cs_real_t delta[2] = {0., 0.};
+
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    delta[0] = CS_MAX(delta[0],
+                      CS_ABS(tempk[cell_id] - _sc_tempk[cell_id])
+                      / _sc_tempk[cell_id]);
+    delta[1] = CS_MAX(delta[1],
+                      CS_ABS(ckg[cell_id] - _sc_ck[cell_id])
+                      / CS_MAX(_sc_ck[cell_id], cs_math_epzero));
+  }
+
+  cs_parall_max(2, CS_REAL_TYPE, delta);
+
+  if (verbosity > 0)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("      Variation since the last resolution:"
+                    " temperature %10.3e, absorption coefficient %10.3e\n"),
+                  delta[0], delta[1]);
+
+  if (delta[0] > threshold || delta[1] > threshold)
+    return false;
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+    const cs_real_t ck_ratio = (_sc_ck[cell_id] > cs_math_epzero) ?
+      ckg[cell_id] / _sc_ck[cell_id] : 1.;
+
+    absom[cell_id] = ck_ratio * _sc_abso[cell_id];
+    emim[cell_id] =   ck_ratio
+                    * (  _sc_emi[cell_id]
+                       + _sc_demi[cell_id]*(tempk[cell_id]-_sc_tempk[cell_id]));
+    istm[cell_id] = ck_ratio * _sc_demi[cell_id] * dcp[cell_id];
+    estm[cell_id] = absom[cell_id] + emim[cell_id];
+
+  }
+
+  if (verbosity > 0)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("      Source terms updated without resolution\n"));
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Order linear solvers for DOM radiative model.
@@ -517,8 +968,20 @@ _cs_rad_transfer_sol(int                        gg_id,
     vcopt.nswrsm =  2;
   }
 
-  if (cs_glob_time_step->nt_cur == cs_glob_time_step->nt_prev + 1)
-    _order_by_direction();
+  /* Direct upwind sweeps (batches of directions) */
+  const bool use_sweeps = (one_dir) ? false : _use_sweeps();
+  const int n_b_max = rt_params->dir_batch_size;
+  cs_real_t *radiance_b = NULL;
+
+  if (cs_glob_time_step->nt_cur == cs_glob_time_step->nt_prev + 1) {
+    if (use_sweeps)
+      _sweep_setup();
+    else
+      _order_by_direction();
+  }
+
+  if (use_sweeps)
+    BFT_MALLOC(radiance_b, n_b_max*n_cells_ext, cs_real_t);
 
   /*                              / -> ->
    * Correct BCs to ensure : pi= /  s. n domega
@@ -708,37 +1171,59 @@ _cs_rad_transfer_sol(int                        gg_id,
           /* In case of a theta-scheme, set theta = 1;
              no relaxation in steady case either */
 
-          cs_equation_iterative_solve_scalar(0,   /* idtvar */
-                                             1,   /* external sub-iteration */
-                                             -1,  /* f_id */
-                                             cname,
-                                             0,   /* iescap */
-                                             0,   /* imucpp */
-                                             -1,  /* normp */
-                                             &vcopt,
-                                             radiance_prev,
-                                             radiance_prev,
-                                             coefap,
-                                             coefbp,
-                                             cofafp,
-                                             cofbfp,
-                                             flurds,
-                                             flurdb,
-                                             viscf,
-                                             viscb,
-                                             viscf,
-                                             viscb,
-                                             NULL,
-                                             NULL,
-                                             NULL,
-                                             0, /* icvflb (upwind) */
-                                             NULL,
-                                             rovsdt,
-                                             rhs,
-                                             radiance,
-                                             dpvar,
-                                             NULL,
-                                             NULL);
+          if (use_sweeps) {
+
+            /* Directions are solved by batches */
+            const int b_id = (kdir - 1) % n_b_max;
+            if (b_id == 0)
+              _sweep_directions(kdir - 1,
+                                CS_MIN(n_b_max, 8*rt_params->ndirs - kdir + 1),
+                                coefap,
+                                coefbp,
+                                rovsdt,
+                                rhs,
+                                vcopt.epsrsm,
+                                verbosity,
+                                radiance_b);
+
+            memcpy(radiance, radiance_b + b_id*n_cells_ext,
+                   n_cells_ext*sizeof(cs_real_t));
+
+          }
+          else {
+
+            cs_equation_iterative_solve_scalar(0,   /* idtvar */
+                                               1, /* external sub-iteration */
+                                               -1,  /* f_id */
+                                               cname,
+                                               0,   /* iescap */
+                                               0,   /* imucpp */
+                                               -1,  /* normp */
+                                               &vcopt,
+                                               radiance_prev,
+                                               radiance_prev,
+                                               coefap,
+                                               coefbp,
+                                               cofafp,
+                                               cofbfp,
+                                               flurds,
+                                               flurdb,
+                                               viscf,
+                                               viscb,
+                                               viscf,
+                                               viscb,
+                                               NULL,
+                                               NULL,
+                                               NULL,
+                                               0, /* icvflb (upwind) */
+                                               NULL,
+                                               rovsdt,
+                                               rhs,
+                                               radiance,
+                                               dpvar,
+                                               NULL,
+                                               NULL);
+          }
 
           /* Integration of fluxes and source terms
            * Increment absorption and emission for Atmo on the fly */
@@ -873,6 +1358,7 @@ _cs_rad_transfer_sol(int                        gg_id,
 
   /* Free memory */
 
+  BFT_FREE(radiance_b);
   BFT_FREE(ck_u_d);
   BFT_FREE(rhs0);
   BFT_FREE(dpvar);
@@ -1162,29 +1648,6 @@ cs_rad_transfer_solve(int               bc_type[],
     /* Radiation coefficient k of the gas phase */
     ckg[cell_id] = 0.0;
 
-    /* Bulk Implicit ST due to emission
-     * for the gas phase and the solid/droplet phase (all classes) */
-    rad_istm[cell_id] = 0.0;
-
-    /* Explicit ST due to emission and absorption */
-    rad_estm[cell_id] = 0.0;
-
-    /* Absortion: Sum, i((kg, i+kp) * Integral(Ii)dOmega):
-     * for the gas phase and the solid/droplet phase (all classes) */
-    absom[cell_id] = 0.0;
-
-    /* Emmitted radiation: Sum, i((kg, i+kp) * c_stefan * T^4 *agi):
-     * for the gas phase and the solid/droplet phase (all classes) */
-    emim[cell_id]  = 0.0;
-
-    /* radiative flux vector */
-    cpro_q[cell_id][0] = 0.0;
-    cpro_q[cell_id][1] = 0.0;
-    cpro_q[cell_id][2] = 0.0;
-
-    /* Total emitted intensity   */
-    cpro_lumin[cell_id] = 0.0;
-
     /* Radiation coefficient of the bulk phase:
      * for the gas phase and the solid/droplet phase (all classes) */
     ckmix[cell_id] = 0.0;
@@ -1374,6 +1837,76 @@ cs_rad_transfer_solve(int               bc_type[],
       dcp[cell_id] = dcp0;
   }
 
+  /* Sub-cycling: update source terms without resolution if possible */
+
+  const bool subcycling = _subcycling_allowed(n_classes);
+
+  if (subcycling) {
+
+    if (_subcycling_update(tempk, ckg, dcp, verbosity,
+                           absom, emim, rad_istm, rad_estm)) {
+
+      if (verbosity > 0)
+        cs_log_separator(CS_LOG_DEFAULT);
+
+      BFT_FREE(dcp);
+      BFT_FREE(int_rad_domega);
+      BFT_FREE(iqpato);
+      BFT_FREE(viscf);
+      BFT_FREE(viscb);
+      BFT_FREE(rhs);
+      BFT_FREE(rovsdt);
+      BFT_FREE(tempk);
+      BFT_FREE(coefap);
+      BFT_FREE(coefbp);
+      BFT_FREE(cofafp);
+      BFT_FREE(cofbfp);
+      BFT_FREE(flurds);
+      BFT_FREE(flurdb);
+      BFT_FREE(int_abso);
+      BFT_FREE(int_emi);
+      BFT_FREE(int_rad_ist);
+      BFT_FREE(ckmix);
+      BFT_FREE(twall);
+      BFT_FREE(kgi);
+      BFT_FREE(agi);
+      BFT_FREE(w_gg);
+      BFT_FREE(iqpar);
+
+      return;
+    }
+
+  }
+
+  /* Initialization of source terms for a full resolution */
+
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+    /* Bulk Implicit ST due to emission
+     * for the gas phase and the solid/droplet phase (all classes) */
+    rad_istm[cell_id] = 0.0;
+
+    /* Explicit ST due to emission and absorption */
+    rad_estm[cell_id] = 0.0;
+
+    /* Absortion: Sum, i((kg, i+kp) * Integral(Ii)dOmega):
+     * for the gas phase and the solid/droplet phase (all classes) */
+    absom[cell_id] = 0.0;
+
+    /* Emmitted radiation: Sum, i((kg, i+kp) * c_stefan * T^4 *agi):
+     * for the gas phase and the solid/droplet phase (all classes) */
+    emim[cell_id]  = 0.0;
+
+    /* radiative flux vector */
+    cpro_q[cell_id][0] = 0.0;
+    cpro_q[cell_id][1] = 0.0;
+    cpro_q[cell_id][2] = 0.0;
+
+    /* Total emitted intensity   */
+    cpro_lumin[cell_id] = 0.0;
+
+  }
+
   /* Check for transparent case => no need to compute absoption or emission */
   int idiver = rt_params->idiver;
 
@@ -1789,6 +2322,14 @@ cs_rad_transfer_solve(int               bc_type[],
 
   } /* end loop on grey gas */
 
+  /* Store the state of this resolution for sub-cycling */
+  if (subcycling) {
+    if (idiver >= 0)
+      _subcycling_store(tempk, ckg, dcp, absom, emim, rad_istm);
+    else
+      _subcycling_free();
+  }
+
   BFT_FREE(dcp);
   BFT_FREE(int_rad_domega);
 
@@ -2091,6 +2632,22 @@ cs_rad_transfer_solve(int               bc_type[],
   BFT_FREE(iqpar);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free the structures used by the direct upwind sweeps of the DOM
+ *        and by the sub-cycling of the radiative source terms.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_finalize(void)
+{
+  cs_adjacency_destroy(&_sweep_c2f);
+  BFT_FREE(_sweep_order);
+
+  _subcycling_free();
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -74,6 +74,16 @@ cs_rad_transfer_solve(int               bc_type[],
                       const cs_real_t   cp2ch[],
                       const int         ichcor[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free the structures used by the direct upwind sweeps of the DOM
+ *        and by the sub-cycling of the radiative source terms.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
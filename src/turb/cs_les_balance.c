@@ -177,6 +177,61 @@ BEGIN_C_DECLS
 
 #define DEBUG_LES 0
 
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Work arrays and cached values, allocated on first use and kept until
+   the LES balance structures are destroyed */
+
+typedef struct {
+
+  int            nt_bc;        /* time step at which boundary conditions
+                                  were last updated */
+
+  /* Boundary conditions and fluxes for divergence computation */
+
+  cs_real_3_t   *coefav;
+  cs_real_33_t  *coefbv;
+  cs_real_t     *i_massflux;
+  cs_real_t     *b_massflux;
+
+  /* Homogeneous scalar boundary conditions (Dirichlet at walls) */
+
+  cs_real_t     *coefas;
+  cs_real_t     *coefbs;
+
+  /* Boundary conditions and face viscosity for Laplacian computation,
+     for the Rij (0) and Tui (1) balances */
+
+  cs_real_t     *coefaf[2];
+  cs_real_t     *coefbf[2];
+  cs_real_t     *i_visc;
+  cs_real_t     *b_visc;
+
+  /* Generic work arrays (size: n_cells_ext) */
+
+  cs_real_3_t   *w1;
+  cs_real_t     *w2;
+  cs_real_t     *diverg;
+  cs_real_t     *lapl;
+
+  /* Divergences based on instantaneous values, updated with gradients */
+
+  bool           div_tau_ok;
+  cs_real_3_t   *div_tau;      /* div(-nu_t (d_k u_j + d_j u_k)) */
+  bool           div_nut2s_ok;
+  cs_real_3_t   *div_nut2s;    /* div(nu_t^2 (d_k u_i + d_i u_k)) */
+
+  /* Values based on time moments, updated once per time step */
+
+  int            nt_grad_nut_m;
+  cs_real_3_t   *grad_nut_m;   /* gradient of mean nu_t */
+  int            nt_div_tau_m;
+  cs_real_3_t   *div_tau_m;    /* div(-(mean nu_t d_k u_j + nu_t d_j u_k)) */
+
+} _les_balance_work_t;
+
 /*============================================================================
  * Static variables
  *============================================================================*/
@@ -219,6 +274,8 @@ static cs_field_t *_gradv   = NULL;
 static cs_field_t *_gradnut = NULL;
 static cs_field_t **_gradt  = NULL;
 
+static _les_balance_work_t  *_work = NULL;
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -251,6 +308,8 @@ _les_balance_get_tm_by_name(const char *name)
 
   for (int imom = 0; imom < n_moments; imom++) {
     f = cs_time_moment_get_field(imom);
+    if (f == NULL) /* sub-moments may not have an associated field */
+      continue;
     if (strcmp(f->name, name) == 0)
       return f;
   }
@@ -313,78 +372,238 @@ _les_balance_get_tm_by_scalar_id(int scalar_id,
   return f;
 }
 
-/*----------------------------------------------------------------------------*
- * Compute the Laplacian of a scalar.
+/*----------------------------------------------------------------------------
+ * Update boundary conditions for LES balance work structure.
  *
  * parameters:
- *   wa   <--  scalar array
- *   res  <->  Laplacian of wa
- *   type <--  called for Rij (0) or Tui (1) LES balance
+ *   w <-> pointer to work structure
  *----------------------------------------------------------------------------*/
 
 static void
-_les_balance_laplacian(cs_real_t   *wa,
-                       cs_real_t   *res,
-                       int         type)
+_les_balance_work_update_bc(_les_balance_work_t  *w)
+{
+  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
+  const int *bc_type = cs_glob_bc_type;
+
+  for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++) {
+    cs_real_t b = 1.;
+    if (   bc_type[ifac] == CS_SMOOTHWALL
+        || bc_type[ifac] == CS_ROUGHWALL)
+      b = 0.;
+    w->coefas[ifac] = 0.;
+    w->coefbs[ifac] = b;
+    for (cs_lnum_t ii = 0; ii < 3; ii++) {
+      w->coefav[ifac][ii] = 0.;
+      for (cs_lnum_t pp = 0; pp < 3; pp++)
+        w->coefbv[ifac][ii][pp] = b;
+    }
+  }
+
+  w->nt_bc = cs_glob_time_step->nt_cur;
+}
+
+/*----------------------------------------------------------------------------
+ * Return LES balance work structure, creating it if needed.
+ *
+ * Boundary conditions are updated at most once per time step.
+ *
+ * returns:
+ *   pointer to work structure
+ *----------------------------------------------------------------------------*/
+
+static _les_balance_work_t *
+_les_balance_work_get(void)
+{
+  if (_work == NULL) {
+
+    const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
+    const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
+    const cs_lnum_t n_i_faces = cs_glob_mesh->n_i_faces;
+
+    _les_balance_work_t *w;
+    BFT_MALLOC(w, 1, _les_balance_work_t);
+
+    BFT_MALLOC(w->coefav, n_b_faces, cs_real_3_t);
+    BFT_MALLOC(w->coefbv, n_b_faces, cs_real_33_t);
+    BFT_MALLOC(w->i_massflux, n_i_faces, cs_real_t);
+    BFT_MALLOC(w->b_massflux, n_b_faces, cs_real_t);
+
+    BFT_MALLOC(w->coefas, n_b_faces, cs_real_t);
+    BFT_MALLOC(w->coefbs, n_b_faces, cs_real_t);
+
+    for (int i = 0; i < 2; i++) {
+      BFT_MALLOC(w->coefaf[i], n_b_faces, cs_real_t);
+      BFT_MALLOC(w->coefbf[i], n_b_faces, cs_real_t);
+    }
+    BFT_MALLOC(w->i_visc, n_i_faces, cs_real_t);
+    BFT_MALLOC(w->b_visc, n_b_faces, cs_real_t);
+
+    BFT_MALLOC(w->w1, n_cells_ext, cs_real_3_t);
+    BFT_MALLOC(w->w2, n_cells_ext, cs_real_t);
+    BFT_MALLOC(w->diverg, n_cells_ext, cs_real_t);
+    BFT_MALLOC(w->lapl, n_cells_ext, cs_real_t);
+
+    w->div_tau_ok = false;
+    w->div_nut2s_ok = false;
+    w->div_tau = NULL;
+    w->div_nut2s = NULL;
+
+    w->nt_grad_nut_m = -1;
+    w->nt_div_tau_m = -1;
+    w->grad_nut_m = NULL;
+    w->div_tau_m = NULL;
+
+    _les_balance_work_update_bc(w);
+
+    _work = w;
+  }
+
+  else if (_work->nt_bc != cs_glob_time_step->nt_cur)
+    _les_balance_work_update_bc(_work);
+
+  return _work;
+}
+
+/*----------------------------------------------------------------------------
+ * Free LES balance work structure.
+ *----------------------------------------------------------------------------*/
+
+static void
+_les_balance_work_destroy(void)
+{
+  _les_balance_work_t *w = _work;
+
+  if (w == NULL)
+    return;
+
+  BFT_FREE(w->coefav);
+  BFT_FREE(w->coefbv);
+  BFT_FREE(w->i_massflux);
+  BFT_FREE(w->b_massflux);
+
+  BFT_FREE(w->coefas);
+  BFT_FREE(w->coefbs);
+
+  for (int i = 0; i < 2; i++) {
+    BFT_FREE(w->coefaf[i]);
+    BFT_FREE(w->coefbf[i]);
+  }
+  BFT_FREE(w->i_visc);
+  BFT_FREE(w->b_visc);
+
+  BFT_FREE(w->w1);
+  BFT_FREE(w->w2);
+  BFT_FREE(w->diverg);
+  BFT_FREE(w->lapl);
+
+  BFT_FREE(w->div_tau);
+  BFT_FREE(w->div_nut2s);
+  BFT_FREE(w->grad_nut_m);
+  BFT_FREE(w->div_tau_m);
+
+  BFT_FREE(_work);
+}
+
+/*----------------------------------------------------------------------------
+ * Update boundary conditions and face viscosity used for the Laplacian.
+ *
+ * This depends only on the mesh and boundary types, so it is done once
+ * per balance computation rather than for each Laplacian.
+ *----------------------------------------------------------------------------*/
+
+static void
+_les_balance_laplacian_setup(void)
 {
   const cs_mesh_t *m = cs_glob_mesh;
   cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
-  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_b_faces = m->n_b_faces;
-  const cs_lnum_t n_i_faces = m->n_i_faces;
 
   const int *bc_type = cs_glob_bc_type;
 
-  cs_real_t *coefaf, *coefbf;
-  BFT_MALLOC(coefaf, n_b_faces, cs_real_t);
-  BFT_MALLOC(coefbf, n_b_faces, cs_real_t);
+  _les_balance_work_t *w = _les_balance_work_get();
 
   const cs_real_t visc = 1., pimp = 0., qimp = 0., hext = -1;
   cs_real_t a, b;
 
-  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
-    cs_real_t hint = visc / fvq->b_dist[face_id];
+  for (int type = 0; type < 2; type++) {
 
-    if (   type == 0
-        && (   bc_type[face_id] == CS_SMOOTHWALL
-            || bc_type[face_id] == CS_ROUGHWALL) )
-      cs_boundary_conditions_set_dirichlet_scalar(&a,
+    cs_real_t *coefaf = w->coefaf[type];
+    cs_real_t *coefbf = w->coefbf[type];
+
+    for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+      cs_real_t hint = visc / fvq->b_dist[face_id];
+
+      if (   type == 0
+          && (   bc_type[face_id] == CS_SMOOTHWALL
+              || bc_type[face_id] == CS_ROUGHWALL) )
+        cs_boundary_conditions_set_dirichlet_scalar(&a,
+                                                    &coefaf[face_id],
+                                                    &b,
+                                                    &coefbf[face_id],
+                                                    pimp,
+                                                    hint,
+                                                    hext);
+      else
+        cs_boundary_conditions_set_neumann_scalar(&a,
                                                   &coefaf[face_id],
                                                   &b,
                                                   &coefbf[face_id],
-                                                  pimp,
-                                                  hint,
-                                                  hext);
-    else
-      cs_boundary_conditions_set_neumann_scalar(&a,
-                                                &coefaf[face_id],
-                                                &b,
-                                                &coefbf[face_id],
-                                                qimp,
-                                                hint);
-  }
-
-  cs_real_t *c_visc, *i_visc, *b_visc;
-  BFT_MALLOC(c_visc, n_cells_ext, cs_real_t);
+                                                  qimp,
+                                                  hint);
+    }
+
+  }
+
+  /* Use the Laplacian work array for cell viscosity */
+
+  cs_real_t *c_visc = w->lapl;
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
     c_visc[c_id] = visc;
 
-  BFT_MALLOC(i_visc, n_i_faces, cs_real_t);
-  BFT_MALLOC(b_visc, n_b_faces, cs_real_t);
   cs_face_viscosity(m,
                     fvq,
                     0,      /* mean type */
                     c_visc,
-                    i_visc,
-                    b_visc);
-  BFT_FREE(c_visc);
+                    w->i_visc,
+                    w->b_visc);
+}
+
+/*----------------------------------------------------------------------------*
+ * Compute the Laplacian of a scalar.
+ *
+ * parameters:
+ *   wa   <--  scalar array
+ *   res  <->  Laplacian of wa
+ *   type <--  called for Rij (0) or Tui (1) LES balance
+ *
+ * Boundary conditions and face viscosity must have been updated using
+ * _les_balance_laplacian_setup.
+ *----------------------------------------------------------------------------*/
+
+static void
+_les_balance_laplacian(cs_real_t   *wa,
+                       cs_real_t   *res,
+                       int         type)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  const _les_balance_work_t *w = _work;
+
+  cs_real_t *coefaf = w->coefaf[type];
+  cs_real_t *coefbf = w->coefbf[type];
+  cs_real_t *i_visc = w->i_visc;
+  cs_real_t *b_visc = w->b_visc;
 
   const cs_equation_param_t *eqp = cs_field_get_equation_param_const(CS_F_(vel));
   cs_equation_param_t _eqp = *eqp;
   _eqp.iconv = 0; /* only diffusion */
   _eqp.thetav = 1.;
 
+  /* The right-hand side is incremented, so start from zero */
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    res[c_id] = 0.;
+
   cs_convection_diffusion_scalar(0,           /* idtvar */
                                  -1,          /* f_id */
                                  _eqp,
@@ -405,11 +624,6 @@ _les_balance_laplacian(cs_real_t   *wa,
                                  b_visc,
                                  res);
 
-  BFT_FREE(coefaf);
-  BFT_FREE(coefbf);
-  BFT_FREE(i_visc);
-  BFT_FREE(b_visc);
-
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
     res[c_id] /= cs_glob_mesh_quantities->cell_f_vol[c_id];
 }
@@ -420,31 +634,24 @@ _les_balance_laplacian(cs_real_t   *wa,
  * Computation options are the ones of the velocity
  *
  * parameters:
- *   wa   <--  vector array
+ *   wa   <--  vector array (size: n_cells_ext)
  *   res  <->  divergence of wa
  *----------------------------------------------------------------------------*/
 
- static void
- _les_balance_divergence_vector(cs_real_3_t  *wa,
-                                cs_real_t    *res)
+static void
+_les_balance_divergence_vector(cs_real_3_t  *wa,
+                               cs_real_t    *res)
 {
   const cs_mesh_t *m = cs_glob_mesh;
   cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
-  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
-  const cs_lnum_t n_i_faces = cs_glob_mesh->n_i_faces;
-  const int *bc_type = cs_glob_bc_type;
   int f_id, itypfl, iflmb0, init, inc;
 
-  cs_real_t *i_massflux, *b_massflux;
-  cs_real_3_t *coefav;
-  cs_real_33_t *coefbv;
-
   const cs_equation_param_t *eqp = cs_field_get_equation_param_const(CS_F_(vel));
 
-  BFT_MALLOC(coefbv, n_b_faces, cs_real_33_t);
-  BFT_MALLOC(coefav, n_b_faces, cs_real_3_t);
-  BFT_MALLOC(i_massflux, n_i_faces, cs_real_t);
-  BFT_MALLOC(b_massflux, n_b_faces, cs_real_t);
+  _les_balance_work_t *w = _les_balance_work_get();
+
+  cs_real_t *i_massflux = w->i_massflux;
+  cs_real_t *b_massflux = w->b_massflux;
 
   f_id = -1;
   itypfl = 0;
@@ -452,20 +659,6 @@ _les_balance_laplacian(cs_real_t   *wa,
   init = 1;
   inc = 1;
 
-  /* Bc coeffs */
-  for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++) {
-    for (cs_lnum_t ii = 0; ii < 3; ii++) {
-        coefav[ifac][ii] = 0.;
-        for (cs_lnum_t pp = 0; pp < 3; pp++) {
-          if (bc_type[ifac] == CS_SMOOTHWALL
-           || bc_type[ifac] == CS_ROUGHWALL)
-            coefbv[ifac][ii][pp] = 0.;
-          else
-            coefbv[ifac][ii][pp] = 1.;
-      }
-    }
-  }
-
   cs_mass_flux(m,
                mq,
                f_id,
@@ -482,8 +675,8 @@ _les_balance_laplacian(cs_real_t   *wa,
                NULL,
                NULL,
                (const cs_real_3_t *)wa,
-               (const cs_real_3_t *)coefav,
-               (const cs_real_33_t *)coefbv,
+               (const cs_real_3_t *)w->coefav,
+               (const cs_real_33_t *)w->coefbv,
                i_massflux,
                b_massflux);
 
@@ -492,11 +685,6 @@ _les_balance_laplacian(cs_real_t   *wa,
                 i_massflux,
                 b_massflux,
                 res);
-
-  BFT_FREE(coefav);
-  BFT_FREE(coefbv);
-  BFT_FREE(i_massflux);
-  BFT_FREE(b_massflux);
 }
 
 /*----------------------------------------------------------------------------
@@ -506,11 +694,14 @@ _les_balance_laplacian(cs_real_t   *wa,
 static void
 _les_balance_compute_gradients(void)
 {
-  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
-  const int *bc_type = cs_glob_bc_type;
   const cs_equation_param_t *eqp = cs_field_get_equation_param_const(CS_F_(vel));
 
-  cs_real_t *coefas, *coefbs;
+  _les_balance_work_t *w = _les_balance_work_get();
+
+  /* Divergences based on previous gradients are now outdated */
+
+  w->div_tau_ok = false;
+  w->div_nut2s_ok = false;
 
   cs_halo_type_t halo_type;
   cs_gradient_type_t gradient_type;
@@ -533,19 +724,6 @@ _les_balance_compute_gradients(void)
   if (_les_balance.type & CS_LES_BALANCE_RIJ_FULL ||
       _les_balance.type & CS_LES_BALANCE_TUI_FULL) {
 
-    BFT_MALLOC(coefas, n_b_faces, cs_real_t);
-    BFT_MALLOC(coefbs, n_b_faces, cs_real_t);
-
-    /* Bc coeffs */
-    for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++) {
-      coefas[ifac] = 0.;
-      if (bc_type[ifac] == CS_SMOOTHWALL
-       || bc_type[ifac] == CS_ROUGHWALL)
-        coefbs[ifac] = 0.;
-      else
-        coefbs[ifac] = 1.;
-    }
-
     cs_gradient_scalar("nu_t",
                        gradient_type,
                        halo_type,
@@ -560,15 +738,12 @@ _les_balance_compute_gradients(void)
                        eqp->epsrgr,
                        eqp->climgr,
                        NULL,
-                       coefas,
-                       coefbs,
+                       w->coefas,
+                       w->coefbs,
                        CS_F_(mu_t)->val,
                        NULL,
                        NULL,
                        (cs_real_3_t *)_gradnut->val);
-
-    BFT_FREE(coefas);
-    BFT_FREE(coefbs);
   }
 
   /* Computation of scalar gradients */
@@ -599,6 +774,100 @@ _les_balance_compute_gradients(void)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return divergence of the SGS stress -nu_t (d_k u_j + d_j u_k), for
+ * each j, computing it if not already done since the last gradients update.
+ *
+ * This is shared by all time moments requiring it.
+ *
+ * returns:
+ *   pointer to divergence of SGS stress (size: n_cells_ext)
+ *----------------------------------------------------------------------------*/
+
+static const cs_real_3_t *
+_les_balance_div_tau(void)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
+
+  _les_balance_work_t *w = _les_balance_work_get();
+
+  if (w->div_tau_ok)
+    return (const cs_real_3_t *)w->div_tau;
+
+  if (w->div_tau == NULL)
+    BFT_MALLOC(w->div_tau, n_cells_ext, cs_real_3_t);
+
+  const cs_real_t *mu_t = CS_F_(mu_t)->val;
+  const cs_real_33_t *grdv = (const cs_real_33_t *)_gradv->val;
+  cs_real_3_t *w1 = w->w1;
+  cs_real_t *diverg = w->diverg;
+
+  for (cs_lnum_t j = 0; j < 3; j++) {
+
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+      for (cs_lnum_t k = 0; k < 3; k++)
+        w1[iel][k] = -mu_t[iel]*(grdv[iel][j][k] + grdv[iel][k][j]);
+
+    _les_balance_divergence_vector(w1, diverg);
+
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+      w->div_tau[iel][j] = diverg[iel];
+  }
+
+  w->div_tau_ok = true;
+
+  return (const cs_real_3_t *)w->div_tau;
+}
+
+/*----------------------------------------------------------------------------
+ * Return divergence of nu_t^2 (d_k u_i + d_i u_k), for each i, computing
+ * it if not already done since the last gradients update.
+ *
+ * This is shared by all scalars (the turbulent Schmidt number being
+ * applied by the caller).
+ *
+ * returns:
+ *   pointer to divergence (size: n_cells_ext)
+ *----------------------------------------------------------------------------*/
+
+static const cs_real_3_t *
+_les_balance_div_nut2s(void)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
+
+  _les_balance_work_t *w = _les_balance_work_get();
+
+  if (w->div_nut2s_ok)
+    return (const cs_real_3_t *)w->div_nut2s;
+
+  if (w->div_nut2s == NULL)
+    BFT_MALLOC(w->div_nut2s, n_cells_ext, cs_real_3_t);
+
+  const cs_real_t *mu_t = CS_F_(mu_t)->val;
+  const cs_real_33_t *grdv = (const cs_real_33_t *)_gradv->val;
+  cs_real_3_t *w1 = w->w1;
+  cs_real_t *diverg = w->diverg;
+
+  for (cs_lnum_t i = 0; i < 3; i++) {
+
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+      for (cs_lnum_t k = 0; k < 3; k++)
+        w1[iel][k] =  cs_math_sq(mu_t[iel])
+                     *(grdv[iel][i][k] + grdv[iel][k][i]);
+
+    _les_balance_divergence_vector(w1, diverg);
+
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+      w->div_nut2s[iel][i] = diverg[iel];
+  }
+
+  w->div_nut2s_ok = true;
+
+  return (const cs_real_3_t *)w->div_nut2s;
+}
+
 /*----------------------------------------------------------------------------
  * Function which computes the pressure times the velocity gradient.
  *
@@ -693,41 +962,20 @@ _les_balance_compute_dkuidkuj(const void   *input,
 
 static void
 _les_balance_compute_uidktaujk(const void   *input,
-                                 cs_real_t    *vals)
+                               cs_real_t    *vals)
 {
-  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
   const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
 
   CS_UNUSED(input);
 
-  cs_real_t *diverg;
-  cs_real_3_t *vel, *velocity;
-
-  velocity = (cs_real_3_t *)CS_F_(vel)->val;
-
-  BFT_MALLOC(diverg, n_cells_ext, cs_real_t);
-  BFT_MALLOC(vel, n_cells, cs_real_3_t);
-
-  cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
-
-  for (cs_lnum_t i = 0; i < 3; i++) {
-
-    for (cs_lnum_t j = 0; j < 3; j++) {
-
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-        for (cs_lnum_t k = 0; k < 3; k++)
-          vel[iel][k] = -CS_F_(mu_t)->val[iel]*( grdv[iel][j][k]
-                                                +grdv[iel][k][j]);
-
-      _les_balance_divergence_vector(vel, diverg);
+  const cs_real_3_t *velocity = (const cs_real_3_t *)CS_F_(vel)->val;
+  const cs_real_3_t *div_tau = _les_balance_div_tau();
 
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-        vals[9*iel+i*3+j] = velocity[iel][i]*diverg[iel];
-    }
+  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+    for (cs_lnum_t i = 0; i < 3; i++)
+      for (cs_lnum_t j = 0; j < 3; j++)
+        vals[9*iel+i*3+j] = velocity[iel][i]*div_tau[iel][j];
   }
-
-  BFT_FREE(diverg);
-  BFT_FREE(vel);
 }
 
 /*----------------------------------------------------------------------------
@@ -1044,42 +1292,13 @@ _les_balance_compute_tdjtauij(const void   *input,
                               cs_real_t    *vals)
 {
   const cs_field_t *sca = (const cs_field_t *)input;
-  const int keysca = cs_field_key_id("scalar_id");
-  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
   const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-  int isca = 0;
-
-  for (int f_id = 0; f_id < cs_field_n_fields(); f_id++) {
-    cs_field_t *f = cs_field_by_id(f_id);
-    if (cs_field_get_key_int(f, keysca) > 0) {
-      if (f_id == sca->id)
-        break;
-      isca++;
-    }
-  }
-
-  cs_real_t *diverg;
-  cs_real_3_t *w1;
 
-  BFT_MALLOC(diverg, n_cells_ext, cs_real_t);
-  BFT_MALLOC(w1, n_cells, cs_real_3_t);
+  const cs_real_3_t *div_tau = _les_balance_div_tau();
 
-  cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
-
-  for (cs_lnum_t i = 0; i < 3; i++) {
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-      for (cs_lnum_t k = 0; k < 3; k++)
-        w1[iel][k] = -CS_F_(mu_t)->val[iel]*( grdv[iel][i][k]
-                                             +grdv[iel][k][i]);
-
-    _les_balance_divergence_vector(w1, diverg);
-
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-      vals[3*iel+i] = sca->val[iel]*diverg[iel];
-  }
-
-  BFT_FREE(diverg);
-  BFT_FREE(w1);
+  for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+    for (cs_lnum_t i = 0; i < 3; i++)
+      vals[3*iel+i] = sca->val[iel]*div_tau[iel][i];
 }
 
 /*----------------------------------------------------------------------------
@@ -1096,45 +1315,16 @@ _les_balance_compute_uidivturflux(const void   *input,
 {
   const cs_field_t *sca = (const cs_field_t *)input;
   const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
-  const int keysca = cs_field_key_id("scalar_id");
   const int ksigmas = cs_field_key_id("turbulent_schmidt");
-  int isca = 0;
 
-  for (int f_id = 0; f_id < cs_field_n_fields(); f_id++) {
-    cs_field_t *f = cs_field_by_id(f_id);
-    if (cs_field_get_key_int(f, keysca) > 0) {
-      if (f_id == sca->id)
-        break;
-      isca++;
-    }
-  }
-
-  cs_real_t sigmas, *diverg;
-  cs_real_3_t *w1, *vel;
-
-  vel = (cs_real_3_t *)CS_F_(vel)->val;
-  sigmas = cs_field_get_key_double(sca, ksigmas);
+  const cs_real_3_t *vel = (const cs_real_3_t *)CS_F_(vel)->val;
+  const cs_real_t sigmas = cs_field_get_key_double(sca, ksigmas);
 
-  BFT_MALLOC(diverg, n_cells_ext, cs_real_t);
-  BFT_MALLOC(w1, n_cells, cs_real_3_t);
+  const cs_real_3_t *div_nut2s = _les_balance_div_nut2s();
 
-  cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
-
-  for (cs_lnum_t i = 0; i < 3; i++) {
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-      for (cs_lnum_t k = 0; k < 3; k++)
-        w1[iel][k] =  cs_math_sq(CS_F_(mu_t)->val[iel])/sigmas
-                     *(grdv[iel][i][k]+grdv[iel][k][i]);
-
-    _les_balance_divergence_vector(w1, diverg);
-
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-      vals[3*iel+i] = vel[iel][i]*diverg[iel];
-  }
-
-  BFT_FREE(diverg);
-  BFT_FREE(w1);
+  for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+    for (cs_lnum_t i = 0; i < 3; i++)
+      vals[3*iel+i] = vel[iel][i]*div_nut2s[iel][i]/sigmas;
 }
 
 /*----------------------------------------------------------------------------
@@ -1151,44 +1341,16 @@ _les_balance_compute_tdivturflux(const void   *input,
 {
   const cs_field_t *sca = (const cs_field_t *)input;
   const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
-  const int keysca = cs_field_key_id("scalar_id");
   const int ksigmas = cs_field_key_id("turbulent_schmidt");
-  int isca = 0;
 
-  for (int f_id = 0; f_id < cs_field_n_fields(); f_id++) {
-    cs_field_t *f = cs_field_by_id(f_id);
-    if (cs_field_get_key_int(f, keysca) > 0) {
-      if (f_id == sca->id)
-        break;
-      isca++;
-    }
-  }
-
-  cs_real_t sigmas, *diverg;
-  cs_real_3_t *w1;
+  const cs_real_t sigmas = cs_field_get_key_double(sca, ksigmas);
 
-  sigmas = cs_field_get_key_double(sca, ksigmas);
-
-  BFT_MALLOC(diverg, n_cells_ext, cs_real_t);
-  BFT_MALLOC(w1, n_cells, cs_real_3_t);
-
-  cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
-
-  /* TODO : bug dans le fortran, boucle sur ii ? */
-  for (cs_lnum_t i = 0; i < 3; i++)
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-      for (cs_lnum_t k = 0; k < 3; k++)
-        w1[iel][k] =  cs_math_sq(CS_F_(mu_t)->val[iel])/sigmas
-                     *(grdv[iel][i][k]+grdv[iel][k][i]);
-
-  _les_balance_divergence_vector(w1, diverg);
+  const cs_real_3_t *div_nut2s = _les_balance_div_nut2s();
 
+  /* TODO : bug dans le fortran, boucle sur ii ?
+     (only the last direction is used here) */
   for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-    vals[iel] = sca->val[iel]*diverg[iel];
-
-  BFT_FREE(diverg);
-  BFT_FREE(w1);
+    vals[iel] = sca->val[iel]*div_nut2s[iel][2]/sigmas;
 }
 
 /*----------------------------------------------------------------------------
@@ -1369,6 +1531,115 @@ _les_balance_compute_djnuttdiuj(const void   *input,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return gradient of the mean turbulent viscosity, computing it if not
+ * already done at the current time step.
+ *
+ * This is shared by the Rij and all Tui balances.
+ *
+ * returns:
+ *   pointer to gradient of mean turbulent viscosity (size: n_cells_ext)
+ *----------------------------------------------------------------------------*/
+
+static const cs_real_3_t *
+_les_balance_grad_nut_m(void)
+{
+  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  _les_balance_work_t *w = _les_balance_work_get();
+
+  if (w->nt_grad_nut_m == nt_cur)
+    return (const cs_real_3_t *)w->grad_nut_m;
+
+  if (w->grad_nut_m == NULL)
+    BFT_MALLOC(w->grad_nut_m, n_cells_ext, cs_real_3_t);
+
+  const cs_equation_param_t *eqp = cs_field_get_equation_param_const(CS_F_(vel));
+
+  cs_halo_type_t halo_type;
+  cs_gradient_type_t gradient_type;
+
+  cs_gradient_type_by_imrgra(eqp->imrgra,
+                             &gradient_type,
+                             &halo_type);
+
+  cs_real_t *nut = _les_balance_get_tm_by_name("nut_m")->val;
+
+  cs_gradient_scalar("nu_t",
+                     gradient_type,
+                     halo_type,
+                     1,     /* inc */
+                     true,
+                     eqp->nswrgr,
+                     0,
+                     0,
+                     1,
+                     eqp->verbosity,
+                     eqp->imligr,
+                     eqp->epsrgr,
+                     eqp->climgr,
+                     NULL,
+                     w->coefas,
+                     w->coefbs,
+                     nut,
+                     NULL,
+                     NULL,
+                     w->grad_nut_m);
+
+  w->nt_grad_nut_m = nt_cur;
+
+  return (const cs_real_3_t *)w->grad_nut_m;
+}
+
+/*----------------------------------------------------------------------------
+ * Return divergence of the mean SGS stress
+ * -(mean(nu_t d_k u_j) + mean(nu_t d_j u_k)), for each j, computing it if
+ * not already done at the current time step.
+ *
+ * This is shared by the Rij and all Tui balances.
+ *
+ * returns:
+ *   pointer to divergence of mean SGS stress (size: n_cells_ext)
+ *----------------------------------------------------------------------------*/
+
+static const cs_real_3_t *
+_les_balance_div_tau_m(void)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  _les_balance_work_t *w = _les_balance_work_get();
+
+  if (w->nt_div_tau_m == nt_cur)
+    return (const cs_real_3_t *)w->div_tau_m;
+
+  if (w->div_tau_m == NULL)
+    BFT_MALLOC(w->div_tau_m, n_cells_ext, cs_real_3_t);
+
+  const cs_real_33_t *nutduidxj
+    = (const cs_real_33_t *)_les_balance_get_tm_by_name("nutdjui_m")->val;
+  cs_real_3_t *w1 = w->w1;
+  cs_real_t *diverg = w->diverg;
+
+  for (cs_lnum_t j = 0; j < 3; j++) {
+
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+      for (cs_lnum_t kk = 0; kk < 3; kk++)
+        w1[iel][kk] = -nutduidxj[iel][j][kk] - nutduidxj[iel][kk][j];
+
+    _les_balance_divergence_vector(w1, diverg);
+
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+      w->div_tau_m[iel][j] = diverg[iel];
+  }
+
+  w->nt_div_tau_m = nt_cur;
+
+  return (const cs_real_3_t *)w->div_tau_m;
+}
+
 /*----------------------------------------------------------------------------
  * Declare generic time moments for either the Rij or the Tui LES balance.
  * Time moments are defined either by field ids or by function.
@@ -2829,13 +3100,6 @@ void
 cs_les_balance_compute_rij(void)
 {
   const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
-  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
-
-  const cs_equation_param_t *eqp = cs_field_get_equation_param_const(CS_F_(vel));
-
-  cs_halo_type_t halo_type;
-  cs_gradient_type_t gradient_type;
 
   /* Rij balance structure */
   cs_les_balance_rij_t *brij = _les_balance.brij;
@@ -2879,14 +3143,13 @@ cs_les_balance_compute_rij(void)
   }
 
   /* Get the triple corrleations mean UiUjUk */
-  cs_real_t **uiujuk;
-  BFT_MALLOC(uiujuk, 10, cs_real_t*);
+  cs_real_t *uiujuk[10];
 
   uiujuk[0] = cs_field_by_name("u1u2u3_m")->val;
   uiujuk[1] = cs_field_by_name("u1u1u1_m")->val;
   uiujuk[2] = cs_field_by_name("u1u1u2_m")->val;
   uiujuk[3] = cs_field_by_name("u1u1u3_m")->val;
-  uiujuk[3] = cs_field_by_name("u2u2u1_m")->val;
+  uiujuk[4] = cs_field_by_name("u2u2u1_m")->val;
   uiujuk[5] = cs_field_by_name("u2u2u2_m")->val;
   uiujuk[6] = cs_field_by_name("u2u2u3_m")->val;
   uiujuk[7] = cs_field_by_name("u3u3u1_m")->val;
@@ -2894,10 +3157,8 @@ cs_les_balance_compute_rij(void)
   uiujuk[9] = cs_field_by_name("u3u3u3_m")->val;
 
   /* Get additional averaged fields */
-  cs_real_6_t  **nutdkuiuj;
-  cs_real_33_t **uidujdxk;
-  BFT_MALLOC(nutdkuiuj, 3, cs_real_6_t*);
-  BFT_MALLOC(uidujdxk, 3, cs_real_33_t*);
+  cs_real_6_t  *nutdkuiuj[3] = {NULL, NULL, NULL};
+  cs_real_33_t *uidujdxk[3] = {NULL, NULL, NULL};
 
   if (_les_balance.type & CS_LES_BALANCE_RIJ_FULL) {
     nutdkuiuj[0] = (cs_real_6_t *)cs_field_by_name("nutd1uiuj_m")->val;
@@ -2909,52 +3170,27 @@ cs_les_balance_compute_rij(void)
     uidujdxk[2] = (cs_real_33_t *)cs_field_by_name("u3dkuj_m")->val;
   }
 
-  /* Working arrays */
-  cs_real_t *diverg, *w2, *lapl;
-  cs_real_t *coefas, *coefbs;
-  cs_real_3_t *w1, *w3;
+  /* Working arrays (shared, allocated once) */
+  _les_balance_work_t *w = _les_balance_work_get();
+
+  cs_real_t *diverg = w->diverg, *w2 = w->w2, *lapl = w->lapl;
+  cs_real_3_t *w1 = w->w1;
 
   cs_real_t dtref = cs_glob_time_step->dt_ref;
   cs_real_t ro0 = cs_glob_fluid_properties->ro0;
   cs_real_t viscl0 = cs_glob_fluid_properties->viscl0;
-  int i, j, jj, ll, jjj, kkk, lll, inc;
+  int i, j, jj, ll, jjj, kkk, lll;
 
-  const int *bc_type = cs_glob_bc_type;
-
-  inc = 1;
-
-  cs_gradient_type_by_imrgra(eqp->imrgra,
-                             &gradient_type,
-                             &halo_type);
-
-  /* Working arrays memory allocation */
-  BFT_MALLOC(w1, n_cells, cs_real_3_t);
-  BFT_MALLOC(w2, n_cells_ext, cs_real_t);
-  BFT_MALLOC(w3, n_cells_ext, cs_real_3_t);
-  BFT_MALLOC(coefbs, n_b_faces, cs_real_t);
-  BFT_MALLOC(coefas, n_b_faces, cs_real_t);
-  BFT_MALLOC(diverg, n_cells_ext, cs_real_t);
-  BFT_MALLOC(lapl, n_cells_ext, cs_real_t);
+  _les_balance_laplacian_setup();
 
+  /* unstij, epsij, prodij, phiij (single sweep) */
   for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-    for (cs_lnum_t iii = 0; iii < 6; iii++) {
-      brij->prodij[iel][iii]    = 0.;
-      brij->epsij[iel][iii]     = 0.;
-      brij->phiij[iel][iii]     = 0.;
-      brij->difftij[iel][iii]   = 0.;
-      brij->difftpij[iel][iii]  = 0.;
-      brij->convij[iel][iii]    = 0.;
-      brij->difflamij[iel][iii] = 0.;
-    }
-  }
-
-  /* unstij, epsij, prodij, phiij */
-  for (cs_lnum_t ii = 0; ii < 6; ii++) {
-    i = idirtens[ii][0];
-    j = idirtens[ii][1];
+    for (cs_lnum_t ii = 0; ii < 6; ii++) {
+      i = idirtens[ii][0];
+      j = idirtens[ii][1];
 
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
       brij->unstij[iel][ii] = (rij[iel][ii] - brij->unstij[iel][ii])/dtref;
+      brij->prodij[iel][ii] = 0.;
       brij->epsij[iel][ii] = duidxkdujdxk[iel][ii];
 
       for (cs_lnum_t kk = 0; kk < 3; kk++) {
@@ -3038,29 +3274,19 @@ cs_les_balance_compute_rij(void)
 
   if (_les_balance.type & CS_LES_BALANCE_RIJ_BASE) {
 
-    for (cs_lnum_t iii = 0; iii < 6; iii++) {
-      i = idirtens[iii][0];
-      j = idirtens[iii][1];
-
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          w1[iel][kk] = -nutduidxj[iel][j][kk] - nutduidxj[iel][kk][j];
+    /* Divergences only depend on one direction,
+       so are computed once for all components */
+    const cs_real_3_t *div_tau_m = _les_balance_div_tau_m();
 
-      _les_balance_divergence_vector(w1, diverg);
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+      for (cs_lnum_t iii = 0; iii < 6; iii++) {
+        i = idirtens[iii][0];
+        j = idirtens[iii][1];
 
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
         brij->budsgsij[iel][iii]
-          = -(uidtaujkdxk[iel][i][j]-ui[iel][i]*diverg[iel]);
-
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          w1[iel][kk] = -nutduidxj[iel][i][kk] - nutduidxj[iel][kk][i];
-
-      _les_balance_divergence_vector(w1, diverg);
-
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+          = -(uidtaujkdxk[iel][i][j]-ui[iel][i]*div_tau_m[iel][j]);
         brij->budsgsij[iel][iii] -= (  uidtaujkdxk[iel][j][i]
-                                     - ui[iel][j]*diverg[iel]);
+                                     - ui[iel][j]*div_tau_m[iel][i]);
         brij->budsgsij[iel][iii] /= ro0;
       }
     }
@@ -3125,36 +3351,8 @@ cs_les_balance_compute_rij(void)
       }
     }
 
-    /* Bc coeffs */
-    for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++) {
-      coefas[ifac] = 0.;
-      if (bc_type[ifac] == CS_SMOOTHWALL
-       || bc_type[ifac] == CS_ROUGHWALL)
-        coefbs[ifac] = 0.;
-      else
-        coefbs[ifac] = 1.;
-    }
-
-    cs_gradient_scalar("nu_t",
-                       gradient_type,
-                       halo_type,
-                       inc,
-                       true,
-                       eqp->nswrgr,
-                       0,
-                       0,
-                       1,
-                       eqp->verbosity,
-                       eqp->imligr,
-                       eqp->epsrgr,
-                       eqp->climgr,
-                       NULL,
-                       coefas,
-                       coefbs,
-                       nut,
-                       NULL,
-                       NULL,
-                       w3);
+    /* Gradient of mean nu_t (shared with Tui balances) */
+    const cs_real_3_t *w3 = _les_balance_grad_nut_m();
 
     for (cs_lnum_t iii = 0; iii < 6; iii++) {
       i = idirtens[iii][0];
@@ -3238,17 +3436,6 @@ cs_les_balance_compute_rij(void)
     }
   }
 
-  BFT_FREE(uiujuk);
-  BFT_FREE(nutdkuiuj);
-  BFT_FREE(uidujdxk);
-
-  BFT_FREE(w1);
-  BFT_FREE(w2);
-  BFT_FREE(w3);
-  BFT_FREE(coefas);
-  BFT_FREE(coefbs);
-  BFT_FREE(diverg);
-  BFT_FREE(lapl);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3261,19 +3448,8 @@ void
 cs_les_balance_compute_tui(void)
 {
   const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
-  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
   const int kvisls0 = cs_field_key_id("diffusivity_ref");
   const int ksigmas = cs_field_key_id("turbulent_schmidt");
-  const int *bc_type = cs_glob_bc_type;
-
-  cs_halo_type_t halo_type;
-  cs_gradient_type_t gradient_type;
-  const cs_equation_param_t *eqp = cs_field_get_equation_param_const(CS_F_(vel));
-
-  cs_gradient_type_by_imrgra(eqp->imrgra,
-                             &gradient_type,
-                             &halo_type);
 
   cs_real_t *tdivturflux, *nut, *nutt, *nutdtdxidtdxi;
   cs_real_3_t *nutdtdxi, *uidivturflux, *tdtauijdxj;
@@ -3305,17 +3481,22 @@ cs_les_balance_compute_tui(void)
 
   cs_real_t wvar, xx;
 
-  /* Working local arrays */
-  cs_real_t *diverg, *lapl, *w2;
-  cs_real_t *coefas, *coefbs;
-  cs_real_3_t *w1;
+  /* Working arrays (shared, allocated once) */
+  _les_balance_work_t *w = _les_balance_work_get();
+
+  cs_real_t *diverg = w->diverg, *lapl = w->lapl, *w2 = w->w2;
+  cs_real_3_t *w1 = w->w1;
+
+  _les_balance_laplacian_setup();
 
-  BFT_MALLOC(w1    , n_cells_ext, cs_real_3_t);
-  BFT_MALLOC(w2    , n_cells_ext, cs_real_t);
-  BFT_MALLOC(diverg, n_cells_ext, cs_real_t);
-  BFT_MALLOC(lapl  , n_cells_ext, cs_real_t);
-  BFT_MALLOC(coefbs, n_b_faces  , cs_real_t);
-  BFT_MALLOC(coefas, n_b_faces  , cs_real_t);
+  /* Values shared by all scalars */
+  const cs_real_3_t *div_tau_m = NULL, *grad_nut_m = NULL;
+
+  if (_les_balance.type & CS_LES_BALANCE_TUI_BASE)
+    div_tau_m = _les_balance_div_tau_m();
+
+  if (_les_balance.type & CS_LES_BALANCE_TUI_FULL)
+    grad_nut_m = _les_balance_grad_nut_m();
 
   /* For each scalar */
   for (int isca = 0; isca < nscal; isca++) {
@@ -3387,28 +3568,12 @@ cs_les_balance_compute_tui(void)
       nutdtdxi
         = (cs_real_3_t  *)_les_balance_get_tm_by_scalar_id(isca, "nutdit_m")->val;
 
-    /* Initialization */
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-      for (cs_lnum_t ii = 0; ii < 3; ii++) {
-        b_sca->prodtUi[iel][ii]   = 0.;
-        b_sca->prodtTi[iel][ii]   = 0.;
-        b_sca->phiti[iel][ii]     = 0.;
-        b_sca->epsti[iel][ii]     = 0.;
-        b_sca->difftti[iel][ii]   = 0.;
-        b_sca->diffttpi[iel][ii]  = 0.;
-        b_sca->convti[iel][ii]    = 0.;
-        b_sca->difflamti[iel][ii] = 0.;
-      }
-    }
-
-    /* tptp */
+    /* tptp, unstti, prodtUi, prodtTi, epsti, phiti (single sweep) */
     for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
       b_sca->tptp[iel] = t2[iel] - cs_math_sq(t[iel]);
       for (cs_lnum_t ii = 0; ii < 3; ii++)
         b_sca->tpuip[iel][ii] = tui[iel][ii] - t[iel]*ui[iel][ii];
-    }
 
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
       for (cs_lnum_t ii = 0; ii < 3; ii++) {
         b_sca->unstti[iel][ii] = (  b_sca->tpuip[iel][ii]
                                   - b_sca->unstti[iel][ii]) / dtref;
@@ -3458,16 +3623,6 @@ cs_les_balance_compute_tui(void)
       for (cs_lnum_t iel = 0; iel < n_cells; iel++)
         b_sca->difftti[iel][ii] = diverg[iel];
 
-      /* diffttpi */
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          w1[iel][kk] = tp[iel] - t[iel]*p[iel];
-
-      _les_balance_divergence_vector(w1, diverg);
-
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-        b_sca->diffttpi[iel][ii] = diverg[iel]/ro0;
-
       /* Laminar diffusion */
       for (cs_lnum_t iel = 0; iel < n_cells; iel++)
         for (cs_lnum_t kk = 0; kk < 3; kk++)
@@ -3480,15 +3635,18 @@ cs_les_balance_compute_tui(void)
         b_sca->difflamti[iel][ii] = diverg[iel]/ro0;
     }
 
-    /* Variance budgets */
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-      b_sca->prodvar[iel]    = 0.;
-      b_sca->epsvar[iel]     = 0.;
-      b_sca->difftvar[iel]   = 0.;
-      b_sca->convvar[iel]    = 0.;
-      b_sca->difflamvar[iel] = 0.;
-    }
+    /* diffttpi (identical for all directions) */
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+      for (cs_lnum_t kk = 0; kk < 3; kk++)
+        w1[iel][kk] = tp[iel] - t[iel]*p[iel];
+
+    _les_balance_divergence_vector(w1, diverg);
 
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+      for (cs_lnum_t ii = 0; ii < 3; ii++)
+        b_sca->diffttpi[iel][ii] = diverg[iel]/ro0;
+
+    /* Variance budgets */
     for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
       b_sca->unstvar[iel] = (b_sca->tptp[iel] - b_sca->unstvar[iel])/dtref;
       b_sca->prodvar[iel] = 0.;
@@ -3537,36 +3695,25 @@ cs_les_balance_compute_tui(void)
 
     if (_les_balance.type & CS_LES_BALANCE_TUI_BASE) {
 
-      for (cs_lnum_t ii = 0; ii < 3; ii++) {
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-          for (cs_lnum_t kk = 0; kk < 3; kk++)
-            w1[iel][kk] = -nutduidxj[iel][ii][kk] - nutduidxj[iel][kk][ii];
-
-        _les_balance_divergence_vector(w1, diverg);
-
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-          b_sca->budsgstui[iel][ii] = -tdtauijdxj[iel][ii]-t[iel]*diverg[iel];
-      }
-
       for (cs_lnum_t iel = 0; iel < n_cells; iel++)
         for (cs_lnum_t kk = 0; kk < 3; kk++)
           w1[iel][kk] = -nutdtdxi[iel][kk];
 
       _les_balance_divergence_vector(w1, diverg);
 
-      for (cs_lnum_t ii = 0; ii < 3; ii++) {
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+        for (cs_lnum_t ii = 0; ii < 3; ii++) {
+          b_sca->budsgstui[iel][ii]
+            = -tdtauijdxj[iel][ii]-t[iel]*div_tau_m[iel][ii];
           b_sca->budsgstui[iel][ii]
             -= (uidivturflux[iel][ii]-ui[iel][ii]*diverg[iel]/sigmas);
-
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
           b_sca->budsgstui[iel][ii] /= ro0;
-      }
+        }
 
-      /* Total SGS contribution for the variance of a scalar */
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+        /* Total SGS contribution for the variance of a scalar */
         b_sca->budsgsvar[iel]
           = -2.*(tdivturflux[iel]-t[iel]*diverg[iel]/sigmas)/ro0;
+      }
 
     }
 
@@ -3625,43 +3772,13 @@ cs_les_balance_compute_tui(void)
         }
       }
 
-      /* Bc coeffs */
-      for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++) {
-        coefas[ifac] = 0.;
-        if (bc_type[ifac] == CS_SMOOTHWALL
-         || bc_type[ifac] == CS_ROUGHWALL)
-          coefbs[ifac] = 0.;
-        else
-          coefbs[ifac] = 1.;
-      }
-
-      cs_gradient_scalar("nu_t",
-                         gradient_type,
-                         halo_type,
-                         1,
-                         true,
-                         eqp->nswrgr,
-                         0,
-                         0,
-                         1,
-                         eqp->verbosity,
-                         eqp->imligr,
-                         eqp->epsrgr,
-                         eqp->climgr,
-                         NULL,
-                         coefas,
-                         coefbs,
-                         nut,
-                         NULL,
-                         NULL,
-                         w1);
-
       for (cs_lnum_t ii = 0; ii < 3; ii++) {
         for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
           b_sca->budsgstuifull[4][iel][ii] = 0.;
           for (cs_lnum_t kk = 0; kk < 3; kk++)
             b_sca->budsgstuifull[4][iel][ii]
-              += w1[iel][kk]*(tduidxj[iel][ii][kk]-t[iel]*duidxj[iel][ii][kk]);
+              +=   grad_nut_m[iel][kk]
+                 * (tduidxj[iel][ii][kk]-t[iel]*duidxj[iel][ii][kk]);
           b_sca->budsgstuifull[4][iel][ii] /= ro0;
 
           b_sca->budsgstuifull[5][iel][ii] =   dnutdxjtdujdxi[iel][ii]
@@ -3706,72 +3823,67 @@ cs_les_balance_compute_tui(void)
           b_sca->budsgstuifull[7][iel][ii] /= ro0;
           b_sca->budsgstuifull[8][iel][ii] /= ro0;
         }
+      }
 
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-          for (cs_lnum_t kk = 0; kk < 3; kk++)
-            w1[iel][kk] =   2.*nut[iel]/sigmas*(tdtdxi[iel][kk]
-                          - t[iel]*dtdxi[iel][kk]);
-        }
+      /* Variance terms (do not depend on direction) */
 
-        _les_balance_divergence_vector(w1, diverg);
+      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          w1[iel][kk] =   2.*nut[iel]/sigmas*(tdtdxi[iel][kk]
+                        - t[iel]*dtdxi[iel][kk]);
+      }
 
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-          b_sca->budsgsvarfull[iel][0] = diverg[iel]/ro0;
+      _les_balance_divergence_vector(w1, diverg);
 
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-          b_sca->budsgsvarfull[iel][1] = b_sca->epsvar[iel]*nut[iel]/viscl0;
+      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+        b_sca->budsgsvarfull[iel][0] = diverg[iel]/ro0;
 
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-          for (cs_lnum_t kk = 0; kk < 3; kk++)
-            w1[iel][kk] = nuttdtdxi[iel][kk]
-                        + 2.*nut[iel]*t[iel]*dtdxi[iel][kk]
-                        - nut[iel]*tdtdxi[iel][kk]
-                        - t[iel]*nutdtdxi[iel][kk]
-                        - dtdxi[iel][kk]*nutt[iel];
+      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+        b_sca->budsgsvarfull[iel][1] = b_sca->epsvar[iel]*nut[iel]/viscl0;
 
-        _les_balance_divergence_vector(w1, diverg);
+      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          w1[iel][kk] = nuttdtdxi[iel][kk]
+                      + 2.*nut[iel]*t[iel]*dtdxi[iel][kk]
+                      - nut[iel]*tdtdxi[iel][kk]
+                      - t[iel]*nutdtdxi[iel][kk]
+                      - dtdxi[iel][kk]*nutt[iel];
 
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-          b_sca->budsgsvarfull[iel][2] = 2.*diverg[iel]/(ro0*sigmas);
+      _les_balance_divergence_vector(w1, diverg);
 
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-          b_sca->budsgsvarfull[iel][3]
-            = nutdtdxidtdxi[iel]-nut[iel]*dtdxidtdxi[iel];
-          xx = 0.;
-          for (cs_lnum_t kk = 0; kk < 3; kk++)
-            xx += 2.*nut[iel]*t[iel]*dtdxi[iel][kk]
-                  -t[iel]*nutdtdxi[iel][kk]-dtdxi[iel][kk]*nutt[iel];
+      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+        b_sca->budsgsvarfull[iel][2] = 2.*diverg[iel]/(ro0*sigmas);
 
-          b_sca->budsgsvarfull[iel][3] += xx;
-          b_sca->budsgsvarfull[iel][3] *= -2./(sigmas*ro0);
-        }
+      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+        b_sca->budsgsvarfull[iel][3]
+          = nutdtdxidtdxi[iel]-nut[iel]*dtdxidtdxi[iel];
+        xx = 0.;
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          xx += 2.*nut[iel]*t[iel]*dtdxi[iel][kk]
+                -t[iel]*nutdtdxi[iel][kk]-dtdxi[iel][kk]*nutt[iel];
 
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-          for (cs_lnum_t kk = 0; kk < 3; kk++)
-            w1[iel][kk] = dtdxi[iel][kk]*(nutt[iel]-nut[iel]*t[iel]);
+        b_sca->budsgsvarfull[iel][3] += xx;
+        b_sca->budsgsvarfull[iel][3] *= -2./(sigmas*ro0);
+      }
 
-        _les_balance_divergence_vector(w1, diverg);
+      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          w1[iel][kk] = dtdxi[iel][kk]*(nutt[iel]-nut[iel]*t[iel]);
 
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-          b_sca->budsgsvarfull[iel][4] = 2.*diverg[iel]/(sigmas*ro0);
+      _les_balance_divergence_vector(w1, diverg);
 
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-          b_sca->budsgsvarfull[iel][5] = 0.;
-          for (cs_lnum_t kk = 0; kk < 3; kk++)
-            b_sca->budsgsvarfull[iel][5]
-              += dtdxi[iel][kk]*(nutdtdxi[iel][kk]-nut[iel]*dtdxi[iel][kk]);
-          b_sca->budsgsvarfull[iel][5] *= -2./(sigmas*ro0);
-        }
+      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+        b_sca->budsgsvarfull[iel][4] = 2.*diverg[iel]/(sigmas*ro0);
+
+      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+        b_sca->budsgsvarfull[iel][5] = 0.;
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          b_sca->budsgsvarfull[iel][5]
+            += dtdxi[iel][kk]*(nutdtdxi[iel][kk]-nut[iel]*dtdxi[iel][kk]);
+        b_sca->budsgsvarfull[iel][5] *= -2./(sigmas*ro0);
       }
     }
   }
-
-  BFT_FREE(w1);
-  BFT_FREE(w2);
-  BFT_FREE(diverg);
-  BFT_FREE(coefas);
-  BFT_FREE(coefbs);
-  BFT_FREE(lapl);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3820,6 +3932,9 @@ cs_les_balance_finalize(void)
 
   /* Freeing of the btui structure */
   _les_balance.btui = _les_balance_destroy_tui(_les_balance.btui);
+
+  /* Freeing of work arrays */
+  _les_balance_work_destroy();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -50,11 +50,14 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_ale.h"
 #include "cs_cell_to_vertex.h"
 #include "cs_ext_neighborhood.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_quantities.h"
+#include "cs_time_step.h"
+#include "cs_turbomachinery.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -78,218 +81,321 @@ BEGIN_C_DECLS
  * Type definition
  *============================================================================*/
 
+/* Filter operator, in CSR form, with normalized (volume-based) weights;
+   each row includes the diagonal term. */
+
+typedef struct {
+
+  cs_lnum_t    n_rows;      /* number of rows (local cells) */
+  cs_lnum_t   *row_index;   /* row index (size: n_rows + 1) */
+  cs_lnum_t   *col_id;      /* column (cell) ids, possibly ghost cells */
+  cs_real_t   *w;           /* normalized weights */
+
+  int          nt_build;    /* time step at which operator was built */
+
+} _les_filter_op_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
 
+static cs_les_filter_type_t  _filter_type = CS_LES_FILTER_EXT_NEIGHBORHOOD;
+
+/* Operators for the extended neighborhood (0) and face neighbors (1) */
+
+static _les_filter_op_t  *_filter_op[2] = {NULL, NULL};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Compute filters for dynamic models.
- *
- * This function deals with the standard or extended neighborhood.
+/*----------------------------------------------------------------------------
+ * Destroy a filter operator.
  *
- * \param[in]   stride   stride of array to filter
- * \param[in]   val      array of values to filter
- * \param[out]  f_val    array of filtered values
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   op <-> pointer to filter operator
+ *----------------------------------------------------------------------------*/
 
 static void
-_les_filter_ext_neighborhood(int        stride,
-                             cs_real_t  val[],
-                             cs_real_t  f_val[])
+_les_filter_op_destroy(_les_filter_op_t  **op)
 {
-  cs_real_t *w1 = NULL, *w2 = NULL;
+  _les_filter_op_t *_op = *op;
+
+  if (_op == NULL)
+    return;
 
+  BFT_FREE(_op->w);
+  BFT_FREE(_op->col_id);
+  BFT_FREE(_op->row_index);
+  BFT_FREE(*op);
+}
+
+/*----------------------------------------------------------------------------
+ * Build a filter operator based on face-adjacent cells, and optionally
+ * cells of the extended neighborhood.
+ *
+ * As in the matching face-based sums, a neighbor sharing several faces
+ * with a cell is counted once per face.
+ *
+ * parameters:
+ *   ext <-- if true, add extended neighborhood cells
+ *
+ * returns:
+ *   pointer to new filter operator
+ *----------------------------------------------------------------------------*/
+
+static _les_filter_op_t *
+_les_filter_op_create(bool  ext)
+{
   const cs_mesh_t  *mesh = cs_glob_mesh;
-  const cs_lnum_t  _stride = stride;
   const cs_lnum_t  n_cells = mesh->n_cells;
-  const cs_lnum_t  n_cells_ext = mesh->n_cells_with_ghosts;
-  const cs_lnum_t  n_elts_l = n_cells * _stride;
-  const cs_lnum_t  n_elts = n_cells_ext * _stride;
-  const int n_i_groups = mesh->i_face_numbering->n_groups;
-  const int n_i_threads = mesh->i_face_numbering->n_threads;
-  const cs_lnum_t *restrict i_group_index = mesh->i_face_numbering->group_index;
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  const cs_lnum_2_t  *i_face_cells
+    = (const cs_lnum_2_t *)mesh->i_face_cells;
   const cs_lnum_t  *cell_cells_idx = mesh->cell_cells_idx;
   const cs_lnum_t  *cell_cells_lst = mesh->cell_cells_lst;
   const cs_real_t  *cell_vol = cs_glob_mesh_quantities->cell_vol;
 
-  assert(cell_cells_idx != NULL);
-
-  /* Allocate and initialize working buffers */
+  assert(ext == false || cell_cells_idx != NULL);
 
-  BFT_MALLOC(w1, n_elts, cs_real_t);
-  BFT_MALLOC(w2, n_elts, cs_real_t);
+  _les_filter_op_t *op = NULL;
+  BFT_MALLOC(op, 1, _les_filter_op_t);
 
-  /* Case for scalar variable */
-  /*--------------------------*/
+  op->n_rows = n_cells;
+  op->nt_build = cs_glob_time_step->nt_cur;
 
-  if (stride == 1) {
+  /* Count row sizes */
 
-    /* Synchronize valiable */
+  cs_lnum_t *row_index;
+  BFT_MALLOC(row_index, n_cells + 1, cs_lnum_t);
 
-    if (mesh->halo != NULL)
-      cs_halo_sync_var(mesh->halo, CS_HALO_EXTENDED, val);
+  row_index[0] = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    row_index[i+1] = 1;
+    if (ext)
+      row_index[i+1] += cell_cells_idx[i+1] - cell_cells_idx[i];
+  }
 
-    /* Define filtered valiable array */
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t i = i_face_cells[f_id][0];
+    cs_lnum_t j = i_face_cells[f_id][1];
+    if (i < n_cells)
+      row_index[i+1] += 1;
+    if (j < n_cells)
+      row_index[j+1] += 1;
+  }
 
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_cells; i++) {
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    row_index[i+1] += row_index[i];
 
-      w1[i] = val[i] * cell_vol[i];
-      w2[i] = cell_vol[i];
+  /* Fill columns */
 
-      /* Loop on connected cells (without cells sharing a face) */
+  cs_lnum_t *col_id, *pos;
+  BFT_MALLOC(col_id, row_index[n_cells], cs_lnum_t);
+  BFT_MALLOC(pos, n_cells, cs_lnum_t);
 
-      for (cs_lnum_t j = cell_cells_idx[i]; j < cell_cells_idx[i+1]; j++) {
-        cs_lnum_t k = cell_cells_lst[j];
-        w1[i] += val[k] * cell_vol[k];
-        w2[i] += cell_vol[k];
-      }
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cs_lnum_t k = row_index[i];
+    col_id[k++] = i;
+    if (ext) {
+      for (cs_lnum_t j = cell_cells_idx[i]; j < cell_cells_idx[i+1]; j++)
+        col_id[k++] = cell_cells_lst[j];
+    }
+    pos[i] = k;
+  }
 
-    } /* End of loop on cells */
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t i = i_face_cells[f_id][0];
+    cs_lnum_t j = i_face_cells[f_id][1];
+    if (i < n_cells)
+      col_id[pos[i]++] = j;
+    if (j < n_cells)
+      col_id[pos[j]++] = i;
+  }
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  BFT_FREE(pos);
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+  /* Normalized weights */
 
-        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             face_id++) {
+  cs_real_t *w;
+  BFT_MALLOC(w, row_index[n_cells], cs_real_t);
 
-          cs_lnum_t i = mesh->i_face_cells[face_id][0];
-          cs_lnum_t j = mesh->i_face_cells[face_id][1];
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cs_real_t w_sum = 0;
+    for (cs_lnum_t k = row_index[i]; k < row_index[i+1]; k++)
+      w_sum += cell_vol[col_id[k]];
+    const cs_real_t inv_w_sum = 1. / w_sum;
+    for (cs_lnum_t k = row_index[i]; k < row_index[i+1]; k++)
+      w[k] = cell_vol[col_id[k]] * inv_w_sum;
+  }
 
-          w1[i] += val[j] * cell_vol[j];
-          w2[i] += cell_vol[j];
-          w1[j] += val[i] * cell_vol[i];
-          w2[j] += cell_vol[i];
+  op->row_index = row_index;
+  op->col_id = col_id;
+  op->w = w;
 
-        }
+  return op;
+}
 
-      }
+/*----------------------------------------------------------------------------
+ * Return a filter operator, building it if needed.
+ *
+ * With a moving mesh, the operator is rebuilt once per time step.
+ *
+ * parameters:
+ *   op_id <-- 0 for extended neighborhood, 1 for face neighbors
+ *
+ * returns:
+ *   pointer to filter operator
+ *----------------------------------------------------------------------------*/
 
-    }
+static const _les_filter_op_t *
+_les_filter_op_get(int  op_id)
+{
+  _les_filter_op_t *op = _filter_op[op_id];
 
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_cells; i++)
-      f_val[i] = w1[i]/w2[i];
+  if (op != NULL) {
+    if (   (   cs_glob_ale != CS_ALE_NONE
+            || cs_turbomachinery_get_model() == CS_TURBOMACHINERY_TRANSIENT)
+        && op->nt_build != cs_glob_time_step->nt_cur)
+      _les_filter_op_destroy(&(_filter_op[op_id]));
+  }
 
-    /* Synchronize valiable */
+  if (_filter_op[op_id] == NULL)
+    _filter_op[op_id] = _les_filter_op_create(op_id == 0);
 
-    if (mesh->halo != NULL)
-      cs_halo_sync_var(mesh->halo, CS_HALO_STANDARD, f_val);
-  }
+  return _filter_op[op_id];
+}
 
-  /* Case for vector or tensor variable */
-  /*------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Apply a filter operator to a set of strided fields.
+ *
+ * Values are assumed to be synchronized on the halo matching the operator.
+ *
+ * parameters:
+ *   op       <-- pointer to filter operator
+ *   n_fields <-- number of fields to filter
+ *   stride   <-- stride of each field
+ *   val      <-- values to filter, for each field
+ *   f_val    --> filtered values, for each field
+ *----------------------------------------------------------------------------*/
 
-  else {
+static void
+_les_filter_op_apply(const _les_filter_op_t  *op,
+                     int                      n_fields,
+                     const int                stride[],
+                     cs_real_t               *val[],
+                     cs_real_t               *f_val[])
+{
+  const cs_lnum_t  n_rows = op->n_rows;
+  const cs_lnum_t  *restrict row_index = op->row_index;
+  const cs_lnum_t  *restrict col_id = op->col_id;
+  const cs_real_t  *restrict w = op->w;
 
-    /* Synchronize valiable */
+# pragma omp parallel for if (n_rows > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
 
-    if (mesh->halo != NULL)
-      cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED, val, stride);
+    const cs_lnum_t s_id = row_index[i];
+    const cs_lnum_t e_id = row_index[i+1];
 
-    /* Define filtered valiable array */
+    for (int f_id = 0; f_id < n_fields; f_id++) {
 
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      const cs_lnum_t _stride = stride[f_id];
+      const cs_real_t *restrict _val = val[f_id];
+      cs_real_t *restrict _f_val = f_val[f_id] + i*_stride;
 
-      for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-        const cs_lnum_t ic = i *_stride + c_id;
-        w1[ic] = val[ic] * cell_vol[i];
-        w2[ic] = cell_vol[i];
+      if (_stride == 1) {
+        cs_real_t s = 0;
+        for (cs_lnum_t k = s_id; k < e_id; k++)
+          s += w[k] * _val[col_id[k]];
+        _f_val[0] = s;
       }
 
-      /* Loop on connected cells (without cells sharing a face) */
-
-      for (cs_lnum_t j = cell_cells_idx[i]; j < cell_cells_idx[i+1]; j++) {
-        cs_lnum_t k = cell_cells_lst[j];
-        for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-          const cs_lnum_t ic = i *_stride + c_id;
-          const cs_lnum_t kc = k *_stride + c_id;
-          w1[ic] += val[kc] * cell_vol[k];
-          w2[ic] += cell_vol[k];
+      else {
+        for (cs_lnum_t c_id = 0; c_id < _stride; c_id++)
+          _f_val[c_id] = 0;
+        for (cs_lnum_t k = s_id; k < e_id; k++) {
+          const cs_real_t *restrict _val_j = _val + col_id[k]*_stride;
+          const cs_real_t w_k = w[k];
+          for (cs_lnum_t c_id = 0; c_id < _stride; c_id++)
+            _f_val[c_id] += w_k * _val_j[c_id];
         }
       }
 
-    } /* End of loop on cells */
+    }
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  }
+}
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+/*----------------------------------------------------------------------------
+ * Compute filters for dynamic models using a precomputed operator.
+ *
+ * parameters:
+ *   op_id    <-- 0 for extended neighborhood, 1 for face neighbors
+ *   n_fields <-- number of fields to filter
+ *   stride   <-- stride of each field
+ *   val      <-> values to filter, for each field
+ *   f_val    --> filtered values, for each field
+ *----------------------------------------------------------------------------*/
 
-        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             face_id++) {
+static void
+_les_filter_cells(int          op_id,
+                  int          n_fields,
+                  const int    stride[],
+                  cs_real_t   *val[],
+                  cs_real_t   *f_val[])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_halo_type_t  halo_type
+    = (op_id == 0) ? CS_HALO_EXTENDED : CS_HALO_STANDARD;
+
+  /* Synchronize variables */
+
+  if (mesh->halo != NULL) {
+    for (int f_id = 0; f_id < n_fields; f_id++) {
+      if (stride[f_id] == 1)
+        cs_halo_sync_var(mesh->halo, halo_type, val[f_id]);
+      else
+        cs_halo_sync_var_strided(mesh->halo, halo_type, val[f_id],
+                                 stride[f_id]);
+    }
+  }
 
-          cs_lnum_t i = mesh->i_face_cells[face_id][0];
-          cs_lnum_t j = mesh->i_face_cells[face_id][1];
+  /* Define filtered variable arrays */
 
-          for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-            const cs_lnum_t ic = i *_stride + c_id;
-            const cs_lnum_t jc = j *_stride + c_id;
-            w1[ic] += val[jc] * cell_vol[j];
-            w2[ic] += cell_vol[j];
-            w1[jc] += val[ic] * cell_vol[i];
-            w2[jc] += cell_vol[i];
-          }
+  const _les_filter_op_t *op = _les_filter_op_get(op_id);
 
-        }
+  _les_filter_op_apply(op, n_fields, stride, val, f_val);
 
-      }
+  /* Synchronize variables */
 
+  if (mesh->halo != NULL) {
+    for (int f_id = 0; f_id < n_fields; f_id++) {
+      if (stride[f_id] == 1)
+        cs_halo_sync_var(mesh->halo, CS_HALO_STANDARD, f_val[f_id]);
+      else
+        cs_halo_sync_var_strided(mesh->halo, halo_type, f_val[f_id],
+                                 stride[f_id]);
     }
-
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_elts_l; i++)
-      f_val[i] = w1[i]/w2[i];
-
-    /* Synchronize valiable */
-
-    if (mesh->halo != NULL)
-      cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED, f_val, stride);
   }
-
-  BFT_FREE(w2);
-  BFT_FREE(w1);
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*=============================================================================
- * Public function definitions
- *============================================================================*/
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Compute filters for dynamic models.
+/*----------------------------------------------------------------------------
+ * Compute filters for dynamic models based on vertex values.
  *
- * This function deals with the standard or extended neighborhood.
+ * This is used when the complete extended neighborhood is not available.
  *
- * \param[in]   stride   stride of array to filter
- * \param[in]   val      array of values to filter
- * \param[out]  f_val    array of filtered values
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   stride <-- stride of array to filter
+ *   val    <-- array of values to filter
+ *   f_val  --> array of filtered values
+ *----------------------------------------------------------------------------*/
 
-void
-cs_les_filter(int        stride,
-              cs_real_t  val[],
-              cs_real_t  f_val[])
+static void
+_les_filter_vertices(int        stride,
+                     cs_real_t  val[],
+                     cs_real_t  f_val[])
 {
-  if (cs_ext_neighborhood_get_type() == CS_EXT_NEIGHBORHOOD_COMPLETE) {
-    _les_filter_ext_neighborhood(stride, val, f_val);
-    return;
-  }
-
   cs_real_t *v_val = NULL, *v_weight = NULL;
 
   const cs_mesh_t  *mesh = cs_glob_mesh;
@@ -379,6 +485,108 @@ cs_les_filter(int        stride,
     cs_halo_sync_var_strided(mesh->halo, CS_HALO_STANDARD, f_val, _stride);
 }
 
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the type of filter used for dynamic models.
+ *
+ * \param[in]  type  filter type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_set_type(cs_les_filter_type_t  type)
+{
+  _filter_type = type;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the type of filter used for dynamic models.
+ *
+ * \return  filter type
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_les_filter_type_t
+cs_les_filter_get_type(void)
+{
+  return _filter_type;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute filters for dynamic models.
+ *
+ * This function deals with the standard or extended neighborhood.
+ *
+ * \param[in]   stride   stride of array to filter
+ * \param[in]   val      array of values to filter
+ * \param[out]  f_val    array of filtered values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_filter(int        stride,
+              cs_real_t  val[],
+              cs_real_t  f_val[])
+{
+  cs_les_filter_multi(1, &stride, &val, &f_val);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute filters for dynamic models for several fields at once.
+ *
+ * Cell-based filters use an operator with precomputed normalized weights,
+ * built on first use (and at each time step with a moving mesh), so
+ * filtering several fields in a single call allows reusing its
+ * coefficients for each cell.
+ *
+ * \param[in]       n_fields  number of fields to filter
+ * \param[in]       stride    stride of each field
+ * \param[in, out]  val       values to filter for each field
+ *                             (synchronized in place)
+ * \param[out]      f_val     filtered values for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_multi(int          n_fields,
+                    const int    stride[],
+                    cs_real_t   *val[],
+                    cs_real_t   *f_val[])
+{
+  if (_filter_type == CS_LES_FILTER_FACE_NEIGHBORS)
+    _les_filter_cells(1, n_fields, stride, val, f_val);
+
+  else if (cs_ext_neighborhood_get_type() == CS_EXT_NEIGHBORHOOD_COMPLETE)
+    _les_filter_cells(0, n_fields, stride, val, f_val);
+
+  else {
+    for (int f_id = 0; f_id < n_fields; f_id++)
+      _les_filter_vertices(stride[f_id], val[f_id], f_val[f_id]);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free filter operators for dynamic models.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_finalize(void)
+{
+  for (int i = 0; i < 2; i++)
+    _les_filter_op_destroy(&(_filter_op[i]));
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
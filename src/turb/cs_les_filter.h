@@ -45,10 +45,42 @@ BEGIN_C_DECLS
  * Type definition
  *============================================================================*/
 
+/* Filter type */
+
+typedef enum {
+
+  CS_LES_FILTER_EXT_NEIGHBORHOOD,  /* box filter on the extended
+                                      neighborhood, or vertex-based if
+                                      the complete extended neighborhood
+                                      is not available (default) */
+  CS_LES_FILTER_FACE_NEIGHBORS     /* box filter on face-adjacent cells */
+
+} cs_les_filter_type_t;
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Set the type of filter used for dynamic models.
+ *
+ * parameters:
+ *   type  <--  filter type
+ *----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_set_type(cs_les_filter_type_t  type);
+
+/*----------------------------------------------------------------------------
+ * Return the type of filter used for dynamic models.
+ *
+ * returns:
+ *   filter type
+ *----------------------------------------------------------------------------*/
+
+cs_les_filter_type_t
+cs_les_filter_get_type(void);
+
 /*----------------------------------------------------------------------------
  * Compute filters for dynamic models.
  *
@@ -65,6 +97,32 @@ cs_les_filter(int        stride,
               cs_real_t  val[],
               cs_real_t  f_val[]);
 
+/*----------------------------------------------------------------------------
+ * Compute filters for dynamic models for several fields at once.
+ *
+ * Cell-based filters use an operator with precomputed normalized weights,
+ * built on first use (and at each time step with a moving mesh).
+ *
+ * parameters:
+ *   n_fields  <--  number of fields to filter
+ *   stride    <--  stride of each field
+ *   val       <->  values to filter for each field
+ *   f_val     -->  filtered values for each field
+ *----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_multi(int          n_fields,
+                    const int    stride[],
+                    cs_real_t   *val[],
+                    cs_real_t   *f_val[]);
+
+/*----------------------------------------------------------------------------
+ * Free filter operators for dynamic models.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -57,6 +57,7 @@
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_random.h"
+#include "cs_sort.h"
 #include "cs_timer.h"
 #include "cs_mesh_location.h"
 #include "cs_restart.h"
@@ -173,6 +174,217 @@ static int   _n_sem_vol_restart_structures = 50;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Return the bin containing a given coordinate along one direction.
+ *
+ * Coordinates outside the box are associated with the first or last bin.
+ *
+ * parameters:
+ *   x         <-- coordinate
+ *   x_min     <-- box min coordinate
+ *   bin_size  <-- bin size
+ *   n_bins    <-- number of bins
+ *
+ * returns:
+ *   id of the bin along this direction
+ *----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_sem_bin_id(cs_real_t  x,
+            cs_real_t  x_min,
+            cs_real_t  bin_size,
+            cs_lnum_t  n_bins)
+{
+  cs_real_t r = floor((x - x_min) / bin_size);
+
+  if (r < 0.)
+    return 0;
+  else if (r > (cs_real_t)(n_bins - 1))
+    return n_bins - 1;
+
+  return (cs_lnum_t)r;
+}
+
+/*----------------------------------------------------------------------------
+ * Distribute synthetic eddies on a uniform grid of bins covering the box.
+ *
+ * The bin size is at least the largest local eddy length scale in each
+ * direction (so that a point only visits its neighboring bins), and the
+ * total number of bins is bounded by the number of structures.
+ *
+ * parameters:
+ *   inflow         <-- pointer to structure for SEM
+ *   n_points       <-- local number of points
+ *   length_scale   <-- eddy length scale at each point
+ *   box_min_coord  <-- min coordinates of the virtual box
+ *   box_length     <-- dimensions of the virtual box
+ *   n_bins         --> number of bins in each direction
+ *   bin_size       --> bin size in each direction
+ *   bin_idx        --> index of structures in each bin (size: n_bins + 1)
+ *   bin_s_ids      --> ids of structures in each bin, in increasing order
+ *----------------------------------------------------------------------------*/
+
+static void
+_sem_bin_structures(const cs_inflow_sem_t  *inflow,
+                    cs_lnum_t               n_points,
+                    const cs_real_3_t       length_scale[],
+                    const cs_real_t         box_min_coord[3],
+                    const cs_real_t         box_length[3],
+                    cs_lnum_t               n_bins[3],
+                    cs_real_t               bin_size[3],
+                    cs_lnum_t             **bin_idx,
+                    cs_lnum_t             **bin_s_ids)
+{
+  const cs_lnum_t n_structures = inflow->n_structures;
+
+  cs_real_t ls_max[3] = {0., 0., 0.};
+
+  for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+      ls_max[coo_id] = CS_MAX(ls_max[coo_id], length_scale[point_id][coo_id]);
+  }
+
+  for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+    n_bins[coo_id] = 1;
+    if (ls_max[coo_id] > 0.) {
+      cs_real_t r = floor(box_length[coo_id] / ls_max[coo_id]);
+      if (r > (cs_real_t)n_structures)
+        n_bins[coo_id] = n_structures;
+      else if (r > 1.)
+        n_bins[coo_id] = (cs_lnum_t)r;
+    }
+  }
+
+  /* Coarsen the largest direction until the grid is not finer than the
+     number of structures */
+
+  while (  (cs_gnum_t)n_bins[0] * (cs_gnum_t)n_bins[1]
+         * (cs_gnum_t)n_bins[2] > (cs_gnum_t)n_structures) {
+    int d = 0;
+    for (int coo_id = 1; coo_id < 3; coo_id++) {
+      if (n_bins[coo_id] > n_bins[d])
+        d = coo_id;
+    }
+    n_bins[d] = (n_bins[d] + 1) / 2;
+  }
+
+  for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+    bin_size[coo_id] = box_length[coo_id] / n_bins[coo_id];
+
+  const cs_lnum_t n_tot_bins = n_bins[0]*n_bins[1]*n_bins[2];
+
+  cs_lnum_t *s_bin_id, *_bin_idx, *_bin_s_ids;
+  BFT_MALLOC(s_bin_id, n_structures, cs_lnum_t);
+  BFT_MALLOC(_bin_idx, n_tot_bins + 1, cs_lnum_t);
+  BFT_MALLOC(_bin_s_ids, n_structures, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_tot_bins + 1; i++)
+    _bin_idx[i] = 0;
+
+  for (cs_lnum_t struct_id = 0; struct_id < n_structures; struct_id++) {
+    cs_lnum_t b_id[3];
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+      b_id[coo_id] = _sem_bin_id(inflow->position[struct_id][coo_id],
+                                 box_min_coord[coo_id],
+                                 bin_size[coo_id],
+                                 n_bins[coo_id]);
+    s_bin_id[struct_id] = (b_id[2]*n_bins[1] + b_id[1])*n_bins[0] + b_id[0];
+    _bin_idx[s_bin_id[struct_id] + 1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_tot_bins; i++)
+    _bin_idx[i+1] += _bin_idx[i];
+
+  /* Structures are added in increasing id order in each bin */
+
+  for (cs_lnum_t struct_id = 0; struct_id < n_structures; struct_id++) {
+    cs_lnum_t b_id = s_bin_id[struct_id];
+    _bin_s_ids[_bin_idx[b_id]] = struct_id;
+    _bin_idx[b_id] += 1;
+  }
+
+  for (cs_lnum_t i = n_tot_bins; i > 0; i--)
+    _bin_idx[i] = _bin_idx[i-1];
+  _bin_idx[0] = 0;
+
+  BFT_FREE(s_bin_id);
+
+  *bin_idx = _bin_idx;
+  *bin_s_ids = _bin_s_ids;
+}
+
+/*----------------------------------------------------------------------------
+ * Broadcast SEM structures from rank 0 to the ranks using them.
+ *
+ * parameters:
+ *   inflow <-> pointer to structure for SEM
+ *----------------------------------------------------------------------------*/
+
+static void
+_sem_bcast_structures(cs_inflow_sem_t  *inflow)
+{
+#if defined(HAVE_MPI)
+
+  if (cs_glob_rank_id >= 0 && inflow->comm != MPI_COMM_NULL) {
+
+    MPI_Bcast(inflow->energy,   3*inflow->n_structures,
+              CS_MPI_REAL, 0, inflow->comm);
+    MPI_Bcast(inflow->position, 3*inflow->n_structures,
+              CS_MPI_REAL, 0, inflow->comm);
+
+  }
+
+#else
+
+  CS_UNUSED(inflow);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Build the communicator used to broadcast SEM structures.
+ *
+ * Structures are generated on rank 0, and only needed on ranks having
+ * inlet points, so when some ranks have no inlet face, a communicator
+ * restricted to rank 0 and ranks with faces is used.
+ *
+ * parameters:
+ *   inflow  <-> pointer to structure for SEM
+ *   n_elts  <-- local number of inlet faces
+ *----------------------------------------------------------------------------*/
+
+static void
+_sem_comm_build(cs_inflow_sem_t  *inflow,
+                cs_lnum_t         n_elts)
+{
+#if defined(HAVE_MPI)
+
+  inflow->comm = cs_glob_mpi_comm;
+
+  if (cs_glob_n_ranks > 1 && inflow->volume_mode == 0) {
+
+    int have_elts = (n_elts > 0 || cs_glob_rank_id == 0) ? 1 : 0;
+    int n_ranks_elts = 0;
+
+    MPI_Allreduce(&have_elts, &n_ranks_elts, 1, MPI_INT, MPI_SUM,
+                  cs_glob_mpi_comm);
+
+    if (n_ranks_elts < cs_glob_n_ranks) {
+      int color = (have_elts == 1) ? 1 : MPI_UNDEFINED;
+      MPI_Comm_split(cs_glob_mpi_comm, color, cs_glob_rank_id,
+                     &(inflow->comm));
+    }
+
+  }
+
+#else
+
+  CS_UNUSED(inflow);
+  CS_UNUSED(n_elts);
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Generation of synthetic turbulence via a Gaussian random method.
  *
@@ -585,6 +797,12 @@ cs_les_inflow_finalize(void)
         BFT_FREE(inflow->position);  /* 位置 */
         BFT_FREE(inflow->energy);    /* 能量 */
 
+#if defined(HAVE_MPI)
+        if (   inflow->comm != MPI_COMM_NULL
+            && inflow->comm != cs_glob_mpi_comm)
+          MPI_Comm_free(&(inflow->comm));
+#endif
+
         BFT_FREE(inflow);
 
         inlet->inflow = NULL;
@@ -759,6 +977,8 @@ cs_les_inflow_add_inlet(cs_les_inflow_type_t   type,
       BFT_MALLOC(inflow->position, inflow->n_structures, cs_real_3_t);
       BFT_MALLOC(inflow->energy,   inflow->n_structures, cs_real_3_t);
 
+      _sem_comm_build(inflow, n_elts);
+
       inlet->inflow = inflow;
 
       bft_printf(_("   Number of structures: %d\n\n"),n_entities);
@@ -1602,18 +1822,7 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
     }
 
-#if defined(HAVE_MPI)
-
-    if (cs_glob_rank_id >= 0) {
-
-      MPI_Bcast(inflow->energy, 3*inflow->n_structures,
-                CS_MPI_REAL, 0, cs_glob_mpi_comm);
-      MPI_Bcast(inflow->position, 3*inflow->n_structures,
-                CS_MPI_REAL, 0, cs_glob_mpi_comm);
-
-    }
-
-#endif
+    _sem_bcast_structures(inflow);
 
   }
 
@@ -1675,6 +1884,7 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
     /* Time advancement of the eddies */
 
+#   pragma omp parallel for if (inflow->n_structures > CS_THR_MIN)
     for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
 
       for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
@@ -1742,50 +1952,113 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
   }
 
-#if defined(HAVE_MPI)
+  _sem_bcast_structures(inflow);
 
-  if (cs_glob_rank_id >= 0) {
+  /* Computation of the eddy signal 【计算涡的信号】*/
+  /*--------------------------------*/
 
-    MPI_Bcast(inflow->energy,   3*inflow->n_structures,
-              CS_MPI_REAL, 0, cs_glob_mpi_comm);
-    MPI_Bcast(inflow->position, 3*inflow->n_structures,
-              CS_MPI_REAL, 0, cs_glob_mpi_comm);
+  alpha = sqrt(box_volume / (double)inflow->n_structures);
 
+  if (n_points < 1) {
+    BFT_FREE(length_scale);
+    return;
   }
 
+  /* Only eddies of bins neighboring a point may contribute to its signal;
+     contributions are summed in increasing structure id order */
+
+  cs_lnum_t  n_bins[3];
+  cs_real_t  bin_size[3];
+  cs_lnum_t  *bin_idx = NULL, *bin_s_ids = NULL;
+
+  _sem_bin_structures(inflow,
+                      n_points,
+                      (const cs_real_3_t *)length_scale,
+                      box_min_coord,
+                      box_length,
+                      n_bins,
+                      bin_size,
+                      &bin_idx,
+                      &bin_s_ids);
+
+  int n_t_max = 1;
+#if defined(HAVE_OPENMP)
+  n_t_max = omp_get_max_threads();
 #endif
 
-  /* Computation of the eddy signal 【计算涡的信号】*/
-  /*--------------------------------*/
-
-  alpha = sqrt(box_volume / (double)inflow->n_structures);
+  cs_lnum_t *t_s_ids;
+  BFT_MALLOC(t_s_ids, (size_t)n_t_max*inflow->n_structures, cs_lnum_t);
 
+# pragma omp parallel for if (n_points > CS_THR_MIN)
   for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
 
-    cs_real_t distance[3];
+#if defined(HAVE_OPENMP)
+    int t_id = omp_get_thread_num();
+#else
+    int t_id = 0;
+#endif
 
-    for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    cs_lnum_t *s_ids = t_s_ids + (size_t)t_id*inflow->n_structures;
+    cs_lnum_t n_s_ids = 0;
+
+    const cs_real_t *xp = point_coordinates[point_id];
+    const cs_real_t *lp = length_scale[point_id];
+
+    cs_lnum_t b_s[3], b_e[3];
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+      b_s[coo_id] = _sem_bin_id(xp[coo_id] - lp[coo_id],
+                                box_min_coord[coo_id],
+                                bin_size[coo_id],
+                                n_bins[coo_id]);
+      b_e[coo_id] = _sem_bin_id(xp[coo_id] + lp[coo_id],
+                                box_min_coord[coo_id],
+                                bin_size[coo_id],
+                                n_bins[coo_id]) + 1;
+    }
+
+    for (cs_lnum_t k = b_s[2]; k < b_e[2]; k++) {
+      for (cs_lnum_t j = b_s[1]; j < b_e[1]; j++) {
+        for (cs_lnum_t i = b_s[0]; i < b_e[0]; i++) {
+
+          cs_lnum_t b_id = (k*n_bins[1] + j)*n_bins[0] + i;
+
+          for (cs_lnum_t l = bin_idx[b_id]; l < bin_idx[b_id+1]; l++) {
+
+            cs_lnum_t struct_id = bin_s_ids[l];
+
+            if (   CS_ABS(xp[0] - inflow->position[struct_id][0]) < lp[0]
+                && CS_ABS(xp[1] - inflow->position[struct_id][1]) < lp[1]
+                && CS_ABS(xp[2] - inflow->position[struct_id][2]) < lp[2])
+              s_ids[n_s_ids++] = struct_id;
+
+          }
+
+        }
+      }
+    }
+
+    if (n_s_ids > 1)
+      cs_sort_lnum(s_ids, n_s_ids);
+
+    for (cs_lnum_t l = 0; l < n_s_ids; l++) {
+
+      cs_lnum_t struct_id = s_ids[l];
+      cs_real_t distance[3];
 
       for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
         distance[coo_id] =
           CS_ABS(point_coordinates[point_id][coo_id]
                  - inflow->position[struct_id][coo_id]);
 
-      if (   distance[0] < length_scale[point_id][0]
-          && distance[1] < length_scale[point_id][1]
-          && distance[2] < length_scale[point_id][2]) {
-
-        cs_real_t form_function = 1.;    /* 形状函数 */
-        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-          form_function *=
-            (1.-distance[coo_id]/length_scale[point_id][coo_id])
-            /sqrt(2./3.*length_scale[point_id][coo_id]);
-
-        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-          fluctuations[point_id][coo_id]
-            += inflow->energy[struct_id][coo_id]*form_function;
+      cs_real_t form_function = 1.;    /* 形状函数 */
+      for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+        form_function *=
+          (1.-distance[coo_id]/length_scale[point_id][coo_id])
+          /sqrt(2./3.*length_scale[point_id][coo_id]);
 
-      }
+      for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+        fluctuations[point_id][coo_id]
+          += inflow->energy[struct_id][coo_id]*form_function;
 
     }
 
@@ -1794,6 +2067,10 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
   }
 
+  BFT_FREE(t_s_ids);
+  BFT_FREE(bin_idx);
+  BFT_FREE(bin_s_ids);
+
   BFT_FREE(length_scale);
 }
 
@@ -80,6 +80,11 @@ typedef struct {
   cs_real_3_t  *position;      /*!< Position of the structures */
   cs_real_3_t  *energy;        /*!w Anisotropic energy of the structures */
 
+#if defined(HAVE_MPI)
+  MPI_Comm      comm;          /*!< Communicator used to broadcast structures
+                                    (MPI_COMM_NULL on ranks not using them) */
+#endif
+
 } cs_inflow_sem_t;
 
 /*=============================================================================
@@ -38,6 +38,7 @@
 #include "cs_turbulence_ke.h"
 #include "cs_turbulence_kw.h"
 #include "cs_turbulence_model.h"
+#include "cs_turbulence_rij.h"
 #include "cs_turbulence_rotation.h"
 
 /*----------------------------------------------------------------------------*/
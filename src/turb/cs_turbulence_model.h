@@ -298,7 +298,11 @@ extern const double cs_turb_cssgr4;
 extern const double cs_turb_cssgr5;
 extern const double cs_turb_cebms1;
 extern const double cs_turb_cebms2;
-extern const double cs_turb_cebmr1, cebmr2, cebmr3, cebmr4, cebmr5;
+extern const double cs_turb_cebmr1;
+extern const double cs_turb_cebmr2;
+extern const double cs_turb_cebmr3;
+extern const double cs_turb_cebmr4;
+extern const double cs_turb_cebmr5;
 extern double cs_turb_csrij;
 extern const double cs_turb_cebme2;
 extern const double cs_turb_cebmmu;
@@ -0,0 +1,675 @@
+/*============================================================================
+ * Rij-epsilon turbulence model source terms.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+
+#include "cs_base.h"
+#include "cs_field.h"
+#include "cs_field_pointer.h"
+#include "cs_field_operator.h"
+#include "cs_math.h"
+#include "cs_mesh.h"
+#include "cs_mesh_quantities.h"
+#include "cs_physical_constants.h"
+#include "cs_rotation.h"
+#include "cs_turbomachinery.h"
+#include "cs_turbulence_model.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_turbulence_rij.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+ * \file cs_turbulence_rij.c
+ *
+ * Source terms of Rij-epsilon turbulence models.
+ *
+ * Cell-local terms are computed for blocks of cells, with intermediate
+ * tensors stored component by component (structure of arrays) so that
+ * loops over cells of a block may be vectorized.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Number of cells handled together by block kernels */
+
+#define CS_RIJ_BLOCK_SIZE 32
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Symmetric tensor (11, 22, 33, 12, 23, 13) storage indexes */
+
+static const int _iv2t[6] = {0, 1, 2, 0, 1, 0};
+static const int _jv2t[6] = {0, 1, 2, 1, 2, 2};
+
+static const int _t2v[3][3] = {{0, 3, 5},
+                               {3, 1, 4},
+                               {5, 4, 2}};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Add SSG or EBRSM production, pressure-strain, dissipation and rotation
+ * source terms for a block of cells.
+ *
+ * Symmetric tensors are stored as (11, 22, 33, 12, 23, 13) components,
+ * with one array per component, and the (non symmetric) vorticity tensor
+ * as a full 3x3 array.
+ *
+ * parameters:
+ *   iturb          <-- turbulence model
+ *   icorio         <-- 1 for a rotating frame of reference, 0 otherwise
+ *   ccorio         <-- coefficient of the Coriolis-type term
+ *   cell_rotor_num <-- rotor number of cells, or NULL if no rotation
+ *   s_id           <-- id of first cell of block
+ *   e_id           <-- id of past-the-last cell of block
+ *   cell_f_vol     <-- cell fluid volumes
+ *   crom           <-- density
+ *   cromo          <-- density used for explicit terms
+ *   cvara_rij      <-- Reynolds stress at previous time step
+ *   cvara_ep       <-- dissipation at previous time step
+ *   cvar_al        <-- EBRSM blending variable, or NULL
+ *   grad_al        <-- EBRSM blending variable gradient, or NULL
+ *   gradv          <-- velocity gradient (Fortran index order)
+ *   produc         <-- production term
+ *   c_st_prv       <-> previous explicit source terms, or NULL
+ *   smbr           <-> explicit source terms
+ *   rovsdt         <-> implicit source terms (Fortran index order)
+ *----------------------------------------------------------------------------*/
+
+static void
+_rij_ssg_block_source_terms(int                   iturb,
+                            int                   icorio,
+                            cs_real_t             ccorio,
+                            const int             cell_rotor_num[],
+                            cs_lnum_t             s_id,
+                            cs_lnum_t             e_id,
+                            const cs_real_t       cell_f_vol[],
+                            const cs_real_t       crom[],
+                            const cs_real_t       cromo[],
+                            const cs_real_6_t     cvara_rij[],
+                            const cs_real_t       cvara_ep[],
+                            const cs_real_t       cvar_al[],
+                            const cs_real_3_t     grad_al[],
+                            const cs_real_33_t    gradv[],
+                            const cs_real_6_t     produc[],
+                            cs_real_6_t           c_st_prv[],
+                            cs_real_6_t           smbr[],
+                            cs_real_66_t          rovsdt[])
+{
+  const cs_lnum_t n = e_id - s_id;
+
+  const cs_real_t d1s2 = 1./2.;
+  const cs_real_t d1s3 = 1./3.;
+  const cs_real_t d2s3 = 2./3.;
+
+  const bool ebrsm = (iturb == CS_TURB_RIJ_EPSILON_EBRSM);
+
+  /* Block work arrays */
+
+  cs_real_t xr[6][CS_RIJ_BLOCK_SIZE];     /* Rij */
+  cs_real_t xp[6][CS_RIJ_BLOCK_SIZE];     /* production */
+  cs_real_t xa[6][CS_RIJ_BLOCK_SIZE];     /* anisotropy */
+  cs_real_t xs[6][CS_RIJ_BLOCK_SIZE];     /* strain rate */
+  cs_real_t oo_r[6][CS_RIJ_BLOCK_SIZE];   /* inverse of Rij */
+  cs_real_t xw[3][3][CS_RIJ_BLOCK_SIZE];  /* vorticity */
+  cs_real_t mrot[3][3][CS_RIJ_BLOCK_SIZE];
+  cs_real_t st_exp[6][CS_RIJ_BLOCK_SIZE];
+
+  cs_real_t trprod[CS_RIJ_BLOCK_SIZE], trrij[CS_RIJ_BLOCK_SIZE];
+  cs_real_t aii[CS_RIJ_BLOCK_SIZE], sqrt_aii[CS_RIJ_BLOCK_SIZE];
+  cs_real_t aklskl[CS_RIJ_BLOCK_SIZE], eigen_max[CS_RIJ_BLOCK_SIZE];
+  cs_real_t alpha3[CS_RIJ_BLOCK_SIZE], xnal[3][CS_RIJ_BLOCK_SIZE];
+
+  /* Load Rij, production, strain rate and vorticity tensors */
+
+# if defined(HAVE_OPENMP_SIMD)
+#   pragma omp simd
+# endif
+  for (cs_lnum_t i = 0; i < n; i++) {
+    const cs_lnum_t c_id = s_id + i;
+    const cs_real_t *restrict g = (const cs_real_t *)gradv[c_id];
+
+    for (int ij = 0; ij < 6; ij++) {
+      xr[ij][i] = cvara_rij[c_id][ij];
+      xp[ij][i] = produc[c_id][ij];
+    }
+
+    /* g[3*j + i] is the (i, j) entry of the Fortran gradient */
+
+    xs[0][i] = g[0];
+    xs[1][i] = g[4];
+    xs[2][i] = g[8];
+    xs[3][i] = d1s2*(g[1] + g[3]);
+    xs[4][i] = d1s2*(g[5] + g[7]);
+    xs[5][i] = d1s2*(g[2] + g[6]);
+
+    xw[0][0][i] = 0.;
+    xw[0][1][i] = d1s2*(g[1] - g[3]);
+    xw[0][2][i] = d1s2*(g[2] - g[6]);
+    xw[1][0][i] = -xw[0][1][i];
+    xw[1][1][i] = 0.;
+    xw[1][2][i] = d1s2*(g[5] - g[7]);
+    xw[2][0][i] = -xw[0][2][i];
+    xw[2][1][i] = -xw[1][2][i];
+    xw[2][2][i] = 0.;
+  }
+
+  /* Rotating frame of reference => "Coriolis production" term */
+
+  if (cell_rotor_num != NULL) {
+
+    for (cs_lnum_t i = 0; i < n; i++) {
+      const cs_lnum_t c_id = s_id + i;
+      const int r_num = cell_rotor_num[c_id];
+
+      cs_real_t tr[3][3];
+      cs_rotation_coriolis_t(cs_glob_rotation + r_num, 1., tr);
+
+      for (int ii = 0; ii < 3; ii++) {
+        for (int jj = 0; jj < 3; jj++)
+          mrot[ii][jj][i] = tr[jj][ii];
+      }
+
+      if (r_num > 0) {
+        for (int ii = 0; ii < 3; ii++) {
+          for (int jj = ii; jj < 3; jj++) {
+            const int ij = _t2v[ii][jj];
+            for (int kk = 0; kk < 3; kk++)
+              xp[ij][i] = xp[ij][i]
+                          - ccorio*(  mrot[ii][kk][i]*xr[_t2v[jj][kk]][i]
+                                    + mrot[jj][kk][i]*xr[_t2v[ii][kk]][i]);
+          }
+        }
+      }
+    }
+
+  }
+
+  /* Traces, anisotropy tensor invariants and inverse of Rij */
+
+# if defined(HAVE_OPENMP_SIMD)
+#   pragma omp simd
+# endif
+  for (cs_lnum_t i = 0; i < n; i++) {
+
+    trprod[i] = d1s2 * (xp[0][i] + xp[1][i] + xp[2][i]);
+    trrij[i]  = d1s2 * (xr[0][i] + xr[1][i] + xr[2][i]);
+
+    for (int ij = 0; ij < 3; ij++)
+      xa[ij][i] = xr[ij][i]/trrij[i] - d2s3;
+    for (int ij = 3; ij < 6; ij++)
+      xa[ij][i] = xr[ij][i]/trrij[i];
+
+    cs_real_t _aii = 0., _aklskl = 0.;
+    for (int ii = 0; ii < 3; ii++) {
+      for (int jj = 0; jj < 3; jj++) {
+        const int ij = _t2v[ii][jj];
+        _aii    = _aii + xa[ij][i]*xa[ij][i];
+        _aklskl = _aklskl + xa[ij][i]*xs[ij][i];
+      }
+    }
+    aii[i] = _aii;
+    aklskl[i] = _aklskl;
+    sqrt_aii[i] = sqrt(_aii);
+
+    /* Scaling by tr(R) in order to dodge inversion errors */
+
+    cs_real_t matrn[6], oo_matrn[6];
+    for (int ij = 0; ij < 6; ij++)
+      matrn[ij] = xr[ij][i]/trrij[i];
+
+    cs_math_sym_33_inv_cramer(matrn, oo_matrn);
+
+    for (int ij = 0; ij < 6; ij++)
+      oo_r[ij][i] = oo_matrn[ij]/trrij[i];
+  }
+
+  /* Maximal eigenvalue (in terms of norm) of S */
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    cs_real_t sym_strain[6], eigen_vals[3];
+    for (int ij = 0; ij < 6; ij++)
+      sym_strain[ij] = xs[ij][i];
+    cs_math_sym_33_eigen(sym_strain, eigen_vals);
+    eigen_max[i] = cs_math_fmax(cs_math_fmax(fabs(eigen_vals[0]),
+                                             fabs(eigen_vals[1])),
+                                fabs(eigen_vals[2]));
+  }
+
+  /* EBRSM: blending coefficient and unit vector normal to the wall */
+
+  if (ebrsm) {
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd
+#   endif
+    for (cs_lnum_t i = 0; i < n; i++) {
+      const cs_lnum_t c_id = s_id + i;
+
+      alpha3[i] = cs_math_pow3(cvar_al[c_id]);
+
+      const cs_real_t xnoral = sqrt(  grad_al[c_id][0]*grad_al[c_id][0]
+                                    + grad_al[c_id][1]*grad_al[c_id][1]
+                                    + grad_al[c_id][2]*grad_al[c_id][2]);
+      for (int ii = 0; ii < 3; ii++)
+        xnal[ii][i] = (xnoral <= cs_math_epzero) ?
+          0. : grad_al[c_id][ii]/xnoral;
+    }
+  }
+
+  /* Implicit part: diagonal and 6x6 coupling terms, assembled directly
+     in the diagonal blocks of the cell matrix.
+     The implicit components of Phi (pressure-velocity fluctuations)
+     are split into the linear part (A*R) and Id part (A*Id). */
+
+  if (c_st_prv == NULL) {
+
+    for (cs_lnum_t i = 0; i < n; i++) {
+      const cs_lnum_t c_id = s_id + i;
+
+      const cs_real_t ep = cvara_ep[c_id];
+      const cs_real_t ceps_impl = d1s3 * ep;
+
+      cs_real_t impl_id_cst, impl_lin_cst, impl_eps_cst, w2;
+
+      if (!ebrsm) {
+
+        const cs_real_t cphi3impl
+          = fabs(cs_turb_cssgr2 - cs_turb_cssgr3*sqrt_aii[i]);
+
+        impl_id_cst
+          = - d2s3*cs_turb_cssgr1*cs_math_fmin(trprod[i], 0.)      /* Phi1 */
+            - d1s3*cs_turb_cssgs2*ep*aii[i]                        /* Phi2 */
+            + cphi3impl * trrij[i] * eigen_max[i]                  /* Phi3 */
+            + 2.*d2s3*cs_turb_cssgr4*trrij[i]*eigen_max[i]         /* Phi4 */
+            + d2s3*trrij[i]*cs_turb_cssgr4*cs_math_fmax(aklskl[i], 0.);
+
+        impl_lin_cst = eigen_max[i] * (  1.             /* Production */
+                                       + cs_turb_cssgr4 /* Phi4 linear */
+                                       + cs_turb_cssgr5);
+
+        impl_eps_cst = ceps_impl;
+
+        w2 =   cell_f_vol[c_id]/trrij[i]*crom[c_id]
+             * (  cs_turb_cssgs1*ep
+                + cs_turb_cssgr1*cs_math_fmax(trprod[i], 0.));
+
+      }
+      else {
+
+        const cs_real_t a3 = alpha3[i];
+
+        const cs_real_t cphi3impl
+          = fabs(cs_turb_cebmr2 - cs_turb_cebmr3*sqrt_aii[i]);
+
+        /* PhiWall + epsilon_wall constants for EBRSM */
+        const cs_real_t cphiw_impl = 6.*(1.-a3)*ep/trrij[i];
+
+        impl_id_cst
+          = a3 * (- d2s3*cs_turb_cebmr1*cs_math_fmin(trprod[i], 0.)
+                  + cphi3impl * trrij[i] * eigen_max[i]
+                  + 2.*d2s3*cs_turb_cebmr4*trrij[i]*eigen_max[i]
+                  + d2s3*trrij[i]*cs_turb_cebmr4
+                    *cs_math_fmax(aklskl[i], 0.));
+
+        impl_lin_cst = eigen_max[i] * (  1.
+                                       + cs_turb_cebmr4 * a3
+                                       + cs_turb_cebmr5 * a3)
+                       + cphiw_impl;
+
+        impl_eps_cst = a3*ceps_impl;
+
+        w2 =   cell_f_vol[c_id]*crom[c_id]
+             * (  cs_turb_cebms1*ep/trrij[i]*a3
+                + cs_turb_cebmr1*cs_math_fmax(trprod[i]/trrij[i], 0.)*a3);
+
+      }
+
+      /* implmat2add, transposed as expected by the reduction */
+
+      cs_real_t implmat2add[3][3];
+      for (int jj = 0; jj < 3; jj++) {
+        for (int ii = 0; ii < 3; ii++) {
+          const int iii = _t2v[ii][jj];
+          const cs_real_t deltij = (iii < 3) ? 1. : 0.;
+          implmat2add[jj][ii] =   xw[ii][jj][i]
+                                + impl_lin_cst*deltij
+                                + impl_id_cst*d1s2*oo_r[iii][i]
+                                + impl_eps_cst*oo_r[iii][i];
+        }
+      }
+
+      cs_real_t impl_drsm[6][6];
+      for (int ij = 0; ij < 6; ij++) {
+        for (int kl = 0; kl < 6; kl++)
+          impl_drsm[ij][kl] = 0.;
+      }
+      cs_math_reduce_sym_prod_33_to_66(implmat2add, impl_drsm);
+
+      const cs_real_t vr = cell_f_vol[c_id]*crom[c_id];
+
+      for (int ij = 0; ij < 6; ij++) {
+        rovsdt[c_id][ij][ij] += w2;
+        for (int kl = 0; kl < 6; kl++)
+          rovsdt[c_id][ij][kl] += vr * impl_drsm[kl][ij];
+      }
+    }
+
+  }
+
+  /* Rotating frame of reference => "absolute" vorticity */
+
+  if (icorio == 1) {
+    for (int ii = 0; ii < 3; ii++) {
+      for (int jj = 0; jj < 3; jj++) {
+#       if defined(HAVE_OPENMP_SIMD)
+#         pragma omp simd
+#       endif
+        for (cs_lnum_t i = 0; i < n; i++)
+          xw[ii][jj][i] += mrot[ii][jj][i];
+      }
+    }
+  }
+
+  /* Explicit part, component by component */
+
+  for (int ij = 0; ij < 6; ij++) {
+
+    const int ii = _iv2t[ij];
+    const int jj = _jv2t[ij];
+    const cs_real_t deltij = (ij < 3) ? 1. : 0.;
+
+    if (!ebrsm) {
+
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (cs_lnum_t i = 0; i < n; i++) {
+        const cs_lnum_t c_id = s_id + i;
+        const cs_real_t ep = cvara_ep[c_id];
+
+        cs_real_t aiksjk = 0, aikrjk = 0, aikakj = 0;
+        for (int kk = 0; kk < 3; kk++) {
+          const int ik = _t2v[ii][kk], jk = _t2v[jj][kk];
+          /* aiksjk = aik.Sjk+ajk.Sik */
+          aiksjk = aiksjk + xa[ik][i]*xs[jk][i] + xa[jk][i]*xs[ik][i];
+          /* aikrjk = aik.Omega_jk + ajk.omega_ik */
+          aikrjk =   aikrjk + xa[ik][i]*xw[jj][kk][i]
+                   + xa[jk][i]*xw[ii][kk][i];
+          /* aikakj = aik*akj */
+          aikakj = aikakj + xa[ik][i]*xa[jk][i];
+        }
+
+        const cs_real_t pij = xp[ij][i];
+        const cs_real_t phiij1
+          = -ep * (  cs_turb_cssgs1*xa[ij][i]
+                   + cs_turb_cssgs2*(aikakj-d1s3*deltij*aii[i]));
+        const cs_real_t phiij2
+          = - cs_turb_cssgr1*trprod[i]*xa[ij][i]
+            + trrij[i]*xs[ij][i]*(cs_turb_cssgr2-cs_turb_cssgr3*sqrt_aii[i])
+            + cs_turb_cssgr4*trrij[i]*(aiksjk-d2s3*deltij*aklskl[i])
+            + cs_turb_cssgr5*trrij[i]* aikrjk;
+        const cs_real_t epsij = -d2s3*ep*deltij;
+
+        st_exp[ij][i] =   cromo[c_id]*cell_f_vol[c_id]
+                        * (pij+phiij1+phiij2+epsij);
+      }
+
+    }
+    else {
+
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (cs_lnum_t i = 0; i < n; i++) {
+        const cs_lnum_t c_id = s_id + i;
+        const cs_real_t ep = cvara_ep[c_id];
+        const cs_real_t a3 = alpha3[i];
+
+        cs_real_t aiksjk = 0, aikrjk = 0;
+        for (int kk = 0; kk < 3; kk++) {
+          const int ik = _t2v[ii][kk], jk = _t2v[jj][kk];
+          aiksjk = aiksjk + xa[ik][i]*xs[jk][i] + xa[jk][i]*xs[ik][i];
+          aikrjk =   aikrjk + xa[ik][i]*xw[jj][kk][i]
+                   + xa[jk][i]*xw[ii][kk][i];
+        }
+
+        /* Wall term:
+         * Phiw = -5.0 * (eps/k) * [ R*Xn + Xn^T*R - 0.5*tr(Xn*R)*(Xn + Id) ] */
+
+        cs_real_t phiijw = 0.;
+        const cs_real_t xnnd = d1s2*(xnal[ii][i]*xnal[jj][i] + deltij);
+        for (int kk = 0; kk < 3; kk++) {
+          phiijw += xr[_t2v[ii][kk]][i]*xnal[jj][i]*xnal[kk][i];
+          phiijw += xr[_t2v[jj][kk]][i]*xnal[ii][i]*xnal[kk][i];
+          for (int ll = 0; ll < 3; ll++)
+            phiijw -= xr[_t2v[kk][ll]][i]*xnal[kk][i]*xnal[ll][i]*xnnd;
+        }
+        phiijw = -5.*ep/trrij[i] * phiijw;
+
+        /* Almost homogeneous term */
+        const cs_real_t phiij1 = -ep*cs_turb_cebms1*xa[ij][i];
+        const cs_real_t phiij2
+          = - cs_turb_cebmr1*trprod[i]*xa[ij][i]
+            + trrij[i]*xs[ij][i]*(cs_turb_cebmr2-cs_turb_cebmr3*sqrt_aii[i])
+            + cs_turb_cebmr4*trrij[i]*(aiksjk-d2s3*deltij*aklskl[i])
+            + cs_turb_cebmr5*trrij[i]* aikrjk;
+
+        /* Wall (Rotta model) and homogeneous dissipation */
+        const cs_real_t epsijw = xr[ij][i]/trrij[i]*ep;
+        const cs_real_t epsij = d2s3*ep*deltij;
+
+        st_exp[ij][i] =   cell_f_vol[c_id]*crom[c_id]
+                        * (  xp[ij][i]
+                           + (1.-a3)*phiijw + a3*(phiij1+phiij2)
+                           - (1.-a3)*epsijw - a3*epsij);
+      }
+
+    }
+
+  }
+
+  /* Add explicit terms to the previous source terms if those are
+     extrapolated, to the right-hand side otherwise */
+
+  cs_real_6_t *restrict st = (c_st_prv != NULL) ? c_st_prv : smbr;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    const cs_lnum_t c_id = s_id + i;
+    for (int ij = 0; ij < 6; ij++)
+      st[c_id][ij] += st_exp[ij][i];
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add production, pressure-strain correlation, dissipation and
+ *        rotation source terms of the coupled Rij equations for the
+ *        SSG and EBRSM models.
+ *
+ * Explicit terms are added to the right-hand side (or to the previous
+ * source terms when those are extrapolated), and implicit terms to the
+ * 6x6 diagonal blocks of the coupled system.
+ *
+ * Arrays are indexed as the Fortran arrays of the caller, so that
+ * gradv[c][j][i] is the (i, j) entry of the Fortran gradv array and
+ * rovsdt[c][j][i] the (i, j) term of the cell's block.
+ *
+ * \param[in]       gradv   velocity gradient
+ * \param[in]       produc  production term
+ * \param[in, out]  smbr    explicit source terms
+ * \param[in, out]  rovsdt  implicit source terms (6x6 diagonal blocks)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_turbulence_rij_ssg_source_terms(const cs_real_33_t  gradv[],
+                                   const cs_real_6_t   produc[],
+                                   cs_real_6_t         smbr[],
+                                   cs_real_66_t        rovsdt[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_real_t *cell_f_vol = cs_glob_mesh_quantities->cell_f_vol;
+
+  const int iturb = cs_glob_turb_model->iturb;
+
+  cs_field_t *f_rij = CS_F_(rij);
+
+  const cs_real_6_t *cvara_rij = (const cs_real_6_t *)f_rij->val_pre;
+  const cs_real_t *cvara_ep = CS_F_(eps)->val_pre;
+  const cs_real_t *crom = CS_F_(rho)->val;
+  const cs_real_t *cromo = crom;
+
+  /* Extrapolated source terms */
+
+  cs_real_6_t *c_st_prv = NULL;
+
+  const int kstprv = cs_field_key_id("source_term_prev_id");
+  const int st_prv_id = cs_field_get_key_int(f_rij, kstprv);
+
+  if (st_prv_id > -1) {
+    c_st_prv = (cs_real_6_t *)cs_field_by_id(st_prv_id)->val;
+
+    const int key_t_ext_id = cs_field_key_id("time_extrapolated");
+    if (cs_field_get_key_int(CS_F_(rho), key_t_ext_id) > 0)
+      cromo = CS_F_(rho)->val_pre;
+  }
+
+  /* Rotating frame of reference */
+
+  const int icorio = cs_glob_physical_constants->icorio;
+  const cs_turbomachinery_model_t iturbo = cs_turbomachinery_get_model();
+
+  const int *cell_rotor_num = NULL;
+  cs_real_t ccorio = 0.;
+
+  if (icorio == 1 || iturbo == CS_TURBOMACHINERY_FROZEN) {
+    cell_rotor_num = cs_turbomachinery_get_cell_rotor_num();
+
+    /* Relative velocity formulation */
+    if (icorio == 1)
+      ccorio = 2.;
+    /* Mixed relative/absolute velocity formulation */
+    else
+      ccorio = 1.;
+  }
+
+  /* EBRSM: gradient of the blending variable */
+
+  const cs_real_t *cvar_al = NULL;
+  cs_real_3_t *grad_al = NULL;
+
+  if (iturb == CS_TURB_RIJ_EPSILON_EBRSM) {
+    cvar_al = CS_F_(alp_bl)->val;
+
+    BFT_MALLOC(grad_al, m->n_cells_with_ghosts, cs_real_3_t);
+
+    cs_field_gradient_scalar(CS_F_(alp_bl),
+                             true,  /* use_previous_t */
+                             1,     /* inc */
+                             true,  /* iccocg */
+                             grad_al);
+  }
+
+  /* Loop on blocks of cells */
+
+  const cs_lnum_t n_blocks
+    = (n_cells + CS_RIJ_BLOCK_SIZE - 1) / CS_RIJ_BLOCK_SIZE;
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+    const cs_lnum_t s_id = b_id*CS_RIJ_BLOCK_SIZE;
+    const cs_lnum_t e_id = CS_MIN(s_id + CS_RIJ_BLOCK_SIZE, n_cells);
+
+    _rij_ssg_block_source_terms(iturb,
+                                icorio,
+                                ccorio,
+                                cell_rotor_num,
+                                s_id,
+                                e_id,
+                                cell_f_vol,
+                                crom,
+                                cromo,
+                                cvara_rij,
+                                cvara_ep,
+                                cvar_al,
+                                (const cs_real_3_t *)grad_al,
+                                gradv,
+                                produc,
+                                c_st_prv,
+                                smbr,
+                                rovsdt);
+  }
+
+  BFT_FREE(grad_al);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,75 @@
+#ifndef __CS_TURBULENCE_RIJ_H__
+#define __CS_TURBULENCE_RIJ_H__
+
+/*============================================================================
+ * Rij-epsilon turbulence model source terms.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add production, pressure-strain correlation, dissipation and
+ *        rotation source terms of the coupled Rij equations for the
+ *        SSG and EBRSM models.
+ *
+ * Explicit terms are added to the right-hand side (or to the previous
+ * source terms when those are extrapolated), and implicit terms to the
+ * 6x6 diagonal blocks of the coupled system.
+ *
+ * Arrays are indexed as the Fortran arrays of the caller, so that
+ * gradv[c][j][i] is the (i, j) entry of the Fortran gradv array and
+ * rovsdt[c][j][i] the (i, j) term of the cell's block.
+ *
+ * \param[in]       gradv   velocity gradient
+ * \param[in]       produc  production term
+ * \param[in, out]  smbr    explicit source terms
+ * \param[in, out]  rovsdt  implicit source terms (6x6 diagonal blocks)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_turbulence_rij_ssg_source_terms(const cs_real_33_t  gradv[],
+                                   const cs_real_6_t   produc[],
+                                   cs_real_6_t         smbr[],
+                                   cs_real_66_t        rovsdt[]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_TURBULENCE_RIJ_H__ */
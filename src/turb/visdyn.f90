@@ -120,6 +120,7 @@ double precision, allocatable, dimension(:) :: w4, w5, w6
 double precision, allocatable, dimension(:) :: w7, w8, w9
 double precision, allocatable, dimension(:) :: w10, w0
 double precision, allocatable, dimension(:,:) :: xmij, w61, w62
+double precision, allocatable, dimension(:,:) :: w91, w92
 double precision, dimension(:,:,:), allocatable :: gradv, gradvf
 double precision, dimension(:,:), pointer :: coefau
 double precision, dimension(:,:,:), pointer :: coefbu
@@ -275,60 +276,37 @@ allocate(w5(ncelet), w6(ncelet), w7(ncelet))
 allocate(w8(ncelet), w9(ncelet), w10(ncelet))
 
 ! Filtering the velocity and its square
+! (all components are filtered in a single call)
 
-! U**2
-do iel = 1,ncel
-  w0(iel) = vel(1,iel)*vel(1,iel)
-enddo
-call les_filter(1, w0, w1)
-
-! V**2
-do iel = 1,ncel
-  w0(iel) = vel(2,iel)*vel(2,iel)
-enddo
-call les_filter(1, w0, w2)
-
-! W**2
-do iel = 1,ncel
-  w0(iel) = vel(3,iel)*vel(3,iel)
-enddo
-call les_filter(1, w0, w3)
-
-! UV
-do iel = 1,ncel
-  w0(iel) = vel(1,iel)*vel(2,iel)
-enddo
-call les_filter(1, w0, w4)
+allocate(w91(9,ncelet), w92(9,ncelet))
 
-! UW
-do iel = 1,ncel
-  w0(iel) = vel(1,iel)*vel(3,iel)
-enddo
-call les_filter(1, w0, w5)
-
-! VW
-do iel = 1,ncel
-  w0(iel) = vel(2,iel)*vel(3,iel)
+do iel = 1, ncel
+  w91(1,iel) = vel(1,iel)*vel(1,iel)
+  w91(2,iel) = vel(2,iel)*vel(2,iel)
+  w91(3,iel) = vel(3,iel)*vel(3,iel)
+  w91(4,iel) = vel(1,iel)*vel(2,iel)
+  w91(5,iel) = vel(1,iel)*vel(3,iel)
+  w91(6,iel) = vel(2,iel)*vel(3,iel)
+  w91(7,iel) = vel(1,iel)
+  w91(8,iel) = vel(2,iel)
+  w91(9,iel) = vel(3,iel)
 enddo
-call les_filter(1, w0, w6)
 
-! U
-do iel = 1,ncel
-  w0(iel) = vel(1,iel)
-enddo
-call les_filter(1, w0, w7)
+call les_filter(9, w91, w92)
 
-! V
-do iel = 1,ncel
-  w0(iel) = vel(2,iel)
+do iel = 1, ncel
+  w1(iel) = w92(1,iel)
+  w2(iel) = w92(2,iel)
+  w3(iel) = w92(3,iel)
+  w4(iel) = w92(4,iel)
+  w5(iel) = w92(5,iel)
+  w6(iel) = w92(6,iel)
+  w7(iel) = w92(7,iel)
+  w8(iel) = w92(8,iel)
+  w9(iel) = w92(9,iel)
 enddo
-call les_filter(1, w0, w8)
 
-! W
-do iel = 1,ncel
-  w0(iel) = vel(3,iel)
-enddo
-call les_filter(1, w0, w9)
+deallocate(w91, w92)
 
 do iel = 1, ncel
 
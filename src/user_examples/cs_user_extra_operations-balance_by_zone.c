@@ -71,6 +71,39 @@ BEGIN_C_DECLS
  * User function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize variables.
+ *
+ * This function is called at beginning of the computation
+ * (restart or not) before the time step loop.
+ *
+ * \param[in, out]  domain   pointer to a cs_domain_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_user_extra_operations_initialize(cs_domain_t     *domain)
+{
+  CS_UNUSED(domain);
+
+  //!< [example_7]
+
+  /* Balances defined here are computed and logged at each time step;
+     balances of a same scalar share gradient computations and
+     a single pass on the mesh. */
+
+  cs_balance_by_zone_add("all[]", "scalar1");
+
+  cs_balance_by_zone_add("box[-0.5, 1.3, 0.0, 1.0, 1.9, 1.0]", "scalar1");
+
+  cs_real_t normal[3] = {0., 0., 1.,};
+
+  cs_surface_balance_add("selection_criterion", "scalar1", normal);
+
+  //!< [example_7]
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief This function is called at the end of each time step.
@@ -409,6 +409,18 @@ cs_user_mesh_modify(cs_mesh_t  *mesh)
   }
   /*! [mesh_modify_refine_1] */
 
+  /* Adapt mesh based on an indicator from a previous computation */
+  /*! [mesh_modify_adapt_1] */
+  {
+    cs_mesh_adapt_from_restart(mesh,
+                               "auxiliary.csc",     /* restart file */
+                               "adapt_indicator",   /* section name */
+                               0.1,                 /* refine fraction */
+                               0.05,                /* coarsen fraction */
+                               3);                  /* max. level */
+  }
+  /*! [mesh_modify_adapt_1] */
+
   /* Remove cells from a selection
    * Note: if present, remove periodicity info first */
   /*! [mesh_modify_remove_cells] */
@@ -1218,6 +1218,10 @@ cs_user_parameters(cs_domain_t *domain)
   cs_glob_porosity_from_scan_opt->transformation_matrix[1][1] =  cos(angle);
   cs_glob_porosity_from_scan_opt->transformation_matrix[2][2] = 1.;
 
+  /* Merge points in voxels of given size before locating them in cells,
+     which reduces the cost for very large scans (optional) */
+  cs_glob_porosity_from_scan_opt->voxel_size = 0.01;
+
   /* Add some sources to fill fluid space */
   {
     cs_real_3_t source = {4.295, 1.15326, 0.5};
@@ -288,10 +288,12 @@ cs_user_linear_solvers(void)
   /* Available native iterative linear solvers are:
    *
    *  CS_SLES_PCG                 (preconditioned conjugate gradient)
+   *  CS_SLES_PIPELINED_PCG       (pipelined preconditioned conjugate gradient)
    *  CS_SLES_JACOBI              (Jacobi)
    *  CS_SLES_BICGSTAB            (Bi-conjugate gradient stabilized)
    *  CS_SLES_BICGSTAB2           (BiCGStab2)
    *  CS_SLES_GMRES               (generalized minimal residual)
+   *  CS_SLES_S_STEP_GMRES        (s-step GMRES, one reduction per s vectors)
    *  CS_SLES_P_GAUSS_SEIDEL      (process-local Gauss-Seidel)
    *  CS_SLES_P_SYM_GAUSS_SEIDEL  (process-local symmetric Gauss-Seidel)
    *  CS_SLES_PCR3                (3-layer conjugate residual)
@@ -376,6 +378,11 @@ cs_user_linear_solvers(void)
        -1.0,           /* precision multiplier ascent (< 0 forces max iters) */
        0.1);           /* requested precision multiplier coarse (default 1) */
 
+    /* Use single precision coefficients for products on levels >= 2 */
+
+    cs_multigrid_set_coarse_precision(mg,
+                                      2);  /* min. level (default 0: none) */
+
   }
   /*! [sles_mgp_1] */
 
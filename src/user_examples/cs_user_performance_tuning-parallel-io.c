@@ -84,6 +84,8 @@ cs_user_parallel_io(void)
      CS_FILE_STDIO_SERIAL        Serial standard C IO
                                  (funnelled through rank 0 in parallel)
      CS_FILE_STDIO_PARALLEL      Per-process standard C IO
+     CS_FILE_MMAP                Per-process memory-mapped file access
+                                 (for reading only)
      CS_FILE_MPI_INDEPENDENT     Non-collective MPI-IO
                                  with independent file open and close
      CS_FILE_MPI_NON_COLLECTIVE  Non-collective MPI-IO
@@ -59,6 +59,48 @@ BEGIN_C_DECLS
  */
 /*----------------------------------------------------------------------------*/
 
+/*============================================================================
+ * Local function definitions
+ *============================================================================*/
+
+/*! [performance_tuning_partition_weight_func] */
+
+/*----------------------------------------------------------------------------
+ * Define cell weights for partitioning: cells of a given group class
+ * (such as a reactive or Lagrangian injection zone) are assumed to
+ * be 3 times more expensive than other cells.
+ *
+ * parameters:
+ *   input       <-> pointer to optional (untyped) value or structure
+ *   mesh        <-- pointer to mesh structure
+ *   mb          <-- pointer to mesh builder structure
+ *   cell_weight --> weight associated with each cell
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_weights(void                     *input,
+              const cs_mesh_t          *mesh,
+              const cs_mesh_builder_t  *mb,
+              cs_real_t                 cell_weight[])
+{
+  CS_UNUSED(mesh);
+
+  const int *gc_id_weighted = input;
+
+  cs_lnum_t n_cells = 0;
+  if (mb->cell_bi.gnum_range[1] > mb->cell_bi.gnum_range[0])
+    n_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    if (mb->cell_gc_id[i] == *gc_id_weighted)
+      cell_weight[i] = 3.;
+    else
+      cell_weight[i] = 1.;
+  }
+}
+
+/*! [performance_tuning_partition_weight_func] */
+
 /*============================================================================
  * User function definitions
  *============================================================================*/
@@ -145,6 +187,17 @@ cs_user_partition(void)
   }
   /*! [performance_tuning_partition_4] */
 
+  /*! [performance_tuning_partition_5] */
+  {
+    /* Example: define cell weights for the main partitioning so that
+     * expensive cells are balanced among ranks (see _cell_weights above). */
+
+    static int gc_id_weighted = 2;
+
+    cs_partition_set_cell_weights(_cell_weights, &gc_id_weighted);
+  }
+  /*! [performance_tuning_partition_5] */
+
 }
 
 /*----------------------------------------------------------------------------*/
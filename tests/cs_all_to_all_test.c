@@ -132,17 +132,25 @@ main (int argc, char *argv[])
   sprintf(mem_trace_name, "cs_all_to_all_test_mem.%d", rank);
   bft_mem_init(mem_trace_name);
 
-  cs_all_to_all_type_t a2at[5] = {CS_ALL_TO_ALL_MPI_DEFAULT,
+  cs_all_to_all_type_t a2at[9] = {CS_ALL_TO_ALL_MPI_DEFAULT,
                                   CS_ALL_TO_ALL_CRYSTAL_ROUTER,
                                   CS_ALL_TO_ALL_CRYSTAL_ROUTER,
                                   CS_ALL_TO_ALL_MPI_DEFAULT,
-                                  CS_ALL_TO_ALL_CRYSTAL_ROUTER};
+                                  CS_ALL_TO_ALL_CRYSTAL_ROUTER,
+                                  CS_ALL_TO_ALL_NEIGHBOR_COLLECTIVE,
+                                  CS_ALL_TO_ALL_NEIGHBOR_COLLECTIVE,
+                                  CS_ALL_TO_ALL_AUTO,
+                                  CS_ALL_TO_ALL_AUTO};
 
-  int a2a_flags[5] = {0, 0, CS_ALL_TO_ALL_ORDER_BY_SRC_RANK,
+  int a2a_flags[9] = {0, 0, CS_ALL_TO_ALL_ORDER_BY_SRC_RANK,
+                      CS_ALL_TO_ALL_USE_DEST_ID,
+                      CS_ALL_TO_ALL_USE_DEST_ID,
+                      0,
                       CS_ALL_TO_ALL_USE_DEST_ID,
+                      0,
                       CS_ALL_TO_ALL_USE_DEST_ID};
 
-  for (int test_id = 0; test_id < 5; test_id++) {
+  for (int test_id = 0; test_id < 9; test_id++) {
 
     cs_all_to_all_set_type(a2at[test_id]);
 
@@ -161,7 +169,7 @@ main (int argc, char *argv[])
     cs_gnum_t *part_gnum = NULL;
     cs_all_to_all_t *d = NULL;
 
-    if (test_id < 3) {
+    if (test_id < 3 || test_id == 5 || test_id == 7) {
 
       n_elts = 3 + rank%3;
 
@@ -0,0 +1,606 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*
+ * Standalone linear solver check.
+ *
+ * A linear system written by cs_matrix_dump_linear_system() (or by the
+ * cs_matrix_dump_test() helper) is read back, converted to an edge-based
+ * matrix, and solved with a chosen iterative solver. Setup and solve times
+ * are reported, so as to allow comparing solver and preconditioner settings
+ * on a production matrix without running the full code.
+ *
+ * This check is serial only; dumps produced in parallel are read as a single
+ * domain. Multigrid is not available here, as coarsening requires the mesh
+ * geometry.
+ */
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_blas.h"
+#include "cs_file.h"
+#include "cs_log.h"
+#include "cs_matrix.h"
+#include "cs_order.h"
+#include "cs_sles.h"
+#include "cs_sles_it.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Linear system read from a dump */
+
+typedef struct {
+
+  cs_lnum_t     n_rows;     /* number of rows */
+  cs_lnum_t     n_edges;    /* number of matrix edges */
+  bool          symmetric;  /* are extradiagonal terms symmetric ? */
+
+  cs_lnum_2_t  *edges;      /* edges (i, j), with i < j */
+  cs_real_t    *da;         /* diagonal values */
+  cs_real_t    *xa;         /* extradiagonal values (xa[n_edges] if
+                               symmetric, xa[n_edges][2] otherwise) */
+  cs_real_t    *rhs;        /* right-hand side */
+
+} _linear_system_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char *_solver_name[] = {"pcg", "fcg", "ipcg", "pipelined_pcg",
+                                     "deflated_pcg", "jacobi", "bicgstab",
+                                     "bicgstab2", "gcr", "gmres",
+                                     "s_step_gmres", "gauss_seidel",
+                                     "sym_gauss_seidel", "pcr3"};
+
+static const cs_sles_it_type_t _solver_type[] = {CS_SLES_PCG,
+                                                 CS_SLES_FCG,
+                                                 CS_SLES_IPCG,
+                                                 CS_SLES_PIPELINED_PCG,
+                                                 CS_SLES_DEFLATED_PCG,
+                                                 CS_SLES_JACOBI,
+                                                 CS_SLES_BICGSTAB,
+                                                 CS_SLES_BICGSTAB2,
+                                                 CS_SLES_GCR,
+                                                 CS_SLES_GMRES,
+                                                 CS_SLES_S_STEP_GMRES,
+                                                 CS_SLES_P_GAUSS_SEIDEL,
+                                                 CS_SLES_P_SYM_GAUSS_SEIDEL,
+                                                 CS_SLES_PCR3};
+
+static const char *_matrix_name[] = {"native", "csr", "msr"};
+
+static const cs_matrix_type_t _matrix_type[] = {CS_MATRIX_NATIVE,
+                                                CS_MATRIX_CSR,
+                                                CS_MATRIX_MSR};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Print usage and exit.
+ *
+ * parameters:
+ *   arg_0     <-- name of executable as given by argv[0]
+ *   exit_code <-- EXIT_SUCCESS or EXIT_FAILURE
+ *----------------------------------------------------------------------------*/
+
+static void
+_usage(const char  *arg_0,
+       int          exit_code)
+{
+  size_t n_solvers = sizeof(_solver_name) / sizeof(_solver_name[0]);
+
+  printf("\n"
+         "Usage: %s [options] <linear_system_dump>\n\n"
+         "Options:\n\n"
+         " -s <solver>     iterative solver (default: pcg)\n"
+         " -p <degree>     polynomial preconditioning degree\n"
+         "                 (-1: none, 0: Jacobi; default: 0)\n"
+         " -m <type>       matrix type: native, csr, msr (default: native)\n"
+         " -n <n_max_iter> maximum number of iterations (default: 10000)\n"
+         " -e <precision>  relative precision (default: 1e-8)\n"
+         " -r <n_runs>     number of timed solves (default: 1)\n"
+         " -h              this message\n\n"
+         "Available solvers:\n ",
+         arg_0);
+  for (size_t i = 0; i < n_solvers; i++)
+    printf(" %s", _solver_name[i]);
+  printf("\n\n");
+
+  exit(exit_code);
+}
+
+/*----------------------------------------------------------------------------
+ * Return index of a string in a list of names, or -1.
+ *----------------------------------------------------------------------------*/
+
+static int
+_name_id(const char   *s,
+         const char  **names,
+         size_t        n_names)
+{
+  for (size_t i = 0; i < n_names; i++) {
+    if (strcmp(s, names[i]) == 0)
+      return i;
+  }
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a linear system written by cs_matrix_dump_linear_system().
+ *
+ * File format:
+ *   - header: sizeof(cs_gnum_t), sizeof(double), endianness ('b' or 'l')
+ *   - number of matrix entries (1 integer of type cs_gnum_t)
+ *   - row and column coordinates (1-based, sorted by row then column)
+ *   - matrix values (double)
+ *   - vector size (1 integer of type cs_gnum_t)
+ *   - vector values (double)
+ *
+ * parameters:
+ *   path <-- path to dump file
+ *   ls   --> linear system
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_linear_system(const char        *path,
+                    _linear_system_t  *ls)
+{
+  unsigned char flags[3];
+  cs_gnum_t n_ents = 0, n_g_rows = 0;
+
+  cs_file_t *f = cs_file_open_default(path, CS_FILE_MODE_READ);
+
+  cs_file_read_global(f, flags, 1, 3);
+
+  if (flags[0] != sizeof(cs_gnum_t) || flags[1] != sizeof(double))
+    bft_error(__FILE__, __LINE__, 0,
+              _("File \"%s\" uses %d-byte integers and %d-byte reals,\n"
+                "while this build uses %d and %d bytes."),
+              path, (int)flags[0], (int)flags[1],
+              (int)sizeof(cs_gnum_t), (int)sizeof(double));
+
+  {
+    unsigned  int_endian = 0;
+    *((char *)(&int_endian)) = '\1';
+    char l_endian = (int_endian == 1) ? 'l' : 'b';
+    if (flags[2] != l_endian)
+      cs_file_set_swap_endian(f, 1);
+  }
+
+  /* Matrix coordinates and values */
+
+  cs_gnum_t *r_coords, *c_coords;
+  double *m_vals;
+
+  cs_file_read_global(f, &n_ents, sizeof(cs_gnum_t), 1);
+
+  BFT_MALLOC(r_coords, n_ents, cs_gnum_t);
+  BFT_MALLOC(c_coords, n_ents, cs_gnum_t);
+  BFT_MALLOC(m_vals, n_ents, double);
+
+  cs_file_read_global(f, r_coords, sizeof(cs_gnum_t), n_ents);
+  cs_file_read_global(f, c_coords, sizeof(cs_gnum_t), n_ents);
+  cs_file_read_global(f, m_vals, sizeof(double), n_ents);
+
+  /* Right-hand side */
+
+  cs_file_read_global(f, &n_g_rows, sizeof(cs_gnum_t), 1);
+
+  ls->n_rows = n_g_rows;
+
+  BFT_MALLOC(ls->rhs, ls->n_rows, cs_real_t);
+  {
+    double *_rhs = NULL;
+    BFT_MALLOC(_rhs, ls->n_rows, double);
+    if (cs_file_read_global(f, _rhs, sizeof(double), ls->n_rows)
+        != (size_t)(ls->n_rows))
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error reading right-hand side from file \"%s\"."), path);
+    for (cs_lnum_t i = 0; i < ls->n_rows; i++)
+      ls->rhs[i] = _rhs[i];
+    BFT_FREE(_rhs);
+  }
+
+  f = cs_file_free(f);
+
+  /* Build edge keys (min, max) for extradiagonal terms */
+
+  cs_lnum_t n_xa = 0;
+  cs_gnum_t *keys;
+  cs_lnum_t *xa_src;
+
+  BFT_MALLOC(ls->da, ls->n_rows, cs_real_t);
+  for (cs_lnum_t i = 0; i < ls->n_rows; i++)
+    ls->da[i] = 0.;
+
+  BFT_MALLOC(keys, n_ents*2, cs_gnum_t);
+  BFT_MALLOC(xa_src, n_ents, cs_lnum_t);
+
+  for (cs_gnum_t k = 0; k < n_ents; k++) {
+    cs_gnum_t r = r_coords[k], c = c_coords[k];
+    if (r < 1 || c < 1 || r > n_g_rows || c > n_g_rows)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Matrix entry (%llu, %llu) out of range in file \"%s\"."),
+                (unsigned long long)r, (unsigned long long)c, path);
+    if (r == c)
+      ls->da[r-1] += m_vals[k];
+    else {
+      keys[n_xa*2]     = CS_MIN(r, c);
+      keys[n_xa*2 + 1] = CS_MAX(r, c);
+      xa_src[n_xa] = k;
+      n_xa++;
+    }
+  }
+
+  cs_lnum_t *order = cs_order_gnum_s(NULL, keys, 2, n_xa);
+
+  /* Merge (i, j) and (j, i) entries into a single edge */
+
+  BFT_MALLOC(ls->edges, n_xa, cs_lnum_2_t);
+  BFT_MALLOC(ls->xa, n_xa*2, cs_real_t);
+
+  cs_lnum_t n_edges = 0;
+
+  for (cs_lnum_t o_id = 0; o_id < n_xa; o_id++) {
+    cs_lnum_t k = order[o_id];
+    cs_lnum_t i = keys[k*2] - 1, j = keys[k*2 + 1] - 1;
+    if (   n_edges == 0
+        || ls->edges[n_edges-1][0] != i || ls->edges[n_edges-1][1] != j) {
+      ls->edges[n_edges][0] = i;
+      ls->edges[n_edges][1] = j;
+      ls->xa[n_edges*2] = 0.;
+      ls->xa[n_edges*2 + 1] = 0.;
+      n_edges++;
+    }
+    cs_gnum_t s = xa_src[k];
+    if (r_coords[s] < c_coords[s])
+      ls->xa[(n_edges-1)*2] += m_vals[s];
+    else
+      ls->xa[(n_edges-1)*2 + 1] += m_vals[s];
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(xa_src);
+  BFT_FREE(keys);
+  BFT_FREE(m_vals);
+  BFT_FREE(c_coords);
+  BFT_FREE(r_coords);
+
+  ls->n_edges = n_edges;
+  BFT_REALLOC(ls->edges, n_edges, cs_lnum_2_t);
+
+  /* Use symmetric storage when possible */
+
+  ls->symmetric = true;
+  for (cs_lnum_t e_id = 0; e_id < n_edges; e_id++) {
+    if (ls->xa[e_id*2] != ls->xa[e_id*2 + 1]) {
+      ls->symmetric = false;
+      break;
+    }
+  }
+
+  if (ls->symmetric) {
+    for (cs_lnum_t e_id = 0; e_id < n_edges; e_id++)
+      ls->xa[e_id] = ls->xa[e_id*2];
+    BFT_REALLOC(ls->xa, n_edges, cs_real_t);
+  }
+  else
+    BFT_REALLOC(ls->xa, n_edges*2, cs_real_t);
+}
+
+/*----------------------------------------------------------------------------
+ * Free linear system arrays.
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_linear_system(_linear_system_t  *ls)
+{
+  BFT_FREE(ls->edges);
+  BFT_FREE(ls->da);
+  BFT_FREE(ls->xa);
+  BFT_FREE(ls->rhs);
+}
+
+/*----------------------------------------------------------------------------
+ * Return true residual norm ||b - A.x|| / ||b||.
+ *----------------------------------------------------------------------------*/
+
+static double
+_true_residual(const cs_matrix_t  *a,
+               cs_lnum_t           n_rows,
+               const cs_real_t     rhs[],
+               cs_real_t           vx[])
+{
+  cs_real_t *r;
+  BFT_MALLOC(r, n_rows, cs_real_t);
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, a, vx, r);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    r[i] = rhs[i] - r[i];
+
+  double r_norm = sqrt(cs_dot_xx(n_rows, r));
+  double b_norm = sqrt(cs_dot_xx(n_rows, rhs));
+
+  BFT_FREE(r);
+
+  return (b_norm > 0.) ? r_norm / b_norm : r_norm;
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  const char *path = NULL;
+  int solver_id = 0, matrix_id = 0;
+  int poly_degree = 0, n_max_iter = 10000, n_runs = 1;
+  double precision = 1e-8;
+
+  size_t n_solvers = sizeof(_solver_name) / sizeof(_solver_name[0]);
+  size_t n_matrix_types = sizeof(_matrix_name) / sizeof(_matrix_name[0]);
+
+  /* Parse command line */
+
+  for (int i = 1; i < argc; i++) {
+    const char *s = argv[i];
+    if (strcmp(s, "-h") == 0 || strcmp(s, "--help") == 0)
+      _usage(argv[0], EXIT_SUCCESS);
+    else if (s[0] == '-' && s[1] != '\0' && s[2] == '\0') {
+      if (i + 1 >= argc)
+        _usage(argv[0], EXIT_FAILURE);
+      const char *v = argv[++i];
+      switch (s[1]) {
+      case 's':
+        solver_id = _name_id(v, _solver_name, n_solvers);
+        break;
+      case 'm':
+        matrix_id = _name_id(v, _matrix_name, n_matrix_types);
+        break;
+      case 'p':
+        poly_degree = atoi(v);
+        break;
+      case 'n':
+        n_max_iter = atoi(v);
+        break;
+      case 'e':
+        precision = atof(v);
+        break;
+      case 'r':
+        n_runs = atoi(v);
+        break;
+      default:
+        _usage(argv[0], EXIT_FAILURE);
+      }
+      if (solver_id < 0 || matrix_id < 0 || n_max_iter < 1 || n_runs < 1)
+        _usage(argv[0], EXIT_FAILURE);
+    }
+    else if (path == NULL)
+      path = s;
+    else
+      _usage(argv[0], EXIT_FAILURE);
+  }
+
+  if (path == NULL)
+    _usage(argv[0], EXIT_FAILURE);
+
+#if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
+  {
+    int t_id;
+#pragma omp parallel private(t_id)
+    {
+      t_id = omp_get_thread_num();
+      if (t_id == 0)
+        cs_glob_n_threads = omp_get_max_threads();
+    }
+  }
+#endif
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  (void)cs_timer_wtime();
+
+  cs_sles_initialize();
+
+  /* Read system */
+
+  _linear_system_t ls;
+  cs_timer_t t0 = cs_timer_time();
+
+  _read_linear_system(path, &ls);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_t t_read;
+  CS_TIMER_COUNTER_INIT(t_read);
+  cs_timer_counter_add_diff(&t_read, &t0, &t1);
+
+  bft_printf("\n"
+             " Linear system: %s\n"
+             "   rows:        %ld\n"
+             "   edges:       %ld\n"
+             "   symmetric:   %s\n"
+             "   read time:   %12.5f s\n",
+             path, (long)ls.n_rows, (long)ls.n_edges,
+             (ls.symmetric) ? "yes" : "no",
+             t_read.wall_nsec*1e-9);
+
+  /* Build matrix */
+
+  t0 = cs_timer_time();
+
+  cs_matrix_structure_t *ms
+    = cs_matrix_structure_create(_matrix_type[matrix_id],
+                                 true,
+                                 ls.n_rows,
+                                 ls.n_rows,
+                                 ls.n_edges,
+                                 (const cs_lnum_2_t *)ls.edges,
+                                 NULL,
+                                 NULL);
+
+  cs_matrix_t *a = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(a,
+                             ls.symmetric,
+                             NULL,
+                             NULL,
+                             ls.n_edges,
+                             (const cs_lnum_2_t *)ls.edges,
+                             ls.da,
+                             ls.xa);
+
+  t1 = cs_timer_time();
+  cs_timer_counter_t t_matrix;
+  CS_TIMER_COUNTER_INIT(t_matrix);
+  cs_timer_counter_add_diff(&t_matrix, &t0, &t1);
+
+  /* Define solver */
+
+  const char *sles_name = "cs_check_sles";
+
+  cs_sles_it_define(-1,
+                    sles_name,
+                    _solver_type[solver_id],
+                    poly_degree,
+                    n_max_iter);
+
+  cs_sles_t *sc = cs_sles_find(-1, sles_name);
+
+  /* Setup and solve */
+
+  cs_real_t *vx;
+  BFT_MALLOC(vx, ls.n_rows, cs_real_t);
+
+  double r_norm = sqrt(cs_dot_xx(ls.n_rows, ls.rhs));
+  if (r_norm <= 0.)
+    r_norm = 1.;
+
+  t0 = cs_timer_time();
+
+  cs_sles_setup(sc, a);
+
+  t1 = cs_timer_time();
+  cs_timer_counter_t t_setup, t_solve;
+  CS_TIMER_COUNTER_INIT(t_setup);
+  CS_TIMER_COUNTER_INIT(t_solve);
+  cs_timer_counter_add_diff(&t_setup, &t0, &t1);
+
+  int n_iter = 0;
+  double residue = 0.;
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+
+  for (int run_id = 0; run_id < n_runs; run_id++) {
+
+    for (cs_lnum_t i = 0; i < ls.n_rows; i++)
+      vx[i] = 0.;
+
+    t0 = cs_timer_time();
+
+    cvg = cs_sles_solve(sc,
+                        a,
+                        CS_HALO_ROTATION_COPY,
+                        precision,
+                        r_norm,
+                        &n_iter,
+                        &residue,
+                        ls.rhs,
+                        vx,
+                        0,
+                        NULL);
+
+    t1 = cs_timer_time();
+    cs_timer_counter_add_diff(&t_solve, &t0, &t1);
+
+  }
+
+  cs_sles_free(sc);
+
+  double t_res = _true_residual(a, ls.n_rows, ls.rhs, vx);
+
+  bft_printf("\n"
+             " Solver:          %s\n"
+             "   matrix type:   %s\n"
+             "   poly. degree:  %d\n"
+             "   precision:     %g\n"
+             "   convergence:   %s\n"
+             "   iterations:    %d\n"
+             "   residue:       %12.5e\n"
+             "   true residual: %12.5e\n"
+             "\n"
+             " Timing:\n"
+             "   matrix build:  %12.5f s\n"
+             "   setup:         %12.5f s\n"
+             "   solve (mean):  %12.5f s (%d runs)\n"
+             "   per iteration: %12.5e s\n\n",
+             _solver_name[solver_id], _matrix_name[matrix_id],
+             poly_degree, precision,
+             (cvg == CS_SLES_CONVERGED) ? "converged" : "not converged",
+             n_iter, residue, t_res,
+             t_matrix.wall_nsec*1e-9, t_setup.wall_nsec*1e-9,
+             t_solve.wall_nsec*1e-9/n_runs, n_runs,
+             (n_iter > 0) ? t_solve.wall_nsec*1e-9/(n_runs*n_iter) : 0.);
+
+  cs_sles_log(CS_LOG_PERFORMANCE);
+
+  /* Cleanup */
+
+  BFT_FREE(vx);
+
+  cs_matrix_destroy(&a);
+  cs_matrix_structure_destroy(&ms);
+
+  _free_linear_system(&ls);
+
+  cs_sles_finalize();
+
+  bft_mem_end();
+
+  exit((cvg == CS_SLES_CONVERGED) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
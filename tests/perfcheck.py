@@ -0,0 +1,476 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+#-------------------------------------------------------------------------------
+
+# This file is part of Code_Saturne, a general-purpose CFD tool.
+#
+# Copyright (C) 1998-2021 EDF S.A.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 2 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+# Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#-------------------------------------------------------------------------------
+
+"""
+Performance regression check.
+
+Small cases on a cartesian mesh are created and run using an installed
+code_saturne build. For each case, the timer statistics ("timer_stats.csv")
+are summed over time steps and a throughput (cells x iterations / s) is
+computed. Results are compared to those recorded in a baseline file,
+and cases whose throughput drops (or whose main timer statistics increase)
+beyond a given tolerance are flagged.
+
+Use "--update" to record the current results as the new baseline.
+"""
+
+#-------------------------------------------------------------------------------
+# Library modules import
+#-------------------------------------------------------------------------------
+
+import argparse
+import csv
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+#-------------------------------------------------------------------------------
+# User source templates (@NX@ is replaced by the number of cells per direction,
+# @NT@ by the number of time steps)
+#-------------------------------------------------------------------------------
+
+_src_header = """\
+#include "cs_defs.h"
+
+#include <math.h>
+
+#include "cs_headers.h"
+
+BEGIN_C_DECLS
+
+"""
+
+_src_footer = """\
+
+END_C_DECLS
+"""
+
+_mesh_src = """\
+void
+cs_user_mesh_cartesian_define(void)
+{
+  int nxyz[3] = {@NX@, @NX@, @NX@};
+  cs_real_t xyz[6] = {0., 0., 0., 1., 1., 1.};
+
+  cs_mesh_cartesian_define_simple(nxyz, xyz);
+}
+"""
+
+_model_src = """\
+void
+cs_user_model(void)
+{
+  cs_turb_model_t *turb_model = cs_get_glob_turb_model();
+  turb_model->iturb = CS_TURB_NONE;
+@MODEL@}
+
+void
+cs_user_parameters(cs_domain_t  *domain)
+{
+  domain->time_step->dt_ref = 0.01;
+  domain->time_step->nt_max = @NT@;
+}
+"""
+
+_init_src = """\
+void
+cs_user_initialization(cs_domain_t  *domain)
+{
+  const cs_mesh_t *m = domain->mesh;
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)domain->mesh_quantities->cell_cen;
+
+  cs_real_3_t *vel = (cs_real_3_t *)CS_F_(vel)->val;
+  cs_field_t *f = cs_field_by_name_try("scalar1");
+
+  /* Taylor-Green type vortex, compatible with walls */
+
+  for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
+    cs_real_t x = cell_cen[c_id][0], y = cell_cen[c_id][1];
+    vel[c_id][0] =  sin(cs_math_pi*x) * cos(cs_math_pi*y);
+    vel[c_id][1] = -cos(cs_math_pi*x) * sin(cs_math_pi*y);
+    vel[c_id][2] = 0.;
+  }
+
+  if (f != NULL) {
+    for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
+      cs_real_t r2 = 0;
+      for (int i = 0; i < 3; i++)
+        r2 += (cell_cen[c_id][i] - 0.3)*(cell_cen[c_id][i] - 0.3);
+      f->val[c_id] = exp(-r2/0.01);
+    }
+  }
+}
+"""
+
+_lagr_src = """\
+void
+cs_user_lagr_model(void)
+{
+  cs_glob_lagr_time_scheme->iilagr = CS_LAGR_ONEWAY_COUPLING;
+  cs_glob_lagr_model->physical_model = CS_LAGR_PHYS_OFF;
+}
+
+void
+cs_user_lagr_volume_conditions(void)
+{
+  cs_lagr_zone_data_t *lagr_vol_conds = cs_lagr_get_volume_conditions();
+
+  const cs_zone_t *z = cs_volume_zone_by_id(0);
+
+  cs_lagr_injection_set_t *zis
+    = cs_lagr_get_injection_set(lagr_vol_conds, z->id, 0);
+
+  zis->n_inject = @NP@;
+  zis->injection_frequency = 1;
+  zis->velocity_profile = -1;
+  zis->stat_weight = 1.0;
+  zis->diameter = 5e-6;
+  zis->diameter_variance = 1e-6;
+  zis->density = 2475.;
+  zis->fouling_index = 100.0;
+}
+"""
+
+#-------------------------------------------------------------------------------
+# Mini-case definitions
+#-------------------------------------------------------------------------------
+
+_cases = {
+    'poisson':
+        {'description': 'laminar flow, pressure Poisson solve dominant',
+         'model': '',
+         'lagrangian': False},
+    'scalar':
+        {'description': 'laminar flow with transported scalar',
+         'model': '  cs_parameters_add_variable("scalar1", 1);\n',
+         'lagrangian': False},
+    'lagrangian':
+        {'description': 'laminar flow with one-way Lagrangian tracking',
+         'model': '',
+         'lagrangian': True},
+}
+
+#-------------------------------------------------------------------------------
+# Process command line
+#-------------------------------------------------------------------------------
+
+def process_cmd_line(argv):
+    """
+    Process the passed command line arguments.
+    """
+
+    parser = argparse.ArgumentParser(description="Check for performance "
+                                     "regressions on small cases.")
+
+    parser.add_argument("--code-saturne", dest="code_saturne", type=str,
+                        default="code_saturne",
+                        help="path to code_saturne command")
+
+    parser.add_argument("-b", "--baseline", dest="baseline", type=str,
+                        default="perfcheck_baseline.json",
+                        help="baseline file (default: %(default)s)")
+
+    parser.add_argument("-u", "--update", dest="update",
+                        action="store_true",
+                        help="record current results as new baseline")
+
+    parser.add_argument("-t", "--tolerance", dest="tolerance", type=float,
+                        default=0.1,
+                        help="relative tolerance (default: %(default)s)")
+
+    parser.add_argument("-c", "--case", dest="cases", type=str,
+                        action="append",
+                        help="case to run (default: all); choices: "
+                        + ", ".join(_cases.keys()))
+
+    parser.add_argument("-n", "--nprocs", dest="nprocs", type=int,
+                        default=1,
+                        help="number of MPI processes")
+
+    parser.add_argument("--nx", dest="nx", type=int, default=40,
+                        help="number of cells per direction "
+                        "(default: %(default)s)")
+
+    parser.add_argument("--nt", dest="nt", type=int, default=20,
+                        help="number of time steps (default: %(default)s)")
+
+    parser.add_argument("--dest", dest="dest", type=str, default=None,
+                        help="working directory (default: temporary, "
+                        "removed after run)")
+
+    options = parser.parse_args(argv)
+
+    if options.cases is None:
+        options.cases = list(_cases.keys())
+
+    for c in options.cases:
+        if c not in _cases:
+            parser.error("unknown case: " + c)
+
+    return options
+
+#-------------------------------------------------------------------------------
+# Case setup and run
+#-------------------------------------------------------------------------------
+
+def write_user_sources(src_dir, case, options):
+    """
+    Write user sources for a given mini-case.
+    """
+
+    c = _cases[case]
+
+    model = _model_src.replace('@MODEL@', c['model'])
+
+    sources = {'cs_user_mesh.c': _mesh_src,
+               'cs_user_parameters.c': model,
+               'cs_user_initialization.c': _init_src}
+    if c['lagrangian']:
+        n_p = max(1, (options.nx**3) // 10)
+        sources['cs_user_lagr_model.c'] = _lagr_src.replace('@NP@', str(n_p))
+
+    for name in sources:
+        s = _src_header + sources[name] + _src_footer
+        s = s.replace('@NX@', str(options.nx)).replace('@NT@', str(options.nt))
+        f = open(os.path.join(src_dir, name), 'w')
+        f.write(s)
+        f.close()
+
+
+def run_case(study_dir, case, options):
+    """
+    Create and run a mini-case; return path to its results directory
+    and elapsed wall-clock time.
+    """
+
+    cmd = [options.code_saturne, 'create', '-s', study_dir, '-c', case,
+           '--noref', '--quiet']
+    subprocess.check_call(cmd)
+
+    case_dir = os.path.join(study_dir, case)
+    write_user_sources(os.path.join(case_dir, 'SRC'), case, options)
+
+    run_id = 'perfcheck'
+    cmd = [options.code_saturne, 'run', '--case', case_dir,
+           '--id', run_id, '-n', str(options.nprocs), '--force']
+
+    t0 = time.time()
+    retval = subprocess.call(cmd)
+    t1 = time.time()
+
+    if retval != 0:
+        return None, t1 - t0
+
+    return os.path.join(case_dir, 'RESU', run_id), t1 - t0
+
+#-------------------------------------------------------------------------------
+# Results analysis
+#-------------------------------------------------------------------------------
+
+def read_timer_stats(resu_dir):
+    """
+    Read time plot of timer statistics, and return a dictionary of
+    times summed over time steps, and the number of time steps.
+    """
+
+    path = None
+    for root, dirs, files in os.walk(resu_dir):
+        if 'timer_stats.csv' in files:
+            path = os.path.join(root, 'timer_stats.csv')
+            break
+
+    stats = {}
+    n_steps = 0
+
+    if path is None:
+        return stats, n_steps
+
+    f = open(path, 'r')
+    reader = csv.reader(f)
+    labels = None
+    for row in reader:
+        row = [r.strip() for r in row]
+        if not row:
+            continue
+        if labels is None:
+            labels = row
+            for l in labels[1:]:
+                stats[l] = 0.
+            continue
+        n_steps += 1
+        for l, v in zip(labels[1:], row[1:]):
+            try:
+                stats[l] += float(v)
+            except ValueError:
+                pass
+    f.close()
+
+    return stats, n_steps
+
+
+def case_results(case, resu_dir, wall_time, options):
+    """
+    Compute metrics for a mini-case.
+    """
+
+    stats, n_steps = read_timer_stats(resu_dir)
+    if n_steps == 0:
+        n_steps = options.nt
+
+    n_cells = options.nx**3
+
+    # "total" is the label of the root timer statistic for operations
+
+    t_total = stats.get('total', 0.)
+    if t_total <= 0:
+        t_total = wall_time
+
+    return {'n_cells': n_cells,
+            'n_steps': n_steps,
+            'n_procs': options.nprocs,
+            'time': t_total,
+            'throughput': n_cells * n_steps / max(t_total, 1e-12),
+            'timer_stats': stats}
+
+
+def compare(case, result, base, tolerance):
+    """
+    Compare results to baseline; return list of regression messages.
+    """
+
+    msgs = []
+
+    for k in ('n_cells', 'n_steps', 'n_procs'):
+        if result[k] != base.get(k):
+            msgs.append('  %s: %s differs from baseline (%s vs. %s); '
+                        'not comparable' % (case, k, result[k], base.get(k)))
+            return msgs
+
+    r_tp = result['throughput']
+    b_tp = base['throughput']
+    if r_tp < b_tp * (1. - tolerance):
+        msgs.append('  %s: throughput %.4g cells.it/s, baseline %.4g (%+.1f%%)'
+                    % (case, r_tp, b_tp, 100.*(r_tp/b_tp - 1.)))
+
+    # Only check statistics representing a significant part of the time
+
+    b_total = max(base['time'], 1e-12)
+    b_stats = base.get('timer_stats', {})
+    for l in b_stats:
+        if l not in result['timer_stats'] or b_stats[l] < 0.05*b_total:
+            continue
+        r_t = result['timer_stats'][l]
+        if r_t > b_stats[l] * (1. + tolerance):
+            msgs.append('  %s: "%s" time %.4g s, baseline %.4g s (%+.1f%%)'
+                        % (case, l, r_t, b_stats[l],
+                           100.*(r_t/b_stats[l] - 1.)))
+
+    return msgs
+
+#-------------------------------------------------------------------------------
+# Main function
+#-------------------------------------------------------------------------------
+
+def main(argv):
+    """
+    Run mini-cases, compare to baseline and/or update it.
+    Return 1 if regressions are detected, 0 otherwise.
+    """
+
+    options = process_cmd_line(argv)
+
+    baseline = {}
+    if os.path.isfile(options.baseline):
+        f = open(options.baseline, 'r')
+        baseline = json.load(f)
+        f.close()
+
+    if options.dest:
+        work_dir = os.path.abspath(options.dest)
+        if not os.path.isdir(work_dir):
+            os.makedirs(work_dir)
+    else:
+        work_dir = tempfile.mkdtemp(prefix='cs_perfcheck_')
+
+    study_dir = os.path.join(work_dir, 'PERFCHECK')
+
+    results = {}
+    failed = []
+
+    for case in options.cases:
+        print('Running case "%s" (%s)' % (case, _cases[case]['description']))
+        resu_dir, wall_time = run_case(study_dir, case, options)
+        if resu_dir is None:
+            failed.append(case)
+            continue
+        results[case] = case_results(case, resu_dir, wall_time, options)
+        print('  throughput: %.4g cells.it/s'
+              % results[case]['throughput'])
+
+    if not options.dest:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+    regressions = []
+    for case in results:
+        if case in baseline:
+            regressions += compare(case, results[case], baseline[case],
+                                   options.tolerance)
+        else:
+            print('  %s: no baseline' % case)
+
+    if options.update:
+        baseline.update(results)
+        f = open(options.baseline, 'w')
+        json.dump(baseline, f, indent=2, sort_keys=True)
+        f.close()
+        print('Baseline updated: ' + options.baseline)
+
+    for case in failed:
+        print('  %s: run failed' % case)
+
+    if regressions:
+        print('\nPerformance regressions (tolerance %g%%):'
+              % (100.*options.tolerance))
+        for m in regressions:
+            print(m)
+
+    if regressions or failed:
+        return 1
+
+    return 0
+
+#-------------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
+
+#-------------------------------------------------------------------------------
+# End
+#-------------------------------------------------------------------------------